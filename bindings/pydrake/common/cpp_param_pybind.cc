@@ -31,10 +31,17 @@ Object& Object::operator=(Object&& other) {
   other.ptr_ = nullptr;
   return *this;
 }
+// The GIL might have been released by the calling binding (e.g. an Object
+// is copied when the context of a simulation is cloned), so we reacquire it.
+// Objects that outlive the interpreter are leaked.
 void Object::inc_ref() {
+  if (ptr_ == nullptr || !Py_IsInitialized()) return;
+  py::gil_scoped_acquire guard;
   py::handle(ptr_).inc_ref();
 }
 void Object::dec_ref() {
+  if (ptr_ == nullptr || !Py_IsInitialized()) return;
+  py::gil_scoped_acquire guard;
   py::handle(ptr_).dec_ref();
 }
 
@@ -289,7 +289,8 @@ void DefineGeometryOptimization(py::module m) {
       });
 
   m.def("Iris", &Iris, py::arg("obstacles"), py::arg("sample"),
-      py::arg("domain"), py::arg("options") = IrisOptions(), doc.Iris.doc);
+      py::arg("domain"), py::arg("options") = IrisOptions(), py_gil_release(),
+      doc.Iris.doc);
 
   m.def("MakeIrisObstacles", &MakeIrisObstacles, py::arg("query_object"),
       py::arg("reference_frame") = std::nullopt, doc.MakeIrisObstacles.doc);
@@ -299,7 +300,7 @@ void DefineGeometryOptimization(py::module m) {
           const systems::Context<double>&, const IrisOptions&>(
           &IrisInConfigurationSpace),
       py::arg("plant"), py::arg("context"), py::arg("options") = IrisOptions(),
-      doc.IrisInConfigurationSpace.doc);
+      py_gil_release(), doc.IrisInConfigurationSpace.doc);
 
   // GraphOfConvexSets
   {
@@ -232,17 +232,17 @@ void DoScalarIndependentDefinitions(py::module m) {
         .def("RenderColorImage",
             static_cast<void (Class::*)(ColorRenderCamera const&, ImageRgba8U*)
                     const>(&Class::RenderColorImage),
-            py::arg("camera"), py::arg("color_image_out"),
+            py::arg("camera"), py::arg("color_image_out"), py_gil_release(),
             cls_doc.RenderColorImage.doc)
         .def("RenderDepthImage",
             static_cast<void (Class::*)(DepthRenderCamera const&,
                 ImageDepth32F*) const>(&Class::RenderDepthImage),
-            py::arg("camera"), py::arg("depth_image_out"),
+            py::arg("camera"), py::arg("depth_image_out"), py_gil_release(),
             cls_doc.RenderDepthImage.doc)
         .def("RenderLabelImage",
             static_cast<void (Class::*)(ColorRenderCamera const&,
                 ImageLabel16I*) const>(&Class::RenderLabelImage),
-            py::arg("camera"), py::arg("label_image_out"),
+            py::arg("camera"), py::arg("label_image_out"), py_gil_release(),
             cls_doc.RenderLabelImage.doc)
         .def("default_render_label",
             static_cast<RenderLabel (Class::*)() const>(
@@ -313,7 +313,10 @@ void DoScalarIndependentDefinitions(py::module m) {
         .def_readwrite("default_diffuse", &Class::default_diffuse,
             cls_doc.default_diffuse.doc)
         .def_readwrite("default_clear_color", &Class::default_clear_color,
-            cls_doc.default_clear_color.doc);
+            cls_doc.default_clear_color.doc)
+        .def_readwrite("pipelined_readback", &Class::pipelined_readback,
+            cls_doc.pipelined_readback.doc)
+        .def_readwrite("backend", &Class::backend, cls_doc.backend.doc);
   }
 
   m.def("MakeRenderEngineGl", &MakeRenderEngineGl,
@@ -364,6 +364,10 @@ void DoScalarDependentDefinitions(py::module m, T) {
             &QueryObject<T>::ComputeSignedDistanceToPoint, py::arg("p_WQ"),
             py::arg("threshold") = std::numeric_limits<double>::infinity(),
             cls_doc.ComputeSignedDistanceToPoint.doc)
+        .def("ComputeSignedDistanceToPoints",
+            &QueryObject<T>::ComputeSignedDistanceToPoints, py::arg("p_WQs"),
+            py::arg("threshold") = std::numeric_limits<double>::infinity(),
+            cls_doc.ComputeSignedDistanceToPoints.doc)
         .def("FindCollisionCandidates",
             &QueryObject<T>::FindCollisionCandidates,
             cls_doc.FindCollisionCandidates.doc)
@@ -380,7 +384,7 @@ void DoScalarDependentDefinitions(py::module m, T) {
               return img;
             },
             py::arg("camera"), py::arg("parent_frame"), py::arg("X_PC"),
-            cls_doc.RenderColorImage.doc)
+            py_gil_release(), cls_doc.RenderColorImage.doc)
         .def(
             "RenderDepthImage",
             [](const Class* self, const render::DepthRenderCamera& camera,
@@ -392,7 +396,7 @@ void DoScalarDependentDefinitions(py::module m, T) {
               return img;
             },
             py::arg("camera"), py::arg("parent_frame"), py::arg("X_PC"),
-            cls_doc.RenderDepthImage.doc)
+            py_gil_release(), cls_doc.RenderDepthImage.doc)
         .def(
             "RenderLabelImage",
             [](const Class* self, const render::ColorRenderCamera& camera,
@@ -404,7 +408,7 @@ void DoScalarDependentDefinitions(py::module m, T) {
               return img;
             },
             py::arg("camera"), py::arg("parent_frame"), py::arg("X_PC"),
-            cls_doc.RenderLabelImage.doc);
+            py_gil_release(), cls_doc.RenderLabelImage.doc);
 
     if constexpr (scalar_predicate<T>::is_bool) {
       cls  // BR
@@ -474,6 +478,27 @@ void DoScalarDependentDefinitions(py::module m, T) {
             doc.SignedDistanceToPoint.grad_W.doc);
   }
 
+  // SignedDistanceToPoints
+  {
+    using Class = SignedDistanceToPoints<T>;
+    constexpr auto& cls_doc = doc.SignedDistanceToPoints;
+    auto cls = DefineTemplateClassWithDefault<Class>(
+        m, "SignedDistanceToPoints", param, cls_doc.doc);
+    cls  // BR
+        .def(ParamInit<Class>())
+        .def("num_points", &Class::num_points, cls_doc.num_points.doc)
+        .def("num_results", &Class::num_results, cls_doc.num_results.doc)
+        .def("result", &Class::result, py::arg("k"), cls_doc.result.doc)
+        .def_readwrite("offsets", &Class::offsets, cls_doc.offsets.doc)
+        .def_readwrite("id_G", &Class::id_G, cls_doc.id_G.doc)
+        .def_readwrite("p_GN", &Class::p_GN,
+            return_value_policy_for_scalar_type<T>(), cls_doc.p_GN.doc)
+        .def_readwrite("distance", &Class::distance,
+            return_value_policy_for_scalar_type<T>(), cls_doc.distance.doc)
+        .def_readwrite("grad_W", &Class::grad_W,
+            return_value_policy_for_scalar_type<T>(), cls_doc.grad_W.doc);
+  }
+
   // PenetrationAsPointPair
   {
     using Class = PenetrationAsPointPair<T>;
@@ -8,6 +8,7 @@
 #include "drake/geometry/drake_visualizer.h"
 #include "drake/geometry/meshcat.h"
 #include "drake/geometry/meshcat_animation.h"
+#include "drake/geometry/meshcat_animation_recorder.h"
 #include "drake/geometry/meshcat_point_cloud_visualizer.h"
 #include "drake/geometry/meshcat_visualizer.h"
 
@@ -95,6 +96,12 @@ MeshcatPointCloudVisualizer.  See #13038.)""")
             cls_doc.set_point_size.doc)
         .def("set_default_rgba", &Class::set_default_rgba,
             cls_doc.set_default_rgba.doc)
+        .def("set_voxel_size", &Class::set_voxel_size, py::arg("voxel_size"),
+            cls_doc.set_voxel_size.doc)
+        .def("set_quantize", &Class::set_quantize, py::arg("quantize"),
+            cls_doc.set_quantize.doc)
+        .def("set_max_update_rate", &Class::set_max_update_rate,
+            py::arg("max_update_rate"), cls_doc.set_max_update_rate.doc)
         .def("Delete", &Class::Delete, cls_doc.Delete.doc)
         .def("cloud_input_port", &Class::cloud_input_port,
             py_rvp::reference_internal, cls_doc.cloud_input_port.doc)
@@ -122,6 +129,10 @@ MeshcatVisualizer.  See #13038.)""")
         .def("StartRecording", &Class::StartRecording,
             py::arg("set_transforms_while_recording") = true,
             py_rvp::reference_internal, cls_doc.StartRecording.doc)
+        .def("StartRecordingToFile", &Class::StartRecordingToFile,
+            py::arg("filename"), py::arg("decimation") = 1,
+            py::arg("set_transforms_while_recording") = true,
+            py_rvp::reference_internal, cls_doc.StartRecordingToFile.doc)
         .def("StopRecording", &Class::StopRecording, cls_doc.StopRecording.doc)
         .def("PublishRecording", &Class::PublishRecording,
             cls_doc.PublishRecording.doc)
@@ -177,15 +188,19 @@ void DoScalarIndependentDefinitions(py::module m) {
         .def_readwrite("show_hydroelastic",
             &DrakeVisualizerParams::show_hydroelastic,
             cls_doc.show_hydroelastic.doc)
+        .def_readwrite("publish_changed_poses_only",
+            &DrakeVisualizerParams::publish_changed_poses_only,
+            cls_doc.publish_changed_poses_only.doc)
         .def("__repr__", [](const Class& self) {
           return py::str(
               "DrakeVisualizerParams("
               "publish_period={}, "
               "role={}, "
               "default_color={}, "
-              "show_hydroelastic={})")
+              "show_hydroelastic={}, "
+              "publish_changed_poses_only={})")
               .format(self.publish_period, self.role, self.default_color,
-                  self.show_hydroelastic);
+                  self.show_hydroelastic, self.publish_changed_poses_only);
         });
   }
 
@@ -233,9 +248,10 @@ void DoScalarIndependentDefinitions(py::module m) {
             py::arg("rgba") = Rgba(.9, .9, .9, 1.), cls_doc.SetObject.doc_shape)
         .def("SetObject",
             py::overload_cast<std::string_view, const perception::PointCloud&,
-                double, const Rgba&>(&Class::SetObject),
+                double, const Rgba&, bool>(&Class::SetObject),
             py::arg("path"), py::arg("cloud"), py::arg("point_size") = 0.001,
-            py::arg("rgba") = Rgba(.9, .9, .9, 1.), cls_doc.SetObject.doc_cloud)
+            py::arg("rgba") = Rgba(.9, .9, .9, 1.), py::arg("quantize") = false,
+            cls_doc.SetObject.doc_cloud)
         .def("SetObject",
             py::overload_cast<std::string_view,
                 const TriangleSurfaceMesh<double>&, const Rgba&, bool, double>(
@@ -273,6 +289,8 @@ void DoScalarIndependentDefinitions(py::module m) {
             py::overload_cast<std::string_view,
                 const Eigen::Ref<const Eigen::Matrix4d>&>(&Class::SetTransform),
             py::arg("path"), py::arg("matrix"), cls_doc.SetTransform.doc_matrix)
+        .def("SetTransforms", &Class::SetTransforms, py::arg("paths"),
+            py::arg("X_ParentPaths"), cls_doc.SetTransforms.doc)
         .def("Delete", &Class::Delete, py::arg("path") = "", cls_doc.Delete.doc)
         .def("SetProperty",
             py::overload_cast<std::string_view, std::string, bool>(
@@ -372,6 +390,44 @@ void DoScalarIndependentDefinitions(py::module m) {
             loop_doc.kLoopPingPong.doc);
   }
 
+  // MeshcatAnimationRecorder
+  {
+    using Class = MeshcatAnimationRecorder;
+    constexpr auto& cls_doc = doc.MeshcatAnimationRecorder;
+    py::class_<Class>(m, "MeshcatAnimationRecorder", cls_doc.doc)
+        .def(py::init<const std::string&, double, int>(), py::arg("filename"),
+            py::arg("frames_per_second") = 32.0, py::arg("decimation") = 1,
+            cls_doc.ctor.doc)
+        .def("frames_per_second", &Class::frames_per_second,
+            cls_doc.frames_per_second.doc)
+        .def("decimation", &Class::decimation, cls_doc.decimation.doc)
+        .def("start_time", &Class::start_time, cls_doc.start_time.doc)
+        .def("set_start_time", &Class::set_start_time, py::arg("time"),
+            cls_doc.set_start_time.doc)
+        .def("frame", &Class::frame, py::arg("time"), cls_doc.frame.doc)
+        .def("SetTransform", &Class::SetTransform, py::arg("frame"),
+            py::arg("path"), py::arg("X_ParentPath"), cls_doc.SetTransform.doc)
+        .def("SetProperty",
+            py::overload_cast<int, const std::string&, const std::string&,
+                bool>(&Class::SetProperty),
+            py::arg("frame"), py::arg("path"), py::arg("property"),
+            py::arg("value"), cls_doc.SetProperty.doc_bool)
+        .def("SetProperty",
+            py::overload_cast<int, const std::string&, const std::string&,
+                double>(&Class::SetProperty),
+            py::arg("frame"), py::arg("path"), py::arg("property"),
+            py::arg("value"), cls_doc.SetProperty.doc_double)
+        .def("SetProperty",
+            py::overload_cast<int, const std::string&, const std::string&,
+                const std::vector<double>&>(&Class::SetProperty),
+            py::arg("frame"), py::arg("path"), py::arg("property"),
+            py::arg("value"), cls_doc.SetProperty.doc_vector_double)
+        .def("Flush", &Class::Flush, cls_doc.Flush.doc)
+        .def("num_keyframes", &Class::num_keyframes, cls_doc.num_keyframes.doc)
+        .def_static("Load", &Class::Load, py::arg("filename"),
+            cls_doc.Load.doc);
+  }
+
   // MeshcatVisualizerParams
   {
     using Class = MeshcatVisualizerParams;
@@ -390,6 +446,12 @@ void DoScalarIndependentDefinitions(py::module m) {
         .def_readwrite("delete_on_initialization_event",
             &MeshcatVisualizerParams::delete_on_initialization_event,
             cls_doc.delete_on_initialization_event.doc)
+        .def_readwrite("translation_tolerance",
+            &MeshcatVisualizerParams::translation_tolerance,
+            cls_doc.translation_tolerance.doc)
+        .def_readwrite("rotation_tolerance",
+            &MeshcatVisualizerParams::rotation_tolerance,
+            cls_doc.rotation_tolerance.doc)
         .def("__repr__", [](const Class& self) {
           return py::str(
               "MeshcatVisualizerParams("
@@ -397,9 +459,12 @@ void DoScalarIndependentDefinitions(py::module m) {
               "role={}, "
               "default_color={}, "
               "prefix={}, "
-              "delete_on_initialization_event={}")
+              "delete_on_initialization_event={}, "
+              "translation_tolerance={}, "
+              "rotation_tolerance={})")
               .format(self.publish_period, self.role, self.default_color,
-                  self.prefix, self.delete_on_initialization_event);
+                  self.prefix, self.delete_on_initialization_event,
+                  self.translation_tolerance, self.rotation_tolerance);
         });
   }
 }
@@ -46,6 +46,28 @@ PYBIND11_MODULE(lcm, m) {
             py::arg("timeout_millis"), cls_doc.HandleSubscriptions.doc);
   }
 
+  {
+    using Enum = LcmQueueDropPolicy;
+    constexpr auto& enum_doc = doc.LcmQueueDropPolicy;
+    py::enum_<Enum>(m, "LcmQueueDropPolicy", enum_doc.doc)
+        .value("kDropOldest", Enum::kDropOldest, enum_doc.kDropOldest.doc)
+        .value("kDropNewest", Enum::kDropNewest, enum_doc.kDropNewest.doc);
+  }
+
+  {
+    using Class = DrakeLcmReceiveStatistics;
+    constexpr auto& cls_doc = doc.DrakeLcmReceiveStatistics;
+    py::class_<Class>(m, "DrakeLcmReceiveStatistics", cls_doc.doc)
+        .def(py::init<>())
+        .def_readonly(
+            "num_received", &Class::num_received, cls_doc.num_received.doc)
+        .def_readonly(
+            "num_dropped", &Class::num_dropped, cls_doc.num_dropped.doc)
+        .def_readonly(
+            "num_handled", &Class::num_handled, cls_doc.num_handled.doc)
+        .def_readonly("num_queued", &Class::num_queued, cls_doc.num_queued.doc);
+  }
+
   {
     using Class = DrakeLcm;
     constexpr auto& cls_doc = doc.DrakeLcm;
@@ -67,7 +89,12 @@ PYBIND11_MODULE(lcm, m) {
               // This is already the default, but for clarity we'll repeat it.
               subscription->set_unsubscribe_on_delete(false);
             },
-            py::arg("channel"), py::arg("handler"), cls_doc.Subscribe.doc);
+            py::arg("channel"), py::arg("handler"), cls_doc.Subscribe.doc)
+        .def("StartReceiveThread", &Class::StartReceiveThread,
+            py::arg("drop_policy") = LcmQueueDropPolicy::kDropOldest,
+            cls_doc.StartReceiveThread.doc)
+        .def("get_receive_statistics", &Class::get_receive_statistics,
+            cls_doc.get_receive_statistics.doc);
     // TODO(eric.cousineau): Add remaining methods.
   }
 
@@ -118,7 +118,20 @@ void init_perception(py::module m) {
             [](PointCloud* self, const PointCloud& other) {
               self->SetFrom(other);
             },
-            py::arg("other"), cls_doc.SetFrom.doc);
+            py::arg("other"), cls_doc.SetFrom.doc)
+        // Processing.
+        .def("Crop", &Class::Crop, py::arg("lower_xyz"), py::arg("upper_xyz"),
+            cls_doc.Crop.doc)
+        .def("VoxelizedDownSample", &Class::VoxelizedDownSample,
+            py::arg("voxel_size"), cls_doc.VoxelizedDownSample.doc)
+        .def(
+            "EstimateNormals",
+            [](PointCloud* self, double radius, int num_closest,
+                bool parallelize) {
+              return self->EstimateNormals(radius, num_closest, parallelize);
+            },
+            py::arg("radius"), py::arg("num_closest"),
+            py::arg("parallelize") = false, cls_doc.EstimateNormals.doc);
   }
 
   AddValueInstantiation<PointCloud>(m);
@@ -424,6 +424,34 @@ of raw pointers / references in the public C++ API (rather than
 static / free functions, we instead explicitly spell out `py_rvp::reference`
 and `py::keep_alive<0, 1>()`.
 
+@anchor PydrakeGil
+## Global Interpreter Lock
+
+Python threads only run concurrently while none of them holds the Global
+Interpreter Lock (GIL). By default, a bound function holds the GIL for its full
+duration, so a C++ function that runs for a long time (e.g.
+`Simulator::AdvanceTo()`, `Solve()`, a render call) should instead release it,
+with @ref drake::pydrake::py_gil_release "py_gil_release":
+
+```
+.def("AdvanceTo", &Simulator<T>::AdvanceTo, py::arg("boundary_time"),
+    py_gil_release(), doc.Simulator.AdvanceTo.doc)
+```
+
+The arguments and the return value are still converted while holding the GIL.
+While it is released, the C++ code must not touch Python objects without
+reacquiring it (with `py::gil_scoped_acquire`). The following already do so:
+- overrides of virtual methods implemented in Python (e.g. the methods of a
+  Python `LeafSystem`), through the `PYBIND11_OVERLOAD*` macros;
+- Python callables passed as `std::function`, e.g. the calculation callbacks
+  of a Python `LeafSystem` or a simulator monitor;
+- `pydrake::Object`, which holds the Python values of `AbstractValue`s.
+
+Do not release the GIL in a function that may destroy an object that was
+created in Python and whose ownership was transferred to C++ (e.g.
+`MonteCarloSimulation()`, which destroys the simulators made by its Python
+factory), since such destructors touch Python objects.
+
 @anchor PydrakeOverloads
 ## Function Overloads
 
@@ -32,6 +32,11 @@ namespace py = pybind11;
 /// the @ref PydrakeReturnValuePolicy "Return Value Policy" section.
 using py_rvp = py::return_value_policy;
 
+/// Use this as an extra argument to `def()` for a long-running C++ function, so
+/// that other Python threads may run while it does. For more information, see
+/// the @ref PydrakeGil "Global Interpreter Lock" section.
+using py_gil_release = py::call_guard<py::gil_scoped_release>;
+
 /// Use this when you must do manual casting - e.g. lists or tuples of nurses,
 /// where the container may get discarded but the items kept. Prefer this over
 /// `py::cast(obj, reference_internal, parent)` (pending full resolution of
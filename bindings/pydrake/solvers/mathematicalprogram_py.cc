@@ -402,7 +402,7 @@ void BindSolverInterfaceAndFlags(py::module m) {
             self.Solve(prog, initial_guess, solver_options, result);
           },
           py::arg("prog"), py::arg("initial_guess"), py::arg("solver_options"),
-          py::arg("result"), doc.SolverInterface.Solve.doc)
+          py::arg("result"), py_gil_release(), doc.SolverInterface.Solve.doc)
       .def(
           "Solve",
           // This method really lives on SolverBase, but we manually write it
@@ -415,7 +415,8 @@ void BindSolverInterfaceAndFlags(py::module m) {
             return result;
           },
           py::arg("prog"), py::arg("initial_guess") = std::nullopt,
-          py::arg("solver_options") = std::nullopt, doc.SolverBase.Solve.doc)
+          py::arg("solver_options") = std::nullopt, py_gil_release(),
+          doc.SolverBase.Solve.doc)
       // TODO(m-chaturvedi) Add Pybind11 documentation.
       .def("solver_type",
           [](const SolverInterface& self) {
@@ -518,14 +519,18 @@ void BindSolverInterfaceAndFlags(py::module m) {
       .def("get_print_file_name", &SolverOptions::get_print_file_name,
           doc.SolverOptions.get_print_file_name.doc)
       .def("get_print_to_console", &SolverOptions::get_print_to_console,
-          doc.SolverOptions.get_print_to_console.doc);
+          doc.SolverOptions.get_print_to_console.doc)
+      .def("get_presolve", &SolverOptions::get_presolve,
+          doc.SolverOptions.get_presolve.doc);
 
   py::enum_<CommonSolverOption>(
       m, "CommonSolverOption", doc.CommonSolverOption.doc)
       .value("kPrintFileName", CommonSolverOption::kPrintFileName,
           doc.CommonSolverOption.kPrintFileName.doc)
       .value("kPrintToConsole", CommonSolverOption::kPrintToConsole,
-          doc.CommonSolverOption.kPrintToConsole.doc);
+          doc.CommonSolverOption.kPrintToConsole.doc)
+      .value("kPresolve", CommonSolverOption::kPresolve,
+          doc.CommonSolverOption.kPresolve.doc);
 }
 
 void BindMathematicalProgram(py::module m) {
@@ -2003,7 +2008,8 @@ void BindFreeFunctions(py::module m) {
               const std::optional<Eigen::VectorXd>&,
               const std::optional<SolverOptions>&>(&solvers::Solve),
           py::arg("prog"), py::arg("initial_guess") = py::none(),
-          py::arg("solver_options") = py::none(), doc.Solve.doc_3args)
+          py::arg("solver_options") = py::none(), py_gil_release(),
+          doc.Solve.doc_3args)
       .def("GetProgramType", &solvers::GetProgramType, doc.GetProgramType.doc)
       // The following Solve() methods are placed here to be in the
       // mathematicalprogram module, so as not to provide a conflicting Solve
@@ -31,7 +31,8 @@ class PySerializer(SerializerInterface):
 
 
 @staticmethod
-def _make_lcm_subscriber(channel, lcm_type, lcm, use_cpp_serializer=False):
+def _make_lcm_subscriber(channel, lcm_type, lcm, use_cpp_serializer=False,
+                         *, handoff=LcmSubscriberHandoff.kLocked):
     """Convenience to create an LCM subscriber system with a concrete type.
 
     Args:
@@ -41,6 +42,8 @@ def _make_lcm_subscriber(channel, lcm_type, lcm, use_cpp_serializer=False):
         use_cpp_serializer: Use C++ serializer to interface with LCM converter
             systems that are implemented in C++. LCM types must be registered
             in C++ via `BindCppSerializer`.
+        handoff: How received messages are handed over to the system; see
+            LcmSubscriberHandoff.
     """
     # TODO(eric.cousineau): Make `use_cpp_serializer` be kwarg-only.
     # N.B. This documentation is actually public, as it is assigned to classes
@@ -49,7 +52,7 @@ def _make_lcm_subscriber(channel, lcm_type, lcm, use_cpp_serializer=False):
         serializer = PySerializer(lcm_type)
     else:
         serializer = _Serializer_[lcm_type]()
-    return LcmSubscriberSystem(channel, serializer, lcm)
+    return LcmSubscriberSystem(channel, serializer, lcm, handoff)
 
 
 @staticmethod
@@ -15,6 +15,7 @@
 #include "drake/systems/analysis/simulator_config.h"
 #include "drake/systems/analysis/simulator_config_functions.h"
 #include "drake/systems/analysis/simulator_print_stats.h"
+#include "drake/systems/analysis/vectorized_simulator.h"
 
 using std::unique_ptr;
 
@@ -158,11 +159,11 @@ PYBIND11_MODULE(analysis, m) {
             py::keep_alive<3, 1>(), doc.Simulator.ctor.doc)
         .def("Initialize", &Simulator<T>::Initialize,
             doc.Simulator.Initialize.doc,
-            py::arg("params") = InitializeParams{})
+            py::arg("params") = InitializeParams{}, py_gil_release())
         .def("AdvanceTo", &Simulator<T>::AdvanceTo, py::arg("boundary_time"),
-            doc.Simulator.AdvanceTo.doc)
+            py_gil_release(), doc.Simulator.AdvanceTo.doc)
         .def("AdvancePendingEvents", &Simulator<T>::AdvancePendingEvents,
-            doc.Simulator.AdvancePendingEvents.doc)
+            py_gil_release(), doc.Simulator.AdvancePendingEvents.doc)
         .def("set_monitor", WrapCallbacks(&Simulator<T>::set_monitor),
             py::arg("monitor"), doc.Simulator.set_monitor.doc)
         .def("clear_monitor", &Simulator<T>::clear_monitor,
@@ -205,6 +206,49 @@ PYBIND11_MODULE(analysis, m) {
         .def("get_system", &Simulator<T>::get_system, py_rvp::reference,
             doc.Simulator.get_system.doc);
 
+    // Parallelism is not bound, so the constructor takes num_threads instead.
+    DefineTemplateClassWithDefault<VectorizedSimulator<T>>(
+        m, "VectorizedSimulator", GetPyParam<T>(), doc.VectorizedSimulator.doc)
+        .def(py::init([](const System<T>& system, int num_instances,
+                          double control_period, int num_threads) {
+          return std::make_unique<VectorizedSimulator<T>>(system,
+              num_instances, control_period, Parallelism(num_threads));
+        }),
+            py::arg("system"), py::arg("num_instances"),
+            py::arg("control_period"), py::arg("num_threads") = 1,
+            // Keep alive, reference: `self` keeps `system` alive.
+            py::keep_alive<1, 2>(), doc.VectorizedSimulator.ctor.doc)
+        .def("get_system", &VectorizedSimulator<T>::get_system,
+            py_rvp::reference, doc.VectorizedSimulator.get_system.doc)
+        .def("num_instances", &VectorizedSimulator<T>::num_instances,
+            doc.VectorizedSimulator.num_instances.doc)
+        .def("control_period", &VectorizedSimulator<T>::control_period,
+            doc.VectorizedSimulator.control_period.doc)
+        .def("get_simulator", &VectorizedSimulator<T>::get_simulator,
+            py::arg("i"), py_rvp::reference_internal,
+            doc.VectorizedSimulator.get_simulator.doc)
+        .def("get_mutable_simulator",
+            &VectorizedSimulator<T>::get_mutable_simulator, py::arg("i"),
+            py_rvp::reference_internal,
+            doc.VectorizedSimulator.get_mutable_simulator.doc)
+        .def("get_context", &VectorizedSimulator<T>::get_context, py::arg("i"),
+            py_rvp::reference_internal, doc.VectorizedSimulator.get_context.doc)
+        .def("get_mutable_context",
+            &VectorizedSimulator<T>::get_mutable_context, py::arg("i"),
+            py_rvp::reference_internal,
+            doc.VectorizedSimulator.get_mutable_context.doc)
+        .def("Initialize", &VectorizedSimulator<T>::Initialize,
+            py_gil_release(), doc.VectorizedSimulator.Initialize.doc)
+        .def("Step", &VectorizedSimulator<T>::Step, py_gil_release(),
+            doc.VectorizedSimulator.Step.doc)
+        .def("FixVectorInputPortValues",
+            &VectorizedSimulator<T>::FixVectorInputPortValues, py::arg("port"),
+            py::arg("values"),
+            doc.VectorizedSimulator.FixVectorInputPortValues.doc)
+        .def("EvalVectorOutputPort",
+            &VectorizedSimulator<T>::EvalVectorOutputPort, py::arg("port"),
+            py_gil_release(), doc.VectorizedSimulator.EvalVectorOutputPort.doc);
+
     m  // BR
         .def("ApplySimulatorConfig", &ApplySimulatorConfig<T>,
             py::arg("simulator"), py::arg("config"),
@@ -279,7 +323,9 @@ PYBIND11_MODULE(analysis, m) {
 
     // Note: parallel simulation must be disabled in the binding via
     // num_parallel_executions=kNoConcurrency, since parallel execution of
-    // Python systems in multiple threads is not supported.
+    // Python systems in multiple threads is not supported. These functions also
+    // hold the GIL (see @ref PydrakeGil), since they destroy the simulators
+    // made by `make_simulator`, which may own Python systems.
     m.def("MonteCarloSimulation",
         WrapCallbacks([](const SimulatorFactory make_simulator,
                           const ScalarSystemFunction& output, double final_time,
@@ -245,12 +245,14 @@ struct Impl {
       // https://github.com/pybind/pybind11/pull/1152#issuecomment-340091423
       // TODO(eric.cousineau): This will be resolved once dtype=custom is
       // resolved.
-      PYBIND11_OVERLOAD_INT(void, VectorSystem<T>, "DoCalcVectorOutput",
-          // N.B. Passing `Eigen::Map<>` derived classes by reference rather
-          // than pointer to ensure conceptual clarity. pybind11 `type_caster`
-          // struggles with types of `Map<Derived>*`, but not `Map<Derived>&`.
-          &context, input, state, ToEigenRef(output));
-      // If the macro did not return, use default functionality.
+      // N.B. Passing `Eigen::Map<>` derived classes by reference rather than
+      // pointer to ensure conceptual clarity. pybind11 `type_caster` struggles
+      // with types of `Map<Derived>*`, but not `Map<Derived>&`.
+      if (CallOverload(&output_overload_, context, input, state,
+              ToEigenRef(output))) {
+        return;
+      }
+      // If there was no override, use default functionality.
       Base::DoCalcVectorOutput(context, input, state, output);
     }
 
@@ -260,11 +262,12 @@ struct Impl {
         Eigen::VectorBlock<VectorX<T>>* derivatives) const override {
       // WARNING: Mutating `derivatives` will not work when T is AutoDiffXd,
       // Expression, etc. See above.
-      PYBIND11_OVERLOAD_INT(void, VectorSystem<T>,
-          "DoCalcVectorTimeDerivatives", &context, input, state,
-          ToEigenRef(derivatives));
-      // If the macro did not return, use default functionality.
-      Base::DoCalcVectorOutput(context, input, state, derivatives);
+      if (CallOverload(&derivatives_overload_, context, input, state,
+              ToEigenRef(derivatives))) {
+        return;
+      }
+      // If there was no override, use default functionality.
+      Base::DoCalcVectorTimeDerivatives(context, input, state, derivatives);
     }
 
     void DoCalcVectorDiscreteVariableUpdates(const Context<T>& context,
@@ -273,13 +276,76 @@ struct Impl {
         Eigen::VectorBlock<VectorX<T>>* next_state) const override {
       // WARNING: Mutating `next_state` will not work when T is AutoDiffXd,
       // Expression, etc. See above.
-      PYBIND11_OVERLOAD_INT(void, VectorSystem<T>,
-          "DoCalcVectorDiscreteVariableUpdates", &context, input, state,
-          ToEigenRef(next_state));
-      // If the macro did not return, use default functionality.
+      if (CallOverload(&discrete_overload_, context, input, state,
+              ToEigenRef(next_state))) {
+        return;
+      }
+      // If there was no override, use default functionality.
       Base::DoCalcVectorDiscreteVariableUpdates(
           context, input, state, next_state);
     }
+
+   private:
+    // The Python override of one of the methods above, looked up once rather
+    // than on every call (as PYBIND11_OVERLOAD_INT would do); these methods
+    // are called at every output evaluation or integrator step. The vectors
+    // are passed to the override as NumPy views, without any wrapper objects.
+    struct OverloadCache {
+      explicit OverloadCache(const char* name_in) : name(name_in) {}
+
+      ~OverloadCache() {
+        // The system may be destroyed from C++ without the GIL held.
+        if (function && Py_IsInitialized()) {
+          py::gil_scoped_acquire guard;
+          function = py::object();
+        }
+      }
+
+      const char* const name;
+      bool looked_up{false};
+      // The unbound function (i.e., the method's `__func__`), so as to not
+      // form a reference cycle with the Python instance of this system.
+      // When the override can't be unbound (e.g., it was assigned to the
+      // instance), this stays null and the lookup is repeated on each call.
+      py::object function;
+      bool has_override{false};
+    };
+
+    // Calls the Python override cached in `cache` (if any) with `args`, and
+    // returns whether there was one.
+    template <typename... Args>
+    bool CallOverload(OverloadCache* cache, Args&&... args) const {
+      py::gil_scoped_acquire guard;
+      const VectorSystem<T>* self = this;
+      if (cache->function) {
+        cache->function(
+            py::cast(self, py_rvp::reference), std::forward<Args>(args)...);
+        return true;
+      }
+      if (cache->looked_up && !cache->has_override) {
+        return false;
+      }
+      py::function overload = py::get_overload(self, cache->name);
+      if (!cache->looked_up) {
+        cache->looked_up = true;
+        cache->has_override = static_cast<bool>(overload);
+        if (overload && py::hasattr(overload, "__func__") &&
+            py::hasattr(overload, "__self__") &&
+            overload.attr("__self__").is(py::cast(self, py_rvp::reference))) {
+          cache->function = overload.attr("__func__");
+        }
+      }
+      if (!overload) {
+        return false;
+      }
+      overload(std::forward<Args>(args)...);
+      return true;
+    }
+
+    mutable OverloadCache output_overload_{"DoCalcVectorOutput"};
+    mutable OverloadCache derivatives_overload_{"DoCalcVectorTimeDerivatives"};
+    mutable OverloadCache discrete_overload_{
+        "DoCalcVectorDiscreteVariableUpdates"};
   };
 
   class PySystemVisitor : public py::wrapper<SystemVisitor<T>> {
@@ -65,9 +65,15 @@ class PySerializerInterface : public py::wrapper<SerializerInterface> {
       PYBIND11_OVERLOAD_PURE(
           py::bytes, SerializerInterface, Serialize, &abstract_value);
     };
-    std::string str = wrapped();
-    message_bytes->resize(str.size());
-    std::copy(str.data(), str.data() + str.size(), message_bytes->data());
+    // Copy straight out of the Python bytes object, without an intermediate
+    // std::string.
+    const py::bytes bytes = wrapped();
+    char* data{};
+    Py_ssize_t size{};
+    if (PyBytes_AsStringAndSize(bytes.ptr(), &data, &size) != 0) {
+      throw py::error_already_set();
+    }
+    message_bytes->assign(data, data + size);
   }
 };
 
@@ -168,20 +174,30 @@ PYBIND11_MODULE(lcm, m) {
             py::keep_alive<1, 4>(), cls_doc.ctor.doc_4args);
   }
 
+  {
+    using Enum = LcmSubscriberHandoff;
+    constexpr auto& enum_doc = doc.LcmSubscriberHandoff;
+    py::enum_<Enum>(m, "LcmSubscriberHandoff", enum_doc.doc)
+        .value("kLocked", Enum::kLocked, enum_doc.kLocked.doc)
+        .value("kLockFree", Enum::kLockFree, enum_doc.kLockFree.doc);
+  }
+
   {
     using Class = LcmSubscriberSystem;
     constexpr auto& cls_doc = doc.LcmSubscriberSystem;
     py::class_<Class, LeafSystem<double>>(m, "LcmSubscriberSystem")
         .def(py::init<const std::string&, std::unique_ptr<SerializerInterface>,
-                 DrakeLcmInterface*>(),
+                 DrakeLcmInterface*, LcmSubscriberHandoff>(),
             py::arg("channel"), py::arg("serializer"), py::arg("lcm"),
+            py::arg("handoff") = LcmSubscriberHandoff::kLocked,
             // Keep alive, ownership: `serializer` keeps `self` alive.
             py::keep_alive<3, 1>(),
             // Keep alive, reference: `self` keeps `lcm` alive.
             py::keep_alive<1, 4>(), doc.LcmSubscriberSystem.ctor.doc)
         .def("WaitForMessage", &Class::WaitForMessage,
             py::arg("old_message_count"), py::arg("message") = nullptr,
-            py::arg("timeout") = -1, cls_doc.WaitForMessage.doc);
+            py::arg("timeout") = -1, cls_doc.WaitForMessage.doc)
+        .def("handoff", &Class::handoff, cls_doc.handoff.doc);
   }
 
   {
@@ -30,6 +30,7 @@
 #include "drake/systems/primitives/symbolic_vector_system.h"
 #include "drake/systems/primitives/trajectory_affine_system.h"
 #include "drake/systems/primitives/trajectory_linear_system.h"
+#include "drake/systems/primitives/trajectory_recorder.h"
 #include "drake/systems/primitives/trajectory_source.h"
 #include "drake/systems/primitives/vector_log_sink.h"
 #include "drake/systems/primitives/wrap_to_system.h"
@@ -441,6 +442,10 @@ PYBIND11_MODULE(primitives, m) {
             return_value_policy_for_scalar_type<T>(), doc.VectorLog.data.doc)
         .def("Clear", &VectorLog<T>::Clear, doc.VectorLog.Clear.doc)
         .def("Reserve", &VectorLog<T>::Reserve, doc.VectorLog.Reserve.doc)
+        .def("SetMaxNumSamples", &VectorLog<T>::SetMaxNumSamples,
+            py::arg("max_num_samples"), doc.VectorLog.SetMaxNumSamples.doc)
+        .def("max_num_samples", &VectorLog<T>::max_num_samples,
+            doc.VectorLog.max_num_samples.doc)
         .def("AddData", &VectorLog<T>::AddData, py::arg("time"),
             py::arg("sample"), doc.VectorLog.AddData.doc)
         .def("get_input_size", &VectorLog<T>::get_input_size,
@@ -675,6 +680,39 @@ PYBIND11_MODULE(primitives, m) {
           py::arg("zero_derivatives_beyond_limits") = true,
           doc.TrajectorySource.ctor.doc);
 
+  {
+    using Class = TrajectoryRecorder;
+    constexpr auto& cls_doc = doc.TrajectoryRecorder;
+    // N.B. AddAbstractInput() is not bound, since its flattening function
+    // writes into its output argument.
+    py::class_<Class, LeafSystem<double>>(m, "TrajectoryRecorder", cls_doc.doc)
+        .def(py::init<double, int>(), py::arg("publish_period") = 0.0,
+            py::arg("chunk_size") = 1024, cls_doc.ctor.doc)
+        .def("AddVectorInput", &Class::AddVectorInput, py::arg("name"),
+            py::arg("size"), py_rvp::reference_internal,
+            cls_doc.AddVectorInput.doc)
+        .def("column_names", &Class::column_names, cls_doc.column_names.doc)
+        .def("StartRecording", &Class::StartRecording, py::arg("filename"),
+            py::arg("context"), cls_doc.StartRecording.doc)
+        .def("StopRecording", &Class::StopRecording, py::arg("context"),
+            cls_doc.StopRecording.doc)
+        .def("is_recording", &Class::is_recording, py::arg("context"),
+            cls_doc.is_recording.doc);
+  }
+
+  {
+    using Class = TrajectoryRecordingReader;
+    constexpr auto& cls_doc = doc.TrajectoryRecordingReader;
+    py::class_<Class>(m, "TrajectoryRecordingReader", cls_doc.doc)
+        .def(py::init<const std::string&>(), py::arg("filename"),
+            cls_doc.ctor.doc)
+        .def("column_names", &Class::column_names, cls_doc.column_names.doc)
+        .def("num_rows", &Class::num_rows, cls_doc.num_rows.doc)
+        .def("Read", &Class::Read, py::arg("columns"), py::arg("first_row") = 0,
+            py::arg("num_rows") = std::nullopt, py_gil_release(),
+            cls_doc.Read.doc);
+  }
+
   m.def("AddRandomInputs", &AddRandomInputs<double>,
        py::arg("sampling_interval_sec"), py::arg("builder"),
        doc.AddRandomInputs.doc)
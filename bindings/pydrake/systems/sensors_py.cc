@@ -125,22 +125,40 @@ PYBIND11_MODULE(sensors, m) {
         return py::make_tuple(
             self->height(), self->width(), int{ImageTraitsT::kNumChannels});
       };
+      // The arrays below alias the image's pixels (no copy is made) and keep
+      // the image alive. Image<>::at(...) asserts that the image is not
+      // empty, so zero-sized images map a null pointer instead.
       auto get_data = [=](const ImageT* self) {
-        py::object array =
-            ToArray(self->at(0, 0), self->size(), get_shape(self));
+        const T* pixels = self->size() > 0 ? self->at(0, 0) : nullptr;
+        py::object array = ToArray(pixels, self->size(), get_shape(self));
         py_keep_alive(array, py::cast(self));
         return array;
       };
       auto get_mutable_data = [=](ImageT* self) {
-        py::object array =
-            ToArray(self->at(0, 0), self->size(), get_shape(self));
+        T* pixels = self->size() > 0 ? self->at(0, 0) : nullptr;
+        py::object array = ToArray(pixels, self->size(), get_shape(self));
         py_keep_alive(array, py::cast(self));
         return array;
       };
+      // Expose the (writeable) pixels via the buffer protocol too, so that
+      // `np.asarray(image)` (or `memoryview(image)`) is a view, not a copy.
+      auto get_buffer = [](ImageT& self) {
+        constexpr int kNumChannels = ImageTraitsT::kNumChannels;
+        T* pixels = self.size() > 0 ? self.at(0, 0) : nullptr;
+        const py::ssize_t item_size = sizeof(T);
+        return py::buffer_info(pixels, item_size,
+            py::format_descriptor<T>::format(), 3,
+            {py::ssize_t{self.height()}, py::ssize_t{self.width()},
+                py::ssize_t{kNumChannels}},
+            {item_size * self.width() * kNumChannels,
+                item_size * kNumChannels, item_size});
+      };
 
-      py::class_<ImageT> image(m, TemporaryClassName<ImageT>().c_str());
+      py::class_<ImageT> image(
+          m, TemporaryClassName<ImageT>().c_str(), py::buffer_protocol());
       AddTemplateClass(m, "Image", image, py_param);
       image  // BR
+          .def(py::init<>(), doc.Image.ctor.doc_0args)
           .def(py::init<int, int>(), py::arg("width"), py::arg("height"),
               doc.Image.ctor.doc_2args)
           .def(py::init<int, int, T>(), py::arg("width"), py::arg("height"),
@@ -154,7 +172,8 @@ PYBIND11_MODULE(sensors, m) {
           // Non-C++ properties. Make them Pythonic.
           .def_property_readonly("shape", get_shape)
           .def_property_readonly("data", get_data)
-          .def_property_readonly("mutable_data", get_mutable_data);
+          .def_property_readonly("mutable_data", get_mutable_data)
+          .def_buffer(get_buffer);
       // Constants.
       image.attr("Traits") = traits;
       // - Do not duplicate aliases (e.g. `kNumChannels`) for now.
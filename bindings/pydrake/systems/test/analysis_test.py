@@ -1,15 +1,20 @@
 import copy
+import threading
+import time
 import unittest
 
+import numpy as np
+
 from pydrake.symbolic import Variable, Expression
 from pydrake.autodiffutils import AutoDiffXd
 from pydrake.systems.primitives import (
     ConstantVectorSource,
     ConstantVectorSource_,
+    Integrator,
     SymbolicVectorSystem,
     SymbolicVectorSystem_,
 )
-from pydrake.systems.framework import EventStatus
+from pydrake.systems.framework import EventStatus, LeafSystem
 from pydrake.systems.analysis import (
     ApplySimulatorConfig,
     ExtractSimulatorConfig,
@@ -23,6 +28,8 @@ from pydrake.systems.analysis import (
     Simulator_,
     SimulatorConfig,
     SimulatorStatus,
+    VectorizedSimulator,
+    VectorizedSimulator_,
 )
 from pydrake.trajectories import PiecewisePolynomial
 
@@ -150,3 +157,66 @@ class TestAnalysis(unittest.TestCase):
         self.assertLess(status.return_time(), 1.1)
         simulator.clear_monitor()
         self.assertIsNone(simulator.get_monitor())
+
+    def test_simulator_releases_gil(self):
+        # The simulation sleeps for about one second, in C++, to keep up with
+        # the realtime rate. Other Python threads must be able to run during
+        # that time.
+        simulator = Simulator(ConstantVectorSource([1.]))
+        simulator.set_target_realtime_rate(1.)
+        thread = threading.Thread(target=simulator.AdvanceTo, args=(1.,))
+        start = time.time()
+        thread.start()
+        time.sleep(0.1)
+        self.assertLess(time.time() - start, 0.8)
+        thread.join()
+        self.assertEqual(simulator.get_context().get_time(), 1.)
+
+    def test_simulator_threads_with_python_systems(self):
+        # Python callbacks reacquire the GIL while simulations run in parallel.
+        class Counter(LeafSystem):
+            def __init__(self):
+                LeafSystem.__init__(self)
+                self.count = 0
+                self.DeclarePeriodicPublish(0.001)
+                self.DeclareVectorOutputPort("y", 1, self._calc_y)
+
+            def DoPublish(self, context, events):
+                LeafSystem.DoPublish(self, context, events)
+                self.count += 1
+
+            def _calc_y(self, context, output):
+                output.SetAtIndex(0, context.get_time())
+
+        systems = [Counter() for _ in range(2)]
+        simulators = [Simulator(system) for system in systems]
+        threads = [
+            threading.Thread(target=simulator.AdvanceTo, args=(0.5,))
+            for simulator in simulators]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        for system in systems:
+            self.assertGreaterEqual(system.count, 499)
+
+    def test_vectorized_simulator(self):
+        for T in (float, AutoDiffXd):
+            self.assertIsNotNone(VectorizedSimulator_[T])
+        system = Integrator(2)
+        dut = VectorizedSimulator(
+            system=system, num_instances=3, control_period=0.5,
+            num_threads=2)
+        self.assertEqual(dut.num_instances(), 3)
+        self.assertEqual(dut.control_period(), 0.5)
+        self.assertIs(dut.get_system(), system)
+        u = np.array([[1., 2.], [3., 4.], [5., 6.]])
+        dut.FixVectorInputPortValues(port=system.get_input_port(), values=u)
+        dut.Initialize()
+        dut.Step()
+        np.testing.assert_allclose(
+            dut.EvalVectorOutputPort(port=system.get_output_port()), 0.5 * u)
+        self.assertEqual(dut.get_context(i=1).get_time(), 0.5)
+        dut.get_mutable_context(i=1).SetTime(0.)
+        dut.get_mutable_simulator(i=1).Initialize()
+        self.assertEqual(dut.get_simulator(i=1).get_context().get_time(), 0.)
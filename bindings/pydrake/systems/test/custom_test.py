@@ -659,6 +659,36 @@ class TestCustom(unittest.TestCase):
             y = output.get_vector_data(0).get_value()
             self.assertTrue(np.allclose(y, y_expected))
 
+    def test_vector_system_override_dispatch(self):
+        # The overrides are looked up once per system, but must still be
+        # dispatched on every evaluation.
+        system = CustomVectorSystem(is_discrete=False)
+        context = system.CreateDefaultContext()
+        system.get_input_port(0).FixValue(context, [1.])
+        for i in range(3):
+            context.SetContinuousState([i, 2*i])
+            y = system.get_output_port(0).Eval(context)
+            np.testing.assert_equal(y, [1., i, 2*i])
+        self.assertEqual(system.has_called, ["output"] * 3)
+
+        # An override assigned to an instance is dispatched as well.
+        system = CustomVectorSystem(is_discrete=False)
+        calls = []
+
+        def calc_output(context, u, x, y):
+            y[:] = 7.
+            calls.append(x.copy())
+
+        system.DoCalcVectorOutput = calc_output
+        context = system.CreateDefaultContext()
+        system.get_input_port(0).FixValue(context, [1.])
+        for i in range(2):
+            context.SetContinuousState([i, i])
+            y = system.get_output_port(0).Eval(context)
+            np.testing.assert_equal(y, [7., 7., 7.])
+        self.assertEqual(len(calls), 2)
+        self.assertEqual(system.has_called, [])
+
     def test_context_api(self):
         # Capture miscellaneous functions not yet tested.
         model_value = AbstractValue.Make("Hello")
@@ -138,6 +138,19 @@ class TestSystemsLcm(unittest.TestCase):
         actual_message = dut.get_output_port(0).Eval(context)
         self.assert_lcm_equal(actual_message, model_message)
 
+    def test_subscriber_lock_free(self):
+        lcm = DrakeLcm()
+        dut = mut.LcmSubscriberSystem.Make(
+            channel="TEST_CHANNEL", lcm_type=lcmt_quaternion, lcm=lcm,
+            handoff=mut.LcmSubscriberHandoff.kLockFree)
+        self.assertEqual(dut.handoff(), mut.LcmSubscriberHandoff.kLockFree)
+        model_message = self._model_message()
+        lcm.Publish(channel="TEST_CHANNEL", buffer=model_message.encode())
+        lcm.HandleSubscriptions(0)
+        context = self._process_event(dut)
+        actual_message = dut.get_output_port(0).Eval(context)
+        self.assert_lcm_equal(actual_message, model_message)
+
     def test_subscriber_cpp(self):
         lcm = DrakeLcm()
         dut = mut.LcmSubscriberSystem.Make(
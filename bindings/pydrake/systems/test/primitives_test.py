@@ -3,7 +3,9 @@ import unittest
 import numpy as np
 
 from pydrake.autodiffutils import AutoDiffXd
-from pydrake.common import RandomDistribution, RandomGenerator
+from pydrake.common import (
+    RandomDistribution, RandomGenerator, temp_directory,
+)
 from pydrake.common.test_utilities import numpy_compare
 from pydrake.common.value import AbstractValue
 from pydrake.symbolic import Expression, Variable
@@ -51,6 +53,8 @@ from pydrake.systems.primitives import (
     SymbolicVectorSystem, SymbolicVectorSystem_,
     TrajectoryAffineSystem, TrajectoryAffineSystem_,
     TrajectoryLinearSystem, TrajectoryLinearSystem_,
+    TrajectoryRecorder,
+    TrajectoryRecordingReader,
     TrajectorySource,
     VectorLog, VectorLogSink, VectorLogSink_,
     WrapToSystem, WrapToSystem_,
@@ -728,12 +732,46 @@ class TestGeneral(unittest.TestCase):
         self.assertEqual(dut.num_samples(), 1)
         self.assertEqual(dut.sample_times(), [0.1])
         self.assertEqual(dut.data(), [22.22])
+        # The accessors return views of the log, not copies.
+        self.assertTrue(np.shares_memory(dut.data(), dut.data()))
+        self.assertTrue(
+            np.shares_memory(dut.sample_times(), dut.sample_times()))
         dut.Clear()
         self.assertEqual(dut.num_samples(), 0)
+        self.assertIsNone(dut.max_num_samples())
+        dut.SetMaxNumSamples(max_num_samples=2)
+        self.assertEqual(dut.max_num_samples(), 2)
+        for i in range(3):
+            dut.AddData(i, [i])
+        np.testing.assert_equal(dut.sample_times(), [1, 2])
+        dut.SetMaxNumSamples(max_num_samples=None)
         # There is no good way from python to test the semantics of Reserve(),
         # but test the binding anyway.
         dut.Reserve(VectorLog.kDefaultCapacity * 3)
 
+    def test_trajectory_recorder(self):
+        recorder = TrajectoryRecorder(publish_period=0.0, chunk_size=4)
+        port = recorder.AddVectorInput(name="x", size=2)
+        self.assertEqual(recorder.column_names(), ["time", "x[0]", "x[1]"])
+        context = recorder.CreateDefaultContext()
+        filename = temp_directory() + "/recording.bin"
+        recorder.StartRecording(filename=filename, context=context)
+        self.assertTrue(recorder.is_recording(context=context))
+        for i in range(10):
+            context.SetTime(i)
+            port.FixValue(context, [i, -i])
+            recorder.Publish(context)
+        recorder.StopRecording(context=context)
+        self.assertFalse(recorder.is_recording(context=context))
+
+        reader = TrajectoryRecordingReader(filename=filename)
+        self.assertEqual(reader.column_names(), recorder.column_names())
+        self.assertEqual(reader.num_rows(), 10)
+        data = reader.Read(columns=["x[1]", "time"], first_row=3, num_rows=5)
+        np.testing.assert_equal(data[:, 0], -np.arange(3, 8))
+        np.testing.assert_equal(data[:, 1], np.arange(3, 8))
+        self.assertEqual(reader.Read(columns=["time"]).shape, (10, 1))
+
     @numpy_compare.check_nonsymbolic_types
     def test_vector_log_sink(self, T):
         # Add various redundant loggers to a system, to exercise the
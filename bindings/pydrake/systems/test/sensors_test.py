@@ -173,6 +173,35 @@ class TestSensors(unittest.TestCase):
             np.testing.assert_array_equal(data, channel_default)
             np.testing.assert_array_equal(mutable_data, channel_default)
 
+    def test_image_zero_copy(self):
+        for pixel_type in pixel_types:
+            ImageT = mut.Image[pixel_type]
+            image = ImageT(8, 6, 1)
+            nc = ImageT.Traits.kNumChannels
+            # The NumPy views alias the pixels, rather than copying them.
+            self.assertTrue(np.shares_memory(image.data, image.mutable_data))
+            # The buffer protocol also aliases the pixels.
+            array = np.asarray(image)
+            self.assertEqual(array.shape, (6, 8, nc))
+            self.assertEqual(array.dtype, ImageT.Traits.ChannelType)
+            self.assertTrue(np.shares_memory(array, image.mutable_data))
+            array[1, 2, 0] = 7
+            self.assertEqual(image.at(x=2, y=1)[0], 7)
+            self.assertEqual(memoryview(image).shape, (6, 8, nc))
+
+            # The buffer keeps the image alive.
+            def make_array():
+                return np.asarray(ImageT(8, 6, 1))
+
+            array = make_array()
+            gc.collect()
+            np.testing.assert_array_equal(array, 1)
+
+            # Zero-sized images map to empty arrays.
+            empty = ImageT()
+            self.assertEqual(empty.data.size, 0)
+            self.assertEqual(np.asarray(empty).shape, (0, 0, nc))
+
     def test_camera_info(self):
         width = 640
         height = 480
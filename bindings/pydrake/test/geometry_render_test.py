@@ -47,10 +47,14 @@ class TestGeometryRender(unittest.TestCase):
             default_clear_color=diffuse,
             default_label=label,
             default_diffuse=diffuse,
+            pipelined_readback=True,
+            backend="EGL",
         )
         self.assertEqual(params.default_clear_color, diffuse)
         self.assertEqual(params.default_label, label)
         self.assertEqual(params.default_diffuse, diffuse)
+        self.assertTrue(params.pipelined_readback)
+        self.assertEqual(params.backend, "EGL")
 
     def test_render_label(self):
         RenderLabel = mut.render.RenderLabel
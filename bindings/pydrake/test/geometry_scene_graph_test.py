@@ -399,6 +399,11 @@ class TestGeometrySceneGraph(unittest.TestCase):
             self.assertEqual(len(results), 0)
         results = query_object.ComputeSignedDistanceToPoint(p_WQ=(1, 2, 3))
         self.assertEqual(len(results), 0)
+        results = query_object.ComputeSignedDistanceToPoints(
+            p_WQs=[[1, 4], [2, 5], [3, 6]])
+        self.assertEqual(results.num_points(), 2)
+        self.assertEqual(results.num_results(), 0)
+        self.assertEqual(results.offsets, [0, 0, 0])
         results = query_object.FindCollisionCandidates()
         self.assertEqual(len(results), 0)
         self.assertFalse(query_object.HasCollisions())
@@ -1,11 +1,13 @@
 import pydrake.geometry as mut
 
+import os
 import unittest
 
 import numpy as np
 
 from drake import lcmt_viewer_load_robot, lcmt_viewer_draw
 from pydrake.autodiffutils import AutoDiffXd
+from pydrake.common import temp_directory
 from pydrake.common.value import AbstractValue
 from pydrake.common.test_utilities import numpy_compare
 from pydrake.lcm import DrakeLcm, Subscriber
@@ -27,13 +29,15 @@ class TestGeometryVisualizers(unittest.TestCase):
         params = mut.DrakeVisualizerParams(
             publish_period=0.1, role=mut.Role.kIllustration,
             default_color=mut.Rgba(0.1, 0.2, 0.3, 0.4),
-            show_hydroelastic=False)
+            show_hydroelastic=False,
+            publish_changed_poses_only=False)
         self.assertEqual(repr(params), "".join([
             "DrakeVisualizerParams("
             "publish_period=0.1, "
             "role=Role.kIllustration, "
             "default_color=Rgba(r=0.1, g=0.2, b=0.3, a=0.4), "
-            "show_hydroelastic=False)"]))
+            "show_hydroelastic=False, "
+            "publish_changed_poses_only=False)"]))
 
         # Add some subscribers to detect message broadcast.
         load_channel = "DRAKE_VIEWER_LOAD_ROBOT"
@@ -104,11 +108,15 @@ class TestGeometryVisualizers(unittest.TestCase):
                           rgba=mut.Rgba(.5, .5, .5))
         meshcat.SetTransform(path="/test/box", X_ParentPath=RigidTransform())
         meshcat.SetTransform(path="/test/box", matrix=np.eye(4))
+        meshcat.SetTransforms(paths=["/test/box", "/test/other"],
+                              X_ParentPaths=[RigidTransform()] * 2)
         self.assertTrue(meshcat.HasPath("/test/box"))
         cloud = PointCloud(4)
         cloud.mutable_xyzs()[:] = np.zeros((3, 4))
         meshcat.SetObject(path="/test/cloud", cloud=cloud,
                           point_size=0.01, rgba=mut.Rgba(.5, .5, .5))
+        meshcat.SetObject(path="/test/quantized_cloud", cloud=cloud,
+                          quantize=True)
         mesh = mut.TriangleSurfaceMesh(
             triangles=[mut.SurfaceTriangle(
                 0, 1, 2), mut.SurfaceTriangle(3, 0, 2)],
@@ -178,6 +186,28 @@ class TestGeometryVisualizers(unittest.TestCase):
         meshcat = mut.Meshcat()
         meshcat.SetAnimation(animation)
 
+    def test_meshcat_animation_recorder(self):
+        filename = os.path.join(temp_directory(), "animation.bin")
+        recorder = mut.MeshcatAnimationRecorder(
+            filename=filename, frames_per_second=64, decimation=2)
+        self.assertEqual(recorder.frames_per_second(), 64)
+        self.assertEqual(recorder.decimation(), 2)
+        recorder.set_start_time(time=1.0)
+        self.assertEqual(recorder.start_time(), 1.0)
+        self.assertEqual(recorder.frame(time=2.0), 64)
+        recorder.SetTransform(frame=0, path="test",
+                              X_ParentPath=RigidTransform())
+        recorder.SetProperty(frame=0, path="test", property="bool",
+                             value=True)
+        recorder.SetProperty(frame=0, path="test", property="double",
+                             value=32.0)
+        recorder.SetProperty(frame=1, path="test", property="vector_double",
+                             value=[1., 2., 3.])
+        self.assertEqual(recorder.num_keyframes(), 3)
+        recorder.Flush()
+        animation = mut.MeshcatAnimationRecorder.Load(filename=filename)
+        self.assertEqual(animation.frames_per_second(), 64)
+
     @numpy_compare.check_nonsymbolic_types
     def test_meshcat_visualizer(self, T):
         meshcat = mut.Meshcat()
@@ -187,6 +217,8 @@ class TestGeometryVisualizers(unittest.TestCase):
         params.default_color = mut.Rgba(0.5, 0.5, 0.5)
         params.prefix = "py_visualizer"
         params.delete_on_initialization_event = False
+        params.translation_tolerance = 1e-4
+        params.rotation_tolerance = 1e-3
         self.assertNotIn("object at 0x", repr(params))
         vis = mut.MeshcatVisualizerCpp_[T](meshcat=meshcat, params=params)
         vis.Delete()
@@ -197,6 +229,12 @@ class TestGeometryVisualizers(unittest.TestCase):
         vis.StopRecording()
         vis.PublishRecording()
         vis.DeleteRecording()
+        recorder = vis.StartRecordingToFile(
+            filename=os.path.join(temp_directory(), "recording.bin"),
+            decimation=2, set_transforms_while_recording=False)
+        self.assertIsInstance(recorder, mut.MeshcatAnimationRecorder)
+        vis.StopRecording()
+        vis.DeleteRecording()
 
         builder = DiagramBuilder_[T]()
         scene_graph = builder.AddSystem(mut.SceneGraph_[T]())
@@ -224,6 +262,9 @@ class TestGeometryVisualizers(unittest.TestCase):
             meshcat=meshcat, path="cloud", publish_period=1/12.0)
         visualizer.set_point_size(0.1)
         visualizer.set_default_rgba(mut.Rgba(0, 0, 1, 1))
+        visualizer.set_voxel_size(0.01)
+        visualizer.set_quantize(True)
+        visualizer.set_max_update_rate(30)
         context = visualizer.CreateDefaultContext()
         cloud = PointCloud(4)
         cloud.mutable_xyzs()[:] = np.zeros((3, 4))
@@ -1,6 +1,11 @@
 import unittest
 
-from pydrake.lcm import DrakeLcm, DrakeLcmInterface, Subscriber
+from pydrake.lcm import (
+    DrakeLcm,
+    DrakeLcmInterface,
+    LcmQueueDropPolicy,
+    Subscriber,
+)
 
 from drake import lcmt_quaternion
 
@@ -46,3 +51,18 @@ class TestLcm(unittest.TestCase):
         self.assertEqual(dut.message.x, self.quat.x)
         self.assertEqual(dut.message.y, self.quat.y)
         self.assertEqual(dut.message.z, self.quat.z)
+
+    def test_receive_thread(self):
+        lcm = DrakeLcm("memq://")
+        self.assertEqual(lcm.get_receive_statistics().num_received, 0)
+        dut = Subscriber(lcm=lcm, channel="CHANNEL", lcm_type=lcmt_quaternion)
+        lcm.StartReceiveThread(drop_policy=LcmQueueDropPolicy.kDropNewest)
+        lcm.Publish(channel="CHANNEL", buffer=self.quat.encode())
+        lcm.HandleSubscriptions(10000)
+        self.assertEqual(dut.count, 1)
+        self.assertEqual(dut.message.w, self.quat.w)
+        statistics = lcm.get_receive_statistics()
+        self.assertEqual(statistics.num_received, 1)
+        self.assertEqual(statistics.num_dropped, 0)
+        self.assertEqual(statistics.num_handled, 1)
+        self.assertEqual(statistics.num_queued, 0)
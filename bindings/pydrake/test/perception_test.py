@@ -59,6 +59,9 @@ class TestPerception(unittest.TestCase):
         pc.mutable_xyz(i=0)[:] = test_xyz
         np.testing.assert_equal(pc.xyz(i=0), test_xyz)
         np.testing.assert_equal(pc.xyzs().T[0], test_xyz)
+        # The accessors return views of the cloud, not copies.
+        self.assertTrue(np.shares_memory(pc.xyzs(), pc.mutable_xyzs()))
+        self.assertTrue(np.shares_memory(pc.mutable_xyz(i=0), pc.xyzs()))
         pc_new = mut.PointCloud()
         pc_new.SetFrom(other=pc)
         np.testing.assert_equal(pc.xyzs(), pc_new.xyzs())
@@ -82,6 +85,20 @@ class TestPerception(unittest.TestCase):
         # Test Systems' value registration.
         self.assertIsInstance(AbstractValue.Make(pc), Value[mut.PointCloud])
 
+    def test_point_cloud_processing(self):
+        fields = mut.Fields(mut.BaseField.kXYZs | mut.BaseField.kNormals)
+        pc = mut.PointCloud(new_size=4, fields=fields)
+        pc.mutable_xyzs()[:] = [[0., 1., 0., 0.05],
+                                [0., 0., 1., 0.05],
+                                [1., 1., 1., 1.]]
+        cropped = pc.Crop(lower_xyz=[-0.5, -0.5, 0.], upper_xyz=[0.5, 0.5, 2.])
+        self.assertEqual(cropped.size(), 2)
+        down = pc.VoxelizedDownSample(voxel_size=0.5)
+        self.assertEqual(down.size(), 3)
+        self.assertTrue(pc.EstimateNormals(
+            radius=2., num_closest=4, parallelize=True))
+        np.testing.assert_allclose(pc.normal(i=0), [0., 0., -1.], atol=1e-6)
+
     def test_depth_image_to_point_cloud_api(self):
         camera_info = CameraInfo(width=640, height=480, fov_y=np.pi / 4)
         dut = mut.DepthImageToPointCloud(camera_info=camera_info)
@@ -19,6 +19,7 @@
 #include <cmath>
 #include <limits>
 #include <ostream>
+#include <utility>
 
 #include <Eigen/Dense>
 
@@ -228,10 +229,13 @@ class AutoDiffScalar<VectorXd>
     return *this;
   }
 
-  // It is possible that further overloads could exploit more move-awareness
-  // here. However, overload ambiguities are difficult to resolve. Currently
-  // only the left-hand operand is available for optimizations.  See #13985,
-  // #14039 for discussion.
+  // The left-hand operand is taken by value, so that it can be used as
+  // storage. A right-hand operand that is an rvalue is also used as storage,
+  // through an overload taking an rvalue reference: binding an rvalue to an
+  // rvalue reference ranks better than binding it to a const reference, so
+  // such overloads are preferred without being ambiguous. This covers the
+  // common accumulation `c + a * b` (as in Eigen's dot products), which then
+  // allocates only for the product. See #13985, #14039 for discussion.
   template <typename OtherDerType>
   friend inline AutoDiffScalar<DerType> operator+(
       AutoDiffScalar<DerType> a, const AutoDiffScalar<OtherDerType>& b) {
@@ -239,6 +243,13 @@ class AutoDiffScalar<VectorXd>
     return a;
   }
 
+  template <typename OtherDerType>
+  friend inline AutoDiffScalar<DerType> operator+(
+      const AutoDiffScalar<OtherDerType>& a, AutoDiffScalar<DerType>&& b) {
+    b += a;
+    return std::move(b);
+  }
+
   template <typename OtherDerType>
   inline AutoDiffScalar& operator+=(const AutoDiffScalar<OtherDerType>& other) {
     const bool has_this_der = m_derivatives.size() > 0;
@@ -279,6 +290,23 @@ class AutoDiffScalar<VectorXd>
     return a;
   }
 
+  template <typename OtherDerType>
+  friend inline AutoDiffScalar<DerType> operator-(
+      const AutoDiffScalar<OtherDerType>& a, AutoDiffScalar<DerType>&& b) {
+    const bool has_a_der = a.derivatives().size() > 0;
+    const bool has_b_der = b.derivatives().size() > 0;
+    b.value() = a.value() - b.value();
+    if (has_b_der) {
+      b.derivatives() *= -1;
+      if (has_a_der) {
+        b.derivatives() += a.derivatives();
+      }
+    } else {
+      b.derivatives() = a.derivatives();
+    }
+    return std::move(b);
+  }
+
   template <typename OtherDerType>
   inline AutoDiffScalar& operator-=(const AutoDiffScalar<OtherDerType>& other) {
     const bool has_this_der = m_derivatives.size() > 0;
@@ -330,6 +358,24 @@ class AutoDiffScalar<VectorXd>
     return a;
   }
 
+  template <typename OtherDerType>
+  friend inline AutoDiffScalar<DerType> operator/(
+      const AutoDiffScalar<OtherDerType>& a, AutoDiffScalar<DerType>&& b) {
+    const bool has_a_der = a.derivatives().size() > 0;
+    const bool has_b_der = b.derivatives().size() > 0;
+    const Scalar scale = Scalar(1) / (b.value() * b.value());
+    if (has_a_der && has_b_der) {
+      b.derivatives() =
+          (a.derivatives() * b.value() - b.derivatives() * a.value()) * scale;
+    } else if (has_b_der) {
+      b.derivatives() *= -a.value() * scale;
+    } else {
+      b.derivatives() = a.derivatives() * (Scalar(1) / b.value());
+    }
+    b.value() = a.value() / b.value();
+    return std::move(b);
+  }
+
   template <typename OtherDerType>
   friend inline AutoDiffScalar<DerType> operator*(
       AutoDiffScalar<DerType> a, const AutoDiffScalar<OtherDerType>& b) {
@@ -337,6 +383,13 @@ class AutoDiffScalar<VectorXd>
     return a;
   }
 
+  template <typename OtherDerType>
+  friend inline AutoDiffScalar<DerType> operator*(
+      const AutoDiffScalar<OtherDerType>& a, AutoDiffScalar<DerType>&& b) {
+    b *= a;
+    return std::move(b);
+  }
+
   inline AutoDiffScalar& operator*=(const Scalar& other) {
     m_value *= other;
     m_derivatives *= other;
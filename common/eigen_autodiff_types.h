@@ -27,6 +27,20 @@ using AutoDiffXd = Eigen::AutoDiffScalar<Eigen::VectorXd>;
 template <int num_vars>
 using AutoDiffd = Eigen::AutoDiffScalar<Eigen::Matrix<double, num_vars, 1> >;
 
+/// An autodiff variable with at most `max_vars` partials, whose storage is
+/// inline: unlike AutoDiffXd, creating or copying one never allocates from the
+/// heap, which makes it the cheaper choice when the number of partials is
+/// small but only known at runtime.  Exceeding `max_vars` partials is an error
+/// (asserted by Eigen in Debug builds).  Eigen's fixed-capacity storage can't
+/// spill over to the heap, so a variable with more partials must use
+/// AutoDiffXd instead.
+///
+/// RotationMatrix, RigidTransform and RollPitchYaw are instantiated on
+/// AutoDiffUpTo<16>.
+template <int max_vars>
+using AutoDiffUpTo = Eigen::AutoDiffScalar<
+    Eigen::Matrix<double, Eigen::Dynamic, 1, 0, max_vars, 1>>;
+
 /// A vector of `rows` autodiff variables, each with `num_vars` partials.
 template <int num_vars, int rows>
 using AutoDiffVecd = Eigen::Matrix<AutoDiffd<num_vars>, rows, 1>;
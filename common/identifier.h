@@ -238,10 +238,13 @@ std::string to_string(const drake::Identifier<Tag>& id) {
 
 namespace std {
 
-/** Enables use of the identifier to serve as a key in STL containers.
+/** Enables use of the identifier to serve as a key in STL containers. Because
+ identifiers are hot keys throughout Drake, this uses the cheaper
+ internal::WordMixHasher instead of drake::DefaultHash.
  @relates Identifier
  */
 template <typename Tag>
-struct hash<drake::Identifier<Tag>> : public drake::DefaultHash {};
+struct hash<drake::Identifier<Tag>>
+    : public drake::uhash<drake::internal::WordMixHasher> {};
 
 }  // namespace std
@@ -0,0 +1,84 @@
+#include "drake/common/parallelism.h"
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+
+Parallelism Parallelism::Max() {
+  // hardware_concurrency() is permitted to return 0 when the value is not
+  // computable; in that case we fall back to no parallelism.
+  const int hardware_concurrency =
+      static_cast<int>(std::thread::hardware_concurrency());
+  return Parallelism(std::max(1, hardware_concurrency));
+}
+
+Parallelism::Parallelism(int num_threads) : num_threads_(num_threads) {
+  if (num_threads < 1) {
+    throw std::logic_error(fmt::format(
+        "Parallelism requires num_threads >= 1, but {} was given.",
+        num_threads));
+  }
+}
+
+void StaticParallelForIndexLoop(
+    const Parallelism& parallelism, int loop_begin, int loop_end,
+    const std::function<void(int, int)>& loop_body) {
+  DRAKE_THROW_UNLESS(loop_begin <= loop_end);
+  DRAKE_THROW_UNLESS(loop_body != nullptr);
+  const int num_indices = loop_end - loop_begin;
+  const int num_threads = std::min(parallelism.num_threads(), num_indices);
+
+  if (num_threads <= 1) {
+    for (int index = loop_begin; index < loop_end; ++index) {
+      loop_body(0, index);
+    }
+    return;
+  }
+
+  // Thread t processes the half-open range [begin(t), begin(t + 1)). The
+  // first (num_indices % num_threads) blocks get one extra index.
+  const int block_size = num_indices / num_threads;
+  const int remainder = num_indices % num_threads;
+  auto block_begin = [&](int thread_num) {
+    return loop_begin + thread_num * block_size +
+           std::min(thread_num, remainder);
+  };
+
+  std::vector<std::exception_ptr> errors(num_threads);
+  auto run_block = [&](int thread_num) {
+    try {
+      const int end = block_begin(thread_num + 1);
+      for (int index = block_begin(thread_num); index < end; ++index) {
+        loop_body(thread_num, index);
+      }
+    } catch (...) {
+      errors[thread_num] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(num_threads - 1);
+  for (int thread_num = 1; thread_num < num_threads; ++thread_num) {
+    workers.emplace_back(run_block, thread_num);
+  }
+  run_block(0);
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+
+  for (const std::exception_ptr& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+}  // namespace drake
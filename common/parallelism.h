@@ -0,0 +1,71 @@
+#pragma once
+
+#include <functional>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+
+/** Specifies a desired degree of parallelism for a parallelized operation.
+
+This class denotes a specific number of threads; either 1 (no parallelism), a
+user-specified value (any number >= 1), or the maximum number of threads. For
+the maximum number of threads, std::thread::hardware_concurrency() is used.
+
+Code that uses %Parallelism is required to produce the same results regardless
+of the degree of parallelism chosen (up to floating-point round-off, which the
+consuming API documents); the choice only affects wall-clock time. */
+class Parallelism {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Parallelism);
+
+  /** Default constructs to no parallelism (i.e., num_threads = 1). */
+  Parallelism() = default;
+
+  /** Constructs a %Parallelism with no parallelism (i.e., num_threads = 1).
+  Python note: This function is not bound in pydrake (due to its name); use
+  the default constructor instead. */
+  static Parallelism None() { return Parallelism(); }
+
+  /** Constructs a %Parallelism with the maximum number of threads. */
+  static Parallelism Max();
+
+  /** Constructs a %Parallelism with either no parallelism (i.e., num_threads =
+  1) or the maximum number of threads (Max()), as selected by `parallelize`.
+  This constructor allows for implicit conversion, for convenience. */
+  Parallelism(bool parallelize)  // NOLINT(runtime/explicit)
+      : Parallelism(parallelize ? Max() : None()) {}
+
+  /** Constructs a %Parallelism with the given number of threads.
+  @throws std::exception if num_threads < 1. */
+  explicit Parallelism(int num_threads);
+
+  /** Returns the degree of parallelism. The result will always be >= 1. */
+  int num_threads() const { return num_threads_; }
+
+ private:
+  int num_threads_{1};
+};
+
+/** Executes `loop_body(thread_num, index)` for every `index` in
+[`loop_begin`, `loop_end`), using up to `parallelism.num_threads()` threads
+(including the calling thread).
+
+The indices are statically partitioned into contiguous blocks, one per thread,
+so that the `thread_num` passed to the body (in the range [0, num_threads)) can
+be used to index into per-thread scratch storage allocated by the caller. The
+block assigned to `thread_num == 0` always runs on the calling thread. When only
+a single thread is used (or the range is too small to split), the body is
+invoked serially, in increasing `index` order, without spawning any threads.
+
+The `loop_body` must be safe to call concurrently from different threads for
+different indices. If any invocation throws, all threads are joined and the
+exception thrown by the lowest-numbered failing thread is re-thrown on the
+calling thread.
+
+@pre loop_begin <= loop_end. */
+void StaticParallelForIndexLoop(
+    const Parallelism& parallelism, int loop_begin, int loop_end,
+    const std::function<void(int thread_num, int index)>& loop_body);
+
+}  // namespace drake
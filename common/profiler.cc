@@ -0,0 +1,173 @@
+#include "drake/common/profiler.h"
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/never_destroyed.h"
+
+namespace drake {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// A timed scope that is executing on this thread.
+struct ActiveScope {
+  Clock::time_point start;
+  // The time spent in the timed scopes nested in this one, so far.
+  double child_seconds{};
+};
+
+// The timed scopes that are executing on this thread, outermost first.
+struct ThreadScopes {
+  std::vector<std::string> path;
+  std::vector<ActiveScope> scopes;
+  int thread_index{-1};
+};
+
+ThreadScopes& GetThreadScopes() {
+  static std::atomic<int> num_threads{0};
+  thread_local ThreadScopes thread_scopes;
+  if (thread_scopes.thread_index < 0) {
+    thread_scopes.thread_index = num_threads++;
+  }
+  return thread_scopes;
+}
+
+double ToSeconds(Clock::duration duration) {
+  return std::chrono::duration<double>(duration).count();
+}
+
+// Escapes a string for use inside a JSON string literal.
+std::string EscapeJson(std::string_view text) {
+  std::string result;
+  result.reserve(text.size());
+  for (const char c : text) {
+    switch (c) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      case '\t': result += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          result += fmt::format("\\u{:04x}", static_cast<int>(c));
+        } else {
+          result += c;
+        }
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+std::atomic<bool> Profiler::enabled_{false};
+
+Profiler::Profiler() : epoch_(Clock::now()) {}
+
+Profiler& Profiler::Global() {
+  static never_destroyed<Profiler> global;
+  return global.access();
+}
+
+bool Profiler::is_trace_enabled() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return trace_enabled_;
+}
+
+void Profiler::set_trace_enabled(bool enabled) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  trace_enabled_ = enabled;
+}
+
+void Profiler::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  statistics_.clear();
+  trace_events_.clear();
+}
+
+std::vector<ProfileStatistics> Profiler::GetStatistics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<ProfileStatistics> result;
+  result.reserve(statistics_.size());
+  // The map is ordered lexicographically by path, i.e., depth-first.
+  for (const auto& [path, statistics] : statistics_) {
+    result.push_back(statistics);
+  }
+  return result;
+}
+
+std::string Profiler::FormatReport() const {
+  std::string result = fmt::format("{:>12} {:>12} {:>10} {:>12}  {}\n",
+                                   "total [s]", "self [s]", "count",
+                                   "max [s]", "scope");
+  for (const ProfileStatistics& statistics : GetStatistics()) {
+    const int depth = static_cast<int>(statistics.path.size()) - 1;
+    result += fmt::format("{:12.6f} {:12.6f} {:10} {:12.6f}  {}{}\n",
+                          statistics.total_seconds, statistics.self_seconds,
+                          statistics.count, statistics.max_seconds,
+                          std::string(2 * depth, ' '),
+                          statistics.path.back());
+  }
+  return result;
+}
+
+std::string Profiler::ToChromeTraceJson() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::string result = "{\"traceEvents\":[";
+  for (size_t i = 0; i < trace_events_.size(); ++i) {
+    const TraceEvent& event = trace_events_[i];
+    if (i > 0) result += ",";
+    result += fmt::format(
+        "\n{{\"name\":\"{}\",\"cat\":\"drake\",\"ph\":\"X\",\"ts\":{:.3f},"
+        "\"dur\":{:.3f},\"pid\":0,\"tid\":{}}}",
+        EscapeJson(event.name), event.start_microseconds,
+        event.duration_microseconds, event.thread_index);
+  }
+  result += "\n],\"displayTimeUnit\":\"ms\"}\n";
+  return result;
+}
+
+void Profiler::Record(const std::vector<std::string>& path,
+                      Clock::time_point start, double total_seconds,
+                      double self_seconds, int thread_index) {
+  DRAKE_DEMAND(!path.empty());
+  std::lock_guard<std::mutex> lock(mutex_);
+  ProfileStatistics& statistics = statistics_[path];
+  if (statistics.count == 0) statistics.path = path;
+  ++statistics.count;
+  statistics.total_seconds += total_seconds;
+  statistics.self_seconds += self_seconds;
+  statistics.max_seconds = std::max(statistics.max_seconds, total_seconds);
+  if (trace_enabled_) {
+    trace_events_.push_back(
+        {path.back(), ToSeconds(start - epoch_) * 1e6, total_seconds * 1e6,
+         thread_index});
+  }
+}
+
+void ScopedProfileTimer::Start(std::string label) {
+  ThreadScopes& thread_scopes = GetThreadScopes();
+  thread_scopes.path.push_back(std::move(label));
+  thread_scopes.scopes.push_back({Clock::now(), 0.0});
+  active_ = true;
+}
+
+void ScopedProfileTimer::Stop() {
+  const Clock::time_point end = Clock::now();
+  ThreadScopes& thread_scopes = GetThreadScopes();
+  DRAKE_DEMAND(!thread_scopes.scopes.empty());
+  const ActiveScope scope = thread_scopes.scopes.back();
+  const double total_seconds = ToSeconds(end - scope.start);
+  Profiler::Global().Record(thread_scopes.path, scope.start, total_seconds,
+                            total_seconds - scope.child_seconds,
+                            thread_scopes.thread_index);
+  thread_scopes.scopes.pop_back();
+  thread_scopes.path.pop_back();
+  if (!thread_scopes.scopes.empty()) {
+    thread_scopes.scopes.back().child_seconds += total_seconds;
+  }
+}
+
+}  // namespace drake
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+
+#ifndef DRAKE_DOXYGEN_CXX
+template <typename>
+class never_destroyed;
+#endif
+
+/** The aggregated timings of all the timed scopes (see ScopedProfileTimer)
+that had the same label and the same enclosing timed scopes. */
+struct ProfileStatistics {
+  /** The labels of the enclosing timed scopes, outermost first, followed by
+  the label of this scope. */
+  std::vector<std::string> path;
+
+  /** The number of times the scope was timed. */
+  int64_t count{};
+
+  /** The total wall-clock time spent in the scope, in seconds. */
+  double total_seconds{};
+
+  /** The part of `total_seconds` that was not spent in nested timed scopes. */
+  double self_seconds{};
+
+  /** The longest single wall-clock time spent in the scope, in seconds. */
+  double max_seconds{};
+};
+
+/** A process-wide, opt-in profiler that aggregates the wall-clock times of
+scopes timed with ScopedProfileTimer.
+
+Profiling is disabled by default, in which case a ScopedProfileTimer costs a
+single relaxed atomic load. Once enabled with set_enabled(), every timed scope
+is aggregated by its path, i.e., by its label and the labels of the timed
+scopes that enclose it on the same thread, so that the report is hierarchical.
+
+Drake times the following scopes:
+- Simulator::Initialize() and Simulator::AdvanceTo(), along with their
+  continuous integration and their dispatch of publish, discrete update and
+  unrestricted update events;
+- the event handlers of every LeafSystem, labeled by the path name of the
+  system;
+- the recomputation of every out-of-date cache entry, labeled by the path name
+  of its system and its description (an up-to-date Eval() is not timed);
+- the queries of geometry::internal::ProximityEngine and, in the queries that
+  evaluate each candidate geometry pair separately (hydroelastic contact
+  surfaces, and point-pair penetration on multiple threads), the narrowphase
+  of each pair, labeled with the pair's geometry ids;
+- the phases of the SAP contact solver.
+
+For example: @code
+Profiler& profiler = Profiler::Global();
+profiler.set_enabled(true);
+simulator.AdvanceTo(1.0);
+profiler.set_enabled(false);
+std::cout << profiler.FormatReport();
+@endcode
+
+Individual timed scopes can also be recorded for a timeline view: see
+set_trace_enabled() and ToChromeTraceJson().
+
+All of the methods are thread-safe. */
+class Profiler {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Profiler);
+
+  /** Returns the process-wide profiler. */
+  static Profiler& Global();
+
+  /** Returns whether scopes are being timed. */
+  static bool is_enabled() {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  /** Enables or disables the timing of scopes. Scopes that are already
+  executing when the profiler is enabled are not timed. */
+  void set_enabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+  }
+
+  /** Returns whether individual timed scopes are being recorded. */
+  bool is_trace_enabled() const;
+
+  /** Enables or disables the recording of each individual timed scope, for
+  ToChromeTraceJson(), in addition to their aggregation. The recording grows
+  with the number of timed scopes, so it is disabled by default. */
+  void set_trace_enabled(bool enabled);
+
+  /** Discards all aggregated statistics and recorded scopes. */
+  void Reset();
+
+  /** Returns the aggregated statistics, ordered depth-first by path. */
+  std::vector<ProfileStatistics> GetStatistics() const;
+
+  /** Returns a human-readable table of GetStatistics(), in which each scope
+  is indented under its enclosing scope. */
+  std::string FormatReport() const;
+
+  /** Returns the recorded scopes in the Chrome trace event format, which can
+  be viewed with chrome://tracing or https://ui.perfetto.dev. Only the scopes
+  that were timed while set_trace_enabled() was on are included. */
+  std::string ToChromeTraceJson() const;
+
+#ifndef DRAKE_DOXYGEN_CXX
+  // Adds a completed timed scope. This is called by ScopedProfileTimer.
+  void Record(const std::vector<std::string>& path,
+              std::chrono::steady_clock::time_point start,
+              double total_seconds, double self_seconds, int thread_index);
+#endif
+
+ private:
+  struct TraceEvent {
+    std::string name;
+    double start_microseconds{};
+    double duration_microseconds{};
+    int thread_index{};
+  };
+
+  friend class never_destroyed<Profiler>;
+
+  Profiler();
+
+  static std::atomic<bool> enabled_;
+
+  mutable std::mutex mutex_;
+  const std::chrono::steady_clock::time_point epoch_;
+  bool trace_enabled_{false};
+  std::map<std::vector<std::string>, ProfileStatistics> statistics_;
+  std::vector<TraceEvent> trace_events_;
+};
+
+/** Times the scope in which it lives, under the given label, when the
+Profiler is enabled. Timed scopes on the same thread nest: the label of a
+scope is appended to the path of the enclosing timed scope.
+
+The label may also be given as a function that returns it, which is only
+called when the profiler is enabled; this avoids building dynamic labels
+otherwise. @code
+ScopedProfileTimer timer("MyPlanner::Solve");
+ScopedProfileTimer timer([this]() { return GetSystemPathname() + " Calc"; });
+@endcode */
+class ScopedProfileTimer {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedProfileTimer);
+
+  explicit ScopedProfileTimer(std::string_view label) {
+    if (Profiler::is_enabled()) Start(std::string(label));
+  }
+
+  template <typename LabelFunction,
+            typename = std::enable_if_t<
+                std::is_invocable_r_v<std::string, LabelFunction>>>
+  explicit ScopedProfileTimer(LabelFunction&& make_label) {
+    if (Profiler::is_enabled()) Start(make_label());
+  }
+
+  ~ScopedProfileTimer() {
+    if (active_) Stop();
+  }
+
+ private:
+  void Start(std::string label);
+  void Stop();
+
+  bool active_{false};
+};
+
+}  // namespace drake
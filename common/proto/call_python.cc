@@ -4,11 +4,16 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <condition_variable>
+#include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "drake/common/drake_assert.h"
@@ -128,23 +133,99 @@ std::ofstream* InitOutput(const std::optional<std::string>& filename) {
   return raw_output.access().get();
 }
 
-void PublishCall(std::ofstream* stream_arg, const lcmt_call_python& message) {
-  DRAKE_DEMAND(stream_arg != nullptr);
-  std::ofstream& stream = *stream_arg;
-
+std::vector<uint8_t> EncodeCall(const lcmt_call_python& message) {
   const int num_bytes = message.getEncodedSize();
   DRAKE_DEMAND(num_bytes >= 0);
-  const size_t size_bytes = static_cast<size_t>(num_bytes);
-  std::vector<uint8_t> encoded(size_bytes);
+  std::vector<uint8_t> encoded(static_cast<size_t>(num_bytes));
   message.encode(encoded.data(), 0, num_bytes);
+  return encoded;
+}
 
-  stream << size_bytes;
+void WriteCall(std::ofstream* stream_arg, const std::vector<uint8_t>& encoded) {
+  DRAKE_DEMAND(stream_arg != nullptr);
+  std::ofstream& stream = *stream_arg;
+
+  stream << encoded.size();
   stream << '\0';
   const void* const data = encoded.data();
   stream.write(static_cast<const char*>(data), encoded.size());
   stream << '\0';
+}
 
-  stream.flush();
+// Writes encoded calls to the output on a background thread, so that
+// CallPython() only pays for encoding its message. All of the calls that are
+// queued while a write is in progress are written as one batch, followed by a
+// single flush of the stream.
+class CallPythonWriter {
+ public:
+  // Once this many calls are pending, Push() waits for the writer to catch up
+  // rather than letting the queue grow without bound.
+  static constexpr size_t kMaxPending = 4096;
+
+  explicit CallPythonWriter(std::ofstream* stream) : stream_(stream) {
+    // The thread is never joined; CallPythonFlush() runs at exit instead.
+    std::thread([this]() { Run(); }).detach();
+  }
+
+  void Push(std::vector<uint8_t> encoded) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    written_.wait(lock, [this]() { return pending_.size() < kMaxPending; });
+    pending_.push_back(std::move(encoded));
+    ++num_pushed_;
+    pushed_.notify_one();
+  }
+
+  void Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    const int64_t target = num_pushed_;
+    written_.wait(lock, [this, target]() { return num_written_ >= target; });
+  }
+
+ private:
+  void Run() {
+    std::vector<std::vector<uint8_t>> batch;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        pushed_.wait(lock, [this]() { return !pending_.empty(); });
+        batch.swap(pending_);
+      }
+      for (const std::vector<uint8_t>& encoded : batch) {
+        WriteCall(stream_, encoded);
+      }
+      stream_->flush();
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        num_written_ += batch.size();
+      }
+      written_.notify_all();
+      batch.clear();
+    }
+  }
+
+  std::ofstream* const stream_;
+  std::mutex mutex_;
+  std::condition_variable pushed_;
+  std::condition_variable written_;
+  std::vector<std::vector<uint8_t>> pending_;
+  int64_t num_pushed_{0};
+  int64_t num_written_{0};
+};
+
+// Returns the writer singleton. When `create` is true, the writer (and, if
+// needed, the output) is created on first use; otherwise, returns nullptr if
+// nothing has been published yet.
+CallPythonWriter* GetWriter(bool create) {
+  static never_destroyed<std::mutex> mutex;
+  static never_destroyed<std::unique_ptr<CallPythonWriter>> writer;
+  std::lock_guard<std::mutex> lock(mutex.access());
+  if (!writer.access() && create) {
+    writer.access() =
+        std::make_unique<CallPythonWriter>(InitOutput(std::nullopt));
+    // Make sure that everything published reaches the client before exit.
+    std::atexit(&CallPythonFlush);
+  }
+  return writer.access().get();
 }
 
 }  // namespace
@@ -153,9 +234,15 @@ void CallPythonInit(const std::string& filename) {
   InitOutput(filename);
 }
 
+void CallPythonFlush() {
+  CallPythonWriter* const writer = GetWriter(false);
+  if (writer != nullptr) {
+    writer->Flush();
+  }
+}
+
 void internal::PublishCallPython(const lcmt_call_python& message) {
-  static const never_destroyed<std::ofstream*> output{InitOutput(std::nullopt)};
-  PublishCall(output.access(), message);
+  GetWriter(true)->Push(EncodeCall(message));
 }
 
 }  // namespace common
@@ -21,6 +21,12 @@ namespace common {
 /// already been called.
 void CallPythonInit(const std::string& filename);
 
+/// Blocks until every call issued so far by `CallPython` has been written to
+/// the file. Calls are written on a background thread, in order, so that
+/// `CallPython` does not wait for the Python client; all calls are also
+/// flushed automatically when the program exits.
+void CallPythonFlush();
+
 /// A proxy to a variable stored in Python side.
 class PythonRemoteVariable;
 
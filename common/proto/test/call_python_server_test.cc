@@ -189,6 +189,8 @@ else:
 with open(done_file, 'w') as f:
   f.write(str(done_count))
 )""");
+  // Wait until the calls above have been written to the pipe.
+  CallPythonFlush();
 }
 
 }  // namespace common
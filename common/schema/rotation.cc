@@ -93,5 +93,32 @@ math::RotationMatrix<Expression> Rotation::ToSymbolic() const {
   }, value);
 }
 
+math::RotationMatrixd Rotation::Sample(RandomGenerator* generator) const {
+  using Result = math::RotationMatrixd;
+  return std::visit(overloaded{
+    [](const Identity&) -> Result {
+      return Result{};
+    },
+    [generator](const Rpy& rpy) -> Result {
+      DRAKE_THROW_UNLESS(!std::holds_alternative<GaussianVector<3>>(rpy.deg));
+      const Eigen::Vector3d rpy_rad =
+          schema::ToDistributionVector(rpy.deg)->Sample(generator) *
+          (M_PI / 180.0);
+      return Result{math::RollPitchYawd(rpy_rad)};
+    },
+    [generator](const AngleAxis& aa) -> Result {
+      DRAKE_THROW_UNLESS(!std::holds_alternative<Gaussian>(aa.angle_deg));
+      const double angle_rad =
+          schema::Sample(aa.angle_deg, generator) * (M_PI / 180.0);
+      const Eigen::Vector3d axis =
+          schema::ToDistributionVector(aa.axis)->Sample(generator).normalized();
+      return Result{Eigen::AngleAxis<double>(angle_rad, axis)};
+    },
+    [generator](const Uniform&) -> Result {
+      return math::UniformlyRandomRotationMatrix<double>(generator);
+    },
+  }, value);
+}
+
 }  // namespace schema
 }  // namespace drake
@@ -148,13 +148,29 @@ unique_ptr<Distribution> ToDistribution(const DistributionVariant& var) {
   }, var);
 }
 
+// Unlike ToDistribution(var)->Sample(generator), this doesn't copy the
+// distribution onto the heap, which matters when sampling in a loop.
 double Sample(const DistributionVariant& var,
               drake::RandomGenerator* generator) {
-  return ToDistribution(var)->Sample(generator);
+  return std::visit(overloaded{
+    [](const double& arg) -> double {
+      return arg;
+    },
+    [generator](const auto& arg) -> double {
+      return arg.Sample(generator);
+    },
+  }, var);
 }
 
 double Mean(const DistributionVariant& var) {
-  return ToDistribution(var)->Mean();
+  return std::visit(overloaded{
+    [](const double& arg) -> double {
+      return arg;
+    },
+    [](const auto& arg) -> double {
+      return arg.Mean();
+    },
+  }, var);
 }
 
 Expression ToSymbolic(const DistributionVariant& var) {
@@ -83,6 +83,38 @@ GTEST_TEST(RotationTest, RpyUniform) {
   // correctly, and so do not verify them further here.
 }
 
+GTEST_TEST(RotationTest, Sample) {
+  RandomGenerator generator(0);
+
+  // Deterministic rotations sample to their value.
+  const Rotation identity;
+  EXPECT_TRUE(identity.Sample(&generator).IsExactlyIdentity());
+  const auto angle_axis = LoadYamlString<Rotation>(R"""(
+  value: !AngleAxis { angle_deg: 10.0, axis: [0, 2, 0] }
+  )""");
+  EXPECT_TRUE(angle_axis.Sample(&generator).IsNearlyEqualTo(
+      angle_axis.GetDeterministicValue(), 1e-14));
+
+  // Random angles stay within their range.
+  const auto rpy_uniform = LoadYamlString<Rotation>(R"""(
+  value: !Rpy { deg: !UniformVector { min: [0, 10, 20], max: [30, 40, 50] } }
+  )""");
+  for (int i = 0; i < 10; ++i) {
+    const Vector3d rpy_deg =
+        RollPitchYawd(rpy_uniform.Sample(&generator)).vector() * 180 / M_PI;
+    EXPECT_TRUE((rpy_deg.array() > Eigen::Array3d(0, 10, 20)).all());
+    EXPECT_TRUE((rpy_deg.array() < Eigen::Array3d(30, 40, 50)).all());
+  }
+
+  const auto uniform = LoadYamlString<Rotation>(R"""(
+  value: !Uniform {}
+  )""");
+  const math::RotationMatrixd sample1 = uniform.Sample(&generator);
+  const math::RotationMatrixd sample2 = uniform.Sample(&generator);
+  EXPECT_TRUE(sample1.IsValid());
+  EXPECT_FALSE(sample1.IsExactlyEqualTo(sample2));
+}
+
 // Ensure that we can write out YAML for Identity.
 GTEST_TEST(RotationTest, IdentityToYaml) {
   Rotation rotation;
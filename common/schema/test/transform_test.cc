@@ -1,5 +1,7 @@
 #include "drake/common/schema/transform.h"
 
+#include <random>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -104,6 +106,41 @@ GTEST_TEST(StochasticSampleTest, TransformTest) {
   EXPECT_TRUE(transform.Mean().IsExactlyEqualTo(expected_mean));
 }
 
+// Transform::Sample() draws the translation and then the rotation, each
+// element in order, directly from its distribution. This pins that sequence,
+// so that a change to the values drawn for a given seed is deliberate.
+GTEST_TEST(StochasticSampleTest, TransformSampleSequence) {
+  const auto transform = LoadYamlString<Transform>(random_bounded);
+  drake::RandomGenerator generator(0);
+  const drake::math::RigidTransformd sampled_transform =
+      transform.Sample(&generator);
+
+  drake::RandomGenerator expected_generator(0);
+  auto draw = [&expected_generator](double min, double max) {
+    return std::uniform_real_distribution<double>(min, max)(
+        expected_generator);
+  };
+  Eigen::Vector3d expected_translation;
+  for (int i = 0; i < 3; ++i) {
+    expected_translation[i] = draw(1. + i, 4. + i);
+  }
+  Eigen::Vector3d expected_rpy_deg;
+  expected_rpy_deg[0] = draw(380, 400);
+  expected_rpy_deg[1] = draw(-0.25, 0.25);
+  expected_rpy_deg[2] = draw(-1., 1.);
+  const drake::math::RigidTransformd expected(
+      drake::math::RollPitchYawd(expected_rpy_deg * (M_PI / 180.0)),
+      expected_translation);
+  EXPECT_TRUE(drake::CompareMatrices(
+      sampled_transform.GetAsMatrix34(), expected.GetAsMatrix34(), 1e-15));
+
+  // The translation, written out.
+  EXPECT_TRUE(drake::CompareMatrices(
+      sampled_transform.translation(),
+      Eigen::Vector3d(2.778533849550048, 4.532797232769795, 5.573836859969489),
+      1e-12));
+}
+
 }  // namespace
 }  // namespace schema
 }  // namespace drake
@@ -61,28 +61,11 @@ math::RigidTransformd Transform::Mean() const {
 
 math::RigidTransformd Transform::Sample(
     RandomGenerator* generator) const {
-  // It is somewhat yak-shavey to get an actual materialized transform here.
-  // We convert to symbolic, convert the symbolic to a vector and matrix of
-  // symbolic, `Evaluate` those, convert the result back to a
-  // `RigidTransform<double>`, and build the resulting values into a new
-  // fully determinstic `Transform`.
-  //
-  // This is *much* prettier written with `auto` but please do not be
-  // tempted to use it here: I have left the long type names in because it
-  // is impossible to debug Eigen `enable_if` error messages without them.
-  const math::RigidTransform<Expression> symbolic_transform =
-      ToSymbolic();
-
-  const Vector3<Expression> symbolic_translation =
-      symbolic_transform.translation();
+  // Sample the distributions directly, rather than evaluating ToSymbolic()
+  // with the generator; this is much faster when sampling many scenarios.
   const Eigen::Vector3d concrete_translation =
-      symbolic::Evaluate(symbolic_translation, {}, generator);
-
-  const math::RotationMatrix<Expression> symbolic_rotation =
-      symbolic_transform.rotation();
-  const math::RotationMatrixd concrete_rotation(
-      symbolic::Evaluate(symbolic_rotation.matrix(), {}, generator));
-
+      schema::ToDistributionVector(translation)->Sample(generator);
+  const math::RotationMatrixd concrete_rotation = rotation.Sample(generator);
   return math::RigidTransformd{concrete_rotation, concrete_translation};
 }
 
@@ -185,7 +185,8 @@ class Transform {
   math::RigidTransformd Mean() const;
 
   /// Samples this Transform.  If this is deterministic, the result is the same
-  /// as GetDeterministicValue.
+  /// as GetDeterministicValue.  The translation is sampled first, then the
+  /// rotation (see Rotation::Sample()).
   math::RigidTransformd Sample(RandomGenerator* generator) const;
 
   template <typename Archive>
@@ -49,5 +49,8 @@
 #include "drake/common/symbolic_formula_visitor.h"
 #include "drake/common/symbolic_simplification.h"
 #include "drake/common/symbolic_codegen.h"
+#include "drake/common/symbolic_compiled_expressions.h"
+#include "drake/common/symbolic_expression_interner.h"
+#include "drake/common/symbolic_packed_polynomial.h"
 // clang-format on
 #undef DRAKE_COMMON_SYMBOLIC_HEADER
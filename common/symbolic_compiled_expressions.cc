@@ -0,0 +1,777 @@
+#include "drake/common/symbolic_compiled_expressions.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/hash.h"
+
+namespace drake {
+namespace symbolic {
+
+using std::runtime_error;
+using std::vector;
+
+namespace {
+
+// The checks below mirror those performed by Expression::Evaluate().
+
+void ThrowIfDivisionByZero(double v1, double v2) {
+  if (v2 == 0.0) {
+    throw runtime_error(fmt::format("Division by zero: {} / {}", v1, v2));
+  }
+}
+
+void ThrowIfBadLog(double v) {
+  if (!(v >= 0)) {
+    throw std::domain_error(fmt::format(
+        "log({}) : numerical argument out of domain. {} is not in [0, +oo)", v,
+        v));
+  }
+}
+
+void ThrowIfBadSqrt(double v) {
+  if (!(v >= 0)) {
+    throw std::domain_error(fmt::format(
+        "sqrt({}) : numerical argument out of domain. {} is not in [0, +oo)",
+        v, v));
+  }
+}
+
+void ThrowIfBadPow(double v1, double v2) {
+  if (std::isfinite(v1) && (v1 < 0.0) && std::isfinite(v2) &&
+      (std::trunc(v2) != v2)) {
+    throw std::domain_error(fmt::format(
+        "pow({}, {}) : numerical argument out of domain. {} is finite "
+        "negative and {} is finite non-integer.",
+        v1, v2, v1, v2));
+  }
+}
+
+void ThrowIfBadAsinOrAcos(const char* name, double v) {
+  if (!((v >= -1.0) && (v <= 1.0))) {
+    throw std::domain_error(fmt::format(
+        "{}({}) : numerical argument out of domain. {} is not in [-1.0, +1.0]",
+        name, v, v));
+  }
+}
+
+}  // namespace
+
+// Translates expressions into instructions, numbering each distinct
+// subexpression (keyed on its operation and operand registers) only once.
+class CompiledExpressions::Compiler {
+ public:
+  Compiler(const Eigen::Ref<const VectorX<Variable>>& parameters,
+           CompiledExpressions* compiled)
+      : compiled_(*compiled) {
+    compiled_.num_parameters_ = parameters.size();
+    compiled_.initial_registers_.resize(parameters.size(), 0.0);
+    for (int i = 0; i < parameters.size(); ++i) {
+      const bool inserted =
+          parameter_registers_.emplace(parameters[i].get_id(), i).second;
+      if (!inserted) {
+        throw runtime_error(fmt::format(
+            "CompiledExpressions: the parameter {} appears more than once.",
+            parameters[i].get_name()));
+      }
+    }
+  }
+
+  // Returns the register holding the value of `e` once the instructions
+  // emitted so far have been executed.
+  int Compile(const Expression& e) {
+    switch (e.get_kind()) {
+      case ExpressionKind::Constant:
+        return Constant(get_constant_value(e));
+      case ExpressionKind::Var:
+        return Parameter(get_variable(e));
+      case ExpressionKind::Add:
+        return CompileAddition(e);
+      case ExpressionKind::Mul:
+        return CompileMultiplication(e);
+      case ExpressionKind::Div:
+        return CompileBinary(Op::kDiv, e);
+      case ExpressionKind::Log:
+        return CompileUnary(Op::kLog, e);
+      case ExpressionKind::Abs:
+        return CompileUnary(Op::kAbs, e);
+      case ExpressionKind::Exp:
+        return CompileUnary(Op::kExp, e);
+      case ExpressionKind::Sqrt:
+        return CompileUnary(Op::kSqrt, e);
+      case ExpressionKind::Pow:
+        return CompileBinary(Op::kCheckedPow, e);
+      case ExpressionKind::Sin:
+        return CompileUnary(Op::kSin, e);
+      case ExpressionKind::Cos:
+        return CompileUnary(Op::kCos, e);
+      case ExpressionKind::Tan:
+        return CompileUnary(Op::kTan, e);
+      case ExpressionKind::Asin:
+        return CompileUnary(Op::kAsin, e);
+      case ExpressionKind::Acos:
+        return CompileUnary(Op::kAcos, e);
+      case ExpressionKind::Atan:
+        return CompileUnary(Op::kAtan, e);
+      case ExpressionKind::Atan2:
+        return CompileBinary(Op::kAtan2, e);
+      case ExpressionKind::Sinh:
+        return CompileUnary(Op::kSinh, e);
+      case ExpressionKind::Cosh:
+        return CompileUnary(Op::kCosh, e);
+      case ExpressionKind::Tanh:
+        return CompileUnary(Op::kTanh, e);
+      case ExpressionKind::Min:
+        return CompileBinary(Op::kMin, e);
+      case ExpressionKind::Max:
+        return CompileBinary(Op::kMax, e);
+      case ExpressionKind::Ceil:
+        return CompileUnary(Op::kCeil, e);
+      case ExpressionKind::Floor:
+        return CompileUnary(Op::kFloor, e);
+      case ExpressionKind::IfThenElse:
+        if (IsCompilable(get_conditional_formula(e))) {
+          return CompileIfThenElse(e);
+        }
+        return CompileFallback(e);
+      case ExpressionKind::NaN:
+      case ExpressionKind::UninterpretedFunction:
+        return CompileFallback(e);
+    }
+    DRAKE_UNREACHABLE();
+  }
+
+ private:
+  // The value-numbering key of an instruction.
+  struct Key {
+    Op op{};
+    int a{};
+    int b{};
+    uint64_t k{};
+
+    bool operator==(const Key& other) const {
+      return op == other.op && a == other.a && b == other.b && k == other.k;
+    }
+
+    template <class HashAlgorithm>
+    friend void hash_append(HashAlgorithm& hasher, const Key& key) noexcept {
+      using drake::hash_append;
+      hash_append(hasher, static_cast<int>(key.op));
+      hash_append(hasher, key.a);
+      hash_append(hasher, key.b);
+      hash_append(hasher, key.k);
+    }
+  };
+
+  static uint64_t Bits(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  }
+
+  // Returns true iff `f` can be compiled into instructions by CompileFormula().
+  static bool IsCompilable(const Formula& f) {
+    switch (f.get_kind()) {
+      case FormulaKind::True:
+      case FormulaKind::False:
+      case FormulaKind::Eq:
+      case FormulaKind::Neq:
+      case FormulaKind::Gt:
+      case FormulaKind::Geq:
+      case FormulaKind::Lt:
+      case FormulaKind::Leq:
+        return true;
+      case FormulaKind::And:
+      case FormulaKind::Or:
+        for (const Formula& operand : get_operands(f)) {
+          if (!IsCompilable(operand)) return false;
+        }
+        return true;
+      case FormulaKind::Not:
+        return IsCompilable(get_operand(f));
+      default:
+        return false;
+    }
+  }
+
+  int NewRegister(double initial_value = 0.0) {
+    compiled_.initial_registers_.push_back(initial_value);
+    return static_cast<int>(compiled_.initial_registers_.size()) - 1;
+  }
+
+  int Constant(double value) {
+    const auto [iter, inserted] = constant_registers_.emplace(Bits(value), -1);
+    if (inserted) {
+      iter->second = NewRegister(value);
+    }
+    return iter->second;
+  }
+
+  int Parameter(const Variable& var) const {
+    const auto iter = parameter_registers_.find(var.get_id());
+    if (iter == parameter_registers_.end()) {
+      throw runtime_error(fmt::format(
+          "CompiledExpressions: the variable {} is not a parameter.",
+          var.get_name()));
+    }
+    return iter->second;
+  }
+
+  int ProgramSize() const {
+    return static_cast<int>(compiled_.program_.size());
+  }
+
+  // Appends an instruction without value numbering and returns its index.
+  int Append(Op op, int dst, int a, int b = 0, double k = 0.0) {
+    if (op == Op::kJump || op == Op::kJumpIfZero || op == Op::kFallback) {
+      compiled_.is_straight_line_ = false;
+    }
+    compiled_.program_.push_back(Instruction{op, dst, a, b, k});
+    return ProgramSize() - 1;
+  }
+
+  // Returns the register for the result of the given operation, appending an
+  // instruction only if the same operation has not been computed already.
+  int Emit(Op op, int a, int b = 0, double k = 0.0) {
+    if ((op == Op::kAdd || op == Op::kMul) && b < a) {
+      std::swap(a, b);
+    }
+    const Key key{op, a, b, Bits(k)};
+    const auto [iter, inserted] = numbered_.emplace(key, -1);
+    if (inserted) {
+      iter->second = NewRegister();
+      Append(op, iter->second, a, b, k);
+      numbered_log_.push_back(key);
+    }
+    return iter->second;
+  }
+
+  // Instructions emitted while compiling a branch are not necessarily
+  // executed, so their results must not be reused after the branch. A scope
+  // is the position in numbered_log_ where the branch began.
+  size_t BeginScope() const { return numbered_log_.size(); }
+
+  void EndScope(size_t scope) {
+    while (numbered_log_.size() > scope) {
+      numbered_.erase(numbered_log_.back());
+      numbered_log_.pop_back();
+    }
+  }
+
+  int CompileUnary(Op op, const Expression& e) {
+    return Emit(op, Compile(get_argument(e)));
+  }
+
+  int CompileBinary(Op op, const Expression& e) {
+    const int a = Compile(get_first_argument(e));
+    const int b = Compile(get_second_argument(e));
+    return Emit(op, a, b);
+  }
+
+  // c₀ + ∑ᵢ cᵢ eᵢ, accumulated in the same order as Expression::Evaluate().
+  int CompileAddition(const Expression& e) {
+    const double c0 = get_constant_in_addition(e);
+    int result = (c0 == 0.0) ? -1 : Constant(c0);
+    for (const auto& [e_i, c_i] : get_expr_to_coeff_map_in_addition(e)) {
+      const int term = Compile(e_i);
+      if (result < 0) {
+        result = (c_i == 1.0) ? term : Emit(Op::kScale, term, 0, c_i);
+      } else {
+        result = (c_i == 1.0) ? Emit(Op::kAdd, result, term)
+                              : Emit(Op::kAddScaled, result, term, c_i);
+      }
+    }
+    return (result < 0) ? Constant(c0) : result;
+  }
+
+  // c ∏ᵢ pow(bᵢ, eᵢ), accumulated in the same order as Expression::Evaluate().
+  int CompileMultiplication(const Expression& e) {
+    const double c = get_constant_in_multiplication(e);
+    int result = (c == 1.0) ? -1 : Constant(c);
+    for (const auto& [base, exponent] :
+         get_base_to_exponent_map_in_multiplication(e)) {
+      const int b = Compile(base);
+      int factor{};
+      if (is_one(exponent)) {
+        factor = b;
+      } else if (is_two(exponent)) {
+        factor = Emit(Op::kMul, b, b);
+      } else {
+        factor = Emit(Op::kPow, b, Compile(exponent));
+      }
+      result = (result < 0) ? factor : Emit(Op::kMul, result, factor);
+    }
+    return (result < 0) ? Constant(c) : result;
+  }
+
+  int CompileIfThenElse(const Expression& e) {
+    const int condition = CompileFormula(get_conditional_formula(e));
+    const int result = NewRegister();
+    const int jump_to_else = Append(Op::kJumpIfZero, 0, condition);
+    size_t scope = BeginScope();
+    Append(Op::kMove, result, Compile(get_then_expression(e)));
+    EndScope(scope);
+    const int jump_to_end = Append(Op::kJump, 0, 0);
+    compiled_.program_[jump_to_else].b = ProgramSize();
+    scope = BeginScope();
+    Append(Op::kMove, result, Compile(get_else_expression(e)));
+    EndScope(scope);
+    compiled_.program_[jump_to_end].b = ProgramSize();
+    return result;
+  }
+
+  // Returns the register holding 1.0 if `f` is true and 0.0 otherwise.
+  // Conjunctions and disjunctions short-circuit like Formula::Evaluate().
+  // @pre IsCompilable(f)
+  int CompileFormula(const Formula& f) {
+    switch (f.get_kind()) {
+      case FormulaKind::True:
+        return Constant(1.0);
+      case FormulaKind::False:
+        return Constant(0.0);
+      case FormulaKind::Eq:
+        return CompileRelational(Op::kEq, f);
+      case FormulaKind::Neq:
+        return CompileRelational(Op::kNeq, f);
+      case FormulaKind::Gt:
+        return CompileRelational(Op::kGt, f);
+      case FormulaKind::Geq:
+        return CompileRelational(Op::kGeq, f);
+      case FormulaKind::Lt:
+        return CompileRelational(Op::kLt, f);
+      case FormulaKind::Leq:
+        return CompileRelational(Op::kLeq, f);
+      case FormulaKind::And:
+      case FormulaKind::Or:
+        return CompileShortCircuit(f);
+      case FormulaKind::Not:
+        return Emit(Op::kNot, CompileFormula(get_operand(f)));
+      default:
+        DRAKE_UNREACHABLE();
+    }
+  }
+
+  int CompileRelational(Op op, const Formula& f) {
+    const int a = Compile(get_lhs_expression(f));
+    const int b = Compile(get_rhs_expression(f));
+    return Emit(op, a, b);
+  }
+
+  // For a conjunction, stops at the first false operand; for a disjunction,
+  // at the first true one.
+  int CompileShortCircuit(const Formula& f) {
+    const bool is_and = is_conjunction(f);
+    const int result = NewRegister();
+    vector<int> jumps_to_end;
+    const size_t scope = BeginScope();
+    for (const Formula& operand : get_operands(f)) {
+      const int value = CompileFormula(operand);
+      if (is_and) {
+        Append(Op::kMove, result, value);
+      } else {
+        // Store the negation, so that a zero means we are done.
+        Append(Op::kNot, result, value);
+      }
+      jumps_to_end.push_back(Append(Op::kJumpIfZero, 0, result));
+    }
+    EndScope(scope);
+    const int end = ProgramSize();
+    for (const int jump : jumps_to_end) {
+      compiled_.program_[jump].b = end;
+    }
+    if (is_and) {
+      return result;
+    }
+    Append(Op::kNot, result, result);
+    return result;
+  }
+
+  int CompileFallback(const Expression& e) {
+    Fallback fallback{e, {}};
+    for (const Variable& var : e.GetVariables()) {
+      fallback.variables.emplace_back(var, Parameter(var));
+    }
+    compiled_.fallbacks_.push_back(std::move(fallback));
+    const int result = NewRegister();
+    Append(Op::kFallback, result,
+           static_cast<int>(compiled_.fallbacks_.size()) - 1);
+    return result;
+  }
+
+  CompiledExpressions& compiled_;
+  std::unordered_map<Variable::Id, int> parameter_registers_;
+  std::unordered_map<uint64_t, int> constant_registers_;
+  std::unordered_map<Key, int, DefaultHash> numbered_;
+  vector<Key> numbered_log_;
+};
+
+CompiledExpressions::CompiledExpressions() = default;
+
+CompiledExpressions::CompiledExpressions(
+    const Eigen::Ref<const VectorX<Expression>>& expressions,
+    const Eigen::Ref<const VectorX<Variable>>& parameters) {
+  Compiler compiler(parameters, this);
+  result_registers_.reserve(expressions.size());
+  for (int i = 0; i < expressions.size(); ++i) {
+    result_registers_.push_back(compiler.Compile(expressions[i]));
+  }
+}
+
+void CompiledExpressions::Evaluate(
+    const Eigen::Ref<const Eigen::VectorXd>& parameters,
+    EigenPtr<Eigen::VectorXd> result) const {
+  DRAKE_THROW_UNLESS(parameters.size() == num_parameters_);
+  DRAKE_THROW_UNLESS(result != nullptr && result->size() == size());
+
+  vector<double> r(initial_registers_);
+  for (int i = 0; i < num_parameters_; ++i) {
+    r[i] = parameters[i];
+  }
+  Execute(r.data());
+  for (int i = 0; i < size(); ++i) {
+    (*result)[i] = r[result_registers_[i]];
+  }
+}
+
+Eigen::VectorXd CompiledExpressions::Evaluate(
+    const Eigen::Ref<const Eigen::VectorXd>& parameters) const {
+  Eigen::VectorXd result(size());
+  Evaluate(parameters, &result);
+  return result;
+}
+
+void CompiledExpressions::Execute(double* r) const {
+  const int program_size = static_cast<int>(program_.size());
+  for (int pc = 0; pc < program_size; ++pc) {
+    const Instruction& in = program_[pc];
+    switch (in.op) {
+      case Op::kMove:
+        r[in.dst] = r[in.a];
+        break;
+      case Op::kAdd:
+        r[in.dst] = r[in.a] + r[in.b];
+        break;
+      case Op::kAddScaled:
+        r[in.dst] = r[in.a] + r[in.b] * in.k;
+        break;
+      case Op::kScale:
+        r[in.dst] = r[in.a] * in.k;
+        break;
+      case Op::kMul:
+        r[in.dst] = r[in.a] * r[in.b];
+        break;
+      case Op::kPow:
+        r[in.dst] = std::pow(r[in.a], r[in.b]);
+        break;
+      case Op::kCheckedPow:
+        ThrowIfBadPow(r[in.a], r[in.b]);
+        r[in.dst] = std::pow(r[in.a], r[in.b]);
+        break;
+      case Op::kDiv:
+        ThrowIfDivisionByZero(r[in.a], r[in.b]);
+        r[in.dst] = r[in.a] / r[in.b];
+        break;
+      case Op::kAbs:
+        r[in.dst] = std::fabs(r[in.a]);
+        break;
+      case Op::kLog:
+        ThrowIfBadLog(r[in.a]);
+        r[in.dst] = std::log(r[in.a]);
+        break;
+      case Op::kExp:
+        r[in.dst] = std::exp(r[in.a]);
+        break;
+      case Op::kSqrt:
+        ThrowIfBadSqrt(r[in.a]);
+        r[in.dst] = std::sqrt(r[in.a]);
+        break;
+      case Op::kSin:
+        r[in.dst] = std::sin(r[in.a]);
+        break;
+      case Op::kCos:
+        r[in.dst] = std::cos(r[in.a]);
+        break;
+      case Op::kTan:
+        r[in.dst] = std::tan(r[in.a]);
+        break;
+      case Op::kAsin:
+        ThrowIfBadAsinOrAcos("asin", r[in.a]);
+        r[in.dst] = std::asin(r[in.a]);
+        break;
+      case Op::kAcos:
+        ThrowIfBadAsinOrAcos("acos", r[in.a]);
+        r[in.dst] = std::acos(r[in.a]);
+        break;
+      case Op::kAtan:
+        r[in.dst] = std::atan(r[in.a]);
+        break;
+      case Op::kAtan2:
+        r[in.dst] = std::atan2(r[in.a], r[in.b]);
+        break;
+      case Op::kSinh:
+        r[in.dst] = std::sinh(r[in.a]);
+        break;
+      case Op::kCosh:
+        r[in.dst] = std::cosh(r[in.a]);
+        break;
+      case Op::kTanh:
+        r[in.dst] = std::tanh(r[in.a]);
+        break;
+      case Op::kMin:
+        r[in.dst] = std::min(r[in.a], r[in.b]);
+        break;
+      case Op::kMax:
+        r[in.dst] = std::max(r[in.a], r[in.b]);
+        break;
+      case Op::kCeil:
+        r[in.dst] = std::ceil(r[in.a]);
+        break;
+      case Op::kFloor:
+        r[in.dst] = std::floor(r[in.a]);
+        break;
+      case Op::kEq:
+        r[in.dst] = (r[in.a] == r[in.b]) ? 1.0 : 0.0;
+        break;
+      case Op::kNeq:
+        r[in.dst] = (r[in.a] != r[in.b]) ? 1.0 : 0.0;
+        break;
+      case Op::kGt:
+        r[in.dst] = (r[in.a] > r[in.b]) ? 1.0 : 0.0;
+        break;
+      case Op::kGeq:
+        r[in.dst] = (r[in.a] >= r[in.b]) ? 1.0 : 0.0;
+        break;
+      case Op::kLt:
+        r[in.dst] = (r[in.a] < r[in.b]) ? 1.0 : 0.0;
+        break;
+      case Op::kLeq:
+        r[in.dst] = (r[in.a] <= r[in.b]) ? 1.0 : 0.0;
+        break;
+      case Op::kNot:
+        r[in.dst] = (r[in.a] == 0.0) ? 1.0 : 0.0;
+        break;
+      case Op::kJump:
+        pc = in.b - 1;
+        break;
+      case Op::kJumpIfZero:
+        if (r[in.a] == 0.0) {
+          pc = in.b - 1;
+        }
+        break;
+      case Op::kFallback: {
+        const Fallback& fallback = fallbacks_[in.a];
+        Environment env;
+        for (const auto& [var, index] : fallback.variables) {
+          env.insert(var, r[index]);
+        }
+        r[in.dst] = fallback.expression.Evaluate(env);
+        break;
+      }
+    }
+  }
+}
+
+void CompiledExpressions::ExecuteBlock(int num_lanes, double* r) const {
+  DRAKE_DEMAND(is_straight_line_);
+  const int n = num_lanes;
+  for (const Instruction& in : program_) {
+    double* const dst = r + in.dst * kBlockSize;
+    const double* const a = r + in.a * kBlockSize;
+    const double* const b = r + in.b * kBlockSize;
+    const double k = in.k;
+    // Each case is a loop over contiguous lanes, so that the compiler can
+    // vectorize it. The checked operations check every lane first.
+    switch (in.op) {
+      case Op::kMove:
+        for (int j = 0; j < n; ++j) dst[j] = a[j];
+        break;
+      case Op::kAdd:
+        for (int j = 0; j < n; ++j) dst[j] = a[j] + b[j];
+        break;
+      case Op::kAddScaled:
+        for (int j = 0; j < n; ++j) dst[j] = a[j] + b[j] * k;
+        break;
+      case Op::kScale:
+        for (int j = 0; j < n; ++j) dst[j] = a[j] * k;
+        break;
+      case Op::kMul:
+        for (int j = 0; j < n; ++j) dst[j] = a[j] * b[j];
+        break;
+      case Op::kPow:
+        for (int j = 0; j < n; ++j) dst[j] = std::pow(a[j], b[j]);
+        break;
+      case Op::kCheckedPow:
+        for (int j = 0; j < n; ++j) ThrowIfBadPow(a[j], b[j]);
+        for (int j = 0; j < n; ++j) dst[j] = std::pow(a[j], b[j]);
+        break;
+      case Op::kDiv:
+        for (int j = 0; j < n; ++j) ThrowIfDivisionByZero(a[j], b[j]);
+        for (int j = 0; j < n; ++j) dst[j] = a[j] / b[j];
+        break;
+      case Op::kAbs:
+        for (int j = 0; j < n; ++j) dst[j] = std::fabs(a[j]);
+        break;
+      case Op::kLog:
+        for (int j = 0; j < n; ++j) ThrowIfBadLog(a[j]);
+        for (int j = 0; j < n; ++j) dst[j] = std::log(a[j]);
+        break;
+      case Op::kExp:
+        for (int j = 0; j < n; ++j) dst[j] = std::exp(a[j]);
+        break;
+      case Op::kSqrt:
+        for (int j = 0; j < n; ++j) ThrowIfBadSqrt(a[j]);
+        for (int j = 0; j < n; ++j) dst[j] = std::sqrt(a[j]);
+        break;
+      case Op::kSin:
+        for (int j = 0; j < n; ++j) dst[j] = std::sin(a[j]);
+        break;
+      case Op::kCos:
+        for (int j = 0; j < n; ++j) dst[j] = std::cos(a[j]);
+        break;
+      case Op::kTan:
+        for (int j = 0; j < n; ++j) dst[j] = std::tan(a[j]);
+        break;
+      case Op::kAsin:
+        for (int j = 0; j < n; ++j) ThrowIfBadAsinOrAcos("asin", a[j]);
+        for (int j = 0; j < n; ++j) dst[j] = std::asin(a[j]);
+        break;
+      case Op::kAcos:
+        for (int j = 0; j < n; ++j) ThrowIfBadAsinOrAcos("acos", a[j]);
+        for (int j = 0; j < n; ++j) dst[j] = std::acos(a[j]);
+        break;
+      case Op::kAtan:
+        for (int j = 0; j < n; ++j) dst[j] = std::atan(a[j]);
+        break;
+      case Op::kAtan2:
+        for (int j = 0; j < n; ++j) dst[j] = std::atan2(a[j], b[j]);
+        break;
+      case Op::kSinh:
+        for (int j = 0; j < n; ++j) dst[j] = std::sinh(a[j]);
+        break;
+      case Op::kCosh:
+        for (int j = 0; j < n; ++j) dst[j] = std::cosh(a[j]);
+        break;
+      case Op::kTanh:
+        for (int j = 0; j < n; ++j) dst[j] = std::tanh(a[j]);
+        break;
+      case Op::kMin:
+        for (int j = 0; j < n; ++j) dst[j] = std::min(a[j], b[j]);
+        break;
+      case Op::kMax:
+        for (int j = 0; j < n; ++j) dst[j] = std::max(a[j], b[j]);
+        break;
+      case Op::kCeil:
+        for (int j = 0; j < n; ++j) dst[j] = std::ceil(a[j]);
+        break;
+      case Op::kFloor:
+        for (int j = 0; j < n; ++j) dst[j] = std::floor(a[j]);
+        break;
+      case Op::kEq:
+        for (int j = 0; j < n; ++j) dst[j] = (a[j] == b[j]) ? 1.0 : 0.0;
+        break;
+      case Op::kNeq:
+        for (int j = 0; j < n; ++j) dst[j] = (a[j] != b[j]) ? 1.0 : 0.0;
+        break;
+      case Op::kGt:
+        for (int j = 0; j < n; ++j) dst[j] = (a[j] > b[j]) ? 1.0 : 0.0;
+        break;
+      case Op::kGeq:
+        for (int j = 0; j < n; ++j) dst[j] = (a[j] >= b[j]) ? 1.0 : 0.0;
+        break;
+      case Op::kLt:
+        for (int j = 0; j < n; ++j) dst[j] = (a[j] < b[j]) ? 1.0 : 0.0;
+        break;
+      case Op::kLeq:
+        for (int j = 0; j < n; ++j) dst[j] = (a[j] <= b[j]) ? 1.0 : 0.0;
+        break;
+      case Op::kNot:
+        for (int j = 0; j < n; ++j) dst[j] = (a[j] == 0.0) ? 1.0 : 0.0;
+        break;
+      case Op::kJump:
+      case Op::kJumpIfZero:
+      case Op::kFallback:
+        DRAKE_UNREACHABLE();
+    }
+  }
+}
+
+void CompiledExpressions::EvaluateBatch(
+    const Eigen::Ref<const Eigen::MatrixXd>& parameters,
+    EigenPtr<Eigen::MatrixXd> result, Parallelism parallelism) const {
+  DRAKE_THROW_UNLESS(parameters.rows() == num_parameters_);
+  DRAKE_THROW_UNLESS(result != nullptr && result->rows() == size());
+  DRAKE_THROW_UNLESS(result->cols() == parameters.cols());
+
+  const int num_samples = parameters.cols();
+  const int num_registers = static_cast<int>(initial_registers_.size());
+  const int num_blocks = (num_samples + kBlockSize - 1) / kBlockSize;
+  const int num_threads = std::min(parallelism.num_threads(), num_blocks);
+
+  // Each thread has its own registers, whose constants are set only once:
+  // the program never writes them.
+  vector<vector<double>> thread_registers(std::max(num_threads, 1));
+  const int registers_per_thread =
+      is_straight_line_ ? num_registers * kBlockSize : num_registers;
+  for (vector<double>& r : thread_registers) {
+    r.resize(registers_per_thread);
+    if (is_straight_line_) {
+      for (int i = num_parameters_; i < num_registers; ++i) {
+        std::fill_n(r.data() + i * kBlockSize, kBlockSize,
+                    initial_registers_[i]);
+      }
+    }
+  }
+
+  StaticParallelForIndexLoop(
+      Parallelism(std::max(num_threads, 1)), 0, num_blocks,
+      [&](const int thread_num, const int block) {
+        double* const r = thread_registers[thread_num].data();
+        const int begin = block * kBlockSize;
+        const int num_lanes = std::min(kBlockSize, num_samples - begin);
+        if (!is_straight_line_) {
+          // Conditionals may branch differently for each sample, so run the
+          // scalar program once per sample.
+          for (int j = begin; j < begin + num_lanes; ++j) {
+            std::copy(initial_registers_.begin(), initial_registers_.end(), r);
+            for (int i = 0; i < num_parameters_; ++i) {
+              r[i] = parameters(i, j);
+            }
+            Execute(r);
+            for (int i = 0; i < size(); ++i) {
+              (*result)(i, j) = r[result_registers_[i]];
+            }
+          }
+          return;
+        }
+        for (int i = 0; i < num_parameters_; ++i) {
+          for (int j = 0; j < num_lanes; ++j) {
+            r[i * kBlockSize + j] = parameters(i, begin + j);
+          }
+        }
+        ExecuteBlock(num_lanes, r);
+        for (int i = 0; i < size(); ++i) {
+          const double* const value = r + result_registers_[i] * kBlockSize;
+          for (int j = 0; j < num_lanes; ++j) {
+            (*result)(i, begin + j) = value[j];
+          }
+        }
+      });
+}
+
+Eigen::MatrixXd CompiledExpressions::EvaluateBatch(
+    const Eigen::Ref<const Eigen::MatrixXd>& parameters,
+    Parallelism parallelism) const {
+  Eigen::MatrixXd result(size(), parameters.cols());
+  EvaluateBatch(parameters, &result, parallelism);
+  return result;
+}
+
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace symbolic {
+
+/** Compiles a vector of symbolic expressions into a compact, register-based
+instruction sequence which can then be evaluated numerically many times,
+without walking the expression trees or consulting an Environment.
+
+Compilation numbers each distinct subexpression once, so that a subexpression
+which appears several times among the given expressions (e.g., in a vector of
+expressions together with its Jacobian) is only computed once per evaluation.
+The evaluated results agree with Expression::Evaluate(), including its
+exceptions for out-of-domain arguments (e.g., `log(-1)` or division by zero).
+Conditional expressions evaluate only the branch that is taken.
+
+Expressions that can't be compiled into instructions (e.g., uninterpreted
+functions, or if-then-else expressions whose condition is not a relational,
+logical, or constant formula) are still supported: such a subexpression is
+evaluated with Expression::Evaluate() whenever it is needed.
+
+For example:
+@code
+const Variable x("x"), y("y");
+const Vector2<Expression> f(x * sin(y), x * cos(y));
+const CompiledExpressions compiled(f, Vector2<Variable>(x, y));
+const Eigen::VectorXd value = compiled.Evaluate(Eigen::Vector2d(2.0, 0.5));
+@endcode
+
+To evaluate the same expressions at many values of the parameters, prefer
+EvaluateBatch(), which runs the program over blocks of samples at a time.
+
+Evaluate() and EvaluateBatch() are const and may be called from several threads
+at once. */
+class CompiledExpressions {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CompiledExpressions)
+
+  /** Constructs an empty instance, with no parameters and no results. */
+  CompiledExpressions();
+
+  /** Compiles @p expressions, using @p parameters to provide the ordering of
+  the symbolic variables that they may contain.
+  @throws std::exception if any expression contains a variable that is not
+  in @p parameters, or if @p parameters contains duplicates. */
+  CompiledExpressions(const Eigen::Ref<const VectorX<Expression>>& expressions,
+                      const Eigen::Ref<const VectorX<Variable>>& parameters);
+
+  /** Returns the number of compiled expressions. */
+  int size() const { return static_cast<int>(result_registers_.size()); }
+
+  /** Returns the number of parameters expected by Evaluate(). */
+  int num_parameters() const { return num_parameters_; }
+
+  /** Returns the number of instructions in the compiled program. Each
+  distinct subexpression contributes at most one. */
+  int num_instructions() const { return static_cast<int>(program_.size()); }
+
+  /** Evaluates the compiled expressions using the given @p parameters values,
+  which must be ordered as the `parameters` given at construction, and writes
+  them into @p result.
+  @pre parameters.size() == num_parameters()
+  @pre result != nullptr && result->size() == size()
+  @throws std::exception if the evaluation of any expression would throw. */
+  void Evaluate(const Eigen::Ref<const Eigen::VectorXd>& parameters,
+                EigenPtr<Eigen::VectorXd> result) const;
+
+  /** Returns the compiled expressions evaluated using the given @p parameters
+  values. See the other overload for details. */
+  Eigen::VectorXd Evaluate(
+      const Eigen::Ref<const Eigen::VectorXd>& parameters) const;
+
+  /** Evaluates the compiled expressions at each column of @p parameters, whose
+  rows are ordered as the `parameters` given at construction, and writes the
+  results into the corresponding column of @p result.
+
+  Unless the program contains conditionals or fallbacks, each instruction is
+  applied to a block of samples at once, as a loop over contiguous registers
+  that the compiler can vectorize. Blocks are distributed over the threads
+  allowed by @p parallelism.
+  @pre parameters.rows() == num_parameters()
+  @pre result != nullptr && result->rows() == size()
+  @pre result->cols() == parameters.cols()
+  @throws std::exception if the evaluation of any expression at any sample
+  would throw. */
+  void EvaluateBatch(const Eigen::Ref<const Eigen::MatrixXd>& parameters,
+                     EigenPtr<Eigen::MatrixXd> result,
+                     Parallelism parallelism = Parallelism::None()) const;
+
+  /** Returns the compiled expressions evaluated at each column of
+  @p parameters. See the other overload for details. */
+  Eigen::MatrixXd EvaluateBatch(
+      const Eigen::Ref<const Eigen::MatrixXd>& parameters,
+      Parallelism parallelism = Parallelism::None()) const;
+
+ private:
+  class Compiler;
+
+  // The number of samples per block in EvaluateBatch().
+  static constexpr int kBlockSize = 32;
+
+  // Runs the program over the registers `r`, whose parameters and constants
+  // are already set.
+  void Execute(double* r) const;
+
+  // Runs the program over `num_lanes` samples at once. Register i of lane j is
+  // `r[i * kBlockSize + j]`, and the parameters and constants must already be
+  // set. @pre is_straight_line_
+  void ExecuteBlock(int num_lanes, double* r) const;
+
+  // Each instruction writes register `dst` from the registers `a` and `b`
+  // and the constant `k`, as documented for each operation. Jumps use `b` as
+  // the target instruction index.
+  enum class Op : uint8_t {
+    kMove,        // r[a]
+    kAdd,         // r[a] + r[b]
+    kAddScaled,   // r[a] + r[b] * k
+    kScale,       // r[a] * k
+    kMul,         // r[a] * r[b]
+    kPow,         // pow(r[a], r[b])
+    kCheckedPow,  // pow(r[a], r[b]), checking the domain.
+    kDiv,         // r[a] / r[b], checking for division by zero.
+    kAbs,
+    kLog,
+    kExp,
+    kSqrt,
+    kSin,
+    kCos,
+    kTan,
+    kAsin,
+    kAcos,
+    kAtan,
+    kAtan2,
+    kSinh,
+    kCosh,
+    kTanh,
+    kMin,
+    kMax,
+    kCeil,
+    kFloor,
+    kEq,          // r[a] == r[b] ? 1 : 0, and so on.
+    kNeq,
+    kGt,
+    kGeq,
+    kLt,
+    kLeq,
+    kNot,         // r[a] == 0 ? 1 : 0
+    kJump,        // Continue at instruction b.
+    kJumpIfZero,  // Continue at instruction b if r[a] == 0.
+    kFallback,    // fallbacks_[a] evaluated with Expression::Evaluate().
+  };
+
+  struct Instruction {
+    Op op{};
+    int dst{};
+    int a{};
+    int b{};
+    double k{};
+  };
+
+  // A subexpression which has no corresponding instructions, along with the
+  // registers of the variables that it contains.
+  struct Fallback {
+    Expression expression;
+    std::vector<std::pair<Variable, int>> variables;
+  };
+
+  // Registers [0, num_parameters_) hold the parameters, and are followed by
+  // the constants and the temporaries in order of creation. Of the latter,
+  // only the constants have meaningful values in initial_registers_.
+  int num_parameters_{};
+  std::vector<double> initial_registers_;
+  std::vector<Instruction> program_;
+  std::vector<Fallback> fallbacks_;
+  std::vector<int> result_registers_;
+  // Whether the program has no jumps and no fallbacks.
+  bool is_straight_line_{true};
+};
+
+}  // namespace symbolic
+}  // namespace drake
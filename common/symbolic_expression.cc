@@ -8,6 +8,8 @@
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Core>
@@ -15,6 +17,7 @@
 #include <fmt/ostream.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
 #include "drake/common/never_destroyed.h"
 #include "drake/common/symbolic.h"
 #define DRAKE_COMMON_SYMBOLIC_DETAIL_HEADER
@@ -221,20 +224,112 @@ Expression Expression::Expand() const {
   return result;
 }
 
+namespace {
+
+// Memoizes the results of a traversal (Substitute or Differentiate) over the
+// subexpressions of a DAG, so that a cell shared by several parents is only
+// processed once. A traversal is identified by its argument (the Substitution
+// object, or the Variable's id); the memo of the innermost traversal in
+// progress on this thread is reachable through `active()`, so that the
+// recursive calls made by the cells share it without any change to their
+// signatures.
+template <typename Argument>
+class TraversalMemo {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TraversalMemo)
+
+  // Makes this the active memo of the calling thread until destruction.
+  explicit TraversalMemo(Argument argument)
+      : argument_(argument), previous_(active()) {
+    active() = this;
+  }
+
+  ~TraversalMemo() { active() = previous_; }
+
+  // Returns the memo for `argument` if it is active, or nullptr.
+  static TraversalMemo* Find(const Argument& argument) {
+    TraversalMemo* const memo = active();
+    return (memo != nullptr && memo->argument_ == argument) ? memo : nullptr;
+  }
+
+  // Returns the result for `e`, computing it with `calc(e)` only once.
+  // Cells that only one Expression refers to cannot be reached twice, so
+  // they are not recorded.
+  template <typename Calc>
+  Expression Get(const Expression& e, const ExpressionCell* cell,
+                 bool is_shared, const Calc& calc) {
+    if (!is_shared) {
+      return calc();
+    }
+    const auto iter = results_.find(cell);
+    if (iter != results_.end()) {
+      return iter->second.second;
+    }
+    Expression result = calc();
+    // Keep `e` alive along with its result, so that the cell's address is not
+    // reused by another subexpression during this traversal.
+    results_.emplace(cell, std::make_pair(e, result));
+    return result;
+  }
+
+ private:
+  static TraversalMemo*& active() {
+    thread_local TraversalMemo* active_memo{nullptr};
+    return active_memo;
+  }
+
+  const Argument argument_;
+  TraversalMemo* const previous_;
+  std::unordered_map<const ExpressionCell*, pair<Expression, Expression>>
+      results_;
+};
+
+using SubstituteMemo = TraversalMemo<const Substitution*>;
+using DifferentiateMemo = TraversalMemo<Variable::Id>;
+
+// Returns true iff `kind` has no subexpressions, so that memoizing it cannot
+// save any work.
+bool IsLeaf(ExpressionKind kind) {
+  return kind == ExpressionKind::Constant || kind == ExpressionKind::Var ||
+         kind == ExpressionKind::NaN;
+}
+
+}  // namespace
+
 Expression Expression::Substitute(const Variable& var,
                                   const Expression& e) const {
-  return cell().Substitute({{var, e}});
+  return Substitute(Substitution{{var, e}});
 }
 
 Expression Expression::Substitute(const Substitution& s) const {
-  if (!s.empty()) {
+  if (s.empty()) {
+    return *this;
+  }
+  if (IsLeaf(get_kind())) {
     return cell().Substitute(s);
   }
-  return *this;
+  auto calc = [this, &s]() {
+    return cell().Substitute(s);
+  };
+  if (SubstituteMemo* memo = SubstituteMemo::Find(&s)) {
+    return memo->Get(*this, &cell(), ptr_.use_count() > 1, calc);
+  }
+  SubstituteMemo memo(&s);
+  return calc();
 }
 
 Expression Expression::Differentiate(const Variable& x) const {
-  return cell().Differentiate(x);
+  if (IsLeaf(get_kind())) {
+    return cell().Differentiate(x);
+  }
+  auto calc = [this, &x]() {
+    return cell().Differentiate(x);
+  };
+  if (DifferentiateMemo* memo = DifferentiateMemo::Find(x.get_id())) {
+    return memo->Get(*this, &cell(), ptr_.use_count() > 1, calc);
+  }
+  DifferentiateMemo memo(x.get_id());
+  return calc();
 }
 
 RowVectorX<Expression> Expression::Jacobian(
@@ -899,14 +994,31 @@ VectorX<Variable> GetVariableVector(
   return vec;
 }
 
+namespace internal {
+void SubstituteEach(const Substitution& subst, Expression* data, int size) {
+  DRAKE_DEMAND(size == 0 || data != nullptr);
+  if (subst.empty()) {
+    return;
+  }
+  // Subexpressions shared among the elements are substituted once.
+  SubstituteMemo memo(&subst);
+  for (int i = 0; i < size; ++i) {
+    data[i] = data[i].Substitute(subst);
+  }
+}
+}  // namespace internal
+
 MatrixX<Expression> Jacobian(const Eigen::Ref<const VectorX<Expression>>& f,
                              const vector<Variable>& vars) {
   DRAKE_DEMAND(!vars.empty());
   const Eigen::Ref<const VectorX<Expression>>::Index n{f.size()};
   const size_t m{vars.size()};
   MatrixX<Expression> J(n, m);
-  for (int i = 0; i < n; ++i) {
-    for (size_t j = 0; j < m; ++j) {
+  for (size_t j = 0; j < m; ++j) {
+    // Subexpressions shared among the elements of f are differentiated once
+    // per variable.
+    DifferentiateMemo memo(vars[j].get_id());
+    for (int i = 0; i < n; ++i) {
       J(i, j) = f[i].Differentiate(vars[j]);
     }
   }
@@ -546,6 +546,7 @@ class Expression {
 
   friend class ExpressionAddFactory;
   friend class ExpressionMulFactory;
+  friend class ExpressionInterner;
 
  private:
   // This is a helper function used to handle `Expression(double)` constructor.
@@ -1360,7 +1361,14 @@ Eigen::SparseMatrix<double> Evaluate(
     const Eigen::Ref<const Eigen::SparseMatrix<Expression>>& m,
     const Environment& env = Environment{});
 
+namespace internal {
+// Replaces each of the `size` expressions at `data` with the result of its
+// Substitute(subst), processing the subexpressions that they share only once.
+void SubstituteEach(const Substitution& subst, Expression* data, int size);
+}  // namespace internal
+
 /// Substitutes a symbolic matrix @p m using a given substitution @p subst.
+/// Subexpressions shared among the elements of @p m are substituted once.
 ///
 /// @returns a matrix of symbolic expressions whose size is the size of @p m.
 /// @throws std::exception if NaN is detected during substitution.
@@ -1373,8 +1381,12 @@ Substitute(const Eigen::MatrixBase<Derived>& m, const Substitution& subst) {
                 "Substitute only accepts a symbolic matrix.");
   // Note that the return type is written out explicitly to help gcc 5 (on
   // ubuntu).
-  return m.unaryExpr(
-      [&subst](const Expression& e) { return e.Substitute(subst); });
+  Eigen::Matrix<Expression, Derived::RowsAtCompileTime,
+                Derived::ColsAtCompileTime, 0, Derived::MaxRowsAtCompileTime,
+                Derived::MaxColsAtCompileTime>
+      result = m;
+  internal::SubstituteEach(subst, result.data(), result.size());
+  return result;
 }
 
 /// Substitutes @p var with @p e in a symbolic matrix @p m.
@@ -1401,7 +1413,8 @@ VectorX<Variable> GetVariableVector(
     const Eigen::Ref<const VectorX<Expression>>& expressions);
 
 /// Computes the Jacobian matrix J of the vector function @p f with respect to
-/// @p vars. J(i,j) contains ∂f(i)/∂vars(j).
+/// @p vars. J(i,j) contains ∂f(i)/∂vars(j). Subexpressions shared among the
+/// elements of @p f are differentiated once per variable.
 ///
 ///  For example, Jacobian([x * cos(y), x * sin(y), x^2], {x, y}) returns the
 ///  following 3x2 matrix:
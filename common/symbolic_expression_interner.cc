@@ -0,0 +1,312 @@
+#include "drake/common/symbolic_expression_interner.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <memory>
+
+#include "drake/common/drake_assert.h"
+#define DRAKE_COMMON_SYMBOLIC_DETAIL_HEADER
+#include "drake/common/symbolic_expression_cell.h"
+#undef DRAKE_COMMON_SYMBOLIC_DETAIL_HEADER
+
+namespace drake {
+namespace symbolic {
+
+using std::make_shared;
+using std::vector;
+
+namespace {
+
+uint64_t Bits(double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+}  // namespace
+
+ExpressionInterner::ExpressionInterner() = default;
+
+ExpressionInterner::~ExpressionInterner() = default;
+
+Expression ExpressionInterner::Intern(const Expression& e) {
+  if (interned_.count(Address(e)) > 0) {
+    return e;
+  }
+  vector<Expression> operands;
+  Key key;
+  if (!GetInternedOperands(e, &operands, &key)) {
+    const auto [iter, inserted] = opaque_.insert(e);
+    if (inserted) {
+      interned_.insert(Address(e));
+    }
+    return *iter;
+  }
+  const auto iter = cells_.find(key);
+  if (iter != cells_.end()) {
+    return iter->second;
+  }
+  const Expression result = Rebuild(e, operands);
+  cells_.emplace(std::move(key), result);
+  interned_.insert(Address(result));
+  return result;
+}
+
+Expression ExpressionInterner::Expand(const Expression& e) {
+  const Expression interned = Intern(e);
+  const auto iter = expanded_.find(Address(interned));
+  if (iter != expanded_.end()) {
+    return iter->second;
+  }
+  const Expression result = Intern(interned.Expand());
+  expanded_.emplace(Address(interned), result);
+  return result;
+}
+
+Expression ExpressionInterner::Differentiate(const Expression& e,
+                                             const Variable& x) {
+  const Expression interned = Intern(e);
+  Key key{{Address(interned), x.get_id()}};
+  const auto iter = derivatives_.find(key);
+  if (iter != derivatives_.end()) {
+    return iter->second;
+  }
+  const Expression result = Intern(interned.Differentiate(x));
+  derivatives_.emplace(std::move(key), result);
+  return result;
+}
+
+Expression ExpressionInterner::Substitute(const Expression& e,
+                                          const Substitution& s) {
+  const Expression interned = Intern(e);
+  // Substitutions are unordered, so sort the pairs to obtain a unique key.
+  vector<std::pair<uint64_t, uint64_t>> pairs;
+  pairs.reserve(s.size());
+  for (const auto& [var, value] : s) {
+    pairs.emplace_back(var.get_id(), Address(Intern(value)));
+  }
+  std::sort(pairs.begin(), pairs.end());
+  Key key;
+  key.words.reserve(1 + 2 * pairs.size());
+  key.words.push_back(Address(interned));
+  for (const auto& [id, address] : pairs) {
+    key.words.push_back(id);
+    key.words.push_back(address);
+  }
+  const auto iter = substituted_.find(key);
+  if (iter != substituted_.end()) {
+    return iter->second;
+  }
+  const Expression result = Intern(interned.Substitute(s));
+  substituted_.emplace(std::move(key), result);
+  return result;
+}
+
+void ExpressionInterner::Clear() {
+  cells_.clear();
+  opaque_.clear();
+  interned_.clear();
+  expanded_.clear();
+  derivatives_.clear();
+  substituted_.clear();
+}
+
+bool ExpressionInterner::GetInternedOperands(const Expression& e,
+                                             vector<Expression>* operands,
+                                             Key* key) {
+  key->words.push_back(static_cast<uint64_t>(e.get_kind()));
+  auto add_operand = [this, operands, key](const Expression& operand) {
+    operands->push_back(Intern(operand));
+    key->words.push_back(Address(operands->back()));
+  };
+  switch (e.get_kind()) {
+    case ExpressionKind::Constant:
+      key->words.push_back(Bits(get_constant_value(e)));
+      return true;
+    case ExpressionKind::Var:
+      key->words.push_back(get_variable(e).get_id());
+      return true;
+    case ExpressionKind::Add:
+      key->words.push_back(Bits(get_constant_in_addition(e)));
+      for (const auto& [term, coeff] : get_expr_to_coeff_map_in_addition(e)) {
+        add_operand(term);
+        key->words.push_back(Bits(coeff));
+      }
+      return true;
+    case ExpressionKind::Mul:
+      key->words.push_back(Bits(get_constant_in_multiplication(e)));
+      for (const auto& [base, exponent] :
+           get_base_to_exponent_map_in_multiplication(e)) {
+        add_operand(base);
+        add_operand(exponent);
+      }
+      return true;
+    case ExpressionKind::Div:
+    case ExpressionKind::Pow:
+    case ExpressionKind::Atan2:
+    case ExpressionKind::Min:
+    case ExpressionKind::Max:
+      add_operand(get_first_argument(e));
+      add_operand(get_second_argument(e));
+      return true;
+    case ExpressionKind::Log:
+    case ExpressionKind::Abs:
+    case ExpressionKind::Exp:
+    case ExpressionKind::Sqrt:
+    case ExpressionKind::Sin:
+    case ExpressionKind::Cos:
+    case ExpressionKind::Tan:
+    case ExpressionKind::Asin:
+    case ExpressionKind::Acos:
+    case ExpressionKind::Atan:
+    case ExpressionKind::Sinh:
+    case ExpressionKind::Cosh:
+    case ExpressionKind::Tanh:
+    case ExpressionKind::Ceil:
+    case ExpressionKind::Floor:
+      add_operand(get_argument(e));
+      return true;
+    case ExpressionKind::IfThenElse:
+    case ExpressionKind::NaN:
+    case ExpressionKind::UninterpretedFunction:
+      return false;
+  }
+  DRAKE_UNREACHABLE();
+}
+
+Expression ExpressionInterner::Rebuild(const Expression& e,
+                                       const vector<Expression>& operands) {
+  // Reuse the cell of `e` when its operands are already interned.
+  vector<const Expression*> originals;
+  switch (e.get_kind()) {
+    case ExpressionKind::Add:
+      for (const auto& [term, coeff] : get_expr_to_coeff_map_in_addition(e)) {
+        originals.push_back(&term);
+      }
+      break;
+    case ExpressionKind::Mul:
+      for (const auto& [base, exponent] :
+           get_base_to_exponent_map_in_multiplication(e)) {
+        originals.push_back(&base);
+        originals.push_back(&exponent);
+      }
+      break;
+    case ExpressionKind::Constant:
+    case ExpressionKind::Var:
+      break;
+    default:
+      if (operands.size() == 1) {
+        originals.push_back(&get_argument(e));
+      } else {
+        originals.push_back(&get_first_argument(e));
+        originals.push_back(&get_second_argument(e));
+      }
+  }
+  DRAKE_DEMAND(originals.size() == operands.size());
+  bool unchanged = true;
+  for (size_t i = 0; i < operands.size(); ++i) {
+    unchanged = unchanged && (Address(*originals[i]) == Address(operands[i]));
+  }
+  if (unchanged) {
+    return e;
+  }
+
+  std::shared_ptr<ExpressionCell> cell;
+  switch (e.get_kind()) {
+    case ExpressionKind::Add: {
+      std::map<Expression, double> expr_to_coeff_map;
+      auto operand = operands.begin();
+      for (const auto& [term, coeff] : get_expr_to_coeff_map_in_addition(e)) {
+        expr_to_coeff_map.emplace_hint(expr_to_coeff_map.end(), *operand++,
+                                       coeff);
+      }
+      cell = make_shared<ExpressionAdd>(get_constant_in_addition(e),
+                                        expr_to_coeff_map);
+      break;
+    }
+    case ExpressionKind::Mul: {
+      std::map<Expression, Expression> base_to_exponent_map;
+      for (size_t i = 0; i < operands.size(); i += 2) {
+        base_to_exponent_map.emplace_hint(base_to_exponent_map.end(),
+                                          operands[i], operands[i + 1]);
+      }
+      cell = make_shared<ExpressionMul>(get_constant_in_multiplication(e),
+                                        base_to_exponent_map);
+      break;
+    }
+    case ExpressionKind::Div:
+      cell = make_shared<ExpressionDiv>(operands[0], operands[1]);
+      break;
+    case ExpressionKind::Pow:
+      cell = make_shared<ExpressionPow>(operands[0], operands[1]);
+      break;
+    case ExpressionKind::Atan2:
+      cell = make_shared<ExpressionAtan2>(operands[0], operands[1]);
+      break;
+    case ExpressionKind::Min:
+      cell = make_shared<ExpressionMin>(operands[0], operands[1]);
+      break;
+    case ExpressionKind::Max:
+      cell = make_shared<ExpressionMax>(operands[0], operands[1]);
+      break;
+    case ExpressionKind::Log:
+      cell = make_shared<ExpressionLog>(operands[0]);
+      break;
+    case ExpressionKind::Abs:
+      cell = make_shared<ExpressionAbs>(operands[0]);
+      break;
+    case ExpressionKind::Exp:
+      cell = make_shared<ExpressionExp>(operands[0]);
+      break;
+    case ExpressionKind::Sqrt:
+      cell = make_shared<ExpressionSqrt>(operands[0]);
+      break;
+    case ExpressionKind::Sin:
+      cell = make_shared<ExpressionSin>(operands[0]);
+      break;
+    case ExpressionKind::Cos:
+      cell = make_shared<ExpressionCos>(operands[0]);
+      break;
+    case ExpressionKind::Tan:
+      cell = make_shared<ExpressionTan>(operands[0]);
+      break;
+    case ExpressionKind::Asin:
+      cell = make_shared<ExpressionAsin>(operands[0]);
+      break;
+    case ExpressionKind::Acos:
+      cell = make_shared<ExpressionAcos>(operands[0]);
+      break;
+    case ExpressionKind::Atan:
+      cell = make_shared<ExpressionAtan>(operands[0]);
+      break;
+    case ExpressionKind::Sinh:
+      cell = make_shared<ExpressionSinh>(operands[0]);
+      break;
+    case ExpressionKind::Cosh:
+      cell = make_shared<ExpressionCosh>(operands[0]);
+      break;
+    case ExpressionKind::Tanh:
+      cell = make_shared<ExpressionTanh>(operands[0]);
+      break;
+    case ExpressionKind::Ceil:
+      cell = make_shared<ExpressionCeiling>(operands[0]);
+      break;
+    case ExpressionKind::Floor:
+      cell = make_shared<ExpressionFloor>(operands[0]);
+      break;
+    default:
+      DRAKE_UNREACHABLE();
+  }
+  if (e.is_expanded()) {
+    cell->set_expanded();
+  }
+  return Expression{std::move(cell)};
+}
+
+uint64_t ExpressionInterner::Address(const Expression& e) {
+  return reinterpret_cast<uintptr_t>(&e.cell());
+}
+
+}  // namespace symbolic
+}  // namespace drake
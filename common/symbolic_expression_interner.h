@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/hash.h"
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace symbolic {
+
+/** Hash-conses symbolic expressions, so that structurally equal
+subexpressions share a single ExpressionCell, and memoizes Expand(),
+Differentiate(), and Substitute() results by the identity of those cells.
+
+Every expression returned by this class is interned: it is structurally equal
+(see Expression::EqualTo()) to the expression it was computed from, and each of
+its subexpressions is the same cell as any structurally equal subexpression of
+any other expression returned by this instance. This saves memory when large
+polynomials contain many repeated subtrees, and lets repeated calls of the
+memoized operations on equal arguments return in constant time.
+
+The memoization applies to the expressions passed to the methods below, not to
+the intermediate subexpressions visited by Expression::Expand() and the like.
+Callers that operate term-by-term (e.g., on the entries of a Gram matrix, or
+the coefficients of a Polynomial) see the largest benefit.
+
+Expressions which are not returned by an instance of this class are
+unaffected. Subexpressions of if-then-else expressions and of uninterpreted
+functions are not shared, although those expressions are themselves interned
+as a whole.
+
+The interned expressions remain valid after this object is destroyed or
+cleared. This class is not thread-safe.
+
+For example:
+@code
+ExpressionInterner interner;
+const Expression p = interner.Intern(pow(x + y, 2) + pow(x + y, 3));
+const Expression q = interner.Expand(p);
+// Returns q immediately, without expanding p again.
+const Expression r = interner.Expand(pow(x + y, 2) + pow(x + y, 3));
+@endcode */
+class ExpressionInterner {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ExpressionInterner)
+
+  /** Constructs an instance with no interned expressions. */
+  ExpressionInterner();
+
+  ~ExpressionInterner();
+
+  /** Returns the interned expression that is structurally equal to @p e. */
+  Expression Intern(const Expression& e);
+
+  /** Returns the interned `e.Expand()`.
+  @throws std::exception if NaN is detected during expansion. */
+  Expression Expand(const Expression& e);
+
+  /** Returns the interned `e.Differentiate(x)`.
+  @throws std::exception if @p e is not differentiable. */
+  Expression Differentiate(const Expression& e, const Variable& x);
+
+  /** Returns the interned `e.Substitute(s)`.
+  @throws std::exception if NaN is detected during substitution. */
+  Expression Substitute(const Expression& e, const Substitution& s);
+
+  /** Returns the number of distinct expressions (including subexpressions)
+  interned so far. */
+  int size() const {
+    return static_cast<int>(cells_.size() + opaque_.size());
+  }
+
+  /** Discards all of the interned expressions and memoized results. */
+  void Clear();
+
+ private:
+  // A sequence of words identifying an interned cell, or the arguments of a
+  // memoized operation. The words are kinds, addresses of interned cells,
+  // variable ids, and the bits of constants.
+  struct Key {
+    std::vector<uint64_t> words;
+
+    bool operator==(const Key& other) const { return words == other.words; }
+
+    template <class HashAlgorithm>
+    friend void hash_append(HashAlgorithm& hasher, const Key& key) noexcept {
+      using drake::hash_append;
+      for (const uint64_t word : key.words) {
+        hash_append(hasher, word);
+      }
+      hash_append(hasher, key.words.size());
+    }
+  };
+
+  // Returns the interned operands of `e` in `operands`, and its key. Returns
+  // false iff `e` is interned as a whole, without a key.
+  bool GetInternedOperands(const Expression& e,
+                           std::vector<Expression>* operands, Key* key);
+
+  // Returns an expression equal to `e`, whose operands are `operands`.
+  static Expression Rebuild(const Expression& e,
+                            const std::vector<Expression>& operands);
+
+  // Returns the address of the cell of `e`, as a word of a Key.
+  static uint64_t Address(const Expression& e);
+
+  // Maps the keys of the interned cells to the expressions that own them.
+  std::unordered_map<Key, Expression, DefaultHash> cells_;
+  // The expressions that are interned as a whole, without a Key.
+  std::unordered_set<Expression> opaque_;
+  // The addresses of all of the interned cells.
+  std::unordered_set<uint64_t> interned_;
+
+  // The memoized results, keyed on the addresses of their interned arguments.
+  std::unordered_map<uint64_t, Expression> expanded_;
+  std::unordered_map<Key, Expression, DefaultHash> derivatives_;
+  std::unordered_map<Key, Expression, DefaultHash> substituted_;
+};
+
+}  // namespace symbolic
+}  // namespace drake
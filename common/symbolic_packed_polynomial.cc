@@ -0,0 +1,275 @@
+#include "drake/common/symbolic_packed_polynomial.h"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <unordered_set>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/hash.h"
+
+namespace drake {
+namespace symbolic {
+
+using std::vector;
+
+// Collects the terms of a sum into a PackedPolynomial, combining the terms
+// with equal exponents. The exponents of each new term are written in place
+// into NewRow(), and committed by Add().
+class PackedPolynomial::Accumulator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Accumulator)
+
+  Accumulator(vector<Variable> indeterminates, int capacity)
+      : indeterminates_(std::move(indeterminates)),
+        n_(static_cast<int>(indeterminates_.size())),
+        index_(capacity, RowHash{this}, RowEqual{this}) {
+    exponents_.reserve(static_cast<size_t>(capacity + 1) * n_);
+    coefficients_.reserve(capacity);
+  }
+
+  // Returns the storage for the exponents of the next term.
+  int* NewRow() {
+    exponents_.resize(exponents_.size() + n_);
+    return exponents_.data() + exponents_.size() - n_;
+  }
+
+  // Adds `coeff` times the monomial in NewRow(). This mirrors DoAddProduct()
+  // in symbolic_polynomial.cc, except that a cancelled term keeps its slot
+  // (with a zero coefficient) until Build().
+  void Add(const Expression& coeff) {
+    const int candidate = static_cast<int>(coefficients_.size());
+    if (is_zero(coeff)) {
+      exponents_.resize(static_cast<size_t>(candidate) * n_);
+      return;
+    }
+    const auto [iter, inserted] = index_.insert(candidate);
+    if (inserted) {
+      coefficients_.push_back(coeff);
+      return;
+    }
+    exponents_.resize(static_cast<size_t>(candidate) * n_);
+    Expression& existing = coefficients_[*iter];
+    if (is_zero(existing)) {
+      existing = coeff;
+    } else if (is_zero(existing.Expand() + coeff.Expand())) {
+      existing = Expression::Zero();
+    } else {
+      existing += coeff;
+    }
+  }
+
+  // Returns the accumulated terms with non-zero coefficients, sorted by
+  // their exponents in lexicographic order.
+  PackedPolynomial Build() {
+    vector<int> order;
+    order.reserve(coefficients_.size());
+    for (int i = 0; i < static_cast<int>(coefficients_.size()); ++i) {
+      if (!is_zero(coefficients_[i])) {
+        order.push_back(i);
+      }
+    }
+    std::sort(order.begin(), order.end(), [this](int a, int b) {
+      return std::lexicographical_compare(row(a), row(a) + n_, row(b),
+                                          row(b) + n_);
+    });
+    PackedPolynomial result;
+    result.indeterminates_ = std::move(indeterminates_);
+    result.exponents_.reserve(order.size() * n_);
+    result.coefficients_.reserve(order.size());
+    for (const int i : order) {
+      result.exponents_.insert(result.exponents_.end(), row(i), row(i) + n_);
+      result.coefficients_.push_back(std::move(coefficients_[i]));
+    }
+    return result;
+  }
+
+ private:
+  struct RowHash {
+    size_t operator()(int i) const {
+      drake::internal::FNV1aHasher hasher;
+      hasher(self->row(i), self->n_ * sizeof(int));
+      return static_cast<size_t>(hasher);
+    }
+    const Accumulator* self;
+  };
+
+  struct RowEqual {
+    bool operator()(int a, int b) const {
+      return std::equal(self->row(a), self->row(a) + self->n_, self->row(b));
+    }
+    const Accumulator* self;
+  };
+
+  const int* row(int i) const {
+    return exponents_.data() + static_cast<size_t>(i) * n_;
+  }
+
+  vector<Variable> indeterminates_;
+  const int n_;
+  vector<int> exponents_;
+  vector<Expression> coefficients_;
+  // The indices of the terms, hashed by their exponents.
+  std::unordered_set<int, RowHash, RowEqual> index_;
+};
+
+namespace {
+
+// Returns the sorted union of two sorted lists of variables.
+vector<Variable> Union(const vector<Variable>& vars1,
+                       const vector<Variable>& vars2) {
+  vector<Variable> result;
+  result.reserve(vars1.size() + vars2.size());
+  std::set_union(vars1.begin(), vars1.end(), vars2.begin(), vars2.end(),
+                 std::back_inserter(result),
+                 [](const Variable& v1, const Variable& v2) {
+                   return v1.less(v2);
+                 });
+  return result;
+}
+
+}  // namespace
+
+PackedPolynomial::PackedPolynomial() = default;
+
+PackedPolynomial::PackedPolynomial(const Polynomial& p)
+    : indeterminates_(p.indeterminates().begin(), p.indeterminates().end()) {
+  const int n = static_cast<int>(indeterminates_.size());
+  const Polynomial::MapType& map = p.monomial_to_coefficient_map();
+  exponents_.resize(map.size() * n, 0);
+  coefficients_.reserve(map.size());
+  int* row = exponents_.data();
+  // Both the indeterminates and the powers of each monomial are sorted, and
+  // the map's monomial order is the lexicographic order of the exponents.
+  for (const auto& [monomial, coeff] : map) {
+    int k = 0;
+    for (const auto& [var, exponent] : monomial.get_powers()) {
+      while (!indeterminates_[k].equal_to(var)) {
+        ++k;
+        DRAKE_DEMAND(k < n);
+      }
+      row[k] = exponent;
+    }
+    coefficients_.push_back(coeff);
+    row += n;
+  }
+}
+
+Eigen::Map<const Eigen::VectorXi> PackedPolynomial::exponents(int i) const {
+  DRAKE_DEMAND(0 <= i && i < num_terms());
+  const int n = static_cast<int>(indeterminates_.size());
+  return Eigen::Map<const Eigen::VectorXi>(
+      exponents_.data() + static_cast<size_t>(i) * n, n);
+}
+
+const Expression& PackedPolynomial::coefficient(int i) const {
+  DRAKE_DEMAND(0 <= i && i < num_terms());
+  return coefficients_[i];
+}
+
+Polynomial::MapType PackedPolynomial::ToMonomialToCoefficientMap() const {
+  const int n = static_cast<int>(indeterminates_.size());
+  Polynomial::MapType result;
+  const int* row = exponents_.data();
+  for (const Expression& coeff : coefficients_) {
+    std::map<Variable, int> powers;
+    for (int k = 0; k < n; ++k) {
+      if (row[k] > 0) {
+        powers.emplace_hint(powers.end(), indeterminates_[k], row[k]);
+      }
+    }
+    result.emplace_hint(result.end(), Monomial(powers), coeff);
+    row += n;
+  }
+  return result;
+}
+
+Polynomial PackedPolynomial::ToPolynomial() const {
+  return Polynomial(ToMonomialToCoefficientMap());
+}
+
+PackedPolynomial& PackedPolynomial::operator+=(const PackedPolynomial& p) {
+  vector<Variable> indeterminates = Union(indeterminates_, p.indeterminates_);
+  const PackedPolynomial p1 = Widen(indeterminates);
+  const PackedPolynomial p2 = p.Widen(indeterminates);
+  const int n = static_cast<int>(indeterminates.size());
+  Accumulator accumulator(std::move(indeterminates),
+                          p1.num_terms() + p2.num_terms());
+  for (const PackedPolynomial* summand : {&p1, &p2}) {
+    for (int i = 0; i < summand->num_terms(); ++i) {
+      std::copy_n(summand->exponents_.data() + static_cast<size_t>(i) * n, n,
+                  accumulator.NewRow());
+      accumulator.Add(summand->coefficients_[i]);
+    }
+  }
+  *this = accumulator.Build();
+  return *this;
+}
+
+PackedPolynomial& PackedPolynomial::operator*=(const PackedPolynomial& p) {
+  // (c₁₁ * m₁₁ + ... + c₁ₙ * m₁ₙ) * (c₂₁ * m₂₁ + ... + c₂ₘ * m₂ₘ), with the
+  // products accumulated in the same order as Polynomial::operator*=().
+  vector<Variable> indeterminates = Union(indeterminates_, p.indeterminates_);
+  const PackedPolynomial p1 = Widen(indeterminates);
+  const PackedPolynomial p2 = p.Widen(indeterminates);
+  const int n = static_cast<int>(indeterminates.size());
+  Accumulator accumulator(std::move(indeterminates),
+                          std::max(p1.num_terms(), p2.num_terms()));
+  for (int i = 0; i < p1.num_terms(); ++i) {
+    const int* row_i = p1.exponents_.data() + static_cast<size_t>(i) * n;
+    for (int j = 0; j < p2.num_terms(); ++j) {
+      const int* row_j = p2.exponents_.data() + static_cast<size_t>(j) * n;
+      int* row = accumulator.NewRow();
+      for (int k = 0; k < n; ++k) {
+        row[k] = row_i[k] + row_j[k];
+      }
+      accumulator.Add(p1.coefficients_[i] * p2.coefficients_[j]);
+    }
+  }
+  *this = accumulator.Build();
+  return *this;
+}
+
+PackedPolynomial PackedPolynomial::Widen(
+    const vector<Variable>& indeterminates) const {
+  if (indeterminates.size() == indeterminates_.size()) {
+    return *this;
+  }
+  const int n_old = static_cast<int>(indeterminates_.size());
+  const int n_new = static_cast<int>(indeterminates.size());
+  // position[k] is the index in `indeterminates` of indeterminates_[k].
+  vector<int> position(n_old);
+  for (int k = 0, k_new = 0; k < n_old; ++k) {
+    while (!indeterminates[k_new].equal_to(indeterminates_[k])) {
+      ++k_new;
+      DRAKE_DEMAND(k_new < n_new);
+    }
+    position[k] = k_new;
+  }
+  PackedPolynomial result;
+  result.indeterminates_ = indeterminates;
+  result.exponents_.resize(coefficients_.size() * n_new, 0);
+  result.coefficients_ = coefficients_;
+  for (int i = 0; i < num_terms(); ++i) {
+    for (int k = 0; k < n_old; ++k) {
+      result.exponents_[static_cast<size_t>(i) * n_new + position[k]] =
+          exponents_[static_cast<size_t>(i) * n_old + k];
+    }
+  }
+  return result;
+}
+
+PackedPolynomial operator+(PackedPolynomial p1, const PackedPolynomial& p2) {
+  return p1 += p2;
+}
+
+PackedPolynomial operator*(const PackedPolynomial& p1,
+                           const PackedPolynomial& p2) {
+  PackedPolynomial result{p1};
+  return result *= p2;
+}
+
+}  // namespace symbolic
+}  // namespace drake
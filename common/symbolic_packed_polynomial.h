@@ -0,0 +1,89 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace symbolic {
+
+/** Represents a polynomial as flat arrays: a sorted list of indeterminates,
+and for each term a packed row of exponents (one per indeterminate) and a
+coefficient. It is meant for the inner loops of large polynomial arithmetic,
+where creating a Monomial (whose powers are a `std::map<Variable, int>`) and
+searching the `std::map<Monomial, Expression>` of a Polynomial per term
+dominate. Convert from and to Polynomial at the boundaries.
+
+Addition and multiplication accumulate terms with the same exponents in a hash
+table. The coefficients are added in the same order, and cancelled by the same
+rule, as Polynomial::operator+=() and Polynomial::operator*=(), so that the
+converted results are identical.
+
+For example:
+@code
+const PackedPolynomial p1(Polynomial(pow(x + y, 10)));
+const PackedPolynomial p2(Polynomial(pow(x - y, 10)));
+const Polynomial product = (p1 * p2).ToPolynomial();
+@endcode */
+class PackedPolynomial {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(PackedPolynomial)
+
+  /** Constructs a zero polynomial with no indeterminates. */
+  PackedPolynomial();
+
+  /** Constructs from @p p, using `p.indeterminates()` as the indeterminates.
+  */
+  explicit PackedPolynomial(const Polynomial& p);
+
+  /** Returns the indeterminates, sorted by their ids. */
+  const std::vector<Variable>& indeterminates() const {
+    return indeterminates_;
+  }
+
+  /** Returns the number of terms. Terms whose coefficients are zero are not
+  stored. */
+  int num_terms() const { return static_cast<int>(coefficients_.size()); }
+
+  /** Returns the exponents of the indeterminates() in the @p i'th term.
+  @pre 0 <= i < num_terms() */
+  Eigen::Map<const Eigen::VectorXi> exponents(int i) const;
+
+  /** Returns the coefficient of the @p i'th term.
+  @pre 0 <= i < num_terms() */
+  const Expression& coefficient(int i) const;
+
+  /** Returns the map from monomials to coefficients of this polynomial, as in
+  Polynomial::monomial_to_coefficient_map(). */
+  Polynomial::MapType ToMonomialToCoefficientMap() const;
+
+  /** Returns this polynomial as a Polynomial. Its indeterminates are those
+  that appear in its monomials, as for Polynomial(Polynomial::MapType). */
+  Polynomial ToPolynomial() const;
+
+  PackedPolynomial& operator+=(const PackedPolynomial& p);
+  PackedPolynomial& operator*=(const PackedPolynomial& p);
+
+ private:
+  class Accumulator;
+
+  // Returns a copy of this polynomial over the given indeterminates.
+  // @pre indeterminates is sorted and includes all of indeterminates_.
+  PackedPolynomial Widen(const std::vector<Variable>& indeterminates) const;
+
+  std::vector<Variable> indeterminates_;
+  // The exponents of the i'th term are
+  // exponents_[i * indeterminates_.size(), (i + 1) * indeterminates_.size()).
+  std::vector<int> exponents_;
+  std::vector<Expression> coefficients_;
+};
+
+PackedPolynomial operator+(PackedPolynomial p1, const PackedPolynomial& p2);
+PackedPolynomial operator*(const PackedPolynomial& p1,
+                           const PackedPolynomial& p2);
+
+}  // namespace symbolic
+}  // namespace drake
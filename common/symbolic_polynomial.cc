@@ -6,6 +6,7 @@
 #include <stdexcept>
 #include <utility>
 
+#include "drake/common/drake_throw.h"
 #include "drake/common/symbolic.h"
 #define DRAKE_COMMON_SYMBOLIC_DETAIL_HEADER
 #include "drake/common/symbolic_expression_cell.h"
@@ -24,6 +25,10 @@ namespace drake {
 namespace symbolic {
 
 namespace {
+// Polynomial::operator*=(const Polynomial&) switches to PackedPolynomial when
+// the number of pairs of terms reaches this size.
+constexpr size_t kMinPackedProductSize = 64;
+
 // Helper function to add coeff * m to a map (Monomial → Expression).
 // Used to implement DecomposePolynomialVisitor::VisitAddition and
 // Polynomial::Add.
@@ -542,6 +547,21 @@ double Polynomial::Evaluate(const Environment& env) const {
       });
 }
 
+Eigen::VectorXd Polynomial::EvaluateIndeterminates(
+    const Eigen::Ref<const VectorX<symbolic::Variable>>& indeterminates,
+    const Eigen::Ref<const Eigen::MatrixXd>& indeterminates_values) const {
+  DRAKE_THROW_UNLESS(indeterminates_values.rows() == indeterminates.rows());
+  if (!decision_variables().empty()) {
+    ostringstream oss;
+    oss << "Polynomial::EvaluateIndeterminates(): the coefficients of " << *this
+        << " contain the decision variables " << decision_variables() << ".";
+    throw runtime_error(oss.str());
+  }
+  const CompiledExpressions compiled(Vector1<Expression>(ToExpression()),
+                                     indeterminates);
+  return compiled.EvaluateBatch(indeterminates_values).row(0).transpose();
+}
+
 Polynomial Polynomial::EvaluatePartial(const Environment& env) const {
   MapType new_map;  // Will use this to construct the return value.
   for (const auto& product_i : monomial_to_coefficient_map_) {
@@ -627,15 +647,25 @@ Polynomial& Polynomial::operator*=(const Polynomial& p) {
   // (c₁₁ * m₁₁ + ... + c₁ₙ * m₁ₙ) * (c₂₁ * m₂₁ + ... + c₂ₘ * m₂ₘ)
   // = (c₁₁ * m₁₁ + ... + c₁ₙ * m₁ₙ) * c₂₁ * m₂₁ + ... +
   //   (c₁₁ * m₁₁ + ... + c₁ₙ * m₁ₙ) * c₂ₘ * m₂ₘ
-  MapType new_map{};
-  for (const auto& p1 : monomial_to_coefficient_map_) {
-    for (const auto& p2 : p.monomial_to_coefficient_map()) {
-      const Monomial new_monomial{p1.first * p2.first};
-      const Expression new_coeff{p1.second * p2.second};
-      DoAddProduct(new_coeff, new_monomial, &new_map);
+  if (monomial_to_coefficient_map_.size() *
+          p.monomial_to_coefficient_map().size() >=
+      kMinPackedProductSize) {
+    // For large products, avoid constructing a Monomial and searching the
+    // map for each pair of terms. The result is the same.
+    PackedPolynomial product{*this};
+    product *= PackedPolynomial{p};
+    monomial_to_coefficient_map_ = product.ToMonomialToCoefficientMap();
+  } else {
+    MapType new_map{};
+    for (const auto& p1 : monomial_to_coefficient_map_) {
+      for (const auto& p2 : p.monomial_to_coefficient_map()) {
+        const Monomial new_monomial{p1.first * p2.first};
+        const Expression new_coeff{p1.second * p2.second};
+        DoAddProduct(new_coeff, new_monomial, &new_map);
+      }
     }
+    monomial_to_coefficient_map_ = std::move(new_map);
   }
-  monomial_to_coefficient_map_ = std::move(new_map);
   indeterminates_ += p.indeterminates();
   decision_variables_ += p.decision_variables();
   DRAKE_ASSERT_VOID(CheckInvariant());
@@ -187,6 +187,22 @@ class Polynomial {
   /// assignment is not provided by @p env.
   double Evaluate(const Environment& env) const;
 
+  /// Evaluates this polynomial at many values of its indeterminates, where
+  /// `indeterminates_values(i, j)` is the value of `indeterminates(i)` in the
+  /// j'th sample, and returns the vector of the values at each sample.
+  ///
+  /// The polynomial is compiled once (see CompiledExpressions) and evaluated
+  /// over blocks of samples at a time, which is much faster than calling
+  /// Evaluate() once per sample.
+  ///
+  /// @throws std::exception if the coefficients of this polynomial contain
+  /// decision variables, if @p indeterminates does not contain all of the
+  /// indeterminates of this polynomial or contains duplicates, or if
+  /// `indeterminates_values.rows() != indeterminates.rows()`.
+  Eigen::VectorXd EvaluateIndeterminates(
+      const Eigen::Ref<const VectorX<symbolic::Variable>>& indeterminates,
+      const Eigen::Ref<const Eigen::MatrixXd>& indeterminates_values) const;
+
   /// Partially evaluates this polynomial using an environment @p env.
   ///
   /// @throws std::exception if NaN is detected during evaluation.
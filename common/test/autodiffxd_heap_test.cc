@@ -28,6 +28,39 @@ class AutoDiffXdHeapTest : public ::testing::Test {
 // evidence that the technique is strictly necessary. However, future
 // implementations may be vulnerable to dead-code elimination.
 
+// Arithmetic uses an rvalue on either side as storage for its result.
+TEST_F(AutoDiffXdHeapTest, Addition) {
+  LimitMalloc guard({.max_num_allocations = 2, .min_num_allocations = 2});
+  volatile auto v = (x_ + y_) + y_;
+  volatile auto w = x_ + (x_ + y_);
+}
+
+TEST_F(AutoDiffXdHeapTest, Subtraction) {
+  LimitMalloc guard({.max_num_allocations = 2, .min_num_allocations = 2});
+  volatile auto v = (x_ + y_) - y_;
+  volatile auto w = x_ - (x_ + y_);
+}
+
+TEST_F(AutoDiffXdHeapTest, Multiplication) {
+  LimitMalloc guard({.max_num_allocations = 2, .min_num_allocations = 2});
+  volatile auto v = (x_ + y_) * y_;
+  volatile auto w = x_ * (x_ + y_);
+}
+
+TEST_F(AutoDiffXdHeapTest, Division) {
+  LimitMalloc guard({.max_num_allocations = 2, .min_num_allocations = 2});
+  volatile auto v = (x_ + y_) / y_;
+  volatile auto w = x_ / (x_ + y_);
+}
+
+// A multiply-add allocates only for the product, whatever the order of its
+// terms.
+TEST_F(AutoDiffXdHeapTest, MultiplyAdd) {
+  LimitMalloc guard({.max_num_allocations = 2, .min_num_allocations = 2});
+  volatile auto v = x_ * y_ + x_;
+  volatile auto w = x_ + x_ * y_;
+}
+
 TEST_F(AutoDiffXdHeapTest, Abs) {
   LimitMalloc guard({.max_num_allocations = 1, .min_num_allocations = 1});
   volatile auto v = abs(x_ + y_);
@@ -83,7 +83,9 @@ class AutoDiffXdTest : public ::testing::Test {
   CHECK_EXPR((c bop x)bop y);         \
   CHECK_EXPR(x bop(y bop c));         \
   CHECK_EXPR(x bop(c bop y));         \
-  CHECK_EXPR(c bop(x bop y));
+  CHECK_EXPR(c bop(x bop y));         \
+  CHECK_EXPR(y bop(x bop c));         \
+  CHECK_EXPR(y bop(x bop y));
 
 // The multiplicative factor 0.9 < 1.0 let us call function such as asin, acos,
 // etc. whose arguments must be in (-1, 1).
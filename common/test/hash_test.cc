@@ -1,5 +1,8 @@
 #include "drake/common/hash.h"
 
+#include <set>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -52,5 +55,26 @@ GTEST_TEST(HashTest, HashAppendOptional) {
   EXPECT_NE(hash_empty1.record().size(), hash_nonempty1.record().size());
 }
 
+GTEST_TEST(HashTest, WordMixHasher) {
+  using Hash = uhash<internal::WordMixHasher>;
+  const Hash hash;
+
+  // Equal values hash equally; nearby values don't collide, and their hashes
+  // differ in the low bits used to pick hash table buckets.
+  EXPECT_EQ(hash(int64_t{7}), hash(int64_t{7}));
+  std::set<size_t> low_bits;
+  for (int64_t i = 0; i < 64; ++i) {
+    EXPECT_NE(hash(i), hash(i + 1));
+    low_bits.insert(hash(i) & 0xFF);
+  }
+  EXPECT_GT(low_bits.size(), 32);
+
+  // Inputs longer than one word and shorter than one word are both consumed.
+  EXPECT_NE(hash(std::make_pair(int64_t{1}, int64_t{2})),
+            hash(std::make_pair(int64_t{1}, int64_t{3})));
+  EXPECT_NE(hash(std::string("a")), hash(std::string("b")));
+  EXPECT_NE(hash(std::string("abcdefghi")), hash(std::string("abcdefghj")));
+}
+
 }  // namespace
 }  // namespace drake
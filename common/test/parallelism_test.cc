@@ -0,0 +1,92 @@
+#include "drake/common/parallelism.h"
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace {
+
+GTEST_TEST(ParallelismTest, Constructors) {
+  EXPECT_EQ(Parallelism().num_threads(), 1);
+  EXPECT_EQ(Parallelism::None().num_threads(), 1);
+  EXPECT_EQ(Parallelism(false).num_threads(), 1);
+  EXPECT_EQ(Parallelism(3).num_threads(), 3);
+
+  const int max = Parallelism::Max().num_threads();
+  EXPECT_GE(max, 1);
+  EXPECT_EQ(Parallelism(true).num_threads(), max);
+  const unsigned hardware = std::thread::hardware_concurrency();
+  if (hardware > 0) {
+    EXPECT_EQ(max, static_cast<int>(hardware));
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(Parallelism(0),
+                              ".*num_threads >= 1.*0 was given.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(Parallelism(-2),
+                              ".*num_threads >= 1.*-2 was given.*");
+}
+
+// Every index is visited exactly once, with a valid thread number, and each
+// thread visits a contiguous, increasing block of indices.
+GTEST_TEST(ParallelismTest, StaticParallelForIndexLoop) {
+  for (int num_threads : {1, 2, 3, 7, 20}) {
+    for (int num_indices : {0, 1, 2, 5, 19, 100}) {
+      SCOPED_TRACE(fmt::format("num_threads = {}, num_indices = {}",
+                               num_threads, num_indices));
+      const int begin = 4;
+      std::vector<int> visits(num_indices, 0);
+      std::vector<int> owner(num_indices, -1);
+      StaticParallelForIndexLoop(Parallelism(num_threads), begin,
+                                 begin + num_indices,
+                                 [&](int thread_num, int index) {
+                                   ASSERT_GE(thread_num, 0);
+                                   ASSERT_LT(thread_num, num_threads);
+                                   ++visits[index - begin];
+                                   owner[index - begin] = thread_num;
+                                 });
+      for (int i = 0; i < num_indices; ++i) {
+        EXPECT_EQ(visits[i], 1);
+        if (i > 0) {
+          EXPECT_GE(owner[i], owner[i - 1]);
+        }
+      }
+    }
+  }
+}
+
+GTEST_TEST(ParallelismTest, StaticParallelForIndexLoopSerialOrder) {
+  std::vector<int> order;
+  StaticParallelForIndexLoop(Parallelism::None(), 0, 5,
+                             [&](int thread_num, int index) {
+                               EXPECT_EQ(thread_num, 0);
+                               order.push_back(index);
+                             });
+  EXPECT_EQ(order, std::vector<int>({0, 1, 2, 3, 4}));
+}
+
+GTEST_TEST(ParallelismTest, StaticParallelForIndexLoopThrows) {
+  for (int num_threads : {1, 4}) {
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        StaticParallelForIndexLoop(Parallelism(num_threads), 0, 10,
+                                   [](int, int index) {
+                                     if (index >= 3) {
+                                       throw std::runtime_error(
+                                           fmt::format("bad {}", index));
+                                     }
+                                   }),
+        "bad 3");
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      StaticParallelForIndexLoop(Parallelism::None(), 2, 1,
+                                 [](int, int) {}),
+      ".*loop_begin <= loop_end.*");
+}
+
+}  // namespace
+}  // namespace drake
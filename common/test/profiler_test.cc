@@ -0,0 +1,118 @@
+#include "drake/common/profiler.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace {
+
+using Path = std::vector<std::string>;
+
+class ProfilerTest : public ::testing::Test {
+ protected:
+  void SetUp() override { profiler_.Reset(); }
+
+  void TearDown() override {
+    profiler_.set_enabled(false);
+    profiler_.set_trace_enabled(false);
+    profiler_.Reset();
+  }
+
+  Profiler& profiler_{Profiler::Global()};
+};
+
+// Nothing is recorded, and label functions aren't called, while disabled.
+TEST_F(ProfilerTest, Disabled) {
+  EXPECT_FALSE(Profiler::is_enabled());
+  bool label_made = false;
+  {
+    ScopedProfileTimer timer("outer");
+    ScopedProfileTimer lazy([&label_made]() {
+      label_made = true;
+      return std::string("inner");
+    });
+  }
+  EXPECT_FALSE(label_made);
+  EXPECT_TRUE(profiler_.GetStatistics().empty());
+}
+
+TEST_F(ProfilerTest, Hierarchy) {
+  profiler_.set_enabled(true);
+  for (int i = 0; i < 3; ++i) {
+    ScopedProfileTimer outer("outer");
+    {
+      ScopedProfileTimer inner([]() { return std::string("inner"); });
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    ScopedProfileTimer other("other");
+  }
+  // A scope with the same label but a different enclosing scope is separate.
+  { ScopedProfileTimer inner("inner"); }
+  profiler_.set_enabled(false);
+  { ScopedProfileTimer ignored("ignored"); }
+
+  const std::vector<ProfileStatistics> statistics = profiler_.GetStatistics();
+  ASSERT_EQ(statistics.size(), 4);
+  EXPECT_EQ(statistics[0].path, Path({"inner"}));
+  EXPECT_EQ(statistics[1].path, Path({"outer"}));
+  EXPECT_EQ(statistics[2].path, Path({"outer", "inner"}));
+  EXPECT_EQ(statistics[3].path, Path({"outer", "other"}));
+  EXPECT_EQ(statistics[0].count, 1);
+  EXPECT_EQ(statistics[1].count, 3);
+  EXPECT_EQ(statistics[2].count, 3);
+
+  // The time in the nested scopes is excluded from the self time.
+  const ProfileStatistics& outer = statistics[1];
+  const ProfileStatistics& inner = statistics[2];
+  EXPECT_GE(inner.total_seconds, 3 * 0.002);
+  EXPECT_GE(inner.max_seconds, 0.002);
+  EXPECT_LE(inner.max_seconds, inner.total_seconds);
+  EXPECT_GE(outer.total_seconds, inner.total_seconds);
+  EXPECT_NEAR(outer.self_seconds,
+              outer.total_seconds - inner.total_seconds -
+                  statistics[3].total_seconds,
+              1e-9);
+
+  const std::string report = profiler_.FormatReport();
+  EXPECT_NE(report.find("total [s]"), std::string::npos);
+  EXPECT_NE(report.find("  inner\n"), std::string::npos);
+  EXPECT_NE(report.find("    inner\n"), std::string::npos);
+
+  profiler_.Reset();
+  EXPECT_TRUE(profiler_.GetStatistics().empty());
+}
+
+TEST_F(ProfilerTest, ChromeTrace) {
+  profiler_.set_enabled(true);
+  { ScopedProfileTimer untraced("untraced"); }
+  profiler_.set_trace_enabled(true);
+  EXPECT_TRUE(profiler_.is_trace_enabled());
+  {
+    ScopedProfileTimer outer("a \"quoted\" scope");
+    ScopedProfileTimer inner("inner");
+  }
+  const std::string json = profiler_.ToChromeTraceJson();
+  EXPECT_EQ(json.find("untraced"), std::string::npos);
+  EXPECT_NE(json.find("{\"traceEvents\":["), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"a \\\"quoted\\\" scope\""),
+            std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"inner\""), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+}
+
+// Scopes on different threads don't nest in each other.
+TEST_F(ProfilerTest, Threads) {
+  profiler_.set_enabled(true);
+  ScopedProfileTimer outer("outer");
+  std::thread thread([]() { ScopedProfileTimer timer("worker"); });
+  thread.join();
+  const std::vector<ProfileStatistics> statistics = profiler_.GetStatistics();
+  ASSERT_EQ(statistics.size(), 1);
+  EXPECT_EQ(statistics[0].path, Path({"worker"}));
+}
+
+}  // namespace
+}  // namespace drake
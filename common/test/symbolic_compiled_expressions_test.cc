@@ -0,0 +1,180 @@
+#include <cmath>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/symbolic.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+class CompiledExpressionsTest : public ::testing::Test {
+ protected:
+  // Checks that the compiled `expressions` agree with Expression::Evaluate().
+  void CheckEvaluate(const VectorX<Expression>& expressions,
+                     const Eigen::Vector3d& values) const {
+    const CompiledExpressions compiled(expressions, parameters_);
+    ASSERT_EQ(compiled.size(), expressions.size());
+    ASSERT_EQ(compiled.num_parameters(), 3);
+    const Environment env{{x_, values[0]}, {y_, values[1]}, {z_, values[2]}};
+    const Eigen::VectorXd expected = Evaluate(expressions, env);
+    EXPECT_TRUE(CompareMatrices(compiled.Evaluate(values), expected, 1e-15));
+  }
+
+  const Variable x_{"x"};
+  const Variable y_{"y"};
+  const Variable z_{"z"};
+  const Vector3<Variable> parameters_{x_, y_, z_};
+};
+
+TEST_F(CompiledExpressionsTest, Empty) {
+  const CompiledExpressions dut;
+  EXPECT_EQ(dut.size(), 0);
+  EXPECT_EQ(dut.num_parameters(), 0);
+  EXPECT_EQ(dut.Evaluate(Eigen::VectorXd(0)).size(), 0);
+}
+
+TEST_F(CompiledExpressionsTest, Arithmetic) {
+  VectorX<Expression> e(6);
+  e << 3.0, x_, 2 + 3 * x_ - y_ * z_, pow(x_, 2) * pow(y_, 3) / (1 + z_ * z_),
+      pow(x_, y_), -x_ + 4 * pow(y_ + z_, -1);
+  CheckEvaluate(e, Eigen::Vector3d(0.5, 1.5, -2.0));
+  CheckEvaluate(e, Eigen::Vector3d(-3.0, 2.0, 0.25));
+}
+
+TEST_F(CompiledExpressionsTest, Functions) {
+  VectorX<Expression> e(19);
+  e << abs(y_), log(x_), exp(y_), sqrt(x_), sin(x_), cos(y_), tan(z_),
+      asin(z_), acos(z_), atan(y_), atan2(y_, z_), sinh(x_), cosh(y_),
+      tanh(z_), min(x_, y_), max(x_, y_), ceil(y_), floor(y_),
+      sin(x_) * sin(x_) + cos(x_) * cos(x_);
+  CheckEvaluate(e, Eigen::Vector3d(0.5, -1.5, 0.25));
+  CheckEvaluate(e, Eigen::Vector3d(2.0, 3.5, -0.75));
+}
+
+TEST_F(CompiledExpressionsTest, IfThenElse) {
+  VectorX<Expression> e(4);
+  e << if_then_else(x_ > y_, x_, y_),
+      if_then_else(x_ >= 0 && y_ < 1, log(x_), z_),
+      if_then_else(x_ == y_ || !(z_ <= 0), 1.0, 2.0),
+      if_then_else(x_ != z_, sin(x_), cos(x_)) + sin(x_);
+  CheckEvaluate(e, Eigen::Vector3d(1.0, 0.5, -1.0));
+  CheckEvaluate(e, Eigen::Vector3d(-1.0, 2.0, 3.0));
+  CheckEvaluate(e, Eigen::Vector3d(2.0, 2.0, -1.0));
+  CheckEvaluate(e, Eigen::Vector3d(-1.0, 0.5, -1.0));
+}
+
+// Only the branch taken is evaluated, so that log(x) does not throw here.
+TEST_F(CompiledExpressionsTest, IfThenElseShortCircuits) {
+  const Vector1<Expression> e(if_then_else(x_ > 0, log(x_), 0.0));
+  const CompiledExpressions dut(e, parameters_);
+  EXPECT_EQ(dut.Evaluate(Eigen::Vector3d(-1.0, 0.0, 0.0))[0], 0.0);
+  EXPECT_EQ(dut.Evaluate(Eigen::Vector3d(1.0, 0.0, 0.0))[0], 0.0);
+
+  const Vector1<Expression> f(
+      if_then_else(x_ > 0 && log(x_) > 1, 1.0, 2.0));
+  const CompiledExpressions dut2(f, parameters_);
+  EXPECT_EQ(dut2.Evaluate(Eigen::Vector3d(-1.0, 0.0, 0.0))[0], 2.0);
+  EXPECT_EQ(dut2.Evaluate(Eigen::Vector3d(4.0, 0.0, 0.0))[0], 1.0);
+}
+
+// A subexpression computed only within a branch is recomputed when it is
+// needed again outside of that branch.
+TEST_F(CompiledExpressionsTest, BranchScoping) {
+  Vector2<Expression> e;
+  e << if_then_else(x_ > 0, sin(y_), 0.0), sin(y_) + 1;
+  CheckEvaluate(e, Eigen::Vector3d(-1.0, 0.5, 0.0));
+  CheckEvaluate(e, Eigen::Vector3d(1.0, 0.5, 0.0));
+}
+
+// Repeated subexpressions are only computed once.
+TEST_F(CompiledExpressionsTest, CommonSubexpressions) {
+  const Expression common = sin(x_ * y_);
+  Vector3<Expression> e;
+  e << common, common * common, 2 * common + z_;
+  const CompiledExpressions dut(e, parameters_);
+  // sin, x * y, common², 2 * common + z.
+  EXPECT_EQ(dut.num_instructions(), 4);
+  CheckEvaluate(e, Eigen::Vector3d(0.5, 1.5, -2.0));
+
+  // The Jacobian shares many subexpressions with the expressions themselves.
+  const MatrixX<Expression> J = Jacobian(e, parameters_);
+  VectorX<Expression> e_and_J(e.size() + J.size());
+  e_and_J << e, Eigen::Map<const VectorX<Expression>>(J.data(), J.size());
+  CheckEvaluate(e_and_J, Eigen::Vector3d(0.5, 1.5, -2.0));
+}
+
+TEST_F(CompiledExpressionsTest, Fallback) {
+  const Variable b("b", Variable::Type::BOOLEAN);
+  const Vector3<Variable> parameters(x_, y_, b);
+  const Vector1<Expression> e(if_then_else(Formula{b}, x_, y_));
+  const CompiledExpressions dut(e, parameters);
+  EXPECT_EQ(dut.Evaluate(Eigen::Vector3d(1.0, 2.0, 1.0))[0], 1.0);
+  EXPECT_EQ(dut.Evaluate(Eigen::Vector3d(1.0, 2.0, 0.0))[0], 2.0);
+
+  const Vector1<Expression> f(uninterpreted_function("uf", {x_}));
+  const CompiledExpressions dut2(f, parameters_);
+  DRAKE_EXPECT_THROWS_MESSAGE(dut2.Evaluate(Eigen::Vector3d::Zero()),
+                              ".*cannot be evaluated.*");
+}
+
+TEST_F(CompiledExpressionsTest, Exceptions) {
+  const Vector3<Expression> e(log(x_), x_ / y_, sqrt(z_));
+  const CompiledExpressions dut(e, parameters_);
+  EXPECT_THROW(dut.Evaluate(Eigen::Vector3d(-1.0, 1.0, 1.0)),
+               std::domain_error);
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.Evaluate(Eigen::Vector3d(1.0, 0.0, 1.0)),
+                              "Division by zero.*");
+  EXPECT_THROW(dut.Evaluate(Eigen::Vector3d(1.0, 1.0, -1.0)),
+               std::domain_error);
+  EXPECT_THROW(dut.Evaluate(Eigen::Vector2d(1.0, 1.0)), std::exception);
+
+  const Variable w("w");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      CompiledExpressions(Vector1<Expression>(x_ + w), parameters_),
+      ".*variable w is not a parameter.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      CompiledExpressions(Vector1<Expression>(x_), Vector2<Variable>(x_, x_)),
+      ".*parameter x appears more than once.*");
+}
+
+// Batched evaluation agrees with evaluating each sample on its own, for both
+// straight-line and branching programs, including a partial last block.
+TEST_F(CompiledExpressionsTest, EvaluateBatch) {
+  VectorX<Expression> e(5);
+  e << 2 + 3 * x_ - y_ * z_, pow(x_, 2) * pow(y_, 3) / (1 + z_ * z_),
+      sin(x_) * exp(z_), atan2(y_, z_) + abs(x_), max(x_, y_);
+  VectorX<Expression> f(2);
+  f << if_then_else(x_ > y_, x_, y_), if_then_else(z_ > 0, log(z_), z_);
+  const int num_samples = 70;
+  const Eigen::MatrixXd samples = Eigen::MatrixXd::Random(3, num_samples);
+
+  for (const auto& expressions : {e, f}) {
+    const CompiledExpressions dut(expressions, parameters_);
+    Eigen::MatrixXd expected(dut.size(), num_samples);
+    for (int j = 0; j < num_samples; ++j) {
+      expected.col(j) = dut.Evaluate(samples.col(j));
+    }
+    EXPECT_TRUE(CompareMatrices(dut.EvaluateBatch(samples), expected, 0.0));
+    EXPECT_TRUE(CompareMatrices(
+        dut.EvaluateBatch(samples, Parallelism(3)), expected, 0.0));
+    EXPECT_EQ(dut.EvaluateBatch(Eigen::MatrixXd(3, 0)).cols(), 0);
+  }
+}
+
+TEST_F(CompiledExpressionsTest, EvaluateBatchExceptions) {
+  const Vector1<Expression> e(log(x_));
+  const CompiledExpressions dut(e, parameters_);
+  Eigen::MatrixXd samples = Eigen::MatrixXd::Ones(3, 50);
+  samples(0, 45) = -1.0;
+  EXPECT_THROW(dut.EvaluateBatch(samples), std::domain_error);
+  EXPECT_THROW(dut.EvaluateBatch(samples, Parallelism(2)), std::domain_error);
+  EXPECT_THROW(dut.EvaluateBatch(Eigen::MatrixXd(2, 1)), std::exception);
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
@@ -356,6 +356,37 @@ TEST_F(SymbolicDifferentiationTest, UninterpretedFunction) {
   EXPECT_PRED2(ExprEqual, uf.Differentiate(var_z_), Expression::Zero());
 }
 
+// Returns eₙ where e₀ = x and eᵢ₊₁ = sin(eᵢ) + cos(eᵢ). As a tree, eₙ has 2ⁿ
+// copies of x, but as a DAG it has only O(n) cells.
+Expression MakeDeepDag(const Variable& x, int n) {
+  Expression e{x};
+  for (int i = 0; i < n; ++i) {
+    e = sin(e) + cos(e);
+  }
+  return e;
+}
+
+// Shared subexpressions are only differentiated once, so that this finishes
+// quickly even though the tree is exponentially large.
+TEST_F(SymbolicDifferentiationTest, SharedSubexpressions) {
+  const Expression small = MakeDeepDag(var_x_, 3);
+  const Environment env{{var_x_, 0.3}};
+  EXPECT_NEAR(small.Differentiate(var_x_).Evaluate(env),
+              DifferenceQuotient(small, var_x_, env).Evaluate(env), 1e-5);
+
+  const Expression deep = MakeDeepDag(var_x_, 60);
+  const Expression derivative = deep.Differentiate(var_x_);
+  EXPECT_EQ(derivative.get_kind(), ExpressionKind::Add);
+  EXPECT_PRED2(ExprEqual, deep.Differentiate(var_y_), Expression::Zero());
+
+  // The Jacobian of a vector of expressions shares its memo among them.
+  const Vector2<Expression> f(deep, deep * var_y_);
+  const MatrixX<Expression> J = Jacobian(f, Vector2<Variable>(var_x_, var_y_));
+  EXPECT_EQ(J(0, 0).get_kind(), ExpressionKind::Add);
+  EXPECT_PRED2(ExprEqual, J(0, 1), Expression::Zero());
+  EXPECT_EQ(J(1, 0).get_kind(), ExpressionKind::Mul);
+}
+
 }  // namespace
 }  // namespace symbolic
 }  // namespace drake
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include "drake/common/symbolic.h"
+#include "drake/common/test_utilities/symbolic_test_util.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using test::ExprEqual;
+
+// Returns true iff the addition expressions `a` and `b` share the same cell.
+bool SameAddition(const Expression& a, const Expression& b) {
+  return &get_expr_to_coeff_map_in_addition(a) ==
+         &get_expr_to_coeff_map_in_addition(b);
+}
+
+class ExpressionInternerTest : public ::testing::Test {
+ protected:
+  const Variable var_x_{"x"};
+  const Variable var_y_{"y"};
+  const Expression x_{var_x_};
+  const Expression y_{var_y_};
+
+  ExpressionInterner dut_;
+};
+
+TEST_F(ExpressionInternerTest, Intern) {
+  const Expression e1 = 2 * sin(x_ + y_) + 3;
+  const Expression e2 = 2 * sin(x_ + y_) + 3;
+  ASSERT_FALSE(SameAddition(e1, e2));
+
+  const Expression i1 = dut_.Intern(e1);
+  const Expression i2 = dut_.Intern(e2);
+  EXPECT_PRED2(ExprEqual, i1, e1);
+  EXPECT_TRUE(SameAddition(i1, i2));
+  // x, y, x + y, sin(x + y), and e1.
+  EXPECT_EQ(dut_.size(), 5);
+
+  // Interning an interned expression is a no-op.
+  EXPECT_TRUE(SameAddition(dut_.Intern(i1), i1));
+  EXPECT_EQ(dut_.size(), 5);
+
+  dut_.Clear();
+  EXPECT_EQ(dut_.size(), 0);
+}
+
+TEST_F(ExpressionInternerTest, SharedSubexpressions) {
+  const Expression common = x_ * y_ + 1;
+  const Expression e1 = dut_.Intern(sin(x_ * y_ + 1));
+  const Expression e2 = dut_.Intern(pow(x_ * y_ + 1, 3) / (y_ + 2));
+  const Expression e3 = dut_.Intern(common);
+  EXPECT_PRED2(ExprEqual, e2, pow(common, 3) / (y_ + 2));
+  EXPECT_TRUE(SameAddition(get_argument(e1), e3));
+  const Expression& numerator = get_first_argument(e2);
+  EXPECT_TRUE(SameAddition(get_first_argument(numerator), e3));
+}
+
+TEST_F(ExpressionInternerTest, Opaque) {
+  const Expression e1 = if_then_else(x_ > y_, x_ + 1, y_);
+  const Expression e2 = if_then_else(x_ > y_, x_ + 1, y_);
+  const Expression i1 = dut_.Intern(e1);
+  const Expression i2 = dut_.Intern(e2);
+  EXPECT_PRED2(ExprEqual, i1, e1);
+  EXPECT_EQ(&get_then_expression(i1), &get_then_expression(i2));
+  EXPECT_EQ(dut_.size(), 1);
+}
+
+TEST_F(ExpressionInternerTest, Expand) {
+  const Expression e = pow(x_ + y_, 2) + (x_ + 1) * (y_ - 1);
+  const Expression expanded = dut_.Expand(e);
+  EXPECT_PRED2(ExprEqual, expanded, e.Expand());
+  EXPECT_TRUE(expanded.is_expanded());
+  EXPECT_TRUE(
+      SameAddition(dut_.Expand(pow(x_ + y_, 2) + (x_ + 1) * (y_ - 1)),
+                   expanded));
+  // The expanded result is itself interned.
+  EXPECT_TRUE(SameAddition(dut_.Intern(e.Expand()), expanded));
+}
+
+TEST_F(ExpressionInternerTest, Differentiate) {
+  const Expression e = sin(x_ * y_) + x_ * x_ * y_;
+  const Expression dx = dut_.Differentiate(e, var_x_);
+  const Expression dy = dut_.Differentiate(e, var_y_);
+  EXPECT_PRED2(ExprEqual, dx, e.Differentiate(var_x_));
+  EXPECT_PRED2(ExprEqual, dy, e.Differentiate(var_y_));
+  EXPECT_TRUE(SameAddition(dut_.Differentiate(e, var_x_), dx));
+}
+
+TEST_F(ExpressionInternerTest, Substitute) {
+  const Expression e = x_ * x_ + 2 * x_ * y_ + 3;
+  const Substitution s1{{var_x_, y_ + 1}, {var_y_, x_}};
+  const Substitution s2{{var_x_, y_ + 1}};
+  const Expression e1 = dut_.Substitute(e, s1);
+  const Expression e2 = dut_.Substitute(e, s2);
+  EXPECT_PRED2(ExprEqual, e1, e.Substitute(s1));
+  EXPECT_PRED2(ExprEqual, e2, e.Substitute(s2));
+  EXPECT_TRUE(SameAddition(dut_.Substitute(e, s1), e1));
+  EXPECT_TRUE(SameAddition(dut_.Substitute(e, s2), e2));
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include "drake/common/symbolic.h"
+#include "drake/common/test_utilities/symbolic_test_util.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using test::PolyEqual;
+using test::PolyEqualAfterExpansion;
+
+class PackedPolynomialTest : public ::testing::Test {
+ protected:
+  const Variable var_x_{"x"};
+  const Variable var_y_{"y"};
+  const Variable var_z_{"z"};
+  const Variable var_a_{"a"};
+  const Variable var_b_{"b"};
+  const Expression x_{var_x_};
+  const Expression y_{var_y_};
+  const Expression z_{var_z_};
+  const Expression a_{var_a_};
+  const Expression b_{var_b_};
+  const Variables xy_{var_x_, var_y_};
+  const Variables xyz_{var_x_, var_y_, var_z_};
+};
+
+TEST_F(PackedPolynomialTest, Zero) {
+  const PackedPolynomial dut;
+  EXPECT_EQ(dut.num_terms(), 0);
+  EXPECT_TRUE(dut.indeterminates().empty());
+  EXPECT_PRED2(PolyEqual, dut.ToPolynomial(), Polynomial());
+}
+
+TEST_F(PackedPolynomialTest, RoundTrip) {
+  const Polynomial p(a_ * x_ * x_ * y_ + (a_ + b_) * y_ + 3, xy_);
+  const PackedPolynomial dut(p);
+  ASSERT_EQ(dut.indeterminates().size(), 2);
+  EXPECT_TRUE(dut.indeterminates()[0].equal_to(var_x_));
+  EXPECT_TRUE(dut.indeterminates()[1].equal_to(var_y_));
+  ASSERT_EQ(dut.num_terms(), 3);
+  // The terms are sorted by their exponents.
+  EXPECT_EQ(dut.exponents(0), Eigen::Vector2i(0, 0));
+  EXPECT_EQ(dut.exponents(1), Eigen::Vector2i(0, 1));
+  EXPECT_EQ(dut.exponents(2), Eigen::Vector2i(2, 1));
+  EXPECT_PRED2(test::ExprEqual, dut.coefficient(0), 3);
+  EXPECT_PRED2(test::ExprEqual, dut.coefficient(1), a_ + b_);
+  EXPECT_PRED2(test::ExprEqual, dut.coefficient(2), a_);
+  EXPECT_PRED2(PolyEqual, dut.ToPolynomial(), p);
+}
+
+TEST_F(PackedPolynomialTest, Multiply) {
+  const Polynomial p1(a_ * x_ * x_ + b_ * x_ * y_ + 1, xy_);
+  const Polynomial p2(x_ - b_ * y_, xy_);
+  const PackedPolynomial product = PackedPolynomial(p1) * PackedPolynomial(p2);
+  EXPECT_PRED2(PolyEqual, product.ToPolynomial(), p1 * p2);
+}
+
+TEST_F(PackedPolynomialTest, MultiplyDifferentIndeterminates) {
+  const Polynomial p1(a_ * x_ + z_, Variables{var_x_, var_z_});
+  const Polynomial p2(b_ * y_ * y_ + 2 * z_, Variables{var_y_, var_z_});
+  const PackedPolynomial product = PackedPolynomial(p1) * PackedPolynomial(p2);
+  EXPECT_EQ(product.indeterminates().size(), 3);
+  EXPECT_PRED2(PolyEqual, product.ToPolynomial(), p1 * p2);
+}
+
+TEST_F(PackedPolynomialTest, Cancellation) {
+  // The xy terms cancel, even though their coefficients need expanding.
+  const Polynomial p1(x_ + (a_ + b_) * y_, xy_);
+  const Polynomial p2(x_ - (a_ + b_) * y_, xy_);
+  const PackedPolynomial product = PackedPolynomial(p1) * PackedPolynomial(p2);
+  EXPECT_EQ(product.num_terms(), 2);
+  EXPECT_PRED2(PolyEqual, product.ToPolynomial(), p1 * p2);
+
+  const PackedPolynomial sum =
+      PackedPolynomial(p1) + PackedPolynomial(Polynomial(-x_ + y_, xy_));
+  EXPECT_PRED2(PolyEqual, sum.ToPolynomial(),
+               p1 + Polynomial(-x_ + y_, xy_));
+  EXPECT_EQ(sum.num_terms(), 1);
+}
+
+// Polynomial::operator*= uses PackedPolynomial for large products.
+TEST_F(PackedPolynomialTest, LargePolynomialProduct) {
+  const Expression e1 = pow(x_ + a_ * y_ + z_ + 1, 4);
+  const Expression e2 = pow(x_ - y_ + 2 * z_ - b_, 3);
+  const Polynomial p1(e1, xyz_);
+  const Polynomial p2(e2, xyz_);
+  ASSERT_GE(p1.monomial_to_coefficient_map().size() *
+                p2.monomial_to_coefficient_map().size(),
+            64);
+  const Polynomial product = p1 * p2;
+  EXPECT_PRED2(PolyEqualAfterExpansion, product, Polynomial(e1 * e2, xyz_));
+  EXPECT_PRED2(PolyEqual, product,
+               (PackedPolynomial(p1) * PackedPolynomial(p2)).ToPolynomial());
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
@@ -910,6 +910,37 @@ TEST_F(SymbolicPolynomialTest, Evaluate) {
   EXPECT_THROW(p.Evaluate(partial_env), runtime_error);
 }
 
+TEST_F(SymbolicPolynomialTest, EvaluateIndeterminates) {
+  // p = 2x²y - xy + 3z⁴ + 1
+  const Polynomial p{2 * x_ * x_ * y_ - x_ * y_ + 3 * pow(z_, 4) + 1,
+                     var_xyz_};
+  const Vector3<Variable> indeterminates(var_z_, var_x_, var_y_);
+  const Eigen::MatrixXd values = Eigen::MatrixXd::Random(3, 40);
+  const Eigen::VectorXd result = p.EvaluateIndeterminates(indeterminates,
+                                                          values);
+  ASSERT_EQ(result.size(), values.cols());
+  for (int j = 0; j < values.cols(); ++j) {
+    const Environment env{{
+        {var_z_, values(0, j)},
+        {var_x_, values(1, j)},
+        {var_y_, values(2, j)},
+    }};
+    EXPECT_NEAR(result(j), p.Evaluate(env), 1e-14);
+  }
+
+  // A missing indeterminate.
+  EXPECT_THROW(p.EvaluateIndeterminates(Vector2<Variable>(var_x_, var_y_),
+                                        values.topRows(2)),
+               std::exception);
+  // Mismatched sizes.
+  EXPECT_THROW(p.EvaluateIndeterminates(indeterminates, values.topRows(2)),
+               std::exception);
+  // Decision variables in the coefficients.
+  const Polynomial q{a_ * x_, var_xyz_};
+  EXPECT_THROW(q.EvaluateIndeterminates(indeterminates, values),
+               std::exception);
+}
+
 TEST_F(SymbolicPolynomialTest, PartialEvaluate1) {
   // p1 = a*x² + b*x + c
   // p2 = p1[x ↦ 3.0] = 3²a + 3b + c.
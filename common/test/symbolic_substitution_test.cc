@@ -451,6 +451,28 @@ TEST_F(SymbolicSubstitutionTest, MatrixWithVariableAndExpression) {
   EXPECT_PRED2(ExprEqual, substituted(1, 1), m(1, 1).Substitute(var_x_, 3.0));
 }
 
+// Shared subexpressions are only substituted once, so that this finishes
+// quickly even though the tree of e is exponentially large.
+TEST_F(SymbolicSubstitutionTest, SharedSubexpressions) {
+  auto make_deep_dag = [](const Expression& x, int n) {
+    Expression e{x};
+    for (int i = 0; i < n; ++i) {
+      e = sin(e) + cos(e);
+    }
+    return e;
+  };
+  const Substitution subst{{var_x_, y_ + 1}};
+  EXPECT_PRED2(ExprEqual, make_deep_dag(x_, 3).Substitute(subst),
+               make_deep_dag(y_ + 1, 3));
+
+  const Expression deep = make_deep_dag(x_, 60);
+  EXPECT_EQ(deep.Substitute(subst).get_kind(), ExpressionKind::Add);
+  const Vector2<Expression> m(deep, deep * z_);
+  const Vector2<Expression> substituted = Substitute(m, subst);
+  EXPECT_EQ(substituted[0].get_kind(), ExpressionKind::Add);
+  EXPECT_EQ(substituted[1].get_kind(), ExpressionKind::Mul);
+}
+
 class ForallFormulaSubstitutionTest : public SymbolicSubstitutionTest {
  protected:
   const Expression e_{x_ + y_ + z_};
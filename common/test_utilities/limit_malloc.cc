@@ -3,6 +3,7 @@
 #include <signal.h>
 
 #include <atomic>
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
 #include <memory>
@@ -73,19 +74,20 @@ class Monitor {
   bool has_owner(const LimitMalloc* x) const { return owner_ == x; }
 
   // To be called by our hooks when an allocation attempt occurs,
-  void malloc(size_t) { ObserveAllocation(); }
-  void calloc(size_t, size_t) { ObserveAllocation(); }
-  void realloc(void*, size_t, bool is_noop) {
+  void malloc(size_t size) { ObserveAllocation(size); }
+  void calloc(size_t nmemb, size_t size) { ObserveAllocation(nmemb * size); }
+  void realloc(void*, size_t size, bool is_noop) {
     if (!(is_noop && args_.ignore_realloc_noops)) {
-      ObserveAllocation();
+      ObserveAllocation(size);
     }
   }
 
   int num_allocations() const { return observed_num_allocations_.load(); }
+  int64_t num_bytes() const { return observed_num_bytes_.load(); }
   const LimitMallocParams& params() const { return args_; }
 
  private:
-  void ObserveAllocation();
+  void ObserveAllocation(size_t size);
 
   // Do not de-reference owner_, it may be dangling; use for operator== only.
   const LimitMalloc* const owner_{};
@@ -95,6 +97,7 @@ class Monitor {
 
   // The current tallies for this Monitor.
   std::atomic_int observed_num_allocations_{0};
+  std::atomic<int64_t> observed_num_bytes_{0};
 };
 
 // A cut-down version of drake/common/never_destroyed.
@@ -177,12 +180,13 @@ class ActiveMonitor {
   }
 };
 
-void Monitor::ObserveAllocation() {
+void Monitor::ObserveAllocation(size_t size) {
   if (!IsSupportedConfiguration()) { return; }
 
   bool failure = false;
 
   // Check the allocation-call limit.
+  observed_num_bytes_ += static_cast<int64_t>(size);
   const int observed = ++observed_num_allocations_;
   if ((args_.max_num_allocations >= 0) &&
       (observed > args_.max_num_allocations)) {
@@ -235,6 +239,10 @@ int LimitMalloc::num_allocations() const {
   return ActiveMonitor::load()->num_allocations();
 }
 
+int64_t LimitMalloc::num_bytes() const {
+  return ActiveMonitor::load()->num_bytes();
+}
+
 const LimitMallocParams& LimitMalloc::params() const {
   return ActiveMonitor::load()->params();
 }
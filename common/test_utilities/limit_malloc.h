@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace drake {
 namespace test {
 
@@ -65,6 +67,10 @@ class LimitMalloc final {
   /// Returns the number of allocations observed so far.
   int num_allocations() const;
 
+  /// Returns the number of bytes requested by the allocations observed so far.
+  /// (For realloc, this is the requested new size of the block.)
+  int64_t num_bytes() const;
+
   /// Returns the parameters structure used to construct this object.
   const LimitMallocParams& params() const;
 
@@ -160,16 +160,19 @@ TEST_P(LimitMallocDeathTest, MaxLimitTest) {
 
 TEST_P(LimitMallocDeathTest, ObservationTest) {
   // Though not actually a death test, this is a convenient place to test
-  // that the getter returns a correct count.  We must check within a unit test
+  // that the getters return a correct count.  We must check within a unit test
   // that is known to be disabled via the BUILD file for platforms without a
   // working implementation.
   int num_allocations = -1;  // Choose spoiler value for testing.
+  int64_t num_bytes = -1;
   {
       LimitMalloc guard({.max_num_allocations = 1});
       Allocate();
       num_allocations = guard.num_allocations();
+      num_bytes = guard.num_bytes();
   }
   EXPECT_EQ(num_allocations, 1);
+  EXPECT_EQ(num_bytes, 16);
 }
 
 TEST_P(LimitMallocDeathTest, MinLimitTest) {
@@ -40,6 +40,28 @@ MatrixX<T> BsplineTrajectory<T>::value(const T& time) const {
                                min(max(time, start_time()), end_time()));
 }
 
+template <typename T>
+void BsplineTrajectory<T>::EvalVectorValues(const std::vector<T>& times,
+                                            EigenPtr<MatrixX<T>> values) const {
+  using std::max;
+  using std::min;
+  DRAKE_THROW_UNLESS(cols() == 1);
+  DRAKE_THROW_UNLESS(values != nullptr);
+  DRAKE_THROW_UNLESS(values->rows() == rows() &&
+                     values->cols() == static_cast<int>(times.size()));
+  VectorX<T> basis_values(basis_.order());
+  int first = -1;
+  for (int i = 0; i < static_cast<int>(times.size()); ++i) {
+    first = basis_.EvaluateActiveBasisFunctions(
+        min(max(times[i], start_time()), end_time()), &basis_values, first);
+    auto value_i = values->col(i);
+    value_i.setZero();
+    for (int j = 0; j < basis_.order(); ++j) {
+      value_i += basis_values(j) * control_points_[first + j].col(0);
+    }
+  }
+}
+
 template <typename T>
 bool BsplineTrajectory<T>::do_has_derivative() const {
   return true;
@@ -58,6 +58,18 @@ class BsplineTrajectory final : public trajectories::Trajectory<T> {
            `value(0)` for a trajectory defined over [0, 1]. */
   MatrixX<T> value(const T& time) const override;
 
+  /** Evaluates this vector-valued trajectory at each of the given `times`,
+  writing value(times[i]) (with the same clamping) to `values->col(i)`. All of
+  the basis functions that are non-zero at a time are evaluated at once (see
+  math::BsplineBasis::EvaluateActiveBasisFunctions()) and no memory is
+  allocated per time, which makes this much cheaper than calling value() at
+  each time. It is fastest for sorted `times`.
+  @throws std::exception if cols() != 1, or if `values` is not
+                         rows() × times.size().
+  @pre If T == symbolic::Expression, each time must be constant. */
+  void EvalVectorValues(const std::vector<T>& times,
+                        EigenPtr<MatrixX<T>> values) const;
+
   Eigen::Index rows() const override { return control_points()[0].rows(); }
 
   Eigen::Index cols() const override { return control_points()[0].cols(); }
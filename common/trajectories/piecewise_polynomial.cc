@@ -9,6 +9,7 @@
 #include <fmt/format.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_bool.h"
 #include "drake/common/drake_throw.h"
 
 using std::runtime_error;
@@ -132,6 +133,70 @@ MatrixX<T> PiecewisePolynomial<T>::DoEvalDerivative(
   return ret;
 }
 
+template <typename T>
+MatrixX<T> PiecewisePolynomial<T>::value(
+    const Eigen::Ref<const VectorX<T>>& times) const {
+  if (cols() != 1 && rows() != 1) {
+    throw std::runtime_error(
+        "This method only supports vector-valued trajectories.");
+  }
+  const int size = rows() * cols();
+  MatrixX<T> values(size, times.size());
+  if constexpr (scalar_predicate<T>::is_bool) {
+    const std::vector<T>& breaks = this->breaks();
+    const int num_segments = this->get_number_of_segments();
+    // The coefficients of the current segment, with one row per element of
+    // the output and one column per power of (t - breaks[segment_index]).
+    MatrixX<T> coefficients;
+    int segment_index = -1;
+    for (int i = 0; i < times.size(); ++i) {
+      const T time = min(max(times[i], this->start_time()), this->end_time());
+      const bool in_segment =
+          segment_index >= 0 && time >= breaks[segment_index] &&
+          (time < breaks[segment_index + 1] ||
+           segment_index == num_segments - 1);
+      if (!in_segment) {
+        // Only the breaks on one side of the current segment need searching.
+        const auto first = (segment_index >= 0 && time > breaks[segment_index])
+                               ? breaks.begin() + segment_index + 1
+                               : breaks.begin() + 1;
+        const auto last = (segment_index >= 0 && time < breaks[segment_index])
+                              ? breaks.begin() + segment_index
+                              : breaks.end() - 1;
+        segment_index = std::min<int>(
+            std::upper_bound(first, last, time) - breaks.begin() - 1,
+            num_segments - 1);
+        const PolynomialMatrix& polynomials = polynomials_[segment_index];
+        int degree = 0;
+        for (int k = 0; k < size; ++k) {
+          degree = std::max(degree, polynomials(k).GetDegree());
+        }
+        coefficients.setZero(size, degree + 1);
+        for (int k = 0; k < size; ++k) {
+          const VectorX<T> element = polynomials(k).GetCoefficients();
+          coefficients.row(k).head(element.size()) = element.transpose();
+        }
+      }
+      const T dt = time - breaks[segment_index];
+      // Horner's method, for all elements at once.
+      auto result = values.col(i);
+      result = coefficients.col(coefficients.cols() - 1);
+      for (int power = coefficients.cols() - 2; power >= 0; --power) {
+        result = result * dt + coefficients.col(power);
+      }
+    }
+  } else {
+    for (int i = 0; i < times.size(); ++i) {
+      values.col(i) = Eigen::Map<const VectorX<T>>(value(times[i]).data(),
+                                                   size);
+    }
+  }
+  if (cols() == 1) {
+    return values;
+  }
+  return values.transpose();
+}
+
 template <typename T>
 const typename PiecewisePolynomial<T>::PolynomialMatrix&
 PiecewisePolynomial<T>::getPolynomialMatrix(
@@ -372,6 +437,16 @@ void PiecewisePolynomial<T>::RemoveFinalSegment() {
   this->get_mutable_breaks().pop_back();
 }
 
+template <typename T>
+void PiecewisePolynomial<T>::RemoveInitialSegments(int num_segments) {
+  DRAKE_DEMAND(num_segments >= 0 &&
+               num_segments <= this->get_number_of_segments());
+  if (num_segments == 0) return;
+  polynomials_.erase(polynomials_.begin(), polynomials_.begin() + num_segments);
+  std::vector<T>& breaks = this->get_mutable_breaks();
+  breaks.erase(breaks.begin(), breaks.begin() + num_segments);
+}
+
 template <typename T>
 void PiecewisePolynomial<T>::ReverseTime() {
   using std::pow;
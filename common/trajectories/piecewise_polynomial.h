@@ -529,6 +529,22 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
       return DoEvalDerivative(t, derivative_order);
   }
 
+  /**
+   * Evaluates the %PiecewisePolynomial at each of the given times, returning
+   * the results in the same layout as Trajectory::vector_values().
+   *
+   * This is much faster than calling value() once per time: the coefficients
+   * of each segment are copied once into a contiguous matrix and evaluated
+   * for all of the consecutive times that fall in that segment using
+   * Horner's method. Sorted (ascending) `times` get the most benefit, since
+   * the segment search then only happens when a new segment is entered;
+   * unsorted `times` are supported, but are slower.
+   *
+   * @throws std::exception if both rows() and cols() are not equal to 1.
+   * @warning Times outside the range are clamped, as described in value().
+   */
+  MatrixX<T> value(const Eigen::Ref<const VectorX<T>>& times) const;
+
   /**
    * Gets the matrix of Polynomials corresponding to the given segment index.
    * @warning `segment_index` is not checked for validity.
@@ -727,6 +743,12 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
    */
   void RemoveFinalSegment();
 
+  /** Removes the first `num_segments` segments from the trajectory, so that it
+   * starts at what was the `num_segments`-th break.
+   * @pre 0 <= `num_segments` <= get_number_of_segments()
+   */
+  void RemoveInitialSegments(int num_segments);
+
   /**
    * Modifies the trajectory so that pp_after(t) = pp_before(-t).
    *
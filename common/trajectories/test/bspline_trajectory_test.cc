@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <utility>
 
 #include <gflags/gflags.h>
 #include <gtest/gtest.h>
@@ -130,6 +131,34 @@ TYPED_TEST(BsplineTrajectoryTests, ValueTest) {
   }
 }
 
+// Verifies that EvalVectorValues() agrees with value(), for sorted and
+// unsorted times, including times outside of the trajectory's time span.
+TYPED_TEST(BsplineTrajectoryTests, EvalVectorValuesTest) {
+  using T = TypeParam;
+  BsplineTrajectory<T> trajectory = MakeCircleTrajectory<T>();
+  const int num_times = 100;
+  const VectorX<T> t = VectorX<T>::LinSpaced(
+      num_times, trajectory.start_time() - 0.1, trajectory.end_time() + 0.1);
+  std::vector<T> times(t.data(), t.data() + num_times);
+  std::swap(times[10], times[80]);
+  MatrixX<T> values(trajectory.rows(), num_times);
+  trajectory.EvalVectorValues(times, &values);
+  for (int k = 0; k < num_times; ++k) {
+    EXPECT_TRUE(CompareMatrices(values.col(k), trajectory.value(times[k]),
+                                4 * std::numeric_limits<double>::epsilon()));
+  }
+
+  MatrixX<T> wrong_size(trajectory.rows(), num_times - 1);
+  EXPECT_THROW(trajectory.EvalVectorValues(times, &wrong_size),
+               std::exception);
+  const BsplineTrajectory<T> matrix_trajectory(
+      trajectory.basis(),
+      std::vector<MatrixX<T>>(trajectory.num_control_points(),
+                              MatrixX<T>::Zero(2, 2)));
+  EXPECT_THROW(matrix_trajectory.EvalVectorValues(times, &values),
+               std::exception);
+}
+
 // Verifies that MakeDerivative() works as expected.
 TYPED_TEST(BsplineTrajectoryTests, MakeDerivativeTest) {
   using T = TypeParam;
@@ -1,5 +1,6 @@
 #include "drake/common/trajectories/piecewise_polynomial.h"
 
+#include <algorithm>
 #include <random>
 #include <stdexcept>
 #include <vector>
@@ -304,6 +305,57 @@ GTEST_TEST(testPiecewisePolynomial, VectorValueTest) {
       "This method only supports vector-valued trajectories.");
 }
 
+GTEST_TEST(testPiecewisePolynomial, BatchValueTest) {
+  default_random_engine generator;
+  const vector<double> segment_times =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(20, generator);
+  // The polynomials have differing degrees (up to num_coefficients - 1).
+  const PiecewisePolynomial<double> col =
+      test::MakeRandomPiecewisePolynomial<double>(7, 1, 5, segment_times);
+  const double start = col.start_time();
+  const double end = col.end_time();
+
+  // Sorted times, including times outside of the range and at the breaks.
+  vector<double> sorted = {start - 1, start};
+  for (int i = 0; i <= 200; ++i) {
+    sorted.push_back(start + (end - start) * i / 200.0);
+  }
+  for (int i = 1; i < col.get_number_of_segments(); ++i) {
+    sorted.push_back(col.start_time(i));
+  }
+  sorted.push_back(end);
+  sorted.push_back(end + 1);
+  std::sort(sorted.begin(), sorted.end());
+
+  // Unsorted times.
+  vector<double> unsorted = sorted;
+  std::shuffle(unsorted.begin(), unsorted.end(), generator);
+
+  for (const vector<double>& times : {sorted, unsorted}) {
+    const Eigen::VectorXd t =
+        Eigen::Map<const Eigen::VectorXd>(times.data(), times.size());
+    const Eigen::MatrixXd out = col.value(t);
+    ASSERT_EQ(out.rows(), 7);
+    ASSERT_EQ(out.cols(), t.size());
+    for (int i = 0; i < t.size(); ++i) {
+      EXPECT_TRUE(CompareMatrices(out.col(i), col.value(t[i]), 1e-12));
+    }
+
+    const PiecewisePolynomial<double> row = col.Transpose();
+    EXPECT_TRUE(CompareMatrices(row.value(t), out.transpose(), 1e-12));
+  }
+
+  // Constant trajectories are defined over [-∞, ∞].
+  const PiecewisePolynomial<double> constant(Eigen::Vector2d(1, 2));
+  EXPECT_TRUE(CompareMatrices(constant.value(Eigen::Vector3d(-1, 0, 1)),
+                              Eigen::Vector2d(1, 2).replicate(1, 3)));
+
+  const PiecewisePolynomial<double> mat(Eigen::Matrix3d::Identity());
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      mat.value(Eigen::VectorXd::Zero(3)),
+      "This method only supports vector-valued trajectories.");
+}
+
 GTEST_TEST(testPiecewisePolynomial, RemoveFinalSegmentTest) {
   Eigen::VectorXd breaks(3);
   breaks << 0, .5, 1.;
@@ -326,6 +378,33 @@ GTEST_TEST(testPiecewisePolynomial, RemoveFinalSegmentTest) {
   EXPECT_TRUE(pp.empty());
 }
 
+GTEST_TEST(testPiecewisePolynomial, RemoveInitialSegmentsTest) {
+  Eigen::VectorXd breaks(4);
+  breaks << 0, .5, 1., 2.;
+  Eigen::MatrixXd samples(2, 4);
+  samples << 1, 1, 2, 0,
+             2, 0, 3, 1;
+
+  const PiecewisePolynomial<double> original =
+      PiecewisePolynomial<double>::CubicWithContinuousSecondDerivatives(
+          breaks, samples);
+  PiecewisePolynomial<double> pp = original;
+
+  pp.RemoveInitialSegments(0);
+  EXPECT_EQ(pp.get_number_of_segments(), 3);
+
+  pp.RemoveInitialSegments(2);
+  EXPECT_EQ(pp.start_time(), 1.);
+  EXPECT_EQ(pp.end_time(), 2.);
+  EXPECT_EQ(pp.get_number_of_segments(), 1);
+  for (const double t : {1.0, 1.3, 1.8}) {
+    EXPECT_TRUE(CompareMatrices(pp.value(t), original.value(t), 1e-14));
+  }
+
+  pp.RemoveInitialSegments(1);
+  EXPECT_TRUE(pp.empty());
+}
+
 std::unique_ptr<Trajectory<double>> TestReverseTime(
     const PiecewisePolynomial<double>& pp_orig) {
   std::unique_ptr<Trajectory<double>> pp_ptr = pp_orig.Clone();
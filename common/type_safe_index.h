@@ -581,7 +581,10 @@ operator>=(const U& value, const TypeSafeIndex<Tag>& tag) {
 namespace std {
 
 /// Enables use of the type-safe index to serve as a key in STL containers.
+/// Like std::hash<drake::Identifier>, this uses the cheaper
+/// internal::WordMixHasher instead of drake::DefaultHash.
 /// @relates TypeSafeIndex
 template <typename Tag>
-struct hash<drake::TypeSafeIndex<Tag>> : public drake::DefaultHash {};
+struct hash<drake::TypeSafeIndex<Tag>>
+    : public drake::uhash<drake::internal::WordMixHasher> {};
 }  // namespace std
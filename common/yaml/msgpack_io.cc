@@ -0,0 +1,47 @@
+#include "drake/common/yaml/msgpack_io.h"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace drake {
+namespace yaml {
+namespace internal {
+
+std::string ReadMsgpackFile(const std::string& filename) {
+  std::ifstream in(filename, std::ios::binary);
+  if (in.fail()) {
+    throw std::runtime_error(fmt::format(
+        "LoadMsgpackFile() could not open '{}' for reading",
+        filename));
+  }
+  std::ostringstream data;
+  data << in.rdbuf();
+  if (in.fail()) {
+    throw std::runtime_error(fmt::format(
+        "LoadMsgpackFile() could not read from '{}'",
+        filename));
+  }
+  return data.str();
+}
+
+void WriteMsgpackFile(const std::string& filename, const std::string& data) {
+  std::ofstream out(filename, std::ios::binary);
+  if (out.fail()) {
+    throw std::runtime_error(fmt::format(
+        "SaveMsgpackFile() could not open '{}' for writing",
+        filename));
+  }
+  out << data;
+  if (out.fail()) {
+    throw std::runtime_error(fmt::format(
+        "SaveMsgpackFile() could not write to '{}'",
+        filename));
+  }
+}
+
+}  // namespace internal
+}  // namespace yaml
+}  // namespace drake
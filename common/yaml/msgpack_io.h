@@ -0,0 +1,99 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include "drake/common/yaml/msgpack_read_archive.h"
+#include "drake/common/yaml/msgpack_write_archive.h"
+#include "drake/common/yaml/yaml_io_options.h"
+
+namespace drake {
+namespace yaml {
+
+/** Loads data from a binary msgpack document, as written by
+SaveMsgpackString().  This is a faster alternative to LoadYamlString() for
+large data, with the same semantics for the `defaults` and `options`.
+
+@param data the msgpack document.
+@param defaults (optional) If provided, then the structure being read into
+  will be initialized using this value instead of the default constructor,
+  and also (unless the `options` argument is provided and specifies otherwise)
+  any member fields that are not mentioned in the document will retain their
+  default values.
+@param options (optional, advanced) If provided, overrides the nominal parsing
+  options.  Most users should not specify this; the default is usually correct.
+@returns the loaded user data.
+@tparam Serializable must implement a @ref implementing_serialize "Serialize"
+  function and be default constructible. */
+template <typename Serializable>
+Serializable LoadMsgpackString(
+    const std::string& data,
+    const std::optional<Serializable>& defaults = std::nullopt,
+    const std::optional<LoadYamlOptions>& options = std::nullopt) {
+  // Reify our optional arguments.
+  Serializable result = defaults.value_or(Serializable{});
+  LoadYamlOptions new_options = options.value_or(LoadYamlOptions{});
+  if (defaults.has_value() && !options.has_value()) {
+    // Do not overwrite existing values.
+    new_options.allow_cpp_with_no_yaml = true;
+    new_options.retain_map_defaults = true;
+  }
+  // Parse and return.
+  MsgpackReadArchive(data, new_options).Accept(&result);
+  return result;
+}
+
+/** Loads data from a binary msgpack file, as written by SaveMsgpackFile().
+See LoadMsgpackString() for details.
+@param filename Filename to be read from. */
+template <typename Serializable>
+Serializable LoadMsgpackFile(
+    const std::string& filename,
+    const std::optional<Serializable>& defaults = std::nullopt,
+    const std::optional<LoadYamlOptions>& options = std::nullopt);
+
+/** Saves data as a binary msgpack document.  The document is the same as the
+YAML from SaveYamlString() would be (with no `child_name`), but encoded in
+binary; see MsgpackWriteArchive for details.
+@param data User data to be serialized.
+@returns the msgpack document.
+@tparam Serializable must implement a @ref implementing_serialize "Serialize"
+  function. */
+template <typename Serializable>
+std::string SaveMsgpackString(const Serializable& data) {
+  MsgpackWriteArchive archive;
+  archive.Accept(data);
+  return archive.data();
+}
+
+/** Saves data as a binary msgpack file.  See SaveMsgpackString() for details.
+@param filename Filename to be written to.
+@param data User data to be serialized. */
+template <typename Serializable>
+void SaveMsgpackFile(const std::string& filename, const Serializable& data);
+
+namespace internal {
+std::string ReadMsgpackFile(const std::string& filename);
+void WriteMsgpackFile(const std::string& filename, const std::string& data);
+}  // namespace internal
+
+// (Implementation of a function declared above.  This cannot be defined
+// inline because we need internal::ReadMsgpackFile to be declared.)
+template <typename Serializable>
+Serializable LoadMsgpackFile(
+    const std::string& filename,
+    const std::optional<Serializable>& defaults,
+    const std::optional<LoadYamlOptions>& options) {
+  return LoadMsgpackString(internal::ReadMsgpackFile(filename), defaults,
+                           options);
+}
+
+// (Implementation of a function declared above.  This cannot be defined
+// inline because we need internal::WriteMsgpackFile to be declared.)
+template <typename Serializable>
+void SaveMsgpackFile(const std::string& filename, const Serializable& data) {
+  internal::WriteMsgpackFile(filename, SaveMsgpackString(data));
+}
+
+}  // namespace yaml
+}  // namespace drake
@@ -0,0 +1,398 @@
+#include "drake/common/yaml/msgpack_read_archive.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace drake {
+namespace yaml {
+namespace {
+
+// The extension type of a tagged (variant) value; this must match the
+// MsgpackWriteArchive.
+constexpr uint8_t kTaggedExtType = 1;
+
+// The kinds of msgpack values, for error messages.
+const char* GetTypeName(uint8_t byte) {
+  if (byte <= 0x7f || byte >= 0xe0) { return "an integer"; }
+  if (byte <= 0x8f) { return "a map"; }
+  if (byte <= 0x9f) { return "an array"; }
+  if (byte <= 0xbf) { return "a string"; }
+  switch (byte) {
+    case 0xc0: return "nil";
+    case 0xc2: case 0xc3: return "a bool";
+    case 0xc4: case 0xc5: case 0xc6: return "binary";
+    case 0xca: case 0xcb: return "a floating-point number";
+    case 0xcc: case 0xcd: case 0xce: case 0xcf:
+    case 0xd0: case 0xd1: case 0xd2: case 0xd3: return "an integer";
+    case 0xd9: case 0xda: case 0xdb: return "a string";
+    case 0xdc: case 0xdd: return "an array";
+    case 0xde: case 0xdf: return "a map";
+  }
+  return "an extension";
+}
+
+}  // namespace
+
+MsgpackReadArchive::MsgpackReadArchive(
+    std::string_view data, const LoadYamlOptions& options)
+    : end_(data.data() + data.size()),
+      options_(options),
+      parent_(nullptr) {
+  const char* cursor = data.data();
+  const size_t size = ReadMapHeader(&cursor);
+  entries_.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    const std::string_view key = ReadString(&cursor);
+    entries_.push_back(Entry{key, cursor});
+    Skip(&cursor);
+  }
+  if (cursor != end_) {
+    ReportError("has trailing data after the document");
+  }
+}
+
+MsgpackReadArchive::MsgpackReadArchive(
+    const char** cursor, const MsgpackReadArchive* parent)
+    : end_(parent->end_),
+      options_(parent->options_),
+      parent_(parent) {
+  const size_t size = ReadMapHeader(cursor);
+  entries_.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    const std::string_view key = ReadString(cursor);
+    entries_.push_back(Entry{key, *cursor});
+    Skip(cursor);
+  }
+}
+
+bool MsgpackReadArchive::IsTagMatch(
+    const std::string& name, std::string_view tag) {
+  // Match the name without any namespaces or template parameters, as in
+  // YamlReadArchive::IsTagMatch().
+  const auto start_offset = name.rfind(':');
+  const size_t start =
+      (start_offset == std::string::npos) ? 0 : start_offset + 1;
+  const size_t end = std::min(name.find('<', start), name.size());
+  return std::string_view(name).substr(start, end - start) == tag;
+}
+
+void MsgpackReadArchive::ReadScalar(const char** cursor, bool* result) {
+  Require(*cursor, 1);
+  const uint8_t byte = **cursor;
+  if (byte != 0xc2 && byte != 0xc3) {
+    ReportError(fmt::format("is {} (wanted a bool)", GetTypeName(byte)));
+  }
+  *result = (byte == 0xc3);
+  ++*cursor;
+}
+
+void MsgpackReadArchive::ReadScalar(const char** cursor, float* result) {
+  Require(*cursor, 1);
+  if (static_cast<uint8_t>(**cursor) == 0xca) {
+    ++*cursor;
+    const uint32_t bits = ReadBigEndian(cursor, 4);
+    std::memcpy(result, &bits, sizeof(bits));
+    return;
+  }
+  double value{};
+  ReadScalar(cursor, &value);
+  *result = static_cast<float>(value);
+  if (std::isfinite(value) && static_cast<double>(*result) != value) {
+    ReportError(fmt::format("value {} is not representable as a float",
+                            value));
+  }
+}
+
+void MsgpackReadArchive::ReadScalar(const char** cursor, double* result) {
+  Require(*cursor, 1);
+  const uint8_t byte = **cursor;
+  if (byte == 0xcb) {
+    ++*cursor;
+    const uint64_t bits = ReadBigEndian(cursor, 8);
+    std::memcpy(result, &bits, sizeof(bits));
+  } else if (byte == 0xca) {
+    float value;
+    ReadScalar(cursor, &value);
+    *result = value;
+  } else {
+    // Integers are also accepted, e.g., from other msgpack writers.
+    if (std::string_view(GetTypeName(byte)) != "an integer") {
+      ReportError(fmt::format("is {} (wanted a floating-point number)",
+                              GetTypeName(byte)));
+    }
+    int64_t value{};
+    ReadIntegerImpl(cursor, &value);
+    *result = static_cast<double>(value);
+  }
+}
+
+void MsgpackReadArchive::ReadScalar(const char** cursor, int32_t* result) {
+  ReadIntegerImpl(cursor, result);
+}
+
+void MsgpackReadArchive::ReadScalar(const char** cursor, uint32_t* result) {
+  ReadIntegerImpl(cursor, result);
+}
+
+void MsgpackReadArchive::ReadScalar(const char** cursor, int64_t* result) {
+  ReadIntegerImpl(cursor, result);
+}
+
+void MsgpackReadArchive::ReadScalar(const char** cursor, uint64_t* result) {
+  ReadIntegerImpl(cursor, result);
+}
+
+void MsgpackReadArchive::ReadScalar(const char** cursor, std::string* result) {
+  *result = ReadString(cursor);
+}
+
+template <typename T>
+void MsgpackReadArchive::ReadIntegerImpl(const char** cursor, T* result) {
+  Require(*cursor, 1);
+  const uint8_t byte = **cursor;
+  // Decode into either an unsigned or a negative value.
+  bool negative = false;
+  uint64_t magnitude{};
+  int64_t signed_value{};
+  if (byte <= 0x7f) {
+    ++*cursor;
+    magnitude = byte;
+  } else if (byte >= 0xe0) {
+    ++*cursor;
+    negative = true;
+    signed_value = static_cast<int8_t>(byte);
+  } else if (byte >= 0xcc && byte <= 0xcf) {
+    ++*cursor;
+    magnitude = ReadBigEndian(cursor, 1 << (byte - 0xcc));
+  } else if (byte >= 0xd0 && byte <= 0xd3) {
+    ++*cursor;
+    const int size = 1 << (byte - 0xd0);
+    const uint64_t bits = ReadBigEndian(cursor, size);
+    // Sign-extend the value.
+    const int shift = 64 - 8 * size;
+    signed_value = static_cast<int64_t>(bits << shift) >> shift;
+    negative = signed_value < 0;
+    magnitude = static_cast<uint64_t>(signed_value);
+  } else {
+    ReportError(fmt::format("is {} (wanted an integer)", GetTypeName(byte)));
+  }
+  if (negative) {
+    if (!std::is_signed_v<T> ||
+        signed_value < static_cast<int64_t>(std::numeric_limits<T>::min())) {
+      ReportError(fmt::format("value {} is out of range", signed_value));
+    }
+    *result = static_cast<T>(signed_value);
+  } else {
+    if (magnitude > static_cast<uint64_t>(std::numeric_limits<T>::max())) {
+      ReportError(fmt::format("value {} is out of range", magnitude));
+    }
+    *result = static_cast<T>(magnitude);
+  }
+}
+
+size_t MsgpackReadArchive::ReadArrayHeader(const char** cursor) {
+  Require(*cursor, 1);
+  const uint8_t byte = **cursor;
+  if (byte >= 0x90 && byte <= 0x9f) {
+    ++*cursor;
+    return byte & 0x0f;
+  }
+  if (byte == 0xdc || byte == 0xdd) {
+    ++*cursor;
+    return ReadBigEndian(cursor, byte == 0xdc ? 2 : 4);
+  }
+  ReportError(fmt::format("is {} (wanted an array)", GetTypeName(byte)));
+}
+
+void MsgpackReadArchive::ReadArrayHeader(const char** cursor, size_t size) {
+  const size_t actual = ReadArrayHeader(cursor);
+  if (actual != size) {
+    ReportError(fmt::format("has {}-size entry (wanted {}-size)",
+                            actual, size));
+  }
+}
+
+size_t MsgpackReadArchive::ReadMapHeader(const char** cursor) {
+  Require(*cursor, 1);
+  const uint8_t byte = **cursor;
+  if (byte >= 0x80 && byte <= 0x8f) {
+    ++*cursor;
+    return byte & 0x0f;
+  }
+  if (byte == 0xde || byte == 0xdf) {
+    ++*cursor;
+    return ReadBigEndian(cursor, byte == 0xde ? 2 : 4);
+  }
+  ReportError(fmt::format("is {} (wanted a map)", GetTypeName(byte)));
+}
+
+std::string_view MsgpackReadArchive::ReadString(const char** cursor) {
+  Require(*cursor, 1);
+  const uint8_t byte = **cursor;
+  size_t size{};
+  if (byte >= 0xa0 && byte <= 0xbf) {
+    ++*cursor;
+    size = byte & 0x1f;
+  } else if (byte >= 0xd9 && byte <= 0xdb) {
+    ++*cursor;
+    size = ReadBigEndian(cursor, 1 << (byte - 0xd9));
+  } else {
+    ReportError(fmt::format("is {} (wanted a string)", GetTypeName(byte)));
+  }
+  Require(*cursor, size);
+  const std::string_view result(*cursor, size);
+  *cursor += size;
+  return result;
+}
+
+bool MsgpackReadArchive::ReadNil(const char** cursor) {
+  Require(*cursor, 1);
+  if (static_cast<uint8_t>(**cursor) == 0xc0) {
+    ++*cursor;
+    return true;
+  }
+  return false;
+}
+
+std::optional<std::string_view> MsgpackReadArchive::ReadTag(
+    const char** cursor) {
+  Require(*cursor, 1);
+  const uint8_t byte = **cursor;
+  if (byte < 0xc7 || byte > 0xc9) {
+    return std::nullopt;
+  }
+  const char* ext = *cursor + 1;
+  const uint64_t size = ReadBigEndian(&ext, 1 << (byte - 0xc7));
+  Require(ext, 1);
+  if (static_cast<uint8_t>(*ext) != kTaggedExtType) {
+    ReportError(fmt::format("is an extension of unknown type {}",
+                            static_cast<int>(*ext)));
+  }
+  ++ext;
+  Require(ext, size);
+  const char* const ext_end = ext + size;
+  const std::string_view tag = ReadString(&ext);
+  if (ext > ext_end) {
+    ReportError("has a malformed type tag");
+  }
+  *cursor = ext;
+  return tag;
+}
+
+void MsgpackReadArchive::Skip(const char** cursor) {
+  Require(*cursor, 1);
+  const uint8_t byte = **cursor;
+  // Containers, whose elements are skipped in turn.
+  if ((byte >= 0x80 && byte <= 0x9f) || (byte >= 0xdc && byte <= 0xdf)) {
+    const bool is_map = (byte <= 0x8f) || (byte >= 0xde);
+    const size_t size =
+        is_map ? ReadMapHeader(cursor) : ReadArrayHeader(cursor);
+    for (size_t i = 0; i < (is_map ? 2 * size : size); ++i) {
+      Skip(cursor);
+    }
+    return;
+  }
+  ++*cursor;
+  if (byte <= 0x7f || byte >= 0xe0 || byte == 0xc0 || byte == 0xc2 ||
+      byte == 0xc3) {
+    return;
+  }
+  // Strings, whose size is in the header.
+  uint64_t size{};
+  if (byte >= 0xa0 && byte <= 0xbf) {
+    size = byte & 0x1f;
+  } else if (byte >= 0xd9 && byte <= 0xdb) {
+    size = ReadBigEndian(cursor, 1 << (byte - 0xd9));
+  } else if (byte >= 0xc4 && byte <= 0xc6) {
+    // Binary.
+    size = ReadBigEndian(cursor, 1 << (byte - 0xc4));
+  } else if (byte >= 0xc7 && byte <= 0xc9) {
+    // An extension, whose size excludes its type.
+    size = ReadBigEndian(cursor, 1 << (byte - 0xc7)) + 1;
+  } else if (byte == 0xca) {
+    size = 4;
+  } else if (byte == 0xcb) {
+    size = 8;
+  } else if (byte >= 0xcc && byte <= 0xcf) {
+    size = 1 << (byte - 0xcc);
+  } else if (byte >= 0xd0 && byte <= 0xd3) {
+    size = 1 << (byte - 0xd0);
+  } else if (byte >= 0xd4 && byte <= 0xd8) {
+    // A fixext, whose size excludes its type.
+    size = (1 << (byte - 0xd4)) + 1;
+  } else {
+    ReportError(fmt::format("has an invalid msgpack byte 0x{:02x}", byte));
+  }
+  Require(*cursor, size);
+  *cursor += size;
+}
+
+uint64_t MsgpackReadArchive::ReadBigEndian(const char** cursor, int size) {
+  Require(*cursor, size);
+  uint64_t result = 0;
+  for (int i = 0; i < size; ++i) {
+    result = (result << 8) | static_cast<uint8_t>((*cursor)[i]);
+  }
+  *cursor += size;
+  return result;
+}
+
+void MsgpackReadArchive::Require(const char* cursor, size_t size) const {
+  if (static_cast<size_t>(end_ - cursor) < size) {
+    ReportError("is truncated");
+  }
+}
+
+const char* MsgpackReadArchive::FindEntry(const char* name) {
+  // Structs are small, so a linear search is faster than hashing.
+  for (Entry& entry : entries_) {
+    if (entry.key == name) {
+      entry.visited = true;
+      return entry.value;
+    }
+  }
+  return nullptr;
+}
+
+void MsgpackReadArchive::CheckAllAccepted() const {
+  if (options_.allow_yaml_with_no_cpp) {
+    return;
+  }
+  for (const Entry& entry : entries_) {
+    if (!entry.visited) {
+      ReportError(fmt::format(
+          "has an entry '{}' that does not match any C++ member", entry.key));
+    }
+  }
+}
+
+void MsgpackReadArchive::ReportMissing(const char* name) const {
+  ReportError(fmt::format("is missing the entry '{}'", name));
+}
+
+void MsgpackReadArchive::ReportError(const std::string& message) const {
+  std::string path;
+  AppendPath(&path);
+  throw std::runtime_error(fmt::format(
+      "MsgpackReadArchive: the msgpack {} {}",
+      path.empty() ? std::string("document") : fmt::format("entry {}", path),
+      message));
+}
+
+void MsgpackReadArchive::AppendPath(std::string* path) const {
+  if (parent_ != nullptr) {
+    parent_->AppendPath(path);
+  }
+  if (!debug_visit_name_.empty()) {
+    if (!path->empty()) {
+      path->push_back('.');
+    }
+    path->append(debug_visit_name_);
+  }
+}
+
+}  // namespace yaml
+}  // namespace drake
@@ -0,0 +1,369 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include <Eigen/Core>
+#include <fmt/format.h>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/name_value.h"
+#include "drake/common/nice_type_name.h"
+#include "drake/common/yaml/yaml_io_options.h"
+
+namespace drake {
+namespace yaml {
+
+/// (Advanced) A helper class for @ref yaml_serialization "YAML Serialization"
+/// that loads data from a binary msgpack document, as written by
+/// MsgpackWriteArchive, into a C++ structure.
+///
+/// The document is decoded directly into the C++ structure, without building
+/// an intermediate tree of nodes or strings, and the mismatches between the
+/// document and the structure that are permitted are governed by the same
+/// LoadYamlOptions as for YamlReadArchive.  Numbers may be converted between
+/// integers and floating-point values as long as they are represented
+/// exactly.
+class MsgpackReadArchive final {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MsgpackReadArchive)
+
+  /// (Advanced) Creates an archive that reads from the msgpack `data`, which
+  /// is aliased (not copied) and so must outlive this archive.
+  /// @throws std::exception if `data` is not a well-formed msgpack map.
+  MsgpackReadArchive(std::string_view data, const LoadYamlOptions& options);
+
+  /// (Advanced) Sets the contents `serializable` based on the msgpack data
+  /// associated with this archive.
+  template <typename Serializable>
+  void Accept(Serializable* serializable) {
+    DRAKE_THROW_UNLESS(serializable != nullptr);
+    this->DoAccept(serializable, static_cast<int32_t>(0));
+    CheckAllAccepted();
+  }
+
+  /// (Advanced) Sets the value pointed to by `nvp.value()` based on the
+  /// msgpack data associated with this archive.  Most users should call
+  /// Accept, not Visit.
+  template <typename NameValuePair>
+  void Visit(const NameValuePair& nvp) {
+    using T = typename NameValuePair::value_type;
+    const char* cursor = FindEntry(nvp.name());
+    if (cursor == nullptr) {
+      if (options_.allow_cpp_with_no_yaml) { return; }
+      if constexpr (is_optional<T>::value) {
+        *nvp.value() = std::nullopt;
+      } else {
+        ReportMissing(nvp.name());
+      }
+      return;
+    }
+    debug_visit_name_ = nvp.name();
+    // Use int32_t for the final argument to prefer the specialized overload.
+    this->DoRead(&cursor, nvp.value(), static_cast<int32_t>(0));
+    debug_visit_name_ = {};
+  }
+
+ private:
+  // One entry of the map being read.
+  struct Entry {
+    std::string_view key;
+    // The start of the entry's value.
+    const char* value{};
+    bool visited{};
+  };
+
+  template <typename T>
+  struct is_optional : std::false_type {};
+  template <typename T>
+  struct is_optional<std::optional<T>> : std::true_type {};
+
+  // Internal-use constructor during recursion, for the map at `*cursor`,
+  // which is advanced past the map.  This aliases `parent`, so it must
+  // outlive this object.
+  MsgpackReadArchive(const char** cursor, const MsgpackReadArchive* parent);
+
+  // --------------------------------------------------------------------------
+  // @name Overloads for the Accept() implementation
+
+  // This version applies when Serialize is member method.
+  template <typename Serializable>
+  auto DoAccept(Serializable* serializable, int32_t) ->
+      decltype(serializable->Serialize(this)) {
+    serializable->Serialize(this);
+  }
+
+  // This version applies when `value` is a std::map from std::string to
+  // Serializable.  The map's values must be serializable, but there is no
+  // Serialize function required for the map itself.
+  template <typename Serializable>
+  void DoAccept(std::map<std::string, Serializable>* value, int32_t) {
+    if (!options_.retain_map_defaults) {
+      value->clear();
+    }
+    for (Entry& entry : entries_) {
+      entry.visited = true;
+      const std::string key(entry.key);
+      Serializable& item = value->emplace(key, Serializable{}).first->second;
+      debug_visit_name_ = entry.key;
+      const char* cursor = entry.value;
+      this->DoRead(&cursor, &item, static_cast<int32_t>(0));
+    }
+    debug_visit_name_ = {};
+  }
+
+  // This version applies when Serialize is an ADL free function.
+  template <typename Serializable>
+  void DoAccept(Serializable* serializable, int64_t) {
+    Serialize(this, serializable);
+  }
+
+  // --------------------------------------------------------------------------
+  // @name Overloads for reading one value at `*cursor`, and advancing the
+  // cursor past it.
+
+  // This version applies when the type has a Serialize member function.
+  template <typename T>
+  auto DoRead(const char** cursor, T* value, int32_t) ->
+      decltype(value->Serialize(static_cast<MsgpackReadArchive*>(nullptr))) {
+    MsgpackReadArchive sub_archive(cursor, this);
+    sub_archive.Accept(value);
+  }
+
+  // This version applies when the type has an ADL Serialize function.
+  template <typename T>
+  auto DoRead(const char** cursor, T* value, int32_t) ->
+      decltype(Serialize(static_cast<MsgpackReadArchive*>(nullptr), value)) {
+    MsgpackReadArchive sub_archive(cursor, this);
+    sub_archive.Accept(value);
+  }
+
+  // For std::vector.
+  template <typename T>
+  void DoRead(const char** cursor, std::vector<T>* value, int32_t) {
+    const size_t size = ReadArrayHeader(cursor);
+    value->resize(size);
+    for (T& item : *value) {
+      this->DoRead(cursor, &item, static_cast<int32_t>(0));
+    }
+  }
+
+  // For std::array.
+  template <typename T, std::size_t N>
+  void DoRead(const char** cursor, std::array<T, N>* value, int32_t) {
+    ReadArrayHeader(cursor, N);
+    for (T& item : *value) {
+      this->DoRead(cursor, &item, static_cast<int32_t>(0));
+    }
+  }
+
+  // For std::map.
+  template <typename K, typename V, typename C>
+  void DoRead(const char** cursor, std::map<K, V, C>* value, int32_t) {
+    this->ReadMap(cursor, value);
+  }
+
+  // For std::unordered_map.
+  template <typename K, typename V, typename H, typename E>
+  void DoRead(const char** cursor, std::unordered_map<K, V, H, E>* value,
+              int32_t) {
+    this->ReadMap(cursor, value);
+  }
+
+  // For std::optional.
+  template <typename T>
+  void DoRead(const char** cursor, std::optional<T>* value, int32_t) {
+    if (ReadNil(cursor)) {
+      *value = std::nullopt;
+      return;
+    }
+    if (!value->has_value()) { value->emplace(); }
+    this->DoRead(cursor, &value->value(), static_cast<int32_t>(0));
+  }
+
+  // For std::variant.
+  template <typename... Types>
+  void DoRead(const char** cursor, std::variant<Types...>* value, int32_t) {
+    // An untagged value is the variant's first type.
+    const std::optional<std::string_view> tag = ReadTag(cursor);
+    if (!tag) {
+      this->DoRead(cursor, &value->template emplace<0>(),
+                   static_cast<int32_t>(0));
+      return;
+    }
+    this->ReadVariantImpl<0, std::variant<Types...>, Types...>(
+        *tag, cursor, value);
+  }
+
+  // For Eigen::Matrix or Eigen::Vector.
+  template <typename T, int Rows, int Cols,
+      int Options = 0, int MaxRows = Rows, int MaxCols = Cols>
+  void DoRead(const char** cursor,
+              Eigen::Matrix<T, Rows, Cols, Options, MaxRows, MaxCols>* value,
+              int32_t) {
+    if constexpr (Cols == 1) {
+      if constexpr (Rows >= 0) {
+        ReadArrayHeader(cursor, Rows);
+      } else {
+        value->resize(ReadArrayHeader(cursor));
+      }
+      for (int i = 0; i < value->size(); ++i) {
+        this->DoRead(cursor, &value->coeffRef(i), static_cast<int32_t>(0));
+      }
+    } else {
+      const size_t rows = ReadArrayHeader(cursor);
+      if ((Rows != Eigen::Dynamic) && (static_cast<int>(rows) != Rows)) {
+        ReportError(fmt::format("has {} rows (wanted {})", rows, Rows));
+      }
+      for (size_t i = 0; i < rows; ++i) {
+        const size_t cols = ReadArrayHeader(cursor);
+        if (i == 0) {
+          if ((Cols != Eigen::Dynamic) && (static_cast<int>(cols) != Cols)) {
+            ReportError(fmt::format("has {} cols (wanted {})", cols, Cols));
+          }
+          value->resize(rows, cols);
+        } else if (static_cast<int>(cols) != value->cols()) {
+          ReportError("has inconsistent cols dimensions");
+        }
+        for (size_t j = 0; j < cols; ++j) {
+          this->DoRead(cursor, &value->coeffRef(i, j),
+                       static_cast<int32_t>(0));
+        }
+      }
+      if (rows == 0) {
+        value->resize(Rows == Eigen::Dynamic ? 0 : Rows,
+                      Cols == Eigen::Dynamic ? 0 : Cols);
+      }
+    }
+  }
+
+  // If no other DoRead matched, we'll treat the value as a scalar.
+  template <typename T>
+  void DoRead(const char** cursor, T* value, int64_t) {
+    ReadScalar(cursor, value);
+  }
+
+  // --------------------------------------------------------------------------
+  // @name Implementations of DoRead() once the shape is known
+
+  template <typename Map>
+  void ReadMap(const char** cursor, Map* value) {
+    // For now, we only allow std::string as the keys of a serialized std::map,
+    // as in YamlReadArchive.
+    static_assert(std::is_same_v<typename Map::key_type, std::string>,
+                  "std::map keys must be strings");
+    if (!options_.retain_map_defaults) {
+      value->clear();
+    }
+    const size_t size = ReadMapHeader(cursor);
+    for (size_t i = 0; i < size; ++i) {
+      std::string key(ReadString(cursor));
+      auto& item = (*value)[std::move(key)];
+      this->DoRead(cursor, &item, static_cast<int32_t>(0));
+    }
+  }
+
+  // Recursive case -- checks if `tag` matches `T` (which was the I'th type in
+  // the template parameter pack), or else keeps looking.
+  template <size_t I, typename Variant, typename T, typename... Remaining>
+  void ReadVariantImpl(
+      std::string_view tag, const char** cursor, Variant* value) {
+    if (IsTagMatch(NiceTypeName::GetFromStorage<T>(), tag)) {
+      this->DoRead(cursor, &value->template emplace<I>(),
+                   static_cast<int32_t>(0));
+      return;
+    }
+    this->ReadVariantImpl<I + 1, Variant, Remaining...>(tag, cursor, value);
+  }
+
+  // Base case -- no match.
+  template <size_t, typename Variant>
+  void ReadVariantImpl(std::string_view tag, const char**, Variant*) {
+    ReportError(fmt::format(
+        "has unsupported type tag {} while selecting a variant<>", tag));
+  }
+
+  // Checks if a NiceTypeName matches the tag written by MsgpackWriteArchive,
+  // i.e., the name without any namespaces or template arguments.
+  static bool IsTagMatch(const std::string& name, std::string_view tag);
+
+  // --------------------------------------------------------------------------
+  // @name Decoders
+
+  // These are the only scalar types that Drake supports, as in YAML.
+  void ReadScalar(const char** cursor, bool* result);
+  void ReadScalar(const char** cursor, float* result);
+  void ReadScalar(const char** cursor, double* result);
+  void ReadScalar(const char** cursor, int32_t* result);
+  void ReadScalar(const char** cursor, uint32_t* result);
+  void ReadScalar(const char** cursor, int64_t* result);
+  void ReadScalar(const char** cursor, uint64_t* result);
+  void ReadScalar(const char** cursor, std::string* result);
+
+  template <typename T>
+  void ReadIntegerImpl(const char** cursor, T* result);
+
+  // Reads an array header, and returns its size.
+  size_t ReadArrayHeader(const char** cursor);
+  // Reads an array header, and reports an error if its size is not `size`.
+  void ReadArrayHeader(const char** cursor, size_t size);
+  // Reads a map header, and returns its size.
+  size_t ReadMapHeader(const char** cursor);
+  std::string_view ReadString(const char** cursor);
+  // Returns true (and advances past it) iff the value at `*cursor` is nil.
+  bool ReadNil(const char** cursor);
+  // If the value at `*cursor` is tagged (a variant that is not its first
+  // type), returns the tag and advances to the tagged value.  Otherwise,
+  // returns nullopt.
+  std::optional<std::string_view> ReadTag(const char** cursor);
+  // Advances past the value at `*cursor`.
+  void Skip(const char** cursor);
+  // Returns the `size` bytes at `*cursor` (advancing past them) as a
+  // big-endian unsigned integer.
+  uint64_t ReadBigEndian(const char** cursor, int size);
+  // Reports an error unless there are at least `size` bytes at `*cursor`.
+  void Require(const char* cursor, size_t size) const;
+
+  // --------------------------------------------------------------------------
+  // @name Helpers, utilities, and member variables.
+
+  // Returns the start of the named entry's value, and marks it as visited,
+  // or else returns nullptr.
+  const char* FindEntry(const char* name);
+
+  // To be called after Accept-ing a Serializable to cross-check that all keys
+  // in the map matched a Visit call from the Serializable.  This relates to
+  // the Options.allow_yaml_with_no_cpp setting.
+  void CheckAllAccepted() const;
+
+  [[noreturn]] void ReportMissing(const char* name) const;
+  [[noreturn]] void ReportError(const std::string& message) const;
+  // Appends the names of the entries being visited, from the root down to
+  // this archive, e.g., "outer.inner".
+  void AppendPath(std::string* path) const;
+
+  // The end of the msgpack data.
+  const char* const end_;
+  // The entries of the map read by this archive.
+  std::vector<Entry> entries_;
+  // When the C++ structure and msgpack data disagree, these options govern
+  // which mismatches are permitted without an error.
+  const LoadYamlOptions options_;
+
+  // These are only used for error messages.  The debug_visit_name_ is only
+  // non-empty during Visit()'s lifetime.
+  const MsgpackReadArchive* const parent_;
+  std::string_view debug_visit_name_;
+};
+
+}  // namespace yaml
+}  // namespace drake
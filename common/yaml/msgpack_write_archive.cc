@@ -0,0 +1,170 @@
+#include "drake/common/yaml/msgpack_write_archive.h"
+
+#include <cstring>
+#include <limits>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace yaml {
+namespace {
+
+// The extension type of a tagged (variant) value; this must match the
+// MsgpackReadArchive.
+constexpr uint8_t kTaggedExtType = 1;
+
+}  // namespace
+
+void MsgpackWriteArchive::WriteScalar(bool value) {
+  buffer_.push_back(static_cast<char>(value ? 0xc3 : 0xc2));
+}
+
+void MsgpackWriteArchive::WriteScalar(float value) {
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  buffer_.push_back(static_cast<char>(0xca));
+  WriteBigEndian(bits, 4);
+}
+
+void MsgpackWriteArchive::WriteScalar(double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  buffer_.push_back(static_cast<char>(0xcb));
+  WriteBigEndian(bits, 8);
+}
+
+void MsgpackWriteArchive::WriteNil() {
+  buffer_.push_back(static_cast<char>(0xc0));
+}
+
+void MsgpackWriteArchive::WriteInt(int64_t value) {
+  if (value >= 0) {
+    WriteUint(value);
+  } else if (value >= -32) {
+    // A negative fixint.
+    buffer_.push_back(static_cast<char>(value));
+  } else if (value >= std::numeric_limits<int8_t>::min()) {
+    buffer_.push_back(static_cast<char>(0xd0));
+    WriteBigEndian(value, 1);
+  } else if (value >= std::numeric_limits<int16_t>::min()) {
+    buffer_.push_back(static_cast<char>(0xd1));
+    WriteBigEndian(value, 2);
+  } else if (value >= std::numeric_limits<int32_t>::min()) {
+    buffer_.push_back(static_cast<char>(0xd2));
+    WriteBigEndian(value, 4);
+  } else {
+    buffer_.push_back(static_cast<char>(0xd3));
+    WriteBigEndian(value, 8);
+  }
+}
+
+void MsgpackWriteArchive::WriteUint(uint64_t value) {
+  if (value < 0x80) {
+    // A positive fixint.
+    buffer_.push_back(static_cast<char>(value));
+  } else if (value <= std::numeric_limits<uint8_t>::max()) {
+    buffer_.push_back(static_cast<char>(0xcc));
+    WriteBigEndian(value, 1);
+  } else if (value <= std::numeric_limits<uint16_t>::max()) {
+    buffer_.push_back(static_cast<char>(0xcd));
+    WriteBigEndian(value, 2);
+  } else if (value <= std::numeric_limits<uint32_t>::max()) {
+    buffer_.push_back(static_cast<char>(0xce));
+    WriteBigEndian(value, 4);
+  } else {
+    buffer_.push_back(static_cast<char>(0xcf));
+    WriteBigEndian(value, 8);
+  }
+}
+
+void MsgpackWriteArchive::WriteString(std::string_view value) {
+  const size_t size = value.size();
+  if (size < 32) {
+    buffer_.push_back(static_cast<char>(0xa0 | size));
+  } else if (size <= std::numeric_limits<uint8_t>::max()) {
+    buffer_.push_back(static_cast<char>(0xd9));
+    WriteBigEndian(size, 1);
+  } else if (size <= std::numeric_limits<uint16_t>::max()) {
+    buffer_.push_back(static_cast<char>(0xda));
+    WriteBigEndian(size, 2);
+  } else {
+    DRAKE_THROW_UNLESS(size <= std::numeric_limits<uint32_t>::max());
+    buffer_.push_back(static_cast<char>(0xdb));
+    WriteBigEndian(size, 4);
+  }
+  WriteBytes(value.data(), size);
+}
+
+void MsgpackWriteArchive::WriteArrayHeader(size_t size) {
+  if (size < 16) {
+    buffer_.push_back(static_cast<char>(0x90 | size));
+  } else if (size <= std::numeric_limits<uint16_t>::max()) {
+    buffer_.push_back(static_cast<char>(0xdc));
+    WriteBigEndian(size, 2);
+  } else {
+    DRAKE_THROW_UNLESS(size <= std::numeric_limits<uint32_t>::max());
+    buffer_.push_back(static_cast<char>(0xdd));
+    WriteBigEndian(size, 4);
+  }
+}
+
+void MsgpackWriteArchive::WriteMapHeader(size_t size) {
+  if (size < 16) {
+    buffer_.push_back(static_cast<char>(0x80 | size));
+  } else if (size <= std::numeric_limits<uint16_t>::max()) {
+    buffer_.push_back(static_cast<char>(0xde));
+    WriteBigEndian(size, 2);
+  } else {
+    DRAKE_THROW_UNLESS(size <= std::numeric_limits<uint32_t>::max());
+    buffer_.push_back(static_cast<char>(0xdf));
+    WriteBigEndian(size, 4);
+  }
+}
+
+MsgpackWriteArchive::StructFrame MsgpackWriteArchive::BeginStruct() {
+  // Reserve a map16 header, since the size isn't known yet.
+  const StructFrame frame{buffer_.size(), num_entries_};
+  buffer_.push_back(static_cast<char>(0xde));
+  WriteBigEndian(0, 2);
+  num_entries_ = 0;
+  return frame;
+}
+
+void MsgpackWriteArchive::EndStruct(const StructFrame& frame) {
+  DRAKE_THROW_UNLESS(num_entries_ <= std::numeric_limits<uint16_t>::max());
+  buffer_[frame.offset + 1] = static_cast<char>(num_entries_ >> 8);
+  buffer_[frame.offset + 2] = static_cast<char>(num_entries_);
+  num_entries_ = frame.enclosing_num_entries;
+}
+
+size_t MsgpackWriteArchive::BeginTagged(std::string_view tag) {
+  // Reserve an ext32 header, since the size isn't known yet.
+  const size_t offset = buffer_.size();
+  buffer_.push_back(static_cast<char>(0xc9));
+  WriteBigEndian(0, 4);
+  buffer_.push_back(static_cast<char>(kTaggedExtType));
+  WriteString(tag);
+  return offset;
+}
+
+void MsgpackWriteArchive::EndTagged(size_t offset) {
+  const size_t payload_start = offset + 6;
+  const size_t size = buffer_.size() - payload_start;
+  DRAKE_THROW_UNLESS(size <= std::numeric_limits<uint32_t>::max());
+  for (int i = 0; i < 4; ++i) {
+    buffer_[offset + 1 + i] = static_cast<char>(size >> (8 * (3 - i)));
+  }
+}
+
+void MsgpackWriteArchive::WriteBigEndian(uint64_t value, int size) {
+  for (int i = size - 1; i >= 0; --i) {
+    buffer_.push_back(static_cast<char>(value >> (8 * i)));
+  }
+}
+
+void MsgpackWriteArchive::WriteBytes(const void* data, size_t size) {
+  buffer_.append(static_cast<const char*>(data), size);
+}
+
+}  // namespace yaml
+}  // namespace drake
@@ -0,0 +1,302 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/name_value.h"
+#include "drake/common/nice_type_name.h"
+
+namespace drake {
+namespace yaml {
+
+/// (Advanced) A helper class for @ref yaml_serialization "YAML Serialization"
+/// that saves data from a C++ structure into a compact binary document in the
+/// <a href="https://msgpack.org/">msgpack</a> format, as a faster alternative
+/// to YamlWriteArchive for large data.  Use MsgpackReadArchive to load it.
+///
+/// The document has the same shape as the YAML that YamlWriteArchive would
+/// emit: each Serializable is a map from the names of its visited members to
+/// their values, std::vector, std::array and Eigen vectors are arrays,
+/// Eigen matrices are arrays of rows, and std::map is a map.  An unset
+/// std::optional is omitted from its struct (or is nil within a container).
+/// The scalars are encoded natively (e.g., a double as a float64), not as
+/// strings.  A std::variant whose value is not its first alternative is
+/// encoded as an extension value of type 1, whose payload is the name of
+/// the value's type (without namespaces or template arguments, like the YAML
+/// tag) followed by the value.
+class MsgpackWriteArchive final {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MsgpackWriteArchive)
+
+  /// (Advanced) Creates an archive.
+  MsgpackWriteArchive() {}
+
+  /// (Advanced) Encodes the contents of `serializable` as the document of
+  /// this archive, replacing any previous document.
+  template <typename Serializable>
+  void Accept(const Serializable& serializable) {
+    auto* serializable_mutable = const_cast<Serializable*>(&serializable);
+    buffer_.clear();
+    num_entries_ = 0;
+    this->DoAccept(serializable_mutable, static_cast<int32_t>(0));
+  }
+
+  /// (Advanced) Returns the msgpack document for whatever Serializable was
+  /// most recently passed into Accept.
+  const std::string& data() const { return buffer_; }
+
+  /// (Advanced) Encodes the value pointed to by `nvp.value()` as an entry of
+  /// the map currently being written.  Most users should call Accept, not
+  /// Visit.
+  template <typename NameValuePair>
+  void Visit(const NameValuePair& nvp) {
+    using T = typename NameValuePair::value_type;
+    if constexpr (is_optional<T>::value) {
+      // An unset optional is omitted from its struct (as in YAML).
+      if (!nvp.value()->has_value()) { return; }
+    }
+    WriteString(nvp.name());
+    ++num_entries_;
+    // Use int32_t for the final argument to prefer the specialized overload.
+    this->DoWrite(nvp.value(), static_cast<int32_t>(0));
+  }
+
+ private:
+  template <typename T>
+  struct is_optional : std::false_type {};
+  template <typename T>
+  struct is_optional<std::optional<T>> : std::true_type {};
+
+  // --------------------------------------------------------------------------
+  // @name Overloads for the Accept() implementation
+
+  // This version applies when Serialize is member function.
+  template <typename Serializable>
+  auto DoAccept(Serializable* serializable, int32_t) ->
+      decltype(serializable->Serialize(this)) {
+    const StructFrame map = BeginStruct();
+    serializable->Serialize(this);
+    EndStruct(map);
+  }
+
+  // This version applies when `value` is a std::map from std::string to
+  // Serializable.  The map's values must be serializable, but there is no
+  // Serialize function required for the map itself.
+  template <typename Serializable>
+  void DoAccept(std::map<std::string, Serializable>* value, int32_t) {
+    WriteMap(value);
+  }
+
+  // This version applies when Serialize is an ADL free function.
+  template <typename Serializable>
+  void DoAccept(Serializable* serializable, int64_t) {
+    const StructFrame map = BeginStruct();
+    Serialize(this, serializable);
+    EndStruct(map);
+  }
+
+  // --------------------------------------------------------------------------
+  // @name Overloads for writing one value, once its entry name (if any) has
+  // been written.
+
+  // This version applies when the type has a Serialize member function.
+  template <typename T>
+  auto DoWrite(T* value, int32_t) ->
+      decltype(value->Serialize(static_cast<MsgpackWriteArchive*>(nullptr))) {
+    const StructFrame map = BeginStruct();
+    value->Serialize(this);
+    EndStruct(map);
+  }
+
+  // This version applies when the type has an ADL Serialize function.
+  template <typename T>
+  auto DoWrite(T* value, int32_t) ->
+      decltype(Serialize(static_cast<MsgpackWriteArchive*>(nullptr), value)) {
+    const StructFrame map = BeginStruct();
+    Serialize(this, value);
+    EndStruct(map);
+  }
+
+  // For std::vector.
+  template <typename T>
+  void DoWrite(std::vector<T>* value, int32_t) {
+    WriteArrayHeader(value->size());
+    for (T& item : *value) {
+      this->DoWrite(&item, static_cast<int32_t>(0));
+    }
+  }
+
+  // For std::array.
+  template <typename T, std::size_t N>
+  void DoWrite(std::array<T, N>* value, int32_t) {
+    WriteArrayHeader(N);
+    for (T& item : *value) {
+      this->DoWrite(&item, static_cast<int32_t>(0));
+    }
+  }
+
+  // For std::map.
+  template <typename K, typename V, typename C>
+  void DoWrite(std::map<K, V, C>* value, int32_t) {
+    WriteMap(value);
+  }
+
+  // For std::unordered_map.
+  template <typename K, typename V, typename H, typename E>
+  void DoWrite(std::unordered_map<K, V, H, E>* value, int32_t) {
+    WriteMap(value);
+  }
+
+  // For std::optional (other than as a struct member, which Visit() omits
+  // when unset).
+  template <typename T>
+  void DoWrite(std::optional<T>* value, int32_t) {
+    if (value->has_value()) {
+      this->DoWrite(&value->value(), static_cast<int32_t>(0));
+    } else {
+      WriteNil();
+    }
+  }
+
+  // For std::variant.
+  template <typename... Types>
+  void DoWrite(std::variant<Types...>* value, int32_t) {
+    const size_t index = value->index();
+    std::visit([this, index](auto&& unwrapped) {
+      if (index == 0) {
+        this->DoWrite(&unwrapped, static_cast<int32_t>(0));
+        return;
+      }
+      using T = std::decay_t<decltype(unwrapped)>;
+      const size_t ext = BeginTagged(GetVariantTag<T>());
+      this->DoWrite(&unwrapped, static_cast<int32_t>(0));
+      EndTagged(ext);
+    }, *value);
+  }
+
+  // For Eigen::Matrix or Eigen::Vector.
+  template <typename T, int Rows, int Cols,
+      int Options = 0, int MaxRows = Rows, int MaxCols = Cols>
+  void DoWrite(Eigen::Matrix<T, Rows, Cols, Options, MaxRows, MaxCols>* value,
+               int32_t) {
+    if constexpr (Cols == 1) {
+      WriteArrayHeader(value->size());
+      for (int i = 0; i < value->size(); ++i) {
+        this->DoWrite(&value->coeffRef(i), static_cast<int32_t>(0));
+      }
+    } else {
+      WriteArrayHeader(value->rows());
+      for (int i = 0; i < value->rows(); ++i) {
+        WriteArrayHeader(value->cols());
+        for (int j = 0; j < value->cols(); ++j) {
+          this->DoWrite(&value->coeffRef(i, j), static_cast<int32_t>(0));
+        }
+      }
+    }
+  }
+
+  // If no other DoWrite matched, we'll treat the value as a scalar.
+  template <typename T>
+  void DoWrite(T* value, int64_t) {
+    WriteScalar(*value);
+  }
+
+  // --------------------------------------------------------------------------
+  // @name Implementations of DoWrite() once the shape is known
+
+  // This is used for std::map, std::unordered_map, or similar.  The entries
+  // are written in sorted order, so that the document is deterministic.
+  template <typename Map>
+  void WriteMap(Map* value) {
+    // For now, we only allow std::string as the keys of a serialized std::map,
+    // as in YamlWriteArchive.
+    static_assert(std::is_same_v<typename Map::key_type, std::string>,
+                  "Map keys must be strings");
+    std::vector<typename Map::value_type*> entries;
+    entries.reserve(value->size());
+    for (auto& entry : *value) {
+      entries.push_back(&entry);
+    }
+    std::sort(entries.begin(), entries.end(), [](auto* a, auto* b) {
+      return a->first < b->first;
+    });
+    WriteMapHeader(entries.size());
+    for (auto* entry : entries) {
+      WriteString(entry->first);
+      this->DoWrite(&entry->second, static_cast<int32_t>(0));
+    }
+  }
+
+  template <typename T>
+  static std::string GetVariantTag() {
+    std::string short_name =
+        NiceTypeName::RemoveNamespaces(NiceTypeName::GetFromStorage<T>());
+    auto angle = short_name.find('<');
+    if (angle != std::string::npos) {
+      // Remove template arguments.
+      short_name.resize(angle);
+    }
+    return short_name;
+  }
+
+  // --------------------------------------------------------------------------
+  // @name Encoders
+
+  // These are the only scalar types that Drake supports, as in YAML.
+  void WriteScalar(bool value);
+  void WriteScalar(float value);
+  void WriteScalar(double value);
+  void WriteScalar(int32_t value) { WriteInt(value); }
+  void WriteScalar(uint32_t value) { WriteUint(value); }
+  void WriteScalar(int64_t value) { WriteInt(value); }
+  void WriteScalar(uint64_t value) { WriteUint(value); }
+  void WriteScalar(const std::string& value) { WriteString(value); }
+
+  void WriteNil();
+  void WriteInt(int64_t value);
+  void WriteUint(uint64_t value);
+  void WriteString(std::string_view value);
+  void WriteArrayHeader(size_t size);
+  void WriteMapHeader(size_t size);
+
+  // The bookkeeping for a map whose size is not yet known, i.e., the entries
+  // of a Serializable: the offset of its header, and the number of entries
+  // of the enclosing struct so far.
+  struct StructFrame {
+    size_t offset{};
+    uint32_t enclosing_num_entries{};
+  };
+
+  // Starts a struct, whose header EndStruct() fills in once its members have
+  // been visited.
+  StructFrame BeginStruct();
+  void EndStruct(const StructFrame& frame);
+
+  // Starts a tagged (variant) value, and returns its offset for EndTagged()
+  // to write its size.
+  size_t BeginTagged(std::string_view tag);
+  void EndTagged(size_t offset);
+
+  // Appends `size` bytes in big-endian order (for the headers) or as-is.
+  void WriteBigEndian(uint64_t value, int size);
+  void WriteBytes(const void* data, size_t size);
+
+  std::string buffer_;
+  // The number of entries written so far to the innermost struct.
+  uint32_t num_entries_{};
+};
+
+}  // namespace yaml
+}  // namespace drake
@@ -0,0 +1,291 @@
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/common/yaml/msgpack_io.h"
+#include "drake/common/yaml/test/example_structs.h"
+#include "drake/common/yaml/yaml_io.h"
+
+namespace drake {
+namespace yaml {
+namespace test {
+namespace {
+
+struct Int32Struct {
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(value));
+  }
+
+  int32_t value{};
+};
+
+struct Int64Struct {
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(value));
+  }
+
+  int64_t value{};
+};
+
+// A variant without DoubleStruct.
+struct OtherVariantStruct {
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(value));
+  }
+
+  std::variant<std::string, EigenVecStruct> value;
+};
+
+// Saves `data` as msgpack, and then loads it back.
+template <typename Serializable>
+Serializable RoundTrip(const Serializable& data) {
+  return LoadMsgpackString<Serializable>(SaveMsgpackString(data));
+}
+
+// The bytes of a document, for easier comparisons.
+std::string Bytes(std::initializer_list<int> bytes) {
+  std::string result;
+  for (int byte : bytes) {
+    result.push_back(static_cast<char>(byte));
+  }
+  return result;
+}
+
+GTEST_TEST(MsgpackArchiveTest, Encoding) {
+  // A struct is a map from member names to their values.  Its size is written
+  // once the members have been visited, so is always a map16.
+  EXPECT_EQ(SaveMsgpackString(DoubleStruct{0.5}),
+            Bytes({0xde, 0x00, 0x01,
+                   0xa5, 'v', 'a', 'l', 'u', 'e',
+                   0xcb, 0x3f, 0xe0, 0, 0, 0, 0, 0, 0}));
+  EXPECT_EQ(SaveMsgpackString(VectorStruct{{1.0}}),
+            Bytes({0xde, 0x00, 0x01,
+                   0xa5, 'v', 'a', 'l', 'u', 'e',
+                   0x91, 0xcb, 0x3f, 0xf0, 0, 0, 0, 0, 0, 0}));
+  // An unset optional is omitted from its struct.
+  EXPECT_EQ(SaveMsgpackString(OptionalStructNoDefault{}),
+            Bytes({0xde, 0x00, 0x00}));
+}
+
+GTEST_TEST(MsgpackArchiveTest, Scalars) {
+  AllScalarsStruct data;
+  data.some_bool = true;
+  data.some_float = 101.0f;
+  data.some_double = 1.0 / 3.0;
+  data.some_int32 = std::numeric_limits<int32_t>::min();
+  data.some_uint32 = std::numeric_limits<uint32_t>::max();
+  data.some_int64 = -200;
+  data.some_uint64 = std::numeric_limits<uint64_t>::max();
+  data.some_string = std::string(300, 'x');
+  const AllScalarsStruct result = RoundTrip(data);
+  EXPECT_EQ(result.some_bool, data.some_bool);
+  EXPECT_EQ(result.some_float, data.some_float);
+  EXPECT_EQ(result.some_double, data.some_double);
+  EXPECT_EQ(result.some_int32, data.some_int32);
+  EXPECT_EQ(result.some_uint32, data.some_uint32);
+  EXPECT_EQ(result.some_int64, data.some_int64);
+  EXPECT_EQ(result.some_uint64, data.some_uint64);
+  EXPECT_EQ(result.some_string, data.some_string);
+
+  // Non-finite values round-trip exactly.
+  EXPECT_TRUE(std::isnan(RoundTrip(DoubleStruct{NAN}).value));
+  EXPECT_EQ(RoundTrip(DoubleStruct{-INFINITY}).value, -INFINITY);
+}
+
+GTEST_TEST(MsgpackArchiveTest, Containers) {
+  std::vector<double> many(1000);
+  for (size_t i = 0; i < many.size(); ++i) {
+    many[i] = 0.1 * i;
+  }
+  EXPECT_EQ(RoundTrip(VectorStruct{many}).value, many);
+  EXPECT_EQ(RoundTrip(VectorStruct{{}}).value.size(), 0);
+  const std::array<double, 3> array{1.0, 2.0, 3.0};
+  EXPECT_EQ(RoundTrip(ArrayStruct{array}).value, array);
+
+  NonPodVectorStruct non_pod;
+  non_pod.value = {{"a"}, {"b"}};
+  const NonPodVectorStruct non_pod_result = RoundTrip(non_pod);
+  ASSERT_EQ(non_pod_result.value.size(), 2);
+  EXPECT_EQ(non_pod_result.value[1].value, "b");
+
+  const std::map<std::string, double> map{{"a", 1.0}, {"b", 2.0}};
+  EXPECT_EQ(RoundTrip(MapStruct{map}).value, map);
+  const std::unordered_map<std::string, double> unordered_map{
+      {"a", 1.0}, {"b", 2.0}};
+  EXPECT_EQ(RoundTrip(UnorderedMapStruct{unordered_map}).value, unordered_map);
+
+  EXPECT_EQ(RoundTrip(OptionalStruct{2.0}).value, 2.0);
+  EXPECT_EQ(RoundTrip(OptionalStruct{std::nullopt}).value, std::nullopt);
+
+  BigMapStruct big_map;
+  big_map.value["bar"].outer_value = 3.0;
+  const BigMapStruct big_map_result = RoundTrip(big_map);
+  ASSERT_EQ(big_map_result.value.size(), 2);
+  EXPECT_EQ(big_map_result.value.at("foo").inner_struct.inner_value, 2.0);
+  EXPECT_EQ(big_map_result.value.at("bar").outer_value, 3.0);
+
+  // A map of Serializables can be the root.
+  using RootMap = std::map<std::string, DoubleStruct>;
+  const RootMap root{{"x", {1.0}}, {"y", {2.0}}};
+  EXPECT_EQ(LoadMsgpackString<RootMap>(SaveMsgpackString(root)), root);
+}
+
+GTEST_TEST(MsgpackArchiveTest, Eigen) {
+  Eigen::VectorXd vector(4);
+  vector << 1.0, 2.0, 3.0, 4.0;
+  EXPECT_EQ(RoundTrip(EigenVecStruct{vector}), EigenVecStruct{vector});
+  const Eigen::Vector3d vector3(1.0, 2.0, 3.0);
+  EXPECT_EQ(RoundTrip(EigenVec3Struct{vector3}), EigenVec3Struct{vector3});
+  Eigen::MatrixXd matrix(2, 3);
+  matrix << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
+  EXPECT_EQ(RoundTrip(EigenMatrixStruct{matrix}), EigenMatrixStruct{matrix});
+  Eigen::Matrix<double, 3, 4> matrix34;
+  matrix34.setConstant(7.0);
+  EXPECT_EQ(RoundTrip(EigenMatrix34Struct{matrix34}),
+            EigenMatrix34Struct{matrix34});
+  EXPECT_EQ(RoundTrip(EigenMatrixStruct{Eigen::MatrixXd(0, 0)}).value.size(),
+            0);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadMsgpackString<EigenVec3Struct>(
+          SaveMsgpackString(EigenVecStruct{vector})),
+      ".*entry value has 4-size entry \\(wanted 3-size\\).*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadMsgpackString<EigenMatrix34Struct>(
+          SaveMsgpackString(EigenMatrixStruct{matrix})),
+      ".*entry value has 2 rows \\(wanted 3\\).*");
+}
+
+GTEST_TEST(MsgpackArchiveTest, Variant) {
+  for (const Variant4& value : {Variant4{std::string("foo")}, Variant4{1.0},
+                                Variant4{DoubleStruct{2.0}},
+                                Variant4{EigenVecStruct{}}}) {
+    const VariantStruct result = RoundTrip(VariantStruct{value});
+    EXPECT_EQ(result.value.index(), value.index());
+  }
+  EXPECT_EQ(std::get<double>(RoundTrip(VariantStruct{Variant4{1.0}}).value),
+            1.0);
+  EXPECT_EQ(std::get<DoubleStruct>(
+                RoundTrip(VariantStruct{Variant4{DoubleStruct{2.0}}}).value),
+            DoubleStruct{2.0});
+  VariantWrappingStruct wrapping;
+  wrapping.inner.value = DoubleStruct{3.0};
+  EXPECT_EQ(std::get<DoubleStruct>(RoundTrip(wrapping).inner.value),
+            DoubleStruct{3.0});
+
+  // A tag that doesn't match any type is an error.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadMsgpackString<OtherVariantStruct>(
+          SaveMsgpackString(VariantStruct{Variant4{DoubleStruct{}}})),
+      ".*has unsupported type tag DoubleStruct while selecting a variant.*");
+}
+
+GTEST_TEST(MsgpackArchiveTest, Nested) {
+  OuterStruct data;
+  data.outer_value = 1.0;
+  data.inner_struct.inner_value = 2.0;
+  const OuterStruct result = RoundTrip(data);
+  EXPECT_EQ(result.outer_value, 1.0);
+  EXPECT_EQ(result.inner_struct.inner_value, 2.0);
+
+  // The member order doesn't matter.
+  const auto opposite =
+      LoadMsgpackString<OuterStructOpposite>(SaveMsgpackString(data));
+  EXPECT_EQ(opposite.outer_value, 1.0);
+  EXPECT_EQ(opposite.inner_struct.inner_value, 2.0);
+
+  EXPECT_EQ(RoundTrip(OuterWithBlankInner{}).outer_value, kNominalDouble);
+}
+
+// The defaults and options have the same effect as for YAML.
+GTEST_TEST(MsgpackArchiveTest, DefaultsAndOptions) {
+  const std::string outer = SaveMsgpackString(OuterStruct{});
+  const std::string blank = SaveMsgpackString(OuterWithBlankInner{});
+
+  // The document has an entry that the struct doesn't.
+  LoadYamlOptions options;
+  options.allow_cpp_with_no_yaml = true;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadMsgpackString<DoubleStruct>(outer, {}, options),
+      ".*has an entry 'outer_value' that does not match any C.. member.*");
+  options.allow_yaml_with_no_cpp = true;
+  EXPECT_EQ(LoadMsgpackString<DoubleStruct>(outer, {}, options).value,
+            kNominalDouble);
+
+  // The struct has an entry that the document doesn't.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadMsgpackString<OuterStruct>(blank),
+      ".*the msgpack entry inner_struct is missing the entry 'inner_value'.*");
+  OuterStruct defaults;
+  defaults.inner_struct.inner_value = 5.0;
+  EXPECT_EQ(LoadMsgpackString<OuterStruct>(blank, defaults)
+                .inner_struct.inner_value,
+            5.0);
+
+  // Map entries are retained iff retain_map_defaults.
+  const std::string map = SaveMsgpackString(MapStruct{{{"a", 1.0}}});
+  EXPECT_EQ(LoadMsgpackString<MapStruct>(map).value.size(), 1);
+  EXPECT_EQ(LoadMsgpackString<MapStruct>(map, MapStruct{}).value.size(), 2);
+}
+
+GTEST_TEST(MsgpackArchiveTest, Errors) {
+  const std::string scalars = SaveMsgpackString(AllScalarsStruct{});
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadMsgpackString<AllScalarsStruct>(
+          scalars.substr(0, scalars.size() - 1)),
+      ".*msgpack document is truncated.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadMsgpackString<AllScalarsStruct>(scalars + "x"),
+      ".*has trailing data.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadMsgpackString<DoubleStruct>(SaveMsgpackString(StringStruct{})),
+      ".*entry value is a string \\(wanted a floating-point number\\).*");
+
+  // Integers are range checked.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadMsgpackString<Int32Struct>(SaveMsgpackString(Int64Struct{1LL << 40})),
+      ".*value 1099511627776 is out of range.*");
+  EXPECT_EQ(LoadMsgpackString<DoubleStruct>(
+                SaveMsgpackString(Int64Struct{-7})).value, -7.0);
+}
+
+GTEST_TEST(MsgpackArchiveTest, File) {
+  const std::string filename = temp_directory() + "/outer.msgpack";
+  OuterStruct data;
+  data.outer_value = 3.0;
+  SaveMsgpackFile(filename, data);
+  EXPECT_EQ(LoadMsgpackFile<OuterStruct>(filename).outer_value, 3.0);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadMsgpackFile<OuterStruct>(filename + ".missing"),
+      ".*could not open.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SaveMsgpackFile(temp_directory() + "/no/such/dir/a.msgpack", data),
+      ".*could not open.*");
+}
+
+// The msgpack document loads the same data as the equivalent YAML.
+GTEST_TEST(MsgpackArchiveTest, SameAsYaml) {
+  BigMapStruct data;
+  data.value["bar"].inner_struct.inner_value = 4.0;
+  const auto from_yaml = LoadYamlString<BigMapStruct>(SaveYamlString(data));
+  const auto from_msgpack = RoundTrip(data);
+  ASSERT_EQ(from_msgpack.value.size(), from_yaml.value.size());
+  for (const auto& [key, value] : from_yaml.value) {
+    EXPECT_EQ(from_msgpack.value.at(key).outer_value, value.outer_value);
+    EXPECT_EQ(from_msgpack.value.at(key).inner_struct.inner_value,
+              value.inner_struct.inner_value);
+  }
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace yaml
+}  // namespace drake
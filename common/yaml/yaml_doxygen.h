@@ -381,4 +381,13 @@ bar4:
     data: hello
 @endcode
 
+<h2>Binary (msgpack) serialization</h2>
+
+For large data (e.g., trajectories or per-sample Monte Carlo results), parsing
+YAML text can dominate the run time.  The same Serialize() functions also
+support a compact binary encoding in the https://msgpack.org format, via
+SaveMsgpackFile(), SaveMsgpackString(), LoadMsgpackFile() and
+LoadMsgpackString() (in `drake/common/yaml/msgpack_io.h`).  The document has the
+same shape as the YAML would; see MsgpackWriteArchive for details.
+
 */
@@ -0,0 +1,110 @@
+// @file
+// Benchmarks for a single control step of the ManipulationStation, with the
+// full-fidelity station and with the reduced-order options that are meant for
+// high-throughput training.
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/examples/manipulation_station/manipulation_station.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace examples {
+namespace manipulation_station {
+namespace {
+
+using Eigen::VectorXd;
+using systems::Simulator;
+
+constexpr double kTimeStep = 0.002;
+
+class StationFixture : public benchmark::Fixture {
+ public:
+  StationFixture() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+  // Builds a manipulation class station with the given options, holds its
+  // commands fixed and reads the observations once.
+  void Populate(const ManipulationStationOptions& options) {
+    station_ = std::make_unique<ManipulationStation<double>>(kTimeStep);
+    station_->SetupManipulationClassStation();
+    station_->set_options(options);
+    station_->Finalize();
+
+    simulator_ = std::make_unique<Simulator<double>>(*station_);
+    auto& context = simulator_->get_mutable_context();
+    station_->GetInputPort("iiwa_position")
+        .FixValue(&context, station_->GetIiwaPosition(context));
+    station_->GetInputPort("iiwa_feedforward_torque")
+        .FixValue(&context, VectorXd::Zero(7));
+    station_->GetInputPort("wsg_position")
+        .FixValue(&context, station_->GetWsgPosition(context));
+    station_->GetInputPort("wsg_force_limit").FixValue(&context, 40.);
+    simulator_->Initialize();
+    Observe();
+  }
+
+  // Advances by one step of the station and evaluates what a learning agent
+  // would observe: the IIWA state and, when present, the camera images.
+  void Step() {
+    const auto& context = simulator_->get_context();
+    simulator_->AdvanceTo(context.get_time() + kTimeStep);
+    Observe();
+  }
+
+ private:
+  void Observe() {
+    const auto& context = simulator_->get_context();
+    station_->GetOutputPort("iiwa_position_measured").Eval(context);
+    station_->GetOutputPort("iiwa_velocity_estimated").Eval(context);
+    if (station_->get_options().enable_cameras) {
+      for (const auto& name : station_->get_camera_names()) {
+        station_->GetOutputPort("camera_" + name + "_rgb_image")
+            .Eval<AbstractValue>(context);
+      }
+    }
+  }
+
+  std::unique_ptr<ManipulationStation<double>> station_;
+  std::unique_ptr<Simulator<double>> simulator_;
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(StationFixture, FullFidelityStep)(benchmark::State& state) {
+  Populate(ManipulationStationOptions{});
+  for (auto _ : state) {
+    Step();
+  }
+}
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(StationFixture, FusedControllerStep)(benchmark::State& state) {
+  ManipulationStationOptions options;
+  options.use_fused_iiwa_controller = true;
+  Populate(options);
+  for (auto _ : state) {
+    Step();
+  }
+}
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(StationFixture, TrainingStep)(benchmark::State& state) {
+  ManipulationStationOptions options;
+  options.use_fused_iiwa_controller = true;
+  options.enable_cameras = false;
+  Populate(options);
+  for (auto _ : state) {
+    Step();
+  }
+}
+
+}  // namespace
+}  // namespace manipulation_station
+}  // namespace examples
+}  // namespace drake
+
+BENCHMARK_MAIN();
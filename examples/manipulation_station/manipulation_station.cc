@@ -15,6 +15,7 @@
 #include "drake/multibody/tree/prismatic_joint.h"
 #include "drake/multibody/tree/revolute_joint.h"
 #include "drake/perception/depth_image_to_point_cloud.h"
+#include "drake/systems/controllers/fused_inverse_dynamics_controller.h"
 #include "drake/systems/controllers/inverse_dynamics_controller.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/primitives/adder.h"
@@ -618,10 +619,21 @@ void ManipulationStation<T>::Finalize(
     DRAKE_THROW_UNLESS(check_gains(iiwa_ki_, num_iiwa_positions));
 
     // Add the inverse dynamics controller.
-    auto iiwa_controller = builder.template AddSystem<
-        systems::controllers::InverseDynamicsController>(
-        *owned_controller_plant_, iiwa_kp_, iiwa_ki_, iiwa_kd_, false);
-    iiwa_controller->set_name("iiwa_controller");
+    systems::controllers::StateFeedbackControllerInterface<T>*
+        iiwa_controller{};
+    if (options_.use_fused_iiwa_controller) {
+      auto controller = builder.template AddSystem<
+          systems::controllers::FusedInverseDynamicsController>(
+          *owned_controller_plant_, iiwa_kp_, iiwa_ki_, iiwa_kd_, false);
+      controller->set_name("iiwa_controller");
+      iiwa_controller = controller;
+    } else {
+      auto controller = builder.template AddSystem<
+          systems::controllers::InverseDynamicsController>(
+          *owned_controller_plant_, iiwa_kp_, iiwa_ki_, iiwa_kd_, false);
+      controller->set_name("iiwa_controller");
+      iiwa_controller = controller;
+    }
     builder.Connect(plant_->get_state_output_port(iiwa_model_.model_instance),
                     iiwa_controller->get_input_port_estimated_state());
 
@@ -691,7 +703,7 @@ void ManipulationStation<T>::Finalize(
                            iiwa_model_.model_instance),
                        "iiwa_torque_external");
 
-  {  // RGB-D Cameras
+  if (options_.enable_cameras) {  // RGB-D Cameras
     if (render_engines.size() > 0) {
       for (auto& pair : render_engines) {
         scene_graph_->AddRenderer(pair.first, std::move(pair.second));
@@ -701,44 +713,62 @@ void ManipulationStation<T>::Finalize(
                                 MakeRenderEngineVtk(RenderEngineVtkParams()));
     }
 
-    for (const auto& [name, info] : camera_information_) {
-      std::string camera_name = "camera_" + name;
-
-      const std::optional<geometry::FrameId> parent_body_id =
-          plant_->GetBodyFrameIdIfExists(info.parent_frame->body().index());
-      DRAKE_THROW_UNLESS(parent_body_id.has_value());
-      const RigidTransform<double> X_PC =
-          info.parent_frame->GetFixedPoseInBodyFrame() * info.X_PC;
-
-      auto camera = builder.template AddSystem<systems::sensors::RgbdSensor>(
-          parent_body_id.value(), X_PC, info.color_camera, info.depth_camera);
+    // Wires up and exports a camera, which is either an RgbdSensor or an
+    // RgbdSensorDiscrete; the two have the same ports.
+    auto add_camera_outputs = [this, &builder](
+        const auto& camera, const systems::sensors::CameraInfo& depth_info,
+        const RigidTransform<double>& X_PC, const std::string& camera_name) {
       builder.Connect(scene_graph_->get_query_output_port(),
-                      camera->query_object_input_port());
+                      camera.query_object_input_port());
 
       auto depth_to_cloud = builder.template AddSystem<
           perception::DepthImageToPointCloud>(
-              camera->depth_camera_info(),
+              depth_info,
               systems::sensors::PixelType::kDepth16U,
               0.001f /* depth camera is in mm */,
               perception::pc_flags::kXYZs |
               perception::pc_flags::kRGBs);
       auto x_pc_system = builder.template AddSystem<
           systems::ConstantValueSource>(Value<RigidTransformd>(X_PC));
-      builder.Connect(camera->color_image_output_port(),
+      builder.Connect(camera.color_image_output_port(),
                       depth_to_cloud->color_image_input_port());
-      builder.Connect(camera->depth_image_16U_output_port(),
+      builder.Connect(camera.depth_image_16U_output_port(),
                       depth_to_cloud->depth_image_input_port());
       builder.Connect(x_pc_system->get_output_port(),
                       depth_to_cloud->camera_pose_input_port());
 
-      builder.ExportOutput(camera->color_image_output_port(),
+      builder.ExportOutput(camera.color_image_output_port(),
                            camera_name + "_rgb_image");
-      builder.ExportOutput(camera->depth_image_16U_output_port(),
+      builder.ExportOutput(camera.depth_image_16U_output_port(),
                            camera_name + "_depth_image");
-      builder.ExportOutput(camera->label_image_output_port(),
+      builder.ExportOutput(camera.label_image_output_port(),
                            camera_name + "_label_image");
       builder.ExportOutput(depth_to_cloud->point_cloud_output_port(),
                            camera_name + "_point_cloud");
+    };
+
+    for (const auto& [name, info] : camera_information_) {
+      std::string camera_name = "camera_" + name;
+
+      const std::optional<geometry::FrameId> parent_body_id =
+          plant_->GetBodyFrameIdIfExists(info.parent_frame->body().index());
+      DRAKE_THROW_UNLESS(parent_body_id.has_value());
+      const RigidTransform<double> X_PC =
+          info.parent_frame->GetFixedPoseInBodyFrame() * info.X_PC;
+
+      auto sensor = std::make_unique<systems::sensors::RgbdSensor>(
+          parent_body_id.value(), X_PC, info.color_camera, info.depth_camera);
+      if (options_.camera_period > 0) {
+        auto camera = builder.template AddSystem<
+            systems::sensors::RgbdSensorDiscrete>(std::move(sensor),
+                                                  options_.camera_period);
+        add_camera_outputs(*camera, camera->sensor().depth_camera_info(),
+                           X_PC, camera_name);
+      } else {
+        auto camera = builder.AddSystem(std::move(sensor));
+        add_camera_outputs(*camera, camera->depth_camera_info(), X_PC,
+                           camera_name);
+      }
     }
   }
 
@@ -32,6 +32,28 @@ enum class SchunkCollisionModel { kBox, kBoxPlusFingertipSpheres };
 /// Determines which manipulation station is simulated.
 enum class Setup { kNone, kManipulationClass, kClutterClearing, kPlanarIiwa };
 
+/// Options that trade some of the fidelity of a ManipulationStation for
+/// simulation speed, e.g., to run many stations in parallel for reinforcement
+/// learning. The default values give the full-fidelity station.
+/// @see ManipulationStation::set_options()
+struct ManipulationStationOptions {
+  /// If true, the IIWA is controlled by a single
+  /// systems::controllers::FusedInverseDynamicsController rather than by a
+  /// systems::controllers::InverseDynamicsController, which is a Diagram of
+  /// several systems. The two compute the same torques.
+  bool use_fused_iiwa_controller{false};
+
+  /// If false, the station has neither a renderer nor cameras, and none of
+  /// the camera_[NAME]_* output ports exist. Registered cameras are ignored.
+  bool enable_cameras{true};
+
+  /// If positive, the images of each camera are rendered once per
+  /// `camera_period` seconds and held in between (see
+  /// systems::sensors::RgbdSensorDiscrete), instead of being rendered every
+  /// time the camera output ports are evaluated with new state.
+  double camera_period{0};
+};
+
 /// @defgroup manipulation_station_systems Manipulation Station
 /// @{
 /// @brief Systems related to the "manipulation station" used in the <a
@@ -83,6 +105,9 @@ enum class Setup { kNone, kManipulationClass, kClutterClearing, kPlanarIiwa };
 /// Each pixel in the output image from `depth_image` is a 16bit unsigned
 /// short in millimeters.
 ///
+/// The camera_[NAME]_* output ports are absent if cameras are disabled (see
+/// ManipulationStationOptions).
+///
 /// Note that outputs in <b style="color:orange">orange</b> are
 /// available in the simulation, but not on the real robot.  The distinction
 /// between q_measured and v_estimated is because the Kuka FRI reports
@@ -468,6 +493,17 @@ class ManipulationStation : public systems::Diagram<T> {
     iiwa_ki_ = ki;
   }
 
+  /// Sets the options that trade fidelity for speed.
+  /// @throws std::exception if Finalize() has been called.
+  void set_options(const ManipulationStationOptions& options) {
+    DRAKE_THROW_UNLESS(!plant_->is_finalized());
+    DRAKE_THROW_UNLESS(options.camera_period >= 0);
+    options_ = options;
+  }
+
+  /// Returns the options that trade fidelity for speed.
+  const ManipulationStationOptions& get_options() const { return options_; }
+
  private:
   // Struct defined to store information about the how to parse and add a model.
   struct ModelInformation {
@@ -531,6 +567,8 @@ class ManipulationStation : public systems::Diagram<T> {
   double wsg_kp_{200};
   double wsg_kd_{5};
 
+  ManipulationStationOptions options_;
+
   // Represents the manipulation station to simulate. This gets set in the
   // corresponding station setup function (e.g.,
   // SetupManipulationClassStation()), and informs how SetDefaultState()
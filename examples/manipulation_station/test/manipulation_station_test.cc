@@ -420,6 +420,56 @@ GTEST_TEST(ManipulationStationTest, ConfigureRenderer) {
   }
 }
 
+// The reduced-order options keep the controller's torques, and drop the
+// renderer and the camera ports.
+GTEST_TEST(ManipulationStationTest, Options) {
+  ManipulationStation<double> reference(0.001);
+  reference.SetupManipulationClassStation();
+  reference.Finalize();
+
+  ManipulationStation<double> dut(0.001);
+  dut.SetupManipulationClassStation();
+  ManipulationStationOptions options;
+  options.use_fused_iiwa_controller = true;
+  options.enable_cameras = false;
+  dut.set_options(options);
+  EXPECT_TRUE(dut.get_options().use_fused_iiwa_controller);
+  dut.Finalize();
+  EXPECT_THROW(dut.set_options(options), std::exception);
+
+  EXPECT_FALSE(reference.get_camera_names().empty());
+  for (const auto& name : reference.get_camera_names()) {
+    EXPECT_TRUE(reference.HasOutputPort("camera_" + name + "_rgb_image"));
+    EXPECT_FALSE(dut.HasOutputPort("camera_" + name + "_rgb_image"));
+  }
+  EXPECT_EQ(dut.get_scene_graph().RendererCount(), 0);
+  EXPECT_LT(dut.num_output_ports(), reference.num_output_ports());
+
+  auto reference_context = reference.CreateDefaultContext();
+  auto dut_context = dut.CreateDefaultContext();
+  EXPECT_EQ(dut_context->num_continuous_states(),
+            reference_context->num_continuous_states());
+  const VectorXd q = VectorXd::LinSpaced(7, 0.1, 0.7);
+  const VectorXd v = VectorXd::LinSpaced(7, 1.1, 1.7);
+  const VectorXd q_command = VectorXd::LinSpaced(7, 2.1, 2.7);
+  for (auto [station, context] :
+       {std::pair(&reference, reference_context.get()),
+        std::pair(&dut, dut_context.get())}) {
+    station->SetIiwaPosition(context, q);
+    station->SetIiwaVelocity(context, v);
+    station->GetInputPort("iiwa_position").FixValue(context, q_command);
+    station->GetInputPort("iiwa_feedforward_torque")
+        .FixValue(context, VectorXd::Zero(7));
+  }
+  EXPECT_TRUE(CompareMatrices(dut.GetOutputPort("iiwa_torque_commanded")
+                                  .Eval<BasicVector<double>>(*dut_context)
+                                  .get_value(),
+                              reference.GetOutputPort("iiwa_torque_commanded")
+                                  .Eval<BasicVector<double>>(*reference_context)
+                                  .get_value(),
+                              1e-10));
+}
+
 }  // namespace
 }  // namespace manipulation_station
 }  // namespace examples
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <limits>
+
 #include <benchmark/benchmark.h>
 
 #include "drake/common/find_resource.h"
@@ -6,12 +9,18 @@
 #include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/parsing/parser.h"
 #include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/tools/performance/allocation_tracker.h"
 #include "drake/tools/performance/fixture_common.h"
 
+using drake::math::RigidTransformd;
 using drake::multibody::MultibodyPlant;
 using drake::symbolic::Expression;
 using drake::systems::Context;
+using drake::systems::Diagram;
+using drake::systems::DiscreteValues;
 using drake::test::LimitMalloc;
+using drake::tools::performance::AllocationTracker;
 
 using Eigen::MatrixXd;
 using Eigen::VectorXd;
@@ -35,39 +44,6 @@ drake::test::LimitMallocParams LimitReleaseOnly(int max_num_allocations) {
   return { .max_num_allocations = max_num_allocations };
 }
 
-// Track and report simple streaming statistics on allocations. Variance
-// tracking is adapted from:
-// https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Welford's_online_algorithm
-class AllocationTracker {
- public:
-  AllocationTracker() {}
-
-  void Report(benchmark::State* state) {
-    state->counters["Allocs.min"] = min_;
-    state->counters["Allocs.max"] = max_;
-    state->counters["Allocs.mean"] = mean_;
-    state->counters["Allocs.stddev"] =
-        updates_ < 2 ? std::numeric_limits<double>::quiet_NaN()
-                     : std::sqrt(m2_ / (updates_ - 1));
-  }
-
-  void Update(int allocs) {
-    min_ = std::min(min_, allocs);
-    max_ = std::max(max_, allocs);
-    ++updates_;
-    double delta = allocs - mean_;
-    mean_ += delta / updates_;
-    m2_ += delta * (allocs - mean_);
-  }
-
- private:
-  int min_{std::numeric_limits<int>::max()};
-  int max_{std::numeric_limits<int>::min()};
-  int updates_{};
-  double mean_{};
-  double m2_{};
-};
-
 // Fixture that holds a Cassie robot model in a MultibodyPlant<double>. The
 // class also holds a default context for the plant, and dimensions of its
 // state and inputs.
@@ -133,7 +109,7 @@ BENCHMARK_F(CassieDoubleFixture, DoubleMassMatrix)(benchmark::State& state) {
     LimitMalloc guard({.max_num_allocations = 0});
     InvalidateState();
     plant_->CalcMassMatrix(*context_, &M);
-    tracker_.Update(guard.num_allocations());
+    tracker_.Update(guard);
   }
   tracker_.Report(&state);
 }
@@ -148,7 +124,7 @@ BENCHMARK_F(CassieDoubleFixture, DoubleInverseDynamics)
     LimitMalloc guard({.max_num_allocations = 3});
     InvalidateState();
     plant_->CalcInverseDynamics(*context_, desired_vdot, external_forces);
-    tracker_.Update(guard.num_allocations());
+    tracker_.Update(guard);
   }
   tracker_.Report(&state);
 }
@@ -165,7 +141,7 @@ BENCHMARK_F(CassieDoubleFixture, DoubleForwardDynamics)
     InvalidateState();
     port_value.GetMutableData();  // Invalidates caching of inputs.
     plant_->CalcTimeDerivatives(*context_, derivatives.get());
-    tracker_.Update(guard.num_allocations());
+    tracker_.Update(guard);
   }
   tracker_.Report(&state);
 }
@@ -214,7 +190,7 @@ BENCHMARK_F(CassieAutodiffFixture, AutodiffMassMatrix)
 
     compute();
 
-    tracker_.Update(guard.num_allocations());
+    tracker_.Update(guard);
   }
 
   for (auto _ : state) {
@@ -252,7 +228,7 @@ BENCHMARK_F(CassieAutodiffFixture, AutodiffInverseDynamics)
 
     compute();
 
-    tracker_.Update(guard.num_allocations());
+    tracker_.Update(guard);
   }
 
   for (auto _ : state) {
@@ -291,7 +267,7 @@ BENCHMARK_F(CassieAutodiffFixture, AutodiffForwardDynamics)
 
     compute();
 
-    tracker_.Update(guard.num_allocations());
+    tracker_.Update(guard);
   }
 
   for (auto _ : state) {
@@ -361,6 +337,137 @@ BENCHMARK_F(CassieExpressionFixture, ExpressionForwardDynamics)
   }
 }
 
+// Fixture that holds a discrete (1 ms) Cassie model standing on a ground half
+// space, with its four contact points penetrating the ground by 1 mm, in a
+// Diagram with its SceneGraph. The class also holds the AutoDiffXd version of
+// that Diagram, to time the gradients of the discrete contact step with respect
+// to the state (q, v), as used by gradient-based trajectory optimization.
+class CassieContactFixture : public benchmark::Fixture {
+ public:
+  CassieContactFixture() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State&) override {
+    systems::DiagramBuilder<double> builder;
+    auto items = multibody::AddMultibodyPlantSceneGraph(&builder, 1e-3);
+    plant_ = &items.plant;
+    multibody::Parser parser(plant_);
+    const auto& model =
+        "drake/examples/multibody/cassie_benchmark/cassie_v2.urdf";
+    parser.AddModelFromFile(FindResourceOrThrow(model));
+    plant_->RegisterCollisionGeometry(
+        plant_->world_body(), RigidTransformd(), geometry::HalfSpace(),
+        "ground", multibody::CoulombFriction<double>(1.0, 1.0));
+    plant_->Finalize();
+    diagram_ = builder.Build();
+
+    context_ = diagram_->CreateDefaultContext();
+    plant_context_ = &plant_->GetMyMutableContextFromRoot(context_.get());
+    plant_->get_actuation_input_port().FixValue(
+        plant_context_, VectorXd::Zero(plant_->num_actuators()));
+
+    // Lower the pelvis, from its default pose, so that the lowest contact
+    // point penetrates the ground by 1 mm.
+    const auto& inspector = items.scene_graph.model_inspector();
+    double min_height = std::numeric_limits<double>::infinity();
+    for (multibody::BodyIndex i(1); i < plant_->num_bodies(); ++i) {
+      const multibody::Body<double>& body = plant_->get_body(i);
+      for (const geometry::GeometryId id :
+           plant_->GetCollisionGeometriesForBody(body)) {
+        const double radius =
+            dynamic_cast<const geometry::Sphere&>(inspector.GetShape(id))
+                .radius();
+        const RigidTransformd X_WG =
+            plant_->EvalBodyPoseInWorld(*plant_context_, body) *
+            inspector.GetPoseInFrame(id);
+        min_height = std::min(min_height, X_WG.translation().z() - radius);
+      }
+    }
+    const multibody::Body<double>& pelvis = plant_->GetBodyByName("pelvis");
+    RigidTransformd X_WP = plant_->EvalBodyPoseInWorld(*plant_context_, pelvis);
+    X_WP.set_translation(X_WP.translation() -
+                         Eigen::Vector3d(0, 0, min_height + 1e-3));
+    plant_->SetFreeBodyPose(plant_context_, pelvis, X_WP);
+    x_ = plant_->GetPositionsAndVelocities(*plant_context_);
+    updates_ = plant_->AllocateDiscreteVariables();
+
+    diagram_autodiff_ = systems::System<double>::ToAutoDiffXd(*diagram_);
+    plant_autodiff_ = &dynamic_cast<const MultibodyPlant<AutoDiffXd>&>(
+        diagram_autodiff_->GetSubsystemByName(plant_->get_name()));
+    context_autodiff_ = diagram_autodiff_->CreateDefaultContext();
+    plant_context_autodiff_ =
+        &plant_autodiff_->GetMyMutableContextFromRoot(context_autodiff_.get());
+    plant_autodiff_->get_actuation_input_port().FixValue(
+        plant_context_autodiff_,
+        VectorX<AutoDiffXd>::Zero(plant_->num_actuators()));
+    updates_autodiff_ = plant_autodiff_->AllocateDiscreteVariables();
+  }
+
+ protected:
+  AllocationTracker tracker_;
+  MultibodyPlant<double>* plant_{};
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> context_;
+  Context<double>* plant_context_{};
+  std::unique_ptr<DiscreteValues<double>> updates_;
+  const MultibodyPlant<AutoDiffXd>* plant_autodiff_{};
+  std::unique_ptr<Diagram<AutoDiffXd>> diagram_autodiff_;
+  std::unique_ptr<Context<AutoDiffXd>> context_autodiff_;
+  Context<AutoDiffXd>* plant_context_autodiff_{};
+  std::unique_ptr<DiscreteValues<AutoDiffXd>> updates_autodiff_;
+  VectorXd x_{};
+};
+
+// Setting the state, in each step, invalidates all of the state-dependent
+// computations, including the geometry queries.
+BENCHMARK_F(CassieContactFixture, DoubleContactStep)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  for (auto _ : state) {
+    // @see LimitMalloc note above. No limit has been established yet; the
+    // guard only observes the allocations.
+    LimitMalloc guard(test::LimitMallocParams{});
+    plant_->SetPositionsAndVelocities(plant_context_, x_);
+    plant_->CalcDiscreteVariableUpdates(*plant_context_, updates_.get());
+    tracker_.Update(guard);
+  }
+  tracker_.Report(&state);
+}
+
+// The gradients are with respect to the full state x = (q, v).
+BENCHMARK_F(CassieContactFixture, AutodiffContactStep)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  const VectorX<AutoDiffXd> x_autodiff = math::InitializeAutoDiff(x_);
+
+  auto compute = [&]() {
+    plant_autodiff_->SetPositionsAndVelocities(plant_context_autodiff_,
+                                               x_autodiff);
+    plant_autodiff_->CalcDiscreteVariableUpdates(*plant_context_autodiff_,
+                                                 updates_autodiff_.get());
+  };
+
+  // The first iteration allocates more memory than subsequent runs.
+  compute();
+
+  for (int k = 0; k < 3; k++) {
+    // @see LimitMalloc note above. No limit has been established yet; the
+    // guard only observes the allocations.
+    LimitMalloc guard(test::LimitMallocParams{});
+
+    compute();
+
+    tracker_.Update(guard);
+  }
+
+  for (auto _ : state) {
+    compute();
+  }
+  tracker_.Report(&state);
+}
+
 }  // namespace
 }  // namespace examples
 }  // namespace drake
@@ -0,0 +1,140 @@
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/contact_surface_utility.h"
+#include "drake/geometry/proximity/field_intersection.h"
+#include "drake/geometry/proximity/make_ellipsoid_field.h"
+#include "drake/geometry/proximity/make_ellipsoid_mesh.h"
+#include "drake/geometry/proximity/make_sphere_field.h"
+#include "drake/geometry/proximity/make_sphere_mesh.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* @defgroup field_intersection_benchmarks Field Intersection Benchmarks
+ @ingroup proximity_queries
+
+ The benchmark evaluates the contact surface between two compliant meshes,
+ i.e., the intersection of two tetrahedral meshes with pressure fields
+ (IntersectFields()). It is the compliant-compliant counterpart of
+ @ref mesh_intersection_benchmarks, and it uses the same ellipsoid and sphere
+ (now both compliant) and the same arguments:
+ - __resolution__: An enumeration in the integer range from 0 to 3 that guides
+   the level of mesh refinement, where 0 produces the coarsest meshes and 3
+   produces the finest meshes.
+ - __contact overlap__: An enumeration in the integer range from 0 to 4 that
+   correlates with the size of the resultant contact surface between the two
+   meshes, where 0 produces the least contact and 4 produces the most contact.
+ - __rotation factor__: An enumeration in the integer range from 0 to 3 that
+   affects how much the meshes are in axis alignment, where 0 is aligned and
+   3 is maximally misaligned.
+
+ Each result reports two counters: `candidates`, the number of tetrahedron
+ pairs that survive the broad phase, and `faces`, the number of polygons in
+ the resulting contact surface. Most candidates produce no polygon; the
+ difference between the two is the work that the per-pair rejection tests in
+ IntersectTetrahedra() try to make cheap.
+
+ <h2>Running the benchmark</h2>
+
+ ```
+ bazel run //geometry/benchmarking:field_intersection_benchmark
+ ```
+ */
+
+using Eigen::AngleAxis;
+using Eigen::Vector3d;
+using math::RigidTransformd;
+
+const double kElasticModulus = 1.0e5;
+const double kMaxRotationFactor = 3.;
+const double kSphereDimension = 3.;
+const Vector3d kEllipsoidDimension{3.01, 3.5, 4.};
+const double kResolutionHint[4] = {4., 3., 2., 1.};
+const Vector3d kContactOverlapTranslation[5] = {
+    Vector3d{7, 7, 7},        // 0: No overlap at all.
+    Vector3d{4, 4, 4},        // 1: Overlapping bounding volumes.
+    Vector3d{3.5, 3.5, 3.5},  // 2: Minimal contact surface.
+    Vector3d{1.2, 1.2, 1.2},  // 3: Intermediate sized contact surface.
+    Vector3d{0, 0, 0}};       // 4: Maximal contact surface.
+
+class FieldIntersectionBenchmark : public benchmark::Fixture {
+ public:
+  FieldIntersectionBenchmark()
+      : ellipsoid_{kEllipsoidDimension[0], kEllipsoidDimension[1],
+                   kEllipsoidDimension[2]},
+        sphere_{kSphereDimension} {}
+
+  /* Set up the two compliant meshes and their relative transform.  */
+  void SetupMeshes(const benchmark::State& state) {
+    const double resolution_hint = kResolutionHint[state.range(0)];
+    mesh_E_ = std::make_unique<VolumeMesh<double>>(
+        MakeEllipsoidVolumeMesh<double>(
+            ellipsoid_, resolution_hint,
+            TessellationStrategy::kDenseInteriorVertices));
+    field_E_ = std::make_unique<VolumeMeshFieldLinear<double, double>>(
+        MakeEllipsoidPressureField<double>(ellipsoid_, mesh_E_.get(),
+                                           kElasticModulus));
+    mesh_S_ = std::make_unique<VolumeMesh<double>>(
+        MakeSphereVolumeMesh<double>(
+            sphere_, resolution_hint,
+            TessellationStrategy::kDenseInteriorVertices));
+    field_S_ = std::make_unique<VolumeMeshFieldLinear<double, double>>(
+        MakeSpherePressureField<double>(sphere_, mesh_S_.get(),
+                                        kElasticModulus));
+    X_ES_ = RigidTransformd{
+        AngleAxis(state.range(2) / kMaxRotationFactor * M_PI / 4,
+                  Vector3d{1, 1, 1}.normalized()),
+        kContactOverlapTranslation[state.range(1)]};
+  }
+
+  Ellipsoid ellipsoid_;
+  Sphere sphere_;
+  std::unique_ptr<VolumeMesh<double>> mesh_E_;
+  std::unique_ptr<VolumeMeshFieldLinear<double, double>> field_E_;
+  std::unique_ptr<VolumeMesh<double>> mesh_S_;
+  std::unique_ptr<VolumeMeshFieldLinear<double, double>> field_S_;
+  RigidTransformd X_ES_;
+};
+
+BENCHMARK_DEFINE_F(FieldIntersectionBenchmark, SoftSoftMesh)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  SetupMeshes(state);
+  const auto bvh_E = Bvh<Obb, VolumeMesh<double>>(*mesh_E_);
+  const auto bvh_S = Bvh<Obb, VolumeMesh<double>>(*mesh_S_);
+  std::unique_ptr<PolygonSurfaceMesh<double>> surface_ES;
+  std::unique_ptr<PolygonSurfaceMeshFieldLinear<double, double>> e_ES;
+  std::vector<Vector3d> grad_eE_Es;
+  std::vector<Vector3d> grad_eS_Es;
+  for (auto _ : state) {
+    IntersectFields<PolygonSurfaceMesh<double>, PolyMeshBuilder<double>>(
+        *field_E_, bvh_E, *field_S_, bvh_S, X_ES_, &surface_ES, &e_ES,
+        &grad_eE_Es, &grad_eS_Es);
+  }
+
+  int num_candidates = 0;
+  bvh_E.Collide(bvh_S, X_ES_, [&num_candidates](int, int) {
+    ++num_candidates;
+    return BvttCallbackResult::Continue;
+  });
+  state.counters["candidates"] = num_candidates;
+  state.counters["faces"] =
+      surface_ES == nullptr ? 0 : surface_ES->num_elements();
+}
+BENCHMARK_REGISTER_F(FieldIntersectionBenchmark, SoftSoftMesh)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({{0, 1, 2},     // resolution.
+                   {1, 2, 3, 4},  // contact overlap.
+                   {0, 3}});      // rotation factor.
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
+
+BENCHMARK_MAIN();
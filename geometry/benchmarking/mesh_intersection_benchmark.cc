@@ -1,6 +1,7 @@
 #include "fmt/format.h"
 #include <benchmark/benchmark.h>
 
+#include "drake/geometry/proximity/bvh.h"
 #include "drake/geometry/proximity/make_ellipsoid_field.h"
 #include "drake/geometry/proximity/make_ellipsoid_mesh.h"
 #include "drake/geometry/proximity/make_sphere_mesh.h"
@@ -18,6 +19,9 @@ namespace internal {
 
  It computes the contact surface formed from the intersection of an ellipsoid
  and a sphere using broad-phase culling (via a bounding volume hierarchy).
+ A second benchmark, BvhCollide, times the broad-phase culling of the same
+ configurations in isolation, comparing the one-pair-at-a-time traversal
+ Bvh::Collide() with the SIMD-batched Bvh::CollideBatched().
  Arguments include:
  - __resolution__: An enumeration in the integer range from 0 to 3 that guides
    the level of mesh refinement, where 0 produces the coarsest meshes and 3
@@ -32,6 +36,8 @@ namespace internal {
    3 is maximally misaligned. The given scalar is used as a multiplicative
    factor of PI/4 and applied such that the sphere is rotated relative to the
    ellipsoid.
+ - __batched__ (BvhCollide only): 0 for Bvh::Collide(), 1 for
+   Bvh::CollideBatched().
 
  For more details on arguments, see <b>Interpreting the benchmark</b> below.
 
@@ -102,7 +108,7 @@ Resulting contact surface sizes:
  MeshIntersectionBenchmark/TestName/resolution/contact_overlap/rotation_factor/min_time
  ```
 
-   - __TestName__: RigidSoftMesh
+   - __TestName__: RigidSoftMesh or BvhCollide
    - __resolution__: Affects the resolution of the ellipsoid and sphere
      meshes. Valid values must be one of [0, 1, 2, 3], where 0 produces the
      coarsest meshes and 3 produces the finest meshes. This is converted behind
@@ -126,6 +132,10 @@ Resulting contact surface sizes:
      [0, 1, 2, 3]. Note: we use this integer factor instead of directly
      specifying the rotation because Google Benchmark does not accept doubles
      as arguments.
+   - __batched__: For BvhCollide, whether the bounding volume tests are
+     batched (1) or are performed one node pair at a time (0). Both report the
+     same `candidates` counter, the number of element pairs that survive
+     culling.
    - __min_time__: Minimum amount of time to run the benchmark in seconds. This
      needs to be specified for tests that run long in order to get enough
      iterations.
@@ -261,6 +271,36 @@ BENCHMARK_REGISTER_F(MeshIntersectionBenchmark, RigidSoftMesh)
     ->Args({2, 3, 1})   // 2 resolution, 3 contact overlap, 1 rotation factor.
     ->Args({2, 2, 2});  // 2 resolution, 2 contact overlap, 2 rotation factor.
 
+BENCHMARK_DEFINE_F(MeshIntersectionBenchmark, BvhCollide)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  SetupMeshes(state);
+  const bool batched = state.range(3) != 0;
+  const auto bvh_S = Bvh<Obb, VolumeMesh<double>>(mesh_S_);
+  const auto bvh_R = Bvh<Obb, TriangleSurfaceMesh<double>>(mesh_R_);
+  int num_candidates = 0;
+  auto callback = [&num_candidates](int, int) {
+    ++num_candidates;
+    return BvttCallbackResult::Continue;
+  };
+  for (auto _ : state) {
+    num_candidates = 0;
+    if (batched) {
+      bvh_S.CollideBatched(bvh_R, X_SR_, callback);
+    } else {
+      bvh_S.Collide(bvh_R, X_SR_, callback);
+    }
+    benchmark::DoNotOptimize(num_candidates);
+  }
+  state.counters["candidates"] = num_candidates;
+}
+BENCHMARK_REGISTER_F(MeshIntersectionBenchmark, BvhCollide)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgsProduct({{1, 2, 3},  // resolution.
+                   {1, 3, 4},  // contact overlap.
+                   {0, 3},     // rotation factor.
+                   {0, 1}});   // batched.
+
 void ReportContactSurfaces() {
   std::cout << "Resulting contact surface sizes:" << std::endl;
   for (const auto& output :
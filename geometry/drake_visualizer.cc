@@ -364,6 +364,7 @@ EventStatus DrakeVisualizer<T>::SendGeometryMessage(
     if (!version_.IsSameAs(current_version, params_.role)) {
       send_load_message = true;
       version_ = current_version;
+      sent_poses_.clear();
     }
   }
   if (send_load_message) {
@@ -372,8 +373,15 @@ EventStatus DrakeVisualizer<T>::SendGeometryMessage(
                     ExtractDoubleOrThrow(context.get_time()), lcm_);
   }
 
-  SendDrawMessage(query_object, EvalDynamicFrameData(context),
-                  ExtractDoubleOrThrow(context.get_time()), lcm_);
+  if (params_.publish_changed_poses_only) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SendDrawMessage(query_object, EvalDynamicFrameData(context),
+                    ExtractDoubleOrThrow(context.get_time()), lcm_,
+                    &sent_poses_);
+  } else {
+    SendDrawMessage(query_object, EvalDynamicFrameData(context),
+                    ExtractDoubleOrThrow(context.get_time()), lcm_);
+  }
 
   return EventStatus::Succeeded();
 }
@@ -462,10 +470,36 @@ template <typename T>
 void DrakeVisualizer<T>::SendDrawMessage(
     const QueryObject<T>& query_object,
     const vector<internal::DynamicFrameData>& dynamic_frames, double time,
-    lcm::DrakeLcmInterface* lcm) {
+    lcm::DrakeLcmInterface* lcm, vector<math::RigidTransformd>* sent_poses) {
   lcmt_viewer_draw message{};
 
-  const int frame_count = static_cast<int>(dynamic_frames.size());
+  // The indices of the dynamic frames to send, and their poses.
+  vector<int> frames;
+  vector<math::RigidTransformd> poses;
+  frames.reserve(dynamic_frames.size());
+  poses.reserve(dynamic_frames.size());
+  for (int i = 0; i < static_cast<int>(dynamic_frames.size()); ++i) {
+    frames.push_back(i);
+    poses.push_back(internal::convert_to_double(
+        query_object.GetPoseInWorld(dynamic_frames[i].frame_id)));
+  }
+  if (sent_poses != nullptr) {
+    // Without the poses of the previous draw message, every frame is sent.
+    if (sent_poses->size() == poses.size()) {
+      int kept = 0;
+      for (int i : frames) {
+        if (!(*sent_poses)[i].IsExactlyEqualTo(poses[i])) {
+          (*sent_poses)[i] = poses[i];
+          frames[kept++] = i;
+        }
+      }
+      frames.resize(kept);
+    } else {
+      *sent_poses = poses;
+    }
+  }
+
+  const int frame_count = static_cast<int>(frames.size());
 
   message.timestamp = static_cast<int64_t>(time * 1000.0);
   message.num_links = frame_count;
@@ -476,12 +510,11 @@ void DrakeVisualizer<T>::SendDrawMessage(
 
   const SceneGraphInspector<T>& inspector = query_object.inspector();
   for (int i = 0; i < frame_count; ++i) {
-    const FrameId frame_id = dynamic_frames[i].frame_id;
+    const FrameId frame_id = dynamic_frames[frames[i]].frame_id;
     message.robot_num[i] = inspector.GetFrameGroup(frame_id);
-    message.link_name[i] = dynamic_frames[i].name;
+    message.link_name[i] = dynamic_frames[frames[i]].name;
 
-    const math::RigidTransformd& X_WF =
-        internal::convert_to_double(query_object.GetPoseInWorld(frame_id));
+    const math::RigidTransformd& X_WF = poses[frames[i]];
     message.position[i].resize(3);
     message.position[i][0] = X_WF.translation()[0];
     message.position[i][1] = X_WF.translation()[1];
@@ -11,6 +11,7 @@
 #include "drake/geometry/geometry_version.h"
 #include "drake/geometry/query_object.h"
 #include "drake/lcm/drake_lcm_interface.h"
+#include "drake/math/rigid_transform.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/framework/event_status.h"
 #include "drake/systems/framework/input_port.h"
@@ -219,11 +220,15 @@ class DrakeVisualizer final : public systems::LeafSystem<T> {
       double time, lcm::DrakeLcmInterface* lcm);
 
   /* Dispatches a "draw" message for geometry that is known to have been
-   loaded.  */
+   loaded. If `sent_poses` is not null, it holds the poses of the dynamic frames
+   in the previous draw message (or is empty if there was none since the last
+   load message); the message then omits the frames whose poses haven't
+   changed, and `sent_poses` is updated.  */
   static void SendDrawMessage(
       const QueryObject<T>& query_object,
       const std::vector<internal::DynamicFrameData>& dynamic_frames,
-      double time, lcm::DrakeLcmInterface* lcm);
+      double time, lcm::DrakeLcmInterface* lcm,
+      std::vector<math::RigidTransformd>* sent_poses = nullptr);
 
   /* Identifies all of the frames with dynamic data and stores them (with
    additional data) in the given vector `frame_data`.  */
@@ -266,6 +271,11 @@ class DrakeVisualizer final : public systems::LeafSystem<T> {
   mutable GeometryVersion version_;
   mutable std::mutex mutex_;
 
+  /* The poses of the dynamic frames in the last draw message since the last
+   load message; only used when params_.publish_changed_poses_only is set.
+   Guarded by mutex_.  */
+  mutable std::vector<math::RigidTransformd> sent_poses_;
+
   /* The index of this System's QueryObject-valued input port.  */
   int query_object_input_port_{};
 
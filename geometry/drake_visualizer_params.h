@@ -35,6 +35,16 @@ struct DrakeVisualizerParams {
    none of the collision meshes have a hydroelastic mesh associated with them.
    */
   bool show_hydroelastic{false};
+
+  /** When `true`, a draw message only includes the frames whose poses have
+   changed since the previous draw message; the first draw message after each
+   load message still includes every frame. This reduces the broadcast traffic
+   for scenes in which most frames are static. It relies on the visualizer
+   treating a draw message as an update to the poses it lists, and keeping the
+   last pose of every other frame (as `meldis` and `drake_visualizer` do). A
+   visualizer that starts listening after the first draw message won't learn
+   the poses of the frames that don't move.  */
+  bool publish_changed_poses_only{false};
 };
 
 }  // namespace geometry
@@ -27,8 +27,9 @@ FrameKinematicsVector<KinematicsValue>::FrameKinematicsVector() {
 template <typename KinematicsValue>
 FrameKinematicsVector<KinematicsValue>::FrameKinematicsVector(
     std::initializer_list<std::pair<const FrameId, KinematicsValue>> init) {
-  values_.insert(init.begin(), init.end());
-  size_ = init.size();
+  for (const auto& item : init) {
+    set_value(item.first, item.second);
+  }
   DRAKE_ASSERT_VOID(CheckInvariants());
 }
 
@@ -36,9 +37,7 @@ template <typename KinematicsValue>
 FrameKinematicsVector<KinematicsValue>&
 FrameKinematicsVector<KinematicsValue>::operator=(
     std::initializer_list<std::pair<const FrameId, KinematicsValue>> init) {
-  // N.B. We can't use unordered_map::insert in our operator= implementation
-  // because it does not overwrite pre-existing keys.  (Our clear() doesn't
-  // remove the keys, it only nulls the values.)
+  // N.B. Our clear() doesn't remove the ids, it only nulls the values.
   clear();
   for (const auto& item : init) {
     set_value(item.first, item.second);
@@ -49,38 +48,62 @@ FrameKinematicsVector<KinematicsValue>::operator=(
 
 template <typename KinematicsValue>
 void FrameKinematicsVector<KinematicsValue>::clear() {
-  for (auto& item : values_) {
-    item.second = std::nullopt;
+  for (auto& value : values_) {
+    value = std::nullopt;
   }
   size_ = 0;
+  next_slot_ = 0;
 }
 
 template <typename KinematicsValue>
 void FrameKinematicsVector<KinematicsValue>::set_value(
     FrameId id, const KinematicsValue& value) {
-  auto& map_value = values_[id];
-  if (!map_value.has_value()) { ++size_; }
-  map_value = value;
+  int slot = next_slot_;
+  if (slot >= static_cast<int>(ids_.size()) || ids_[slot] != id) {
+    const auto [iter, inserted] =
+        slots_.emplace(id, static_cast<int>(ids_.size()));
+    if (inserted) {
+      ids_.push_back(id);
+      values_.emplace_back();
+    }
+    slot = iter->second;
+  }
+  next_slot_ = slot + 1;
+  std::optional<KinematicsValue>& slot_value = values_[slot];
+  if (!slot_value.has_value()) { ++size_; }
+  slot_value = value;
 }
 
 template <typename KinematicsValue>
 const KinematicsValue& FrameKinematicsVector<KinematicsValue>::value(
     FrameId id) const {
   using std::to_string;
-  auto iter = values_.find(id);
-  if (iter != values_.end()) {
-    const std::optional<KinematicsValue>& map_value = iter->second;
-    if (map_value.has_value()) {
-      return *map_value;
-    }
+  int slot_hint = -1;
+  const KinematicsValue* result = FindValue(id, &slot_hint);
+  if (result == nullptr) {
+    throw std::runtime_error("No such FrameId " + to_string(id) + ".");
   }
-  throw std::runtime_error("No such FrameId " + to_string(id) + ".");
+  return *result;
 }
 
 template <typename KinematicsValue>
 bool FrameKinematicsVector<KinematicsValue>::has_id(FrameId id) const {
-  auto iter = values_.find(id);
-  return (iter != values_.end()) && iter->second.has_value();
+  int slot_hint = -1;
+  return FindValue(id, &slot_hint) != nullptr;
+}
+
+template <typename KinematicsValue>
+const KinematicsValue* FrameKinematicsVector<KinematicsValue>::FindValue(
+    FrameId id, int* slot_hint) const {
+  DRAKE_ASSERT(slot_hint != nullptr);
+  int slot = *slot_hint;
+  if (slot < 0 || slot >= static_cast<int>(ids_.size()) || ids_[slot] != id) {
+    const auto iter = slots_.find(id);
+    slot = (iter != slots_.end()) ? iter->second : -1;
+    *slot_hint = slot;
+  }
+  if (slot < 0 || !values_[slot].has_value()) return nullptr;
+  return &*values_[slot];
 }
 
 template <typename KinematicsValue>
@@ -88,9 +111,9 @@ std::vector<FrameId>
 FrameKinematicsVector<KinematicsValue>::frame_ids() const {
   std::vector<FrameId> result;
   result.reserve(size_);
-  for (const auto& item : values_) {
-    if (item.second.has_value()) {
-      result.emplace_back(item.first);
+  for (size_t i = 0; i < ids_.size(); ++i) {
+    if (values_[i].has_value()) {
+      result.emplace_back(ids_[i]);
     }
   }
   DRAKE_ASSERT(static_cast<int>(result.size()) == size_);
@@ -100,12 +123,14 @@ FrameKinematicsVector<KinematicsValue>::frame_ids() const {
 template <typename KinematicsValue>
 void FrameKinematicsVector<KinematicsValue>::CheckInvariants() const {
   int num_nonnull = 0;
-  for (const auto& item : values_) {
-    if (item.second.has_value()) {
+  for (const auto& value : values_) {
+    if (value.has_value()) {
       ++num_nonnull;
     }
   }
   DRAKE_DEMAND(num_nonnull == size_);
+  DRAKE_DEMAND(ids_.size() == values_.size());
+  DRAKE_DEMAND(slots_.size() == ids_.size());
 }
 
 // Explicitly instantiates on the most common scalar types.
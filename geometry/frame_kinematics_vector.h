@@ -126,6 +126,19 @@ class FrameKinematicsVector {
   /** Reports true if the given id is a member of this data. */
   bool has_id(FrameId id) const;
 
+  /** (Advanced) Returns a pointer to the value associated with the given `id`,
+   or nullptr if `id` is not a member of this data.
+
+   The values are stored contiguously, in the order in which their ids were
+   first set. `slot_hint` is an in-out guess of the position of `id` in that
+   storage: if it is right, the look up doesn't hash `id`; otherwise, it is
+   updated to the correct position (or -1 if `id` is absent). A consumer that
+   keeps one hint per frame, e.g., SceneGraph, pays for hashing only the first
+   time it reads a vector whose producer sets the same frames after every
+   clear().
+   @pre slot_hint != nullptr.  */
+  const KinematicsValue* FindValue(FrameId id, int* slot_hint) const;
+
   /** Provides a range object for all of the frame ids in the vector.
    This is intended to be used as:
    @code
@@ -141,15 +154,20 @@ class FrameKinematicsVector {
  private:
   void CheckInvariants() const;
 
-  // Mapping from frame id to its current pose.  If the map's optional value is
-  // nullopt, we treat it as if the map key were absent instead.  We do this in
-  // order to avoid reallocating map nodes as we repeatedly clear() and then
-  // re-set_value() the same IDs over and over again.
-  // TODO(jwnimmer-tri) A better way to avoid map node allocations would be to
-  // replace this unordered_map with a flat_hash_map (where the entire storage
-  // is a single heap slab); in that case, the complicated implementation in
-  // the cc file would become simplified.
-  std::unordered_map<FrameId, std::optional<KinematicsValue>> values_;
+  // The ids and values of every frame ever set, in the order in which they
+  // were first set. If a value is nullopt, we treat it as if the id were
+  // absent instead. We do this in order to avoid reallocating storage as we
+  // repeatedly clear() and then re-set_value() the same IDs over and over
+  // again.
+  std::vector<FrameId> ids_;
+  std::vector<std::optional<KinematicsValue>> values_;
+
+  // Mapping from each frame id in ids_ to its position in ids_ and values_.
+  std::unordered_map<FrameId, int> slots_;
+
+  // The position at which set_value() expects the next id. Producers that set
+  // the same ids in the same order after every clear() never hash an id.
+  int next_slot_{0};
 
   // The count of non-nullopt items in values_.  We could recompute this from
   // values_, but we store it separately so that size() is still constant-time.
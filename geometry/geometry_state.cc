@@ -4,13 +4,16 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include <fmt/format.h>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
+#include "drake/common/drake_bool.h"
 #include "drake/common/extract_double.h"
+#include "drake/common/scope_exit.h"
 #include "drake/common/text_logging.h"
 #include "drake/geometry/geometry_frame.h"
 #include "drake/geometry/geometry_instance.h"
@@ -113,6 +116,20 @@ std::string get_missing_id_message<GeometryId>(const GeometryId& key) {
   return ss.str();
 }
 
+// Reports true if the two poses have different values. Only the values matter
+// to the render engines (derivatives are discarded), and symbolic poses are
+// always reported as different.
+template <typename T>
+bool PoseValueChanged(const RigidTransform<T>& X_old,
+                      const RigidTransform<T>& X_new) {
+  if constexpr (scalar_predicate<T>::is_bool) {
+    return !convert_to_double(X_old).IsExactlyEqualTo(
+        convert_to_double(X_new));
+  } else {
+    return true;
+  }
+}
+
 //-----------------------------------------------------------------------------
 
 template <typename T>
@@ -129,6 +146,7 @@ GeometryState<T>::GeometryState()
   frame_index_to_id_map_.push_back(world);
   X_WF_.push_back(RigidTransform<T>::Identity());
   X_PF_.push_back(RigidTransform<T>::Identity());
+  X_WF_is_stale_.push_back(false);
 
   source_frame_id_map_[self_source_] = {world};
   source_root_frame_map_[self_source_] = {world};
@@ -537,6 +555,7 @@ SourceId GeometryState<T>::RegisterNewSource(const std::string& name) {
   source_frame_id_map_[source_id];
   source_root_frame_map_[source_id];
   source_anchored_geometry_map_[source_id];
+  pose_update_plan_stale_ = true;
   source_names_[source_id] = final_name;
   return source_id;
 }
@@ -574,6 +593,8 @@ FrameId GeometryState<T>::RegisterFrame(SourceId source_id, FrameId parent_id,
   int index(static_cast<int>(X_PF_.size()));
   X_PF_.emplace_back(RigidTransform<T>::Identity());
   X_WF_.emplace_back(RigidTransform<T>::Identity());
+  X_WF_is_stale_.push_back(true);
+  pose_update_plan_stale_ = true;
   frame_index_to_id_map_.push_back(frame_id);
   f_set.insert(frame_id);
   frames_.emplace(frame_id, InternalFrame(source_id, frame_id, frame.name(),
@@ -623,6 +644,7 @@ GeometryId GeometryState<T>::RegisterGeometry(
 
   InternalFrame& frame = frames_[frame_id];
   frame.add_child(geometry_id);
+  pose_update_plan_stale_ = true;
 
   // pose() is always RigidTransform<double>. To account for
   // GeometryState<AutoDiff>, we need to cast it to the common type T.
@@ -697,6 +719,29 @@ GeometryId GeometryState<T>::RegisterGeometryWithParent(
   return new_id;
 }
 
+template <typename T>
+std::vector<GeometryId> GeometryState<T>::RegisterGeometries(
+    SourceId source_id, const std::vector<FrameId>& frame_ids,
+    std::vector<std::unique_ptr<GeometryInstance>> geometries) {
+  if (frame_ids.size() != geometries.size()) {
+    throw std::logic_error(fmt::format(
+        "RegisterGeometries(): {} frame ids were given for {} geometries.",
+        frame_ids.size(), geometries.size()));
+  }
+  // Each geometry with a proximity role would otherwise refit the engine's
+  // broadphase trees over all of the geometries registered so far; refit them
+  // once at the end instead (even if a registration throws).
+  geometry_engine_->SuspendBroadphaseUpdates();
+  ScopeExit guard([this]() { geometry_engine_->ResumeBroadphaseUpdates(); });
+  std::vector<GeometryId> geometry_ids;
+  geometry_ids.reserve(geometries.size());
+  for (size_t i = 0; i < geometries.size(); ++i) {
+    geometry_ids.push_back(
+        RegisterGeometry(source_id, frame_ids[i], std::move(geometries[i])));
+  }
+  return geometry_ids;
+}
+
 template <typename T>
 GeometryId GeometryState<T>::RegisterAnchoredGeometry(
     SourceId source_id,
@@ -1067,13 +1112,107 @@ void GeometryState<T>::SetFramePoses(
     const SourceId source_id, const FramePoseVector<T>& poses) {
   // TODO(SeanCurtis-TRI): Down the road, make this validation depend on
   // ASSERT_ARMED.
-  ValidateFrameIds(source_id, poses);
-  const RigidTransform<T> world_pose = RigidTransform<T>::Identity();
-  for (auto frame_id : source_root_frame_map_[source_id]) {
-    UpdatePosesRecursively(frames_[frame_id], world_pose, poses);
+  if (pose_update_plan_stale_) RebuildPoseUpdatePlan();
+
+  // Confirm that `poses` has exactly the source's frames before changing
+  // anything. The look ups reuse the positions at which the previous update
+  // found each frame, so a producer that reports its frames in a fixed order
+  // costs no hashing. Otherwise, ValidateFrameIds() reports the error.
+  const auto order_iter = source_frame_orders_.find(source_id);
+  bool valid = order_iter != source_frame_orders_.end() &&
+               static_cast<int>(order_iter->second.size()) == poses.size();
+  if (valid) {
+    for (const int index : order_iter->second) {
+      if (poses.FindValue(frame_index_to_id_map_[index],
+                          &frame_pose_slots_[index]) == nullptr) {
+        valid = false;
+        break;
+      }
+    }
+  }
+  if (!valid) {
+    ValidateFrameIds(source_id, poses);
+    DRAKE_UNREACHABLE();
+  }
+
+  // Parents are visited before their children. A frame whose parent didn't
+  // move and whose own pose X_PF is unchanged keeps its (and its geometries')
+  // world poses.
+  for (const int index : order_iter->second) {
+    const int parent_index = frame_parent_indexes_[index];
+    const RigidTransform<T>& X_PF = *poses.FindValue(
+        frame_index_to_id_map_[index], &frame_pose_slots_[index]);
+    // Only double-valued poses can be skipped; for other scalars, the
+    // derivatives may have changed even if the values didn't.
+    bool moved = true;
+    if constexpr (std::is_same_v<T, double>) {
+      moved = frame_moved_[parent_index] || X_WF_is_stale_[index] ||
+              !X_PF_[index].IsExactlyEqualTo(X_PF);
+    }
+    frame_moved_[index] = moved;
+    if (!moved) continue;
+
+    X_PF_[index] = X_PF;
+    X_WF_[index] = X_WF_[parent_index] * X_PF;
+    X_WF_is_stale_[index] = false;
+    const RigidTransform<T>& X_WF = X_WF_[index];
+    // Update the geometry which belong to *this* frame.
+    for (int g = frame_geometry_offsets_[index];
+         g < frame_geometry_offsets_[index + 1]; ++g) {
+      // X_FG is always RigidTransform<double>, to account for
+      // GeometryState<AutoDiff>, we need to cast it to the common type T.
+      RigidTransform<T> X_WG = X_WF * dense_X_FGs_[g].template cast<T>();
+      const bool changed = PoseValueChanged(dense_X_WGs_[g], X_WG);
+      if (changed || !std::is_same_v<T, double>) {
+        const GeometryId geometry_id = dense_geometry_ids_[g];
+        if (changed) moved_geometry_ids_.insert(geometry_id);
+        X_WGs_[geometry_id] = X_WG;
+      }
+      dense_X_WGs_[g] = std::move(X_WG);
+    }
   }
 }
 
+template <typename T>
+void GeometryState<T>::RebuildPoseUpdatePlan() {
+  const int num_frames = static_cast<int>(frame_index_to_id_map_.size());
+  frame_parent_indexes_.resize(num_frames);
+  frame_geometry_offsets_.resize(num_frames + 1);
+  frame_moved_.assign(num_frames, false);
+  frame_pose_slots_.resize(num_frames, -1);
+  dense_geometry_ids_.clear();
+  dense_X_FGs_.clear();
+  dense_X_WGs_.clear();
+  for (int i = 0; i < num_frames; ++i) {
+    const InternalFrame& frame = frames_.at(frame_index_to_id_map_[i]);
+    frame_parent_indexes_[i] = frames_.at(frame.parent_frame_id()).index();
+    frame_geometry_offsets_[i] = static_cast<int>(dense_geometry_ids_.size());
+    for (GeometryId geometry_id : frame.child_geometries()) {
+      dense_geometry_ids_.push_back(geometry_id);
+      dense_X_FGs_.push_back(geometries_.at(geometry_id).X_FG());
+      dense_X_WGs_.push_back(X_WGs_.at(geometry_id));
+    }
+  }
+  frame_geometry_offsets_[num_frames] =
+      static_cast<int>(dense_geometry_ids_.size());
+
+  // Order each source's frames breadth first from its root frames.
+  source_frame_orders_.clear();
+  for (const auto& [source_id, root_frame_ids] : source_root_frame_map_) {
+    std::vector<int>& order = source_frame_orders_[source_id];
+    for (FrameId frame_id : root_frame_ids) {
+      order.push_back(frames_.at(frame_id).index());
+    }
+    for (size_t k = 0; k < order.size(); ++k) {
+      const InternalFrame& frame = frames_.at(frame_index_to_id_map_[order[k]]);
+      for (FrameId child_id : frame.child_frames()) {
+        order.push_back(frames_.at(child_id).index());
+      }
+    }
+  }
+  pose_update_plan_stale_ = false;
+}
+
 template <typename T>
 template <typename ValueType>
 void GeometryState<T>::ValidateFrameIds(
@@ -1101,10 +1240,11 @@ void GeometryState<T>::ValidateFrameIds(
 
 template <typename T>
 void GeometryState<T>::FinalizePoseUpdate() {
-  geometry_engine_->UpdateWorldPoses(X_WGs_);
+  geometry_engine_->UpdateWorldPoses(X_WGs_, moved_geometry_ids_);
   for (auto& pair : render_engines_) {
-    pair.second->UpdatePoses(X_WGs_);
+    pair.second->UpdatePoses(X_WGs_, moved_geometry_ids_);
   }
+  moved_geometry_ids_.clear();
 }
 
 template <typename T>
@@ -1160,37 +1300,13 @@ void GeometryState<T>::RemoveGeometryUnchecked(GeometryId geometry_id,
 
   // Clean up state collections.
   X_WGs_.erase(geometry_id);
+  moved_geometry_ids_.erase(geometry_id);
+  pose_update_plan_stale_ = true;
 
   // Remove from the geometries.
   geometries_.erase(geometry_id);
 }
 
-template <typename T>
-void GeometryState<T>::UpdatePosesRecursively(
-    const internal::InternalFrame& frame, const RigidTransform<T>& X_WP,
-    const FramePoseVector<T>& poses) {
-  const auto frame_id = frame.id();
-  const auto& X_PF = poses.value(frame_id);
-  // Cache this transform for later use.
-  X_PF_[frame.index()] = X_PF;
-  RigidTransform<T> X_WF = X_WP * X_PF;
-  X_WF_[frame.index()] = X_WF;
-  // Update the geometry which belong to *this* frame.
-  for (auto child_id : frame.child_geometries()) {
-    auto& child_geometry = geometries_[child_id];
-    // X_FG() is always RigidTransform<double>, to account for
-    // GeometryState<AutoDiff>, we need to cast it to the common type T.
-    RigidTransform<double> X_FG(child_geometry.X_FG());
-    X_WGs_[child_id] = X_WF * X_FG.cast<T>();
-  }
-
-  // Update each child frame.
-  for (auto child_id : frame.child_frames()) {
-    auto& child_frame = frames_[child_id];
-    UpdatePosesRecursively(child_frame, X_WF, poses);
-  }
-}
-
 template <typename T>
 const InternalGeometry* GeometryState<T>::GetGeometry(GeometryId id) const {
   const auto& iterator = geometries_.find(id);
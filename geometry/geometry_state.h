@@ -12,6 +12,7 @@
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/geometry/collision_filter_manager.h"
 #include "drake/geometry/frame_kinematics_vector.h"
 #include "drake/geometry/geometry_ids.h"
@@ -304,6 +305,11 @@ class GeometryState {
       SourceId source_id, GeometryId parent_id,
       std::unique_ptr<GeometryInstance> geometry);
 
+  /** Implementation of SceneGraph::RegisterGeometries().  */
+  std::vector<GeometryId> RegisterGeometries(
+      SourceId source_id, const std::vector<FrameId>& frame_ids,
+      std::vector<std::unique_ptr<GeometryInstance>> geometries);
+
   // TODO(SeanCurtis-TRI): Consider deprecating this; it's now strictly a
   // wrapper for the more general `RegisterGeometry()`.
   /** Implementation of SceneGraph::RegisterAnchoredGeometry().  */
@@ -397,6 +403,17 @@ class GeometryState {
    See @ref collision_queries "Collision Queries" for more details.  */
   //@{
 
+  /** Sets the degree of parallelism used by the proximity engine for the
+   queries that support it. See SceneGraphConfig::proximity_num_threads.  */
+  void set_proximity_parallelism(Parallelism parallelism) {
+    geometry_engine_->set_parallelism(parallelism);
+  }
+
+  /** Reports the degree of parallelism used by the proximity engine.  */
+  Parallelism proximity_parallelism() const {
+    return geometry_engine_->parallelism();
+  }
+
   /** Implementation of QueryObject::ComputePointPairPenetration().  */
   std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration() const {
     return geometry_engine_->ComputePointPairPenetration(X_WGs_);
@@ -434,6 +451,12 @@ class GeometryState {
     return geometry_engine_->HasCollisions();
   }
 
+  /** Provides access to the proximity engine, see
+   SceneGraphInspector::CloneProximityEngine().  */
+  const internal::ProximityEngine<T>& proximity_engine() const {
+    return *geometry_engine_;
+  }
+
   //@}
 
   /** @name        Collision filtering    */
@@ -477,6 +500,20 @@ class GeometryState {
                                                           threshold);
   }
 
+  /** Implementation of QueryObject::ComputeSignedDistanceToPoints().  */
+  SignedDistanceToPoints<T> ComputeSignedDistanceToPoints(
+      const Matrix3X<T>& p_WQs, double threshold) const {
+    return geometry_engine_->ComputeSignedDistanceToPoints(p_WQs, X_WGs_,
+                                                           threshold);
+  }
+
+  /** Implementation of QueryObject::CastRays().  */
+  std::vector<RayHit> CastRays(const Eigen::Matrix3Xd& p_WRs,
+                               const Eigen::Matrix3Xd& n_Ws,
+                               double max_distance) const {
+    return geometry_engine_->CastRays(p_WRs, n_Ws, max_distance);
+  }
+
   //@}
 
   //---------------------------------------------------------------------------
@@ -568,6 +605,7 @@ class GeometryState {
         geometry_engine_(
             std::move(source.geometry_engine_->template ToScalarType<T>())),
         render_engines_(source.render_engines_),
+        moved_geometry_ids_(source.moved_geometry_ids_),
         geometry_version_(source.geometry_version_) {
     auto convert_pose_vector = [](const std::vector<math::RigidTransform<U>>& s,
                                   std::vector<math::RigidTransform<T>>* d) {
@@ -579,6 +617,10 @@ class GeometryState {
     };
     convert_pose_vector(source.X_PF_, &X_PF_);
     convert_pose_vector(source.X_WF_, &X_WF_);
+    X_WF_is_stale_ = source.X_WF_is_stale_;
+    // The pose update plan is rebuilt from the converted X_WGs_ on the next
+    // call to SetFramePoses().
+    pose_update_plan_stale_ = true;
 
     // Now convert the id -> pose map.
     std::unordered_map<GeometryId, math::RigidTransform<T>>& dest = X_WGs_;
@@ -660,12 +702,11 @@ class GeometryState {
   void RemoveGeometryUnchecked(GeometryId geometry_id,
                                RemoveGeometryOrigin caller);
 
-  // Recursively updates the frame and geometry _pose_ information for the tree
-  // rooted at the given frame, whose parent's pose in the world frame is given
-  // as `X_WP`.
-  void UpdatePosesRecursively(const internal::InternalFrame& frame,
-                              const math::RigidTransform<T>& X_WP,
-                              const FramePoseVector<T>& poses);
+  // Rebuilds the index-based copy of the frame and geometry topology used by
+  // SetFramePoses() (frame_parent_indexes_, frame_geometry_offsets_, the
+  // dense_* geometry arrays and source_frame_orders_) from frames_,
+  // geometries_ and X_WGs_.
+  void RebuildPoseUpdatePlan();
 
   // Reports true if the given id refers to a _dynamic_ geometry. Assumes the
   // precondition that id refers to a valid geometry in the state.
@@ -820,6 +861,46 @@ class GeometryState {
   // TODO(SeanCurtis-TRI): Rename this to X_WFs_ to reflect multiplicity.
   std::vector<math::RigidTransform<T>> X_WF_;
 
+  // For each frame index, true if X_WF_ (and the world poses of the frame's
+  // geometries) haven't been computed since the frame was registered, so the
+  // next pose update must compute them even if X_PF is unchanged.
+  std::vector<bool> X_WF_is_stale_;
+
+  // An index-based copy of the frame and geometry topology, laid out as
+  // parallel arrays so that SetFramePoses() can update the world poses
+  // without looking up frames and geometries by id. It must be rebuilt (see
+  // RebuildPoseUpdatePlan()) whenever a frame or geometry is added or removed,
+  // which is recorded by pose_update_plan_stale_.
+  bool pose_update_plan_stale_{true};
+
+  // For each frame index, the index of its parent frame. The world frame is
+  // its own parent.
+  std::vector<int> frame_parent_indexes_;
+
+  // For each frame index i, the dense geometry indices of the frame's child
+  // geometries are [frame_geometry_offsets_[i], frame_geometry_offsets_[i+1]).
+  std::vector<int> frame_geometry_offsets_;
+
+  // For each dense geometry index, the geometry's id, its pose in its frame
+  // and its pose in the world frame, as of the last pose update. The latter
+  // mirrors X_WGs_; it is only used to detect which geometries moved.
+  std::vector<GeometryId> dense_geometry_ids_;
+  std::vector<math::RigidTransform<double>> dense_X_FGs_;
+  std::vector<math::RigidTransform<T>> dense_X_WGs_;
+
+  // For each source, the indexes of its frames ordered such that every frame
+  // comes after its parent.
+  std::unordered_map<SourceId, std::vector<int>> source_frame_orders_;
+
+  // For each frame index, true if the frame's world pose changed in the last
+  // pose update. It is scratch data for SetFramePoses().
+  std::vector<bool> frame_moved_;
+
+  // For each frame index, the position of the frame's pose in the last
+  // FramePoseVector given to SetFramePoses() (see
+  // FrameKinematicsVector::FindValue()), or -1 if unknown.
+  std::vector<int> frame_pose_slots_;
+
   // The underlying geometry engine. The topology of the engine does _not_
   // change with respect to time. But its values do. This straddles the two
   // worlds, maintaining its own persistent topological state and derived
@@ -833,6 +914,11 @@ class GeometryState {
   std::unordered_map<std::string, copyable_unique_ptr<render::RenderEngine>>
       render_engines_;
 
+  // The ids of the geometries whose world poses have changed value since the
+  // proximity and render engines were last updated (see FinalizePoseUpdate()).
+  // Geometries that haven't moved don't need to be pushed to the engines.
+  std::unordered_set<GeometryId> moved_geometry_ids_;
+
   // The version for this geometry data.
   GeometryVersion geometry_version_;
 };
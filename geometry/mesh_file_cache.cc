@@ -0,0 +1,79 @@
+#include "drake/geometry/mesh_file_cache.h"
+
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include "drake/common/never_destroyed.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace mesh_file_cache {
+namespace {
+
+using Key = std::tuple<std::type_index, std::string, std::string, double>;
+
+struct Cache {
+  std::mutex mutex;
+  std::map<Key, std::weak_ptr<const void>> entries;
+};
+
+Cache& GetCache() {
+  static never_destroyed<Cache> cache;
+  return cache.access();
+}
+
+}  // namespace
+
+std::shared_ptr<const void> Find(std::type_index type, const std::string& kind,
+                                 const std::string& filename, double scale) {
+  Cache& cache = GetCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  const auto iter = cache.entries.find(Key(type, kind, filename, scale));
+  if (iter == cache.entries.end()) {
+    return nullptr;
+  }
+  return iter->second.lock();
+}
+
+std::shared_ptr<const void> Insert(std::type_index type,
+                                   const std::string& kind,
+                                   const std::string& filename, double scale,
+                                   std::shared_ptr<const void> data) {
+  Cache& cache = GetCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  // Drop the entries whose data has been freed, so the map doesn't grow
+  // without bound.
+  for (auto iter = cache.entries.begin(); iter != cache.entries.end();) {
+    if (iter->second.expired()) {
+      iter = cache.entries.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+  std::weak_ptr<const void>& entry =
+      cache.entries[Key(type, kind, filename, scale)];
+  if (std::shared_ptr<const void> existing = entry.lock()) {
+    return existing;
+  }
+  entry = data;
+  return data;
+}
+
+int NumLiveEntries() {
+  Cache& cache = GetCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  int result = 0;
+  for (const auto& [key, entry] : cache.entries) {
+    if (!entry.expired()) {
+      ++result;
+    }
+  }
+  return result;
+}
+
+}  // namespace mesh_file_cache
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
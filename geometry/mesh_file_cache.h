@@ -0,0 +1,65 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <utility>
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* Implementation details of GetOrMakeMeshFileData(); don't call these
+ directly.  */
+namespace mesh_file_cache {
+
+/* Returns the live entry for the given key, or null.  */
+std::shared_ptr<const void> Find(std::type_index type, const std::string& kind,
+                                 const std::string& filename, double scale);
+
+/* Stores `data` under the given key, unless a live entry was stored
+ concurrently; returns whichever entry is now in the cache.  */
+std::shared_ptr<const void> Insert(std::type_index type,
+                                   const std::string& kind,
+                                   const std::string& filename, double scale,
+                                   std::shared_ptr<const void> data);
+
+/* Returns the number of live entries (for testing).  */
+int NumLiveEntries();
+
+}  // namespace mesh_file_cache
+
+/* Returns the immutable data of type T derived from the mesh file `filename`
+ at the given `scale`, invoking `make` to build it only if no one else in this
+ process is currently using data for the same key. This is how the geometry
+ derived from mesh files (the parsed vertices, the hydroelastic surface and
+ volume meshes, and their BVHs) is shared by every SceneGraph -- and every
+ clone of one -- instead of being duplicated.
+
+ The key is the type T, the `kind` of data (which distinguishes different data
+ of the same type, e.g., a mesh read with and without triangulation), the
+ `filename` (as given; it is not canonicalized) and the `scale`. The cache only
+ holds weak references: data is freed as soon as its last user releases it,
+ and is rebuilt (re-reading the file) the next time it is requested. While the
+ data is alive, changes to the file on disk are not observed.
+
+ This function is thread safe. `make` may be invoked concurrently for the same
+ key by different threads; only one of the results is kept.  */
+template <typename T>
+std::shared_ptr<const T> GetOrMakeMeshFileData(
+    const std::string& kind, const std::string& filename, double scale,
+    const std::function<T()>& make) {
+  const std::type_index type(typeid(T));
+  std::shared_ptr<const void> data =
+      mesh_file_cache::Find(type, kind, filename, scale);
+  if (data == nullptr) {
+    data = mesh_file_cache::Insert(type, kind, filename, scale,
+                                   std::make_shared<const T>(make()));
+  }
+  return std::static_pointer_cast<const T>(std::move(data));
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
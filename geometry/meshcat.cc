@@ -7,6 +7,7 @@
 #include <fstream>
 #include <functional>
 #include <future>
+#include <limits>
 #include <map>
 #include <optional>
 #include <regex>
@@ -16,6 +17,7 @@
 #include <thread>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <App.h>
 #include <common_robotics_utilities/base64_helpers.hpp>
@@ -731,18 +733,23 @@ class Meshcat::Impl {
 
   // This function is public via the PIMPL.
   void SetObject(std::string_view path, const perception::PointCloud& cloud,
-                 double point_size, const Rgba& rgba) {
+                 double point_size, const Rgba& rgba, bool quantize) {
     DRAKE_DEMAND(IsThread(main_thread_id_));
 
     uuids::uuid_random_generator uuid_generator{generator_};
     internal::SetObjectData data;
     data.path = FullPath(path);
 
+    internal::MeshData mesh;
     auto geometry = std::make_unique<internal::BufferGeometryData>();
     geometry->uuid = uuids::to_string(uuid_generator());
-    geometry->position = cloud.xyzs();
-    if (cloud.has_rgbs()) {
-      geometry->color = cloud.rgbs().cast<float>()/255.0;
+    if (quantize) {
+      QuantizePointCloud(cloud, geometry.get(), &mesh);
+    } else {
+      geometry->position = cloud.xyzs();
+      if (cloud.has_rgbs()) {
+        geometry->color = cloud.rgbs().cast<float>()/255.0;
+      }
     }
     data.object.geometry = std::move(geometry);
 
@@ -756,7 +763,6 @@ class Meshcat::Impl {
     material->vertexColors = cloud.has_rgbs();
     data.object.material = std::move(material);
 
-    internal::MeshData mesh;
     mesh.uuid = uuids::to_string(uuid_generator());
     mesh.type = "Points";
     mesh.geometry = data.object.geometry->uuid;
@@ -773,6 +779,57 @@ class Meshcat::Impl {
     });
   }
 
+  // Stores the finite points of `cloud` in `geometry` as int16 positions
+  // normalized to the points' bounding box (and uint8 colors), and sets the
+  // matrix of `mesh` to map the normalized positions back to the box.
+  static void QuantizePointCloud(const perception::PointCloud& cloud,
+                                 internal::BufferGeometryData* geometry,
+                                 internal::MeshData* mesh) {
+    std::vector<int> finite;
+    finite.reserve(cloud.size());
+    Eigen::AlignedBox3f bounds;
+    for (int i = 0; i < cloud.size(); ++i) {
+      if (cloud.xyz(i).allFinite()) {
+        finite.push_back(i);
+        bounds.extend(cloud.xyz(i));
+      }
+    }
+    if (finite.empty()) return;
+
+    const Eigen::Vector3f center = bounds.center();
+    // Degenerate extents get an arbitrary (non-zero) scale.
+    const Eigen::Vector3f half_extent =
+        (0.5f * bounds.sizes()).unaryExpr([](float x) {
+          return x > 0 ? x : 1.0f;
+        });
+    constexpr float kMax = std::numeric_limits<int16_t>::max();
+    const Eigen::Vector3f scale = kMax * half_extent.cwiseInverse();
+    const int n = static_cast<int>(finite.size());
+    geometry->quantized_position.resize(3, n);
+    for (int j = 0; j < n; ++j) {
+      geometry->quantized_position.col(j) =
+          (scale.cwiseProduct(cloud.xyz(finite[j]) - center))
+              .array()
+              .round()
+              .max(-kMax)
+              .min(kMax)
+              .cast<int16_t>()
+              .matrix();
+    }
+    if (cloud.has_rgbs()) {
+      geometry->quantized_color.resize(3, n);
+      for (int j = 0; j < n; ++j) {
+        geometry->quantized_color.col(j) = cloud.rgb(finite[j]);
+      }
+    }
+
+    // three.js maps a normalized int16 q to q / kMax ∈ [-1, 1].
+    Eigen::Map<Eigen::Matrix4d> matrix(mesh->matrix);
+    matrix.setIdentity();
+    matrix.diagonal().head<3>() = half_extent.cast<double>();
+    matrix.col(3).head<3>() = center.cast<double>();
+  }
+
   // This function is public via the PIMPL.
   void SetObject(std::string_view path, const TriangleSurfaceMesh<double>& mesh,
                  const Rgba& rgba, bool wireframe,
@@ -953,6 +1010,44 @@ class Meshcat::Impl {
     });
   }
 
+  // This function is public via the PIMPL.
+  void SetTransforms(const std::vector<std::string>& paths,
+                     const std::vector<RigidTransformd>& X_ParentPaths) {
+    DRAKE_DEMAND(IsThread(main_thread_id_));
+    DRAKE_THROW_UNLESS(paths.size() == X_ParentPaths.size());
+    if (paths.empty()) return;
+
+    internal::SetTransformsData data;
+    data.paths.reserve(paths.size());
+    data.matrices.resize(16 * paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+      data.paths.push_back(FullPath(paths[i]));
+      Eigen::Map<Eigen::Matrix4f>(&data.matrices[16 * i]) =
+          X_ParentPaths[i].GetAsMatrix4().cast<float>();
+    }
+
+    Defer([this, data = std::move(data),
+           X_ParentPaths = X_ParentPaths]() {
+      DRAKE_DEMAND(IsThread(websocket_thread_id_));
+      DRAKE_DEMAND(app_ != nullptr);
+      std::stringstream message_stream;
+      msgpack::pack(message_stream, data);
+      app_->publish("all", message_stream.str(), uWS::OpCode::BINARY, false);
+      // The scene tree retains an individual set_transform command per path,
+      // for new connections and static html.
+      internal::SetTransformData element_data;
+      for (size_t i = 0; i < data.paths.size(); ++i) {
+        element_data.path = data.paths[i];
+        Eigen::Map<Eigen::Matrix4d>(element_data.matrix) =
+            X_ParentPaths[i].GetAsMatrix4();
+        std::stringstream element_stream;
+        msgpack::pack(element_stream, element_data);
+        SceneTreeElement& e = scene_tree_root_[element_data.path];
+        e.transform() = element_stream.str();
+      }
+    });
+  }
+
   // This function is public via the PIMPL.
   void Delete(std::string_view path) {
     DRAKE_DEMAND(IsThread(main_thread_id_));
@@ -1938,8 +2033,8 @@ void Meshcat::SetObject(std::string_view path, const Shape& shape,
 
 void Meshcat::SetObject(std::string_view path,
                         const perception::PointCloud& cloud, double point_size,
-                        const Rgba& rgba) {
-  impl().SetObject(path, cloud, point_size, rgba);
+                        const Rgba& rgba, bool quantize) {
+  impl().SetObject(path, cloud, point_size, rgba, quantize);
 }
 
 void Meshcat::SetObject(std::string_view path,
@@ -1988,6 +2083,12 @@ void Meshcat::SetTransform(std::string_view path,
   impl().SetTransform(path, matrix);
 }
 
+void Meshcat::SetTransforms(
+    const std::vector<std::string>& paths,
+    const std::vector<math::RigidTransformd>& X_ParentPaths) {
+  impl().SetTransforms(paths, X_ParentPaths);
+}
+
 void Meshcat::Delete(std::string_view path) {
   impl().Delete(path);
 }
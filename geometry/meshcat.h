@@ -172,12 +172,20 @@ class Meshcat {
   @param point_size is the size of each rendered point.
   @param rgba is the default color, which is only used if
               `point_cloud.has_rgbs() == false`.
+  @param quantize if true, the cloud is sent in a compact form: each point's
+                  position is quantized to 16 bits per coordinate relative to
+                  the bounding box of the cloud, and colors use 8 bits per
+                  channel. This reduces the size of the message by about a
+                  factor of two (or four, with colors), at the cost of a
+                  precision of (box size / 65534). Non-finite points are
+                  omitted.
   @pydrake_mkdoc_identifier{cloud}
   */
   void SetObject(std::string_view path,
                  const perception::PointCloud& point_cloud,
                  double point_size = 0.001,
-                 const Rgba& rgba = Rgba(.9, .9, .9, 1.));
+                 const Rgba& rgba = Rgba(.9, .9, .9, 1.),
+                 bool quantize = false);
 
   /** Sets the "object" at `path` in the scene tree to a TriangleSurfaceMesh.
 
@@ -343,6 +351,19 @@ class Meshcat {
   void SetTransform(std::string_view path,
                     const Eigen::Ref<const Eigen::Matrix4d>& matrix);
 
+  /** Sets the RigidTransform of each path in `paths` relative to its parent
+  path, as if by calling SetTransform(paths[i], X_ParentPaths[i]) for each i.
+  The transforms are sent to the browser in a single compact message (with
+  single-precision matrices), which is substantially cheaper than sending them
+  individually when updating many paths at once (e.g., in MeshcatVisualizer).
+  @param paths "/"-delimited strings indicating the paths in the scene tree.
+               See @ref meshcat_path "Meshcat paths" for the semantics.
+  @param X_ParentPaths the relative transforms from each path to its
+                       immediate parent.
+  @throws std::exception if `paths` and `X_ParentPaths` differ in size. */
+  void SetTransforms(const std::vector<std::string>& paths,
+                     const std::vector<math::RigidTransformd>& X_ParentPaths);
+
   /** Deletes the object at the given `path` as well as all of its children.
   See @ref meshcat_path for the detailed semantics of deletion. */
   void Delete(std::string_view path = "");
@@ -0,0 +1,228 @@
+#include "drake/geometry/meshcat_animation_recorder.h"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace geometry {
+namespace {
+
+// The file begins with this tag (followed by the frame rate as a double).
+constexpr char kMagic[8] = {'D', 'R', 'K', 'M', 'C', 'A', 'N', '1'};
+
+// Each record begins with one of these tags.
+enum RecordTag : uint8_t {
+  // uint32 id, uint32 size, char[size].
+  kString = 0,
+  // int32 frame, uint32 path id, float[3] position, float[4] quaternion
+  // (x, y, z, w).
+  kTransform = 1,
+  // int32 frame, uint32 path id, uint32 property id, followed by the value:
+  // uint8 (kBool), double (kDouble), or uint32 size, double[size] (kVector).
+  kBool = 2,
+  kDouble = 3,
+  kVector = 4,
+};
+
+template <typename T>
+void Write(std::ostream* out, const T& value) {
+  out->write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool Read(std::istream* in, T* value) {
+  return static_cast<bool>(
+      in->read(reinterpret_cast<char*>(value), sizeof(T)));
+}
+
+}  // namespace
+
+MeshcatAnimationRecorder::MeshcatAnimationRecorder(const std::string& filename,
+                                                   double frames_per_second,
+                                                   int decimation)
+    : frames_per_second_(frames_per_second), decimation_(decimation) {
+  DRAKE_THROW_UNLESS(frames_per_second > 0);
+  DRAKE_THROW_UNLESS(decimation >= 1);
+  file_ = std::make_unique<std::ofstream>(
+      filename, std::ios::binary | std::ios::trunc);
+  if (!file_->good()) {
+    throw std::runtime_error(fmt::format(
+        "MeshcatAnimationRecorder: could not open '{}' for writing.",
+        filename));
+  }
+  file_->write(kMagic, sizeof(kMagic));
+  Write(file_.get(), frames_per_second_);
+}
+
+MeshcatAnimationRecorder::~MeshcatAnimationRecorder() = default;
+
+void MeshcatAnimationRecorder::SetTransform(
+    int frame, const std::string& path,
+    const math::RigidTransformd& X_ParentPath) {
+  if (!IsRecorded(frame)) return;
+  const uint32_t path_id = GetStringId(path);
+  const Eigen::Vector3f p = X_ParentPath.translation().cast<float>();
+  const Eigen::Quaterniond q = X_ParentPath.rotation().ToQuaternion();
+  const float data[7] = {p.x(),
+                         p.y(),
+                         p.z(),
+                         static_cast<float>(q.x()),
+                         static_cast<float>(q.y()),
+                         static_cast<float>(q.z()),
+                         static_cast<float>(q.w())};
+  Write(file_.get(), kTransform);
+  Write(file_.get(), static_cast<int32_t>(frame));
+  Write(file_.get(), path_id);
+  Write(file_.get(), data);
+  ++num_keyframes_;
+}
+
+void MeshcatAnimationRecorder::SetProperty(int frame, const std::string& path,
+                                           const std::string& property,
+                                           bool value) {
+  if (!IsRecorded(frame)) return;
+  WritePropertyHeader(kBool, frame, path, property);
+  Write(file_.get(), static_cast<uint8_t>(value));
+}
+
+void MeshcatAnimationRecorder::SetProperty(int frame, const std::string& path,
+                                           const std::string& property,
+                                           double value) {
+  if (!IsRecorded(frame)) return;
+  WritePropertyHeader(kDouble, frame, path, property);
+  Write(file_.get(), value);
+}
+
+void MeshcatAnimationRecorder::SetProperty(int frame, const std::string& path,
+                                           const std::string& property,
+                                           const std::vector<double>& value) {
+  if (!IsRecorded(frame)) return;
+  WritePropertyHeader(kVector, frame, path, property);
+  Write(file_.get(), static_cast<uint32_t>(value.size()));
+  file_->write(reinterpret_cast<const char*>(value.data()),
+               value.size() * sizeof(double));
+}
+
+void MeshcatAnimationRecorder::Flush() {
+  file_->flush();
+}
+
+uint32_t MeshcatAnimationRecorder::GetStringId(const std::string& str) {
+  const auto [iter, inserted] =
+      string_ids_.emplace(str, static_cast<uint32_t>(string_ids_.size()));
+  if (inserted) {
+    Write(file_.get(), kString);
+    Write(file_.get(), iter->second);
+    Write(file_.get(), static_cast<uint32_t>(str.size()));
+    file_->write(str.data(), str.size());
+  }
+  return iter->second;
+}
+
+void MeshcatAnimationRecorder::WritePropertyHeader(
+    uint8_t tag, int frame, const std::string& path,
+    const std::string& property) {
+  // The string ids must be written before the record that uses them.
+  const uint32_t path_id = GetStringId(path);
+  const uint32_t property_id = GetStringId(property);
+  Write(file_.get(), tag);
+  Write(file_.get(), static_cast<int32_t>(frame));
+  Write(file_.get(), path_id);
+  Write(file_.get(), property_id);
+  ++num_keyframes_;
+}
+
+std::unique_ptr<MeshcatAnimation> MeshcatAnimationRecorder::Load(
+    const std::string& filename) {
+  std::ifstream file(filename, std::ios::binary);
+  if (!file.good()) {
+    throw std::runtime_error(fmt::format(
+        "MeshcatAnimationRecorder::Load(): could not open '{}'.", filename));
+  }
+  char magic[sizeof(kMagic)];
+  double frames_per_second{};
+  if (!file.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+      !Read(&file, &frames_per_second)) {
+    throw std::runtime_error(fmt::format(
+        "MeshcatAnimationRecorder::Load(): '{}' is not a Meshcat animation "
+        "recording.",
+        filename));
+  }
+  auto animation = std::make_unique<MeshcatAnimation>(frames_per_second);
+
+  // Reads records until the end of the file; a truncated final record (e.g.,
+  // from an interrupted recording) is ignored.
+  std::vector<std::string> strings;
+  auto read_string_id = [&file, &strings](const std::string** result) {
+    uint32_t id{};
+    if (!Read(&file, &id)) return false;
+    if (id >= strings.size()) {
+      throw std::runtime_error(
+          "MeshcatAnimationRecorder::Load(): corrupt recording.");
+    }
+    *result = &strings[id];
+    return true;
+  };
+  uint8_t tag{};
+  while (Read(&file, &tag)) {
+    if (tag == kString) {
+      uint32_t id{}, size{};
+      if (!Read(&file, &id) || !Read(&file, &size)) break;
+      std::string str(size, '\0');
+      if (!file.read(str.data(), size)) break;
+      if (id != strings.size()) {
+        throw std::runtime_error(
+            "MeshcatAnimationRecorder::Load(): corrupt recording.");
+      }
+      strings.push_back(std::move(str));
+      continue;
+    }
+    int32_t frame{};
+    const std::string* path{};
+    if (!Read(&file, &frame) || !read_string_id(&path)) break;
+    if (tag == kTransform) {
+      float data[7];
+      if (!Read(&file, &data)) break;
+      const Eigen::Quaterniond q(data[6], data[3], data[4], data[5]);
+      animation->SetTransform(
+          frame, *path,
+          math::RigidTransformd(
+              Eigen::Quaterniond(q.normalized()),
+              Eigen::Vector3d(data[0], data[1], data[2])));
+      continue;
+    }
+    const std::string* property{};
+    if (!read_string_id(&property)) break;
+    if (tag == kBool) {
+      uint8_t value{};
+      if (!Read(&file, &value)) break;
+      animation->SetProperty(frame, *path, *property, value != 0);
+    } else if (tag == kDouble) {
+      double value{};
+      if (!Read(&file, &value)) break;
+      animation->SetProperty(frame, *path, *property, value);
+    } else if (tag == kVector) {
+      uint32_t size{};
+      if (!Read(&file, &size)) break;
+      std::vector<double> value(size);
+      if (!file.read(reinterpret_cast<char*>(value.data()),
+                     size * sizeof(double))) {
+        break;
+      }
+      animation->SetProperty(frame, *path, *property, value);
+    } else {
+      throw std::runtime_error(
+          "MeshcatAnimationRecorder::Load(): corrupt recording.");
+    }
+  }
+  return animation;
+}
+
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/meshcat_animation.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+
+/** Records an animation (transforms and properties set at integer frame
+numbers, as in MeshcatAnimation) by streaming its keyframes to a file as they
+are set, instead of accumulating them in memory. This supports long recordings
+(e.g., of regression tests) without a browser or an unbounded memory footprint;
+the file can be loaded later with Load() and replayed with
+Meshcat::SetAnimation() (or saved as a standalone html file via
+Meshcat::StaticHtml()) without re-running the simulation.
+
+To reduce the size of the file, keyframes can be decimated: only frames that
+are multiples of `decimation` are written, and Meshcat interpolates between
+them on playback. Transforms are stored in single precision.
+
+The file is a sequence of binary records in the host's byte order; it is meant
+to be read back by Load() on a machine of the same endianness. The data is
+buffered; call Flush() (or destroy the recorder) to ensure that everything
+recorded so far has been written. If a recording is cut short (e.g., by a
+crash), Load() recovers all of the records that were completely written. */
+class MeshcatAnimationRecorder {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MeshcatAnimationRecorder)
+
+  /** Creates (or truncates) the file `filename` and begins a recording.
+  @param frames_per_second a positive number specifying the timing at which the
+  frames are played back.
+  @param decimation a positive integer; only frames that are multiples of it
+  are recorded.
+  @throws std::exception if the file cannot be opened, or if the arguments are
+  not positive. */
+  explicit MeshcatAnimationRecorder(const std::string& filename,
+                                    double frames_per_second = 32.0,
+                                    int decimation = 1);
+
+  /** Flushes and closes the file. */
+  ~MeshcatAnimationRecorder();
+
+  /** Returns the frame rate at which the animation will be played back. */
+  double frames_per_second() const { return frames_per_second_; }
+
+  /** Returns the decimation passed to the constructor. */
+  int decimation() const { return decimation_; }
+
+  /** Returns the start time; see MeshcatAnimation::set_start_time(). */
+  double start_time() const { return start_time_; }
+
+  /** Sets the start time used by frame(); see
+  MeshcatAnimation::set_start_time(). The default is zero. */
+  void set_start_time(double time) { start_time_ = time; }
+
+  /** Uses the frame rate to convert from time to the frame number, using
+  std::floor.
+  @pre `time` ≥ start_time(). */
+  int frame(double time) const {
+    DRAKE_DEMAND(time >= start_time_);
+    return static_cast<int>(
+        std::floor((time - start_time_) * frames_per_second_));
+  }
+
+  /** Records the RigidTransform at `frame` for the given `path`, if `frame`
+  is not decimated. @see MeshcatAnimation::SetTransform. */
+  void SetTransform(int frame, const std::string& path,
+                    const math::RigidTransformd& X_ParentPath);
+
+  /** Records a property value at `frame` for the given `path`, if `frame` is
+  not decimated. @see MeshcatAnimation::SetProperty.
+  @pydrake_mkdoc_identifier{bool} */
+  void SetProperty(int frame, const std::string& path,
+                   const std::string& property, bool value);
+
+  /** Records a property value at `frame` for the given `path`, if `frame` is
+  not decimated. @see MeshcatAnimation::SetProperty.
+  @pydrake_mkdoc_identifier{double} */
+  void SetProperty(int frame, const std::string& path,
+                   const std::string& property, double value);
+
+  /** Records a property value at `frame` for the given `path`, if `frame` is
+  not decimated. @see MeshcatAnimation::SetProperty.
+  @pydrake_mkdoc_identifier{vector_double} */
+  void SetProperty(int frame, const std::string& path,
+                   const std::string& property,
+                   const std::vector<double>& value);
+
+  /** Writes any buffered keyframes to the file. */
+  void Flush();
+
+  /** Returns the number of keyframes (transforms and property values)
+  recorded so far, not counting the decimated ones. */
+  int num_keyframes() const { return num_keyframes_; }
+
+  /** Loads a recording written by a %MeshcatAnimationRecorder into a new
+  MeshcatAnimation, with the recorded frame rate.
+  @throws std::exception if the file cannot be read or is not a recording. */
+  static std::unique_ptr<MeshcatAnimation> Load(const std::string& filename);
+
+ private:
+  // Returns true iff keyframes at `frame` should be written.
+  bool IsRecorded(int frame) const {
+    DRAKE_DEMAND(frame >= 0);
+    return frame % decimation_ == 0;
+  }
+
+  // Returns the id of `str`, writing it to the file's string table if needed.
+  uint32_t GetStringId(const std::string& str);
+
+  // Writes the common prefix of a property record.
+  void WritePropertyHeader(uint8_t tag, int frame, const std::string& path,
+                           const std::string& property);
+
+  std::unique_ptr<std::ofstream> file_;
+  const double frames_per_second_;
+  const int decimation_;
+  double start_time_{0.0};
+  int num_keyframes_{0};
+  std::unordered_map<std::string, uint32_t> string_ids_;
+};
+
+}  // namespace geometry
+}  // namespace drake
@@ -47,6 +47,22 @@ MeshcatPointCloudVisualizer<T>::MeshcatPointCloudVisualizer(
                                   other.publish_period_) {
   set_point_size(other.point_size_);
   set_default_rgba(other.default_rgba_);
+  set_voxel_size(other.voxel_size_);
+  set_quantize(other.quantize_);
+  set_max_update_rate(other.max_update_rate_);
+}
+
+template <typename T>
+void MeshcatPointCloudVisualizer<T>::set_voxel_size(double voxel_size) {
+  DRAKE_THROW_UNLESS(voxel_size >= 0.0);
+  voxel_size_ = voxel_size;
+}
+
+template <typename T>
+void MeshcatPointCloudVisualizer<T>::set_max_update_rate(
+    double max_update_rate) {
+  DRAKE_THROW_UNLESS(max_update_rate >= 0.0);
+  max_update_rate_ = max_update_rate;
 }
 
 template <typename T>
@@ -57,9 +73,24 @@ void MeshcatPointCloudVisualizer<T>::Delete() const {
 template <typename T>
 systems::EventStatus MeshcatPointCloudVisualizer<T>::UpdateMeshcat(
     const systems::Context<T>& context) const {
+  if (max_update_rate_ > 0) {
+    const auto now = std::chrono::steady_clock::now();
+    if (last_update_time_.has_value() &&
+        std::chrono::duration<double>(now - *last_update_time_).count() <
+            1.0 / max_update_rate_) {
+      return systems::EventStatus::DidNothing();
+    }
+    last_update_time_ = now;
+  }
+
   const auto& cloud =
       cloud_input_port().template Eval<perception::PointCloud>(context);
-  meshcat_->SetObject(path_, cloud, point_size_, default_rgba_);
+  if (voxel_size_ > 0) {
+    meshcat_->SetObject(path_, cloud.VoxelizedDownSample(voxel_size_),
+                        point_size_, default_rgba_, quantize_);
+  } else {
+    meshcat_->SetObject(path_, cloud, point_size_, default_rgba_, quantize_);
+  }
 
   const math::RigidTransformd X_ParentCloud =
       pose_input_port().HasValue(context)
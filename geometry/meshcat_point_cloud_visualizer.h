@@ -1,7 +1,9 @@
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -62,6 +64,24 @@ class MeshcatPointCloudVisualizer final : public systems::LeafSystem<T> {
   `has_rgbs() == false` for the cloud on the input port. */
   void set_default_rgba(const Rgba& rgba) { default_rgba_ = rgba; }
 
+  /** Sets the side length of the voxels used to decimate the cloud before it
+  is sent (see perception::PointCloud::VoxelizedDownSample()). The default of
+  zero sends every point.
+  @throws std::exception if `voxel_size` is negative. */
+  void set_voxel_size(double voxel_size);
+
+  /** Sets whether the cloud is sent with quantized positions and colors (see
+  Meshcat::SetObject(std::string_view, const perception::PointCloud&, double,
+  const Rgba&, bool)). The default is false. */
+  void set_quantize(bool quantize) { quantize_ = quantize; }
+
+  /** Sets the maximum rate (in wall-clock updates per second) at which the
+  cloud is sent, for simulations that run faster than real time. Updates that
+  would exceed this rate are skipped. The default of zero sends every update
+  (at the simulation-time `publish_period`).
+  @throws std::exception if `max_update_rate` is negative. */
+  void set_max_update_rate(double max_update_rate);
+
   /** Calls Meschat::Delete(path), where `path` is the value passed in the
    constructor. */
   void Delete() const;
@@ -103,6 +123,16 @@ class MeshcatPointCloudVisualizer final : public systems::LeafSystem<T> {
   double point_size_{0.001};
   Rgba default_rgba_{.9, .9, .9, 1.0};
 
+  /* Bandwidth parameters. */
+  double voxel_size_{0.0};
+  bool quantize_{false};
+  double max_update_rate_{0.0};
+
+  /* The wall-clock time of the most recent update, for max_update_rate_. This
+   does not represent undeclared state; it only throttles messages. */
+  mutable std::optional<std::chrono::steady_clock::time_point>
+      last_update_time_;
+
   /* We store the arguments passed in the constructor to support scalar
   conversion. */
   double publish_period_;
@@ -5,6 +5,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <variant>
 #include <vector>
 
@@ -241,6 +242,37 @@ struct MeshFileGeometryData : public GeometryData {
   }
 };
 
+// Packs a three.js BufferAttribute whose values are normalized integers, i.e.,
+// the renderer maps them to [-1, 1] (signed) or [0, 1] (unsigned).
+template <typename Scalar>
+void PackNormalizedAttribute(
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of msgpack.
+    msgpack::packer<std::stringstream>& o,
+    const Eigen::Matrix<Scalar, 3, Eigen::Dynamic>& mat) {
+  static_assert(std::is_same_v<Scalar, int16_t> ||
+                std::is_same_v<Scalar, uint8_t>);
+  o.pack_map(4);
+  o.pack("itemSize");
+  o.pack(3);
+  o.pack("type");
+  // See https://github.com/msgpack/msgpack/blob/master/spec.md#extension-types
+  // and the pack<Eigen::Matrix> adaptor below for the extension type codes.
+  int8_t ext;
+  if constexpr (std::is_same_v<Scalar, int16_t>) {
+    o.pack("Int16Array");
+    ext = 0x13;
+  } else {
+    o.pack("Uint8Array");
+    ext = 0x12;
+  }
+  o.pack("array");
+  const size_t s = mat.size() * sizeof(Scalar);
+  o.pack_ext(s, ext);
+  o.pack_ext_body(reinterpret_cast<const char*>(mat.data()), s);
+  o.pack("normalized");
+  o.pack(true);
+}
+
 struct BufferGeometryData : public GeometryData {
   // We deviate from the meshcat data structure, since it is an unnecessarily
   // deep hierarchy of dictionaries, and simply implement the packer manually.
@@ -248,8 +280,32 @@ struct BufferGeometryData : public GeometryData {
   Eigen::Matrix3Xf color;
   Eigen::Matrix<uint32_t, 3, Eigen::Dynamic> faces;
 
+  // Compact alternatives to `position` and `color` for point clouds; when
+  // non-empty, they are sent (as normalized attributes) in their place. The
+  // object's matrix must map the normalized positions in [-1, 1]³ back to the
+  // original positions.
+  Eigen::Matrix<int16_t, 3, Eigen::Dynamic> quantized_position;
+  Eigen::Matrix<uint8_t, 3, Eigen::Dynamic> quantized_color;
+
   // NOLINTNEXTLINE(runtime/references) cpplint disapproves of msgpack choices.
   void msgpack_pack(msgpack::packer<std::stringstream>& o) const override {
+    if (quantized_position.cols() > 0) {
+      o.pack_map(3);
+      o.pack("type");
+      o.pack("BufferGeometry");
+      PACK_MAP_VAR(o, uuid);
+      o.pack("data");
+      o.pack_map(1);
+      o.pack("attributes");
+      o.pack_map(quantized_color.cols() > 0 ? 2 : 1);
+      if (quantized_color.cols() > 0) {
+        o.pack("color");
+        PackNormalizedAttribute(o, quantized_color);
+      }
+      o.pack("position");
+      PackNormalizedAttribute(o, quantized_position);
+      return;
+    }
     o.pack_map(3);
     o.pack("type");
     o.pack("BufferGeometry");
@@ -367,6 +423,14 @@ struct SetTransformData {
   MSGPACK_DEFINE_MAP(type, path, matrix);
 };
 
+// A batch of set_transform commands, decoded by the "set_transforms" handler
+// in meshcat.html. The i'th path's transform is stored (column major) in
+// matrices[16 * i, 16 * i + 16), and is packed as a Float32Array.
+struct SetTransformsData {
+  std::vector<std::string> paths;
+  std::vector<float> matrices;
+};
+
 struct DeleteData {
   std::string type{"delete"};
   std::string path;
@@ -494,6 +558,27 @@ struct pack<Eigen::Matrix<Scalar, RowsAtCompileTime, ColsAtCompileTime, Options,
   }
 };
 
+template <>
+struct pack<drake::geometry::internal::SetTransformsData> {
+  template <typename Stream>
+  packer<Stream>& operator()(
+      // NOLINTNEXTLINE(runtime/references) cpplint disapproves of msgpack.
+      msgpack::packer<Stream>& o,
+      const drake::geometry::internal::SetTransformsData& v) const {
+    o.pack_map(3);
+    o.pack("type");
+    o.pack("set_transforms");
+    o.pack("paths");
+    o.pack(v.paths);
+    o.pack("matrices");
+    const size_t s = v.matrices.size() * sizeof(float);
+    // Float32Array; see the pack<Eigen::Matrix> adaptor above.
+    o.pack_ext(s, 0x17);
+    o.pack_ext_body(reinterpret_cast<const char*>(v.matrices.data()), s);
+    return o;
+  }
+};
+
 template <>
 struct pack<drake::geometry::Meshcat::OrthographicCamera> {
   template <typename Stream>
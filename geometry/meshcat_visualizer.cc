@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -21,6 +22,8 @@ MeshcatVisualizer<T>::MeshcatVisualizer(std::shared_ptr<Meshcat> meshcat,
           std::make_unique<MeshcatAnimation>(1.0 / params_.publish_period)) {
   DRAKE_DEMAND(meshcat_ != nullptr);
   DRAKE_DEMAND(params_.publish_period >= 0.0);
+  DRAKE_DEMAND(params_.translation_tolerance >= 0.0);
+  DRAKE_DEMAND(params_.rotation_tolerance >= 0.0);
   if (params_.role == Role::kUnassigned) {
     throw std::runtime_error(
         "MeshcatVisualizer cannot be used for geometries with the "
@@ -58,9 +61,30 @@ void MeshcatVisualizer<T>::PublishRecording() const {
   meshcat_->SetAnimation(*animation_);
 }
 
+template <typename T>
+MeshcatAnimationRecorder* MeshcatVisualizer<T>::StartRecordingToFile(
+    const std::string& filename, int decimation,
+    bool set_transforms_while_recording) {
+  file_recording_.reset();
+  file_recording_ = std::make_unique<MeshcatAnimationRecorder>(
+      filename, 1.0 / params_.publish_period, decimation);
+  recording_ = true;
+  set_transforms_while_recording_ = set_transforms_while_recording;
+  return file_recording_.get();
+}
+
+template <typename T>
+void MeshcatVisualizer<T>::StopRecording() {
+  recording_ = false;
+  if (file_recording_ != nullptr) {
+    file_recording_->Flush();
+  }
+}
+
 template <typename T>
 void MeshcatVisualizer<T>::DeleteRecording() {
   animation_ = std::make_unique<MeshcatAnimation>(1.0 / params_.publish_period);
+  file_recording_.reset();
 }
 
 template <typename T>
@@ -111,6 +135,9 @@ void MeshcatVisualizer<T>::SetObjects(
   std::map <GeometryId, std::string> geometries_to_delete{};
   geometries_.swap(geometries_to_delete);
 
+  // All frames are sent again with the new objects.
+  X_WF_sent_.clear();
+
   // TODO(SeanCurtis-TRI): Mimic the full tree structure in SceneGraph.
   // SceneGraph supports arbitrary hierarchies of frames just like Meshcat.
   // This code is arbitrarily flattening it because the current SceneGraph API
@@ -163,18 +190,49 @@ template <typename T>
 void MeshcatVisualizer<T>::SetTransforms(
     const systems::Context<T>& context,
     const QueryObject<T>& query_object) const {
+  const bool send = !recording_ || set_transforms_while_recording_;
+  std::vector<std::string> paths;
+  std::vector<math::RigidTransformd> X_WFs;
+  if (send) {
+    paths.reserve(dynamic_frames_.size());
+    X_WFs.reserve(dynamic_frames_.size());
+  }
   for (const auto& [frame_id, path] : dynamic_frames_) {
     const math::RigidTransformd X_WF =
         internal::convert_to_double(query_object.GetPoseInWorld(frame_id));
-    if (!recording_ || set_transforms_while_recording_) {
-      meshcat_->SetTransform(path, X_WF);
+    if (send) {
+      auto [iter, inserted] = X_WF_sent_.emplace(frame_id, X_WF);
+      if (inserted || HasMoved(iter->second, X_WF)) {
+        iter->second = X_WF;
+        paths.push_back(path);
+        X_WFs.push_back(X_WF);
+      }
     }
-    if (recording_) {
+    if (recording_ && file_recording_ != nullptr) {
+      file_recording_->SetTransform(
+          file_recording_->frame(ExtractDoubleOrThrow(context.get_time())),
+          path, X_WF);
+    } else if (recording_) {
       animation_->SetTransform(
           animation_->frame(ExtractDoubleOrThrow(context.get_time())), path,
           X_WF);
     }
   }
+  // All of the moved frames are sent to Meshcat in a single message.
+  meshcat_->SetTransforms(paths, X_WFs);
+}
+
+template <typename T>
+bool MeshcatVisualizer<T>::HasMoved(const math::RigidTransformd& X_WF_sent,
+                                   const math::RigidTransformd& X_WF) const {
+  if (X_WF.IsExactlyEqualTo(X_WF_sent)) return false;
+  if ((X_WF.translation() - X_WF_sent.translation()).norm() >
+      params_.translation_tolerance) {
+    return true;
+  }
+  const math::RotationMatrixd R_SF =
+      X_WF_sent.rotation().InvertAndCompose(X_WF.rotation());
+  return R_SF.ToAngleAxis().angle() > params_.rotation_tolerance;
 }
 
 template <typename T>
@@ -7,6 +7,7 @@
 #include "drake/geometry/geometry_roles.h"
 #include "drake/geometry/meshcat.h"
 #include "drake/geometry/meshcat_animation.h"
+#include "drake/geometry/meshcat_animation_recorder.h"
 #include "drake/geometry/meshcat_visualizer_params.h"
 #include "drake/geometry/rgba.h"
 #include "drake/geometry/scene_graph.h"
@@ -90,12 +91,31 @@ class MeshcatVisualizer final : public systems::LeafSystem<T> {
   MeshcatAnimation* StartRecording(bool set_transforms_while_recording = true) {
     recording_ = true;
     set_transforms_while_recording_ = set_transforms_while_recording;
+    file_recording_.reset();
     return get_mutable_recording();
   }
 
+  /** Like StartRecording(), but subsequent publish events stream their frames
+  into the file `filename` (see MeshcatAnimationRecorder) instead of into the
+  in-memory MeshcatAnimation. This is suitable for long simulations and for
+  recording without a browser; the file can be loaded and replayed later with
+  MeshcatAnimationRecorder::Load(). Any previous file recording is closed.
+
+  @param decimation only every `decimation`'th frame is recorded.
+  @param set_transforms_while_recording see StartRecording().
+
+  @returns a mutable pointer to the recorder, which remains valid until the
+  next call to StartRecording(), StartRecordingToFile(), or DeleteRecording().
+  @throws std::exception if the file cannot be opened. */
+  MeshcatAnimationRecorder* StartRecordingToFile(
+      const std::string& filename, int decimation = 1,
+      bool set_transforms_while_recording = true);
+
   /** Sets a flag to pause/stop recording.  When stopped, publish events will
-  not add frames to the animation. */
-  void StopRecording() { recording_ = false; }
+  not add frames to the animation. A file recording (see
+  StartRecordingToFile()) is flushed, but remains open so that recording can be
+  resumed. */
+  void StopRecording();
 
   /** Sends the recording to Meshcat as an animation. The published animation
   only includes transforms and properties; the objects that they modify must be
@@ -104,8 +124,9 @@ class MeshcatVisualizer final : public systems::LeafSystem<T> {
 
   /** Deletes the current animation holding the recorded frames.  Animation
   options (autoplay, repetitions, etc) will also be reset, and any pointers
-  obtained from get_mutable_recording() will be rendered invalid. This does
-  *not* currently remove the animation from Meshcat. */
+  obtained from get_mutable_recording() will be rendered invalid. A file
+  recording (see StartRecordingToFile()) is closed. This does *not* currently
+  remove the animation from Meshcat. */
   void DeleteRecording();
 
   /** Returns a mutable pointer to this MeshcatVisualizer's unique
@@ -161,6 +182,11 @@ class MeshcatVisualizer final : public systems::LeafSystem<T> {
   void SetTransforms(const systems::Context<T>& context,
                      const QueryObject<T>& query_object) const;
 
+  /* Returns true if X_WF differs from the pose X_WF_sent previously sent to
+   Meshcat by more than the tolerances in params_. */
+  bool HasMoved(const math::RigidTransformd& X_WF_sent,
+                const math::RigidTransformd& X_WF) const;
+
   /* Handles the initialization event. */
   systems::EventStatus OnInitialization(const systems::Context<T>&) const;
 
@@ -192,6 +218,11 @@ class MeshcatVisualizer final : public systems::LeafSystem<T> {
    new geometry version appears that does not contain them. */
   mutable std::map<GeometryId, std::string> geometries_{};
 
+  /* The pose of each dynamic frame most recently sent to Meshcat, so that
+   unmoved frames are not sent again. Like dynamic_frames_, it is coupled with
+   the version_. */
+  mutable std::map<FrameId, math::RigidTransformd> X_WF_sent_{};
+
   /* The parameters for the visualizer.  */
   MeshcatVisualizerParams params_;
 
@@ -209,6 +240,10 @@ class MeshcatVisualizer final : public systems::LeafSystem<T> {
    * can be added to it during Publish events. */
   mutable std::unique_ptr<MeshcatAnimation> animation_;
 
+  /* The recorder used instead of animation_ when recording to a file. It is
+  mutable for the same reason as animation_. */
+  mutable std::unique_ptr<MeshcatAnimationRecorder> file_recording_;
+
   /* Recording status.  True means that each new Publish event will record a
   frame in the animation. */
   bool recording_{false};
@@ -34,6 +34,17 @@ struct MeshcatVisualizerParams {
    simulation. See @ref declare_initialization_events "Declare initialization
    events" for more information. */
   bool delete_on_initialization_event{true};
+
+  /** On each publish, a frame's pose is only sent to Meshcat if it has moved
+   since it was last sent; the pose is considered to have moved if its
+   translation has changed by more than `translation_tolerance` (in meters) or
+   its orientation has changed by more than `rotation_tolerance` (in radians).
+   With the default tolerances of zero any change is sent, but an idle scene
+   sends nothing. */
+  double translation_tolerance{0.0};
+
+  /** See `translation_tolerance`. */
+  double rotation_tolerance{0.0};
 };
 
 }  // namespace geometry
@@ -1,14 +1,20 @@
 #include "drake/geometry/optimization/graph_of_convex_sets.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <random>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include <fmt/format.h>
 
+#include "drake/common/random.h"
+#include "drake/geometry/optimization/point.h"
 #include "drake/math/quadratic_form.h"
+#include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/create_cost.h"
 #include "drake/solvers/solve.h"
 
@@ -45,6 +51,19 @@ using symbolic::Expression;
 using symbolic::Variable;
 using symbolic::Variables;
 
+struct GraphOfConvexSets::ShortestPathProgram {
+  MathematicalProgram prog;
+  bool convex_relaxation{};
+  std::set<EdgeId> active_edges;
+  std::map<VertexId, std::vector<Edge*>> incoming_edges;
+  std::map<VertexId, std::vector<Edge*>> outgoing_edges;
+  // The relaxed ϕ variables (only when convex_relaxation is true).
+  std::map<EdgeId, Variable> relaxed_phi;
+  // The constraints y ∈ ϕX and z ∈ ϕX, grouped by the vertex whose set X they
+  // use.
+  std::map<VertexId, std::vector<Binding<Constraint>>> scaling_constraints;
+};
+
 GraphOfConvexSets::~GraphOfConvexSets() = default;
 
 Vertex::Vertex(VertexId id, const ConvexSet& set, std::string name)
@@ -262,18 +281,221 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
     VertexId source_id, VertexId target_id, bool convex_relaxation,
     const solvers::SolverInterface* solver,
     const std::optional<solvers::SolverOptions>& solver_options) const {
+  GraphOfConvexSetsOptions options;
+  options.convex_relaxation = convex_relaxation;
+  options.solver = solver;
+  options.solver_options = solver_options;
+  return SolveShortestPath(source_id, target_id, options);
+}
+
+MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
+    const Vertex& source, const Vertex& target, bool convex_relaxation,
+    const solvers::SolverInterface* solver,
+    const std::optional<solvers::SolverOptions>& solver_options) const {
+  return SolveShortestPath(source.id(), target.id(), convex_relaxation, solver,
+                           solver_options);
+}
+
+MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
+    VertexId source_id, VertexId target_id,
+    const GraphOfConvexSetsOptions& options) const {
   DRAKE_DEMAND(vertices_.find(source_id) != vertices_.end());
   DRAKE_DEMAND(vertices_.find(target_id) != vertices_.end());
+  DRAKE_THROW_UNLESS(options.max_rounded_paths >= 0);
+  DRAKE_THROW_UNLESS(options.max_rounding_trials >= 0);
 
-  MathematicalProgram prog;
+  std::set<EdgeId> active_edges;
+  if (options.preprocessing) {
+    active_edges = FindShortestPathEdges(source_id, target_id);
+  } else {
+    for (const auto& [edge_id, e] : edges_) {
+      active_edges.insert(edge_id);
+    }
+  }
+  const std::unique_ptr<ShortestPathProgram> spp =
+      MakeShortestPathProgram(source_id, target_id, active_edges,
+                              options.convex_relaxation, false);
 
-  std::map<VertexId, std::vector<Edge*>> incoming_edges;
-  std::map<VertexId, std::vector<Edge*>> outgoing_edges;
-  const double inf = std::numeric_limits<double>::infinity();
+  solvers::SolverOptions solver_options;
+  if (options.solver_options) {
+    solver_options = *options.solver_options;
+  }
+  MathematicalProgramResult result;
+  if (options.solver) {
+    options.solver->Solve(spp->prog, {}, solver_options, &result);
+  } else {
+    result = solvers::Solve(spp->prog, {}, solver_options);
+  }
+  AddPlaceholderSolutions(*spp, target_id, &result);
 
-  std::map<EdgeId, Variable> relaxed_phi;
+  if (!options.convex_relaxation || options.max_rounded_paths == 0 ||
+      !result.is_success()) {
+    return result;
+  }
+
+  // Randomized rounding: sample distinct paths from the source to the target,
+  // choosing each outgoing edge with probability proportional to its flow in
+  // the relaxation (and never revisiting a vertex).
+  RandomGenerator generator(options.rounding_seed);
+  std::vector<std::set<EdgeId>> paths;
+  std::set<std::vector<EdgeId>> distinct_paths;
+  for (int trial = 0; trial < options.max_rounding_trials &&
+                      static_cast<int>(paths.size()) < options.max_rounded_paths;
+       ++trial) {
+    std::vector<EdgeId> path;
+    std::set<VertexId> visited{source_id};
+    VertexId current = source_id;
+    while (current != target_id) {
+      std::vector<const Edge*> candidates;
+      std::vector<double> flows;
+      for (const Edge* e : spp->outgoing_edges[current]) {
+        const double flow = result.GetSolution(e->phi_);
+        if (visited.count(e->v().id()) == 0 && flow > 0) {
+          candidates.push_back(e);
+          flows.push_back(flow);
+        }
+      }
+      if (candidates.empty()) {
+        break;
+      }
+      std::discrete_distribution<int> choose(flows.begin(), flows.end());
+      const Edge* e = candidates[choose(generator)];
+      path.push_back(e->id());
+      current = e->v().id();
+      visited.insert(current);
+    }
+    if (current == target_id && distinct_paths.insert(path).second) {
+      paths.emplace_back(path.begin(), path.end());
+    }
+  }
+  // The restriction of a path must also respect AddPhiConstraint(true).
+  for (const auto& [edge_id, e] : edges_) {
+    if (e->phi_value_.value_or(false)) {
+      paths.erase(std::remove_if(paths.begin(), paths.end(),
+                                 [id = edge_id](const std::set<EdgeId>& path) {
+                                   return path.count(id) == 0;
+                                 }),
+                  paths.end());
+    }
+  }
+  if (paths.empty()) {
+    return result;
+  }
+
+  // Solve the convex restriction of each path (with ϕ = 1 on its edges).
+  std::vector<std::unique_ptr<ShortestPathProgram>> restrictions;
+  std::vector<const MathematicalProgram*> progs;
+  for (const std::set<EdgeId>& path : paths) {
+    restrictions.push_back(
+        MakeShortestPathProgram(source_id, target_id, path, true, true));
+    progs.push_back(&restrictions.back()->prog);
+  }
+  const std::vector<const solvers::SolverOptions*> all_solver_options(
+      progs.size(), &solver_options);
+  std::optional<solvers::SolverId> solver_id;
+  if (options.solver) {
+    solver_id = options.solver->solver_id();
+  }
+  std::vector<MathematicalProgramResult> path_results =
+      solvers::SolveInParallel(progs, nullptr, &all_solver_options, solver_id,
+                               options.parallelism);
+
+  // Return the best of the restrictions, or the relaxation if none of them
+  // succeeded.
+  int best = -1;
+  for (int i = 0; i < static_cast<int>(path_results.size()); ++i) {
+    if (path_results[i].is_success() &&
+        (best < 0 || path_results[i].get_optimal_cost() <
+                         path_results[best].get_optimal_cost())) {
+      best = i;
+    }
+  }
+  if (best < 0) {
+    return result;
+  }
+  AddPlaceholderSolutions(*restrictions[best], target_id, &path_results[best]);
+  return std::move(path_results[best]);
+}
+
+std::set<EdgeId> GraphOfConvexSets::FindShortestPathEdges(
+    VertexId source_id, VertexId target_id) const {
+  std::map<VertexId, std::vector<const Edge*>> incoming_edges;
+  std::map<VertexId, std::vector<const Edge*>> outgoing_edges;
+  for (const auto& [edge_id, e] : edges_) {
+    outgoing_edges[e->u().id()].emplace_back(e.get());
+    incoming_edges[e->v().id()].emplace_back(e.get());
+  }
+
+  // A path never leaves the target nor re-enters the source, so the searches
+  // stop at those vertices.
+  auto search = [](VertexId start, VertexId stop,
+                   const std::map<VertexId, std::vector<const Edge*>>& edges,
+                   bool forward) {
+    std::set<VertexId> reached{start};
+    std::vector<VertexId> frontier{start};
+    while (!frontier.empty()) {
+      const VertexId u = frontier.back();
+      frontier.pop_back();
+      if (u == stop) {
+        continue;
+      }
+      const auto iter = edges.find(u);
+      if (iter == edges.end()) {
+        continue;
+      }
+      for (const Edge* e : iter->second) {
+        const VertexId v = forward ? e->v().id() : e->u().id();
+        if (reached.insert(v).second) {
+          frontier.push_back(v);
+        }
+      }
+    }
+    return reached;
+  };
+  const std::set<VertexId> from_source =
+      search(source_id, target_id, outgoing_edges, true);
+  const std::set<VertexId> to_target =
+      search(target_id, source_id, incoming_edges, false);
+
+  // An edge can only be on a path if its tail is reachable from the source
+  // and the target is reachable from its head. Self-loops, edges into the
+  // source, and edges out of the target can never be on a path. Edges that
+  // the user has required to be on the path are always kept, so that an
+  // infeasible requirement still makes the problem infeasible.
+  std::set<EdgeId> active_edges;
+  for (const auto& [edge_id, e] : edges_) {
+    const VertexId u = e->u().id();
+    const VertexId v = e->v().id();
+    const bool can_be_on_path = u != v && u != target_id && v != source_id &&
+                                from_source.count(u) > 0 &&
+                                to_target.count(v) > 0;
+    if (can_be_on_path || e->phi_value_.value_or(false)) {
+      active_edges.insert(edge_id);
+    }
+  }
+  return active_edges;
+}
+
+std::unique_ptr<GraphOfConvexSets::ShortestPathProgram>
+GraphOfConvexSets::MakeShortestPathProgram(VertexId source_id,
+                                           VertexId target_id,
+                                           const std::set<EdgeId>& active_edges,
+                                           bool convex_relaxation,
+                                           bool on_path) const {
+  DRAKE_DEMAND(convex_relaxation || !on_path);
+  auto spp = std::make_unique<ShortestPathProgram>();
+  spp->convex_relaxation = convex_relaxation;
+  spp->active_edges = active_edges;
+  MathematicalProgram& prog = spp->prog;
+  std::map<VertexId, std::vector<Edge*>>& incoming_edges = spp->incoming_edges;
+  std::map<VertexId, std::vector<Edge*>>& outgoing_edges = spp->outgoing_edges;
+  std::map<EdgeId, Variable>& relaxed_phi = spp->relaxed_phi;
+  const double inf = std::numeric_limits<double>::infinity();
 
   for (const auto& [edge_id, e] : edges_) {
+    if (active_edges.count(edge_id) == 0) {
+      continue;
+    }
     outgoing_edges[e->u().id()].emplace_back(e.get());
     incoming_edges[e->v().id()].emplace_back(e.get());
 
@@ -290,14 +512,26 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
       double phi_value = *e->phi_value_ ? 1.0 : 0.0;
       prog.AddBoundingBoxConstraint(phi_value, phi_value, phi);
     }
+    if (on_path) {
+      prog.AddBoundingBoxConstraint(1, 1, phi);
+    }
     prog.AddDecisionVariables(e->y_);
     prog.AddDecisionVariables(e->z_);
     prog.AddDecisionVariables(e->ell_);
     prog.AddLinearCost(VectorXd::Ones(e->ell_.size()), e->ell_);
 
     // Spatial non-negativity: y ∈ ϕX, z ∈ ϕX.
-    e->u().set().AddPointInNonnegativeScalingConstraints(&prog, e->y_, phi);
-    e->v().set().AddPointInNonnegativeScalingConstraints(&prog, e->z_, phi);
+    auto add_scaling_constraints = [&](const Vertex& vertex,
+                                       const VectorX<Variable>& vars) {
+      const std::vector<Binding<Constraint>> bindings =
+          vertex.set().AddPointInNonnegativeScalingConstraints(&prog, vars,
+                                                               phi);
+      std::vector<Binding<Constraint>>& recorded =
+          spp->scaling_constraints[vertex.id()];
+      recorded.insert(recorded.end(), bindings.begin(), bindings.end());
+    };
+    add_scaling_constraints(e->u(), e->y_);
+    add_scaling_constraints(e->v(), e->z_);
 
     // Edge costs.
     for (int i = 0; i < e->ell_.size(); ++i) {
@@ -576,41 +810,49 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
     }
   }
 
-  solvers::SolverOptions options;
-  if (solver_options) {
-    options = *solver_options;
-  }
-  MathematicalProgramResult result;
-  if (solver) {
-    solver->Solve(prog, {}, options, &result);
-  } else {
-    result = solvers::Solve(prog, {}, options);
-  }
+  return spp;
+}
 
+void GraphOfConvexSets::AddPlaceholderSolutions(
+    const ShortestPathProgram& spp, VertexId target_id,
+    MathematicalProgramResult* result) const {
   // Push the placeholder variables into the result, so that they can be
-  // accessed as if they were real variables.
-  int num_placeholder_vars = relaxed_phi.size();
+  // accessed as if they were real variables.  The variables of the inactive
+  // edges are all zero.
+  int num_placeholder_vars = spp.relaxed_phi.size();
   for (const std::pair<const VertexId, std::unique_ptr<Vertex>>& vpair :
        vertices_) {
     num_placeholder_vars += vpair.second->ambient_dimension();
   }
+  for (const auto& [edge_id, e] : edges_) {
+    if (spp.active_edges.count(edge_id) == 0) {
+      num_placeholder_vars +=
+          1 + e->y_.size() + e->z_.size() + e->ell_.size();
+    }
+  }
   std::unordered_map<symbolic::Variable::Id, int> decision_variable_index =
-      prog.decision_variable_index();
-  int count = result.get_x_val().size();
+      spp.prog.decision_variable_index();
+  int count = result->get_x_val().size();
   Eigen::VectorXd x_val(count + num_placeholder_vars);
-  x_val.head(count) = result.get_x_val();
+  x_val.head(count) = result->get_x_val();
   for (const std::pair<const VertexId, std::unique_ptr<Vertex>>& vpair :
        vertices_) {
     const Vertex* v = vpair.second.get();
     const bool is_target = (target_id == v->id());
     VectorXd x_v = VectorXd::Zero(v->ambient_dimension());
     if (is_target) {
-      for (const auto& e : incoming_edges[v->id()]) {
-        x_v += result.GetSolution(e->z_);
+      const auto iter = spp.incoming_edges.find(v->id());
+      if (iter != spp.incoming_edges.end()) {
+        for (const auto& e : iter->second) {
+          x_v += result->GetSolution(e->z_);
+        }
       }
     } else {
-      for (const auto& e : outgoing_edges[v->id()]) {
-        x_v += result.GetSolution(e->y_);
+      const auto iter = spp.outgoing_edges.find(v->id());
+      if (iter != spp.outgoing_edges.end()) {
+        for (const auto& e : iter->second) {
+          x_v += result->GetSolution(e->y_);
+        }
       }
     }
     for (int i = 0; i < v->ambient_dimension(); ++i) {
@@ -618,24 +860,125 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
       x_val[count++] = x_v[i];
     }
   }
-  if (convex_relaxation) {
+  if (spp.convex_relaxation) {
     // Write the value of the relaxed phi into the phi placeholder.
-    for (const auto& [edge_id, relaxed_phi_var] : relaxed_phi) {
+    for (const auto& [edge_id, relaxed_phi_var] : spp.relaxed_phi) {
       decision_variable_index.emplace(edges_.at(edge_id)->phi_.get_id(), count);
-      x_val[count++] = result.GetSolution(relaxed_phi_var);
+      x_val[count++] = result->GetSolution(relaxed_phi_var);
     }
   }
-  result.set_decision_variable_index(decision_variable_index);
-  result.set_x_val(x_val);
-  return result;
+  for (const auto& [edge_id, e] : edges_) {
+    if (spp.active_edges.count(edge_id) > 0) {
+      continue;
+    }
+    auto add_zeros = [&](const VectorX<Variable>& vars) {
+      for (int i = 0; i < vars.size(); ++i) {
+        decision_variable_index.emplace(vars[i].get_id(), count);
+        x_val[count++] = 0.0;
+      }
+    };
+    add_zeros(Vector1<Variable>(e->phi_));
+    add_zeros(e->y_);
+    add_zeros(e->z_);
+    add_zeros(e->ell_);
+  }
+  result->set_decision_variable_index(decision_variable_index);
+  result->set_x_val(x_val);
 }
 
-MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
-    const Vertex& source, const Vertex& target, bool convex_relaxation,
-    const solvers::SolverInterface* solver,
-    const std::optional<solvers::SolverOptions>& solver_options) const {
-  return SolveShortestPath(source.id(), target.id(), convex_relaxation, solver,
-                           solver_options);
+std::unique_ptr<GraphOfConvexSets::CompiledShortestPath>
+GraphOfConvexSets::CompileShortestPath(
+    VertexId source_id, VertexId target_id,
+    const GraphOfConvexSetsOptions& options) const {
+  // The constructor is private, so std::make_unique can't be used here.
+  return std::unique_ptr<CompiledShortestPath>(
+      new CompiledShortestPath(this, source_id, target_id, options));
+}
+
+GraphOfConvexSets::CompiledShortestPath::CompiledShortestPath(
+    const GraphOfConvexSets* gcs, VertexId source_id, VertexId target_id,
+    const GraphOfConvexSetsOptions& options)
+    : gcs_(gcs), source_id_(source_id), target_id_(target_id) {
+  DRAKE_DEMAND(gcs_ != nullptr);
+  DRAKE_DEMAND(gcs_->vertices_.find(source_id) != gcs_->vertices_.end());
+  DRAKE_DEMAND(gcs_->vertices_.find(target_id) != gcs_->vertices_.end());
+  for (VertexId id : {source_id, target_id}) {
+    const Vertex& v = *gcs_->vertices_.at(id);
+    if (dynamic_cast<const Point*>(&v.set()) == nullptr) {
+      throw std::runtime_error(fmt::format(
+          "CompileShortestPath: the set of vertex {} must be a Point.",
+          v.name()));
+    }
+  }
+  if (options.max_rounded_paths > 0) {
+    throw std::runtime_error(
+        "CompileShortestPath does not support rounding; set "
+        "GraphOfConvexSetsOptions::max_rounded_paths to zero.");
+  }
+
+  std::set<EdgeId> active_edges;
+  if (options.preprocessing) {
+    active_edges = gcs_->FindShortestPathEdges(source_id, target_id);
+  } else {
+    for (const auto& [edge_id, e] : gcs_->edges_) {
+      active_edges.insert(edge_id);
+    }
+  }
+  spp_ = gcs_->MakeShortestPathProgram(source_id, target_id, active_edges,
+                                       options.convex_relaxation, false);
+
+  if (options.solver) {
+    solver_ = options.solver;
+  } else {
+    owned_solver_ = solvers::MakeSolver(solvers::ChooseBestSolver(spp_->prog));
+    solver_ = owned_solver_.get();
+  }
+  if (options.solver_options) {
+    solver_options_ = *options.solver_options;
+  }
+}
+
+GraphOfConvexSets::CompiledShortestPath::~CompiledShortestPath() = default;
+
+void GraphOfConvexSets::CompiledShortestPath::UpdatePoint(
+    VertexId vertex_id, const Ref<const VectorXd>& point) {
+  const Vertex& v = *gcs_->vertices_.at(vertex_id);
+  if (point.size() != v.ambient_dimension()) {
+    throw std::runtime_error(fmt::format(
+        "CompiledShortestPath::Solve: the point for vertex {} has size {}, but "
+        "its set has ambient dimension {}.",
+        v.name(), point.size(), v.ambient_dimension()));
+  }
+  const auto iter = spp_->scaling_constraints.find(vertex_id);
+  if (iter == spp_->scaling_constraints.end()) {
+    return;
+  }
+  // Point adds x == t * point as the linear equality [I, -point] [x; t] == 0.
+  const int n = point.size();
+  MatrixXd Aeq(n, n + 1);
+  Aeq.leftCols(n) = MatrixXd::Identity(n, n);
+  Aeq.col(n) = -point;
+  for (const Binding<Constraint>& binding : iter->second) {
+    auto constraint =
+        std::dynamic_pointer_cast<LinearEqualityConstraint>(binding.evaluator());
+    DRAKE_DEMAND(constraint != nullptr);
+    constraint->UpdateCoefficients(Aeq, VectorXd::Zero(n));
+  }
+}
+
+MathematicalProgramResult GraphOfConvexSets::CompiledShortestPath::Solve(
+    const Ref<const VectorXd>& source_point,
+    const Ref<const VectorXd>& target_point) {
+  UpdatePoint(source_id_, source_point);
+  UpdatePoint(target_id_, target_point);
+
+  MathematicalProgramResult result;
+  solver_->Solve(spp_->prog, initial_guess_, solver_options_, &result);
+  if (result.is_success()) {
+    initial_guess_ = result.get_x_val();
+  }
+  gcs_->AddPlaceholderSolutions(*spp_, target_id_, &result);
+  return result;
 }
 
 }  // namespace optimization
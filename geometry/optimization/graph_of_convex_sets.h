@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/symbolic.h"
 #include "drake/geometry/optimization/convex_set.h"
 #include "drake/solvers/mathematical_program_result.h"
@@ -21,6 +22,49 @@ namespace drake {
 namespace geometry {
 namespace optimization {
 
+/** Options for GraphOfConvexSets::SolveShortestPath().
+
+@experimental
+@ingroup geometry_optimization */
+struct GraphOfConvexSetsOptions {
+  /** Solves the convex relaxation of the problem instead of the mixed-integer
+  problem.  See GraphOfConvexSets::SolveShortestPath(). */
+  bool convex_relaxation{false};
+
+  /** Before formulating the problem, removes the edges that cannot be on any
+  path from the source to the target: those whose tail is not reachable from
+  the source or whose head cannot reach the target, self-loops, edges into the
+  source, and edges out of the target.  This does not change the optimal
+  solution, but can make the program much smaller.  The removed edges are
+  reported as inactive (ϕ = 0) in the result. */
+  bool preprocessing{true};
+
+  /** When solving the convex relaxation, the maximum number of distinct paths
+  to sample from the relaxed flows (randomized rounding).  The convex
+  restriction of each path (its edges' ϕ fixed to 1) is solved, and the best
+  successful one is returned instead of the relaxation.  Zero (the default)
+  disables rounding. */
+  int max_rounded_paths{0};
+
+  /** The maximum number of random walks used to find the
+  `max_rounded_paths` distinct paths. */
+  int max_rounding_trials{100};
+
+  /** The seed for the random walks of the rounding stage. */
+  int rounding_seed{0};
+
+  /** The maximum number of threads used to solve the convex restrictions of
+  the rounded paths. */
+  Parallelism parallelism{Parallelism::Max()};
+
+  /** The optimizer to be used.  If not set, the best solver for the given
+  problem is selected. */
+  const solvers::SolverInterface* solver{nullptr};
+
+  /** The options passed to the solver. */
+  std::optional<solvers::SolverOptions> solver_options{std::nullopt};
+};
+
 /**
 GraphOfConvexSets implements the design pattern and optimization problems first
 introduced in the paper "Shortest Paths in Graphs of Convex Sets".
@@ -369,11 +413,105 @@ class GraphOfConvexSets {
       const std::optional<solvers::SolverOptions>& solver_options =
           std::nullopt) const;
 
+  /** Formulates and solves the shortest path problem as above, with the
+  additional preprocessing and rounding stages described by @p options.
+  @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+  */
+  solvers::MathematicalProgramResult SolveShortestPath(
+      VertexId source_id, VertexId target_id,
+      const GraphOfConvexSetsOptions& options) const;
+
+  class CompiledShortestPath;
+
+  /** Formulates the shortest path problem from @p source_id to @p target_id
+  once, so that it can be solved repeatedly for different source and target
+  points without rebuilding the optimization program.  The sets of both the
+  source and the target vertices must be Point sets; their values are replaced
+  by the points passed to CompiledShortestPath::Solve().
+
+  The returned object refers to this graph, which must outlive it.  Changes
+  made to the graph after compilation (vertices, edges, costs, constraints,
+  or phi values) are not reflected in the compiled program.
+
+  @throws std::exception if the source or target set is not a Point, or if
+  `options.max_rounded_paths` is positive (rounding is not supported by the
+  compiled program).
+  @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+  */
+  std::unique_ptr<CompiledShortestPath> CompileShortestPath(
+      VertexId source_id, VertexId target_id,
+      const GraphOfConvexSetsOptions& options = {}) const;
+
  private:
+  // The optimization program for SolveShortestPath(), along with the
+  // bookkeeping needed to write its solution onto the placeholder variables.
+  struct ShortestPathProgram;
+
+  // Returns the ids of the edges that can be on a path from the source to the
+  // target. See GraphOfConvexSetsOptions::preprocessing.
+  std::set<EdgeId> FindShortestPathEdges(VertexId source_id,
+                                         VertexId target_id) const;
+
+  // Formulates the shortest path problem using only the `active_edges`.  When
+  // `on_path` is true, every active edge is constrained to be on the path,
+  // which (with `convex_relaxation`) gives the convex restriction of a path.
+  std::unique_ptr<ShortestPathProgram> MakeShortestPathProgram(
+      VertexId source_id, VertexId target_id,
+      const std::set<EdgeId>& active_edges, bool convex_relaxation,
+      bool on_path) const;
+
+  // Adds the values of the vertex and edge placeholder variables to the
+  // `result` of solving `spp.prog`.
+  void AddPlaceholderSolutions(const ShortestPathProgram& spp,
+                               VertexId target_id,
+                               solvers::MathematicalProgramResult* result) const;
+
   std::map<VertexId, std::unique_ptr<Vertex>> vertices_{};
   std::map<EdgeId, std::unique_ptr<Edge>> edges_{};
 };
 
+/** A shortest path problem that has been formulated once by
+GraphOfConvexSets::CompileShortestPath(), and can be solved many times for
+different source and target points.  Each query only updates the coefficients
+of the constraints that pin the path endpoints; the solution of the previous
+successful query is passed to the solver as the initial guess.
+@exclude_from_pydrake_mkdoc{Not bound in pydrake.} */
+class GraphOfConvexSets::CompiledShortestPath {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CompiledShortestPath)
+
+  ~CompiledShortestPath();
+
+  /** Solves the shortest path problem from @p source_point to
+  @p target_point.  The result can be queried using the vertex and edge
+  placeholder variables, exactly as for GraphOfConvexSets::SolveShortestPath().
+  @throws std::exception if the size of either point does not match the
+  ambient dimension of its vertex. */
+  solvers::MathematicalProgramResult Solve(
+      const Eigen::Ref<const Eigen::VectorXd>& source_point,
+      const Eigen::Ref<const Eigen::VectorXd>& target_point);
+
+ private:
+  friend class GraphOfConvexSets;
+
+  CompiledShortestPath(const GraphOfConvexSets* gcs, VertexId source_id,
+                       VertexId target_id,
+                       const GraphOfConvexSetsOptions& options);
+
+  // Sets the point of every x == t * point constraint on the vertex's set.
+  void UpdatePoint(VertexId vertex_id,
+                   const Eigen::Ref<const Eigen::VectorXd>& point);
+
+  const GraphOfConvexSets* gcs_{};
+  VertexId source_id_;
+  VertexId target_id_;
+  std::unique_ptr<ShortestPathProgram> spp_;
+  std::unique_ptr<solvers::SolverInterface> owned_solver_;
+  const solvers::SolverInterface* solver_{};
+  solvers::SolverOptions solver_options_;
+  std::optional<Eigen::VectorXd> initial_guess_;
+};
+
 }  // namespace optimization
 }  // namespace geometry
 }  // namespace drake
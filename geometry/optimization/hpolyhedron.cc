@@ -3,12 +3,14 @@
 #include <limits>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 #include <Eigen/Eigenvalues>
 #include <fmt/format.h>
 
 #include "drake/math/matrix_util.h"
 #include "drake/math/rotation_matrix.h"
+#include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/solve.h"
 
 namespace drake {
@@ -98,13 +100,12 @@ VectorXd HPolyhedron::ChebyshevCenter() const {
   // r ≥ 0.
   prog.AddBoundingBoxConstraint(0, inf, r);
 
-  // aᵢᵀ x + |aᵢ| r ≤ bᵢ.
-  RowVectorXd a(A_.cols() + 1);
-  for (int i = 0; i < A_.rows(); i++) {
-    a[0] = A_.row(i).norm();
-    a.tail(A_.cols()) = A_.row(i);
-    prog.AddLinearConstraint(a, -inf, b_[i], {r, x});
-  }
+  // aᵢᵀ x + |aᵢ| r ≤ bᵢ, added as a single constraint for all rows.
+  MatrixXd A_bar(A_.rows(), A_.cols() + 1);
+  A_bar.col(0) = A_.rowwise().norm();
+  A_bar.rightCols(A_.cols()) = A_;
+  prog.AddLinearConstraint(A_bar, VectorXd::Constant(b_.size(), -inf), b_,
+                           {r, x});
 
   auto result = solvers::Solve(prog);
   if (!result.is_success()) {
@@ -147,6 +148,107 @@ HPolyhedron HPolyhedron::Intersection(const HPolyhedron& other) const {
   return {A_intersect, b_intersect};
 }
 
+HPolyhedron HPolyhedron::ReduceInequalities(double tol) const {
+  DRAKE_DEMAND(tol >= 0);
+  const int m = A_.rows();
+  const int n = A_.cols();
+  const double inf = std::numeric_limits<double>::infinity();
+  std::vector<bool> keep(m, true);
+
+  // Cheap pass: drop vacuous rows (0 ≤ bᵢ) and rows that are parallel to a
+  // row which is at least as tight.  Rows are compared after normalization.
+  const VectorXd norms = A_.rowwise().norm();
+  for (int i = 0; i < m; ++i) {
+    if (norms[i] == 0) {
+      // 0 ≤ bᵢ is either vacuous or makes the set empty; keep the latter.
+      keep[i] = !(b_[i] >= -tol);
+    }
+  }
+  for (int i = 0; i < m; ++i) {
+    if (!keep[i] || norms[i] == 0) {
+      continue;
+    }
+    for (int j = i + 1; j < m; ++j) {
+      if (!keep[j] || norms[j] == 0) {
+        continue;
+      }
+      const double cosine = A_.row(i).dot(A_.row(j)) / (norms[i] * norms[j]);
+      if (cosine < 1 - tol) {
+        continue;
+      }
+      const double b_i = b_[i] / norms[i];
+      const double b_j = b_[j] / norms[j];
+      if (b_i <= b_j) {
+        keep[j] = false;
+      } else {
+        keep[i] = false;
+        break;
+      }
+    }
+  }
+
+  // LP pass: row i is redundant iff max aᵢᵀx subject to the other kept rows
+  // (and aᵢᵀx ≤ bᵢ + 1, which keeps the program bounded) is at most bᵢ.
+  MathematicalProgram prog;
+  VectorXDecisionVariable x = prog.NewContinuousVariables(n, "x");
+  VectorXd ub(m);
+  for (int i = 0; i < m; ++i) {
+    ub[i] = keep[i] ? b_[i] : inf;
+  }
+  auto constraint =
+      prog.AddLinearConstraint(A_, VectorXd::Constant(m, -inf), ub, x)
+          .evaluator();
+  auto cost = prog.AddLinearCost(VectorXd::Zero(n), x).evaluator();
+  std::unique_ptr<solvers::SolverInterface> solver;
+  for (int i = 0; i < m; ++i) {
+    if (!keep[i] || norms[i] == 0) {
+      continue;
+    }
+    cost->UpdateCoefficients(-A_.row(i).transpose());
+    ub[i] = b_[i] + 1;
+    constraint->UpdateUpperBound(ub);
+    if (solver == nullptr) {
+      solver = solvers::MakeSolver(solvers::ChooseBestSolver(prog));
+    }
+    solvers::MathematicalProgramResult result;
+    solver->Solve(prog, std::nullopt, std::nullopt, &result);
+    // If the program is infeasible then the set is empty; conservatively keep
+    // the row.
+    if (result.is_success() && -result.get_optimal_cost() <= b_[i] + tol) {
+      keep[i] = false;
+      ub[i] = inf;
+    } else {
+      ub[i] = b_[i];
+    }
+  }
+
+  std::vector<int> kept_rows;
+  for (int i = 0; i < m; ++i) {
+    if (keep[i]) {
+      kept_rows.push_back(i);
+    }
+  }
+  MatrixXd A_reduced(kept_rows.size(), n);
+  VectorXd b_reduced(kept_rows.size());
+  for (int k = 0; k < static_cast<int>(kept_rows.size()); ++k) {
+    A_reduced.row(k) = A_.row(kept_rows[k]);
+    b_reduced[k] = b_[kept_rows[k]];
+  }
+  return {A_reduced, b_reduced};
+}
+
+Eigen::Array<bool, Eigen::Dynamic, 1> HPolyhedron::PointsInSet(
+    const Eigen::Ref<const MatrixXd>& x, double tol) const {
+  DRAKE_DEMAND(x.rows() == ambient_dimension());
+  if (A_.rows() == 0) {
+    return Eigen::Array<bool, Eigen::Dynamic, 1>::Constant(x.cols(), true);
+  }
+  // The largest violation of each point (column).
+  const Eigen::RowVectorXd violation =
+      ((A_ * x).colwise() - b_).colwise().maxCoeff();
+  return (violation.transpose().array() <= tol);
+}
+
 HPolyhedron HPolyhedron::MakeBox(const Eigen::Ref<const VectorXd>& lb,
                                  const Eigen::Ref<const VectorXd>& ub) {
   DRAKE_DEMAND(lb.size() == ub.size());
@@ -191,7 +293,13 @@ bool HPolyhedron::DoIsBounded() const {
 bool HPolyhedron::DoPointInSet(const Eigen::Ref<const VectorXd>& x,
                                double tol) const {
   DRAKE_DEMAND(A_.cols() == x.size());
-  return ((A_ * x).array() <= b_.array() + tol).all();
+  // Check one row at a time, so that we can exit early without allocating.
+  for (int i = 0; i < A_.rows(); ++i) {
+    if (A_.row(i).dot(x) > b_[i] + tol) {
+      return false;
+    }
+  }
+  return true;
 }
 
 void HPolyhedron::DoAddPointInSetConstraints(
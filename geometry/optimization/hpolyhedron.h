@@ -100,9 +100,32 @@ class HPolyhedron final : public ConvexSet {
   repeated n times. */
   HPolyhedron CartesianPower(int n) const;
 
-  /** Returns the intersection of `this` and `other`. */
+  /** Returns the intersection of `this` and `other`.  The inequalities of
+  both sets are simply stacked; use ReduceInequalities() on the result to
+  remove the ones that are redundant. */
   HPolyhedron Intersection(const HPolyhedron& other) const;
 
+  /** Returns an HPolyhedron describing the same set as `this`, with the
+  redundant inequalities removed.  An inequality is redundant if removing it
+  does not change the set, up to @p tol.  Inequalities with a zero normal and
+  inequalities that are parallel to a tighter (or equal) inequality are removed
+  without any optimization; each remaining inequality is then tested by
+  solving a linear program that maximizes its left-hand side subject to the
+  inequalities that are kept.  All of the linear programs share a single
+  MathematicalProgram and solver, and only their coefficients are updated.
+
+  When two inequalities are identical up to a positive scaling, the first one
+  is kept.  The returned inequalities keep their relative order.
+  @pre tol ≥ 0. */
+  HPolyhedron ReduceInequalities(double tol = 1E-9) const;
+
+  /** Returns, for each column of @p x, whether that point is contained in the
+  set.  This is equivalent to calling PointInSet() on every column, but
+  evaluates all of the inequalities with a single matrix product.
+  @pre x.rows() == ambient_dimension(). */
+  Eigen::Array<bool, Eigen::Dynamic, 1> PointsInSet(
+      const Eigen::Ref<const Eigen::MatrixXd>& x, double tol = 0) const;
+
   /** Constructs a polyhedron as an axis-aligned box from the lower and upper
   corners. */
   static HPolyhedron MakeBox(const Eigen::Ref<const Eigen::VectorXd>& lb,
@@ -2,13 +2,18 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
+#include <numeric>
 #include <optional>
+#include <random>
+#include <set>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "drake/common/random.h"
 #include "drake/geometry/optimization/cartesian_product.h"
 #include "drake/geometry/optimization/convex_set.h"
 #include "drake/geometry/optimization/minkowski_sum.h"
@@ -18,6 +23,7 @@
 #include "drake/solvers/ibex_solver.h"
 #include "drake/solvers/ipopt_solver.h"
 #include "drake/solvers/snopt_solver.h"
+#include "drake/solvers/solve.h"
 
 namespace drake {
 namespace geometry {
@@ -316,26 +322,26 @@ class SamePointConstraint : public solvers::Constraint {
   std::unique_ptr<Context<Expression>> symbolic_context_{nullptr};
 };
 
-// Solves the optimization
+// Makes the optimization
 // min_q (q-d)*CᵀC(q-d)
 // s.t. setA in frameA and setB in frameB are in collision in q.
 //      Aq ≤ b.
-// where C, d are the matrix and center from the hyperellipsoid E.
-// Returns true iff a collision is found.
-// Sets `closest` to an optimizing solution q*, if a solution is found.
-bool FindClosestCollision(
+// where C, d are the matrix and center from the hyperellipsoid E, to be solved
+// by the solver with id `solver_id`. The first A.cols() decision variables of
+// the returned program are q.
+std::unique_ptr<solvers::MathematicalProgram> MakeClosestCollisionProgram(
     std::shared_ptr<SamePointConstraint> same_point_constraint,
     const multibody::Frame<double>& frameA,
     const multibody::Frame<double>& frameB, const ConvexSet& setA,
     const ConvexSet& setB, const Hyperellipsoid& E,
     const Eigen::Ref<const Eigen::MatrixXd>& A,
     const Eigen::Ref<const Eigen::VectorXd>& b,
-    const solvers::SolverInterface& solver,
-    const Eigen::Ref<const Eigen::VectorXd>& q_guess, VectorXd* closest) {
-  solvers::MathematicalProgram prog;
-  auto q = prog.NewContinuousVariables(A.cols(), "q");
+    const solvers::SolverId& solver_id,
+    const Eigen::Ref<const Eigen::VectorXd>& q_guess) {
+  auto prog = std::make_unique<solvers::MathematicalProgram>();
+  auto q = prog->NewContinuousVariables(A.cols(), "q");
 
-  prog.AddLinearConstraint(
+  prog->AddLinearConstraint(
       A, VectorXd::Constant(b.size(), -std::numeric_limits<double>::infinity()),
       b, q);
   // Scale the objective so the eigenvalues are close to 1, using
@@ -344,45 +350,62 @@ bool FindClosestCollision(
   Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(Asq);
   const double scale = 1.0 / std::sqrt(es.eigenvalues().maxCoeff() *
                                        es.eigenvalues().minCoeff());
-  prog.AddQuadraticErrorCost(scale * Asq, E.center(), q);
+  prog->AddQuadraticErrorCost(scale * Asq, E.center(), q);
 
-  auto p_AA = prog.NewContinuousVariables<3>("p_AA");
-  auto p_BB = prog.NewContinuousVariables<3>("p_BB");
-  setA.AddPointInSetConstraints(&prog, p_AA);
-  setB.AddPointInSetConstraints(&prog, p_BB);
+  auto p_AA = prog->NewContinuousVariables<3>("p_AA");
+  auto p_BB = prog->NewContinuousVariables<3>("p_BB");
+  setA.AddPointInSetConstraints(prog.get(), p_AA);
+  setB.AddPointInSetConstraints(prog.get(), p_BB);
 
   same_point_constraint->set_frameA(&frameA);
   same_point_constraint->set_frameB(&frameB);
-  prog.AddConstraint(same_point_constraint, {q, p_AA, p_BB});
+  prog->AddConstraint(same_point_constraint, {q, p_AA, p_BB});
 
   // Help nonlinear optimizers (e.g. SNOPT) avoid trivial local minima at the
   // origin.
-  prog.SetInitialGuess(q, q_guess);
-  prog.SetInitialGuess(p_AA, Vector3d::Constant(.01));
-  prog.SetInitialGuess(p_BB, Vector3d::Constant(.01));
+  prog->SetInitialGuess(q, q_guess);
+  prog->SetInitialGuess(p_AA, Vector3d::Constant(.01));
+  prog->SetInitialGuess(p_BB, Vector3d::Constant(.01));
 
-  if (solver.solver_id() == solvers::IbexSolver::id()) {
-    prog.SetSolverOption(solvers::IbexSolver::id(), "rigor", true);
+  if (solver_id == solvers::IbexSolver::id()) {
+    prog->SetSolverOption(solvers::IbexSolver::id(), "rigor", true);
     // Use kNonconvex instead of the default kConvexSmooth.
     std::vector<solvers::Binding<solvers::LorentzConeConstraint>> to_replace =
-        prog.lorentz_cone_constraints();
+        prog->lorentz_cone_constraints();
     for (const auto& binding : to_replace) {
       const auto c = binding.evaluator();
-      prog.AddConstraint(
+      prog->AddConstraint(
           std::make_shared<solvers::LorentzConeConstraint>(
               c->A_dense(), c->b(),
               solvers::LorentzConeConstraint::EvalType::kNonconvex),
           binding.variables());
     }
     for (const auto& binding : to_replace) {
-      prog.RemoveConstraint(binding);
+      prog->RemoveConstraint(binding);
     }
   }
+  return prog;
+}
 
+// Solves the optimization from MakeClosestCollisionProgram().
+// Returns true iff a collision is found.
+// Sets `closest` to an optimizing solution q*, if a solution is found.
+bool FindClosestCollision(
+    std::shared_ptr<SamePointConstraint> same_point_constraint,
+    const multibody::Frame<double>& frameA,
+    const multibody::Frame<double>& frameB, const ConvexSet& setA,
+    const ConvexSet& setB, const Hyperellipsoid& E,
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::VectorXd>& b,
+    const solvers::SolverInterface& solver,
+    const Eigen::Ref<const Eigen::VectorXd>& q_guess, VectorXd* closest) {
+  const std::unique_ptr<solvers::MathematicalProgram> prog =
+      MakeClosestCollisionProgram(same_point_constraint, frameA, frameB, setA,
+                                  setB, E, A, b, solver.solver_id(), q_guess);
   solvers::MathematicalProgramResult result;
-  solver.Solve(prog, std::nullopt, std::nullopt, &result);
+  solver.Solve(*prog, std::nullopt, std::nullopt, &result);
   if (result.is_success()) {
-    *closest = result.GetSolution(q);
+    *closest = result.GetSolution(prog->decision_variables().head(A.cols()));
     return true;
   }
   return false;
@@ -421,19 +444,170 @@ struct GeometryPairWithDistance {
   }
 };
 
-}  // namespace
+// The convex sets and body frames of every proximity geometry of a plant.
+// The sets are expressed in their geometry's frame, so these do not depend on
+// the plant's configuration and may be shared when growing many regions.
+struct ConfigurationSpaceObstacles {
+  std::unordered_map<GeometryId, copyable_unique_ptr<ConvexSet>> sets;
+  std::unordered_map<GeometryId, const multibody::Frame<double>*> frames;
+};
 
-HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
-                                     const Context<double>& context,
-                                     const IrisOptions& options) {
-  // Check the inputs.
-  plant.ValidateContext(context);
+ConfigurationSpaceObstacles MakeConfigurationSpaceObstacles(
+    const MultibodyPlant<double>& plant,
+    const QueryObject<double>& query_object) {
+  const SceneGraphInspector<double>& inspector = query_object.inspector();
+  IrisConvexSetMaker maker(query_object, inspector.world_frame_id());
+  ConfigurationSpaceObstacles obstacles;
+  const std::unordered_set<GeometryId> geom_ids = inspector.GetGeometryIds(
+      GeometrySet(inspector.GetAllGeometryIds()), Role::kProximity);
+  copyable_unique_ptr<ConvexSet> temp_set;
+  for (GeometryId geom_id : geom_ids) {
+    // Make all sets in the local geometry frame.
+    FrameId frame_id = inspector.GetFrameId(geom_id);
+    maker.set_reference_frame(frame_id);
+    maker.set_geometry_id(geom_id);
+    inspector.GetShape(geom_id).Reify(&maker, &temp_set);
+    obstacles.sets.emplace(geom_id, std::move(temp_set));
+    obstacles.frames.emplace(
+        geom_id, &plant.GetBodyFromFrameId(frame_id)->body_frame());
+  }
+  return obstacles;
+}
+
+// Finds separating hyperplanes for all of the `candidates` (indices into
+// `sorted_pairs`) at once, using `solver_id`, and adds them to
+// {x | A * x <= b}. Every candidate's counterexample
+// program is solved (in parallel) against the current polytope; the
+// counterexamples are then visited in `sorted_pairs` order, and each one that
+// is not already cut off by a hyperplane added in the same round adds its
+// tangent. The pairs that found a counterexample are solved again against the
+// shrunken polytope, until none of them do. This is the batched version of the
+// serial per-pair loop in IrisInConfigurationSpace(), and produces a (possibly
+// different) polytope with the same guarantee.
+// Returns false iff `options.require_sample_point_is_contained` and a
+// hyperplane excluded `sample`.
+bool AddSeparatingHyperplanesInParallel(
+    const std::vector<std::shared_ptr<SamePointConstraint>>&
+        same_point_constraints,
+    const std::vector<GeometryPairWithDistance>& sorted_pairs,
+    const std::vector<int>& candidates,
+    const ConfigurationSpaceObstacles& obstacles, const Hyperellipsoid& E,
+    const solvers::SolverId& solver_id,
+    const Eigen::Ref<const Eigen::VectorXd>& sample, const IrisOptions& options,
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>* A,
+    Eigen::VectorXd* b, int* num_constraints) {
+  DRAKE_DEMAND(same_point_constraints.size() == sorted_pairs.size());
+  const int nq = A->cols();
+  std::vector<int> active = candidates;
+  while (!active.empty()) {
+    // Each pair has its own SamePointConstraint (and therefore its own plant
+    // context), so that the programs can be solved concurrently.
+    std::vector<std::unique_ptr<solvers::MathematicalProgram>> progs;
+    std::vector<const solvers::MathematicalProgram*> prog_ptrs;
+    for (int k : active) {
+      const GeometryPairWithDistance& pair = sorted_pairs[k];
+      progs.push_back(MakeClosestCollisionProgram(
+          same_point_constraints[k], *obstacles.frames.at(pair.geomA),
+          *obstacles.frames.at(pair.geomB), *obstacles.sets.at(pair.geomA),
+          *obstacles.sets.at(pair.geomB), E, A->topRows(*num_constraints),
+          b->head(*num_constraints), solver_id, sample));
+      prog_ptrs.push_back(progs.back().get());
+    }
+    const std::vector<solvers::MathematicalProgramResult> results =
+        solvers::SolveInParallel(prog_ptrs, nullptr, nullptr, solver_id,
+                                 options.parallelism);
+
+    const int round_start = *num_constraints;
+    std::vector<int> next_active;
+    for (int i = 0; i < static_cast<int>(active.size()); ++i) {
+      if (!results[i].is_success()) {
+        continue;
+      }
+      next_active.push_back(active[i]);
+      const VectorXd closest =
+          results[i].GetSolution(progs[i]->decision_variables().head(nq));
+      const int num_new = *num_constraints - round_start;
+      if (((A->middleRows(round_start, num_new) * closest).array() >
+           b->segment(round_start, num_new).array())
+              .any()) {
+        continue;
+      }
+      AddTangentToPolytope(E, closest, options, A, b, num_constraints);
+      if (options.require_sample_point_is_contained &&
+          A->row(*num_constraints - 1) * sample > (*b)(*num_constraints - 1)) {
+        return false;
+      }
+    }
+    active = std::move(next_active);
+  }
+  return true;
+}
+
+// Returns the indices of the `sorted_pairs` that could plausibly be in
+// collision inside the ellipsoid E: those that come within
+// `options.collision_prefilter_distance` of each other at any of
+// `options.num_collision_prefilter_samples` configurations sampled uniformly
+// from E (plus its center). The samples are evaluated by setting the plant's
+// positions in `root_context`, which are restored before returning.
+std::vector<int> FindCandidatePairs(
+    const MultibodyPlant<double>& plant, Context<double>* root_context,
+    const std::vector<GeometryPairWithDistance>& sorted_pairs,
+    const Hyperellipsoid& E, const IrisOptions& options,
+    RandomGenerator* generator) {
+  Context<double>& context = plant.GetMyMutableContextFromRoot(root_context);
+  const VectorXd original_positions = plant.GetPositions(context);
+  const int nq = plant.num_positions();
+  const Eigen::PartialPivLU<MatrixXd> A_lu(E.A());
+  std::normal_distribution<double> normal;
+  std::uniform_real_distribution<double> uniform;
+
+  std::set<std::pair<GeometryId, GeometryId>> near_pairs;
+  for (int i = 0; i <= options.num_collision_prefilter_samples; ++i) {
+    VectorXd q = E.center();
+    if (i > 0) {
+      // A uniform sample from the unit ball, mapped into E.
+      VectorXd u(nq);
+      for (int j = 0; j < nq; ++j) {
+        u[j] = normal(*generator);
+      }
+      u *= std::pow(uniform(*generator), 1.0 / nq) / u.norm();
+      q += A_lu.solve(u);
+    }
+    plant.SetPositions(&context, q);
+    const auto& query_object =
+        plant.get_geometry_query_input_port().Eval<QueryObject<double>>(
+            context);
+    for (const SignedDistancePair<double>& pair :
+         query_object.ComputeSignedDistancePairwiseClosestPoints(
+             options.collision_prefilter_distance)) {
+      near_pairs.emplace(std::min(pair.id_A, pair.id_B),
+                         std::max(pair.id_A, pair.id_B));
+    }
+  }
+  plant.SetPositions(&context, original_positions);
+
+  std::vector<int> candidates;
+  for (int i = 0; i < static_cast<int>(sorted_pairs.size()); ++i) {
+    const GeometryPairWithDistance& pair = sorted_pairs[i];
+    if (near_pairs.count({std::min(pair.geomA, pair.geomB),
+                          std::max(pair.geomA, pair.geomB)}) > 0) {
+      candidates.push_back(i);
+    }
+  }
+  return candidates;
+}
+
+// Grows a region around the positions in `context`; this is the body of
+// IrisInConfigurationSpace() after the (configuration-independent)
+// `obstacles` have been made. The `root_context` (which must contain
+// `context`) is only needed by the collision pre-filter, and may otherwise be
+// null.
+HPolyhedron GrowConfigurationSpaceRegion(
+    const MultibodyPlant<double>& plant, const Context<double>& context,
+    Context<double>* root_context, const ConfigurationSpaceObstacles& obstacles,
+    const IrisOptions& options) {
   const int nq = plant.num_positions();
   const Eigen::VectorXd sample = plant.GetPositions(context);
-  // Note: We require finite joint limits to define the bounding box for the
-  // IRIS algorithm.
-  DRAKE_DEMAND(plant.GetPositionLowerLimits().array().isFinite().all());
-  DRAKE_DEMAND(plant.GetPositionUpperLimits().array().isFinite().all());
 
   // Make the polytope and ellipsoid.
   HPolyhedron P = HPolyhedron::MakeBox(plant.GetPositionLowerLimits(),
@@ -442,25 +616,11 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
   const double kEpsilonEllipsoid = 1e-2;
   Hyperellipsoid E = Hyperellipsoid::MakeHypersphere(kEpsilonEllipsoid, sample);
 
-  // Make all of the convex sets and supporting quantities.
   auto query_object =
       plant.get_geometry_query_input_port().Eval<QueryObject<double>>(context);
   const SceneGraphInspector<double>& inspector = query_object.inspector();
-  IrisConvexSetMaker maker(query_object, inspector.world_frame_id());
-  std::unordered_map<GeometryId, copyable_unique_ptr<ConvexSet>> sets{};
-  std::unordered_map<GeometryId, const multibody::Frame<double>*> frames{};
-  const std::unordered_set<GeometryId> geom_ids = inspector.GetGeometryIds(
-      GeometrySet(inspector.GetAllGeometryIds()), Role::kProximity);
-  copyable_unique_ptr<ConvexSet> temp_set;
-  for (GeometryId geom_id : geom_ids) {
-    // Make all sets in the local geometry frame.
-    FrameId frame_id = inspector.GetFrameId(geom_id);
-    maker.set_reference_frame(frame_id);
-    maker.set_geometry_id(geom_id);
-    inspector.GetShape(geom_id).Reify(&maker, &temp_set);
-    sets.emplace(geom_id, std::move(temp_set));
-    frames.emplace(geom_id, &plant.GetBodyFromFrameId(frame_id)->body_frame());
-  }
+  const auto& sets = obstacles.sets;
+  const auto& frames = obstacles.frames;
 
   auto pairs = inspector.GetCollisionCandidates();
   const int N = static_cast<int>(pairs.size());
@@ -502,25 +662,52 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
     same_point_constraint->EnableSymbolic();
   }
 
+  // When batching the nonlinear solves, each pair gets its own constraint.
+  std::vector<std::shared_ptr<SamePointConstraint>> same_point_constraints;
+  if (options.parallelism.num_threads() > 1) {
+    for (int i = 0; i < N; ++i) {
+      same_point_constraints.push_back(
+          std::make_shared<SamePointConstraint>(&plant, context));
+    }
+  }
+
+  std::vector<int> candidates(N);
+  std::iota(candidates.begin(), candidates.end(), 0);
+  RandomGenerator generator;
+
   while (true) {
     int num_constraints = 2 * nq;  // Start with just the joint limits.
     bool sample_point_requirement = true;
     DRAKE_ASSERT(best_volume > 0);
     // Find separating hyperplanes
 
+    // Skip the pairs that are nowhere near each other within the ellipsoid.
+    if (options.num_collision_prefilter_samples > 0) {
+      DRAKE_DEMAND(root_context != nullptr);
+      candidates = FindCandidatePairs(plant, root_context, sorted_pairs, E,
+                                      options, &generator);
+    }
+
     // First use a fast nonlinear optimizer to add as many constraint as it
     // can find.
-    for (const auto& pair : sorted_pairs) {
-      while (sample_point_requirement &&
-             FindClosestCollision(
-                 same_point_constraint, *frames.at(pair.geomA),
-                 *frames.at(pair.geomB), *sets.at(pair.geomA),
-                 *sets.at(pair.geomB), E, A.topRows(num_constraints),
-                 b.head(num_constraints), *solver, sample, &closest)) {
-        AddTangentToPolytope(E, closest, options, &A, &b, &num_constraints);
-        if (options.require_sample_point_is_contained) {
-          sample_point_requirement =
-              A.row(num_constraints - 1) * sample <= b(num_constraints - 1);
+    if (options.parallelism.num_threads() > 1) {
+      sample_point_requirement = AddSeparatingHyperplanesInParallel(
+          same_point_constraints, sorted_pairs, candidates, obstacles, E,
+          solver->solver_id(), sample, options, &A, &b, &num_constraints);
+    } else {
+      for (int k : candidates) {
+        const GeometryPairWithDistance& pair = sorted_pairs[k];
+        while (sample_point_requirement &&
+               FindClosestCollision(
+                   same_point_constraint, *frames.at(pair.geomA),
+                   *frames.at(pair.geomB), *sets.at(pair.geomA),
+                   *sets.at(pair.geomB), E, A.topRows(num_constraints),
+                   b.head(num_constraints), *solver, sample, &closest)) {
+          AddTangentToPolytope(E, closest, options, &A, &b, &num_constraints);
+          if (options.require_sample_point_is_contained) {
+            sample_point_requirement =
+                A.row(num_constraints - 1) * sample <= b(num_constraints - 1);
+          }
         }
       }
     }
@@ -569,6 +756,91 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
   return P;
 }
 
+}  // namespace
+
+HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
+                                     const Context<double>& context,
+                                     const IrisOptions& options) {
+  // Check the inputs.
+  plant.ValidateContext(context);
+  if (options.num_collision_prefilter_samples > 0) {
+    throw std::logic_error(
+        "IrisInConfigurationSpace: the collision pre-filter needs to change the "
+        "plant's positions, so it requires the overload that takes the root "
+        "context of the Diagram (and one or more seeds).");
+  }
+  // Note: We require finite joint limits to define the bounding box for the
+  // IRIS algorithm.
+  DRAKE_DEMAND(plant.GetPositionLowerLimits().array().isFinite().all());
+  DRAKE_DEMAND(plant.GetPositionUpperLimits().array().isFinite().all());
+
+  // Make all of the convex sets and supporting quantities.
+  auto query_object =
+      plant.get_geometry_query_input_port().Eval<QueryObject<double>>(context);
+  const ConfigurationSpaceObstacles obstacles =
+      MakeConfigurationSpaceObstacles(plant, query_object);
+  return GrowConfigurationSpaceRegion(plant, context, nullptr, obstacles,
+                                      options);
+}
+
+std::vector<HPolyhedron> IrisInConfigurationSpace(
+    const MultibodyPlant<double>& plant,
+    const Context<double>& diagram_context,
+    const Eigen::Ref<const Eigen::MatrixXd>& seeds, const IrisOptions& options,
+    Parallelism parallelism) {
+  // Check the inputs.
+  if (!diagram_context.is_root_context()) {
+    throw std::logic_error(
+        "IrisInConfigurationSpace: the context for multiple seeds must be the "
+        "root context of the Diagram that contains the plant.");
+  }
+  const Context<double>& plant_context =
+      plant.GetMyContextFromRoot(diagram_context);
+  DRAKE_THROW_UNLESS(seeds.rows() == plant.num_positions());
+  DRAKE_DEMAND(plant.GetPositionLowerLimits().array().isFinite().all());
+  DRAKE_DEMAND(plant.GetPositionUpperLimits().array().isFinite().all());
+
+  // The obstacles do not depend on the configuration, so they are made once
+  // and shared (read-only) by all of the threads.
+  auto query_object =
+      plant.get_geometry_query_input_port().Eval<QueryObject<double>>(
+          plant_context);
+  const ConfigurationSpaceObstacles obstacles =
+      MakeConfigurationSpaceObstacles(plant, query_object);
+
+  // IPOPT's linear solver (MUMPS) is not reentrant, so the regions can only
+  // be grown concurrently when SNOPT is the nonlinear solver.
+  if (!(solvers::SnoptSolver::is_available() &&
+        solvers::SnoptSolver::is_enabled())) {
+    parallelism = Parallelism::None();
+  }
+
+  // Each thread grows its regions using its own copy of the Diagram's context.
+  const int num_regions = seeds.cols();
+  const int num_threads = std::min(parallelism.num_threads(), num_regions);
+  std::vector<std::unique_ptr<Context<double>>> thread_contexts;
+  for (int i = 0; i < num_threads; ++i) {
+    thread_contexts.push_back(diagram_context.Clone());
+  }
+  std::vector<std::optional<HPolyhedron>> regions(num_regions);
+  StaticParallelForIndexLoop(
+      parallelism, 0, num_regions, [&](int thread_num, int i) {
+        Context<double>& context = plant.GetMyMutableContextFromRoot(
+            thread_contexts[thread_num].get());
+        plant.SetPositions(&context, seeds.col(i));
+        regions[i] = GrowConfigurationSpaceRegion(
+            plant, context, thread_contexts[thread_num].get(), obstacles,
+            options);
+      });
+
+  std::vector<HPolyhedron> result;
+  result.reserve(num_regions);
+  for (std::optional<HPolyhedron>& region : regions) {
+    result.push_back(std::move(*region));
+  }
+  return result;
+}
+
 }  // namespace optimization
 }  // namespace geometry
 }  // namespace drake
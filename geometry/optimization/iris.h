@@ -4,6 +4,7 @@
 #include <optional>
 #include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/common/symbolic.h"
 #include "drake/geometry/optimization/convex_set.h"
 #include "drake/geometry/optimization/hpolyhedron.h"
@@ -54,6 +55,31 @@ struct IrisOptions {
   demanding, so we allow it to be disabled for a faster algorithm for obtaining
   regions without the rigorous guarantee. */
   bool enable_ibex = true;
+
+  /** For IRIS in configuration space, the maximum number of threads used to
+  solve the nonlinear counterexample programs. With more than one thread, the
+  programs for all of the collision pairs are solved as a batch, and each
+  counterexample that is not already excluded adds a separating hyperplane;
+  the resulting region may differ from the serial one, but has the same
+  guarantees. The rigorous Ibex certification is always serial. */
+  Parallelism parallelism{Parallelism::None()};
+
+  /** For IRIS in configuration space, the number of configurations sampled
+  uniformly from the current ellipsoid (in addition to its center) on each
+  iteration to pre-filter the collision pairs. Only the pairs that come within
+  `collision_prefilter_distance` of each other at one of these configurations
+  are passed to the nonlinear counterexample search; the Ibex certification
+  still checks every pair. Since a pair that is skipped might still collide
+  inside the region, this trades the (non-rigorous) guarantee of the nonlinear
+  search for speed. Setting this to zero (the default) disables the
+  pre-filter. The pre-filter is only supported by the overload of
+  IrisInConfigurationSpace() that takes the root context of the Diagram. */
+  int num_collision_prefilter_samples{0};
+
+  /** For IRIS in configuration space, the signed distance (in meters) below
+  which the collision pre-filter keeps a pair of geometries. See
+  `num_collision_prefilter_samples`. */
+  double collision_prefilter_distance{0.1};
 };
 
 /** The IRIS (Iterative Region Inflation by Semidefinite programming) algorithm,
@@ -130,6 +156,37 @@ HPolyhedron IrisInConfigurationSpace(
     const systems::Context<double>& context,
     const IrisOptions& options = IrisOptions());
 
+/** Runs IrisInConfigurationSpace() once for each column of @p seeds, growing
+the regions in parallel. The convex sets for the collision geometries are made
+once and shared, and each thread grows its regions using its own clone of
+@p diagram_context, so no plant Context is shared between threads.
+
+@param plant describes the kinematics of configuration space.  It must be
+connected to a SceneGraph in a systems::Diagram.
+@param diagram_context is a root context of that Diagram. The positions of the
+plant are ignored; each region is seeded from a column of @p seeds instead.
+@param seeds has one column for each region, with `plant.num_positions()` rows.
+@param options provides additional configuration options, used for every
+region. Since the regions are already grown in parallel, a serial
+`options.parallelism` is usually the best choice.
+@param parallelism The maximum number of regions to grow at once. The regions
+are grown serially if SNOPT is not available, since IPOPT is not reentrant.
+@returns The regions, where entry i was grown from `seeds.col(i)`.
+@throws std::exception if @p diagram_context is not a root context.
+
+This is also the overload that supports
+IrisOptions::num_collision_prefilter_samples. To pre-filter a single region,
+pass a single seed.
+
+@ingroup geometry_optimization
+@exclude_from_pydrake_mkdoc{Not bound in pydrake.} */
+std::vector<HPolyhedron> IrisInConfigurationSpace(
+    const multibody::MultibodyPlant<double>& plant,
+    const systems::Context<double>& diagram_context,
+    const Eigen::Ref<const Eigen::MatrixXd>& seeds,
+    const IrisOptions& options = IrisOptions(),
+    Parallelism parallelism = Parallelism::Max());
+
 }  // namespace optimization
 }  // namespace geometry
 }  // namespace drake
@@ -1,6 +1,7 @@
 #include "drake/geometry/optimization/graph_of_convex_sets.h"
 
 #include <forward_list>
+#include <tuple>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -795,6 +796,131 @@ GTEST_TEST(ShortestPathTest, ClassicalShortestPath) {
   }
 }
 
+// The ClassicalShortestPath graph, plus edges that can never be on a path
+// from vid[0] to vid[4]: a dead end, an unreachable vertex, a self-loop, and
+// an edge out of the target back into the source.
+GTEST_TEST(ShortestPathTest, PreprocessingAndRounding) {
+  GraphOfConvexSets spp;
+
+  std::vector<VertexId> vid(7);
+  for (int i = 0; i < 7; ++i) {
+    vid[i] = spp.AddVertex(Point(Vector1d{1.0}))->id();
+  }
+
+  spp.AddEdge(vid[0], vid[1])->AddCost(3.0);
+  spp.AddEdge(vid[1], vid[0])->AddCost(1.0);
+  spp.AddEdge(vid[0], vid[2])->AddCost(4.0);
+  spp.AddEdge(vid[1], vid[2])->AddCost(1.0);
+  spp.AddEdge(vid[0], vid[3])->AddCost(1.0);
+  spp.AddEdge(vid[3], vid[2])->AddCost(1.0);
+  spp.AddEdge(vid[1], vid[4])->AddCost(2.5);
+  spp.AddEdge(vid[2], vid[4])->AddCost(3.0);
+  spp.AddEdge(vid[0], vid[4])->AddCost(6.0);
+  const std::vector<const Edge*> unusable{
+      spp.AddEdge(vid[0], vid[5]), spp.AddEdge(vid[6], vid[4]),
+      spp.AddEdge(vid[1], vid[1]), spp.AddEdge(vid[4], vid[0])};
+
+  auto expected_cost = [&](const Edge* e) {
+    if ((e->u().id() == vid[0] && e->v().id() == vid[3]) ||
+        (e->u().id() == vid[3] && e->v().id() == vid[2])) {
+      return 1.0;
+    }
+    if (e->u().id() == vid[2] && e->v().id() == vid[4]) {
+      return 3.0;
+    }
+    return 0.0;
+  };
+
+  GraphOfConvexSetsOptions options;
+  options.convex_relaxation = true;
+  auto result = spp.SolveShortestPath(vid[0], vid[4], options);
+  ASSERT_TRUE(result.is_success());
+  for (const auto& e : spp.Edges()) {
+    EXPECT_NEAR(e->GetSolutionCost(result), expected_cost(e), 1e-6);
+  }
+  for (const Edge* e : unusable) {
+    EXPECT_EQ(result.GetSolution(e->phi()), 0.0);
+    EXPECT_EQ(e->GetSolutionCost(result), 0.0);
+    EXPECT_TRUE(CompareMatrices(e->GetSolutionPhiXu(result), Vector1d{0.0}));
+  }
+  EXPECT_TRUE(CompareMatrices(spp.Vertices()[5]->GetSolution(result),
+                              Vector1d{0.0}));
+  EXPECT_TRUE(CompareMatrices(spp.Vertices()[6]->GetSolution(result),
+                              Vector1d{0.0}));
+
+  // Without preprocessing, the optimal cost is the same.
+  options.preprocessing = false;
+  auto unprocessed_result = spp.SolveShortestPath(vid[0], vid[4], options);
+  ASSERT_TRUE(unprocessed_result.is_success());
+  EXPECT_NEAR(unprocessed_result.get_optimal_cost(), result.get_optimal_cost(),
+              1e-6);
+
+  // Rounding returns the convex restriction of the best sampled path.
+  options.preprocessing = true;
+  options.max_rounded_paths = 3;
+  options.parallelism = Parallelism(2);
+  auto rounded_result = spp.SolveShortestPath(vid[0], vid[4], options);
+  ASSERT_TRUE(rounded_result.is_success());
+  EXPECT_NEAR(rounded_result.get_optimal_cost(), 5.0, 1e-6);
+  for (const auto& e : spp.Edges()) {
+    EXPECT_NEAR(rounded_result.GetSolution(e->phi()),
+                expected_cost(e) > 0 ? 1.0 : 0.0, 1e-6);
+    EXPECT_NEAR(e->GetSolutionCost(rounded_result), expected_cost(e), 1e-6);
+  }
+
+  // Requiring an unusable edge keeps the problem infeasible.
+  spp.Edges()[10]->AddPhiConstraint(true);
+  ASSERT_EQ(spp.Edges()[10]->u().id(), vid[6]);
+  EXPECT_FALSE(spp.SolveShortestPath(vid[0], vid[4], options).is_success());
+}
+
+GTEST_TEST(ShortestPathTest, CompiledShortestPath) {
+  GraphOfConvexSets spp;
+  Vertex* source = spp.AddVertex(Point(Vector2d(0, 0)), "source");
+  Vertex* box = spp.AddVertex(HPolyhedron::MakeUnitBox(2), "box");
+  Vertex* target = spp.AddVertex(Point(Vector2d(0, 0)), "target");
+
+  // |xu - xv|₁
+  Matrix<double, 2, 4> A;
+  A.leftCols(2) = Matrix2d::Identity();
+  A.rightCols(2) = -Matrix2d::Identity();
+  auto cost = std::make_shared<solvers::L1NormCost>(A, Vector2d::Zero());
+  for (Edge* e : {spp.AddEdge(*source, *box), spp.AddEdge(*box, *target)}) {
+    e->AddCost(solvers::Binding(cost, {e->xu(), e->xv()}));
+  }
+
+  GraphOfConvexSetsOptions options;
+  options.convex_relaxation = true;
+  auto compiled = spp.CompileShortestPath(source->id(), target->id(), options);
+
+  // The same compiled program answers queries for different endpoints.
+  const std::vector<std::tuple<Vector2d, Vector2d, double>> queries{
+      {Vector2d(-2, 0), Vector2d(2, 0), 4.0},
+      {Vector2d(0, 3), Vector2d(0, 5), 6.0},
+      {Vector2d(-2, 0), Vector2d(2, 0), 4.0}};
+  for (const auto& [source_point, target_point, expected_cost] : queries) {
+    auto result = compiled->Solve(source_point, target_point);
+    ASSERT_TRUE(result.is_success());
+    EXPECT_NEAR(result.get_optimal_cost(), expected_cost, 1e-6);
+    EXPECT_TRUE(
+        CompareMatrices(source->GetSolution(result), source_point, 1e-6));
+    EXPECT_TRUE(
+        CompareMatrices(target->GetSolution(result), target_point, 1e-6));
+    EXPECT_LE(box->GetSolution(result).lpNorm<Eigen::Infinity>(), 1 + 1e-6);
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      compiled->Solve(Vector1d(0.0), Vector2d(0, 0)),
+      ".*point for vertex source has size 1.*ambient dimension 2.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      spp.CompileShortestPath(source->id(), box->id(), options),
+      ".*vertex box must be a Point.*");
+  options.max_rounded_paths = 1;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      spp.CompileShortestPath(source->id(), target->id(), options),
+      ".*does not support rounding.*");
+}
+
 GTEST_TEST(ShortestPathTest, TwoStepLoopConstraint) {
   GraphOfConvexSets spp;
 
@@ -461,6 +461,57 @@ GTEST_TEST(HPolyhedronTest, IntersectionTest) {
   EXPECT_FALSE(H_C.PointInSet(x_B));
 }
 
+GTEST_TEST(HPolyhedronTest, ReduceInequalities) {
+  HPolyhedron H_A = HPolyhedron::MakeUnitBox(2);
+  HPolyhedron H_B = HPolyhedron::MakeBox(Vector2d(0, 0), Vector2d(2, 2));
+  // The parallel rows of the intersection are removed without solving any
+  // programs; the first of the tighter rows is kept.
+  HPolyhedron H_C = H_A.Intersection(H_B).ReduceInequalities();
+  HPolyhedron expected = HPolyhedron::MakeBox(Vector2d(0, 0), Vector2d(1, 1));
+  ASSERT_EQ(H_C.A().rows(), 4);
+  MatrixXd A_expected(4, 2);
+  A_expected << 1, 0, 0, 1, -1, 0, 0, -1;
+  EXPECT_TRUE(CompareMatrices(H_C.A(), A_expected));
+  EXPECT_TRUE(CompareMatrices(H_C.b(), Vector4d(1, 1, 0, 0)));
+
+  // x + 2y ≤ 4 and 0x + 0y ≤ 1 are redundant, but x + y ≤ 1.5 is not.
+  MatrixXd A(7, 2);
+  A << expected.A(), 1, 2, 1, 1, 0, 0;
+  VectorXd b(7);
+  b << expected.b(), 4, 1.5, 1;
+  HPolyhedron H_D = HPolyhedron(A, b).ReduceInequalities();
+  ASSERT_EQ(H_D.A().rows(), 5);
+  EXPECT_TRUE(CompareMatrices(H_D.A().topRows(4), expected.A()));
+  EXPECT_TRUE(CompareMatrices(H_D.A().row(4), Eigen::RowVector2d(1, 1)));
+  EXPECT_NEAR(H_D.b()[4], 1.5, 1e-12);
+
+  // Duplicated rows are reduced to one.
+  MatrixXd A_dup(5, 2);
+  A_dup << expected.A(), 2 * expected.A().row(0);
+  VectorXd b_dup(5);
+  b_dup << expected.b(), 2 * expected.b()[0];
+  EXPECT_EQ(HPolyhedron(A_dup, b_dup).ReduceInequalities().A().rows(), 4);
+}
+
+GTEST_TEST(HPolyhedronTest, PointsInSet) {
+  HPolyhedron H = HPolyhedron::MakeBox(Vector2d(0, 0), Vector2d(2, 1));
+  MatrixXd x(2, 4);
+  // clang-format off
+  x << 1, 3, 2, -1e-3,
+       1, 0, 1, 0.5;
+  // clang-format on
+  const Eigen::Array<bool, Eigen::Dynamic, 1> in_set = H.PointsInSet(x);
+  ASSERT_EQ(in_set.size(), 4);
+  for (int i = 0; i < x.cols(); ++i) {
+    EXPECT_EQ(in_set[i], H.PointInSet(x.col(i)));
+  }
+  EXPECT_TRUE(in_set[0]);
+  EXPECT_FALSE(in_set[1]);
+  EXPECT_TRUE(in_set[2]);
+  EXPECT_FALSE(in_set[3]);
+  EXPECT_TRUE(H.PointsInSet(x, 1e-2)[3]);
+}
+
 }  // namespace optimization
 }  // namespace geometry
 }  // namespace drake
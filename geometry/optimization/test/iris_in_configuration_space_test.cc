@@ -1,3 +1,5 @@
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/geometry/optimization/hpolyhedron.h"
@@ -109,6 +111,89 @@ GTEST_TEST(IrisInConfigurationSpaceTest, BoxesPrismatic) {
   EXPECT_FALSE(region.PointInSet(Vector1d{qmax + kTol}));
 }
 
+// The same three boxes as in BoxesPrismatic, but growing regions from several
+// seeds at once, and batching the counterexample programs.
+GTEST_TEST(IrisInConfigurationSpaceTest, MultipleSeeds) {
+  const std::string boxes_urdf = R"(
+<robot name="boxes">
+  <link name="fixed">
+    <collision name="right">
+      <origin rpy="0 0 0" xyz="2 0 0"/>
+      <geometry><box size="1 1 1"/></geometry>
+    </collision>
+    <collision name="left">
+      <origin rpy="0 0 0" xyz="-2 0 0"/>
+      <geometry><box size="1 1 1"/></geometry>
+    </collision>
+  </link>
+  <joint name="fixed_link_weld" type="fixed">
+    <parent link="world"/>
+    <child link="fixed"/>
+  </joint>
+  <link name="movable">
+    <collision name="center">
+      <geometry><box size="1 1 1"/></geometry>
+    </collision>
+  </link>
+  <joint name="movable" type="prismatic">
+    <axis xyz="1 0 0"/>
+    <limit lower="-2" upper="2"/>
+    <parent link="world"/>
+    <child link="movable"/>
+  </joint>
+</robot>
+)";
+
+  systems::DiagramBuilder<double> builder;
+  multibody::MultibodyPlant<double>& plant =
+      multibody::AddMultibodyPlantSceneGraph(&builder, 0.0);
+  multibody::Parser(&plant).AddModelFromString(boxes_urdf, "urdf");
+  plant.Finalize();
+  auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+
+  const Eigen::RowVector3d seeds(-0.5, 0.0, 0.5);
+  IrisOptions options;
+  options.parallelism = Parallelism(2);
+  const std::vector<HPolyhedron> regions = IrisInConfigurationSpace(
+      plant, *context, seeds, options, Parallelism(2));
+  ASSERT_EQ(regions.size(), 3);
+
+  const double kTol = 1e-3;  // due to ibex's rel_eps_f.
+  const double qmin = -1.0 + options.configuration_space_margin,
+               qmax = 1.0 - options.configuration_space_margin;
+  for (const HPolyhedron& region : regions) {
+    EXPECT_EQ(region.ambient_dimension(), 1);
+    EXPECT_TRUE(region.PointInSet(Vector1d{qmin + kTol}));
+    EXPECT_TRUE(region.PointInSet(Vector1d{qmax - kTol}));
+    EXPECT_FALSE(region.PointInSet(Vector1d{qmin - kTol}));
+    EXPECT_FALSE(region.PointInSet(Vector1d{qmax + kTol}));
+  }
+
+  // The context must be the Diagram's context.
+  EXPECT_THROW(IrisInConfigurationSpace(
+                   plant, plant.GetMyContextFromRoot(*context), seeds),
+               std::exception);
+
+  // The boxes are at most 1.5m apart at the seeds, so with this pre-filter
+  // distance both pairs remain candidates and the regions are the same.
+  options.num_collision_prefilter_samples = 10;
+  options.collision_prefilter_distance = 2.0;
+  for (const HPolyhedron& region :
+       IrisInConfigurationSpace(plant, *context, seeds, options)) {
+    EXPECT_TRUE(region.PointInSet(Vector1d{qmin + kTol}));
+    EXPECT_TRUE(region.PointInSet(Vector1d{qmax - kTol}));
+    EXPECT_FALSE(region.PointInSet(Vector1d{qmin - kTol}));
+    EXPECT_FALSE(region.PointInSet(Vector1d{qmax + kTol}));
+  }
+
+  // The single-seed overload can't change the plant's positions, so it does
+  // not support the pre-filter.
+  EXPECT_THROW(IrisInConfigurationSpace(
+                   plant, plant.GetMyContextFromRoot(*context), options),
+               std::exception);
+}
+
 // Three spheres.  Two on the outside are fixed.  One in the middle on a
 // prismatic joint.  The configuration space is a (convex) line segment q ∈
 // (−1,1).
@@ -0,0 +1,472 @@
+/* @file
+ An offline tool for choosing the `hydroelastic_resolution_hint` of the
+ geometries in a hydroelastic scene. Selecting the hint is otherwise a matter
+ of trial and error: too fine a hint wastes memory and contact-surface time,
+ too coarse a hint degrades the contact force.
+
+ The scene is the same one used by contact_surface_rigid_bowl_soft_ball: a
+ compliant geometry (a ball by default) moves vertically against an anchored
+ rigid geometry (a bowl by default), and the same --rigid and --compliant
+ options select the shapes. The compliant geometry is sampled at --num_poses
+ heights spanning its range of motion.
+
+ For each geometry whose hydroelastic representation depends on the
+ resolution hint, the tool sweeps that geometry's hint geometrically from
+ --max_hint down to --min_hint while holding every other geometry at
+ --reference_hint. At each hint it reports:
+   - the wall-clock time to compute one contact surface (one geometry pair),
+   - the memory used by the geometry's hydroelastic mesh (and pressure field,
+     for compliant geometries), and
+   - the relative error of the net contact force with respect to the
+     reference scene in which every geometry uses --reference_hint,
+     maximized over the sampled poses.
+ The recommended hint for a geometry is the coarsest one whose force error
+ does not exceed --force_tolerance.
+
+ For example, to tune a compliant capsule against the rigid bowl:
+ @code
+ bazel-bin/geometry/profiling/hydroelastic_resolution_sweep --compliant=capsule
+ @endcode
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/value.h"
+#include "drake/geometry/frame_kinematics_vector.h"
+#include "drake/geometry/geometry_frame.h"
+#include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/geometry_instance.h"
+#include "drake/geometry/geometry_roles.h"
+#include "drake/geometry/proximity_properties.h"
+#include "drake/geometry/query_object.h"
+#include "drake/geometry/query_results/contact_surface.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/geometry/scene_graph_inspector.h"
+#include "drake/geometry/shape_specification.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace examples {
+namespace scene_graph {
+namespace resolution_sweep {
+
+using Eigen::Vector3d;
+using geometry::AddCompliantHydroelasticProperties;
+using geometry::AddRigidHydroelasticProperties;
+using geometry::Box;
+using geometry::Capsule;
+using geometry::ContactSurface;
+using geometry::Cylinder;
+using geometry::FrameId;
+using geometry::FramePoseVector;
+using geometry::GeometryFrame;
+using geometry::GeometryId;
+using geometry::GeometryInstance;
+using geometry::HydroelasticContactRepresentation;
+using geometry::Mesh;
+using geometry::ProximityProperties;
+using geometry::QueryObject;
+using geometry::SceneGraph;
+using geometry::SceneGraphInspector;
+using geometry::Shape;
+using geometry::SourceId;
+using geometry::Sphere;
+using geometry::SurfaceTriangle;
+using geometry::TriangleSurfaceMesh;
+using geometry::VolumeElement;
+using geometry::VolumeMesh;
+using math::RigidTransformd;
+using std::make_unique;
+using systems::Context;
+
+DEFINE_string(rigid, "bowl",
+              "Specify the shape of the rigid geometry.\n"
+              "[--rigid={ball,bowl,box,capsule,cylinder}]\n"
+              "By default, it is the bowl.\n");
+DEFINE_string(compliant, "ball",
+              "Specify the shape of the compliant geometry.\n"
+              "[--compliant={ball,box,capsule,cylinder}]\n"
+              "By default, it is the ball.\n");
+DEFINE_bool(polygons, true,
+            "Set to true to time contact surfaces represented by polygons.\n"
+            "Set to false to time contact surfaces represented by triangles.\n"
+            "By default, it is true.");
+DEFINE_double(max_hint, 0.04,
+              "The coarsest resolution hint (in meters) of the sweep.");
+DEFINE_double(min_hint, 0.0025,
+              "The finest resolution hint (in meters) of the sweep.");
+DEFINE_int32(num_hints, 5,
+             "The number of resolution hints in the sweep, spaced "
+             "geometrically from --max_hint down to --min_hint.");
+DEFINE_double(reference_hint, 0.00125,
+              "The resolution hint (in meters) of the reference scene against "
+              "which contact forces are compared. It should be finer than "
+              "--min_hint.");
+DEFINE_int32(num_poses, 5,
+             "The number of compliant-geometry poses sampled over its range "
+             "of motion.");
+DEFINE_int32(num_repeats, 20,
+             "The number of times the contact surfaces are computed at each "
+             "pose when timing.");
+DEFINE_double(force_tolerance, 0.05,
+              "The largest relative contact-force error accepted when "
+              "recommending a resolution hint.");
+
+// Ball radius 2.5cm; the compliant shapes are sized relative to it, as in
+// contact_surface_rigid_bowl_soft_ball.
+constexpr double kRadius = 0.025;
+// The compliant geometry's center moves along World z in [5cm, 6cm].
+constexpr double kZLow = 0.05;
+constexpr double kZHigh = 0.06;
+constexpr double kHydroelasticModulus = 1e8;
+
+/* Reports whether the hydroelastic representation of the named shape depends
+ on the resolution hint. Boxes are not tessellated according to the hint and
+ the bowl is a fixed mesh. */
+bool UsesResolutionHint(const std::string& shape_name) {
+  return shape_name == "ball" || shape_name == "capsule" ||
+         shape_name == "cylinder";
+}
+
+std::unique_ptr<Shape> MakeCompliantShape() {
+  if (FLAGS_compliant == "box") {
+    return make_unique<Box>(Box::MakeCube(1.5 * kRadius));
+  } else if (FLAGS_compliant == "capsule") {
+    return make_unique<Capsule>(1.2 * kRadius, 1.5 * kRadius);
+  } else if (FLAGS_compliant == "cylinder") {
+    return make_unique<Cylinder>(1.2 * kRadius, 1.5 * kRadius);
+  }
+  return make_unique<Sphere>(kRadius);
+}
+
+std::unique_ptr<Shape> MakeRigidShape() {
+  if (FLAGS_rigid == "ball") {
+    return make_unique<Sphere>(0.04);
+  } else if (FLAGS_rigid == "box") {
+    return make_unique<Box>(0.15, 0.15, 0.02);
+  } else if (FLAGS_rigid == "capsule") {
+    return make_unique<Capsule>(0.05, 0.02);
+  } else if (FLAGS_rigid == "cylinder") {
+    return make_unique<Cylinder>(0.05, 0.02);
+  }
+  return make_unique<Mesh>(
+      FindResourceOrThrow("drake/geometry/profiling/evo_bowl_no_mtl.obj"));
+}
+
+/* A standalone SceneGraph holding the compliant and rigid geometries, with
+ the compliant geometry's frame pose supplied through a fixed input port. */
+class Scene {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Scene)
+
+  Scene(double compliant_hint, double rigid_hint) {
+    source_id_ = scene_graph_.RegisterSource("resolution_sweep");
+    frame_id_ = scene_graph_.RegisterFrame(source_id_,
+                                           GeometryFrame("moving_frame"));
+    compliant_id_ = scene_graph_.RegisterGeometry(
+        source_id_, frame_id_,
+        make_unique<GeometryInstance>(RigidTransformd(), MakeCompliantShape(),
+                                      "compliant"));
+    ProximityProperties compliant_props;
+    AddCompliantHydroelasticProperties(compliant_hint, kHydroelasticModulus,
+                                       &compliant_props);
+    scene_graph_.AssignRole(source_id_, compliant_id_, compliant_props);
+
+    // Place the rigid geometry as contact_surface_rigid_bowl_soft_ball does,
+    // so that the compliant geometry touches the rim of the bowl.
+    const RigidTransformd X_WR(Vector3d(0, 0.05, 0.0305));
+    rigid_id_ = scene_graph_.RegisterAnchoredGeometry(
+        source_id_,
+        make_unique<GeometryInstance>(X_WR, MakeRigidShape(), "rigid"));
+    ProximityProperties rigid_props;
+    AddRigidHydroelasticProperties(rigid_hint, &rigid_props);
+    scene_graph_.AssignRole(source_id_, rigid_id_, rigid_props);
+
+    context_ = scene_graph_.CreateDefaultContext();
+  }
+
+  /* Moves the compliant geometry's center to height `z` in World. */
+  void SetCompliantHeight(double z) {
+    const FramePoseVector<double> poses{
+        {frame_id_, RigidTransformd(Vector3d(0, 0, z))}};
+    scene_graph_.get_source_pose_port(source_id_).FixValue(context_.get(),
+                                                           poses);
+  }
+
+  std::vector<ContactSurface<double>> ComputeContactSurfaces(
+      HydroelasticContactRepresentation representation) const {
+    const auto& query_object =
+        scene_graph_.get_query_output_port().Eval<QueryObject<double>>(
+            *context_);
+    return query_object.ComputeContactSurfaces(representation);
+  }
+
+  const SceneGraphInspector<double>& inspector() const {
+    return scene_graph_.model_inspector();
+  }
+
+  GeometryId compliant_id() const { return compliant_id_; }
+  GeometryId rigid_id() const { return rigid_id_; }
+
+ private:
+  SceneGraph<double> scene_graph_;
+  SourceId source_id_;
+  FrameId frame_id_;
+  GeometryId compliant_id_;
+  GeometryId rigid_id_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+/* Returns the number of bytes used by the hydroelastic representation of the
+ given geometry: its mesh and, for a compliant geometry, the per-vertex
+ pressure values and per-element pressure gradients of its field. */
+int64_t CalcHydroelasticBytes(const SceneGraphInspector<double>& inspector,
+                              GeometryId id) {
+  const auto maybe_mesh = inspector.maybe_get_hydroelastic_mesh(id);
+  if (std::holds_alternative<const VolumeMesh<double>*>(maybe_mesh)) {
+    const VolumeMesh<double>& mesh =
+        *std::get<const VolumeMesh<double>*>(maybe_mesh);
+    return int64_t{mesh.num_vertices()} * (sizeof(Vector3d) + sizeof(double)) +
+           int64_t{mesh.num_elements()} *
+               (sizeof(VolumeElement) + sizeof(Vector3d));
+  }
+  if (std::holds_alternative<const TriangleSurfaceMesh<double>*>(maybe_mesh)) {
+    const TriangleSurfaceMesh<double>& mesh =
+        *std::get<const TriangleSurfaceMesh<double>*>(maybe_mesh);
+    // Each triangle also stores its area and unit normal.
+    return int64_t{mesh.num_vertices()} * sizeof(Vector3d) +
+           int64_t{mesh.num_elements()} *
+               (sizeof(SurfaceTriangle) + sizeof(double) + sizeof(Vector3d));
+  }
+  return 0;
+}
+
+/* Returns the net hydroelastic force, expressed in World, over the given
+ triangle-represented contact surfaces. The pressure field is linear on each
+ triangle, so its integral is the triangle's area times the mean of its
+ vertex pressures. */
+Vector3d CalcNetForce(const std::vector<ContactSurface<double>>& surfaces) {
+  Vector3d f_W = Vector3d::Zero();
+  for (const ContactSurface<double>& surface : surfaces) {
+    DRAKE_DEMAND(surface.is_triangle());
+    const TriangleSurfaceMesh<double>& mesh_W = surface.tri_mesh_W();
+    const auto& e_MN = surface.tri_e_MN();
+    for (int t = 0; t < mesh_W.num_triangles(); ++t) {
+      const SurfaceTriangle& triangle = mesh_W.element(t);
+      const double mean_pressure = (e_MN.EvaluateAtVertex(triangle.vertex(0)) +
+                                    e_MN.EvaluateAtVertex(triangle.vertex(1)) +
+                                    e_MN.EvaluateAtVertex(triangle.vertex(2))) /
+                                   3.0;
+      f_W += mesh_W.area(t) * mean_pressure * mesh_W.face_normal(t);
+    }
+  }
+  return f_W;
+}
+
+std::vector<double> SampleHeights() {
+  std::vector<double> heights(FLAGS_num_poses);
+  for (int i = 0; i < FLAGS_num_poses; ++i) {
+    const double s =
+        FLAGS_num_poses == 1 ? 0.5 : static_cast<double>(i) /
+                                         (FLAGS_num_poses - 1);
+    heights[i] = kZLow + s * (kZHigh - kZLow);
+  }
+  return heights;
+}
+
+/* The measurements of one scene over all sampled poses. */
+struct SceneMeasurement {
+  // Mean wall-clock seconds to compute one contact surface.
+  double seconds_per_pair{0};
+  // Net contact force at each sampled pose.
+  std::vector<Vector3d> forces;
+};
+
+SceneMeasurement Measure(Scene* scene, const std::vector<double>& heights) {
+  using Clock = std::chrono::steady_clock;
+  const auto representation =
+      FLAGS_polygons ? HydroelasticContactRepresentation::kPolygon
+                     : HydroelasticContactRepresentation::kTriangle;
+  SceneMeasurement result;
+  double total_seconds = 0;
+  int64_t num_pairs = 0;
+  for (double z : heights) {
+    scene->SetCompliantHeight(z);
+    // The first query also updates the geometry poses; it supplies the force
+    // and is excluded from the timing.
+    const std::vector<ContactSurface<double>> surfaces =
+        scene->ComputeContactSurfaces(
+            HydroelasticContactRepresentation::kTriangle);
+    result.forces.push_back(CalcNetForce(surfaces));
+    if (surfaces.empty()) continue;
+    const Clock::time_point start = Clock::now();
+    for (int r = 0; r < FLAGS_num_repeats; ++r) {
+      scene->ComputeContactSurfaces(representation);
+    }
+    total_seconds +=
+        std::chrono::duration<double>(Clock::now() - start).count();
+    num_pairs += int64_t{FLAGS_num_repeats} * surfaces.size();
+  }
+  if (num_pairs > 0) result.seconds_per_pair = total_seconds / num_pairs;
+  return result;
+}
+
+/* Returns the relative force error of `forces` with respect to `reference`,
+ maximized over the poses at which the reference is in contact. */
+double CalcMaxRelativeForceError(const std::vector<Vector3d>& forces,
+                                 const std::vector<Vector3d>& reference) {
+  double max_error = 0;
+  for (int i = 0; i < static_cast<int>(reference.size()); ++i) {
+    const double reference_norm = reference[i].norm();
+    if (reference_norm == 0) continue;
+    max_error =
+        std::max(max_error, (forces[i] - reference[i]).norm() / reference_norm);
+  }
+  return max_error;
+}
+
+/* Sweeps the resolution hint of one geometry (the compliant one if
+ `sweep_compliant`, otherwise the rigid one), prints one row per hint, and
+ returns the recommended hint, or NaN if none meets the tolerance. */
+double SweepGeometry(bool sweep_compliant, const std::string& shape_name,
+                     const std::vector<double>& heights,
+                     const SceneMeasurement& reference) {
+  std::cout << "\n"
+            << (sweep_compliant ? "compliant " : "rigid ") << shape_name
+            << ":\n"
+            << std::setw(12) << "hint(m)" << std::setw(16) << "time/pair(us)"
+            << std::setw(14) << "memory(KiB)" << std::setw(16)
+            << "force error(%)" << "\n";
+  double recommended = std::nan("");
+  const double ratio =
+      FLAGS_num_hints == 1
+          ? 1.0
+          : std::pow(FLAGS_min_hint / FLAGS_max_hint,
+                     1.0 / (FLAGS_num_hints - 1));
+  double hint = FLAGS_max_hint;
+  for (int i = 0; i < FLAGS_num_hints; ++i, hint *= ratio) {
+    Scene scene(sweep_compliant ? hint : FLAGS_reference_hint,
+                sweep_compliant ? FLAGS_reference_hint : hint);
+    const SceneMeasurement measurement = Measure(&scene, heights);
+    const int64_t bytes = CalcHydroelasticBytes(
+        scene.inspector(),
+        sweep_compliant ? scene.compliant_id() : scene.rigid_id());
+    const double error =
+        CalcMaxRelativeForceError(measurement.forces, reference.forces);
+    std::cout << std::setw(12) << hint << std::setw(16)
+              << measurement.seconds_per_pair * 1e6 << std::setw(14)
+              << bytes / 1024.0 << std::setw(16) << error * 100 << "\n";
+    // The sweep runs from coarse to fine, so the first hint that meets the
+    // tolerance is the coarsest acceptable one.
+    if (std::isnan(recommended) && error <= FLAGS_force_tolerance) {
+      recommended = hint;
+    }
+  }
+  return recommended;
+}
+
+void PrintRecommendation(const std::string& label, double hint) {
+  std::cout << "  " << label << ": ";
+  if (std::isnan(hint)) {
+    std::cout << "none of the swept hints meets the force tolerance; "
+                 "try a smaller --min_hint\n";
+  } else {
+    std::cout << hint << " m\n";
+  }
+}
+
+int do_main() {
+  if (!(FLAGS_max_hint >= FLAGS_min_hint && FLAGS_min_hint > 0 &&
+        FLAGS_reference_hint > 0 && FLAGS_num_hints >= 1 &&
+        FLAGS_num_poses >= 1 && FLAGS_num_repeats >= 1)) {
+    std::cerr << "Invalid sweep: require --max_hint >= --min_hint > 0, "
+                 "--reference_hint > 0, and positive --num_hints, "
+                 "--num_poses, and --num_repeats.\n";
+    return 1;
+  }
+  const std::vector<std::string> rigid_names{"ball", "bowl", "box", "capsule",
+                                              "cylinder"};
+  const std::vector<std::string> compliant_names{"ball", "box", "capsule",
+                                                 "cylinder"};
+  if (std::find(rigid_names.begin(), rigid_names.end(), FLAGS_rigid) ==
+          rigid_names.end() ||
+      std::find(compliant_names.begin(), compliant_names.end(),
+                FLAGS_compliant) == compliant_names.end()) {
+    std::cerr << "Unsupported --rigid=" << FLAGS_rigid << " or --compliant="
+              << FLAGS_compliant << ". Supported values are ball, bowl, box, "
+              << "capsule, or cylinder for --rigid and ball, box, capsule, "
+              << "or cylinder for --compliant.\n";
+    return 1;
+  }
+  if (FLAGS_reference_hint >= FLAGS_min_hint) {
+    std::cout << "Warning: --reference_hint is not finer than --min_hint; "
+                 "force errors near the fine end are not meaningful.\n";
+  }
+
+  const std::vector<double> heights = SampleHeights();
+  Scene reference_scene(FLAGS_reference_hint, FLAGS_reference_hint);
+  const SceneMeasurement reference = Measure(&reference_scene, heights);
+  const int num_contact_poses = std::count_if(
+      reference.forces.begin(), reference.forces.end(),
+      [](const Vector3d& f) { return f.norm() > 0; });
+  if (num_contact_poses == 0) {
+    std::cerr << "The reference scene has no contact at any sampled pose.\n";
+    return 1;
+  }
+  std::cout << "Reference hint " << FLAGS_reference_hint << " m; "
+            << num_contact_poses << " of " << heights.size()
+            << " sampled poses in contact; reference time/pair "
+            << reference.seconds_per_pair * 1e6 << " us.\n";
+
+  const bool sweep_compliant = UsesResolutionHint(FLAGS_compliant);
+  const bool sweep_rigid = UsesResolutionHint(FLAGS_rigid);
+  double compliant_hint = std::nan("");
+  double rigid_hint = std::nan("");
+  if (sweep_compliant) {
+    compliant_hint = SweepGeometry(true, FLAGS_compliant, heights, reference);
+  }
+  if (sweep_rigid) {
+    rigid_hint = SweepGeometry(false, FLAGS_rigid, heights, reference);
+  }
+
+  std::cout << "\nRecommended resolution hints (force error <= "
+            << FLAGS_force_tolerance * 100 << "%):\n";
+  if (sweep_compliant) {
+    PrintRecommendation("compliant " + FLAGS_compliant, compliant_hint);
+  } else {
+    std::cout << "  compliant " << FLAGS_compliant
+              << ": not affected by the resolution hint\n";
+  }
+  if (sweep_rigid) {
+    PrintRecommendation("rigid " + FLAGS_rigid, rigid_hint);
+  } else {
+    std::cout << "  rigid " << FLAGS_rigid
+              << ": not affected by the resolution hint\n";
+  }
+  return 0;
+}
+
+}  // namespace resolution_sweep
+}  // namespace scene_graph
+}  // namespace examples
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Sweeps the hydroelastic resolution hint of each geometry in a "
+      "compliant-versus-rigid scene and recommends per-geometry hints.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::examples::scene_graph::resolution_sweep::do_main();
+}
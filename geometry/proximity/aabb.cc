@@ -50,6 +50,23 @@ bool Aabb::HasOverlap(const Aabb& aabb_G, const Obb& obb_H,
   return BoxesOverlap(aabb_G.half_width(), obb_H.half_width(), X_AO);
 }
 
+void Aabb::AddToOverlapBatch(const Aabb& a_G, const Aabb& b_H,
+                             const RigidTransformd& X_GH,
+                             BoxPairBatch* batch) {
+  DRAKE_ASSERT(batch != nullptr);
+  // R_GA = R_HB = I because they are Aabb.
+  batch->Add(a_G.half_width(), RigidTransformd(a_G.center()), b_H.half_width(),
+             RigidTransformd(b_H.center()), X_GH);
+}
+
+void Aabb::AddToOverlapBatch(const Aabb& aabb_G, const Obb& obb_H,
+                             const RigidTransformd& X_GH,
+                             BoxPairBatch* batch) {
+  DRAKE_ASSERT(batch != nullptr);
+  batch->Add(aabb_G.half_width(), RigidTransformd(aabb_G.center()),
+             obb_H.half_width(), obb_H.pose(), X_GH);
+}
+
 template <typename MeshType>
 Aabb AabbMaker<MeshType>::Compute() const {
   auto itr = vertices_.begin();
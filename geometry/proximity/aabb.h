@@ -15,6 +15,7 @@ namespace internal {
 // Forward declarations.
 template <typename> class AabbMaker;
 template <typename> class BvhUpdater;
+class BoxPairBatch;
 class Obb;
 
 /* Axis-aligned bounding box. The box is defined in a canonical frame B such
@@ -118,6 +119,19 @@ class Aabb {
   static bool HasOverlap(const Aabb& aabb_G, const Obb& obb_H,
                          const math::RigidTransformd& X_GH);
 
+  /* Appends the pair of boxes to `batch` so that the batched BoxesOverlap()
+   reports the same result for it as HasOverlap() with the same arguments
+   would (up to rounding; see BoxesOverlap(const BoxPairBatch&)). Overloads
+   are provided for the same pairs of box types as HasOverlap().
+   @pre !batch->full(). */
+  static void AddToOverlapBatch(const Aabb& a_G, const Aabb& b_H,
+                                const math::RigidTransformd& X_GH,
+                                BoxPairBatch* batch);
+
+  static void AddToOverlapBatch(const Aabb& aabb_G, const Obb& obb_H,
+                                const math::RigidTransformd& X_GH,
+                                BoxPairBatch* batch);
+
   // TODO(SeanCurtis-TRI): Support collision with primitives as appropriate
   //  (see obb.h for an example).
 
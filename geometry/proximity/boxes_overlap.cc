@@ -1,5 +1,7 @@
 #include "drake/geometry/proximity/boxes_overlap.h"
 
+#include <limits>
+
 namespace drake {
 namespace geometry {
 namespace internal {
@@ -66,6 +68,145 @@ bool BoxesOverlap(const Vector3d& half_size_a, const Vector3d& half_size_b,
   return true;
 }
 
+namespace {
+
+using Lanes = BoxPairBatch::Lanes;
+// A 3x3 matrix per lane; entry (i, j) is stored at 3 * i + j.
+using MatrixLanes = std::array<Lanes, 9>;
+using VectorLanes = std::array<Lanes, 3>;
+
+// Returns a * b.
+MatrixLanes Multiply(const MatrixLanes& a, const MatrixLanes& b) {
+  MatrixLanes c;
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      c[3 * i + j] = a[3 * i] * b[j] + a[3 * i + 1] * b[3 + j] +
+                     a[3 * i + 2] * b[6 + j];
+    }
+  }
+  return c;
+}
+
+// Returns aᵀ * b.
+MatrixLanes MultiplyTransposed(const MatrixLanes& a, const MatrixLanes& b) {
+  MatrixLanes c;
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      c[3 * i + j] = a[i] * b[j] + a[3 + i] * b[3 + j] + a[6 + i] * b[6 + j];
+    }
+  }
+  return c;
+}
+
+// Returns a * v.
+VectorLanes Multiply(const MatrixLanes& a, const VectorLanes& v) {
+  VectorLanes c;
+  for (int i = 0; i < 3; ++i) {
+    c[i] = a[3 * i] * v[0] + a[3 * i + 1] * v[1] + a[3 * i + 2] * v[2];
+  }
+  return c;
+}
+
+// Returns aᵀ * v.
+VectorLanes MultiplyTransposed(const MatrixLanes& a, const VectorLanes& v) {
+  VectorLanes c;
+  for (int i = 0; i < 3; ++i) {
+    c[i] = a[i] * v[0] + a[3 + i] * v[1] + a[6 + i] * v[2];
+  }
+  return c;
+}
+
+}  // namespace
+
+BoxPairBatch::BoxPairBatch() {
+  // Zero the lanes so that unused ones never hold uninitialized values.
+  for (auto* quantity :
+       {&half_size_a_, &half_size_b_, &p_GA_, &p_HB_, &p_GH_}) {
+    for (Lanes& lanes : *quantity) lanes.setZero();
+  }
+  for (auto* quantity : {&R_GA_, &R_HB_, &R_GH_}) {
+    for (Lanes& lanes : *quantity) lanes.setZero();
+  }
+}
+
+// After computing X_AB, this mirrors the single-pair BoxesOverlap() axis for
+// axis, with each scalar replaced by the lanes of all the pairs in the batch.
+// Rather than returning at the first separating axis, we track for each pair
+// the largest amount by which any axis separates it; a pair is separated if
+// that amount is positive (for finite values, x - y > 0 if and only if x > y).
+std::bitset<kBoxesOverlapBatchSize> BoxesOverlap(const BoxPairBatch& batch) {
+  const int n = batch.size();
+  std::bitset<kBoxesOverlapBatchSize> result;
+  if (n == 0) return result;
+
+  // X_AB = X_AG * X_GH * X_HB, with p_AB = R_AG * (p_GB - p_GA).
+  const MatrixLanes R_GB = Multiply(batch.R_GH_, batch.R_HB_);
+  const VectorLanes R_GH_p_HB = Multiply(batch.R_GH_, batch.p_HB_);
+  VectorLanes p_AB_G;
+  for (int i = 0; i < 3; ++i) {
+    p_AB_G[i] = R_GH_p_HB[i] + batch.p_GH_[i] - batch.p_GA_[i];
+  }
+  const MatrixLanes r = MultiplyTransposed(batch.R_GA_, R_GB);
+  const VectorLanes t = MultiplyTransposed(batch.R_GA_, p_AB_G);
+  const VectorLanes& half_size_a = batch.half_size_a_;
+  const VectorLanes& half_size_b = batch.half_size_b_;
+
+  const double kEpsilon = 0.000001;
+  MatrixLanes abs_r;
+  for (int k = 0; k < 9; ++k) {
+    abs_r[k] = r[k].abs() + kEpsilon;
+  }
+
+  Lanes excess = Lanes::Constant(-std::numeric_limits<double>::infinity());
+
+  // First category of cases separating along a's axes.
+  for (int i = 0; i < 3; ++i) {
+    const Lanes rhs =
+        half_size_a[i] +
+        (half_size_b[0] * abs_r[3 * i] + half_size_b[1] * abs_r[3 * i + 1] +
+         half_size_b[2] * abs_r[3 * i + 2]);
+    excess = excess.max(t[i].abs() - rhs);
+  }
+
+  // Second category of cases separating along b's axes.
+  for (int i = 0; i < 3; ++i) {
+    const Lanes lhs = (t[0] * r[i] + t[1] * r[3 + i] + t[2] * r[6 + i]).abs();
+    const Lanes rhs =
+        half_size_b[i] +
+        (half_size_a[0] * abs_r[i] + half_size_a[1] * abs_r[3 + i] +
+         half_size_a[2] * abs_r[6 + i]);
+    excess = excess.max(lhs - rhs);
+  }
+
+  // The face axes usually settle the matter; skip the edge axes if every pair
+  // has already been separated.
+  if ((excess.head(n) > 0).all()) return result;
+
+  // Third category of cases separating along the axes formed from the cross
+  // products of a's and b's axes.
+  int i1 = 1;
+  for (int i = 0; i < 3; ++i) {
+    const int i2 = (i1 + 1) % 3;  // Calculate common sub expressions.
+    int j1 = 1;
+    for (int j = 0; j < 3; ++j) {
+      const int j2 = (j1 + 1) % 3;
+      const Lanes lhs = (t[i2] * r[3 * i1 + j] - t[i1] * r[3 * i2 + j]).abs();
+      const Lanes rhs = half_size_a[i1] * abs_r[3 * i2 + j] +
+                        half_size_a[i2] * abs_r[3 * i1 + j] +
+                        half_size_b[j1] * abs_r[3 * i + j2] +
+                        half_size_b[j2] * abs_r[3 * i + j1];
+      excess = excess.max(lhs - rhs);
+      j1 = j2;
+    }
+    i1 = i2;
+  }
+
+  for (int k = 0; k < n; ++k) {
+    result[k] = !(excess(k) > 0);
+  }
+  return result;
+}
+
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
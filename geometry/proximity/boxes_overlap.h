@@ -1,5 +1,9 @@
 #pragma once
 
+#include <array>
+#include <bitset>
+
+#include "drake/common/drake_assert.h"
 #include "drake/common/eigen_types.h"
 #include "drake/math/rigid_transform.h"
 
@@ -21,6 +25,100 @@ bool BoxesOverlap(const Vector3<double>& half_size_a,
                   const Vector3<double>& half_size_b,
                   const math::RigidTransformd& X_AB);
 
+/* The number of box pairs that the batched BoxesOverlap() tests at once. Four
+ doubles fill a 256-bit (AVX) vector register, or two 128-bit (SSE2/NEON)
+ registers. */
+constexpr int kBoxesOverlapBatchSize = 4;
+
+/* A batch of up to kBoxesOverlapBatchSize box pairs to be tested for overlap
+ by the batched BoxesOverlap().
+
+ Unlike the single-pair BoxesOverlap(), the pairs are not given by their
+ relative pose X_AB. Instead, as in a bounding volume hierarchy traversal, box
+ A is posed in some frame G, box B is posed in some frame H, and the two are
+ related by X_GH. Computing X_AB = X_GA⁻¹ * X_GH * X_HB is more costly than
+ most of the separating-axis tests, so it is part of what gets batched.
+
+ The quantities are stored as a structure of arrays -- one array "lane" per
+ pair -- so that the computation for all of the pairs is carried out together
+ using Eigen's vectorized array arithmetic (i.e., SIMD instructions). */
+class BoxPairBatch {
+ public:
+  using Lanes = Eigen::Array<double, kBoxesOverlapBatchSize, 1>;
+
+  BoxPairBatch();
+
+  /* The number of pairs in the batch. */
+  int size() const { return size_; }
+
+  bool full() const { return size_ == kBoxesOverlapBatchSize; }
+
+  /* Removes all pairs from the batch. */
+  void clear() { size_ = 0; }
+
+  /* Appends a pair of boxes to the batch.
+
+   @param half_size_a   The half size of box A expressed in A's canonical frame.
+   @param X_GA          The pose of A's canonical frame in frame G.
+   @param half_size_b   The half size of box B expressed in B's canonical frame.
+   @param X_HB          The pose of B's canonical frame in frame H.
+   @param X_GH          The relative pose between frames G and H.
+   @pre !full(). */
+  void Add(const Vector3<double>& half_size_a, const math::RigidTransformd& X_GA,
+           const Vector3<double>& half_size_b, const math::RigidTransformd& X_HB,
+           const math::RigidTransformd& X_GH) {
+    DRAKE_ASSERT(!full());
+    const int k = size_++;
+    SetLane(k, half_size_a, &half_size_a_);
+    SetLane(k, half_size_b, &half_size_b_);
+    SetLane(k, X_GA, &R_GA_, &p_GA_);
+    SetLane(k, X_HB, &R_HB_, &p_HB_);
+    SetLane(k, X_GH, &R_GH_, &p_GH_);
+  }
+
+ private:
+  friend std::bitset<kBoxesOverlapBatchSize> BoxesOverlap(
+      const BoxPairBatch&);
+
+  static void SetLane(int k, const Vector3<double>& value,
+                      std::array<Lanes, 3>* lanes) {
+    for (int i = 0; i < 3; ++i) (*lanes)[i](k) = value(i);
+  }
+
+  static void SetLane(int k, const math::RigidTransformd& X,
+                      std::array<Lanes, 9>* R_lanes,
+                      std::array<Lanes, 3>* p_lanes) {
+    const Matrix3<double>& R = X.rotation().matrix();
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        (*R_lanes)[3 * i + j](k) = R(i, j);
+      }
+    }
+    SetLane(k, X.translation(), p_lanes);
+  }
+
+  // Component i of each vector quantity, or entry (i, j) of each rotation
+  // matrix (stored at 3 * i + j), for each of the pairs. Lanes at or beyond
+  // size_ hold stale values.
+  std::array<Lanes, 3> half_size_a_;
+  std::array<Lanes, 3> half_size_b_;
+  std::array<Lanes, 9> R_GA_;
+  std::array<Lanes, 3> p_GA_;
+  std::array<Lanes, 9> R_HB_;
+  std::array<Lanes, 3> p_HB_;
+  std::array<Lanes, 9> R_GH_;
+  std::array<Lanes, 3> p_GH_;
+  int size_{0};
+};
+
+/* Batched variant of BoxesOverlap(). Bit k of the result reports whether the
+ kth pair in `batch` overlaps. The result agrees with the single-pair
+ BoxesOverlap() (given X_AB = X_GA⁻¹ * X_GH * X_HB) except, possibly, for
+ boxes whose separation along some axis is within rounding error of zero;
+ the two compute X_AB with differently-ordered arithmetic. Bits at or beyond
+ batch.size() are zero. */
+std::bitset<kBoxesOverlapBatchSize> BoxesOverlap(const BoxPairBatch& batch);
+
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <bitset>
 #include <memory>
 #include <stack>
 #include <utility>
@@ -12,6 +14,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/geometry/proximity/aabb.h"
+#include "drake/geometry/proximity/boxes_overlap.h"
 #include "drake/geometry/proximity/obb.h"
 #include "drake/geometry/proximity/triangle_surface_mesh.h"
 #include "drake/geometry/proximity/volume_mesh.h"
@@ -265,6 +268,73 @@ class Bvh {
     }
   }
 
+  /* A variant of Collide() that tests the bounding volumes of several node
+   pairs at once. Each iteration takes up to kBoxesOverlapBatchSize node pairs
+   off the traversal frontier and tests them together with the batched
+   BoxesOverlap() (which makes use of SIMD instructions); the surviving pairs
+   then proceed exactly as in Collide(). The callback is invoked on the same
+   set of element pairs as Collide() would invoke it on, but not necessarily
+   in the same order.
+
+   @param bvh_B           The bounding volume hierarchy to collide with.
+   @param X_AB            The relative pose of the two hierarchies.
+   @param callback        The callback to invoke on each unculled pair.
+   @tparam OtherBvhType   The type of Bvh to collide against this. There must
+                          be an overload of BvType::AddToOverlapBatch() for
+                          its bounding volume type.  */
+  template <class OtherBvhType>
+  void CollideBatched(const OtherBvhType& bvh_B,
+                      const math::RigidTransformd& X_AB,
+                      BvttCallback callback) const {
+    using OtherNodeType = typename OtherBvhType::NodeType;
+    using NodePair = std::pair<const NodeType*, const OtherNodeType*>;
+    std::vector<NodePair> node_pairs{{&root_node(), &bvh_B.root_node()}};
+    std::array<NodePair, kBoxesOverlapBatchSize> candidates;
+    BoxPairBatch batch;
+
+    while (!node_pairs.empty()) {
+      // Pop a batch's worth of pairs off the stack.
+      const int num_candidates = std::min<int>(
+          kBoxesOverlapBatchSize, static_cast<int>(node_pairs.size()));
+      batch.clear();
+      for (int k = 0; k < num_candidates; ++k) {
+        candidates[k] = node_pairs.back();
+        node_pairs.pop_back();
+        BvType::AddToOverlapBatch(candidates[k].first->bv(),
+                                  candidates[k].second->bv(), X_AB, &batch);
+      }
+      const std::bitset<kBoxesOverlapBatchSize> overlaps = BoxesOverlap(batch);
+
+      for (int k = 0; k < num_candidates; ++k) {
+        if (!overlaps[k]) continue;
+        const NodeType& node_a = *candidates[k].first;
+        const OtherNodeType& node_b = *candidates[k].second;
+        if (node_a.is_leaf() && node_b.is_leaf()) {
+          const int num_a_elements = node_a.num_element_indices();
+          const int num_b_elements = node_b.num_element_indices();
+          for (int a = 0; a < num_a_elements; ++a) {
+            for (int b = 0; b < num_b_elements; ++b) {
+              const BvttCallbackResult result =
+                  callback(node_a.element_index(a), node_b.element_index(b));
+              if (result == BvttCallbackResult::Terminate) return;
+            }
+          }
+        } else if (node_b.is_leaf()) {
+          node_pairs.emplace_back(&node_a.left(), &node_b);
+          node_pairs.emplace_back(&node_a.right(), &node_b);
+        } else if (node_a.is_leaf()) {
+          node_pairs.emplace_back(&node_a, &node_b.left());
+          node_pairs.emplace_back(&node_a, &node_b.right());
+        } else {
+          node_pairs.emplace_back(&node_a.left(), &node_b.left());
+          node_pairs.emplace_back(&node_a.right(), &node_b.left());
+          node_pairs.emplace_back(&node_a.left(), &node_b.right());
+          node_pairs.emplace_back(&node_a.right(), &node_b.right());
+        }
+      }
+    }
+  }
+
   /* Culls the nodes of the BVH based on the nodes' bounding volumes'
    relationships with a primitive object. This is different from the BVH-BVH
    Collide() method in that when a node is found to be overlapping the
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <limits>
+#include <utility>
 #include <vector>
 
 #include "drake/geometry/proximity/aabb.h"
@@ -54,6 +57,10 @@ class BvhUpdater {
   /* Updates the referenced bvh to maintain a good fit on the referenced mesh.
    */
   void Update() {
+    /* A full refit leaves the boxes without the padding that the incremental
+     update relies on. */
+    ResetIncrementalState();
+
     /* Get the *double-valued* mesh vertices. */
     const auto& vertices = GetMeshVertices(mesh_.vertices());
     if (vertices.size() == 0) return;
@@ -63,7 +70,200 @@ class BvhUpdater {
     UpdateRecursive(&bvh_.mutable_root_node(), vertices);
   }
 
+  /* Updates the referenced bvh so that it remains a valid (conservative) fit
+   on the referenced mesh, while only visiting the parts of the hierarchy whose
+   elements moved appreciably.
+
+   Each vertex remembers the position it had when its leaf boxes were last
+   fit. Only vertices that have since moved more than `tolerance` are
+   re-recorded; only the leaves containing those vertices (and their
+   ancestors) are refit. To guarantee that the unvisited boxes still bound
+   their elements, leaf boxes are fit to the recorded positions and padded by
+   `tolerance`. So, larger tolerances mean less work per update but looser
+   boxes. With a tolerance of zero the result is exactly the same as Update().
+
+   Because refitting never changes the hierarchy's topology, a mesh that
+   deforms far from its original configuration can end up with siblings whose
+   boxes overlap heavily, degrading culling. After refitting, overlap_ratio()
+   is compared with its value from when the hierarchy was built; if it has
+   grown by more than `max_overlap_increase`, the bvh is rebuilt from the mesh.
+
+   The first call (or the first call after Update(), ResetIncrementalState(),
+   or a change in `tolerance`) fits every box.
+
+   @pre tolerance >= 0 and max_overlap_increase >= 0. */
+  void UpdateIncremental(
+      double tolerance,
+      double max_overlap_increase = std::numeric_limits<double>::infinity()) {
+    DRAKE_DEMAND(tolerance >= 0);
+    DRAKE_DEMAND(max_overlap_increase >= 0);
+    const auto& vertices = GetMeshVertices(mesh_.vertices());
+    if (vertices.size() == 0) return;
+
+    if (nodes_.empty() || tolerance != tolerance_) {
+      InitializeIncrementalState(vertices, tolerance);
+      num_refit_nodes_ = static_cast<int>(nodes_.size());
+      return;
+    }
+
+    /* Record the vertices that left their tolerance region, and flag every
+     leaf that contains one of them -- along with its ancestors -- as dirty. */
+    std::vector<int> dirty_nodes;
+    for (int v = 0; v < static_cast<int>(vertices.size()); ++v) {
+      if ((vertices[v] - fitted_positions_[v]).norm() <= tolerance_) continue;
+      fitted_positions_[v] = vertices[v];
+      for (int i = vertex_leaf_start_[v]; i < vertex_leaf_start_[v + 1]; ++i) {
+        for (int n = vertex_leaves_[i]; n >= 0 && !is_dirty_[n];
+             n = parent_[n]) {
+          is_dirty_[n] = true;
+          dirty_nodes.push_back(n);
+        }
+      }
+    }
+
+    /* In pre-order, every child has a larger index than its parent, so
+     processing in decreasing index order refits bottom-up. */
+    std::sort(dirty_nodes.begin(), dirty_nodes.end(), std::greater<int>());
+    for (int n : dirty_nodes) {
+      RefitNode(n);
+      is_dirty_[n] = false;
+    }
+    num_refit_nodes_ = static_cast<int>(dirty_nodes.size());
+
+    if (overlap_ratio() - initial_overlap_ratio_ > max_overlap_increase) {
+      bvh_ = Bvh<Aabb, MeshType>(mesh_);
+      ++num_rebuilds_;
+      InitializeIncrementalState(vertices, tolerance_);
+    }
+  }
+
+  /* Discards the bookkeeping of UpdateIncremental() so that its next call fits
+   every box. This must be called whenever the referenced bvh is replaced
+   (e.g., assigned to) by means other than this updater. */
+  void ResetIncrementalState() {
+    nodes_.clear();
+    parent_.clear();
+  }
+
+  /* A measure of the culling quality of the bvh as last maintained by
+   UpdateIncremental(): the total volume of overlap between sibling boxes
+   divided by the total volume of their parent boxes. It lies in the range
+   [0, 1]; lower is better. Returns zero if UpdateIncremental() hasn't
+   initialized its bookkeeping.  */
+  double overlap_ratio() const {
+    return total_volume_ > 0 ? total_overlap_ / total_volume_ : 0.0;
+  }
+
+  /* The number of nodes refit by the most recent call to UpdateIncremental().
+   */
+  int num_refit_nodes() const { return num_refit_nodes_; }
+
+  /* The number of times UpdateIncremental() has rebuilt the bvh. */
+  int num_rebuilds() const { return num_rebuilds_; }
+
  private:
+  using NodeType = typename Bvh<Aabb, MeshType>::NodeType;
+
+  static double Volume(const Vector3<double>& lower,
+                       const Vector3<double>& upper) {
+    return (upper - lower).cwiseMax(0.0).prod();
+  }
+
+  // Indexes the nodes in pre-order, records the vertex-to-leaf adjacency, and
+  // fits every box around the given vertex positions.
+  void InitializeIncrementalState(const std::vector<Vector3<double>>& vertices,
+                                  double tolerance) {
+    tolerance_ = tolerance;
+    nodes_.clear();
+    parent_.clear();
+    std::vector<std::pair<NodeType*, int>> stack{{&bvh_.mutable_root_node(),
+                                                  -1}};
+    while (!stack.empty()) {
+      auto [node, parent] = stack.back();
+      stack.pop_back();
+      nodes_.push_back(node);
+      parent_.push_back(parent);
+      if (!node->is_leaf()) {
+        const int index = static_cast<int>(nodes_.size()) - 1;
+        // The right child is pushed first, so the left is visited first.
+        stack.emplace_back(&node->right(), index);
+        stack.emplace_back(&node->left(), index);
+      }
+    }
+    const int num_nodes = static_cast<int>(nodes_.size());
+    is_dirty_.assign(num_nodes, false);
+    overlap_.assign(num_nodes, 0.0);
+    volume_.assign(num_nodes, 0.0);
+
+    // A compressed row layout of the leaves that contain each vertex.
+    const int num_vertices = static_cast<int>(vertices.size());
+    std::vector<std::vector<int>> leaves_of_vertex(num_vertices);
+    for (int n = 0; n < num_nodes; ++n) {
+      const NodeType& node = *nodes_[n];
+      if (!node.is_leaf()) continue;
+      for (int e = 0; e < node.num_element_indices(); ++e) {
+        const auto& element = mesh_.element(node.element_index(e));
+        for (int i = 0; i < MeshType::kVertexPerElement; ++i) {
+          std::vector<int>& leaves = leaves_of_vertex[element.vertex(i)];
+          if (leaves.empty() || leaves.back() != n) leaves.push_back(n);
+        }
+      }
+    }
+    vertex_leaf_start_.assign(1, 0);
+    vertex_leaves_.clear();
+    for (const std::vector<int>& leaves : leaves_of_vertex) {
+      vertex_leaves_.insert(vertex_leaves_.end(), leaves.begin(),
+                            leaves.end());
+      vertex_leaf_start_.push_back(static_cast<int>(vertex_leaves_.size()));
+    }
+
+    fitted_positions_ = vertices;
+    total_overlap_ = 0;
+    total_volume_ = 0;
+    for (int n = num_nodes - 1; n >= 0; --n) {
+      RefitNode(n);
+    }
+    initial_overlap_ratio_ = overlap_ratio();
+  }
+
+  // Refits the box of the node with the given pre-order index (assuming its
+  // children, if any, are already up to date) and updates the overlap
+  // bookkeeping.
+  void RefitNode(int n) {
+    constexpr double kInf = std::numeric_limits<double>::infinity();
+    NodeType& node = *nodes_[n];
+    /* Intentionally uninitialized. */
+    Vector3<double> lower, upper;
+    if (node.is_leaf()) {
+      lower << kInf, kInf, kInf;
+      upper = -lower;
+      for (int e = 0; e < node.num_element_indices(); ++e) {
+        const auto& element = mesh_.element(node.element_index(e));
+        for (int i = 0; i < MeshType::kVertexPerElement; ++i) {
+          const Vector3<double>& p_MV = fitted_positions_[element.vertex(i)];
+          lower = lower.cwiseMin(p_MV);
+          upper = upper.cwiseMax(p_MV);
+        }
+      }
+      const Vector3<double> padding = Vector3<double>::Constant(tolerance_);
+      lower -= padding;
+      upper += padding;
+    } else {
+      const Aabb& left = node.left().bv();
+      const Aabb& right = node.right().bv();
+      lower = left.lower().cwiseMin(right.lower());
+      upper = left.upper().cwiseMax(right.upper());
+      const double overlap = Volume(left.lower().cwiseMax(right.lower()),
+                                    left.upper().cwiseMin(right.upper()));
+      const double volume = Volume(lower, upper);
+      total_overlap_ += overlap - overlap_[n];
+      total_volume_ += volume - volume_[n];
+      overlap_[n] = overlap;
+      volume_[n] = volume;
+    }
+    node.bv().set_bounds(lower, upper);
+  }
+
   // If the mesh type is already double-valued, simply return the mesh vertices.
   static const std::vector<Vector3<double>>& GetMeshVertices(
       const std::vector<Vector3<double>>& vertices) {
@@ -116,6 +316,28 @@ class BvhUpdater {
 
   const MeshType& mesh_;
   Bvh<Aabb, MeshType>& bvh_;
+
+  /* The bookkeeping for UpdateIncremental(); empty nodes_ means it has not
+   been initialized for the current bvh. Nodes are indexed in pre-order. */
+  std::vector<NodeType*> nodes_;
+  // The index of each node's parent (-1 for the root).
+  std::vector<int> parent_;
+  std::vector<bool> is_dirty_;
+  // For internal nodes, the volume of their box and of its children's overlap.
+  std::vector<double> overlap_;
+  std::vector<double> volume_;
+  double total_overlap_{0};
+  double total_volume_{0};
+  double initial_overlap_ratio_{0};
+  // The leaves containing vertex v are
+  // vertex_leaves_[vertex_leaf_start_[v]:vertex_leaf_start_[v + 1]].
+  std::vector<int> vertex_leaf_start_;
+  std::vector<int> vertex_leaves_;
+  // The position of each vertex when its leaves were last fit.
+  std::vector<Vector3<double>> fitted_positions_;
+  double tolerance_{0};
+  int num_refit_nodes_{0};
+  int num_rebuilds_{0};
 };
 
 }  // namespace internal
@@ -1,7 +1,8 @@
 #include "drake/geometry/proximity/collision_filter.h"
 
+#include <algorithm>
+
 #include "drake/common/drake_assert.h"
-#include "drake/common/unused.h"
 
 namespace drake {
 namespace geometry {
@@ -16,6 +17,49 @@ CollisionFilter::CollisionFilter() {
   filter_history_.emplace_back(FilterState{}, FilterId::get_new_id());
 }
 
+CollisionFilter::FilterState::FilterState(int capacity,
+                                          PairRelationship relationship)
+    : capacity_(capacity),
+      words_per_row_((capacity + 63) / 64),
+      low_(static_cast<size_t>(capacity) * words_per_row_,
+           (relationship & 1) ? ~uint64_t{0} : 0),
+      high_(low_.size(), (relationship & 2) ? ~uint64_t{0} : 0) {}
+
+void CollisionFilter::FilterState::SetSlot(int slot,
+                                           PairRelationship relationship) {
+  /* The row is set word by word; the column bit by bit. */
+  const uint64_t low = (relationship & 1) ? ~uint64_t{0} : 0;
+  const uint64_t high = (relationship & 2) ? ~uint64_t{0} : 0;
+  std::fill_n(low_.begin() + slot * words_per_row_, words_per_row_, low);
+  std::fill_n(high_.begin() + slot * words_per_row_, words_per_row_, high);
+  for (int i = 0; i < capacity_; ++i) {
+    SetOne(i, slot, relationship);
+  }
+}
+
+void CollisionFilter::FilterState::Grow(int capacity) {
+  DRAKE_DEMAND(capacity >= capacity_);
+  FilterState grown(capacity, kUndefined);
+  for (int i = 0; i < capacity_; ++i) {
+    std::copy_n(low_.begin() + i * words_per_row_, words_per_row_,
+                grown.low_.begin() + i * grown.words_per_row_);
+    std::copy_n(high_.begin() + i * words_per_row_, words_per_row_,
+                grown.high_.begin() + i * grown.words_per_row_);
+  }
+  *this = std::move(grown);
+}
+
+void CollisionFilter::FilterState::Compose(const FilterState& delta) {
+  DRAKE_DEMAND(delta.capacity_ == capacity_);
+  for (size_t w = 0; w < low_.size(); ++w) {
+    /* The pairs that are defined in the delta and are not invariant here. */
+    const uint64_t mask =
+        (delta.low_[w] | delta.high_[w]) & ~(low_[w] & high_[w]);
+    low_[w] = (low_[w] & ~mask) | (delta.low_[w] & mask);
+    high_[w] = (high_[w] & ~mask) | (delta.high_[w] & mask);
+  }
+}
+
 // TODO(SeanCurtis-TRI): Multiple calls to Apply will lead to multiple
 //  constructions of std::unordered_set from GeometrySet (as opposed to
 //  re-using a single set). If this is a performance issue, revisit this so
@@ -64,7 +108,7 @@ FilterId CollisionFilter::ApplyTransient(
   //  history and maintain the composite copy.
   Apply(declaration, extract_ids, is_invariant, &filter_state_);
   filter_history_.emplace_back(
-      InitializeTransientState(filter_state_, kUndefined),
+      FilterState(filter_state_.capacity(), kUndefined),
       FilterId::get_new_id());
   Apply(declaration, extract_ids, is_invariant,
         &filter_history_.back().filter_state);
@@ -92,20 +136,7 @@ bool CollisionFilter::RemoveDeclaration(FilterId id) {
     filter_history_.erase(it);
     filter_state_ = filter_history_[0].filter_state;
     for (size_t i = 1; i < filter_history_.size(); ++i) {
-      const FilterState& state = filter_history_[i].filter_state;
-      /* Note: If the filtered state in transient declarations was sparse, this
-       application algorithm would directly benefit. It only requires that the
-       persistent state has all of the required pairs. See the TODO in
-       AddGeometry() for more discussion. */
-      for (const auto& [source_id, source_map] : state) {
-        for (const auto& [pair_id, pair_relation] : source_map) {
-          if (pair_relation != kUndefined) {
-            if (filter_state_[source_id][pair_id] != kInvariantFilter) {
-              filter_state_[source_id][pair_id] = pair_relation;
-            }
-          }
-        }
-      }
+      filter_state_.Compose(filter_history_[i].filter_state);
     }
     return true;
   }
@@ -120,99 +151,123 @@ void CollisionFilter::Flatten() {
 }
 
 void CollisionFilter::AddGeometry(GeometryId new_id) {
+  DRAKE_DEMAND(!HasGeometry(new_id));
+  int slot;
+  if (!free_slots_.empty()) {
+    slot = free_slots_.back();
+    free_slots_.pop_back();
+    slot_ids_[slot] = new_id;
+  } else {
+    slot = static_cast<int>(slot_ids_.size());
+    slot_ids_.push_back(new_id);
+    if (slot >= filter_state_.capacity()) {
+      /* Grow geometrically, so that adding N geometries is O(N²). */
+      const int capacity = std::max(64, 2 * filter_state_.capacity());
+      filter_state_.Grow(capacity);
+      for (auto& delta : filter_history_) {
+        delta.filter_state.Grow(capacity);
+      }
+    }
+  }
+  slots_[new_id] = slot;
+
   /* Current and persistent configurations should simply add the id with
    unfiltered status. */
-  AddGeometry(new_id, &filter_state_, kUnfiltered);
-  AddGeometry(new_id, &filter_history_[0].filter_state, kUnfiltered);
-  // TODO(SeanCurtis): Can I skip this work by allowing delta filter state to be
-  //  incomplete? If each transient delta *only* contains explicitly declared
-  //  changes, iterating through it would be faster. More complex, but faster.
+  filter_state_.SetSlot(slot, kUnfiltered);
+  filter_history_[0].filter_state.SetSlot(slot, kUnfiltered);
   /* Active transient history should add the id with undefined status. */
   for (size_t i = 1; i < filter_history_.size(); ++i) {
-    AddGeometry(new_id, &filter_history_[i].filter_state, kUndefined);
+    filter_history_[i].filter_state.SetSlot(slot, kUndefined);
   }
 }
 
 void CollisionFilter::RemoveGeometry(GeometryId remove_id) {
-  /* Simply remove the geometry from everything. */
-  RemoveGeometry(remove_id, &filter_state_);
-  for (auto& delta : filter_history_) {
-    RemoveGeometry(remove_id, &delta.filter_state);
-  }
+  /* The tables don't need to change; the slot's row and column will be reset
+   when it's reused. */
+  const int slot = GetSlot(remove_id);
+  slots_.erase(remove_id);
+  slot_ids_[slot] = GeometryId{};
+  free_slots_.push_back(slot);
 }
 
 bool CollisionFilter::CanCollideWith(GeometryId id_A, GeometryId id_B) const {
   if (id_A == id_B) return false;
-  if (id_A < id_B) {
-    return filter_state_.at(id_A).at(id_B) == kUnfiltered;
-  } else {
-    return filter_state_.at(id_B).at(id_A) == kUnfiltered;
+  return filter_state_.is_unfiltered(slots_.at(id_A), slots_.at(id_B));
+}
+
+std::vector<int> CollisionFilter::GetSlots(
+    const std::unordered_set<GeometryId>& ids) const {
+  std::vector<int> result;
+  result.reserve(ids.size());
+  for (GeometryId id : ids) {
+    result.push_back(GetSlot(id));
   }
+  return result;
 }
 
 void CollisionFilter::AddFiltersBetween(
     const GeometrySet& set_A, const GeometrySet& set_B,
     const CollisionFilter::ExtractIds& extract_ids, bool is_invariant,
-    FilterState* state_out) {
-  const std::unordered_set<GeometryId> ids_A = extract_ids(set_A);
-  const std::unordered_set<GeometryId>& ids_B =
-      &set_A == &set_B ? ids_A : extract_ids(set_B);
-  for (GeometryId id_A : ids_A) {
-    for (GeometryId id_B : ids_B) {
-      AddFilteredPair(id_A, id_B, is_invariant, state_out);
+    FilterState* state_out) const {
+  const std::vector<int> slots_A = GetSlots(extract_ids(set_A));
+  const std::vector<int> slots_B =
+      &set_A == &set_B ? slots_A : GetSlots(extract_ids(set_B));
+  for (int slot_A : slots_A) {
+    for (int slot_B : slots_B) {
+      AddFilteredPair(slot_A, slot_B, is_invariant, state_out);
     }
   }
 }
 
 void CollisionFilter::RemoveFiltersBetween(
     const GeometrySet& set_A, const GeometrySet& set_B,
-    const CollisionFilter::ExtractIds& extract_ids, FilterState* state_out) {
-  const std::unordered_set<GeometryId> ids_A = extract_ids(set_A);
-  const std::unordered_set<GeometryId>& ids_B =
-      &set_A == &set_B ? ids_A : extract_ids(set_B);
-  for (GeometryId id_A : ids_A) {
-    for (GeometryId id_B : ids_B) {
-      RemoveFilteredPair(id_A, id_B, state_out);
+    const CollisionFilter::ExtractIds& extract_ids,
+    FilterState* state_out) const {
+  const std::vector<int> slots_A = GetSlots(extract_ids(set_A));
+  const std::vector<int> slots_B =
+      &set_A == &set_B ? slots_A : GetSlots(extract_ids(set_B));
+  for (int slot_A : slots_A) {
+    for (int slot_B : slots_B) {
+      RemoveFilteredPair(slot_A, slot_B, state_out);
     }
   }
 }
 
-void CollisionFilter::AddFilteredPair(GeometryId id_A, GeometryId id_B,
+void CollisionFilter::AddFilteredPair(int slot_A, int slot_B,
                                       bool is_invariant,
                                       FilterState* state_out) {
   FilterState& filter_state = *state_out;
-  DRAKE_DEMAND(filter_state.count(id_A) == 1 &&
-               filter_state.count(id_B) == 1);
-
-  if (id_A == id_B) return;
-  PairRelationship& pair_relation =
-      id_A < id_B ? filter_state[id_A][id_B] : filter_state[id_B][id_A];
-  if (pair_relation == kInvariantFilter) return;
-  pair_relation = is_invariant ? kInvariantFilter : kFiltered;
+  if (slot_A == slot_B) return;
+  if (filter_state.get(slot_A, slot_B) == kInvariantFilter) return;
+  filter_state.set(slot_A, slot_B, is_invariant ? kInvariantFilter : kFiltered);
 }
 
-void CollisionFilter::RemoveFilteredPair(GeometryId id_A, GeometryId id_B,
+void CollisionFilter::RemoveFilteredPair(int slot_A, int slot_B,
                                          FilterState* state_out) {
   FilterState& filter_state = *state_out;
-  DRAKE_DEMAND(filter_state.count(id_A) == 1 &&
-               filter_state.count(id_B) == 1);
-  if (id_A == id_B) return;
-  PairRelationship& pair_relation =
-      id_A < id_B ? filter_state[id_A][id_B] : filter_state[id_B][id_A];
-  if (pair_relation == kInvariantFilter) return;
-  pair_relation = kUnfiltered;
+  if (slot_A == slot_B) return;
+  if (filter_state.get(slot_A, slot_B) == kInvariantFilter) return;
+  filter_state.set(slot_A, slot_B, kUnfiltered);
 }
 
 bool CollisionFilter::operator==(const CollisionFilter& other) const {
   if (this == &other) return true;
-  if (filter_state_.size() != other.filter_state_.size()) return false;
-  for (const auto& [this_id, this_map] : filter_state_) {
-    if (!other.HasGeometry(this_id)) return false;
-    for (const auto& [this_pair_id, can_collide] : this_map) {
-      unused(can_collide);
-      if (!other.HasGeometry(this_pair_id)) return false;
-      if (CanCollideWith(this_id, this_pair_id) !=
-          other.CanCollideWith(this_id, this_pair_id)) {
+  if (slots_.size() != other.slots_.size()) return false;
+  /* The two filters may have assigned different slots to the same geometry,
+   so we compare the pairs through the other's slots. */
+  std::vector<std::pair<int, int>> slot_pairs;
+  slot_pairs.reserve(slots_.size());
+  for (const auto& [id, slot] : slots_) {
+    const auto other_iter = other.slots_.find(id);
+    if (other_iter == other.slots_.end()) return false;
+    slot_pairs.emplace_back(slot, other_iter->second);
+  }
+  for (size_t i = 0; i < slot_pairs.size(); ++i) {
+    for (size_t j = i + 1; j < slot_pairs.size(); ++j) {
+      if (filter_state_.is_unfiltered(slot_pairs[i].first,
+                                      slot_pairs[j].first) !=
+          other.filter_state_.is_unfiltered(slot_pairs[i].second,
+                                            slot_pairs[j].second)) {
         return false;
       }
     }
@@ -221,9 +276,11 @@ bool CollisionFilter::operator==(const CollisionFilter& other) const {
 }
 
 CollisionFilter CollisionFilter::MakeClearCopy() const {
-  auto clear_state = CollisionFilter::InitializeTransientState(
-      filter_state_, CollisionFilter::kUnfiltered);
+  const FilterState clear_state(filter_state_.capacity(), kUnfiltered);
   CollisionFilter new_filter;
+  new_filter.slots_ = slots_;
+  new_filter.slot_ids_ = slot_ids_;
+  new_filter.free_slots_ = free_slots_;
   new_filter.filter_state_ = clear_state;
   new_filter.filter_history_[0].filter_state = clear_state;
   return new_filter;
@@ -231,7 +288,8 @@ CollisionFilter CollisionFilter::MakeClearCopy() const {
 
 void CollisionFilter::Apply(const CollisionFilterDeclaration& declaration,
                             const CollisionFilter::ExtractIds& extract_ids,
-                            bool is_invariant, FilterState* filter_state) {
+                            bool is_invariant,
+                            FilterState* filter_state) const {
   using Operation = CollisionFilterDeclaration::StatementOp;
   for (const auto& statement : declaration.statements()) {
     switch (statement.operation) {
@@ -259,53 +317,6 @@ void CollisionFilter::Apply(const CollisionFilterDeclaration& declaration,
   }
 }
 
-void CollisionFilter::AddGeometry(GeometryId new_id,
-                                  FilterState* filter_state_out,
-                                  PairRelationship relationship) {
-  FilterState& filter_state = *filter_state_out;
-  DRAKE_DEMAND(filter_state.count(new_id) == 0);
-  GeometryMap& new_map = filter_state[new_id] = {};
-  for (auto& [other_id, other_map] : filter_state) {
-    /* Whichever id is *smaller* tracks the relationship with the other.
-     That relationship defaults to unfiltered (i.e., "can collide").
-
-     Note: we're iterating over filter_state_ and assigning to either new_map
-     or other_map. This doesn't invalidate the implicit iterator of the range
-     operator. We never change the *keys* of filter_state_ in this loop, only
-     its values. And we don't do any iteration in the new_map or other_map
-     so don't depend on their iterators. */
-    if (other_id < new_id) {
-      other_map[new_id] = relationship;
-    } else {
-      new_map[other_id] = relationship;
-    }
-  }
-}
-
-void CollisionFilter::RemoveGeometry(GeometryId remove_id,
-                                     FilterState* filter_state_out) {
-  FilterState& filter_state = *filter_state_out;
-  DRAKE_DEMAND(filter_state.count(remove_id) == 1);
-  filter_state.erase(remove_id);
-  for (auto& [other_id, other_map] : filter_state) {
-    /* remove_id will only be found in maps belonging to geometries with ids
-     that are smaller than remove_id. Those that are larger were deleted when we
-     removed remove_id's entry. */
-    if (other_id < remove_id) {
-      other_map.erase(remove_id);
-    }
-  }
-}
-
-CollisionFilter::FilterState CollisionFilter::InitializeTransientState(
-    const FilterState& reference, PairRelationship default_relationship) {
-  FilterState new_state;
-  for (const auto& [id, _] : reference) {
-    unused(_);
-    AddGeometry(id, &new_state, default_relationship);
-  }
-  return new_state;
-}
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
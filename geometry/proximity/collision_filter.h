@@ -1,11 +1,13 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "drake/common/drake_assert.h"
 #include "drake/geometry/collision_filter_declaration.h"
 #include "drake/geometry/geometry_ids.h"
 
@@ -126,7 +128,7 @@ class CollisionFilter {
   }
 
   /* Reports if the given `id` has been added to this filter system. */
-  bool HasGeometry(GeometryId id) const { return filter_state_.count(id) > 0; }
+  bool HasGeometry(GeometryId id) const { return slots_.count(id) > 0; }
 
  private:
   friend class CollisionFilterTest;
@@ -135,7 +137,8 @@ class CollisionFilter {
    of the registered geometry but no collision filters. */
   CollisionFilter MakeClearCopy() const;
 
-  /* The collision filter state between a pair of geometries. */
+  /* The collision filter state between a pair of geometries. FilterState
+   relies on these values being 0, 1, 2, and 3. */
   enum PairRelationship {
     kUndefined,        // No relationship has been defined; used for transient
                        // declarations.
@@ -147,46 +150,93 @@ class CollisionFilter {
 
   /* The "filter state" is a 2d table. For N registered geometries, it is
    an NxN table where cell (i, j) reports the filter status of the ith and jth
-   geometries (although i and j are actually GeometryIds).
-
-   Because a pair's filter status is symmetric (e.g., (a, b) and (b, a) are
-   equivalent), we only encode a triangular portion of the table. We have two
-   types that work together to define the table: GeometryMap and FilterState.
-
-   FilterState maps a GeometryId to the filter relationship with all other
-   registered geometries with *greater* GeometryId values. That set of
-   geometries is contained in a GeometryMap, where each entry on that "row"
-   is the key-value pair (other_id, filter_pair_state).
-
-   So, given a FilterState instance (filter_state) and two GeometryIds, a and b,
-   we could set the filtered state as (assuming a < b):
-
-      filter_state[a][b] = kFiltered;
+   geometries.
+
+   Each registered geometry is assigned a dense index, its "slot" (see
+   slots_), which indexes the rows and columns of the table. Slots of removed
+   geometries are reused by geometries added later. The table is stored in
+   full (both (i, j) and (j, i)), so that each row is contiguous, as two
+   bit matrices: each pair's PairRelationship is two bits, one in each
+   "plane". Compared to maps of maps keyed on GeometryId, this makes lookups
+   cache friendly and the table small (e.g., 250 kB for 1000 geometries).
+
+   All of the tables of one CollisionFilter have the same capacity (the number
+   of slots they can hold). */
+  class FilterState {
+   public:
+    FilterState() = default;
+
+    /* Creates a table with the given `capacity`, in which every pair has the
+     given `relationship`. */
+    FilterState(int capacity, PairRelationship relationship);
+
+    int capacity() const { return capacity_; }
+
+    PairRelationship get(int i, int j) const {
+      const int word = i * words_per_row_ + (j >> 6);
+      const uint64_t bit = uint64_t{1} << (j & 63);
+      return static_cast<PairRelationship>(((low_[word] & bit) ? 1 : 0) |
+                                           ((high_[word] & bit) ? 2 : 0));
+    }
+
+    /* The equivalent of get(i, j) == kUnfiltered. */
+    bool is_unfiltered(int i, int j) const {
+      const int word = i * words_per_row_ + (j >> 6);
+      const uint64_t bit = uint64_t{1} << (j & 63);
+      return (low_[word] & bit) && !(high_[word] & bit);
+    }
+
+    /* Sets the relationship of the pair (i, j) (and (j, i)). */
+    void set(int i, int j, PairRelationship relationship) {
+      SetOne(i, j, relationship);
+      SetOne(j, i, relationship);
+    }
+
+    /* Sets the relationship of the given `slot` with every slot. */
+    void SetSlot(int slot, PairRelationship relationship);
+
+    /* Grows the table to the given `capacity`, preserving the relationship of
+     every existing pair. The new pairs are kUndefined. */
+    void Grow(int capacity);
+
+    /* Composes the transient `delta` onto this table: every pair that `delta`
+     defines takes the delta's relationship, unless it's kInvariantFilter in
+     this table. */
+    void Compose(const FilterState& delta);
+
+   private:
+    void SetOne(int i, int j, PairRelationship relationship) {
+      const int word = i * words_per_row_ + (j >> 6);
+      const uint64_t bit = uint64_t{1} << (j & 63);
+      low_[word] =
+          (relationship & 1) ? (low_[word] | bit) : (low_[word] & ~bit);
+      high_[word] =
+          (relationship & 2) ? (high_[word] | bit) : (high_[word] & ~bit);
+    }
+
+    int capacity_{};
+    int words_per_row_{};
+    // The low and high bits of each pair's relationship, row by row.
+    std::vector<uint64_t> low_;
+    std::vector<uint64_t> high_;
+  };
 
-   As a concrete example, if we've registered GeometryId values 10, 20, 30, 40,
-   the filter state would have keys {10, 20, 30, 40} which each maps to a
-   corresponding GeometryMap as illustrated below.
-     10 -> {(20, PairRelationship), (30, PairRelationship),
-            (40, PairRelationship)}
-     20 -> {(30, PairRelationship), (40, PairRelationship)}
-     30 -> {(40, PairRelationship)}
-     40 -> {} */
-  using GeometryMap = std::unordered_map<GeometryId, PairRelationship>;
+  /* Returns the slot of the given geometry.
+   @pre `id` is part of this filter system. */
+  int GetSlot(GeometryId id) const {
+    const auto iter = slots_.find(id);
+    DRAKE_DEMAND(iter != slots_.end());
+    return iter->second;
+  }
 
-  using FilterState = std::unordered_map<GeometryId, GeometryMap>;
+  /* Returns the slots of the given geometries. */
+  std::vector<int> GetSlots(
+      const std::unordered_set<GeometryId>& ids) const;
 
   /* Applies the given declaration to an arbitrary `filter_state`. */
-  static void Apply(const CollisionFilterDeclaration& declaration,
-                    const ExtractIds& extract_ids, bool is_invariant,
-                    FilterState* filter_state);
-
-  /* Adds the geometry with the given `id` to the given filter state with the
-   given initial_state for all pairs including the new id. */
-  static void AddGeometry(GeometryId id, FilterState* filter_state_out,
-                          PairRelationship relationship);
-
-  /* Removes the geometry with the given `id` from the given filter state. */
-  static void RemoveGeometry(GeometryId id, FilterState* filter_state_out);
+  void Apply(const CollisionFilterDeclaration& declaration,
+             const ExtractIds& extract_ids, bool is_invariant,
+             FilterState* filter_state) const;
 
   /* Declares pairs (`id_A`, `id_B`) `∀ id_A ∈ set_A, id_B ∈ set_B` to be
    filtered. For each pair, if they are already filtered, no discernible change
@@ -199,33 +249,34 @@ class CollisionFilter {
    responsible for determining invariance when adding filters.
 
    @pre All ids in `id_A` and `id_B` are part of this filter system.  */
-  static void AddFiltersBetween(const GeometrySet& set_A,
-                                const GeometrySet& set_B,
-                                const ExtractIds& extract_ids,
-                                bool is_invariant, FilterState* state_out);
+  void AddFiltersBetween(const GeometrySet& set_A, const GeometrySet& set_B,
+                         const ExtractIds& extract_ids, bool is_invariant,
+                         FilterState* state_out) const;
 
   /* Declares pairs (`id_A`, `id_B`) `∀ id_A ∈ set_A, id_B ∈ set_B` to be
    unfiltered (if the filter isn't invariant). For each pair, if they are
    already unfiltered, no discernible change is made.
 
    @pre All ids `id_A` and `id_B` are part of the system.  */
-  static void RemoveFiltersBetween(const GeometrySet& set_A,
-                                   const GeometrySet& set_B,
-                                   const ExtractIds& extract_ids,
-                                   FilterState* state_out);
+  void RemoveFiltersBetween(const GeometrySet& set_A, const GeometrySet& set_B,
+                            const ExtractIds& extract_ids,
+                            FilterState* state_out) const;
 
   /* Atomic operation in support of AddFiltersBetween().  */
-  static void AddFilteredPair(GeometryId id_A, GeometryId id_B,
-                              bool is_invariant, FilterState* state_out);
+  static void AddFilteredPair(int slot_A, int slot_B, bool is_invariant,
+                              FilterState* state_out);
 
   /* Atomic operation in support of RemoveFilterBetween().  */
-  static void RemoveFilteredPair(GeometryId id_A, GeometryId id_B,
+  static void RemoveFilteredPair(int slot_A, int slot_B,
                                  FilterState* state_out);
 
-  /* Instantiates a FilterState such that all known pairs have given
-   default relationship. */
-  static FilterState InitializeTransientState(
-      const FilterState& reference, PairRelationship default_relationship);
+  /* The slot of each registered geometry. */
+  std::unordered_map<GeometryId, int> slots_;
+
+  /* The geometry in each slot (invalid for the slots of removed geometries),
+   and the slots that can be reused. */
+  std::vector<GeometryId> slot_ids_;
+  std::vector<int> free_slots_;
 
   /* The filter state of all pairs of geometry.
 
@@ -0,0 +1,23 @@
+#include "drake/geometry/proximity/contact_pair_cache.h"
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+void ContactPairCache::EndStep(Updates&& updates, int num_skipped) {
+  DRAKE_DEMAND(num_skipped >= 0);
+  entries_.clear();
+  entries_.reserve(updates.size());
+  for (auto& [pair, entry] : updates) {
+    entries_.insert_or_assign(pair, std::move(entry));
+  }
+  updates.clear();
+  ++num_steps_;
+  num_skipped_in_last_step_ = num_skipped;
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/sorted_pair.h"
+#include "drake/geometry/geometry_ids.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* A record of witness features of geometry pairs, carried from one
+ point-pair penetration query to the next to exploit the temporal coherence of
+ contact: between consecutive time steps, pairs that are apart tend to stay
+ apart and pairs in contact tend to stay in contact.
+
+ Each entry, keyed by the (sorted) pair of geometry ids, holds a direction
+ along which the pair was last known to be separated or, if it was in contact,
+ its contact normal (the best guess for the direction along which it will
+ separate). The penetration query uses that axis to warm start the
+ narrowphase: if the geometries' current extents along the axis don't overlap,
+ the pair is separated and the narrowphase is skipped.
+
+ The cache is owned by the caller of the query (not by the ProximityEngine),
+ which passes it to every query that constitutes one step (see
+ ProximityEngine::ComputePointPairPenetration()). Different callers can
+ therefore query the same engine concurrently, each with its own cache.
+
+ An entry is dropped as soon as the broadphase stops reporting its pair, i.e.,
+ once the pair's bounding boxes are separated. Skipping the narrowphase never
+ changes the query's results; it only avoids work.  */
+class ContactPairCache {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ContactPairCache)
+
+  /* The per-pair record. For the pair (A, B), A is the geometry with the
+   smaller id.  */
+  struct Entry {
+    /* A unit vector, expressed in the world frame, pointing from A towards B
+     along which A and B were last known to be separated (or, if they were in
+     contact, the negated contact normal -nhat_BA_W).  */
+    Vector3<double> axis_AB_W;
+
+    /* The number of consecutive steps (ending with the most recent one) in
+     which this pair has been in contact.  */
+    int num_steps_in_contact{};
+  };
+
+  /* The entries recorded by a single step, in no particular order.  */
+  using Updates = std::vector<std::pair<SortedPair<GeometryId>, Entry>>;
+
+  ContactPairCache() = default;
+
+  /* Returns the entry for the given pair, or nullptr if there is none.  */
+  const Entry* Find(const SortedPair<GeometryId>& pair) const {
+    auto iter = entries_.find(pair);
+    return iter == entries_.end() ? nullptr : &iter->second;
+  }
+
+  /* Ends a step: the entries are replaced by the given `updates`, so the pairs
+   that weren't recorded in this step are dropped. `num_skipped` is the number
+   of pairs for which the step skipped the narrowphase.  */
+  void EndStep(Updates&& updates, int num_skipped);
+
+  /* The number of entries.  */
+  int size() const { return static_cast<int>(entries_.size()); }
+
+  /* The number of steps ended so far.  */
+  int num_steps() const { return num_steps_; }
+
+  /* The number of pairs whose narrowphase was skipped in the most recent step
+   because a cached axis still separated them.  */
+  int num_skipped_in_last_step() const { return num_skipped_in_last_step_; }
+
+  /* Removes all entries. The counters are unaffected.  */
+  void clear() { entries_.clear(); }
+
+ private:
+  std::unordered_map<SortedPair<GeometryId>, Entry> entries_;
+  int num_steps_{0};
+  int num_skipped_in_last_step_{0};
+};
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -8,7 +8,13 @@ template <typename T>
 void DeformableVolumeMesh<T>::UpdateVertexPositions(
     const Eigen::Ref<const VectorX<T>>& q) {
   deformer_.SetAllPositions(q);
-  bvh_updater_.Update();
+  if (bvh_refit_tolerance_ == 0 &&
+      max_bvh_overlap_increase_ == std::numeric_limits<double>::infinity()) {
+    bvh_updater_.Update();
+  } else {
+    bvh_updater_.UpdateIncremental(bvh_refit_tolerance_,
+                                   max_bvh_overlap_increase_);
+  }
 }
 
 }  // namespace internal
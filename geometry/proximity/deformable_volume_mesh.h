@@ -1,5 +1,6 @@
 #pragma once
 
+#include <limits>
 #include <utility>
 
 #include "drake/geometry/proximity/bvh.h"
@@ -46,23 +47,38 @@ class DeformableVolumeMesh {
   // worry about setting the member mesh and bvh to the assigned data; we don't
   // have to (and can't) make any modifications to the deformer or bvh updater.
 
+  // The bvh updater's incremental bookkeeping refers to the nodes of the bvh
+  // it was initialized on; it is reset whenever bvh_ is assigned.
+
   DeformableVolumeMesh(const DeformableVolumeMesh& other)
-      : DeformableVolumeMesh(other.mesh_, other.bvh_) {}
+      : DeformableVolumeMesh(other.mesh_, other.bvh_) {
+    bvh_refit_tolerance_ = other.bvh_refit_tolerance_;
+    max_bvh_overlap_increase_ = other.max_bvh_overlap_increase_;
+  }
 
   DeformableVolumeMesh& operator=(const DeformableVolumeMesh& other) {
     if (this == &other) return *this;
     mesh_ = other.mesh();
     bvh_ = other.bvh_;
+    bvh_updater_.ResetIncrementalState();
+    bvh_refit_tolerance_ = other.bvh_refit_tolerance_;
+    max_bvh_overlap_increase_ = other.max_bvh_overlap_increase_;
     return *this;
   }
 
   DeformableVolumeMesh(DeformableVolumeMesh&& other)
-      : DeformableVolumeMesh(std::move(other.mesh_), std::move(other.bvh_)) {}
+      : DeformableVolumeMesh(std::move(other.mesh_), std::move(other.bvh_)) {
+    bvh_refit_tolerance_ = other.bvh_refit_tolerance_;
+    max_bvh_overlap_increase_ = other.max_bvh_overlap_increase_;
+  }
 
   DeformableVolumeMesh& operator=(DeformableVolumeMesh&& other) {
     if (this == &other) return *this;
     mesh_ = std::move(other.mesh_);
     bvh_ = std::move(other.bvh_);
+    bvh_updater_.ResetIncrementalState();
+    bvh_refit_tolerance_ = other.bvh_refit_tolerance_;
+    max_bvh_overlap_increase_ = other.max_bvh_overlap_increase_;
     return *this;
   }
 
@@ -88,6 +104,26 @@ class DeformableVolumeMesh {
   @pre q.size == 3 * mesh().num_vertices(). */
   void UpdateVertexPositions(const Eigen::Ref<const VectorX<T>>& q);
 
+  /* Configures how UpdateVertexPositions() maintains the bvh. By default
+   (a zero tolerance and no overlap limit), every update refits every box
+   exactly. With a positive `tolerance`, only the parts of the bvh containing
+   vertices that moved farther than `tolerance` are refit (the boxes are
+   padded by `tolerance` to remain conservative); if the sibling overlap of the
+   refit bvh grows by more than `max_overlap_increase`, it is rebuilt. See
+   BvhUpdater::UpdateIncremental() for details.
+   @pre tolerance >= 0 and max_overlap_increase >= 0. */
+  void SetBvhUpdateParameters(
+      double tolerance,
+      double max_overlap_increase = std::numeric_limits<double>::infinity()) {
+    DRAKE_DEMAND(tolerance >= 0);
+    DRAKE_DEMAND(max_overlap_increase >= 0);
+    bvh_refit_tolerance_ = tolerance;
+    max_bvh_overlap_increase_ = max_overlap_increase;
+  }
+
+  /* Read-only access to the bvh updater (e.g., for its statistics). */
+  const BvhUpdater<VolumeMesh<T>>& bvh_updater() const { return bvh_updater_; }
+
  private:
   // The delegate constructor used by move and copy constructors. We can't have
   // all three constructors delegate to this same constructor because the base
@@ -105,6 +141,8 @@ class DeformableVolumeMesh {
   MeshDeformer<VolumeMesh<T>> deformer_;
   Bvh<Aabb, VolumeMesh<T>> bvh_;
   BvhUpdater<VolumeMesh<T>> bvh_updater_;
+  double bvh_refit_tolerance_{0};
+  double max_bvh_overlap_increase_{std::numeric_limits<double>::infinity()};
 };
 
 }  // namespace internal
@@ -2,6 +2,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_bool.h"
+#include "drake/common/unused.h"
 
 namespace drake {
 namespace geometry {
@@ -356,6 +357,29 @@ SignedDistanceToPoint<T> DistanceToPoint<T>::operator()(
   }
 }
 
+template <typename T>
+SignedDistanceToPoint<T> DistanceToPoint<T>::operator()(
+    const MeshSignedDistanceField& field) {
+  if constexpr (scalar_predicate<T>::is_bool) {
+    const Vector3<T> p_GQ_G = X_WG_.inverse() * p_WQ_;
+    Vector3<T> grad_G;
+    const T distance = field.CalcSignedDistance(p_GQ_G, &grad_G);
+    const T norm = grad_G.norm();
+    if (norm > 0) {
+      grad_G /= norm;
+    } else {
+      grad_G = Vector3<T>::UnitX();
+    }
+    const Vector3<T> p_GN_G = p_GQ_G - distance * grad_G;
+    const Vector3<T> grad_W = X_WG_.rotation() * grad_G;
+    return SignedDistanceToPoint<T>{geometry_id_, p_GN_G, distance, grad_W};
+  } else {
+    // The Callback() never calls this with T = Expression.
+    unused(field);
+    DRAKE_UNREACHABLE();
+  }
+}
+
 template <typename T>
 SignedDistanceToPoint<T> DistanceToPoint<T>::operator()(
     const fcl::Halfspaced& halfspace) {
@@ -533,6 +557,23 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
 
   const fcl::CollisionGeometryd* collision_geometry =
       geometry_object->collisionGeometry().get();
+
+  // A mesh with a signed distance field is evaluated by its field.
+  if constexpr (scalar_predicate<T>::is_bool) {
+    if (data.mesh_sdfs != nullptr) {
+      const auto iter = data.mesh_sdfs->find(geometry_id);
+      if (iter != data.mesh_sdfs->end()) {
+        const math::RigidTransform<T> typed_X_WG(data.X_WGs.at(geometry_id));
+        DistanceToPoint<T> distance_to_point(geometry_id, typed_X_WG,
+                                             data.p_WQ_W);
+        SignedDistanceToPoint<T> distance = distance_to_point(*iter->second);
+        if (distance.distance <= data.threshold) {
+          data.distances.emplace_back(std::move(distance));
+        }
+        return false;
+      }
+    }
+  }
   if (ScalarSupport<T>::is_supported(collision_geometry->getNodeType())) {
     const math::RigidTransform<T> typed_X_WG(data.X_WGs.at(geometry_id));
     DistanceToPoint<T> distance_to_point(geometry_id, typed_X_WG, data.p_WQ_W);
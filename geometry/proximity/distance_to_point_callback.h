@@ -11,6 +11,7 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/eigen_types.h"
 #include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/proximity/mesh_signed_distance_field.h"
 #include "drake/geometry/proximity/proximity_utilities.h"
 #include "drake/geometry/query_results/signed_distance_to_point.h"
 #include "drake/math/rigid_transform.h"
@@ -74,6 +75,10 @@ struct CallbackData {
 
   /* The accumulator for results.  */
   std::vector<SignedDistanceToPoint<T>>& distances;
+
+  /* The signed distance fields of the meshes that have one, if any. Aliased.
+   The meshes without one are ignored.  */
+  const MeshSignedDistanceFields* mesh_sdfs{nullptr};
 };
 
 /* @name Functions for computing distance from point to primitives
@@ -168,6 +173,12 @@ class DistanceToPoint {
   /* Overload to compute distance to a sphere.  */
   SignedDistanceToPoint<T> operator()(const fcl::Sphered& sphere);
 
+  /* Overload to compute distance to a mesh with a signed distance field. The
+   gradient is the normalized gradient of the interpolated field; where that
+   vanishes, it is arbitrarily the x-axis of G. The nearest point N is Q
+   projected along the gradient onto the field's zero level set.  */
+  SignedDistanceToPoint<T> operator()(const MeshSignedDistanceField& field);
+
   /* Reports the "sign" of x with a small modification; Sign(0) --> 1.
    @tparam U  Templated to allow DistanceToPoint<AutoDiffXd> to still compute
               Sign<double> or Sign<AutoDiffXd> as needed.  */
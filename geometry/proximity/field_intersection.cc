@@ -21,6 +21,25 @@ namespace internal {
 
 using Eigen::Vector3d;
 
+namespace {
+
+// Returns true if all four vertices of a tetrahedron lie strictly on the same
+// side of the plane, i.e., the plane doesn't intersect the tetrahedron.
+template <typename T>
+bool IsTetrahedronOnOneSideOfPlane(const Vector3<T> (&p_MVs)[4],
+                                   const Plane<T>& plane_M) {
+  int num_positive = 0;
+  int num_negative = 0;
+  for (const Vector3<T>& p_MV : p_MVs) {
+    const T height = plane_M.CalcHeight(p_MV);
+    num_positive += (height > 0);
+    num_negative += (height < 0);
+  }
+  return num_positive == 4 || num_negative == 4;
+}
+
+}  // namespace
+
 template <typename T>
 bool CalcEquilibriumPlane(int element0,
                           const VolumeMeshFieldLinear<double, double>& field0_M,
@@ -79,13 +98,32 @@ std::vector<Vector3<T>> IntersectTetrahedra(
     int element0, const VolumeMesh<double>& mesh0_M,
     int element1, const VolumeMesh<double>& mesh1_N,
     const math::RigidTransform<T>& X_MN, const Plane<T>& equilibrium_plane_M) {
+  // Positions of vertices of tetrahedral element1 in mesh1_N expressed in
+  // frame M.
+  Vector3<T> p_MVs[4];
+  for (int i = 0; i < 4; ++i) {
+    p_MVs[i] =
+        X_MN * mesh1_N.vertex(mesh1_N.element(element1).vertex(i)).cast<T>();
+  }
+  // Most candidate pairs from the broad phase don't intersect. We reject the
+  // pairs whose element1 lies strictly on one side of the plane before doing
+  // any slicing or clipping. (SliceTetrahedronWithPlane() does the equivalent
+  // test for element0.)
+  if (IsTetrahedronOnOneSideOfPlane(p_MVs, equilibrium_plane_M)) {
+    return {};
+  }
+
   // TODO(DamrongGuoy): Refactor this buffer from being a function-local
   //  variable to a class member variable to reduce heap allocations. Then,
   //  return the const reference. I cannot make them static function-local
   //  because it will create race condition in multithreading environment.
 
-  // We use two alternating buffers to reduce heap allocations.
+  // We use two alternating buffers to reduce heap allocations. The polygon
+  // has at most eight vertices (see IntersectFields()), so each buffer
+  // allocates once and never grows while clipping.
   std::vector<Vector3<T>> polygon_buffer[2];
+  polygon_buffer[0].reserve(8);
+  polygon_buffer[1].reserve(8);
 
   // Intersects the equilibrium plane with the tetrahedron element0.
   std::vector<Vector3<T>>* polygon_M = &(polygon_buffer[0]);
@@ -96,13 +134,6 @@ std::vector<Vector3<T>> IntersectTetrahedra(
   if (polygon_M->size() < 3)
     return {};
 
-  // Positions of vertices of tetrahedral element1 in mesh1_N expressed in
-  // frame M.
-  Vector3<T> p_MVs[4];
-  for (int i = 0; i < 4; ++i) {
-    p_MVs[i] =
-        X_MN * mesh1_N.vertex(mesh1_N.element(element1).vertex(i)).cast<T>();
-  }
   // Each tuple of three vertex indices are oriented so that their normal
   // vector points outward from the tetrahedron.
   constexpr int kFaceVertexLocalIndex[4][3] = {
@@ -214,16 +245,15 @@ void IntersectFields(const VolumeMeshFieldLinear<double, double>& field0_M,
 
     // Add the vertices to the builder (with corresponding pressure values)
     // and construct index-based polygon representation.
-    std::vector<int> polygon_vertex_indices;
-    polygon_vertex_indices.reserve(polygon_vertices_M.size());
+    contact_polygon.clear();
     for (const auto& p_MV : polygon_vertices_M) {
-      polygon_vertex_indices.push_back(
+      contact_polygon.push_back(
           builder.AddVertex(p_MV, field0_M.EvaluateCartesian(tet0, p_MV)));
     }
 
     const Vector3<T>& grad_field0_M = field0_M.EvaluateGradient(tet0);
-    const int num_new_faces = builder.AddPolygon(polygon_vertex_indices,
-                                                 polygon_nhat_M, grad_field0_M);
+    const int num_new_faces =
+        builder.AddPolygon(contact_polygon, polygon_nhat_M, grad_field0_M);
 
     const Vector3<T>& grad_field1_N = field1_N.EvaluateGradient(tet1);
     const Vector3<T>& grad_field1_M = X_MN.rotation() * grad_field1_N;
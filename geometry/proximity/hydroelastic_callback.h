@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cmath>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -10,16 +11,19 @@
 
 #include "drake/common/eigen_types.h"
 #include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/proximity/bvh.h"
 #include "drake/geometry/proximity/collision_filter.h"
 #include "drake/geometry/proximity/field_intersection.h"
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 #include "drake/geometry/proximity/mesh_half_space_intersection.h"
 #include "drake/geometry/proximity/mesh_intersection.h"
 #include "drake/geometry/proximity/mesh_plane_intersection.h"
+#include "drake/geometry/proximity/obb.h"
 #include "drake/geometry/proximity/penetration_as_point_pair_callback.h"
 #include "drake/geometry/proximity/proximity_utilities.h"
 #include "drake/geometry/query_results/contact_surface.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
+#include "drake/geometry/utilities.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
 
@@ -101,6 +105,94 @@ enum class CalcContactSurfaceResult {
                                      //< compliant half space; not allowed.
 };
 
+/* Reports whether the bounding volumes of the hierarchies rooted at `node_A`
+ and `node_B` may overlap once those of the first are inflated by `margin`. The
+ hierarchy rooted at a node is only descended if the node's `descend` flag is
+ true; otherwise the node's bounding volume stands for the whole hierarchy.
+ @param X_AB  The pose of the second hierarchy's frame in the first's.  */
+template <class MeshA, class MeshB>
+bool InflatedBvsMayOverlap(const BvNode<Obb, MeshA>& node_A, bool descend_A,
+                           const BvNode<Obb, MeshB>& node_B, bool descend_B,
+                           const math::RigidTransformd& X_AB, double margin) {
+  const Obb& bv_A = node_A.bv();
+  const Obb inflated_A(bv_A.pose(),
+                       bv_A.half_width() + Vector3<double>::Constant(margin));
+  if (!Obb::HasOverlap(inflated_A, node_B.bv(), X_AB)) return false;
+  const bool split_A = descend_A && !node_A.is_leaf();
+  const bool split_B = descend_B && !node_B.is_leaf();
+  if (!split_A && !split_B) return true;
+  // Split the larger of the two volumes.
+  if (split_A &&
+      (!split_B || bv_A.CalcVolume() >= node_B.bv().CalcVolume())) {
+    return InflatedBvsMayOverlap(node_A.left(), true, node_B, descend_B, X_AB,
+                                 margin) ||
+           InflatedBvsMayOverlap(node_A.right(), true, node_B, descend_B, X_AB,
+                                 margin);
+  }
+  return InflatedBvsMayOverlap(node_A, descend_A, node_B.left(), true, X_AB,
+                               margin) ||
+         InflatedBvsMayOverlap(node_A, descend_A, node_B.right(), true, X_AB,
+                               margin);
+}
+
+/* Reports whether the soft mesh geometries A and B may be in contact, based on
+ their coarse levels of detail, if any. The test is conservative: the coarse
+ bounding volumes are inflated by the coarse tessellation errors, so a false
+ return value guarantees that the fine meshes don't intersect. Only a geometry
+ with a coarse level of detail has its (deferred) fine mesh left unbuilt.
+ @pre Neither geometry is a half space.  */
+template <typename T>
+bool SoftSoftMayBeInContact(const SoftGeometry& soft_A,
+                            const math::RigidTransform<T>& X_WA,
+                            const SoftGeometry& soft_B,
+                            const math::RigidTransform<T>& X_WB) {
+  const bool coarse_A = soft_A.has_coarse_representation();
+  const bool coarse_B = soft_B.has_coarse_representation();
+  if (!coarse_A && !coarse_B) return true;
+  const double margin =
+      (coarse_A ? soft_A.coarse_tessellation_error() : 0.0) +
+      (coarse_B ? soft_B.coarse_tessellation_error() : 0.0);
+  if (!std::isfinite(margin)) return true;
+  // The leaves bound tetrahedra, so the whole hierarchies bound the solids.
+  const SoftGeometry& bounded_A =
+      coarse_A ? soft_A.coarse_representation() : soft_A;
+  const SoftGeometry& bounded_B =
+      coarse_B ? soft_B.coarse_representation() : soft_B;
+  const math::RigidTransformd X_AB =
+      convert_to_double(X_WA).InvertAndCompose(convert_to_double(X_WB));
+  return InflatedBvsMayOverlap(bounded_A.bvh().root_node(), true,
+                               bounded_B.bvh().root_node(), true, X_AB,
+                               margin);
+}
+
+/* The rigid-soft counterpart of SoftSoftMayBeInContact(). The hierarchy of a
+ rigid surface mesh only bounds its triangles, not the solid they enclose, so
+ a coarse rigid level of detail is represented by its root bounding volume
+ alone.
+ @pre Neither geometry is a half space.  */
+template <typename T>
+bool RigidSoftMayBeInContact(const SoftGeometry& soft,
+                             const math::RigidTransform<T>& X_WS,
+                             const RigidGeometry& rigid,
+                             const math::RigidTransform<T>& X_WR) {
+  const bool coarse_S = soft.has_coarse_representation();
+  const bool coarse_R = rigid.has_coarse_representation();
+  if (!coarse_S && !coarse_R) return true;
+  const double margin =
+      (coarse_S ? soft.coarse_tessellation_error() : 0.0) +
+      (coarse_R ? rigid.coarse_tessellation_error() : 0.0);
+  if (!std::isfinite(margin)) return true;
+  const SoftGeometry& bounded_S =
+      coarse_S ? soft.coarse_representation() : soft;
+  const RigidGeometry& bounded_R =
+      coarse_R ? rigid.coarse_representation() : rigid;
+  const math::RigidTransformd X_SR =
+      convert_to_double(X_WS).InvertAndCompose(convert_to_double(X_WR));
+  return InflatedBvsMayOverlap(bounded_S.bvh().root_node(), true,
+                               bounded_R.bvh().root_node(), !coarse_R, X_SR,
+                               margin);
+}
+
 /* Computes ContactSurface using the algorithm appropriate to the Shape types
  represented by the given `soft` and `rigid` geometries.
  @pre The geometries are not *both* half spaces.  */
@@ -226,6 +318,14 @@ CalcContactSurfaceResult MaybeCalcContactSurface(
 
     // Compliant mesh vs. compliant mesh.
     DRAKE_DEMAND(!soft0.is_half_space() && !soft1.is_half_space());
+
+    // When levels of detail are available, the fine representations are only
+    // requested (and, the first time, built) if the pair may be in contact.
+    if (!SoftSoftMayBeInContact(soft0, data->X_WGs.at(id0), soft1,
+                                data->X_WGs.at(id1))) {
+      return CalcContactSurfaceResult::kCalculated;
+    }
+
     std::unique_ptr<ContactSurface<T>> surface =
         DispatchCompliantCompliantCalculation(soft0, data->X_WGs.at(id0), id0,
                                               soft1, data->X_WGs.at(id1), id1,
@@ -257,6 +357,14 @@ CalcContactSurfaceResult MaybeCalcContactSurface(
   const math::RigidTransform<T>& X_WS(data->X_WGs.at(id_S));
   const math::RigidTransform<T>& X_WR(data->X_WGs.at(id_R));
 
+  // As for compliant-compliant contact, levels of detail are tested
+  // conservatively before the fine representations are requested. Half spaces
+  // have no levels of detail.
+  if (!soft.is_half_space() && !rigid.is_half_space() &&
+      !RigidSoftMayBeInContact(soft, X_WS, rigid, X_WR)) {
+    return CalcContactSurfaceResult::kCalculated;
+  }
+
   std::unique_ptr<ContactSurface<T>> surface = DispatchRigidSoftCalculation(
       soft, X_WS, id_S, rigid, X_WR, id_R, data->representation);
 
@@ -1,9 +1,14 @@
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
 #include <string>
 
 #include <fmt/format.h>
 
+#include "drake/geometry/mesh_file_cache.h"
 #include "drake/geometry/proximity/make_box_field.h"
 #include "drake/geometry/proximity/make_box_mesh.h"
 #include "drake/geometry/proximity/make_capsule_field.h"
@@ -25,21 +30,10 @@ namespace geometry {
 namespace internal {
 namespace hydroelastic {
 
+using Eigen::Vector3d;
 using std::make_unique;
 using std::move;
 
-SoftMesh& SoftMesh::operator=(const SoftMesh& s) {
-  if (this == &s) return *this;
-
-  mesh_ = make_unique<VolumeMesh<double>>(s.mesh());
-  // We can't simply copy the mesh field; the copy must contain a pointer to
-  // the new mesh. So, we use CloneAndSetMesh() instead.
-  pressure_ = s.pressure().CloneAndSetMesh(mesh_.get());
-  bvh_ = make_unique<Bvh<Obb, VolumeMesh<double>>>(s.bvh());
-
-  return *this;
-}
-
 HydroelasticType Geometries::hydroelastic_type(GeometryId id) const {
   auto iter = supported_geometries_.find(id);
   if (iter != supported_geometries_.end()) return iter->second;
@@ -140,6 +134,9 @@ class Validator {
 
   virtual ~Validator() = default;
 
+  const char* shape_name() const { return shape_name_; }
+  const char* compliance() const { return compliance_; }
+
   // Extract an arbitrary property from the proximity properties. Throws a
   // consistent error message in the case of missing or mis-typed properties.
   // Relies on the ValidateValue() method to validate the value.
@@ -158,9 +155,6 @@ class Validator {
   }
 
  protected:
-  const char* shape_name() const { return shape_name_; }
-  const char* compliance() const { return compliance_; }
-
   // Does the work of validating the given value. Sub-classes should throw if
   // the provided value is not valid. The first parameter is the value to
   // validate; the second is the full name of the property.
@@ -188,6 +182,143 @@ class PositiveDouble : public Validator<double> {
   }
 };
 
+// Returns the ('hydroelastic', 'coarse_resolution_hint') property, if defined.
+// Throws if it is not positive or if it is finer than `resolution_hint`.
+std::optional<double> MaybeExtractCoarseResolutionHint(
+    const ProximityProperties& props, double resolution_hint,
+    PositiveDouble* validator) {
+  if (!props.HasProperty(kHydroGroup, kCoarseRezHint)) return std::nullopt;
+  const double coarse_resolution_hint =
+      validator->Extract(props, kHydroGroup, kCoarseRezHint);
+  if (coarse_resolution_hint < resolution_hint) {
+    throw std::logic_error(fmt::format(
+        "Cannot create {} {}; the ('{}', '{}') property ({}) must be at least "
+        "as large as the ('{}', '{}') property ({})",
+        validator->compliance(), validator->shape_name(), kHydroGroup,
+        kCoarseRezHint, coarse_resolution_hint, kHydroGroup, kRezHint,
+        resolution_hint));
+  }
+  return coarse_resolution_hint;
+}
+
+// Returns the rigid mesh (and its BVH) read from the given OBJ file, shared
+// with every other user of the same file and scale in this process.
+RigidMesh MakeSharedRigidMesh(const std::string& filename, double scale) {
+  auto mesh = GetOrMakeMeshFileData<TriangleSurfaceMesh<double>>(
+      "hydroelastic.TriangleSurfaceMesh", filename, scale,
+      [&filename, scale]() {
+        return ReadObjToTriangleSurfaceMesh(filename, scale);
+      });
+  auto bvh = GetOrMakeMeshFileData<Bvh<Obb, TriangleSurfaceMesh<double>>>(
+      "hydroelastic.TriangleSurfaceMesh", filename, scale, [&mesh]() {
+        return Bvh<Obb, TriangleSurfaceMesh<double>>(*mesh);
+      });
+  return RigidMesh(move(mesh), move(bvh));
+}
+
+// The support function h(n̂) = max_{p ∈ S} n̂⋅p of a convex shape S, measured
+// and expressed in the shape's frame, for the unit vector n̂.
+using SupportFunction = std::function<double(const Vector3d&)>;
+
+// Returns a distance ε such that every point of the convex shape S with the
+// given `support` function lies within ε of the solid bounded by `surface`, a
+// closed tessellation of S whose vertices lie on S. It relies on S containing
+// the origin of its frame: the solid is then star-shaped with respect to the
+// origin if every (outward) triangle plane n̂⋅p = d has d > 0. A point of S on
+// the ray that leaves the solid through triangle f lies at most
+// (h(n̂) - d) / d times the distance of the exit point beyond it. Returns
+// infinity if the solid isn't star-shaped with respect to the origin.
+double CalcTessellationErrorBound(const TriangleSurfaceMesh<double>& surface,
+                                  const SupportFunction& support) {
+  double max_distance = 0;
+  for (int v = 0; v < surface.num_vertices(); ++v) {
+    max_distance = std::max(max_distance, surface.vertex(v).norm());
+  }
+  double max_ratio = 0;
+  for (int f = 0; f < surface.num_triangles(); ++f) {
+    const Vector3d& n = surface.face_normal(f);
+    const double d = n.dot(surface.vertex(surface.element(f).vertex(0)));
+    if (!(d > 0)) return std::numeric_limits<double>::infinity();
+    max_ratio = std::max(max_ratio, (support(n) - d) / d);
+  }
+  // Pad for the rounding in the vertex positions and normals.
+  return (max_ratio + 1e-10) * max_distance;
+}
+
+// Creates the rigid geometry for a shape tessellated by `make_mesh`, a function
+// of the resolution hint. If the coarse resolution hint property is defined, a
+// coarse level of detail is built right away and the construction of the mesh
+// with the given `resolution_hint` is deferred until it is needed. The shape
+// must be convex, contain its frame's origin and have the given `support`
+// function, which bounds the coarse tessellation error.
+RigidGeometry MakeRigidGeometryWithLevelsOfDetail(
+    const ProximityProperties& props, double resolution_hint,
+    PositiveDouble* validator, const SupportFunction& support,
+    std::function<TriangleSurfaceMesh<double>(double)> make_mesh) {
+  const std::optional<double> coarse_resolution_hint =
+      MaybeExtractCoarseResolutionHint(props, resolution_hint, validator);
+  if (!coarse_resolution_hint) {
+    return RigidGeometry(RigidMesh(
+        make_unique<TriangleSurfaceMesh<double>>(make_mesh(resolution_hint))));
+  }
+  auto coarse_surface = make_unique<TriangleSurfaceMesh<double>>(
+      make_mesh(*coarse_resolution_hint));
+  const double error = CalcTessellationErrorBound(*coarse_surface, support);
+  return RigidGeometry(
+      RigidMesh(move(coarse_surface)), error,
+      [make_mesh = move(make_mesh), resolution_hint]() {
+        return RigidMesh(make_unique<TriangleSurfaceMesh<double>>(
+            make_mesh(resolution_hint)));
+      });
+}
+
+// The soft counterpart of MakeRigidGeometryWithLevelsOfDetail(); `make_mesh`
+// creates the soft mesh (including its pressure field) for a given resolution
+// hint.
+SoftGeometry MakeSoftGeometryWithLevelsOfDetail(
+    const ProximityProperties& props, double resolution_hint,
+    PositiveDouble* validator, const SupportFunction& support,
+    std::function<SoftMesh(double)> make_mesh) {
+  const std::optional<double> coarse_resolution_hint =
+      MaybeExtractCoarseResolutionHint(props, resolution_hint, validator);
+  if (!coarse_resolution_hint) {
+    return SoftGeometry(make_mesh(resolution_hint));
+  }
+  SoftMesh coarse_mesh = make_mesh(*coarse_resolution_hint);
+  const double error = CalcTessellationErrorBound(
+      ConvertVolumeToSurfaceMesh(coarse_mesh.mesh()), support);
+  return SoftGeometry(move(coarse_mesh), error,
+                      [make_mesh = move(make_mesh), resolution_hint]() {
+                        return make_mesh(resolution_hint);
+                      });
+}
+
+// Support functions of the shapes that support levels of detail.
+SupportFunction MakeSupportFunction(const Sphere& sphere) {
+  return [r = sphere.radius()](const Vector3d&) {
+    return r;
+  };
+}
+
+SupportFunction MakeSupportFunction(const Cylinder& cylinder) {
+  return [r = cylinder.radius(), l = cylinder.length()](const Vector3d& n) {
+    return r * std::hypot(n.x(), n.y()) + 0.5 * l * std::abs(n.z());
+  };
+}
+
+SupportFunction MakeSupportFunction(const Capsule& capsule) {
+  return [r = capsule.radius(), l = capsule.length()](const Vector3d& n) {
+    return r + 0.5 * l * std::abs(n.z());
+  };
+}
+
+SupportFunction MakeSupportFunction(const Ellipsoid& ellipsoid) {
+  const Vector3d abc(ellipsoid.a(), ellipsoid.b(), ellipsoid.c());
+  return [abc](const Vector3d& n) {
+    return abc.cwiseProduct(n).norm();
+  };
+}
+
 std::optional<RigidGeometry> MakeRigidRepresentation(
     const HalfSpace& hs, const ProximityProperties&) {
   return RigidGeometry(hs);
@@ -197,10 +328,11 @@ std::optional<RigidGeometry> MakeRigidRepresentation(
     const Sphere& sphere, const ProximityProperties& props) {
   PositiveDouble validator("Sphere", "rigid");
   const double edge_length = validator.Extract(props, kHydroGroup, kRezHint);
-  auto mesh = make_unique<TriangleSurfaceMesh<double>>(
-      MakeSphereSurfaceMesh<double>(sphere, edge_length));
-
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return MakeRigidGeometryWithLevelsOfDetail(
+      props, edge_length, &validator, MakeSupportFunction(sphere),
+      [sphere](double resolution_hint) {
+        return MakeSphereSurfaceMesh<double>(sphere, resolution_hint);
+      });
 }
 
 std::optional<RigidGeometry> MakeRigidRepresentation(
@@ -219,70 +351,69 @@ std::optional<RigidGeometry> MakeRigidRepresentation(
     const Cylinder& cylinder, const ProximityProperties& props) {
   PositiveDouble validator("Cylinder", "rigid");
   const double edge_length = validator.Extract(props, kHydroGroup, kRezHint);
-  auto mesh = make_unique<TriangleSurfaceMesh<double>>(
-      MakeCylinderSurfaceMesh<double>(cylinder, edge_length));
-
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return MakeRigidGeometryWithLevelsOfDetail(
+      props, edge_length, &validator, MakeSupportFunction(cylinder),
+      [cylinder](double resolution_hint) {
+        return MakeCylinderSurfaceMesh<double>(cylinder, resolution_hint);
+      });
 }
 
 std::optional<RigidGeometry> MakeRigidRepresentation(
     const Capsule& capsule, const ProximityProperties& props) {
   PositiveDouble validator("Capsule", "rigid");
   const double edge_length = validator.Extract(props, kHydroGroup, kRezHint);
-  auto mesh = make_unique<TriangleSurfaceMesh<double>>(
-      MakeCapsuleSurfaceMesh<double>(capsule, edge_length));
-
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return MakeRigidGeometryWithLevelsOfDetail(
+      props, edge_length, &validator, MakeSupportFunction(capsule),
+      [capsule](double resolution_hint) {
+        return MakeCapsuleSurfaceMesh<double>(capsule, resolution_hint);
+      });
 }
 
 std::optional<RigidGeometry> MakeRigidRepresentation(
     const Ellipsoid& ellipsoid, const ProximityProperties& props) {
   PositiveDouble validator("Ellipsoid", "rigid");
   const double edge_length = validator.Extract(props, kHydroGroup, kRezHint);
-  auto mesh = make_unique<TriangleSurfaceMesh<double>>(
-      MakeEllipsoidSurfaceMesh<double>(ellipsoid, edge_length));
-
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return MakeRigidGeometryWithLevelsOfDetail(
+      props, edge_length, &validator, MakeSupportFunction(ellipsoid),
+      [ellipsoid](double resolution_hint) {
+        return MakeEllipsoidSurfaceMesh<double>(ellipsoid, resolution_hint);
+      });
 }
 
 std::optional<RigidGeometry> MakeRigidRepresentation(
     const Mesh& mesh_spec, const ProximityProperties&) {
   // Mesh does not use any properties.
-  auto mesh = make_unique<TriangleSurfaceMesh<double>>(
-      ReadObjToTriangleSurfaceMesh(mesh_spec.filename(), mesh_spec.scale()));
-
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return RigidGeometry(
+      MakeSharedRigidMesh(mesh_spec.filename(), mesh_spec.scale()));
 }
 
 std::optional<RigidGeometry> MakeRigidRepresentation(
     const Convex& convex_spec, const ProximityProperties&) {
   // Convex does not use any properties.
-  auto mesh =
-      make_unique<TriangleSurfaceMesh<double>>(ReadObjToTriangleSurfaceMesh(
-          convex_spec.filename(), convex_spec.scale()));
-
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return RigidGeometry(
+      MakeSharedRigidMesh(convex_spec.filename(), convex_spec.scale()));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
     const Sphere& sphere, const ProximityProperties& props) {
   PositiveDouble validator("Sphere", "soft");
-  // First, create the mesh.
   const double edge_length = validator.Extract(props, kHydroGroup, kRezHint);
   // If nothing is said, let's go for the *cheap* tessellation strategy.
   const TessellationStrategy strategy =
       props.GetPropertyOrDefault(kHydroGroup, "tessellation_strategy",
                                  TessellationStrategy::kSingleInteriorVertex);
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeSphereVolumeMesh<double>(sphere, edge_length, strategy));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeSpherePressureField(sphere, mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(move(mesh), move(pressure)));
+  return MakeSoftGeometryWithLevelsOfDetail(
+      props, edge_length, &validator, MakeSupportFunction(sphere),
+      [sphere, strategy, hydroelastic_modulus](double resolution_hint) {
+        auto mesh = make_unique<VolumeMesh<double>>(
+            MakeSphereVolumeMesh<double>(sphere, resolution_hint, strategy));
+        auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+            MakeSpherePressureField(sphere, mesh.get(), hydroelastic_modulus));
+        return SoftMesh(move(mesh), move(pressure));
+      });
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -304,56 +435,63 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
 std::optional<SoftGeometry> MakeSoftRepresentation(
     const Cylinder& cylinder, const ProximityProperties& props) {
   PositiveDouble validator("Cylinder", "soft");
-  // First, create the mesh.
   const double edge_length = validator.Extract(props, kHydroGroup, kRezHint);
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeCylinderVolumeMeshWithMa<double>(cylinder, edge_length));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeCylinderPressureField(cylinder, mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(move(mesh), move(pressure)));
+  return MakeSoftGeometryWithLevelsOfDetail(
+      props, edge_length, &validator, MakeSupportFunction(cylinder),
+      [cylinder, hydroelastic_modulus](double resolution_hint) {
+        auto mesh = make_unique<VolumeMesh<double>>(
+            MakeCylinderVolumeMeshWithMa<double>(cylinder, resolution_hint));
+        auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+            MakeCylinderPressureField(cylinder, mesh.get(),
+                                      hydroelastic_modulus));
+        return SoftMesh(move(mesh), move(pressure));
+      });
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
     const Capsule& capsule, const ProximityProperties& props) {
   PositiveDouble validator("Capsule", "soft");
-  // First, create the mesh.
   const double edge_length = validator.Extract(props, kHydroGroup, kRezHint);
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeCapsuleVolumeMesh<double>(capsule, edge_length));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeCapsulePressureField(capsule, mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(move(mesh), move(pressure)));
+  return MakeSoftGeometryWithLevelsOfDetail(
+      props, edge_length, &validator, MakeSupportFunction(capsule),
+      [capsule, hydroelastic_modulus](double resolution_hint) {
+        auto mesh = make_unique<VolumeMesh<double>>(
+            MakeCapsuleVolumeMesh<double>(capsule, resolution_hint));
+        auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+            MakeCapsulePressureField(capsule, mesh.get(),
+                                     hydroelastic_modulus));
+        return SoftMesh(move(mesh), move(pressure));
+      });
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
     const Ellipsoid& ellipsoid, const ProximityProperties& props) {
   PositiveDouble validator("Ellipsoid", "soft");
-  // First, create the mesh.
   const double edge_length = validator.Extract(props, kHydroGroup, kRezHint);
   // If nothing is said, let's go for the *cheap* tessellation strategy.
   const TessellationStrategy strategy =
       props.GetPropertyOrDefault(kHydroGroup, "tessellation_strategy",
                                  TessellationStrategy::kSingleInteriorVertex);
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeEllipsoidVolumeMesh<double>(ellipsoid, edge_length, strategy));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeEllipsoidPressureField(ellipsoid, mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(move(mesh), move(pressure)));
+  return MakeSoftGeometryWithLevelsOfDetail(
+      props, edge_length, &validator, MakeSupportFunction(ellipsoid),
+      [ellipsoid, strategy, hydroelastic_modulus](double resolution_hint) {
+        auto mesh = make_unique<VolumeMesh<double>>(
+            MakeEllipsoidVolumeMesh<double>(ellipsoid, resolution_hint,
+                                            strategy));
+        auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+            MakeEllipsoidPressureField(ellipsoid, mesh.get(),
+                                       hydroelastic_modulus));
+        return SoftMesh(move(mesh), move(pressure));
+      });
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -373,16 +511,33 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
     const Convex& convex_spec, const ProximityProperties& props) {
   PositiveDouble validator("Convex", "soft");
 
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeConvexVolumeMesh<double>(convex_spec));
+  // The volume mesh and its BVH only depend on the file, so they are shared.
+  // The pressure field also depends on the hydroelastic modulus; it is shared
+  // by the soft convex geometries made from the same file with the same
+  // modulus (e.g., hundreds of instances of one object in a scene).
+  const std::string& filename = convex_spec.filename();
+  const double scale = convex_spec.scale();
+  auto mesh = GetOrMakeMeshFileData<VolumeMesh<double>>(
+      "hydroelastic.VolumeMesh", filename, scale,
+      [&convex_spec]() { return MakeConvexVolumeMesh<double>(convex_spec); });
+  auto bvh = GetOrMakeMeshFileData<Bvh<Obb, VolumeMesh<double>>>(
+      "hydroelastic.VolumeMesh", filename, scale, [&mesh]() {
+        return Bvh<Obb, VolumeMesh<double>>(*mesh);
+      });
 
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeConvexPressureField(mesh.get(), hydroelastic_modulus));
+  // The field refers to the shared mesh, which the cache keeps alive for as
+  // long as the field is in use (every SoftMesh holding the field also holds
+  // the mesh).
+  auto pressure = GetOrMakeMeshFileData<VolumeMeshFieldLinear<double, double>>(
+      fmt::format("hydroelastic.ConvexPressureField {}", hydroelastic_modulus),
+      filename, scale, [&mesh, hydroelastic_modulus]() {
+        return MakeConvexPressureField(mesh.get(), hydroelastic_modulus);
+      });
 
-  return SoftGeometry(SoftMesh(move(mesh), move(pressure)));
+  return SoftGeometry(SoftMesh(move(mesh), move(pressure), move(bvh)));
 }
 
 }  // namespace hydroelastic
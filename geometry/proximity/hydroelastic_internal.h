@@ -1,12 +1,14 @@
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <utility>
 #include <variant>
 
-#include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/text_logging.h"
 #include "drake/geometry/geometry_ids.h"
@@ -25,25 +27,45 @@ namespace hydroelastic {
 // TODO(SeanCurtis-TRI): When we do soft-soft contact, we'll need ∇p̃(e) as well.
 //  ∇p̃(e) is piecewise constant -- one ℜ³ vector per tetrahedron.
 /* Defines a soft mesh -- a mesh, its linearized pressure field, p̃(e), and its
- bounding volume hierarchy. While this class retains ownership of the mesh,
- we assume that both the pressure field and the bounding volume hierarchy
- are derived from the mesh. */
+ bounding volume hierarchy. We assume that both the pressure field and the
+ bounding volume hierarchy are derived from the mesh.
+
+ All three are immutable and shared: copies of a SoftMesh (e.g., in a clone of
+ a SceneGraph) refer to the same data, as may soft meshes made from the same
+ file (see GetOrMakeMeshFileData()).  */
 class SoftMesh {
  public:
   SoftMesh() = default;
 
   SoftMesh(std::unique_ptr<VolumeMesh<double>> mesh,
            std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure)
+      : SoftMesh(std::shared_ptr<const VolumeMesh<double>>(std::move(mesh)),
+                 std::move(pressure)) {}
+
+  /* Constructs the soft mesh from a (possibly shared) `mesh`, building a new
+   bounding volume hierarchy for it.
+   @pre `pressure` is defined on `mesh`.  */
+  SoftMesh(std::shared_ptr<const VolumeMesh<double>> mesh,
+           std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure)
+      : SoftMesh(mesh, std::move(pressure),
+                 std::make_shared<const Bvh<Obb, VolumeMesh<double>>>(*mesh)) {
+  }
+
+  /* Constructs the soft mesh from a (possibly shared) `mesh`, its (possibly
+   shared) `pressure` field, and its `bvh`.
+   @pre `pressure` is defined on `mesh` and `bvh` was built from it.  */
+  SoftMesh(
+      std::shared_ptr<const VolumeMesh<double>> mesh,
+      std::shared_ptr<const VolumeMeshFieldLinear<double, double>> pressure,
+      std::shared_ptr<const Bvh<Obb, VolumeMesh<double>>> bvh)
       : mesh_(std::move(mesh)),
         pressure_(std::move(pressure)),
-        bvh_(std::make_unique<Bvh<Obb, VolumeMesh<double>>>(*mesh_)) {
+        bvh_(std::move(bvh)) {
+    DRAKE_DEMAND(mesh_ != nullptr && pressure_ != nullptr && bvh_ != nullptr);
     DRAKE_ASSERT(mesh_.get() == &pressure_->mesh());
   }
 
-  SoftMesh(const SoftMesh& s) { *this = s; }
-  SoftMesh& operator=(const SoftMesh& s);
-  SoftMesh(SoftMesh&&) = default;
-  SoftMesh& operator=(SoftMesh&&) = default;
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SoftMesh)
 
   const VolumeMesh<double>& mesh() const {
     DRAKE_DEMAND(mesh_ != nullptr);
@@ -59,9 +81,54 @@ class SoftMesh {
   }
 
  private:
-  std::unique_ptr<VolumeMesh<double>> mesh_;
-  std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure_;
-  std::unique_ptr<Bvh<Obb, VolumeMesh<double>>> bvh_;
+  std::shared_ptr<const VolumeMesh<double>> mesh_;
+  std::shared_ptr<const VolumeMeshFieldLinear<double, double>> pressure_;
+  std::shared_ptr<const Bvh<Obb, VolumeMesh<double>>> bvh_;
+};
+
+/* A mesh representation (i.e., SoftMesh or RigidMesh) whose construction is
+ deferred until it is first requested. This is how the fine level of detail of
+ a geometry is stored (see SoftGeometry and RigidGeometry): the (possibly
+ expensive) fine mesh is only built once the geometry is found to be in contact
+ with the coarse mesh.
+
+ Copies share the same underlying representation, which is immutable once
+ built. Building it is thread safe.  */
+template <class MeshRepresentation>
+class DeferredMesh {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(DeferredMesh)
+
+  /* Constructs the deferred representation. `make_mesh` will be invoked (at
+   most once) the first time the representation is requested.  */
+  explicit DeferredMesh(std::function<MeshRepresentation()> make_mesh)
+      : state_(std::make_shared<State>(std::move(make_mesh))) {}
+
+  /* Returns the representation, building it if it hasn't been built yet.  */
+  const MeshRepresentation& get() const {
+    std::call_once(state_->once, [state = state_.get()]() {
+      state->mesh = state->make_mesh();
+      // The factory may hold (large) copies of the shape data; release it.
+      state->make_mesh = nullptr;
+      state->is_built = true;
+    });
+    return *state_->mesh;
+  }
+
+  /* Returns true if the representation has already been built.  */
+  bool is_built() const { return state_->is_built; }
+
+ private:
+  struct State {
+    explicit State(std::function<MeshRepresentation()> make_mesh_in)
+        : make_mesh(std::move(make_mesh_in)) {}
+    std::once_flag once;
+    std::function<MeshRepresentation()> make_mesh;
+    std::optional<MeshRepresentation> mesh;
+    std::atomic<bool> is_built{false};
+  };
+
+  std::shared_ptr<State> state_;
 };
 
 /* Defines a soft half space. The half space is defined such that the half
@@ -100,7 +167,18 @@ struct SoftHalfSpace {
  soft geometry, a shape must be associated with either:
 
    - a volume mesh (including a linearized scalar pressure field), or
-   - a soft half space (with a "slab thickness").  */
+   - a soft half space (with a "slab thickness").
+
+ A soft mesh can optionally have two levels of detail: a fine mesh, which is
+ what mesh(), pressure_field() and bvh() report, and a coarse mesh reported by
+ coarse_representation(). The fine mesh is only built the first time it is
+ requested. The coarse mesh comes with a bound on its tessellation error
+ (coarse_tessellation_error()): every point of the represented shape, and
+ therefore of the fine mesh, lies within that distance of the coarse mesh.
+ Contact queries test the coarse bounding volumes, inflated by that bound, to
+ conservatively rule out contact and only request the fine mesh otherwise.
+ Therefore, geometries that never come near each other never pay for their fine
+ mesh, and no contact is missed because of the coarse resolution.  */
 class SoftGeometry {
  public:
   /* Constructs a soft half space representation.  */
@@ -111,6 +189,16 @@ class SoftGeometry {
   explicit SoftGeometry(SoftMesh&& soft_mesh)
       : geometry_(std::move(soft_mesh)) {}
 
+  /* Constructs a soft mesh representation with two levels of detail: the
+   `coarse_mesh`, and the fine mesh built by `make_fine_mesh` when first
+   requested. Every point of the shape lies within `coarse_tessellation_error`
+   of the coarse mesh; it may be infinite when no such bound is known.  */
+  SoftGeometry(SoftMesh&& coarse_mesh, double coarse_tessellation_error,
+               std::function<SoftMesh()> make_fine_mesh)
+      : geometry_(DeferredMesh<SoftMesh>(std::move(make_fine_mesh))),
+        coarse_(std::make_shared<const SoftGeometry>(std::move(coarse_mesh))),
+        coarse_tessellation_error_(coarse_tessellation_error) {}
+
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SoftGeometry)
 
   /* @name  Distinguishing compliant representations
@@ -136,7 +224,7 @@ class SoftGeometry {
       throw std::runtime_error(
           "SoftGeometry::mesh() cannot be invoked for soft half space");
     }
-    return std::get<SoftMesh>(geometry_).mesh();
+    return soft_mesh().mesh();
   }
 
   /* Returns a reference to the mesh's linearized pressure field -- calling
@@ -146,7 +234,7 @@ class SoftGeometry {
       throw std::runtime_error("SoftGeometry::pressure_field() cannot be "
                                "invoked for soft half space");
     }
-    return std::get<SoftMesh>(geometry_).pressure();
+    return soft_mesh().pressure();
   }
 
   /* Returns a reference to the bounding volume hierarchy -- calling this will
@@ -156,7 +244,7 @@ class SoftGeometry {
       throw std::runtime_error(
           "SoftGeometry::bvh() cannot be invoked for soft half space");
     }
-    return std::get<SoftMesh>(geometry_).bvh();
+    return soft_mesh().bvh();
   }
 
   /* Returns the half space's pressure scale -- calling this will throw if
@@ -171,8 +259,50 @@ class SoftGeometry {
 
   //@}
 
+  /* @name  Levels of detail  */
+  //@{
+
+  /* Returns true if this geometry has a coarse level of detail.  */
+  bool has_coarse_representation() const { return coarse_ != nullptr; }
+
+  /* Returns the coarse level of detail of this geometry.
+   @pre has_coarse_representation() is true.  */
+  const SoftGeometry& coarse_representation() const {
+    DRAKE_DEMAND(has_coarse_representation());
+    return *coarse_;
+  }
+
+  /* Returns the distance within which every point of the represented shape
+   lies from the coarse mesh (possibly infinite).
+   @pre has_coarse_representation() is true.  */
+  double coarse_tessellation_error() const {
+    DRAKE_DEMAND(has_coarse_representation());
+    return coarse_tessellation_error_;
+  }
+
+  /* Returns true if the fine mesh has already been built. Representations
+   without levels of detail are always built.  */
+  bool is_fine_representation_built() const {
+    const auto* deferred = std::get_if<DeferredMesh<SoftMesh>>(&geometry_);
+    return deferred == nullptr || deferred->is_built();
+  }
+
+  //@}
+
  private:
-  std::variant<SoftHalfSpace, SoftMesh> geometry_;
+  // Returns the (fine) soft mesh, building it if necessary.
+  // @pre is_half_space() is false.
+  const SoftMesh& soft_mesh() const {
+    const auto* deferred = std::get_if<DeferredMesh<SoftMesh>>(&geometry_);
+    if (deferred != nullptr) return deferred->get();
+    return std::get<SoftMesh>(geometry_);
+  }
+
+  std::variant<SoftHalfSpace, SoftMesh, DeferredMesh<SoftMesh>> geometry_;
+  // The coarse level of detail, if any. It is immutable and therefore shared
+  // between copies.
+  std::shared_ptr<const SoftGeometry> coarse_;
+  double coarse_tessellation_error_{0};
 };
 
 /* Defines a rigid mesh -- a surface mesh and its bounding volume hierarchy.
@@ -183,9 +313,24 @@ class RigidMesh {
   RigidMesh() = default;
 
   explicit RigidMesh(std::unique_ptr<TriangleSurfaceMesh<double>> mesh)
-      : mesh_(std::move(mesh)),
-        bvh_(std::make_unique<Bvh<Obb, TriangleSurfaceMesh<double>>>(
-            *mesh_)) {}
+      : RigidMesh(
+            std::shared_ptr<const TriangleSurfaceMesh<double>>(std::move(mesh))) {
+  }
+
+  /* Constructs the rigid mesh from a (possibly shared) `mesh`, building a new
+   bounding volume hierarchy for it.  */
+  explicit RigidMesh(std::shared_ptr<const TriangleSurfaceMesh<double>> mesh)
+      : RigidMesh(mesh,
+                  std::make_shared<const Bvh<Obb, TriangleSurfaceMesh<double>>>(
+                      *mesh)) {}
+
+  /* Constructs the rigid mesh from a (possibly shared) `mesh` and its `bvh`.
+   @pre `bvh` was built from `mesh`.  */
+  RigidMesh(std::shared_ptr<const TriangleSurfaceMesh<double>> mesh,
+            std::shared_ptr<const Bvh<Obb, TriangleSurfaceMesh<double>>> bvh)
+      : mesh_(std::move(mesh)), bvh_(std::move(bvh)) {
+    DRAKE_DEMAND(mesh_ != nullptr && bvh_ != nullptr);
+  }
 
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RigidMesh)
 
@@ -199,14 +344,18 @@ class RigidMesh {
   }
 
  private:
-  copyable_unique_ptr<TriangleSurfaceMesh<double>> mesh_;
-  copyable_unique_ptr<Bvh<Obb, TriangleSurfaceMesh<double>>> bvh_;
+  // Like SoftMesh, the mesh and its BVH are immutable and shared by copies.
+  std::shared_ptr<const TriangleSurfaceMesh<double>> mesh_;
+  std::shared_ptr<const Bvh<Obb, TriangleSurfaceMesh<double>>> bvh_;
 };
 
 /* The base representation of rigid geometries. Generally, a rigid geometry
  is represented with a TriangleSurfaceMesh. However, half spaces do not get
  tessellated and are treated as primitives. This class contains either
- representation.  */
+ representation.
+
+ Like SoftGeometry, a rigid mesh can optionally have a coarse level of detail
+ and a fine mesh that is only built when first requested.  */
 class RigidGeometry {
  public:
   /* Constructs a rigid half space representation -- the half space, like its
@@ -219,10 +368,22 @@ class RigidGeometry {
   explicit RigidGeometry(RigidMesh&& rigid_mesh)
       : geometry_(RigidMesh(std::move(rigid_mesh))) {}
 
+  /* Constructs a rigid mesh representation with two levels of detail: the
+   `coarse_mesh`, and the fine mesh built by `make_fine_mesh` when first
+   requested. Every point of the shape lies within `coarse_tessellation_error`
+   of the coarse mesh; it may be infinite when no such bound is known.  */
+  RigidGeometry(RigidMesh&& coarse_mesh, double coarse_tessellation_error,
+                std::function<RigidMesh()> make_fine_mesh)
+      : geometry_(DeferredMesh<RigidMesh>(std::move(make_fine_mesh))),
+        coarse_(std::make_shared<const RigidGeometry>(std::move(coarse_mesh))),
+        coarse_tessellation_error_(coarse_tessellation_error) {}
+
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RigidGeometry)
 
   /* Returns true if this RigidGeometry is a half space.  */
-  bool is_half_space() const { return !geometry_.has_value(); }
+  bool is_half_space() const {
+    return std::holds_alternative<std::monostate>(geometry_);
+  }
 
   /* Returns a reference to the surface mesh -- calling this will throw unless
    is_half_space() returns false.  */
@@ -231,7 +392,7 @@ class RigidGeometry {
       throw std::runtime_error(
           "RigidGeometry::mesh() cannot be invoked for rigid half space");
     }
-    return geometry_->mesh();
+    return rigid_mesh().mesh();
   }
 
   /* Returns a reference to the bounding volume hierarchy -- calling this will
@@ -241,12 +402,49 @@ class RigidGeometry {
       throw std::runtime_error(
           "RigidGeometry::bvh() cannot be invoked for rigid half space");
     }
-    return geometry_->bvh();
+    return rigid_mesh().bvh();
+  }
+
+  /* Returns true if this geometry has a coarse level of detail.  */
+  bool has_coarse_representation() const { return coarse_ != nullptr; }
+
+  /* Returns the coarse level of detail of this geometry.
+   @pre has_coarse_representation() is true.  */
+  const RigidGeometry& coarse_representation() const {
+    DRAKE_DEMAND(has_coarse_representation());
+    return *coarse_;
+  }
+
+  /* Returns the distance within which every point of the represented shape
+   lies from the coarse mesh (possibly infinite).
+   @pre has_coarse_representation() is true.  */
+  double coarse_tessellation_error() const {
+    DRAKE_DEMAND(has_coarse_representation());
+    return coarse_tessellation_error_;
+  }
+
+  /* Returns true if the fine mesh has already been built. Representations
+   without levels of detail are always built.  */
+  bool is_fine_representation_built() const {
+    const auto* deferred = std::get_if<DeferredMesh<RigidMesh>>(&geometry_);
+    return deferred == nullptr || deferred->is_built();
   }
 
  private:
+  // Returns the (fine) rigid mesh, building it if necessary.
+  // @pre is_half_space() is false.
+  const RigidMesh& rigid_mesh() const {
+    const auto* deferred = std::get_if<DeferredMesh<RigidMesh>>(&geometry_);
+    if (deferred != nullptr) return deferred->get();
+    return std::get<RigidMesh>(geometry_);
+  }
+
   // If the mesh isn't defined, then this is implicitly a rigid half space.
-  std::optional<RigidMesh> geometry_{std::nullopt};
+  std::variant<std::monostate, RigidMesh, DeferredMesh<RigidMesh>> geometry_;
+  // The coarse level of detail, if any. It is immutable and therefore shared
+  // between copies.
+  std::shared_ptr<const RigidGeometry> coarse_;
+  double coarse_tessellation_error_{0};
 };
 
 /* This class stores all instantiated hydroelastic representations of declared
@@ -365,7 +563,17 @@ class Geometries final : public ShapeReifier {
  will return std::nullopt.
 
  For every shape that *is* supported, an overload of this method on that shape
- type is declared below.  */
+ type is declared below.
+
+ The shapes whose tessellation is controlled by the ('hydroelastic',
+ 'resolution_hint') property also accept the optional ('hydroelastic',
+ 'coarse_resolution_hint') property, which must be at least as large as the
+ resolution hint. When it is defined, the representation has two levels of
+ detail (see SoftGeometry and RigidGeometry): a coarse mesh tessellated with the
+ coarse hint and a fine mesh tessellated with the resolution hint, which is
+ only built once the geometry is first possibly in contact. Only convex shapes
+ centered on their frame's origin use levels of detail, which allows bounding
+ the coarse tessellation error.  */
 //@{
 
 /* Generic interface for handling unsupported rigid Shapes. Unsupported
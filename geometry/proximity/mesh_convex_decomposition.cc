@@ -0,0 +1,33 @@
+#include "drake/geometry/proximity/mesh_convex_decomposition.h"
+
+#include <fmt/format.h>
+
+#include "drake/geometry/read_obj.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+MeshConvexDecomposition::MeshConvexDecomposition(const std::string& filename,
+                                                 double scale) {
+  const auto objects =
+      ReadObjFileObjects(filename, scale, false /* triangulate */);
+  pieces_.reserve(objects.size());
+  for (const auto& [vertices, faces, num_faces] : objects) {
+    if (vertices->size() < 4) {
+      throw std::runtime_error(fmt::format(
+          "Each piece of the convex decomposition in '{}' must have at least "
+          "four vertices; piece {} has {}",
+          filename, pieces_.size(), vertices->size()));
+    }
+    pieces_.push_back(
+        std::make_shared<fcl::Convexd>(vertices, num_faces, faces));
+    // The pieces are shared (among threads, too), so their bounds are
+    // computed once, here.
+    pieces_.back()->computeLocalAABB();
+  }
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fcl/fcl.h>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/geometry_ids.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* An approximate convex decomposition of a (generally nonconvex) mesh: a set
+ of convex pieces whose union approximates the volume enclosed by the mesh.
+
+ A good decomposition is expensive to compute, so it is baked offline (e.g.,
+ by V-HACD or CoACD) and read from an OBJ file in which each object is one
+ convex piece, measured and expressed in the mesh's frame. The pieces take
+ the place of the mesh's convex hull in point-pair penetration queries, so a
+ concave mesh (e.g., a bin or a shelf) doesn't report contact with objects
+ that are merely inside its hull.  */
+class MeshConvexDecomposition {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(MeshConvexDecomposition)
+
+  /* Reads the decomposition from the OBJ file with the given name, scaling
+   its vertices by `scale` (the scale of the mesh it decomposes).
+   @throws std::exception if the file can't be read, or if any of its
+                          objects has fewer than four vertices.  */
+  MeshConvexDecomposition(const std::string& filename, double scale);
+
+  int num_pieces() const { return static_cast<int>(pieces_.size()); }
+
+  /* The convex shape of the ith piece. Its local bounding volume (e.g., its
+   `aabb_center` and `aabb_radius`) has been computed.  */
+  const std::shared_ptr<fcl::Convexd>& piece(int i) const {
+    return pieces_.at(i);
+  }
+
+ private:
+  std::vector<std::shared_ptr<fcl::Convexd>> pieces_;
+};
+
+/* The (shared) convex decompositions of the geometries that have one, keyed by
+ geometry id.  */
+using MeshConvexDecompositions =
+    std::unordered_map<GeometryId,
+                       std::shared_ptr<const MeshConvexDecomposition>>;
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -6,7 +6,9 @@
 #include <utility>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/extract_double.h"
 #include "drake/geometry/proximity/contact_surface_utility.h"
+#include "drake/geometry/utilities.h"
 
 namespace drake {
 namespace geometry {
@@ -111,6 +113,46 @@ int GetVertexAddIfNeeded(
   return v_to_new_v_iter->second;
 }
 
+/* Returns the subset of `tri_indices` whose triangles may overlap the half
+ space, i.e., it drops the triangles whose vertices all lie outside of it (the
+ case in which ConstructTriangleHalfspaceIntersectionPolygon() adds nothing).
+ The three signed distances of a triangle are computed together, in double,
+ even when T is AutoDiffXd. Because they aren't computed exactly as
+ ConstructTriangleHalfspaceIntersectionPolygon() computes them, a triangle is
+ only dropped if all of its vertices lie outside by more than a rounding-error
+ margin. */
+template <typename T>
+std::vector<int> FindTrianglesOverlappingHalfSpace(
+    const TriangleSurfaceMesh<double>& mesh_F,
+    const PosedHalfSpace<T>& half_space_F,
+    const std::vector<int>& tri_indices) {
+  // Bounds the rounding error in a signed distance computed as a dot product
+  // and a difference, relative to the magnitude of the summands.
+  constexpr double kMargin = 16 * std::numeric_limits<double>::epsilon();
+  const Vector3<double> nhat_F = convert_to_double(half_space_F.normal());
+  // The signed distance of the frame's origin Fo is -d in the boundary plane's
+  // implicit equation n̂⋅p = d.
+  const Vector3<double> p_FFo = Vector3<double>::Zero();
+  const double d =
+      -ExtractDoubleOrThrow(half_space_F.CalcSignedDistance(p_FFo));
+  const double abs_d = std::abs(d);
+
+  std::vector<int> overlapping_tris;
+  overlapping_tris.reserve(tri_indices.size());
+  Eigen::Matrix3d p_FVs;
+  for (const int tri_index : tri_indices) {
+    const SurfaceTriangle& tri = mesh_F.element(tri_index);
+    for (int i = 0; i < 3; ++i) p_FVs.col(i) = mesh_F.vertex(tri.vertex(i));
+    const Eigen::Array<double, 1, 3> distances =
+        (nhat_F.transpose() * p_FVs).array() - d;
+    const double margin =
+        kMargin * (abs_d + p_FVs.cwiseAbs().colwise().sum().maxCoeff());
+    if ((distances > margin).all()) continue;
+    overlapping_tris.push_back(tri_index);
+  }
+  return overlapping_tris;
+}
+
 }  // namespace
 
 template <typename MeshBuilder>
@@ -331,12 +373,21 @@ ComputeContactSurface(
 
   if (tri_indices.size() == 0) return nullptr;
 
+  const std::vector<int> overlapping_tris =
+      FindTrianglesOverlappingHalfSpace(input_mesh_F, half_space_F,
+                                        tri_indices);
+  if (overlapping_tris.size() == 0) return nullptr;
+
   // Build infrastructure as we process each potentially colliding triangle.
+  // Vertices and edges are mostly shared among neighboring triangles; one
+  // entry per triangle keeps the caches from rehashing as they grow.
   MeshBuilder builder_W;
   std::unordered_map<int, int> vertices_to_newly_created_vertices;
   std::unordered_map<SortedPair<int>, int> edges_to_newly_created_vertices;
+  vertices_to_newly_created_vertices.reserve(overlapping_tris.size());
+  edges_to_newly_created_vertices.reserve(overlapping_tris.size());
 
-  for (const auto& tri_index : tri_indices) {
+  for (const auto& tri_index : overlapping_tris) {
     ConstructTriangleHalfspaceIntersectionPolygon(
         input_mesh_F, tri_index, half_space_F, pressure_in_F, grad_p_W, X_WF,
         &builder_W, &vertices_to_newly_created_vertices,
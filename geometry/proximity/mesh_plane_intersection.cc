@@ -1,12 +1,16 @@
 #include "drake/geometry/proximity/mesh_plane_intersection.h"
 
 #include <array>
+#include <cmath>
+#include <limits>
 #include <utility>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/extract_double.h"
 #include "drake/geometry/proximity/contact_surface_utility.h"
 #include "drake/geometry/proximity/triangle_surface_mesh_field.h"
 #include "drake/geometry/proximity/volume_mesh.h"
+#include "drake/geometry/utilities.h"
 
 namespace drake {
 namespace geometry {
@@ -59,6 +63,51 @@ constexpr std::array<std::array<int, 4>, 16> kMarchingTetsTable = {
     std::array<int, 4>{0, 2, 3, -1},    /* 1110 */
     std::array<int, 4>{-1, -1, -1, -1}  /* 1111 */};
 
+/* Returns the subset of `tet_indices` whose tetrahedra the plane may cut.
+
+ This front-loads the sign classification that SliceTetWithPlane() does for
+ each tetrahedron (codes 0000 and 1111 in kMarchingTetsTable produce nothing)
+ into a single tight pass over the candidates. The four heights of a
+ tetrahedron are computed together as one (vectorizable) 1x4 product in
+ double, even when T is AutoDiffXd. For a fine mesh resting on a plane, most
+ of the tetrahedra reported by the BVH lie wholly on one side of it; they now
+ never reach the scalar-typed slicing code.
+
+ The heights are not computed in the same order or type as in
+ SliceTetWithPlane(), so this classification is conservative: a tetrahedron is
+ only rejected when all of its vertices lie strictly on one side of the plane
+ by more than a rounding-error margin. SliceTetWithPlane() has the final word
+ on the tetrahedra that remain. */
+template <typename T>
+std::vector<int> FindCutTetrahedra(const VolumeMesh<double>& mesh_M,
+                                   const Plane<T>& plane_M,
+                                   const std::vector<int>& tet_indices) {
+  // Bounds the rounding error in a height computed as a dot product and a
+  // difference, relative to the magnitude of the summands.
+  constexpr double kMargin = 16 * std::numeric_limits<double>::epsilon();
+  const Vector3<double> nhat_M = convert_to_double(plane_M.normal());
+  // The height of the mesh frame's origin Mo is -d in the plane's implicit
+  // equation n̂⋅p = d.
+  const Vector3<double> p_MMo = Vector3<double>::Zero();
+  const double d = -ExtractDoubleOrThrow(plane_M.CalcHeight(p_MMo));
+  const double abs_d = std::abs(d);
+
+  std::vector<int> cut_tets;
+  cut_tets.reserve(tet_indices.size());
+  Eigen::Matrix<double, 3, 4> p_MVs;
+  for (const int tet_index : tet_indices) {
+    const VolumeElement& tet = mesh_M.element(tet_index);
+    for (int i = 0; i < 4; ++i) p_MVs.col(i) = mesh_M.vertex(tet.vertex(i));
+    const Eigen::Array<double, 1, 4> heights =
+        (nhat_M.transpose() * p_MVs).array() - d;
+    const double margin =
+        kMargin * (abs_d + p_MVs.cwiseAbs().colwise().sum().maxCoeff());
+    if ((heights > margin).all() || (heights < -margin).all()) continue;
+    cut_tets.push_back(tet_index);
+  }
+  return cut_tets;
+}
+
 }  // namespace
 
 template <typename T>
@@ -196,12 +245,21 @@ ComputeContactSurface(
   using T = typename MeshBuilder::ScalarType;
   if (tet_indices.size() == 0) return nullptr;
 
-  // Build infrastructure as we process each potentially colliding tet.
+  const std::vector<int> cut_tets =
+      FindCutTetrahedra(mesh_field_M.mesh(), plane_M, tet_indices);
+  if (cut_tets.size() == 0) return nullptr;
+
+  // Build infrastructure as we process each cut tet. Each cut tet contributes
+  // three or four cut edges, but most of those are shared with its neighbors;
+  // reserving one entry per tet keeps the edge cache from rehashing as it
+  // grows.
   MeshBuilder builder_W;
   std::unordered_map<SortedPair<int>, int> cut_edges;
+  cut_edges.reserve(cut_tets.size());
 
   auto grad_eM_W = std::make_unique<std::vector<Vector3<T>>>();
-  for (const auto& tet_index : tet_indices) {
+  grad_eM_W->reserve(cut_tets.size());
+  for (const auto& tet_index : cut_tets) {
     const int num_new_faces = SliceTetWithPlane(
         tet_index, mesh_field_M, plane_M, X_WM, &builder_W, &cut_edges);
     // ContactSurface requires us to store the gradient of the *constituent*
@@ -0,0 +1,473 @@
+#include "drake/geometry/proximity/mesh_signed_distance_field.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/extract_double.h"
+#include "drake/common/filesystem.h"
+#include "drake/common/sorted_pair.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+using Eigen::Vector3d;
+
+namespace {
+
+// The exact signed distance from points to a closed triangle mesh, by
+// (pruned) exhaustive search of its triangles.
+class MeshDistance {
+ public:
+  explicit MeshDistance(const TriangleSurfaceMesh<double>& mesh_M)
+      : mesh_M_(mesh_M),
+        vertex_normals_(mesh_M.num_vertices(), Vector3d::Zero()),
+        edge_normals_(3 * mesh_M.num_triangles()) {
+    // The pseudonormal of an edge is the sum of the normals of its incident
+    // faces; that of a vertex is the sum of the normals of its incident faces,
+    // weighted by their angles at the vertex.
+    std::map<SortedPair<int>, Vector3d> edge_sums;
+    for (int t = 0; t < mesh_M.num_triangles(); ++t) {
+      const Vector3d& n = mesh_M.face_normal(t);
+      for (int e = 0; e < 3; ++e) {
+        const int v = mesh_M.element(t).vertex(e);
+        const int v_next = mesh_M.element(t).vertex((e + 1) % 3);
+        const int v_prev = mesh_M.element(t).vertex((e + 2) % 3);
+        auto [iter, inserted] =
+            edge_sums.emplace(SortedPair<int>(v, v_next), Vector3d::Zero());
+        iter->second += n;
+        const Vector3d a = mesh_M.vertex(v_next) - mesh_M.vertex(v);
+        const Vector3d b = mesh_M.vertex(v_prev) - mesh_M.vertex(v);
+        const double angle = std::atan2(a.cross(b).norm(), a.dot(b));
+        vertex_normals_[v] += angle * n;
+      }
+    }
+    for (int t = 0; t < mesh_M.num_triangles(); ++t) {
+      for (int e = 0; e < 3; ++e) {
+        edge_normals_[3 * t + e] = edge_sums.at(SortedPair<int>(
+            mesh_M.element(t).vertex(e),
+            mesh_M.element(t).vertex((e + 1) % 3)));
+      }
+      boxes_.push_back(CalcBox(t));
+    }
+  }
+
+  int num_triangles() const { return mesh_M_.num_triangles(); }
+
+  // Returns the bounding box (lower and upper corners) of triangle t.
+  const std::pair<Vector3d, Vector3d>& box(int t) const { return boxes_[t]; }
+
+  // Returns the signed distance from the point Q to the mesh. The nearest
+  // triangle to Q must be among the given `triangles`.
+  double Calc(const Vector3d& p_MQ, const std::vector<int>& triangles) const {
+    double best_squared = std::numeric_limits<double>::infinity();
+    Vector3d best_p_MN = Vector3d::Zero();
+    const Vector3d* best_normal = nullptr;
+    for (int t : triangles) {
+      // Skip the triangles whose bounding boxes are no nearer than the best.
+      const Vector3d to_box = (boxes_[t].first - p_MQ)
+                                  .cwiseMax(p_MQ - boxes_[t].second)
+                                  .cwiseMax(0.0);
+      if (to_box.squaredNorm() >= best_squared) continue;
+      const auto [p_MN, normal] = CalcNearestPoint(t, p_MQ);
+      const double squared = (p_MQ - p_MN).squaredNorm();
+      if (squared < best_squared) {
+        best_squared = squared;
+        best_p_MN = p_MN;
+        best_normal = normal;
+      }
+    }
+    DRAKE_DEMAND(best_normal != nullptr);
+    const double distance = std::sqrt(best_squared);
+    return (p_MQ - best_p_MN).dot(*best_normal) < 0 ? -distance : distance;
+  }
+
+ private:
+  std::pair<Vector3d, Vector3d> CalcBox(int t) const {
+    Vector3d lower = mesh_M_.vertex(mesh_M_.element(t).vertex(0));
+    Vector3d upper = lower;
+    for (int i = 1; i < 3; ++i) {
+      lower = lower.cwiseMin(mesh_M_.vertex(mesh_M_.element(t).vertex(i)));
+      upper = upper.cwiseMax(mesh_M_.vertex(mesh_M_.element(t).vertex(i)));
+    }
+    return {lower, upper};
+  }
+
+  // Returns the nearest point N on triangle t to the point Q, along with the
+  // pseudonormal of the feature on which N lies. See Ericson, "Real-Time
+  // Collision Detection", Section 5.1.5.
+  std::pair<Vector3d, const Vector3d*> CalcNearestPoint(
+      int t, const Vector3d& p_MQ) const {
+    const SurfaceTriangle& tri = mesh_M_.element(t);
+    const Vector3d& a = mesh_M_.vertex(tri.vertex(0));
+    const Vector3d& b = mesh_M_.vertex(tri.vertex(1));
+    const Vector3d& c = mesh_M_.vertex(tri.vertex(2));
+    const Vector3d ab = b - a;
+    const Vector3d ac = c - a;
+    const Vector3d ap = p_MQ - a;
+    const double d1 = ab.dot(ap);
+    const double d2 = ac.dot(ap);
+    if (d1 <= 0 && d2 <= 0) return {a, &vertex_normals_[tri.vertex(0)]};
+    const Vector3d bp = p_MQ - b;
+    const double d3 = ab.dot(bp);
+    const double d4 = ac.dot(bp);
+    if (d3 >= 0 && d4 <= d3) return {b, &vertex_normals_[tri.vertex(1)]};
+    const double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+      return {a + d1 / (d1 - d3) * ab, &edge_normals_[3 * t]};
+    }
+    const Vector3d cp = p_MQ - c;
+    const double d5 = ab.dot(cp);
+    const double d6 = ac.dot(cp);
+    if (d6 >= 0 && d5 <= d6) return {c, &vertex_normals_[tri.vertex(2)]};
+    const double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+      return {a + d2 / (d2 - d6) * ac, &edge_normals_[3 * t + 2]};
+    }
+    const double va = d3 * d6 - d5 * d4;
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+      const double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+      return {b + w * (c - b), &edge_normals_[3 * t + 1]};
+    }
+    const double denom = 1 / (va + vb + vc);
+    return {a + ab * (vb * denom) + ac * (vc * denom),
+            &mesh_M_.face_normal(t)};
+  }
+
+  const TriangleSurfaceMesh<double>& mesh_M_;
+  std::vector<Vector3d> vertex_normals_;
+  // The pseudonormal of edge e of triangle t (from its vertex e to its vertex
+  // e + 1) is at index 3t + e.
+  std::vector<Vector3d> edge_normals_;
+  std::vector<std::pair<Vector3d, Vector3d>> boxes_;
+};
+
+// The header of the files written by MeshSignedDistanceField::Save().
+constexpr char kMagic[] = "drake_mesh_sdf_1";
+
+template <typename Value>
+void WriteValues(std::ofstream* out, const Value* values, size_t count) {
+  out->write(reinterpret_cast<const char*>(values), sizeof(Value) * count);
+}
+
+template <typename Value>
+bool ReadValues(std::ifstream* in, Value* values, size_t count) {
+  in->read(reinterpret_cast<char*>(values), sizeof(Value) * count);
+  return in->good();
+}
+
+}  // namespace
+
+MeshSignedDistanceField::MeshSignedDistanceField(
+    const TriangleSurfaceMesh<double>& mesh_M, double resolution)
+    : resolution_(resolution) {
+  DRAKE_THROW_UNLESS(resolution > 0);
+  DRAKE_THROW_UNLESS(mesh_M.num_triangles() > 0);
+  const MeshDistance mesh_distance(mesh_M);
+  const double brick_width = kBrickSize * resolution;
+
+  // The grid spans the mesh's bounding box, padded by a brick on each side.
+  const auto [p_MMin, p_MMax] = mesh_M.CalcBoundingBox();
+  p_MLower_ = p_MMin - Vector3d::Constant(brick_width);
+  for (int a = 0; a < 3; ++a) {
+    num_bricks_(a) =
+        static_cast<int>(std::ceil((p_MMax(a) - p_MMin(a)) / brick_width)) + 2;
+  }
+  const Vector3<int>& nb = num_bricks_;
+
+  // Sample the coarse grid.
+  std::vector<int> all_triangles(mesh_M.num_triangles());
+  std::iota(all_triangles.begin(), all_triangles.end(), 0);
+  coarse_.resize((nb.x() + 1) * (nb.y() + 1) * (nb.z() + 1));
+  for (int i = 0; i <= nb.x(); ++i) {
+    for (int j = 0; j <= nb.y(); ++j) {
+      for (int k = 0; k <= nb.z(); ++k) {
+        const Vector3d p_MS = p_MLower_ + brick_width * Vector3d(i, j, k);
+        coarse_[coarse_index(i, j, k)] =
+            mesh_distance.Calc(p_MS, all_triangles);
+      }
+    }
+  }
+
+  // Refine the bricks that the surface may pass through: a brick can only
+  // contain a point of the surface if one of its corners is within the
+  // brick's diagonal of the surface.
+  const double diagonal = std::sqrt(3.0) * brick_width;
+  fine_offsets_.assign(nb.x() * nb.y() * nb.z(), -1);
+  for (int i = 0; i < nb.x(); ++i) {
+    for (int j = 0; j < nb.y(); ++j) {
+      for (int k = 0; k < nb.z(); ++k) {
+        double nearest = std::numeric_limits<double>::infinity();
+        for (int corner = 0; corner < 8; ++corner) {
+          nearest = std::min(
+              nearest, std::abs(coarse_[coarse_index(
+                           i + (corner & 1), j + ((corner >> 1) & 1),
+                           k + ((corner >> 2) & 1))]));
+        }
+        if (nearest > diagonal) continue;
+
+        // The nearest triangle to any point in the brick is within
+        // `nearest + diagonal` of the brick.
+        const Vector3d p_MBrickMin =
+            p_MLower_ + brick_width * Vector3d(i, j, k);
+        const Vector3d p_MBrickMax =
+            p_MBrickMin + Vector3d::Constant(brick_width);
+        const double reach = nearest + diagonal;
+        std::vector<int> candidates;
+        for (int t = 0; t < mesh_distance.num_triangles(); ++t) {
+          const auto& [p_MBoxMin, p_MBoxMax] = mesh_distance.box(t);
+          const Vector3d gap = (p_MBoxMin - p_MBrickMax)
+                                   .cwiseMax(p_MBrickMin - p_MBoxMax)
+                                   .cwiseMax(0.0);
+          if (gap.squaredNorm() <= reach * reach) candidates.push_back(t);
+        }
+
+        fine_offsets_[brick_index(i, j, k)] = num_fine_bricks();
+        for (int fi = 0; fi <= kBrickSize; ++fi) {
+          for (int fj = 0; fj <= kBrickSize; ++fj) {
+            for (int fk = 0; fk <= kBrickSize; ++fk) {
+              const Vector3d p_MS =
+                  p_MBrickMin + resolution * Vector3d(fi, fj, fk);
+              fine_.push_back(mesh_distance.Calc(p_MS, candidates));
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+std::optional<MeshSignedDistanceField> MeshSignedDistanceField::Load(
+    const std::string& filename, const std::string& key) {
+  std::ifstream in(filename, std::ios::binary);
+  if (!in.good()) return std::nullopt;
+
+  char magic[sizeof(kMagic)];
+  if (!ReadValues(&in, magic, sizeof(kMagic)) ||
+      std::string(magic, sizeof(kMagic)) !=
+          std::string(kMagic, sizeof(kMagic))) {
+    return std::nullopt;
+  }
+  uint64_t key_size{};
+  if (!ReadValues(&in, &key_size, 1) || key_size != key.size()) {
+    return std::nullopt;
+  }
+  std::string saved_key(key_size, '\0');
+  if (!ReadValues(&in, saved_key.data(), key_size) || saved_key != key) {
+    return std::nullopt;
+  }
+
+  MeshSignedDistanceField field;
+  int32_t num_bricks[3];
+  int32_t num_fine_bricks{};
+  if (!ReadValues(&in, &field.resolution_, 1) ||
+      !ReadValues(&in, field.p_MLower_.data(), 3) ||
+      !ReadValues(&in, num_bricks, 3) ||
+      !ReadValues(&in, &num_fine_bricks, 1)) {
+    return std::nullopt;
+  }
+  const Vector3<int> nb(num_bricks[0], num_bricks[1], num_bricks[2]);
+  if (!(field.resolution_ > 0) || nb.minCoeff() < 1 || num_fine_bricks < 0 ||
+      num_fine_bricks > nb.prod()) {
+    return std::nullopt;
+  }
+  field.num_bricks_ = nb;
+  field.coarse_.resize((nb.x() + 1) * (nb.y() + 1) * (nb.z() + 1));
+  field.fine_offsets_.resize(nb.prod());
+  field.fine_.resize(num_fine_bricks * kSamplesPerBrick);
+  if (!ReadValues(&in, field.coarse_.data(), field.coarse_.size()) ||
+      !ReadValues(&in, field.fine_offsets_.data(),
+                  field.fine_offsets_.size())) {
+    return std::nullopt;
+  }
+  // The last read may hit the end of the file, so only check for failure.
+  in.read(reinterpret_cast<char*>(field.fine_.data()),
+          sizeof(double) * field.fine_.size());
+  if (in.fail()) return std::nullopt;
+  for (int offset : field.fine_offsets_) {
+    if (offset < -1 || offset >= num_fine_bricks) return std::nullopt;
+  }
+  return field;
+}
+
+void MeshSignedDistanceField::Save(const std::string& filename,
+                                   const std::string& key) const {
+  // Write to a uniquely named temporary file and then rename it over
+  // `filename`, so that a concurrent Load() (or an interrupted Save()) never
+  // observes a partially written field.
+  const std::string temp_filename =
+      fmt::format("{}.tmp{:08x}", filename, std::random_device{}());
+  std::ofstream out(temp_filename, std::ios::binary | std::ios::trunc);
+  const uint64_t key_size = key.size();
+  const int32_t num_bricks[3] = {num_bricks_.x(), num_bricks_.y(),
+                                 num_bricks_.z()};
+  const int32_t num_fine = num_fine_bricks();
+  WriteValues(&out, kMagic, sizeof(kMagic));
+  WriteValues(&out, &key_size, 1);
+  WriteValues(&out, key.data(), key.size());
+  WriteValues(&out, &resolution_, 1);
+  WriteValues(&out, p_MLower_.data(), 3);
+  WriteValues(&out, num_bricks, 3);
+  WriteValues(&out, &num_fine, 1);
+  WriteValues(&out, coarse_.data(), coarse_.size());
+  WriteValues(&out, fine_offsets_.data(), fine_offsets_.size());
+  WriteValues(&out, fine_.data(), fine_.size());
+  out.close();
+  std::error_code error;
+  if (!out.fail()) filesystem::rename(temp_filename, filename, error);
+  if (out.fail() || error) {
+    std::error_code ignored;
+    filesystem::remove(temp_filename, ignored);
+    throw std::runtime_error(fmt::format(
+        "MeshSignedDistanceField: could not write the file '{}'", filename));
+  }
+}
+
+template <typename T>
+T MeshSignedDistanceField::CalcSignedDistance(const Vector3<T>& p_MQ,
+                                              Vector3<T>* grad_M) const {
+  const Vector3<T> u = (p_MQ - p_MLower_.cast<T>()) / resolution_;
+  const Vector3<double> u_max = num_bricks_.cast<double>() * kBrickSize;
+  Vector3<T> u_grid = u;
+  bool outside = false;
+  for (int a = 0; a < 3; ++a) {
+    if (u(a) < 0) {
+      u_grid(a) = 0;
+      outside = true;
+    } else if (u(a) > u_max(a)) {
+      u_grid(a) = u_max(a);
+      outside = true;
+    }
+  }
+  if (!outside) return Interpolate(u, grad_M);
+
+  // Outside the grid, we extrapolate from the nearest point G on the grid.
+  const T phi_G = Interpolate<T>(u_grid, nullptr);
+  const Vector3<T> p_GQ_M = (u - u_grid) * resolution_;
+  const T distance = p_GQ_M.norm();
+  if (grad_M != nullptr) *grad_M = p_GQ_M / distance;
+  return phi_G + distance;
+}
+
+template <typename T>
+T MeshSignedDistanceField::Interpolate(const Vector3<T>& u,
+                                       Vector3<T>* grad_M) const {
+  // The brick containing the point.
+  Vector3<int> b;
+  for (int a = 0; a < 3; ++a) {
+    b(a) = std::clamp(
+        static_cast<int>(std::floor(ExtractDoubleOrThrow(u(a)) / kBrickSize)),
+        0, num_bricks_(a) - 1);
+  }
+  const int offset = fine_offsets_[brick_index(b.x(), b.y(), b.z())];
+
+  // The samples at the corners of the cell containing the point, indexed by
+  // [x][y][z] offset, the point's fractional coordinates t in the cell, and
+  // the cell's size.
+  double v[2][2][2];
+  Vector3<T> t;
+  double cell_size{};
+  if (offset >= 0) {
+    Vector3<int> c;
+    for (int a = 0; a < 3; ++a) {
+      const T local = u(a) - b(a) * kBrickSize;
+      const int cell =
+          static_cast<int>(std::floor(ExtractDoubleOrThrow(local)));
+      c(a) = std::clamp(cell, 0, kBrickSize - 1);
+      t(a) = local - c(a);
+    }
+    const double* samples = &fine_[offset * kSamplesPerBrick];
+    for (int i = 0; i < 2; ++i) {
+      for (int j = 0; j < 2; ++j) {
+        for (int k = 0; k < 2; ++k) {
+          v[i][j][k] = samples[((c.x() + i) * (kBrickSize + 1) + c.y() + j) *
+                                   (kBrickSize + 1) +
+                               c.z() + k];
+        }
+      }
+    }
+    cell_size = resolution_;
+  } else {
+    for (int a = 0; a < 3; ++a) {
+      t(a) = u(a) / kBrickSize - b(a);
+    }
+    for (int i = 0; i < 2; ++i) {
+      for (int j = 0; j < 2; ++j) {
+        for (int k = 0; k < 2; ++k) {
+          v[i][j][k] = coarse_[coarse_index(b.x() + i, b.y() + j, b.z() + k)];
+        }
+      }
+    }
+    cell_size = kBrickSize * resolution_;
+  }
+
+  // Trilinear interpolation.
+  const T& x = t.x();
+  const T& y = t.y();
+  const T& z = t.z();
+  const T v00 = v[0][0][0] + (v[1][0][0] - v[0][0][0]) * x;
+  const T v10 = v[0][1][0] + (v[1][1][0] - v[0][1][0]) * x;
+  const T v01 = v[0][0][1] + (v[1][0][1] - v[0][0][1]) * x;
+  const T v11 = v[0][1][1] + (v[1][1][1] - v[0][1][1]) * x;
+  const T v0 = v00 + (v10 - v00) * y;
+  const T v1 = v01 + (v11 - v01) * y;
+  if (grad_M != nullptr) {
+    const T dx00 = T(v[1][0][0] - v[0][0][0]);
+    const T dx10 = T(v[1][1][0] - v[0][1][0]);
+    const T dx01 = T(v[1][0][1] - v[0][0][1]);
+    const T dx11 = T(v[1][1][1] - v[0][1][1]);
+    const T dx0 = dx00 + (dx10 - dx00) * y;
+    const T dx1 = dx01 + (dx11 - dx01) * y;
+    (*grad_M)(0) = dx0 + (dx1 - dx0) * z;
+    (*grad_M)(1) = (v10 - v00) + ((v11 - v01) - (v10 - v00)) * z;
+    (*grad_M)(2) = v1 - v0;
+    *grad_M /= cell_size;
+  }
+  return v0 + (v1 - v0) * z;
+}
+
+DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS((
+    &MeshSignedDistanceField::CalcSignedDistance<T>
+))
+
+MeshSignedDistanceField MakeMeshSignedDistanceField(
+    const std::string& filename, double scale, double resolution,
+    const std::string& cache_file) {
+  // Distinguish versions of the mesh file by size and modification time, so
+  // that a field cached from an edited file isn't reused.
+  std::error_code error;
+  const auto size = filesystem::file_size(filename, error);
+  const auto time = filesystem::last_write_time(filename, error);
+  const std::string key = fmt::format(
+      "{} size={} mtime={} scale={} resolution={}", filename, error ? 0 : size,
+      error ? 0 : time.time_since_epoch().count(), scale, resolution);
+  if (!cache_file.empty()) {
+    std::optional<MeshSignedDistanceField> cached =
+        MeshSignedDistanceField::Load(cache_file, key);
+    if (cached.has_value()) return std::move(*cached);
+  }
+  MeshSignedDistanceField field(ReadObjToTriangleSurfaceMesh(filename, scale),
+                                resolution);
+  if (!cache_file.empty()) {
+    field.Save(cache_file, key);
+  }
+  return field;
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
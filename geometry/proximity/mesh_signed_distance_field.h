@@ -0,0 +1,150 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/proximity/triangle_surface_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* A signed distance field φ of a rigid, closed triangle mesh, baked once on a
+ sparse voxel grid so that it can be evaluated in constant time (independent
+ of the number of triangles) at any query point.
+
+ The grid spans the mesh's bounding box, padded by one brick on each side. It
+ has two levels:
+
+   - a coarse grid, whose cells are "bricks" of kBrickSize³ voxels, with a
+     sample of φ at every brick corner, and
+   - for only those bricks that the mesh's surface may pass through (i.e.,
+     where the coarse samples can't resolve the surface), a brick of fine
+     samples spaced at the given resolution.
+
+ So, the storage is proportional to the area of the surface rather than the
+ volume of its bounding box. φ is evaluated by trilinear interpolation of the
+ finest samples available at the query point; outside the grid, it is
+ extrapolated as the distance to the grid plus φ at the nearest point of the
+ grid.
+
+ The samples themselves are exact signed distances; the sign is determined by
+ the angle-weighted pseudonormal of the nearest feature (face, edge or vertex)
+ of the mesh. As such, the mesh must be closed (watertight) with consistently
+ outward-facing triangles for the sign to be meaningful. It need not be
+ convex.  */
+class MeshSignedDistanceField {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(MeshSignedDistanceField)
+
+  /* The number of voxels along each edge of a brick.  */
+  static constexpr int kBrickSize = 8;
+
+  /* Bakes the signed distance field of the given mesh, with fine samples
+   spaced by `resolution`.
+   @param mesh_M      The mesh, measured and expressed in its frame M.
+   @param resolution  The spacing of the fine samples (in meters).
+   @throws std::exception if `resolution` is not positive or the mesh has no
+                          triangles.  */
+  MeshSignedDistanceField(const TriangleSurfaceMesh<double>& mesh_M,
+                          double resolution);
+
+  /* Reads a field previously written by Save() from `filename`. Returns
+   nullopt if the file doesn't exist, is malformed, or was saved with a
+   different `key`.  */
+  static std::optional<MeshSignedDistanceField> Load(
+      const std::string& filename, const std::string& key);
+
+  /* Writes this field to `filename`, tagged with the given `key` (which
+   identifies the mesh and parameters from which it was baked) for Load().
+   The field is written to a temporary file that then replaces `filename`, so
+   readers see either the old file or the complete new one.
+   @throws std::exception if the file can't be written.  */
+  void Save(const std::string& filename, const std::string& key) const;
+
+  /* Evaluates the (interpolated) signed distance φ(Q) of the query point Q.
+   @param p_MQ         The position of Q in the mesh's frame M.
+   @param[out] grad_M  If non-null, set to the gradient of the interpolated φ
+                       at Q, expressed in M. It approximates the unit normal
+                       of the nearest point on the surface, but it is not
+                       normalized (and may be zero).
+   @tparam T  double or AutoDiffXd; the derivatives are those of the
+              interpolant.  */
+  template <typename T>
+  T CalcSignedDistance(const Vector3<T>& p_MQ, Vector3<T>* grad_M) const;
+
+  /* The spacing of the fine samples.  */
+  double resolution() const { return resolution_; }
+
+  /* The minimum corner of the grid, measured and expressed in M.  */
+  const Vector3<double>& p_MLower() const { return p_MLower_; }
+
+  /* The number of bricks along each axis of the grid.  */
+  const Vector3<int>& num_bricks() const { return num_bricks_; }
+
+  /* The number of bricks that have fine samples.  */
+  int num_fine_bricks() const {
+    return static_cast<int>(fine_.size()) / kSamplesPerBrick;
+  }
+
+ private:
+  static constexpr int kSamplesPerBrick =
+      (kBrickSize + 1) * (kBrickSize + 1) * (kBrickSize + 1);
+
+  MeshSignedDistanceField() = default;
+
+  // Evaluates the field at the point Q, whose (continuous) grid coordinates u
+  // (in units of fine voxels, measured from the grid's minimum corner) must
+  // lie within the grid.
+  template <typename T>
+  T Interpolate(const Vector3<T>& u, Vector3<T>* grad_M) const;
+
+  // The index of the coarse sample at brick corner (i, j, k).
+  int coarse_index(int i, int j, int k) const {
+    return (i * (num_bricks_.y() + 1) + j) * (num_bricks_.z() + 1) + k;
+  }
+
+  // The index of brick (i, j, k).
+  int brick_index(int i, int j, int k) const {
+    return (i * num_bricks_.y() + j) * num_bricks_.z() + k;
+  }
+
+  double resolution_{};
+  Vector3<double> p_MLower_;
+  Vector3<int> num_bricks_;
+  // The samples at the brick corners, indexed by coarse_index().
+  std::vector<double> coarse_;
+  // For each brick (indexed by brick_index()), the offset of its fine samples
+  // in fine_ (in units of kSamplesPerBrick), or -1 if it has none.
+  std::vector<int> fine_offsets_;
+  // The fine samples of the refined bricks, kSamplesPerBrick per brick,
+  // ordered like coarse_ within each brick.
+  std::vector<double> fine_;
+};
+
+/* The (shared) signed distance fields of the geometries that have one, keyed
+ by geometry id.  */
+using MeshSignedDistanceFields =
+    std::unordered_map<GeometryId,
+                       std::shared_ptr<const MeshSignedDistanceField>>;
+
+/* Returns the signed distance field of the mesh in the given OBJ file, at the
+ given scale and resolution. If `cache_file` is non-empty, the field is loaded
+ from that file when it holds a field baked from the same mesh file (with the
+ same size and modification time), scale and resolution; otherwise, the field
+ is baked and then saved to that file.
+ @throws std::exception if the OBJ file can't be read or the cache file can't
+                        be written.  */
+MeshSignedDistanceField MakeMeshSignedDistanceField(
+    const std::string& filename, double scale, double resolution,
+    const std::string& cache_file = {});
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
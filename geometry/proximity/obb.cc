@@ -47,6 +47,21 @@ bool Obb::HasOverlap(const Obb& obb_G, const Aabb& aabb_H,
   return BoxesOverlap(aabb_H.half_width(), obb_G.half_width(), X_AO);
 }
 
+void Obb::AddToOverlapBatch(const Obb& a_G, const Obb& b_H,
+                            const RigidTransformd& X_GH, BoxPairBatch* batch) {
+  DRAKE_ASSERT(batch != nullptr);
+  batch->Add(a_G.half_width(), a_G.pose(), b_H.half_width(), b_H.pose(), X_GH);
+}
+
+void Obb::AddToOverlapBatch(const Obb& obb_G, const Aabb& aabb_H,
+                            const RigidTransformd& X_GH, BoxPairBatch* batch) {
+  DRAKE_ASSERT(batch != nullptr);
+  // As in HasOverlap(), the aabb plays the role of box A, so the roles of the
+  // hierarchy frames are swapped as well.
+  batch->Add(aabb_H.half_width(), RigidTransformd(aabb_H.center()),
+             obb_G.half_width(), obb_G.pose(), X_GH.inverse());
+}
+
 bool Obb::HasOverlap(const Obb& bv, const Plane<double>& plane_P,
                       const math::RigidTransformd& X_PH) {
   // We want the two corners of the box that lie at the most extreme extents in
@@ -18,6 +18,7 @@ namespace internal {
 // Forward declarations.
 template <typename> class ObbMaker;
 class Aabb;
+class BoxPairBatch;
 
 /* Oriented bounding box used in Bvh. The box is defined in a canonical
  frame B such that it is centered on Bo and its extents are aligned with
@@ -102,6 +103,19 @@ class Obb {
   static bool HasOverlap(const Obb& obb_G, const Aabb& aabb_H,
                          const math::RigidTransformd& X_GH);
 
+  /* Appends the pair of boxes to `batch` so that the batched BoxesOverlap()
+   reports the same result for it as HasOverlap() with the same arguments
+   would (up to rounding; see BoxesOverlap(const BoxPairBatch&)). Overloads
+   are provided for the same pairs of box types as HasOverlap().
+   @pre !batch->full(). */
+  static void AddToOverlapBatch(const Obb& a_G, const Obb& b_H,
+                                const math::RigidTransformd& X_GH,
+                                BoxPairBatch* batch);
+
+  static void AddToOverlapBatch(const Obb& obb_G, const Aabb& aabb_H,
+                                const math::RigidTransformd& X_GH,
+                                BoxPairBatch* batch);
+
   /* Checks whether bounding volume `bv` intersects the given plane. The
    bounding volume is centered on its canonical frame B, and B is posed in the
    corresponding hierarchy frame H. The plane is defined in frame P.
@@ -4,7 +4,6 @@
 #include <istream>
 #include <memory>
 #include <numeric>
-#include <optional>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -14,9 +13,9 @@
 #include <tiny_obj_loader.h>
 
 #include "drake/common/drake_assert.h"
-#include "drake/common/filesystem.h"
 #include "drake/common/text_logging.h"
 #include "drake/geometry/proximity/triangle_surface_mesh.h"
+#include "drake/geometry/read_obj.h"
 
 namespace drake {
 namespace geometry {
@@ -24,9 +23,6 @@ namespace {
 
 using Eigen::Vector3d;
 
-// TODO(DamrongGuoy): Refactor the tinyobj usage between here and
-//  ProximityEngine.
-
 /*
  Converts vertices of tinyobj to vertices of TriangleSurfaceMesh.
  @param tinyobj_vertices
@@ -109,31 +105,20 @@ void TinyObjToSurfaceFaces(const tinyobj::mesh_t& mesh,
   }
 }
 
-TriangleSurfaceMesh<double> DoReadObjToSurfaceMesh(
-    std::istream* input_stream,
+/*
+ Converts the parse of a Wavefront obj file into a TriangleSurfaceMesh,
+ reporting the parser's errors and warnings.
+ */
+TriangleSurfaceMesh<double> ObjDataToSurfaceMesh(
+    const internal::ObjFileData& data,
     const double scale,
-    const std::optional<std::string>& mtl_basedir,
-    const std::function<void(std::string_view)> on_warning) {
-  tinyobj::attrib_t attrib;  // Used for vertices.
-  std::vector<tinyobj::shape_t> shapes;  // Used for triangles.
-  std::vector<tinyobj::material_t> materials;  // Not used.
-  std::string warn;
-  std::string err;
-  std::unique_ptr<tinyobj::MaterialReader> readMatFn;
-  if (mtl_basedir) {
-    readMatFn = std::make_unique<tinyobj::MaterialFileReader>(*mtl_basedir);
+    const std::function<void(std::string_view)>& on_warning) {
+  if (!data.success || !data.error.empty()) {
+    throw std::runtime_error("Error parsing Wavefront obj file : " +
+                             data.error);
   }
-  // triangulate non-triangle faces.
-  bool triangulate = true;
-
-  bool ret = tinyobj::LoadObj(
-      &attrib, &shapes, &materials, &warn, &err, input_stream, readMatFn.get(),
-      triangulate);
-  if (!ret || !err.empty()) {
-    throw std::runtime_error("Error parsing Wavefront obj file : " + err);
-  }
-  if (!warn.empty()) {
-    warn = "Warning parsing Wavefront obj file : " + warn;
+  if (!data.warning.empty()) {
+    std::string warn = "Warning parsing Wavefront obj file : " + data.warning;
     if (warn.back() == '\n') {
       warn.pop_back();
     }
@@ -143,11 +128,12 @@ TriangleSurfaceMesh<double> DoReadObjToSurfaceMesh(
       drake::log()->warn(warn);
     }
   }
+  const std::vector<tinyobj::shape_t>& shapes = data.shapes;
   if (shapes.size() == 0) {
     throw std::runtime_error("The Wavefront obj file has no faces.");
   }
   std::vector<Vector3d> vertices =
-      TinyObjToSurfaceVertices(attrib.vertices, scale);
+      TinyObjToSurfaceVertices(data.attrib.vertices, scale);
 
   // tinyobj stores vertices from all objects in attrib.vertices but stores
   // faces from each object separately. We will keep all faces together in
@@ -178,10 +164,12 @@ TriangleSurfaceMesh<double> ReadObjToTriangleSurfaceMesh(
   if (!input_stream.is_open()) {
     throw std::runtime_error("Cannot open file '" + filename +"'");
   }
-  const std::string mtl_basedir =
-      filesystem::path(filename).parent_path().string() + "/";
-  return DoReadObjToSurfaceMesh(&input_stream, scale, mtl_basedir,
-                                std::move(on_warning));
+  input_stream.close();
+  // Files are parsed through GetObjFileData(), so that the parse is shared
+  // with the other geometry consumers of the same file.
+  const std::shared_ptr<const internal::ObjFileData> data =
+      internal::GetObjFileData(filename, true /* triangulate */);
+  return ObjDataToSurfaceMesh(*data, scale, on_warning);
 }
 
 TriangleSurfaceMesh<double> ReadObjToTriangleSurfaceMesh(
@@ -189,8 +177,14 @@ TriangleSurfaceMesh<double> ReadObjToTriangleSurfaceMesh(
     const double scale,
     std::function<void(std::string_view)> on_warning) {
   DRAKE_THROW_UNLESS(input_stream != nullptr);
-  return DoReadObjToSurfaceMesh(input_stream, scale,
-      std::nullopt /* mtl_basedir */, std::move(on_warning));
+  internal::ObjFileData data;
+  std::vector<tinyobj::material_t> materials;  // Not used.
+  // triangulate non-triangle faces.
+  const bool triangulate = true;
+  data.success = tinyobj::LoadObj(
+      &data.attrib, &data.shapes, &materials, &data.warning, &data.error,
+      input_stream, nullptr /* readMatFn */, triangulate);
+  return ObjDataToSurfaceMesh(data, scale, on_warning);
 }
 
 }  // namespace geometry
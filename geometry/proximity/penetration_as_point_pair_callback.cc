@@ -1,7 +1,11 @@
 #include "drake/geometry/proximity/penetration_as_point_pair_callback.h"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
@@ -87,6 +91,12 @@ class PenetrationPairFunctor {
     SphereShapePenetration(sphere_A, capsule_B, result);
   }
 
+  void operator()(const fcl::Sphered& sphere_A,
+                  const MeshSignedDistanceField& field_B,
+                  PenetrationAsPointPair<T>* result) {
+    SphereShapePenetration(sphere_A, field_B, result);
+  }
+
   //@}
 
  private:
@@ -156,18 +166,20 @@ void CalcDistanceFallback(const fcl::CollisionObjectd& a,
       GetGeometryName(a), GetGeometryName(b), NiceTypeName::Get<T>()));
 }
 
-/* For the double scalar, computes the signed distance between the two objects.
- */
-template <>
-void CalcDistanceFallback<double>(const fcl::CollisionObjectd& a,
-                                  const fcl::CollisionObjectd& b,
-                                  const fcl::CollisionRequestd& request,
-                                  PenetrationAsPointPair<double>* pair_data) {
+/* Computes the penetration between the fcl shapes `a` and `b` (with the given
+ poses in the world frame), reporting it as the penetration between the
+ geometries with ids `id_A` and `id_B`.  */
+void CalcShapePenetration(const fcl::CollisionGeometryd& a,
+                          const fcl::Transform3d& X_WA, GeometryId id_A,
+                          const fcl::CollisionGeometryd& b,
+                          const fcl::Transform3d& X_WB, GeometryId id_B,
+                          const fcl::CollisionRequestd& request,
+                          PenetrationAsPointPair<double>* pair_data) {
   DRAKE_DEMAND(pair_data != nullptr);
   fcl::CollisionResult<double> result;
 
   // Perform nearphase collision detection
-  collide(&a, &b, request, result);
+  fcl::collide(&a, X_WA, &b, X_WB, request, result);
 
   if (!result.isCollision()) return;
 
@@ -201,12 +213,117 @@ void CalcDistanceFallback<double>(const fcl::CollisionObjectd& a,
   pair_data->p_WCb =
       contact.pos + 0.5 * pair_data->depth * pair_data->nhat_BA_W;
 
-  pair_data->id_A = EncodedData(a).id();
-  pair_data->id_B = EncodedData(b).id();
+  pair_data->id_A = id_A;
+  pair_data->id_B = id_B;
+}
+
+/* For the double scalar, computes the signed distance between the two objects.
+ */
+template <>
+void CalcDistanceFallback<double>(const fcl::CollisionObjectd& a,
+                                  const fcl::CollisionObjectd& b,
+                                  const fcl::CollisionRequestd& request,
+                                  PenetrationAsPointPair<double>* pair_data) {
+  CalcShapePenetration(*a.collisionGeometry(), a.getTransform(),
+                       EncodedData(a).id(), *b.collisionGeometry(),
+                       b.getTransform(), EncodedData(b).id(), request,
+                       pair_data);
 }
 
 //@}
 
+/* Returns the convex decomposition of the geometry with the given `id`, or
+ null if it has none.  */
+const MeshConvexDecomposition* FindMeshConvexDecomposition(
+    const MeshConvexDecompositions* mesh_decompositions, GeometryId id) {
+  if (mesh_decompositions == nullptr) return nullptr;
+  const auto iter = mesh_decompositions->find(id);
+  return iter != mesh_decompositions->end() ? iter->second.get() : nullptr;
+}
+
+/* The shapes that stand in for a collision object in
+ CalcDecomposedDistanceFallback(), each with its bounding box in the world
+ frame.  */
+struct ObjectParts {
+  std::vector<const fcl::CollisionGeometryd*> shapes;
+  std::vector<fcl::AABBd> aabbs;
+};
+
+/* Returns the parts of `object`: the pieces of its `decomposition` if it has
+ one, or else its own shape.  */
+ObjectParts MakeObjectParts(const fcl::CollisionObjectd& object,
+                            const MeshConvexDecomposition* decomposition) {
+  ObjectParts parts;
+  if (decomposition == nullptr) {
+    parts.shapes.push_back(object.collisionGeometry().get());
+    parts.aabbs.push_back(object.getAABB());
+    return parts;
+  }
+  const fcl::Transform3d& X_WO = object.getTransform();
+  parts.shapes.reserve(decomposition->num_pieces());
+  parts.aabbs.reserve(decomposition->num_pieces());
+  for (int i = 0; i < decomposition->num_pieces(); ++i) {
+    const fcl::Convexd& piece = *decomposition->piece(i);
+    // Like fcl's CollisionObject::computeAABB(), we bound the piece's
+    // bounding sphere.
+    const Vector3d center_W = X_WO * piece.aabb_center;
+    const Vector3d delta = Vector3d::Constant(piece.aabb_radius);
+    parts.shapes.push_back(&piece);
+    parts.aabbs.emplace_back(center_W - delta, center_W + delta);
+  }
+  return parts;
+}
+
+/* Evaluates CalcDistanceFallback() for the pair (`a`, `b`), except that an
+ object whose mesh has a convex decomposition is represented by its convex
+ pieces rather than by its convex hull. The reported penetration is the
+ deepest among all pairs of (overlapping) pieces.
+
+ Decompositions are only evaluated for the double scalar; for other scalars,
+ this is simply CalcDistanceFallback().  */
+template <typename T>
+void CalcDecomposedDistanceFallback(
+    const fcl::CollisionObjectd& a, const fcl::CollisionObjectd& b,
+    const fcl::CollisionRequestd& request,
+    const MeshConvexDecompositions* mesh_decompositions,
+    PenetrationAsPointPair<T>* pair_data) {
+  if constexpr (std::is_same_v<T, double>) {
+    const GeometryId id_A = EncodedData(a).id();
+    const GeometryId id_B = EncodedData(b).id();
+    const MeshConvexDecomposition* decomposition_A =
+        FindMeshConvexDecomposition(mesh_decompositions, id_A);
+    const MeshConvexDecomposition* decomposition_B =
+        FindMeshConvexDecomposition(mesh_decompositions, id_B);
+    if (decomposition_A != nullptr || decomposition_B != nullptr) {
+      const ObjectParts parts_A = MakeObjectParts(a, decomposition_A);
+      const ObjectParts parts_B = MakeObjectParts(b, decomposition_B);
+      for (size_t i = 0; i < parts_A.shapes.size(); ++i) {
+        for (size_t j = 0; j < parts_B.shapes.size(); ++j) {
+          if (!parts_A.aabbs[i].overlap(parts_B.aabbs[j])) continue;
+          PenetrationAsPointPair<double> part_pair;
+          CalcShapePenetration(*parts_A.shapes[i], a.getTransform(), id_A,
+                               *parts_B.shapes[j], b.getTransform(), id_B,
+                               request, &part_pair);
+          if (part_pair.depth > pair_data->depth) {
+            *pair_data = part_pair;
+          }
+        }
+      }
+      return;
+    }
+  }
+  CalcDistanceFallback<T>(a, b, request, pair_data);
+}
+
+/* Returns the signed distance field of the geometry with the given `id`, or
+ null if it has none.  */
+const MeshSignedDistanceField* FindMeshSdf(
+    const MeshSignedDistanceFields* mesh_sdfs, GeometryId id) {
+  if (mesh_sdfs == nullptr) return nullptr;
+  const auto iter = mesh_sdfs->find(id);
+  return iter != mesh_sdfs->end() ? iter->second.get() : nullptr;
+}
+
 /* Dispatches the narrowphase shape-shape query for the object pair (`a`, `b`)
  to the appropriate primitive-primitive function (optionally defaulting to the
  type- and shape-dependent fallback function).
@@ -216,16 +333,23 @@ void CalcDistanceFallback<double>(const fcl::CollisionObjectd& a,
  @param b               The second object in the pair.
  @param X_WB            The pose of object `b` expressed in the world frame.
  @param request         The distance request parameters.
+ @param mesh_sdfs       The signed distance fields of the meshes that have one
+                        (or null if none do); a sphere penetrating such a mesh
+                        is evaluated by the mesh's field.
+ @param mesh_decompositions  The convex decompositions of the meshes that
+                        have one (or null if none do); otherwise, a mesh
+                        with a decomposition is evaluated piece by piece.
  @param result          The structure to capture the computation results in.
  @tparam T Computation scalar type.
  @pre The pair should *not* be (Halfspace, X), unless X is Sphere.  */
 template <typename T>
-void ComputeNarrowPhasePenetration(const fcl::CollisionObjectd& a,
-                                   const math::RigidTransform<T>& X_WA,
-                                   const fcl::CollisionObjectd& b,
-                                   const math::RigidTransform<T>& X_WB,
-                                   const fcl::CollisionRequestd& request,
-                                   PenetrationAsPointPair<T>* result) {
+void ComputeNarrowPhasePenetration(
+    const fcl::CollisionObjectd& a, const math::RigidTransform<T>& X_WA,
+    const fcl::CollisionObjectd& b, const math::RigidTransform<T>& X_WB,
+    const fcl::CollisionRequestd& request,
+    const MeshSignedDistanceFields* mesh_sdfs,
+    const MeshConvexDecompositions* mesh_decompositions,
+    PenetrationAsPointPair<T>* result) {
   DRAKE_DEMAND(result != nullptr);
   const fcl::CollisionGeometryd* a_geometry = a.collisionGeometry().get();
   const fcl::CollisionGeometryd* b_geometry = b.collisionGeometry().get();
@@ -233,7 +357,8 @@ void ComputeNarrowPhasePenetration(const fcl::CollisionObjectd& a,
   const bool b_is_sphere = b_geometry->getNodeType() == fcl::GEOM_SPHERE;
   const bool no_sphere = !(a_is_sphere || b_is_sphere);
   if (no_sphere) {
-    CalcDistanceFallback<T>(a, b, request, result);
+    CalcDecomposedDistanceFallback<T>(a, b, request, mesh_decompositions,
+                                      result);
     return;
   }
   DRAKE_ASSERT(a_is_sphere || b_is_sphere);
@@ -285,8 +410,19 @@ void ComputeNarrowPhasePenetration(const fcl::CollisionObjectd& a,
       calc_penetration_pair(sphere_S, capsule_O, result);
       break;
     }
+    case fcl::GEOM_CONVEX: {
+      // Signed distance fields aren't evaluated symbolically.
+      const MeshSignedDistanceField* field_O =
+          scalar_predicate<T>::is_bool ? FindMeshSdf(mesh_sdfs, id_O) : nullptr;
+      if (field_O != nullptr) {
+        calc_penetration_pair(sphere_S, *field_O, result);
+      } else {
+        CalcDecomposedDistanceFallback<T>(a, b, request, mesh_decompositions,
+                                          result);
+      }
+      break;
+    }
     case fcl::GEOM_ELLIPSOID:
-    case fcl::GEOM_CONVEX:
       // We don't have a closed form solution for these geometries, so we
       // call FCL.
       CalcDistanceFallback<T>(a, b, request, result);
@@ -314,6 +450,98 @@ void ComputeNarrowPhasePenetration(const fcl::CollisionObjectd& a,
   }
 }
 
+/* Returns the support of `object`'s shape in the unit direction `dir_W`, i.e.,
+ the maximum of dir_W ⋅ p_WQ over the points Q of the shape, or infinity if it
+ is unbounded (or not handled).  */
+double CalcSupport(const fcl::CollisionObjectd& object, const Vector3d& dir_W) {
+  const fcl::Transform3d& X_WG = object.getTransform();
+  // The direction, expressed in the shape's frame G.
+  const Vector3d d = X_WG.linear().transpose() * dir_W;
+  const fcl::CollisionGeometryd& geometry = *object.collisionGeometry();
+  double support_G{};
+  switch (geometry.getNodeType()) {
+    case fcl::GEOM_SPHERE:
+      support_G = static_cast<const fcl::Sphered&>(geometry).radius;
+      break;
+    case fcl::GEOM_BOX:
+      support_G = 0.5 * static_cast<const fcl::Boxd&>(geometry)
+                            .side.cwiseProduct(d.cwiseAbs())
+                            .sum();
+      break;
+    case fcl::GEOM_CAPSULE: {
+      const auto& capsule = static_cast<const fcl::Capsuled&>(geometry);
+      support_G = 0.5 * capsule.lz * std::abs(d.z()) + capsule.radius;
+      break;
+    }
+    case fcl::GEOM_CYLINDER: {
+      const auto& cylinder = static_cast<const fcl::Cylinderd&>(geometry);
+      support_G = 0.5 * cylinder.lz * std::abs(d.z()) +
+                  cylinder.radius * d.head<2>().norm();
+      break;
+    }
+    case fcl::GEOM_ELLIPSOID:
+      support_G = static_cast<const fcl::Ellipsoidd&>(geometry)
+                      .radii.cwiseProduct(d)
+                      .norm();
+      break;
+    case fcl::GEOM_CONVEX: {
+      // A mesh's convex hull; it also bounds the mesh's convex decomposition.
+      support_G = -std::numeric_limits<double>::infinity();
+      for (const Vector3d& p_GV :
+           static_cast<const fcl::Convexd&>(geometry).getVertices()) {
+        support_G = std::max(support_G, d.dot(p_GV));
+      }
+      break;
+    }
+    default:
+      return std::numeric_limits<double>::infinity();
+  }
+  return dir_W.dot(X_WG.translation()) + support_G;
+}
+
+bool IsSeparatedAlong(const fcl::CollisionObjectd& a,
+                      const fcl::CollisionObjectd& b,
+                      const Vector3d& axis_AB_W) {
+  // The extent of `a` along the axis ends before that of `b` begins.
+  return CalcSupport(a, axis_AB_W) < -CalcSupport(b, -axis_AB_W);
+}
+
+/* Records the witness of the pair (`a`, `b`) for the next step in
+ `data.contact_pair_updates`, given the outcome of its narrowphase: if the pair
+ is in contact, the (negated) contact normal; otherwise, an axis that separates
+ the pair now, if one is found.  */
+template <typename T>
+void RecordWitness(const fcl::CollisionObjectd& a,
+                   const fcl::CollisionObjectd& b,
+                   const SortedPair<GeometryId>& pair,
+                   const ContactPairCache::Entry* previous_entry,
+                   const PenetrationAsPointPair<T>& penetration,
+                   CallbackData<T>* data) {
+  ContactPairCache::Updates& updates = *data->contact_pair_updates;
+  if (ExtractDoubleOrThrow(penetration.depth) >= 0) {
+    const int num_steps =
+        previous_entry ? previous_entry->num_steps_in_contact + 1 : 1;
+    // The penetration's A need not be the pair's first geometry.
+    const double sign = penetration.id_A == pair.first() ? -1.0 : 1.0;
+    updates.emplace_back(
+        pair,
+        ContactPairCache::Entry{
+            sign * ExtractDoubleOrThrow(penetration.nhat_BA_W), num_steps});
+    return;
+  }
+  // Separated: try the direction between the geometries' origins. Failing
+  // that, keep the previous axis (if any); it was the best guess the last time
+  // the pair was apart or in contact.
+  const Vector3d p_AB_W = b.getTranslation() - a.getTranslation();
+  const double distance = p_AB_W.norm();
+  if (distance > 0 && IsSeparatedAlong(a, b, p_AB_W / distance)) {
+    updates.emplace_back(pair, ContactPairCache::Entry{p_AB_W / distance, 0});
+  } else if (previous_entry != nullptr) {
+    updates.emplace_back(
+        pair, ContactPairCache::Entry{previous_entry->axis_AB_W, 0});
+  }
+}
+
 // TODO(SeanCurtis-TRI): Replace this clunky mechanism with a new mechanism
 // which does this implicitly via ADL and templates.
 /* @name   Mechanism for reporting on which scalars and for which shape-pairs
@@ -397,19 +625,52 @@ bool Callback(fcl::CollisionObjectd* fcl_object_A_ptr,
   // Since we want *all* collisions, we return false.
   if (!can_collide) return false;
 
-  if (ScalarSupport<T>::is_supported(
-          fcl_object_A_ptr->collisionGeometry()->getNodeType(),
-          fcl_object_B_ptr->collisionGeometry()->getNodeType())) {
+  const fcl::NODE_TYPE type_A =
+      fcl_object_A_ptr->collisionGeometry()->getNodeType();
+  const fcl::NODE_TYPE type_B =
+      fcl_object_B_ptr->collisionGeometry()->getNodeType();
+  // A sphere against a mesh with a signed distance field is supported for any
+  // non-symbolic scalar.
+  bool is_sphere_mesh_sdf = false;
+  if constexpr (scalar_predicate<T>::is_bool) {
+    is_sphere_mesh_sdf =
+        (type_A == fcl::GEOM_SPHERE &&
+         FindMeshSdf(data.mesh_sdfs, id_B) != nullptr) ||
+        (type_B == fcl::GEOM_SPHERE &&
+         FindMeshSdf(data.mesh_sdfs, id_A) != nullptr);
+  }
+  if (is_sphere_mesh_sdf || ScalarSupport<T>::is_supported(type_A, type_B)) {
     // Unpack the callback data
     const fcl::CollisionRequestd& request = data.request;
 
     // This callback only works for a single contact, this confirms a request
     // hasn't been made for more contacts.
     DRAKE_ASSERT(request.num_max_contacts == 1);
+
+    // If the pair's witness from the previous step still separates it, the
+    // narrowphase is unnecessary.
+    const SortedPair<GeometryId> pair(id_A, id_B);
+    const ContactPairCache::Entry* entry =
+        data.contact_pair_cache != nullptr ? data.contact_pair_cache->Find(pair)
+                                           : nullptr;
+    if (entry != nullptr &&
+        IsSeparatedAlong(*fcl_object_A_ptr, *fcl_object_B_ptr,
+                         entry->axis_AB_W)) {
+      data.contact_pair_updates->emplace_back(
+          pair, ContactPairCache::Entry{entry->axis_AB_W, 0});
+      ++data.num_narrowphase_skipped;
+      return false;
+    }
+
     PenetrationAsPointPair<T> penetration;
     ComputeNarrowPhasePenetration(*fcl_object_A_ptr, data.X_WGs.at(id_A),
                                   *fcl_object_B_ptr, data.X_WGs.at(id_B),
-                                  data.request, &penetration);
+                                  data.request, data.mesh_sdfs,
+                                  data.mesh_decompositions, &penetration);
+    if (data.contact_pair_cache != nullptr) {
+      RecordWitness(*fcl_object_A_ptr, *fcl_object_B_ptr, pair, entry,
+                    penetration, &data);
+    }
     if (ExtractDoubleOrThrow(penetration.depth) >= 0) {
       data.point_pairs.push_back(std::move(penetration));
     }
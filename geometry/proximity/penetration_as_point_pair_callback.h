@@ -6,6 +6,9 @@
 #include <fcl/fcl.h>
 
 #include "drake/geometry/proximity/collision_filter.h"
+#include "drake/geometry/proximity/contact_pair_cache.h"
+#include "drake/geometry/proximity/mesh_convex_decomposition.h"
+#include "drake/geometry/proximity/mesh_signed_distance_field.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
 #include "drake/math/rigid_transform.h"
 
@@ -21,7 +24,9 @@ namespace penetration_as_point_pair {
     - An fcl collision request. Aliased.
     - The poses. Aliased.
     - A vector of point pairs -- one instance of PenetrationAsPointPair for
-      every supported, unfiltered penetrating pair. Aliased. */
+      every supported, unfiltered penetrating pair. Aliased.
+    - Optionally, the contact-pair cache from the previous step and the
+      entries recorded for the next one. Aliased. */
 template <typename T>
 struct CallbackData {
   CallbackData(
@@ -56,8 +61,36 @@ struct CallbackData {
 
   /* The results of the collision query.  */
   std::vector<PenetrationAsPointPair<T>>& point_pairs;
+
+  /* The signed distance fields of the meshes that have one, if any. Aliased.
+   */
+  const MeshSignedDistanceFields* mesh_sdfs{nullptr};
+
+  /* The convex decompositions of the meshes that have one, if any. Aliased.
+   */
+  const MeshConvexDecompositions* mesh_decompositions{nullptr};
+
+  /* The witnesses carried over from the previous step, if any. If non-null,
+   contact_pair_updates must be non-null too. Aliased.  */
+  const ContactPairCache* contact_pair_cache{nullptr};
+
+  /* The witnesses recorded by this step for the next one. Aliased.  */
+  ContactPairCache::Updates* contact_pair_updates{nullptr};
+
+  /* The number of pairs whose narrowphase was skipped because their cached
+   axis still separated them.  */
+  int num_narrowphase_skipped{0};
 };
 
+/* Reports whether the shapes of the objects `a` and `b`, at their current
+ poses, are separated along the unit direction `axis_AB_W`; i.e., whether all of
+ `a` lies strictly before all of `b` along it. A `true` result proves that the
+ objects don't touch; `false` proves nothing. Objects whose extent along an axis
+ is unbounded (e.g., half spaces) are never reported as separated.  */
+bool IsSeparatedAlong(const fcl::CollisionObjectd& a,
+                      const fcl::CollisionObjectd& b,
+                      const Eigen::Vector3d& axis_AB_W);
+
 /* Callback function for FCL's collide() function for retrieving a *single*
  contact. As documented by QueryObject::ComputePointPairPenetration(), the
  result added to the output data is the same, regardless of the order of
@@ -0,0 +1,170 @@
+#include "drake/geometry/proximity/ray_cast.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace ray_cast {
+
+using Eigen::Vector3d;
+
+namespace {
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+// Returns the intersection of two intervals.
+std::optional<Interval> Intersect(const std::optional<Interval>& a,
+                                  const std::optional<Interval>& b) {
+  if (!a || !b) return std::nullopt;
+  const double t_enter = std::max(a->first, b->first);
+  const double t_exit = std::min(a->second, b->second);
+  if (t_enter > t_exit) return std::nullopt;
+  return Interval{t_enter, t_exit};
+}
+
+// Returns the smallest interval containing both intervals. For pieces of a
+// convex shape, that is their union.
+std::optional<Interval> Hull(const std::optional<Interval>& a,
+                             const std::optional<Interval>& b) {
+  if (!a) return b;
+  if (!b) return a;
+  return Interval{std::min(a->first, b->first),
+                  std::max(a->second, b->second)};
+}
+
+// Returns the interval of t for which lower ≤ p + t⋅n ≤ upper.
+std::optional<Interval> Slab(double p, double n, double lower, double upper) {
+  if (n == 0) {
+    if (p < lower || p > upper) return std::nullopt;
+    return Interval{-kInf, kInf};
+  }
+  const double t_lower = (lower - p) / n;
+  const double t_upper = (upper - p) / n;
+  return Interval{std::min(t_lower, t_upper), std::max(t_lower, t_upper)};
+}
+
+// Returns the interval of t for which a⋅t² + b⋅t + c ≤ 0, for a ≥ 0. When
+// a = 0, b must be zero as well (that's the case for the quadrics below,
+// where a = 0 only if the line is parallel to the quadric's axis).
+std::optional<Interval> Quadratic(double a, double b, double c) {
+  DRAKE_ASSERT(a >= 0);
+  if (a == 0) {
+    if (c > 0) return std::nullopt;
+    return Interval{-kInf, kInf};
+  }
+  const double discriminant = b * b - 4 * a * c;
+  if (discriminant < 0) return std::nullopt;
+  // This form avoids the cancellation in -b ± √discriminant.
+  const double q = -0.5 * (b + std::copysign(std::sqrt(discriminant), b));
+  if (q == 0) return Interval{0, 0};  // b = c = 0.
+  const double t0 = q / a;
+  const double t1 = c / q;
+  return Interval{std::min(t0, t1), std::max(t0, t1)};
+}
+
+}  // namespace
+
+std::optional<Interval> IntersectSphere(double radius, const Vector3d& p_GR,
+                                        const Vector3d& n_G) {
+  return Quadratic(n_G.squaredNorm(), 2 * p_GR.dot(n_G),
+                   p_GR.squaredNorm() - radius * radius);
+}
+
+std::optional<Interval> IntersectBox(const Vector3d& half_size,
+                                     const Vector3d& p_GR,
+                                     const Vector3d& n_G) {
+  std::optional<Interval> result = Interval{-kInf, kInf};
+  for (int i = 0; i < 3; ++i) {
+    result = Intersect(
+        result, Slab(p_GR(i), n_G(i), -half_size(i), half_size(i)));
+  }
+  return result;
+}
+
+std::optional<Interval> IntersectCylinder(double radius, double length,
+                                          const Vector3d& p_GR,
+                                          const Vector3d& n_G) {
+  const Eigen::Vector2d p_xy = p_GR.head<2>();
+  const Eigen::Vector2d n_xy = n_G.head<2>();
+  return Intersect(Quadratic(n_xy.squaredNorm(), 2 * p_xy.dot(n_xy),
+                             p_xy.squaredNorm() - radius * radius),
+                   Slab(p_GR.z(), n_G.z(), -length / 2, length / 2));
+}
+
+std::optional<Interval> IntersectCapsule(double radius, double length,
+                                         const Vector3d& p_GR,
+                                         const Vector3d& n_G) {
+  const Vector3d p_GC(0, 0, length / 2);  // The center of the top cap.
+  return Hull(IntersectCylinder(radius, length, p_GR, n_G),
+              Hull(IntersectSphere(radius, p_GR - p_GC, n_G),
+                   IntersectSphere(radius, p_GR + p_GC, n_G)));
+}
+
+std::optional<Interval> IntersectEllipsoid(const Vector3d& radii,
+                                           const Vector3d& p_GR,
+                                           const Vector3d& n_G) {
+  // Scaling the ellipsoid to the unit sphere preserves the parameters.
+  return IntersectSphere(1.0, p_GR.cwiseQuotient(radii),
+                         n_G.cwiseQuotient(radii));
+}
+
+std::optional<Interval> IntersectHalfSpace(const Vector3d& p_GR,
+                                           const Vector3d& n_G) {
+  return Slab(p_GR.z(), n_G.z(), -kInf, 0);
+}
+
+std::optional<Interval> IntersectConvex(const std::vector<Vector3d>& vertices,
+                                        int num_faces,
+                                        const std::vector<int>& faces,
+                                        const Vector3d& p_GR,
+                                        const Vector3d& n_G) {
+  DRAKE_DEMAND(num_faces > 0 && !vertices.empty());
+  Vector3d p_GCentroid = Vector3d::Zero();
+  for (const Vector3d& p_GV : vertices) p_GCentroid += p_GV;
+  p_GCentroid /= static_cast<double>(vertices.size());
+
+  // Clip the line against the half space bounded by each face's plane.
+  double t_enter = -kInf;
+  double t_exit = kInf;
+  int index = 0;
+  for (int f = 0; f < num_faces; ++f) {
+    const int num_face_vertices = faces[index];
+    const int* face = &faces[index + 1];
+    index += num_face_vertices + 1;
+    // Newell's method gives a robust normal for a planar polygon.
+    Vector3d normal = Vector3d::Zero();
+    for (int i = 0; i < num_face_vertices; ++i) {
+      normal += vertices[face[i]].cross(
+          vertices[face[(i + 1) % num_face_vertices]]);
+    }
+    if (normal.squaredNorm() == 0) continue;  // A degenerate face.
+    const Vector3d& p_GF = vertices[face[0]];
+    if (normal.dot(p_GCentroid - p_GF) > 0) normal = -normal;
+    // The points inside satisfy normal⋅(p_GR + t⋅n_G - p_GF) ≤ 0.
+    const std::optional<Interval> inside =
+        Slab(normal.dot(p_GR - p_GF), normal.dot(n_G), -kInf, 0);
+    if (!inside) return std::nullopt;
+    t_enter = std::max(t_enter, inside->first);
+    t_exit = std::min(t_exit, inside->second);
+    if (t_enter > t_exit) return std::nullopt;
+  }
+  return Interval{t_enter, t_exit};
+}
+
+std::optional<double> FirstHitDistance(const std::optional<Interval>& interval,
+                                       double max_distance) {
+  if (!interval || interval->second < 0 || interval->first > max_distance) {
+    return std::nullopt;
+  }
+  return std::max(interval->first, 0.0);
+}
+
+}  // namespace ray_cast
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace ray_cast {
+
+/* @name Ray-shape intersection
+
+ Each of these functions intersects the line R(t) = p_GR + t⋅n_G, t ∈ ℝ, with
+ a convex shape defined in its canonical frame G (as documented in
+ shape_specification.h), and returns the interval [t_enter, t_exit] of the
+ parameters of the points on the line that lie in the (closed) shape, or
+ nullopt if the line misses the shape. Unbounded shapes (the half space) can
+ report infinite end points. Because every shape is convex, the set of points
+ is a single interval.
+
+ The direction `n_G` need not be unit length; the parameters are measured in
+ multiples of its length. It must not be zero.  */
+//@{
+
+using Interval = std::pair<double, double>;
+
+std::optional<Interval> IntersectSphere(double radius,
+                                        const Eigen::Vector3d& p_GR,
+                                        const Eigen::Vector3d& n_G);
+
+/* @param half_size  Half the box's extents along Gx, Gy, and Gz.  */
+std::optional<Interval> IntersectBox(const Eigen::Vector3d& half_size,
+                                     const Eigen::Vector3d& p_GR,
+                                     const Eigen::Vector3d& n_G);
+
+std::optional<Interval> IntersectCylinder(double radius, double length,
+                                          const Eigen::Vector3d& p_GR,
+                                          const Eigen::Vector3d& n_G);
+
+std::optional<Interval> IntersectCapsule(double radius, double length,
+                                         const Eigen::Vector3d& p_GR,
+                                         const Eigen::Vector3d& n_G);
+
+/* @param radii  The ellipsoid's semi-axes along Gx, Gy, and Gz.  */
+std::optional<Interval> IntersectEllipsoid(const Eigen::Vector3d& radii,
+                                           const Eigen::Vector3d& p_GR,
+                                           const Eigen::Vector3d& n_G);
+
+/* The half space is z ≤ 0 in G.  */
+std::optional<Interval> IntersectHalfSpace(const Eigen::Vector3d& p_GR,
+                                           const Eigen::Vector3d& n_G);
+
+/* Intersects a convex polyhedron, given by its `vertices` and its `faces`
+ encoded as for fcl::Convex: for each face, the number of its vertices
+ followed by their indices. The face normals are oriented away from the
+ centroid of the vertices, so the winding of the faces doesn't matter.
+ @pre `num_faces` > 0 and the faces bound a convex region.  */
+std::optional<Interval> IntersectConvex(
+    const std::vector<Eigen::Vector3d>& vertices, int num_faces,
+    const std::vector<int>& faces, const Eigen::Vector3d& p_GR,
+    const Eigen::Vector3d& n_G);
+
+//@}
+
+/* Returns the distance along a ray with unit direction from its origin
+ (t = 0) to the first point in `interval` that is no farther than
+ `max_distance`, or nullopt if there is none. A ray whose origin lies in the
+ shape hits it at distance zero.  */
+std::optional<double> FirstHitDistance(const std::optional<Interval>& interval,
+                                       double max_distance);
+
+}  // namespace ray_cast
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -1,6 +1,9 @@
 #include "drake/geometry/proximity/bvh.h"
 
+#include <algorithm>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -352,6 +355,62 @@ TYPED_TEST(BvhTest, TestCollideEarlyExit) {
   EXPECT_EQ(count, 5);
 }
 
+// Tests that CollideBatched() reports the same candidates as Collide() (up to
+// ordering), covering the same separated and tangent configurations as
+// TestCollide as well as a deeply interpenetrating one, and that it honors
+// early termination.
+TYPED_TEST(BvhTest, TestCollideBatched) {
+  using BvType = TypeParam;
+  using BvhType = Bvh<BvType, TriangleSurfaceMesh<double>>;
+
+  auto sorted_candidates = [](const BvhType& bvh_A, const BvhType& bvh_B,
+                              const RigidTransformd& X_AB, bool batched) {
+    std::vector<std::pair<int, int>> pairs;
+    auto callback = [&pairs](int a, int b) {
+      pairs.emplace_back(a, b);
+      return BvttCallbackResult::Continue;
+    };
+    if (batched) {
+      bvh_A.CollideBatched(bvh_B, X_AB, callback);
+    } else {
+      bvh_A.Collide(bvh_B, X_AB, callback);
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+  };
+
+  const BvhType separate(MakeSphereSurfaceMesh<double>(Sphere(1.5), 3));
+  EXPECT_TRUE(sorted_candidates(this->bvh_, separate,
+                                RigidTransformd{Vector3d{4, 4, 4}}, true)
+                  .empty());
+
+  const BvhType tangent(MakeSphereSurfaceMesh<double>(Sphere(1.5), 2));
+  const BvhType fine(MakeSphereSurfaceMesh<double>(Sphere(1.25), 0.1));
+  const RigidTransformd X_tangent{Vector3d{3, 0, 0}};
+  const RigidTransformd X_overlap{
+      AngleAxisd(M_PI / 5, Vector3d{1, 2, 3}.normalized()),
+      Vector3d{0.5, -0.25, 0.125}};
+  const BvhType& coarse = this->bvh_;
+  for (const auto& [bvh_A, bvh_B, X_AB] :
+       {std::make_tuple(&coarse, &tangent, X_tangent),
+        std::make_tuple(&tangent, &coarse, X_tangent),
+        std::make_tuple(&fine, &tangent, X_overlap),
+        std::make_tuple(&tangent, &fine, X_overlap)}) {
+    const std::vector<std::pair<int, int>> expected =
+        sorted_candidates(*bvh_A, *bvh_B, X_AB, false);
+    ASSERT_FALSE(expected.empty());
+    EXPECT_EQ(sorted_candidates(*bvh_A, *bvh_B, X_AB, true), expected);
+  }
+
+  int count{0};
+  auto terminate_at_five = [&count](int, int) {
+    return ++count < 5 ? BvttCallbackResult::Continue
+                       : BvttCallbackResult::Terminate;
+  };
+  fine.CollideBatched(tangent, X_overlap, terminate_at_five);
+  EXPECT_EQ(count, 5);
+}
+
 // Confirms that we can collide bvh trees on different mesh types: surface vs.
 // volume. We construct two meshes with known intersection and confirm that
 // the BVH produces candidates which include the intersecting elements, and
@@ -652,6 +711,19 @@ GTEST_TEST(BoundingVolumeHierarchyTest, CollideDifferentBvTypes) {
 
   obb_bvh.Collide(aabb_bvh, RigidTransformd{Vector3d{100, 0, 0}}, callback);
   EXPECT_EQ(results.size(), 0);
+
+  // The batched traversal supports the same combinations.
+  aabb_bvh.CollideBatched(obb_bvh, RigidTransformd{}, callback);
+  ASSERT_GT(results.size(), 0);
+  results.clear();
+
+  obb_bvh.CollideBatched(aabb_bvh, RigidTransformd{}, callback);
+  ASSERT_GT(results.size(), 0);
+  results.clear();
+
+  obb_bvh.CollideBatched(aabb_bvh, RigidTransformd{Vector3d{100, 0, 0}},
+                         callback);
+  EXPECT_EQ(results.size(), 0);
 }
 
 // This confirms that we can execute the GetCollisionCandidates() method between
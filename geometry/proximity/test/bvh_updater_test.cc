@@ -193,6 +193,173 @@ TYPED_TEST(BvhUpdaterTest, Update) {
       (R * expected_right_bv.half_width().cast<T>()).cwiseAbs(), 2 * kEps));
 }
 
+/* Reports whether every vertex of every element in the subtree rooted at
+ `node` lies in the node's box, and every child box lies in its parent's. */
+template <typename MeshType, typename NodeType>
+bool BoxesContainMesh(const MeshType& mesh, const NodeType& node) {
+  const Vector3d lower = node.bv().lower();
+  const Vector3d upper = node.bv().upper();
+  auto contains = [&lower, &upper](const Vector3d& p) {
+    return (p.array() >= lower.array()).all() &&
+           (p.array() <= upper.array()).all();
+  };
+  if (node.is_leaf()) {
+    for (int e = 0; e < node.num_element_indices(); ++e) {
+      const auto& element = mesh.element(node.element_index(e));
+      for (int i = 0; i < MeshType::kVertexPerElement; ++i) {
+        if (!contains(convert_to_double(mesh.vertex(element.vertex(i))))) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+  for (const NodeType* child : {&node.left(), &node.right()}) {
+    if (!contains(child->bv().lower()) || !contains(child->bv().upper())) {
+      return false;
+    }
+    if (!BoxesContainMesh(mesh, *child)) return false;
+  }
+  return true;
+}
+
+/* With zero tolerance, the incremental update produces exactly the same
+ boxes as the full refit -- whether all or some of the vertices move. */
+TYPED_TEST(BvhUpdaterTest, UpdateIncrementalZeroTolerance) {
+  using MeshType = TypeParam;
+  using T = typename MeshType::ScalarType;
+
+  MeshType mesh_full = this->MakeMesh();
+  Bvh<Aabb, MeshType> bvh_full(mesh_full);
+  BvhUpdater<MeshType> updater_full(&mesh_full, &bvh_full);
+  MeshDeformer<MeshType> deformer_full(&mesh_full);
+
+  MeshType mesh_inc = this->MakeMesh();
+  Bvh<Aabb, MeshType> bvh_inc(mesh_inc);
+  BvhUpdater<MeshType> updater_inc(&mesh_inc, &bvh_inc);
+  MeshDeformer<MeshType> deformer_inc(&mesh_inc);
+
+  /* The first call fits every node (a root and two leaves). */
+  updater_inc.UpdateIncremental(0.0);
+  EXPECT_EQ(updater_inc.num_refit_nodes(), 3);
+
+  const RotationMatrix<T> R = RotationMatrix<T>::MakeZRotation(0.3);
+  VectorX<T> p_MVs(3 * mesh_full.num_vertices());
+  for (int i = 0; i < mesh_full.num_vertices(); ++i) {
+    p_MVs.segment(i * 3, 3) << R * mesh_full.vertex(i);
+  }
+  deformer_full.SetAllPositions(p_MVs);
+  updater_full.Update();
+  deformer_inc.SetAllPositions(p_MVs);
+  updater_inc.UpdateIncremental(0.0);
+  EXPECT_EQ(updater_inc.num_refit_nodes(), 3);
+  EXPECT_TRUE(bvh_inc.Equal(bvh_full));
+
+  /* Move only vertex 0 (which belongs to a single element); only its leaf
+   and the root are refit. */
+  p_MVs.segment(0, 3) += Vector3<T>(0.25, -0.5, 0.125);
+  deformer_full.SetAllPositions(p_MVs);
+  updater_full.Update();
+  deformer_inc.SetAllPositions(p_MVs);
+  updater_inc.UpdateIncremental(0.0);
+  EXPECT_EQ(updater_inc.num_refit_nodes(), 2);
+  EXPECT_TRUE(bvh_inc.Equal(bvh_full));
+
+  /* No motion, no work. */
+  updater_inc.UpdateIncremental(0.0);
+  EXPECT_EQ(updater_inc.num_refit_nodes(), 0);
+  EXPECT_EQ(updater_inc.num_rebuilds(), 0);
+}
+
+/* With a positive tolerance, motion within the tolerance doesn't refit any
+ nodes, and the padded boxes still contain the mesh. */
+TYPED_TEST(BvhUpdaterTest, UpdateIncrementalTolerance) {
+  using MeshType = TypeParam;
+  using T = typename MeshType::ScalarType;
+
+  const double dist = 3;
+  const double kTolerance = 0.1;
+  MeshType mesh = this->MakeMesh(dist);
+  Bvh<Aabb, MeshType> bvh(mesh);
+  BvhUpdater<MeshType> updater(&mesh, &bvh);
+  MeshDeformer<MeshType> deformer(&mesh);
+
+  updater.UpdateIncremental(kTolerance);
+  EXPECT_EQ(updater.num_refit_nodes(), 3);
+  /* The right leaf (see the Update test) is padded by the tolerance. */
+  const auto& right = bvh.root_node().right();
+  EXPECT_TRUE(CompareMatrices(right.bv().half_width(),
+                              Vector3d::Constant(0.5 + kTolerance), 1e-15));
+  EXPECT_TRUE(BoxesContainMesh(mesh, bvh.root_node()));
+
+  VectorX<T> p_MVs(3 * mesh.num_vertices());
+  for (int i = 0; i < mesh.num_vertices(); ++i) {
+    p_MVs.segment(i * 3, 3) << mesh.vertex(i);
+  }
+
+  /* Vertex 1 is the right element's extreme vertex in +x. Moving it within
+   the tolerance doesn't refit anything. */
+  p_MVs(3) += 0.6 * kTolerance;
+  deformer.SetAllPositions(p_MVs);
+  updater.UpdateIncremental(kTolerance);
+  EXPECT_EQ(updater.num_refit_nodes(), 0);
+  EXPECT_TRUE(BoxesContainMesh(mesh, bvh.root_node()));
+
+  /* Moving it again puts it farther than the tolerance from where it was
+   fit; its leaf and the root get refit. */
+  p_MVs(3) += 0.6 * kTolerance;
+  deformer.SetAllPositions(p_MVs);
+  updater.UpdateIncremental(kTolerance);
+  EXPECT_EQ(updater.num_refit_nodes(), 2);
+  EXPECT_TRUE(BoxesContainMesh(mesh, bvh.root_node()));
+
+  /* A change in tolerance refits everything. */
+  updater.UpdateIncremental(2 * kTolerance);
+  EXPECT_EQ(updater.num_refit_nodes(), 3);
+  EXPECT_TRUE(BoxesContainMesh(mesh, bvh.root_node()));
+
+  /* So does a full update followed by an incremental one. */
+  updater.Update();
+  updater.UpdateIncremental(2 * kTolerance);
+  EXPECT_EQ(updater.num_refit_nodes(), 3);
+}
+
+/* When the sibling overlap grows beyond the limit, the bvh is rebuilt. */
+TYPED_TEST(BvhUpdaterTest, UpdateIncrementalRebuild) {
+  using MeshType = TypeParam;
+  using T = typename MeshType::ScalarType;
+
+  const double dist = 3;
+  MeshType mesh = this->MakeMesh(dist);
+  Bvh<Aabb, MeshType> bvh(mesh);
+  BvhUpdater<MeshType> updater(&mesh, &bvh);
+  MeshDeformer<MeshType> deformer(&mesh);
+
+  const double kMaxOverlapIncrease = 0.05;
+  updater.UpdateIncremental(0.0, kMaxOverlapIncrease);
+  /* The two leaves are initially disjoint. */
+  EXPECT_EQ(updater.overlap_ratio(), 0.0);
+
+  /* Interleave the two elements by moving the left one (vertices 3, 4, 5, 7)
+   so that its box overlaps half of the right one's. */
+  VectorX<T> p_MVs(3 * mesh.num_vertices());
+  for (int i = 0; i < mesh.num_vertices(); ++i) {
+    p_MVs.segment(i * 3, 3) << mesh.vertex(i);
+  }
+  for (int i : {3, 4, 5, 7}) {
+    p_MVs(3 * i) += 2 * dist + 0.5;
+  }
+  deformer.SetAllPositions(p_MVs);
+  updater.UpdateIncremental(0.0, kMaxOverlapIncrease);
+  EXPECT_EQ(updater.num_rebuilds(), 1);
+  EXPECT_TRUE(BoxesContainMesh(mesh, bvh.root_node()));
+  EXPECT_TRUE(bvh.Equal(Bvh<Aabb, MeshType>(mesh)));
+
+  /* The rebuilt bvh becomes the new baseline; no more rebuilds. */
+  updater.UpdateIncremental(0.0, kMaxOverlapIncrease);
+  EXPECT_EQ(updater.num_rebuilds(), 1);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
@@ -489,6 +489,49 @@ TEST_F(CollisionFilterTest, Equality) {
   EXPECT_TRUE(filters1 != filters2);
 }
 
+/* The filter state is stored per internal slot; confirms that slots of removed
+ geometries are reused without inheriting stale filters, and that the state
+ survives growing past the initial capacity (including transient history). */
+TEST_F(CollisionFilterTest, ManyGeometries) {
+  CollisionFilter filters;
+  vector<GeometryId> ids;
+  for (int i = 0; i < 50; ++i) {
+    ids.push_back(GeometryId::get_new_id());
+    filters.AddGeometry(ids.back());
+  }
+  /* Filter the pairs among the even geometries. */
+  GeometrySet evens;
+  for (int i = 0; i < 50; i += 2) evens.Add(ids[i]);
+  filters.Apply(CollisionFilterDeclaration().ExcludeWithin(evens),
+                get_extract_ids_functor());
+  const FilterId transient_id = filters.ApplyTransient(
+      CollisionFilterDeclaration().ExcludeBetween(GeometrySet(ids[1]),
+                                                  GeometrySet(ids[3])),
+      get_extract_ids_functor());
+
+  /* Remove a filtered geometry, and add geometries until the capacity grows
+   (reusing the freed slot first). */
+  filters.RemoveGeometry(ids[0]);
+  EXPECT_FALSE(filters.HasGeometry(ids[0]));
+  for (int i = 0; i < 100; ++i) {
+    ids.push_back(GeometryId::get_new_id());
+    filters.AddGeometry(ids.back());
+  }
+  for (int i = 1; i < static_cast<int>(ids.size()); ++i) {
+    for (int j = 1; j < static_cast<int>(ids.size()); ++j) {
+      const bool both_even = i % 2 == 0 && j % 2 == 0 && i < 50 && j < 50;
+      const bool transient = (i == 1 && j == 3) || (i == 3 && j == 1);
+      const bool expected = i != j && !both_even && !transient;
+      ASSERT_TRUE(ExpectCanCollide(filters, ids[i], ids[j], expected));
+    }
+  }
+
+  /* Removing the transient declaration restores the pair (1, 3). */
+  EXPECT_TRUE(filters.RemoveDeclaration(transient_id));
+  EXPECT_TRUE(filters.CanCollideWith(ids[1], ids[3]));
+  EXPECT_FALSE(filters.CanCollideWith(ids[2], ids[4]));
+}
+
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
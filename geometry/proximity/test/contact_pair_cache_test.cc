@@ -0,0 +1,74 @@
+#include "drake/geometry/proximity/contact_pair_cache.h"
+
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using Pair = SortedPair<GeometryId>;
+
+GTEST_TEST(ContactPairCacheTest, Empty) {
+  const ContactPairCache cache;
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_EQ(cache.num_steps(), 0);
+  EXPECT_EQ(cache.num_skipped_in_last_step(), 0);
+  EXPECT_EQ(cache.Find(Pair(GeometryId::get_new_id(),
+                            GeometryId::get_new_id())),
+            nullptr);
+}
+
+/* Each step replaces the entries wholesale: pairs not recorded in a step are
+ dropped. */
+GTEST_TEST(ContactPairCacheTest, EndStep) {
+  const GeometryId id_1 = GeometryId::get_new_id();
+  const GeometryId id_2 = GeometryId::get_new_id();
+  const GeometryId id_3 = GeometryId::get_new_id();
+  const Pair pair_12(id_1, id_2);
+  const Pair pair_23(id_3, id_2);
+
+  ContactPairCache cache;
+  ContactPairCache::Updates updates{{pair_12, {Vector3d::UnitX(), 0}},
+                                    {pair_23, {Vector3d::UnitZ(), 2}}};
+  cache.EndStep(std::move(updates), 3);
+  EXPECT_TRUE(updates.empty());
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.num_steps(), 1);
+  EXPECT_EQ(cache.num_skipped_in_last_step(), 3);
+  ASSERT_NE(cache.Find(pair_12), nullptr);
+  EXPECT_TRUE(CompareMatrices(cache.Find(pair_12)->axis_AB_W,
+                              Vector3d::UnitX()));
+  EXPECT_EQ(cache.Find(pair_12)->num_steps_in_contact, 0);
+  // The lookup is independent of the order of the ids.
+  ASSERT_NE(cache.Find(Pair(id_2, id_3)), nullptr);
+  EXPECT_EQ(cache.Find(Pair(id_2, id_3))->num_steps_in_contact, 2);
+
+  updates = {{pair_23, {Vector3d::UnitY(), 3}}};
+  cache.EndStep(std::move(updates), 0);
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(cache.num_steps(), 2);
+  EXPECT_EQ(cache.num_skipped_in_last_step(), 0);
+  EXPECT_EQ(cache.Find(pair_12), nullptr);
+  ASSERT_NE(cache.Find(pair_23), nullptr);
+  EXPECT_TRUE(CompareMatrices(cache.Find(pair_23)->axis_AB_W,
+                              Vector3d::UnitY()));
+  EXPECT_EQ(cache.Find(pair_23)->num_steps_in_contact, 3);
+
+  // Copies are independent.
+  const ContactPairCache copy(cache);
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_EQ(cache.num_steps(), 2);
+  EXPECT_EQ(copy.size(), 1);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
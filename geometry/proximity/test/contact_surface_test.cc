@@ -306,7 +306,8 @@ GTEST_TEST(ContactSurfaceTest, ConstituentGradients) {
   }
 }
 
-// Tests copy constructor of ContactSurface.
+// Tests copy constructor of ContactSurface. The copies share the (immutable)
+// data of the original.
 GTEST_TEST(ContactSurfaceTest, TestCopy) {
   ContactSurface<double> original_tri =
       TestContactSurface<TriangleSurfaceMesh<double>>(false /*test*/);
@@ -314,10 +315,8 @@ GTEST_TEST(ContactSurfaceTest, TestCopy) {
             HydroelasticContactRepresentation::kTriangle);
 
   auto test_copy = [](const auto& source_mesh, const auto& target_mesh) {
-    // They have different addresses; it is a deep copy.
-    EXPECT_NE(&source_mesh, &target_mesh);
-    // They are structurally similar; this doesn't confirm that all the values
-    // are copied -- that should be tested by the mesh type's unit tests.
+    // They have the same address; it is a shallow copy.
+    EXPECT_EQ(&source_mesh, &target_mesh);
     EXPECT_EQ(source_mesh.num_elements(), target_mesh.num_elements());
     EXPECT_EQ(source_mesh.num_vertices(), target_mesh.num_vertices());
   };
@@ -337,6 +336,7 @@ GTEST_TEST(ContactSurfaceTest, TestCopy) {
   const Vector3d p_MC0 = original_tri.tri_mesh_W().element_centroid(f);
   EXPECT_EQ(original_tri.tri_e_MN().EvaluateCartesian(f, p_MC0),
             copy_tri.tri_e_MN().EvaluateCartesian(f, p_MC0));
+  EXPECT_EQ(&original_tri.tri_e_MN(), &copy_tri.tri_e_MN());
 
   // Repeat the test for polygon mesh representation.
   ContactSurface<double> original_poly =
@@ -367,6 +367,13 @@ GTEST_TEST(ContactSurfaceTest, TestCopy) {
   copy_poly = original_tri;
   ASSERT_EQ(copy_poly.representation(),
             HydroelasticContactRepresentation::kTriangle);
+
+  // A copy remains valid after the original is destroyed.
+  auto temporary = make_unique<ContactSurface<double>>(original_tri);
+  const ContactSurface<double> survivor(*temporary);
+  temporary.reset();
+  EXPECT_EQ(survivor.tri_e_MN().EvaluateCartesian(f, p_MC0),
+            original_tri.tri_e_MN().EvaluateCartesian(f, p_MC0));
 }
 
 // TODO(DamrongGuoy): This test should also be run with a polygon
@@ -381,13 +388,17 @@ GTEST_TEST(ContactSurfaceTest, TestEqual) {
   auto surface0 = ContactSurface<double>(surface);
   EXPECT_TRUE(surface.Equal(surface0));
 
-  // To get a "different" mesh, we'll copy the current contact surface so it's
-  // all the same and then sneak around the const access to change the mesh by
-  // reversing its winding. That will be sufficient to show mesh differences
-  // imply constact surface differences (even if all else is bit identical).
-  auto surface1 = ContactSurface<double>(surface);
-  const_cast<TriangleSurfaceMesh<double>&>(surface1.tri_mesh_W())
-      .ReverseFaceWinding();
+  // To get a "different" mesh, we'll copy the current contact surface's mesh
+  // and field so they're all the same, but reverse the mesh's winding. That
+  // will be sufficient to show mesh differences imply contact surface
+  // differences (even if all else is bit identical). (Copies of the surface
+  // itself share its mesh, so they can't differ.)
+  auto mesh1 = make_unique<TriangleSurfaceMesh<double>>(surface.tri_mesh_W());
+  mesh1->ReverseFaceWinding();
+  auto field1 = make_unique<TriangleSurfaceMeshFieldLinear<double, double>>(
+      vector<double>(surface.tri_e_MN().values()), mesh1.get());
+  auto surface1 = ContactSurface<double>(surface.id_M(), surface.id_N(),
+                                         move(mesh1), move(field1));
   EXPECT_FALSE(surface.Equal(surface1));
 
   // Equal mesh, Different pressure field.
@@ -223,6 +223,37 @@ TYPED_TEST(DeformableVolumeMeshTest, MoveAssignment) {
   EXPECT_TRUE(dut.bvh().Equal(scaled_bvh));
 }
 
+/* With non-default bvh update parameters, UpdateVertexPositions() maintains
+ the bvh incrementally. With zero tolerance it is still an exact fit; with a
+ positive tolerance the boxes are padded. The parameters survive copying. */
+TYPED_TEST(DeformableVolumeMeshTest, BvhUpdateParameters) {
+  using T = TypeParam;
+  DeformableVolumeMesh<T> dut(this->MakeBox());
+  /* A finite overlap limit selects the incremental update. */
+  dut.SetBvhUpdateParameters(0.0, 1.0);
+
+  constexpr double kScale = 0.25;
+  const VolumeMesh<T> scaled = this->MakeBox(kScale);
+  dut.UpdateVertexPositions(this->ExtractVertexPositions(scaled));
+  EXPECT_TRUE(dut.mesh().Equal(scaled));
+  EXPECT_TRUE(dut.bvh().Equal(Bvh<Aabb, VolumeMesh<T>>(scaled)));
+  EXPECT_GT(dut.bvh_updater().num_refit_nodes(), 0);
+
+  /* Without any motion, nothing gets refit. */
+  dut.UpdateVertexPositions(this->ExtractVertexPositions(scaled));
+  EXPECT_EQ(dut.bvh_updater().num_refit_nodes(), 0);
+
+  constexpr double kTolerance = 0.1;
+  dut.SetBvhUpdateParameters(kTolerance);
+  DeformableVolumeMesh<T> copy(dut);
+  copy.UpdateVertexPositions(this->ExtractVertexPositions(this->MakeBox()));
+  const Vector3<double> half_size =
+      this->box().size() / 2 + Vector3<double>::Constant(kTolerance);
+  const auto& root_bv = copy.bvh().root_node().bv();
+  EXPECT_TRUE(CompareMatrices(root_bv.lower(), -half_size, 1e-15));
+  EXPECT_TRUE(CompareMatrices(root_bv.upper(), half_size, 1e-15));
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
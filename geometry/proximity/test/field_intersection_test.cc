@@ -258,6 +258,28 @@ TEST_F(FieldIntersectionLowLevelTest, IntersectTetrahedra_NoIntersection) {
   EXPECT_EQ(polygon_M.size(), 0);
 }
 
+// The plane x = 1.8 cuts the first tetrahedron (its vertices have x = ±2),
+// but the second tetrahedron lies entirely on the negative side of it
+// (|x| <= 1.5), so there is no intersection. This is the case that is
+// rejected before any clipping.
+TEST_F(FieldIntersectionLowLevelTest, IntersectTetrahedra_SeparatedByPlane) {
+  const Plane<double> plane_M{Vector3d::UnitX(), 1.8 * Vector3d::UnitX()};
+
+  const std::vector<Vector3d> polygon_M =
+      IntersectTetrahedra(0, field0_M_.mesh(), 0, field1_N_.mesh(),
+                          RigidTransformd::Identity(), plane_M);
+  EXPECT_EQ(polygon_M.size(), 0);
+
+  // A plane that cuts both tetrahedra, on the other hand, does intersect
+  // them.
+  const Plane<double> cutting_plane_M{Vector3d::UnitX(),
+                                      0.5 * Vector3d::UnitX()};
+  const std::vector<Vector3d> cut_polygon_M =
+      IntersectTetrahedra(0, field0_M_.mesh(), 0, field1_N_.mesh(),
+                          RigidTransformd::Identity(), cutting_plane_M);
+  EXPECT_GE(cut_polygon_M.size(), 3);
+}
+
 TEST_F(FieldIntersectionLowLevelTest, IsPlaneNormalAlongPressureGradient) {
   const int first_tetrahedron_in_field0{0};
 
@@ -1,6 +1,7 @@
 #include "drake/geometry/proximity/hydroelastic_callback.h"
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -102,23 +103,25 @@ class TestScene {
     shape_B_ = MakeShape(id_B_, type_B, shape_B_type_, &data_B);
   }
 
+  // Requests a coarse level of detail, tessellated with the given resolution
+  // hint, for the geometries subsequently added.
+  void set_coarse_resolution_hint(double coarse_resolution_hint) {
+    coarse_resolution_hint_ = coarse_resolution_hint;
+  }
+
   // Adds a hydroelastic representation of the given `shape` with the given
   // compliance `type`.
   void MakeHydroelastic(GeometryId id, const HydroelasticType type,
                         const Shape& shape) {
-    switch (type) {
-      case HydroelasticType::kSoft:
-        this->hydroelastic_geometries_.MaybeAddGeometry(shape, id,
-                                                        soft_properties());
-        break;
-      case HydroelasticType::kRigid:
-        this->hydroelastic_geometries_.MaybeAddGeometry(shape, id,
-                                                        rigid_properties());
-        break;
-      case HydroelasticType::kUndefined:
-        // Note: HydroelasticType::kUndefined will not be added.
-        break;
+    // Note: HydroelasticType::kUndefined will not be added.
+    if (type == HydroelasticType::kUndefined) return;
+    ProximityProperties props = type == HydroelasticType::kSoft
+                                    ? soft_properties()
+                                    : rigid_properties();
+    if (coarse_resolution_hint_.has_value()) {
+      props.AddProperty(kHydroGroup, kCoarseRezHint, *coarse_resolution_hint_);
     }
+    this->hydroelastic_geometries_.MaybeAddGeometry(shape, id, props);
   }
 
   // Given the "description" of the shape to be added, does the work of
@@ -233,11 +236,15 @@ class TestScene {
   const RigidTransform<T>& pose_in_world(GeometryId id) const {
     return X_WGs_.at(id);
   }
+  void set_pose_in_world(GeometryId id, const RigidTransform<T>& X_WG) {
+    X_WGs_[id] = X_WG;
+  }
 
  private:
   Geometries hydroelastic_geometries_;
   CollisionFilter collision_filter_;
   unordered_map<GeometryId, RigidTransform<T>> X_WGs_;
+  std::optional<double> coarse_resolution_hint_;
   GeometryId id_A_{};
   GeometryId id_B_{};
   static constexpr double kRadius{0.25};
@@ -668,6 +675,112 @@ TYPED_TEST(MaybeCalcContactSurfaceTests, HandleSoftMeshRigidHalfspace) {
   EXPECT_TRUE(ValidateDerivatives(scene.surfaces()[0]));
 }
 
+// Confirms that the fine representations of geometries with levels of detail
+// are only built for pairs that may be in contact, and that the reported
+// contact surface is computed with the fine representations.
+TYPED_TEST(MaybeCalcContactSurfaceTests, LevelsOfDetail) {
+  using T = TypeParam;
+
+  for (const HydroelasticType type_B :
+       {HydroelasticType::kRigid, HydroelasticType::kSoft}) {
+    SCOPED_TRACE(fmt::format("Use type_B = {}.", static_cast<int>(type_B)));
+    for (const bool are_colliding : {false, true}) {
+      // Separated pairs are moved farther apart than the coarse tessellation
+      // errors, so that the coarse test can rule out contact.
+      const RigidTransform<T> X_WB_far(Vector3<T>(0, 0, -2));
+
+      TestScene<T> reference{ShapeType::kSphere, ShapeType::kSphere};
+      reference.ConfigureScene(HydroelasticType::kSoft, type_B, are_colliding);
+      if (!are_colliding) {
+        reference.set_pose_in_world(reference.id_B(), X_WB_far);
+      }
+      MaybeCalcContactSurface<T>(&reference.shape_A(), &reference.shape_B(),
+                                 &reference.data());
+
+      TestScene<T> scene{ShapeType::kSphere, ShapeType::kSphere};
+      scene.set_coarse_resolution_hint(0.5);
+      scene.ConfigureScene(HydroelasticType::kSoft, type_B, are_colliding);
+      if (!are_colliding) {
+        scene.set_pose_in_world(scene.id_B(), X_WB_far);
+      }
+      const SoftGeometry& soft_A =
+          scene.hydroelastic_geometries().soft_geometry(scene.id_A());
+      ASSERT_TRUE(soft_A.has_coarse_representation());
+      EXPECT_FALSE(soft_A.is_fine_representation_built());
+
+      CalcContactSurfaceResult result = MaybeCalcContactSurface<T>(
+          &scene.shape_A(), &scene.shape_B(), &scene.data());
+      EXPECT_EQ(result, CalcContactSurfaceResult::kCalculated);
+      EXPECT_EQ(soft_A.is_fine_representation_built(), are_colliding);
+      ASSERT_EQ(scene.surfaces().size(), reference.surfaces().size());
+      if (are_colliding) {
+        ASSERT_EQ(scene.surfaces().size(), 1u);
+        EXPECT_EQ(scene.surfaces()[0].num_faces(),
+                  reference.surfaces()[0].num_faces());
+        EXPECT_TRUE(ValidateDerivatives(scene.surfaces()[0]));
+      }
+    }
+  }
+}
+
+// Confirms that contact is reported when the fine meshes overlap by less than
+// the coarse tessellation error, i.e., when the coarse meshes alone would
+// miss it. The spheres (of radius 0.25) approach each other along a direction
+// in which the coarse octahedra only reach 0.144 from the centers while the
+// fine meshes reach beyond 0.2: at a distance of 0.4, only the fine meshes
+// overlap.
+TYPED_TEST(MaybeCalcContactSurfaceTests, LevelsOfDetailShallowContact) {
+  using T = TypeParam;
+
+  const Vector3d p_WB = -0.4 * Vector3d(1, 1, 1).normalized();
+  const RigidTransform<T> X_WB(Vector3<T>(p_WB.cast<T>()));
+
+  for (const HydroelasticType type_B :
+       {HydroelasticType::kRigid, HydroelasticType::kSoft}) {
+    SCOPED_TRACE(fmt::format("Use type_B = {}.", static_cast<int>(type_B)));
+    TestScene<T> reference{ShapeType::kSphere, ShapeType::kSphere};
+    reference.ConfigureScene(HydroelasticType::kSoft, type_B);
+    reference.set_pose_in_world(reference.id_B(), X_WB);
+    MaybeCalcContactSurface<T>(&reference.shape_A(), &reference.shape_B(),
+                               &reference.data());
+    ASSERT_EQ(reference.surfaces().size(), 1u);
+
+    TestScene<T> scene{ShapeType::kSphere, ShapeType::kSphere};
+    scene.set_coarse_resolution_hint(0.5);
+    scene.ConfigureScene(HydroelasticType::kSoft, type_B);
+    scene.set_pose_in_world(scene.id_B(), X_WB);
+    const GeometryId id_A = scene.id_A();
+    const GeometryId id_B = scene.id_B();
+    const Geometries& geometries = scene.hydroelastic_geometries();
+    const SoftGeometry& soft_A = geometries.soft_geometry(id_A);
+    ASSERT_TRUE(soft_A.has_coarse_representation());
+
+    // The coarse meshes are not in contact.
+    const RigidTransform<T>& X_WA = scene.pose_in_world(id_A);
+    const auto representation = HydroelasticContactRepresentation::kTriangle;
+    if (type_B == HydroelasticType::kRigid) {
+      EXPECT_EQ(DispatchRigidSoftCalculation(
+                    soft_A.coarse_representation(), X_WA, id_A,
+                    geometries.rigid_geometry(id_B).coarse_representation(),
+                    X_WB, id_B, representation),
+                nullptr);
+    } else {
+      EXPECT_EQ(DispatchCompliantCompliantCalculation(
+                    soft_A.coarse_representation(), X_WA, id_A,
+                    geometries.soft_geometry(id_B).coarse_representation(),
+                    X_WB, id_B, representation),
+                nullptr);
+    }
+
+    CalcContactSurfaceResult result = MaybeCalcContactSurface<T>(
+        &scene.shape_A(), &scene.shape_B(), &scene.data());
+    EXPECT_EQ(result, CalcContactSurfaceResult::kCalculated);
+    ASSERT_EQ(scene.surfaces().size(), 1u);
+    EXPECT_EQ(scene.surfaces()[0].num_faces(),
+              reference.surfaces()[0].num_faces());
+  }
+}
+
 TYPED_TEST_SUITE(StrictHydroelasticCallbackTyped, ScalarTypes);
 
 // Test infrastructure for the strict hydroelastic callback for arbitrary
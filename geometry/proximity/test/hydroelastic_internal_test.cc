@@ -1,5 +1,6 @@
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <limits>
@@ -14,6 +15,7 @@
 #include "drake/geometry/proximity/make_sphere_mesh.h"
 #include "drake/geometry/proximity/proximity_utilities.h"
 #include "drake/geometry/proximity/tessellation_strategy.h"
+#include "drake/geometry/proximity/volume_to_surface_mesh.h"
 #include "drake/geometry/proximity_properties.h"
 
 namespace drake {
@@ -43,10 +45,10 @@ GTEST_TEST(SoftMeshTest, TestCopyMoveAssignConstruct) {
     SoftMesh copy;
     copy = original;
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.pressure(), &copy.pressure());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // The immutable data is shared.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.pressure(), &copy.pressure());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
 
@@ -65,10 +67,10 @@ GTEST_TEST(SoftMeshTest, TestCopyMoveAssignConstruct) {
   {
     SoftMesh copy(original);
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.pressure(), &copy.pressure());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // The immutable data is shared.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.pressure(), &copy.pressure());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
 
@@ -138,10 +140,10 @@ GTEST_TEST(SoftGeometryTest, TestCopyMoveAssignConstruct) {
     SoftGeometry dut(SoftHalfSpace{1e+7});
     dut = original;
 
-    // Test for uniqueness. The contents have different memory addresses.
-    EXPECT_NE(&original.mesh(), &dut.mesh());
-    EXPECT_NE(&original.pressure_field(), &dut.pressure_field());
-    EXPECT_NE(&original.bvh(), &dut.bvh());
+    // The immutable data is shared.
+    EXPECT_EQ(&original.mesh(), &dut.mesh());
+    EXPECT_EQ(&original.pressure_field(), &dut.pressure_field());
+    EXPECT_EQ(&original.bvh(), &dut.bvh());
 
     EXPECT_TRUE(dut.mesh().Equal(original.mesh()));
     const auto& copy_pressure =
@@ -158,10 +160,10 @@ GTEST_TEST(SoftGeometryTest, TestCopyMoveAssignConstruct) {
   {
     SoftGeometry copy(original);
 
-    // Test for uniqueness. The contents have different memory addresses.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.pressure_field(), &copy.pressure_field());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // The immutable data is shared.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.pressure_field(), &copy.pressure_field());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     const auto& copy_pressure =
@@ -219,9 +221,9 @@ GTEST_TEST(RigidMeshTest, TestCopyMoveAssignConstruct) {
     RigidMesh copy;
     copy = original;
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // The immutable data is shared.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     EXPECT_TRUE(copy.bvh().Equal(original.bvh()));
@@ -231,9 +233,9 @@ GTEST_TEST(RigidMeshTest, TestCopyMoveAssignConstruct) {
   {
     RigidMesh copy(original);
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // The immutable data is shared.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     EXPECT_TRUE(copy.bvh().Equal(original.bvh()));
@@ -284,9 +286,9 @@ GTEST_TEST(RigidGeometryTest, TestCopyMoveAssignConstruct) {
     RigidGeometry dut(HalfSpace{});
     dut = original;
 
-    // Test for uniqueness. The contents have different memory addresses.
-    EXPECT_NE(&original.mesh(), &dut.mesh());
-    EXPECT_NE(&original.bvh(), &dut.bvh());
+    // The immutable data is shared.
+    EXPECT_EQ(&original.mesh(), &dut.mesh());
+    EXPECT_EQ(&original.bvh(), &dut.bvh());
 
     EXPECT_TRUE(dut.mesh().Equal(original.mesh()));
     EXPECT_TRUE(dut.bvh().Equal(original.bvh()));
@@ -296,9 +298,9 @@ GTEST_TEST(RigidGeometryTest, TestCopyMoveAssignConstruct) {
   {
     RigidGeometry copy(original);
 
-    // Test for uniqueness. Their contents are at different memory addresses.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // The immutable data is shared.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     EXPECT_TRUE(copy.bvh().Equal(original.bvh()));
@@ -411,6 +413,18 @@ GTEST_TEST(Hydroelastic, RemoveGeometry) {
   }
 }
 
+// Returns the smallest distance from the origin to the plane of a triangle of
+// the given surface `mesh`.
+double CalcMinFacePlaneDistance(const TriangleSurfaceMesh<double>& mesh) {
+  double min_distance = std::numeric_limits<double>::infinity();
+  for (int f = 0; f < mesh.num_triangles(); ++f) {
+    min_distance = std::min(
+        min_distance,
+        mesh.face_normal(f).dot(mesh.vertex(mesh.element(f).vertex(0))));
+  }
+  return min_distance;
+}
+
 class HydroelasticRigidGeometryTest : public ::testing::Test {
  protected:
   /* Creates a simple set of properties for generating rigid geometry. */
@@ -467,6 +481,68 @@ TEST_F(HydroelasticRigidGeometryTest, Sphere) {
   }
 }
 
+// Confirms that a coarse resolution hint produces a rigid geometry with two
+// levels of detail, whose fine level matches the representation without
+// levels of detail and is only built when first requested.
+TEST_F(HydroelasticRigidGeometryTest, SphereLevelsOfDetail) {
+  const Sphere sphere_spec(0.5);
+  ProximityProperties props = rigid_properties(0.1);
+  const std::optional<RigidGeometry> reference =
+      MakeRigidRepresentation(sphere_spec, props);
+  ASSERT_NE(reference, std::nullopt);
+  EXPECT_FALSE(reference->has_coarse_representation());
+  EXPECT_TRUE(reference->is_fine_representation_built());
+
+  props.AddProperty(kHydroGroup, kCoarseRezHint, 0.5);
+  const std::optional<RigidGeometry> sphere =
+      MakeRigidRepresentation(sphere_spec, props);
+  ASSERT_NE(sphere, std::nullopt);
+  ASSERT_FALSE(sphere->is_half_space());
+  ASSERT_TRUE(sphere->has_coarse_representation());
+  EXPECT_FALSE(sphere->is_fine_representation_built());
+
+  const RigidGeometry& coarse = sphere->coarse_representation();
+  EXPECT_FALSE(coarse.has_coarse_representation());
+  EXPECT_LT(coarse.mesh().num_triangles(), reference->mesh().num_triangles());
+  EXPECT_FALSE(sphere->is_fine_representation_built());
+
+  // The point of the sphere farthest from the coarse mesh lies at least as far
+  // from it as the sphere rises above the face plane closest to the center.
+  // The bound must cover that distance, without being as crude as the radius.
+  const double min_face_distance = CalcMinFacePlaneDistance(coarse.mesh());
+  EXPECT_GE(sphere->coarse_tessellation_error(),
+            sphere_spec.radius() - min_face_distance);
+  EXPECT_LT(sphere->coarse_tessellation_error(), sphere_spec.radius());
+
+  // Copies share the fine level of detail; building it once builds it for
+  // all of them.
+  const RigidGeometry copy(*sphere);
+  EXPECT_TRUE(sphere->mesh().Equal(reference->mesh()));
+  EXPECT_TRUE(sphere->is_fine_representation_built());
+  EXPECT_TRUE(copy.is_fine_representation_built());
+  EXPECT_EQ(&copy.mesh(), &sphere->mesh());
+  EXPECT_EQ(&copy.coarse_representation(), &coarse);
+}
+
+// Every other shape with levels of detail also gets a positive, finite bound on
+// its coarse tessellation error, smaller than the shape's extent.
+TEST_F(HydroelasticRigidGeometryTest, CoarseTessellationErrorBounds) {
+  ProximityProperties props = rigid_properties(0.1);
+  props.AddProperty(kHydroGroup, kCoarseRezHint, 1.0);
+  const Cylinder cylinder(0.5, 1.5);
+  const Capsule capsule(0.5, 1.5);
+  const Ellipsoid ellipsoid(0.5, 0.75, 1.0);
+  for (const std::optional<RigidGeometry>& geometry :
+       {MakeRigidRepresentation(cylinder, props),
+        MakeRigidRepresentation(capsule, props),
+        MakeRigidRepresentation(ellipsoid, props)}) {
+    ASSERT_NE(geometry, std::nullopt);
+    ASSERT_TRUE(geometry->has_coarse_representation());
+    EXPECT_GT(geometry->coarse_tessellation_error(), 0);
+    EXPECT_LT(geometry->coarse_tessellation_error(), 2.0);
+  }
+}
+
 // Confirm support for a rigid Box. Tests that a hydroelastic representation
 // is made, and samples the representation to look for evidence of it being the
 // *right* representation.
@@ -615,6 +691,13 @@ void TestRigidMeshType() {
     ASSERT_NE(geometry, std::nullopt);
     ASSERT_FALSE(geometry->is_half_space());
 
+    // Another representation of the same file and scale shares the mesh.
+    const std::optional<RigidGeometry> other =
+        MakeRigidRepresentation(MeshType(file, scale), props);
+    ASSERT_NE(other, std::nullopt);
+    EXPECT_EQ(&other->mesh(), &geometry->mesh());
+    EXPECT_EQ(&other->bvh(), &geometry->bvh());
+
     // We only check that the obj file was read by verifying the number of
     // vertices and triangles, which depend on the specific content of
     // the obj file.
@@ -795,8 +878,32 @@ TYPED_TEST_P(HydroelasticRigidGeometryErrorTests, BadResolutionHint) {
       -0.2, {});
 }
 
+// The coarse resolution hint is optional, but when given it must be positive
+// and no finer than the resolution hint. This applies to soft geometries as
+// well, through the same code path.
+TYPED_TEST_P(HydroelasticRigidGeometryErrorTests, BadCoarseResolutionHint) {
+  using ShapeType = TypeParam;
+  ShapeType shape_spec = make_default_shape<ShapeType>();
+  const std::string shape_name = ShapeName(shape_spec).name();
+
+  ProximityProperties props;
+  props.AddProperty(kHydroGroup, kRezHint, 0.5);
+  props.AddProperty(kHydroGroup, kCoarseRezHint, -0.2);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MakeRigidRepresentation(shape_spec, props),
+      fmt::format("Cannot create rigid {}.+'{}'.+ positive", shape_name,
+                  kCoarseRezHint));
+
+  props.UpdateProperty(kHydroGroup, kCoarseRezHint, 0.25);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MakeRigidRepresentation(shape_spec, props),
+      fmt::format("Cannot create rigid {}.+'{}'.+ must be at least as large "
+                  "as .+'{}'.+",
+                  shape_name, kCoarseRezHint, kRezHint));
+}
+
 REGISTER_TYPED_TEST_SUITE_P(HydroelasticRigidGeometryErrorTests,
-                            BadResolutionHint);
+                            BadResolutionHint, BadCoarseResolutionHint);
 typedef ::testing::Types<Sphere, Capsule, Cylinder, Ellipsoid>
     RigidErrorShapeTypes;
 INSTANTIATE_TYPED_TEST_SUITE_P(My, HydroelasticRigidGeometryErrorTests,
@@ -855,6 +962,42 @@ TEST_F(HydroelasticSoftGeometryTest, HalfSpace) {
       "SoftGeometry::bvh.* cannot be invoked .* half space");
 }
 
+// The soft counterpart of HydroelasticRigidGeometryTest.SphereLevelsOfDetail.
+TEST_F(HydroelasticSoftGeometryTest, SphereLevelsOfDetail) {
+  const Sphere sphere_spec(0.5);
+  ProximityProperties props = soft_properties(0.125);
+  const std::optional<SoftGeometry> reference =
+      MakeSoftRepresentation(sphere_spec, props);
+  ASSERT_NE(reference, std::nullopt);
+  EXPECT_FALSE(reference->has_coarse_representation());
+  EXPECT_TRUE(reference->is_fine_representation_built());
+
+  props.AddProperty(kHydroGroup, kCoarseRezHint, 0.5);
+  const std::optional<SoftGeometry> sphere =
+      MakeSoftRepresentation(sphere_spec, props);
+  ASSERT_NE(sphere, std::nullopt);
+  ASSERT_FALSE(sphere->is_half_space());
+  ASSERT_TRUE(sphere->has_coarse_representation());
+  EXPECT_FALSE(sphere->is_fine_representation_built());
+
+  const SoftGeometry& coarse = sphere->coarse_representation();
+  EXPECT_LT(coarse.mesh().num_elements(), reference->mesh().num_elements());
+  EXPECT_FALSE(sphere->is_fine_representation_built());
+
+  const double min_face_distance =
+      CalcMinFacePlaneDistance(ConvertVolumeToSurfaceMesh(coarse.mesh()));
+  EXPECT_GE(sphere->coarse_tessellation_error(),
+            sphere_spec.radius() - min_face_distance);
+  EXPECT_LT(sphere->coarse_tessellation_error(), sphere_spec.radius());
+
+  const SoftGeometry copy(*sphere);
+  EXPECT_TRUE(sphere->mesh().Equal(reference->mesh()));
+  EXPECT_TRUE(sphere->is_fine_representation_built());
+  EXPECT_TRUE(copy.is_fine_representation_built());
+  EXPECT_EQ(&copy.pressure_field(), &sphere->pressure_field());
+  EXPECT_EQ(&copy.bvh(), &sphere->bvh());
+}
+
 // Test construction of a soft sphere. Confirms that the edge length has
 // an effect (i.e., that shrinking the edge_length by at least half causes
 // a change in mesh resolution. It relies on unit tests for the unit sphere
@@ -1140,6 +1283,23 @@ TEST_F(HydroelasticSoftGeometryTest, Convex) {
     EXPECT_GE(pressure, 0);
     EXPECT_LE(pressure, E);
   }
+
+  // Another representation of the same file and scale with the same modulus
+  // shares the mesh and the pressure field.
+  std::optional<SoftGeometry> same =
+      MakeSoftRepresentation(convex_spec, properties);
+  EXPECT_EQ(&same->mesh(), &convex->mesh());
+  EXPECT_EQ(&same->pressure_field(), &convex->pressure_field());
+
+  // A different modulus shares the mesh, but not the pressure field.
+  ProximityProperties stiffer(properties);
+  stiffer.UpdateProperty(kHydroGroup, kElastic, 2 * E);
+  std::optional<SoftGeometry> other =
+      MakeSoftRepresentation(convex_spec, stiffer);
+  EXPECT_EQ(&other->mesh(), &convex->mesh());
+  EXPECT_NE(&other->pressure_field(), &convex->pressure_field());
+  EXPECT_EQ(other->pressure_field().EvaluateAtVertex(
+                expected_num_vertices - 1), 2 * E);
 }
 
 // Test suite for testing the common failure conditions for generating soft
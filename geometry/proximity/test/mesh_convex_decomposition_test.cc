@@ -0,0 +1,41 @@
+#include "drake/geometry/proximity/mesh_convex_decomposition.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+// The decomposition of the U-shaped block in extruded_u.obj is its two arms
+// and its base, each a box.
+GTEST_TEST(MeshConvexDecompositionTest, ExtrudedU) {
+  const MeshConvexDecomposition decomposition(
+      FindResourceOrThrow(
+          "drake/geometry/test/extruded_u_convex_decomposition.obj"),
+      2.0);
+  ASSERT_EQ(decomposition.num_pieces(), 3);
+  for (int i = 0; i < decomposition.num_pieces(); ++i) {
+    const fcl::Convexd& piece = *decomposition.piece(i);
+    EXPECT_EQ(piece.getVertices().size(), 8);
+    EXPECT_EQ(piece.getFaceCount(), 6);
+  }
+  // The vertices are scaled; the right arm spans x ∈ [2, 4].
+  for (const Eigen::Vector3d& p_MV : decomposition.piece(1)->getVertices()) {
+    EXPECT_TRUE(p_MV.x() == 2 || p_MV.x() == 4);
+  }
+}
+
+GTEST_TEST(MeshConvexDecompositionTest, MissingFile) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MeshConvexDecomposition("/no/such/decomposition.obj", 1.0),
+      "Error parsing file '/no/such/decomposition.obj'.*");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
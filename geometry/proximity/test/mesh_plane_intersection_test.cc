@@ -1203,6 +1203,38 @@ TEST_F(ComputeContactSurfaceTest, MeshRepresentation) {
             HydroelasticContactRepresentation::kPolygon);
 }
 
+/* ComputeContactSurface() discards the tets that lie wholly on one side of the
+ plane before slicing the others. That early classification must not discard
+ tets that merely *touch* the plane. In this case, the plane contains the face
+ shared by the two tets; as in SliceTest.NoDoubleCounting, tet 0 (the one
+ above the plane) produces the face and tet 1 produces nothing. We do this in
+ the mesh frame, where all values are perfectly represented, for both double
+ and AutoDiffXd. */
+TEST_F(ComputeContactSurfaceTest, PlaneContainingSharedFace) {
+  const VolumeMesh<double> mesh_M = TrivialVolumeMesh<double>();
+  const VolumeMeshFieldLinear<double, double> field_M{
+      vector<double>{0.25, 0.5, 0.75, 1, -1}, &mesh_M};
+  {
+    const Plane<double> plane_M{Vector3d::UnitZ(), Vector3d::Zero()};
+    const auto contact_surface = ComputeContactSurface<PolyMeshBuilder<double>>(
+        mesh_id_, field_M, plane_id_, plane_M, both_tets_,
+        RigidTransformd::Identity());
+    ASSERT_NE(contact_surface, nullptr);
+    EXPECT_EQ(contact_surface->poly_mesh_W().num_elements(), 1);
+    EXPECT_EQ(contact_surface->poly_mesh_W().num_vertices(), 3);
+  }
+  {
+    const Plane<AutoDiffXd> plane_M{Vector3<AutoDiffXd>::UnitZ(),
+                                    Vector3<AutoDiffXd>::Zero()};
+    const auto contact_surface =
+        ComputeContactSurface<PolyMeshBuilder<AutoDiffXd>>(
+            mesh_id_, field_M, plane_id_, plane_M, both_tets_,
+            RigidTransform<AutoDiffXd>::Identity());
+    ASSERT_NE(contact_surface, nullptr);
+    EXPECT_EQ(contact_surface->poly_mesh_W().num_elements(), 1);
+  }
+}
+
 /* Test of ComputeContactSurfaceFromSoftVolumeRigidHalfSpace(). This function
  has the following unique responsibilities:
 
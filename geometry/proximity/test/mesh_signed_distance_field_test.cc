@@ -0,0 +1,189 @@
+#include "drake/geometry/proximity/mesh_signed_distance_field.h"
+
+#include <fstream>
+#include <string>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/filesystem.h"
+#include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/geometry/proximity/make_box_mesh.h"
+#include "drake/math/autodiff.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+
+constexpr double kEps = 1e-12;
+
+// A 2x2x2 box, centered on the origin of its frame.
+MeshSignedDistanceField MakeBoxField(double resolution) {
+  return MeshSignedDistanceField(
+      MakeBoxSurfaceMesh<double>(Box(2, 2, 2), 2.0), resolution);
+}
+
+// Near a face (and away from the medial axes), the signed distance is linear,
+// so the interpolated field reproduces it exactly.
+GTEST_TEST(MeshSignedDistanceFieldTest, Box) {
+  const MeshSignedDistanceField field = MakeBoxField(0.05);
+  EXPECT_EQ(field.resolution(), 0.05);
+
+  Vector3d grad;
+  // Inside.
+  EXPECT_NEAR(field.CalcSignedDistance(Vector3d(0.5, 0.1, 0.2), &grad), -0.5,
+              kEps);
+  EXPECT_TRUE(CompareMatrices(grad, Vector3d::UnitX(), kEps));
+  // Outside.
+  EXPECT_NEAR(field.CalcSignedDistance(Vector3d(0.2, -1.3, -0.1), &grad), 0.3,
+              kEps);
+  EXPECT_TRUE(CompareMatrices(grad, -Vector3d::UnitY(), kEps));
+  // Outside of the grid, the field is extrapolated.
+  EXPECT_NEAR(field.CalcSignedDistance(Vector3d(0.1, 0.2, 5), &grad), 4,
+              kEps);
+  EXPECT_TRUE(CompareMatrices(grad, Vector3d::UnitZ(), kEps));
+  // The gradient is optional.
+  EXPECT_NEAR(field.CalcSignedDistance<double>(Vector3d(0, 0, 1.5), nullptr),
+              0.5, kEps);
+
+  // Only the bricks near the surface are refined.
+  EXPECT_GT(field.num_fine_bricks(), 0);
+  EXPECT_LT(field.num_fine_bricks(), field.num_bricks().prod());
+}
+
+// The derivatives of the AutoDiffXd-valued field are consistent with its
+// gradient.
+GTEST_TEST(MeshSignedDistanceFieldTest, AutoDiff) {
+  const MeshSignedDistanceField field = MakeBoxField(0.1);
+  const Vector3d p_MQ(1.23, 0.31, -0.47);
+  Vector3d grad;
+  const double phi = field.CalcSignedDistance(p_MQ, &grad);
+  Vector3<AutoDiffXd> grad_ad;
+  const Vector3<AutoDiffXd> p_MQ_ad = math::InitializeAutoDiff(p_MQ);
+  const AutoDiffXd phi_ad = field.CalcSignedDistance(p_MQ_ad, &grad_ad);
+  EXPECT_NEAR(phi_ad.value(), phi, kEps);
+  EXPECT_TRUE(CompareMatrices(phi_ad.derivatives(), grad, kEps));
+  EXPECT_TRUE(CompareMatrices(math::ExtractValue(grad_ad), grad, kEps));
+}
+
+// The sign is correct for a nonconvex mesh, including in its concavity. The
+// mesh is a U-shaped block: [-2, 2] x [-1, 1] x [-2, 0.5], with the notch
+// [-1, 1] x [-1, 1] x [-0.5, 0.5] removed.
+GTEST_TEST(MeshSignedDistanceFieldTest, NonConvex) {
+  const std::string filename =
+      FindResourceOrThrow("drake/geometry/test/extruded_u.obj");
+  const MeshSignedDistanceField field =
+      MakeMeshSignedDistanceField(filename, 1.0, 0.05);
+
+  Vector3d grad;
+  // In the notch, above its floor.
+  EXPECT_NEAR(field.CalcSignedDistance(Vector3d(0.1, 0.2, 0.1), &grad), 0.6,
+              kEps);
+  EXPECT_TRUE(CompareMatrices(grad, Vector3d::UnitZ(), kEps));
+  // Below the notch.
+  EXPECT_NEAR(field.CalcSignedDistance(Vector3d(0.1, 0.2, -0.8), &grad), -0.3,
+              kEps);
+  EXPECT_TRUE(CompareMatrices(grad, Vector3d::UnitZ(), kEps));
+  // In an arm.
+  EXPECT_NEAR(field.CalcSignedDistance(Vector3d(1.6, 0.1, -0.2), &grad), -0.4,
+              kEps);
+  EXPECT_TRUE(CompareMatrices(grad, Vector3d::UnitX(), kEps));
+}
+
+GTEST_TEST(MeshSignedDistanceFieldTest, SaveAndLoad) {
+  const MeshSignedDistanceField field = MakeBoxField(0.1);
+  const std::string filename = temp_directory() + "/box.sdf";
+  field.Save(filename, "box");
+
+  const std::optional<MeshSignedDistanceField> loaded =
+      MeshSignedDistanceField::Load(filename, "box");
+  ASSERT_TRUE(loaded.has_value());
+  EXPECT_EQ(loaded->resolution(), field.resolution());
+  EXPECT_EQ(loaded->p_MLower(), field.p_MLower());
+  EXPECT_EQ(loaded->num_bricks(), field.num_bricks());
+  EXPECT_EQ(loaded->num_fine_bricks(), field.num_fine_bricks());
+  for (const Vector3d& p_MQ :
+       {Vector3d(0.3, 0.2, 0.1), Vector3d(1.05, -0.4, 0.7),
+        Vector3d(-3, 2, 1)}) {
+    EXPECT_EQ(loaded->CalcSignedDistance<double>(p_MQ, nullptr),
+              field.CalcSignedDistance<double>(p_MQ, nullptr));
+  }
+
+  // A mismatched key or a missing file is reported as nothing loaded.
+  EXPECT_FALSE(MeshSignedDistanceField::Load(filename, "sphere").has_value());
+  EXPECT_FALSE(MeshSignedDistanceField::Load(filename + ".missing", "box")
+                   .has_value());
+
+  // Saving again replaces the file, and no temporary file is left behind.
+  MakeBoxField(0.2).Save(filename, "coarse box");
+  EXPECT_EQ(MeshSignedDistanceField::Load(filename, "coarse box")->resolution(),
+            0.2);
+  const filesystem::path directory = filesystem::path(filename).parent_path();
+  int num_files = 0;
+  for (const auto& entry : filesystem::directory_iterator(directory)) {
+    if (entry.path().filename().string().rfind("box.sdf", 0) == 0) {
+      ++num_files;
+    }
+  }
+  EXPECT_EQ(num_files, 1);
+}
+
+// MakeMeshSignedDistanceField() writes the cache file and then reuses it.
+GTEST_TEST(MeshSignedDistanceFieldTest, CacheFile) {
+  const std::string filename =
+      FindResourceOrThrow("drake/geometry/test/quad_cube.obj");
+  const std::string cache_file = temp_directory() + "/quad_cube.sdf";
+  const MeshSignedDistanceField baked =
+      MakeMeshSignedDistanceField(filename, 2.0, 0.1, cache_file);
+  EXPECT_TRUE(filesystem::exists(cache_file));
+  const MeshSignedDistanceField cached =
+      MakeMeshSignedDistanceField(filename, 2.0, 0.1, cache_file);
+  EXPECT_EQ(cached.num_fine_bricks(), baked.num_fine_bricks());
+
+  // A different resolution doesn't use (but replaces) the cached field.
+  const MeshSignedDistanceField finer =
+      MakeMeshSignedDistanceField(filename, 2.0, 0.05, cache_file);
+  EXPECT_EQ(finer.resolution(), 0.05);
+}
+
+// Editing the mesh file invalidates a field cached from its previous contents.
+GTEST_TEST(MeshSignedDistanceFieldTest, CacheFileTracksMeshEdits) {
+  const std::string filename = temp_directory() + "/cube.obj";
+  const std::string cache_file = temp_directory() + "/cube.sdf";
+  // Writes the cube of quad_cube.obj, with half width `h`. The half widths
+  // used below have different lengths, so the file's size changes.
+  auto write_cube = [&filename](const std::string& h) {
+    std::ofstream obj(filename);
+    for (const char* signs : {"+--", "+-+", "--+", "---",
+                              "++-", "+++", "-++", "-+-"}) {
+      obj << "v";
+      for (int i = 0; i < 3; ++i) {
+        obj << (signs[i] == '-' ? " -" : " ") << h;
+      }
+      obj << "\n";
+    }
+    obj << "f 1 2 3 4\nf 5 8 7 6\nf 1 5 6 2\n"
+        << "f 2 6 7 3\nf 3 7 8 4\nf 5 1 4 8\n";
+  };
+
+  write_cube("1");
+  const MeshSignedDistanceField small =
+      MakeMeshSignedDistanceField(filename, 1.0, 0.1, cache_file);
+  EXPECT_NEAR(small.CalcSignedDistance<double>(Vector3d::Zero(), nullptr),
+              -1.0, kEps);
+  write_cube("2.5");
+  const MeshSignedDistanceField large =
+      MakeMeshSignedDistanceField(filename, 1.0, 0.1, cache_file);
+  EXPECT_NEAR(large.CalcSignedDistance<double>(Vector3d::Zero(), nullptr),
+              -2.5, kEps);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -1,10 +1,15 @@
 #include "drake/geometry/proximity/obb.h"
 
+#include <algorithm>
+#include <bitset>
+#include <vector>
+
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/geometry/proximity/aabb.h"
+#include "drake/geometry/proximity/boxes_overlap.h"
 #include "drake/geometry/proximity/make_box_mesh.h"
 #include "drake/geometry/proximity/make_ellipsoid_mesh.h"
 #include "drake/geometry/proximity/make_sphere_mesh.h"
@@ -980,6 +985,85 @@ GTEST_TEST(ObbTest, TestObbOverlap) {
   }
 }
 
+// Tests the batched BoxesOverlap() against the single-pair version. We take
+// all of the boundary cases of TestObbOverlap (where the boxes are separated
+// or overlapping by a small margin along each of the 15 axes) and process
+// them in batches of every possible size; each bit must match the single-pair
+// result.
+GTEST_TEST(ObbTest, BatchedBoxesOverlap) {
+  const RigidTransformd X_GA{
+      RotationMatrixd(RollPitchYawd(2. * M_PI / 3., M_PI_4, -M_PI / 3.)),
+      Vector3d(1, 2, 3)};
+  const RigidTransformd X_HB{
+      RotationMatrixd(RollPitchYawd(M_PI_4, M_PI / 5., M_PI / 6.)),
+      Vector3d(2, 0.5, 4)};
+  const RigidTransformd X_BH = X_HB.inverse();
+  const Obb a(X_GA, Vector3d(2, 4, 3));
+  const Obb b(X_HB, Vector3d(3.5, 2, 1.5));
+
+  std::vector<RigidTransformd> X_GHs;
+  X_GHs.push_back(X_GA * X_BH);
+  for (bool expect_overlap : {false, true}) {
+    for (int axis = 0; axis < 3; ++axis) {
+      X_GHs.push_back(X_GA * CalcCornerTransform(a, b, axis, expect_overlap) *
+                      X_BH);
+      X_GHs.push_back(
+          X_GA * CalcCornerTransform(b, a, axis, expect_overlap).inverse() *
+          X_BH);
+      for (int b_axis = 0; b_axis < 3; ++b_axis) {
+        X_GHs.push_back(
+            X_GA * CalcEdgeTransform(a, b, axis, b_axis, expect_overlap) *
+            X_BH);
+      }
+    }
+  }
+
+  for (int batch_size = 1; batch_size <= kBoxesOverlapBatchSize;
+       ++batch_size) {
+    SCOPED_TRACE(fmt::format("batch_size = {}", batch_size));
+    const int num_poses = static_cast<int>(X_GHs.size());
+    for (int start = 0; start < num_poses; start += batch_size) {
+      const int end = std::min(start + batch_size, num_poses);
+      BoxPairBatch batch;
+      for (int i = start; i < end; ++i) {
+        Obb::AddToOverlapBatch(a, b, X_GHs[i], &batch);
+      }
+      ASSERT_EQ(batch.size(), end - start);
+      const std::bitset<kBoxesOverlapBatchSize> overlaps = BoxesOverlap(batch);
+      for (int i = start; i < end; ++i) {
+        EXPECT_EQ(overlaps[i - start], Obb::HasOverlap(a, b, X_GHs[i]))
+            << "pose " << i;
+      }
+      // Unused lanes never report overlap.
+      for (int k = end - start; k < kBoxesOverlapBatchSize; ++k) {
+        EXPECT_FALSE(overlaps[k]);
+      }
+    }
+  }
+
+  // Mixed bounding volume types contribute the same quantities as their
+  // HasOverlap() counterparts.
+  const Aabb aabb(Vector3d(0.5, -0.25, 1), Vector3d(1, 2, 0.5));
+  for (const RigidTransformd& X_GH : X_GHs) {
+    BoxPairBatch batch;
+    Obb::AddToOverlapBatch(a, aabb, X_GH, &batch);
+    Aabb::AddToOverlapBatch(aabb, b, X_GH, &batch);
+    Aabb::AddToOverlapBatch(aabb, aabb, X_GH, &batch);
+    const std::bitset<kBoxesOverlapBatchSize> overlaps = BoxesOverlap(batch);
+    EXPECT_EQ(overlaps[0], Obb::HasOverlap(a, aabb, X_GH));
+    EXPECT_EQ(overlaps[1], Aabb::HasOverlap(aabb, b, X_GH));
+    EXPECT_EQ(overlaps[2], Aabb::HasOverlap(aabb, aabb, X_GH));
+  }
+
+  // A batch can be reused after clearing it.
+  BoxPairBatch batch;
+  Obb::AddToOverlapBatch(a, b, X_GA * X_BH, &batch);
+  EXPECT_EQ(BoxesOverlap(batch).count(), 1);
+  batch.clear();
+  EXPECT_EQ(batch.size(), 0);
+  EXPECT_EQ(BoxesOverlap(batch).count(), 0);
+}
+
 // Tests the Obb-Aabb intersection.  We rely on TestObbOverlap to cover all the
 // subtleties of the test. This just confirms that the Aabb is accounted for
 // and reports contact. So, we'll pick a couple of arbitrary poses to trigger
@@ -530,6 +530,105 @@ TEST_F(PenetrationAsPointPairCallbackTest, UnsupportedHalfSpaceHalfSpace) {
                                   this->id_halfspace_, hs2_id);
 }
 
+// IsSeparatedAlong() compares the extents of the two shapes along the axis,
+// accounting for each object's pose.
+TEST_F(PenetrationAsPointPairCallbackTest, IsSeparatedAlong) {
+  const Vector3d x_W = Vector3d::UnitX();
+  // The box (0.1 x 0.2 x 0.3) sits 0.57 units to the +x of sphere A (radius
+  // 0.5), leaving a gap of 0.02 along x.
+  box_.setTranslation(Vector3d(0.57, 0, 0));
+  EXPECT_TRUE(IsSeparatedAlong(sphere_A_, box_, x_W));
+  EXPECT_FALSE(IsSeparatedAlong(box_, sphere_A_, x_W));
+  EXPECT_TRUE(IsSeparatedAlong(box_, sphere_A_, -x_W));
+  // Rotating the box a quarter turn about z brings its 0.2-unit side along x.
+  box_.setTransform(
+      RigidTransformd(RotationMatrixd::MakeZRotation(M_PI / 2),
+                      Vector3d(0.57, 0, 0)).GetAsIsometry3());
+  EXPECT_FALSE(IsSeparatedAlong(sphere_A_, box_, x_W));
+
+  // Capsule and cylinder: their lengths are along their z axes.
+  capsule_.setTranslation(Vector3d(0, 0, 0.5 + capsule_size_[1] / 2 +
+                                             capsule_size_[0] + 0.01));
+  EXPECT_TRUE(IsSeparatedAlong(sphere_A_, capsule_, Vector3d::UnitZ()));
+  cylinder_.setTranslation(
+      Vector3d(0, 0.5 + cylinder_size_[0] + 0.01, 0));
+  EXPECT_TRUE(IsSeparatedAlong(sphere_A_, cylinder_, Vector3d::UnitY()));
+  EXPECT_FALSE(IsSeparatedAlong(sphere_A_, cylinder_, Vector3d::UnitZ()));
+
+  // A convex hull uses its vertices.
+  auto vertices = make_shared<vector<Vector3d>>(vector<Vector3d>{
+      {0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}});
+  auto faces = make_shared<vector<int>>(
+      vector<int>{3, 0, 2, 1, 3, 0, 1, 3, 3, 0, 3, 2, 3, 1, 2, 3});
+  CollisionObjectd tet(make_shared<fcl::Convexd>(vertices, 4, faces));
+  tet.setTranslation(Vector3d(-1.6, 0, 0));
+  EXPECT_TRUE(IsSeparatedAlong(tet, sphere_A_, x_W));
+  EXPECT_FALSE(
+      IsSeparatedAlong(tet, sphere_A_, Vector3d(1, 1, 0).normalized()));
+
+  // Half spaces are unbounded; they are never separated along any axis.
+  EXPECT_FALSE(IsSeparatedAlong(sphere_A_, halfspace_, x_W));
+  EXPECT_FALSE(IsSeparatedAlong(halfspace_, sphere_A_, x_W));
+}
+
+// With a contact-pair cache, the callback records each pair's witness, and
+// skips the narrowphase of a pair that its cached axis still separates.
+TEST_F(PenetrationAsPointPairCallbackTest, ContactPairCache) {
+  std::unordered_map<GeometryId, RigidTransformd> X_WGs{
+      {id_A_, RigidTransformd::Identity()},
+      {id_B_, RigidTransformd(Vector3d(kRadius * 3, 0, 0))}};
+  sphere_B_.setTranslation(X_WGs.at(id_B_).translation());
+  const SortedPair<GeometryId> pair(id_A_, id_B_);
+  vector<PenetrationAsPointPair<double>> point_pairs;
+  ContactPairCache cache;
+  ContactPairCache::Updates updates;
+  auto run_step = [&]() {
+    point_pairs.clear();
+    CallbackData<double> data(&collision_filter_, &X_WGs, &point_pairs);
+    data.contact_pair_cache = &cache;
+    data.contact_pair_updates = &updates;
+    EXPECT_FALSE(Callback<double>(&sphere_B_, &sphere_A_, &data));
+    cache.EndStep(std::move(updates), data.num_narrowphase_skipped);
+  };
+
+  // Step 1: no witness yet; the narrowphase runs and the pair is found
+  // separated along the line between the centers.
+  run_step();
+  EXPECT_EQ(point_pairs.size(), 0u);
+  EXPECT_EQ(cache.num_skipped_in_last_step(), 0);
+  const Vector3d axis_AB_W = Vector3d::UnitX() * (id_A_ < id_B_ ? 1 : -1);
+  ASSERT_NE(cache.Find(pair), nullptr);
+  EXPECT_TRUE(CompareMatrices(cache.Find(pair)->axis_AB_W, axis_AB_W));
+
+  // Step 2: the cached axis still separates the pair.
+  run_step();
+  EXPECT_EQ(point_pairs.size(), 0u);
+  EXPECT_EQ(cache.num_skipped_in_last_step(), 1);
+  ASSERT_NE(cache.Find(pair), nullptr);
+
+  // Step 3: B moves into contact; the narrowphase runs and reports it, and
+  // the contact normal becomes the witness.
+  X_WGs.at(id_B_) = RigidTransformd(Vector3d(kRadius * 1.5, 0, 0));
+  sphere_B_.setTranslation(X_WGs.at(id_B_).translation());
+  run_step();
+  ASSERT_EQ(point_pairs.size(), 1u);
+  EXPECT_EQ(cache.num_skipped_in_last_step(), 0);
+  ASSERT_NE(cache.Find(pair), nullptr);
+  EXPECT_EQ(cache.Find(pair)->num_steps_in_contact, 1);
+  EXPECT_TRUE(CompareMatrices(cache.Find(pair)->axis_AB_W,
+                              -point_pairs[0].nhat_BA_W, kEps));
+  run_step();
+  EXPECT_EQ(cache.Find(pair)->num_steps_in_contact, 2);
+
+  // The results match the uncached query.
+  vector<PenetrationAsPointPair<double>> uncached_pairs;
+  CallbackData<double> data(&collision_filter_, &X_WGs, &uncached_pairs);
+  EXPECT_FALSE(Callback<double>(&sphere_B_, &sphere_A_, &data));
+  ASSERT_EQ(uncached_pairs.size(), 1u);
+  EXPECT_EQ(uncached_pairs[0].depth, point_pairs[0].depth);
+  EXPECT_TRUE(CompareMatrices(uncached_pairs[0].p_WCa, point_pairs[0].p_WCa));
+}
+
 }  // namespace
 }  // namespace penetration_as_point_pair
 }  // namespace internal
@@ -0,0 +1,160 @@
+#include "drake/geometry/proximity/ray_cast.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace ray_cast {
+namespace {
+
+using Eigen::Vector3d;
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+constexpr double kTol = 1e-14;
+
+// Checks that `value` is `expected`, where an infinite `expected` must match
+// exactly.
+void ExpectNear(double value, double expected) {
+  if (std::isinf(expected)) {
+    EXPECT_EQ(value, expected);
+  } else {
+    EXPECT_NEAR(value, expected, kTol);
+  }
+}
+
+// Checks that `interval` is [t_enter, t_exit].
+void ExpectInterval(const std::optional<Interval>& interval, double t_enter,
+                    double t_exit) {
+  ASSERT_TRUE(interval.has_value());
+  ExpectNear(interval->first, t_enter);
+  ExpectNear(interval->second, t_exit);
+}
+
+GTEST_TEST(RayCastTest, Sphere) {
+  // A line through the center enters and exits at distance ±r from it.
+  ExpectInterval(IntersectSphere(2, Vector3d(-5, 0, 0), Vector3d(1, 0, 0)), 3,
+                 7);
+  // The parameters are in multiples of the direction's length.
+  ExpectInterval(IntersectSphere(2, Vector3d(-5, 0, 0), Vector3d(2, 0, 0)),
+                 1.5, 3.5);
+  // A tangent line touches at a single point; an offset line misses.
+  ExpectInterval(IntersectSphere(2, Vector3d(-5, 2, 0), Vector3d(1, 0, 0)), 5,
+                 5);
+  EXPECT_FALSE(
+      IntersectSphere(2, Vector3d(-5, 2.1, 0), Vector3d(1, 0, 0)).has_value());
+}
+
+GTEST_TEST(RayCastTest, Box) {
+  const Vector3d half_size(1, 2, 3);
+  ExpectInterval(
+      IntersectBox(half_size, Vector3d(0, 0, 10), Vector3d(0, 0, -1)), 7, 13);
+  // A diagonal line through opposite corners of the xy face.
+  ExpectInterval(
+      IntersectBox(half_size, Vector3d(-2, -3, 0), Vector3d(1, 1, 0)), 1, 3);
+  // A line parallel to a face, inside and outside of its slab.
+  ExpectInterval(
+      IntersectBox(half_size, Vector3d(0.5, 0, 0), Vector3d(0, 1, 0)), -2, 2);
+  EXPECT_FALSE(
+      IntersectBox(half_size, Vector3d(1.5, 0, 0), Vector3d(0, 1, 0))
+          .has_value());
+}
+
+GTEST_TEST(RayCastTest, Cylinder) {
+  // Through the curved side, and through the caps.
+  ExpectInterval(
+      IntersectCylinder(1, 4, Vector3d(-3, 0, 1), Vector3d(1, 0, 0)), 2, 4);
+  ExpectInterval(
+      IntersectCylinder(1, 4, Vector3d(0.5, 0, 5), Vector3d(0, 0, -1)), 3, 7);
+  // Diagonally, entering through the side and exiting through a cap.
+  ExpectInterval(
+      IntersectCylinder(1, 4, Vector3d(-2, 0, 0), Vector3d(1, 0, 1)), 1, 2);
+  // Parallel to the axis, outside of the cylinder.
+  EXPECT_FALSE(IntersectCylinder(1, 4, Vector3d(1.5, 0, 0), Vector3d(0, 0, 1))
+                   .has_value());
+  // Beyond a cap.
+  EXPECT_FALSE(IntersectCylinder(1, 4, Vector3d(-3, 0, 2.5), Vector3d(1, 0, 0))
+                   .has_value());
+}
+
+GTEST_TEST(RayCastTest, Capsule) {
+  // Along the axis, the line spans the caps' poles.
+  ExpectInterval(
+      IntersectCapsule(1, 4, Vector3d(0, 0, 10), Vector3d(0, 0, -1)), 7, 13);
+  // Through the side.
+  ExpectInterval(
+      IntersectCapsule(1, 4, Vector3d(-3, 0, 1), Vector3d(1, 0, 0)), 2, 4);
+  // Through a cap only (the cylinder would miss).
+  ExpectInterval(
+      IntersectCapsule(1, 4, Vector3d(-3, 0, 2.5), Vector3d(1, 0, 0)),
+      3 - std::sqrt(0.75), 3 + std::sqrt(0.75));
+  EXPECT_FALSE(IntersectCapsule(1, 4, Vector3d(-3, 0, 3.5), Vector3d(1, 0, 0))
+                   .has_value());
+}
+
+GTEST_TEST(RayCastTest, Ellipsoid) {
+  const Vector3d radii(1, 2, 3);
+  ExpectInterval(
+      IntersectEllipsoid(radii, Vector3d(0, -5, 0), Vector3d(0, 1, 0)), 3, 7);
+  ExpectInterval(
+      IntersectEllipsoid(radii, Vector3d(0, 0, 5), Vector3d(0, 0, -1)), 2, 8);
+  EXPECT_FALSE(IntersectEllipsoid(radii, Vector3d(1.1, -5, 0),
+                                  Vector3d(0, 1, 0))
+                   .has_value());
+}
+
+GTEST_TEST(RayCastTest, HalfSpace) {
+  ExpectInterval(IntersectHalfSpace(Vector3d(0, 0, 2), Vector3d(0, 0, -1)), 2,
+                 kInf);
+  ExpectInterval(IntersectHalfSpace(Vector3d(0, 0, 2), Vector3d(0, 0, 1)),
+                 -kInf, -2);
+  ExpectInterval(IntersectHalfSpace(Vector3d(0, 0, -2), Vector3d(1, 0, 0)),
+                 -kInf, kInf);
+  EXPECT_FALSE(
+      IntersectHalfSpace(Vector3d(0, 0, 2), Vector3d(1, 0, 0)).has_value());
+}
+
+GTEST_TEST(RayCastTest, Convex) {
+  // A unit cube centered at the origin, with faces wound inconsistently.
+  const std::vector<Vector3d> vertices{
+      {-0.5, -0.5, -0.5}, {0.5, -0.5, -0.5}, {0.5, 0.5, -0.5},
+      {-0.5, 0.5, -0.5},  {-0.5, -0.5, 0.5}, {0.5, -0.5, 0.5},
+      {0.5, 0.5, 0.5},    {-0.5, 0.5, 0.5}};
+  const std::vector<int> faces{4, 0, 1, 2, 3,  // -z, wound outward.
+                               4, 4, 5, 6, 7,  // +z, wound outward.
+                               4, 0, 1, 5, 4,  // -y, wound inward.
+                               4, 3, 2, 6, 7,  // +y, wound outward.
+                               4, 0, 3, 7, 4,  // -x, wound outward.
+                               4, 1, 2, 6, 5};  // +x, wound inward.
+  ExpectInterval(IntersectConvex(vertices, 6, faces, Vector3d(0, 0, 3),
+                                 Vector3d(0, 0, -1)),
+                 2.5, 3.5);
+  ExpectInterval(IntersectConvex(vertices, 6, faces, Vector3d(-3, 0.25, 0),
+                                 Vector3d(1, 0, 0)),
+                 2.5, 3.5);
+  EXPECT_FALSE(IntersectConvex(vertices, 6, faces, Vector3d(-3, 0.75, 0),
+                               Vector3d(1, 0, 0))
+                   .has_value());
+}
+
+GTEST_TEST(RayCastTest, FirstHitDistance) {
+  EXPECT_EQ(FirstHitDistance(std::nullopt, kInf), std::nullopt);
+  // In front of the origin.
+  EXPECT_EQ(FirstHitDistance(Interval{2, 3}, kInf), 2.0);
+  EXPECT_EQ(FirstHitDistance(Interval{2, 3}, 2.0), 2.0);
+  EXPECT_EQ(FirstHitDistance(Interval{2, 3}, 1.5), std::nullopt);
+  // The origin is inside.
+  EXPECT_EQ(FirstHitDistance(Interval{-1, 3}, kInf), 0.0);
+  // Behind the origin.
+  EXPECT_EQ(FirstHitDistance(Interval{-3, -1}, kInf), std::nullopt);
+}
+
+}  // namespace
+}  // namespace ray_cast
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
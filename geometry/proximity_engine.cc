@@ -1,11 +1,17 @@
 #include "drake/geometry/proximity_engine.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iterator>
 #include <limits>
+#include <numeric>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -14,15 +20,21 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/profiler.h"
 #include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/mesh_file_cache.h"
 #include "drake/geometry/proximity/collisions_exist_callback.h"
 #include "drake/geometry/proximity/distance_to_point_callback.h"
 #include "drake/geometry/proximity/distance_to_shape_callback.h"
 #include "drake/geometry/proximity/find_collision_candidates_callback.h"
 #include "drake/geometry/proximity/hydroelastic_callback.h"
 #include "drake/geometry/proximity/hydroelastic_internal.h"
+#include "drake/geometry/proximity/mesh_convex_decomposition.h"
+#include "drake/geometry/proximity/mesh_signed_distance_field.h"
 #include "drake/geometry/proximity/obj_to_surface_mesh.h"
 #include "drake/geometry/proximity/penetration_as_point_pair_callback.h"
+#include "drake/geometry/proximity/ray_cast.h"
+#include "drake/geometry/proximity_properties.h"
 #include "drake/geometry/read_obj.h"
 #include "drake/geometry/utilities.h"
 
@@ -46,6 +58,21 @@ using symbolic::Expression;
 
 namespace {
 
+// The result of reading an OBJ file for fcl (see ReadObjFile()).
+using FclConvexData = std::tuple<std::shared_ptr<std::vector<Vector3d>>,
+                                 std::shared_ptr<std::vector<int>>, int>;
+
+// Reads the given OBJ file (without triangulation) for use by fcl::Convex.
+// The data is shared with every other ProximityEngine in this process that
+// reads the same file at the same scale.
+std::shared_ptr<const FclConvexData> ReadSharedObjFile(
+    const std::string& filename, double scale) {
+  return GetOrMakeMeshFileData<FclConvexData>(
+      "ReadObjFile", filename, scale, [&filename, scale]() {
+        return ReadObjFile(filename, scale, false /* triangulate */);
+      });
+}
+
 // Returns a copy of the given fcl collision geometry; throws an exception for
 // unsupported collision geometry types. This supplements the *missing* cloning
 // functionality in FCL. Issue has been submitted to FCL:
@@ -80,14 +107,10 @@ shared_ptr<fcl::ShapeBased> CopyShapeOrThrow(
     }
     case fcl::GEOM_CONVEX: {
       const auto& convex = dynamic_cast<const fcl::Convexd&>(geometry);
-      // TODO(DamrongGuoy): Change to the copy constructor Convex(other) when
-      //  we figure out why "Convex(const Convex& other) = default" created
-      //  link errors for Xenial Debug build.  For now we do deep copy of the
-      //  vertices and faces instead of simply copying the shared pointer.
-      return make_shared<fcl::Convexd>(
-          make_shared<const std::vector<Vector3d>>(convex.getVertices()),
-          convex.getFaceCount(),
-          make_shared<const std::vector<int>>(convex.getFaces()));
+      // The copy shares the (immutable) vertices and faces with the original,
+      // which in turn may share them with every other engine that uses the
+      // same file (see ReadSharedObjFile()).
+      return make_shared<fcl::Convexd>(convex);
     }
     case fcl::GEOM_CONE:
     case fcl::GEOM_PLANE:
@@ -193,6 +216,135 @@ bool OrderContactSurface(const ContactSurface<T>& s1,
   return s1.id_N() < s2.id_N();
 }
 
+// Returns the indices of the columns of `p_WQs`, ordered along a Morton
+// (Z-order) curve over the points' bounding box, so that consecutive indices
+// refer to nearby points.
+vector<int> SpatiallySortedOrder(const Eigen::Matrix3Xd& p_WQs) {
+  const int num_points = static_cast<int>(p_WQs.cols());
+  vector<int> order(num_points);
+  std::iota(order.begin(), order.end(), 0);
+  if (num_points < 2) return order;
+  const Vector3d lower = p_WQs.rowwise().minCoeff();
+  const Vector3d extent = p_WQs.rowwise().maxCoeff() - lower;
+  // Each coordinate is quantized to 10 bits, whose bits are interleaved.
+  constexpr int kBits = 10;
+  const double scale = ((1 << kBits) - 1) / std::max(extent.maxCoeff(), 1e-12);
+  vector<uint32_t> codes(num_points);
+  for (int i = 0; i < num_points; ++i) {
+    const Vector3d cell = (p_WQs.col(i) - lower) * scale;
+    uint32_t code = 0;
+    for (int bit = 0; bit < kBits; ++bit) {
+      for (int axis = 0; axis < 3; ++axis) {
+        const uint32_t q = static_cast<uint32_t>(cell(axis));
+        code |= ((q >> bit) & 1u) << (3 * bit + axis);
+      }
+    }
+    codes[i] = code;
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [&codes](int a, int b) { return codes[a] < codes[b]; });
+  return order;
+}
+
+// The data for CollectCandidate(): the object being queried against the
+// broadphase, and the accumulator of the geometry objects it overlaps.
+struct CandidateData {
+  const CollisionObjectd* region{};
+  vector<CollisionObjectd*>* candidates{};
+};
+
+// An fcl collision callback that records the geometry object of every pair
+// whose bounding boxes overlap.
+bool CollectCandidate(CollisionObjectd* object_A, CollisionObjectd* object_B,
+                      void* callback_data) {
+  auto& data = *static_cast<CandidateData*>(callback_data);
+  data.candidates->push_back(data.region == object_A ? object_B : object_A);
+  return false;  // Returning false tells fcl to continue to other objects.
+}
+
+// Orders fcl objects by the id of their geometry.
+bool OrderByGeometryId(const CollisionObjectd* a, const CollisionObjectd* b) {
+  return EncodedData(*a).id() < EncodedData(*b).id();
+}
+
+// Returns the distance along the ray R(t) = p_WR + t⋅n_W (with unit n_W) to
+// the first point of the given object's geometry, no farther than
+// `max_distance`, or nullopt if the ray misses it. Meshes (represented as an
+// empty fcl::Convex) are hit only through their convex decompositions, if
+// they have one.
+std::optional<double> CastRay(
+    const CollisionObjectd& object, const Vector3d& p_WR, const Vector3d& n_W,
+    double max_distance, const MeshConvexDecompositions& mesh_decompositions) {
+  const fcl::Transform3d& X_WG = object.getTransform();
+  const Vector3d p_GR = X_WG.linear().transpose() * (p_WR - X_WG.translation());
+  const Vector3d n_G = X_WG.linear().transpose() * n_W;
+  const fcl::CollisionGeometryd& geometry = *object.collisionGeometry();
+  std::optional<ray_cast::Interval> interval;
+  switch (geometry.getNodeType()) {
+    case fcl::GEOM_SPHERE: {
+      const auto& sphere = static_cast<const fcl::Sphered&>(geometry);
+      interval = ray_cast::IntersectSphere(sphere.radius, p_GR, n_G);
+      break;
+    }
+    case fcl::GEOM_BOX: {
+      const auto& box = static_cast<const fcl::Boxd&>(geometry);
+      interval = ray_cast::IntersectBox(box.side / 2, p_GR, n_G);
+      break;
+    }
+    case fcl::GEOM_CYLINDER: {
+      const auto& cylinder = static_cast<const fcl::Cylinderd&>(geometry);
+      interval = ray_cast::IntersectCylinder(cylinder.radius, cylinder.lz,
+                                             p_GR, n_G);
+      break;
+    }
+    case fcl::GEOM_CAPSULE: {
+      const auto& capsule = static_cast<const fcl::Capsuled&>(geometry);
+      interval =
+          ray_cast::IntersectCapsule(capsule.radius, capsule.lz, p_GR, n_G);
+      break;
+    }
+    case fcl::GEOM_ELLIPSOID: {
+      const auto& ellipsoid = static_cast<const fcl::Ellipsoidd&>(geometry);
+      interval = ray_cast::IntersectEllipsoid(ellipsoid.radii, p_GR, n_G);
+      break;
+    }
+    case fcl::GEOM_HALFSPACE: {
+      interval = ray_cast::IntersectHalfSpace(p_GR, n_G);
+      break;
+    }
+    case fcl::GEOM_CONVEX: {
+      const auto& convex = static_cast<const fcl::Convexd&>(geometry);
+      if (convex.getFaceCount() == 0) {
+        // The first hit of a union of convex pieces is the nearest of the
+        // pieces' first hits.
+        const auto iter = mesh_decompositions.find(EncodedData(object).id());
+        if (iter == mesh_decompositions.end()) return std::nullopt;
+        std::optional<double> distance;
+        for (int i = 0; i < iter->second->num_pieces(); ++i) {
+          const fcl::Convexd& piece = *iter->second->piece(i);
+          const std::optional<double> piece_distance =
+              ray_cast::FirstHitDistance(
+                  ray_cast::IntersectConvex(piece.getVertices(),
+                                            piece.getFaceCount(),
+                                            piece.getFaces(), p_GR, n_G),
+                  max_distance);
+          if (piece_distance && (!distance || *piece_distance < *distance)) {
+            distance = piece_distance;
+          }
+        }
+        return distance;
+      }
+      interval = ray_cast::IntersectConvex(convex.getVertices(),
+                                           convex.getFaceCount(),
+                                           convex.getFaces(), p_GR, n_G);
+      break;
+    }
+    default:
+      return std::nullopt;
+  }
+  return ray_cast::FirstHitDistance(interval, max_distance);
+}
+
 }  // namespace
 
 // The implementation class for the fcl engine. Each of these functions
@@ -205,6 +357,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   Impl(const Impl& other) : ShapeReifier(other) {
     hydroelastic_geometries_ = other.hydroelastic_geometries_;
+    mesh_sdfs_ = other.mesh_sdfs_;
+    mesh_decompositions_ = other.mesh_decompositions_;
     dynamic_tree_.clear();
     dynamic_objects_.clear();
     anchored_tree_.clear();
@@ -223,6 +377,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     BuildTreeFromReference(other.anchored_tree_, object_map, &anchored_tree_);
 
     collision_filter_ = other.collision_filter_;
+    parallelism_ = other.parallelism_;
   }
 
   // Only the copy constructor is used to facilitate copying of the parent
@@ -253,7 +408,10 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     BuildTreeFromReference(anchored_tree_, object_map, &engine->anchored_tree_);
 
     engine->hydroelastic_geometries_ = this->hydroelastic_geometries_;
+    engine->mesh_sdfs_ = this->mesh_sdfs_;
+    engine->mesh_decompositions_ = this->mesh_decompositions_;
     engine->distance_tolerance_ = this->distance_tolerance_;
+    engine->parallelism_ = this->parallelism_;
 
     return engine;
   }
@@ -272,13 +430,22 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
                 &anchored_objects_);
   }
 
+  void SuspendBroadphaseUpdates() { broadphase_updates_suspended_ = true; }
+
+  void ResumeBroadphaseUpdates() {
+    if (!broadphase_updates_suspended_) return;
+    broadphase_updates_suspended_ = false;
+    dynamic_tree_.update();
+    anchored_tree_.update();
+  }
+
   void UpdateRepresentationForNewProperties(
       const InternalGeometry& geometry,
       const ProximityProperties& new_properties) {
     const GeometryId id = geometry.id();
-    // Note: Currently, the only aspect of a geometry's representation that can
-    // be affected by its proximity properties is its hydroelastic
-    // representation.
+    // Note: Currently, the only aspects of a geometry's representation that
+    // can be affected by its proximity properties are its hydroelastic
+    // representation and its signed distance field.
     if (dynamic_objects_.count(id) == 0 && anchored_objects_.count(id) == 0) {
       throw std::logic_error(
           fmt::format("The proximity engine does not contain a geometry with "
@@ -297,6 +464,12 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     hydroelastic_geometries_.RemoveGeometry(id);
     hydroelastic_geometries_.MaybeAddGeometry(geometry.shape(), id,
                                               new_properties);
+    mesh_sdfs_.erase(id);
+    mesh_decompositions_.erase(id);
+    if (const auto* mesh = dynamic_cast<const Mesh*>(&geometry.shape())) {
+      MaybeAddMeshSdf(*mesh, id, new_properties);
+      MaybeAddMeshConvexDecomposition(*mesh, id, new_properties);
+    }
   }
 
   void RemoveGeometry(GeometryId id, bool is_dynamic) {
@@ -306,6 +479,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       RemoveGeometry(id, &anchored_tree_, &anchored_objects_);
     }
     hydroelastic_geometries_.RemoveGeometry(id);
+    mesh_sdfs_.erase(id);
+    mesh_decompositions_.erase(id);
   }
 
   int num_geometries() const {
@@ -324,24 +499,76 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   double distance_tolerance() const { return distance_tolerance_; }
 
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  Parallelism parallelism() const { return parallelism_; }
+
   // TODO(SeanCurtis-TRI): I could do things here differently a number of ways:
   //  1. I could make this move semantics (or swap semantics).
   //  2. I could simply have a method that returns a mutable reference to such
   //    a vector and the caller sets values there directly.
   void UpdateWorldPoses(
       const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) {
-    for (const auto& id_object_pair : dynamic_objects_) {
-      const GeometryId id = id_object_pair.first;
-      const RigidTransform<T>& X_WG = X_WGs.at(id);
-      // The FCL broadphase requires double-valued poses; so we use ADL to
-      // efficiently get double-valued poses out of arbitrary T-valued poses.
-      dynamic_objects_[id]->setTransform(
-          convert_to_double(X_WG).GetAsIsometry3());
-      dynamic_objects_[id]->computeAABB();
+    vector<std::pair<GeometryId, CollisionObjectd*>> objects;
+    objects.reserve(dynamic_objects_.size());
+    for (const auto& [id, object] : dynamic_objects_) {
+      objects.emplace_back(id, object.get());
     }
+    UpdateObjectPoses(X_WGs, objects);
     dynamic_tree_.update();
   }
 
+  void UpdateWorldPoses(
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      const std::unordered_set<GeometryId>& moved_ids) {
+    vector<std::pair<GeometryId, CollisionObjectd*>> objects;
+    for (GeometryId id : moved_ids) {
+      const auto iter = dynamic_objects_.find(id);
+      if (iter != dynamic_objects_.end()) {
+        objects.emplace_back(id, iter->second.get());
+      }
+    }
+    if (objects.empty()) return;
+    // Updating in a fixed order keeps the tree independent of the set's order.
+    std::sort(objects.begin(), objects.end());
+    // Reinserting a few objects into the tree is cheaper than refitting all of
+    // it, but reinserting most of them is not.
+    if (2 * objects.size() > dynamic_objects_.size()) {
+      UpdateWorldPoses(X_WGs);
+      return;
+    }
+    UpdateObjectPoses(X_WGs, objects);
+    vector<CollisionObjectd*> moved_objects;
+    moved_objects.reserve(objects.size());
+    for (const auto& id_object_pair : objects) {
+      moved_objects.push_back(id_object_pair.second);
+    }
+    dynamic_tree_.update(moved_objects);
+  }
+
+  // Sets the transforms of the given dynamic objects and recomputes their
+  // bounding boxes (but doesn't update the tree). Each object's update is
+  // independent of every other object's, so they are updated in parallel.
+  // Small sets aren't worth the threading overhead.
+  void UpdateObjectPoses(
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      const vector<std::pair<GeometryId, CollisionObjectd*>>& objects) {
+    const int num_objects = static_cast<int>(objects.size());
+    const Parallelism parallelism(
+        std::clamp(num_objects / kMinPoseUpdatesPerThread, 1,
+                   parallelism_.num_threads()));
+    StaticParallelForIndexLoop(
+        parallelism, 0, num_objects, [&](int, int i) {
+          const auto& [id, object] = objects[i];
+          const RigidTransform<T>& X_WG = X_WGs.at(id);
+          // The FCL broadphase requires double-valued poses; so we use ADL to
+          // efficiently get double-valued poses out of arbitrary T-valued
+          // poses.
+          object->setTransform(convert_to_double(X_WG).GetAsIsometry3());
+          object->computeAABB();
+        });
+  }
+
   // Implementation of ShapeReifier interface
   using ShapeReifier::ImplementGeometry;
 
@@ -353,6 +580,46 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     hydroelastic_geometries_.MaybeAddGeometry(shape, data.id, data.properties);
   }
 
+  // Bakes (or loads) the signed distance field of the given mesh if its
+  // properties request one (see AddSignedDistanceFieldProperties()). The field
+  // is shared with every other engine that uses the same mesh file, scale and
+  // resolution.
+  void MaybeAddMeshSdf(const Mesh& mesh, GeometryId id,
+                       const ProximityProperties& props) {
+    if (!props.HasProperty(kSdfGroup, kSdfResolution)) return;
+    const double resolution =
+        props.GetProperty<double>(kSdfGroup, kSdfResolution);
+    const std::string cache_file = props.GetPropertyOrDefault(
+        kSdfGroup, kSdfCacheFile, std::string());
+    const std::string& filename = mesh.filename();
+    const double scale = mesh.scale();
+    mesh_sdfs_[id] = GetOrMakeMeshFileData<MeshSignedDistanceField>(
+        fmt::format("MeshSignedDistanceField({})", resolution), filename,
+        scale, [&]() {
+          return MakeMeshSignedDistanceField(filename, scale, resolution,
+                                             cache_file);
+        });
+  }
+
+  // Reads the convex decomposition of the given mesh if its properties name
+  // one (see AddConvexDecompositionProperties()). The decomposition is shared
+  // with every other engine that uses the same decomposition file and scale.
+  void MaybeAddMeshConvexDecomposition(const Mesh& mesh, GeometryId id,
+                                       const ProximityProperties& props) {
+    if (!props.HasProperty(kConvexDecompositionGroup,
+                           kConvexDecompositionFile)) {
+      return;
+    }
+    const std::string filename = props.GetProperty<std::string>(
+        kConvexDecompositionGroup, kConvexDecompositionFile);
+    const double scale = mesh.scale();
+    mesh_decompositions_[id] =
+        GetOrMakeMeshFileData<MeshConvexDecomposition>(
+            "MeshConvexDecomposition", filename, scale, [&]() {
+              return MeshConvexDecomposition(filename, scale);
+            });
+  }
+
   void ImplementGeometry(const Sphere& sphere, void* user_data) override {
     // Note: Using `shared_ptr` because of FCL API requirements.
     auto fcl_sphere = make_shared<fcl::Sphered>(sphere.radius());
@@ -400,8 +667,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   void ImplementGeometry(const Mesh& mesh, void* user_data) override {
     // Don't bother triangulating; we're going to throw the faces out.
-    const auto [vertices, face_ptr, num_faces] =
-        ReadObjFile(mesh.filename(), mesh.scale(), false /* triangulate */);
+    const auto obj = ReadSharedObjFile(mesh.filename(), mesh.scale());
+    const auto& [vertices, face_ptr, num_faces] = *obj;
     unused(face_ptr, num_faces);
 
     // Note: the strategy here is to use an *invalid* fcl::Convex shape for the
@@ -413,23 +680,21 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     TakeShapeOwnership(fcl_convex, user_data);
     // The actual mesh is used for hydroelastic representation.
     ProcessHydroelastic(mesh, user_data);
+    const ReifyData& data = *static_cast<ReifyData*>(user_data);
+    MaybeAddMeshSdf(mesh, data.id, data.properties);
+    MaybeAddMeshConvexDecomposition(mesh, data.id, data.properties);
   }
 
   void ImplementGeometry(const Convex& convex, void* user_data) override {
     // Don't bother triangulating; Convex supports polygons.
-    const auto [vertices, faces, num_faces] =
-        ReadObjFile(convex.filename(), convex.scale(), false /* triangulate */);
+    const auto obj = ReadSharedObjFile(convex.filename(), convex.scale());
+    const auto& [vertices, faces, num_faces] = *obj;
 
     // Create fcl::Convex.
     auto fcl_convex = make_shared<fcl::Convexd>(vertices, num_faces, faces);
 
     TakeShapeOwnership(fcl_convex, user_data);
     ProcessHydroelastic(convex, user_data);
-
-    // TODO(DamrongGuoy): Per f2f with SeanCurtis-TRI, we want ProximityEngine
-    // to own vertices and face by a map from filename.  This way we won't have
-    // to read the same file again and again when we create multiple Convex
-    // objects from the same file.
   }
 
   std::vector<SignedDistancePair<T>> ComputeSignedDistancePairwiseClosestPoints(
@@ -510,6 +775,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
     point_distance::CallbackData<T> data{
         &query_point, threshold, p_WQ, &X_WGs, &distances};
+    data.mesh_sdfs = &mesh_sdfs_;
 
     // Perform query of point vs dynamic objects.
     dynamic_tree_.distance(&query_point, &data, point_distance::Callback<T>);
@@ -520,11 +786,189 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     return distances;
   }
 
+  SignedDistanceToPoints<T> ComputeSignedDistanceToPoints(
+      const Matrix3X<T>& p_WQs,
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      const double threshold) const {
+    const int num_points = static_cast<int>(p_WQs.cols());
+    Eigen::Matrix3Xd p_WQs_double(3, num_points);
+    for (int i = 0; i < num_points; ++i) {
+      p_WQs_double.col(i) = convert_to_double(Vector3<T>(p_WQs.col(i)));
+    }
+
+    // The points are grouped into tiles of nearby points; the broadphase is
+    // traversed once per tile (rather than once per point) to find the
+    // geometries that might lie within the threshold of any of its points.
+    constexpr int kPointsPerTile = 32;
+    const vector<int> order = SpatiallySortedOrder(p_WQs_double);
+    const int num_tiles = (num_points + kPointsPerTile - 1) / kPointsPerTile;
+
+    // With no threshold, every geometry is a candidate for every point.
+    vector<CollisionObjectd*> all_objects;
+    if (std::isinf(threshold)) {
+      for (const auto* objects : {&dynamic_objects_, &anchored_objects_}) {
+        for (const auto& pair : *objects) {
+          all_objects.push_back(pair.second.get());
+        }
+      }
+      std::sort(all_objects.begin(), all_objects.end(), OrderByGeometryId);
+    }
+
+    // The point distance callback only uses the query object to tell it apart
+    // from the geometry object, so one is shared by all points.
+    CollisionObjectd query_point(make_shared<fcl::Sphered>(0.0));
+
+    // Each thread accumulates its results, along with their point indices.
+    const int num_threads = parallelism_.num_threads();
+    vector<vector<SignedDistanceToPoint<T>>> distances_per_thread(num_threads);
+    vector<vector<int>> point_indices_per_thread(num_threads);
+    StaticParallelForIndexLoop(
+        parallelism_, 0, num_tiles, [&](int thread_num, int tile) {
+          const int begin = tile * kPointsPerTile;
+          const int end = std::min(begin + kPointsPerTile, num_points);
+          vector<CollisionObjectd*> tile_candidates;
+          if (!std::isinf(threshold)) {
+            // See point_distance::Callback() for why the threshold is padded.
+            const double padding =
+                std::max(threshold, std::numeric_limits<double>::epsilon());
+            Vector3d lower = p_WQs_double.col(order[begin]);
+            Vector3d upper = lower;
+            for (int j = begin + 1; j < end; ++j) {
+              lower = lower.cwiseMin(p_WQs_double.col(order[j]));
+              upper = upper.cwiseMax(p_WQs_double.col(order[j]));
+            }
+            lower.array() -= padding;
+            upper.array() += padding;
+            CollisionObjectd region(make_shared<fcl::Boxd>(upper - lower));
+            region.setTranslation((lower + upper) / 2);
+            region.computeAABB();
+            CandidateData data{&region, &tile_candidates};
+            dynamic_tree_.collide(&region, &data, CollectCandidate);
+            anchored_tree_.collide(&region, &data, CollectCandidate);
+            std::sort(tile_candidates.begin(), tile_candidates.end(),
+                      OrderByGeometryId);
+          }
+          const vector<CollisionObjectd*>& candidates =
+              std::isinf(threshold) ? all_objects : tile_candidates;
+
+          vector<SignedDistanceToPoint<T>>& distances =
+              distances_per_thread[thread_num];
+          vector<int>& point_indices = point_indices_per_thread[thread_num];
+          for (int j = begin; j < end; ++j) {
+            const int i = order[j];
+            point_distance::CallbackData<T> data{
+                &query_point, threshold, p_WQs.col(i), &X_WGs, &distances};
+            data.mesh_sdfs = &mesh_sdfs_;
+            for (CollisionObjectd* candidate : candidates) {
+              double unused_threshold{};
+              point_distance::Callback<T>(&query_point, candidate, &data,
+                                          unused_threshold);
+            }
+            point_indices.resize(distances.size(), i);
+          }
+        });
+
+    // Group the results by point index.
+    SignedDistanceToPoints<T> result;
+    result.offsets.assign(num_points + 1, 0);
+    for (const vector<int>& point_indices : point_indices_per_thread) {
+      for (int i : point_indices) ++result.offsets[i + 1];
+    }
+    std::partial_sum(result.offsets.begin(), result.offsets.end(),
+                     result.offsets.begin());
+    const int num_results = result.offsets.back();
+    result.id_G.resize(num_results);
+    result.p_GN.resize(3, num_results);
+    result.distance.resize(num_results);
+    result.grad_W.resize(3, num_results);
+    vector<int> next(result.offsets.begin(), result.offsets.end() - 1);
+    for (int t = 0; t < num_threads; ++t) {
+      const vector<SignedDistanceToPoint<T>>& distances =
+          distances_per_thread[t];
+      for (int r = 0; r < static_cast<int>(distances.size()); ++r) {
+        const int k = next[point_indices_per_thread[t][r]]++;
+        result.id_G[k] = distances[r].id_G;
+        result.p_GN.col(k) = distances[r].p_GN;
+        result.distance[k] = distances[r].distance;
+        result.grad_W.col(k) = distances[r].grad_W;
+      }
+    }
+    return result;
+  }
+
+  std::vector<RayHit> CastRays(const Eigen::Matrix3Xd& p_WRs,
+                               const Eigen::Matrix3Xd& n_Ws,
+                               double max_distance) const {
+    const int num_rays = static_cast<int>(p_WRs.cols());
+
+    // With no maximum distance, every geometry is a candidate for every ray.
+    vector<CollisionObjectd*> all_objects;
+    if (std::isinf(max_distance)) {
+      for (const auto* objects : {&dynamic_objects_, &anchored_objects_}) {
+        for (const auto& pair : *objects) {
+          all_objects.push_back(pair.second.get());
+        }
+      }
+    }
+
+    vector<RayHit> hits(num_rays);
+    StaticParallelForIndexLoop(
+        parallelism_, 0, num_rays, [&](int, int i) {
+          const Vector3d p_WR = p_WRs.col(i);
+          const Vector3d n_W = n_Ws.col(i).normalized();
+          vector<CollisionObjectd*> ray_candidates;
+          if (!std::isinf(max_distance)) {
+            // The candidates are the geometries whose bounding boxes overlap
+            // the bounding box of the ray's segment.
+            const Vector3d p_WE = p_WR + max_distance * n_W;
+            const Vector3d lower = p_WR.cwiseMin(p_WE);
+            const Vector3d upper = p_WR.cwiseMax(p_WE);
+            CollisionObjectd region(make_shared<fcl::Boxd>(upper - lower));
+            region.setTranslation((lower + upper) / 2);
+            region.computeAABB();
+            CandidateData data{&region, &ray_candidates};
+            dynamic_tree_.collide(&region, &data, CollectCandidate);
+            anchored_tree_.collide(&region, &data, CollectCandidate);
+          }
+          const vector<CollisionObjectd*>& candidates =
+              std::isinf(max_distance) ? all_objects : ray_candidates;
+
+          RayHit& hit = hits[i];
+          for (const CollisionObjectd* candidate : candidates) {
+            const std::optional<double> distance =
+                CastRay(*candidate, p_WR, n_W, max_distance,
+                        mesh_decompositions_);
+            if (!distance) continue;
+            const GeometryId id = EncodedData(*candidate).id();
+            // Ties go to the smaller id, so that the result doesn't depend on
+            // the order of the candidates.
+            if (*distance < hit.distance ||
+                (*distance == hit.distance && hit.is_hit() && id < hit.id_G)) {
+              hit.id_G = id;
+              hit.distance = *distance;
+            }
+          }
+        });
+    return hits;
+  }
+
+  // If `cache` is non-null, the query is one step of it (see
+  // ProximityEngine::ComputePointPairPenetration()).
   std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration(
-      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      ContactPairCache* cache = nullptr) const {
+    if (parallelism_.num_threads() > 1) {
+      return ComputePointPairPenetrationInParallel(X_WGs, cache);
+    }
+
     std::vector<PenetrationAsPointPair<T>> contacts;
+    ContactPairCache::Updates cache_updates;
     penetration_as_point_pair::CallbackData data{&collision_filter_, &X_WGs,
                                                  &contacts};
+    data.mesh_sdfs = &mesh_sdfs_;
+    data.mesh_decompositions = &mesh_decompositions_;
+    data.contact_pair_cache = cache;
+    data.contact_pair_updates = &cache_updates;
 
     // Perform a query of the dynamic objects against themselves.
     dynamic_tree_.collide(&data, penetration_as_point_pair::Callback<T>);
@@ -535,6 +979,49 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
                penetration_as_point_pair::Callback<T>);
 
     std::sort(contacts.begin(), contacts.end(), OrderPointPair<T>);
+    if (cache != nullptr) {
+      cache->EndStep(std::move(cache_updates), data.num_narrowphase_skipped);
+    }
+
+    return contacts;
+  }
+
+  // The parallel counterpart to ComputePointPairPenetration().
+  std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetrationInParallel(
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      ContactPairCache* cache) const {
+    const int num_threads = parallelism_.num_threads();
+    std::vector<std::vector<PenetrationAsPointPair<T>>> contacts_per_thread(
+        num_threads);
+    std::vector<ContactPairCache::Updates> cache_updates_per_thread(
+        num_threads);
+    std::vector<penetration_as_point_pair::CallbackData<T>> data_per_thread;
+    data_per_thread.reserve(num_threads);
+    for (int i = 0; i < num_threads; ++i) {
+      data_per_thread.emplace_back(&collision_filter_, &X_WGs,
+                                   &contacts_per_thread[i]);
+      data_per_thread.back().mesh_sdfs = &mesh_sdfs_;
+      data_per_thread.back().mesh_decompositions = &mesh_decompositions_;
+      // The cache is only read during the query; each thread records its
+      // witnesses separately.
+      data_per_thread.back().contact_pair_cache = cache;
+      data_per_thread.back().contact_pair_updates =
+          &cache_updates_per_thread[i];
+    }
+
+    CollideCandidates(penetration_as_point_pair::Callback<T>,
+                      &data_per_thread);
+
+    std::vector<PenetrationAsPointPair<T>> contacts =
+        Concatenate(&contacts_per_thread);
+    std::sort(contacts.begin(), contacts.end(), OrderPointPair<T>);
+    if (cache != nullptr) {
+      int num_skipped = 0;
+      for (const auto& data : data_per_thread) {
+        num_skipped += data.num_narrowphase_skipped;
+      }
+      cache->EndStep(Concatenate(&cache_updates_per_thread), num_skipped);
+    }
 
     return contacts;
   }
@@ -575,12 +1062,114 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     return data.collisions_exist;
   }
 
+  bool HasCollisionsAlongMotion(
+      const unordered_map<GeometryId, RigidTransformd>& X_WGs_start,
+      const unordered_map<GeometryId, RigidTransformd>& X_WGs_end,
+      double tolerance) {
+    if constexpr (!std::is_same_v<T, double>) {
+      throw std::logic_error(
+          "ProximityEngine::HasCollisionsAlongMotion() only supports double.");
+    } else {
+      DRAKE_THROW_UNLESS(tolerance > 0);
+
+      // For each dynamic geometry G, its start and end poses and a bound μ on
+      // the distance travelled by any of its points for t ∈ [0, 1]. With
+      // translation interpolated linearly and rotation with a constant angular
+      // rate θ (the angle between the two orientations), we have
+      // μ = ‖p₁ − p₀‖ + θ⋅r, with r the radius of a sphere centered at G's
+      // origin that bounds G.
+      struct Motion {
+        GeometryId id;
+        Vector3d p_start;
+        Vector3d p_end;
+        Eigen::Quaterniond q_start;
+        Eigen::Quaterniond q_end;
+      };
+      std::vector<Motion> motions;
+      motions.reserve(dynamic_objects_.size());
+      unordered_map<GeometryId, double> motion_bound;
+      for (const auto& [id, object] : dynamic_objects_) {
+        const RigidTransformd& X_start = X_WGs_start.at(id);
+        const RigidTransformd& X_end = X_WGs_end.at(id);
+        const fcl::CollisionGeometryd& geometry = *object->collisionGeometry();
+        const double radius =
+            geometry.aabb_center.norm() + geometry.aabb_radius;
+        const double angle =
+            Eigen::AngleAxisd(
+                (X_start.rotation().inverse() * X_end.rotation()).matrix())
+                .angle();
+        const double translation =
+            (X_end.translation() - X_start.translation()).norm();
+        const double bound = translation + (angle > 0 ? angle * radius : 0.0);
+        if (!std::isfinite(bound)) {
+          throw std::logic_error(fmt::format(
+              "ProximityEngine::HasCollisionsAlongMotion(): the motion of "
+              "geometry {} cannot be bounded; unbounded geometries such as "
+              "half spaces cannot rotate.",
+              id));
+        }
+        motion_bound[id] = bound;
+        motions.push_back({id, X_start.translation(), X_end.translation(),
+                           X_start.rotation().ToQuaternion(),
+                           X_end.rotation().ToQuaternion()});
+      }
+      auto get_bound = [&motion_bound](GeometryId id) {
+        auto iter = motion_bound.find(id);
+        return iter == motion_bound.end() ? 0.0 : iter->second;
+      };
+
+      // Conservative advancement. At time t, no pair at signed distance d with
+      // combined motion bound μ can come into contact before t + d/μ.
+      unordered_map<GeometryId, RigidTransformd> X_WGs = X_WGs_start;
+      double t = 0.0;
+      while (true) {
+        for (const Motion& motion : motions) {
+          X_WGs[motion.id] = RigidTransformd(
+              motion.q_start.slerp(t, motion.q_end),
+              (1.0 - t) * motion.p_start + t * motion.p_end);
+        }
+        UpdateWorldPoses(X_WGs);
+        const std::vector<SignedDistancePair<double>> pairs =
+            ComputeSignedDistancePairwiseClosestPoints(
+                X_WGs, std::numeric_limits<double>::infinity());
+        double dt = std::numeric_limits<double>::infinity();
+        for (const SignedDistancePair<double>& pair : pairs) {
+          if (pair.distance <= tolerance) return true;
+          const double bound = get_bound(pair.id_A) + get_bound(pair.id_B);
+          if (bound > 0) dt = std::min(dt, pair.distance / bound);
+        }
+        t += dt;
+        if (t >= 1.0) return false;
+      }
+    }
+  }
+
   template <typename T1 = T>
   typename std::enable_if_t<scalar_predicate<T1>::is_bool,
                             std::vector<ContactSurface<T>>>
   ComputeContactSurfaces(
       HydroelasticContactRepresentation representation,
-      const unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
+      const unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      std::vector<PairTiming>* timings) const {
+    if (parallelism_.num_threads() > 1 || timings != nullptr ||
+        Profiler::is_enabled()) {
+      const int num_threads = parallelism_.num_threads();
+      std::vector<vector<ContactSurface<T>>> surfaces_per_thread(num_threads);
+      std::vector<hydroelastic::CallbackData<T>> data_per_thread;
+      data_per_thread.reserve(num_threads);
+      for (int i = 0; i < num_threads; ++i) {
+        data_per_thread.emplace_back(&collision_filter_, &X_WGs,
+                                     &hydroelastic_geometries_, representation,
+                                     &surfaces_per_thread[i]);
+      }
+
+      CollideCandidates(hydroelastic::Callback<T>, &data_per_thread, timings);
+
+      vector<ContactSurface<T>> surfaces = Concatenate(&surfaces_per_thread);
+      std::sort(surfaces.begin(), surfaces.end(), OrderContactSurface<T>);
+      return surfaces;
+    }
+
     vector<ContactSurface<T>> surfaces;
     // All these quantities are aliased in the callback data.
     hydroelastic::CallbackData<T> data{&collision_filter_, &X_WGs,
@@ -605,10 +1194,37 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       HydroelasticContactRepresentation representation,
       const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
       std::vector<ContactSurface<T>>* surfaces,
-      std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
+      std::vector<PenetrationAsPointPair<T>>* point_pairs,
+      std::vector<PairTiming>* timings) const {
     DRAKE_DEMAND(surfaces != nullptr);
     DRAKE_DEMAND(point_pairs != nullptr);
 
+    if (parallelism_.num_threads() > 1 || timings != nullptr ||
+        Profiler::is_enabled()) {
+      const int num_threads = parallelism_.num_threads();
+      std::vector<vector<ContactSurface<T>>> surfaces_per_thread(num_threads);
+      std::vector<vector<PenetrationAsPointPair<T>>> point_pairs_per_thread(
+          num_threads);
+      std::vector<hydroelastic::CallbackWithFallbackData<T>> data_per_thread;
+      data_per_thread.reserve(num_threads);
+      for (int i = 0; i < num_threads; ++i) {
+        data_per_thread.push_back(hydroelastic::CallbackWithFallbackData<T>{
+            hydroelastic::CallbackData<T>{
+                &collision_filter_, &X_WGs, &hydroelastic_geometries_,
+                representation, &surfaces_per_thread[i]},
+            &point_pairs_per_thread[i]});
+      }
+
+      CollideCandidates(hydroelastic::CallbackWithFallback<T>,
+                        &data_per_thread, timings);
+
+      *surfaces = Concatenate(&surfaces_per_thread);
+      *point_pairs = Concatenate(&point_pairs_per_thread);
+      std::sort(surfaces->begin(), surfaces->end(), OrderContactSurface<T>);
+      std::sort(point_pairs->begin(), point_pairs->end(), OrderPointPair<T>);
+      return;
+    }
+
     // All these quantities are aliased in the callback data.
     hydroelastic::CallbackWithFallbackData<T> data{
         hydroelastic::CallbackData<T>{&collision_filter_, &X_WGs,
@@ -725,12 +1341,83 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     encoding.write_to(data.fcl_object.get());
 
     tree->registerObject(data.fcl_object.get());
-    tree->update();
+    if (!broadphase_updates_suspended_) tree->update();
     (*objects)[id] = std::move(data.fcl_object);
 
     collision_filter_.AddGeometry(id);
   }
 
+  // Invokes the fcl-style `callback` on every unfiltered candidate pair
+  // reported by the broadphase. The pairs are statically distributed across
+  // parallelism_ threads; an invocation on thread `i` is given
+  // `&(*data_per_thread)[i]` as its callback data. If `timings` is non-null,
+  // it is overwritten with the wall-clock duration of each invocation, ordered
+  // by geometry id pair. When the Profiler is enabled, each invocation is also
+  // timed as a scope labeled with the pair's geometry ids.
+  // @pre data_per_thread->size() == parallelism_.num_threads().
+  template <typename CallbackFunction, typename CallbackData>
+  void CollideCandidates(CallbackFunction callback,
+                         std::vector<CallbackData>* data_per_thread,
+                         std::vector<PairTiming>* timings = nullptr) const {
+    using Clock = std::chrono::steady_clock;
+    DRAKE_DEMAND(static_cast<int>(data_per_thread->size()) ==
+                 parallelism_.num_threads());
+    const std::vector<SortedPair<GeometryId>> candidates =
+        FindCollisionCandidates();
+    // Each pair's timing is written to its own slot, so no synchronization is
+    // needed; the candidates are already sorted.
+    if (timings != nullptr) {
+      timings->resize(candidates.size());
+    }
+
+    StaticParallelForIndexLoop(
+        parallelism_, 0, static_cast<int>(candidates.size()),
+        [&](int thread_num, int i) {
+          const SortedPair<GeometryId>& pair = candidates[i];
+          const Clock::time_point start = Clock::now();
+          {
+            ScopedProfileTimer pair_timer([&pair]() {
+              return fmt::format("ProximityEngine candidate pair ({}, {})",
+                                 pair.first().get_value(),
+                                 pair.second().get_value());
+            });
+            // FCL's callback signature requires non-const objects; the
+            // callbacks do not modify them.
+            callback(&FindCollisionObject(pair.first()),
+                     &FindCollisionObject(pair.second()),
+                     &(*data_per_thread)[thread_num]);
+          }
+          if (timings != nullptr) {
+            (*timings)[i] = PairTiming{
+                pair, std::chrono::duration<double>(Clock::now() - start)
+                          .count()};
+          }
+        });
+  }
+
+  // Moves the per-thread results into a single vector (in thread order).
+  template <typename Result>
+  static std::vector<Result> Concatenate(
+      std::vector<std::vector<Result>>* results_per_thread) {
+    std::vector<Result> results;
+    for (auto& thread_results : *results_per_thread) {
+      std::move(thread_results.begin(), thread_results.end(),
+                std::back_inserter(results));
+    }
+    return results;
+  }
+
+  // Returns the collision object (dynamic or anchored) for the given id.
+  // @pre The id has been registered with this engine.
+  CollisionObjectd& FindCollisionObject(GeometryId id) const {
+    auto iter = dynamic_objects_.find(id);
+    if (iter == dynamic_objects_.end()) {
+      iter = anchored_objects_.find(id);
+      DRAKE_DEMAND(iter != anchored_objects_.end());
+    }
+    return *iter->second;
+  }
+
   // Removes the geometry with the given id from the given tree.
   void RemoveGeometry(
       GeometryId id, fcl::DynamicAABBTreeCollisionManager<double>* tree,
@@ -775,6 +1462,10 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // All of the *anchored* collision elements (spanning *all* sources).
   unordered_map<GeometryId, unique_ptr<CollisionObjectd>> anchored_objects_;
 
+  // While true, AddGeometry() leaves the trees un-refitted; see
+  // SuspendBroadphaseUpdates().
+  bool broadphase_updates_suspended_{false};
+
   // The mechanism for dictating collision filtering.
   CollisionFilter collision_filter_;
 
@@ -782,9 +1473,25 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // @see ProximityEngine::set_distance_tolerance() for more details.
   double distance_tolerance_{1E-6};
 
+  // The minimum number of dynamic objects per thread for which
+  // UpdateObjectPoses() bothers to update the objects in parallel.
+  static constexpr int kMinPoseUpdatesPerThread = 128;
+
+  // The degree of parallelism for queries that support it.
+  // @see ProximityEngine::set_parallelism() for more details.
+  Parallelism parallelism_;
+
   // All of the hydroelastic representations of supported geometries -- this
   // can get quite large based on mesh resolution.
   hydroelastic::Geometries hydroelastic_geometries_;
+
+  // The signed distance fields of the meshes whose properties request one.
+  // They are immutable and shared among copies of this engine.
+  MeshSignedDistanceFields mesh_sdfs_;
+
+  // The convex decompositions of the meshes whose properties name one. They
+  // are immutable and shared among copies of this engine.
+  MeshConvexDecompositions mesh_decompositions_;
 };
 
 template <typename T>
@@ -843,6 +1550,16 @@ void ProximityEngine<T>::AddAnchoredGeometry(
   impl_->AddAnchoredGeometry(shape, X_WG, id, props);
 }
 
+template <typename T>
+void ProximityEngine<T>::SuspendBroadphaseUpdates() {
+  impl_->SuspendBroadphaseUpdates();
+}
+
+template <typename T>
+void ProximityEngine<T>::ResumeBroadphaseUpdates() {
+  impl_->ResumeBroadphaseUpdates();
+}
+
 template <typename T>
 void ProximityEngine<T>::UpdateRepresentationForNewProperties(
     const InternalGeometry& geometry,
@@ -880,6 +1597,16 @@ double ProximityEngine<T>::distance_tolerance() const {
   return impl_->distance_tolerance();
 }
 
+template <typename T>
+void ProximityEngine<T>::set_parallelism(Parallelism parallelism) {
+  impl_->set_parallelism(parallelism);
+}
+
+template <typename T>
+Parallelism ProximityEngine<T>::parallelism() const {
+  return impl_->parallelism();
+}
+
 template <typename T>
 template <typename U>
 std::unique_ptr<ProximityEngine<U>> ProximityEngine<T>::ToScalarType() const {
@@ -895,14 +1622,25 @@ CollisionFilter& ProximityEngine<T>::collision_filter() {
 template <typename T>
 void ProximityEngine<T>::UpdateWorldPoses(
     const unordered_map<GeometryId, RigidTransform<T>>& X_WGs) {
+  ScopedProfileTimer timer("ProximityEngine::UpdateWorldPoses");
   impl_->UpdateWorldPoses(X_WGs);
 }
 
+template <typename T>
+void ProximityEngine<T>::UpdateWorldPoses(
+    const unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    const std::unordered_set<GeometryId>& moved_ids) {
+  ScopedProfileTimer timer("ProximityEngine::UpdateWorldPoses");
+  impl_->UpdateWorldPoses(X_WGs, moved_ids);
+}
+
 template <typename T>
 std::vector<SignedDistancePair<T>>
 ProximityEngine<T>::ComputeSignedDistancePairwiseClosestPoints(
     const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
     const double max_distance) const {
+  ScopedProfileTimer timer(
+      "ProximityEngine::ComputeSignedDistancePairwiseClosestPoints");
   return impl_->ComputeSignedDistancePairwiseClosestPoints(X_WGs, max_distance);
 }
 
@@ -912,6 +1650,8 @@ ProximityEngine<T>::ComputeSignedDistancePairClosestPoints(
     GeometryId id_A, GeometryId id_B,
     const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
     const {
+  ScopedProfileTimer timer(
+      "ProximityEngine::ComputeSignedDistancePairClosestPoints");
   return impl_->ComputeSignedDistancePairClosestPoints(id_A, id_B, X_WGs);
 }
 
@@ -921,30 +1661,74 @@ ProximityEngine<T>::ComputeSignedDistanceToPoint(
     const Vector3<T>& query,
     const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
     const double threshold) const {
+  ScopedProfileTimer timer("ProximityEngine::ComputeSignedDistanceToPoint");
   return impl_->ComputeSignedDistanceToPoint(query, X_WGs, threshold);
 }
 
+template <typename T>
+SignedDistanceToPoints<T> ProximityEngine<T>::ComputeSignedDistanceToPoints(
+    const Matrix3X<T>& p_WQs,
+    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    const double threshold) const {
+  ScopedProfileTimer timer("ProximityEngine::ComputeSignedDistanceToPoints");
+  return impl_->ComputeSignedDistanceToPoints(p_WQs, X_WGs, threshold);
+}
+
+template <typename T>
+std::vector<RayHit> ProximityEngine<T>::CastRays(
+    const Eigen::Matrix3Xd& p_WRs, const Eigen::Matrix3Xd& n_Ws,
+    double max_distance) const {
+  DRAKE_THROW_UNLESS(p_WRs.cols() == n_Ws.cols());
+  DRAKE_THROW_UNLESS((n_Ws.colwise().squaredNorm().array() > 0).all());
+  DRAKE_THROW_UNLESS(max_distance >= 0);
+  ScopedProfileTimer timer("ProximityEngine::CastRays");
+  return impl_->CastRays(p_WRs, n_Ws, max_distance);
+}
+
 template <typename T>
 bool ProximityEngine<T>::HasCollisions() const {
+  ScopedProfileTimer timer("ProximityEngine::HasCollisions");
   return impl_->HasCollisions();
 }
 
+template <typename T>
+bool ProximityEngine<T>::HasCollisionsAlongMotion(
+    const std::unordered_map<GeometryId, RigidTransformd>& X_WGs_start,
+    const std::unordered_map<GeometryId, RigidTransformd>& X_WGs_end,
+    double tolerance) {
+  ScopedProfileTimer timer("ProximityEngine::HasCollisionsAlongMotion");
+  return impl_->HasCollisionsAlongMotion(X_WGs_start, X_WGs_end, tolerance);
+}
+
 template <typename T>
 std::vector<PenetrationAsPointPair<T>>
 ProximityEngine<T>::ComputePointPairPenetration(
     const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
     const {
+  ScopedProfileTimer timer("ProximityEngine::ComputePointPairPenetration");
   return impl_->ComputePointPairPenetration(X_WGs);
 }
 
+template <typename T>
+std::vector<PenetrationAsPointPair<T>>
+ProximityEngine<T>::ComputePointPairPenetration(
+    const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+    ContactPairCache* cache) const {
+  DRAKE_THROW_UNLESS(cache != nullptr);
+  ScopedProfileTimer timer("ProximityEngine::ComputePointPairPenetration");
+  return impl_->ComputePointPairPenetration(X_WGs, cache);
+}
+
 template <typename T>
 template <typename T1>
 typename std::enable_if_t<scalar_predicate<T1>::is_bool,
                           std::vector<ContactSurface<T>>>
 ProximityEngine<T>::ComputeContactSurfaces(
     HydroelasticContactRepresentation representation,
-    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
-  return impl_->ComputeContactSurfaces(representation, X_WGs);
+    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    std::vector<PairTiming>* timings) const {
+  ScopedProfileTimer timer("ProximityEngine::ComputeContactSurfaces");
+  return impl_->ComputeContactSurfaces(representation, X_WGs, timings);
 }
 
 template <typename T>
@@ -954,14 +1738,18 @@ ProximityEngine<T>::ComputeContactSurfacesWithFallback(
     HydroelasticContactRepresentation representation,
     const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
     std::vector<ContactSurface<T>>* surfaces,
-    std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
-  return impl_->ComputeContactSurfacesWithFallback(representation, X_WGs,
-                                                   surfaces, point_pairs);
+    std::vector<PenetrationAsPointPair<T>>* point_pairs,
+    std::vector<PairTiming>* timings) const {
+  ScopedProfileTimer timer(
+      "ProximityEngine::ComputeContactSurfacesWithFallback");
+  return impl_->ComputeContactSurfacesWithFallback(
+      representation, X_WGs, surfaces, point_pairs, timings);
 }
 
 template <typename T>
 std::vector<SortedPair<GeometryId>>
 ProximityEngine<T>::FindCollisionCandidates() const {
+  ScopedProfileTimer timer("ProximityEngine::FindCollisionCandidates");
   return impl_->FindCollisionCandidates();
 }
 
@@ -8,14 +8,17 @@
 #include <vector>
 
 #include "drake/common/autodiff.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/sorted_pair.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_roles.h"
 #include "drake/geometry/internal_geometry.h"
 #include "drake/geometry/proximity/collision_filter.h"
+#include "drake/geometry/proximity/contact_pair_cache.h"
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 #include "drake/geometry/query_results/contact_surface.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
+#include "drake/geometry/query_results/ray_hit.h"
 #include "drake/geometry/query_results/signed_distance_pair.h"
 #include "drake/geometry/query_results/signed_distance_to_point.h"
 #include "drake/geometry/shape_specification.h"
@@ -28,6 +31,18 @@ template <typename T> class GeometryState;
 
 namespace internal {
 
+/* The wall-clock time spent in the narrowphase of a proximity query for a
+ single candidate geometry pair. It is a profiling aid for identifying the
+ expensive geometries in a scene; see, e.g.,
+ ProximityEngine::ComputeContactSurfaces(). The same times are reported to the
+ Profiler, when it is enabled, as scopes labeled
+ "ProximityEngine candidate pair (id1, id2)"; that is how they reach users of
+ the public queries (e.g., QueryObject::ComputeContactSurfaces()).  */
+struct PairTiming {
+  SortedPair<GeometryId> pair;
+  double seconds{};
+};
+
 /* The underlying engine for performing geometric _proximity_ queries.
  It owns the geometry instances and, once it has been provided with the poses
  of the geometry, it provides geometric queries on that geometry.
@@ -106,6 +121,18 @@ class ProximityEngine {
                            const math::RigidTransformd& X_WG, GeometryId id,
                            const ProximityProperties& props = {});
 
+  /* Stops AddDynamicGeometry() and AddAnchoredGeometry() from refitting the
+   broadphase trees after each geometry, which makes adding n geometries
+   O(n²). The trees are refitted once, by the matching
+   ResumeBroadphaseUpdates(). In between, the engine may only be added to;
+   it must not be queried, cloned or have poses updated.  */
+  void SuspendBroadphaseUpdates();
+
+  /* Refits the broadphase trees over all of the geometries added since
+   SuspendBroadphaseUpdates() and restores the per-geometry refitting. Does
+   nothing if updates are not suspended.  */
+  void ResumeBroadphaseUpdates();
+
   /* Possibly updates the proximity representation of the given `geometry`
    based on the relationship between its _current_ proximity properties and the
    given _new_ proximity properties. The underlying representation may not
@@ -152,6 +179,15 @@ class ProximityEngine {
 
   double distance_tolerance() const;
 
+  /* Sets the degree of parallelism used by the queries that support it (see
+   ComputePointPairPenetration(), ComputeContactSurfaces(), and
+   ComputeContactSurfacesWithFallback()), as well as by UpdateWorldPoses() for
+   scenes with many dynamic geometries. The results of those queries do not
+   depend on the degree of parallelism. Defaults to Parallelism::None().  */
+  void set_parallelism(Parallelism parallelism);
+
+  Parallelism parallelism() const;
+
   //@}
 
   /* Updates the poses for all of the _dynamic_ geometries in the engine.
@@ -159,6 +195,8 @@ class ProximityEngine {
                     world frame `W` (including geometries which may *not* be
                     registered with the proximity engine or may not be
                     dynamic).
+   The geometries' world-frame bounding boxes are recomputed in parallel (see
+   set_parallelism()) when there are enough of them.
   */
   // TODO(SeanCurtis-TRI): I could do things here differently a number of ways:
   //  1. I could make this move semantics (or swap semantics).
@@ -167,6 +205,16 @@ class ProximityEngine {
   void UpdateWorldPoses(
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs);
 
+  /* Variant of UpdateWorldPoses() that only updates the dynamic geometries
+   whose ids are in `moved_ids`, i.e., those whose poses may have changed
+   since the last update; the other geometries keep their previous poses. When
+   few geometries move, only their nodes in the broadphase are updated.
+   Ids of geometries that are not registered or are not dynamic are ignored.
+  */
+  void UpdateWorldPoses(
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      const std::unordered_set<GeometryId>& moved_ids);
+
   // ----------------------------------------------------------------------
   /* @name              Signed Distance Queries
   See @ref signed_distance_query "Signed Distance Query" for more details.  */
@@ -199,6 +247,28 @@ class ProximityEngine {
       const Vector3<T>& p_WQ,
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
       const double threshold = std::numeric_limits<double>::infinity()) const;
+
+  /* Implementation of GeometryState::ComputeSignedDistanceToPoints().
+   This includes `X_WGs`, the current poses of all geometries in World in the
+   current scalar type, keyed on each geometry's GeometryId.  */
+  SignedDistanceToPoints<T>
+  ComputeSignedDistanceToPoints(
+      const Matrix3X<T>& p_WQs,
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      const double threshold = std::numeric_limits<double>::infinity()) const;
+  //@}
+
+  //----------------------------------------------------------------------------
+  /* @name                Ray Casting Queries  */
+  //@{
+
+  /* Implementation of GeometryState::CastRays(). The rays are intersected
+   with the geometries at their most recently updated poses (see
+   UpdateWorldPoses()). When parallelism() requests more than one thread, the
+   rays are distributed across the threads.  */
+  std::vector<RayHit> CastRays(const Eigen::Matrix3Xd& p_WRs,
+                               const Eigen::Matrix3Xd& n_Ws,
+                               double max_distance) const;
   //@}
 
 
@@ -216,23 +286,50 @@ class ProximityEngine {
   // be updated).
   /* Implementation of GeometryState::ComputePointPairPenetration().
    This includes `X_WGs`, the current poses of all geometries in World in the
-   current scalar type, keyed on each geometry's GeometryId.  */
+   current scalar type, keyed on each geometry's GeometryId.
+
+   When parallelism() requests more than one thread, the candidate pairs
+   reported by the broadphase are partitioned across threads for the
+   narrowphase. The merged results are sorted by geometry id pair and are
+   identical to those of the serial evaluation.  */
   std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration(
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
       const;
 
+  /* Variant of ComputePointPairPenetration() that constitutes one step of the
+   caller-owned `cache` (see ContactPairCache): the narrowphase is skipped for
+   every candidate pair that the axis cached by the previous step still
+   separates, and the cache is then replaced by this step's witnesses. The
+   results are the same as without a cache. The engine itself remains
+   unchanged, so callers with distinct caches may query it concurrently.
+   @pre cache != nullptr.  */
+  std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration(
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      ContactPairCache* cache) const;
+
   /* Implementation of GeometryState::ComputeContactSurfaces().
+
+   When parallelism() requests more than one thread, each candidate pair is
+   processed as an independent task; the merged surfaces are sorted exactly as
+   in the serial evaluation.
+
    @param X_WGs the current poses of all geometries in World in the
-                current scalar type, keyed on each geometry's GeometryId.  */
+                current scalar type, keyed on each geometry's GeometryId.
+   @param[out] timings  If not null, it is overwritten with the wall-clock time
+                        spent on each unfiltered candidate pair (see
+                        PairTiming). Requesting timings doesn't change the
+                        computed surfaces.  */
   template <typename T1 = T>
   typename std::enable_if_t<scalar_predicate<T1>::is_bool,
                             std::vector<ContactSurface<T>>>
   ComputeContactSurfaces(
       HydroelasticContactRepresentation representation,
-      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
-      const;
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      std::vector<PairTiming>* timings = nullptr) const;
 
   /* Implementation of GeometryState::ComputeContactSurfacesWithFallback().
+   Parallelism and `timings` are as documented for ComputeContactSurfaces();
+   the time reported for a pair includes the point-pair fallback.
    @param X_WGs the current poses of all geometries in World in the
                 current scalar type, keyed on each geometry's GeometryId.  */
   template <typename T1 = T>
@@ -241,7 +338,8 @@ class ProximityEngine {
       HydroelasticContactRepresentation representation,
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
       std::vector<ContactSurface<T>>* surfaces,
-      std::vector<PenetrationAsPointPair<T>>* point_pairs) const;
+      std::vector<PenetrationAsPointPair<T>>* point_pairs,
+      std::vector<PairTiming>* timings = nullptr) const;
 
   /* Implementation of GeometryState::FindCollisionCandidates().  */
   std::vector<SortedPair<GeometryId>> FindCollisionCandidates() const;
@@ -249,6 +347,40 @@ class ProximityEngine {
   /* Implementation of GeometryState::HasCollisions().  */
   bool HasCollisions() const;
 
+  /* Reports if any unfiltered pair of geometries comes into contact while
+   each dynamic geometry G moves from pose X_WGs_start.at(G) to pose
+   X_WGs_end.at(G). Along the motion, translation is interpolated linearly
+   and orientation with spherical linear interpolation, over a normalized time
+   t ∈ [0, 1].
+
+   The query is answered with conservative advancement: at the current time t,
+   signed distances are computed for all pairs. No pair at distance d whose
+   points move at most a distance μ over the whole motion can come into
+   contact before t + d/μ, so t is advanced to the earliest such time over all
+   pairs. Unlike sampling the motion, this doesn't miss thin obstacles, and
+   typically needs only a handful of distance queries.
+
+   @param X_WGs_start  The initial poses of all geometries, keyed on their
+                       ids. Anchored geometries are assumed to stay at these
+                       poses.
+   @param X_WGs_end    The final poses. Must contain all dynamic geometries.
+   @param tolerance    A pair is considered to be in contact when its signed
+                       distance is smaller than or equal to `tolerance`. It
+                       bounds the number of iterations and must be positive.
+   @returns `true` if a contact is found at some t ∈ [0, 1].
+
+   On return, the world poses of the dynamic geometries are those at the time
+   of the last distance query. Use UpdateWorldPoses() to reset them.
+
+   @throws std::exception if `tolerance` is not positive, if a moving geometry
+   is unbounded (e.g. a half space), if a signed distance query is not
+   supported for a pair of geometries (see
+   ComputeSignedDistancePairwiseClosestPoints()), or if T is not double.  */
+  bool HasCollisionsAlongMotion(
+      const std::unordered_map<GeometryId, math::RigidTransformd>& X_WGs_start,
+      const std::unordered_map<GeometryId, math::RigidTransformd>& X_WGs_end,
+      double tolerance);
+
   //@}
 
   /* The representation of every geometry that was successfully requested for
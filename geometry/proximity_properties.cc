@@ -12,9 +12,17 @@ const char* const kPointStiffness = "point_contact_stiffness";
 const char* const kHydroGroup = "hydroelastic";
 const char* const kElastic = "hydroelastic_modulus";
 const char* const kRezHint = "resolution_hint";
+const char* const kCoarseRezHint = "coarse_resolution_hint";
 const char* const kComplianceType = "compliance_type";
 const char* const kSlabThickness = "slab_thickness";
 
+const char* const kSdfGroup = "sdf";
+const char* const kSdfResolution = "resolution";
+const char* const kSdfCacheFile = "cache_file";
+
+const char* const kConvexDecompositionGroup = "convex_decomposition";
+const char* const kConvexDecompositionFile = "file";
+
 std::ostream& operator<<(std::ostream& out, const HydroelasticType& type) {
   switch (type) {
     case HydroelasticType::kUndefined:
@@ -122,5 +130,33 @@ void AddCompliantHydroelasticPropertiesForHalfSpace(
   AddCompliantHydroelasticProperties(hydroelastic_modulus, properties);
 }
 
+void AddSignedDistanceFieldProperties(
+    double resolution, const std::optional<std::string>& cache_file,
+    ProximityProperties* properties) {
+  DRAKE_DEMAND(properties != nullptr);
+  if (!(resolution > 0)) {
+    throw std::logic_error(fmt::format(
+        "The signed distance field resolution must be positive; given {}",
+        resolution));
+  }
+  properties->AddProperty(internal::kSdfGroup, internal::kSdfResolution,
+                          resolution);
+  if (cache_file.has_value()) {
+    properties->AddProperty(internal::kSdfGroup, internal::kSdfCacheFile,
+                            *cache_file);
+  }
+}
+
+void AddConvexDecompositionProperties(const std::string& filename,
+                                      ProximityProperties* properties) {
+  DRAKE_DEMAND(properties != nullptr);
+  if (filename.empty()) {
+    throw std::logic_error(
+        "The convex decomposition file name must not be empty");
+  }
+  properties->AddProperty(internal::kConvexDecompositionGroup,
+                          internal::kConvexDecompositionFile, filename);
+}
+
 }  // namespace geometry
 }  // namespace drake
@@ -9,6 +9,7 @@
 
 #include <optional>
 #include <ostream>
+#include <string>
 
 #include "drake/geometry/geometry_roles.h"
 #include "drake/multibody/plant/coulomb_friction.h"
@@ -63,12 +64,49 @@ extern const char* const kHydroGroup;       ///< Hydroelastic group name.
 extern const char* const kElastic;          ///< Hydroelastic modulus property
                                             ///< name.
 extern const char* const kRezHint;          ///< Resolution hint property name.
+extern const char* const kCoarseRezHint;    ///< Coarse resolution hint property
+                                            ///< name (for levels of detail).
 extern const char* const kComplianceType;   ///< Compliance type property name.
 extern const char* const kSlabThickness;    ///< Slab thickness property name
                                             ///< (for half spaces).
 
 //@}
 
+/* @name  Declaring a signed distance field for a Mesh.
+
+ A Mesh geometry whose proximity properties define the resolution of a signed
+ distance field gets one baked at registration; signed distance queries
+ against the mesh (see QueryObject::ComputeSignedDistanceToPoint()) then
+ evaluate the field instead of ignoring the mesh, as do point-pair penetration
+ queries between the mesh and a sphere. If the (optional) cache file
+ is given, the baked field is stored in that file and reused by subsequent
+ registrations of the same mesh file, scale and resolution (even in other
+ processes).  */
+//@{
+
+extern const char* const kSdfGroup;         ///< Signed distance field group
+                                            ///< name.
+extern const char* const kSdfResolution;    ///< Field resolution property name.
+extern const char* const kSdfCacheFile;     ///< Field cache file property name.
+
+//@}
+
+/* @name  Declaring a convex decomposition for a Mesh.
+
+ A Mesh geometry whose proximity properties name a convex decomposition file
+ is represented by the decomposition's convex pieces (instead of its convex
+ hull) in point-pair penetration queries (see
+ QueryObject::ComputePointPairPenetration()). The decomposition is read at
+ registration and shared by every registration of the same file and scale.  */
+//@{
+
+extern const char* const kConvexDecompositionGroup;  ///< Convex decomposition
+                                                     ///< group name.
+extern const char* const kConvexDecompositionFile;   ///< Decomposition file
+                                                     ///< property name.
+
+//@}
+
 // TODO(SeanCurtis-TRI): Update this to have an additional classification: kBoth
 //  when we have the need from the algorithm. For example: when we have two
 //  very stiff objects, we'd want to process them as compliant. But when one
@@ -171,6 +209,53 @@ void AddCompliantHydroelasticPropertiesForHalfSpace(
     double slab_thickness, double hydroelastic_modulus,
     ProximityProperties* properties);
 
+/** Adds properties to the given set of proximity properties sufficient to cause
+ the associated Mesh geometry to have a signed distance field baked at
+ registration. The field is sampled on a sparse voxel grid, refined only near
+ the mesh's surface, and evaluated by interpolation; this allows signed
+ distance queries against nonconvex meshes (see
+ QueryObject::ComputeSignedDistanceToPoint() and
+ QueryObject::ComputePointPairPenetration()) in constant time per query point.
+ The mesh must be closed with outward-facing triangles. The property is
+ ignored by all other shapes.
+
+ @param resolution           The spacing of the field's samples near the
+                             surface (in meters); the field's error is on the
+                             order of this spacing near edges and corners.
+ @param cache_file           If given, the path of a file in which the baked
+                             field is stored and from which it is reloaded if
+                             the same mesh is registered again (with the same
+                             scale and resolution).
+ @param[in,out] properties   The properties will be added to this property set.
+ @throws std::exception      If `resolution` is not positive or `properties`
+                             already has properties with the names that this
+                             function would need to add.
+ @pre `properties` is not nullptr.  */
+void AddSignedDistanceFieldProperties(
+    double resolution, const std::optional<std::string>& cache_file,
+    ProximityProperties* properties);
+
+/** Adds properties to the given set of proximity properties sufficient to cause
+ the associated Mesh geometry to be represented by an approximate convex
+ decomposition in point-pair penetration queries (see
+ QueryObject::ComputePointPairPenetration()). Otherwise, those queries treat a
+ Mesh as its convex hull, which reports false contacts inside the concavities
+ of, e.g., bins and shelves. The property is ignored by all other shapes.
+
+ The decomposition is baked offline (e.g., by V-HACD or CoACD) and stored as an
+ OBJ file in which each object is one convex piece, measured and expressed in
+ the frame of the (unscaled) mesh; the pieces are scaled by the Mesh's scale.
+ Only double-valued queries use the decomposition.
+
+ @param filename             The path of the decomposition's OBJ file.
+ @param[in,out] properties   The properties will be added to this property set.
+ @throws std::exception      If `filename` is empty or `properties` already
+                             has properties with the names that this function
+                             would need to add.
+ @pre `properties` is not nullptr.  */
+void AddConvexDecompositionProperties(const std::string& filename,
+                                      ProximityProperties* properties);
+
 //@}
 
 }  // namespace geometry
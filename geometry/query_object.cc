@@ -169,6 +169,27 @@ QueryObject<T>::ComputeSignedDistanceToPoint(
   return state.ComputeSignedDistanceToPoint(p_WQ, threshold);
 }
 
+template <typename T>
+SignedDistanceToPoints<T> QueryObject<T>::ComputeSignedDistanceToPoints(
+    const Matrix3X<T>& p_WQs, const double threshold) const {
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.ComputeSignedDistanceToPoints(p_WQs, threshold);
+}
+
+template <typename T>
+std::vector<RayHit> QueryObject<T>::CastRays(const Eigen::Matrix3Xd& p_WRs,
+                                             const Eigen::Matrix3Xd& n_Ws,
+                                             double max_distance) const {
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.CastRays(p_WRs, n_Ws, max_distance);
+}
+
 template <typename T>
 void QueryObject<T>::RenderColorImage(const ColorRenderCamera& camera,
                                       FrameId parent_frame,
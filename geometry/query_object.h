@@ -8,6 +8,7 @@
 #include "drake/common/drake_deprecated.h"
 #include "drake/geometry/query_results/contact_surface.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
+#include "drake/geometry/query_results/ray_hit.h"
 #include "drake/geometry/query_results/signed_distance_pair.h"
 #include "drake/geometry/query_results/signed_distance_to_point.h"
 #include "drake/geometry/render/render_camera.h"
@@ -274,7 +275,10 @@ class QueryObject {
             consistent -- for fixed geometry poses, the results will remain
             the same.
    @warning For Mesh shapes, their convex hulls are used in this query. It is
-            *not* computationally efficient or particularly accurate.
+            *not* computationally efficient or particularly accurate. A Mesh
+            with an approximate convex decomposition (see
+            AddConvexDecompositionProperties()) is represented by its convex
+            pieces instead (for T = double).
    @throws std::exception if a Shape-Shape pair is in collision and indicated as
            `throws` in the support table above.  */
   std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration() const;
@@ -681,6 +685,76 @@ class QueryObject {
   ComputeSignedDistanceToPoint(const Vector3<T> &p_WQ,
                                const double threshold
                                = std::numeric_limits<double>::infinity()) const;
+
+  /** A batched version of ComputeSignedDistanceToPoint() for many query
+   points. It reports the same results for each point Qᵢ (the i'th column of
+   `p_WQs`) as ComputeSignedDistanceToPoint() would, ordered by geometry id,
+   but is faster than calling that query once per point: nearby points share
+   a single broadphase traversal, and the points are distributed across the
+   proximity engine's threads (see SceneGraphConfig::proximity_num_threads).
+
+   @param[in] p_WQs           The positions of the query points in world
+                              frame W, one per column.
+   @param[in] threshold       We ignore any object beyond this distance from a
+                              query point. By default, it is infinity, so we
+                              report distances from every query point to every
+                              object.
+   @retval signed_distances   The per-point, per-object signed distance values,
+                              grouped by query point. See
+                              SignedDistanceToPoints. */
+  SignedDistanceToPoints<T>
+  ComputeSignedDistanceToPoints(const Matrix3X<T>& p_WQs,
+                                const double threshold
+                                = std::numeric_limits<double>::infinity())
+      const;
+  //@}
+
+
+  //---------------------------------------------------------------------------
+  /**
+   @anchor ray_casting_queries
+   @name                Ray Casting Queries
+
+   These queries report what a set of rays (e.g., the beams of a range sensor
+   such as a LIDAR) first hit among the geometries with the proximity role.
+   They are evaluated directly against the proximity engine's broadphase, so
+   they don't require a render engine and cost far less than rendering a
+   depth image when only a few rays are of interest.
+  */
+  //@{
+
+  /** Casts many rays and reports, for each ray, the nearest geometry it hits
+   and the distance to the hit point. The i'th ray starts at the i'th column
+   of `p_WRs` and points along the i'th column of `n_Ws`. The rays are
+   distributed across the proximity engine's threads (see
+   SceneGraphConfig::proximity_num_threads).
+
+   <h3>Characterizing the returned values</h3>
+
+   A ray whose origin lies inside a geometry hits it at distance zero. The
+   geometries are posed with the double-valued values of their poses, so the
+   results carry no derivatives for any scalar type T.
+
+   <h3>Shape support</h3>
+
+   This query supports every shape. A Mesh is hit only if it has a convex
+   decomposition (see AddConvexDecompositionProperties()), in which case the
+   rays hit the decomposition's pieces; otherwise, rays pass through it.
+
+   @param[in] p_WRs         The origins of the rays in world frame W, one per
+                            column.
+   @param[in] n_Ws          The directions of the rays, expressed in W, one per
+                            column. They need not be unit length.
+   @param[in] max_distance  Geometries farther than this distance along a ray
+                            are ignored. By default, it is infinity.
+   @retval hits             The hit of each ray, in the order of the rays. See
+                            RayHit.
+   @throws std::exception if `p_WRs` and `n_Ws` have different numbers of
+                          columns, any direction is zero, or `max_distance`
+                          is negative. */
+  std::vector<RayHit> CastRays(
+      const Eigen::Matrix3Xd& p_WRs, const Eigen::Matrix3Xd& n_Ws,
+      double max_distance = std::numeric_limits<double>::infinity()) const;
   //@}
 
 
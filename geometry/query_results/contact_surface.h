@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -160,54 +161,32 @@ enum class HydroelasticContactRepresentation { kTriangle, kPolygon };
 template <typename T>
 class ContactSurface {
  public:
-  ContactSurface(const ContactSurface& surface) { *this = surface; }
-
-  // TODO(SeanCurtis-TRI) Copy assignment, both constructors, and SwapMAndN
-  //  would all be better defined in the .cc file. The primary reason they are
-  //  not is that multibody::HydroelasticContactInfo and
-  //  multibody::ContactResultsToLcm unit tests
-  //  (which explicitly declare support for T = symbolic::Expression), blindly
-  //  assume that the contact surface likewise supports symbolic::Expression
-  //  (even though that is not the case). Their only meaningful actions are to
-  //  copy/create instances. By leaving these functions in the header, those
-  //  workflows continue to work. Ideally, they'd protect themselves against the
-  //  fact that they are instantiating types that don't *truly* support
-  //  symbolic::Expression and these functions can move into the .cc file.
-  //  This has a downstream effect of requiring the surface meshes
-  //  ReverseFaceWinding methods defined in the header as it gets invoked by
-  //  SwapMAndN.
-
-  ContactSurface& operator=(const ContactSurface& surface) {
-    if (&surface == this) return *this;
-
-    id_M_ = surface.id_M_;
-    id_N_ = surface.id_N_;
-    if (surface.is_triangle()) {
-      mesh_W_ = std::make_unique<TriangleSurfaceMesh<T>>(surface.tri_mesh_W());
-      // We can't simply copy the mesh fields; the copies must contain pointers
-      // to the new mesh. So, we use CloneAndSetMesh() instead.
-      e_MN_ = surface.tri_e_MN().CloneAndSetMesh(&tri_mesh_W());
-    } else {
-      mesh_W_ = std::make_unique<PolygonSurfaceMesh<T>>(surface.poly_mesh_W());
-      // We can't simply copy the mesh fields; the copies must contain pointers
-      // to the new mesh. So, we use CloneAndSetMesh() instead.
-      e_MN_ = surface.poly_e_MN().CloneAndSetMesh(&poly_mesh_W());
-    }
-
-    if (surface.grad_eM_W_) {
-      grad_eM_W_ =
-          std::make_unique<std::vector<Vector3<T>>>(*surface.grad_eM_W_);
-    }
-    if (surface.grad_eN_W_) {
-      grad_eN_W_ =
-          std::make_unique<std::vector<Vector3<T>>>(*surface.grad_eN_W_);
-    }
-
-    return *this;
-  }
+  /** @name Implements CopyConstructible, CopyAssignable, MoveConstructible,
+   MoveAssignable
 
+   A %ContactSurface is immutable once constructed, so copies share its mesh,
+   field, and gradients rather than duplicating them; copying is cheap
+   regardless of the size of the surface.  */
+  //@{
+  ContactSurface(const ContactSurface&) = default;
+  ContactSurface& operator=(const ContactSurface&) = default;
   ContactSurface(ContactSurface&&) = default;
   ContactSurface& operator=(ContactSurface&&) = default;
+  //@}
+
+  // TODO(SeanCurtis-TRI) Both constructors and the M/N swap would be better
+  //  defined in the .cc file. The primary reason they are not is that
+  //  multibody::HydroelasticContactInfo and multibody::ContactResultsToLcm unit
+  //  tests (which explicitly declare support for T = symbolic::Expression),
+  //  blindly assume that the contact surface likewise supports
+  //  symbolic::Expression (even though that is not the case). Their only
+  //  meaningful actions are to copy/create instances. By leaving these
+  //  functions in the header, those workflows continue to work. Ideally, they'd
+  //  protect themselves against the fact that they are instantiating types
+  //  that don't *truly* support symbolic::Expression and these functions can
+  //  move into the .cc file. This has a downstream effect of requiring the
+  //  surface meshes ReverseFaceWinding methods defined in the header as it gets
+  //  invoked by the swap.
 
   /** @name Constructors
 
@@ -325,8 +304,8 @@ class ContactSurface {
 
    and offered as convenient sugar. */
   bool is_triangle() const {
-    return std::holds_alternative<std::unique_ptr<TriangleSurfaceMesh<T>>>(
-        mesh_W_);
+    return std::holds_alternative<
+        std::shared_ptr<const TriangleSurfaceMesh<T>>>(mesh_W_);
   }
 
   /** Reports the representation mode of this contact surface. If accessing the
@@ -342,15 +321,15 @@ class ContactSurface {
    @pre `is_triangle()` returns `true`. */
   const TriangleSurfaceMesh<T>& tri_mesh_W() const {
     DRAKE_DEMAND(is_triangle());
-    return *std::get<std::unique_ptr<TriangleSurfaceMesh<T>>>(mesh_W_);
+    return *std::get<std::shared_ptr<const TriangleSurfaceMesh<T>>>(mesh_W_);
   }
 
   /** Returns a reference to the scalar field eₘₙ for the _triangle_ mesh.
    @pre `is_triangle()` returns `true`. */
   const TriangleSurfaceMeshFieldLinear<T, T>& tri_e_MN() const {
     DRAKE_DEMAND(is_triangle());
-    return *std::get<std::unique_ptr<TriangleSurfaceMeshFieldLinear<T, T>>>(
-        e_MN_);
+    return *std::get<
+        std::shared_ptr<const TriangleSurfaceMeshFieldLinear<T, T>>>(e_MN_);
   }
 
   /** Returns a reference to the _polygonal_ surface mesh whose vertex
@@ -358,15 +337,15 @@ class ContactSurface {
    @pre `is_triangle()` returns `false`. */
   const PolygonSurfaceMesh<T>& poly_mesh_W() const {
     DRAKE_DEMAND(!is_triangle());
-    return *std::get<std::unique_ptr<PolygonSurfaceMesh<T>>>(mesh_W_);
+    return *std::get<std::shared_ptr<const PolygonSurfaceMesh<T>>>(mesh_W_);
   }
 
   /** Returns a reference to the scalar field eₘₙ for the _polygonal_ mesh.
    @pre `is_triangle()` returns `false`. */
   const PolygonSurfaceMeshFieldLinear<T, T>& poly_e_MN() const {
     DRAKE_DEMAND(!is_triangle());
-    return *std::get<std::unique_ptr<PolygonSurfaceMeshFieldLinear<T, T>>>(
-        e_MN_);
+    return *std::get<
+        std::shared_ptr<const PolygonSurfaceMeshFieldLinear<T, T>>>(e_MN_);
   }
 
   //@}
@@ -424,6 +403,12 @@ class ContactSurface {
   using FieldVariant =
       std::variant<std::unique_ptr<TriangleSurfaceMeshFieldLinear<T, T>>,
                    std::unique_ptr<PolygonSurfaceMeshFieldLinear<T, T>>>;
+  using SharedMeshVariant =
+      std::variant<std::shared_ptr<const TriangleSurfaceMesh<T>>,
+                   std::shared_ptr<const PolygonSurfaceMesh<T>>>;
+  using SharedFieldVariant = std::variant<
+      std::shared_ptr<const TriangleSurfaceMeshFieldLinear<T, T>>,
+      std::shared_ptr<const PolygonSurfaceMeshFieldLinear<T, T>>>;
 
   // Main delegation constructor. The extra int parameter is to introduce a
   // disambiguation mechanism.
@@ -431,41 +416,47 @@ class ContactSurface {
                  FieldVariant e_MN,
                  std::unique_ptr<std::vector<Vector3<T>>> grad_eM_W,
                  std::unique_ptr<std::vector<Vector3<T>>> grad_eN_W, int)
-      : id_M_(id_M),
-        id_N_(id_N),
-        mesh_W_(move(mesh_W)),
-        e_MN_(move(e_MN)),
-        grad_eM_W_(move(grad_eM_W)),
-        grad_eN_W_(move(grad_eN_W)) {
+      : id_M_(id_M), id_N_(id_N) {
     // If defined the gradient values must map 1-to-1 onto elements.
-    if (is_triangle()) {
-      DRAKE_THROW_UNLESS(grad_eM_W_ == nullptr ||
-                         static_cast<int>(grad_eM_W_->size()) ==
-                             tri_mesh_W().num_elements());
-      DRAKE_THROW_UNLESS(grad_eN_W_ == nullptr ||
-                         static_cast<int>(grad_eN_W_->size()) ==
-                             tri_mesh_W().num_elements());
-    } else {
-      DRAKE_THROW_UNLESS(grad_eM_W_ == nullptr ||
-                         static_cast<int>(grad_eM_W_->size()) ==
-                             poly_mesh_W().num_elements());
-      DRAKE_THROW_UNLESS(grad_eN_W_ == nullptr ||
-                         static_cast<int>(grad_eN_W_->size()) ==
-                             poly_mesh_W().num_elements());
-    }
-    if (id_N_ < id_M_) SwapMAndN();
+    const int num_faces = std::visit(
+        [](const auto& mesh) { return mesh->num_elements(); }, mesh_W);
+    DRAKE_THROW_UNLESS(grad_eM_W == nullptr ||
+                       static_cast<int>(grad_eM_W->size()) == num_faces);
+    DRAKE_THROW_UNLESS(grad_eN_W == nullptr ||
+                       static_cast<int>(grad_eN_W->size()) == num_faces);
+    if (id_N_ < id_M_) SwapMAndN(&mesh_W, &grad_eM_W, &grad_eN_W);
+
+    // From here on, the data is immutable and shared by all copies.
+    std::visit(
+        [this](auto&& mesh) {
+          using MeshType = typename std::decay_t<decltype(mesh)>::element_type;
+          mesh_W_ = std::shared_ptr<const MeshType>(std::move(mesh));
+        },
+        mesh_W);
+    std::visit(
+        [this](auto&& field) {
+          using FieldType =
+              typename std::decay_t<decltype(field)>::element_type;
+          e_MN_ = std::shared_ptr<const FieldType>(std::move(field));
+        },
+        e_MN);
+    grad_eM_W_ = std::move(grad_eM_W);
+    grad_eN_W_ = std::move(grad_eN_W);
   }
 
-  // Swaps M and N (modifying the data in place to reflect the change).
-  void SwapMAndN() {
+  // Swaps M and N (modifying the given data, before it is shared, to reflect
+  // the change).
+  void SwapMAndN(MeshVariant* mesh_W,
+                 std::unique_ptr<std::vector<Vector3<T>>>* grad_eM_W,
+                 std::unique_ptr<std::vector<Vector3<T>>>* grad_eN_W) {
     std::swap(id_M_, id_N_);
     // TODO(SeanCurtis-TRI): Determine if this work is necessary. It is neither
     // documented nor tested that the face winding is guaranteed to be one way
     // or the other. Alternatively, this should be documented and tested.
-    std::visit([](auto&& mesh) { mesh->ReverseFaceWinding(); }, mesh_W_);
+    std::visit([](auto&& mesh) { mesh->ReverseFaceWinding(); }, *mesh_W);
 
     // Note: the scalar field does not depend on the order of M and N.
-    std::swap(grad_eM_W_, grad_eN_W_);
+    std::swap(*grad_eM_W, *grad_eN_W);
   }
 
   // The id of the first geometry M.
@@ -474,17 +465,18 @@ class ContactSurface {
   GeometryId id_N_;
 
   // The surface mesh of the contact surface 𝕊ₘₙ between M and N.
-  MeshVariant mesh_W_;
+  SharedMeshVariant mesh_W_;
 
-  // Represents the scalar field eₘₙ on the surface mesh.
-  FieldVariant e_MN_;
+  // Represents the scalar field eₘₙ on the surface mesh. It refers to the mesh
+  // in mesh_W_, which it shares the lifetime of.
+  SharedFieldVariant e_MN_;
 
   // The gradients of the pressure fields eₘ and eₙ sampled on the contact
   // surface. There is one gradient value *per contact surface face*.
   // These quantities may not be defined if the gradient is not well-defined.
   // See class documentation for elaboration.
-  std::unique_ptr<std::vector<Vector3<T>>> grad_eM_W_;
-  std::unique_ptr<std::vector<Vector3<T>>> grad_eN_W_;
+  std::shared_ptr<const std::vector<Vector3<T>>> grad_eM_W_;
+  std::shared_ptr<const std::vector<Vector3<T>>> grad_eN_W_;
 
   template <typename U> friend class ContactSurfaceTester;
 };
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <limits>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/geometry_ids.h"
+
+namespace drake {
+namespace geometry {
+
+/** The result of casting a single ray against the proximity geometries, as
+ computed by QueryObject::CastRays(). It reports the nearest geometry G that
+ the ray hits and the distance along the ray to the hit point. If the ray hits
+ nothing (within the query's maximum distance), `id_G` is invalid and
+ `distance` is infinite. */
+struct RayHit {
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RayHit)
+  RayHit() = default;
+
+  /** Reports true if the ray hit a geometry. */
+  bool is_hit() const { return id_G.is_valid(); }
+
+  /** The id of the geometry hit by the ray. */
+  GeometryId id_G;
+  /** The distance from the ray's origin to the hit point. It is zero if the
+      ray's origin lies inside G. */
+  double distance{std::numeric_limits<double>::infinity()};
+};
+
+}  // namespace geometry
+}  // namespace drake
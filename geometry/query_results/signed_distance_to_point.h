@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cmath>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
@@ -73,5 +74,51 @@ struct SignedDistanceToPoint{
   Vector3<T> grad_W;
 };
 
+/** The data for reporting the signed distances from many query points to the
+  geometries, as computed by QueryObject::ComputeSignedDistanceToPoints(). The
+  results are stored as a "structure of arrays": the k'th result is given by
+  `id_G[k]`, `p_GN.col(k)`, `distance[k]` and `grad_W.col(k)`, each with the
+  same meaning as the corresponding member of SignedDistanceToPoint. The
+  results are grouped by query point; those for the i'th query point Qᵢ are
+  the results k in the range [`offsets[i]`, `offsets[i + 1]`).
+
+  @tparam T The underlying scalar type. Must be a valid Eigen scalar.
+ */
+template <typename T>
+struct SignedDistanceToPoints {
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SignedDistanceToPoints)
+  SignedDistanceToPoints() = default;
+
+  /** Returns the number of query points. */
+  int num_points() const {
+    return offsets.empty() ? 0 : static_cast<int>(offsets.size()) - 1;
+  }
+
+  /** Returns the total number of results, over all query points. */
+  int num_results() const { return static_cast<int>(id_G.size()); }
+
+  /** Returns the k'th result as a SignedDistanceToPoint.
+   @pre 0 <= k < num_results(). */
+  SignedDistanceToPoint<T> result(int k) const {
+    DRAKE_ASSERT(0 <= k && k < num_results());
+    return SignedDistanceToPoint<T>(id_G[k], p_GN.col(k), distance[k],
+                                    grad_W.col(k));
+  }
+
+  /** The offsets of each query point's results; it has num_points() + 1
+      entries, the first of which is zero. */
+  std::vector<int> offsets;
+  /** The id of the geometry G of each result. */
+  std::vector<GeometryId> id_G;
+  /** The nearest point N on G's surface of each result, expressed in G's
+      frame. */
+  Matrix3X<T> p_GN;
+  /** The signed distance of each result. */
+  VectorX<T> distance;
+  /** The gradient vector of the distance function of each result, expressed
+      in world frame W. */
+  Matrix3X<T> grad_W;
+};
+
 }  // namespace geometry
 }  // namespace drake
@@ -1,10 +1,18 @@
 #include "drake/geometry/read_obj.h"
 
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <system_error>
+#include <utility>
+
 #include <fmt/format.h>
-#include <tiny_obj_loader.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/filesystem.h"
+#include "drake/common/never_destroyed.h"
 #include "drake/common/text_logging.h"
+#include "drake/geometry/mesh_file_cache.h"
 
 static_assert(std::is_same_v<tinyobj::real_t, double>,
               "tinyobjloader must be compiled in double-precision mode");
@@ -92,16 +100,10 @@ std::vector<int> TinyObjToFclFaces(const tinyobj::mesh_t& mesh) {
 
   return faces;
 }
-}  // namespace
 
-std::tuple<std::shared_ptr<std::vector<Eigen::Vector3d>>,
-           std::shared_ptr<std::vector<int>>, int>
-ReadObjFile(const std::string& filename, double scale, bool triangulate) {
-  tinyobj::attrib_t attrib;
-  std::vector<tinyobj::shape_t> shapes;
+ObjFileData ParseObjFile(const std::string& filename, bool triangulate) {
+  ObjFileData result;
   std::vector<tinyobj::material_t> materials;
-  std::string warn;
-  std::string err;
 
   // Tinyobj doesn't infer the search directory from the directory containing
   // the obj file. We have to provide that directory; of course, this assumes
@@ -110,14 +112,76 @@ ReadObjFile(const std::string& filename, double scale, bool triangulate) {
   const std::string obj_folder = filename.substr(0, pos + 1);
   const char* mtl_basedir = obj_folder.c_str();
 
-  bool ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err,
-                              filename.c_str(), mtl_basedir, triangulate);
-  if (!ret || !err.empty()) {
-    throw std::runtime_error("Error parsing file '" + filename + "' : " + err);
+  result.success = tinyobj::LoadObj(
+      &result.attrib, &result.shapes, &materials, &result.warning,
+      &result.error, filename.c_str(), mtl_basedir, triangulate);
+  return result;
+}
+
+// The number of parses kept alive by GetObjFileData() after their last user
+// releases them.
+constexpr int kNumRetainedParses = 4;
+
+// Keeps the most recently requested parse alive, evicting the oldest ones.
+void RetainParse(std::shared_ptr<const ObjFileData> data) {
+  struct Retained {
+    std::mutex mutex;
+    std::deque<std::shared_ptr<const ObjFileData>> parses;
+  };
+  static never_destroyed<Retained> retained;
+  Retained& r = retained.access();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  const auto iter = std::find(r.parses.begin(), r.parses.end(), data);
+  if (iter != r.parses.end()) r.parses.erase(iter);
+  r.parses.push_front(std::move(data));
+  if (static_cast<int>(r.parses.size()) > kNumRetainedParses) {
+    r.parses.pop_back();
   }
-  if (!warn.empty()) {
-    drake::log()->warn("Warning parsing file '{}' : {}", filename, warn);
+}
+
+// Returns the parse of the OBJ file with the given `filename`, throwing on
+// parse errors and logging the warnings.
+std::shared_ptr<const ObjFileData> LoadObjFile(const std::string& filename,
+                                               bool triangulate) {
+  std::shared_ptr<const ObjFileData> data =
+      GetObjFileData(filename, triangulate);
+  if (!data->success || !data->error.empty()) {
+    throw std::runtime_error("Error parsing file '" + filename + "' : " +
+                             data->error);
   }
+  if (!data->warning.empty()) {
+    drake::log()->warn("Warning parsing file '{}' : {}", filename,
+                       data->warning);
+  }
+  return data;
+}
+}  // namespace
+
+std::shared_ptr<const ObjFileData> GetObjFileData(const std::string& filename,
+                                                  bool triangulate) {
+  // Distinguish versions of the file by size and modification time, so that
+  // a rewritten file is parsed again.
+  std::error_code error;
+  const auto size = filesystem::file_size(filename, error);
+  const auto time = filesystem::last_write_time(filename, error);
+  const std::string kind = fmt::format(
+      "tinyobj {} {} {}", triangulate ? "triangulated" : "polygonal",
+      error ? 0 : size, error ? 0 : time.time_since_epoch().count());
+  std::shared_ptr<const ObjFileData> data = GetOrMakeMeshFileData<ObjFileData>(
+      kind, filename, 1.0, [&filename, triangulate]() {
+        return ParseObjFile(filename, triangulate);
+      });
+  RetainParse(data);
+  return data;
+}
+
+std::tuple<std::shared_ptr<std::vector<Eigen::Vector3d>>,
+           std::shared_ptr<std::vector<int>>, int>
+ReadObjFile(const std::string& filename, double scale, bool triangulate) {
+  const std::shared_ptr<const ObjFileData> data =
+      LoadObjFile(filename, triangulate);
+  const tinyobj::attrib_t& attrib = data->attrib;
+  const std::vector<tinyobj::shape_t>& shapes = data->shapes;
 
   if (shapes.size() == 0) {
     throw std::runtime_error(
@@ -149,6 +213,53 @@ ReadObjFile(const std::string& filename, double scale, bool triangulate) {
       std::make_shared<std::vector<int>>(TinyObjToFclFaces(shapes[0].mesh));
   return {vertices, faces, num_faces};
 }
+
+std::vector<std::tuple<std::shared_ptr<std::vector<Eigen::Vector3d>>,
+                       std::shared_ptr<std::vector<int>>, int>>
+ReadObjFileObjects(const std::string& filename, double scale,
+                   bool triangulate) {
+  const std::shared_ptr<const ObjFileData> data =
+      LoadObjFile(filename, triangulate);
+  const tinyobj::attrib_t& attrib = data->attrib;
+  const std::vector<tinyobj::shape_t>& shapes = data->shapes;
+
+  if (shapes.size() == 0) {
+    throw std::runtime_error(
+        fmt::format("The file parsed contains no objects. The file could be "
+                    "corrupt, empty, or not an OBJ file. File name: '{}'",
+                    filename));
+  }
+
+  const std::vector<Eigen::Vector3d> all_vertices =
+      TinyObjToFclVertices(attrib, scale);
+  std::vector<std::tuple<std::shared_ptr<std::vector<Eigen::Vector3d>>,
+                         std::shared_ptr<std::vector<int>>, int>>
+      objects;
+  objects.reserve(shapes.size());
+  // The vertices are shared by all objects in the file; we give each object
+  // its own copy of the vertices it references, renumbering them in the
+  // order in which they are first referenced.
+  std::vector<int> object_index(all_vertices.size(), -1);
+  for (const tinyobj::shape_t& shape : shapes) {
+    auto vertices = std::make_shared<std::vector<Eigen::Vector3d>>();
+    auto faces =
+        std::make_shared<std::vector<int>>(TinyObjToFclFaces(shape.mesh));
+    std::fill(object_index.begin(), object_index.end(), -1);
+    for (size_t i = 0; i < faces->size(); i += (*faces)[i] + 1) {
+      for (int j = 1; j <= (*faces)[i]; ++j) {
+        int& v = (*faces)[i + j];
+        if (object_index[v] < 0) {
+          object_index[v] = static_cast<int>(vertices->size());
+          vertices->push_back(all_vertices[v]);
+        }
+        v = object_index[v];
+      }
+    }
+    const int num_faces = static_cast<int>(shape.mesh.num_face_vertices.size());
+    objects.emplace_back(std::move(vertices), std::move(faces), num_faces);
+  }
+  return objects;
+}
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
@@ -6,10 +6,44 @@
 #include <vector>
 
 #include <Eigen/Core>
+#include <tiny_obj_loader.h>
 
 namespace drake {
 namespace geometry {
 namespace internal {
+/** The contents of an OBJ file as parsed by tinyobjloader: the vertex
+ * positions, normals, and texture coordinates (shared by all objects in the
+ * file), and the faces of each object. Materials are not kept.
+ */
+struct ObjFileData {
+  /** The value returned by tinyobj::LoadObj(); if false, the other members
+   * are unspecified. */
+  bool success{false};
+  /** The errors and warnings reported by tinyobj::LoadObj(). */
+  std::string error;
+  std::string warning;
+  tinyobj::attrib_t attrib;
+  std::vector<tinyobj::shape_t> shapes;
+};
+
+/** Returns the parse of the OBJ file with the given `filename`, with
+ * polygonal faces triangulated iff `triangulate` is true. Material libraries
+ * are looked up relative to the directory containing the file.
+ *
+ * Every consumer of OBJ files in geometry (proximity, hydroelastics, convex
+ * hulls, and RenderEngineGl) reads files through this function, so that a
+ * file that several of them use is parsed once. The parse is shared through
+ * GetOrMakeMeshFileData(), and the few most recently requested parses are
+ * kept alive even when no one is using them, since consumers typically
+ * convert the data and release it right away. A parse is only reused while
+ * the file's size and modification time are unchanged.
+ *
+ * Parse errors are not thrown; they are reported in the result.
+ * This function is thread safe.
+ */
+std::shared_ptr<const ObjFileData> GetObjFileData(const std::string& filename,
+                                                  bool triangulate);
+
 /** Reads the OBJ file with the given `filename` into a collection of data. It
  * includes the vertex positions, face encodings (see TinyObjToFclFaces), and
  * number of faces.
@@ -36,6 +70,17 @@ std::tuple<std::shared_ptr<std::vector<Eigen::Vector3d>>,
            std::shared_ptr<std::vector<int>>, int>
 ReadObjFile(const std::string& filename, double scale, bool triangulate);
 
+/** Reads the OBJ file with the given `filename`, which may contain any number
+ * of objects (or groups), into one collection of data per object, in the same
+ * format as ReadObjFile(). Each object's `vertices` are only those referenced
+ * by its faces, and its faces index into them.
+ * @throws std::exception if the file can't be parsed or contains no objects.
+ */
+std::vector<std::tuple<std::shared_ptr<std::vector<Eigen::Vector3d>>,
+                       std::shared_ptr<std::vector<int>>, int>>
+ReadObjFileObjects(const std::string& filename, double scale,
+                   bool triangulate);
+
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
@@ -0,0 +1,239 @@
+#include "drake/geometry/render/frustum_culler.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace internal {
+
+using Eigen::AlignedBox3d;
+using Eigen::Vector3d;
+using math::RigidTransformd;
+
+namespace {
+
+// The maximum number of geometries in a leaf of the hierarchy.
+constexpr int kMaxLeafSize = 4;
+
+// Computes the world-aligned box that bounds the box `bounds_G` posed at X_WG.
+AlignedBox3d CalcWorldBounds(const AlignedBox3d& bounds_G,
+                             const RigidTransformd& X_WG) {
+  if (!bounds_G.min().allFinite() || !bounds_G.max().allFinite()) {
+    const double kInf = std::numeric_limits<double>::infinity();
+    return AlignedBox3d(Vector3d::Constant(-kInf), Vector3d::Constant(kInf));
+  }
+  const Vector3d center_W = X_WG * bounds_G.center();
+  const Vector3d half_W =
+      X_WG.rotation().matrix().cwiseAbs() * (0.5 * bounds_G.sizes());
+  return AlignedBox3d(center_W - half_W, center_W + half_W);
+}
+
+// A plane n⋅p + d = 0 in the world frame; points with n⋅p + d ≥ 0 are on the
+// inside of the frustum.
+struct Plane {
+  Vector3d n;
+  double d{};
+};
+
+// The six planes bounding the view frustum of `camera` at pose X_WC.
+std::array<Plane, 6> CalcFrustumPlanes(const RenderCameraCore& camera,
+                                       const RigidTransformd& X_WC) {
+  // The planes expressed in the camera frame C (+z is the view direction, +x
+  // points to the right of the image, and +y down). Pixel coordinates (u, v)
+  // are u = fx⋅x/z + cx and v = fy⋅y/z + cy; each side plane bounds u or v to
+  // the image.
+  const systems::sensors::CameraInfo& intrinsics = camera.intrinsics();
+  const double fx = intrinsics.focal_x();
+  const double fy = intrinsics.focal_y();
+  const double cx = intrinsics.center_x();
+  const double cy = intrinsics.center_y();
+  const double w = intrinsics.width();
+  const double h = intrinsics.height();
+  const std::array<Plane, 6> planes_C{
+      Plane{Vector3d(0, 0, 1), -camera.clipping().near()},
+      Plane{Vector3d(0, 0, -1), camera.clipping().far()},
+      Plane{Vector3d(fx, 0, cx), 0},       // u ≥ 0.
+      Plane{Vector3d(-fx, 0, w - cx), 0},  // u ≤ w.
+      Plane{Vector3d(0, fy, cy), 0},       // v ≥ 0.
+      Plane{Vector3d(0, -fy, h - cy), 0},  // v ≤ h.
+  };
+
+  // For p_C = X_CW⋅p_W, n_C⋅p_C + d = (R_WC⋅n_C)⋅p_W + (n_C⋅p_CW + d).
+  const RigidTransformd X_CW = X_WC.inverse();
+  std::array<Plane, 6> planes_W;
+  for (int i = 0; i < 6; ++i) {
+    planes_W[i].n = X_WC.rotation() * planes_C[i].n;
+    planes_W[i].d = planes_C[i].n.dot(X_CW.translation()) + planes_C[i].d;
+  }
+  return planes_W;
+}
+
+// The classification of a box with respect to the frustum.
+enum class Containment { kOutside, kIntersecting, kInside };
+
+Containment Classify(const std::array<Plane, 6>& planes,
+                     const AlignedBox3d& box) {
+  Containment result = Containment::kInside;
+  for (const Plane& plane : planes) {
+    // The box's corners furthest along and against the plane normal.
+    const Vector3d p_max = (plane.n.array() >= 0)
+                               .select(box.max(), box.min());
+    const Vector3d p_min = (plane.n.array() >= 0)
+                               .select(box.min(), box.max());
+    // Note: infinite boxes can produce NaN (0⋅∞); NaN fails both tests below,
+    // so such boxes are conservatively classified as intersecting.
+    if (plane.n.dot(p_max) + plane.d < 0) return Containment::kOutside;
+    if (!(plane.n.dot(p_min) + plane.d >= 0)) {
+      result = Containment::kIntersecting;
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+void FrustumCuller::AddGeometry(GeometryId id, const AlignedBox3d& bounds_G,
+                                const RigidTransformd& X_WG) {
+  const bool inserted =
+      entries_.emplace(id, Entry{bounds_G, CalcWorldBounds(bounds_G, X_WG)})
+          .second;
+  DRAKE_DEMAND(inserted);
+  needs_rebuild_ = true;
+}
+
+void FrustumCuller::UpdatePose(GeometryId id, const RigidTransformd& X_WG) {
+  auto iter = entries_.find(id);
+  if (iter == entries_.end()) return;
+  iter->second.bounds_W = CalcWorldBounds(iter->second.bounds_G, X_WG);
+  needs_refit_ = true;
+}
+
+void FrustumCuller::RemoveGeometry(GeometryId id) {
+  if (entries_.erase(id) > 0) needs_rebuild_ = true;
+}
+
+FrustumCullingStatistics FrustumCuller::FindVisible(
+    const RenderCameraCore& camera, const RigidTransformd& X_WC,
+    std::unordered_set<GeometryId>* visible) const {
+  DRAKE_DEMAND(visible != nullptr);
+  visible->clear();
+  Update();
+
+  FrustumCullingStatistics stats;
+  stats.num_geometries = num_geometries();
+  if (nodes_.empty()) return stats;
+
+  const std::array<Plane, 6> planes = CalcFrustumPlanes(camera, X_WC);
+  auto add_all = [this, visible](const Node& node) {
+    visible->insert(ordered_ids_.begin() + node.begin,
+                    ordered_ids_.begin() + node.end);
+  };
+  std::vector<int> stack{0};
+  while (!stack.empty()) {
+    const Node& node = nodes_[stack.back()];
+    stack.pop_back();
+    switch (Classify(planes, node.bounds)) {
+      case Containment::kOutside:
+        break;
+      case Containment::kInside:
+        add_all(node);
+        break;
+      case Containment::kIntersecting:
+        if (node.left < 0) {
+          for (int i = node.begin; i < node.end; ++i) {
+            const GeometryId id = ordered_ids_[i];
+            if (Classify(planes, entries_.at(id).bounds_W) !=
+                Containment::kOutside) {
+              visible->insert(id);
+            }
+          }
+        } else {
+          stack.push_back(node.left);
+          stack.push_back(node.right);
+        }
+        break;
+    }
+  }
+  stats.num_culled = stats.num_geometries - static_cast<int>(visible->size());
+  return stats;
+}
+
+int FrustumCuller::Build(int begin, int end) const {
+  const int index = static_cast<int>(nodes_.size());
+  nodes_.emplace_back();
+  AlignedBox3d bounds;
+  AlignedBox3d centers;
+  for (int i = begin; i < end; ++i) {
+    const AlignedBox3d& bounds_W = entries_.at(ordered_ids_[i]).bounds_W;
+    bounds.extend(bounds_W);
+    // Infinite boxes have no meaningful center; they are left out of the
+    // split heuristic.
+    if (bounds_W.min().allFinite() && bounds_W.max().allFinite()) {
+      centers.extend(bounds_W.center());
+    }
+  }
+  nodes_[index].bounds = bounds;
+  nodes_[index].begin = begin;
+  nodes_[index].end = end;
+  if (end - begin <= kMaxLeafSize) return index;
+
+  // Split at the median along the longest axis of the boxes' centers.
+  int axis = 0;
+  if (!centers.isEmpty()) centers.sizes().maxCoeff(&axis);
+  const int mid = begin + (end - begin) / 2;
+  auto center = [this, axis](GeometryId id) {
+    const AlignedBox3d& bounds_W = entries_.at(id).bounds_W;
+    const double c = 0.5 * (bounds_W.min()(axis) + bounds_W.max()(axis));
+    return std::isnan(c) ? 0.0 : c;
+  };
+  std::nth_element(ordered_ids_.begin() + begin, ordered_ids_.begin() + mid,
+                   ordered_ids_.begin() + end,
+                   [&center](GeometryId a, GeometryId b) {
+                     return center(a) < center(b);
+                   });
+  // Note: nodes_ may reallocate during the recursion, so we can't hold a
+  // reference into it.
+  const int left = Build(begin, mid);
+  const int right = Build(mid, end);
+  nodes_[index].left = left;
+  nodes_[index].right = right;
+  return index;
+}
+
+void FrustumCuller::Update() const {
+  if (needs_rebuild_) {
+    nodes_.clear();
+    ordered_ids_.clear();
+    ordered_ids_.reserve(entries_.size());
+    for (const auto& [id, entry] : entries_) ordered_ids_.push_back(id);
+    if (!ordered_ids_.empty()) Build(0, static_cast<int>(ordered_ids_.size()));
+  } else if (needs_refit_) {
+    // Children always follow their parents, so a reverse sweep visits every
+    // child before its parent.
+    for (int n = static_cast<int>(nodes_.size()) - 1; n >= 0; --n) {
+      Node& node = nodes_[n];
+      AlignedBox3d bounds;
+      if (node.left < 0) {
+        for (int i = node.begin; i < node.end; ++i) {
+          bounds.extend(entries_.at(ordered_ids_[i]).bounds_W);
+        }
+      } else {
+        bounds = nodes_[node.left].bounds.merged(nodes_[node.right].bounds);
+      }
+      node.bounds = bounds;
+    }
+  }
+  needs_rebuild_ = false;
+  needs_refit_ = false;
+}
+
+}  // namespace internal
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <Eigen/Geometry>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/render/render_camera.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+
+/** Reports the work saved by frustum culling in a render engine's most recent
+ image.  */
+struct FrustumCullingStatistics {
+  /** The number of geometries that were candidates for the image.  */
+  int num_geometries{0};
+
+  /** The number of those geometries skipped because their bounding boxes lie
+   completely outside the camera's view frustum.  */
+  int num_culled{0};
+};
+
+namespace internal {
+
+/* Determines which of a set of registered geometries can possibly be seen by a
+ camera, based on each geometry's world-aligned bounding box and the camera's
+ view frustum (its field of view bounded by the near and far clipping planes).
+ The result is conservative: a geometry reported as visible may still not
+ contribute any pixels, but a culled geometry cannot.
+
+ The world-aligned boxes are stored in a bounding volume hierarchy (BVH) so
+ that the cost of a query scales with the number of visible geometries rather
+ than with the number of registered geometries. The hierarchy is rebuilt lazily
+ when geometries are added or removed and refit lazily when poses change.
+
+ Used by RenderEngineVtk and RenderEngineGl.  */
+class FrustumCuller {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(FrustumCuller)
+
+  FrustumCuller() = default;
+
+  /* Adds the geometry with the given `id`, whose axis-aligned bounding box
+   measured and expressed in its frame G is `bounds_G`, at pose `X_WG`.
+   Geometries with unbounded extent can use infinite bounds; they are never
+   culled.
+   @pre `id` has not already been added.  */
+  void AddGeometry(GeometryId id, const Eigen::AlignedBox3d& bounds_G,
+                   const math::RigidTransformd& X_WG);
+
+  /* Updates the pose of the geometry with the given `id`; unknown ids are
+   ignored.  */
+  void UpdatePose(GeometryId id, const math::RigidTransformd& X_WG);
+
+  /* Removes the geometry with the given `id`; unknown ids are ignored.  */
+  void RemoveGeometry(GeometryId id);
+
+  /* Writes the ids of the geometries that intersect the view frustum of
+   `camera` located at X_WC into `visible` (replacing its contents).  */
+  FrustumCullingStatistics FindVisible(
+      const RenderCameraCore& camera, const math::RigidTransformd& X_WC,
+      std::unordered_set<GeometryId>* visible) const;
+
+  int num_geometries() const { return static_cast<int>(entries_.size()); }
+
+ private:
+  struct Entry {
+    Eigen::AlignedBox3d bounds_G;
+    Eigen::AlignedBox3d bounds_W;
+  };
+
+  // A node of the hierarchy. Nodes are stored in pre-order (every parent
+  // precedes its children), so the hierarchy can be refit with a single
+  // reverse sweep. A leaf owns the ids ordered_ids_[begin, end).
+  struct Node {
+    Eigen::AlignedBox3d bounds;
+    int left{-1};
+    int right{-1};
+    int begin{0};
+    int end{0};
+  };
+
+  // Builds the subtree over ordered_ids_[begin, end) and returns its index.
+  int Build(int begin, int end) const;
+
+  // Rebuilds or refits the hierarchy as needed.
+  void Update() const;
+
+  std::unordered_map<GeometryId, Entry> entries_;
+
+  // The lazily maintained hierarchy.
+  mutable std::vector<Node> nodes_;
+  mutable std::vector<GeometryId> ordered_ids_;
+  mutable bool needs_rebuild_{false};
+  mutable bool needs_refit_{false};
+};
+
+}  // namespace internal
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
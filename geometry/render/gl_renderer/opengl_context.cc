@@ -9,8 +9,12 @@
 // Note: This is intentionally included here since it's only needed at the
 // implementation level, and not in a grouping of more generic headers like
 // opengl_includes.h. See opengl_context.h for where pimpl is applied.
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
 #include <GL/glx.h>
 
+#include <fmt/format.h>
+
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/scope_exit.h"
@@ -62,13 +66,45 @@ void GlDebugCallback(GLenum, GLenum type, GLuint, GLenum severity, GLsizei,
   }
 }
 
+// Configures the current context to report the OpenGl implementation's errors
+// to the Drake log.
+void EnableDebugOutput() {
+  drake::log()->info("Vendor: {}", glGetString(GL_VENDOR));
+  glEnable(GL_DEBUG_OUTPUT);
+  glDebugMessageCallback(GlDebugCallback, 0);
+}
+
+// Looks up the EGL extension function with the given name.
+template <class F>
+F GetEglFunction(const char* func_name) {
+  F result = reinterpret_cast<F>(eglGetProcAddress(func_name));
+  if (result == nullptr) {
+    throw std::runtime_error(fmt::format(
+        "Error initializing the EGL OpenGL context for RenderEngineGl; the EGL "
+        "implementation doesn't provide {}().", func_name));
+  }
+  return result;
+}
+
 }  // namespace
 
+/* The interface to the platform-specific context implementations. */
 class OpenGlContext::Impl {
+ public:
+  virtual ~Impl() = default;
+  virtual void MakeCurrent() const = 0;
+  virtual void DisplayWindow(const int width, const int height) = 0;
+  virtual void HideWindow() = 0;
+  virtual bool IsWindowViewable() const = 0;
+  virtual void UpdateWindow() = 0;
+};
+
+/* The GLX implementation; it requires an X display. */
+class OpenGlContext::GlxImpl final : public OpenGlContext::Impl {
  public:
   // Open an X display and initialize an OpenGL context. The display will be
   // open and ready for offscreen rendering, but no window is visible.
-  explicit Impl(bool debug) {
+  explicit GlxImpl(bool debug) {
     // See Offscreen Rendering section here:
     // https://sidvind.com/index.php?title=Opengl/windowless
 
@@ -165,15 +201,11 @@ class OpenGlContext::Impl {
     MakeCurrent();
 
     // Enable debug.
-    if (debug) {
-      drake::log()->info("Vendor: {}", glGetString(GL_VENDOR));
-      glEnable(GL_DEBUG_OUTPUT);
-      glDebugMessageCallback(GlDebugCallback, 0);
-    }
+    if (debug) EnableDebugOutput();
     is_complete = true;
   }
 
-  ~Impl() {
+  ~GlxImpl() final {
     glXDestroyContext(display(), context_);
     XWindowAttributes window_attribs;
     XGetWindowAttributes(display(), window_, &window_attribs);
@@ -181,14 +213,14 @@ class OpenGlContext::Impl {
     XDestroyWindow(display(), window_);
   }
 
-  void MakeCurrent() const {
+  void MakeCurrent() const final {
     if (glXGetCurrentContext() != context_ &&
         !glXMakeCurrent(display(), window_, context_)) {
       throw std::runtime_error("Error making an OpenGL context current");
     }
   }
 
-  void DisplayWindow(const int width, const int height) {
+  void DisplayWindow(const int width, const int height) final {
     if (width != window_width_ || height != window_height_) {
       XResizeWindow(display(), window_, width, height);
       WaitForExposeEvent();
@@ -206,14 +238,14 @@ class OpenGlContext::Impl {
     // XServer).
   }
 
-  void HideWindow() {
+  void HideWindow() final {
     if (IsWindowViewable()) {
       XUnmapWindow(display(), window_);
       // Unmapping a window provides no events on that window.
     }
   }
 
-  bool IsWindowViewable() const {
+  bool IsWindowViewable() const final {
     XWindowAttributes attr;
     const Status status = XGetWindowAttributes(display(), window_, &attr);
 
@@ -227,7 +259,7 @@ class OpenGlContext::Impl {
     return attr.map_state == IsViewable;
   }
 
-  void UpdateWindow() {
+  void UpdateWindow() final {
     XClearWindow(display(), window_);
     glXSwapBuffers(display(), window_);
   }
@@ -240,23 +272,6 @@ class OpenGlContext::Impl {
     DRAKE_DEMAND(event.type == Expose);
   }
 
-  static GLint max_texture_size() {
-    GLint res{-1};
-    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &res);
-    return res;
-  }
-
-  static GLint max_renderbuffer_size() {
-    GLint res{-1};
-    glGetIntegerv(GL_MAX_RENDERBUFFER_SIZE, &res);
-    return res;
-  }
-
-  static GLint max_allowable_texture_size() {
-    // TODO(duy): Take into account CUDA limits.
-    return std::min(max_texture_size(), max_renderbuffer_size());
-  }
-
  private:
   static Display* display() {
     // Turn Display into a singleton to make CI happy, since when we close and
@@ -284,8 +299,156 @@ class OpenGlContext::Impl {
   int window_height_{480};
 };
 
-OpenGlContext::OpenGlContext(bool debug)
-    : impl_(new OpenGlContext::Impl(debug)) {}
+/* The EGL implementation using the device platform
+ (EGL_EXT_platform_device); it requires no display server. There is no window,
+ so rendering is limited to the engine's frame buffer objects. */
+class OpenGlContext::EglImpl final : public OpenGlContext::Impl {
+ public:
+  explicit EglImpl(bool debug) {
+    const int kConfigAttribs[] = {EGL_SURFACE_TYPE,
+                                  EGL_PBUFFER_BIT,
+                                  EGL_RED_SIZE,
+                                  8,
+                                  EGL_GREEN_SIZE,
+                                  8,
+                                  EGL_BLUE_SIZE,
+                                  8,
+                                  EGL_ALPHA_SIZE,
+                                  8,
+                                  EGL_DEPTH_SIZE,
+                                  24,
+                                  EGL_RENDERABLE_TYPE,
+                                  EGL_OPENGL_BIT,
+                                  EGL_NONE};
+    EGLConfig config{};
+    EGLint config_count = 0;
+    if (!eglChooseConfig(display(), kConfigAttribs, &config, 1,
+                         &config_count) ||
+        config_count == 0) {
+      throw std::runtime_error(
+          "Error initializing EGL OpenGL Context for RenderEngineGL; no "
+          "suitable frame buffer configuration found.");
+    }
+
+    // All rendering goes into frame buffer objects; the surface only exists
+    // so the context can be made current on implementations that don't
+    // support surfaceless contexts.
+    const int kSurfaceAttribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+    surface_ = eglCreatePbufferSurface(display(), config, kSurfaceAttribs);
+    if (surface_ == EGL_NO_SURFACE) {
+      throw std::runtime_error(
+          "Error initializing EGL OpenGL Context for RenderEngineGL; failed "
+          "to create a pixel buffer surface.");
+    }
+    bool is_complete = false;
+    ScopeExit surface_guard([surface = surface_, &is_complete]() {
+      if (!is_complete) eglDestroySurface(display(), surface);
+    });
+
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+      throw std::runtime_error(
+          "Error initializing EGL OpenGL Context for RenderEngineGL; the "
+          "OpenGL API is not supported.");
+    }
+    const int kContextAttribs[] = {EGL_CONTEXT_MAJOR_VERSION_KHR, 3,
+                                   EGL_CONTEXT_MINOR_VERSION_KHR, 3, EGL_NONE};
+    context_ = eglCreateContext(display(), config, EGL_NO_CONTEXT,
+                                kContextAttribs);
+    if (context_ == EGL_NO_CONTEXT) {
+      throw std::runtime_error(
+          "Error initializing EGL OpenGL Context for RenderEngineGL; failed "
+          "to create context via eglCreateContext.");
+    }
+    ScopeExit context_guard([context = context_, &is_complete]() {
+      if (!is_complete) eglDestroyContext(display(), context);
+    });
+
+    // Make it the current context.
+    MakeCurrent();
+
+    // Enable debug.
+    if (debug) EnableDebugOutput();
+    is_complete = true;
+  }
+
+  ~EglImpl() final {
+    if (eglGetCurrentContext() == context_) {
+      eglMakeCurrent(display(), EGL_NO_SURFACE, EGL_NO_SURFACE,
+                     EGL_NO_CONTEXT);
+    }
+    eglDestroyContext(display(), context_);
+    eglDestroySurface(display(), surface_);
+  }
+
+  void MakeCurrent() const final {
+    if (eglGetCurrentContext() != context_ &&
+        !eglMakeCurrent(display(), surface_, surface_, context_)) {
+      throw std::runtime_error("Error making an OpenGL context current");
+    }
+  }
+
+  void DisplayWindow(const int, const int) final {
+    throw std::runtime_error(
+        "RenderEngineGl cannot display a window with the EGL backend; use the "
+        "GLX backend for cameras with show_window enabled");
+  }
+
+  // There is no window, so it is never viewable and hiding it is a no-op.
+  void HideWindow() final {}
+
+  bool IsWindowViewable() const final { return false; }
+
+  void UpdateWindow() final {}
+
+ private:
+  static EGLDisplay display() {
+    // As with the X display, the EGL display is a singleton which is never
+    // terminated. We use the first device that initializes successfully.
+    static EGLDisplay g_display = []() {
+      const auto query_devices =
+          GetEglFunction<PFNEGLQUERYDEVICESEXTPROC>("eglQueryDevicesEXT");
+      const auto get_platform_display =
+          GetEglFunction<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+              "eglGetPlatformDisplayEXT");
+      constexpr int kMaxDevices = 16;
+      EGLDeviceEXT devices[kMaxDevices];
+      EGLint device_count = 0;
+      if (!query_devices(kMaxDevices, devices, &device_count)) {
+        device_count = 0;
+      }
+      for (int i = 0; i < device_count; ++i) {
+        EGLDisplay candidate = get_platform_display(EGL_PLATFORM_DEVICE_EXT,
+                                                    devices[i], nullptr);
+        if (candidate != EGL_NO_DISPLAY &&
+            eglInitialize(candidate, nullptr, nullptr)) {
+          return candidate;
+        }
+      }
+      return EGL_NO_DISPLAY;
+    }();
+    if (g_display == EGL_NO_DISPLAY) {
+      throw std::runtime_error(
+          "Error initializing EGL OpenGL Context for RenderEngineGL; no EGL "
+          "device could be initialized.");
+    }
+    return g_display;
+  }
+
+  EGLSurface surface_{EGL_NO_SURFACE};
+  EGLContext context_{EGL_NO_CONTEXT};
+};
+
+OpenGlContext::OpenGlContext(bool debug, OpenGlBackend backend) {
+  switch (backend) {
+    case OpenGlBackend::kGlx:
+      impl_ = std::make_unique<GlxImpl>(debug);
+      return;
+    case OpenGlBackend::kEgl:
+      impl_ = std::make_unique<EglImpl>(debug);
+      return;
+  }
+  DRAKE_UNREACHABLE();
+}
 
 OpenGlContext::~OpenGlContext() = default;
 
@@ -304,15 +467,20 @@ bool OpenGlContext::IsWindowViewable() const {
 void OpenGlContext::UpdateWindow() { impl_->UpdateWindow(); }
 
 GLint OpenGlContext::max_texture_size() {
-  return OpenGlContext::Impl::max_texture_size();
+  GLint res{-1};
+  glGetIntegerv(GL_MAX_TEXTURE_SIZE, &res);
+  return res;
 }
 
 GLint OpenGlContext::max_renderbuffer_size() {
-  return OpenGlContext::Impl::max_renderbuffer_size();
+  GLint res{-1};
+  glGetIntegerv(GL_MAX_RENDERBUFFER_SIZE, &res);
+  return res;
 }
 
 GLint OpenGlContext::max_allowable_texture_size() {
-  return OpenGlContext::Impl::max_allowable_texture_size();
+  // TODO(duy): Take into account CUDA limits.
+  return std::min(max_texture_size(), max_renderbuffer_size());
 }
 
 }  // namespace internal
@@ -9,6 +9,15 @@ namespace geometry {
 namespace render {
 namespace internal {
 
+/* The windowing-system interface used to create an OpenGL context.  */
+enum class OpenGlBackend {
+  /* GLX; requires an X display. Windows can be displayed.  */
+  kGlx,
+  /* EGL on the device platform; requires no display server (headless), but
+   windows cannot be displayed.  */
+  kEgl,
+};
+
 /* Handle OpenGL context initialization, clean-up, and generic OpenGL queries.
  This class creates and owns a new context upon construction. Rendering classes
  need to keep their own OpenGlContext and ensure that they switch to it using
@@ -20,8 +29,11 @@ class OpenGlContext {
    @param debug  If debug is true, the OpenGl context will be a "debug" context,
    in that the OpenGl implementation's errors will be written to the Drake log.
    See https://www.khronos.org/opengl/wiki/Debug_Output for more information.
-   */
-  explicit OpenGlContext(bool debug = false);
+   @param backend  The windowing-system interface used to create the context.
+   @throws std::exception if the context cannot be created with the requested
+   backend.  */
+  explicit OpenGlContext(bool debug = false,
+                         OpenGlBackend backend = OpenGlBackend::kGlx);
 
   ~OpenGlContext();
 
@@ -30,7 +42,8 @@ class OpenGlContext {
   void MakeCurrent() const;
 
   /* Displays the window at the given dimensions. Calling this redundantly (on
-   an already visible window of the given size) has no effect.  */
+   an already visible window of the given size) has no effect.
+   @throws std::exception for the EGL backend, which has no window.  */
   void DisplayWindow(const int width, const int height);
 
   /* Hides the window (if visible). Calling this on a hidden window has no
@@ -57,10 +70,13 @@ class OpenGlContext {
   static GLint max_allowable_texture_size();
 
  private:
-  // Note: we are dependent on `GL/glx.h` but don't want to let that bleed into
-  // other code. So, we pimpl this up so that glx.h lives only in the
-  // implementation.
+  // Note: we are dependent on `GL/glx.h` and `EGL/egl.h` but don't want to let
+  // that bleed into other code. So, we pimpl this up so that they live only in
+  // the implementation. Impl is the interface; GlxImpl and EglImpl are the
+  // backends.
   class Impl;
+  class GlxImpl;
+  class EglImpl;
 
   std::unique_ptr<Impl> impl_;
 };
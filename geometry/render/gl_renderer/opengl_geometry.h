@@ -77,6 +77,9 @@ struct OpenGlGeometry {
   /* True indicates that this has texture coordinates to support texture
    maps. See MeshData::has_tex_coord for detail.  */
   bool has_tex_coord{};
+  /* The axis-aligned bounding box of the vertex positions, in the geometry's
+   canonical (unscaled) frame.  */
+  Eigen::AlignedBox3d bounds;
 
   /* The value of an object (array, buffer) that should be considered invalid.
    */
@@ -1,6 +1,7 @@
 #include "drake/geometry/render/gl_renderer/render_engine_gl.h"
 
 #include <algorithm>
+#include <cstring>
 #include <optional>
 #include <utility>
 
@@ -345,18 +346,22 @@ class DefaultDepthShader final : public ShaderProgram {
   GLint depth_z_far_loc_{};
 
   // The vertex shader computes two pieces of information per vertex: its
-  // transformed position and its depth. Both get linearly interpolated across
+  // transformed position and its depth. It supports instancing; depth has no
+  // per-instance parameters beyond the pose. Both get linearly interpolated across
   // the rasterized triangle's fragments.
   static constexpr char kVertexShader[] = R"""(
 #version 330
 
 layout(location = 0) in vec3 p_MV;
+// The per-instance model view matrix used for instanced rendering.
+layout(location = 3) in mat4 T_CM_instance;
 out float depth;
 uniform mat4 T_CM;  // The "model view matrix" (in OpenGl terms).
 uniform mat4 T_DC;  // The "projection matrix" (in OpenGl terms).
+uniform bool use_T_CM_instance;
 
 void main() {
-  vec4 p_CV = T_CM * vec4(p_MV, 1);
+  vec4 p_CV = (use_T_CM_instance ? T_CM_instance : T_CM) * vec4(p_MV, 1);
   depth = -p_CV.z;
   gl_Position = T_DC * p_CV;
 })""";
@@ -465,9 +470,22 @@ void main() {
 
 }  // namespace
 
+namespace {
+
+internal::OpenGlBackend ParseBackend(const string& backend) {
+  if (backend == "GLX") return internal::OpenGlBackend::kGlx;
+  if (backend == "EGL") return internal::OpenGlBackend::kEgl;
+  throw std::logic_error(fmt::format(
+      "RenderEngineGlParams::backend must be \"GLX\" or \"EGL\"; got \"{}\"",
+      backend));
+}
+
+}  // namespace
+
 RenderEngineGl::RenderEngineGl(RenderEngineGlParams params)
     : RenderEngine(params.default_label),
-      opengl_context_(make_shared<OpenGlContext>()),
+      opengl_context_(make_shared<OpenGlContext>(
+          false /* debug */, ParseBackend(params.backend))),
       texture_library_(make_shared<TextureLibrary>(opengl_context_.get())),
       parameters_(std::move(params)) {
   // Configuration of basic OpenGl state.
@@ -607,6 +625,7 @@ bool RenderEngineGl::DoRegisterVisual(GeometryId id, const Shape& shape,
 void RenderEngineGl::DoUpdateVisualPose(GeometryId id,
                                         const RigidTransformd& X_WG) {
   visuals_.at(id).X_WG = X_WG;
+  culler_.UpdatePose(id, X_WG);
 }
 
 bool RenderEngineGl::DoRemoveGeometry(GeometryId id) {
@@ -632,6 +651,7 @@ bool RenderEngineGl::DoRemoveGeometry(GeometryId id) {
     remove_from_family(id, instance.shader_data, RenderType::kDepth);
     remove_from_family(id, instance.shader_data, RenderType::kLabel);
     visuals_.erase(iter);
+    culler_.RemoveGeometry(id);
     return true;
   } else {
     return false;
@@ -639,20 +659,158 @@ bool RenderEngineGl::DoRemoveGeometry(GeometryId id) {
 }
 
 unique_ptr<RenderEngine> RenderEngineGl::DoClone() const {
-  return unique_ptr<RenderEngineGl>(new RenderEngineGl(*this));
+  unique_ptr<RenderEngineGl> clone(new RenderEngineGl(*this));
+  clone->pipelined_readbacks_.clear();
+  return clone;
+}
+
+void RenderEngineGl::RenderImages(
+    const std::vector<ImageRequest>& requests) const {
+  // One image to be drawn and read back as part of the batch.
+  struct BatchImage {
+    const ImageRequest* request{};
+    RenderType render_type{};
+    // The image's byte offset into (and size within) readback_buffer_.
+    GLintptr offset{};
+    GLsizei size{};
+  };
+
+  // Validate the whole batch up front, so that a bad request doesn't leave the
+  // batch partially rendered, and lay out each image in the readback buffer.
+  std::vector<BatchImage> images;
+  GLintptr total_size = 0;
+  auto add_image = [&images, &total_size](const ImageRequest& request,
+                                          RenderType render_type,
+                                          const RenderCameraCore& core) {
+    // Every supported image type uses four bytes per pixel.
+    const GLsizei size =
+        4 * core.intrinsics().width() * core.intrinsics().height();
+    images.push_back({&request, render_type, total_size, size});
+    total_size += size;
+  };
+  for (const ImageRequest& request : requests) {
+    if ((request.color_image != nullptr || request.label_image != nullptr) &&
+        !request.color_camera.has_value()) {
+      throw std::logic_error(
+          "RenderEngineGl::RenderImages(): a color or label image was "
+          "requested without a color camera");
+    }
+    if (request.depth_image != nullptr && !request.depth_camera.has_value()) {
+      throw std::logic_error(
+          "RenderEngineGl::RenderImages(): a depth image was requested "
+          "without a depth camera");
+    }
+    if (request.color_image != nullptr) {
+      ThrowIfInvalid(request.color_camera->core().intrinsics(),
+                     request.color_image, "color");
+      add_image(request, RenderType::kColor, request.color_camera->core());
+    }
+    if (request.depth_image != nullptr) {
+      ThrowIfInvalid(request.depth_camera->core().intrinsics(),
+                     request.depth_image, "depth");
+      add_image(request, RenderType::kDepth, request.depth_camera->core());
+    }
+    if (request.label_image != nullptr) {
+      ThrowIfInvalid(request.color_camera->core().intrinsics(),
+                     request.label_image, "label");
+      add_image(request, RenderType::kLabel, request.color_camera->core());
+    }
+  }
+  if (images.empty()) return;
+
+  opengl_context_->MakeCurrent();
+
+  if (readback_buffer_ == 0) {
+    glCreateBuffers(1, &readback_buffer_);
+  }
+  GLint64 readback_size = 0;
+  glGetNamedBufferParameteri64v(readback_buffer_, GL_BUFFER_SIZE,
+                                &readback_size);
+  if (readback_size < total_size) {
+    glNamedBufferData(readback_buffer_, total_size, nullptr, GL_STREAM_READ);
+  }
+
+  // Draw each image into its own target and queue the copy of its texture into
+  // the readback buffer. With a pixel pack buffer bound, glGetTextureImage()
+  // doesn't wait for the GPU; the "pixels" argument is an offset into the
+  // buffer.
+  std::array<std::unordered_map<BufferDim, int>, RenderType::kTypeCount>
+      num_targets_used;
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, readback_buffer_);
+  for (const BatchImage& image : images) {
+    const ImageRequest& request = *image.request;
+    const RenderCameraCore& core = image.render_type == RenderType::kDepth
+                                       ? request.depth_camera->core()
+                                       : request.color_camera->core();
+    const BufferDim dim{core.intrinsics().width(), core.intrinsics().height()};
+    const RenderTarget target = GetBatchRenderTarget(
+        core, image.render_type, num_targets_used[image.render_type][dim]++);
+    const RigidTransformd X_CW = request.X_WC.inverse();
+    switch (image.render_type) {
+      case RenderType::kColor:
+        DrawColorImage(*request.color_camera, X_CW, target);
+        break;
+      case RenderType::kDepth:
+        DrawDepthImage(*request.depth_camera, X_CW, target);
+        break;
+      case RenderType::kLabel:
+        DrawLabelImage(*request.color_camera, X_CW, target);
+        break;
+      case RenderType::kTypeCount:
+        DRAKE_UNREACHABLE();
+    }
+    auto [internal_format, format, pixel_type] =
+        get_texture_format(image.render_type);
+    unused(internal_format);
+    glGetTextureImage(target.value_texture, 0, format, pixel_type, image.size,
+                      reinterpret_cast<void*>(image.offset));
+  }
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  // Mapping the buffer is the batch's single synchronization point.
+  const GLubyte* pixels = static_cast<const GLubyte*>(
+      glMapNamedBufferRange(readback_buffer_, 0, total_size, GL_MAP_READ_BIT));
+  if (pixels == nullptr) {
+    throw std::runtime_error(
+        "RenderEngineGl::RenderImages(): failed to map the readback buffer");
+  }
+  for (const BatchImage& image : images) {
+    const ImageRequest& request = *image.request;
+    const GLubyte* data = pixels + image.offset;
+    switch (image.render_type) {
+      case RenderType::kColor:
+        std::memcpy(request.color_image->at(0, 0), data, image.size);
+        break;
+      case RenderType::kDepth:
+        std::memcpy(request.depth_image->at(0, 0), data, image.size);
+        break;
+      case RenderType::kLabel:
+        DecodeLabelImage(data, request.label_image);
+        break;
+      case RenderType::kTypeCount:
+        DRAKE_UNREACHABLE();
+    }
+  }
+  glUnmapNamedBuffer(readback_buffer_);
 }
 
 void RenderEngineGl::RenderAt(const ShaderProgram& shader_program,
-                              RenderType render_type) const {
+                              RenderType render_type,
+                              const RigidTransformd& X_CW_in) const {
   // TODO(SeanCurtis-TRI) Consider storing a float-version of X_CW so it's only
   //  created once per camera declaration (and not once per shader).
-  const Eigen::Matrix4f& X_CW = X_CW_.GetAsMatrix4().matrix().cast<float>();
+  if (shader_program.supports_instancing()) {
+    RenderInstancedAt(shader_program, render_type, X_CW_in);
+    return;
+  }
+  const Eigen::Matrix4f& X_CW = X_CW_in.GetAsMatrix4().matrix().cast<float>();
   // We rely on the calling method to clear all appropriate buffers; this method
   // may be called multiple times per image (based on the number of shaders
   // being used) and, therefore, can't do the clearing itself.
 
   for (const GeometryId& g_id :
        shader_families_.at(render_type).at(shader_program.shader_id())) {
+    if (visible_.count(g_id) == 0) continue;
     const internal::OpenGlInstance& instance = visuals_.at(g_id);
     glBindVertexArray(instance.geometry.vertex_array);
 
@@ -672,10 +830,113 @@ void RenderEngineGl::RenderAt(const ShaderProgram& shader_program,
   glBindVertexArray(0);
 }
 
+void RenderEngineGl::CullGeometries(const RenderCameraCore& camera,
+                                    const RigidTransformd& X_CW) const {
+  culling_statistics_ = culler_.FindVisible(camera, X_CW.inverse(), &visible_);
+}
+
+void RenderEngineGl::RenderInstancedAt(
+    const ShaderProgram& shader_program, RenderType render_type,
+    const RigidTransformd& X_CW_in) const {
+  const Eigen::Matrix4f X_CW = X_CW_in.GetAsMatrix4().matrix().cast<float>();
+
+  // Group the instances by vertex array; std::map keeps the draw order
+  // deterministic.
+  std::map<GLuint, vector<const internal::OpenGlInstance*>> batches;
+  for (const GeometryId& g_id :
+       shader_families_.at(render_type).at(shader_program.shader_id())) {
+    if (visible_.count(g_id) == 0) continue;
+    const internal::OpenGlInstance& instance = visuals_.at(g_id);
+    batches[instance.geometry.vertex_array].push_back(&instance);
+  }
+
+  // Write the model view matrices of every instanced batch into one buffer,
+  // one column (of 16 floats) per instance.
+  int instanced_count = 0;
+  for (const auto& [vertex_array, instances] : batches) {
+    if (instances.size() > 1) instanced_count += instances.size();
+  }
+  Eigen::Matrix<float, 16, Eigen::Dynamic> T_CglMs(16, instanced_count);
+  int column = 0;
+  for (const auto& [vertex_array, instances] : batches) {
+    if (instances.size() == 1) continue;
+    for (const internal::OpenGlInstance* instance : instances) {
+      const Eigen::Matrix4f T_CglM = ShaderProgram::CalcModelViewMatrix(
+          X_CW * instance->X_WG.GetAsMatrix4().cast<float>(), instance->scale);
+      T_CglMs.col(column++) =
+          Eigen::Map<const Eigen::Matrix<float, 16, 1>>(T_CglM.data());
+    }
+  }
+  const GLsizeiptr instanced_size = T_CglMs.size() * sizeof(GLfloat);
+  if (instanced_size > 0) {
+    if (instance_buffer_ == 0) {
+      glCreateBuffers(1, &instance_buffer_);
+    }
+    GLint64 current_size{0};
+    glGetNamedBufferParameteri64v(instance_buffer_, GL_BUFFER_SIZE,
+                                  &current_size);
+    if (current_size < instanced_size) {
+      glNamedBufferData(instance_buffer_, instanced_size, nullptr,
+                        GL_STREAM_DRAW);
+    }
+    glNamedBufferSubData(instance_buffer_, 0, instanced_size, T_CglMs.data());
+  }
+
+  // A mat4 attribute is consumed as four consecutive vec4 attributes.
+  constexpr GLuint kAttrib = ShaderProgram::kInstanceModelViewAttrib;
+  constexpr GLuint kBinding = kAttrib;
+  constexpr GLsizei kStride = 16 * sizeof(GLfloat);
+  GLintptr offset = 0;
+  for (const auto& [vertex_array, instances] : batches) {
+    const internal::OpenGlInstance& first = *instances.front();
+    glBindVertexArray(vertex_array);
+    shader_program.SetInstanceParameters(first.shader_data[render_type]);
+    if (instances.size() == 1) {
+      shader_program.SetUseInstanceModelView(false);
+      shader_program.SetModelViewMatrix(
+          X_CW * first.X_WG.GetAsMatrix4().cast<float>(), first.scale);
+      glDrawElements(GL_TRIANGLES, first.geometry.index_buffer_size,
+                     GL_UNSIGNED_INT, 0);
+      continue;
+    }
+
+    shader_program.SetUseInstanceModelView(true);
+    glVertexArrayVertexBuffer(vertex_array, kBinding, instance_buffer_, offset,
+                              kStride);
+    glVertexArrayBindingDivisor(vertex_array, kBinding, 1);
+    for (GLuint i = 0; i < 4; ++i) {
+      glVertexArrayAttribFormat(vertex_array, kAttrib + i, 4, GL_FLOAT,
+                                GL_FALSE, i * 4 * sizeof(GLfloat));
+      glVertexArrayAttribBinding(vertex_array, kAttrib + i, kBinding);
+      glEnableVertexArrayAttrib(vertex_array, kAttrib + i);
+    }
+    glDrawElementsInstanced(GL_TRIANGLES, first.geometry.index_buffer_size,
+                            GL_UNSIGNED_INT, 0, instances.size());
+    // Leave the shared vertex array as CreateGlGeometry() configured it, so
+    // non-instancing shaders can use it unchanged.
+    for (GLuint i = 0; i < 4; ++i) {
+      glDisableVertexArrayAttrib(vertex_array, kAttrib + i);
+    }
+    offset += instances.size() * kStride;
+  }
+  glBindVertexArray(0);
+}
+
 void RenderEngineGl::DoRenderColorImage(const ColorRenderCamera& camera,
                                         ImageRgba8U* color_image_out) const {
   opengl_context_->MakeCurrent();
 
+  const RenderTarget render_target =
+      GetRenderTarget(camera.core(), RenderType::kColor);
+  DrawColorImage(camera, X_CW_, render_target);
+  ReadBackImage(render_target, RenderType::kColor, &camera, color_image_out,
+                color_image_out->size(), color_image_out->at(0, 0));
+}
+
+void RenderEngineGl::DrawColorImage(const ColorRenderCamera& camera,
+                                    const RigidTransformd& X_CW,
+                                    const RenderTarget& render_target) const {
+  CullGeometries(camera.core(), X_CW);
   // TODO(SeanCurtis-TRI): For transparency to work properly, I need to
   //  segregate objects with transparency from those without. The transparent
   //  geometries then need to be sorted from farthest to nearest the camera and
@@ -683,8 +944,6 @@ void RenderEngineGl::DoRenderColorImage(const ColorRenderCamera& camera,
   //  ordering, I may not necessarily see objects through transparent surfaces.
   //  Confirm that VTK handles transparency correctly and do the same.
 
-  const RenderTarget render_target =
-      GetRenderTarget(camera.core(), RenderType::kColor);
   // TODO(SeanCurtis-TRI) Consider converting Rgba to float[4] as a method on
   //  Rgba.
   const Rgba& clear = parameters_.default_clear_color;
@@ -712,7 +971,7 @@ void RenderEngineGl::DoRenderColorImage(const ColorRenderCamera& camera,
     shader_program.SetProjectionMatrix(T_DC);
 
     // Now I need to render the geometries.
-    RenderAt(shader_program, RenderType::kColor);
+    RenderAt(shader_program, RenderType::kColor, X_CW);
     shader_program.Unuse();
   }
   glDisable(GL_BLEND);
@@ -722,8 +981,6 @@ void RenderEngineGl::DoRenderColorImage(const ColorRenderCamera& camera,
   // the front buffer; reversing the order means the image we've just rendered
   // wouldn't be visible.
   SetWindowVisibility(camera.core(), camera.show_window(), render_target);
-  glGetTextureImage(render_target.value_texture, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-                    color_image_out->size(), color_image_out->at(0, 0));
 }
 
 void RenderEngineGl::DoRenderDepthImage(const DepthRenderCamera& camera,
@@ -732,7 +989,16 @@ void RenderEngineGl::DoRenderDepthImage(const DepthRenderCamera& camera,
 
   const RenderTarget render_target =
       GetRenderTarget(camera.core(), RenderType::kDepth);
+  DrawDepthImage(camera, X_CW_, render_target);
+  ReadBackImage(render_target, RenderType::kDepth, &camera, depth_image_out,
+                depth_image_out->size() * sizeof(GLfloat),
+                depth_image_out->at(0, 0));
+}
 
+void RenderEngineGl::DrawDepthImage(const DepthRenderCamera& camera,
+                                    const RigidTransformd& X_CW,
+                                    const RenderTarget& render_target) const {
+  CullGeometries(camera.core(), X_CW);
   // We initialize the color buffer to be all "too far" values. This is the
   // pixel value if nothing draws there -- i.e., nothing there implies that
   // whatever *might* be there is "too far" beyond the depth range.
@@ -751,14 +1017,10 @@ void RenderEngineGl::DoRenderDepthImage(const DepthRenderCamera& camera,
 
     shader_program.SetProjectionMatrix(T_DC);
     shader_program.SetDepthCameraParameters(camera);
-    RenderAt(shader_program, RenderType::kDepth);
+    RenderAt(shader_program, RenderType::kDepth, X_CW);
 
     shader_program.Unuse();
   }
-
-  glGetTextureImage(render_target.value_texture, 0, GL_RED, GL_FLOAT,
-                    depth_image_out->size() * sizeof(GLfloat),
-                    depth_image_out->at(0, 0));
 }
 
 void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera,
@@ -767,6 +1029,18 @@ void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera,
 
   const RenderTarget render_target =
       GetRenderTarget(camera.core(), RenderType::kLabel);
+  DrawLabelImage(camera, X_CW_, render_target);
+  // TODO(SeanCurtis-TRI): Apparently, we *should* be able to create a frame
+  // buffer texture consisting of a single-channel, 16-bit, signed int (to match
+  // the underlying RenderLabel value). Doing so would allow us to render labels
+  // directly and eliminate this additional pass.
+  GetLabelImage(label_image_out, camera, render_target);
+}
+
+void RenderEngineGl::DrawLabelImage(const ColorRenderCamera& camera,
+                                    const RigidTransformd& X_CW,
+                                    const RenderTarget& render_target) const {
+  CullGeometries(camera.core(), X_CW);
   // TODO(SeanCurtis-TRI) Consider converting Rgba to float[4] as a member.
   const ColorD empty_color =
       RenderEngine::GetColorDFromLabel(RenderLabel::kEmpty);
@@ -787,7 +1061,7 @@ void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera,
     shader_program.Use();
 
     shader_program.SetProjectionMatrix(T_DC);
-    RenderAt(shader_program, RenderType::kLabel);
+    RenderAt(shader_program, RenderType::kLabel, X_CW);
 
     shader_program.Unuse();
   }
@@ -797,11 +1071,6 @@ void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera,
   // the front buffer; reversing the order means the image we've just rendered
   // wouldn't be visible.
   SetWindowVisibility(camera.core(), camera.show_window(), render_target);
-  // TODO(SeanCurtis-TRI): Apparently, we *should* be able to create a frame
-  // buffer texture consisting of a single-channel, 16-bit, signed int (to match
-  // the underlying RenderLabel value). Doing so would allow us to render labels
-  // directly and eliminate this additional pass.
-  GetLabelImage(label_image_out, render_target);
 }
 
 void RenderEngineGl::ImplementGeometry(const OpenGlGeometry& geometry,
@@ -820,6 +1089,15 @@ void RenderEngineGl::ImplementGeometry(const OpenGlGeometry& geometry,
                    OpenGlInstance(geometry, data.X_WG, scale, *color_data,
                                   *depth_data, *label_data));
 
+  // The bounds of the scaled geometry; a negative scale factor swaps the
+  // extremes along its axis.
+  const Vector3d corner_a = geometry.bounds.min().cwiseProduct(scale);
+  const Vector3d corner_b = geometry.bounds.max().cwiseProduct(scale);
+  culler_.AddGeometry(data.id,
+                      Eigen::AlignedBox3d(corner_a.cwiseMin(corner_b),
+                                          corner_a.cwiseMax(corner_b)),
+                      data.X_WG);
+
   shader_families_[RenderType::kColor][color_data->shader_id()].push_back(
       data.id);
   shader_families_[RenderType::kDepth][depth_data->shader_id()].push_back(
@@ -974,16 +1252,73 @@ RenderTarget RenderEngineGl::CreateRenderTarget(const RenderCameraCore& camera,
 }
 
 void RenderEngineGl::GetLabelImage(ImageLabel16I* label_image_out,
+                                   const ColorRenderCamera& camera,
                                    const RenderTarget& target) const {
   ImageRgba8U image(label_image_out->width(), label_image_out->height());
-  glGetTextureImage(target.value_texture, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-                    image.size() * sizeof(GLubyte), image.at(0, 0));
+  ReadBackImage(target, RenderType::kLabel, &camera, label_image_out,
+                image.size() * sizeof(GLubyte), image.at(0, 0));
+  DecodeLabelImage(image.at(0, 0), label_image_out);
+}
+
+void RenderEngineGl::ReadBackImage(const RenderTarget& target,
+                                   RenderType render_type, const void* camera,
+                                   const void* image, GLsizei size,
+                                   void* pixels) const {
+  auto [internal_format, format, pixel_type] = get_texture_format(render_type);
+  unused(internal_format);
+  if (!parameters_.pipelined_readback) {
+    glGetTextureImage(target.value_texture, 0, format, pixel_type, size,
+                      pixels);
+    return;
+  }
+
+  PipelinedReadback& stream =
+      pipelined_readbacks_[{render_type, camera, image}];
+  if (stream.size != size) {
+    if (stream.buffers[0] == 0) {
+      glCreateBuffers(2, stream.buffers.data());
+    }
+    for (GLuint buffer : stream.buffers) {
+      glNamedBufferData(buffer, size, nullptr, GL_STREAM_READ);
+    }
+    stream.size = size;
+    stream.has_previous = false;
+  }
+
+  // Queue the copy of this image; with a pixel pack buffer bound, the last
+  // argument is an offset into the buffer and the call doesn't wait for the
+  // GPU. Flushing makes sure the GPU starts on it while we return.
+  const GLuint current = stream.buffers[stream.next];
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, current);
+  glGetTextureImage(target.value_texture, 0, format, pixel_type, size,
+                    nullptr);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  glFlush();
+
+  // Deliver the previous image. Only the very first image of a stream has to
+  // wait for its own copy.
+  const GLuint deliver =
+      stream.has_previous ? stream.buffers[1 - stream.next] : current;
+  const void* data = glMapNamedBufferRange(deliver, 0, size, GL_MAP_READ_BIT);
+  if (data == nullptr) {
+    throw std::runtime_error(
+        "RenderEngineGl: failed to map a pipelined readback buffer");
+  }
+  std::memcpy(pixels, data, size);
+  glUnmapNamedBuffer(deliver);
+  stream.has_previous = true;
+  stream.next = 1 - stream.next;
+}
+
+void RenderEngineGl::DecodeLabelImage(const GLubyte* rgba,
+                                      ImageLabel16I* label_image_out) const {
   ColorI color;
-  for (int y = 0; y < image.height(); ++y) {
-    for (int x = 0; x < image.width(); ++x) {
-      color.r = image.at(x, y)[0];
-      color.g = image.at(x, y)[1];
-      color.b = image.at(x, y)[2];
+  for (int y = 0; y < label_image_out->height(); ++y) {
+    for (int x = 0; x < label_image_out->width(); ++x) {
+      const GLubyte* pixel = rgba + 4 * (y * label_image_out->width() + x);
+      color.r = pixel[0];
+      color.g = pixel[1];
+      color.b = pixel[2];
       *label_image_out->at(x, y) = RenderEngine::LabelFromColor(color);
     }
   }
@@ -1008,6 +1343,20 @@ RenderTarget RenderEngineGl::GetRenderTarget(const RenderCameraCore& camera,
   return target;
 }
 
+RenderTarget RenderEngineGl::GetBatchRenderTarget(
+    const RenderCameraCore& camera, RenderType render_type, int index) const {
+  const auto& intrinsics = camera.intrinsics();
+  const BufferDim dim{intrinsics.width(), intrinsics.height()};
+  std::vector<RenderTarget>& targets = batch_frame_buffers_[render_type][dim];
+  while (static_cast<int>(targets.size()) <= index) {
+    targets.push_back(CreateRenderTarget(camera, render_type));
+  }
+  const RenderTarget& target = targets[index];
+  glBindFramebuffer(GL_FRAMEBUFFER, target.frame_buffer);
+  glViewport(0, 0, intrinsics.width(), intrinsics.height());
+  return target;
+}
+
 OpenGlGeometry RenderEngineGl::CreateGlGeometry(const MeshData& mesh_data) {
   OpenGlGeometry geometry;
   // Create the vertex array object (VAO).
@@ -1035,6 +1384,10 @@ OpenGlGeometry RenderEngineGl::CreateGlGeometry(const MeshData& mesh_data) {
                      mesh_data.normals.data() + v_count * kFloatsPerNormal);
   vertex_data.insert(vertex_data.end(), mesh_data.uvs.data(),
                      mesh_data.uvs.data() + v_count * kFloatsPerUv);
+  for (int v = 0; v < v_count; ++v) {
+    geometry.bounds.extend(
+        mesh_data.positions.row(v).transpose().cast<double>());
+  }
   glNamedBufferStorage(geometry.vertex_buffer,
                        vertex_data.size() * sizeof(GLfloat),
                        vertex_data.data(), 0);
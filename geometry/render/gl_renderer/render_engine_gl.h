@@ -3,9 +3,11 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "drake/common/eigen_types.h"
@@ -18,6 +20,7 @@
 #include "drake/geometry/render/gl_renderer/shader_program.h"
 #include "drake/geometry/render/gl_renderer/shape_meshes.h"
 #include "drake/geometry/render/gl_renderer/texture_library.h"
+#include "drake/geometry/render/frustum_culler.h"
 #include "drake/geometry/render/render_engine.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/systems/sensors/image.h"
@@ -51,6 +54,44 @@ class RenderEngineGl final : public RenderEngine {
 
   const RenderEngineGlParams& parameters() const { return parameters_; }
 
+  /** Reports the frustum culling performed for the most recently drawn image
+   (of any type). Geometries whose bounding boxes lie outside the camera's view
+   frustum are skipped without being drawn.  */
+  const FrustumCullingStatistics& culling_statistics() const {
+    return culling_statistics_;
+  }
+
+  /** The images to produce for a single camera in a call to RenderImages().
+   Each output image may be nullptr, in which case that image type is not
+   rendered for this camera.  */
+  struct ImageRequest {
+    /** The pose of the camera in the world frame.  */
+    math::RigidTransformd X_WC;
+    /** The camera for the color and label images. Required if either of them
+     is requested.  */
+    std::optional<ColorRenderCamera> color_camera;
+    /** The camera for the depth image. Required if it is requested.  */
+    std::optional<DepthRenderCamera> depth_camera;
+    systems::sensors::ImageRgba8U* color_image{};
+    systems::sensors::ImageDepth32F* depth_image{};
+    systems::sensors::ImageLabel16I* label_image{};
+  };
+
+  /** Renders the images of several cameras as a single batch. The result is
+   the same as calling UpdateViewpoint(request.X_WC) followed by
+   RenderColorImage(), RenderDepthImage() and RenderLabelImage() for each
+   request in turn, but the work is submitted differently: every image is
+   drawn into its own render target before any pixels are read, all of them
+   are then copied into one pixel buffer object, and the GPU is synchronized
+   with only once for the whole batch (rather than once per image).
+
+   The viewpoint set by UpdateViewpoint() is not used or modified.
+
+   @throws std::exception if an image is requested without the corresponding
+                          camera, or if an image's size doesn't match the size
+                          declared by its camera.  */
+  void RenderImages(const std::vector<ImageRequest>& requests) const;
+
   /** @name    Shape reification  */
   //@{
   using RenderEngine::ImplementGeometry;
@@ -109,9 +150,36 @@ class RenderEngineGl final : public RenderEngine {
   RenderEngineGl(const RenderEngineGl& other) = default;
 
   // Renders all geometries which use the given shader program for the given
-  // render type.
+  // render type, as seen from the camera whose pose is X_WC = X_CW⁻¹.
   void RenderAt(const internal::ShaderProgram& shader_program,
-                internal::RenderType render_type) const;
+                internal::RenderType render_type,
+                const math::RigidTransformd& X_CW) const;
+
+  // The RenderAt() implementation for shaders that support instancing. The
+  // geometries are grouped by the OpenGl geometry they share (e.g., all
+  // spheres, all instances of a single mesh file); each group with more than
+  // one member is drawn with a single instanced draw call.
+  void RenderInstancedAt(const internal::ShaderProgram& shader_program,
+                         internal::RenderType render_type,
+                         const math::RigidTransformd& X_CW) const;
+
+  // Determines the geometries visible to the camera at X_WC = X_CW⁻¹, storing
+  // them in visible_ for RenderAt() and updating culling_statistics_.
+  void CullGeometries(const RenderCameraCore& camera,
+                      const math::RigidTransformd& X_CW) const;
+
+  // Clears the given (already bound) render target and draws the color, depth,
+  // or label image into it, as seen from the camera at X_WC = X_CW⁻¹. The
+  // color and label variants also update the display window.
+  void DrawColorImage(const ColorRenderCamera& camera,
+                      const math::RigidTransformd& X_CW,
+                      const internal::RenderTarget& target) const;
+  void DrawDepthImage(const DepthRenderCamera& camera,
+                      const math::RigidTransformd& X_CW,
+                      const internal::RenderTarget& target) const;
+  void DrawLabelImage(const ColorRenderCamera& camera,
+                      const math::RigidTransformd& X_CW,
+                      const internal::RenderTarget& target) const;
 
   // Performs the common setup for all shape types.
   void ImplementGeometry(const internal::OpenGlGeometry& geometry,
@@ -149,14 +217,37 @@ class RenderEngineGl final : public RenderEngine {
   // slower than it has to be because it does per-pixel processing on the CPU.
   // TODO(SeanCurtis-TRI): Figure out how to do all of this directly on the GPU.
   void GetLabelImage(drake::systems::sensors::ImageLabel16I* label_image_out,
+                     const ColorRenderCamera& camera,
                      const internal::RenderTarget& target) const;
 
+  // Reads the image drawn into `target` back into `pixels`, which holds
+  // `size` bytes in the format given by get_texture_format(render_type). When
+  // parameters_.pipelined_readback is set, the copy is only queued, and the
+  // image written to `pixels` is the one queued by the previous call with the
+  // same render type, `camera`, and `image` (see RenderEngineGlParams).
+  void ReadBackImage(const internal::RenderTarget& target,
+                     internal::RenderType render_type, const void* camera,
+                     const void* image, GLsizei size, void* pixels) const;
+
+  // Decodes the RGBA-encoded labels in `rgba` (four bytes per pixel, in the
+  // same pixel order as `label_image_out`) into `label_image_out`.
+  void DecodeLabelImage(const GLubyte* rgba,
+                        drake::systems::sensors::ImageLabel16I* label_image_out)
+      const;
+
   // Acquires the render target for the given camera. "Acquiring" the render
   // target guarantees that the target will be ready for receiving OpenGL
   // draw commands.
   internal::RenderTarget GetRenderTarget(
       const RenderCameraCore& camera, internal::RenderType render_type) const;
 
+  // Acquires the `index`'th render target used by RenderImages() for the
+  // camera's image size and the given render type, creating it if necessary.
+  // As with GetRenderTarget(), the target is bound and ready for drawing.
+  internal::RenderTarget GetBatchRenderTarget(const RenderCameraCore& camera,
+                                              internal::RenderType render_type,
+                                              int index) const;
+
   // Creates an OpenGlGeometry from the mesh defined by the given `mesh_data`.
   static internal::OpenGlGeometry CreateGlGeometry(
       const internal::MeshData& mesh_data);
@@ -259,6 +350,45 @@ class RenderEngineGl final : public RenderEngine {
       internal::RenderType::kTypeCount>
       frame_buffers_;
 
+  // The render targets used by RenderImages(). A batch draws all of its
+  // images before reading any of them back, so it needs one target per image
+  // rather than one per image size; the n'th image of a given size and type in
+  // a batch uses the n'th target in the corresponding vector. Like
+  // frame_buffers_, these are shared by copies of this render engine.
+  mutable std::array<std::unordered_map<internal::BufferDim,
+                                        std::vector<internal::RenderTarget>>,
+                     internal::RenderType::kTypeCount>
+      batch_frame_buffers_;
+
+  // The pixel buffer object into which RenderImages() copies all of a batch's
+  // images. It is created on first use and grown as needed.
+  mutable GLuint readback_buffer_{0};
+
+  // The vertex buffer into which RenderInstancedAt() writes the per-instance
+  // model view matrices of all instanced batches. It is created on first use
+  // and grown as needed.
+  mutable GLuint instance_buffer_{0};
+
+  // The double-buffered pixel buffer objects of one pipelined readback stream
+  // (see RenderEngineGlParams::pipelined_readback).
+  struct PipelinedReadback {
+    std::array<GLuint, 2> buffers{};
+    // The size of each buffer, in bytes.
+    GLsizei size{0};
+    // The index of the buffer that receives the next image; the other one
+    // holds the previous image (if there has been one).
+    int next{0};
+    bool has_previous{false};
+  };
+
+  // The pipelined readback streams, keyed on (render type, camera address,
+  // image address). Unlike the render targets, these are *not* shared with
+  // clones; DoClone() resets them so that clones never deliver each other's
+  // images.
+  mutable std::map<std::tuple<int, const void*, const void*>,
+                   PipelinedReadback>
+      pipelined_readbacks_;
+
   // Mapping from GeometryId to the visual data associated with that geometry.
   // When copying the render engine, this data is copied verbatim allowing the
   // copied render engine access to the same OpenGL objects in the OpenGL
@@ -266,6 +396,15 @@ class RenderEngineGl final : public RenderEngine {
   // modify their copy of visuals_ (adding and removing geometries).
   std::unordered_map<GeometryId, internal::OpenGlInstance> visuals_;
 
+  // The world-aligned bounds of visuals_, for frustum culling. Like visuals_,
+  // each copy of the render engine has its own.
+  internal::FrustumCuller culler_;
+
+  // The geometries that survived culling for the image being drawn, and the
+  // statistics for the most recent image.
+  mutable std::unordered_set<GeometryId> visible_;
+  mutable FrustumCullingStatistics culling_statistics_;
+
   // The direction *to* the light expressed in the camera frame.
   Vector3<float> light_dir_C_{0.0f, 0.0f, 1.0f};
 };
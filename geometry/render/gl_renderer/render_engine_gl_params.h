@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 #include "drake/geometry/render/render_label.h"
 #include "drake/geometry/rgba.h"
 
@@ -19,6 +21,33 @@ struct RenderEngineGlParams {
 
   /** The default background color for color images.  */
   Rgba default_clear_color{204 / 255., 229 / 255., 255 / 255., 1.0};
+
+  /** If true, images are read back from the GPU asynchronously, with a latency
+   of one render call. Each call to RenderColorImage(), RenderDepthImage() or
+   RenderLabelImage() queues the copy of the image it has just drawn into a
+   pixel buffer object and returns immediately with the image drawn by the
+   *previous* call for the same stream, which the GPU has long since finished.
+   A stream is identified by the image type and the addresses of the camera
+   and output image objects; this is stable for the images produced by a
+   systems::sensors::RgbdSensorDiscrete, for which the result is an explicit
+   one-period latency. The first call for a stream has no previous image, so
+   it waits for (and returns) its own.
+
+   If false, every call waits for the GPU to finish its own image.  */
+  bool pipelined_readback{false};
+
+  /** The windowing-system interface used to create the OpenGL context. The
+   valid values are:
+
+   - "GLX": Requires an X display (e.g., a desktop session or Xvfb). Supports
+     displaying render windows (see RenderCameraCore::show_window()).
+   - "EGL": Uses the first available EGL device (EGL_EXT_platform_device), so
+     no display server is needed; e.g., it runs directly on a GPU inside a
+     headless container. Render windows cannot be shown; rendering with a
+     camera that requests a window throws.
+
+   Any other value causes the RenderEngineGl constructor to throw.  */
+  std::string backend{"GLX"};
 };
 
 }  // namespace render
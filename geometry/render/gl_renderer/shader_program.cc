@@ -8,6 +8,8 @@
 
 #include <fmt/format.h>
 
+#include "drake/common/drake_assert.h"
+
 namespace drake {
 namespace geometry {
 namespace render {
@@ -86,6 +88,17 @@ void ShaderProgram::LoadFromSources(const std::string& vertex_shader_source,
 
   projection_matrix_loc_ = GetUniformLocation("T_DC");
   model_view_loc_ = GetUniformLocation("T_CM");
+
+  use_instance_loc_ = -1;
+  const GLint instance_attrib = glGetAttribLocation(gl_id_, "T_CM_instance");
+  if (instance_attrib >= 0) {
+    if (instance_attrib != static_cast<GLint>(kInstanceModelViewAttrib)) {
+      throw std::runtime_error(fmt::format(
+          "The shader attribute 'T_CM_instance' must be at location {}; it is "
+          "at location {}", kInstanceModelViewAttrib, instance_attrib));
+    }
+    use_instance_loc_ = GetUniformLocation("use_T_CM_instance");
+  }
 }
 
 namespace {
@@ -109,23 +122,38 @@ void ShaderProgram::SetProjectionMatrix(const Eigen::Matrix4f& T_DC) const {
   glUniformMatrix4fv(projection_matrix_loc_, 1, GL_FALSE, T_DC.data());
 }
 
-void ShaderProgram::SetModelViewMatrix(const Eigen::Matrix4f& X_CM,
-                                       const Vector3d& scale) const {
-  const Eigen::DiagonalMatrix<float, 4, 4> scale_mat(
-      Vector4<float>(scale(0), scale(1), scale(2), 1.0));
-  // Our camera frame C wrt the OpenGL's camera frame Cgl.
-  // clang-format off
+namespace {
+// Our camera frame C wrt the OpenGL's camera frame Cgl.
+// clang-format off
+const Eigen::Matrix4f& X_CglC() {
   static const Eigen::Matrix4f kX_CglC =
       (Eigen::Matrix4f() << 1,  0,  0, 0,
                             0, -1,  0, 0,
                             0,  0, -1, 0,
                             0,  0,  0, 1)
           .finished();
-  // clang-format on
-  const Eigen::Matrix4f X_CglM = kX_CglC * X_CM;
-  Eigen::Matrix4f T_CglM = X_CglM * scale_mat;
+  return kX_CglC;
+}
+// clang-format on
+}  // namespace
+
+void ShaderProgram::SetModelViewMatrix(const Eigen::Matrix4f& X_CM,
+                                       const Vector3d& scale) const {
+  const Eigen::Matrix4f T_CglM = CalcModelViewMatrix(X_CM, scale);
   glUniformMatrix4fv(model_view_loc_, 1, GL_FALSE, T_CglM.data());
-  DoModelViewMatrix(X_CglM, scale);
+  DoModelViewMatrix(X_CglC() * X_CM, scale);
+}
+
+Eigen::Matrix4f ShaderProgram::CalcModelViewMatrix(const Eigen::Matrix4f& X_CM,
+                                                   const Vector3d& scale) {
+  const Eigen::DiagonalMatrix<float, 4, 4> scale_mat(
+      Vector4<float>(scale(0), scale(1), scale(2), 1.0));
+  return X_CglC() * X_CM * scale_mat;
+}
+
+void ShaderProgram::SetUseInstanceModelView(bool use_instance) const {
+  DRAKE_DEMAND(supports_instancing());
+  glUniform1i(use_instance_loc_, use_instance ? 1 : 0);
 }
 
 GLint ShaderProgram::GetUniformLocation(const std::string& uniform_name) const {
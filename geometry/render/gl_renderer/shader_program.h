@@ -55,7 +55,19 @@ namespace internal {
    - It must specify a uniform mat4 called "T_DC" - this transforms
      vertices from the camera's frame C to the OpenGl normalized device frame
      D. This is a projective transform, taking points in ℜ³ and mapping them
-     to ℜ². */
+     to ℜ².
+
+ A shader can optionally support *instanced* rendering, in which a batch of
+ instances sharing the same OpenGl geometry is drawn with a single call and
+ each instance's model view matrix comes from a per-instance vertex attribute.
+ To do so, in addition to the requirements above, it must:
+   - Declare a vertex attribute `layout(location = 3) in mat4 T_CM_instance`
+     (which occupies locations 3 through 6).
+   - Specify a uniform bool called "use_T_CM_instance". When true, the shader
+     must use `T_CM_instance` in place of the "T_CM" uniform.
+ Because the batch shares a single set of uniforms, an instancing shader should
+ have no per-instance parameters (see SetInstanceParameters()) and should not
+ depend on DoModelViewMatrix(). */
 class ShaderProgram {
  public:
   ShaderProgram() : id_(ShaderId::get_new_id()) {}
@@ -146,6 +158,25 @@ class ShaderProgram {
   void SetModelViewMatrix(const Eigen::Matrix4f& X_CM,
                           const Eigen::Vector3d& scale) const;
 
+  /* Computes the model view matrix T_CglM that SetModelViewMatrix() would
+   upload for the given `X_CM` and `scale`; it is the per-instance value an
+   instancing shader reads from `T_CM_instance`.  */
+  static Eigen::Matrix4f CalcModelViewMatrix(const Eigen::Matrix4f& X_CM,
+                                             const Eigen::Vector3d& scale);
+
+  /* Reports true if this shader supports instanced rendering (see the class
+   documentation for the requirements).  */
+  bool supports_instancing() const { return use_instance_loc_ >= 0; }
+
+  /* Configures an instancing shader to take its model view matrix from the
+   `T_CM_instance` attribute (true) or the "T_CM" uniform (false).
+   @pre supports_instancing() is true.  */
+  void SetUseInstanceModelView(bool use_instance) const;
+
+  /* The vertex attribute location of `T_CM_instance` in shaders that support
+   instancing; a mat4 attribute occupies this and the next three locations.  */
+  static constexpr GLuint kInstanceModelViewAttrib = 3;
+
   /* Provides the location of the named shader uniform parameter.
    @throws std::exception if the named uniform isn't part of the program. */
   GLint GetUniformLocation(const std::string& uniform_name) const;
@@ -202,6 +233,9 @@ class ShaderProgram {
   // *supported* shader.
   GLint projection_matrix_loc_{};
   GLint model_view_loc_{};
+  // Location of the "use_T_CM_instance" uniform; negative if the shader
+  // doesn't support instancing.
+  GLint use_instance_loc_{-1};
 };
 
 }  // namespace internal
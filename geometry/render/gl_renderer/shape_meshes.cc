@@ -6,6 +6,7 @@
 #include <iostream>
 #include <limits>
 #include <map>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -16,6 +17,7 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/text_logging.h"
+#include "drake/geometry/read_obj.h"
 
 namespace drake {
 namespace geometry {
@@ -30,32 +32,12 @@ using std::string;
 using std::tuple;
 using std::vector;
 
-MeshData LoadMeshFromObj(std::istream* input_stream,
-                         const std::string& filename) {
-  tinyobj::attrib_t attrib;
-  vector<tinyobj::shape_t> shapes;
-  vector<tinyobj::material_t> materials;
-  string warn;
-  string err;
-  /* This renderer assumes everything is triangles -- we rely on tinyobj to
-   triangulate for us. */
-  const bool do_tinyobj_triangulation = true;
-
-  drake::log()->trace("LoadMeshFromObj('{}')", filename);
-
-  /* Tinyobj doesn't infer the search directory from the directory containing
-   the obj file. We have to provide that directory; of course, this assumes
-   that the material library reference is relative to the obj directory.
-   Ignore material-library file.  */
-  tinyobj::MaterialReader* material_reader = nullptr;
-  const bool ret =
-      tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, input_stream,
-                       material_reader, do_tinyobj_triangulation);
-  if (!ret) {
-    throw std::runtime_error(
-        fmt::format("tinyobj::LoadObj failed to load file: {}", filename));
-  }
+namespace {
 
+/* Converts the parse of the OBJ data read from `filename` into MeshData. */
+MeshData ObjDataToMeshData(const tinyobj::attrib_t& attrib,
+                           const vector<tinyobj::shape_t>& shapes,
+                           const std::string& filename) {
   if (shapes.empty()) {
     throw std::runtime_error(fmt::format(
         "The OBJ data appears to have no faces; it could be missing faces or "
@@ -205,13 +187,56 @@ MeshData LoadMeshFromObj(std::istream* input_stream,
   return mesh_data;
 }
 
+}  // namespace
+
+MeshData LoadMeshFromObj(std::istream* input_stream,
+                         const std::string& filename) {
+  tinyobj::attrib_t attrib;
+  vector<tinyobj::shape_t> shapes;
+  vector<tinyobj::material_t> materials;
+  string warn;
+  string err;
+  /* This renderer assumes everything is triangles -- we rely on tinyobj to
+   triangulate for us. */
+  const bool do_tinyobj_triangulation = true;
+
+  drake::log()->trace("LoadMeshFromObj('{}')", filename);
+
+  /* Tinyobj doesn't infer the search directory from the directory containing
+   the obj file. We have to provide that directory; of course, this assumes
+   that the material library reference is relative to the obj directory.
+   Ignore material-library file.  */
+  tinyobj::MaterialReader* material_reader = nullptr;
+  const bool ret =
+      tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, input_stream,
+                       material_reader, do_tinyobj_triangulation);
+  if (!ret) {
+    throw std::runtime_error(
+        fmt::format("tinyobj::LoadObj failed to load file: {}", filename));
+  }
+
+  return ObjDataToMeshData(attrib, shapes, filename);
+}
+
 MeshData LoadMeshFromObj(const string& filename) {
   std::ifstream input_stream(filename);
   if (!input_stream.is_open()) {
     throw std::runtime_error(
         fmt::format("Cannot load the obj file '{}'", filename));
   }
-  return LoadMeshFromObj(&input_stream, filename);
+  input_stream.close();
+
+  drake::log()->trace("LoadMeshFromObj('{}')", filename);
+
+  /* The parse is shared with the other geometry consumers of the same file;
+   the materials it references are ignored. */
+  const std::shared_ptr<const geometry::internal::ObjFileData> data =
+      geometry::internal::GetObjFileData(filename, true /* triangulate */);
+  if (!data->success) {
+    throw std::runtime_error(
+        fmt::format("tinyobj::LoadObj failed to load file: {}", filename));
+  }
+  return ObjDataToMeshData(data->attrib, data->shapes, filename);
 }
 
 namespace {
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/expect_throws_message.h"
+
 namespace drake {
 namespace geometry {
 namespace render {
@@ -50,6 +52,27 @@ GTEST_TEST(OpenGlContext, WindowVisibility) {
   EXPECT_FALSE(opengl_context.IsWindowViewable());
 }
 
+// Tests the headless EGL backend: the context can be made current, is
+// independent of a GLX context, and has no window.
+GTEST_TEST(OpenGlContext, EglBackend) {
+  OpenGlContext glx_context;
+  OpenGlContext egl_context(false, OpenGlBackend::kEgl);
+  egl_context.MakeCurrent();
+  EXPECT_GT(OpenGlContext::max_allowable_texture_size(), 0);
+  EXPECT_FALSE(glIsEnabled(GL_BLEND));
+  glEnable(GL_BLEND);
+  EXPECT_TRUE(glIsEnabled(GL_BLEND));
+  glx_context.MakeCurrent();
+  EXPECT_FALSE(glIsEnabled(GL_BLEND));
+  egl_context.MakeCurrent();
+  EXPECT_TRUE(glIsEnabled(GL_BLEND));
+
+  EXPECT_FALSE(egl_context.IsWindowViewable());
+  EXPECT_NO_THROW(egl_context.HideWindow());
+  DRAKE_EXPECT_THROWS_MESSAGE(egl_context.DisplayWindow(640, 480),
+                              ".*cannot display a window with the EGL.*");
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace render
@@ -3,6 +3,7 @@
 #include <array>
 #include <cstring>
 #include <unordered_map>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -719,6 +720,182 @@ TEST_F(RenderEngineGlTest, SphereTest) {
   }
 }
 
+// Spheres all share a single OpenGl geometry, so the depth shader draws them
+// with one instanced draw call. Additional spheres hidden beneath the terrain
+// must leave the sphere test's images unchanged; this confirms that each
+// instance's pose comes through the per-instance buffer.
+TEST_F(RenderEngineGlTest, InstancedSphereTest) {
+  Init(X_WR_, true);
+  PopulateSphereTest(renderer_.get());
+  for (int i = 0; i < 5; ++i) {
+    const GeometryId id = GeometryId::get_new_id();
+    renderer_->RegisterVisual(id, Sphere(0.25), simple_material(),
+                              RigidTransformd::Identity(), true);
+    X_WV_.insert({id, RigidTransformd{Vector3d{0.2 * i, -0.1 * i, -1.0}}});
+  }
+  renderer_->UpdatePoses(X_WV_);
+
+  SCOPED_TRACE("Instanced sphere test");
+  PerformCenterShapeTest(renderer_.get());
+}
+
+// Confirms that a batch of images rendered with RenderImages() matches the
+// images rendered one at a time, for cameras of equal and differing sizes.
+TEST_F(RenderEngineGlTest, RenderImagesBatch) {
+  Init(X_WR_, true);
+  PopulateSphereTest(renderer_.get());
+
+  const DepthRenderCamera small_camera{
+      {"small", {kWidth / 2, kHeight / 2, kFovY}, {kClipNear, kClipFar}, {}},
+      {kZNear, kZFar}};
+  const std::vector<const DepthRenderCamera*> cameras{
+      &depth_camera_, &small_camera, &depth_camera_};
+
+  std::vector<ImageRgba8U> colors;
+  std::vector<ImageDepth32F> depths;
+  std::vector<ImageLabel16I> labels;
+  for (const DepthRenderCamera* camera : cameras) {
+    const int w = camera->core().intrinsics().width();
+    const int h = camera->core().intrinsics().height();
+    colors.emplace_back(w, h);
+    depths.emplace_back(w, h);
+    labels.emplace_back(w, h);
+  }
+  std::vector<RenderEngineGl::ImageRequest> requests;
+  for (int i = 0; i < static_cast<int>(cameras.size()); ++i) {
+    RenderEngineGl::ImageRequest request;
+    request.X_WC = X_WR_;
+    request.color_camera = ColorRenderCamera(cameras[i]->core(), kShowWindow);
+    request.depth_camera = *cameras[i];
+    request.color_image = &colors[i];
+    request.depth_image = &depths[i];
+    request.label_image = &labels[i];
+    requests.push_back(request);
+  }
+  // Moving the engine's own viewpoint must not affect the batch.
+  renderer_->UpdateViewpoint(RigidTransformd::Identity());
+  renderer_->RenderImages(requests);
+  renderer_->UpdateViewpoint(X_WR_);
+
+  for (int i = 0; i < static_cast<int>(cameras.size()); ++i) {
+    SCOPED_TRACE(fmt::format("RenderImagesBatch: camera {}", i));
+    VerifyCenterShapeTest(*renderer_, *cameras[i], colors[i], depths[i],
+                          labels[i]);
+
+    const int w = cameras[i]->core().intrinsics().width();
+    const int h = cameras[i]->core().intrinsics().height();
+    ImageRgba8U color(w, h);
+    ImageDepth32F depth(w, h);
+    ImageLabel16I label(w, h);
+    Render(renderer_.get(), cameras[i], &color, &depth, &label);
+    EXPECT_EQ(std::memcmp(color.at(0, 0), colors[i].at(0, 0),
+                          color.size() * sizeof(uint8_t)), 0);
+    EXPECT_EQ(std::memcmp(depth.at(0, 0), depths[i].at(0, 0),
+                          depth.size() * sizeof(float)), 0);
+    EXPECT_EQ(std::memcmp(label.at(0, 0), labels[i].at(0, 0),
+                          label.size() * sizeof(int16_t)), 0);
+  }
+
+  // A requested image needs its camera.
+  RenderEngineGl::ImageRequest bad_request;
+  bad_request.label_image = &label_;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      renderer_->RenderImages({bad_request}),
+      ".*label image was requested without a color camera");
+}
+
+// Geometry behind the camera is culled without affecting the images; the
+// culling is reported in the statistics.
+TEST_F(RenderEngineGlTest, FrustumCulling) {
+  Init(X_WR_, true);
+  PopulateSphereTest(renderer_.get());
+  const GeometryId behind_id = GeometryId::get_new_id();
+  renderer_->RegisterVisual(behind_id, Sphere(0.25), simple_material(),
+                            RigidTransformd::Identity(), true);
+  X_WV_.insert({behind_id, X_WR_ * RigidTransformd(Vector3d(0, 0, -1))});
+  renderer_->UpdatePoses(X_WV_);
+
+  SCOPED_TRACE("Frustum culling test");
+  PerformCenterShapeTest(renderer_.get());
+  // The terrain, the sphere in view, and the culled sphere behind the camera.
+  EXPECT_EQ(renderer_->culling_statistics().num_geometries, 3);
+  EXPECT_EQ(renderer_->culling_statistics().num_culled, 1);
+
+  // Once removed, there is nothing left to cull.
+  renderer_->RemoveGeometry(behind_id);
+  PerformCenterShapeTest(renderer_.get());
+  EXPECT_EQ(renderer_->culling_statistics().num_geometries, 2);
+  EXPECT_EQ(renderer_->culling_statistics().num_culled, 0);
+}
+
+// Confirms that the headless EGL backend renders the same images as the
+// default GLX backend, and that an unknown backend is rejected.
+TEST_F(RenderEngineGlTest, EglBackend) {
+  RenderEngineGlParams params;
+  params.default_clear_color = kBgColor;
+  params.backend = "EGL";
+  RenderEngineGl renderer(params);
+  InitializeRenderer(X_WR_, true /* add terrain */, &renderer);
+  PopulateSphereTest(&renderer);
+  SCOPED_TRACE("EGL sphere test");
+  PerformCenterShapeTest(&renderer);
+
+  params.backend = "WGL";
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RenderEngineGl{params},
+      "RenderEngineGlParams::backend must be \"GLX\" or \"EGL\"; got \"WGL\"");
+}
+
+// Confirms that with pipelined readback, each render call delivers the image
+// drawn by the previous call for the same camera and image.
+TEST_F(RenderEngineGlTest, PipelinedReadback) {
+  RenderEngineGlParams params;
+  params.default_clear_color = kBgColor;
+  params.pipelined_readback = true;
+  RenderEngineGl renderer(params);
+  InitializeRenderer(X_WR_, true /* add terrain */, &renderer);
+  PopulateSphereTest(&renderer);
+  const ScreenCoord inlier = GetInlier(depth_camera_.core().intrinsics());
+
+  // Streams are identified by the camera's address, so the same camera
+  // objects must be used for every call.
+  const ColorRenderCamera color_camera(depth_camera_.core(), kShowWindow);
+  auto render = [&](ImageRgba8U* color, ImageDepth32F* depth,
+                    ImageLabel16I* label) {
+    renderer.RenderColorImage(color_camera, color);
+    renderer.RenderDepthImage(depth_camera_, depth);
+    renderer.RenderLabelImage(color_camera, label);
+  };
+
+  // The first call has no previous image, so it returns its own.
+  SCOPED_TRACE("PipelinedReadback");
+  render(&color_, &depth_, &label_);
+  VerifyCenterShapeTest(renderer, depth_camera_, color_, depth_, label_);
+
+  // Move the sphere out of view. The next call still delivers the sphere...
+  renderer.UpdatePoses(unordered_map<GeometryId, RigidTransformd>{
+      {geometry_id_, RigidTransformd{Vector3d{100, 0, 0}}}});
+  render(&color_, &depth_, &label_);
+  VerifyCenterShapeTest(renderer, depth_camera_, color_, depth_, label_);
+
+  // ... and the one after that delivers the image without it.
+  render(&color_, &depth_, &label_);
+  EXPECT_TRUE(CompareColor(expected_outlier_color_, color_, inlier));
+  EXPECT_TRUE(IsExpectedDepth(depth_, inlier, expected_outlier_depth_,
+                              kDepthTolerance));
+  EXPECT_EQ(label_.at(inlier.x, inlier.y)[0], expected_outlier_label_);
+
+  // A different output image is a different stream, so it isn't delayed.
+  ImageRgba8U color(kWidth, kHeight);
+  ImageDepth32F depth(kWidth, kHeight);
+  ImageLabel16I label(kWidth, kHeight);
+  render(&color, &depth, &label);
+  EXPECT_TRUE(CompareColor(expected_outlier_color_, color, inlier));
+  EXPECT_TRUE(IsExpectedDepth(depth, inlier, expected_outlier_depth_,
+                              kDepthTolerance));
+  EXPECT_EQ(label.at(inlier.x, inlier.y)[0], expected_outlier_label_);
+}
+
 // Performs the shape-centered-in-the-image test with a transparent sphere.
 TEST_F(RenderEngineGlTest, TransparentSphereTest) {
   RenderEngineGl renderer;
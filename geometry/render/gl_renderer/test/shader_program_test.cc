@@ -279,6 +279,59 @@ TEST_F(ShaderProgramTest, LoadShadersError) {
   }
 }
 
+// Tests the detection of (and requirements on) shaders that support instanced
+// rendering.
+TEST_F(ShaderProgramTest, SupportsInstancing) {
+  {
+    // Case: A shader without the instance attribute doesn't support it.
+    TestShader program;
+    program.LoadFromSources(kVertexSource, kFragmentSource);
+    EXPECT_FALSE(program.supports_instancing());
+  }
+
+  {
+    // Case: A shader with the instance attribute and uniform supports it.
+    TestShader program;
+    program.LoadFromSources(R"""(
+  #version 330
+  layout(location = 3) in mat4 T_CM_instance;
+  uniform mat4 T_CM;
+  uniform mat4 T_DC;
+  uniform bool use_T_CM_instance;
+  out vec4 p_CV;
+  void main() {
+    gl_Position = T_DC * vec4(0.0, 0.0, 0.0, 1.0);
+    p_CV = (use_T_CM_instance ? T_CM_instance : T_CM) *
+        vec4(0.0, 0.0, 0.0, 1.0);
+  }
+)""",
+                            kFragmentSource);
+    EXPECT_TRUE(program.supports_instancing());
+  }
+
+  {
+    // Case: The instance attribute is at the wrong location.
+    TestShader program;
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        program.LoadFromSources(R"""(
+  #version 330
+  layout(location = 4) in mat4 T_CM_instance;
+  uniform mat4 T_CM;
+  uniform mat4 T_DC;
+  uniform bool use_T_CM_instance;
+  out vec4 p_CV;
+  void main() {
+    gl_Position = T_DC * vec4(0.0, 0.0, 0.0, 1.0);
+    p_CV = (use_T_CM_instance ? T_CM_instance : T_CM) *
+        vec4(0.0, 0.0, 0.0, 1.0);
+  }
+)""",
+                                kFragmentSource),
+        "The shader attribute 'T_CM_instance' must be at location 3; it is "
+        "at location 4");
+  }
+}
+
 TEST_F(ShaderProgramTest, UniformAccess) {
   TestShader program;
   program.LoadFromSources(kVertexSource, kFragmentSource);
@@ -415,6 +468,10 @@ TEST_F(ShaderProgramTest, SetModelViewMatrix) {
       Vector4<float>(scale(0), scale(1), scale(2), 1.0));
   const Matrix4f expected_mv_mat = X_CglC * X_CM * scale_mat;
   EXPECT_TRUE(CompareMatrices(expected_mv_mat, gl_mv_mat));
+
+  // The instancing helper computes the same matrix.
+  EXPECT_TRUE(CompareMatrices(ShaderProgram::CalcModelViewMatrix(X_CM, scale),
+                              gl_mv_mat));
 }
 
 // Confirms that the clone contains the same data (including any derived data).
@@ -163,6 +163,27 @@ class RenderEngine : public ShapeReifier {
     }
   }
 
+  /** Variant of UpdatePoses() that only updates the geometries in
+   `moved_ids`; the poses of all other geometries are assumed to be unchanged
+   since the last update. Ids of geometries that are anchored or not
+   registered with `this` engine are ignored.
+
+   @param X_WGs      The poses of *all* geometries in SceneGraph (measured and
+                     expressed in the world frame). The pose for a geometry is
+                     accessed by that geometry's id.
+   @param moved_ids  The ids of the geometries whose poses have changed.  */
+  template <typename T>
+  void UpdatePoses(
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      const std::unordered_set<GeometryId>& moved_ids) {
+    for (const GeometryId& id : moved_ids) {
+      if (update_ids_.count(id) == 0) continue;
+      const math::RigidTransformd X_WG =
+          geometry::internal::convert_to_double(X_WGs.at(id));
+      DoUpdateVisualPose(id, X_WG);
+    }
+  }
+
   /** Updates the renderer's viewpoint with given pose X_WR.
 
    @param X_WR  The pose of renderer's viewpoint in the world coordinate
@@ -1,5 +1,6 @@
 #include "drake/geometry/render/render_engine_vtk.h"
 
+#include <cstdint>
 #include <fstream>
 #include <limits>
 #include <optional>
@@ -14,6 +15,7 @@
 #include <vtkOpenGLTexture.h>
 #include <vtkPNGReader.h>
 #include <vtkPlaneSource.h>
+#include <vtkPolyData.h>
 #include <vtkProperty.h>
 #include <vtkTexturedSphereSource.h>
 #include <vtkTransform.h>
@@ -30,6 +32,7 @@ namespace geometry {
 namespace render {
 
 using Eigen::Vector2d;
+using Eigen::Vector3d;
 using Eigen::Vector4d;
 using math::RigidTransformd;
 using std::make_unique;
@@ -84,6 +87,48 @@ struct RegistrationData {
   std::optional<std::string> mesh_filename;
 };
 
+// Makes a texture for a clone of a render engine. It shares the (immutable)
+// image data of the `source` texture, but not its OpenGL resources, which
+// belong to the source engine's render window.
+vtkSmartPointer<vtkTexture> CloneTexture(vtkTexture* source) {
+  vtkSmartPointer<vtkOpenGLTexture> clone =
+      vtkSmartPointer<vtkOpenGLTexture>::New();
+  clone->SetInputDataObject(source->GetInputDataObject(0, 0));
+  clone->SetRepeat(source->GetRepeat());
+  clone->SetEdgeClamp(source->GetEdgeClamp());
+  clone->SetInterpolate(source->GetInterpolate());
+  clone->SetMipmap(source->GetMipmap());
+  clone->SetColorMode(source->GetColorMode());
+  return clone;
+}
+
+// Provides read access to the rgba bytes of the image produced by a pipeline's
+// vtkWindowToImageFilter, in place, without copying them into an intermediate
+// image. The rows of the filter's output run from the bottom of the image to
+// the top; Row(v) counts rows from the top, as in systems::sensors::Image.
+class RgbaRows {
+ public:
+  RgbaRows(vtkImageExport* exporter, int width, int height)
+      : data_(static_cast<const uint8_t*>(exporter->GetPointerToData())),
+        width_(width),
+        height_(height) {
+    int dims[3];
+    exporter->GetDataDimensions(dims);
+    DRAKE_DEMAND(dims[0] == width && dims[1] == height);
+    DRAKE_DEMAND(exporter->GetDataNumberOfScalarComponents() == 4);
+  }
+
+  // The rgba bytes of the pixel (u, v) are Row(v)[4 * u + i], i ∈ [0, 3].
+  const uint8_t* Row(int v) const {
+    return data_ + 4 * width_ * (height_ - 1 - v);
+  }
+
+ private:
+  const uint8_t* data_{};
+  int width_{};
+  int height_{};
+};
+
 std::string RemoveFileExtension(const std::string& filepath) {
   const size_t last_dot = filepath.find_last_of(".");
   if (last_dot == std::string::npos) {
@@ -104,8 +149,6 @@ ShaderCallback::ShaderCallback() :
 
 }  // namespace internal
 
-vtkNew<internal::ShaderCallback> RenderEngineVtk::uniform_setting_callback_;
-
 RenderEngineVtk::RenderEngineVtk(const RenderEngineVtkParams& parameters)
     : RenderEngine(parameters.default_label ? *parameters.default_label
                                             : RenderLabel::kUnspecified),
@@ -123,6 +166,7 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtkParams& parameters)
 }
 
 void RenderEngineVtk::UpdateViewpoint(const RigidTransformd& X_WC) {
+  X_WC_ = X_WC;
   vtkSmartPointer<vtkTransform> vtk_X_WC = ConvertToVtkTransform(X_WC);
 
   for (const auto& pipeline : pipelines_) {
@@ -200,6 +244,7 @@ void RenderEngineVtk::DoUpdateVisualPose(GeometryId id,
   for (const auto& actor : actors_.at(id)) {
     actor->SetUserTransform(vtk_X_WG);
   }
+  culler_.UpdatePose(id, X_WG);
 }
 
 bool RenderEngineVtk::DoRemoveGeometry(GeometryId id) {
@@ -212,6 +257,7 @@ bool RenderEngineVtk::DoRemoveGeometry(GeometryId id) {
       pipelines_[i]->renderer->RemoveActor(pipe_actors[i]);
     }
     actors_.erase(iter);
+    culler_.RemoveGeometry(id);
     return true;
   }
 
@@ -227,10 +273,11 @@ void RenderEngineVtk::DoRenderColorImage(
     ImageRgba8U* color_image_out) const {
   UpdateWindow(camera.core(), camera.show_window(),
                *pipelines_[ImageType::kColor], "Color Image");
+  CullActors(camera.core(), ImageType::kColor);
   PerformVtkUpdate(*pipelines_[ImageType::kColor]);
 
-  // TODO(SeanCurtis-TRI): Determine if this copies memory (and find some way
-  // around copying).
+  // This copies the filter's output directly into the output image, flipping
+  // its rows (see InitializePipelines()).
   pipelines_[ImageType::kColor]->exporter->Export(color_image_out->at(0, 0));
 }
 
@@ -238,31 +285,27 @@ void RenderEngineVtk::DoRenderDepthImage(
     const DepthRenderCamera& camera,
       ImageDepth32F* depth_image_out) const {
   UpdateWindow(camera, *pipelines_[ImageType::kDepth]);
+  CullActors(camera.core(), ImageType::kDepth);
   PerformVtkUpdate(*pipelines_[ImageType::kDepth]);
 
+  // The depth is decoded straight from the filter's output, in a single pass.
   const CameraInfo& intrinsics = camera.core().intrinsics();
-  ImageRgba8U image(intrinsics.width(), intrinsics.height());
-  // TODO(SeanCurtis-TRI): We're doing multiple passes on the pixel data. This
-  // does one pass by copying the filter to the given image. We then do a second
-  // pass where we re-encode the values. It would be much better to process the
-  // pixels in a single pass.  The solution is to simply call
-  // exporter->GetPointerToData() and process the pixels as they are read.
-  // See the implementation in vtkImageExport::Export() for details.
-  pipelines_[ImageType::kDepth]->exporter->Export(image.at(0, 0));
-
+  const RgbaRows rgba(pipelines_[ImageType::kDepth]->exporter.Get(),
+                      intrinsics.width(), intrinsics.height());
   const double min_depth = camera.depth_range().min_depth();
   const double max_depth = camera.depth_range().max_depth();
   for (int v = 0; v < intrinsics.height(); ++v) {
+    const uint8_t* row = rgba.Row(v);
     for (int u = 0; u < intrinsics.width(); ++u) {
-      if (image.at(u, v)[0] == 255u && image.at(u, v)[1] == 255u &&
-          image.at(u, v)[2] == 255u) {
+      const uint8_t* pixel = row + 4 * u;
+      if (pixel[0] == 255u && pixel[1] == 255u && pixel[2] == 255u) {
         depth_image_out->at(u, v)[0] =
             ImageTraits<PixelType::kDepth32F>::kTooFar;
       } else {
         // Decoding three channel color values to a float value. For the detail,
         // see depth_shaders.h.
-        float shader_value = image.at(u, v)[0] + image.at(u, v)[1] / 255. +
-                             image.at(u, v)[2] / (255. * 255.);
+        float shader_value =
+            pixel[0] + pixel[1] / 255. + pixel[2] / (255. * 255.);
 
         // Dividing by 255 so that the range gets to be [0, 1].
         shader_value /= 255.f;
@@ -279,22 +322,21 @@ void RenderEngineVtk::DoRenderLabelImage(
     ImageLabel16I* label_image_out) const {
   UpdateWindow(camera.core(), camera.show_window(),
                *pipelines_[ImageType::kLabel], "Label Image");
+  CullActors(camera.core(), ImageType::kLabel);
   PerformVtkUpdate(*pipelines_[ImageType::kLabel]);
 
-  // TODO(SeanCurtis-TRI): This copies the image and *that's* a tragedy. It
-  // would be much better to process the pixels directly. The solution is to
-  // simply call exporter->GetPointerToData() and process the pixels myself.
-  // See the implementation in vtkImageExport::Export() for details.
+  // The labels are decoded straight from the filter's output.
   const CameraInfo& intrinsics = camera.core().intrinsics();
-  ImageRgba8U image(intrinsics.width(), intrinsics.height());
-  pipelines_[ImageType::kLabel]->exporter->Export(image.at(0, 0));
-
+  const RgbaRows rgba(pipelines_[ImageType::kLabel]->exporter.Get(),
+                      intrinsics.width(), intrinsics.height());
   ColorI color;
   for (int v = 0; v < intrinsics.height(); ++v) {
+    const uint8_t* row = rgba.Row(v);
     for (int u = 0; u < intrinsics.width(); ++u) {
-      color.r = image.at(u, v)[0];
-      color.g = image.at(u, v)[1];
-      color.b = image.at(u, v)[2];
+      const uint8_t* pixel = row + 4 * u;
+      color.r = pixel[0];
+      color.g = pixel[1];
+      color.b = pixel[2];
       label_image_out->at(u, v)[0] = RenderEngine::LabelFromColor(color);
     }
   }
@@ -306,7 +348,9 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtk& other)
                   make_unique<RenderingPipeline>(),
                   make_unique<RenderingPipeline>()}},
       default_diffuse_{other.default_diffuse_},
-      default_clear_color_{other.default_clear_color_} {
+      default_clear_color_{other.default_clear_color_},
+      X_WC_{other.X_WC_},
+      culler_{other.culler_} {
   InitializePipelines();
 
   // Utility function for creating a cloned actor which *shares* the same
@@ -328,22 +372,36 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtk& other)
       clone.SetShaderProperty(source.GetShaderProperty());
 
       // NOTE: The clone renderer and original renderer *share* polygon data
-      // (via the shared mapper) and all textures. If the meshes or textures get
-      // modified _in place_ in a clone, the change would be visible to all
-      // copies of the renderer. If that proves to be problematic we'll have to
-      // make the copy "deeper" as appropriate.
+      // and texture images. If the meshes or images get modified _in place_ in
+      // a clone, the change would be visible to all copies of the renderer. If
+      // that proves to be problematic we'll have to make the copy "deeper" as
+      // appropriate. The mappers and textures themselves are *not* shared;
+      // they hold OpenGL resources of the render window they were last drawn
+      // in. Giving each clone its own means clones can render concurrently
+      // without contending for them.
       if (source.GetTexture() == nullptr) {
         clone.GetProperty()->SetColor(source.GetProperty()->GetColor());
         clone.GetProperty()->SetOpacity(source.GetProperty()->GetOpacity());
       } else {
-        clone.SetTexture(source.GetTexture());
+        clone.SetTexture(CloneTexture(source.GetTexture()));
       }
       const auto& source_textures = source.GetProperty()->GetAllTextures();
       for (auto& [name, texture] : source_textures) {
-        clone.GetProperty()->SetTexture(name.c_str(), texture);
+        clone.GetProperty()->SetTexture(name.c_str(), CloneTexture(texture));
       }
 
-      clone.SetMapper(source.GetMapper());
+      // The label actor of a geometry that isn't rendered in label images has
+      // no mapper.
+      if (source.GetMapper() != nullptr) {
+        vtkNew<vtkOpenGLPolyDataMapper> mapper;
+        mapper->SetInputData(
+            vtkPolyData::SafeDownCast(source.GetMapper()->GetInput()));
+        if (i == ImageType::kDepth) {
+          mapper->AddObserver(vtkCommand::UpdateShaderEvent,
+                              uniform_setting_callback_.Get());
+        }
+        clone.SetMapper(mapper.Get());
+      }
       clone.SetUserTransform(source.GetUserTransform());
       // This is necessary because *terrain* has its lighting turned off. To
       // blindly handle arbitrary actors being flagged as terrain, we need
@@ -569,6 +627,22 @@ void RenderEngineVtk::ImplementGeometry(vtkPolyDataAlgorithm* source,
 
   // Take ownership of the actors.
   actors_.insert({data.id, std::move(actors)});
+
+  // The source's output is the geometry in its frame G (including any scale).
+  source->Update();
+  double bounds[6];
+  source->GetOutput()->GetBounds(bounds);
+  const Eigen::AlignedBox3d bounds_G(Vector3d(bounds[0], bounds[2], bounds[4]),
+                                     Vector3d(bounds[1], bounds[3], bounds[5]));
+  culler_.AddGeometry(data.id, bounds_G, data.X_WG);
+}
+
+void RenderEngineVtk::CullActors(const RenderCameraCore& camera,
+                                 ImageType image_type) const {
+  culling_statistics_ = culler_.FindVisible(camera, X_WC_, &visible_);
+  for (const auto& [id, actors] : actors_) {
+    actors[image_type]->SetVisibility(visible_.count(id) > 0);
+  }
 }
 
 RenderEngineVtk::RenderingPipeline& RenderEngineVtk::get_mutable_pipeline(
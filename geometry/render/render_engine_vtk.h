@@ -4,6 +4,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <vtkActor.h>
@@ -20,6 +21,7 @@
 #include <vtkWindowToImageFilter.h>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/geometry/render/frustum_culler.h"
 #include "drake/geometry/render/render_engine.h"
 #include "drake/geometry/render/render_engine_vtk_factory.h"
 #include "drake/geometry/render/render_label.h"
@@ -139,6 +141,13 @@ class RenderEngineVtk : public RenderEngine,
   using RenderEngine::default_render_label;
   //@}
 
+  /** Reports the frustum culling performed for the most recently rendered
+   image (of any type). Actors of geometries whose bounding boxes lie outside
+   the camera's view frustum are hidden for that image.  */
+  const FrustumCullingStatistics& culling_statistics() const {
+    return culling_statistics_;
+  }
+
  protected:
   /** Returns all actors registered with the engine, keyed by the SceneGraph
    GeometryId. Each GeometryId maps to a triple of actors: color, depth, and
@@ -217,6 +226,12 @@ class RenderEngineVtk : public RenderEngine,
   // Initializes the VTK pipelines.
   void InitializePipelines();
 
+  // Sets the visibility of the actors in the given image type's pipeline
+  // based on whether their geometries intersect the view frustum of `camera`
+  // (at the pose last given to UpdateViewpoint()).
+  void CullActors(const RenderCameraCore& camera,
+                  internal::ImageType image_type) const;
+
   // Common interface for loading an obj file -- used for both mesh and convex
   // shapes.
   void ImplementObj(const std::string& file_name, double scale,
@@ -234,21 +249,11 @@ class RenderEngineVtk : public RenderEngine,
 
   vtkNew<vtkLight> light_;
 
-  // By design, all of the geometry is shared across clones of the render
-  // engine. This is predicated upon the idea that the geometry is *not*
-  // deformable and does *not* depend on the system's pose information.
-  // (If there is deformable geometry, it will have to be handled differently.)
-  // Having "shared geometry" means having shared vtkPolyDataAlgorithm and
-  // vtkOpenGLPolyDataMapper instances. The shader callback gets registered to
-  // the *mapper* instances, so they all, implicitly, share the same callback.
-  // Making this member static facilitates that but it does preclude the
-  // possibility of simultaneous renderings with different uniform parameters.
-  // Currently, this doesn't happen because drake isn't particularly thread safe
-  // (or executed in such a context). However, this renderer will need some
-  // formal thread safe mechanism so that it doesn't rely on that in the future.
-  // TODO(SeanCurtis-TRI): This is not threadsafe; investigate mechanisms to
-  // prevent undesirable behaviors if used in multi-threaded application.
-  static vtkNew<internal::ShaderCallback> uniform_setting_callback_;
+  // The callback that sets the depth range uniforms on the depth shaders. It is
+  // registered with this instance's depth mappers. Clones share polygon data
+  // but not mappers, so each instance (and each thread rendering with one) has
+  // its own depth range.
+  vtkNew<internal::ShaderCallback> uniform_setting_callback_;
 
   // Obnoxious bright orange.
   Eigen::Vector4d default_diffuse_{0.9, 0.45, 0.1, 1.0};
@@ -260,6 +265,14 @@ class RenderEngineVtk : public RenderEngine,
   // depth, and label) keyed by the geometry's GeometryId.
   std::unordered_map<GeometryId, std::array<vtkSmartPointer<vtkActor>, 3>>
       actors_;
+
+  // The pose of the camera, as given to UpdateViewpoint().
+  math::RigidTransformd X_WC_;
+
+  // The world-aligned bounds of the geometries, for frustum culling.
+  internal::FrustumCuller culler_;
+  mutable std::unordered_set<GeometryId> visible_;
+  mutable FrustumCullingStatistics culling_statistics_;
 };
 
 }  // namespace render
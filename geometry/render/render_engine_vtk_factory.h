@@ -89,6 +89,18 @@ struct RenderEngineVtkParams  {
  e.g., render label validation).
  <!-- TODO(SeanCurtis-TRI): Change this policy to be more selective when other
       renderers with different properties are introduced. -->
+
+ <h2>Rendering from multiple threads</h2>
+
+ A single %RenderEngineVtk instance must not be used from more than one thread
+ at a time. Distinct instances, including clones of one another, don't share
+ any mutable VTK objects. Each clone owns its own offscreen render windows
+ (and, therefore, OpenGL contexts), mappers, and textures; only the immutable
+ polygon and texture image data are shared. So N cameras can be rendered
+ concurrently by N clones, each driven by its own thread. Whether the
+ OpenGL implementation can drive several contexts at once is up to the
+ platform; with X11, the application must call `XInitThreads()` before any
+ rendering.
  */
 std::unique_ptr<RenderEngine> MakeRenderEngineVtk(
     const RenderEngineVtkParams& params);
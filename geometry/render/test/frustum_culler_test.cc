@@ -0,0 +1,126 @@
+#include "drake/geometry/render/frustum_culler.h"
+
+#include <cmath>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace internal {
+namespace {
+
+using Eigen::AlignedBox3d;
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::sensors::CameraInfo;
+
+// A 100x100 camera with a 90° field of view and depth range [0.1, 10].
+RenderCameraCore MakeCamera() {
+  return RenderCameraCore("renderer", CameraInfo(100, 100, M_PI / 2),
+                          ClippingRange(0.1, 10.0), RigidTransformd());
+}
+
+AlignedBox3d UnitCube() {
+  return AlignedBox3d(Vector3d::Constant(-0.5), Vector3d::Constant(0.5));
+}
+
+class FrustumCullerTest : public ::testing::Test {
+ protected:
+  // Adds a unit cube at the given position and returns its id.
+  GeometryId AddCube(const Vector3d& p_WG) {
+    const GeometryId id = GeometryId::get_new_id();
+    culler_.AddGeometry(id, UnitCube(), RigidTransformd(p_WG));
+    return id;
+  }
+
+  std::unordered_set<GeometryId> FindVisible(
+      const RigidTransformd& X_WC = RigidTransformd()) {
+    std::unordered_set<GeometryId> visible;
+    stats_ = culler_.FindVisible(camera_, X_WC, &visible);
+    return visible;
+  }
+
+  const RenderCameraCore camera_{MakeCamera()};
+  FrustumCuller culler_;
+  FrustumCullingStatistics stats_;
+};
+
+// With the camera at the world origin looking along +Wz, only geometries in
+// front of the camera, within the field of view and depth range, are visible.
+TEST_F(FrustumCullerTest, CullsOutsideFrustum) {
+  const GeometryId in_front = AddCube({0, 0, 5});
+  const GeometryId straddling_edge = AddCube({5.2, 0, 5});
+  const GeometryId behind = AddCube({0, 0, -5});
+  const GeometryId too_far = AddCube({0, 0, 12});
+  const GeometryId too_near = AddCube({0, 0, -0.45});
+  const GeometryId left = AddCube({-7, 0, 5});
+  const GeometryId below = AddCube({0, 7, 5});
+
+  const std::unordered_set<GeometryId> visible = FindVisible();
+  EXPECT_EQ(visible,
+            std::unordered_set<GeometryId>({in_front, straddling_edge}));
+  EXPECT_EQ(stats_.num_geometries, 7);
+  EXPECT_EQ(stats_.num_culled, 5);
+  EXPECT_EQ(visible.count(behind), 0);
+  EXPECT_EQ(visible.count(too_far), 0);
+  EXPECT_EQ(visible.count(too_near), 0);
+  EXPECT_EQ(visible.count(left), 0);
+  EXPECT_EQ(visible.count(below), 0);
+
+  // Turning the camera around makes the geometry behind it visible (as well
+  // as the far side of the cube that was too near).
+  const RigidTransformd X_WC(RollPitchYawd(0, M_PI, 0), Vector3d::Zero());
+  EXPECT_EQ(FindVisible(X_WC),
+            std::unordered_set<GeometryId>({behind, too_near}));
+}
+
+// Many geometries exercise the hierarchy; pose updates and removals are
+// reflected in subsequent queries.
+TEST_F(FrustumCullerTest, UpdatesAndRemovals) {
+  // A 20 x 20 grid of cubes in the plane z = 5, spaced 2 m apart; the camera's
+  // frustum at z = 5 spans [-5, 5] in x and y, so the 6 x 6 cubes centered in
+  // [-5, 5] are visible.
+  std::vector<GeometryId> ids;
+  for (int i = 0; i < 20; ++i) {
+    for (int j = 0; j < 20; ++j) {
+      ids.push_back(AddCube({2.0 * i - 19, 2.0 * j - 19, 5}));
+    }
+  }
+  EXPECT_EQ(FindVisible().size(), 36);
+  EXPECT_EQ(stats_.num_culled, 400 - 36);
+
+  // Move a culled cube into view.
+  const GeometryId far_corner = ids.front();
+  ASSERT_EQ(FindVisible().count(far_corner), 0);
+  culler_.UpdatePose(far_corner, RigidTransformd(Vector3d(0, 0, 2)));
+  EXPECT_EQ(FindVisible().count(far_corner), 1);
+  EXPECT_EQ(stats_.num_culled, 400 - 37);
+
+  // Removing it culls it again (trivially).
+  culler_.RemoveGeometry(far_corner);
+  EXPECT_EQ(FindVisible().count(far_corner), 0);
+  EXPECT_EQ(stats_.num_geometries, 399);
+  EXPECT_EQ(stats_.num_culled, 399 - 36);
+}
+
+// Unbounded geometries are never culled.
+TEST_F(FrustumCullerTest, InfiniteBounds) {
+  const double kInf = std::numeric_limits<double>::infinity();
+  const GeometryId id = GeometryId::get_new_id();
+  culler_.AddGeometry(
+      id,
+      AlignedBox3d(Vector3d(-kInf, -kInf, -kInf), Vector3d(kInf, kInf, 0)),
+      RigidTransformd(Vector3d(0, 0, -100)));
+  const RigidTransformd X_WC(RollPitchYawd(0, M_PI, 0), Vector3d::Zero());
+  EXPECT_EQ(FindVisible(X_WC).count(id), 1);
+  EXPECT_EQ(FindVisible().count(id), 1);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
@@ -3,6 +3,7 @@
 #include <optional>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -164,6 +165,44 @@ GTEST_TEST(RenderEngine, RegistrationAndUpdate) {
   }
 }
 
+// Tests the UpdatePoses() variant that only updates the given moved geometries;
+// unregistered and anchored ids are ignored.
+GTEST_TEST(RenderEngine, UpdateMovedPoses) {
+  DummyRenderEngine engine({RenderLabel::kDontCare});
+  const PerceptionProperties add_properties = engine.accepting_properties();
+  const Sphere sphere(1.0);
+
+  const GeometryId dynamic1 = GeometryId::get_new_id();
+  const GeometryId dynamic2 = GeometryId::get_new_id();
+  const GeometryId anchored = GeometryId::get_new_id();
+  const GeometryId unregistered = GeometryId::get_new_id();
+  unordered_map<GeometryId, RigidTransformd> X_WG_all{
+      {dynamic1, RigidTransformd{Vector3d{1, 2, 3}}},
+      {dynamic2, RigidTransformd{Vector3d{2, 3, 4}}},
+      {anchored, RigidTransformd{Vector3d{3, 4, 5}}},
+      {unregistered, RigidTransformd{Vector3d{4, 5, 6}}}};
+  engine.RegisterVisual(dynamic1, sphere, add_properties, X_WG_all[dynamic1],
+                        true);
+  engine.RegisterVisual(dynamic2, sphere, add_properties, X_WG_all[dynamic2],
+                        true);
+  engine.RegisterVisual(anchored, sphere, add_properties, X_WG_all[anchored],
+                        false);
+
+  // Nothing moved; nothing is updated.
+  engine.UpdatePoses(X_WG_all, std::unordered_set<GeometryId>{});
+  EXPECT_EQ(engine.updated_ids().size(), 0);
+
+  // Only the moved, dynamic geometry is updated.
+  const Vector3d p_WG(1.5, 2.5, 3.5);
+  X_WG_all[dynamic2].set_translation(p_WG);
+  engine.UpdatePoses(X_WG_all, std::unordered_set<GeometryId>{
+                                   dynamic2, anchored, unregistered});
+  EXPECT_EQ(engine.updated_ids().size(), 1);
+  ASSERT_EQ(engine.updated_ids().count(dynamic2), 1);
+  EXPECT_TRUE(
+      CompareMatrices(engine.updated_ids().at(dynamic2).translation(), p_WG));
+}
+
 // Tests the removal of geometry from the renderer -- confirms that the
 // RenderEngine removes the geometry appropriately.
 GTEST_TEST(RenderEngine, RemoveGeometry) {
@@ -11,6 +11,7 @@
 #include <Eigen/Dense>
 #include <fmt/format.h>
 #include <gtest/gtest.h>
+#include <vtkMapper.h>
 #include <vtkOpenGLTexture.h>
 #include <vtkProperty.h>
 
@@ -701,6 +702,29 @@ TEST_F(RenderEngineVtkTest, SphereTest) {
   }
 }
 
+// Geometry behind the camera is culled without affecting the images; the
+// culling is reported in the statistics.
+TEST_F(RenderEngineVtkTest, FrustumCulling) {
+  Init(X_WC_, true);
+  PopulateSphereTest(renderer_.get());
+  const GeometryId behind_id = GeometryId::get_new_id();
+  renderer_->RegisterVisual(behind_id, Sphere(0.25), simple_material(),
+                            RigidTransformd::Identity(), true);
+  X_WV_.insert({behind_id, X_WC_ * RigidTransformd(Vector3d(0, 0, -1))});
+  renderer_->UpdatePoses(X_WV_);
+
+  PerformCenterShapeTest(renderer_.get(), "Frustum culling test");
+  // The terrain, the sphere in view, and the culled sphere behind the camera.
+  EXPECT_EQ(renderer_->culling_statistics().num_geometries, 3);
+  EXPECT_EQ(renderer_->culling_statistics().num_culled, 1);
+
+  // Once removed, there is nothing left to cull.
+  renderer_->RemoveGeometry(behind_id);
+  PerformCenterShapeTest(renderer_.get(), "Frustum culling removed");
+  EXPECT_EQ(renderer_->culling_statistics().num_geometries, 2);
+  EXPECT_EQ(renderer_->culling_statistics().num_culled, 0);
+}
+
 // Performs the shape-centered-in-the-image test with a sphere.
 TEST_F(RenderEngineVtkTest, TransparentSphereTest) {
   RenderEngineVtk renderer;
@@ -1269,6 +1293,8 @@ class TextureSetterEngine : public RenderEngineVtk {
  public:
   TextureSetterEngine() = default;
 
+  using RenderEngineVtk::actors;
+
   // Reports if the color actor for the geometry with the given `id` has the
   // property texture append by this class's DoRegisterVisual() implementaiton.
   bool GeometryHasColorTexture(GeometryId id,
@@ -1319,6 +1345,46 @@ TEST_F(RenderEngineVtkTest, PreservePropertyTexturesOverClone) {
   ASSERT_TRUE(clone->GeometryHasColorTexture(id, texture_name));
 }
 
+// Confirms that a clone shares the original's polygon data and texture images
+// but neither its mappers nor its textures; those hold the OpenGL resources of
+// the engine's render windows. That isolation is what allows clones to render
+// concurrently on different threads.
+TEST_F(RenderEngineVtkTest, CloneDoesNotShareOpenGlResources) {
+  const std::string texture_name("test_texture");
+  TextureSetterEngine engine;
+  const GeometryId id = GeometryId::get_new_id();
+  PerceptionProperties material;
+  material.AddProperty("label", "id", RenderLabel(12345));
+  engine.RegisterVisual(id, Sphere(0.5), material, RigidTransformd(),
+                        true /* needs update */);
+  engine.ApplyColorTextureToGeometry(id, texture_name);
+  auto clone_ptr = engine.Clone();
+  const TextureSetterEngine* clone =
+      dynamic_cast<TextureSetterEngine*>(clone_ptr.get());
+  ASSERT_NE(clone, nullptr);
+
+  for (int i = 0; i < 3; ++i) {
+    vtkMapper* source_mapper = engine.actors().at(id)[i]->GetMapper();
+    vtkMapper* clone_mapper = clone->actors().at(id)[i]->GetMapper();
+    ASSERT_NE(source_mapper, nullptr);
+    ASSERT_NE(clone_mapper, nullptr);
+    EXPECT_NE(clone_mapper, source_mapper);
+    EXPECT_EQ(clone_mapper->GetInput(), source_mapper->GetInput());
+  }
+
+  vtkTexture* source_texture =
+      engine.actors().at(id)[0]->GetProperty()->GetTexture(
+          texture_name.c_str());
+  vtkTexture* clone_texture =
+      clone->actors().at(id)[0]->GetProperty()->GetTexture(
+          texture_name.c_str());
+  ASSERT_NE(source_texture, nullptr);
+  ASSERT_NE(clone_texture, nullptr);
+  EXPECT_NE(clone_texture, source_texture);
+  EXPECT_EQ(clone_texture->GetInputDataObject(0, 0),
+            source_texture->GetInputDataObject(0, 0));
+}
+
 namespace {
 
 // Defines the relationship between two adjacent pixels in a rendering of a box.
@@ -103,6 +103,7 @@ template <typename U>
 SceneGraph<T>::SceneGraph(const SceneGraph<U>& other)
     : SceneGraph() {
   model_ = GeometryState<T>(other.model_);
+  config_ = other.config_;
 
   // We need to guarantee that the same source ids map to the same port indices.
   // We'll do this by processing the source ids in monotonically increasing
@@ -196,6 +197,23 @@ GeometryId SceneGraph<T>::RegisterGeometry(
                                             std::move(geometry));
 }
 
+template <typename T>
+std::vector<GeometryId> SceneGraph<T>::RegisterGeometries(
+    SourceId source_id, const std::vector<FrameId>& frame_ids,
+    std::vector<std::unique_ptr<GeometryInstance>> geometries) {
+  return model_.RegisterGeometries(source_id, frame_ids, std::move(geometries));
+}
+
+template <typename T>
+std::vector<GeometryId> SceneGraph<T>::RegisterGeometries(
+    Context<T>* context, SourceId source_id,
+    const std::vector<FrameId>& frame_ids,
+    std::vector<std::unique_ptr<GeometryInstance>> geometries) const {
+  auto& g_state = mutable_geometry_state(context);
+  return g_state.RegisterGeometries(source_id, frame_ids,
+                                    std::move(geometries));
+}
+
 template <typename T>
 GeometryId SceneGraph<T>::RegisterAnchoredGeometry(
     SourceId source_id, std::unique_ptr<GeometryInstance> geometry) {
@@ -318,6 +336,21 @@ const SceneGraphInspector<T>& SceneGraph<T>::model_inspector() const {
   return model_inspector_;
 }
 
+template <typename T>
+void SceneGraph<T>::set_config(const SceneGraphConfig& config) {
+  if (config.proximity_num_threads < 0) {
+    throw std::logic_error(fmt::format(
+        "SceneGraph::set_config(): proximity_num_threads must be "
+        "non-negative; {} was given.",
+        config.proximity_num_threads));
+  }
+  model_.set_proximity_parallelism(
+      config.proximity_num_threads == 0
+          ? Parallelism::Max()
+          : Parallelism(config.proximity_num_threads));
+  config_ = config;
+}
+
 template <typename T>
 CollisionFilterManager SceneGraph<T>::collision_filter_manager() {
   return model_.collision_filter_manager();;
@@ -12,6 +12,7 @@
 #include "drake/geometry/geometry_set.h"
 #include "drake/geometry/query_object.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
+#include "drake/geometry/scene_graph_config.h"
 #include "drake/geometry/scene_graph_inspector.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/leaf_system.h"
@@ -477,6 +478,39 @@ class SceneGraph final : public systems::LeafSystem<T> {
                               GeometryId geometry_id,
                               std::unique_ptr<GeometryInstance> geometry) const;
 
+  /** Registers a batch of new geometries for this source, as if by calling
+   RegisterGeometry(source_id, frame_ids[i], std::move(geometries[i])) for each
+   `i` in order, but with the proximity engine's broadphase structures built
+   once for the whole batch rather than updated after each geometry. Prefer it
+   to a loop of RegisterGeometry() when registering many geometries at once. To
+   register an anchored geometry, give world_frame_id() as its frame.
+
+   This method modifies the underlying model and requires a new Context to be
+   allocated. Potentially modifies proximity, perception, and illustration
+   versions based on the roles assigned to the geometries (see @ref
+   scene_graph_versioning).
+
+   @param source_id   The id for the source registering the geometries.
+   @param frame_ids   The ids of the frames to hang the geometries on.
+   @param geometries  The geometries to add; `geometries[i]` is affixed to
+                      `frame_ids[i]`.
+   @return The unique identifiers of the added geometries, in order.
+   @throws std::exception  if `frame_ids` and `geometries` differ in size, or
+                           for any geometry that RegisterGeometry() would
+                           throw for. In the latter case, the geometries
+                           preceding it in the batch remain registered.  */
+  std::vector<GeometryId> RegisterGeometries(
+      SourceId source_id, const std::vector<FrameId>& frame_ids,
+      std::vector<std::unique_ptr<GeometryInstance>> geometries);
+
+  /** systems::Context-modifying variant of RegisterGeometries(). Rather than
+   modifying %SceneGraph's model, it modifies the copy of the model stored in
+   the provided context.  */
+  std::vector<GeometryId> RegisterGeometries(
+      systems::Context<T>* context, SourceId source_id,
+      const std::vector<FrameId>& frame_ids,
+      std::vector<std::unique_ptr<GeometryInstance>> geometries) const;
+
   /** Registers a new _anchored_ geometry G for this source. This hangs geometry
    G from the world frame (W). Its pose is defined in that frame (i.e., `X_WG`).
    Returns the corresponding unique geometry id.
@@ -788,6 +822,15 @@ class SceneGraph final : public systems::LeafSystem<T> {
   /** Returns an inspector on the system's _model_ scene graph data.  */
   const SceneGraphInspector<T>& model_inspector() const;
 
+  /** Applies the given `config` to this %SceneGraph's _model_. Only contexts
+   allocated after this call are affected.
+   @throws std::exception if `config` contains invalid values.  */
+  void set_config(const SceneGraphConfig& config);
+
+  /** Returns the most recent config passed to set_config(), or the default
+   config if set_config() has never been called.  */
+  const SceneGraphConfig& get_config() const { return config_; }
+
   /** @name         Collision filtering
    @anchor scene_graph_collision_filter_manager
 
@@ -905,6 +948,9 @@ class SceneGraph final : public systems::LeafSystem<T> {
 
   SceneGraphInspector<T> model_inspector_;
 
+  // The configuration most recently applied to model_.
+  SceneGraphConfig config_;
+
   // The geometry state is stored in the Context either as a Parameter with this
   // index.
   int geometry_state_index_{-1};
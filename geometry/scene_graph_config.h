@@ -0,0 +1,30 @@
+#pragma once
+
+#include "drake/common/name_value.h"
+
+namespace drake {
+namespace geometry {
+
+/** The set of configurable properties on a SceneGraph.
+
+ The field names and defaults here match SceneGraph's defaults exactly. */
+struct SceneGraphConfig {
+  /** Passes this object to an Archive.
+   Refer to @ref yaml_serialization "YAML Serialization" for background. */
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(proximity_num_threads));
+  }
+
+  /** The number of threads used by proximity queries that support
+   parallel evaluation (currently, QueryObject::ComputePointPairPenetration(),
+   QueryObject::ComputeContactSurfaces(), and
+   QueryObject::ComputeContactSurfacesWithFallback()). The query results do
+   not depend on this value. A value of 1 evaluates the queries serially on the
+   calling thread. A value of 0 requests one thread per hardware core (see
+   Parallelism::Max()). Negative values are invalid. */
+  int proximity_num_threads{1};
+};
+
+}  // namespace geometry
+}  // namespace drake
@@ -268,6 +268,14 @@ void SceneGraphInspector<T>::Reify(GeometryId geometry_id,
   state_->GetShape(geometry_id).Reify(reifier);
 }
 
+template <typename T>
+std::unique_ptr<internal::ProximityEngine<T>>
+SceneGraphInspector<T>::CloneProximityEngine() const {
+  DRAKE_DEMAND(state_ != nullptr);
+  return std::make_unique<internal::ProximityEngine<T>>(
+      state_->proximity_engine());
+}
+
 template <typename T>
 std::unique_ptr<GeometryInstance> SceneGraphInspector<T>::CloneGeometryInstance(
     GeometryId id) const {
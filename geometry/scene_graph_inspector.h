@@ -29,6 +29,10 @@ template <typename T>
 class QueryObject;
 template <typename T>
 class SceneGraph;
+namespace internal {
+template <typename T>
+class ProximityEngine;
+}  // namespace internal
 #endif
 
 /** The %SceneGraphInspector serves as a mechanism to query the topological
@@ -407,6 +411,13 @@ class SceneGraphInspector {
    geometry.  */
   std::unique_ptr<GeometryInstance>
   CloneGeometryInstance(GeometryId geometry_id) const;
+
+  /** @internal Returns a copy of the proximity engine of the inspected state.
+   The copy holds all geometries with the proximity role and their collision
+   filters. It allows callers that compute geometry poses themselves (e.g., a
+   planner's collision checker) to perform proximity queries without the
+   overhead of evaluating a Context. Not intended for general use.  */
+  std::unique_ptr<internal::ProximityEngine<T>> CloneProximityEngine() const;
   //@}
 
  private:
@@ -564,6 +564,59 @@ TYPED_TEST(DrakeVisualizerTest, ForcePublish) {
   ASSERT_EQ(results.num_draw, 1);
 }
 
+/* Confirms that with publish_changed_poses_only, a draw message only includes
+ the frames that moved since the previous one, except right after a load.  */
+TYPED_TEST(DrakeVisualizerTest, PublishChangedPosesOnly) {
+  using T = TypeParam;
+  DrakeVisualizerParams params;
+  params.publish_changed_poses_only = true;
+  this->ConfigureDiagram(params);
+  vector<FrameId> frame_ids;
+  for (const char* name : {"frame0", "frame1"}) {
+    frame_ids.push_back(this->scene_graph_->RegisterFrame(
+        this->source_id_, GeometryFrame(name)));
+    const GeometryId g_id = this->scene_graph_->RegisterGeometry(
+        this->source_id_, frame_ids.back(),
+        make_unique<GeometryInstance>(RigidTransformd{},
+                                      make_unique<Sphere>(1), name));
+    this->scene_graph_->AssignRole(this->source_id_, g_id,
+                                   IllustrationProperties());
+  }
+  this->pose_source_->SetPoses({{frame_ids[0], RigidTransform<T>{}},
+                                {frame_ids[1], RigidTransform<T>{}}});
+
+  auto context = this->diagram_->CreateDefaultContext();
+  /* The poses are changed outside of the context.  */
+  context->DisableCaching();
+  const auto& vis_context = this->visualizer_->GetMyContextFromRoot(*context);
+
+  /* After the load message, every frame is drawn.  */
+  this->visualizer_->Publish(vis_context);
+  MessageResults results = this->ProcessMessages();
+  ASSERT_EQ(results.num_load, 1);
+  ASSERT_EQ(results.num_draw, 1);
+  EXPECT_EQ(results.draw_message.num_links, 2);
+
+  /* Nothing moved.  */
+  this->visualizer_->Publish(vis_context);
+  results = this->ProcessMessages();
+  ASSERT_EQ(results.num_load, 0);
+  ASSERT_EQ(results.num_draw, 1);
+  EXPECT_EQ(results.draw_message.num_links, 0);
+
+  /* Only frame1 moved.  */
+  const RigidTransform<T> X_WF1(Vector3<T>(1, 2, 3));
+  this->pose_source_->SetPoses(
+      {{frame_ids[0], RigidTransform<T>{}}, {frame_ids[1], X_WF1}});
+  this->visualizer_->Publish(vis_context);
+  results = this->ProcessMessages();
+  ASSERT_EQ(results.num_draw, 1);
+  ASSERT_EQ(results.draw_message.num_links, 1);
+  EXPECT_EQ(results.draw_message.link_name[0],
+            fmt::format("{}::frame1", this->kSourceName));
+  EXPECT_EQ(results.draw_message.position[0][2], 3);
+}
+
 /* When targeting a non-illustration role, if that same geometry *has* an
  illustration role with color, that value is used instead of the default.  */
 TYPED_TEST(DrakeVisualizerTest, GeometryWithIllustrationFallback) {
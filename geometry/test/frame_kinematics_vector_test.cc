@@ -146,6 +146,55 @@ GTEST_TEST(FrameKinematicsVector, SetWithoutAllocations) {
   }
 }
 
+// FindValue() uses and corrects the caller's guess of where a value is
+// stored, and set_value() keeps each id at its first position.
+GTEST_TEST(FrameKinematicsVector, FindValue) {
+  const std::vector<FrameId> ids{FrameId::get_new_id(), FrameId::get_new_id(),
+                                 FrameId::get_new_id()};
+  FramePoseVector<double> dut;
+  for (int i = 0; i < 3; ++i) {
+    dut.set_value(ids[i], RigidTransformd(Eigen::Vector3d(i, 0, 0)));
+  }
+
+  // A correct hint is kept.
+  int hint = 1;
+  const RigidTransformd* pose = dut.FindValue(ids[1], &hint);
+  ASSERT_NE(pose, nullptr);
+  EXPECT_EQ(pose->translation().x(), 1);
+  EXPECT_EQ(hint, 1);
+
+  // A wrong or invalid hint is corrected.
+  for (int bad_hint : {-1, 0, 7}) {
+    hint = bad_hint;
+    pose = dut.FindValue(ids[2], &hint);
+    ASSERT_NE(pose, nullptr);
+    EXPECT_EQ(pose->translation().x(), 2);
+    EXPECT_EQ(hint, 2);
+  }
+
+  // Absent ids report nullptr, whether unknown or cleared.
+  hint = 0;
+  EXPECT_EQ(dut.FindValue(FrameId::get_new_id(), &hint), nullptr);
+  EXPECT_EQ(hint, -1);
+  dut.clear();
+  hint = 0;
+  EXPECT_EQ(dut.FindValue(ids[0], &hint), nullptr);
+
+  // Setting the values in a different order doesn't move them.
+  for (int i = 2; i >= 0; --i) {
+    dut.set_value(ids[i], RigidTransformd(Eigen::Vector3d(10 * i, 0, 0)));
+  }
+  EXPECT_EQ(dut.size(), 3);
+  EXPECT_EQ(dut.frame_ids(), ids);
+  for (int i = 0; i < 3; ++i) {
+    hint = i;
+    pose = dut.FindValue(ids[i], &hint);
+    ASSERT_NE(pose, nullptr);
+    EXPECT_EQ(pose->translation().x(), 10 * i);
+    EXPECT_EQ(hint, i);
+  }
+}
+
 GTEST_TEST(FrameKinematicsVector, AutoDiffInstantiation) {
   FramePoseVector<AutoDiffXd> poses;
   poses.set_value(FrameId::get_new_id(),
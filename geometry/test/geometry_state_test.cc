@@ -1419,6 +1419,44 @@ TEST_F(GeometryStateTest, RegisterNullGeometry) {
       "Registering null geometry to frame \\d+, on source \\d+.");
 }
 
+// Tests registering a batch of geometries, dynamic and anchored, in one call.
+// The proximity engine must be fully usable once the batch is registered.
+TEST_F(GeometryStateTest, RegisterGeometries) {
+  const SourceId s_id = NewSource();
+  const FrameId f_id = geometry_state_.RegisterFrame(s_id, *frame_);
+  // Two overlapping spheres on the frame, and an anchored one that overlaps
+  // with both.
+  const vector<FrameId> frame_ids{f_id, f_id, InternalFrame::world_frame_id()};
+  const vector<double> offsets{0.0, 1.0, 0.5};
+  vector<unique_ptr<GeometryInstance>> instances;
+  vector<GeometryId> expected_ids;
+  for (int i = 0; i < 3; ++i) {
+    auto instance = make_unique<GeometryInstance>(
+        RigidTransformd(Translation3d(offsets[i], 0, 0)),
+        make_unique<Sphere>(1), "sphere" + std::to_string(i));
+    instance->set_proximity_properties(ProximityProperties());
+    expected_ids.push_back(instance->id());
+    instances.push_back(move(instance));
+  }
+
+  const vector<GeometryId> g_ids =
+      geometry_state_.RegisterGeometries(s_id, frame_ids, move(instances));
+  EXPECT_EQ(g_ids, expected_ids);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(geometry_state_.GetFrameId(g_ids[i]), frame_ids[i]);
+    EXPECT_TRUE(geometry_state_.BelongsToSource(g_ids[i], s_id));
+  }
+  EXPECT_EQ(geometry_state_.NumGeometriesWithRole(Role::kProximity), 3);
+
+  // The spheres affixed to the same frame are filtered; each of them collides
+  // with the anchored sphere.
+  EXPECT_EQ(geometry_state_.ComputePointPairPenetration().size(), 2);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      geometry_state_.RegisterGeometries(s_id, {f_id}, {}),
+      "RegisterGeometries\\(\\): 1 frame ids were given for 0 geometries.");
+}
+
 // Tests the logic for hanging a geometry on another geometry. This confirms
 // topology and pose values.
 TEST_F(GeometryStateTest, RegisterGeometryonValidGeometry) {
@@ -1997,6 +2035,84 @@ TEST_F(GeometryStateTest, SetFramePoses) {
   }
 }
 
+// Pose updates only recompute the frames (and geometries) that moved. Confirms
+// that a frame whose own pose is unchanged still follows a moving parent (in
+// the world poses and in the proximity engine), and that a newly registered
+// frame gets its world pose even if its pose relative to its parent is the
+// identity.
+TEST_F(GeometryStateTest, IncrementalPoseUpdate) {
+  SetUpSingleSourceTree(Assign::kProximity);
+  FramePoseVector<double> poses;
+  for (int f = 0; f < static_cast<int>(frames_.size()); ++f) {
+    poses.set_value(frames_[f], X_PFs_[f]);
+  }
+  gs_tester_.SetFramePoses(source_id_, poses);
+  gs_tester_.FinalizePoseUpdate();
+
+  // Move f1 only; f2 (its child) keeps X_PF.
+  const RigidTransformd X_WF1(Vector3d(100, 0, 0));
+  poses.set_value(frames_[1], X_WF1);
+  gs_tester_.SetFramePoses(source_id_, poses);
+  gs_tester_.FinalizePoseUpdate();
+  const RigidTransformd X_WF2 = X_WF1 * X_PFs_[2];
+  EXPECT_TRUE(CompareMatrices(
+      geometry_state_.get_pose_in_world(frames_[2]).GetAsMatrix34(),
+      X_WF2.GetAsMatrix34()));
+  const int g = 2 * kGeometryCount;
+  const RigidTransformd X_WG = X_WF2 * X_FGs_[g];
+  EXPECT_TRUE(CompareMatrices(
+      geometry_state_.get_pose_in_world(geometries_[g]).GetAsMatrix34(),
+      X_WG.GetAsMatrix34()));
+  // The proximity engine's broadphase has moved the geometry too. The query
+  // point is half a radius from the sphere's center, away from its sibling
+  // (whose surface passes through the center).
+  const Vector3d p_WQ = X_WG * Vector3d(-0.5, 0, 0);
+  const std::vector<SignedDistanceToPoint<double>> distances =
+      geometry_state_.ComputeSignedDistanceToPoint(p_WQ, 0.0);
+  ASSERT_EQ(distances.size(), 1);
+  EXPECT_EQ(distances[0].id_G, geometries_[g]);
+  EXPECT_NEAR(distances[0].distance, -0.5, 1e-14);
+  // f0 didn't move.
+  EXPECT_TRUE(CompareMatrices(
+      geometry_state_.get_pose_in_world(frames_[0]).GetAsMatrix34(),
+      X_PFs_[0].GetAsMatrix34()));
+
+  // A new child of f1, posed at the identity in f1.
+  const FrameId f3 = geometry_state_.RegisterFrame(source_id_, frames_[1],
+                                                   GeometryFrame("f3"));
+  const GeometryId g3 = geometry_state_.RegisterGeometry(
+      source_id_, f3,
+      make_unique<GeometryInstance>(RigidTransformd::Identity(),
+                                    make_unique<Sphere>(1), "g3"));
+  poses.set_value(f3, RigidTransformd::Identity());
+  gs_tester_.SetFramePoses(source_id_, poses);
+  gs_tester_.FinalizePoseUpdate();
+  EXPECT_TRUE(
+      CompareMatrices(geometry_state_.get_pose_in_world(f3).GetAsMatrix34(),
+                      X_WF1.GetAsMatrix34()));
+  EXPECT_TRUE(
+      CompareMatrices(geometry_state_.get_pose_in_world(g3).GetAsMatrix34(),
+                      X_WF1.GetAsMatrix34()));
+
+  // Removing a geometry and adding one to an existing frame are both picked
+  // up by the next pose update.
+  geometry_state_.RemoveGeometry(source_id_, g3);
+  const RigidTransformd X_F1G4(Vector3d(0, 0, 3));
+  const GeometryId g4 = geometry_state_.RegisterGeometry(
+      source_id_, frames_[1],
+      make_unique<GeometryInstance>(X_F1G4, make_unique<Sphere>(1), "g4"));
+  const RigidTransformd X_WF1_moved(Vector3d(200, 0, 0));
+  poses.set_value(frames_[1], X_WF1_moved);
+  gs_tester_.SetFramePoses(source_id_, poses);
+  gs_tester_.FinalizePoseUpdate();
+  EXPECT_TRUE(
+      CompareMatrices(geometry_state_.get_pose_in_world(g4).GetAsMatrix34(),
+                      (X_WF1_moved * X_F1G4).GetAsMatrix34()));
+  EXPECT_TRUE(
+      CompareMatrices(geometry_state_.get_pose_in_world(f3).GetAsMatrix34(),
+                      X_WF1_moved.GetAsMatrix34()));
+}
+
 // Test various frame property queries.
 TEST_F(GeometryStateTest, QueryFrameProperties) {
   const SourceId s_id = SetUpSingleSourceTree();
@@ -3431,6 +3547,7 @@ TEST_F(GeometryStateTest, RendererPoseUpdate) {
   for (int f = 0; f < static_cast<int>(frames_.size()); ++f) {
     poses.set_value(frames_[f], X_PFs_[f]);
   }
+  auto X_WGs_before = gs_tester_.get_geometry_world_poses();
   gs_tester_.SetFramePoses(source_id_, poses);
   gs_tester_.FinalizePoseUpdate();
 
@@ -3447,16 +3564,24 @@ TEST_F(GeometryStateTest, RendererPoseUpdate) {
     }
   };
 
-  auto get_expected_ids = [this]() {
+  // Only the geometries whose world poses changed are pushed to the engines.
+  // E.g., f2's initial pose is X_PF1⁻¹, so f2 (and its geometry) keeps the
+  // identity world pose it was registered with.
+  auto get_expected_ids = [this, &X_WGs_before]() {
     map<GeometryId, RigidTransformd> expected;
     for (int i = 0; i < single_tree_dynamic_geometry_count(); ++i) {
       const GeometryId id = geometries_[i];
-      expected.insert({id, gs_tester_.get_geometry_world_poses().at(id)});
+      const RigidTransformd& X_WG =
+          gs_tester_.get_geometry_world_poses().at(id);
+      if (!X_WG.IsExactlyEqualTo(X_WGs_before.at(id))) {
+        expected.insert({id, X_WG});
+      }
     }
     return expected;
   };
 
   map<GeometryId, RigidTransformd> expected_ids = get_expected_ids();
+  EXPECT_GE(static_cast<int>(expected_ids.size()), 2 * kGeometryCount);
   expect_poses(second_engine->updated_ids(), expected_ids);
   expect_poses(render_engine_->updated_ids(), expected_ids);
   render_engine_->init_test_data();
@@ -3472,11 +3597,35 @@ TEST_F(GeometryStateTest, RendererPoseUpdate) {
   }
   EXPECT_EQ(second_engine->updated_ids().size(), 0u);
   EXPECT_EQ(render_engine_->updated_ids().size(), 0u);
+  X_WGs_before = gs_tester_.get_geometry_world_poses();
   gs_tester_.SetFramePoses(source_id_, poses);
   gs_tester_.FinalizePoseUpdate();
 
-  // Confirm poses.
+  // Confirm poses; every frame moved.
   expected_ids = get_expected_ids();
+  EXPECT_EQ(static_cast<int>(expected_ids.size()),
+            single_tree_dynamic_geometry_count());
+  expect_poses(second_engine->updated_ids(), expected_ids);
+  expect_poses(render_engine_->updated_ids(), expected_ids);
+
+  // Setting the same poses again moves nothing; the engines aren't updated.
+  render_engine_->init_test_data();
+  second_engine->init_test_data();
+  gs_tester_.SetFramePoses(source_id_, poses);
+  gs_tester_.FinalizePoseUpdate();
+  EXPECT_EQ(second_engine->updated_ids().size(), 0u);
+  EXPECT_EQ(render_engine_->updated_ids().size(), 0u);
+
+  // Moving only f0 updates only its geometries; f1 and f2 are not its
+  // descendants.
+  poses.set_value(frames_[0], X_PFs_[0]);
+  gs_tester_.SetFramePoses(source_id_, poses);
+  gs_tester_.FinalizePoseUpdate();
+  expected_ids.clear();
+  for (int i = 0; i < kGeometryCount; ++i) {
+    const GeometryId id = geometries_[i];
+    expected_ids.insert({id, gs_tester_.get_geometry_world_poses().at(id)});
+  }
   expect_poses(second_engine->updated_ids(), expected_ids);
   expect_poses(render_engine_->updated_ids(), expected_ids);
 }
@@ -0,0 +1,57 @@
+#include "drake/geometry/mesh_file_cache.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Data = std::vector<double>;
+
+GTEST_TEST(MeshFileCacheTest, SharesLiveData) {
+  int num_made = 0;
+  auto make = [&num_made]() {
+    ++num_made;
+    return Data{1.0, 2.0};
+  };
+
+  auto first = GetOrMakeMeshFileData<Data>("data", "file.obj", 1.0, make);
+  auto second = GetOrMakeMeshFileData<Data>("data", "file.obj", 1.0, make);
+  EXPECT_EQ(first.get(), second.get());
+  EXPECT_EQ(num_made, 1);
+  EXPECT_EQ(mesh_file_cache::NumLiveEntries(), 1);
+
+  // Any part of the key makes a distinct entry.
+  auto other_scale =
+      GetOrMakeMeshFileData<Data>("data", "file.obj", 2.0, make);
+  auto other_file =
+      GetOrMakeMeshFileData<Data>("data", "other.obj", 1.0, make);
+  auto other_kind =
+      GetOrMakeMeshFileData<Data>("other", "file.obj", 1.0, make);
+  auto other_type = GetOrMakeMeshFileData<std::string>(
+      "data", "file.obj", 1.0, []() { return std::string("data"); });
+  EXPECT_NE(other_scale.get(), first.get());
+  EXPECT_NE(other_file.get(), first.get());
+  EXPECT_NE(other_kind.get(), first.get());
+  EXPECT_EQ(*other_type, "data");
+  EXPECT_EQ(num_made, 4);
+  EXPECT_EQ(mesh_file_cache::NumLiveEntries(), 5);
+
+  // Once the last user releases the data, it is freed and will be rebuilt.
+  first.reset();
+  EXPECT_EQ(mesh_file_cache::NumLiveEntries(), 5);
+  second.reset();
+  EXPECT_EQ(mesh_file_cache::NumLiveEntries(), 4);
+  auto rebuilt = GetOrMakeMeshFileData<Data>("data", "file.obj", 1.0, make);
+  EXPECT_EQ(num_made, 5);
+  EXPECT_EQ(*rebuilt, Data({1.0, 2.0}));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,123 @@
+#include "drake/geometry/meshcat_animation_recorder.h"
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace geometry {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+class MeshcatAnimationRecorderTest : public ::testing::Test {
+ protected:
+  const std::string filename_{temp_directory() + "/animation.bin"};
+};
+
+TEST_F(MeshcatAnimationRecorderTest, RoundTrip) {
+  const RigidTransformd X_ParentPath(RollPitchYawd(.5, .26, -3),
+                                     Vector3d(.9, -2., .12));
+  {
+    MeshcatAnimationRecorder recorder(filename_, 64);
+    EXPECT_EQ(recorder.frames_per_second(), 64);
+    EXPECT_EQ(recorder.decimation(), 1);
+    recorder.set_start_time(1.0);
+    EXPECT_EQ(recorder.frame(1.5), 32);
+
+    recorder.SetTransform(0, "box", RigidTransformd());
+    recorder.SetTransform(3, "box", X_ParentPath);
+    recorder.SetProperty(3, "box", "visible", false);
+    recorder.SetProperty(4, "sphere", "opacity", 0.5);
+    recorder.SetProperty(5, "sphere", "scale", std::vector<double>{1, 2, 3});
+    EXPECT_EQ(recorder.num_keyframes(), 5);
+  }
+
+  const std::unique_ptr<MeshcatAnimation> animation =
+      MeshcatAnimationRecorder::Load(filename_);
+  EXPECT_EQ(animation->frames_per_second(), 64);
+
+  // Transforms are stored in single precision.
+  auto position =
+      animation->get_key_frame<std::vector<double>>(3, "box", "position");
+  ASSERT_TRUE(position);
+  EXPECT_TRUE(CompareMatrices(Eigen::Map<Vector3d>(position->data()),
+                              X_ParentPath.translation(), 1e-6));
+  auto quaternion =
+      animation->get_key_frame<std::vector<double>>(3, "box", "quaternion");
+  ASSERT_TRUE(quaternion);
+  const Eigen::Quaterniond q = X_ParentPath.rotation().ToQuaternion();
+  EXPECT_TRUE(CompareMatrices(Eigen::Map<Eigen::Vector4d>(quaternion->data()),
+                              Eigen::Vector4d(q.x(), q.y(), q.z(), q.w()),
+                              1e-6));
+  EXPECT_TRUE(
+      animation->get_key_frame<std::vector<double>>(0, "box", "position"));
+
+  EXPECT_EQ(animation->get_key_frame<bool>(3, "box", "visible"), false);
+  EXPECT_EQ(animation->get_key_frame<double>(4, "sphere", "opacity"), 0.5);
+  EXPECT_EQ(
+      animation->get_key_frame<std::vector<double>>(5, "sphere", "scale"),
+      std::vector<double>({1, 2, 3}));
+}
+
+TEST_F(MeshcatAnimationRecorderTest, Decimation) {
+  {
+    MeshcatAnimationRecorder recorder(filename_, 32, 4);
+    for (int frame = 0; frame < 10; ++frame) {
+      recorder.SetProperty(frame, "box", "opacity", 0.1 * frame);
+    }
+    EXPECT_EQ(recorder.num_keyframes(), 3);
+  }
+  const std::unique_ptr<MeshcatAnimation> animation =
+      MeshcatAnimationRecorder::Load(filename_);
+  for (int frame = 0; frame < 10; ++frame) {
+    EXPECT_EQ(
+        animation->get_key_frame<double>(frame, "box", "opacity").has_value(),
+        frame % 4 == 0);
+  }
+}
+
+// A recording that was cut short still loads its complete records.
+TEST_F(MeshcatAnimationRecorderTest, Truncated) {
+  {
+    MeshcatAnimationRecorder recorder(filename_);
+    recorder.SetProperty(0, "box", "opacity", 0.25);
+    recorder.SetProperty(1, "box", "opacity", 0.75);
+  }
+  // Chop off the last byte of the second record.
+  std::ifstream full(filename_, std::ios::binary);
+  const std::string contents((std::istreambuf_iterator<char>(full)),
+                             std::istreambuf_iterator<char>());
+  std::ofstream(filename_, std::ios::binary | std::ios::trunc)
+      << contents.substr(0, contents.size() - 1);
+
+  const std::unique_ptr<MeshcatAnimation> animation =
+      MeshcatAnimationRecorder::Load(filename_);
+  EXPECT_EQ(animation->get_key_frame<double>(0, "box", "opacity"), 0.25);
+  EXPECT_FALSE(animation->get_key_frame<double>(1, "box", "opacity"));
+}
+
+TEST_F(MeshcatAnimationRecorderTest, Errors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MeshcatAnimationRecorder(temp_directory() + "/no/such/dir/file.bin"),
+      ".*could not open.*");
+  EXPECT_THROW(MeshcatAnimationRecorder(filename_, 0), std::exception);
+  EXPECT_THROW(MeshcatAnimationRecorder(filename_, 32, 0), std::exception);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MeshcatAnimationRecorder::Load(temp_directory() + "/missing.bin"),
+      ".*could not open.*");
+  std::ofstream(filename_) << "not a recording";
+  DRAKE_EXPECT_THROWS_MESSAGE(MeshcatAnimationRecorder::Load(filename_),
+                              ".*not a Meshcat animation recording.*");
+}
+
+}  // namespace
+}  // namespace geometry
+}  // namespace drake
@@ -107,6 +107,30 @@ TEST_F(MeshcatPointCloudVisualizerTest, VisualizationParameters) {
   visualizer_->set_default_rgba(Rgba(0, 0, 1, 1));
 }
 
+TEST_F(MeshcatPointCloudVisualizerTest, BandwidthParameters) {
+  SetUpDiagram();
+  diagram_->Publish(*context_);
+  const std::string full = meshcat_->GetPackedObject("cloud");
+
+  // Decimation with large voxels (and quantization) shrinks the message.
+  visualizer_->set_voxel_size(1000);
+  visualizer_->set_quantize(true);
+  diagram_->Publish(*context_);
+  EXPECT_LT(meshcat_->GetPackedObject("cloud").size(), full.size());
+
+  // With a (very) low maximum update rate, the next publish is skipped.
+  visualizer_->set_max_update_rate(1e-6);
+  diagram_->Publish(*context_);
+  visualizer_->Delete();
+  diagram_->Publish(*context_);
+  EXPECT_TRUE(meshcat_->GetPackedObject("cloud").empty());
+
+  DRAKE_EXPECT_THROWS_MESSAGE(visualizer_->set_voxel_size(-1),
+                              ".*voxel_size.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(visualizer_->set_max_update_rate(-1),
+                              ".*max_update_rate.*");
+}
+
 TEST_F(MeshcatPointCloudVisualizerTest, ScalarConversion) {
   SetUpDiagram(false);
 
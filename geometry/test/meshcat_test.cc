@@ -335,6 +335,22 @@ GTEST_TEST(MeshcatTest, SetObjectWithPointCloud) {
   // clang-format on
   meshcat.SetObject("rgb_cloud", rgb_cloud);
   EXPECT_FALSE(meshcat.GetPackedObject("rgb_cloud").empty());
+
+  // Quantized clouds are packed more compactly. (The message overhead of
+  // these tiny clouds limits the difference, so we use a larger one.)
+  perception::PointCloud big_cloud(
+      1000, perception::pc_flags::kXYZs | perception::pc_flags::kRGBs);
+  big_cloud.mutable_xyzs().setRandom();
+  big_cloud.mutable_rgbs().setConstant(128);
+  meshcat.SetObject("big_cloud", big_cloud);
+  meshcat.SetObject("quantized_cloud", big_cloud, 0.001, Rgba(), true);
+  EXPECT_LT(meshcat.GetPackedObject("quantized_cloud").size() * 3,
+            meshcat.GetPackedObject("big_cloud").size());
+
+  // A cloud without finite points is still a valid (empty) object.
+  perception::PointCloud nan_cloud(2);
+  meshcat.SetObject("nan_cloud", nan_cloud, 0.001, Rgba(), true);
+  EXPECT_FALSE(meshcat.GetPackedObject("nan_cloud").empty());
 }
 
 GTEST_TEST(MeshcatTest, SetObjectWithTriangleSurfaceMesh) {
@@ -445,6 +461,32 @@ GTEST_TEST(MeshcatTest, SetTransformWithMatrix) {
   EXPECT_TRUE(CompareMatrices(matrix, actual));
 }
 
+GTEST_TEST(MeshcatTest, SetTransforms) {
+  Meshcat meshcat;
+  const std::vector<std::string> paths{"frame", "/drake/other/frame"};
+  const std::vector<RigidTransformd> X_ParentPaths{
+      RigidTransformd{math::RollPitchYawd(.5, .26, -3), Vector3d{.9, -2., .12}},
+      RigidTransformd{Vector3d{1, 2, 3}}};
+  meshcat.SetTransforms(paths, X_ParentPaths);
+
+  // Each path's transform is the same as if it had been set individually.
+  for (int i = 0; i < 2; ++i) {
+    std::string transform = meshcat.GetPackedTransform(paths[i]);
+    msgpack::object_handle oh =
+        msgpack::unpack(transform.data(), transform.size());
+    auto data = oh.get().as<internal::SetTransformData>();
+    EXPECT_EQ(data.type, "set_transform");
+    EXPECT_EQ(data.path, i == 0 ? "/drake/frame" : "/drake/other/frame");
+    Eigen::Map<Eigen::Matrix4d> matrix(data.matrix);
+    EXPECT_TRUE(CompareMatrices(matrix, X_ParentPaths[i].GetAsMatrix4()));
+  }
+
+  // An empty batch is a no-op; mismatched sizes are rejected.
+  EXPECT_NO_THROW(meshcat.SetTransforms({}, {}));
+  EXPECT_THROW(meshcat.SetTransforms(paths, {RigidTransformd{}}),
+               std::exception);
+}
+
 GTEST_TEST(MeshcatTest, Delete) {
   Meshcat meshcat;
   // Ok to delete an empty tree.
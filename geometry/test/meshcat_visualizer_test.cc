@@ -3,9 +3,11 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/multibody/parsing/parser.h"
 #include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/primitives/constant_vector_source.h"
@@ -88,6 +90,45 @@ TEST_F(MeshcatVisualizerWithIiwaTest, BasicTest) {
             packed_X_W7);
 }
 
+// Only frames that have moved (beyond the tolerances) are sent to Meshcat.
+TEST_F(MeshcatVisualizerWithIiwaTest, OnlySendMovedFrames) {
+  MeshcatVisualizerParams params;
+  params.rotation_tolerance = 0.01;
+  SetUpDiagram(params);
+  diagram_->Publish(*context_);
+
+  // Overwrite the transform of link 7 in Meshcat; publishing again doesn't
+  // restore it unless the link moves.
+  const std::string path = "visualizer/iiwa14/iiwa_link_7";
+  const std::string packed_X_W7 = meshcat_->GetPackedTransform(path);
+  meshcat_->SetTransform(path, math::RigidTransformd(Eigen::Vector3d(1, 2, 3)));
+  const std::string sentinel = meshcat_->GetPackedTransform(path);
+  ASSERT_NE(sentinel, packed_X_W7);
+  diagram_->Publish(*context_);
+  EXPECT_EQ(meshcat_->GetPackedTransform(path), sentinel);
+
+  // Rotating the last joint (which only rotates link 7 about its origin) by
+  // less than the tolerance doesn't send it either.
+  systems::Context<double>& plant_context =
+      plant_->GetMyMutableContextFromRoot(context_.get());
+  const multibody::RevoluteJoint<double>& joint_7 =
+      plant_->GetJointByName<multibody::RevoluteJoint>("iiwa_joint_7");
+  joint_7.set_angle(&plant_context, 0.005);
+  diagram_->Publish(*context_);
+  EXPECT_EQ(meshcat_->GetPackedTransform(path), sentinel);
+
+  // Rotating it further does.
+  joint_7.set_angle(&plant_context, 0.02);
+  diagram_->Publish(*context_);
+  EXPECT_NE(meshcat_->GetPackedTransform(path), sentinel);
+
+  // Deleting the visualizer's objects sends all frames again.
+  meshcat_->SetTransform(path, math::RigidTransformd(Eigen::Vector3d(1, 2, 3)));
+  visualizer_->Delete();
+  diagram_->Publish(*context_);
+  EXPECT_NE(meshcat_->GetPackedTransform(path), sentinel);
+}
+
 TEST_F(MeshcatVisualizerWithIiwaTest, PublishPeriod) {
   MeshcatVisualizerParams params;
   params.publish_period = 0.123;
@@ -190,7 +231,7 @@ TEST_F(MeshcatVisualizerWithIiwaTest, Delete) {
 bool has_iiwa_frame(const MeshcatAnimation& animation, int frame) {
   return animation
       .get_key_frame<std::vector<double>>(
-          0, "visualizer/iiwa14/iiwa_link_1", "position")
+          frame, "visualizer/iiwa14/iiwa_link_1", "position")
       .has_value();
 }
 
@@ -240,6 +281,38 @@ TEST_F(MeshcatVisualizerWithIiwaTest, Recording) {
   visualizer_->PublishRecording();
 }
 
+TEST_F(MeshcatVisualizerWithIiwaTest, RecordingToFile) {
+  MeshcatVisualizerParams params;
+  SetUpDiagram(params);
+  const std::string filename = temp_directory() + "/recording.bin";
+
+  // Record every other frame.
+  MeshcatAnimationRecorder* recorder =
+      visualizer_->StartRecordingToFile(filename, 2);
+  ASSERT_NE(recorder, nullptr);
+  for (int frame = 0; frame < 4; ++frame) {
+    context_->SetTime(frame * params.publish_period);
+    diagram_->Publish(*context_);
+  }
+  // The in-memory animation is not used.
+  EXPECT_FALSE(has_iiwa_frame(*visualizer_->get_mutable_recording(), 0));
+  visualizer_->StopRecording();
+  EXPECT_GT(recorder->num_keyframes(), 0);
+
+  const std::unique_ptr<MeshcatAnimation> animation =
+      MeshcatAnimationRecorder::Load(filename);
+  EXPECT_EQ(animation->frames_per_second(), 1.0 / params.publish_period);
+  EXPECT_TRUE(has_iiwa_frame(*animation, 0));
+  EXPECT_FALSE(has_iiwa_frame(*animation, 1));
+  EXPECT_TRUE(has_iiwa_frame(*animation, 2));
+  EXPECT_FALSE(has_iiwa_frame(*animation, 3));
+
+  // Recording in memory again closes the file.
+  visualizer_->StartRecording();
+  diagram_->Publish(*context_);
+  EXPECT_TRUE(has_iiwa_frame(*visualizer_->get_mutable_recording(), 3));
+}
+
 TEST_F(MeshcatVisualizerWithIiwaTest, RecordingWithoutSetTransform) {
   SetUpDiagram();
   diagram_->Publish(*context_);
@@ -1,5 +1,6 @@
 #include "drake/geometry/proximity_engine.h"
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <unordered_map>
@@ -7,10 +8,12 @@
 #include <vector>
 
 #include <fcl/fcl.h>
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include "drake/common/filesystem.h"
 #include "drake/common/find_resource.h"
+#include "drake/common/profiler.h"
 #include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
@@ -992,6 +995,301 @@ GTEST_TEST(SignedDistanceToPointBroadphaseTest, MultipleThreshold) {
   EXPECT_EQ(2, results.size());
 }
 
+// Defined below, with the tests that it was written for.
+unordered_map<GeometryId, RigidTransformd> MakeCollidingRing(double radius,
+                                                             int N);
+
+// Confirms that the batched ComputeSignedDistanceToPoints() reports, for each
+// query point, the same results as ComputeSignedDistanceToPoint() (ordered by
+// geometry id), for any threshold and degree of parallelism.
+GTEST_TEST(ProximityEngineTests, SignedDistanceToPoints) {
+  ProximityEngine<double> engine;
+  const double r = 0.5;
+  unordered_map<GeometryId, RigidTransformd> X_WGs = MakeCollidingRing(r, 11);
+  for (const auto& pair : X_WGs) {
+    engine.AddDynamicGeometry(Sphere(r), {}, pair.first);
+  }
+  const GeometryId box_id = GeometryId::get_new_id();
+  const RigidTransformd X_WB(Vector3d(0, 0, -0.45));
+  engine.AddAnchoredGeometry(Box(20, 20, 0.1), X_WB, box_id);
+  X_WGs[box_id] = X_WB;
+  engine.UpdateWorldPoses(X_WGs);
+
+  // A grid of query points (more than fit in a single tile), listed in an
+  // order that is not spatially coherent.
+  const int kNumPerAxis = 7;
+  Eigen::Matrix3Xd p_WQs(3, kNumPerAxis * kNumPerAxis * kNumPerAxis);
+  for (int i = 0; i < p_WQs.cols(); ++i) {
+    const int cell = (i * 37) % p_WQs.cols();
+    const Vector3d index(cell % kNumPerAxis, (cell / kNumPerAxis) % kNumPerAxis,
+                         cell / (kNumPerAxis * kNumPerAxis));
+    p_WQs.col(i) = 0.75 * index - Vector3d(2.5, 2.5, 1);
+  }
+
+  for (double threshold : {kInf, 0.25, 0.0}) {
+    for (int num_threads : {1, 3}) {
+      SCOPED_TRACE(fmt::format("threshold = {}, num_threads = {}", threshold,
+                               num_threads));
+      engine.set_parallelism(Parallelism(num_threads));
+      const SignedDistanceToPoints<double> results =
+          engine.ComputeSignedDistanceToPoints(p_WQs, X_WGs, threshold);
+      ASSERT_EQ(results.num_points(), p_WQs.cols());
+      EXPECT_EQ(results.offsets[0], 0);
+      for (int i = 0; i < p_WQs.cols(); ++i) {
+        std::vector<SignedDistanceToPoint<double>> expected =
+            engine.ComputeSignedDistanceToPoint(p_WQs.col(i), X_WGs,
+                                                threshold);
+        std::sort(expected.begin(), expected.end(),
+                  [](const auto& a, const auto& b) { return a.id_G < b.id_G; });
+        const int begin = results.offsets[i];
+        ASSERT_EQ(results.offsets[i + 1] - begin,
+                  static_cast<int>(expected.size()));
+        for (int j = 0; j < static_cast<int>(expected.size()); ++j) {
+          const SignedDistanceToPoint<double> result =
+              results.result(begin + j);
+          EXPECT_EQ(result.id_G, expected[j].id_G);
+          EXPECT_EQ(result.p_GN, expected[j].p_GN);
+          EXPECT_EQ(result.distance, expected[j].distance);
+          EXPECT_EQ(result.grad_W, expected[j].grad_W);
+        }
+      }
+      if (threshold == kInf) {
+        EXPECT_EQ(results.num_results(),
+                  p_WQs.cols() * static_cast<int>(X_WGs.size()));
+      }
+    }
+  }
+
+  // No query points.
+  const SignedDistanceToPoints<double> empty =
+      engine.ComputeSignedDistanceToPoints(Eigen::Matrix3Xd(3, 0), X_WGs);
+  EXPECT_EQ(empty.num_points(), 0);
+  EXPECT_EQ(empty.num_results(), 0);
+}
+
+// Confirms that CastRays() reports the nearest hit along each ray, whether the
+// candidates come from the broadphase (finite maximum distance) or not, and
+// for any degree of parallelism.
+GTEST_TEST(ProximityEngineTests, CastRays) {
+  ProximityEngine<double> engine;
+  const GeometryId sphere_id = GeometryId::get_new_id();
+  const GeometryId box_id = GeometryId::get_new_id();
+  const GeometryId half_space_id = GeometryId::get_new_id();
+  const unordered_map<GeometryId, RigidTransformd> X_WGs{
+      {sphere_id, RigidTransformd(Vector3d(3, 0, 0))},
+      {box_id, RigidTransformd(Vector3d(0, 3, 0))},
+      {half_space_id, RigidTransformd(Vector3d(0, 0, -5))}};
+  engine.AddDynamicGeometry(Sphere(1), {}, sphere_id);
+  engine.AddAnchoredGeometry(Box(2, 2, 2), X_WGs.at(box_id), box_id);
+  engine.AddAnchoredGeometry(HalfSpace(), X_WGs.at(half_space_id),
+                             half_space_id);
+  engine.UpdateWorldPoses(X_WGs);
+
+  // The last ray starts inside the sphere; the direction of the box's ray is
+  // not unit length.
+  Eigen::Matrix3Xd p_WRs = Eigen::Matrix3Xd::Zero(3, 6);
+  p_WRs.col(5) = Vector3d(3, 0, 0.5);
+  Eigen::Matrix3Xd n_Ws(3, 6);
+  n_Ws << 1, 0, 0, 0, -1, 1,
+          0, 2, 0, 0, 0, 0,
+          0, 0, -1, 1, 0, 0;
+  const std::vector<GeometryId> expected_ids{sphere_id, box_id, half_space_id,
+                                             GeometryId{}, GeometryId{},
+                                             sphere_id};
+  const std::vector<double> expected_distances{2, 2, 5, kInf, kInf, 0};
+
+  for (double max_distance : {kInf, 10.0}) {
+    for (int num_threads : {1, 3}) {
+      SCOPED_TRACE(fmt::format("max_distance = {}, num_threads = {}",
+                               max_distance, num_threads));
+      engine.set_parallelism(Parallelism(num_threads));
+      const std::vector<RayHit> hits =
+          engine.CastRays(p_WRs, n_Ws, max_distance);
+      ASSERT_EQ(hits.size(), 6);
+      for (int i = 0; i < 6; ++i) {
+        EXPECT_EQ(hits[i].is_hit(), expected_ids[i].is_valid());
+        if (hits[i].is_hit()) EXPECT_EQ(hits[i].id_G, expected_ids[i]);
+        EXPECT_EQ(hits[i].distance, expected_distances[i]);
+      }
+    }
+  }
+
+  // Geometries beyond the maximum distance are ignored.
+  const std::vector<RayHit> near_hits = engine.CastRays(p_WRs, n_Ws, 1.5);
+  EXPECT_FALSE(near_hits[0].is_hit());
+  EXPECT_FALSE(near_hits[2].is_hit());
+  EXPECT_EQ(near_hits[5].id_G, sphere_id);
+
+  // Mismatched rays, zero directions, and negative distances are rejected.
+  EXPECT_THROW(engine.CastRays(p_WRs, n_Ws.leftCols(5), kInf),
+               std::exception);
+  EXPECT_THROW(engine.CastRays(p_WRs.leftCols(1), Eigen::Matrix3Xd::Zero(3, 1),
+                               kInf),
+               std::exception);
+  EXPECT_THROW(engine.CastRays(p_WRs, n_Ws, -1), std::exception);
+}
+
+// A Mesh whose proximity properties request a signed distance field supports
+// signed distance to point and penetration (against spheres), even though it
+// is not convex. The mesh is a U-shaped block: [-2, 2] x [-1, 1] x [-2, 0.5],
+// with the notch [-1, 1] x [-1, 1] x [-0.5, 0.5] removed.
+GTEST_TEST(ProximityEngineTests, MeshSignedDistanceField) {
+  ProximityEngine<double> engine;
+  const Mesh mesh(
+      drake::FindResourceOrThrow("drake/geometry/test/extruded_u.obj"));
+  ProximityProperties props;
+  AddSignedDistanceFieldProperties(0.05, std::nullopt, &props);
+  const GeometryId mesh_id = GeometryId::get_new_id();
+  const RigidTransformd X_WM(Vector3d(0, 0, 1));
+  engine.AddAnchoredGeometry(mesh, X_WM, mesh_id, props);
+  // Without the properties, the mesh is ignored by the point query.
+  const GeometryId plain_id = GeometryId::get_new_id();
+  engine.AddAnchoredGeometry(mesh, X_WM, plain_id);
+  unordered_map<GeometryId, RigidTransformd> X_WGs{{mesh_id, X_WM},
+                                                   {plain_id, X_WM}};
+
+  // A point in the notch, 0.6 m above its floor.
+  const Vector3d p_WQ(0.1, 0.2, 1.1);
+  const std::vector<SignedDistanceToPoint<double>> distances =
+      engine.ComputeSignedDistanceToPoint(p_WQ, X_WGs, kInf);
+  ASSERT_EQ(distances.size(), 1);
+  EXPECT_EQ(distances[0].id_G, mesh_id);
+  EXPECT_NEAR(distances[0].distance, 0.6, 1e-12);
+  EXPECT_TRUE(CompareMatrices(distances[0].grad_W, Vector3d::UnitZ(), 1e-12));
+  EXPECT_TRUE(
+      CompareMatrices(distances[0].p_GN, Vector3d(0.1, 0.2, -0.5), 1e-12));
+
+  // A sphere centered at the same point penetrates the notch's floor by 0.1 m
+  // (but no other part of the mesh).
+  ProximityEngine<double> sphere_engine(engine);
+  sphere_engine.RemoveGeometry(plain_id, false /* is_dynamic */);
+  X_WGs.erase(plain_id);
+  const GeometryId sphere_id = GeometryId::get_new_id();
+  sphere_engine.AddDynamicGeometry(Sphere(0.7), {}, sphere_id);
+  X_WGs[sphere_id] = RigidTransformd(p_WQ);
+  sphere_engine.UpdateWorldPoses(X_WGs);
+  const std::vector<PenetrationAsPointPair<double>> contacts =
+      sphere_engine.ComputePointPairPenetration(X_WGs);
+  ASSERT_EQ(contacts.size(), 1);
+  EXPECT_NEAR(contacts[0].depth, 0.1, 1e-12);
+  const Vector3d p_WFloor(0.1, 0.2, 0.5);
+  const Vector3d p_WSphereBottom(0.1, 0.2, 0.4);
+  if (contacts[0].id_A == mesh_id) {
+    EXPECT_EQ(contacts[0].id_B, sphere_id);
+    EXPECT_TRUE(CompareMatrices(contacts[0].p_WCa, p_WFloor, 1e-12));
+    EXPECT_TRUE(CompareMatrices(contacts[0].p_WCb, p_WSphereBottom, 1e-12));
+  } else {
+    EXPECT_EQ(contacts[0].id_A, sphere_id);
+    EXPECT_TRUE(CompareMatrices(contacts[0].p_WCa, p_WSphereBottom, 1e-12));
+    EXPECT_TRUE(CompareMatrices(contacts[0].p_WCb, p_WFloor, 1e-12));
+  }
+
+  // A smaller sphere fits in the notch.
+  sphere_engine.RemoveGeometry(sphere_id, true /* is_dynamic */);
+  sphere_engine.AddDynamicGeometry(Sphere(0.35), {}, sphere_id);
+  sphere_engine.UpdateWorldPoses(X_WGs);
+  EXPECT_TRUE(sphere_engine.ComputePointPairPenetration(X_WGs).empty());
+}
+
+// A mesh with a convex decomposition is represented by its pieces in
+// point-pair penetration queries: objects in a concavity of the mesh (but
+// inside its convex hull) don't report contact.
+GTEST_TEST(ProximityEngineTests, MeshConvexDecomposition) {
+  ProximityEngine<double> engine;
+  const Mesh mesh(
+      drake::FindResourceOrThrow("drake/geometry/test/extruded_u.obj"));
+  ProximityProperties props;
+  AddConvexDecompositionProperties(
+      drake::FindResourceOrThrow(
+          "drake/geometry/test/extruded_u_convex_decomposition.obj"),
+      &props);
+  const GeometryId mesh_id = GeometryId::get_new_id();
+  const RigidTransformd X_WM(Vector3d(0, 0, 1));
+  engine.AddAnchoredGeometry(mesh, X_WM, mesh_id, props);
+  const GeometryId box_id = GeometryId::get_new_id();
+  engine.AddDynamicGeometry(Box(0.4, 0.4, 0.4), {}, box_id);
+  const GeometryId sphere_id = GeometryId::get_new_id();
+  engine.AddDynamicGeometry(Sphere(0.2), {}, sphere_id);
+
+  // Both the box and the sphere are in the notch, clear of the mesh.
+  unordered_map<GeometryId, RigidTransformd> X_WGs{
+      {mesh_id, X_WM},
+      {box_id, RigidTransformd(Vector3d(-0.5, 0, 1.1))},
+      {sphere_id, RigidTransformd(Vector3d(0.5, 0, 1.1))}};
+  engine.UpdateWorldPoses(X_WGs);
+  EXPECT_TRUE(engine.ComputePointPairPenetration(X_WGs).empty());
+
+  // Moving the box into the right arm (which starts at x = 1) penetrates it
+  // by 0.3 m; the sphere still doesn't touch anything.
+  X_WGs[box_id] = RigidTransformd(Vector3d(1.1, 0, 1));
+  engine.UpdateWorldPoses(X_WGs);
+  const std::vector<PenetrationAsPointPair<double>> contacts =
+      engine.ComputePointPairPenetration(X_WGs);
+  ASSERT_EQ(contacts.size(), 1);
+  EXPECT_NEAR(contacts[0].depth, 0.3, 1e-6);
+  const GeometryId other_id =
+      contacts[0].id_A == mesh_id ? contacts[0].id_B : contacts[0].id_A;
+  EXPECT_EQ(other_id, box_id);
+  EXPECT_NEAR(std::abs(contacts[0].nhat_BA_W.x()), 1.0, 1e-6);
+}
+
+// A caller-owned ContactPairCache lets consecutive point-pair queries skip the
+// narrowphase of pairs whose cached axis still separates them, without
+// changing the results.
+GTEST_TEST(ProximityEngineTests, PointPairPenetrationWithContactPairCache) {
+  ProximityEngine<double> engine;
+  const GeometryId id_1 = GeometryId::get_new_id();
+  const GeometryId id_2 = GeometryId::get_new_id();
+  engine.AddDynamicGeometry(Sphere(1.0), {}, id_1);
+  engine.AddDynamicGeometry(Sphere(1.0), {}, id_2);
+  const SortedPair<GeometryId> pair(id_1, id_2);
+
+  // The spheres' bounding boxes overlap, but the spheres don't (the distance
+  // between their centers is 1.5√3 > 2).
+  unordered_map<GeometryId, RigidTransformd> X_WGs{
+      {id_1, RigidTransformd::Identity()},
+      {id_2, RigidTransformd(Vector3d(1.5, 1.5, 1.5))}};
+  engine.UpdateWorldPoses(X_WGs);
+  ContactPairCache cache;
+  EXPECT_TRUE(engine.ComputePointPairPenetration(X_WGs, &cache).empty());
+  EXPECT_EQ(cache.num_steps(), 1);
+  EXPECT_EQ(cache.num_skipped_in_last_step(), 0);
+  ASSERT_EQ(cache.size(), 1);
+  ASSERT_NE(cache.Find(pair), nullptr);
+  EXPECT_EQ(cache.Find(pair)->num_steps_in_contact, 0);
+
+  // The second query reuses the separating axis.
+  EXPECT_TRUE(engine.ComputePointPairPenetration(X_WGs, &cache).empty());
+  EXPECT_EQ(cache.num_steps(), 2);
+  EXPECT_EQ(cache.num_skipped_in_last_step(), 1);
+
+  // Once in contact, the narrowphase runs again and the result matches the
+  // uncached query.
+  X_WGs[id_2] = RigidTransformd(Vector3d(1.5, 0, 0));
+  engine.UpdateWorldPoses(X_WGs);
+  const std::vector<PenetrationAsPointPair<double>> cached =
+      engine.ComputePointPairPenetration(X_WGs, &cache);
+  const std::vector<PenetrationAsPointPair<double>> uncached =
+      engine.ComputePointPairPenetration(X_WGs);
+  EXPECT_EQ(cache.num_skipped_in_last_step(), 0);
+  ASSERT_EQ(cached.size(), 1);
+  ASSERT_EQ(uncached.size(), 1);
+  EXPECT_EQ(cached[0].id_A, uncached[0].id_A);
+  EXPECT_EQ(cached[0].depth, uncached[0].depth);
+  EXPECT_TRUE(CompareMatrices(cached[0].nhat_BA_W, uncached[0].nhat_BA_W));
+  ASSERT_NE(cache.Find(pair), nullptr);
+  EXPECT_EQ(cache.Find(pair)->num_steps_in_contact, 1);
+
+  // When the bounding boxes no longer overlap, the entry is dropped.
+  X_WGs[id_2] = RigidTransformd(Vector3d(5, 0, 0));
+  engine.UpdateWorldPoses(X_WGs);
+  EXPECT_TRUE(engine.ComputePointPairPenetration(X_WGs, &cache).empty());
+  EXPECT_EQ(cache.size(), 0);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.ComputePointPairPenetration(X_WGs, nullptr), ".*cache.*");
+}
+
 // Test the narrow-phase part of ComputeSignedDistanceToPoint.
 
 // Parameter for the value-parameterized test fixture SignedDistanceToPointTest.
@@ -1873,6 +2171,82 @@ GTEST_TEST(ProximityEngineTests, PenetrationAsPointPairResultOrdering) {
   }
 }
 
+// Confirms that updating the poses of many dynamic geometries in parallel
+// produces the same broadphase (and so the same query results) as updating
+// them serially.
+GTEST_TEST(ProximityEngineTests, UpdateWorldPosesParallel) {
+  ProximityEngine<double> serial_engine;
+  const double r = 0.5;
+  const int kNumSpheres = 500;
+  const unordered_map<GeometryId, RigidTransformd> poses =
+      MakeCollidingRing(r, kNumSpheres);
+  for (const auto& pair : poses) {
+    serial_engine.AddDynamicGeometry(Sphere(r), {}, pair.first);
+  }
+  ProximityEngine<double> parallel_engine(serial_engine);
+  parallel_engine.set_parallelism(Parallelism(4));
+
+  // Register the geometries at the origin, then move them into the ring.
+  unordered_map<GeometryId, RigidTransformd> identities;
+  for (const auto& pair : poses) {
+    identities[pair.first] = RigidTransformd::Identity();
+  }
+  for (ProximityEngine<double>* engine : {&serial_engine, &parallel_engine}) {
+    engine->UpdateWorldPoses(identities);
+    engine->UpdateWorldPoses(poses);
+  }
+
+  const auto expected = serial_engine.FindCollisionCandidates();
+  // Each sphere overlaps its two neighbors.
+  ASSERT_EQ(expected.size(), kNumSpheres);
+  EXPECT_EQ(parallel_engine.FindCollisionCandidates(), expected);
+}
+
+// Confirms that evaluating ComputePointPairPenetration() in parallel produces
+// results that are bit-identical to the serial evaluation (including the
+// ordering), for both dynamic-dynamic and dynamic-anchored pairs.
+GTEST_TEST(ProximityEngineTests, PenetrationAsPointPairParallel) {
+  ProximityEngine<double> engine;
+  EXPECT_EQ(engine.parallelism().num_threads(), 1);
+
+  const double r = 0.5;
+  unordered_map<GeometryId, RigidTransformd> poses = MakeCollidingRing(r, 17);
+
+  const Sphere sphere{r};
+  for (const auto& pair : poses) {
+    engine.AddDynamicGeometry(sphere, {}, pair.first);
+  }
+  // An anchored box that every sphere in the ring penetrates slightly.
+  const GeometryId box_id = GeometryId::get_new_id();
+  const RigidTransformd X_WB(Vector3d(0, 0, -0.45));
+  engine.AddAnchoredGeometry(Box(20, 20, 0.1), X_WB, box_id);
+  poses[box_id] = X_WB;
+  engine.UpdateWorldPoses(poses);
+
+  const auto expected = engine.ComputePointPairPenetration(poses);
+  // Each sphere contacts its two neighbors and the box.
+  ASSERT_EQ(expected.size(), 2 * 17);
+
+  for (int num_threads : {2, 3, 8}) {
+    SCOPED_TRACE(fmt::format("num_threads = {}", num_threads));
+    engine.set_parallelism(Parallelism(num_threads));
+    EXPECT_EQ(engine.parallelism().num_threads(), num_threads);
+    // Copies preserve the parallelism.
+    EXPECT_EQ(ProximityEngine<double>(engine).parallelism().num_threads(),
+              num_threads);
+    const auto results = engine.ComputePointPairPenetration(poses);
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+      EXPECT_EQ(results[i].id_A, expected[i].id_A);
+      EXPECT_EQ(results[i].id_B, expected[i].id_B);
+      EXPECT_EQ(results[i].p_WCa, expected[i].p_WCa);
+      EXPECT_EQ(results[i].p_WCb, expected[i].p_WCb);
+      EXPECT_EQ(results[i].nhat_BA_W, expected[i].nhat_BA_W);
+      EXPECT_EQ(results[i].depth, expected[i].depth);
+    }
+  }
+}
+
 // Confirms that the FindCollisionCandidates() computation returns the
 // same results twice in a row. This test is explicitly required because it is
 // known that updating the pose in the FCL tree can lead to erratic ordering.
@@ -1958,6 +2332,68 @@ TEST_F(ProximityEngineHydro, ComputeContactSurfacesResultOrdering) {
   }
 }
 
+// Confirms that the parallel evaluation (and the evaluation with timings)
+// produces the same surfaces, in the same order, as the serial evaluation.
+TEST_F(ProximityEngineHydro, ComputeContactSurfacesParallel) {
+  engine_.UpdateWorldPoses(poses_);
+  const auto expected = engine_.ComputeContactSurfaces(
+      HydroelasticContactRepresentation::kPolygon, poses_);
+  ASSERT_EQ(expected.size(), poses_.size());
+
+  for (int num_threads : {1, 2, 3}) {
+    SCOPED_TRACE(fmt::format("num_threads = {}", num_threads));
+    engine_.set_parallelism(Parallelism(num_threads));
+    std::vector<PairTiming> timings;
+    const auto results = engine_.ComputeContactSurfaces(
+        HydroelasticContactRepresentation::kPolygon, poses_, &timings);
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+      EXPECT_TRUE(results[i].Equal(expected[i]));
+    }
+
+    // There is exactly one timing per candidate pair; in this ring every
+    // candidate pair produces a contact surface.
+    ASSERT_EQ(timings.size(), poses_.size());
+    for (size_t i = 0; i < timings.size(); ++i) {
+      EXPECT_EQ(timings[i].pair,
+                SortedPair<GeometryId>(expected[i].id_M(), expected[i].id_N()));
+      EXPECT_GE(timings[i].seconds, 0.0);
+    }
+  }
+}
+
+// With the Profiler enabled, the narrowphase of each candidate pair is reported
+// as a timed scope, even when the caller doesn't request the timings.
+TEST_F(ProximityEngineHydro, ComputeContactSurfacesProfiled) {
+  engine_.UpdateWorldPoses(poses_);
+  Profiler& profiler = Profiler::Global();
+  profiler.Reset();
+  profiler.set_enabled(true);
+  const auto surfaces = engine_.ComputeContactSurfaces(
+      HydroelasticContactRepresentation::kPolygon, poses_);
+  profiler.set_enabled(false);
+
+  int num_pairs = 0;
+  for (const ProfileStatistics& stats : profiler.GetStatistics()) {
+    if (stats.path.back().find("ProximityEngine candidate pair (") == 0) {
+      EXPECT_EQ(stats.count, 1);
+      ++num_pairs;
+    }
+  }
+  ASSERT_EQ(surfaces.size(), poses_.size());
+  EXPECT_EQ(num_pairs, static_cast<int>(surfaces.size()));
+  const SortedPair<GeometryId> pair(surfaces[0].id_M(), surfaces[0].id_N());
+  const std::string label =
+      fmt::format("ProximityEngine candidate pair ({}, {})",
+                  pair.first().get_value(), pair.second().get_value());
+  const std::vector<ProfileStatistics> all_stats = profiler.GetStatistics();
+  EXPECT_TRUE(std::any_of(all_stats.begin(), all_stats.end(),
+                          [&label](const ProfileStatistics& stats) {
+                            return stats.path.back() == label;
+                          }));
+  profiler.Reset();
+}
+
 // Confirms that the ComputeContactSurfacesWithFallback() computation returns
 // the same results twice in a row. This test is explicitly required because it
 // is known that updating the pose in the FCL tree can lead to erratic ordering.
@@ -2044,6 +2480,39 @@ TEST_F(ProximityEngineHydroWithFallback,
   }
 }
 
+// Confirms that the parallel evaluation produces the same surfaces and point
+// pairs, in the same order, as the serial evaluation.
+TEST_F(ProximityEngineHydroWithFallback,
+       ComputeContactSurfacesWithFallbackParallel) {
+  engine_.UpdateWorldPoses(poses_);
+  vector<ContactSurface<double>> expected_surfaces;
+  vector<PenetrationAsPointPair<double>> expected_points;
+  engine_.ComputeContactSurfacesWithFallback(
+      HydroelasticContactRepresentation::kTriangle, poses_, &expected_surfaces,
+      &expected_points);
+
+  engine_.set_parallelism(Parallelism(4));
+  vector<ContactSurface<double>> surfaces;
+  vector<PenetrationAsPointPair<double>> points;
+  std::vector<PairTiming> timings;
+  engine_.ComputeContactSurfacesWithFallback(
+      HydroelasticContactRepresentation::kTriangle, poses_, &surfaces,
+      &points, &timings);
+
+  ASSERT_EQ(surfaces.size(), expected_surfaces.size());
+  for (size_t i = 0; i < surfaces.size(); ++i) {
+    EXPECT_TRUE(surfaces[i].Equal(expected_surfaces[i]));
+  }
+  ASSERT_EQ(points.size(), expected_points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_EQ(points[i].id_A, expected_points[i].id_A);
+    EXPECT_EQ(points[i].id_B, expected_points[i].id_B);
+    EXPECT_EQ(points[i].depth, expected_points[i].depth);
+  }
+  // Every candidate pair reports a timing, whichever representation it used.
+  EXPECT_EQ(timings.size(), N_);
+}
+
 // These tests validate collisions/distance between spheres. This does *not*
 // test against other geometry types because we assume FCL works. This merely
 // confirms that the ProximityEngine functions provide the correct mapping.
@@ -4077,6 +4546,67 @@ GTEST_TEST(ProximityEngineTests, Issue10577Regression_Osculation) {
   EXPECT_EQ(pairs.size(), 0);
 }
 
+// Tests continuous collision checking with HasCollisionsAlongMotion(). The
+// motions are such that geometries are separated at the start and end poses,
+// but not necessarily in between, as for a thin obstacle.
+GTEST_TEST(ProximityEngineTests, HasCollisionsAlongMotion) {
+  ProximityEngine<double> engine;
+  const double kTolerance = 1e-4;
+
+  // A small sphere translating along the x axis, through a thin wall.
+  const GeometryId sphere_id = GeometryId::get_new_id();
+  const GeometryId wall_id = GeometryId::get_new_id();
+  const RigidTransformd X_WS_start(Vector3d(-1, 0, 0));
+  const RigidTransformd X_WS_end(Vector3d(1, 0, 0));
+  engine.AddDynamicGeometry(Sphere(0.1), X_WS_start, sphere_id);
+  const RigidTransformd X_WWall(Vector3d(0, 0, 0));
+  engine.AddAnchoredGeometry(Box(0.01, 1, 1), X_WWall, wall_id);
+  const unordered_map<GeometryId, RigidTransformd> X_WGs_start{
+      {sphere_id, X_WS_start}, {wall_id, X_WWall}};
+  const unordered_map<GeometryId, RigidTransformd> X_WGs_end{
+      {sphere_id, X_WS_end}, {wall_id, X_WWall}};
+  engine.UpdateWorldPoses(X_WGs_start);
+  EXPECT_FALSE(engine.HasCollisions());
+  engine.UpdateWorldPoses(X_WGs_end);
+  EXPECT_FALSE(engine.HasCollisions());
+  EXPECT_TRUE(
+      engine.HasCollisionsAlongMotion(X_WGs_start, X_WGs_end, kTolerance));
+
+  // The same motion, offset so that it passes by the wall.
+  const RigidTransformd X_WS_start_offset(Vector3d(-1, 0.7, 0));
+  const RigidTransformd X_WS_end_offset(Vector3d(1, 0.7, 0));
+  EXPECT_FALSE(engine.HasCollisionsAlongMotion(
+      {{sphere_id, X_WS_start_offset}, {wall_id, X_WWall}},
+      {{sphere_id, X_WS_end_offset}, {wall_id, X_WWall}}, kTolerance));
+
+  // A long bar rotating a quarter turn about the z axis hits an anchored
+  // sphere only in the middle of the motion.
+  ProximityEngine<double> rotation_engine;
+  const GeometryId bar_id = GeometryId::get_new_id();
+  const GeometryId obstacle_id = GeometryId::get_new_id();
+  const RigidTransformd X_WB_start;
+  const RigidTransformd X_WB_end(
+      RotationMatrixd::MakeZRotation(M_PI_2), Vector3d::Zero());
+  const RigidTransformd X_WO(Vector3d(0.6, 0.6, 0));
+  rotation_engine.AddDynamicGeometry(Box(2, 0.02, 0.02), X_WB_start, bar_id);
+  rotation_engine.AddAnchoredGeometry(Sphere(0.05), X_WO, obstacle_id);
+  EXPECT_TRUE(rotation_engine.HasCollisionsAlongMotion(
+      {{bar_id, X_WB_start}, {obstacle_id, X_WO}},
+      {{bar_id, X_WB_end}, {obstacle_id, X_WO}}, kTolerance));
+  // The same motion, with the obstacle beyond the reach of the bar.
+  const RigidTransformd X_WO_far(Vector3d(0.8, 0.8, 0));
+  ProximityEngine<double> far_engine;
+  far_engine.AddDynamicGeometry(Box(2, 0.02, 0.02), X_WB_start, bar_id);
+  far_engine.AddAnchoredGeometry(Sphere(0.05), X_WO_far, obstacle_id);
+  EXPECT_FALSE(far_engine.HasCollisionsAlongMotion(
+      {{bar_id, X_WB_start}, {obstacle_id, X_WO_far}},
+      {{bar_id, X_WB_end}, {obstacle_id, X_WO_far}}, kTolerance));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.HasCollisionsAlongMotion(X_WGs_start, X_WGs_end, 0.0),
+      ".*tolerance > 0.*");
+}
+
 // When anchored geometry is added to the proximity engine, the broadphase
 // algorithm needs to be properly updated, otherwise it assumes all of the
 // anchored geometry has the identity transformation. This test confirms that
@@ -11,6 +11,8 @@ namespace geometry {
 namespace {
 
 using internal::HydroelasticType;
+using internal::kConvexDecompositionFile;
+using internal::kConvexDecompositionGroup;
 using internal::kComplianceType;
 using internal::kElastic;
 using internal::kFriction;
@@ -19,6 +21,9 @@ using internal::kPointStiffness;
 using internal::kHydroGroup;
 using internal::kMaterialGroup;
 using internal::kRezHint;
+using internal::kSdfCacheFile;
+using internal::kSdfGroup;
+using internal::kSdfResolution;
 using internal::kSlabThickness;
 using CoulombFrictiond = multibody::CoulombFriction<double>;
 
@@ -172,6 +177,39 @@ GTEST_TEST(ProximityPropertiesTest, AddHalfSpaceSoftProperties) {
       });
 }
 
+GTEST_TEST(ProximityPropertiesTest, AddSignedDistanceFieldProperties) {
+  ProximityProperties props;
+  AddSignedDistanceFieldProperties(0.01, std::nullopt, &props);
+  EXPECT_EQ(props.GetProperty<double>(kSdfGroup, kSdfResolution), 0.01);
+  EXPECT_FALSE(props.HasProperty(kSdfGroup, kSdfCacheFile));
+
+  ProximityProperties cached_props;
+  AddSignedDistanceFieldProperties(0.02, "/tmp/mesh.sdf", &cached_props);
+  EXPECT_EQ(cached_props.GetProperty<double>(kSdfGroup, kSdfResolution), 0.02);
+  EXPECT_EQ(cached_props.GetProperty<std::string>(kSdfGroup, kSdfCacheFile),
+            "/tmp/mesh.sdf");
+
+  for (double resolution : {0.0, -0.1}) {
+    ProximityProperties bad_props;
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        AddSignedDistanceFieldProperties(resolution, std::nullopt, &bad_props),
+        "The signed distance field resolution must be positive.*");
+  }
+}
+
+GTEST_TEST(ProximityPropertiesTest, AddConvexDecompositionProperties) {
+  ProximityProperties props;
+  AddConvexDecompositionProperties("/tmp/bin_decomposition.obj", &props);
+  EXPECT_EQ(props.GetProperty<std::string>(kConvexDecompositionGroup,
+                                           kConvexDecompositionFile),
+            "/tmp/bin_decomposition.obj");
+
+  ProximityProperties bad_props;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      AddConvexDecompositionProperties("", &bad_props),
+      "The convex decomposition file name must not be empty");
+}
+
 }  // namespace
 }  // namespace geometry
 }  // namespace drake
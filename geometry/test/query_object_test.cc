@@ -181,6 +181,12 @@ TEST_F(QueryObjectTest, DefaultQueryThrows) {
       GeometryId::get_new_id(), GeometryId::get_new_id()));
   EXPECT_DEFAULT_ERROR(
       default_object.ComputeSignedDistanceToPoint(Vector3<double>::Zero()));
+  EXPECT_DEFAULT_ERROR(default_object.ComputeSignedDistanceToPoints(
+      Eigen::Matrix3Xd::Zero(3, 2)));
+
+  // Ray casting queries.
+  EXPECT_DEFAULT_ERROR(default_object.CastRays(Eigen::Matrix3Xd::Zero(3, 1),
+                                               Eigen::Matrix3Xd::Ones(3, 1)));
 
   EXPECT_DEFAULT_ERROR(default_object.FindCollisionCandidates());
   EXPECT_DEFAULT_ERROR(default_object.HasCollisions());
@@ -1,10 +1,12 @@
 #include "drake/geometry/read_obj.h"
 
+#include <fstream>
 #include <unordered_set>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
 
 namespace drake {
 namespace geometry {
@@ -135,6 +137,98 @@ GTEST_TEST(ReadObjFile, NonconvexMesh) {
     }
   }
 }
+
+// Each object of a multi-object file is read separately, with its own
+// (renumbered) vertices.
+GTEST_TEST(ReadObjFileObjects, ExtrudedUDecomposition) {
+  const double scale = 0.5;
+  const auto objects = ReadObjFileObjects(
+      FindResourceOrThrow(
+          "drake/geometry/test/extruded_u_convex_decomposition.obj"),
+      scale, false /*triangulate */);
+  ASSERT_EQ(objects.size(), 3);
+  // The right arm, [1, 2] x [-1, 1] x [-2, 0.5].
+  const auto& [vertices, faces, num_faces] = objects[1];
+  Eigen::Matrix<double, 8, 3> vertices_expected;
+  // clang-format off
+  vertices_expected << 1, -1, -2,
+                       2, -1, -2,
+                       1,  1, -2,
+                       2,  1, -2,
+                       1, -1, 0.5,
+                       2, -1, 0.5,
+                       1,  1, 0.5,
+                       2,  1, 0.5;
+  // clang-format on
+  vertices_expected *= scale;
+  CheckVertices(vertices, vertices_expected.transpose(), 1E-12);
+  EXPECT_EQ(num_faces, 6);
+  EXPECT_EQ(faces->size(), num_faces * 5);
+  for (int i = 0; i < num_faces; ++i) {
+    EXPECT_EQ((*faces)[5 * i], 4);
+    for (int j = 1; j <= 4; ++j) {
+      EXPECT_GE((*faces)[5 * i + j], 0);
+      EXPECT_LT((*faces)[5 * i + j], 8);
+    }
+  }
+
+  // A single-object file is a single object.
+  EXPECT_EQ(ReadObjFileObjects(
+                FindResourceOrThrow("drake/geometry/test/quad_cube.obj"), 1.0,
+                false /*triangulate */)
+                .size(),
+            1);
+}
+
+GTEST_TEST(GetObjFileData, SharedParse) {
+  const std::string filename =
+      FindResourceOrThrow("drake/geometry/test/quad_cube.obj");
+  const std::shared_ptr<const ObjFileData> polygonal =
+      GetObjFileData(filename, false /* triangulate */);
+  ASSERT_TRUE(polygonal->success);
+  EXPECT_EQ(polygonal->shapes.size(), 1);
+  EXPECT_EQ(polygonal->shapes[0].mesh.num_face_vertices.size(), 6);
+
+  // Repeated requests share the parse, even when nobody holds on to it.
+  const ObjFileData* const address = polygonal.get();
+  EXPECT_EQ(GetObjFileData(filename, false).get(), address);
+
+  // Triangulation is a different parse.
+  const std::shared_ptr<const ObjFileData> triangulated =
+      GetObjFileData(filename, true /* triangulate */);
+  EXPECT_NE(triangulated.get(), address);
+  EXPECT_EQ(triangulated->shapes[0].mesh.num_face_vertices.size(), 12);
+}
+
+GTEST_TEST(GetObjFileData, RewrittenFile) {
+  const std::string filename = temp_directory() + "/rewritten.obj";
+  {
+    std::ofstream file(filename);
+    file << "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n";
+  }
+  const std::shared_ptr<const ObjFileData> before =
+      GetObjFileData(filename, true);
+  ASSERT_TRUE(before->success);
+  EXPECT_EQ(before->attrib.vertices.size(), 9);
+
+  // A file with different contents is parsed again.
+  {
+    std::ofstream file(filename);
+    file << "v 0 0 0\nv 1 0 0\nv 0 1 0\nv 0 0 1\nf 1 2 3\nf 1 2 4\n";
+  }
+  const std::shared_ptr<const ObjFileData> after =
+      GetObjFileData(filename, true);
+  EXPECT_NE(after.get(), before.get());
+  EXPECT_EQ(after->attrib.vertices.size(), 12);
+  EXPECT_EQ(before->attrib.vertices.size(), 9);
+}
+
+GTEST_TEST(GetObjFileData, ParseErrorIsReported) {
+  const std::shared_ptr<const ObjFileData> data =
+      GetObjFileData(temp_directory() + "/no_such_file.obj", true);
+  EXPECT_FALSE(data->success);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
@@ -286,6 +286,21 @@ TEST_F(SceneGraphTest, FullPoseUpdateAnchoredOnly) {
       SceneGraphTester::FullPoseUpdate(scene_graph_, *context_));
 }
 
+// The query object cached in a cloned context must not refer to the source
+// context; it has to remain usable after the source is destroyed.
+TEST_F(SceneGraphTest, ClonedContextQueryObject) {
+  SourceId s_id = scene_graph_.RegisterSource();
+  scene_graph_.RegisterAnchoredGeometry(s_id, make_sphere_instance());
+  CreateDefaultContext();
+  const auto& port = scene_graph_.get_query_output_port();
+  const auto& source_query = port.Eval<QueryObject<double>>(*context_);
+  unique_ptr<Context<double>> clone = context_->Clone();
+  const auto& clone_query = port.Eval<QueryObject<double>>(*clone);
+  EXPECT_NE(&clone_query, &source_query);
+  context_.reset();
+  EXPECT_EQ(clone_query.inspector().num_geometries(), 1);
+}
+
 template <typename T>
 class TypedSceneGraphTest : public SceneGraphTest {
  public:
@@ -400,6 +415,34 @@ TEST_F(SceneGraphTest, ModelInspector) {
             anchored_id);
 }
 
+// Confirms that the config is applied to the model and carried into newly
+// allocated contexts, and that invalid values are rejected.
+TEST_F(SceneGraphTest, SetConfig) {
+  EXPECT_EQ(scene_graph_.get_config().proximity_num_threads, 1);
+
+  SceneGraphConfig config;
+  config.proximity_num_threads = 3;
+  scene_graph_.set_config(config);
+  EXPECT_EQ(scene_graph_.get_config().proximity_num_threads, 3);
+  CreateDefaultContext();
+  EXPECT_EQ(SceneGraphTester::GetGeometryState(scene_graph_, *context_)
+                .proximity_parallelism()
+                .num_threads(),
+            3);
+
+  config.proximity_num_threads = 0;
+  scene_graph_.set_config(config);
+  auto context = scene_graph_.CreateDefaultContext();
+  EXPECT_EQ(SceneGraphTester::GetGeometryState(scene_graph_, *context)
+                .proximity_parallelism()
+                .num_threads(),
+            Parallelism::Max().num_threads());
+
+  config.proximity_num_threads = -1;
+  DRAKE_EXPECT_THROWS_MESSAGE(scene_graph_.set_config(config),
+                              ".*proximity_num_threads must be non-negative.*");
+}
+
 // SceneGraph provides a thin wrapper on the GeometryState renderer
 // configuration/introspection code. These tests are just smoke tests that the
 // functions work. It relies on GeometryState to properly unit test the
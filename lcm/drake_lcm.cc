@@ -1,8 +1,17 @@
 #include "drake/lcm/drake_lcm.h"
 
+#include <poll.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
 #include <cstdlib>
+#include <deque>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -24,6 +33,27 @@ constexpr const char* const kLcmDefaultUrl = "udpm://239.255.76.67:7667?ttl=0";
 // Defined below.
 class DrakeSubscription;
 
+// The state shared by the background receive thread, the subscriptions, and
+// HandleSubscriptions(), once DrakeLcm::StartReceiveThread() has been called.
+struct ReceiveThreadState {
+  // Guards every call into the native LCM instance other than publishing
+  // (handling, subscribing, and unsubscribing), every subscription's queue,
+  // and the fields below.
+  std::mutex mutex;
+
+  // Signaled whenever a message is queued.
+  std::condition_variable message_queued;
+
+  LcmQueueDropPolicy drop_policy{};
+  DrakeLcmReceiveStatistics statistics;
+};
+
+// A message copied out of LCM's receive buffer by the receive thread.
+struct QueuedMessage {
+  std::string channel;
+  std::vector<uint8_t> data;
+};
+
 }  // namespace
 
 class DrakeLcm::Impl {
@@ -48,6 +78,32 @@ class DrakeLcm::Impl {
     }
   }
 
+  // Attaches the subscriptions that were deferred by the constructor.
+  void AttachDeferredSubscriptions();
+
+  // Attaches a newly created subscription (unless initialization is deferred).
+  void Attach(DrakeSubscription* subscription);
+
+  // The body of the background receive thread.
+  void ReceiveThreadMain() {
+    const int lcm_fd = lcm_.getFileno();
+    while (true) {
+      pollfd fds[2] = {{lcm_fd, POLLIN, 0}, {wake_pipe_[0], POLLIN, 0}};
+      if (::poll(fds, 2, -1 /* no timeout */) < 0) {
+        if (errno == EINTR) continue;
+        return;
+      }
+      if (fds[1].revents != 0) {
+        // The destructor is asking us to stop.
+        return;
+      }
+      if (fds[0].revents & POLLIN) {
+        std::lock_guard<std::mutex> lock(receive_state_->mutex);
+        lcm_.handleTimeout(0);
+      }
+    }
+  }
+
   // Housekeeping: scrub any deallocated subscriptions.
   void CleanUpOldSubscriptions() {
     subscriptions_.erase(std::remove_if(
@@ -63,6 +119,12 @@ class DrakeLcm::Impl {
   ::lcm::LCM lcm_;
   std::vector<std::weak_ptr<DrakeSubscription>> subscriptions_;
   std::string handle_subscriptions_error_message_;
+
+  // These are only set once StartReceiveThread() has been called. The pipe is
+  // written to by the destructor, to wake and stop the thread.
+  std::unique_ptr<ReceiveThreadState> receive_state_;
+  std::thread receive_thread_;
+  int wake_pipe_[2]{-1, -1};
 };
 
 DrakeLcm::DrakeLcm() : DrakeLcm(std::string{}) {}
@@ -154,6 +216,12 @@ class DrakeSubscription final : public DrakeSubscriptionInterface {
 
   ~DrakeSubscription() {
     DRAKE_DEMAND(strong_self_reference_ == nullptr);
+    std::unique_lock<std::mutex> lock;
+    if (receive_state_ != nullptr) {
+      // Don't pull the rug out from under the receive thread.
+      lock = std::unique_lock<std::mutex>(receive_state_->mutex);
+      receive_state_->statistics.num_queued -= static_cast<int>(queue_.size());
+    }
     if (native_subscription_) {
       DRAKE_DEMAND(native_instance_ != nullptr);
       native_instance_->unsubscribe(native_subscription_);
@@ -173,6 +241,10 @@ class DrakeSubscription final : public DrakeSubscriptionInterface {
 
   void set_queue_capacity(int capacity) final {
     DRAKE_DEMAND(!weak_self_reference_.expired());
+    std::unique_lock<std::mutex> lock;
+    if (receive_state_ != nullptr) {
+      lock = std::unique_lock<std::mutex>(receive_state_->mutex);
+    }
     queue_capacity_ = capacity;
     if (native_subscription_) {
       DRAKE_DEMAND(native_instance_ != nullptr);
@@ -189,14 +261,42 @@ class DrakeSubscription final : public DrakeSubscriptionInterface {
     native_subscription_->setQueueCapacity(queue_capacity_);
   }
 
-  // This is ONLY called from the DrakeLcm dtor.  Thus, a HandleSubscriptions
-  // is never in flight, so we can freely change any/all of our member fields.
+  // Routes messages into this subscription's queue (rather than directly to the
+  // handler), for use by the receive thread.  The caller must hold the
+  // state's mutex (or the receive thread must not be running yet).
+  void EnableQueueing(ReceiveThreadState* receive_state) {
+    DRAKE_DEMAND(receive_state != nullptr);
+    receive_state_ = receive_state;
+  }
+
+  // Moves all queued messages into `messages` and returns how many there
+  // were.  The caller must hold the state's mutex.
+  int TakeQueuedMessages(std::deque<QueuedMessage>* messages) {
+    DRAKE_DEMAND(receive_state_ != nullptr);
+    messages->clear();
+    messages->swap(queue_);
+    return static_cast<int>(messages->size());
+  }
+
+  // Passes a queued message to the handler.
+  void DispatchQueuedMessage(const QueuedMessage& message) {
+    if (user_callback_ != nullptr) {
+      user_callback_(message.channel, message.data.data(),
+                     static_cast<int>(message.data.size()));
+    }
+  }
+
+  // This is ONLY called from the DrakeLcm dtor (after the receive thread, if
+  // any, has been stopped).  Thus, a HandleSubscriptions is never in flight,
+  // so we can freely change any/all of our member fields.
   void Detach() {
     DRAKE_DEMAND(!weak_self_reference_.expired());
     if (native_subscription_) {
       DRAKE_DEMAND(native_instance_ != nullptr);
       native_instance_->unsubscribe(native_subscription_);
     }
+    receive_state_ = {};
+    queue_.clear();
     native_instance_ = {};
     native_subscription_ = {};
     user_callback_ = {};
@@ -226,11 +326,34 @@ class DrakeSubscription final : public DrakeSubscriptionInterface {
   void InstanceCallback(const std::string& channel,
                         const ::lcm::ReceiveBuffer* buffer) {
     DRAKE_DEMAND(!weak_self_reference_.expired());
+    if (receive_state_ != nullptr) {
+      // We're on the receive thread, which holds the state's mutex.
+      Enqueue(channel, buffer);
+      return;
+    }
     if (user_callback_ != nullptr) {
       user_callback_(channel, buffer->data, buffer->data_size);
     }
   }
 
+  void Enqueue(const std::string& channel, const ::lcm::ReceiveBuffer* buffer) {
+    DrakeLcmReceiveStatistics& statistics = receive_state_->statistics;
+    ++statistics.num_received;
+    if (static_cast<int>(queue_.size()) >= std::max(queue_capacity_, 1)) {
+      ++statistics.num_dropped;
+      if (receive_state_->drop_policy == LcmQueueDropPolicy::kDropNewest) {
+        return;
+      }
+      queue_.pop_front();
+      --statistics.num_queued;
+    }
+    const uint8_t* const data = static_cast<const uint8_t*>(buffer->data);
+    queue_.push_back(
+        QueuedMessage{channel, {data, data + buffer->data_size}});
+    ++statistics.num_queued;
+    receive_state_->message_queued.notify_all();
+  }
+
   std::string channel_regex_;
 
   // The native handle we can use to unsubscribe.
@@ -238,6 +361,11 @@ class DrakeSubscription final : public DrakeSubscriptionInterface {
   ::lcm::Subscription* native_subscription_{};
   int queue_capacity_{1};
 
+  // When the receive thread is running, received messages wait here until
+  // HandleSubscriptions() dispatches them.  Guarded by receive_state_->mutex.
+  ReceiveThreadState* receive_state_{};
+  std::deque<QueuedMessage> queue_;
+
   DrakeLcmInterface::MultichannelHandlerFunction user_callback_;
 
   // We can use "strong" to pretend a subscriber is still active.
@@ -256,9 +384,7 @@ std::shared_ptr<DrakeSubscriptionInterface> DrakeLcm::Subscribe(
   // Add the new subscriber.
   auto result = DrakeSubscription::CreateSingleChannel(
       &(impl_->lcm_), channel, std::move(handler));
-  if (!impl_->deferred_initialization_) {
-    result->AttachIfNeeded();
-  }
+  impl_->Attach(result.get());
   impl_->subscriptions_.push_back(result);
   DRAKE_DEMAND(!impl_->subscriptions_.back().expired());
   return result;
@@ -272,28 +398,109 @@ std::shared_ptr<DrakeSubscriptionInterface> DrakeLcm::SubscribeAllChannels(
   // Add the new subscriber.
   auto result = DrakeSubscription::CreateMultichannel(
       &(impl_->lcm_), std::move(handler));
-  if (!impl_->deferred_initialization_) {
-    result->AttachIfNeeded();
-  }
+  impl_->Attach(result.get());
   impl_->subscriptions_.push_back(result);
   DRAKE_DEMAND(!impl_->subscriptions_.back().expired());
   return result;
 }
 
-int DrakeLcm::HandleSubscriptions(int timeout_millis) {
-  if (impl_->deferred_initialization_) {
-    for (auto& sub : impl_->subscriptions_) {
+void DrakeLcm::Impl::AttachDeferredSubscriptions() {
+  if (deferred_initialization_) {
+    for (auto& sub : subscriptions_) {
       sub.lock()->AttachIfNeeded();
     }
-    impl_->deferred_initialization_ = false;
+    deferred_initialization_ = false;
+  }
+}
+
+void DrakeLcm::Impl::Attach(DrakeSubscription* subscription) {
+  std::unique_lock<std::mutex> lock;
+  if (receive_state_ != nullptr) {
+    lock = std::unique_lock<std::mutex>(receive_state_->mutex);
+    subscription->EnableQueueing(receive_state_.get());
+  }
+  if (!deferred_initialization_) {
+    subscription->AttachIfNeeded();
+  }
+}
+
+void DrakeLcm::StartReceiveThread(LcmQueueDropPolicy drop_policy) {
+  if (impl_->receive_state_ != nullptr) {
+    throw std::logic_error(
+        "DrakeLcm::StartReceiveThread() has already been called");
+  }
+  impl_->CleanUpOldSubscriptions();
+  impl_->AttachDeferredSubscriptions();
+  if (::pipe(impl_->wake_pipe_) != 0) {
+    throw std::runtime_error(
+        "DrakeLcm::StartReceiveThread() could not create a pipe");
   }
-  // Keep pumping handleTimeout until it's empty, but only pause for the
-  // timeout on the first attempt.
+  impl_->receive_state_ = std::make_unique<ReceiveThreadState>();
+  impl_->receive_state_->drop_policy = drop_policy;
+  for (auto& sub : impl_->subscriptions_) {
+    sub.lock()->EnableQueueing(impl_->receive_state_.get());
+  }
+  impl_->receive_thread_ = std::thread([impl = impl_.get()]() {
+    impl->ReceiveThreadMain();
+  });
+}
+
+DrakeLcmReceiveStatistics DrakeLcm::get_receive_statistics() const {
+  if (impl_->receive_state_ == nullptr) {
+    return {};
+  }
+  std::lock_guard<std::mutex> lock(impl_->receive_state_->mutex);
+  return impl_->receive_state_->statistics;
+}
+
+int DrakeLcm::HandleSubscriptions(int timeout_millis) {
+  impl_->AttachDeferredSubscriptions();
   int total_messages = 0;
-  int zero_or_one = impl_->lcm_.handleTimeout(timeout_millis);
-  for (; zero_or_one > 0; zero_or_one = impl_->lcm_.handleTimeout(0)) {
-    DRAKE_DEMAND(zero_or_one == 1);
-    ++total_messages;
+  if (impl_->receive_state_ != nullptr) {
+    // Wait for the receive thread to queue something (with the same timeout
+    // semantics as LCM), and then take all of the queued messages.
+    ReceiveThreadState& state = *impl_->receive_state_;
+    std::vector<std::pair<std::shared_ptr<DrakeSubscription>,
+                          std::deque<QueuedMessage>>> batches;
+    {
+      std::unique_lock<std::mutex> lock(state.mutex);
+      auto has_messages = [&state]() {
+        return state.statistics.num_queued > 0;
+      };
+      if (timeout_millis < 0) {
+        state.message_queued.wait(lock, has_messages);
+      } else if (timeout_millis > 0) {
+        state.message_queued.wait_for(
+            lock, std::chrono::milliseconds(timeout_millis), has_messages);
+      }
+      for (const auto& weak_subscription : impl_->subscriptions_) {
+        auto subscription = weak_subscription.lock();
+        if (subscription == nullptr) continue;
+        std::deque<QueuedMessage> messages;
+        const int count = subscription->TakeQueuedMessages(&messages);
+        if (count > 0) {
+          total_messages += count;
+          batches.emplace_back(std::move(subscription), std::move(messages));
+        }
+      }
+      state.statistics.num_queued -= total_messages;
+      state.statistics.num_handled += total_messages;
+    }
+    // Call the handlers without holding the mutex, so that they may publish,
+    // subscribe, or unsubscribe.
+    for (const auto& [subscription, messages] : batches) {
+      for (const QueuedMessage& message : messages) {
+        subscription->DispatchQueuedMessage(message);
+      }
+    }
+  } else {
+    // Keep pumping handleTimeout until it's empty, but only pause for the
+    // timeout on the first attempt.
+    int zero_or_one = impl_->lcm_.handleTimeout(timeout_millis);
+    for (; zero_or_one > 0; zero_or_one = impl_->lcm_.handleTimeout(0)) {
+      DRAKE_DEMAND(zero_or_one == 1);
+      ++total_messages;
+    }
   }
   // If a handler posted an error, raise it now that we're done with LCM C code.
   if (!impl_->handle_subscriptions_error_message_.empty()) {
@@ -313,6 +520,16 @@ void DrakeLcm::OnHandleSubscriptionsError(const std::string& error_message) {
 }
 
 DrakeLcm::~DrakeLcm() {
+  // Stop the receive thread, if any.
+  if (impl_->receive_thread_.joinable()) {
+    const char wake = 0;
+    const ssize_t written = ::write(impl_->wake_pipe_[1], &wake, 1);
+    DRAKE_DEMAND(written == 1);
+    impl_->receive_thread_.join();
+    ::close(impl_->wake_pipe_[0]);
+    ::close(impl_->wake_pipe_[1]);
+  }
+
   // Invalidate our DrakeSubscription objects.
   for (const auto& weak_subscription : impl_->subscriptions_) {
     auto subscription = weak_subscription.lock();
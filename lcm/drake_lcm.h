@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
@@ -12,6 +13,37 @@
 namespace drake {
 namespace lcm {
 
+/**
+ * Selects which message is discarded when a subscription's queue is full and
+ * another message arrives, when using DrakeLcm::StartReceiveThread().
+ */
+enum class LcmQueueDropPolicy {
+  /** Discards the oldest queued message, to make room for the new one. */
+  kDropOldest,
+
+  /** Discards the newly received message. */
+  kDropNewest,
+};
+
+/**
+ * Counters reported by DrakeLcm::get_receive_statistics().
+ */
+struct DrakeLcmReceiveStatistics {
+  /** The number of messages received by the background receive thread. */
+  int64_t num_received{0};
+
+  /** The number of received messages discarded because a subscription's queue
+   was full. */
+  int64_t num_dropped{0};
+
+  /** The number of messages passed to subscription handlers by
+   HandleSubscriptions(). */
+  int64_t num_handled{0};
+
+  /** The number of messages currently waiting in the subscriptions' queues. */
+  int num_queued{0};
+};
+
 /**
  * A wrapper around a *real* LCM instance.
  */
@@ -56,6 +88,31 @@ class DrakeLcm : public DrakeLcmInterface {
    */
   ::lcm::LCM* get_lcm_instance();
 
+  /**
+   * (Advanced) Launches a background thread that receives messages as soon as
+   * they arrive, independently of how often HandleSubscriptions() is called.
+   * Each received message is copied into a bounded queue belonging to its
+   * subscription (the capacity is set by
+   * DrakeSubscriptionInterface::set_queue_capacity(), and defaults to 1); when
+   * a queue is full, the @p drop_policy decides which message is discarded.
+   * The handlers are still only ever called from within HandleSubscriptions(),
+   * on the thread that calls it, which drains the queues.
+   *
+   * Unlike the native LCM queues, these queues also work with the memq:// URL.
+   * The thread is stopped by the destructor.
+   *
+   * @throws std::exception if the receive thread was already started.
+   */
+  void StartReceiveThread(
+      LcmQueueDropPolicy drop_policy = LcmQueueDropPolicy::kDropOldest);
+
+  /**
+   * Returns the message counters of the background receive thread (all zero
+   * if StartReceiveThread() has not been called). May be called from any
+   * thread.
+   */
+  DrakeLcmReceiveStatistics get_receive_statistics() const;
+
 
   void Publish(const std::string&, const void*, int,
                std::optional<double>) override;
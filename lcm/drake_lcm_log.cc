@@ -1,15 +1,142 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <limits>
 #include <stdexcept>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/common/drake_assert.h"
 
 namespace drake {
 namespace lcm {
+namespace {
+
+// Reads a big-endian unsigned integer of type T from `bytes`.
+template <typename T>
+T ReadBigEndian(const uint8_t* bytes) {
+  T result = 0;
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    result = static_cast<T>((result << 8) | bytes[i]);
+  }
+  return result;
+}
+
+}  // namespace
+
+// A read-only, memory-mapped LCM log along with an index of its messages.
+//
+// Each message (an "event" in LCM's terms) in the file consists of a 28 byte
+// big-endian header -- a sync word, the event number, the timestamp (in
+// microseconds), the channel name length, and the data length -- followed by
+// the channel name and the data. The index is built by hopping from header to
+// header, so the message data is never read (or even paged in) until it is
+// dispatched.
+class DrakeLcmLog::Reader {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Reader);
+
+  struct Message {
+    uint64_t timestamp{};
+    // Points into the mapped file.
+    const void* data{};
+    int data_size{};
+    // The index into channels().
+    int channel{};
+  };
+
+  explicit Reader(const std::string& file_name) {
+    const int fd = ::open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error("Failed to open log file: " + file_name);
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0) {
+      ::close(fd);
+      throw std::runtime_error("Failed to open log file: " + file_name);
+    }
+    size_ = static_cast<size_t>(info.st_size);
+    if (size_ > 0) {
+      mapped_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (mapped_ == MAP_FAILED) {
+      throw std::runtime_error("Failed to map log file: " + file_name);
+    }
+    BuildIndex();
+  }
+
+  ~Reader() {
+    if (mapped_ != MAP_FAILED) {
+      ::munmap(mapped_, size_);
+    }
+  }
+
+  const std::vector<Message>& messages() const { return messages_; }
+
+  const std::string& channel(int index) const { return channels_[index]; }
+
+ private:
+  void BuildIndex() {
+    constexpr uint32_t kSyncWord = 0xEDA1DA01;
+    constexpr size_t kHeaderSize = 28;
+    // The same sanity limits as LCM's own log reader.
+    constexpr int32_t kMaxChannelLength = 1000;
+    constexpr int32_t kMaxDataLength = 256 * 1024 * 1024;
+
+    const uint8_t* const bytes = static_cast<const uint8_t*>(mapped_);
+    std::unordered_map<std::string_view, int> channel_indices;
+    size_t offset = 0;
+    while (offset + kHeaderSize <= size_) {
+      const uint8_t* header = bytes + offset;
+      const auto channel_length =
+          static_cast<int32_t>(ReadBigEndian<uint32_t>(header + 20));
+      const auto data_length =
+          static_cast<int32_t>(ReadBigEndian<uint32_t>(header + 24));
+      if (ReadBigEndian<uint32_t>(header) != kSyncWord ||
+          channel_length <= 0 || channel_length >= kMaxChannelLength ||
+          data_length < 0 || data_length >= kMaxDataLength) {
+        // Like LCM, we resynchronize by searching for the next sync word.
+        ++offset;
+        continue;
+      }
+      const size_t end = offset + kHeaderSize + channel_length + data_length;
+      if (end > size_) {
+        // The final message was truncated.
+        break;
+      }
+      const std::string_view channel_name(
+          reinterpret_cast<const char*>(header + kHeaderSize), channel_length);
+      const auto [iter, inserted] = channel_indices.emplace(
+          channel_name, static_cast<int>(channels_.size()));
+      if (inserted) {
+        channels_.emplace_back(channel_name);
+      }
+      Message message;
+      message.timestamp = ReadBigEndian<uint64_t>(header + 12);
+      message.data = header + kHeaderSize + channel_length;
+      message.data_size = data_length;
+      message.channel = iter->second;
+      messages_.push_back(message);
+      offset = end;
+    }
+  }
+
+  void* mapped_{MAP_FAILED};
+  size_t size_{};
+  std::vector<Message> messages_;
+  std::vector<std::string> channels_;
+};
 
 DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write,
                          bool overwrite_publish_time_with_system_clock)
@@ -19,15 +146,16 @@ DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write,
       url_("lcmlog://" + file_name) {
   if (is_write_) {
     log_ = std::make_unique<::lcm::LogFile>(file_name, "w");
+    if (!log_->good()) {
+      throw std::runtime_error("Failed to open log file: " + file_name);
+    }
   } else {
-    log_ = std::make_unique<::lcm::LogFile>(file_name, "r");
-    next_event_ = log_->readNextEvent();
-  }
-  if (!log_->good()) {
-    throw std::runtime_error("Failed to open log file: " + file_name);
+    reader_ = std::make_unique<Reader>(file_name);
   }
 }
 
+DrakeLcmLog::~DrakeLcmLog() = default;
+
 std::string DrakeLcmLog::get_lcm_url() const {
   return url_;
 }
@@ -92,10 +220,32 @@ double DrakeLcmLog::GetNextMessageTime() const {
   }
 
   std::lock_guard<std::mutex> lock(mutex_);
-  if (next_event_ == nullptr) {
+  if (next_message_ >= num_messages()) {
     return std::numeric_limits<double>::infinity();
   }
-  return timestamp_to_second(next_event_->timestamp);
+  return timestamp_to_second(reader_->messages()[next_message_].timestamp);
+}
+
+void DrakeLcmLog::Seek(double time_sec) {
+  if (is_write_) {
+    throw std::logic_error("Seek is only available for log playback.");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const std::vector<Reader::Message>& messages = reader_->messages();
+  const auto iter = std::lower_bound(
+      messages.begin(), messages.end(), time_sec,
+      [this](const Reader::Message& message, double time) {
+        return timestamp_to_second(message.timestamp) < time;
+      });
+  next_message_ = static_cast<int>(iter - messages.begin());
+}
+
+int DrakeLcmLog::num_messages() const {
+  if (is_write_) {
+    throw std::logic_error("num_messages is only available for log playback.");
+  }
+  return static_cast<int>(reader_->messages().size());
 }
 
 void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
@@ -106,25 +256,28 @@ void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
 
   std::lock_guard<std::mutex> lock(mutex_);
   // End of log, do nothing.
-  if (next_event_ == nullptr) return;
+  if (next_message_ >= num_messages()) return;
+  const Reader::Message& message = reader_->messages()[next_message_];
 
   // Do nothing if the call time does not match the event's time.
-  if (current_time != timestamp_to_second(next_event_->timestamp)) {
+  if (current_time != timestamp_to_second(message.timestamp)) {
     return;
   }
 
-  // Dispatch message if necessary.
-  const auto& range = subscriptions_.equal_range(next_event_->channel);
+  // Dispatch message if necessary. The data is passed directly from the
+  // mapped file.
+  const std::string& channel = reader_->channel(message.channel);
+  const auto& range = subscriptions_.equal_range(channel);
   for (auto iter = range.first; iter != range.second; ++iter) {
     const HandlerFunction& handler = iter->second;
-    handler(next_event_->data, next_event_->datalen);
+    handler(message.data, message.data_size);
   }
   for (MultichannelHandlerFunction& handler : multichannel_subscriptions_) {
-    handler(next_event_->channel, next_event_->data, next_event_->datalen);
+    handler(channel, message.data, message.data_size);
   }
 
   // Advance log.
-  next_event_ = log_->readNextEvent();
+  ++next_message_;
 }
 
 void DrakeLcmLog::OnHandleSubscriptionsError(const std::string& error_message) {
@@ -23,6 +23,12 @@ namespace lcm {
  * is generated by some external logger (the lcm-logger binary), which uses the
  * unix epoch time clock to record message arrival time, the user needs to
  * offset those timestamps properly to match and the clock used for playback.
+ *
+ * In read mode, the log file is memory-mapped and indexed when it is opened
+ * (by scanning only the message headers), so that the playback cursor can be
+ * moved to any time with Seek() in O(log n), and the message bytes are handed
+ * to subscribers directly from the mapped file without being copied. Messages
+ * on channels without subscribers are skipped without being read.
  */
 class DrakeLcmLog : public DrakeLcmInterface {
  public:
@@ -46,6 +52,8 @@ class DrakeLcmLog : public DrakeLcmInterface {
   DrakeLcmLog(const std::string& file_name, bool is_write,
               bool overwrite_publish_time_with_system_clock = false);
 
+  ~DrakeLcmLog() override;
+
   /**
    * Writes an entry occurred at @p timestamp with content @p data to the log
    * file. The current implementation blocks until writing is done.
@@ -115,6 +123,27 @@ class DrakeLcmLog : public DrakeLcmInterface {
    */
   void DispatchMessageAndAdvanceLog(double current_time);
 
+  /**
+   * Moves the playback cursor to the first message whose time is greater than
+   * or equal to @p time_sec (or to the end of the log, if there is none), in
+   * O(log n) time for a log of n messages. The cursor may move backward or
+   * forward. Messages that are skipped over are not dispatched.
+   *
+   * @pre The times of the messages in the log are non-decreasing (as they
+   * are for logs written by this class or by lcm-logger).
+   * @throws std::exception if this instance is not constructed in read-only
+   * mode.
+   */
+  void Seek(double time_sec);
+
+  /**
+   * Returns the number of messages in the log.
+   *
+   * @throws std::exception if this instance is not constructed in read-only
+   * mode.
+   */
+  int num_messages() const;
+
   /**
    * Returns true if this instance is constructed in write-only mode.
    */
@@ -154,8 +183,13 @@ class DrakeLcmLog : public DrakeLcmInterface {
   std::multimap<std::string, DrakeLcmInterface::HandlerFunction> subscriptions_;
   std::vector<DrakeLcmInterface::MultichannelHandlerFunction>
     multichannel_subscriptions_;
+  // The log being written (in write mode).
   std::unique_ptr<::lcm::LogFile> log_;
-  const ::lcm::LogEvent* next_event_{nullptr};
+  // The indexed, memory-mapped log being read (in read mode), and the index of
+  // the next message to be dispatched.
+  class Reader;
+  std::unique_ptr<Reader> reader_;
+  int next_message_{0};
 };
 
 }  // namespace lcm
@@ -1,7 +1,9 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <cmath>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -66,6 +68,58 @@ GTEST_TEST(LcmLogTest, LcmLogTestSaveAndRead) {
   EXPECT_TRUE(multichannel_received);
 }
 
+// Plays back a log with several messages out of order using Seek.
+GTEST_TEST(LcmLogTest, LcmLogTestSeek) {
+  const std::vector<double> times{1.0, 2.0, 2.0, 3.5};
+  {
+    DrakeLcmLog w_log("seek.log", true);
+    EXPECT_THROW(w_log.Seek(0), std::exception);
+    EXPECT_THROW(w_log.num_messages(), std::exception);
+    for (int i = 0; i < static_cast<int>(times.size()); ++i) {
+      drake::lcmt_drake_signal msg{};
+      msg.timestamp = i;
+      Publish(&w_log, i % 2 ? "odd" : "even", msg, times[i]);
+    }
+  }
+
+  DrakeLcmLog r_log("seek.log", false);
+  EXPECT_EQ(r_log.num_messages(), 4);
+  std::vector<int64_t> received;
+  Subscribe<drake::lcmt_drake_signal>(
+      &r_log, "odd", [&received](const auto& message) {
+        received.push_back(message.timestamp);
+      });
+
+  // Dispatch everything in order.
+  for (double time = r_log.GetNextMessageTime(); !std::isinf(time);
+       time = r_log.GetNextMessageTime()) {
+    r_log.DispatchMessageAndAdvanceLog(time);
+  }
+  EXPECT_EQ(received, std::vector<int64_t>({1, 3}));
+
+  // Seek backward to a time between messages.
+  r_log.Seek(1.5);
+  EXPECT_EQ(r_log.GetNextMessageTime(), 2.0);
+  received.clear();
+  r_log.DispatchMessageAndAdvanceLog(2.0);
+  r_log.DispatchMessageAndAdvanceLog(2.0);
+  EXPECT_EQ(received, std::vector<int64_t>({1}));
+  EXPECT_EQ(r_log.GetNextMessageTime(), 3.5);
+
+  // Seek to an exact message time, before the start, and past the end.
+  r_log.Seek(3.5);
+  EXPECT_EQ(r_log.GetNextMessageTime(), 3.5);
+  r_log.Seek(-10);
+  EXPECT_EQ(r_log.GetNextMessageTime(), 1.0);
+  r_log.Seek(10);
+  EXPECT_TRUE(std::isinf(r_log.GetNextMessageTime()));
+}
+
+// Opening a log that does not exist is an error.
+GTEST_TEST(LcmLogTest, LcmLogTestMissingFile) {
+  EXPECT_THROW(DrakeLcmLog("no_such_file.log", false), std::exception);
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace drake
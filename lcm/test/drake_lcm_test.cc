@@ -3,6 +3,7 @@
 #include <chrono>
 #include <stdexcept>
 #include <thread>
+#include <vector>
 
 #include "lcm/lcm-cpp.hpp"
 #include <gtest/gtest.h>
@@ -314,6 +315,72 @@ TEST_F(DrakeLcmTest, QueueCapacityTest) {
   count = 0;
 }
 
+// Tests DrakeLcm's background receive thread, whose queues (unlike LCM's
+// native queues) also work with the memq URL.
+TEST_F(DrakeLcmTest, ReceiveThreadTest) {
+  for (const LcmQueueDropPolicy policy : {LcmQueueDropPolicy::kDropOldest,
+                                          LcmQueueDropPolicy::kDropNewest}) {
+    dut_ = std::make_unique<DrakeLcm>("memq://");
+    const std::string channel_name = "DrakeLcmTest.ReceiveThreadTest";
+    std::vector<int64_t> received;
+    auto subscription = Subscribe<lcmt_drake_signal>(
+        dut_.get(), channel_name, [&received](const auto& message) {
+          received.push_back(message.timestamp);
+        });
+    subscription->set_queue_capacity(2);
+    EXPECT_EQ(dut_->get_receive_statistics().num_received, 0);
+    dut_->StartReceiveThread(policy);
+    DRAKE_EXPECT_THROWS_MESSAGE(dut_->StartReceiveThread(),
+                                ".*already been called.*");
+
+    // Send five messages; the receive thread takes them in without any calls
+    // to HandleSubscriptions, but only two fit into the queue.
+    for (int i = 0; i < 5; ++i) {
+      message_.timestamp = i;
+      Publish(dut_.get(), channel_name, message_);
+    }
+    for (int retries = 0; retries < 1000; ++retries) {
+      if (dut_->get_receive_statistics().num_received == 5) break;
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    DrakeLcmReceiveStatistics statistics = dut_->get_receive_statistics();
+    EXPECT_EQ(statistics.num_received, 5);
+    EXPECT_EQ(statistics.num_dropped, 3);
+    EXPECT_EQ(statistics.num_queued, 2);
+    EXPECT_EQ(statistics.num_handled, 0);
+    EXPECT_TRUE(received.empty());
+
+    // The handler is called from here, with the messages the policy kept.
+    EXPECT_EQ(dut_->HandleSubscriptions(0), 2);
+    if (policy == LcmQueueDropPolicy::kDropOldest) {
+      EXPECT_EQ(received, std::vector<int64_t>({3, 4}));
+    } else {
+      EXPECT_EQ(received, std::vector<int64_t>({0, 1}));
+    }
+    statistics = dut_->get_receive_statistics();
+    EXPECT_EQ(statistics.num_queued, 0);
+    EXPECT_EQ(statistics.num_handled, 2);
+    EXPECT_EQ(dut_->HandleSubscriptions(10 /* millis */), 0);
+
+    // A blocked HandleSubscriptions wakes up as soon as a message arrives.
+    std::thread publisher([this, &channel_name]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      message_.timestamp = 22;
+      Publish(dut_.get(), channel_name, message_);
+    });
+    EXPECT_EQ(dut_->HandleSubscriptions(10000 /* millis */), 1);
+    publisher.join();
+    EXPECT_EQ(received.back(), 22);
+
+    // Unsubscribing discards any queued messages.
+    Publish(dut_.get(), channel_name, message_);
+    subscription->set_unsubscribe_on_delete(true);
+    subscription.reset();
+    EXPECT_EQ(dut_->HandleSubscriptions(10 /* millis */), 0);
+    EXPECT_EQ(dut_->get_receive_statistics().num_queued, 0);
+  }
+}
+
 // Tests that upstream LCM actually obeys the IP address in the URL.
 TEST_F(DrakeLcmTest, AddressFilterAcceptanceTest) {
   const std::string channel_name = "DrakeLcmTest.AddressFilterAcceptanceTest";
@@ -12,14 +12,16 @@ namespace drake {
 namespace manipulation {
 namespace planner {
 
-namespace internal {
-DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
-    const Eigen::Ref<const VectorX<double>>& q_current,
-    const Eigen::Ref<const VectorX<double>>& v_current,
+namespace {
+// Rotates V_WE_desired and the Jacobian J_WE_W to the end effector frame E,
+// scales them by the end effector gains, and stores the rows with a positive
+// gain at the top of V_scaled and J_scaled. Returns the number of such rows.
+int ScaleToEndEffectorFrame(
     const math::RigidTransform<double>& X_WE,
     const Eigen::Ref<const Matrix6X<double>>& J_WE_W,
     const multibody::SpatialVelocity<double>& V_WE_desired,
-    const DifferentialInverseKinematicsParameters& parameters) {
+    const Vector6<double>& gain_E, VectorX<double>* V_scaled,
+    MatrixX<double>* J_scaled) {
   const math::RotationMatrix<double> R_EW = X_WE.rotation().transpose();
   const multibody::SpatialVelocity<double> V_WE_E = R_EW * V_WE_desired;
 
@@ -27,21 +29,71 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
   // TODO(Mitiguy) Switch to direct application of RotationMatrix multiplied by
   // a `6 x n` array if that becomes available.
   const int num_columns = J_WE_W.cols();
-  Matrix6X<double> J_WE_E{6, num_columns};
-  J_WE_E.topRows<3>() = R_EW * J_WE_W.topRows<3>();
-  J_WE_E.bottomRows<3>() = R_EW * J_WE_W.bottomRows<3>();
-
-  Vector6<double> V_WE_E_scaled;
-  MatrixX<double> J_WE_E_scaled{6, num_columns};
+  V_scaled->resize(6);
+  J_scaled->resize(6, num_columns);
+  const Eigen::Matrix3d& R = R_EW.matrix();
   int num_cart_constraints = 0;
   for (int i = 0; i < 6; i++) {
-    const double gain{parameters.get_end_effector_velocity_gain()(i)};
+    const double gain{gain_E(i)};
     if (gain > 0) {
-      J_WE_E_scaled.row(num_cart_constraints) = gain * J_WE_E.row(i);
-      V_WE_E_scaled(num_cart_constraints) = gain * V_WE_E[i];
+      J_scaled->row(num_cart_constraints) =
+          gain * (i < 3 ? R.row(i) * J_WE_W.topRows<3>()
+                        : R.row(i - 3) * J_WE_W.bottomRows<3>());
+      (*V_scaled)(num_cart_constraints) = gain * V_WE_E[i];
       num_cart_constraints++;
     }
   }
+  return num_cart_constraints;
+}
+
+// Converts the result of the QP into a DifferentialInverseKinematicsResult,
+// detecting whether the end effector is stuck.
+DifferentialInverseKinematicsResult MakeDifferentialInverseKinematicsResult(
+    const solvers::MathematicalProgramResult& result,
+    const solvers::VectorXDecisionVariable& v_next,
+    const solvers::VectorDecisionVariable<1>& alpha,
+    const solvers::QuadraticCost* cart_cost) {
+  if (!result.is_success()) {
+    return {std::nullopt,
+            DifferentialInverseKinematicsStatus::kNoSolutionFound};
+  }
+
+  if (cart_cost != nullptr) {
+    VectorX<double> cost(1);
+    cart_cost->Eval(result.GetSolution(alpha), &cost);
+    const double kMaxTrackingError = 5;
+    const double kMinEndEffectorVel = 1e-2;
+    if (cost(0) > kMaxTrackingError &&
+        result.GetSolution(alpha)[0] <= kMinEndEffectorVel) {
+      // Not tracking the desired vel norm (large tracking error) and the
+      // computed vel is small.
+      log()->info("v_next = {}", result.GetSolution(v_next).transpose());
+      log()->info("alpha = {}", result.GetSolution(alpha).transpose());
+      return {std::nullopt, DifferentialInverseKinematicsStatus::kStuck};
+    }
+  }
+
+  return {result.GetSolution(v_next),
+          DifferentialInverseKinematicsStatus::kSolutionFound};
+}
+
+// TODO(russt): This should not be hard-coded.
+constexpr double kCartesianTrackingWeight = 100;
+}  // namespace
+
+namespace internal {
+DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
+    const Eigen::Ref<const VectorX<double>>& q_current,
+    const Eigen::Ref<const VectorX<double>>& v_current,
+    const math::RigidTransform<double>& X_WE,
+    const Eigen::Ref<const Matrix6X<double>>& J_WE_W,
+    const multibody::SpatialVelocity<double>& V_WE_desired,
+    const DifferentialInverseKinematicsParameters& parameters) {
+  VectorX<double> V_WE_E_scaled;
+  MatrixX<double> J_WE_E_scaled;
+  const int num_cart_constraints = ScaleToEndEffectorFrame(
+      X_WE, J_WE_W, V_WE_desired, parameters.get_end_effector_velocity_gain(),
+      &V_WE_E_scaled, &J_WE_E_scaled);
 
   return DoDifferentialInverseKinematics(
       q_current, v_current, V_WE_E_scaled.head(num_cart_constraints),
@@ -142,8 +194,6 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
     A.rightCols(1) = -V_dir;
     prog.AddLinearEqualityConstraint(
         A, VectorX<double>::Zero(num_cart_constraints), {v_next, alpha});
-    // TODO(russt): This should not be hard-coded.
-    const double kCartesianTrackingWeight = 100;
     cart_cost =
         prog.AddQuadraticErrorCost(Vector1<double>(kCartesianTrackingWeight),
                                    Vector1<double>(V_mag), alpha)
@@ -215,29 +265,8 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
   // Solve
   solvers::OsqpSolver solver;
   solvers::MathematicalProgramResult result = solver.Solve(prog, {}, {});
-
-  if (!result.is_success()) {
-    return {std::nullopt,
-            DifferentialInverseKinematicsStatus::kNoSolutionFound};
-  }
-
-  if (num_cart_constraints) {
-    VectorX<double> cost(1);
-    cart_cost->Eval(result.GetSolution(alpha), &cost);
-    const double kMaxTrackingError = 5;
-    const double kMinEndEffectorVel = 1e-2;
-    if (cost(0) > kMaxTrackingError &&
-        result.GetSolution(alpha)[0] <= kMinEndEffectorVel) {
-      // Not tracking the desired vel norm (large tracking error) and the
-      // computed vel is small.
-      log()->info("v_next = {}", result.GetSolution(v_next).transpose());
-      log()->info("alpha = {}", result.GetSolution(alpha).transpose());
-      return {std::nullopt, DifferentialInverseKinematicsStatus::kStuck};
-    }
-  }
-
-  return {result.GetSolution(v_next),
-          DifferentialInverseKinematicsStatus::kSolutionFound};
+  return MakeDifferentialInverseKinematicsResult(result, v_next, alpha,
+                                                 cart_cost);
 }
 
 DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
@@ -276,6 +305,174 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
                                          parameters);
 }
 
+DifferentialInverseKinematicsSolver::DifferentialInverseKinematicsSolver(
+    const DifferentialInverseKinematicsParameters& parameters,
+    const std::optional<solvers::SolverOptions>& solver_options)
+    : parameters_(parameters),
+      num_cart_constraints_(
+          (parameters.get_end_effector_velocity_gain().array() > 0).count()),
+      v_next_(prog_.NewContinuousVariables(parameters.get_num_velocities(),
+                                           "v_next")),
+      alpha_(prog_.NewContinuousVariables<1>("alpha")) {
+  // A bunch of the operations below assume num_positions == num_velocities.
+  // TODO(russt): Generalize this
+  DRAKE_THROW_UNLESS(parameters_.get_num_positions() ==
+                     parameters_.get_num_velocities());
+  const int num_velocities = parameters_.get_num_velocities();
+  const auto identity_num_velocities =
+      MatrixX<double>::Identity(num_velocities, num_velocities);
+
+  // The terms are added with placeholder coefficients, with the same sparsity
+  // as those set by Solve(), and the same structure as the program of
+  // DoDifferentialInverseKinematics().
+  if (num_cart_constraints_ > 0) {
+    A_direction_ =
+        MatrixX<double>::Ones(num_cart_constraints_, num_velocities + 1);
+    direction_constraint_ = prog_.AddLinearEqualityConstraint(
+        A_direction_, VectorX<double>::Zero(num_cart_constraints_),
+        {v_next_, alpha_});
+    cart_cost_ = prog_.AddQuadraticErrorCost(
+        Vector1<double>(kCartesianTrackingWeight), Vector1<double>(0), alpha_);
+    if (parameters_.get_unconstrained_degrees_of_freedom_velocity_limit() &&
+        num_cart_constraints_ < num_velocities) {
+      const double uncon_v =
+          parameters_.get_unconstrained_degrees_of_freedom_velocity_limit()
+              .value();
+      const int num_unconstrained = num_velocities - num_cart_constraints_;
+      unconstrained_dof_constraint_ = prog_.AddLinearConstraint(
+          MatrixX<double>::Ones(num_unconstrained, num_velocities),
+          VectorX<double>::Constant(num_unconstrained, -uncon_v),
+          VectorX<double>::Constant(num_unconstrained, uncon_v), v_next_);
+    }
+    svd_ = Eigen::JacobiSVD<MatrixX<double>>(
+        num_cart_constraints_, num_velocities, Eigen::ComputeFullV);
+  }
+
+  for (const auto& constraint :
+       parameters_.get_linear_velocity_constraints()) {
+    prog_.AddConstraint(
+        solvers::Binding<solvers::LinearConstraint>(constraint, v_next_));
+  }
+
+  if (num_cart_constraints_ < num_velocities) {
+    const double dt{parameters_.get_timestep()};
+    Q_nominal_ = 2 * dt * dt * identity_num_velocities;
+    nominal_cost_ = prog_.AddQuadraticCost(
+        Q_nominal_, VectorX<double>::Zero(num_velocities), v_next_);
+  }
+
+  if (parameters_.get_joint_position_limits()) {
+    position_limit_constraint_ = prog_.AddBoundingBoxConstraint(
+        parameters_.get_joint_position_limits()->first,
+        parameters_.get_joint_position_limits()->second, v_next_);
+  }
+
+  if (parameters_.get_joint_velocity_limits()) {
+    prog_.AddBoundingBoxConstraint(
+        parameters_.get_joint_velocity_limits()->first,
+        parameters_.get_joint_velocity_limits()->second, v_next_);
+  }
+
+  if (parameters_.get_joint_acceleration_limits()) {
+    acceleration_limit_constraint_ = prog_.AddLinearConstraint(
+        identity_num_velocities,
+        parameters_.get_joint_acceleration_limits()->first,
+        parameters_.get_joint_acceleration_limits()->second, v_next_);
+  }
+
+  session_ =
+      std::make_unique<solvers::OsqpSolverSession>(&prog_, solver_options);
+}
+
+DifferentialInverseKinematicsSolver::~DifferentialInverseKinematicsSolver() =
+    default;
+
+DifferentialInverseKinematicsResult DifferentialInverseKinematicsSolver::Solve(
+    const Eigen::Ref<const VectorX<double>>& q_current,
+    const Eigen::Ref<const VectorX<double>>& v_current,
+    const Eigen::Ref<const VectorX<double>>& V,
+    const Eigen::Ref<const MatrixX<double>>& J) {
+  const int num_velocities = parameters_.get_num_velocities();
+  DRAKE_THROW_UNLESS(q_current.size() == parameters_.get_num_positions());
+  DRAKE_THROW_UNLESS(v_current.size() == num_velocities);
+  DRAKE_THROW_UNLESS(V.size() == num_cart_constraints_);
+  DRAKE_THROW_UNLESS(J.rows() == num_cart_constraints_);
+  DRAKE_THROW_UNLESS(J.cols() == num_velocities);
+
+  if (num_cart_constraints_ > 0) {
+    A_direction_.leftCols(num_velocities) = J;
+    A_direction_.rightCols<1>() = -V.normalized();
+    direction_constraint_->evaluator()->UpdateCoefficients(
+        A_direction_, VectorX<double>::Zero(num_cart_constraints_));
+    // The cost kCartesianTrackingWeight * (alpha - |V|)², as in
+    // AddQuadraticErrorCost().
+    const double V_mag = V.norm();
+    cart_cost_->evaluator()->UpdateCoefficients(
+        Vector1<double>(2 * kCartesianTrackingWeight),
+        Vector1<double>(-2 * kCartesianTrackingWeight * V_mag),
+        kCartesianTrackingWeight * V_mag * V_mag);
+    if (unconstrained_dof_constraint_) {
+      svd_.compute(J, Eigen::ComputeFullV);
+      solvers::LinearConstraint* constraint =
+          unconstrained_dof_constraint_->evaluator().get();
+      constraint->UpdateCoefficients(
+          svd_.matrixV().rightCols(num_velocities - num_cart_constraints_)
+              .transpose(),
+          constraint->lower_bound(), constraint->upper_bound());
+    }
+  }
+
+  // The cost |q_current + v_next * dt - q_nominal|² scaled by 1/dt², as in
+  // DoDifferentialInverseKinematics().
+  const double dt{parameters_.get_timestep()};
+  if (nominal_cost_) {
+    nominal_cost_->evaluator()->UpdateCoefficients(
+        Q_nominal_,
+        -2 * dt * (parameters_.get_nominal_joint_position() - q_current),
+        (parameters_.get_nominal_joint_position() - q_current).squaredNorm(),
+        true /* is_hessian_psd */);
+  }
+
+  if (position_limit_constraint_) {
+    position_limit_constraint_->evaluator()->set_bounds(
+        (parameters_.get_joint_position_limits()->first - q_current) / dt,
+        (parameters_.get_joint_position_limits()->second - q_current) / dt);
+  }
+
+  if (acceleration_limit_constraint_) {
+    acceleration_limit_constraint_->evaluator()->set_bounds(
+        parameters_.get_joint_acceleration_limits()->first * dt + v_current,
+        parameters_.get_joint_acceleration_limits()->second * dt + v_current);
+  }
+
+  const solvers::MathematicalProgramResult result = session_->Solve();
+  return MakeDifferentialInverseKinematicsResult(
+      result, v_next_, alpha_,
+      cart_cost_ ? cart_cost_->evaluator().get() : nullptr);
+}
+
+DifferentialInverseKinematicsResult DifferentialInverseKinematicsSolver::Solve(
+    const multibody::MultibodyPlant<double>& robot,
+    const systems::Context<double>& context,
+    const Vector6<double>& V_WE_desired,
+    const multibody::Frame<double>& frame_E) {
+  const math::RigidTransform<double> X_WE =
+      robot.CalcRelativeTransform(context, robot.world_frame(), frame_E);
+  J_WE_W_.resize(6, robot.num_velocities());
+  const multibody::Frame<double>& frame_W = robot.world_frame();
+  robot.CalcJacobianSpatialVelocity(context,
+                                    multibody::JacobianWrtVariable::kV,
+                                    frame_E, Vector3<double>::Zero(),
+                                    frame_W, frame_W, &J_WE_W_);
+  const int num_cart_constraints = ScaleToEndEffectorFrame(
+      X_WE, J_WE_W_, multibody::SpatialVelocity<double>(V_WE_desired),
+      parameters_.get_end_effector_velocity_gain(), &V_scaled_, &J_scaled_);
+  DRAKE_DEMAND(num_cart_constraints == num_cart_constraints_);
+  return Solve(robot.GetPositions(context), robot.GetVelocities(context),
+               V_scaled_.head(num_cart_constraints),
+               J_scaled_.topRows(num_cart_constraints));
+}
+
 }  // namespace planner
 }  // namespace manipulation
 }  // namespace drake
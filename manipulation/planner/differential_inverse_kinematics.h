@@ -16,6 +16,7 @@
 #include "drake/multibody/math/spatial_algebra.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/osqp_solver.h"
 
 namespace drake {
 namespace manipulation {
@@ -342,6 +343,115 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
     const multibody::Frame<double>& frame_E,
     const DifferentialInverseKinematicsParameters& parameters);
 
+/**
+ * Solves the same program as
+ * DoDifferentialInverseKinematics(q_current, v_current, V, J, parameters)
+ * repeatedly, e.g. once per tick of a control loop, without rebuilding it.
+ *
+ * The MathematicalProgram is constructed once, from the parameters given at
+ * construction, and kept together with an OSQP workspace (see
+ * solvers::OsqpSolverSession). Each call to Solve() only updates the
+ * coefficients that depend on the current state and target (the Jacobian, the
+ * desired velocity, the unconstrained degrees of freedom, the nominal position
+ * cost and the joint position and acceleration bounds) and solves the QP
+ * warm-started from the previous solution. OSQP keeps its KKT factorization
+ * as long as the sparsity pattern of the constraint matrix does not change.
+ *
+ * To bound the time spent in each Solve(), limit the number of OSQP
+ * iterations through the solver options, e.g.
+ * `solver_options.SetOption(solvers::OsqpSolver::id(), "max_iter", 200)`.
+ * When the limit is reached before convergence, the status of the result is
+ * kNoSolutionFound.
+ *
+ * The number of rows of the Jacobian J and of the desired velocity V is fixed
+ * at construction to the number of positive end effector gains in the
+ * parameters. Later changes to a copy of the parameters have no effect; make a
+ * new solver instead.
+ *
+ * @ingroup planning
+ */
+class DifferentialInverseKinematicsSolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DifferentialInverseKinematicsSolver)
+
+  /**
+   * @param parameters Collection of various problem specific constraints and
+   * constants. It is copied.
+   * @param solver_options Options for OSQP, used for every solve.
+   * @throws std::exception if the number of positions and velocities in
+   * @p parameters differ.
+   */
+  explicit DifferentialInverseKinematicsSolver(
+      const DifferentialInverseKinematicsParameters& parameters,
+      const std::optional<solvers::SolverOptions>& solver_options =
+          std::nullopt);
+
+  ~DifferentialInverseKinematicsSolver();
+
+  /**
+   * Computes v_next as
+   * DoDifferentialInverseKinematics(q_current, v_current, V, J, parameters)
+   * does, up to the solver tolerance.
+   * @throws std::exception if V.size() or J.rows() differs from
+   * num_cart_constraints(), or the other sizes are inconsistent with the
+   * parameters.
+   */
+  DifferentialInverseKinematicsResult Solve(
+      const Eigen::Ref<const VectorX<double>>& q_current,
+      const Eigen::Ref<const VectorX<double>>& v_current,
+      const Eigen::Ref<const VectorX<double>>& V,
+      const Eigen::Ref<const MatrixX<double>>& J);
+
+  /**
+   * Computes v_next as
+   * DoDifferentialInverseKinematics(robot, context, V_WE_desired, frame_E,
+   * parameters) does, up to the solver tolerance.
+   */
+  DifferentialInverseKinematicsResult Solve(
+      const multibody::MultibodyPlant<double>& robot,
+      const systems::Context<double>& context,
+      const Vector6<double>& V_WE_desired,
+      const multibody::Frame<double>& frame_E);
+
+  /** The number of rows of V and J accepted by Solve(). */
+  int num_cart_constraints() const { return num_cart_constraints_; }
+
+  /** The program that is solved, for inspection. */
+  const solvers::MathematicalProgram& prog() const { return prog_; }
+
+  /** The number of times the OSQP workspace has been set up, see
+   * solvers::OsqpSolverSession::num_setups(). */
+  int num_setups() const { return session_->num_setups(); }
+
+ private:
+  const DifferentialInverseKinematicsParameters parameters_;
+  const int num_cart_constraints_;
+  solvers::MathematicalProgram prog_;
+  solvers::VectorXDecisionVariable v_next_;
+  solvers::VectorDecisionVariable<1> alpha_;
+  // The bindings whose coefficients change between solves. Each is only set
+  // if the corresponding term is present in the program.
+  std::optional<solvers::Binding<solvers::LinearEqualityConstraint>>
+      direction_constraint_;
+  std::optional<solvers::Binding<solvers::QuadraticCost>> cart_cost_;
+  std::optional<solvers::Binding<solvers::LinearConstraint>>
+      unconstrained_dof_constraint_;
+  std::optional<solvers::Binding<solvers::QuadraticCost>> nominal_cost_;
+  std::optional<solvers::Binding<solvers::BoundingBoxConstraint>>
+      position_limit_constraint_;
+  std::optional<solvers::Binding<solvers::LinearConstraint>>
+      acceleration_limit_constraint_;
+  std::unique_ptr<solvers::OsqpSolverSession> session_;
+  // The (constant) Hessian of nominal_cost_.
+  MatrixX<double> Q_nominal_;
+  // Preallocated workspaces.
+  Eigen::JacobiSVD<MatrixX<double>> svd_;
+  MatrixX<double> A_direction_;
+  MatrixX<double> J_WE_W_;
+  MatrixX<double> J_scaled_;
+  VectorX<double> V_scaled_;
+};
+
 #ifndef DRAKE_DOXYGEN_CXX
 namespace internal {
 DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
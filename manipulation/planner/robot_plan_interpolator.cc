@@ -88,7 +88,8 @@ RobotPlanInterpolator::RobotPlanInterpolator(
           .get_index();
 
   // This corresponds to the actual plan.
-  plan_index_ = this->DeclareAbstractState(Value<PlanData>());
+  plan_index_ = this->DeclareAbstractState(
+      Value<PlanDataPtr>(std::make_shared<const PlanData>()));
 
   // Flag indicating whether RobotPlanInterpolator::Initialize has been called.
   init_flag_index_ = this->DeclareAbstractState(Value<bool>(false));
@@ -101,15 +102,15 @@ RobotPlanInterpolator::~RobotPlanInterpolator() {}
 void RobotPlanInterpolator::SetDefaultState(
     const systems::Context<double>&,
     systems::State<double>* state) const {
-  PlanData& plan =
-      state->get_mutable_abstract_state<PlanData>(plan_index_);
-  plan = PlanData();
+  state->get_mutable_abstract_state<PlanDataPtr>(plan_index_) =
+      std::make_shared<const PlanData>();
   state->get_mutable_abstract_state<bool>(init_flag_index_) = false;
 }
 
 void RobotPlanInterpolator::OutputState(const systems::Context<double>& context,
                                   systems::BasicVector<double>* output) const {
-  const PlanData& plan = context.get_abstract_state<PlanData>(plan_index_);
+  const PlanData& plan =
+      *context.get_abstract_state<PlanDataPtr>(plan_index_);
   const bool inited = context.get_abstract_state<bool>(init_flag_index_);
   DRAKE_DEMAND(inited);
 
@@ -126,7 +127,8 @@ void RobotPlanInterpolator::OutputState(const systems::Context<double>& context,
 void RobotPlanInterpolator::OutputAccel(
     const systems::Context<double>& context,
     systems::BasicVector<double>* output) const {
-  const PlanData& plan = context.get_abstract_state<PlanData>(plan_index_);
+  const PlanData& plan =
+      *context.get_abstract_state<PlanDataPtr>(plan_index_);
   const bool inited = context.get_abstract_state<bool>(init_flag_index_);
   DRAKE_DEMAND(inited);
 
@@ -142,28 +144,29 @@ void RobotPlanInterpolator::OutputAccel(
   }
 }
 
-void RobotPlanInterpolator::MakeFixedPlan(
+RobotPlanInterpolator::PlanDataPtr RobotPlanInterpolator::MakeFixedPlan(
     double plan_start_time, const VectorX<double>& q0,
-    systems::State<double>* state) const {
-  DRAKE_DEMAND(state != nullptr);
+    std::vector<char> encoded_msg) const {
   DRAKE_DEMAND(q0.size() == plant_.num_positions());
-  PlanData& plan =
-      state->get_mutable_abstract_state<PlanData>(plan_index_);
+  auto plan = std::make_shared<PlanData>();
+  plan->encoded_msg = std::move(encoded_msg);
 
   std::vector<Eigen::MatrixXd> knots(2, q0);
   std::vector<double> times{0., 1.};
-  plan.start_time = plan_start_time;
-  plan.pp = PiecewisePolynomial<double>::ZeroOrderHold(times, knots);
-  plan.pp_deriv = plan.pp.derivative();
-  plan.pp_double_deriv = plan.pp_deriv.derivative();
+  plan->start_time = plan_start_time;
+  plan->pp = PiecewisePolynomial<double>::ZeroOrderHold(times, knots);
+  plan->pp_deriv = plan->pp.derivative();
+  plan->pp_double_deriv = plan->pp_deriv.derivative();
   drake::log()->info("Generated fixed plan at {}", q0.transpose());
+  return plan;
 }
 
 void RobotPlanInterpolator::Initialize(double plan_start_time,
                                        const VectorX<double>& q0,
                                        systems::State<double>* state) const {
   DRAKE_DEMAND(state != nullptr);
-  MakeFixedPlan(plan_start_time, q0, state);
+  state->get_mutable_abstract_state<PlanDataPtr>(plan_index_) =
+      MakeFixedPlan(plan_start_time, q0);
   state->get_mutable_abstract_state<bool>(init_flag_index_) = true;
 }
 
@@ -171,8 +174,9 @@ void RobotPlanInterpolator::DoCalcUnrestrictedUpdate(
     const systems::Context<double>& context,
     const std::vector<const systems::UnrestrictedUpdateEvent<double>*>&,
     systems::State<double>* state) const {
-  PlanData& plan =
-      state->get_mutable_abstract_state<PlanData>(plan_index_);
+  PlanDataPtr& plan_ptr =
+      state->get_mutable_abstract_state<PlanDataPtr>(plan_index_);
+  const PlanData& plan = *plan_ptr;
   const lcmt_robot_plan& plan_input =
       get_plan_input_port().Eval<lcmt_robot_plan>(context);
 
@@ -182,17 +186,25 @@ void RobotPlanInterpolator::DoCalcUnrestrictedUpdate(
   std::vector<char> encoded_msg(plan_input.getEncodedSize());
   plan_input.encode(encoded_msg.data(), 0, encoded_msg.size());
   if (encoded_msg != plan.encoded_msg) {
-    plan.encoded_msg.swap(encoded_msg);
+    // The current plan may be shared with other copies of the state, so we
+    // replace it rather than modifying it.
     if (plan_input.num_states == 0) {
       // The plan is empty.  Encode a plan for the current planned position.
       const double current_plan_time = context.get_time() - plan.start_time;
-      MakeFixedPlan(context.get_time(),
-                    plan.pp.value(current_plan_time),
-                    state);
-    } else if (plan_input.num_states == 1) {
+      plan_ptr = MakeFixedPlan(context.get_time(),
+                               plan.pp.value(current_plan_time),
+                               std::move(encoded_msg));
+      return;
+    }
+    // A plan with one knot point is ignored, so only the message changes.
+    auto new_plan = (plan_input.num_states == 1)
+                        ? std::make_shared<PlanData>(plan)
+                        : std::make_shared<PlanData>();
+    new_plan->encoded_msg.swap(encoded_msg);
+    if (plan_input.num_states == 1) {
       drake::log()->info("Ignoring plan with only one knot point.");
     } else {
-      plan.start_time = context.get_time();
+      new_plan->start_time = context.get_time();
       std::vector<Eigen::MatrixXd> knots(
           plan_input.num_states,
           Eigen::MatrixXd::Zero(plant_.num_positions(), 1));
@@ -217,26 +229,27 @@ void RobotPlanInterpolator::DoCalcUnrestrictedUpdate(
           Eigen::MatrixXd::Zero(plant_.num_velocities(), 1);
       switch (interp_type_) {
         case InterpolatorType::ZeroOrderHold :
-          plan.pp = PiecewisePolynomial<double>::ZeroOrderHold(
+          new_plan->pp = PiecewisePolynomial<double>::ZeroOrderHold(
               input_time, knots);
           break;
         case InterpolatorType::FirstOrderHold :
-          plan.pp = PiecewisePolynomial<double>::FirstOrderHold(
+          new_plan->pp = PiecewisePolynomial<double>::FirstOrderHold(
               input_time, knots);
           break;
         case InterpolatorType::Pchip :
-          plan.pp = PiecewisePolynomial<double>::CubicShapePreserving(
+          new_plan->pp = PiecewisePolynomial<double>::CubicShapePreserving(
               input_time, knots, true);
           break;
         case InterpolatorType::Cubic :
-          plan.pp =
+          new_plan->pp =
               PiecewisePolynomial<double>::CubicWithContinuousSecondDerivatives(
                   input_time, knots, knot_dot, knot_dot);
           break;
       }
-      plan.pp_deriv = plan.pp.derivative();
-      plan.pp_double_deriv = plan.pp_deriv.derivative();
+      new_plan->pp_deriv = new_plan->pp.derivative();
+      new_plan->pp_double_deriv = new_plan->pp_deriv.derivative();
     }
+    plan_ptr = std::move(new_plan);
   }
 }
 
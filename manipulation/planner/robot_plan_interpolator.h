@@ -85,6 +85,9 @@ class RobotPlanInterpolator : public systems::LeafSystem<double> {
 
  private:
   struct PlanData;
+  // Plans are immutable once made, so the abstract state shares them; the
+  // copies of the state made on every update only copy the pointer.
+  using PlanDataPtr = std::shared_ptr<const PlanData>;
 
   // Calculator method for the state output port.
   void OutputState(const systems::Context<double>& context,
@@ -94,8 +97,10 @@ class RobotPlanInterpolator : public systems::LeafSystem<double> {
   void OutputAccel(const systems::Context<double>& context,
                    systems::BasicVector<double>* output) const;
 
-  void MakeFixedPlan(double plan_start_time, const VectorX<double>& q0,
-                     systems::State<double>* state) const;
+  // Returns a plan to hold at `q0` starting at `plan_start_time`, for the
+  // plan message encoded as `encoded_msg`.
+  PlanDataPtr MakeFixedPlan(double plan_start_time, const VectorX<double>& q0,
+                            std::vector<char> encoded_msg = {}) const;
 
   static constexpr double kDefaultPlanUpdateInterval = 0.1;
   const int plan_input_port_{};
@@ -10,6 +10,7 @@
 #include "drake/common/eigen_types.h"
 #include "drake/common/find_resource.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/manipulation/kuka_iiwa/iiwa_constants.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/multibody/parsing/parser.h"
@@ -242,6 +243,57 @@ TEST_F(DifferentialInverseKinematicsTest, SimpleTracker) {
                               1e-5, MatrixCompareType::absolute));
 }
 
+// Track a fixed end effector pose with DifferentialInverseKinematicsSolver,
+// which keeps its program and OSQP workspace across ticks.
+TEST_F(DifferentialInverseKinematicsTest, SolverTracker) {
+  params_->set_joint_acceleration_limits(
+      {VectorXd::Constant(7, -1e3), VectorXd::Constant(7, 1e3)});
+  DifferentialInverseKinematicsSolver solver(*params_);
+  EXPECT_EQ(solver.num_cart_constraints(), 6);
+  const auto num_costs = solver.prog().GetAllCosts().size();
+  const auto num_constraints = solver.prog().GetAllConstraints().size();
+
+  math::RigidTransform<double> X_WE = frame_E_->CalcPoseInWorld(*context_);
+  const math::RigidTransform<double> X_WE_desired =
+      math::RigidTransform<double>(Vector3d(-0.02, -0.01, -0.03)) * X_WE;
+  const double dt = params_->get_timestep();
+  for (int iteration = 0; iteration < 900; ++iteration) {
+    X_WE = frame_E_->CalcPoseInWorld(*context_);
+    const Vector6<double> V_WE_desired =
+        ComputePoseDiffInCommonFrame(X_WE, X_WE_desired) / dt;
+    const DifferentialInverseKinematicsResult result =
+        solver.Solve(*plant_, *context_, V_WE_desired, *frame_E_);
+    ASSERT_EQ(result.status,
+              DifferentialInverseKinematicsStatus::kSolutionFound);
+    if (iteration == 0) {
+      // The same velocity as the one-shot function, up to OSQP's tolerance.
+      const DifferentialInverseKinematicsResult expected =
+          DoDiffIKForSpatialVelocity(
+              multibody::SpatialVelocity<double>(V_WE_desired));
+      EXPECT_TRUE(CompareMatrices(result.joint_velocities.value(),
+                                  expected.joint_velocities.value(), 1e-2,
+                                  MatrixCompareType::absolute));
+    }
+
+    const VectorXd q = plant_->GetPositions(*context_);
+    const VectorXd v = result.joint_velocities.value();
+    plant_->SetPositions(context_, q + v * dt);
+    plant_->SetVelocities(context_, v);
+  }
+  X_WE = frame_E_->CalcPoseInWorld(*context_);
+  EXPECT_TRUE(CompareMatrices(X_WE.GetAsMatrix4(), X_WE_desired.GetAsMatrix4(),
+                              1e-5, MatrixCompareType::absolute));
+  // The structure of the program never changes.
+  EXPECT_EQ(solver.prog().GetAllCosts().size(), num_costs);
+  EXPECT_EQ(solver.prog().GetAllConstraints().size(), num_constraints);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      solver.Solve(plant_->GetPositions(*context_),
+                   plant_->GetVelocities(*context_), VectorXd::Zero(3),
+                   MatrixX<double>::Zero(3, 7)),
+      ".*V.size\\(\\) == num_cart_constraints_.*");
+}
+
 // Test various throw conditions.
 GTEST_TEST(DifferentialInverseKinematicsParametersTest, TestSetter) {
   DifferentialInverseKinematicsParameters dut(1, 1);
@@ -75,16 +75,52 @@ void BarycentricMesh<T>::EvalBarycentricWeights(
   DRAKE_DEMAND(input.size() == static_cast<int>(input_grid_.size()));
   DRAKE_DEMAND(mesh_indices != nullptr && weights != nullptr);
 
-  // std::pair of fractional position [0,1] and dimension index (position first,
-  // so that std::pair's default operator< works for us).
   // There is one relative position for every non-singleton input dimension.  In
   // the case of triangular meshes, there is one interpolant for every
   // non-singular dimension + one additional, so num_interpolants-1 is the size
   // we need.
   std::vector<std::pair<T, int>> relative_position(num_interpolants_ - 1);
-  // Bounding box on the input grid containing the sample input.
   std::vector<bool> has_volume(get_input_size());
 
+  mesh_indices->resize(num_interpolants_);
+  weights->resize(num_interpolants_);
+  DoEvalBarycentricWeights(input, &relative_position, &has_volume,
+                           mesh_indices->data(), weights->data());
+}
+
+template <typename T>
+void BarycentricMesh<T>::EvalBarycentricWeightsBatch(
+    const Eigen::Ref<const MatrixX<T>>& inputs,
+    EigenPtr<Eigen::MatrixXi> mesh_indices,
+    EigenPtr<MatrixX<T>> weights) const {
+  DRAKE_DEMAND(inputs.rows() == get_input_size());
+  DRAKE_DEMAND(mesh_indices != nullptr && weights != nullptr);
+  DRAKE_DEMAND(mesh_indices->rows() == num_interpolants_ &&
+               mesh_indices->cols() == inputs.cols());
+  DRAKE_DEMAND(weights->rows() == num_interpolants_ &&
+               weights->cols() == inputs.cols());
+
+  std::vector<std::pair<T, int>> relative_position(num_interpolants_ - 1);
+  std::vector<bool> has_volume(get_input_size());
+  // The columns of a block of a column-major matrix are contiguous.
+  for (int j = 0; j < inputs.cols(); j++) {
+    DoEvalBarycentricWeights(inputs.col(j), &relative_position, &has_volume,
+                             &mesh_indices->coeffRef(0, j),
+                             &weights->coeffRef(0, j));
+  }
+}
+
+template <typename T>
+void BarycentricMesh<T>::DoEvalBarycentricWeights(
+    const Eigen::Ref<const VectorX<T>>& input,
+    std::vector<std::pair<T, int>>* relative_position_ptr,
+    std::vector<bool>* has_volume_ptr, int* mesh_indices, T* weights) const {
+  // std::pair of fractional position [0,1] and dimension index (position first,
+  // so that std::pair's default operator< works for us).
+  std::vector<std::pair<T, int>>& relative_position = *relative_position_ptr;
+  // Bounding box on the input grid containing the sample input.
+  std::vector<bool>& has_volume = *has_volume_ptr;
+
   int current_index = 0;
 
   // Loop through input dimensions and compute the relative positions and
@@ -137,22 +173,19 @@ void BarycentricMesh<T>::EvalBarycentricWeights(
   // position.
   std::sort(relative_position.begin(), relative_position.end());
 
-  mesh_indices->resize(num_interpolants_);
-  weights->resize(num_interpolants_);
-  (*mesh_indices)[0] = current_index;
-  (*weights)[0] = relative_position[0].first;
+  mesh_indices[0] = current_index;
+  weights[0] = relative_position[0].first;
 
   for (int i = 1; i < num_interpolants_; i++) {
     int dim = relative_position[i - 1].second;
     if (has_volume[dim]) {
       current_index -= stride_[dim];
     }
-    (*mesh_indices)[i] = current_index;
+    mesh_indices[i] = current_index;
     if (i == (num_interpolants_ - 1)) {
-      (*weights)[i] = 1.0 - relative_position[i - 1].first;
+      weights[i] = 1.0 - relative_position[i - 1].first;
     } else {
-      (*weights)[i] =
-          relative_position[i].first - relative_position[i - 1].first;
+      weights[i] = relative_position[i].first - relative_position[i - 1].first;
     }
   }
 }
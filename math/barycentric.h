@@ -3,6 +3,7 @@
 #include <iterator>
 #include <memory>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -96,6 +97,20 @@ class BarycentricMesh {
                               EigenPtr<Eigen::VectorXi> mesh_indices,
                               EigenPtr<VectorX<T>> weights) const;
 
+  /// Performs EvalBarycentricWeights for a batch of inputs, one per column of
+  /// @p inputs: column j of @p mesh_indices and @p weights receives the result
+  /// for column j of @p inputs.  The scratch memory is allocated once for the
+  /// whole batch, rather than once per input.
+  ///
+  /// @param inputs must have get_input_size() rows.
+  /// @param mesh_indices must be get_num_interpolants() by inputs.cols(); it
+  /// may be a block of a larger matrix.
+  /// @param weights must be get_num_interpolants() by inputs.cols(); it may be
+  /// a block of a larger matrix.
+  void EvalBarycentricWeightsBatch(const Eigen::Ref<const MatrixX<T>>& inputs,
+                                   EigenPtr<Eigen::MatrixXi> mesh_indices,
+                                   EigenPtr<MatrixX<T>> weights) const;
+
   /// Evaluates the function at the @p input values, by interpolating between
   /// the values at @p mesh_values.  Inputs that are outside the
   /// bounding box of the input_grid are interpolated as though they were
@@ -168,6 +183,14 @@ class BarycentricMesh {
           vector_func) const;
 
  private:
+  // Implements EvalBarycentricWeights, using the caller's scratch memory for
+  // the relative positions and the bounding box.  The results are written to
+  // the get_num_interpolants() elements of @p mesh_indices and @p weights.
+  void DoEvalBarycentricWeights(
+      const Eigen::Ref<const VectorX<T>>& input,
+      std::vector<std::pair<T, int>>* relative_position,
+      std::vector<bool>* has_volume, int* mesh_indices, T* weights) const;
+
   MeshGrid input_grid_;      // Specifies the location of the mesh points in
                              // the input space.
   std::vector<int> stride_;  // The number of elements to skip to arrive at the
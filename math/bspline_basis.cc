@@ -105,6 +105,74 @@ T BsplineBasis<T>::EvaluateBasisFunctionI(int index,
   return EvaluateCurve(delta, parameter_value);
 }
 
+template <typename T>
+int BsplineBasis<T>::EvaluateActiveBasisFunctions(const T& parameter_value,
+                                                  VectorX<T>* values,
+                                                  int interval_hint) const {
+  DRAKE_DEMAND(values != nullptr);
+  DRAKE_ASSERT(parameter_value >= initial_parameter_value());
+  DRAKE_ASSERT(parameter_value <= final_parameter_value());
+  const std::vector<T>& t = knots();
+  const T& t_bar = parameter_value;
+  const int k = order();
+
+  /* The containing interval is the greatest ell such that t[ell] ≤ t_bar and
+  t[ell] < final_parameter_value(); try the hinted interval and its successor
+  before searching. */
+  const auto contains = [&](int ell) {
+    return ell >= k - 1 && ell < num_basis_functions() &&
+           static_cast<bool>(t[ell] <= t_bar) &&
+           static_cast<bool>(t[ell] < final_parameter_value()) &&
+           static_cast<bool>(t_bar < t[ell + 1] ||
+                             t[ell + 1] >= final_parameter_value());
+  };
+  int ell = interval_hint + k - 1;
+  if (interval_hint < 0 || !contains(ell)) {
+    ell = (interval_hint >= 0 && contains(ell + 1))
+              ? ell + 1
+              : FindContainingInterval(t_bar);
+  }
+
+  /* This is the triangular scheme of the Cox-de Boor recursion (algorithm A2.2
+  of Piegl and Tiller, "The NURBS Book"). After step j, N(r) holds the value of
+  the degree-j basis function with index ell - j + r. The denominators span
+  the containing interval, so they are non-zero. */
+  VectorX<T>& N = *values;
+  N.resize(k);
+  N(0) = 1.0;
+  for (int j = 1; j < k; ++j) {
+    T saved = 0.0;
+    for (int r = 0; r < j; ++r) {
+      const T right = t[ell + r + 1] - t_bar;
+      const T left = t_bar - t[ell + r + 1 - j];
+      const T temp = N(r) / (right + left);
+      N(r) = saved + right * temp;
+      saved = left * temp;
+    }
+    N(j) = saved;
+  }
+  return ell - k + 1;
+}
+
+template <typename T>
+Eigen::SparseMatrix<T> BsplineBasis<T>::ComputeBasisMatrix(
+    const std::vector<T>& parameter_values) const {
+  const int num_values = static_cast<int>(parameter_values.size());
+  std::vector<Eigen::Triplet<T>> triplets;
+  triplets.reserve(num_values * order());
+  VectorX<T> values(order());
+  int first = -1;
+  for (int i = 0; i < num_values; ++i) {
+    first = EvaluateActiveBasisFunctions(parameter_values[i], &values, first);
+    for (int j = 0; j < order(); ++j) {
+      triplets.emplace_back(i, first + j, values(j));
+    }
+  }
+  Eigen::SparseMatrix<T> basis_matrix(num_values, num_basis_functions());
+  basis_matrix.setFromTriplets(triplets.begin(), triplets.end());
+  return basis_matrix;
+}
+
 template <typename T>
 int BsplineBasis<T>::FindContainingInterval(const T& parameter_value) const {
   DRAKE_ASSERT(parameter_value >= initial_parameter_value());
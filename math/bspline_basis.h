@@ -3,10 +3,13 @@
 #include <array>
 #include <vector>
 
+#include <Eigen/SparseCore>
+
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_bool.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_throw.h"
+#include "drake/common/eigen_types.h"
 #include "drake/common/name_value.h"
 #include "drake/math/knot_vector_type.h"
 
@@ -183,6 +186,34 @@ class BsplineBasis final {
   `parameter_value`. */
   T EvaluateBasisFunctionI(int i, const T& parameter_value) const;
 
+  /** Evaluates all of the basis functions which may be non-zero at
+  `parameter_value` (see ComputeActiveBasisFunctionIndices()) at once, in
+  O(order()²) operations; calling EvaluateBasisFunctionI() for each of them
+  costs O(order()³). On return, `(*values)(j)` is the value of the basis
+  function with index `first + j` for j in [0, order()), where `first` is the
+  returned index.
+  @param interval_hint A previously returned index, e.g., the one for the
+  preceding parameter value when evaluating a sorted sequence of them. If the
+  parameter value lies in the same or the next knot interval, the search for
+  its containing interval is skipped. Pass -1 (the default) for no hint.
+  @pre values != nullptr
+  @pre parameter_value ≥ initial_parameter_value()
+  @pre parameter_value ≤ final_parameter_value() */
+  int EvaluateActiveBasisFunctions(const T& parameter_value, VectorX<T>* values,
+                                   int interval_hint = -1) const;
+
+  /** Returns the sparse matrix B whose (i, j) entry is the value of the jth
+  basis function at `parameter_values[i]`, so that the ith row of B P is the
+  value at `parameter_values[i]` of the B-spline curve whose control points
+  are the rows of P. Each row of B has order() stored entries. The matrix
+  depends only on the basis and the parameter values, so it can be computed
+  once and reused for any number of curves. Sorted parameter values are
+  evaluated fastest (see EvaluateActiveBasisFunctions()).
+  @pre Each parameter value lies in
+       [initial_parameter_value(), final_parameter_value()]. */
+  Eigen::SparseMatrix<T> ComputeBasisMatrix(
+      const std::vector<T>& parameter_values) const;
+
   boolean<T> operator==(const BsplineBasis& other) const;
 
   boolean<T> operator!=(const BsplineBasis& other) const;
@@ -137,6 +137,10 @@ double* GetMutableRawMatrixStart(RigidTransform<double>* X) {
   return reinterpret_cast<double*>(X);
 }
 
+/* Each RigidTransform<double> in an array is 12 consecutive doubles, so
+element i of an array starts 12*i doubles after its first element. */
+constexpr int kRigidTransformSize = 12;
+
 }  // namespace
 
 /* Composition of rotation matrices R_AC = R_AB * R_BC. Each matrix is 9
@@ -186,6 +190,40 @@ void ComposeXinvXPortable(const RigidTransform<double>& X_BA,
   std::copy(X_AC_temp, X_AC_temp + 12, GetMutableRawMatrixStart(X_AC));
 }
 
+/* Batched compositions of transforms. The outputs may be the same arrays as
+the inputs, so each element is composed into a temporary first. */
+void ComposeXXBatchPortable(const RigidTransform<double>* X_AB,
+                            const RigidTransform<double>* X_BC, int count,
+                            RigidTransform<double>* X_AC) {
+  assert(count == 0 || (X_AB != nullptr && X_BC != nullptr &&
+                        X_AC != nullptr));
+  const double* a = reinterpret_cast<const double*>(X_AB);
+  const double* b = reinterpret_cast<const double*>(X_BC);
+  double* c = reinterpret_cast<double*>(X_AC);
+  double X_AC_temp[12];
+  for (int i = 0; i < count; ++i) {
+    const int offset = kRigidTransformSize * i;
+    ComposeXXNoAlias(a + offset, b + offset, X_AC_temp);
+    std::copy(X_AC_temp, X_AC_temp + 12, c + offset);
+  }
+}
+
+void ComposeXinvXBatchPortable(const RigidTransform<double>* X_BA,
+                               const RigidTransform<double>* X_BC, int count,
+                               RigidTransform<double>* X_AC) {
+  assert(count == 0 || (X_BA != nullptr && X_BC != nullptr &&
+                        X_AC != nullptr));
+  const double* a = reinterpret_cast<const double*>(X_BA);
+  const double* b = reinterpret_cast<const double*>(X_BC);
+  double* c = reinterpret_cast<double*>(X_AC);
+  double X_AC_temp[12];
+  for (int i = 0; i < count; ++i) {
+    const int offset = kRigidTransformSize * i;
+    ComposeXinvXNoAlias(a + offset, b + offset, X_AC_temp);
+    std::copy(X_AC_temp, X_AC_temp + 12, c + offset);
+  }
+}
+
 #if defined(__AVX2__) && defined(__FMA__)
 
 namespace {
@@ -555,6 +593,36 @@ void ComposeXinvX(const RigidTransform<double>& X_BA,
                   GetMutableRawMatrixStart(X_AC));
 }
 
+/* The AVX kernels tolerate overlap of their output with their inputs, and
+compiling them into a single loop lets the compiler interleave consecutive
+compositions. */
+void ComposeXXBatch(const RigidTransform<double>* X_AB,
+                    const RigidTransform<double>* X_BC, int count,
+                    RigidTransform<double>* X_AC) {
+  assert(count == 0 || (X_AB != nullptr && X_BC != nullptr &&
+                        X_AC != nullptr));
+  const double* a = reinterpret_cast<const double*>(X_AB);
+  const double* b = reinterpret_cast<const double*>(X_BC);
+  double* c = reinterpret_cast<double*>(X_AC);
+  for (int i = 0; i < count; ++i) {
+    const int offset = kRigidTransformSize * i;
+    ComposeXXAvx(a + offset, b + offset, c + offset);
+  }
+}
+void ComposeXinvXBatch(const RigidTransform<double>* X_BA,
+                       const RigidTransform<double>* X_BC, int count,
+                       RigidTransform<double>* X_AC) {
+  assert(count == 0 || (X_BA != nullptr && X_BC != nullptr &&
+                        X_AC != nullptr));
+  const double* a = reinterpret_cast<const double*>(X_BA);
+  const double* b = reinterpret_cast<const double*>(X_BC);
+  double* c = reinterpret_cast<double*>(X_AC);
+  for (int i = 0; i < count; ++i) {
+    const int offset = kRigidTransformSize * i;
+    ComposeXinvXAvx(a + offset, b + offset, c + offset);
+  }
+}
+
 #else
 /* Use portable functions. */
 bool IsUsingPortableCompositionFunctions() { return true; }
@@ -580,6 +648,17 @@ void ComposeXinvX(const RigidTransform<double>& X_BA,
                   RigidTransform<double>* X_AC) {
   internal::ComposeXinvXPortable(X_BA, X_BC, X_AC);
 }
+
+void ComposeXXBatch(const RigidTransform<double>* X_AB,
+                    const RigidTransform<double>* X_BC, int count,
+                    RigidTransform<double>* X_AC) {
+  internal::ComposeXXBatchPortable(X_AB, X_BC, count, X_AC);
+}
+void ComposeXinvXBatch(const RigidTransform<double>* X_BA,
+                       const RigidTransform<double>* X_BC, int count,
+                       RigidTransform<double>* X_AC) {
+  internal::ComposeXinvXBatchPortable(X_BA, X_BC, count, X_AC);
+}
 #endif
 
 }  // namespace internal
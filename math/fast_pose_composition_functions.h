@@ -78,6 +78,27 @@ void ComposeXinvX(const RigidTransform<double>& X_BA,
                   const RigidTransform<double>& X_BC,
                   RigidTransform<double>* X_AC);
 
+/* Composes `count` pairs of drake::math::RigidTransform<double> objects stored
+in contiguous arrays, as if by calling ComposeXX() on each pair, but without
+the per-call overhead.
+
+Here we calculate `X_AC[i] = X_AB[i] * X_BC[i]` for `0 <= i < count`. It is OK
+for X_AC to be the same array as one or both inputs; otherwise it must not
+overlap with them. */
+void ComposeXXBatch(const RigidTransform<double>* X_AB,
+                    const RigidTransform<double>* X_BC, int count,
+                    RigidTransform<double>* X_AC);
+
+/* Composes the inverses of `count` drake::math::RigidTransform<double>
+objects with as many (non-inverted) others, stored in contiguous arrays, as if
+by calling ComposeXinvX() on each pair.
+
+Here we calculate `X_AC[i] = X_BA[i]⁻¹ * X_BC[i]` for `0 <= i < count`. The
+same aliasing rules as for ComposeXXBatch() apply. */
+void ComposeXinvXBatch(const RigidTransform<double>* X_BA,
+                       const RigidTransform<double>* X_BC, int count,
+                       RigidTransform<double>* X_AC);
+
 /* Returns `true` if we are using the portable fallback implementations for
 the above functions. */
 bool IsUsingPortableCompositionFunctions();
@@ -100,6 +121,13 @@ void ComposeXinvXPortable(const RigidTransform<double>& X_BA,
                           const RigidTransform<double>& X_BC,
                           RigidTransform<double>* X_AC);
 
+void ComposeXXBatchPortable(const RigidTransform<double>* X_AB,
+                            const RigidTransform<double>* X_BC, int count,
+                            RigidTransform<double>* X_AC);
+void ComposeXinvXBatchPortable(const RigidTransform<double>* X_BA,
+                               const RigidTransform<double>* X_BC, int count,
+                               RigidTransform<double>* X_AC);
+
 }  // namespace internal
 }  // namespace math
 }  // namespace drake
@@ -0,0 +1,302 @@
+#include "drake/math/low_rank_matrix_equations.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Eigenvalues>
+#include <Eigen/SparseLU>
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace math {
+namespace {
+
+using Complex = std::complex<double>;
+
+// The operator F = Aᵀ - UVᵀ of a Lyapunov equation FX + XFᵀ + GGᵀ = 0, where
+// Aᵀ is sparse and U and V are n-by-m, with m ≪ n.
+class LyapunovOperator {
+ public:
+  LyapunovOperator(const Eigen::SparseMatrix<double>& At,
+                   const Eigen::MatrixXd& U, const Eigen::MatrixXd& V)
+      : At_(At), U_(U), V_(V) {}
+
+  int size() const { return At_.rows(); }
+
+  Eigen::MatrixXd Multiply(const Eigen::MatrixXd& X) const {
+    return At_ * X - U_ * (V_.transpose() * X);
+  }
+
+  // Returns (F + pI)⁻¹W.  Only Aᵀ + pI is factorized; the low-rank term is
+  // handled with the Sherman-Morrison-Woodbury formula.
+  template <typename Scalar>
+  MatrixX<Scalar> SolveShifted(const Scalar& p,
+                               const Eigen::MatrixXd& W) const {
+    using SparseMatrix = Eigen::SparseMatrix<Scalar>;
+    SparseMatrix identity(size(), size());
+    identity.setIdentity();
+    const SparseMatrix M = At_.template cast<Scalar>() + p * identity;
+    Eigen::SparseLU<SparseMatrix> lu(M);
+    if (lu.info() != Eigen::Success) {
+      throw std::runtime_error(fmt::format(
+          "Low-rank ADI: the factorization of Aᵀ + pI failed for the shift "
+          "p = {}{:+}i.",
+          std::real(p), std::imag(p)));
+    }
+    const int m = U_.cols();
+    MatrixX<Scalar> rhs(size(), W.cols() + m);
+    rhs << W.template cast<Scalar>(), U_.template cast<Scalar>();
+    const MatrixX<Scalar> solution = lu.solve(rhs);
+    if (m == 0) {
+      return solution;
+    }
+    // (M - UVᵀ)⁻¹W = M⁻¹W + M⁻¹U (I - VᵀM⁻¹U)⁻¹ VᵀM⁻¹W.
+    const auto Minv_W = solution.leftCols(W.cols());
+    const auto Minv_U = solution.rightCols(m);
+    const MatrixX<Scalar> Vt = V_.transpose().template cast<Scalar>();
+    const MatrixX<Scalar> capacitance =
+        MatrixX<Scalar>::Identity(m, m) - Vt * Minv_U;
+    return Minv_W + Minv_U * capacitance.partialPivLu().solve(Vt * Minv_W);
+  }
+
+ private:
+  const Eigen::SparseMatrix<double>& At_;
+  const Eigen::MatrixXd& U_;
+  const Eigen::MatrixXd& V_;
+};
+
+// Returns ‖WWᵀ‖₂ = ‖WᵀW‖₂.
+double SquaredNorm2(const Eigen::MatrixXd& W) {
+  if (W.cols() == 0) return 0;
+  const Eigen::MatrixXd WtW = W.transpose() * W;
+  return WtW.selfadjointView<Eigen::Lower>().operatorNorm();
+}
+
+// Returns the ADI shifts from the eigenvalues of F projected onto the range of
+// Y (the Ritz values).  Those in the right half-plane are mirrored into the
+// left one, and the complex ones come in conjugate pairs, the one with a
+// positive imaginary part first.
+std::vector<Complex> CalcProjectionShifts(const LyapunovOperator& F,
+                                          const Eigen::MatrixXd& Y) {
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> qr(Y);
+  const int rank = qr.rank();
+  const Eigen::MatrixXd Q =
+      qr.householderQ() * Eigen::MatrixXd::Identity(Y.rows(), rank);
+  const Eigen::MatrixXd H = Q.transpose() * F.Multiply(Q);
+  const Eigen::VectorXcd ritz_values =
+      Eigen::EigenSolver<Eigen::MatrixXd>(H, false).eigenvalues();
+
+  std::vector<Complex> shifts;
+  const double tiny = std::sqrt(std::numeric_limits<double>::epsilon()) *
+                      (H.norm() + 1);
+  for (const Complex& ritz_value : ritz_values) {
+    // A shift on the imaginary axis would make no progress.
+    if (std::abs(ritz_value.real()) <= tiny) continue;
+    const Complex p(-std::abs(ritz_value.real()), ritz_value.imag());
+    if (std::abs(p.imag()) <= tiny) {
+      shifts.push_back(p.real());
+    } else if (p.imag() > 0) {
+      shifts.push_back(p);
+      shifts.push_back(std::conj(p));
+    }
+  }
+  if (shifts.empty()) {
+    shifts.push_back(-(H.norm() + 1));
+  }
+  return shifts;
+}
+
+// Returns a factor Z with full column rank and ZZᵀ = YYᵀ, up to the relative
+// singular values of Y below √ε.
+Eigen::MatrixXd CompressColumns(const Eigen::MatrixXd& Y) {
+  if (Y.cols() == 0) return Y;
+  Eigen::HouseholderQR<Eigen::MatrixXd> qr(Y);
+  const int r = std::min(Y.rows(), Y.cols());
+  // YYᵀ = QRRᵀQᵀ = (QU)Σ²(QU)ᵀ, with the SVD R = UΣVᵀ.
+  const Eigen::MatrixXd R =
+      qr.matrixQR().topRows(r).triangularView<Eigen::Upper>();
+  Eigen::JacobiSVD<Eigen::MatrixXd> svd(R, Eigen::ComputeThinU);
+  const Eigen::VectorXd& sigma = svd.singularValues();
+  const double threshold =
+      std::sqrt(std::numeric_limits<double>::epsilon()) * sigma(0);
+  int rank = 0;
+  while (rank < sigma.size() && sigma(rank) > threshold) ++rank;
+  const Eigen::MatrixXd Q =
+      qr.householderQ() * Eigen::MatrixXd::Identity(Y.rows(), r);
+  return Q * (svd.matrixU().leftCols(rank) *
+              sigma.head(rank).asDiagonal());
+}
+
+// The minimum dimension of the spaces onto which F is projected to compute the
+// ADI shifts.  Too small a space yields too few shifts, and no complex ones
+// for the projection onto a single vector.
+constexpr int kMinProjectionDimension = 12;
+
+// Returns the block Krylov space [G, FG, F⁻¹G, F²G, F⁻²G, ...] with at least
+// kMinProjectionDimension columns (or n, if smaller).  Its Ritz values
+// approximate both the largest and the smallest eigenvalues of F, in
+// magnitude.  Each block is normalized, since only its range matters.
+Eigen::MatrixXd MakeInitialProjectionSpace(const LyapunovOperator& F,
+                                           const Eigen::MatrixXd& G) {
+  const int n = F.size();
+  const int dimension = std::min(n, kMinProjectionDimension);
+  Eigen::MatrixXd Y = G / G.norm();
+  Eigen::MatrixXd forward = Y;
+  Eigen::MatrixXd backward = Y;
+  while (Y.cols() < dimension) {
+    forward = F.Multiply(forward);
+    forward /= forward.norm();
+    backward = F.SolveShifted(0.0, backward);
+    backward /= backward.norm();
+    Y.conservativeResize(n, Y.cols() + 2 * G.cols());
+    Y.rightCols(2 * G.cols()) << forward, backward;
+  }
+  return Y;
+}
+
+// Solves FX + XFᵀ + GGᵀ = 0 for a low-rank factor Z of X = ZZᵀ, with the
+// low-rank ADI method in real arithmetic, see [1] in the header.  The shifts
+// are recomputed, after every cycle through them, from the projection of F
+// onto the columns added to Z during the cycle (or onto at least the last
+// kMinProjectionDimension columns), see [2] in the header.
+Eigen::MatrixXd SolveLowRankAdi(const LyapunovOperator& F,
+                                const Eigen::MatrixXd& G,
+                                const LowRankMatrixEquationOptions& options) {
+  const int n = F.size();
+  const double G_norm = SquaredNorm2(G);
+  if (G_norm == 0) {
+    return Eigen::MatrixXd(n, 0);
+  }
+
+  // The residual is WWᵀ.
+  Eigen::MatrixXd W = G;
+  std::vector<Eigen::MatrixXd> blocks;
+  std::vector<Complex> shifts =
+      CalcProjectionShifts(F, MakeInitialProjectionSpace(F, G));
+  int next_shift = 0;
+  int cycle_begin = 0;
+  for (int iteration = 0; iteration < options.max_adi_iterations;
+       ++iteration) {
+    if (next_shift == static_cast<int>(shifts.size())) {
+      const int min_columns = std::min(n, kMinProjectionDimension);
+      int first = blocks.size();
+      int num_columns = 0;
+      while (first > 0 &&
+             (first > cycle_begin || num_columns < min_columns)) {
+        num_columns += blocks[--first].cols();
+      }
+      Eigen::MatrixXd cycle(n, num_columns);
+      for (int i = first, column = 0; i < static_cast<int>(blocks.size());
+           ++i) {
+        cycle.middleCols(column, blocks[i].cols()) = blocks[i];
+        column += blocks[i].cols();
+      }
+      shifts = CalcProjectionShifts(F, cycle);
+      next_shift = 0;
+      cycle_begin = blocks.size();
+    }
+    const Complex p = shifts[next_shift++];
+    if (p.imag() == 0) {
+      const Eigen::MatrixXd V = F.SolveShifted(p.real(), W);
+      W -= 2 * p.real() * V;
+      blocks.push_back(std::sqrt(-2 * p.real()) * V);
+    } else {
+      // A pair of complex conjugate shifts p, p̄ is applied at once, in real
+      // arithmetic.
+      const Eigen::MatrixXcd V = F.SolveShifted(p, W);
+      const double gamma = 2 * std::sqrt(-p.real());
+      const double delta = p.real() / p.imag();
+      const Eigen::MatrixXd V_real = V.real() + delta * V.imag();
+      W += gamma * gamma * V_real;
+      blocks.push_back(gamma * V_real);
+      blocks.push_back(gamma * std::sqrt(delta * delta + 1) * V.imag());
+      ++next_shift;
+    }
+    const double residual = SquaredNorm2(W);
+    if (!std::isfinite(residual)) {
+      break;
+    }
+    if (residual <= options.adi_tolerance * G_norm) {
+      int num_columns = 0;
+      for (const auto& block : blocks) num_columns += block.cols();
+      Eigen::MatrixXd Z(n, num_columns);
+      int column = 0;
+      for (const auto& block : blocks) {
+        Z.middleCols(column, block.cols()) = block;
+        column += block.cols();
+      }
+      return CompressColumns(Z);
+    }
+  }
+  throw std::runtime_error(fmt::format(
+      "Low-rank ADI did not converge in {} iterations; is A Hurwitz?",
+      options.max_adi_iterations));
+}
+
+}  // namespace
+
+Eigen::MatrixXd RealContinuousLyapunovEquationLowRank(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& C,
+    const LowRankMatrixEquationOptions& options) {
+  DRAKE_THROW_UNLESS(A.rows() == A.cols());
+  DRAKE_THROW_UNLESS(C.cols() == A.rows());
+  const Eigen::SparseMatrix<double> At = A.transpose();
+  const Eigen::MatrixXd none(A.rows(), 0);
+  return SolveLowRankAdi(LyapunovOperator(At, none, none), C.transpose(),
+                         options);
+}
+
+LowRankRiccatiResult ContinuousAlgebraicRiccatiEquationLowRank(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& C,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const LowRankMatrixEquationOptions& options) {
+  const int n = A.rows();
+  const int m = B.cols();
+  DRAKE_THROW_UNLESS(A.cols() == n);
+  DRAKE_THROW_UNLESS(B.rows() == n);
+  DRAKE_THROW_UNLESS(C.cols() == n);
+  DRAKE_THROW_UNLESS(R.rows() == m && R.cols() == m);
+  const Eigen::LLT<Eigen::MatrixXd> R_cholesky(R);
+  if (R_cholesky.info() != Eigen::Success) {
+    throw std::runtime_error("R must be positive definite");
+  }
+  const Eigen::MatrixXd L = R_cholesky.matrixL();
+  const Eigen::SparseMatrix<double> At = A.transpose();
+  const Eigen::MatrixXd B_dense = B;
+
+  LowRankRiccatiResult result;
+  result.K = Eigen::MatrixXd::Zero(m, n);
+  for (int iteration = 0; iteration < options.max_newton_iterations;
+       ++iteration) {
+    // Sₖ₊₁ solves the Lyapunov equation of the closed loop Aₖ = A - BKₖ,
+    //   AₖᵀS + SAₖ + CᵀC + KₖᵀRKₖ = 0.
+    const Eigen::MatrixXd Kt = result.K.transpose();
+    Eigen::MatrixXd G(n, C.rows() + m);
+    G << C.transpose(), Kt * L;
+    result.Z = SolveLowRankAdi(LyapunovOperator(At, Kt, B_dense), G, options);
+    const Eigen::MatrixXd K_next =
+        R_cholesky.solve(B.transpose() * result.Z) * result.Z.transpose();
+    const double change = (K_next - result.K).norm();
+    result.K = K_next;
+    if (change <= options.newton_tolerance * result.K.norm()) {
+      return result;
+    }
+  }
+  throw std::runtime_error(fmt::format(
+      "The low-rank Newton-Kleinman iteration did not converge in {} "
+      "iterations.",
+      options.max_newton_iterations));
+}
+
+}  // namespace math
+}  // namespace drake
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <Eigen/Dense>
+#include <Eigen/SparseCore>
+
+namespace drake {
+namespace math {
+
+/// Options for the low-rank solvers of large, sparse matrix equations.
+struct LowRankMatrixEquationOptions {
+  /// The low-rank ADI iteration for a Lyapunov equation AᵀX + XA + CᵀC = 0
+  /// stops once the 2-norm of its residual is at most `adi_tolerance` times
+  /// ‖CᵀC‖₂.
+  double adi_tolerance{1e-10};
+
+  /// The maximum number of ADI iterations, per Lyapunov equation.
+  int max_adi_iterations{200};
+
+  /// The Newton-Kleinman iteration for a Riccati equation stops once the
+  /// relative change of its gain K is at most `newton_tolerance`, in the
+  /// Frobenius norm.
+  double newton_tolerance{1e-9};
+
+  /// The maximum number of Newton-Kleinman iterations.
+  int max_newton_iterations{30};
+};
+
+/// Computes a low-rank factor Z of the solution X = ZZᵀ to the continuous
+/// Lyapunov equation
+///
+///   AᵀX + XA + CᵀC = 0,
+///
+/// where A is a large, sparse n-by-n matrix and C is a p-by-n matrix with
+/// p ≪ n.  This is the same equation as RealContinuousLyapunovEquation(A, Q)
+/// with Q = CᵀC, which is dense and costs O(n³) time and O(n²) memory; here,
+/// the cost is dominated by one sparse LU factorization of A + pI per shift p,
+/// and X is never formed.
+///
+/// The solution is computed with the low-rank ADI method in real arithmetic
+/// [1], with projection shifts [2], and its columns are compressed so that
+/// Z has full column rank (up to a relative singular value of √ε).
+///
+/// @pre All the eigenvalues of A have negative real parts, i.e. A is Hurwitz,
+/// so that X exists, is unique and positive semi-definite.
+/// @throws std::exception if the sizes of A and C don't match, or if the
+/// iteration doesn't converge within `options.max_adi_iterations`.
+///
+/// [1] P. Benner, P. Kürschner and J. Saak, "Efficient handling of complex
+/// shift parameters in the low-rank ADI method", Numerical Algorithms, 62(2),
+/// 2013.
+///
+/// [2] P. Benner, P. Kürschner and J. Saak, "Self-generating and efficient
+/// shift parameters in ADI methods for large Lyapunov and Sylvester
+/// equations", Electronic Transactions on Numerical Analysis, 43, 2014.
+Eigen::MatrixXd RealContinuousLyapunovEquationLowRank(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& C,
+    const LowRankMatrixEquationOptions& options = {});
+
+/// The result of ContinuousAlgebraicRiccatiEquationLowRank().
+struct LowRankRiccatiResult {
+  /// The low-rank factor of the solution S = ZZᵀ.
+  Eigen::MatrixXd Z;
+  /// The gain K = R⁻¹BᵀS, so that A - BK is the stabilized closed loop of the
+  /// linear quadratic regulator with cost xᵀCᵀCx + uᵀRu.
+  Eigen::MatrixXd K;
+};
+
+/// Computes a low-rank factor Z of the stabilizing solution S = ZZᵀ to the
+/// continuous-time algebraic Riccati equation
+///
+///   SA + AᵀS - SBR⁻¹BᵀS + CᵀC = 0,
+///
+/// where A is a large, sparse n-by-n matrix, and B and C are n-by-m and p-by-n
+/// matrices with m, p ≪ n.  This is the same equation as
+/// ContinuousAlgebraicRiccatiEquation(A, B, Q, R) with Q = CᵀC, whose cost is
+/// O(n³).
+///
+/// The solution is computed with the low-rank Newton-Kleinman method: every
+/// iteration solves the Lyapunov equation of the current closed loop
+/// A - BKₖ with RealContinuousLyapunovEquationLowRank()'s method, handling
+/// the low-rank term BKₖ with the Sherman-Morrison-Woodbury formula so that
+/// only A + pI is ever factorized.  The iteration starts from K₀ = 0.
+///
+/// @pre A is Hurwitz, so that K₀ = 0 is stabilizing.
+/// @throws std::exception if the sizes of A, B, C and R don't match, if R is
+/// not positive definite, or if an iteration doesn't converge.
+LowRankRiccatiResult ContinuousAlgebraicRiccatiEquationLowRank(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& C,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const LowRankMatrixEquationOptions& options = {});
+
+}  // namespace math
+}  // namespace drake
@@ -674,3 +674,6 @@ using RigidTransformd = RigidTransform<double>;
 
 DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::math::RigidTransform)
+
+// Also instantiated on a small, heap-free autodiff scalar; see AutoDiffUpTo.
+extern template class ::drake::math::RigidTransform<::drake::AutoDiffUpTo<16>>;
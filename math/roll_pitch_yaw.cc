@@ -136,8 +136,10 @@ Vector3<T> CalcRollPitchYawFromQuaternionAndRotationMatrix(
   const T epsilon = Eigen::NumTraits<T>::epsilon();
   const auto isSingularA = abs(yA) <= epsilon && abs(xA) <= epsilon;
   const auto isSingularB = abs(yB) <= epsilon && abs(xB) <= epsilon;
-  const T zA = if_then_else(isSingularA, T{0.0}, atan2(yA, xA));
-  const T zB = if_then_else(isSingularB, T{0.0}, atan2(yB, xB));
+  // N.B. Eigen's atan2() for AutoDiffScalar returns a dynamic-sized derivative
+  // type, which is converted back to T.
+  const T zA = if_then_else(isSingularA, T{0.0}, T(atan2(yA, xA)));
+  const T zB = if_then_else(isSingularB, T{0.0}, T(atan2(yB, xB)));
   T q1 = zA - zB;  // First angle in rotation sequence.
   T q3 = zA + zB;  // Third angle in rotation sequence.
 
@@ -261,3 +263,5 @@ DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS((
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::math::RollPitchYaw)
+
+template class ::drake::math::RollPitchYaw<::drake::AutoDiffUpTo<16>>;
@@ -666,3 +666,6 @@ using RollPitchYawd = RollPitchYaw<double>;
 
 DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::math::RollPitchYaw)
+
+// Also instantiated on a small, heap-free autodiff scalar; see AutoDiffUpTo.
+extern template class ::drake::math::RollPitchYaw<::drake::AutoDiffUpTo<16>>;
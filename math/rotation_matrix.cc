@@ -278,3 +278,5 @@ Vector3<T> RotationMatrix<T>::NormalizeOrThrow(const Vector3<T>& v,
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::math::RotationMatrix)
+
+template class ::drake::math::RotationMatrix<::drake::AutoDiffUpTo<16>>;
@@ -1095,3 +1095,6 @@ double ProjectMatToRotMatWithAxis(const Eigen::Matrix3d& M,
 
 DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::math::RotationMatrix)
+
+// Also instantiated on a small, heap-free autodiff scalar; see AutoDiffUpTo.
+extern template class ::drake::math::RotationMatrix<::drake::AutoDiffUpTo<16>>;
@@ -99,6 +99,38 @@ GTEST_TEST(BarycentricTest, EvalWeights) {
   EXPECT_TRUE(CompareMatrices(weights, Vector3d{.5, 0, .5}, 1e-8));
 }
 
+GTEST_TEST(BarycentricTest, EvalWeightsBatch) {
+  BarycentricMesh<double> bary{{{0.0, 1.0},  // BR
+                                {2.0},       // BR
+                                {3.0, 4.0}}};
+
+  // The samples of EvalWeights, one per column.
+  Eigen::Matrix<double, 3, 5> samples;
+  // clang-format off
+  samples << 1,   1.5, 0,   -1.5, .5,
+             2,   3,   2,   2,    2,
+             3.1, 3.1, 3.4, 3.4,  3.5;
+  // clang-format on
+
+  // Write into a block of larger matrices.
+  Eigen::MatrixXi indices = Eigen::MatrixXi::Constant(3, 7, -1);
+  MatrixXd weights = MatrixXd::Constant(3, 7, -1);
+  auto indices_block = indices.middleCols(1, 5);
+  auto weights_block = weights.middleCols(1, 5);
+  bary.EvalBarycentricWeightsBatch(samples, &indices_block, &weights_block);
+
+  VectorXi expected_indices(3);
+  VectorXd expected_weights(3);
+  for (int j = 0; j < samples.cols(); j++) {
+    bary.EvalBarycentricWeights(samples.col(j), &expected_indices,
+                                &expected_weights);
+    EXPECT_TRUE(CompareMatrices(indices.col(j + 1), expected_indices));
+    EXPECT_TRUE(CompareMatrices(weights.col(j + 1), expected_weights));
+  }
+  EXPECT_TRUE(CompareMatrices(indices.col(0), Vector3i::Constant(-1)));
+  EXPECT_TRUE(CompareMatrices(weights.col(6), Vector3d::Constant(-1)));
+}
+
 GTEST_TEST(BarycentricTest, EvalTest) {
   BarycentricMesh<double> bary{{{0.0, 1.0},  // BR
                                 {0.0, 1.0}}};
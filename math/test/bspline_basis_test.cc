@@ -279,6 +279,69 @@ TYPED_TEST(BsplineBasisTests, EvaluateBasisFunctionIScipyComparison) {
   }
 }
 
+// Verifies that EvaluateActiveBasisFunctions() agrees with
+// EvaluateBasisFunctionI() and ComputeActiveBasisFunctionIndices(), with and
+// without interval hints, on a knot vector with a repeated interior knot.
+TYPED_TEST(BsplineBasisTests, EvaluateActiveBasisFunctionsTest) {
+  using T = TypeParam;
+  const int order = 4;
+  const std::vector<T> knots{0, 0, 0, 0, 0.1, 0.3, 0.3, 0.7, 1, 1, 1, 1};
+  const BsplineBasis<T> basis{order, knots};
+  const int num_parameter_values = 50;
+  VectorX<T> values;
+  int hinted_first = -1;
+  for (int i = 0; i < num_parameter_values; ++i) {
+    const T parameter_value = i / (num_parameter_values - 1.0);
+    const int first =
+        basis.EvaluateActiveBasisFunctions(parameter_value, &values);
+    hinted_first = basis.EvaluateActiveBasisFunctions(parameter_value, &values,
+                                                      hinted_first);
+    EXPECT_EQ(first,
+              basis.ComputeActiveBasisFunctionIndices(parameter_value).front());
+    EXPECT_EQ(hinted_first, first);
+    ASSERT_EQ(values.size(), order);
+    for (int j = 0; j < basis.num_basis_functions(); ++j) {
+      const T expected = basis.EvaluateBasisFunctionI(j, parameter_value);
+      const T actual = (j >= first && j < first + order)
+                           ? values(j - first)
+                           : T(0.0);
+      EXPECT_NEAR(ExtractDoubleOrThrow(actual), ExtractDoubleOrThrow(expected),
+                  4 * std::numeric_limits<double>::epsilon());
+    }
+  }
+
+  // A hint that is wrong is ignored.
+  const int expected_first =
+      basis.ComputeActiveBasisFunctionIndices(T(0.8)).front();
+  for (int hint = 0; hint < basis.num_basis_functions(); ++hint) {
+    EXPECT_EQ(basis.EvaluateActiveBasisFunctions(T(0.8), &values, hint),
+              expected_first);
+  }
+}
+
+// Verifies that ComputeBasisMatrix() agrees with EvaluateBasisFunctionI(),
+// for parameter values in any order.
+TYPED_TEST(BsplineBasisTests, ComputeBasisMatrixTest) {
+  using T = TypeParam;
+  const BsplineBasis<T> basis{3, 6};
+  const std::vector<T> parameter_values{0, 0.1, 0.25, 0.5, 0.55, 1, 0.3, 0};
+  const Eigen::SparseMatrix<T> basis_matrix =
+      basis.ComputeBasisMatrix(parameter_values);
+  ASSERT_EQ(basis_matrix.rows(), static_cast<int>(parameter_values.size()));
+  ASSERT_EQ(basis_matrix.cols(), basis.num_basis_functions());
+  EXPECT_EQ(basis_matrix.nonZeros(),
+            static_cast<int>(parameter_values.size()) * basis.order());
+  const MatrixX<T> dense = basis_matrix;
+  for (int i = 0; i < dense.rows(); ++i) {
+    for (int j = 0; j < dense.cols(); ++j) {
+      EXPECT_NEAR(ExtractDoubleOrThrow(dense(i, j)),
+                  ExtractDoubleOrThrow(
+                      basis.EvaluateBasisFunctionI(j, parameter_values[i])),
+                  4 * std::numeric_limits<double>::epsilon());
+    }
+  }
+}
+
 // Tests that {initial,final}_parameter_value() behave as expected.
 TYPED_TEST(BsplineBasisTests, InitialAndFinalParameterValueTest) {
   using T = TypeParam;
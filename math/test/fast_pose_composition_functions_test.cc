@@ -1,5 +1,6 @@
 #include "drake/math/fast_pose_composition_functions.h"
 
+#include <functional>
 #include <limits>
 
 #include <Eigen/Dense>
@@ -154,6 +155,56 @@ void TestXxX(std::function<void(const RigidTransform<double>& X1,
       invert_first_matrix);
 }
 
+// Test the given batched RigidTransform composition function against the
+// corresponding single composition, including when the output array is one of
+// the input arrays.
+void TestXxXBatch(
+    std::function<void(const RigidTransform<double>*,
+                       const RigidTransform<double>*, int,
+                       RigidTransform<double>*)> compose_batch,
+    std::function<void(const RigidTransform<double>&,
+                       const RigidTransform<double>&,
+                       RigidTransform<double>*)> compose_single) {
+  // As above, these are not legitimate RigidTransform values.
+  constexpr int kCount = 5;
+  Eigen::Matrix<double, 12, kCount> M, N;
+  for (int i = 0; i < M.size(); ++i) {
+    M(i) = i + 1;
+    N(i) = 2 * i - 30;
+  }
+  // Column i of a 12-by-kCount matrix is the i'th element of an array of
+  // RigidTransforms.
+  auto as_transform = [](auto* matrix, int i) {
+    return reinterpret_cast<RigidTransform<double>*>(matrix->col(i).data());
+  };
+  auto as_transforms = [&as_transform](auto* matrix) {
+    return as_transform(matrix, 0);
+  };
+  Eigen::Matrix<double, 12, kCount> expected;
+  for (int i = 0; i < kCount; ++i) {
+    compose_single(*as_transform(&M, i), *as_transform(&N, i),
+                   as_transform(&expected, i));
+  }
+
+  Eigen::Matrix<double, 12, kCount> result;
+  compose_batch(as_transforms(&M), as_transforms(&N), kCount,
+                as_transforms(&result));
+  EXPECT_TRUE(CompareMatrices(result, expected, 0));
+
+  // Now test in-place compositions.
+  Eigen::Matrix<double, 12, kCount> Mwork = M, Nwork = N;
+  compose_batch(as_transforms(&Mwork), as_transforms(&Nwork), kCount,
+                as_transforms(&Mwork));
+  EXPECT_TRUE(CompareMatrices(Mwork, expected, 0));
+  Mwork = M;
+  compose_batch(as_transforms(&Mwork), as_transforms(&Nwork), kCount,
+                as_transforms(&Nwork));
+  EXPECT_TRUE(CompareMatrices(Nwork, expected, 0));
+
+  // An empty batch does nothing.
+  compose_batch(nullptr, nullptr, 0, nullptr);
+}
+
 /* Test the user-callable methods first. Those are ideally implemented
 with SIMD instructions, however they may just punt to the plain C++ fallback
 methods, which we'll test separately below. */
@@ -175,6 +226,15 @@ GTEST_TEST(TestFastPoseCompositionFunctions, TestXinvX) {
   TestXxX(internal::ComposeXinvX, true);
 }
 
+GTEST_TEST(TestFastPoseCompositionFunctions, TestXXBatch) {
+  SCOPED_TRACE("testing ComposeXXBatch()");
+  TestXxXBatch(internal::ComposeXXBatch, internal::ComposeXX);
+}
+GTEST_TEST(TestFastPoseCompositionFunctions, TestXinvXBatch) {
+  SCOPED_TRACE("testing ComposeXinvXBatch()");
+  TestXxXBatch(internal::ComposeXinvXBatch, internal::ComposeXinvX);
+}
+
 /* Now repeat these tests for the portable methods. */
 
 GTEST_TEST(TestFastPoseCompositionFunctions, TestRRPortable) {
@@ -193,6 +253,15 @@ GTEST_TEST(TestFastPoseCompositionFunctions, TestXinvXPortable) {
   SCOPED_TRACE("testing internal::ComposeXinvXPortable()");
   TestXxX(internal::ComposeXinvXPortable, true);
 }
+GTEST_TEST(TestFastPoseCompositionFunctions, TestXXBatchPortable) {
+  SCOPED_TRACE("testing internal::ComposeXXBatchPortable()");
+  TestXxXBatch(internal::ComposeXXBatchPortable, internal::ComposeXXPortable);
+}
+GTEST_TEST(TestFastPoseCompositionFunctions, TestXinvXBatchPortable) {
+  SCOPED_TRACE("testing internal::ComposeXinvXBatchPortable()");
+  TestXxXBatch(internal::ComposeXinvXBatchPortable,
+               internal::ComposeXinvXPortable);
+}
 
 }  // namespace
 
@@ -0,0 +1,125 @@
+#include "drake/math/low_rank_matrix_equations.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/continuous_algebraic_riccati_equation.h"
+#include "drake/math/continuous_lyapunov_equation.h"
+
+using Eigen::MatrixXd;
+
+namespace drake {
+namespace math {
+namespace {
+
+// The heat equation on a rod, discretized with finite differences, with some
+// advection: A is a sparse, non-symmetric, Hurwitz matrix with real
+// eigenvalues.
+Eigen::SparseMatrix<double> MakeHeatEquation(int n) {
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (int i = 0; i < n; ++i) {
+    triplets.emplace_back(i, i, -2.0 * n);
+    if (i > 0) triplets.emplace_back(i, i - 1, 1.2 * n);
+    if (i < n - 1) triplets.emplace_back(i, i + 1, 0.8 * n);
+  }
+  Eigen::SparseMatrix<double> A(n, n);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  return A;
+}
+
+// A damped chain of k masses and springs, with the state (q, v): A is Hurwitz,
+// with lightly damped, complex eigenvalues.
+Eigen::SparseMatrix<double> MakeMassSpringChain(int k) {
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (int i = 0; i < k; ++i) {
+    triplets.emplace_back(i, k + i, 1.0);
+    // v̇ = -Kq - Dv, with the stiffness K of the chain and the damping
+    // D = 0.05 I + 0.01 K.
+    for (const auto& [j, stiffness] :
+         {std::pair{i - 1, -1.0}, std::pair{i, 2.0}, std::pair{i + 1, -1.0}}) {
+      if (j < 0 || j >= k) continue;
+      triplets.emplace_back(k + i, j, -stiffness);
+      triplets.emplace_back(k + i, k + j,
+                            -0.01 * stiffness - (i == j ? 0.05 : 0.0));
+    }
+  }
+  Eigen::SparseMatrix<double> A(2 * k, 2 * k);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  return A;
+}
+
+// Returns the number of columns of the low-rank factor.
+int CheckLyapunov(const Eigen::SparseMatrix<double>& A, const MatrixXd& C) {
+  const MatrixXd Z = RealContinuousLyapunovEquationLowRank(A, C);
+  const MatrixXd X = Z * Z.transpose();
+  const MatrixXd Q = C.transpose() * C;
+  const MatrixXd X_expected =
+      RealContinuousLyapunovEquation(MatrixXd(A), Q);
+  EXPECT_TRUE(CompareMatrices(X, X_expected, 1E-7 * X_expected.norm()));
+  return Z.cols();
+}
+
+GTEST_TEST(LowRankMatrixEquationsTest, LyapunovRealEigenvalues) {
+  const int n = 60;
+  MatrixXd C = MatrixXd::Zero(2, n);
+  C(0, 0) = 1;
+  C(1, n / 2) = 1;
+  // The solution is numerically low-rank.
+  EXPECT_LE(CheckLyapunov(MakeHeatEquation(n), C), n / 2);
+}
+
+GTEST_TEST(LowRankMatrixEquationsTest, LyapunovComplexEigenvalues) {
+  const int k = 30;
+  MatrixXd C = MatrixXd::Zero(1, 2 * k);
+  C(0, k - 1) = 1;
+  CheckLyapunov(MakeMassSpringChain(k), C);
+}
+
+GTEST_TEST(LowRankMatrixEquationsTest, Riccati) {
+  const int k = 25;
+  const Eigen::SparseMatrix<double> A = MakeMassSpringChain(k);
+  const int n = 2 * k;
+  MatrixXd B = MatrixXd::Zero(n, 2);
+  B(k, 0) = 1;
+  B(2 * k - 1, 1) = 1;
+  MatrixXd C = MatrixXd::Zero(3, n);
+  C(0, 0) = 1;
+  C(1, k / 2) = 1;
+  C(2, k - 1) = 2;
+  const Eigen::Matrix2d R(Eigen::Vector2d(1, 0.5).asDiagonal());
+
+  const LowRankRiccatiResult result =
+      ContinuousAlgebraicRiccatiEquationLowRank(A, B, C, R);
+  const MatrixXd S = result.Z * result.Z.transpose();
+  const MatrixXd S_expected = ContinuousAlgebraicRiccatiEquation(
+      MatrixXd(A), B, C.transpose() * C, R);
+  EXPECT_TRUE(CompareMatrices(S, S_expected, 1E-6 * S_expected.norm()));
+  EXPECT_TRUE(CompareMatrices(result.K, R.inverse() * B.transpose() * S,
+                              1E-10 * S.norm()));
+}
+
+GTEST_TEST(LowRankMatrixEquationsTest, Errors) {
+  const Eigen::SparseMatrix<double> A = MakeHeatEquation(4);
+  EXPECT_THROW(RealContinuousLyapunovEquationLowRank(A, MatrixXd::Ones(1, 3)),
+               std::exception);
+  EXPECT_THROW(ContinuousAlgebraicRiccatiEquationLowRank(
+                   A, MatrixXd::Ones(4, 1), MatrixXd::Ones(1, 4),
+                   -MatrixXd::Identity(1, 1)),
+               std::exception);
+
+  // An unstable A.
+  const Eigen::SparseMatrix<double> unstable = -A;
+  EXPECT_THROW(
+      RealContinuousLyapunovEquationLowRank(unstable, MatrixXd::Ones(1, 4)),
+      std::exception);
+
+  // A zero right-hand side has a zero solution.
+  EXPECT_EQ(
+      RealContinuousLyapunovEquationLowRank(A, MatrixXd::Zero(1, 4)).cols(), 0);
+}
+
+}  // namespace
+}  // namespace math
+}  // namespace drake
@@ -885,6 +885,37 @@ GTEST_TEST(RigidTransform, StreamInsertionOperator) {
       Vector3d{-0.1, 0.2, 0.3}, "xyz = -10 20 30");
 }
 
+// Verify that a RigidTransform on the inline-storage AutoDiffUpTo scalar has
+// the same values and derivatives as one on AutoDiffXd, including when it is
+// composed with a constant transform, whose derivatives are empty.
+GTEST_TEST(RigidTransform, AutoDiffUpTo) {
+  Vector6<double> values;
+  values << -0.3, 0.2, 0.9, 1.0, -2.0, 3.0;
+  auto make = [&values](auto zero) {
+    using U = decltype(zero);
+    Vector6<U> x;
+    for (int i = 0; i < 6; ++i) {
+      x(i).value() = values(i);
+      x(i).derivatives() = Eigen::VectorXd::Unit(6, i);
+    }
+    const RigidTransform<U> X_AB(RollPitchYaw<U>(x.template head<3>()),
+                                 x.template tail<3>());
+    const RigidTransform<U> X_BC(RollPitchYaw<U>(0.1, 0.5, -0.2),
+                                 Vector3<U>(4, 5, 6));
+    return (X_AB * X_BC.inverse()).GetAsMatrix34();
+  };
+  const Eigen::Matrix<AutoDiffXd, 3, 4> expected = make(AutoDiffXd{});
+  const Eigen::Matrix<AutoDiffUpTo<16>, 3, 4> actual =
+      make(AutoDiffUpTo<16>{});
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      EXPECT_NEAR(actual(i, j).value(), expected(i, j).value(), 1E-14);
+      EXPECT_TRUE(CompareMatrices(actual(i, j).derivatives(),
+                                  expected(i, j).derivatives(), 1E-14));
+    }
+  }
+}
+
 }  // namespace
 }  // namespace math
 }  // namespace drake
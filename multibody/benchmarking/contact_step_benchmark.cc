@@ -0,0 +1,378 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/profiler.h"
+#include "drake/geometry/proximity_properties.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using geometry::Box;
+using geometry::HalfSpace;
+using geometry::ProximityProperties;
+using geometry::SceneGraph;
+using geometry::Sphere;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::Context;
+using systems::Diagram;
+using systems::DiscreteValues;
+
+constexpr double kTimeStep = 1.0e-3;
+
+// The number of extra steps, run with the Profiler enabled after the timed
+// loop, that the per-phase counters are averaged over.
+constexpr int kProfiledSteps = 10;
+
+const CoulombFriction<double> kFriction(0.5, 0.5);
+
+ProximityProperties MakeCompliantProperties(double resolution_hint) {
+  ProximityProperties properties;
+  geometry::AddCompliantHydroelasticProperties(resolution_hint, 5.0e5,
+                                               &properties);
+  geometry::AddContactMaterial(1.0, {}, kFriction, &properties);
+  return properties;
+}
+
+/* Times a single discrete step of a MultibodyPlant, i.e., the geometry
+ queries, the contact kinematics and the contact solve, on contact-rich
+ scenes. The benchmarks take a single argument selecting the scene:
+
+ - 0: a bin of 100 boxes and spheres, with point contact.
+ - 1: two KUKA iiwa arms with Schunk WSG grippers over a table of boxes, with
+   point contact.
+ - 2: an Allegro hand, palm up, holding two compliant objects, with
+   hydroelastic contact (the hand is rigid).
+
+ Each scene is first simulated for a short time so that the objects settle
+ into contact; every step then starts from that same settled state. The
+ actuation is fixed to the gravity compensation of that state, so that the
+ arms and fingers hold their configuration.
+
+ The step uses the plant's default TAMSI solver. Besides the time per step,
+ each benchmark reports the average time per step of its phases, measured with
+ the Profiler (see ReportPhases()).
+
+ SAP and deformable bodies are not benchmarked: MultibodyPlant can't step
+ either yet (CompliantContactManager only uses SAP for contact-free plants). */
+class ContactStepFixture : public benchmark::Fixture {
+ public:
+  ContactStepFixture() { tools::performance::AddMinMaxStatistics(this); }
+
+  // This apparently futile using statement works around "overloaded virtual"
+  // errors in g++. All of this is a consequence of the weird deprecation of
+  // const-ref State versions of SetUp() and TearDown() in benchmark.h.
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    initial_poses_.clear();
+    initial_angles_.clear();
+    systems::DiagramBuilder<double> builder;
+    auto items = AddMultibodyPlantSceneGraph(&builder, kTimeStep);
+    plant_ = &items.plant;
+    scene_graph_ = &items.scene_graph;
+    switch (state.range(0)) {
+      case 0:
+        AddClutterBin();
+        state.SetLabel("clutter_bin");
+        break;
+      case 1:
+        AddDualIiwaStation();
+        state.SetLabel("dual_iiwa_wsg");
+        break;
+      default:
+        AddAllegroHand();
+        state.SetLabel("allegro_hydroelastic");
+    }
+    plant_->Finalize();
+    diagram_ = builder.Build();
+
+    context_ = diagram_->CreateDefaultContext();
+    plant_context_ = &plant_->GetMyMutableContextFromRoot(context_.get());
+    for (const auto& [body, X_WB] : initial_poses_) {
+      plant_->SetFreeBodyPose(plant_context_, *body, X_WB);
+    }
+    for (const auto& [joint, angle] : initial_angles_) {
+      joint->set_angle(plant_context_, angle);
+    }
+    const VectorXd gravity_compensation =
+        -plant_->MakeActuationMatrix().transpose() *
+        plant_->CalcGravityGeneralizedForces(*plant_context_);
+    plant_->get_actuation_input_port().FixValue(plant_context_,
+                                                gravity_compensation);
+
+    systems::Simulator<double> simulator(*diagram_, std::move(context_));
+    simulator.AdvanceTo(0.3);
+    context_ = simulator.release_context();
+    plant_context_ = &plant_->GetMyMutableContextFromRoot(context_.get());
+    x0_ = plant_->GetPositionsAndVelocities(*plant_context_);
+    updates_ = plant_->AllocateDiscreteVariables();
+  }
+
+ protected:
+  // Computes the next discrete state from the settled state. Setting the state
+  // invalidates all of the plant's state-dependent computations.
+  void Step() {
+    plant_->SetPositionsAndVelocities(plant_context_, x0_);
+    plant_->CalcDiscreteVariableUpdates(*plant_context_, updates_.get());
+  }
+
+  // Runs kProfiledSteps more steps with the Profiler enabled and reports the
+  // average time per step, in microseconds, of:
+  // - geometry: the queries of the proximity engine;
+  // - jacobians: the contact Jacobians, excluding the queries;
+  // - solver: forming and solving the contact problem, excluding the above;
+  // - other: the rest of the step, e.g., the kinematics and the dynamics.
+  void ReportPhases(benchmark::State& state) {
+    Profiler& profiler = Profiler::Global();
+    profiler.Reset();
+    profiler.set_enabled(true);
+    for (int i = 0; i < kProfiledSteps; ++i) {
+      ScopedProfileTimer timer("step");
+      Step();
+    }
+    profiler.set_enabled(false);
+
+    double total = 0;
+    double geometry = 0;
+    double jacobians = 0;
+    double solver = 0;
+    const auto ends_with = [](const std::string& label, const char* suffix) {
+      const std::string quoted = std::string("'") + suffix + "'";
+      return label.size() >= quoted.size() &&
+             label.compare(label.size() - quoted.size(), quoted.size(),
+                           quoted) == 0;
+    };
+    for (const ProfileStatistics& statistics : profiler.GetStatistics()) {
+      const std::string& label = statistics.path.back();
+      if (statistics.path.size() == 1) {
+        total += statistics.total_seconds;
+      } else if (label.rfind("ProximityEngine::", 0) == 0) {
+        geometry += statistics.total_seconds;
+      } else if (ends_with(label,
+                           "Contact Jacobians Jn(q), Jt(q), Jc(q) and frames "
+                           "R_WC.")) {
+        jacobians += statistics.self_seconds;
+      } else if (ends_with(label, "Implicit Stribeck solver computations.")) {
+        solver += statistics.self_seconds;
+      }
+    }
+    profiler.Reset();
+
+    const double to_microseconds_per_step = 1e6 / kProfiledSteps;
+    state.counters["geometry_us"] = geometry * to_microseconds_per_step;
+    state.counters["jacobians_us"] = jacobians * to_microseconds_per_step;
+    state.counters["solver_us"] = solver * to_microseconds_per_step;
+    state.counters["other_us"] =
+        (total - geometry - jacobians - solver) * to_microseconds_per_step;
+  }
+
+  // Registers a ground half space, at z = 0, with point contact properties.
+  void AddGround() {
+    plant_->RegisterCollisionGeometry(plant_->world_body(), RigidTransformd(),
+                                      HalfSpace(), "ground", kFriction);
+  }
+
+  // 100 objects, alternating boxes and spheres of about 5 cm, dropped on a
+  // grid into a 50 cm square bin.
+  void AddClutterBin() {
+    AddGround();
+    const double kWallHeight = 0.2;
+    for (int i = 0; i < 4; ++i) {
+      const double sign = (i % 2 == 0) ? 1.0 : -1.0;
+      const bool along_x = i < 2;
+      const Vector3d p_WF(along_x ? sign * 0.26 : 0.0,
+                          along_x ? 0.0 : sign * 0.26, kWallHeight / 2);
+      plant_->RegisterCollisionGeometry(
+          plant_->world_body(), RigidTransformd(p_WF),
+          Box(along_x ? 0.02 : 0.54, along_x ? 0.54 : 0.02, kWallHeight),
+          "wall" + std::to_string(i), kFriction);
+    }
+
+    const ModelInstanceIndex instance = plant_->AddModelInstance("clutter");
+    const double kMass = 0.1;
+    const double kSize = 0.05;
+    for (int i = 0; i < 100; ++i) {
+      const std::string name = "object" + std::to_string(i);
+      const bool is_box = (i % 2 == 0);
+      const RigidBody<double>& body = plant_->AddRigidBody(
+          name, instance,
+          SpatialInertia<double>::MakeFromCentralInertia(
+              kMass, Vector3d::Zero(),
+              kMass * (is_box ? UnitInertia<double>::SolidBox(kSize, kSize,
+                                                              kSize)
+                              : UnitInertia<double>::SolidSphere(kSize / 2))));
+      if (is_box) {
+        plant_->RegisterCollisionGeometry(body, RigidTransformd(),
+                                          Box(kSize, kSize, kSize), name,
+                                          kFriction);
+      } else {
+        plant_->RegisterCollisionGeometry(body, RigidTransformd(),
+                                          Sphere(kSize / 2), name, kFriction);
+      }
+      // A 5 x 5 grid, 4 layers high, with the layers slightly rotated so that
+      // the objects tumble as they land.
+      const int layer = i / 25;
+      const Vector3d p_WB(0.09 * (i % 5 - 2), 0.09 * (i / 5 % 5 - 2),
+                          0.05 + 0.08 * layer);
+      initial_poses_.emplace_back(
+          &body, RigidTransformd(RollPitchYawd(0.3 * layer, 0.2 * layer, 0),
+                                 p_WB));
+    }
+  }
+
+  // Two iiwa arms reaching down, with their grippers open, over a table
+  // (the ground) with 10 boxes between them.
+  void AddDualIiwaStation() {
+    AddGround();
+    Parser parser(plant_);
+    const std::string iiwa_file = FindResourceOrThrow(
+        "drake/manipulation/models/iiwa_description/sdf/"
+        "iiwa14_polytope_collision.sdf");
+    const std::string wsg_file = FindResourceOrThrow(
+        "drake/manipulation/models/wsg_50_description/sdf/"
+        "schunk_wsg_50_with_tip.sdf");
+    const std::vector<double> iiwa_angles{0.0, 0.6, 0.0, -1.75, 0.0, 1.0, 0.0};
+    for (int i = 0; i < 2; ++i) {
+      const double sign = (i == 0) ? 1.0 : -1.0;
+      const ModelInstanceIndex iiwa =
+          parser.AddModelFromFile(iiwa_file, "iiwa" + std::to_string(i));
+      const ModelInstanceIndex wsg =
+          parser.AddModelFromFile(wsg_file, "wsg" + std::to_string(i));
+      plant_->WeldFrames(
+          plant_->world_frame(), plant_->GetFrameByName("iiwa_link_0", iiwa),
+          RigidTransformd(RollPitchYawd(0, 0, sign > 0 ? 0 : M_PI),
+                          Vector3d(-sign * 0.6, 0, 0)));
+      plant_->WeldFrames(
+          plant_->GetFrameByName("iiwa_link_7", iiwa),
+          plant_->GetFrameByName("body", wsg),
+          RigidTransformd(RollPitchYawd(M_PI_2, 0, M_PI_2),
+                          Vector3d(0, 0, 0.114)));
+      for (int j = 0; j < 7; ++j) {
+        initial_angles_.emplace_back(
+            &plant_->GetJointByName<RevoluteJoint>(
+                "iiwa_joint_" + std::to_string(j + 1), iiwa),
+            iiwa_angles[j]);
+      }
+    }
+
+    const ModelInstanceIndex instance = plant_->AddModelInstance("boxes");
+    const double kMass = 0.2;
+    const Vector3d size(0.06, 0.04, 0.08);
+    for (int i = 0; i < 10; ++i) {
+      const std::string name = "box" + std::to_string(i);
+      const RigidBody<double>& body = plant_->AddRigidBody(
+          name, instance,
+          SpatialInertia<double>::MakeFromCentralInertia(
+              kMass, Vector3d::Zero(),
+              kMass * UnitInertia<double>::SolidBox(size.x(), size.y(),
+                                                    size.z())));
+      plant_->RegisterCollisionGeometry(body, RigidTransformd(),
+                                        Box(size.x(), size.y(), size.z()),
+                                        name, kFriction);
+      const Vector3d p_WB(0.1 * (i % 5 - 2), 0.1 * (i / 5) - 0.05,
+                          size.z() / 2);
+      initial_poses_.emplace_back(&body,
+                                  RigidTransformd(RollPitchYawd(0, 0, 0.3 * i),
+                                                  p_WB));
+    }
+  }
+
+  // An Allegro hand, with rigid hydroelastic geometry, facing up and holding
+  // a compliant sphere and a compliant box in its palm.
+  void AddAllegroHand() {
+    plant_->set_contact_model(ContactModel::kHydroelasticWithFallback);
+    Parser parser(plant_);
+    const ModelInstanceIndex hand = parser.AddModelFromFile(FindResourceOrThrow(
+        "drake/manipulation/models/allegro_hand_description/sdf/"
+        "allegro_hand_description_right.sdf"));
+    // The palm faces the hand's +x axis and the fingers point along its +z
+    // axis; this faces the palm up, with the fingers along the world's -x.
+    plant_->WeldFrames(plant_->world_frame(),
+                       plant_->GetFrameByName("hand_root", hand),
+                       RigidTransformd(RollPitchYawd(0, -M_PI_2, 0),
+                                       Vector3d::Zero()));
+    for (const BodyIndex& index : plant_->GetBodyIndices(hand)) {
+      for (const geometry::GeometryId id :
+           plant_->GetCollisionGeometriesForBody(plant_->get_body(index))) {
+        ProximityProperties properties(
+            *scene_graph_->model_inspector().GetProximityProperties(id));
+        geometry::AddRigidHydroelasticProperties(0.005, &properties);
+        scene_graph_->AssignRole(*plant_->get_source_id(), id, properties,
+                                 geometry::RoleAssign::kReplace);
+      }
+    }
+
+    const ModelInstanceIndex instance = plant_->AddModelInstance("objects");
+    const double kMass = 0.05;
+    const double kRadius = 0.025;
+    const RigidBody<double>& sphere = plant_->AddRigidBody(
+        "sphere", instance,
+        SpatialInertia<double>::MakeFromCentralInertia(
+            kMass, Vector3d::Zero(),
+            kMass * UnitInertia<double>::SolidSphere(kRadius)));
+    plant_->RegisterCollisionGeometry(sphere, RigidTransformd(),
+                                      Sphere(kRadius), "sphere",
+                                      MakeCompliantProperties(0.01));
+    initial_poses_.emplace_back(
+        &sphere, RigidTransformd(Vector3d(-0.05, 0.0, 0.06)));
+
+    const double kSize = 0.04;
+    const RigidBody<double>& box = plant_->AddRigidBody(
+        "box", instance,
+        SpatialInertia<double>::MakeFromCentralInertia(
+            kMass, Vector3d::Zero(),
+            kMass * UnitInertia<double>::SolidBox(kSize, kSize, kSize)));
+    plant_->RegisterCollisionGeometry(box, RigidTransformd(),
+                                      Box(kSize, kSize, kSize), "box",
+                                      MakeCompliantProperties(0.01));
+    initial_poses_.emplace_back(
+        &box, RigidTransformd(RollPitchYawd(0.2, 0.1, 0),
+                              Vector3d(-0.1, 0.0, 0.07)));
+  }
+
+  MultibodyPlant<double>* plant_{};
+  SceneGraph<double>* scene_graph_{};
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> context_;
+  Context<double>* plant_context_{};
+  std::unique_ptr<DiscreteValues<double>> updates_;
+  VectorXd x0_;
+  std::vector<std::pair<const Body<double>*, RigidTransformd>> initial_poses_;
+  std::vector<std::pair<const RevoluteJoint<double>*, double>> initial_angles_;
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(ContactStepFixture, Tamsi)(benchmark::State& state) {
+  for (auto _ : state) {
+    Step();
+  }
+  ReportPhases(state);
+}
+BENCHMARK_REGISTER_F(ContactStepFixture, Tamsi)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(2);
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
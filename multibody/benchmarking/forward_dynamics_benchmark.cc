@@ -0,0 +1,122 @@
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+using systems::Context;
+
+/* Compares the two ways of evaluating the continuous forward dynamics
+ v̇ = M(q)⁻¹(τ - C(q, v)v) of a MultibodyPlant:
+
+ - Aba: MultibodyPlant::CalcTimeDerivatives(), which uses the O(n) Articulated
+   Body Algorithm.
+ - MassMatrix: forms the dense mass matrix with the Composite Body Algorithm
+   and solves with its LDLT factorization, which is O(n³).
+
+ The benchmarks take a single argument selecting the model:
+ - 0: the KUKA iiwa arm welded to the world (7 dofs).
+ - 1: the Atlas humanoid with a floating base (36 dofs).
+
+ Both models are free of contact and constraints; the only applied forces are
+ gravity and zero actuation (so that both paths solve the same equations). */
+class ForwardDynamicsFixture : public benchmark::Fixture {
+ public:
+  ForwardDynamicsFixture() { tools::performance::AddMinMaxStatistics(this); }
+
+  // This apparently futile using statement works around "overloaded virtual"
+  // errors in g++. All of this is a consequence of the weird deprecation of
+  // const-ref State versions of SetUp() and TearDown() in benchmark.h.
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    plant_ = std::make_unique<MultibodyPlant<double>>(0.0);
+    Parser parser(plant_.get());
+    if (state.range(0) == 0) {
+      parser.AddModelFromFile(FindResourceOrThrow(
+          "drake/manipulation/models/iiwa_description/sdf/"
+          "iiwa14_no_collision.sdf"));
+      plant_->WeldFrames(plant_->world_frame(),
+                         plant_->GetFrameByName("iiwa_link_0"));
+    } else {
+      parser.AddModelFromFile(FindResourceOrThrow(
+          "drake/examples/atlas/urdf/atlas_convex_hull.urdf"));
+    }
+    plant_->Finalize();
+    state.SetLabel(state.range(0) == 0 ? "iiwa" : "atlas");
+
+    context_ = plant_->CreateDefaultContext();
+    plant_->get_actuation_input_port().FixValue(
+        context_.get(), VectorXd::Zero(plant_->num_actuators()));
+
+    // An arbitrary state, away from any singular configuration. The floating
+    // base of Atlas, if any, is left at its default pose.
+    for (JointIndex i(0); i < plant_->num_joints(); ++i) {
+      const auto* revolute =
+          dynamic_cast<const RevoluteJoint<double>*>(&plant_->get_joint(i));
+      if (revolute != nullptr) {
+        revolute->set_angle(context_.get(), 0.1 * (i % 7) - 0.3);
+      }
+    }
+    const int nv = plant_->num_velocities();
+    plant_->SetVelocities(context_.get(), VectorXd::LinSpaced(nv, -1.0, 1.0));
+  }
+
+ protected:
+  // Invalidates the state-dependent computations within each benchmarked
+  // step, without disabling the cache that both paths rely on internally.
+  void InvalidateState() { context_->NoteContinuousStateChange(); }
+
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(ForwardDynamicsFixture, Aba)(benchmark::State& state) {
+  auto derivatives = plant_->AllocateTimeDerivatives();
+  for (auto _ : state) {
+    InvalidateState();
+    plant_->CalcTimeDerivatives(*context_, derivatives.get());
+  }
+}
+BENCHMARK_REGISTER_F(ForwardDynamicsFixture, Aba)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(0)
+    ->Arg(1);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(ForwardDynamicsFixture, MassMatrix)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  const int nv = plant_->num_velocities();
+  MatrixXd M(nv, nv);
+  VectorXd Cv(nv);
+  VectorXd vdot(nv);
+  for (auto _ : state) {
+    InvalidateState();
+    plant_->CalcMassMatrix(*context_, &M);
+    plant_->CalcBiasTerm(*context_, &Cv);
+    const VectorXd tau = plant_->CalcGravityGeneralizedForces(*context_) - Cv;
+    vdot = M.ldlt().solve(tau);
+    benchmark::DoNotOptimize(vdot);
+  }
+}
+BENCHMARK_REGISTER_F(ForwardDynamicsFixture, MassMatrix)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(0)
+    ->Arg(1);
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -7,8 +7,11 @@
 #include <utility>
 #include <vector>
 
+#include <Eigen/SparseCore>
+
 #include "drake/common/text_logging.h"
 #include "drake/multibody/constraint/constraint_problem_data.h"
+#include "drake/multibody/contact_solvers/linear_operator.h"
 #include "drake/solvers/moby_lcp_solver.h"
 
 namespace drake {
@@ -68,9 +71,13 @@ namespace constraint {
 template <typename T>
 class ConstraintSolver {
  public:
-  ConstraintSolver() = default;
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ConstraintSolver)
 
+  /// Constructs the solver. Successive problems of the same size (as posed by
+  /// a time stepping scheme) are first attempted from the final basis of the
+  /// previous LCP solve; see MobyLCPSolver::SetWarmStartingEnabled().
+  ConstraintSolver() { lcp_.SetWarmStartingEnabled(true); }
+
   /// Structure used to convert a mixed linear complementarity problem to a
   /// pure linear complementarity problem (by solving for free variables).
   struct MlcpToLcpData {
@@ -382,6 +389,92 @@ class ConstraintSolver {
       VectorX<T>* cf);
   //@}
 
+  /// @name Structure-exploiting velocity-level constraint problems
+  /// SolveImpactProblem() forms the LCP matrix `MM` densely, applying the
+  /// inertia solve and the constraint Jacobian operators once per constraint;
+  /// its cost grows cubically with the number of constraints, which becomes
+  /// prohibitive for scenarios with many contacts, such as stacks and piles.
+  /// The methods below instead keep the constraint Jacobians and the inverse
+  /// of the generalized inertia matrix as (sparse)
+  /// contact_solvers::internal::LinearOperator objects, form the Delassus
+  /// matrix `W = JM⁻¹Jᵀ` (where `J` stacks N, F, and L) as a sparse matrix,
+  /// and solve the impact problem with an iterative method whose cost per
+  /// iteration is proportional to the number of nonzeros in `W`.
+  // @{
+
+  /// Structure-exploiting representations of the operators in a
+  /// ConstraintVelProblemData. The pointers are not owned and must remain
+  /// valid while in use.
+  struct SparseVelProblemOperators {
+    /// The ℝⁿᶜˣⁿᵛ Jacobian N of the contact normals, or null if nc = 0.
+    const contact_solvers::internal::LinearOperator<T>* N{nullptr};
+
+    /// The ℝⁿⁿʳˣⁿᵛ Jacobian F of the contact tangent spanning directions, or
+    /// null if nnr = 0.
+    const contact_solvers::internal::LinearOperator<T>* F{nullptr};
+
+    /// The ℝⁿᵘˣⁿᵛ Jacobian L of the generic unilateral constraints, or null
+    /// if nu = 0.
+    const contact_solvers::internal::LinearOperator<T>* L{nullptr};
+
+    /// The inverse M⁻¹ of the ℝⁿᵛˣⁿᵛ generalized inertia matrix. Products with
+    /// sparse vectors should preserve sparsity (e.g., for block diagonal M⁻¹)
+    /// for FormSparseDelassusMatrix() to be efficient.
+    const contact_solvers::internal::LinearOperator<T>* inverse_inertia{
+        nullptr};
+  };
+
+  /// Parameters of SolveImpactProblemIteratively().
+  struct IterativeSolverParameters {
+    /// The maximum number of sweeps over the constraints.
+    int max_iterations{100};
+
+    /// The iteration stops once no constraint force changes by more than
+    /// this tolerance times the largest constraint force magnitude (or one,
+    /// if larger).
+    double relative_tolerance{1e-6};
+  };
+
+  /// Forms the Delassus matrix `W = JM⁻¹Jᵀ + Γ` of the impact problem, where
+  /// `J = [N; F; L]` and `Γ = diag(γᴺ, γᶠ, γᴸ)` (see
+  /// ConstraintVelProblemData). The Jacobian operators must support
+  /// AssembleMatrix() into an Eigen::SparseMatrix; `M⁻¹` is applied to one
+  /// sparse column of `Jᵀ` at a time.
+  /// @throws std::exception if `W` is null, if a required operator is null,
+  ///         or if the operator dimensions are inconsistent with
+  ///         `problem_data`.
+  static void FormSparseDelassusMatrix(
+      const ConstraintVelProblemData<T>& problem_data,
+      const SparseVelProblemOperators& operators,
+      Eigen::SparseMatrix<T>* W);
+
+  /// Solves the impact problem described by `problem_data` and `operators`
+  /// using projected Gauss-Seidel iterations on the sparse Delassus matrix
+  /// formed by FormSparseDelassusMatrix(). Normal and unilateral constraint
+  /// impulses are projected onto the nonnegative reals, and the frictional
+  /// impulses at each contact are projected onto the polygonal friction cone
+  /// |fᶠ|₁ ≤ μfᴺ of the LCP formulation. For frictionless or sticking
+  /// problems with a unique solution, the result agrees with
+  /// SolveImpactProblem() to within the iteration tolerance; the operators
+  /// of `problem_data` (N_mult, solve_inertia, etc.) are not used.
+  /// @param problem_data the constraint problem data; only the vectors (and
+  ///        `r`) are used.
+  /// @param operators the Jacobian and inverse inertia operators.
+  /// @param parameters the iteration parameters.
+  /// @param[out] cf the constraint impulses on return, in the packed storage
+  ///        format described in SolveImpactProblem(). If the iteration does
+  ///        not converge, `cf` holds the last iterate.
+  /// @returns `true` if the iteration converged.
+  /// @throws std::exception if `cf` is null, if `problem_data` contains
+  ///         bilateral constraints (which are not supported), or under the
+  ///         conditions described in FormSparseDelassusMatrix().
+  static bool SolveImpactProblemIteratively(
+      const ConstraintVelProblemData<T>& problem_data,
+      const SparseVelProblemOperators& operators,
+      const IterativeSolverParameters& parameters,
+      VectorX<T>* cf);
+  //@}
+
   /// Solves the appropriate constraint problem at the acceleration level.
   /// @param problem_data The data used to compute the constraint forces.
   /// @param cf The computed constraint forces, on return, in a packed storage
@@ -1359,6 +1452,192 @@ void ConstraintSolver<T>::SolveImpactProblem(
       problem_data, mlcp_to_lcp_data, zz, a, cf);
 }
 
+template <typename T>
+void ConstraintSolver<T>::FormSparseDelassusMatrix(
+    const ConstraintVelProblemData<T>& problem_data,
+    const SparseVelProblemOperators& operators,
+    Eigen::SparseMatrix<T>* W) {
+  using contact_solvers::internal::LinearOperator;
+
+  if (!W)
+    throw std::logic_error("W (output parameter) is null.");
+  if (!operators.inverse_inertia)
+    throw std::logic_error("The inverse inertia operator is null.");
+
+  const int num_contacts = problem_data.mu.size();
+  const int num_spanning_vectors = std::accumulate(problem_data.r.begin(),
+                                                   problem_data.r.end(), 0);
+  const int num_limits = problem_data.kL.size();
+  const int num_constraints = num_contacts + num_spanning_vectors + num_limits;
+  const int ngv = operators.inverse_inertia->rows();
+  if (operators.inverse_inertia->cols() != ngv)
+    throw std::logic_error("The inverse inertia operator is not square.");
+
+  // Assemble J = [N; F; L] from triplets.
+  std::vector<Eigen::Triplet<T>> triplets;
+  Eigen::SparseMatrix<T> block;
+  auto append_jacobian = [&](const LinearOperator<T>* op, int num_rows,
+                             int row_offset, const char* name) {
+    if (num_rows == 0) return;
+    if (!op || op->rows() != num_rows || op->cols() != ngv) {
+      throw std::logic_error(fmt::format(
+          "The {} operator is missing or is not {}x{}.", name, num_rows, ngv));
+    }
+    block.resize(num_rows, ngv);
+    op->AssembleMatrix(&block);
+    for (int k = 0; k < block.outerSize(); ++k) {
+      for (typename Eigen::SparseMatrix<T>::InnerIterator it(block, k); it;
+           ++it) {
+        triplets.emplace_back(row_offset + it.row(), it.col(), it.value());
+      }
+    }
+  };
+  append_jacobian(operators.N, num_contacts, 0, "N");
+  append_jacobian(operators.F, num_spanning_vectors, num_contacts, "F");
+  append_jacobian(operators.L, num_limits,
+                  num_contacts + num_spanning_vectors, "L");
+  Eigen::SparseMatrix<T> J(num_constraints, ngv);
+  J.setFromTriplets(triplets.begin(), triplets.end());
+
+  // Compute M⁻¹Jᵀ one sparse column at a time.
+  const Eigen::SparseMatrix<T> JT = J.transpose();
+  triplets.clear();
+  Eigen::SparseVector<T> JT_col(ngv);
+  Eigen::SparseVector<T> iM_JT_col(ngv);
+  for (int j = 0; j < num_constraints; ++j) {
+    JT_col = JT.col(j);
+    iM_JT_col.setZero();
+    operators.inverse_inertia->Multiply(JT_col, &iM_JT_col);
+    for (typename Eigen::SparseVector<T>::InnerIterator it(iM_JT_col); it;
+         ++it) {
+      triplets.emplace_back(it.index(), j, it.value());
+    }
+  }
+  Eigen::SparseMatrix<T> iM_JT(ngv, num_constraints);
+  iM_JT.setFromTriplets(triplets.begin(), triplets.end());
+
+  // Form W = JM⁻¹Jᵀ + Γ.
+  if (problem_data.gammaN.size() != num_contacts ||
+      problem_data.gammaF.size() != num_spanning_vectors ||
+      problem_data.gammaL.size() != num_limits) {
+    throw std::logic_error("gammaN, gammaF, or gammaL is incorrectly sized.");
+  }
+  *W = J * iM_JT;
+  VectorX<T> gamma(num_constraints);
+  gamma << problem_data.gammaN, problem_data.gammaF, problem_data.gammaL;
+  for (int i = 0; i < num_constraints; ++i) {
+    if (gamma[i] != 0) W->coeffRef(i, i) += gamma[i];
+  }
+  W->makeCompressed();
+}
+
+template <typename T>
+bool ConstraintSolver<T>::SolveImpactProblemIteratively(
+    const ConstraintVelProblemData<T>& problem_data,
+    const SparseVelProblemOperators& operators,
+    const IterativeSolverParameters& parameters,
+    VectorX<T>* cf) {
+  using std::abs;
+  using std::max;
+  using std::min;
+
+  if (!cf)
+    throw std::logic_error("cf (output parameter) is null.");
+  if (problem_data.kG.size() > 0) {
+    throw std::logic_error("SolveImpactProblemIteratively() does not support "
+                           "bilateral constraints.");
+  }
+
+  const int num_contacts = problem_data.mu.size();
+  if (static_cast<size_t>(num_contacts) != problem_data.r.size()) {
+    throw std::logic_error("Number of elements in 'r' does not match number"
+                               "of elements in 'mu'");
+  }
+  const int num_spanning_vectors = std::accumulate(problem_data.r.begin(),
+                                                   problem_data.r.end(), 0);
+  const int num_limits = problem_data.kL.size();
+  const int num_constraints = num_contacts + num_spanning_vectors + num_limits;
+  cf->setZero(num_constraints);
+  if (num_constraints == 0)
+    return true;
+
+  if (problem_data.kN.size() != num_contacts ||
+      problem_data.kF.size() != num_spanning_vectors) {
+    throw std::logic_error("kN or kF is incorrectly sized.");
+  }
+  Eigen::SparseMatrix<T> W;
+  FormSparseDelassusMatrix(problem_data, operators, &W);
+
+  // The constraint velocities after the impulses f are applied are Wf + c,
+  // where c = J M⁻¹ Mv + k.
+  const int ngv = operators.inverse_inertia->rows();
+  VectorX<T> v(ngv);
+  operators.inverse_inertia->Multiply(problem_data.Mv, &v);
+  VectorX<T> c(num_constraints), Jv;
+  int offset = 0;
+  auto append_velocity = [&](const contact_solvers::internal::LinearOperator<
+                                 T>* op,
+                             const VectorX<T>& k) {
+    if (k.size() == 0) return;
+    Jv.resize(k.size());
+    op->Multiply(v, &Jv);
+    c.segment(offset, k.size()) = Jv + k;
+    offset += k.size();
+  };
+  append_velocity(operators.N, problem_data.kN);
+  append_velocity(operators.F, problem_data.kF);
+  append_velocity(operators.L, problem_data.kL);
+
+  // Performs the Gauss-Seidel update of constraint i, without projection.
+  // Constraints with no effect on the velocities (W(i,i) = 0) get no force.
+  VectorX<T>& f = *cf;
+  const VectorX<T> W_diag = W.diagonal();
+  auto update = [&](int i) -> T {
+    if (W_diag[i] <= 0) return T(0);
+    T w_i = c[i];
+    for (typename Eigen::SparseMatrix<T>::InnerIterator it(W, i); it; ++it)
+      w_i += it.value() * f[it.row()];  // W is symmetric.
+    return f[i] - w_i / W_diag[i];
+  };
+
+  for (int iter = 0; iter < parameters.max_iterations; ++iter) {
+    T max_change = 0;
+    auto set = [&](int i, const T& value) {
+      max_change = max(max_change, abs(value - f[i]));
+      f[i] = value;
+    };
+
+    // Sweep over the contacts, updating the normal impulse and then the
+    // frictional impulses, which are projected onto the friction cone.
+    int friction_index = num_contacts;
+    for (int i = 0; i < num_contacts; ++i) {
+      set(i, max(T(0), update(i)));
+      const T limit = problem_data.mu[i] * f[i];
+      const int r = problem_data.r[i];
+      T l1_norm = 0;
+      for (int k = friction_index; k < friction_index + r; ++k) {
+        set(k, max(-limit, min(limit, update(k))));
+        l1_norm += abs(f[k]);
+      }
+      if (l1_norm > limit) {
+        const T scale = limit / l1_norm;
+        for (int k = friction_index; k < friction_index + r; ++k)
+          set(k, f[k] * scale);
+      }
+      friction_index += r;
+    }
+
+    // Sweep over the generic unilateral constraints.
+    for (int i = num_contacts + num_spanning_vectors; i < num_constraints; ++i)
+      set(i, max(T(0), update(i)));
+
+    const T scale = max(T(1), f.template lpNorm<Eigen::Infinity>());
+    if (max_change <= parameters.relative_tolerance * scale)
+      return true;
+  }
+  return false;
+}
+
 template <typename T>
 void ConstraintSolver<T>::ConstructLinearEquationSolversForMlcp(
     const ConstraintVelProblemData<T>& problem_data,
@@ -6,7 +6,9 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/examples/rod2d/rod2d.h"
+#include "drake/multibody/contact_solvers/sparse_linear_operator.h"
 #include "drake/solvers/unrevised_lemke_solver.h"
 
 using drake::systems::ContinuousState;
@@ -2852,6 +2854,154 @@ TEST_F(Constraint2DSolverTest, BilateralOnly) {
               eps_ * cf.size());
 }
 
+// A vertical stack of planar particles, each with velocity (ẋ, ẏ), falling
+// onto the ground. Contact i is between particle i and the particle below it
+// (or the ground, for i = 0); its normal and tangent directions are y and x.
+// The impact problem is posed both with dense std::function operators (for
+// SolveImpactProblem()) and with sparse operators (for
+// SolveImpactProblemIteratively()).
+class ParticleStackImpactTest : public ::testing::Test {
+ protected:
+  using SparseLinearOperator =
+      contact_solvers::internal::SparseLinearOperator<double>;
+
+  void MakeProblem(int num_particles, double mu) {
+    const int nv = 2 * num_particles;
+    const int nc = num_particles;
+    Eigen::MatrixXd N = Eigen::MatrixXd::Zero(nc, nv);
+    Eigen::MatrixXd F = Eigen::MatrixXd::Zero(nc, nv);
+    Eigen::VectorXd mass(num_particles), v(nv);
+    for (int i = 0; i < num_particles; ++i) {
+      N(i, 2 * i + 1) = 1;
+      F(i, 2 * i) = 1;
+      if (i > 0) {
+        N(i, 2 * i - 1) = -1;
+        F(i, 2 * i - 2) = -1;
+      }
+      mass[i] = 1.0 + 0.5 * i;
+      v.segment<2>(2 * i) << 0.4 * std::cos(i), -1.0;
+    }
+    Eigen::VectorXd M_diag(nv);
+    for (int i = 0; i < nv; ++i) M_diag[i] = mass[i / 2];
+
+    N_ = N.sparseView();
+    F_ = F.sparseView();
+    iM_ = Eigen::MatrixXd(M_diag.cwiseInverse().asDiagonal()).sparseView();
+    N_op_ = std::make_unique<SparseLinearOperator>("N", &N_);
+    F_op_ = std::make_unique<SparseLinearOperator>("F", &F_);
+    iM_op_ = std::make_unique<SparseLinearOperator>("Minv", &iM_);
+    operators_.N = N_op_.get();
+    operators_.F = F_op_.get();
+    operators_.inverse_inertia = iM_op_.get();
+
+    data_ = std::make_unique<ConstraintVelProblemData<double>>(nv);
+    data_->mu.setConstant(nc, mu);
+    data_->r.assign(nc, 1);
+    data_->N_mult = [N](const VectorX<double>& x) -> VectorX<double> {
+      return N * x;
+    };
+    data_->N_transpose_mult = [N](const VectorX<double>& x) -> VectorX<double> {
+      return N.transpose() * x;
+    };
+    data_->F_mult = [F](const VectorX<double>& x) -> VectorX<double> {
+      return F * x;
+    };
+    data_->F_transpose_mult = [F](const VectorX<double>& x) -> VectorX<double> {
+      return F.transpose() * x;
+    };
+    data_->solve_inertia = [M_diag](const MatrixX<double>& B) {
+      return MatrixX<double>(M_diag.cwiseInverse().asDiagonal() * B);
+    };
+    data_->kN.setZero(nc);
+    data_->kF.setZero(nc);
+    data_->gammaN.setZero(nc);
+    data_->gammaF.setZero(nc);
+    data_->gammaE.setZero(nc);
+    data_->Mv = M_diag.asDiagonal() * v;
+    v_ = v;
+    N_dense_ = N;
+    F_dense_ = F;
+    M_diag_ = M_diag;
+  }
+
+  ConstraintSolver<double> solver_;
+  std::unique_ptr<ConstraintVelProblemData<double>> data_;
+  ConstraintSolver<double>::SparseVelProblemOperators operators_;
+  Eigen::SparseMatrix<double> N_, F_, iM_;
+  std::unique_ptr<SparseLinearOperator> N_op_, F_op_, iM_op_;
+  Eigen::VectorXd v_, M_diag_;
+  Eigen::MatrixXd N_dense_, F_dense_;
+};
+
+TEST_F(ParticleStackImpactTest, DelassusMatrix) {
+  MakeProblem(4, 1.0);
+  data_->gammaN.setConstant(1e-3);
+  Eigen::SparseMatrix<double> W;
+  ConstraintSolver<double>::FormSparseDelassusMatrix(*data_, operators_, &W);
+
+  Eigen::MatrixXd J(8, 8);
+  J << N_dense_, F_dense_;
+  Eigen::MatrixXd expected =
+      J * M_diag_.cwiseInverse().asDiagonal() * J.transpose();
+  expected.diagonal().head(4).array() += 1e-3;
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(W), expected, 1e-14));
+
+  // Contacts only couple with their neighbors in the stack.
+  EXPECT_EQ(W.nonZeros(), 2 * (4 + 2 * 3));
+
+  operators_.inverse_inertia = nullptr;
+  EXPECT_THROW(ConstraintSolver<double>::FormSparseDelassusMatrix(
+                   *data_, operators_, &W),
+               std::logic_error);
+}
+
+// With ample friction, the stack stops (sticks) on impact, and the solution
+// is unique; both solvers must find it.
+TEST_F(ParticleStackImpactTest, SticksLikeLcpSolution) {
+  MakeProblem(4, 1.0);
+  VectorX<double> cf_lcp, cf_iterative;
+  solver_.SolveImpactProblem(*data_, &cf_lcp);
+  ConstraintSolver<double>::IterativeSolverParameters parameters;
+  parameters.max_iterations = 1000;
+  parameters.relative_tolerance = 1e-12;
+  EXPECT_TRUE(ConstraintSolver<double>::SolveImpactProblemIteratively(
+      *data_, operators_, parameters, &cf_iterative));
+  EXPECT_TRUE(CompareMatrices(cf_iterative, cf_lcp, 1e-8));
+
+  VectorX<double> dv;
+  ConstraintSolver<double>::ComputeGeneralizedVelocityChange(
+      *data_, cf_iterative, &dv);
+  EXPECT_TRUE(CompareMatrices(v_ + dv, VectorX<double>::Zero(8), 1e-8));
+}
+
+// A single particle impacting with too little friction to stop sliding.
+TEST_F(ParticleStackImpactTest, Slides) {
+  MakeProblem(1, 0.1);
+  VectorX<double> cf;
+  EXPECT_TRUE(ConstraintSolver<double>::SolveImpactProblemIteratively(
+      *data_, operators_, {}, &cf));
+  ASSERT_EQ(cf.size(), 2);
+  EXPECT_NEAR(cf[0], 1.0, 1e-12);
+  EXPECT_NEAR(cf[1], -0.1, 1e-12);
+
+  VectorX<double> cf_lcp;
+  solver_.SolveImpactProblem(*data_, &cf_lcp);
+  EXPECT_TRUE(CompareMatrices(cf, cf_lcp, 1e-8));
+
+  // Too few iterations to converge.
+  MakeProblem(8, 1.0);
+  ConstraintSolver<double>::IterativeSolverParameters parameters;
+  parameters.max_iterations = 1;
+  EXPECT_FALSE(ConstraintSolver<double>::SolveImpactProblemIteratively(
+      *data_, operators_, parameters, &cf));
+  EXPECT_EQ(cf.size(), 16);
+
+  data_->kG.resize(1);
+  EXPECT_THROW(ConstraintSolver<double>::SolveImpactProblemIteratively(
+                   *data_, operators_, parameters, &cf),
+               std::logic_error);
+}
+
 }  // namespace
 }  // namespace constraint
 }  // namespace multibody
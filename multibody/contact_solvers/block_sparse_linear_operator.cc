@@ -2,8 +2,6 @@
 
 #include <vector>
 
-#include "drake/common/unused.h"
-
 namespace drake {
 namespace multibody {
 namespace contact_solvers {
@@ -55,14 +53,16 @@ void BlockSparseLinearOperator<T>::DoAssembleMatrix(
     Eigen::SparseMatrix<T>* A_sparse) const {
   // Count number of non-zeros.
   int num_nonzeros = 0;
-  for (const auto& [ib, jb, B] : A_->get_blocks()) {
-    unused(ib, jb);
-    num_nonzeros += B.size();
+  for (int b = 0; b < A_->num_blocks(); ++b) {
+    num_nonzeros += A_->get_block(b).size();
   }
   std::vector<Eigen::Triplet<T>> non_zeros;
   non_zeros.reserve(num_nonzeros);
 
-  for (const auto& [ib, jb, B] : A_->get_blocks()) {
+  for (int b = 0; b < A_->num_blocks(); ++b) {
+    const int ib = A_->block_row_index(b);
+    const int jb = A_->block_col_index(b);
+    const auto B = A_->get_block(b);
     for (int n = 0; n < B.cols(); ++n) {
       const int j = A_->col_start(jb) + n;
       for (int m = 0; m < B.rows(); ++m) {
@@ -1,23 +1,43 @@
 #include "drake/multibody/contact_solvers/block_sparse_matrix.h"
 
-#include <tuple>
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
-#include "drake/common/unused.h"
 
 namespace drake {
 namespace multibody {
 namespace contact_solvers {
 namespace internal {
+namespace {
+
+// Calls kernel(B) with B a read-only view of the rows x cols block stored at
+// `data`. The 3x6 and 3x7 blocks, which are those of contact Jacobians with
+// respect to a free body or a seven-dof arm, are viewed with fixed sizes so
+// that their products with vectors are fully unrolled.
+template <typename T, typename Kernel>
+void VisitBlock(const T* data, int rows, int cols, Kernel&& kernel) {
+  if (rows == 3 && cols == 6) {
+    kernel(Eigen::Map<const Eigen::Matrix<T, 3, 6>>(data));
+  } else if (rows == 3 && cols == 7) {
+    kernel(Eigen::Map<const Eigen::Matrix<T, 3, 7>>(data));
+  } else {
+    kernel(Eigen::Map<const MatrixX<T>>(data, rows, cols));
+  }
+}
+
+}  // namespace
 
 template <typename T>
-BlockSparseMatrix<T>::BlockSparseMatrix(std::vector<BlockTriplet>&& blocks,
+BlockSparseMatrix<T>::BlockSparseMatrix(std::vector<Block>&& blocks,
+                                        std::vector<T>&& values,
                                         std::vector<int>&& block_row_size,
                                         std::vector<int>&& block_col_size)
     : blocks_(std::move(blocks)),
+      values_(std::move(values)),
       block_row_size_(std::move(block_row_size)),
       block_col_size_(std::move(block_col_size)) {
   row_start_.resize(block_row_size_.size(), 0);
@@ -43,12 +63,16 @@ void BlockSparseMatrix<T>::Multiply(const Eigen::Ref<const VectorX<T>>& x,
   DRAKE_DEMAND(y != nullptr);
   DRAKE_DEMAND(y->size() == rows());
   y->setZero();
-  for (const auto& [ib, jb, Bij] : blocks_) {
-    const auto xj = x.segment(col_start_[jb], block_col_size_[jb]);
-    auto yi = y->segment(row_start_[ib], block_row_size_[ib]);
-    // N.B. noalias() is necessary to remove Eigen's aliasing assumption and
-    // avoid evaluation into a temporary.
-    yi.noalias() += Bij * xj;
+  for (const auto& [ib, jb, start] : blocks_) {
+    const int rows = block_row_size_[ib];
+    const int cols = block_col_size_[jb];
+    const auto xj = x.segment(col_start_[jb], cols);
+    auto yi = y->segment(row_start_[ib], rows);
+    VisitBlock(values_.data() + start, rows, cols, [&](const auto& Bij) {
+      // N.B. noalias() is necessary to remove Eigen's aliasing assumption and
+      // avoid evaluation into a temporary.
+      yi.noalias() += Bij * xj;
+    });
   }
 }
 
@@ -59,12 +83,16 @@ void BlockSparseMatrix<T>::MultiplyByTranspose(
   DRAKE_DEMAND(y != nullptr);
   DRAKE_DEMAND(y->size() == cols());
   y->setZero();
-  for (const auto& [ib, jb, Bij] : blocks_) {
-    const auto xi = x.segment(row_start_[ib], block_row_size_[ib]);
-    auto yj = y->segment(col_start_[jb], block_col_size_[jb]);
-    // N.B. noalias() is necessary to remove Eigen's aliasing assumption and
-    // avoid evaluation into a temporary.
-    yj.noalias() += Bij.transpose() * xi;
+  for (const auto& [ib, jb, start] : blocks_) {
+    const int rows = block_row_size_[ib];
+    const int cols = block_col_size_[jb];
+    const auto xi = x.segment(row_start_[ib], rows);
+    auto yj = y->segment(col_start_[jb], cols);
+    VisitBlock(values_.data() + start, rows, cols, [&](const auto& Bij) {
+      // N.B. noalias() is necessary to remove Eigen's aliasing assumption and
+      // avoid evaluation into a temporary.
+      yj.noalias() += Bij.transpose() * xi;
+    });
   }
 }
 
@@ -72,20 +100,22 @@ template <typename T>
 MatrixX<T> BlockSparseMatrix<T>::MakeDenseMatrix() const {
   MatrixX<T> A(rows(), cols());
   A.setZero();
-  for (const auto& [ib, jb, Bij] : blocks_) {
+  for (int b = 0; b < num_blocks(); ++b) {
+    const int ib = blocks_[b].i;
+    const int jb = blocks_[b].j;
     const int is = row_start_[ib];
     const int rows = block_row_size_[ib];
     const int js = col_start_[jb];
     const int cols = block_col_size_[jb];
-    A.block(is, js, rows, cols) = Bij;
+    A.block(is, js, rows, cols) = get_block(b);
   }
   return A;
 }
 
 template <typename T>
-void BlockSparseMatrixBuilder<T>::PushBlock(int i, int j,
-                                            const MatrixX<T>& Bij) {
-  if (blocks_.size() == blocks_.capacity()) {
+void BlockSparseMatrixBuilder<T>::PushBlock(
+    int i, int j, const Eigen::Ref<const MatrixX<T>>& Bij) {
+  if (static_cast<int>(blocks_.size()) == nonzero_blocks_capacity_) {
     throw std::runtime_error(
         "Exceeded the maximum number of non-zero blocks capacity specified at "
         "construction.");
@@ -102,13 +132,21 @@ void BlockSparseMatrixBuilder<T>::PushBlock(int i, int j,
       DRAKE_THROW_UNLESS(Bij.cols() == block_col_size_[j]);
     }
     // Verify that the block was not already added.
-    const auto& [it, success] = index_pairs_.emplace(i, j);
-    unused(it);
-    if (!success) {
-      throw std::runtime_error(
-          fmt::format("Block ({}, {}) already added.", i, j));
+    for (int b = row_head_[i]; b >= 0; b = next_in_row_[b]) {
+      if (blocks_[b].j == j) {
+        throw std::runtime_error(
+            fmt::format("Block ({}, {}) already added.", i, j));
+      }
+    }
+    const int b = blocks_.size();
+    blocks_.push_back({i, j, static_cast<int>(values_.size())});
+    next_in_row_.push_back(row_head_[i]);
+    row_head_[i] = b;
+    // Bij might be a view with an outer stride; copy it one column at a time.
+    for (int c = 0; c < Bij.cols(); ++c) {
+      values_.insert(values_.end(), Bij.col(c).data(),
+                     Bij.col(c).data() + Bij.rows());
     }
-    blocks_.push_back({i, j, Bij});
     block_row_size_[i] = Bij.rows();
     block_col_size_[j] = Bij.cols();
   }
@@ -117,10 +155,57 @@ void BlockSparseMatrixBuilder<T>::PushBlock(int i, int j,
 template <typename T>
 BlockSparseMatrix<T> BlockSparseMatrixBuilder<T>::Build() {
   VerifyInvariants();
-  return BlockSparseMatrix<T>(std::move(blocks_), std::move(block_row_size_),
+  return BlockSparseMatrix<T>(std::move(blocks_), std::move(values_),
+                              std::move(block_row_size_),
                               std::move(block_col_size_));
 }
 
+template <typename T>
+void BlockSparseMatrixBuilder<T>::Build(BlockSparseMatrix<T>* matrix) {
+  DRAKE_DEMAND(matrix != nullptr);
+  VerifyInvariants();
+  if (HasSamePattern(*matrix)) {
+    // N.B. Copying rather than swapping the buffers keeps the address of each
+    // block's data, which users of the matrix may hold on to.
+    std::copy(values_.begin(), values_.end(), matrix->values_.begin());
+  } else {
+    *matrix = Build();
+  }
+}
+
+template <typename T>
+void BlockSparseMatrixBuilder<T>::Reset() {
+  // N.B. After Build(), the vectors are in a moved-from state; clear() and
+  // assign() make them valid again.
+  blocks_.clear();
+  blocks_.reserve(nonzero_blocks_capacity_);
+  next_in_row_.clear();
+  next_in_row_.reserve(nonzero_blocks_capacity_);
+  values_.clear();
+  // Negative size means "not yet specified".
+  block_row_size_.assign(block_rows_, -1);
+  block_col_size_.assign(block_cols_, -1);
+  row_head_.assign(block_rows_, -1);
+}
+
+template <typename T>
+bool BlockSparseMatrixBuilder<T>::HasSamePattern(
+    const BlockSparseMatrix<T>& matrix) const {
+  if (matrix.block_row_size_ != block_row_size_ ||
+      matrix.block_col_size_ != block_col_size_ ||
+      matrix.blocks_.size() != blocks_.size()) {
+    return false;
+  }
+  // With equal block sizes, equal block indices imply equal offsets.
+  for (size_t b = 0; b < blocks_.size(); ++b) {
+    if (matrix.blocks_[b].i != blocks_[b].i ||
+        matrix.blocks_[b].j != blocks_[b].j) {
+      return false;
+    }
+  }
+  return true;
+}
+
 template <typename T>
 void BlockSparseMatrixBuilder<T>::VerifyInvariants() const {
   // All row/column blocks must be specified in order to determine sizes. We
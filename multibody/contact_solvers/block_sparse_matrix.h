@@ -1,8 +1,5 @@
 #pragma once
 
-#include <tuple>
-#include <unordered_set>
-#include <utility>
 #include <vector>
 
 #include "drake/common/default_scalars.h"
@@ -24,6 +21,11 @@ class BlockSparseMatrixBuilder;
 // capable of exploiting highly optimized operations with dense blocks (e.g. via
 // AVX instructions).
 //
+// As in the BSR (Block Sparse Row) format, the values of all blocks are stored
+// in a single contiguous buffer, each block in column-major order, and the
+// blocks are described by their block row, block column and offset into that
+// buffer. Blocks are stored in the order they were added with the builder.
+//
 // Instances of this class are meant to be built with BlockSparseMatrixBuilder
 // to ensure the consistency of block entries provided by users.
 //
@@ -41,11 +43,6 @@ class BlockSparseMatrix {
  public:
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BlockSparseMatrix)
 
-  // A non-zero block entry is specified with the triplet {i, j, Bij}, where
-  // (i,j) are the i-th and j-th block row and column respectively and Bij is
-  // the dense block entry.
-  typedef std::tuple<int, int, MatrixX<T>> BlockTriplet;
-
   // Constructs a zero sized matrix.
   // While non-empty matrices must be built with BlockSparseMatrixBuilder to
   // obtain a valid data structure, empty matrices are always well formed and
@@ -69,13 +66,37 @@ class BlockSparseMatrix {
   // Access to the b-th block. b must be in the range 0 to num_blocks()-1.
   // Blocks are indexed in the order they were added using a builder via
   // BlockSparseMatrixBuilder::PushBlock().
-  const MatrixX<T>& get_block(int b) const {
-    DRAKE_DEMAND(b < num_blocks());
-    return std::get<2>(blocks_[b]);
+  Eigen::Map<const MatrixX<T>> get_block(int b) const {
+    DRAKE_DEMAND(0 <= b && b < num_blocks());
+    const Block& block = blocks_[b];
+    return Eigen::Map<const MatrixX<T>>(values_.data() + block.start,
+                                        block_row_size_[block.i],
+                                        block_col_size_[block.j]);
+  }
+
+  // Mutable access to the values of the b-th block, with b in the range 0 to
+  // num_blocks()-1. The sparsity structure of this matrix, including the size
+  // of each block, cannot be changed. This allows to update the values of a
+  // matrix in place, without the heap allocations of a new build.
+  Eigen::Map<MatrixX<T>> get_mutable_block(int b) {
+    DRAKE_DEMAND(0 <= b && b < num_blocks());
+    const Block& block = blocks_[b];
+    return Eigen::Map<MatrixX<T>>(values_.data() + block.start,
+                                  block_row_size_[block.i],
+                                  block_col_size_[block.j]);
   }
 
-  // Access to the vector of all triplets stored by this class.
-  const std::vector<BlockTriplet>& get_blocks() const { return blocks_; }
+  // The block row of the b-th block.
+  int block_row_index(int b) const {
+    DRAKE_DEMAND(0 <= b && b < num_blocks());
+    return blocks_[b].i;
+  }
+
+  // The block column of the b-th block.
+  int block_col_index(int b) const {
+    DRAKE_DEMAND(0 <= b && b < num_blocks());
+    return blocks_[b].j;
+  }
 
   // Size of the i-th block row.
   int block_row_size(int i) const {
@@ -118,27 +139,36 @@ class BlockSparseMatrix {
   // Builder needs access to private constructors.
   friend class BlockSparseMatrixBuilder<T>;
 
+  // The b-th block Aij has block row i, block column j, and its values start
+  // at values_[start].
+  struct Block {
+    int i{};
+    int j{};
+    int start{};
+  };
+
   // Constructs a BlockSparseMatrix from a known block-sparse structure.
   // block_row_size[i] stores the size of the i-th block row.
   // block_col_size[j] stores the size of the j-th block column.
-  // blocks[b] stores the b-th block triplet (i, j, Aij) where i <
-  // block_row_size.size() is the i-th block row, j < block_col_size.size() is
-  // the j-th block column and Aij is the block entry of size block_row_size[i]
-  // by block_col_size[j].
+  // blocks[b] describes the b-th block Aij, where i < block_row_size.size() is
+  // the i-th block row and j < block_col_size.size() is the j-th block column;
+  // its block_row_size[i] by block_col_size[j] values are stored in column
+  // major order in `values`, starting at blocks[b].start.
   // @warning this constructor does not verify the validity of the arguments,
   // only the friend class BlockSparseMatrixBuilder has access to it. That is,
   // it assumes that:
   // - There are no zero sized block rows or columns. That is, all entries in
   // block_row_size and block_col_size are strictly positive.
-  // - The block sizes in `blocks` are consistent with block_row_size and
-  // block_col_size.
-  BlockSparseMatrix(std::vector<BlockTriplet>&& blocks,
+  // - The block offsets in `blocks` are consistent with block_row_size,
+  // block_col_size and the size of `values`.
+  BlockSparseMatrix(std::vector<Block>&& blocks, std::vector<T>&& values,
                     std::vector<int>&& block_row_size,
                     std::vector<int>&& block_col_size);
 
-  int rows_{0};                       // total number of rows.
-  int cols_{0};                       // total number of columns.
-  std::vector<BlockTriplet> blocks_;  // All block triplets.
+  int rows_{0};                // total number of rows.
+  int cols_{0};                // total number of columns.
+  std::vector<Block> blocks_;  // Block indices and offsets.
+  std::vector<T> values_;      // Values of all blocks, back to back.
   // block_row_size_[i] stores the number of rows in the i-th block row.
   std::vector<int> block_row_size_;
   // block_col_size_[j] stores the number of columns in the j-th block column.
@@ -155,6 +185,12 @@ class BlockSparseMatrix {
 // It provides safe APIs to add blocks that verify proper invariants as blocks
 // are added. If successful, the resulting matrix obtained with the Build()
 // method is properly formed.
+//
+// A builder can be reused to rebuild a matrix whose values change while its
+// sparsity pattern stays the same, e.g. a contact Jacobian from one time step
+// to the next. After Reset(), the same blocks are pushed again, and
+// Build(BlockSparseMatrix<T>*) copies the new values over those of the matrix
+// built previously. Past the first build, this allocates no memory.
 // @tparam_nonsymbolic_scalar
 template <typename T>
 class BlockSparseMatrixBuilder {
@@ -178,16 +214,15 @@ class BlockSparseMatrixBuilder {
   // or an exception will be thrown.
   BlockSparseMatrixBuilder(int block_rows, int block_cols,
                            int nonzero_blocks_capacity)
-      : block_rows_(block_rows), block_cols_(block_cols) {
+      : block_rows_(block_rows),
+        block_cols_(block_cols),
+        nonzero_blocks_capacity_(nonzero_blocks_capacity) {
     DRAKE_DEMAND(block_rows >= 0);
     DRAKE_DEMAND(block_cols >= 0);
     DRAKE_DEMAND(nonzero_blocks_capacity >= 0);
     DRAKE_DEMAND(nonzero_blocks_capacity >= block_rows);
     DRAKE_DEMAND(nonzero_blocks_capacity >= block_cols);
-    blocks_.reserve(nonzero_blocks_capacity);
-    // Negative size means "not yet specified".
-    block_row_size_.resize(block_rows, -1);
-    block_col_size_.resize(block_cols, -1);
+    Reset();
   }
 
   // Adds dense block Bij to the block entry with indexes (i,j).
@@ -197,31 +232,48 @@ class BlockSparseMatrixBuilder {
   // added block to column j or an exception is thrown.
   // @note Blocks of size zero are ignored.
   // @throws if block (i,j) was already added.
-  void PushBlock(int i, int j, const MatrixX<T>& Bij);
+  void PushBlock(int i, int j, const Eigen::Ref<const MatrixX<T>>& Bij);
 
   // Makes a new BlockSparseMatrix.
   // If successful, the new BlockSparseMatrix is guaranteed to be properly
-  // formed. This builder is left in an invalid state. Do not reuse.
+  // formed. The builder must be Reset() before it is used again.
   BlockSparseMatrix<T> Build();
 
+  // Builds into `matrix`. If `matrix` already has the sparsity pattern of the
+  // blocks pushed to this builder (the same block sizes, and the same blocks
+  // in the same order), its values are updated in place: the data of each
+  // block keeps its address, and no memory is allocated. Otherwise, *matrix
+  // is replaced by the result of Build(). Either way, the builder must be
+  // Reset() before it is used again.
+  // @pre matrix is not nullptr.
+  void Build(BlockSparseMatrix<T>* matrix);
+
+  // Discards all pushed blocks, so that this builder can be used again to make
+  // a matrix with the same number of block rows and columns. The memory
+  // already allocated is kept.
+  void Reset();
+
  private:
+  using Block = typename BlockSparseMatrix<T>::Block;
+
   void VerifyInvariants() const;
 
+  // Returns true iff `matrix` has the sparsity pattern of the pushed blocks.
+  bool HasSamePattern(const BlockSparseMatrix<T>& matrix) const;
+
   int block_rows_{0};
   int block_cols_{0};
-  std::vector<typename BlockSparseMatrix<T>::BlockTriplet> blocks_;
+  int nonzero_blocks_capacity_{0};
+  std::vector<Block> blocks_;
+  std::vector<T> values_;
   std::vector<int> block_row_size_;
   std::vector<int> block_col_size_;
-  // We store all pairs (i,j) for block Bij as the users adds blocks. This is
-  // used to verify if a user already added a given block.
-  struct pair_hash {
-    std::size_t operator()(std::pair<int, int> const& pair) const {
-      std::size_t h1 = std::hash<int>()(pair.first);
-      std::size_t h2 = std::hash<int>()(pair.second);
-      return h1 ^ h2;
-    }
-  };
-  std::unordered_set<std::pair<int, int>, pair_hash> index_pairs_;
+  // The blocks of each block row are chained, so that a block pushed twice can
+  // be detected without allocating: row_head_[i] is the last block pushed to
+  // row i, and next_in_row_[b] the block pushed to the same row before block b
+  // (-1 for none).
+  std::vector<int> row_head_;
+  std::vector<int> next_in_row_;
 };
 
 }  // namespace internal
@@ -1,6 +1,7 @@
 #include "drake/multibody/contact_solvers/pgs_solver.h"
 
 #include <algorithm>
+#include <vector>
 
 #include "drake/common/unused.h"
 namespace drake {
@@ -69,28 +70,39 @@ ContactSolverStatus PgsSolver<T>::SolveWithGuess(
   // Contact velocity initialized to the value before the contact solve.
   vc_ = vc_star;
   VectorX<T> vc_kp(3 * nc);  // Contact velocity at state_kp.
+
+  // Performs the Gauss-Seidel update of contact point i. gamma_kp holds the
+  // k+1's iteration of the contact impulses for the contact points already
+  // visited in this sweep and the k's iteration for all others, so the
+  // contribution of each contact impulse to the contact velocity at contact
+  // point i is evaluated at the most recent iteration available.
+  auto update_contact = [&](int i) {
+    const int i3 = 3 * i;
+    auto vci_kp = vc_kp.template segment<3>(i3);
+    vci_kp = vc_star.template segment<3>(i3) + W.block(i3, 0, 3, 3 * nc) *
+                                                   gamma_kp;
+    auto gammai_kp = gamma_kp.template segment<3>(i3);
+    // Get the k+1's iteration of the contact impulse at contact point i.
+    const Vector3<T> gammai_unprojected =
+        gammai_kp - omega * Dinv.template segment<3>(i3).asDiagonal() * vci_kp;
+    // Project the contact impulse at contact point i into the friction cone.
+    gammai_kp = ProjectImpulse(vci_kp, gammai_unprojected, mu(i));
+  };
+
+  const bool check_convergence = parameters_.check_convergence;
+  const auto& colors = pre_proc_data_.colors;
   for (int k = 0; k < max_iters; ++k) {
-    // Initialize the contact velocity to the value before any contact impulse
-    // is applied.
-    vc_kp = vc_star;
-    // Add the contribution of all contact impulse to the contact velocity at
-    // each contact point in a Gauss-Seidel fashion. Namely, for each contact
-    // point i, the contact impulse contribution from j is evaluated at the k's
-    // iteration if j > i and is evaluated at the k+1's iteration if j < i.
-    for (int i = 0; i < nc; ++i) {
-      const int i3 = 3 * i;
-      auto vci_kp = vc_kp.template segment<3>(i3);
-      // Contribution from contact impulses 0, 1, ..., i-1.
-      vci_kp += W.block(i3, 0, 3, i3) * gamma_kp.head(i3);
-      // Contribution from contact impulses i, i+1, i+2, ..., nc.
-      vci_kp += W.block(i3, i3, 3, 3 * (nc - i)) * gamma.tail(3 * (nc - i));
-      const auto& gammai = gamma.template segment<3>(i3);
-      auto gammai_kp = gamma_kp.template segment<3>(i3);
-      // Get the k+1's iteration of the contact impulse at contact point i.
-      gammai_kp =
-          gammai - omega * Dinv.template segment<3>(i3).asDiagonal() * vci_kp;
-      // Project the contact impulse at contact point i into the friction cone.
-      gammai_kp = ProjectImpulse(vci_kp, gammai_kp, mu(i));
+    gamma_kp = gamma;
+    if (colors.empty()) {
+      for (int i = 0; i < nc; ++i) update_contact(i);
+    } else {
+      // Contacts of the same color are not coupled through W, so none of
+      // them reads the impulses or velocities that the others write.
+      for (const std::vector<int>& color : colors) {
+        StaticParallelForIndexLoop(
+            parameters_.parallelism, 0, static_cast<int>(color.size()),
+            [&](int, int c) { update_contact(color[c]); });
+      }
     }
     // Update generalized velocities; v = v* + A⁻¹⋅Jᵀ⋅γ.
     contact_data.get_Jc().MultiplyByTranspose(gamma_kp,
@@ -100,15 +112,19 @@ ContactSolverStatus PgsSolver<T>::SolveWithGuess(
     // Update contact velocities; vc = J⋅v.
     contact_data.get_Jc().Multiply(v_kp, &vc_kp);
 
-    // Verify convergence.
-    const bool converged = VerifyConvergenceCriteria(
-        nc, vc_, vc_kp, gamma, gamma_kp, &stats_.vc_err, &stats_.gamma_err);
+    // Verify convergence. With a fixed iteration budget, the errors are only
+    // computed (for reporting) at the last iteration.
+    const bool last_iteration = k == max_iters - 1;
+    const bool converged =
+        (check_convergence || last_iteration) &&
+        VerifyConvergenceCriteria(nc, vc_, vc_kp, gamma, gamma_kp,
+                                  &stats_.vc_err, &stats_.gamma_err);
     ++stats_.iterations;
 
     // Update state for the next iteration.
     state_ = state_kp;
     vc_ = vc_kp;
-    if (converged) {
+    if (converged || (!check_convergence && last_iteration)) {
       CopyContactResults(results);
       return ContactSolverStatus::kSuccess;
     }
@@ -184,6 +200,49 @@ void PgsSolver<T>::PreProcessData(const SystemDynamicsData<T>& dynamics_data,
                      1.0 / (max(Wii(2, 2), Wii_norm(i))));
     }
   }
+
+  pre_proc_data_.colors.clear();
+  if (parameters_.use_coloring && nc != 0) ColorContacts(nc);
+}
+
+template <typename T>
+void PgsSolver<T>::ColorContacts(int num_contacts) {
+  // Contacts coupled through the Delassus operator, as a list of neighbors per
+  // contact. Since W is symmetric, each coupling is seen from both sides.
+  const Eigen::SparseMatrix<T>& W = pre_proc_data_.W;
+  std::vector<std::vector<int>> neighbors(num_contacts);
+  for (int col = 0; col < W.outerSize(); ++col) {
+    const int j = col / 3;
+    for (typename Eigen::SparseMatrix<T>::InnerIterator it(W, col); it; ++it) {
+      const int i = it.row() / 3;
+      if (i != j) neighbors[j].push_back(i);
+    }
+  }
+  for (std::vector<int>& n : neighbors) {
+    std::sort(n.begin(), n.end());
+    n.erase(std::unique(n.begin(), n.end()), n.end());
+  }
+
+  // Assign to each contact the smallest color not used by its neighbors.
+  std::vector<int> color_of(num_contacts, -1);
+  std::vector<int> last_contact_using_color;
+  auto& colors = pre_proc_data_.colors;
+  for (int i = 0; i < num_contacts; ++i) {
+    for (int j : neighbors[i]) {
+      if (color_of[j] >= 0) last_contact_using_color[color_of[j]] = i;
+    }
+    int c = 0;
+    while (c < static_cast<int>(colors.size()) &&
+           last_contact_using_color[c] == i) {
+      ++c;
+    }
+    if (c == static_cast<int>(colors.size())) {
+      colors.emplace_back();
+      last_contact_using_color.push_back(-1);
+    }
+    color_of[i] = c;
+    colors[c].push_back(i);
+  }
 }
 
 template <typename T>
@@ -240,7 +299,8 @@ Vector3<T> PgsSolver<T>::ProjectImpulse(
   if (pi <= 0.0) return Vector3<T>::Zero();  // No contact.
 
   const auto beta = gamma.template head<2>();  // Tangential component.
-  if (beta.norm() <= mu * pi) return gamma;    // Inside the cone.
+  const T mu_pi = mu * pi;
+  if (beta.squaredNorm() <= mu_pi * mu_pi) return gamma;  // Inside the cone.
 
   // Non-zero impulse lies outside the cone. We'll project it.
   using std::sqrt;
@@ -254,7 +314,7 @@ Vector3<T> PgsSolver<T>::ProjectImpulse(
   const T vt_soft_norm = sqrt(vt.squaredNorm() + v_eps2);
   const Vector2<T> t_hat = vt / vt_soft_norm;
   // Project with Principle of maximum dissipation.
-  const Vector2<T> projected_beta = -mu * pi * t_hat;
+  const Vector2<T> projected_beta = -mu_pi * t_hat;
   return Vector3<T>(projected_beta(0), projected_beta(1), pi);
 }
 
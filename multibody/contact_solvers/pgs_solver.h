@@ -1,5 +1,8 @@
 #pragma once
 
+#include <vector>
+
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/contact_solver.h"
 #include "drake/multibody/contact_solvers/contact_solver_utils.h"
 
@@ -18,6 +21,22 @@ struct PgsSolverParameters {
   double rel_tolerance{1.0e-4};
   // Maximum number of PGS iterations.
   int max_iterations{100};
+  // If false, the solver performs exactly `max_iterations` iterations without
+  // evaluating the convergence criteria (except to report the errors of the
+  // last iteration in PgsSolverStats) and reports success. This gives a fixed
+  // cost per solve, e.g. for real-time use.
+  bool check_convergence{true};
+  // If true, the contacts are partitioned into colors such that no two
+  // contacts of the same color are coupled through the Delassus operator
+  // (e.g., they involve disjoint sets of bodies), and each Gauss-Seidel sweep
+  // visits the colors in turn. Contacts of the same color are then updated
+  // concurrently, with up to `parallelism` threads. The result does not depend
+  // on the number of threads, but generally differs from that of the
+  // sequential sweep in contact order.
+  bool use_coloring{false};
+  // The maximum number of threads used for each color when `use_coloring` is
+  // true; ignored otherwise.
+  Parallelism parallelism{Parallelism::None()};
 };
 
 struct PgsSolverStats {
@@ -102,6 +121,9 @@ class PgsSolver final : public ContactSolver<T> {
     VectorX<T> Wii_norm;
     // Approximation to the inverse of the diagonal of W, of size nc.
     VectorX<T> Dinv;
+    // When coloring is used, the indices of the contacts of each color, in
+    // the order in which the colors are swept. Empty otherwise.
+    std::vector<std::vector<int>> colors;
 
     // Resizes `this` data given the number of generalized velocities
     // `nv` and number of contact points `nc`.
@@ -116,6 +138,11 @@ class PgsSolver final : public ContactSolver<T> {
   void PreProcessData(const SystemDynamicsData<T>& dynamics_data,
                       const PointContactData<T>& contact_data);
 
+  /* Greedily partitions the contacts into colors such that contacts i and j
+   have the same color only if the 3x3 block Wᵢⱼ of the Delassus operator is
+   zero, and stores them in pre_proc_data_.colors. */
+  void ColorContacts(int num_contacts);
+
   /* Returns true if the change in contact velocity and the change in contact
    impulse from one iteration to the next is smaller than the absolute and
    relative error threshold. More specifically, the iterations are considered
@@ -147,7 +174,8 @@ class PgsSolver final : public ContactSolver<T> {
 
   /* Returns the impulse in contact space at a single contact point that lies
    in the friction cone given the contact velocity `vc`, the contact impulse
-   `gamma` and the friction coefficient `mu`. */
+   `gamma` and the friction coefficient `mu`. This method is safe to call
+   concurrently. */
   Vector3<T> ProjectImpulse(const Eigen::Ref<const Vector3<T>>& vc,
                             const Eigen::Ref<const Vector3<T>>& gamma,
                             const T& mu) const;
@@ -1,5 +1,7 @@
 #include "drake/multibody/contact_solvers/sap/contact_problem_graph.h"
 
+#include <algorithm>
+#include <numeric>
 #include <utility>
 
 namespace drake {
@@ -60,6 +62,64 @@ int ContactProblemGraph::AddConstraint(int first_clique, int second_clique,
                        num_constraint_equations);
 }
 
+bool ContactProblemGraph::HasSameTopology(
+    const ContactProblemGraph& other) const {
+  if (num_cliques() != other.num_cliques() ||
+      num_constraints() != other.num_constraints() ||
+      num_constraint_equations() != other.num_constraint_equations() ||
+      num_clusters() != other.num_clusters()) {
+    return false;
+  }
+  // Participating cliques are numbered in the order they get referenced by
+  // clusters. Therefore the same clusters in the same order lead to the same
+  // permutation of participating cliques.
+  for (int k = 0; k < num_clusters(); ++k) {
+    const ConstraintCluster& cluster = clusters_[k];
+    const ConstraintCluster& other_cluster = other.clusters_[k];
+    if (cluster.cliques() != other_cluster.cliques() ||
+        cluster.constraint_index() != other_cluster.constraint_index() ||
+        cluster.constraint_num_equations() !=
+            other_cluster.constraint_num_equations()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<std::vector<int>> ContactProblemGraph::CalcIslands() const {
+  // Union-find over cliques, with the smallest clique index as the root.
+  std::vector<int> parent(num_cliques());
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find_root = [&parent](int c) {
+    while (parent[c] != c) {
+      parent[c] = parent[parent[c]];  // Path halving.
+      c = parent[c];
+    }
+    return c;
+  };
+  for (const ConstraintCluster& cluster : clusters_) {
+    const int first_root = find_root(cluster.cliques().first());
+    const int second_root = find_root(cluster.cliques().second());
+    if (first_root != second_root) {
+      parent[std::max(first_root, second_root)] =
+          std::min(first_root, second_root);
+    }
+  }
+
+  std::vector<std::vector<int>> islands;
+  std::vector<int> root_to_island(num_cliques(), -1);
+  for (int c = 0; c < num_cliques(); ++c) {
+    if (!participating_cliques_.participates(c)) continue;
+    const int root = find_root(c);
+    if (root_to_island[root] < 0) {
+      root_to_island[root] = islands.size();
+      islands.emplace_back();
+    }
+    islands[root_to_island[root]].push_back(c);
+  }
+  return islands;
+}
+
 }  // namespace internal
 }  // namespace contact_solvers
 }  // namespace multibody
@@ -145,6 +145,29 @@ class ContactProblemGraph {
     return participating_cliques_;
   }
 
+  /* Returns `true` if `other` has the same topology as this graph, i.e. the
+   same number of cliques and the same clusters, each with the same
+   constraints, in the same order and with the same number of equations.
+   Two graphs with the same topology have the same participating cliques and
+   lead to models with the same sparsity structure, allowing a solver to reuse
+   its symbolic analysis from one time step to the next. */
+  bool HasSameTopology(const ContactProblemGraph& other) const;
+
+  /* Computes the "islands" of this graph, i.e. its connected components. Two
+   participating cliques belong to the same island if there is a path of
+   clusters connecting them. Cliques that do not participate in any constraint
+   are not included in any island.
+   Islands are the natural unit to decide which parts of a problem can be
+   deactivated ("put to sleep") or reactivated together, since constraints
+   never couple cliques in different islands. Sleeping itself (velocity
+   thresholds, per-island rest counters and wake-up on new contact) is not
+   implemented: CompliantContactManager does not yet build SAP problems from
+   which islands could be tracked across time steps.
+   @returns islands, where islands[i] contains the original (not participating)
+   clique indexes of the i-th island, in increasing order. Islands are sorted
+   by their smallest clique index. */
+  std::vector<std::vector<int>> CalcIslands() const;
+
  private:
   /* Helper to add a constraint between a pair of cliques. */
   int AddConstraint(SortedPair<int> cliques, int num_constrained_dofs);
@@ -1,5 +1,7 @@
 #include "drake/multibody/contact_solvers/sap/sap_constraint_bundle.h"
 
+#include <algorithm>
+
 #include "drake/common/default_scalars.h"
 #include "drake/multibody/contact_solvers/sap/contact_problem_graph.h"
 
@@ -10,40 +12,93 @@ namespace internal {
 
 template <typename T>
 SapConstraintBundle<T>::SapConstraintBundle(
-    const SapContactProblem<T>* problem, const VectorX<T>& delassus_diagonal) {
+    const SapContactProblem<T>* problem, const VectorX<T>& delassus_diagonal,
+    Parallelism parallelism)
+    : parallelism_(parallelism) {
   DRAKE_THROW_UNLESS(problem != nullptr);
   DRAKE_THROW_UNLESS(delassus_diagonal.size() == problem->num_constraints());
 
+  SetConstraintsData(*problem, delassus_diagonal);
+  MakeConstraintBundleJacobian(*problem);
+}
+
+template <typename T>
+void SapConstraintBundle<T>::UpdateValues(const SapContactProblem<T>* problem,
+                                          const VectorX<T>& delassus_diagonal) {
+  DRAKE_THROW_UNLESS(problem != nullptr);
+  DRAKE_THROW_UNLESS(delassus_diagonal.size() == problem->num_constraints());
+  const ContactProblemGraph& graph = problem->graph();
+  DRAKE_THROW_UNLESS(graph.num_clusters() == J_.block_rows());
+  DRAKE_THROW_UNLESS(graph.participating_cliques().permuted_domain_size() ==
+                     J_.block_cols());
+
+  SetConstraintsData(*problem, delassus_diagonal);
+
+  // Blocks are stored in the order they were pushed by
+  // MakeConstraintBundleJacobian(), that is, one or two blocks per cluster in
+  // the order clusters are enumerated in the graph. Empty blocks are not
+  // stored, see BlockSparseMatrixBuilder::PushBlock().
+  int b = 0;
+  auto next_block = [&](int rows, int cols) -> Eigen::Ref<MatrixX<T>> {
+    if (rows * cols == 0) return Eigen::Map<MatrixX<T>>(nullptr, rows, cols);
+    DRAKE_THROW_UNLESS(b < J_.num_blocks());
+    Eigen::Ref<MatrixX<T>> block = J_.get_mutable_block(b++);
+    DRAKE_THROW_UNLESS(block.rows() == rows && block.cols() == cols);
+    return block;
+  };
+  for (const ContactProblemGraph::ConstraintCluster& cluster :
+       graph.clusters()) {
+    const int c0 = cluster.cliques().first();
+    const int c1 = cluster.cliques().second();
+    const int num_rows = cluster.num_total_constraint_equations();
+    Eigen::Ref<MatrixX<T>> J0 =
+        next_block(num_rows, problem->num_velocities(c0));
+    if (c1 != c0) {
+      Eigen::Ref<MatrixX<T>> J1 =
+          next_block(num_rows, problem->num_velocities(c1));
+      CalcClusterJacobianBlocks(*problem, cluster, J0, J1);
+    } else {
+      CalcClusterJacobianBlocks(*problem, cluster, J0, J0);
+    }
+  }
+  DRAKE_THROW_UNLESS(b == J_.num_blocks());
+}
+
+template <typename T>
+void SapConstraintBundle<T>::SetConstraintsData(
+    const SapContactProblem<T>& problem, const VectorX<T>& delassus_diagonal) {
   // Create vector of constraints but not in the order they were enumerated in
   // the SapProblem, but in the computationally convenient order enumerated in
   // the ContactProblemGraph, where constraints between the same
   // pair of cliques are "clustered" together.
-  constraints_.reserve(problem->num_constraints());
+  constraints_.clear();
+  constraints_.reserve(problem.num_constraints());
+  constraint_start_.clear();
+  constraint_start_.reserve(problem.num_constraints());
 
   // Vector of bias velocities and diagonal matrix R.
-  vhat_.resize(problem->num_constraint_equations());
-  R_.resize(problem->num_constraint_equations());
+  vhat_.resize(problem.num_constraint_equations());
+  R_.resize(problem.num_constraint_equations());
   int impulse_index_start = 0;
   for (const ContactProblemGraph::ConstraintCluster& e :
-       problem->graph().clusters()) {
+       problem.graph().clusters()) {
     for (int i : e.constraint_index()) {
-      const SapConstraint<T>& c = problem->get_constraint(i);
+      const SapConstraint<T>& c = problem.get_constraint(i);
       constraints_.push_back(&c);
+      constraint_start_.push_back(impulse_index_start);
 
       const int ni = c.num_constraint_equations();
       const T& wi = delassus_diagonal[i];
 
       vhat_.segment(impulse_index_start, ni) =
-          c.CalcBiasTerm(problem->time_step(), wi);
+          c.CalcBiasTerm(problem.time_step(), wi);
       R_.segment(impulse_index_start, ni) =
-          c.CalcDiagonalRegularization(problem->time_step(), wi);
+          c.CalcDiagonalRegularization(problem.time_step(), wi);
 
       impulse_index_start += ni;
     }
   }
   Rinv_ = R_.cwiseInverse();
-
-  MakeConstraintBundleJacobian(*problem);
 }
 
 template <typename T>
@@ -88,28 +143,7 @@ void SapConstraintBundle<T>::MakeConstraintBundleJacobian(
       const int nv1 = problem.num_velocities(c1);
       J1.resize(num_rows, nv1);
     }
-
-    // Constraints are added in the order set by the graph.
-    int row_start = 0;
-    for (int i : cluster.constraint_index()) {
-      const SapConstraint<T>& c = problem.get_constraint(i);
-      const int ni = c.num_constraint_equations();
-
-      // N.B. Each edge stores its cliques as a sorted pair. However, the pair
-      // of cliques in the original constraints can be in arbitrary order.
-      // Therefore below we must check to what clique in the original constraint
-      // the group's cliques correspond to.
-
-      J0.middleRows(row_start, ni) = c0 == c.first_clique()
-                                         ? c.first_clique_jacobian()
-                                         : c.second_clique_jacobian();
-      if (c1 != c0) {
-        J1.middleRows(row_start, ni) = c1 == c.first_clique()
-                                           ? c.first_clique_jacobian()
-                                           : c.second_clique_jacobian();
-      }
-      row_start += ni;
-    }
+    CalcClusterJacobianBlocks(problem, cluster, J0, J1);
 
     const int participating_c0 = cliques_permutation.permuted_index(c0);
     builder.PushBlock(block_row, participating_c0, J0);
@@ -122,6 +156,37 @@ void SapConstraintBundle<T>::MakeConstraintBundleJacobian(
   J_ = builder.Build();
 }
 
+template <typename T>
+void SapConstraintBundle<T>::CalcClusterJacobianBlocks(
+    const SapContactProblem<T>& problem,
+    const ContactProblemGraph::ConstraintCluster& cluster,
+    Eigen::Ref<MatrixX<T>> J0, Eigen::Ref<MatrixX<T>> J1) {
+  const int c0 = cluster.cliques().first();
+  const int c1 = cluster.cliques().second();
+
+  // Constraints are added in the order set by the graph.
+  int row_start = 0;
+  for (int i : cluster.constraint_index()) {
+    const SapConstraint<T>& c = problem.get_constraint(i);
+    const int ni = c.num_constraint_equations();
+
+    // N.B. Each edge stores its cliques as a sorted pair. However, the pair
+    // of cliques in the original constraints can be in arbitrary order.
+    // Therefore below we must check to what clique in the original constraint
+    // the group's cliques correspond to.
+
+    J0.middleRows(row_start, ni) = c0 == c.first_clique()
+                                       ? c.first_clique_jacobian()
+                                       : c.second_clique_jacobian();
+    if (c1 != c0) {
+      J1.middleRows(row_start, ni) = c1 == c.first_clique()
+                                         ? c.first_clique_jacobian()
+                                         : c.second_clique_jacobian();
+    }
+    row_start += ni;
+  }
+}
+
 template <typename T>
 void SapConstraintBundle<T>::CalcUnprojectedImpulses(const VectorX<T>& vc,
                                                      VectorX<T>* y) const {
@@ -131,6 +196,20 @@ void SapConstraintBundle<T>::CalcUnprojectedImpulses(const VectorX<T>& vc,
   *y = Rinv_.asDiagonal() * (vhat_ - vc);
 }
 
+template <typename T>
+void SapConstraintBundle<T>::ForEachConstraint(
+    const std::function<void(int)>& func) const {
+  const int nc = num_constraints();
+  const int num_threads = std::min(parallelism_.num_threads(),
+                                   nc / kMinConstraintsPerThread);
+  if (num_threads <= 1) {
+    for (int i = 0; i < nc; ++i) func(i);
+    return;
+  }
+  StaticParallelForIndexLoop(Parallelism(num_threads), 0, nc,
+                             [&func](int, int i) { func(i); });
+}
+
 template <typename T>
 void SapConstraintBundle<T>::ProjectImpulses(
     const VectorX<T>& y, VectorX<T>* gamma,
@@ -141,9 +220,11 @@ void SapConstraintBundle<T>::ProjectImpulses(
   if (dPdy != nullptr) {
     DRAKE_DEMAND(static_cast<int>(dPdy->size()) == num_constraints());
   }
-  int constraint_start = 0;
-  for (int i = 0; i < num_constraints(); ++i) {
+  // N.B. Each constraint writes to its own segment of gamma and its own entry
+  // in dPdy and therefore constraints can be processed concurrently.
+  ForEachConstraint([&](int i) {
     const SapConstraint<T>& c = *constraints_[i];
+    const int constraint_start = constraint_start_[i];
     const int ni = c.num_constraint_equations();
     const auto y_i = y.segment(constraint_start, ni);
     const auto R_i = R().segment(constraint_start, ni);
@@ -154,8 +235,7 @@ void SapConstraintBundle<T>::ProjectImpulses(
     } else {
       c.Project(y_i, R_i, &gamma_i);
     }
-    constraint_start += ni;
-  }
+  });
 }
 
 template <typename T>
@@ -165,19 +245,21 @@ void SapConstraintBundle<T>::ProjectImpulsesAndCalcConstraintsHessian(
   DRAKE_DEMAND(gamma != nullptr);
   DRAKE_DEMAND(gamma->size() == num_constraint_equations());
   DRAKE_DEMAND(static_cast<int>(G->size()) == num_constraints());
-  // G = dPdy after call to ProjectImpulses. We add in the R⁻¹ next.
-  ProjectImpulses(y, gamma, G);
-
-  // The regularizer Hessian is G = d²ℓ/dvc² = dP/dy⋅R⁻¹.
-  int constraint_start = 0;
-  for (int i = 0; i < num_constraints(); ++i) {
+  // The regularizer Hessian is G = d²ℓ/dvc² = dP/dy⋅R⁻¹. We compute both the
+  // projection and Hessian for each constraint in a single pass.
+  ForEachConstraint([&](int i) {
     const SapConstraint<T>& c = *constraints_[i];
+    const int constraint_start = constraint_start_[i];
     const int ni = c.num_constraint_equations();
+    const auto y_i = y.segment(constraint_start, ni);
+    const auto R_i = R().segment(constraint_start, ni);
     const auto Rinv_i = Rinv().segment(constraint_start, ni);
-    const MatrixX<T>& dPdy_i = (*G)[i];
-    (*G)[i] = dPdy_i * Rinv_i.asDiagonal();
-    constraint_start += ni;
-  }
+    auto gamma_i = gamma->segment(constraint_start, ni);
+    // G = dPdy after the call to Project(). We add in the R⁻¹ next.
+    MatrixX<T>& G_i = (*G)[i];
+    c.Project(y_i, R_i, &gamma_i, &G_i);
+    G_i = G_i * Rinv_i.asDiagonal();
+  });
 }
 
 }  // namespace internal
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <functional>
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/block_sparse_matrix.h"
+#include "drake/multibody/contact_solvers/sap/contact_problem_graph.h"
 #include "drake/multibody/contact_solvers/sap/partial_permutation.h"
 #include "drake/multibody/contact_solvers/sap/sap_constraint.h"
 #include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
@@ -61,9 +64,39 @@ class SapConstraintBundle {
    @param[in] delassus_diagonal It must have size problem.num_constraint() or an
    exception is thrown. The i-th entry stores the scaling parameter used for
    regularization estimation by the i-th constraint in `problem`, see
-   SapConstraint::CalcDiagonalRegularization(). */
+   SapConstraint::CalcDiagonalRegularization().
+   @param[in] parallelism Maximum degree of parallelism used to process
+   constraints, which are all independent, in ProjectImpulses() and
+   ProjectImpulsesAndCalcConstraintsHessian(). Bundles with fewer than
+   kMinConstraintsPerThread constraints per thread use fewer threads, down to a
+   serial evaluation, since for small problems the overhead of threading
+   outweighs its benefits. Results are independent of the parallelism. */
   SapConstraintBundle(const SapContactProblem<T>* problem,
-                      const VectorX<T>& delassus_diagonal);
+                      const VectorX<T>& delassus_diagonal,
+                      Parallelism parallelism = Parallelism::None());
+
+  /* Minimum number of constraints processed by each thread. */
+  static constexpr int kMinConstraintsPerThread = 64;
+
+  /* Updates the numerical values of this bundle for a new `problem` with the
+   same structure as the problem used at construction, reusing the sparsity
+   pattern and memory allocated for the bundle's Jacobian. That is, this bundle
+   becomes equivalent to SapConstraintBundle(problem, delassus_diagonal),
+   without the heap allocations of a new construction.
+   @param[in] problem This bundle keeps a reference to the constraints owned by
+   `problem` and therefore it must outlive this object. An exception is thrown
+   if nullptr.
+   @param[in] delassus_diagonal It must have size problem.num_constraint() or an
+   exception is thrown.
+   @throws std::exception if the structure of `problem` is not the same as the
+   structure of the problem used at construction, refer to the preconditions
+   below. Only sizes are verified.
+   @pre problem->graph().HasSameTopology() is true when compared against the
+   graph of the problem used at construction.
+   @pre Each participating clique in `problem` has the same number of
+   generalized velocities as in the problem used at construction. */
+  void UpdateValues(const SapContactProblem<T>* problem,
+                    const VectorX<T>& delassus_diagonal);
 
   /* Returns the number of constraints in this bundle. */
   int num_constraints() const;
@@ -129,12 +162,35 @@ class SapConstraintBundle {
    refer to the documentation for the public accessor J(). */
   void MakeConstraintBundleJacobian(const SapContactProblem<T>& problem);
 
+  /* Invokes `func(i)` for the i-th constraint, for all constraints in this
+   bundle, in parallel according to parallelism_.
+   @pre func can be invoked concurrently for different constraints. */
+  void ForEachConstraint(const std::function<void(int)>& func) const;
+
+  /* Sets constraints_, constraint_start_, vhat_, R_ and Rinv_ for the given
+   problem. */
+  void SetConstraintsData(const SapContactProblem<T>& problem,
+                          const VectorX<T>& delassus_diagonal);
+
+  /* Computes the Jacobian blocks J0 and J1 for `cluster` in `problem`, with J0
+   the block for the first clique in cluster.cliques() and J1 the block for the
+   second clique. J1 is not referenced if the cluster is a "loop" of the graph,
+   i.e. if both cliques are the same. */
+  static void CalcClusterJacobianBlocks(
+      const SapContactProblem<T>& problem,
+      const ContactProblemGraph::ConstraintCluster& cluster,
+      Eigen::Ref<MatrixX<T>> J0, Eigen::Ref<MatrixX<T>> J1);
+
   BlockSparseMatrix<T> J_;
   VectorX<T> vhat_;
   VectorX<T> R_;
   VectorX<T> Rinv_;
   // Constraint references in the order dictated by the ContactProblemGraph.
   std::vector<const SapConstraint<T>*> constraints_;
+  // constraint_start_[i] stores the index of the first equation of the i-th
+  // constraint in the bundle, i.e. the first row in J_ for that constraint.
+  std::vector<int> constraint_start_;
+  Parallelism parallelism_;
 };
 
 }  // namespace internal
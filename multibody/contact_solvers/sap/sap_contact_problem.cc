@@ -1,6 +1,8 @@
 #include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
 
+#include <memory>
 #include <utility>
+#include <vector>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_throw.h"
@@ -12,6 +14,55 @@ namespace multibody {
 namespace contact_solvers {
 namespace internal {
 
+namespace {
+
+/* A constraint within an island problem, see
+ SapContactProblem::MakeIslandProblems(). It is a copy of a constraint in the
+ original problem, with its cliques renumbered, that delegates the projection,
+ bias and regularization computations to the original constraint. */
+template <typename T>
+class IslandConstraint final : public SapConstraint<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(IslandConstraint);
+
+  /* Constructs a constraint on `clique` for a single clique `constraint`. */
+  IslandConstraint(const SapConstraint<T>& constraint, int clique)
+      : SapConstraint<T>(clique, constraint.constraint_function(),
+                         constraint.first_clique_jacobian()),
+        constraint_(constraint) {}
+
+  /* Constructs a constraint between `first_clique` and `second_clique` for a
+   two cliques `constraint`. */
+  IslandConstraint(const SapConstraint<T>& constraint, int first_clique,
+                   int second_clique)
+      : SapConstraint<T>(first_clique, second_clique,
+                         constraint.constraint_function(),
+                         constraint.first_clique_jacobian(),
+                         constraint.second_clique_jacobian()),
+        constraint_(constraint) {}
+
+  void Project(const Eigen::Ref<const VectorX<T>>& y,
+               const Eigen::Ref<const VectorX<T>>& R,
+               EigenPtr<VectorX<T>> gamma,
+               MatrixX<T>* dPdy = nullptr) const final {
+    constraint_.Project(y, R, gamma, dPdy);
+  }
+
+  VectorX<T> CalcBiasTerm(const T& time_step, const T& wi) const final {
+    return constraint_.CalcBiasTerm(time_step, wi);
+  }
+
+  VectorX<T> CalcDiagonalRegularization(const T& time_step,
+                                        const T& wi) const final {
+    return constraint_.CalcDiagonalRegularization(time_step, wi);
+  }
+
+ private:
+  const SapConstraint<T>& constraint_;
+};
+
+}  // namespace
+
 template <typename T>
 SapContactProblem<T>::SapContactProblem(const T& time_step,
                                         std::vector<MatrixX<T>> A,
@@ -66,6 +117,93 @@ int SapContactProblem<T>::AddConstraint(std::unique_ptr<SapConstraint<T>> c) {
   return constraint_index;
 }
 
+template <typename T>
+std::vector<typename SapContactProblem<T>::IslandProblem>
+SapContactProblem<T>::MakeIslandProblems() const {
+  const std::vector<std::vector<int>> island_cliques = graph_.CalcIslands();
+  const int num_islands = island_cliques.size();
+
+  // For each clique in this problem, its island and its index within the
+  // island.
+  std::vector<int> clique_island(num_cliques(), -1);
+  std::vector<int> clique_index_in_island(num_cliques(), -1);
+  for (int i = 0; i < num_islands; ++i) {
+    for (int k = 0; k < static_cast<int>(island_cliques[i].size()); ++k) {
+      clique_island[island_cliques[i][k]] = i;
+      clique_index_in_island[island_cliques[i][k]] = k;
+    }
+  }
+
+  // First velocity of each clique in v_star_.
+  std::vector<int> clique_start(num_cliques(), 0);
+  for (int c = 1; c < num_cliques(); ++c) {
+    clique_start[c] = clique_start[c - 1] + num_velocities(c - 1);
+  }
+
+  std::vector<IslandProblem> islands(num_islands);
+  for (int i = 0; i < num_islands; ++i) {
+    const std::vector<int>& cliques = island_cliques[i];
+    std::vector<MatrixX<T>> A;
+    A.reserve(cliques.size());
+    int island_nv = 0;
+    for (int c : cliques) {
+      A.push_back(A_[c]);
+      island_nv += num_velocities(c);
+    }
+    VectorX<T> v_star(island_nv);
+    int offset = 0;
+    for (int c : cliques) {
+      v_star.segment(offset, num_velocities(c)) =
+          v_star_.segment(clique_start[c], num_velocities(c));
+      offset += num_velocities(c);
+    }
+    islands[i].problem = std::make_unique<SapContactProblem<T>>(
+        time_step_, std::move(A), std::move(v_star));
+    islands[i].cliques = cliques;
+  }
+
+  for (int k = 0; k < num_constraints(); ++k) {
+    const SapConstraint<T>& c = *constraints_[k];
+    IslandProblem& island = islands[clique_island[c.first_clique()]];
+    const int first_clique = clique_index_in_island[c.first_clique()];
+    if (c.num_cliques() == 1) {
+      island.problem->AddConstraint(
+          std::make_unique<IslandConstraint<T>>(c, first_clique));
+    } else {
+      const int second_clique = clique_index_in_island[c.second_clique()];
+      island.problem->AddConstraint(std::make_unique<IslandConstraint<T>>(
+          c, first_clique, second_clique));
+    }
+    island.constraints.push_back(k);
+  }
+
+  return islands;
+}
+
+template <typename T>
+VectorX<T> SapContactProblem<T>::CombineIslandVelocities(
+    const std::vector<IslandProblem>& islands,
+    const std::vector<VectorX<T>>& island_velocities) const {
+  DRAKE_THROW_UNLESS(island_velocities.size() == islands.size());
+  std::vector<int> clique_start(num_cliques(), 0);
+  for (int c = 1; c < num_cliques(); ++c) {
+    clique_start[c] = clique_start[c - 1] + num_velocities(c - 1);
+  }
+  VectorX<T> v = v_star_;
+  for (int i = 0; i < static_cast<int>(islands.size()); ++i) {
+    const VectorX<T>& v_island = island_velocities[i];
+    DRAKE_THROW_UNLESS(v_island.size() ==
+                       islands[i].problem->num_velocities());
+    int offset = 0;
+    for (int c : islands[i].cliques) {
+      v.segment(clique_start[c], num_velocities(c)) =
+          v_island.segment(offset, num_velocities(c));
+      offset += num_velocities(c);
+    }
+  }
+  return v;
+}
+
 }  // namespace internal
 }  // namespace contact_solvers
 }  // namespace multibody
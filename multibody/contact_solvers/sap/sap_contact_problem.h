@@ -47,6 +47,20 @@ class SapContactProblem {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SapContactProblem);
 
+  /* An independent sub-problem of a SapContactProblem, corresponding to an
+   island of its contact graph. See MakeIslandProblems(). */
+  struct IslandProblem {
+    /* The problem for the island, with its own numbering of cliques and
+     constraints. */
+    std::unique_ptr<SapContactProblem<T>> problem;
+    /* cliques[i] is the index in the original problem of the i-th clique in
+     `problem`. */
+    std::vector<int> cliques;
+    /* constraints[k] is the index in the original problem of the k-th
+     constraint in `problem`. */
+    std::vector<int> constraints;
+  };
+
   /* Constructs a SAP contact problem for a system of equations discretized with
    a given `time_step` provided its linear dynamics matrix A and free motion
    velocities v*. See this class's documentation for details.
@@ -128,6 +142,28 @@ class SapContactProblem {
 
   const ContactProblemGraph& graph() const { return graph_; }
 
+  /* Splits this problem into independent problems, one for each island of
+   graph(), see ContactProblemGraph::CalcIslands(). Since no constraint couples
+   cliques in different islands, each island problem can be solved on its own,
+   possibly concurrently with the others, and the solutions combined with
+   CombineIslandVelocities(). Cliques that do not participate in any
+   constraint are not part of any island, their solution is trivially v = v*.
+   @warning The constraints of the island problems reference the constraints
+   in this problem. Therefore this problem must outlive the returned island
+   problems. */
+  std::vector<IslandProblem> MakeIslandProblems() const;
+
+  /* Combines the generalized velocities `island_velocities` of the island
+   problems `islands` previously obtained with MakeIslandProblems() into the
+   generalized velocities for the full problem. Velocities of cliques not in
+   any island are set to their free-motion values v*.
+   @throws exception if island_velocities.size() != islands.size() or if the
+   size of island_velocities[i] does not match the number of velocities of
+   islands[i].problem. */
+  VectorX<T> CombineIslandVelocities(
+      const std::vector<IslandProblem>& islands,
+      const std::vector<VectorX<T>>& island_velocities) const;
+
  private:
   int nv_{0};                    // Total number of generalized velocities.
   T time_step_{0.0};             // Discrete time step.
@@ -15,63 +15,104 @@ namespace internal {
 using systems::Context;
 
 template <typename T>
-SapModel<T>::SapModel(const SapContactProblem<T>* problem_ptr)
-    : problem_(problem_ptr) {
+SapModel<T>::SapModel(const SapContactProblem<T>* problem_ptr,
+                      Parallelism parallelism)
+    : problem_(problem_ptr), parallelism_(parallelism) {
+  BuildModel();
+}
+
+template <typename T>
+bool SapModel<T>::ResetProblem(const SapContactProblem<T>* problem_ptr) {
+  DRAKE_THROW_UNLESS(problem_ptr != nullptr);
+  problem_ = problem_ptr;
+  if (!HasSameStructure(problem())) {
+    BuildModel();
+    return false;
+  }
+  // The permutation of participating velocities, the sparsity pattern of the
+  // bundle's Jacobian and the system managing context resources stay the same.
+  // Only numerical values are updated.
+  UpdateModelValues();
+  model_data_.constraints_bundle->UpdateValues(&problem(),
+                                               model_data_.delassus_diagonal);
+  return true;
+}
+
+template <typename T>
+bool SapModel<T>::HasSameStructure(const SapContactProblem<T>& problem) const {
+  if (!problem.graph().HasSameTopology(model_data_.graph)) return false;
+  // N.B. Since graphs have the same topology, they have the same number of
+  // cliques.
+  for (int c = 0; c < problem.num_cliques(); ++c) {
+    if (problem.num_velocities(c) != model_data_.clique_num_velocities[c]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+void SapModel<T>::BuildModel() {
   // Graph to the original contact problem, including all cliques
   // (participating and non-participating).
   const ContactProblemGraph& graph = problem().graph();
 
+  // Structure of the problem, used to detect whether the structure of this
+  // model can be reused for a new problem.
+  model_data_.graph = graph;
+  model_data_.clique_num_velocities.resize(problem().num_cliques());
+  for (int c = 0; c < problem().num_cliques(); ++c) {
+    model_data_.clique_num_velocities[c] = problem().num_velocities(c);
+  }
+
   // Permutations to map indexes from participating cliques/dofs to the original
   // set of cliques/dofs.
-  const PartialPermutation& cliques_permutation = graph.participating_cliques();
-  PartialPermutation velocities_permutation =
+  model_data_.velocities_permutation =
       MakeParticipatingVelocitiesPermutation(problem());
 
-  // Extract momentum matrix for participating DOFs only.
+  // Allocate model data for participating cliques/DOFs only.
   const int num_participating_cliques =
-      cliques_permutation.permuted_domain_size();
-  std::vector<MatrixX<T>> dynamics_matrix(num_participating_cliques);
-  cliques_permutation.Apply(problem().dynamics_matrix(), &dynamics_matrix);
+      graph.participating_cliques().permuted_domain_size();
+  const int nv_participating = num_velocities();
+  model_data_.dynamics_matrix.resize(num_participating_cliques);
+  model_data_.v_star.resize(nv_participating);
+  model_data_.p_star.resize(nv_participating);
+  model_data_.inv_sqrt_A.resize(nv_participating);
+  UpdateModelValues();
+
+  // Create constraints bundle.
+  model_data_.constraints_bundle = std::make_unique<SapConstraintBundle<T>>(
+      &problem(), model_data_.delassus_diagonal, parallelism_);
+
+  system_ = std::make_unique<SapModelSystem>(num_velocities());
+  DeclareCacheEntries();
+}
+
+template <typename T>
+void SapModel<T>::UpdateModelValues() {
+  const PartialPermutation& cliques_permutation =
+      problem().graph().participating_cliques();
+
+  // Extract momentum matrix for participating DOFs only.
+  cliques_permutation.Apply(problem().dynamics_matrix(),
+                            &model_data_.dynamics_matrix);
 
   // Get v* for participating DOFs only.
-  const int nv_participating = velocities_permutation.permuted_domain_size();
-  VectorX<T> v_star(nv_participating);
-  velocities_permutation.Apply(problem().v_star(), &v_star);
+  velocities_permutation().Apply(problem().v_star(), &model_data_.v_star);
+  MultiplyByDynamicsMatrix(model_data_.v_star, &model_data_.p_star);
 
   // Compute diagonal scaling inv_sqrt_A.
-  VectorX<T> inv_sqrt_A(nv_participating);
   int clique_offset = 0;
-  for (const auto& Ac : dynamics_matrix) {
+  for (const auto& Ac : model_data_.dynamics_matrix) {
     const int clique_nv = Ac.rows();
-    inv_sqrt_A.segment(clique_offset, clique_nv) =
+    model_data_.inv_sqrt_A.segment(clique_offset, clique_nv) =
         Ac.diagonal().cwiseInverse().cwiseSqrt();
     clique_offset += clique_nv;
   }
 
   // Computation of a diagonal approximation to the Delassus operator.
-  VectorX<T> delassus_diagonal(num_constraints());
-  CalcDelassusDiagonalApproximation(dynamics_matrix, &delassus_diagonal);
-
-  // Create constraints bundle.
-  std::unique_ptr<SapConstraintBundle<T>> constraints_bundle =
-      std::make_unique<SapConstraintBundle<T>>(&problem(), delassus_diagonal);
-
-  // N.B. const_model_data_ is meant to be created once at construction and
-  // remain const afterwards.
-  const_model_data_.velocities_permutation = std::move(velocities_permutation);
-  const_model_data_.dynamics_matrix = std::move(dynamics_matrix);
-  const_model_data_.constraints_bundle = std::move(constraints_bundle);
-  // N.B. We must extract p* after the dynamics matrix has been moved into
-  // const_model_data_.
-  VectorX<T> p_star(nv_participating);
-  MultiplyByDynamicsMatrix(v_star, &p_star);
-  const_model_data_.v_star = std::move(v_star);
-  const_model_data_.p_star = std::move(p_star);
-  const_model_data_.inv_sqrt_A = std::move(inv_sqrt_A);
-  const_model_data_.delassus_diagonal = std::move(delassus_diagonal);
-
-  system_ = std::make_unique<SapModelSystem>(num_velocities());
-  DeclareCacheEntries();
+  CalcDelassusDiagonalApproximation(model_data_.dynamics_matrix,
+                                    &model_data_.delassus_diagonal);
 }
 
 template <typename T>
@@ -242,28 +283,28 @@ int SapModel<T>::num_constraint_equations() const {
 
 template <typename T>
 const std::vector<MatrixX<T>>& SapModel<T>::dynamics_matrix() const {
-  return const_model_data_.dynamics_matrix;
+  return model_data_.dynamics_matrix;
 }
 
 template <typename T>
 const VectorX<T>& SapModel<T>::v_star() const {
-  return const_model_data_.v_star;
+  return model_data_.v_star;
 }
 
 template <typename T>
 const VectorX<T>& SapModel<T>::p_star() const {
-  return const_model_data_.p_star;
+  return model_data_.p_star;
 }
 
 template <typename T>
 const VectorX<T>& SapModel<T>::inv_sqrt_dynamics_matrix() const {
-  return const_model_data_.inv_sqrt_A;
+  return model_data_.inv_sqrt_A;
 }
 
 template <typename T>
 const SapConstraintBundle<T>& SapModel<T>::constraints_bundle() const {
-  DRAKE_DEMAND(const_model_data_.constraints_bundle != nullptr);
-  return *const_model_data_.constraints_bundle;
+  DRAKE_DEMAND(model_data_.constraints_bundle != nullptr);
+  return *model_data_.constraints_bundle;
 }
 
 template <typename T>
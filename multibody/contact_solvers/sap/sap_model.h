@@ -4,6 +4,8 @@
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
+#include "drake/multibody/contact_solvers/sap/contact_problem_graph.h"
 #include "drake/multibody/contact_solvers/sap/partial_permutation.h"
 #include "drake/multibody/contact_solvers/sap/sap_constraint_bundle.h"
 #include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
@@ -84,17 +86,18 @@ struct HessianCache {
  non-participating cliques is trivial (v=v*) and therefore they are excluded
  from the main (expensive) SAP computation.
 
- This model is meant to be constructed once per time step, it does not persist
- over multiple time steps. Given a multibody system with state x, this model is
- built for a given state x₀ at time t so that we can take a discrete time step
- of size δt and advance the state of the system to time t+δt. In other words,
- the model is a function of state x₀ and therefore it must be updated at the
- next time step.
+ Given a multibody system with state x, this model is built for a given state
+ x₀ at time t so that we can take a discrete time step of size δt and advance
+ the state of the system to time t+δt. In other words, the model is a function
+ of state x₀ and therefore it must be updated at the next time step. Since the
+ structure of the problem (the graph of the contact problem) often does not
+ change between time steps, a model can persist over multiple time steps with
+ ResetProblem(), which reuses the structure of the model when possible and
+ only updates its numerical values.
 
  Our SAP solver will create an instance of a SapModel to solve a given
- SapContactProblem per discrete time step. The model remains "const" after
- creation and only (const) state dependent queries on this model can be
- performed. The state of the model is stored as a systems::Context. This Context
+ SapContactProblem. Between calls to ResetProblem() the model remains "const"
+ and only (const) state dependent queries on this model can be performed. The state of the model is stored as a systems::Context. This Context
  is created by the SAP solver invoking the method SapModel::MakeContext(). Once
  a context is available, the solver can perform queries on this model; e.g.
  SapModel::EvalMomentumCost(context).
@@ -110,8 +113,33 @@ class SapModel {
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SapModel);
 
   /* Constructs a model of `problem` optimized to be used by the SAP solver.
-   The input `problem` must outlive `this` model. */
-  explicit SapModel(const SapContactProblem<T>* problem);
+   The input `problem` must outlive `this` model. Per-constraint computations
+   are performed with up to `parallelism` threads, see SapConstraintBundle. */
+  explicit SapModel(const SapContactProblem<T>* problem,
+                    Parallelism parallelism = Parallelism::None());
+
+  /* Resets this model to represent the given `problem`, typically the contact
+   problem for the next time step of a simulation. The input `problem` must
+   outlive `this` model, or until the next call to ResetProblem().
+
+   When the graph of `problem` has the same topology as the graph of the
+   previous problem (see ContactProblemGraph::HasSameTopology()) and each clique
+   has the same number of generalized velocities, the structure of this model
+   is reused and only its numerical values are updated. That is, the
+   permutation of participating velocities, the sparsity pattern of the
+   constraints' Jacobian and the system used to manage context resources are
+   reused, without the heap allocations of a new build. In this case, contexts
+   previously created with MakeContext() can still be used with this model.
+   Otherwise the model is rebuilt as if constructed with SapModel(problem) and
+   previously created contexts are no longer valid.
+
+   @note Values cached in a context are not aware of this update. Therefore
+   velocities must be set with SetVelocities() before any further queries on a
+   previously created context.
+
+   @returns `true` if the structure of this model was reused.
+   @throws std::exception if `problem` is nullptr. */
+  bool ResetProblem(const SapContactProblem<T>* problem);
 
   /* Returns a reference to the contact problem being modeled by this class. */
   const SapContactProblem<T>& problem() const {
@@ -138,7 +166,7 @@ class SapModel {
    in the full vector of generalized velocities v, leaving non-participating
    velocities untouched. */
   const PartialPermutation& velocities_permutation() const {
-    return const_model_data_.velocities_permutation;
+    return model_data_.velocities_permutation;
   }
 
   /* The time step of problem(). */
@@ -279,10 +307,17 @@ class SapModel {
     CacheIndexes cache_indexes_;
   };
 
-  // SapModel builds a model at construction that is meant to remain const for
-  // its lifetime. We place all this model data into this structure as a way to
-  // properly document its intent to future developers.
-  struct ConstModelData {
+  // Data for the model of problem_. It is built at construction and remains
+  // const between calls to ResetProblem(). When the structure of the model is
+  // reused, ResetProblem() updates numerical values in place and keeps the
+  // structure (graph, clique sizes, velocities permutation and sizes) intact.
+  struct ModelData {
+    /* Copy of the graph of the problem the structure of this model was built
+     for. */
+    ContactProblemGraph graph{0};
+    /* Number of generalized velocities for each clique in the problem,
+     including non-participating cliques. */
+    std::vector<int> clique_num_velocities;
     /* Permutation to map back and forth between DOFs in problem_ and DOFs in
      this model. */
     PartialPermutation velocities_permutation;
@@ -298,6 +333,20 @@ class SapModel {
     std::unique_ptr<SapConstraintBundle<T>> constraints_bundle;
   };
 
+  /* Builds the structure of this model for problem() and computes all model
+   data. Creates a new SapModelSystem. */
+  void BuildModel();
+
+  /* Updates the numerical values of the dynamics matrix, v*, p*,
+   diag(A)^{-1/2} and the Delassus operator diagonal approximation for
+   problem(), assuming the structure of the model was already built. The
+   constraints bundle is not updated. */
+  void UpdateModelValues();
+
+  /* Returns `true` if the structure of this model can be reused for `problem`,
+   see ResetProblem(). */
+  bool HasSameStructure(const SapContactProblem<T>& problem) const;
+
   /* Const access to the bundle for this model. */
   const SapConstraintBundle<T>& constraints_bundle() const;
 
@@ -307,10 +356,10 @@ class SapModel {
    owns a SapModelSystem used to manage this resources in the context, even
    though SapModel is NOT a systems::System. A few important notes on
    DeclareCacheEntries():
-     1. This method is intended to be called ONLY from the model's constructor,
-        AFTER the SapModelSystem used to manage its resources is created.
-        Calling this method before the SapModelSystem is created will trigger an
-        assertion failure.
+     1. This method is intended to be called ONLY from BuildModel(), AFTER the
+        SapModelSystem used to manage its resources is created. Calling this
+        method before the SapModelSystem is created will trigger an assertion
+        failure.
      2. The Calc() and Eval() methods for these cache entries belong to
         SapModel, not to the system used to declare them. This is required by
         the fact that model data belongs to SapModel. */
@@ -383,15 +432,14 @@ class SapModel {
 
   const SapContactProblem<T>* problem_{nullptr};
 
-  // TODO(amcastro-tri): Data below is heap allocated once per time step.
-  // Consider how to pre-allocate once to minimize heap allocation.
-  // N.B. For developers, this model data is set once at construction and is
-  // meant to remain const for the lifetime of the SapModel object. The name of
-  // the struct and the name of the data variable should be enough for
-  // developers to think twice before mutating any of this.
-  // Future efforts to mutate this data (for instance to reuse the model) must
-  // move data out of this struct and document properly its mutability.
-  ConstModelData const_model_data_;
+  // N.B. For developers, this model data is set at construction and only
+  // mutated by ResetProblem(). The name of the struct and the name of the data
+  // variable should be enough for developers to think twice before mutating
+  // any of this elsewhere.
+  ModelData model_data_;
+
+  // Degree of parallelism used by the constraints bundle.
+  Parallelism parallelism_;
 
   // System used to manage context resources.
   std::unique_ptr<SapModelSystem> system_;
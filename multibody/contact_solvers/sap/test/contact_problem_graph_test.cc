@@ -100,6 +100,79 @@ GTEST_TEST(ContactGraph, Construction) {
   EXPECT_EQ(p.permutation(), expected_p);
 }
 
+GTEST_TEST(ContactGraph, HasSameTopology) {
+  auto make_graph = [](int num_equations_last) {
+    ContactProblemGraph graph(4);
+    graph.AddConstraint(3, 1);
+    graph.AddConstraint(0, 1, 3);
+    graph.AddConstraint(0, 3, num_equations_last);
+    return graph;
+  };
+  const ContactProblemGraph graph = make_graph(6);
+  EXPECT_TRUE(graph.HasSameTopology(graph));
+  EXPECT_TRUE(graph.HasSameTopology(make_graph(6)));
+
+  // Constraint with a different number of equations.
+  EXPECT_FALSE(graph.HasSameTopology(make_graph(5)));
+
+  // Same number of constraints and equations, different cliques.
+  ContactProblemGraph other(4);
+  other.AddConstraint(3, 1);
+  other.AddConstraint(0, 1, 3);
+  other.AddConstraint(2, 3, 6);
+  EXPECT_FALSE(graph.HasSameTopology(other));
+
+  // Same clusters, added in a different order.
+  ContactProblemGraph reordered(4);
+  reordered.AddConstraint(0, 1, 3);
+  reordered.AddConstraint(3, 1);
+  reordered.AddConstraint(0, 3, 6);
+  EXPECT_FALSE(graph.HasSameTopology(reordered));
+
+  // Constraints distributed differently among the same clusters.
+  ContactProblemGraph graph_a(2);
+  graph_a.AddConstraint(0, 1, 1);
+  graph_a.AddConstraint(0, 1, 1);
+  graph_a.AddConstraint(1, 1);
+  ContactProblemGraph graph_b(2);
+  graph_b.AddConstraint(0, 1, 1);
+  graph_b.AddConstraint(1, 1);
+  graph_b.AddConstraint(0, 1, 1);
+  EXPECT_FALSE(graph_a.HasSameTopology(graph_b));
+
+  // Different number of cliques.
+  ContactProblemGraph larger(5);
+  larger.AddConstraint(3, 1);
+  larger.AddConstraint(0, 1, 3);
+  larger.AddConstraint(0, 3, 6);
+  EXPECT_FALSE(graph.HasSameTopology(larger));
+}
+
+GTEST_TEST(ContactGraph, CalcIslands) {
+  ContactProblemGraph graph(7);
+  EXPECT_TRUE(graph.CalcIslands().empty());
+
+  // Island {1, 4, 5}, with a self-constraint on 5.
+  graph.AddConstraint(5, 1, 3);
+  graph.AddConstraint(5, 2);
+  graph.AddConstraint(4, 1, 3);
+  // Island {2}, constrained only with itself.
+  graph.AddConstraint(2, 1);
+  // Island {0, 6}.
+  graph.AddConstraint(6, 0, 3);
+  // Clique 3 does not participate.
+
+  const std::vector<std::vector<int>> expected_islands = {
+      {0, 6}, {1, 4, 5}, {2}};
+  EXPECT_EQ(graph.CalcIslands(), expected_islands);
+
+  // A constraint between two islands merges them.
+  graph.AddConstraint(2, 6, 3);
+  const std::vector<std::vector<int>> expected_merged_islands = {
+      {0, 2, 6}, {1, 4, 5}};
+  EXPECT_EQ(graph.CalcIslands(), expected_merged_islands);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
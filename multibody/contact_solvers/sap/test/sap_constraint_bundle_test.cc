@@ -95,31 +95,39 @@ namespace {
 class SapConstraintBundleTest : public ::testing::Test {
  public:
   void SetUp() override {
+    problem_ = MakeProblem(1.0);
+    delassus_diagonal_.resize(7);
+    delassus_diagonal_ = VectorXd::LinSpaced(7, 1., 7.0);
+
+    bundle_ = std::make_unique<SapConstraintBundle<double>>(problem_.get(),
+                                                            delassus_diagonal_);
+  }
+
+ protected:
+  // Makes the problem for this fixture, where the parameter of the i-th
+  // constraint is (i + 1) * param_scale.
+  static std::unique_ptr<SapContactProblem<double>> MakeProblem(
+      double param_scale) {
     const double time_step = 1.0e-3;
     std::vector<MatrixXd> A = {MatrixXd::Ones(1, 1), MatrixXd::Ones(2, 2),
                                MatrixXd::Ones(3, 3)};
     VectorXd v_star = VectorXd::LinSpaced(6, 1., 6.);
-    problem_ = std::make_unique<SapContactProblem<double>>(
+    auto problem = std::make_unique<SapContactProblem<double>>(
         time_step, std::move(A), std::move(v_star));
+    const double s = param_scale;
     // First cluster of constraints between cliques 0 and 2.
-    problem_->AddConstraint(std::make_unique<TestConstraint>(0, 2, 1, 1.0));
-    problem_->AddConstraint(std::make_unique<TestConstraint>(2, 0, 2, 2.0));
+    problem->AddConstraint(std::make_unique<TestConstraint>(0, 2, 1, 1.0 * s));
+    problem->AddConstraint(std::make_unique<TestConstraint>(2, 0, 2, 2.0 * s));
     // A second cluster of constraints between cliques 0 and 1.
-    problem_->AddConstraint(std::make_unique<TestConstraint>(0, 1, 3, 3.0));
-    problem_->AddConstraint(std::make_unique<TestConstraint>(0, 1, 2, 4.0));
-    problem_->AddConstraint(std::make_unique<TestConstraint>(0, 1, 3, 5.0));
+    problem->AddConstraint(std::make_unique<TestConstraint>(0, 1, 3, 3.0 * s));
+    problem->AddConstraint(std::make_unique<TestConstraint>(0, 1, 2, 4.0 * s));
+    problem->AddConstraint(std::make_unique<TestConstraint>(0, 1, 3, 5.0 * s));
     // A third cluster only involving clique 1.
-    problem_->AddConstraint(std::make_unique<TestConstraint>(1, 4, 6.0));
-    problem_->AddConstraint(std::make_unique<TestConstraint>(1, 2, 7.0));
-
-    delassus_diagonal_.resize(7);
-    delassus_diagonal_ = VectorXd::LinSpaced(7, 1., 7.0);
-
-    bundle_ = std::make_unique<SapConstraintBundle<double>>(problem_.get(),
-                                                            delassus_diagonal_);
+    problem->AddConstraint(std::make_unique<TestConstraint>(1, 4, 6.0 * s));
+    problem->AddConstraint(std::make_unique<TestConstraint>(1, 2, 7.0 * s));
+    return problem;
   }
 
- protected:
   std::unique_ptr<SapContactProblem<double>> problem_;
   VectorXd delassus_diagonal_;
   std::unique_ptr<SapConstraintBundle<double>> bundle_;
@@ -258,6 +266,97 @@ TEST_F(SapConstraintBundleTest, ProjectImpulses) {
   }
 }
 
+// Verifies that a bundle processing constraints in parallel produces the same
+// results as a serial bundle.
+GTEST_TEST(SapConstraintBundle, ParallelProjection) {
+  const double time_step = 1.0e-3;
+  std::vector<MatrixXd> A = {MatrixXd::Ones(1, 1), MatrixXd::Ones(2, 2),
+                             MatrixXd::Ones(3, 3)};
+  VectorXd v_star = VectorXd::LinSpaced(6, 1., 6.);
+  SapContactProblem<double> problem(time_step, std::move(A),
+                                    std::move(v_star));
+  // Enough constraints for three threads to share the work.
+  const int num_constraints =
+      3 * SapConstraintBundle<double>::kMinConstraintsPerThread + 5;
+  for (int i = 0; i < num_constraints; ++i) {
+    const int size = 1 + i % 3;
+    const double param = 0.5 + 0.01 * i;
+    if (i % 2 == 0) {
+      problem.AddConstraint(
+          std::make_unique<TestConstraint>(i % 3, size, param));
+    } else {
+      problem.AddConstraint(std::make_unique<TestConstraint>(
+          i % 3, (i + 1) % 3, size, param));
+    }
+  }
+  const VectorXd delassus_diagonal = VectorXd::Ones(num_constraints);
+  const SapConstraintBundle<double> serial_bundle(&problem, delassus_diagonal);
+  const SapConstraintBundle<double> parallel_bundle(
+      &problem, delassus_diagonal, Parallelism(3));
+
+  const int ne = problem.num_constraint_equations();
+  const VectorXd y = VectorXd::LinSpaced(ne, -1.0, 5.0);
+  VectorXd gamma_serial(ne);
+  VectorXd gamma_parallel(ne);
+  std::vector<MatrixXd> G_serial(num_constraints);
+  std::vector<MatrixXd> G_parallel(num_constraints);
+  serial_bundle.ProjectImpulsesAndCalcConstraintsHessian(y, &gamma_serial,
+                                                         &G_serial);
+  parallel_bundle.ProjectImpulsesAndCalcConstraintsHessian(y, &gamma_parallel,
+                                                           &G_parallel);
+  EXPECT_EQ(gamma_parallel, gamma_serial);
+  EXPECT_EQ(G_parallel, G_serial);
+
+  gamma_parallel.setZero();
+  parallel_bundle.ProjectImpulses(y, &gamma_parallel);
+  EXPECT_EQ(gamma_parallel, gamma_serial);
+}
+
+// Verifies that UpdateValues() makes the bundle reference the constraints of
+// a new problem with the same structure, reusing the Jacobian's storage.
+TEST_F(SapConstraintBundleTest, UpdateValues) {
+  const MatrixXd J_expected = bundle_->J().MakeDenseMatrix();
+  std::vector<const double*> blocks_data;
+  for (int b = 0; b < bundle_->J().num_blocks(); ++b) {
+    blocks_data.push_back(bundle_->J().get_block(b).data());
+  }
+
+  // Same structure, all constraint parameters scaled by two.
+  std::unique_ptr<SapContactProblem<double>> new_problem = MakeProblem(2.0);
+  ASSERT_TRUE(new_problem->graph().HasSameTopology(problem_->graph()));
+  bundle_->UpdateValues(new_problem.get(), delassus_diagonal_);
+  problem_ = std::move(new_problem);
+
+  EXPECT_EQ(bundle_->J().MakeDenseMatrix(), J_expected);
+  for (int b = 0; b < bundle_->J().num_blocks(); ++b) {
+    EXPECT_EQ(bundle_->J().get_block(b).data(), blocks_data[b]);
+  }
+  const SapConstraintBundle<double> expected_bundle(problem_.get(),
+                                                    delassus_diagonal_);
+  EXPECT_EQ(bundle_->vhat(), expected_bundle.vhat());
+  EXPECT_EQ(bundle_->R(), expected_bundle.R());
+  EXPECT_EQ(bundle_->Rinv(), expected_bundle.Rinv());
+
+  // Projections are performed with the constraints of the new problem.
+  const VectorXd y =
+      VectorXd::LinSpaced(problem_->num_constraint_equations(), -1.0, 5.0);
+  VectorXd gamma(problem_->num_constraint_equations());
+  VectorXd gamma_expected(problem_->num_constraint_equations());
+  bundle_->ProjectImpulses(y, &gamma);
+  expected_bundle.ProjectImpulses(y, &gamma_expected);
+  EXPECT_EQ(gamma, gamma_expected);
+
+  // A problem with a different structure is rejected.
+  std::vector<MatrixXd> A = {MatrixXd::Ones(1, 1), MatrixXd::Ones(2, 2),
+                             MatrixXd::Ones(3, 3)};
+  SapContactProblem<double> other_problem(1.0e-3, std::move(A),
+                                          VectorXd::LinSpaced(6, 1., 6.));
+  other_problem.AddConstraint(std::make_unique<TestConstraint>(0, 2, 1, 1.0));
+  EXPECT_FALSE(other_problem.graph().HasSameTopology(problem_->graph()));
+  EXPECT_THROW(bundle_->UpdateValues(&other_problem, Vector1d(1.0)),
+               std::exception);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
@@ -182,6 +182,63 @@ GTEST_TEST(ContactProblem, AddConstraint) {
   EXPECT_EQ(graph.num_constraint_equations(), 17);
 }
 
+// Unit test the decomposition of a problem into islands. Cliques 0 and 2 are
+// coupled by a constraint, clique 3 only has a constraint with itself and
+// clique 1 does not participate in any constraint.
+GTEST_TEST(ContactProblem, MakeIslandProblems) {
+  const double time_step = 0.01;
+  const std::vector<MatrixXd> A{S22, S33, S44, S22};
+  const VectorXd v_star = VectorXd::LinSpaced(11, 1.0, 11.0);
+  SapContactProblem<double> problem(time_step, A, v_star);
+  problem.AddConstraint(std::make_unique<TestConstraint>(
+      1 /* num_equations */, 3 /* clique */, 2 /* clique_nv */));
+  problem.AddConstraint(std::make_unique<TestConstraint>(
+      3 /* num_equations */, 2 /* first_clique */, 4 /* first_clique_nv */,
+      0 /* second_clique */, 2 /* second_clique_nv */));
+  problem.AddConstraint(std::make_unique<TestConstraint>(
+      2 /* num_equations */, 2 /* clique */, 4 /* clique_nv */));
+
+  const std::vector<SapContactProblem<double>::IslandProblem> islands =
+      problem.MakeIslandProblems();
+  ASSERT_EQ(islands.size(), 2);
+
+  // Island with cliques 0 and 2.
+  const SapContactProblem<double>& island0 = *islands[0].problem;
+  EXPECT_EQ(islands[0].cliques, std::vector<int>({0, 2}));
+  EXPECT_EQ(islands[0].constraints, std::vector<int>({1, 2}));
+  EXPECT_EQ(island0.time_step(), time_step);
+  EXPECT_EQ(island0.num_cliques(), 2);
+  EXPECT_EQ(island0.num_velocities(), 6);
+  EXPECT_EQ(island0.dynamics_matrix(), std::vector<MatrixXd>({S22, S44}));
+  VectorXd expected_v_star(6);
+  expected_v_star << v_star.segment<2>(0), v_star.segment<4>(5);
+  EXPECT_EQ(island0.v_star(), expected_v_star);
+  ASSERT_EQ(island0.num_constraints(), 2);
+  EXPECT_EQ(island0.num_constraint_equations(), 5);
+  EXPECT_EQ(island0.get_constraint(0).first_clique(), 1);
+  EXPECT_EQ(island0.get_constraint(0).second_clique(), 0);
+  EXPECT_EQ(island0.get_constraint(1).num_cliques(), 1);
+  EXPECT_EQ(island0.get_constraint(1).first_clique(), 1);
+
+  // Island with clique 3 only.
+  const SapContactProblem<double>& island1 = *islands[1].problem;
+  EXPECT_EQ(islands[1].cliques, std::vector<int>({3}));
+  EXPECT_EQ(islands[1].constraints, std::vector<int>({0}));
+  EXPECT_EQ(island1.num_velocities(), 2);
+  EXPECT_EQ(island1.v_star(), v_star.tail<2>());
+  ASSERT_EQ(island1.num_constraints(), 1);
+  EXPECT_EQ(island1.get_constraint(0).first_clique(), 0);
+
+  // Clique 1 is not in any island and keeps its free-motion velocities.
+  const std::vector<VectorXd> island_velocities = {
+      VectorXd::Constant(6, -1.0), VectorXd::Constant(2, -2.0)};
+  VectorXd expected_v(11);
+  expected_v << -1.0, -1.0, v_star.segment<3>(2), VectorXd::Constant(4, -1.0),
+      -2.0, -2.0;
+  EXPECT_EQ(problem.CombineIslandVelocities(islands, island_velocities),
+            expected_v);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
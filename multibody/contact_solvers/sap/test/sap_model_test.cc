@@ -30,7 +30,7 @@ class SapModelTester {
 
   template <typename T>
   static const VectorX<T>& delassus_diagonal(const SapModel<T>& model) {
-    return model.const_model_data_.delassus_diagonal;
+    return model.model_data_.delassus_diagonal;
   }
 };
 
@@ -228,6 +228,69 @@ TEST_F(SpringMassTest, EvalMomentumCost) {
   EXPECT_EQ(sap_model_->EvalMomentumCost(*context_), momentum_cost);
 }
 
+// Verifies that the structure of the model is reused for a problem with the
+// same graph and that the model reflects the values of the new problem.
+TEST_F(SpringMassTest, ResetProblemWithSameStructure) {
+  const SapConstraintBundle<double>& bundle =
+      SapModelTester::constraints_bundle(*sap_model_);
+  const double* J_data = bundle.J().get_block(0).data();
+
+  const Vector3d v1(1., 2., 3.);
+  const Vector3d v2(4., 5., 6.);
+  const Vector6d v0 = (Vector6d() << v1, v2).finished();
+  const Vector6d q0 = Vector6d::LinSpaced(6, 0.1, 0.6);
+  std::unique_ptr<SapContactProblem<double>> new_problem =
+      model_.MakeContactProblem(q0, v0);
+  EXPECT_TRUE(sap_model_->ResetProblem(new_problem.get()));
+  sap_problem_ = std::move(new_problem);
+  EXPECT_EQ(&sap_model_->problem(), sap_problem_.get());
+
+  // The bundle and the storage for its Jacobian are reused.
+  EXPECT_EQ(&SapModelTester::constraints_bundle(*sap_model_), &bundle);
+  EXPECT_EQ(bundle.J().get_block(0).data(), J_data);
+
+  // Values are those of the new problem.
+  EXPECT_EQ(sap_model_->num_velocities(), 3);
+  const Vector3d v_star =
+      v1 - model_.time_step() * model_.gravity() * Vector3d::UnitZ();
+  EXPECT_EQ(sap_model_->v_star(), v_star);
+  EXPECT_EQ(sap_model_->p_star(), model_.mass1() * v_star);
+  const SapModel<double> expected_model(sap_problem_.get());
+  const SapConstraintBundle<double>& expected_bundle =
+      SapModelTester::constraints_bundle(expected_model);
+  EXPECT_EQ(bundle.vhat(), expected_bundle.vhat());
+  EXPECT_EQ(bundle.R(), expected_bundle.R());
+  EXPECT_EQ(bundle.J().MakeDenseMatrix(),
+            expected_bundle.J().MakeDenseMatrix());
+
+  // Contexts created before the reset can still be used.
+  const Vector3d v(1., 2., 3.);
+  sap_model_->SetVelocities(v, context_.get());
+  EXPECT_EQ(sap_model_->EvalMomentumGain(*context_),
+            model_.mass1() * (v - v_star));
+}
+
+// Verifies that the model is rebuilt when the graph of the new problem has a
+// different topology.
+TEST_F(SpringMassTest, ResetProblemWithDifferentStructure) {
+  std::unique_ptr<SapContactProblem<double>> new_problem =
+      model_.MakeContactProblem(Vector6d::Zero(), Vector6d::Zero());
+  // Constrain the second mass as well.
+  new_problem->AddConstraint(std::make_unique<SpringConstraint<double>>(
+      1, Vector3d::Zero(), 100.0, 0.1));
+  EXPECT_FALSE(sap_model_->ResetProblem(new_problem.get()));
+  sap_problem_ = std::move(new_problem);
+  EXPECT_EQ(sap_model_->num_cliques(), 2);
+  EXPECT_EQ(sap_model_->num_velocities(), 6);
+  EXPECT_EQ(sap_model_->num_constraints(), 2);
+  EXPECT_EQ(sap_model_->num_constraint_equations(), 6);
+
+  context_ = sap_model_->MakeContext();
+  const Vector6d v = Vector6d::LinSpaced(6, 1.0, 6.0);
+  sap_model_->SetVelocities(v, context_.get());
+  EXPECT_EQ(sap_model_->EvalConstraintVelocities(*context_), v);
+}
+
 // Fake constraint used for unit testing, see DummyModel.
 template <typename T>
 class DummyConstraint final : public SapConstraint<T> {
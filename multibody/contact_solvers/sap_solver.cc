@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "drake/common/profiler.h"
 #include "drake/multibody/contact_solvers/contact_solver_utils.h"
 
 namespace drake {
@@ -31,7 +32,11 @@ ContactSolverStatus SapSolver<T>::SolveWithGuess(
   // User code should only call the solver for problems with constraints.
   // Otherwise the solution is trivially v = v*.
   DRAKE_DEMAND(contact_data.num_contacts() != 0);
-  PreProcessData(time_step, dynamics_data, contact_data, &data_);
+  ScopedProfileTimer timer("SapSolver::SolveWithGuess");
+  {
+    ScopedProfileTimer preprocessing_timer("preprocessing");
+    PreProcessData(time_step, dynamics_data, contact_data, &data_);
+  }
   return DoSolveWithGuess(v_guess, results);
 }
 
@@ -184,7 +189,10 @@ void SapSolver<T>::CalcDelassusDiagonalApproximation(
   // We compute a diagonal approximation to the Delassus operator W. We
   // initialize it to zero and progressively add contributions in an O(n) pass.
   std::vector<Matrix3<T>> W(nc, Matrix3<T>::Zero());
-  for (auto [p, t, Jpt] : J.get_blocks()) {
+  for (int b = 0; b < J.num_blocks(); ++b) {
+    const int p = J.block_row_index(b);
+    const int t = J.block_col_index(b);
+    const auto Jpt = J.get_block(b);
     // Verify assumption that this indeed is a contact Jacobian.
     DRAKE_DEMAND(J.row_start(p) % 3 == 0);
     DRAKE_DEMAND(Jpt.rows() % 3 == 0);
@@ -237,10 +245,10 @@ void SapSolver<T>::PreProcessData(const T& time_step,
   // scaling inv_sqrt_A.
   data->At.clear();
   data->At.reserve(data->A.num_blocks());
-  for (const auto& block : data->A.get_blocks()) {
-    const int t1 = std::get<0>(block);
-    const int t2 = std::get<1>(block);
-    const MatrixX<T>& Aij = std::get<2>(block);
+  for (int b = 0; b < data->A.num_blocks(); ++b) {
+    const int t1 = data->A.block_row_index(b);
+    const int t2 = data->A.block_col_index(b);
+    const auto Aij = data->A.get_block(b);
     // We verify the assumption that M is block diagonal.
     DRAKE_DEMAND(t1 == t2);
     // Each block must be square.
@@ -334,6 +342,40 @@ void SapSolver<T>::CalcStoppingCriteriaResidual(const State& state,
   *momentum_scale = max(p_tilde.norm(), jc_tilde.norm());
 }
 
+template <typename T>
+int SapSolver<T>::CalcImpulsesGuess(VectorX<T>* v) const {
+  DRAKE_DEMAND(v != nullptr);
+  const int nc = data_.nc;
+  if (static_cast<int>(contact_correspondence_.size()) != nc) return 0;
+
+  // Impulses γ₀ for the new problem. Zero for new contacts.
+  const int nc_previous = previous_gamma_.size() / 3;
+  VectorX<T> gamma0 = VectorX<T>::Zero(3 * nc);
+  int num_persistent_contacts = 0;
+  for (int ic = 0; ic < nc; ++ic) {
+    const int ic_previous = contact_correspondence_[ic];
+    if (0 <= ic_previous && ic_previous < nc_previous) {
+      gamma0.template segment<3>(3 * ic) =
+          previous_gamma_.template segment<3>(3 * ic_previous);
+      ++num_persistent_contacts;
+    }
+  }
+  if (num_persistent_contacts == 0) return 0;
+
+  // v = v* + A⁻¹⋅Jᵀ⋅γ₀, computed tree by tree since A is block diagonal.
+  VectorX<T> jc(data_.nv);
+  data_.J.MultiplyByTranspose(gamma0, &jc);
+  *v = data_.v_star;
+  for (int b = 0; b < data_.A.num_blocks(); ++b) {
+    const int t = data_.A.block_row_index(b);
+    const auto At = data_.A.get_block(b);
+    const int start = data_.A.row_start(t);
+    const int nt = At.rows();
+    v->segment(start, nt) += At.ldlt().solve(jc.segment(start, nt));
+  }
+  return num_persistent_contacts;
+}
+
 template <typename T>
 ContactSolverStatus SapSolver<T>::DoSolveWithGuess(
     const VectorX<T>& v_guess, ContactSolverResults<T>* result) {
@@ -354,6 +396,23 @@ ContactSolverStatus SapSolver<double>::DoSolveWithGuess(
 
   state.mutable_v() = v_guess;
 
+  if (parameters_.warm_start_with_impulses) {
+    stats_.guess_cost = EvalCostCache(state).ell;
+    VectorX<double> v_impulses;
+    stats_.num_persistent_contacts = CalcImpulsesGuess(&v_impulses);
+    if (stats_.num_persistent_contacts > 0) {
+      State impulses_state(nv, nc);
+      impulses_state.mutable_v() = v_impulses;
+      stats_.impulses_guess_cost = EvalCostCache(impulses_state).ell;
+      if (stats_.impulses_guess_cost < stats_.guess_cost) {
+        state = std::move(impulses_state);
+        stats_.impulses_guess_used = true;
+      }
+    }
+  }
+  // The correspondence only applies to this solve.
+  contact_correspondence_.clear();
+
   // Start Newton iterations.
   int k = 0;
   double ell_previous = EvalCostCache(state).ell;
@@ -423,6 +482,11 @@ ContactSolverStatus SapSolver<double>::DoSolveWithGuess(
   const VectorX<double>& vc = EvalVelocitiesCache(state).vc;
   const VectorX<double>& gamma = EvalImpulsesCache(state).gamma;
   PackContactResults(data_, state.v(), vc, gamma, results);
+  if (parameters_.warm_start_with_impulses) {
+    previous_gamma_ = gamma;
+  } else {
+    previous_gamma_.resize(0);
+  }
 
   // N.B. If the stopping criteria is satisfied for k = 0, the solver is not
   // even instantiated and no factorizations are performed (the expensive part
@@ -476,6 +540,7 @@ template <typename T>
 std::pair<T, int> SapSolver<T>::PerformBackTrackingLineSearch(
     const State& state, const VectorX<T>& dv) const {
   using std::abs;
+  ScopedProfileTimer timer("line search");
   // Line search parameters.
   const double rho = parameters_.ls_rho;
   const double c = parameters_.ls_c;
@@ -728,6 +793,7 @@ SapSolver<T>::EvalSearchDirectionCache(const State& state) const {
     return state.cache().search_direction_cache();
   typename Cache::SearchDirectionCache& cache =
       state.mutable_cache().mutable_search_direction_cache();
+  ScopedProfileTimer timer("search direction");
 
   // Update search direction dv.
   CallDenseSolver(state, &cache.dv);
@@ -106,6 +106,20 @@ struct SapSolverParameters {
 
   // Tolerance used in impulse soft norms. In Ns.
   double soft_tolerance{1.0e-7};
+
+  // Warm-start with the impulses of the previous solve. When true, the solver
+  // keeps the contact impulses of its last successful solve. If the caller
+  // specifies which contacts persist from that solve with
+  // SapSolver::SetContactCorrespondence(), the solver considers the initial
+  // guess v₀ = v* + A⁻¹⋅Jᵀ⋅γ₀, where γ₀ is formed with the previous impulses of
+  // persistent contacts and zero for new contacts. This guess is consistent
+  // with the balance of momentum for impulses γ₀ and therefore retains the
+  // previous step's regime (stiction, sliding or separation) of persistent
+  // contacts. Since SAP's cost ℓ(v) is convex, of this guess and the guess
+  // provided to SolveWithGuess() the solver starts from the one with the lower
+  // cost. MultibodyPlant::SetContactSolver() provides the correspondence when
+  // the plant runs this solver.
+  bool warm_start_with_impulses{false};
 };
 
 // This class implements the Semi-Analytic Primal (SAP) solver described in
@@ -147,6 +161,10 @@ class SapSolver final : public ContactSolver<T> {
       num_line_search_iters = 0;
       num_impulses_cache_updates = 0;
       num_gradients_cache_updates = 0;
+      num_persistent_contacts = 0;
+      impulses_guess_used = false;
+      guess_cost = NAN;
+      impulses_guess_cost = NAN;
     }
     int num_iters{0};              // Number of Newton iterations.
     int num_line_search_iters{0};  // Total number of line search iterations.
@@ -163,6 +181,21 @@ class SapSolver final : public ContactSolver<T> {
 
     // Indicates if the cost condition was reached.
     bool cost_criterion_reached{false};
+
+    // Warm-start statistics, see SapSolverParameters::warm_start_with_impulses.
+    // The savings of a warm-start can be assessed as the reduction of the
+    // initial cost from guess_cost to impulses_guess_cost, and in the number
+    // of iterations, num_iters.
+
+    // Number of contacts warm-started with the impulses of the previous solve.
+    int num_persistent_contacts{0};
+    // Indicates if the solver started from the guess computed from impulses.
+    bool impulses_guess_used{false};
+    // Cost ℓ(v) at the guess supplied to SolveWithGuess(). Only computed when
+    // warm-starting with impulses is enabled, NaN otherwise.
+    double guess_cost{NAN};
+    // Cost ℓ(v) at the guess computed from impulses, NaN if not computed.
+    double impulses_guess_cost{NAN};
   };
 
   SapSolver() = default;
@@ -195,6 +228,20 @@ class SapSolver final : public ContactSolver<T> {
     parameters_ = parameters;
   }
 
+  // Specifies the correspondence between the contacts of the problem to be
+  // solved by the next call to SolveWithGuess() and the contacts of the problem
+  // solved by the last successful call to SolveWithGuess(). That is,
+  // previous_contact_index[i] is the index of the contact in the previous
+  // problem that persists as the i-th contact of the next problem, or -1 if the
+  // i-th contact is new. Only used when
+  // SapSolverParameters::warm_start_with_impulses is true; see its
+  // documentation for details. The correspondence only applies to the next
+  // call to SolveWithGuess(). It is ignored if its size does not match the
+  // number of contacts of the next problem.
+  void SetContactCorrespondence(std::vector<int> previous_contact_index) {
+    contact_correspondence_ = std::move(previous_contact_index);
+  }
+
   // Returns solver statistics from the last call to SolveWithGuess().
   // Statistics are reset with SolverStats::Reset() on each new call to
   // SolveWithGuess().
@@ -570,6 +617,13 @@ class SapSolver final : public ContactSolver<T> {
   void CalcStoppingCriteriaResidual(const State& state, T* momentum_residual,
                                     T* momentum_scale) const;
 
+  // Computes the guess v = v* + A⁻¹⋅Jᵀ⋅γ₀, with γ₀ the impulses of the previous
+  // solve for the persistent contacts specified by contact_correspondence_, see
+  // SapSolverParameters::warm_start_with_impulses.
+  // @returns the number of persistent contacts. If zero, `v` is not modified.
+  // @pre PreProcessData() has already been called.
+  int CalcImpulsesGuess(VectorX<T>* v) const;
+
   // Solves the contact problem from initial guess `v_guess` into `result`.
   // @pre PreProcessData() has already been called.
   ContactSolverStatus DoSolveWithGuess(const VectorX<T>& v_guess,
@@ -618,6 +672,12 @@ class SapSolver final : public ContactSolver<T> {
 
   SapSolverParameters parameters_;
   PreProcessedData data_;
+  // Impulses of the last successful solve, stored when warm-starting is
+  // enabled, see SapSolverParameters::warm_start_with_impulses.
+  VectorX<T> previous_gamma_;
+  // Correspondence between contacts in the next solve and the last solve, see
+  // SetContactCorrespondence().
+  std::vector<int> contact_correspondence_;
   // Stats are mutable so we can update them from within const methods (e.g.
   // Eval() methods). Nothing in stats is allowed to affect the computation; it
   // is purely a passive observer.
@@ -1,6 +1,8 @@
 #include "drake/multibody/contact_solvers/supernodal_solver.h"
 
 #include <algorithm>
+#include <numeric>
+#include <string>
 #include <utility>
 
 #include "conex/clique_ordering.h"
@@ -271,11 +273,6 @@ void SortTheCliques(std::vector<std::vector<int>>* path) {
   }
 }
 
-// The destructor is defined in the source so we can use an incomplete
-// definition when storing unique pointers of CliqueAssembler within a
-// std::vector.
-SuperNodalSolver::~SuperNodalSolver() {}
-
 // Helper struct for assembling the input to the conex supernodal solver. The
 // variable "cliques" contains the nodes of a "supernodal elimination tree,"
 // also called a "clique tree" or "junction tree". The variables "supernodes"
@@ -309,9 +306,11 @@ struct SparsityData {
   std::vector<std::vector<int>> variable_cliques;
 };
 
+// Each entry of `jacobian_blocks` holds the block row, the block column and
+// the number of columns of a non-zero block of the Jacobian.
 SparsityData GetEliminationOrdering(
     int num_jacobian_row_blocks,
-    const std::vector<BlockMatrixTriplet>& jacobian_blocks) {
+    const std::vector<std::tuple<int, int, int>>& jacobian_blocks) {
   SparsityData clique_data;
   SolverData& data = clique_data.data;
 
@@ -328,7 +327,7 @@ SparsityData GetEliminationOrdering(
   for (const auto& b : jacobian_blocks) {
     int i = std::get<0>(b);
     int j = std::get<1>(b);
-    column_block_sizes[j] = std::get<2>(b).cols();
+    column_block_sizes[j] = std::get<2>(b);
     cliques[i].push_back(j);
     if (j >= num_column_blocks) {
       num_column_blocks = j + 1;
@@ -403,103 +402,315 @@ SparsityData GetEliminationOrdering(
   return clique_data;
 }
 
-void SuperNodalSolver::Initialize(
-    const vector<vector<int>>& cliques, int num_jacobian_row_blocks,
-    const std::vector<BlockMatrixTriplet>& jacobian_blocks,
-    const std::vector<Eigen::MatrixXd>& mass_matrices) {
-  std::vector<int> jacobian_column_block_size =
-      GetJacobianBlockSizesVerifyTriplets(jacobian_blocks);
+struct SuperNodalSymbolicAnalysis::Component {
+  // The block rows of J in this component, in increasing order.
+  std::vector<int> row_blocks;
+  // The scalar variables (columns of J) in this component, in increasing
+  // order. The k-th variable of the component is variables[k] in the full
+  // problem.
+  std::vector<int> variables;
+  // The elimination ordering for the component, in terms of its local
+  // numbering of block rows and variables.
+  SparsityData sparsity;
+};
+
+SuperNodalSymbolicAnalysis::SuperNodalSymbolicAnalysis(
+    int num_jacobian_row_blocks,
+    const std::vector<BlockMatrixTriplet>& jacobian_blocks)
+    : num_jacobian_row_blocks_(num_jacobian_row_blocks) {
+  pattern_.reserve(jacobian_blocks.size());
+  for (const auto& [p, t, Jpt] : jacobian_blocks) {
+    pattern_.push_back({p, t, static_cast<int>(Jpt.rows()),
+                        static_cast<int>(Jpt.cols())});
+  }
   // Will throw an exception if verification fails.
-  VerifyMassMatrixPartitionRefinesJacobianPartition(jacobian_column_block_size,
-                                                    mass_matrices);
+  column_block_sizes_ = GetJacobianBlockSizesVerifyTriplets(jacobian_blocks);
+  row_to_triplets_ =
+      GetRowToTripletMapping(num_jacobian_row_blocks, jacobian_blocks);
+  const int num_column_blocks = column_block_sizes_.size();
+  column_block_starts_ =
+      CumulativeSum(column_block_sizes_, num_column_blocks);
 
-  clique_assemblers_ptrs_.resize(cliques.size());
+  row_block_sizes_.resize(num_jacobian_row_blocks);
+  for (int p = 0; p < num_jacobian_row_blocks; ++p) {
+    if (row_to_triplets_[p].empty()) {
+      throw std::runtime_error(
+          "Invalid Jacobian triplets: no triplet provided for row " +
+          std::to_string(p) + ".");
+    }
+    row_block_sizes_[p] = pattern_[row_to_triplets_[p][0]].rows;
+  }
 
-  vector<vector<int>> row_to_triplet_list =
-      GetRowToTripletMapping(num_jacobian_row_blocks, jacobian_blocks);
-  for (size_t i = 0; i < cliques.size(); ++i) {
-    owned_clique_assemblers_[i] = std::make_unique<CliqueAssembler>();
-    std::vector<MatrixXd> jacobian_blocks_of_row;
-    jacobian_blocks_of_row.reserve(row_to_triplet_list[i].size());
-    for (const auto& j : row_to_triplet_list[i]) {
-      jacobian_blocks_of_row.push_back(std::get<2>(jacobian_blocks[j]));
+  // Two block columns belong to the same component if they share a block
+  // row. We find the components with a union-find over block columns.
+  std::vector<int> root(num_column_blocks);
+  std::iota(root.begin(), root.end(), 0);
+  auto find_root = [&root](int t) {
+    while (root[t] != t) {
+      root[t] = root[root[t]];
+      t = root[t];
+    }
+    return t;
+  };
+  for (const vector<int>& row : row_to_triplets_) {
+    const int first_root = find_root(pattern_[row[0]].col);
+    for (size_t k = 1; k < row.size(); ++k) {
+      root[find_root(pattern_[row[k]].col)] = first_root;
     }
-    owned_clique_assemblers_[i]->Initialize(std::move(jacobian_blocks_of_row));
-    clique_assemblers_ptrs_[i] = owned_clique_assemblers_[i].get();
   }
 
-  const std::vector<int> mass_matrix_starting_columns =
-      GetMassMatrixStartingColumn(mass_matrices);
-  int cnt = 0;
-  for (const auto& c : mass_matrix_starting_columns) {
-    const std::pair<int, int> position = FindPositionInClique(c, cliques);
-    owned_clique_assemblers_[position.first]->AssignMassMatrix(
-        position.second, mass_matrices[cnt]);
-    ++cnt;
+  // Components are numbered in the order of their first block column.
+  std::vector<int> component_of_root(num_column_blocks, -1);
+  component_of_column_block_.resize(num_column_blocks);
+  // For each block column, its index within its component.
+  std::vector<int> local_column_block(num_column_blocks);
+  std::vector<std::vector<int>> component_column_block_sizes;
+  for (int t = 0; t < num_column_blocks; ++t) {
+    int& c = component_of_root[find_root(t)];
+    if (c < 0) {
+      c = components_.size();
+      components_.push_back(std::make_unique<Component>());
+      component_column_block_sizes.emplace_back();
+    }
+    component_of_column_block_[t] = c;
+    local_column_block[t] = component_column_block_sizes[c].size();
+    component_column_block_sizes[c].push_back(column_block_sizes_[t]);
+    for (int k = column_block_starts_[t]; k < column_block_starts_[t + 1];
+         ++k) {
+      components_[c]->variables.push_back(k);
+    }
+  }
+
+  // The pattern of each component, in its local numbering.
+  std::vector<std::vector<std::tuple<int, int, int>>> component_blocks(
+      components_.size());
+  for (int p = 0; p < num_jacobian_row_blocks; ++p) {
+    const BlockPattern& first_block = pattern_[row_to_triplets_[p][0]];
+    const int c = component_of_column_block_[first_block.col];
+    const int local_row = components_[c]->row_blocks.size();
+    components_[c]->row_blocks.push_back(p);
+    for (int k : row_to_triplets_[p]) {
+      const BlockPattern& block = pattern_[k];
+      component_blocks[c].emplace_back(
+          local_row, local_column_block[block.col], block.cols);
+    }
   }
+  for (size_t c = 0; c < components_.size(); ++c) {
+    components_[c]->sparsity = GetEliminationOrdering(
+        components_[c]->row_blocks.size(), component_blocks[c]);
+  }
+}
+
+SuperNodalSymbolicAnalysis::~SuperNodalSymbolicAnalysis() = default;
 
-  // Make connections between clique_assemblers and solver->Assemble().
-  solver_->Bind(clique_assemblers_ptrs_);
+bool SuperNodalSymbolicAnalysis::IsCompatibleWith(
+    int num_jacobian_row_blocks,
+    const std::vector<BlockMatrixTriplet>& jacobian_blocks) const {
+  if (num_jacobian_row_blocks != num_jacobian_row_blocks_ ||
+      jacobian_blocks.size() != pattern_.size()) {
+    return false;
+  }
+  for (size_t k = 0; k < pattern_.size(); ++k) {
+    const auto& [p, t, Jpt] = jacobian_blocks[k];
+    const BlockPattern& block = pattern_[k];
+    if (p != block.row || t != block.col || Jpt.rows() != block.rows ||
+        Jpt.cols() != block.cols) {
+      return false;
+    }
+  }
+  return true;
 }
 
+class SuperNodalSolver::ComponentSolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ComponentSolver)
+
+  // Constructs the solver for the given component of `analysis`.
+  // `mass_matrices` are the blocks of M within this component, in order, and
+  // `mass_matrix_starting_columns` the index of the first column of each of
+  // them in the numbering of the component's variables.
+  ComponentSolver(const SuperNodalSymbolicAnalysis& analysis,
+                  const SuperNodalSymbolicAnalysis::Component& component,
+                  const std::vector<BlockMatrixTriplet>& jacobian_blocks,
+                  const std::vector<const MatrixXd*>& mass_matrices,
+                  const std::vector<int>& mass_matrix_starting_columns)
+      : component_(component) {
+    const SparsityData& clique_data = component.sparsity;
+    solver_ = std::make_unique<::conex::SupernodalKKTSolver>(
+        clique_data.variable_cliques, clique_data.data.num_vars,
+        clique_data.data.order, clique_data.data.supernodes,
+        clique_data.data.separators);
+
+    const int num_rows = component.row_blocks.size();
+    owned_clique_assemblers_.resize(num_rows);
+    clique_assemblers_ptrs_.resize(num_rows);
+    for (int i = 0; i < num_rows; ++i) {
+      owned_clique_assemblers_[i] = std::make_unique<CliqueAssembler>();
+      const vector<int>& triplets =
+          analysis.row_to_triplets_[component.row_blocks[i]];
+      std::vector<MatrixXd> jacobian_blocks_of_row;
+      jacobian_blocks_of_row.reserve(triplets.size());
+      for (const auto& j : triplets) {
+        jacobian_blocks_of_row.push_back(std::get<2>(jacobian_blocks[j]));
+      }
+      owned_clique_assemblers_[i]->Initialize(
+          std::move(jacobian_blocks_of_row));
+      clique_assemblers_ptrs_[i] = owned_clique_assemblers_[i].get();
+    }
+
+    for (size_t k = 0; k < mass_matrices.size(); ++k) {
+      const std::pair<int, int> position = FindPositionInClique(
+          mass_matrix_starting_columns[k], clique_data.variable_cliques);
+      owned_clique_assemblers_[position.first]->AssignMassMatrix(
+          position.second, *mass_matrices[k]);
+    }
+
+    // Make connections between clique_assemblers and solver->Assemble().
+    solver_->Bind(clique_assemblers_ptrs_);
+  }
+
+  const std::vector<int>& variables() const { return component_.variables; }
+
+  // Assembles this component's block of H for the weight matrix G, where
+  // weight_matrix_ranges[p] is the (first, last) range of blocks of G for the
+  // p-th block row of J.
+  void Assemble(const std::vector<MatrixXd>& weight_matrix,
+                const std::vector<std::pair<int, int>>& weight_matrix_ranges) {
+    // We copy these pointers so that SetDenseData (a virtual function
+    // override) can access the weight matrices when solver_->Assemble() is
+    // called below. For safety, we replace these pointers with nullptr when
+    // solver_->Assemble() returns.
+    for (size_t i = 0; i < owned_clique_assemblers_.size(); ++i) {
+      CliqueAssembler& c = *owned_clique_assemblers_[i];
+      const std::pair<int, int>& range =
+          weight_matrix_ranges[component_.row_blocks[i]];
+      c.SetWeightMatrixPointer(&weight_matrix);
+      c.SetWeightMatrixIndex(range.first, range.second);
+    }
+    solver_->Assemble();
+    // Destroy references to argument weight_matrix.
+    for (auto& c : owned_clique_assemblers_) {
+      c->SetWeightMatrixPointer(nullptr);
+    }
+  }
+
+  bool Factor() { return solver_->Factor(); }
+
+  // Solves in place for the component's block of H.
+  void SolveInPlace(Eigen::Map<MatrixXd, Eigen::Aligned>* b) const {
+    solver_->SolveInPlace(b);
+  }
+
+  MatrixXd KKTMatrix() const { return solver_->KKTMatrix(); }
+
+ private:
+  const SuperNodalSymbolicAnalysis::Component& component_;
+  std::unique_ptr<::conex::SupernodalKKTSolver> solver_;
+  // N.B. This array stores pointers to clique assemblers owned by
+  // owned_clique_assemblers_.
+  std::vector<CliqueAssembler*> clique_assemblers_ptrs_;
+  std::vector<std::unique_ptr<CliqueAssembler>> owned_clique_assemblers_;
+};
+
 SuperNodalSolver::SuperNodalSolver(
     int num_jacobian_row_blocks,
     const std::vector<BlockMatrixTriplet>& jacobian_blocks,
-    const std::vector<Eigen::MatrixXd>& mass_matrices)
-    : owned_clique_assemblers_(num_jacobian_row_blocks) {
-  SparsityData clique_data =
-      GetEliminationOrdering(num_jacobian_row_blocks, jacobian_blocks);
-
-  solver_ = std::make_unique<::conex::SupernodalKKTSolver>(
-      clique_data.variable_cliques, clique_data.data.num_vars,
-      clique_data.data.order, clique_data.data.supernodes,
-      clique_data.data.separators);
-
-  Initialize(clique_data.variable_cliques, num_jacobian_row_blocks,
-             jacobian_blocks, mass_matrices);
+    const std::vector<Eigen::MatrixXd>& mass_matrices,
+    std::shared_ptr<const SuperNodalSymbolicAnalysis> symbolic_analysis,
+    Parallelism parallelism)
+    : parallelism_(parallelism) {
+  if (symbolic_analysis == nullptr) {
+    symbolic_analysis = std::make_shared<SuperNodalSymbolicAnalysis>(
+        num_jacobian_row_blocks, jacobian_blocks);
+  } else if (!symbolic_analysis->IsCompatibleWith(num_jacobian_row_blocks,
+                                                  jacobian_blocks)) {
+    throw std::runtime_error(
+        "The symbolic analysis is not compatible with the sparsity pattern of "
+        "the Jacobian.");
+  }
+  symbolic_analysis_ = std::move(symbolic_analysis);
+  const SuperNodalSymbolicAnalysis& analysis = *symbolic_analysis_;
+
+  // Will throw an exception if verification fails.
+  VerifyMassMatrixPartitionRefinesJacobianPartition(
+      analysis.column_block_sizes_, mass_matrices);
+
+  // Distribute the blocks of M among the components. Since the partition
+  // induced by M refines the one induced by J, each block of M belongs to a
+  // single block column of J.
+  const int num_components = analysis.num_components();
+  std::vector<std::vector<const MatrixXd*>> component_mass_matrices(
+      num_components);
+  std::vector<std::vector<int>> component_mass_matrix_starts(num_components);
+  const std::vector<int> mass_matrix_starting_columns =
+      GetMassMatrixStartingColumn(mass_matrices);
+  for (size_t k = 0; k < mass_matrices.size(); ++k) {
+    const int start = mass_matrix_starting_columns[k];
+    const std::vector<int>& column_block_starts = analysis.column_block_starts_;
+    const int t = std::upper_bound(column_block_starts.begin(),
+                                   column_block_starts.end(), start) -
+                  column_block_starts.begin() - 1;
+    const int c = analysis.component_of_column_block_[t];
+    const std::vector<int>& variables = analysis.components_[c]->variables;
+    component_mass_matrices[c].push_back(&mass_matrices[k]);
+    component_mass_matrix_starts[c].push_back(
+        std::lower_bound(variables.begin(), variables.end(), start) -
+        variables.begin());
+  }
+
+  component_solvers_.reserve(num_components);
+  for (int c = 0; c < num_components; ++c) {
+    component_solvers_.push_back(std::make_unique<ComponentSolver>(
+        analysis, *analysis.components_[c], jacobian_blocks,
+        component_mass_matrices[c], component_mass_matrix_starts[c]));
+  }
 }
 
+// The destructor is defined in the source so we can use an incomplete
+// definition when storing unique pointers of CliqueAssembler and
+// ComponentSolver within a std::vector.
+SuperNodalSolver::~SuperNodalSolver() {}
+
 void SuperNodalSolver::SetWeightMatrix(
     const std::vector<Eigen::MatrixXd>& weight_matrix) {
-  // We copy these pointers so that SetDenseData (a virtual function override)
-  // can access the weight matrices when solver_->Assemble() is called
-  // below. For safety, we replace these pointers with nullptr when
-  // solver_->Assemble() returns.
-  for (auto& c : owned_clique_assemblers_) {
-    c->SetWeightMatrixPointer(&weight_matrix);
-  }
+  const SuperNodalSymbolicAnalysis& analysis = *symbolic_analysis_;
 
+  // Find the range of blocks of G for each block row of J.
+  const int num_weight_blocks = weight_matrix.size();
+  std::vector<std::pair<int, int>> weight_matrix_ranges(
+      analysis.num_jacobian_row_blocks_);
   int e_last = -1;
   bool weight_matrix_incompatible = false;
-  for (auto& c : owned_clique_assemblers_) {
-    int num_rows = c->NumRows();
-    int s = e_last + 1;
+  for (int p = 0; p < analysis.num_jacobian_row_blocks_; ++p) {
+    const int num_rows = analysis.row_block_sizes_[p];
+    const int s = e_last + 1;
+    if (s >= num_weight_blocks) {
+      weight_matrix_incompatible = true;
+      break;
+    }
     int e = s;
     int num_rows_found = weight_matrix[e].rows();
-    while (num_rows_found < num_rows) {
+    while (num_rows_found < num_rows && e + 1 < num_weight_blocks) {
       ++e;
       num_rows_found += weight_matrix[e].rows();
     }
     if (num_rows_found != num_rows) {
       weight_matrix_incompatible = true;
+      break;
     }
     e_last = e;
-    c->SetWeightMatrixIndex(s, e);
-  }
-
-  if (!weight_matrix_incompatible) {
-    solver_->Assemble();
+    weight_matrix_ranges[p] = {s, e};
   }
-
-  // Destroy references to argument weight_matrix.
-  for (auto& c : owned_clique_assemblers_) {
-    c->SetWeightMatrixPointer(nullptr);
-  }
-
   if (weight_matrix_incompatible) {
     throw std::runtime_error("Weight matrix incompatible with Jacobian.");
   }
 
+  const int num_components = component_solvers_.size();
+  StaticParallelForIndexLoop(
+      parallelism_, 0, num_components, [&](int, int c) {
+        component_solvers_[c]->Assemble(weight_matrix, weight_matrix_ranges);
+      });
+
   factorization_ready_ = false;
   matrix_ready_ = true;
 }
@@ -508,22 +719,24 @@ bool SuperNodalSolver::Factor() {
   if (!matrix_ready_) {
     throw std::runtime_error("Call to Factor() failed: weight matrix not set.");
   }
-  bool success = solver_->Factor();
-  factorization_ready_ = success;
+  // N.B. We avoid std::vector<bool>, whose elements cannot be written to
+  // concurrently.
+  const int num_components = component_solvers_.size();
+  std::vector<int> success(num_components);
+  StaticParallelForIndexLoop(
+      parallelism_, 0, num_components, [&](int, int c) {
+        success[c] = component_solvers_[c]->Factor();
+      });
+  const bool all_succeeded =
+      std::all_of(success.begin(), success.end(), [](int s) { return s; });
+  factorization_ready_ = all_succeeded;
   matrix_ready_ = false;
-  return success;
+  return all_succeeded;
 }
 
 Eigen::VectorXd SuperNodalSolver::Solve(const Eigen::VectorXd& b) const {
-  if (!factorization_ready_) {
-    throw std::runtime_error(
-        "Call to Solve() failed: factorization not ready.");
-  }
   Eigen::VectorXd y = b;
-  // The supernodal solver uses a mapped MatrixXd as input, so we create this
-  // map.
-  Eigen::Map<MatrixXd, Eigen::Aligned> ymap(y.data(), b.rows(), 1);
-  solver_->SolveInPlace(&ymap);
+  SolveInPlace(&y);
   return y;
 }
 
@@ -532,8 +745,28 @@ void SuperNodalSolver::SolveInPlace(Eigen::VectorXd* b) const {
     throw std::runtime_error(
         "Call to Solve() failed: factorization not ready.");
   }
-  Eigen::Map<MatrixXd, Eigen::Aligned> ymap(b->data(), b->rows(), 1);
-  solver_->SolveInPlace(&ymap);
+  // The supernodal solver uses a mapped MatrixXd as input, so we create this
+  // map.
+  if (component_solvers_.size() == 1) {
+    Eigen::Map<MatrixXd, Eigen::Aligned> ymap(b->data(), b->rows(), 1);
+    component_solvers_[0]->SolveInPlace(&ymap);
+    return;
+  }
+  // Each component reads and writes a disjoint subset of the entries of b.
+  const int num_components = component_solvers_.size();
+  StaticParallelForIndexLoop(
+      parallelism_, 0, num_components, [&](int, int c) {
+        const std::vector<int>& variables = component_solvers_[c]->variables();
+        Eigen::VectorXd b_c(variables.size());
+        for (size_t k = 0; k < variables.size(); ++k) {
+          b_c(k) = (*b)(variables[k]);
+        }
+        Eigen::Map<MatrixXd, Eigen::Aligned> ymap(b_c.data(), b_c.rows(), 1);
+        component_solvers_[c]->SolveInPlace(&ymap);
+        for (size_t k = 0; k < variables.size(); ++k) {
+          (*b)(variables[k]) = b_c(k);
+        }
+      });
 }
 
 Eigen::MatrixXd SuperNodalSolver::MakeFullMatrix() const {
@@ -542,7 +775,18 @@ Eigen::MatrixXd SuperNodalSolver::MakeFullMatrix() const {
         "Call to MakeFullMatrix() failed: weight matrix not set or matrix has "
         "been factored in place.");
   }
-  return solver_->KKTMatrix();
+  const int num_vars = symbolic_analysis_->column_block_starts_.back();
+  MatrixXd H = MatrixXd::Zero(num_vars, num_vars);
+  for (const auto& component_solver : component_solvers_) {
+    const std::vector<int>& variables = component_solver->variables();
+    const MatrixXd H_c = component_solver->KKTMatrix();
+    for (size_t j = 0; j < variables.size(); ++j) {
+      for (size_t i = 0; i < variables.size(); ++i) {
+        H(variables[i], variables[j]) = H_c(i, j);
+      }
+    }
+  }
+  return H;
 }
 
 void SuperNodalSolver::CliqueAssembler::Initialize(
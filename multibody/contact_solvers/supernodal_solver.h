@@ -8,14 +8,7 @@
 #include <Eigen/Dense>
 
 #include "drake/common/drake_copyable.h"
-
-#ifndef DRAKE_DOXYGEN_CXX
-// Forward declaration to avoid the inclusion of conex's headers within a Drake
-// header.
-namespace conex {
-class SupernodalKKTSolver;
-}
-#endif
+#include "drake/common/parallelism.h"
 
 namespace drake {
 namespace multibody {
@@ -24,29 +17,71 @@ namespace internal {
 
 using BlockMatrixTriplet = std::tuple<int, int, Eigen::MatrixXd>;
 
-// A supernodal Cholesky solver for solving the symmetric positive definite
-// system
-//   H⋅x = b
-// where H = M + Jᵀ G J. The matrices M and J are set at construction and the
-// weight matrix G is set with SetWeightMatrix(), which can be called multiple
-// times on a constructed object.
-//
-// Example use case:
-//
-//  SuperNodalSolver solver( ... );
-//  solver.SetWeightMatrix( ... );
-//  solver.Factor();
-//
-//  // Solve H⋅x1 = b1.
-//  x1 = solver.Solve(b1);
-//  // Solve H⋅x2 = b2. This reuses the factorization (important for speed!).
-//  x2 = solver.Solve(b2);
-//
-//  // Update weight matrix and refactor.
-//  solver.SetWeightMatrix( ... );
-//  solver.Factor();
-//  // Solve H⋅x = b using updated factorization.
-//  x = solver.Solve(b);
+// The symbolic analysis of the sparsity of H = M + Jᵀ G J used by
+// SuperNodalSolver: the supernodal elimination ordering, along with the
+// partition of H into independent diagonal blocks (the connected components of
+// the graph in which block columns of J are connected when they share a block
+// row). It only depends on the block sparsity pattern of J, that is, on the
+// block row, block column and size of each of its non-zero blocks. For a
+// contact problem, this pattern only changes when the contact graph (e.g.,
+// SAP's ContactProblemGraph) does. Therefore a single analysis can be shared
+// by the solvers of consecutive time steps for as long as the contact graph
+// does not change, avoiding recomputing the elimination ordering at each time
+// step.
+class SuperNodalSymbolicAnalysis {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SuperNodalSymbolicAnalysis)
+
+  // Analyzes the sparsity pattern of the Jacobian J specified by
+  // `jacobian_blocks`, with `num_jacobian_row_blocks` block rows. Only the
+  // indexes and sizes of the blocks are used, not their values. See
+  // SuperNodalSolver's constructor for the requirements on the blocks and the
+  // exceptions thrown when they are not met.
+  SuperNodalSymbolicAnalysis(
+      int num_jacobian_row_blocks,
+      const std::vector<BlockMatrixTriplet>& jacobian_blocks);
+
+  ~SuperNodalSymbolicAnalysis();
+
+  // Returns `true` if the Jacobian blocks `jacobian_blocks` have the same
+  // sparsity pattern as the blocks used to construct this analysis (in which
+  // case this analysis can be used with them), `false` otherwise.
+  bool IsCompatibleWith(
+      int num_jacobian_row_blocks,
+      const std::vector<BlockMatrixTriplet>& jacobian_blocks) const;
+
+  // The number of independent diagonal blocks of H, each factored
+  // independently of the others.
+  int num_components() const { return static_cast<int>(components_.size()); }
+
+ private:
+  friend class SuperNodalSolver;
+
+  // The block row, block column and size of a block of J.
+  struct BlockPattern {
+    int row{};
+    int col{};
+    int rows{};
+    int cols{};
+  };
+
+  // The data for one of the independent blocks, see the implementation.
+  struct Component;
+
+  int num_jacobian_row_blocks_{};
+  std::vector<BlockPattern> pattern_;
+  std::vector<int> column_block_sizes_;
+  // The index of the first scalar column of each block column of J, followed
+  // by the total number of columns.
+  std::vector<int> column_block_starts_;
+  // Number of rows of each block row of J.
+  std::vector<int> row_block_sizes_;
+  // For each block row of J, the indexes of its triplets sorted by column.
+  std::vector<std::vector<int>> row_to_triplets_;
+  std::vector<int> component_of_column_block_;
+  std::vector<std::unique_ptr<Component>> components_;
+};
+
 class SuperNodalSolver {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SuperNodalSolver)
@@ -76,9 +111,26 @@ class SuperNodalSolver {
   //     num_cols(J₁) =  ∑num_cols(Mₜ), t = 1…n
   //     num_cols(J₃) =  ∑num_cols(Mₜ), t = n+1…nᵥ
   //   If this condition fails, an exception is thrown.
-  SuperNodalSolver(int num_jacobian_row_blocks,
-                   const std::vector<BlockMatrixTriplet>& jacobian_blocks,
-                   const std::vector<Eigen::MatrixXd>& mass_matrices);
+  // @param symbolic_analysis
+  //   The result of the symbolic analysis of the sparsity pattern, typically
+  //   obtained with symbolic_analysis() from a solver constructed with the
+  //   same sparsity pattern (e.g., at a previous time step). If nullptr, the
+  //   analysis is performed at construction. An exception is thrown if the
+  //   analysis is not compatible with `jacobian_blocks`, see
+  //   SuperNodalSymbolicAnalysis::IsCompatibleWith().
+  // @param parallelism
+  //   The maximum number of threads used to assemble and factor (and solve
+  //   with) the independent diagonal blocks of H concurrently. Problems with
+  //   several sets of bodies in contact among themselves but not with each
+  //   other, e.g. several robots each manipulating its own objects, have one
+  //   such block per set.
+  SuperNodalSolver(
+      int num_jacobian_row_blocks,
+      const std::vector<BlockMatrixTriplet>& jacobian_blocks,
+      const std::vector<Eigen::MatrixXd>& mass_matrices,
+      std::shared_ptr<const SuperNodalSymbolicAnalysis> symbolic_analysis =
+          nullptr,
+      Parallelism parallelism = Parallelism::None());
 
   ~SuperNodalSolver();
 
@@ -99,7 +151,8 @@ class SuperNodalSolver {
   // + J^T G J is not positive definite. If failure is encountered, the user
   // should verify that the specified matrix M + J^T G J is positive definite
   // and not poorly conditioned.  Throws if SetWeightMatrix() has not been
-  // called.
+  // called. The independent diagonal blocks of H are factored concurrently,
+  // using up to the number of threads specified at construction.
   bool Factor();
 
   // Solves the system H⋅x = b and returns x.
@@ -110,6 +163,13 @@ class SuperNodalSolver {
   // Throws if Factor() has not been called.
   void SolveInPlace(Eigen::VectorXd* b) const;
 
+  // Returns the symbolic analysis used by this solver, which can be reused to
+  // construct solvers with the same sparsity pattern.
+  const std::shared_ptr<const SuperNodalSymbolicAnalysis>& symbolic_analysis()
+      const {
+    return symbolic_analysis_;
+  }
+
  private:
   // This class is responsible for filling a dense matrix of the form
   // sub_matrix(M) +  Jᵀₚ Gₚ Jₚ where Jₚ is a block row of the Jacobian. Each
@@ -118,19 +178,16 @@ class SuperNodalSolver {
   // sub_matrix(M) = diag(Mₜ₁ Mₜ₂).
   class CliqueAssembler;
 
-  void Initialize(const std::vector<std::vector<int>>& cliques,
-                  int num_jacobian_row_blocks,
-                  const std::vector<BlockMatrixTriplet>& jacobian_blocks,
-                  const std::vector<Eigen::MatrixXd>& mass_matrices);
+  // The supernodal factorization of one of the independent diagonal blocks of
+  // H, see SuperNodalSymbolicAnalysis.
+  class ComponentSolver;
 
   bool factorization_ready_ = false;
   bool matrix_ready_ = false;
 
-  std::unique_ptr<::conex::SupernodalKKTSolver> solver_;
-  // N.B. This array stores pointers to clique assemblers owned by
-  // owned_clique_assemblers_.
-  std::vector<CliqueAssembler*> clique_assemblers_ptrs_;
-  std::vector<std::unique_ptr<CliqueAssembler>> owned_clique_assemblers_;
+  std::shared_ptr<const SuperNodalSymbolicAnalysis> symbolic_analysis_;
+  Parallelism parallelism_;
+  std::vector<std::unique_ptr<ComponentSolver>> component_solvers_;
 };
 
 }  // namespace internal
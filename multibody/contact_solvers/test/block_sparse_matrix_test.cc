@@ -1,5 +1,8 @@
 #include "drake/multibody/contact_solvers/block_sparse_matrix.h"
 
+#include <utility>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -76,14 +79,38 @@ TEST_F(BlockSparseMatrixTest, Sizes) {
 }
 
 TEST_F(BlockSparseMatrixTest, AccessBlocks) {
-  // Here we simply verify that get_block() returns the same matrices at each
-  // entry of get_blocks().
-  EXPECT_EQ(Jblk_.get_blocks().size(), 5u);
+  // Blocks are indexed in the order they were pushed.
+  const std::vector<std::pair<int, int>> expected_indices{
+      {0, 0}, {0, 2}, {1, 2}, {2, 1}, {2, 3}};
   for (int b = 0; b < Jblk_.num_blocks(); ++b) {
-    EXPECT_EQ(Jblk_.get_block(b), std::get<2>(Jblk_.get_blocks()[b]));
+    const auto [ib, jb] = expected_indices[b];
+    EXPECT_EQ(Jblk_.block_row_index(b), ib);
+    EXPECT_EQ(Jblk_.block_col_index(b), jb);
+    EXPECT_EQ(Jblk_.get_block(b),
+              J_.block(Jblk_.row_start(ib), Jblk_.col_start(jb),
+                       Jblk_.block_row_size(ib), Jblk_.block_col_size(jb)));
+  }
+
+  // The values of all blocks are stored back to back.
+  for (int b = 1; b < Jblk_.num_blocks(); ++b) {
+    EXPECT_EQ(Jblk_.get_block(b).data(),
+              Jblk_.get_block(b - 1).data() + Jblk_.get_block(b - 1).size());
   }
 }
 
+// Verifies that the values of a block can be updated in place without
+// changing the structure of the matrix.
+TEST_F(BlockSparseMatrixTest, UpdateBlockValues) {
+  const MatrixXd B = 10.0 * J_.block(3, 3, 4, 2);
+  Jblk_.get_mutable_block(2) = B;
+  EXPECT_EQ(Jblk_.get_block(2), B);
+  EXPECT_EQ(Jblk_.block_row_size(1), 4);
+  EXPECT_EQ(Jblk_.block_col_size(2), 2);
+  MatrixXd J_expected = J_;
+  J_expected.block(3, 3, 4, 2) = B;
+  EXPECT_TRUE(CompareMatrices(Jblk_.MakeDenseMatrix(), J_expected, 0));
+}
+
 // This test verifies that the BlockSparseMatrixBuilder makes the expected
 // block-sparse representation of the matrix J in this test. We also unit test
 // BlockSparseMatrix::MakeDenseMatrix().
@@ -116,6 +143,22 @@ TEST_F(BlockSparseMatrixTest, EmptyColumn) {
                               "No block was specified for column 1.");
 }
 
+// Verifies the builder throws when a block is pushed twice, or when more
+// blocks than the capacity given at construction are pushed.
+TEST_F(BlockSparseMatrixTest, PushBlockErrors) {
+  BlockSparseMatrixBuilder<double> builder(3, 4, 5);
+  builder.PushBlock(0, 0, J_.block(0, 0, 3, 2));
+  builder.PushBlock(0, 2, J_.block(0, 3, 3, 2));
+  builder.PushBlock(1, 2, J_.block(3, 3, 4, 2));
+  DRAKE_EXPECT_THROWS_MESSAGE(builder.PushBlock(0, 2, J_.block(0, 3, 3, 2)),
+                              "Block \\(0, 2\\) already added.");
+  builder.PushBlock(2, 1, J_.block(7, 2, 3, 1));
+  builder.PushBlock(2, 3, J_.block(7, 5, 3, 4));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      builder.PushBlock(1, 0, J_.block(3, 0, 4, 2)),
+      "Exceeded the maximum number of non-zero blocks.*");
+}
+
 TEST_F(BlockSparseMatrixTest, Multiply) {
   VectorXd x(cols_);
   VectorXd y(rows_);
@@ -142,6 +185,83 @@ TEST_F(BlockSparseMatrixTest, Multiply) {
                               std::numeric_limits<double>::epsilon()));
 }
 
+// Verifies that a builder can be reused to update the values of a matrix with
+// an unchanged pattern in place, and to rebuild one whose pattern changed.
+TEST_F(BlockSparseMatrixTest, ReuseBuilder) {
+  BlockSparseMatrixBuilder<double> builder(3, 4, 6);
+  auto push_blocks = [&](const MatrixXd& J) {
+    builder.PushBlock(0, 0, J.block(0, 0, 3, 2));
+    builder.PushBlock(0, 2, J.block(0, 3, 3, 2));
+    builder.PushBlock(1, 2, J.block(3, 3, 4, 2));
+    builder.PushBlock(2, 1, J.block(7, 2, 3, 1));
+    builder.PushBlock(2, 3, J.block(7, 5, 3, 4));
+  };
+  push_blocks(J_);
+  BlockSparseMatrix<double> J;
+  builder.Build(&J);
+  EXPECT_TRUE(CompareMatrices(J.MakeDenseMatrix(), J_, 0));
+
+  // Same pattern, new values: the data stays where it was.
+  const double* data = J.get_block(0).data();
+  builder.Reset();
+  push_blocks(2.0 * J_);
+  builder.Build(&J);
+  EXPECT_EQ(J.get_block(0).data(), data);
+  EXPECT_TRUE(CompareMatrices(J.MakeDenseMatrix(), 2.0 * J_, 0));
+
+  // A different pattern makes a new matrix.
+  builder.Reset();
+  builder.PushBlock(0, 0, J_.block(0, 0, 3, 2));
+  builder.PushBlock(0, 2, J_.block(0, 3, 3, 2));
+  builder.PushBlock(1, 2, J_.block(3, 3, 4, 2));
+  builder.PushBlock(2, 1, J_.block(7, 2, 3, 1));
+  builder.PushBlock(1, 3, J_.block(3, 5, 4, 4));
+  builder.PushBlock(2, 3, J_.block(7, 5, 3, 4));
+  EXPECT_EQ(J.num_blocks(), 5);
+  builder.Build(&J);
+  EXPECT_EQ(J.num_blocks(), 6);
+  EXPECT_TRUE(CompareMatrices(J.MakeDenseMatrix(), J_, 0));
+
+  // A builder can also be reused after Build().
+  builder.Reset();
+  push_blocks(J_);
+  const BlockSparseMatrix<double> J2 = builder.Build();
+  EXPECT_TRUE(CompareMatrices(J2.MakeDenseMatrix(), J_, 0));
+}
+
+// Verifies that the fixed-size products of 3x6 and 3x7 blocks agree with
+// the dense product.
+GTEST_TEST(BlockSparseMatrix, FixedSizeBlocks) {
+  const MatrixXd A = MatrixXd::Random(9, 20);
+  MatrixXd A_sparse = MatrixXd::Zero(9, 20);
+  BlockSparseMatrixBuilder<double> builder(3, 3, 5);
+  // Block columns of size 6, 7 and 7.
+  builder.PushBlock(0, 0, A.block(0, 0, 3, 6));
+  builder.PushBlock(0, 1, A.block(0, 6, 3, 7));
+  builder.PushBlock(1, 2, A.block(3, 13, 3, 7));
+  builder.PushBlock(2, 0, A.block(6, 0, 3, 6));
+  builder.PushBlock(2, 2, A.block(6, 13, 3, 7));
+  const BlockSparseMatrix<double> Ablk = builder.Build();
+  for (int b = 0; b < Ablk.num_blocks(); ++b) {
+    const int ib = Ablk.block_row_index(b);
+    const int jb = Ablk.block_col_index(b);
+    A_sparse.block(Ablk.row_start(ib), Ablk.col_start(jb),
+                   Ablk.block_row_size(ib), Ablk.block_col_size(jb)) =
+        Ablk.get_block(b);
+  }
+  EXPECT_TRUE(CompareMatrices(Ablk.MakeDenseMatrix(), A_sparse, 0));
+
+  const VectorXd x = VectorXd::LinSpaced(20, -1.0, 2.0);
+  VectorXd y(9);
+  Ablk.Multiply(x, &y);
+  EXPECT_TRUE(CompareMatrices(y, A_sparse * x, 1e-14));
+
+  const VectorXd z = VectorXd::LinSpaced(9, 0.5, 3.0);
+  VectorXd w(20);
+  Ablk.MultiplyByTranspose(z, &w);
+  EXPECT_TRUE(CompareMatrices(w, A_sparse.transpose() * z, 1e-14));
+}
+
 // Tests that we allow to overestimate the capacity of non-zero blocks.
 TEST_F(BlockSparseMatrixTest, CapacityOverestimated) {
   // An arbitrary capacity of non-zero blocks estimated to be larger than the
@@ -1,5 +1,6 @@
 #include "drake/multibody/contact_solvers/contact_solver.h"
 
+#include <cmath>
 #include <iostream>
 #include <memory>
 
@@ -8,6 +9,7 @@
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/multibody/contact_solvers/contact_solver_utils.h"
+#include "drake/multibody/contact_solvers/sap_solver.h"
 #include "drake/multibody/contact_solvers/test/multibody_sim_driver.h"
 #include "drake/multibody/plant/contact_results.h"
 
@@ -279,6 +281,57 @@ TEST_F(ParticleTest, Sliding) {
   VerifyGeneralizedContactForces(f_Pc_W_expected);
 }
 
+// MultibodyPlant gives a SapSolver the inverse dynamics it needs and, when it
+// warm-starts with impulses, the correspondence between the contacts of
+// consecutive discrete updates.
+GTEST_TEST(SapSolverInPlant, WarmStartWithImpulses) {
+  const double kStiffness = 1.0e4;
+  const double kMass = 0.5;
+  const double kWeight = 5.0;  // The driver sets g = 10 m/s².
+  MultibodySimDriver driver;
+  driver.BuildModel(1.0e-3,
+                    "drake/multibody/contact_solvers/test/"
+                    "particle_with_infinite_inertia.sdf");
+  const auto& particle = driver.plant().GetBodyByName("particle");
+  const double mu = driver.GetDynamicFrictionCoefficients(particle)[0];
+  driver.AddGround(kStiffness, 0.0 /* damping */, mu);
+  driver.Initialize();
+  ASSERT_NEAR(particle.get_default_mass(), kMass, kEpsilon);
+
+  auto solver = std::make_unique<SapSolver<double>>();
+  SapSolverParameters parameters;
+  parameters.warm_start_with_impulses = true;
+  solver->set_parameters(parameters);
+  const SapSolver<double>& sap = *solver;
+  driver.mutable_plant().SetContactSolver(std::move(solver));
+
+  // The particle rests on the ground, in stiction under a tangential force
+  // below μ times its weight.
+  const MultibodyPlant<double>& plant = driver.plant();
+  systems::Context<double>& context = driver.mutable_plant_context();
+  plant.SetFreeBodyPose(
+      &context, particle,
+      RigidTransformd(Vector3d(0, 0, -kWeight / kStiffness)));
+  plant.SetFreeBodySpatialVelocity(&context, particle,
+                                   SpatialVelocity<double>::Zero());
+  driver.FixAppliedForce(particle, Vector3d(0.5 * mu * kWeight, 0.0, 0.0));
+
+  std::unique_ptr<systems::DiscreteValues<double>> updates =
+      plant.AllocateDiscreteVariables();
+  for (int step = 0; step < 5; ++step) {
+    plant.CalcDiscreteVariableUpdates(context, updates.get());
+    context.SetDiscreteState(updates->value());
+    const SapSolver<double>::SolverStats& stats = sap.get_statistics();
+    // The first solve has no previous impulses. The single contact persists
+    // afterwards.
+    EXPECT_EQ(stats.num_persistent_contacts, step == 0 ? 0 : 1);
+    EXPECT_EQ(std::isnan(stats.impulses_guess_cost), step == 0);
+    const Vector3d v_WP =
+        plant.EvalBodySpatialVelocityInWorld(context, particle).translational();
+    EXPECT_LT(v_WP.head<2>().norm(), 1.0e-3);
+  }
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
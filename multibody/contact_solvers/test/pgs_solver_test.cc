@@ -197,6 +197,117 @@ TEST_F(PgsTest, NoContact) {
       CompareMatrices(result.tau_contact, Vector3<double>::Zero(), kTol));
   VerifySolverStats();
 }
+/* A row of particles resting on the ground, each also in contact with its
+ neighbors, all moving toward the ground. Every contact point is
+ coupled to the others that share a particle with it, so the contacts require
+ several colors. */
+class PgsRowOfParticlesTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const int nv = 3 * kNumParticles;
+    const int nc = 2 * kNumParticles - 1;
+    std::vector<Triplet> triplets;
+    // Contacts between neighbors, with relative velocity v(p+1) - v(p).
+    for (int p = 0; p + 1 < kNumParticles; ++p) {
+      for (int d = 0; d < 3; ++d) {
+        triplets.emplace_back(3 * p + d, 3 * (p + 1) + d, 1);
+        triplets.emplace_back(3 * p + d, 3 * p + d, -1);
+      }
+    }
+    // Contacts with the ground.
+    for (int p = 0; p < kNumParticles; ++p) {
+      const int row = 3 * (kNumParticles - 1 + p);
+      for (int d = 0; d < 3; ++d) triplets.emplace_back(row + d, 3 * p + d, 1);
+    }
+    jacobian_.resize(3 * nc, nv);
+    jacobian_.setFromTriplets(triplets.begin(), triplets.end());
+    Jc_ = std::make_unique<SparseLinearOperator<double>>("Jc", &jacobian_);
+
+    triplets.clear();
+    for (int i = 0; i < nv; ++i) triplets.emplace_back(i, i, 1.0 / (1 + i / 3));
+    Ainv_matrix_.resize(nv, nv);
+    Ainv_matrix_.setFromTriplets(triplets.begin(), triplets.end());
+    Ainv_ = std::make_unique<SparseLinearOperator<double>>("Ainv",
+                                                           &Ainv_matrix_);
+    v_star_ = VectorXd::LinSpaced(nv, -1, -2);
+    dynamics_data_ =
+        std::make_unique<SystemDynamicsData<double>>(Ainv_.get(), &v_star_);
+
+    // Stiffness, dissipation and penetration depth are not used by PGS.
+    unused_ = VectorXd::Constant(nc, NAN);
+    mu_ = VectorXd::Constant(nc, 1000);
+    point_data_ = std::make_unique<PointContactData<double>>(
+        &unused_, Jc_.get(), &unused_, &unused_, &mu_);
+  }
+
+  ContactSolverStatus Solve(const PgsSolverParameters& parameters,
+                            ContactSolverResults<double>* result) {
+    PgsSolver<double> pgs;
+    pgs.set_parameters(parameters);
+    const ContactSolverStatus status = pgs.SolveWithGuess(
+        NAN, *dynamics_data_, *point_data_, v_star_, result);
+    stats_ = pgs.get_solver_stats();
+    return status;
+  }
+
+  static constexpr int kNumParticles = 5;
+  SparseMatrixd jacobian_;
+  SparseMatrixd Ainv_matrix_;
+  std::unique_ptr<SparseLinearOperator<double>> Jc_;
+  std::unique_ptr<SparseLinearOperator<double>> Ainv_;
+  std::unique_ptr<SystemDynamicsData<double>> dynamics_data_;
+  std::unique_ptr<PointContactData<double>> point_data_;
+  VectorXd v_star_;
+  VectorXd unused_;
+  VectorXd mu_;
+  PgsSolverStats stats_;
+};
+
+/* The colored sweeps converge to the same (sticking) velocities as the
+ sequential sweep, and their result does not depend on the number of threads.
+*/
+TEST_F(PgsRowOfParticlesTest, Coloring) {
+  PgsSolverParameters parameters;
+  parameters.abs_tolerance = 1e-10;
+  parameters.rel_tolerance = 1e-10;
+  parameters.max_iterations = 1000;
+  ContactSolverResults<double> sequential;
+  ASSERT_EQ(Solve(parameters, &sequential), ContactSolverStatus::kSuccess);
+  EXPECT_TRUE(CompareMatrices(sequential.v_next,
+                              VectorXd::Zero(3 * kNumParticles), 1e-8));
+
+  parameters.use_coloring = true;
+  ContactSolverResults<double> colored;
+  ASSERT_EQ(Solve(parameters, &colored), ContactSolverStatus::kSuccess);
+  const int colored_iterations = stats_.iterations;
+  EXPECT_TRUE(CompareMatrices(colored.v_next, sequential.v_next, 1e-8));
+
+  parameters.parallelism = Parallelism(3);
+  ContactSolverResults<double> parallel;
+  ASSERT_EQ(Solve(parameters, &parallel), ContactSolverStatus::kSuccess);
+  EXPECT_EQ(stats_.iterations, colored_iterations);
+  EXPECT_TRUE(CompareMatrices(parallel.v_next, colored.v_next, 0));
+  EXPECT_TRUE(CompareMatrices(parallel.fn, colored.fn, 0));
+  EXPECT_TRUE(CompareMatrices(parallel.ft, colored.ft, 0));
+}
+
+/* Without convergence checks, the solver runs exactly max_iterations
+ iterations and reports success. A single iteration never converges, since the
+ impulses change from their initial zero values. */
+TEST_F(PgsRowOfParticlesTest, FixedIterationBudget) {
+  PgsSolverParameters parameters;
+  parameters.max_iterations = 1;
+  ContactSolverResults<double> result;
+  EXPECT_EQ(Solve(parameters, &result), ContactSolverStatus::kFailure);
+  EXPECT_EQ(stats_.iterations, 1);
+
+  parameters.check_convergence = false;
+  EXPECT_EQ(Solve(parameters, &result), ContactSolverStatus::kSuccess);
+  EXPECT_EQ(stats_.iterations, 1);
+  // The errors of the last iteration are still reported.
+  EXPECT_GT(stats_.gamma_err, 0);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
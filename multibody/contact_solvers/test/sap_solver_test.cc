@@ -660,6 +660,67 @@ GTEST_TEST(PizzaSaver, Stiction) {
   VerifyStictionSolution(params, relative_tolerance, cost_criterion_reached);
 }
 
+// Advances a stiction problem with the solver warm-started with the previous
+// velocities and, when requested, with the previous impulses. The three
+// contacts of the pizza saver persist throughout the simulation. Returns the
+// total number of Newton iterations.
+int AdvanceStictionProblem(bool warm_start_with_impulses,
+                           ContactSolverResults<double>* result) {
+  PizzaSaverProblem problem = MakeStictionProblem();
+  SapSolverParameters params;
+  params.beta = 0;  // No near-rigid regime.
+  params.warm_start_with_impulses = warm_start_with_impulses;
+  SapSolver<double> sap;
+  sap.set_parameters(params);
+
+  const double Mz = 20.0;
+  const Vector4d tau(0.0, 0.0, -problem.mass() * problem.g(), Mz);
+  VectorXd q = Vector4d(0.0, 0.0, 0.0, M_PI / 5);
+  VectorXd v = VectorXd::Zero(problem.kNumVelocities);
+  int num_iters = 0;
+  for (int i = 0; i < 40; ++i) {
+    const auto data = problem.MakeProblemData(q, v, tau);
+    sap.SetContactCorrespondence({0, 1, 2});
+    const ContactSolverStatus status = sap.SolveWithGuess(
+        problem.time_step(), *data->dynamics_data, *data->contact_data, v,
+        result);
+    EXPECT_EQ(status, ContactSolverStatus::kSuccess);
+    v = result->v_next;
+    q += problem.time_step() * v;
+
+    const SapSolver<double>::SolverStats& stats = sap.get_statistics();
+    num_iters += stats.num_iters;
+    if (!warm_start_with_impulses) {
+      EXPECT_EQ(stats.num_persistent_contacts, 0);
+      EXPECT_FALSE(stats.impulses_guess_used);
+      EXPECT_TRUE(std::isnan(stats.guess_cost));
+    } else if (i == 0) {
+      // There are no impulses from a previous solve.
+      EXPECT_EQ(stats.num_persistent_contacts, 0);
+      EXPECT_TRUE(std::isnan(stats.impulses_guess_cost));
+    } else {
+      EXPECT_EQ(stats.num_persistent_contacts, 3);
+      EXPECT_FALSE(std::isnan(stats.impulses_guess_cost));
+      // The guess with the lowest cost is used.
+      EXPECT_EQ(stats.impulses_guess_used,
+                stats.impulses_guess_cost < stats.guess_cost);
+    }
+  }
+  return num_iters;
+}
+
+// Verifies that warm-starting with the previous impulses leads to the same
+// solution in fewer iterations.
+GTEST_TEST(PizzaSaver, WarmStartWithImpulses) {
+  ContactSolverResults<double> cold_result;
+  const int cold_iters = AdvanceStictionProblem(false, &cold_result);
+  ContactSolverResults<double> warm_result;
+  const int warm_iters = AdvanceStictionProblem(true, &warm_result);
+  EXPECT_LT(warm_iters, cold_iters);
+  EXPECT_TRUE(CompareMatrices(warm_result.tau_contact, cold_result.tau_contact,
+                              1.0e-5, MatrixCompareType::relative));
+}
+
 // We set a very tight optimality tolerance. The solver won't be able to reach
 // these tolerances. However, it will reach the optimal solution within
 // round-off errors. This is the best the solver could do. It makes sense that
@@ -1,5 +1,6 @@
 #include "drake/multibody/contact_solvers/supernodal_solver.h"
 
+#include <cmath>
 #include <tuple>
 
 #include <gtest/gtest.h>
@@ -637,6 +638,92 @@ GTEST_TEST(SupernodalSolver, ColumnSizesDifferent) {
   EXPECT_NEAR((solver.MakeFullMatrix() - full_matrix_ref).norm(), 0, 1e-15);
 }
 
+// Four trees of two dofs each, in three groups that are not in contact with
+// each other: {0, 2}, {1} and {3}. We verify that the independent blocks of H
+// are factored (concurrently) and solved correctly and that the symbolic
+// analysis can be reused for a new Jacobian with the same sparsity pattern.
+GTEST_TEST(SupernodalSolver, ParallelFactorizationAndSymbolicAnalysisReuse) {
+  const int num_row_blocks_of_J = 4;
+  const int nv = 8;
+  const int num_rows = 3 * num_row_blocks_of_J;
+  // Makes the blocks of J, of size 3x2, with values parameterized by `scale`.
+  auto make_jacobian = [&](double scale, MatrixXd* J) {
+    J->setZero(num_rows, nv);
+    std::vector<BlockMatrixTriplet> triplets;
+    const std::vector<std::pair<int, int>> blocks{
+        {0, 2}, {0, 0}, {1, 1}, {2, 3}, {3, 3}};
+    int k = 0;
+    for (const auto& [p, t] : blocks) {
+      MatrixXd Jpt(3, 2);
+      for (int i = 0; i < Jpt.size(); ++i) {
+        Jpt(i) = scale * std::cos(1.0 + k + i);
+      }
+      J->block(3 * p, 2 * t, 3, 2) = Jpt;
+      triplets.push_back({p, t, Jpt});
+      ++k;
+    }
+    return triplets;
+  };
+
+  MatrixXd M = MatrixXd::Zero(nv, nv);
+  std::vector<MatrixXd> blocks_of_M(4);
+  for (int t = 0; t < 4; ++t) {
+    MatrixXd Mt(2, 2);
+    // clang-format off
+    Mt << 2 + t, 1,
+          1,     3;
+    // clang-format on
+    M.block(2 * t, 2 * t, 2, 2) = Mt;
+    blocks_of_M.at(t) = Mt;
+  }
+  MatrixXd G = MatrixXd::Zero(num_rows, num_rows);
+  std::vector<MatrixXd> blocks_of_G(num_row_blocks_of_J);
+  for (int p = 0; p < num_row_blocks_of_J; ++p) {
+    const MatrixXd Gp = (p + 1.0) * MatrixXd::Identity(3, 3);
+    G.block(3 * p, 3 * p, 3, 3) = Gp;
+    blocks_of_G.at(p) = Gp;
+  }
+
+  MatrixXd J;
+  const std::vector<BlockMatrixTriplet> Jtriplets = make_jacobian(1.0, &J);
+  SuperNodalSolver solver(num_row_blocks_of_J, Jtriplets, blocks_of_M,
+                          nullptr, Parallelism(2));
+  ASSERT_NE(solver.symbolic_analysis(), nullptr);
+  EXPECT_EQ(solver.symbolic_analysis()->num_components(), 3);
+  solver.SetWeightMatrix(blocks_of_G);
+  const MatrixXd H = M + J.transpose() * G * J;
+  EXPECT_NEAR((solver.MakeFullMatrix() - H).norm(), 0, 1e-14);
+  ASSERT_TRUE(solver.Factor());
+  const VectorXd x_ref = VectorXd::LinSpaced(nv, -1, 1);
+  EXPECT_NEAR((solver.Solve(H * x_ref) - x_ref).norm(), 0, 1e-12);
+
+  // Reuse the symbolic analysis for a Jacobian with new values.
+  MatrixXd J2;
+  const std::vector<BlockMatrixTriplet> Jtriplets2 = make_jacobian(2.0, &J2);
+  EXPECT_TRUE(solver.symbolic_analysis()->IsCompatibleWith(num_row_blocks_of_J,
+                                                           Jtriplets2));
+  SuperNodalSolver solver2(num_row_blocks_of_J, Jtriplets2, blocks_of_M,
+                           solver.symbolic_analysis(), Parallelism(2));
+  EXPECT_EQ(solver2.symbolic_analysis(), solver.symbolic_analysis());
+  solver2.SetWeightMatrix(blocks_of_G);
+  const MatrixXd H2 = M + J2.transpose() * G * J2;
+  ASSERT_TRUE(solver2.Factor());
+  VectorXd b = H2 * x_ref;
+  solver2.SolveInPlace(&b);
+  EXPECT_NEAR((b - x_ref).norm(), 0, 1e-12);
+
+  // The analysis cannot be used with a different sparsity pattern.
+  std::vector<BlockMatrixTriplet> different_triplets = Jtriplets;
+  std::get<1>(different_triplets.back()) = 1;
+  EXPECT_FALSE(solver.symbolic_analysis()->IsCompatibleWith(
+      num_row_blocks_of_J, different_triplets));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SuperNodalSolver(num_row_blocks_of_J, different_triplets, blocks_of_M,
+                       solver.symbolic_analysis()),
+      "The symbolic analysis is not compatible with the sparsity pattern of "
+      "the Jacobian.");
+}
+
 }  // namespace internal
 }  // namespace contact_solvers
 }  // namespace multibody
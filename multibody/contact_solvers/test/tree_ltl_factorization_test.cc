@@ -0,0 +1,145 @@
+#include "drake/multibody/contact_solvers/tree_ltl_factorization.h"
+
+#include <cmath>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/autodiff_gradient.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+constexpr double kEpsilon = std::numeric_limits<double>::epsilon();
+
+// The parent array of a forest with two trees. The first tree emulates a
+// mobile base (a chain of three velocities) carrying two arms of two
+// velocities each. The second tree is a single pendulum.
+//
+//   0 - 1 - 2 - 3 - 4
+//           |
+//           5 - 6
+//   7
+const std::vector<int> kParents{-1, 0, 1, 2, 3, 2, 5, -1};
+
+// Makes a symmetric positive definite matrix with the sparsity pattern induced
+// by `parents`, in the form A = Lᵀ⋅L with L the (dense) lower triangular matrix
+// with L(i, j) non-zero only for j equal to i or an ancestor of i.
+MatrixXd MakeTreeSparseMatrix(const std::vector<int>& parents) {
+  const int n = parents.size();
+  MatrixXd L = MatrixXd::Zero(n, n);
+  for (int i = 0; i < n; ++i) {
+    L(i, i) = 2.0 + 0.1 * i;
+    for (int j = parents[i]; j >= 0; j = parents[j]) {
+      L(i, j) = 0.3 * std::sin(1.0 + i + 2.0 * j);
+    }
+  }
+  return L.transpose() * L;
+}
+
+GTEST_TEST(TreeLtlFactorization, Construction) {
+  const TreeLtlFactorization<double> dut(kParents);
+  EXPECT_EQ(dut.size(), 8);
+  EXPECT_EQ(dut.parents(), kParents);
+  // One entry per velocity and one per (velocity, ancestor) pair.
+  EXPECT_EQ(dut.num_nonzeros(), 8 + (0 + 1 + 2 + 3 + 4 + 3 + 4 + 0));
+  EXPECT_FALSE(dut.is_factored());
+
+  DRAKE_EXPECT_THROWS_MESSAGE(TreeLtlFactorization<double>({-1, 1}),
+                              ".*parents_\\[i\\] < i.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(TreeLtlFactorization<double>({-2}),
+                              ".*-1 <= parents_\\[i\\].*");
+}
+
+GTEST_TEST(TreeLtlFactorization, FactorAndSolve) {
+  TreeLtlFactorization<double> dut(kParents);
+  const MatrixXd A = MakeTreeSparseMatrix(kParents);
+  ASSERT_TRUE(dut.Factor(A));
+  EXPECT_TRUE(dut.is_factored());
+
+  // L has no fill-in, A = Lᵀ⋅L.
+  const MatrixXd L = dut.MakeDenseL();
+  EXPECT_TRUE(CompareMatrices(L.transpose() * L, A, 10 * kEpsilon));
+  // The arms are not coupled.
+  EXPECT_EQ(L(5, 3), 0.0);
+  EXPECT_EQ(L(6, 4), 0.0);
+  // Neither are the two trees.
+  EXPECT_EQ(L.row(7).head(7).norm(), 0.0);
+
+  const VectorXd b = VectorXd::LinSpaced(8, -1.0, 2.0);
+  const VectorXd x_expected = A.ldlt().solve(b);
+  EXPECT_TRUE(CompareMatrices(dut.Solve(b), x_expected, 10 * kEpsilon));
+
+  VectorXd Ax;
+  dut.Multiply(x_expected, &Ax);
+  EXPECT_TRUE(CompareMatrices(Ax, b, 10 * kEpsilon));
+
+  // Entries of A outside the sparsity pattern are ignored.
+  MatrixXd A_polluted = A;
+  A_polluted(5, 3) = A_polluted(3, 5) = 100.0;
+  ASSERT_TRUE(dut.Factor(A_polluted));
+  EXPECT_TRUE(CompareMatrices(dut.Solve(b), x_expected, 10 * kEpsilon));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.Factor(MatrixXd::Identity(3, 3)),
+                              ".*A.rows\\(\\) == n.*");
+  VectorXd wrong_size(3);
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.SolveInPlace(&wrong_size),
+                              ".*x->size\\(\\) == n.*");
+}
+
+// The factorization of a matrix with a chain structure (each velocity is the
+// parent of the next one) is the dense Cholesky factorization.
+GTEST_TEST(TreeLtlFactorization, Chain) {
+  const std::vector<int> parents{-1, 0, 1, 2};
+  MatrixXd A = MatrixXd::Constant(4, 4, 1.0);
+  A.diagonal() << 5.0, 4.0, 3.0, 2.0;
+  TreeLtlFactorization<double> dut(parents);
+  ASSERT_TRUE(dut.Factor(A));
+  const VectorXd b = VectorXd::Ones(4);
+  EXPECT_TRUE(CompareMatrices(dut.Solve(b), A.ldlt().solve(b),
+                              10 * kEpsilon));
+}
+
+GTEST_TEST(TreeLtlFactorization, NotPositiveDefinite) {
+  TreeLtlFactorization<double> dut({-1, 0});
+  MatrixXd A(2, 2);
+  A << 1.0, 2.0,
+       2.0, 1.0;
+  EXPECT_FALSE(dut.Factor(A));
+  EXPECT_FALSE(dut.is_factored());
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.Solve(VectorXd::Ones(2)),
+                              ".*is_factored\\(\\).*");
+}
+
+GTEST_TEST(TreeLtlFactorization, AutoDiff) {
+  TreeLtlFactorization<AutoDiffXd> dut(kParents);
+  const MatrixXd A = MakeTreeSparseMatrix(kParents);
+  // Derivatives with respect to a scaling s of A, at s = 1.
+  MatrixX<AutoDiffXd> A_ad = A;
+  for (int i = 0; i < A.size(); ++i) {
+    A_ad(i).derivatives() = Vector1d(A(i));
+  }
+  ASSERT_TRUE(dut.Factor(A_ad));
+  const VectorXd b = VectorXd::LinSpaced(8, -1.0, 2.0);
+  const VectorX<AutoDiffXd> x = dut.Solve(b.cast<AutoDiffXd>());
+  // Since x(s) = A⁻¹⋅b/s, dx/ds = -x at s = 1.
+  const VectorXd x_value = math::ExtractValue(x);
+  EXPECT_TRUE(CompareMatrices(x_value, A.ldlt().solve(b), 10 * kEpsilon));
+  EXPECT_TRUE(CompareMatrices(math::ExtractGradient(x), -x_value,
+                              100 * kEpsilon));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,70 @@
+#include "drake/multibody/contact_solvers/tree_ltl_inverse_operator.h"
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::SparseVector;
+using Eigen::VectorXd;
+
+constexpr double kEpsilon = std::numeric_limits<double>::epsilon();
+
+// A floating base (a chain of three velocities) with two single-velocity
+// branches.
+//   0 - 1 - 2 - 3
+//           |
+//           4
+class TreeLtlInverseOperatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    A_ = MatrixXd::Zero(5, 5);
+    A_.diagonal() << 6.0, 5.0, 4.0, 2.0, 3.0;
+    for (int i = 1; i < 5; ++i) {
+      for (int j = factorization_.parents()[i]; j >= 0;
+           j = factorization_.parents()[j]) {
+        A_(i, j) = A_(j, i) = 0.5;
+      }
+    }
+    ASSERT_TRUE(factorization_.Factor(A_));
+  }
+
+  TreeLtlFactorization<double> factorization_{{-1, 0, 1, 2, 2}};
+  MatrixXd A_;
+};
+
+TEST_F(TreeLtlInverseOperatorTest, Multiply) {
+  const TreeLtlInverseOperator<double> Ainv("Ainv", &factorization_);
+  EXPECT_EQ(Ainv.name(), "Ainv");
+  EXPECT_EQ(Ainv.rows(), 5);
+  EXPECT_EQ(Ainv.cols(), 5);
+
+  const VectorXd x = VectorXd::LinSpaced(5, 1.0, 3.0);
+  const VectorXd y_expected = A_.ldlt().solve(x);
+  VectorXd y(5);
+  Ainv.Multiply(x, &y);
+  EXPECT_TRUE(CompareMatrices(y, y_expected, 10 * kEpsilon));
+  Ainv.MultiplyByTranspose(x, &y);
+  EXPECT_TRUE(CompareMatrices(y, y_expected, 10 * kEpsilon));
+
+  const SparseVector<double> x_sparse = x.sparseView();
+  SparseVector<double> y_sparse(5);
+  Ainv.Multiply(x_sparse, &y_sparse);
+  EXPECT_TRUE(CompareMatrices(VectorXd(y_sparse), y_expected, 10 * kEpsilon));
+  Ainv.MultiplyByTranspose(x_sparse, &y_sparse);
+  EXPECT_TRUE(CompareMatrices(VectorXd(y_sparse), y_expected, 10 * kEpsilon));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
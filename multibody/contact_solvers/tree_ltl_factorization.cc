@@ -0,0 +1,147 @@
+#include "drake/multibody/contact_solvers/tree_ltl_factorization.h"
+
+#include <utility>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+template <typename T>
+TreeLtlFactorization<T>::TreeLtlFactorization(std::vector<int> parents)
+    : parents_(std::move(parents)) {
+  const int n = size();
+  depth_.resize(n);
+  row_start_.resize(n);
+  int nnz = 0;
+  for (int i = 0; i < n; ++i) {
+    DRAKE_THROW_UNLESS(-1 <= parents_[i] && parents_[i] < i);
+    depth_[i] = parents_[i] < 0 ? 0 : depth_[parents_[i]] + 1;
+    row_start_[i] = nnz;
+    nnz += depth_[i] + 1;
+  }
+  L_.resize(nnz);
+}
+
+template <typename T>
+bool TreeLtlFactorization<T>::Factor(const Eigen::Ref<const MatrixX<T>>& A) {
+  using std::sqrt;
+  const int n = size();
+  DRAKE_THROW_UNLESS(A.rows() == n && A.cols() == n);
+  is_factored_ = false;
+
+  // Gather the non-zeros of the lower triangle of A.
+  for (int i = 0; i < n; ++i) {
+    int k = row_start_[i];
+    for (int j = i; j >= 0; j = parents_[j], ++k) {
+      L_[k] = A(i, j);
+    }
+  }
+
+  // Factorize in place, from the leaves to the roots.
+  for (int k = n - 1; k >= 0; --k) {
+    const int rk = row_start_[k];
+    if (!(L_[rk] > 0.0)) return false;
+    L_[rk] = sqrt(L_[rk]);
+    for (int a = 1; a <= depth_[k]; ++a) {
+      L_[rk + a] /= L_[rk];
+    }
+    // Update the rows of the ancestors of k. For the ancestor i at offset a
+    // in row k, entry L(i, j) for the ancestor j of i at offset b >= a in row
+    // k is at offset b - a in row i.
+    int a = 1;
+    for (int i = parents_[k]; i >= 0; i = parents_[i], ++a) {
+      const T L_ki = L_[rk + a];
+      const int ri = row_start_[i];
+      for (int b = a; b <= depth_[k]; ++b) {
+        L_[ri + b - a] -= L_ki * L_[rk + b];
+      }
+    }
+  }
+  is_factored_ = true;
+  return true;
+}
+
+template <typename T>
+void TreeLtlFactorization<T>::SolveInPlace(EigenPtr<VectorX<T>> x) const {
+  DRAKE_THROW_UNLESS(is_factored());
+  DRAKE_THROW_UNLESS(x != nullptr);
+  const int n = size();
+  DRAKE_THROW_UNLESS(x->size() == n);
+
+  // Solve Lᵀ⋅y = b, with y overwriting x.
+  for (int i = n - 1; i >= 0; --i) {
+    int k = row_start_[i];
+    (*x)(i) /= L_[k];
+    for (int j = parents_[i]; j >= 0; j = parents_[j]) {
+      (*x)(j) -= L_[++k] * (*x)(i);
+    }
+  }
+
+  // Solve L⋅x = y.
+  for (int i = 0; i < n; ++i) {
+    int k = row_start_[i];
+    for (int j = parents_[i]; j >= 0; j = parents_[j]) {
+      (*x)(i) -= L_[++k] * (*x)(j);
+    }
+    (*x)(i) /= L_[row_start_[i]];
+  }
+}
+
+template <typename T>
+VectorX<T> TreeLtlFactorization<T>::Solve(
+    const Eigen::Ref<const VectorX<T>>& b) const {
+  VectorX<T> x = b;
+  SolveInPlace(&x);
+  return x;
+}
+
+template <typename T>
+void TreeLtlFactorization<T>::Multiply(const Eigen::Ref<const VectorX<T>>& x,
+                                       VectorX<T>* y) const {
+  DRAKE_THROW_UNLESS(is_factored());
+  const int n = size();
+  DRAKE_THROW_UNLESS(x.size() == n);
+  DRAKE_THROW_UNLESS(y != nullptr);
+
+  // z = L⋅x.
+  VectorX<T> z = VectorX<T>::Zero(n);
+  for (int i = 0; i < n; ++i) {
+    int k = row_start_[i];
+    for (int j = i; j >= 0; j = parents_[j], ++k) {
+      z(i) += L_[k] * x(j);
+    }
+  }
+
+  // y = Lᵀ⋅z.
+  y->setZero(n);
+  for (int i = 0; i < n; ++i) {
+    int k = row_start_[i];
+    for (int j = i; j >= 0; j = parents_[j], ++k) {
+      (*y)(j) += L_[k] * z(i);
+    }
+  }
+}
+
+template <typename T>
+MatrixX<T> TreeLtlFactorization<T>::MakeDenseL() const {
+  DRAKE_THROW_UNLESS(is_factored());
+  const int n = size();
+  MatrixX<T> L = MatrixX<T>::Zero(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = i; j >= 0; j = parents_[j]) {
+      L(i, j) = L_[index(i, j)];
+    }
+  }
+  return L;
+}
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::contact_solvers::internal::TreeLtlFactorization)
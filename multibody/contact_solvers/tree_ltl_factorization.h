@@ -0,0 +1,112 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+// Sparse factorization A = Lᵀ⋅L of a symmetric positive definite matrix A
+// whose sparsity pattern is induced by a kinematic tree, such as the mass
+// matrix of a multibody system, or the matrix M + dt⋅D of its discrete
+// dynamics with diagonal joint damping D. L is lower triangular. This is the
+// "LTL" factorization described in Section 6.5 of [Featherstone, 2008].
+//
+// The sparsity pattern is described by a "parent array" λ of size n such that
+// λ[i] < i, with λ[i] = -1 for the roots of the tree (see
+// MultibodyTreeTopology::GetVelocityParents()). Entry A(i, j) with j < i can
+// only be non-zero if j is an ancestor of i, that is, if j belongs to the
+// sequence λ[i], λ[λ[i]], ... Factorizing A in the order n-1, ..., 0
+// produces no fill-in, and therefore L has the same sparsity pattern as the
+// lower triangle of A. Only the non-zeros of L are stored.
+//
+// For a tree of depth d, the cost of the factorization is O(n⋅d²) and the
+// cost of a solve is O(n⋅d), versus O(n³) and O(n²) for a dense factorization.
+// For branched systems, such as a mobile base carrying a torso and two arms,
+// d is considerably smaller than n. Systems with several trees (each rooted at
+// the world) lead to a block diagonal A, naturally handled by the parent
+// array.
+//
+// - [Featherstone, 2008] Featherstone, R., 2008. Rigid body dynamics
+//                        algorithms. Springer.
+//
+// @tparam_nonsymbolic_scalar
+template <typename T>
+class TreeLtlFactorization {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(TreeLtlFactorization)
+
+  // Constructs a factorization for matrices with sparsity pattern given by the
+  // parent array `parents`. The factorization must be computed with Factor()
+  // before calling Solve().
+  // @throws std::exception if parents[i] is not in [-1, i) for some i.
+  explicit TreeLtlFactorization(std::vector<int> parents);
+
+  // The size n of the (square) factorized matrix.
+  int size() const { return static_cast<int>(parents_.size()); }
+
+  // The parent array provided at construction.
+  const std::vector<int>& parents() const { return parents_; }
+
+  // Returns the number of stored non-zeros in L.
+  int num_nonzeros() const { return static_cast<int>(L_.size()); }
+
+  // Computes the factorization of A. Only the entries A(i, j) in the lower
+  // triangle of A with j equal to i or an ancestor of i are read; all others
+  // are assumed to be zero.
+  // @returns `true` if the factorization succeeded and `false` if A is found
+  // not to be positive definite, in which case is_factored() is false.
+  // @throws std::exception if A is not of size n x n.
+  bool Factor(const Eigen::Ref<const MatrixX<T>>& A);
+
+  // Returns `true` if the last call to Factor() succeeded.
+  bool is_factored() const { return is_factored_; }
+
+  // Solves A⋅x = b in place; on input `x` stores b and on output the solution.
+  // @throws std::exception if is_factored() is false.
+  // @throws std::exception if x is nullptr or not of size n.
+  void SolveInPlace(EigenPtr<VectorX<T>> x) const;
+
+  // Returns the solution of A⋅x = b.
+  // @throws std::exception under the same conditions as SolveInPlace().
+  VectorX<T> Solve(const Eigen::Ref<const VectorX<T>>& b) const;
+
+  // Computes y = A⋅x = Lᵀ⋅L⋅x using the factorization.
+  // @throws std::exception if is_factored() is false.
+  // @throws std::exception if x is not of size n or y is nullptr.
+  void Multiply(const Eigen::Ref<const VectorX<T>>& x, VectorX<T>* y) const;
+
+  // Returns the factor L as a dense matrix, mostly for testing and debugging.
+  // @throws std::exception if is_factored() is false.
+  MatrixX<T> MakeDenseL() const;
+
+ private:
+  // The index in L_ of entry L(i, j), with j equal to i or an ancestor of i.
+  // Each row of L is stored contiguously, starting with the diagonal entry and
+  // followed by the entries for the ancestors of i in the order λ[i],
+  // λ[λ[i]], ... Therefore the entry for j is at an offset equal to the
+  // difference in depth between i and j.
+  int index(int i, int j) const {
+    return row_start_[i] + depth_[i] - depth_[j];
+  }
+
+  std::vector<int> parents_;
+  // The number of ancestors of each node.
+  std::vector<int> depth_;
+  std::vector<int> row_start_;
+  std::vector<T> L_;
+  bool is_factored_{false};
+};
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::contact_solvers::internal::TreeLtlFactorization)
@@ -0,0 +1,39 @@
+#include "drake/multibody/contact_solvers/tree_ltl_inverse_operator.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+template <typename T>
+TreeLtlInverseOperator<T>::TreeLtlInverseOperator(
+    const std::string& name, const TreeLtlFactorization<T>* A_factorization)
+    : LinearOperator<T>(name), A_factorization_(A_factorization) {
+  DRAKE_DEMAND(A_factorization != nullptr);
+  DRAKE_DEMAND(A_factorization->is_factored());
+}
+
+template <typename T>
+void TreeLtlInverseOperator<T>::DoMultiply(
+    const Eigen::Ref<const VectorX<T>>& x, VectorX<T>* y) const {
+  *y = x;
+  A_factorization_->SolveInPlace(y);
+}
+
+template <typename T>
+void TreeLtlInverseOperator<T>::DoMultiply(
+    const Eigen::Ref<const Eigen::SparseVector<T>>& x,
+    Eigen::SparseVector<T>* y) const {
+  // A⁻¹ is in general dense, even when A is sparse.
+  VectorX<T> y_dense = VectorX<T>(x);
+  A_factorization_->SolveInPlace(&y_dense);
+  *y = y_dense.sparseView();
+}
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::contact_solvers::internal::TreeLtlInverseOperator)
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <string>
+
+#include <Eigen/SparseCore>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/contact_solvers/linear_operator.h"
+#include "drake/multibody/contact_solvers/tree_ltl_factorization.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+// A LinearOperator that applies A⁻¹ given a TreeLtlFactorization of A, without
+// ever forming a dense matrix. Typically A is the mass matrix M (or M + dt⋅D)
+// of a multibody system and this operator is the forward dynamics operator
+// Ainv consumed by SystemDynamicsData.
+//
+// Since A is symmetric, so is A⁻¹ and MultiplyByTranspose() is the same as
+// Multiply().
+//
+// @tparam_nonsymbolic_scalar
+template <typename T>
+class TreeLtlInverseOperator final : public LinearOperator<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TreeLtlInverseOperator)
+
+  // Constructs an operator with given `name` implementing A⁻¹ for the
+  // factorization `A_factorization` of A.
+  // This class keeps a reference to `A_factorization` and therefore it is
+  // required that it outlives this object.
+  // @pre A_factorization is not nullptr and A_factorization->is_factored() is
+  // true.
+  TreeLtlInverseOperator(const std::string& name,
+                         const TreeLtlFactorization<T>* A_factorization);
+
+  ~TreeLtlInverseOperator() = default;
+
+  int rows() const final { return A_factorization_->size(); }
+  int cols() const final { return A_factorization_->size(); }
+
+ protected:
+  void DoMultiply(const Eigen::Ref<const VectorX<T>>& x,
+                  VectorX<T>* y) const final;
+
+  void DoMultiply(const Eigen::Ref<const Eigen::SparseVector<T>>& x,
+                  Eigen::SparseVector<T>* y) const final;
+
+  void DoMultiplyByTranspose(const Eigen::Ref<const VectorX<T>>& x,
+                             VectorX<T>* y) const final {
+    DoMultiply(x, y);
+  }
+
+  void DoMultiplyByTranspose(const Eigen::Ref<const Eigen::SparseVector<T>>& x,
+                             Eigen::SparseVector<T>* y) const final {
+    DoMultiply(x, y);
+  }
+
+ private:
+  const TreeLtlFactorization<T>* A_factorization_{nullptr};
+};
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::contact_solvers::internal::TreeLtlInverseOperator)
@@ -0,0 +1,310 @@
+#include "drake/multibody/fem/block_sparse_symmetric_matrix.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+
+using Eigen::Matrix3d;
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using std::vector;
+
+BlockSparseSymmetricMatrix::BlockSparseSymmetricMatrix(
+    const vector<vector<int>>& sparsity_pattern) {
+  const int num_block_rows = sparsity_pattern.size();
+  row_starts_.reserve(num_block_rows + 1);
+  row_starts_.push_back(0);
+  vector<int> row;
+  for (int i = 0; i < num_block_rows; ++i) {
+    row = sparsity_pattern[i];
+    row.push_back(i);
+    std::sort(row.begin(), row.end());
+    row.erase(std::unique(row.begin(), row.end()), row.end());
+    DRAKE_DEMAND(row.front() == i);
+    DRAKE_DEMAND(row.back() < num_block_rows);
+    col_indices_.insert(col_indices_.end(), row.begin(), row.end());
+    row_starts_.push_back(col_indices_.size());
+  }
+  blocks_.resize(col_indices_.size(), Matrix3d::Zero());
+}
+
+int BlockSparseSymmetricMatrix::FindBlock(int block_row, int block_col) const {
+  const auto begin = col_indices_.begin() + row_starts_[block_row];
+  const auto end = col_indices_.begin() + row_starts_[block_row + 1];
+  const auto it = std::lower_bound(begin, end, block_col);
+  if (it == end || *it != block_col) return -1;
+  return it - col_indices_.begin();
+}
+
+void BlockSparseSymmetricMatrix::AddToBlock(const VectorX<int>& block_indices,
+                                            const MatrixX<double>& block) {
+  for (int a = 0; a < block_indices.size(); ++a) {
+    for (int b = 0; b < block_indices.size(); ++b) {
+      const int block_row = block_indices(a);
+      const int block_col = block_indices(b);
+      /* Only the upper triangular blocks are stored. */
+      if (block_row > block_col) continue;
+      const int k = FindBlock(block_row, block_col);
+      DRAKE_ASSERT(k >= 0);
+      blocks_[k] += block.block<3, 3>(3 * a, 3 * b);
+    }
+  }
+}
+
+void BlockSparseSymmetricMatrix::SetZero() {
+  for (Matrix3d& block : blocks_) {
+    block.setZero();
+  }
+}
+
+void BlockSparseSymmetricMatrix::ZeroRowsAndColumns(const vector<int>& indexes,
+                                                    double value) {
+  const std::unordered_set<int> zeroed(indexes.begin(), indexes.end());
+  for (int i = 0; i < num_block_rows(); ++i) {
+    for (int k = row_starts_[i]; k < row_starts_[i + 1]; ++k) {
+      const int j = col_indices_[k];
+      for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+          const int row = 3 * i + r;
+          const int col = 3 * j + c;
+          if (zeroed.count(row) > 0 || zeroed.count(col) > 0) {
+            blocks_[k](r, c) = (row == col) ? value : 0.0;
+          }
+        }
+      }
+    }
+  }
+}
+
+void BlockSparseSymmetricMatrix::Multiply(
+    const Eigen::Ref<const VectorXd>& x, EigenPtr<VectorXd> y) const {
+  DRAKE_DEMAND(y != nullptr);
+  DRAKE_DEMAND(x.size() == cols());
+  DRAKE_DEMAND(y->size() == rows());
+  y->setZero();
+  for (int i = 0; i < num_block_rows(); ++i) {
+    const auto x_i = x.segment<3>(3 * i);
+    Vector3d y_i = blocks_[row_starts_[i]] * x_i;
+    for (int k = row_starts_[i] + 1; k < row_starts_[i + 1]; ++k) {
+      const int j = col_indices_[k];
+      y_i += blocks_[k] * x.segment<3>(3 * j);
+      /* Contribution of the (symmetric) lower triangular block. */
+      y->segment<3>(3 * j) += blocks_[k].transpose() * x_i;
+    }
+    y->segment<3>(3 * i) += y_i;
+  }
+}
+
+vector<Matrix3d> BlockSparseSymmetricMatrix::CalcIncompleteCholesky() const {
+  /* Right-looking block IC(0): U starts as a copy of the upper triangle of A,
+   and updates that fall outside of the sparsity pattern are dropped. */
+  vector<Matrix3d> U = blocks_;
+  for (int i = 0; i < num_block_rows(); ++i) {
+    const Eigen::LLT<Matrix3d> llt(U[row_starts_[i]]);
+    if (llt.info() != Eigen::Success) return {};
+    /* U_ii = Lᵀ where U_ii (before the update) = L Lᵀ. */
+    const Matrix3d L = llt.matrixL();
+    U[row_starts_[i]] = L.transpose();
+    for (int k = row_starts_[i] + 1; k < row_starts_[i + 1]; ++k) {
+      U[k] = L.triangularView<Eigen::Lower>().solve(U[k]);
+    }
+    for (int k1 = row_starts_[i] + 1; k1 < row_starts_[i + 1]; ++k1) {
+      const int j1 = col_indices_[k1];
+      for (int k2 = k1; k2 < row_starts_[i + 1]; ++k2) {
+        const int k = FindBlock(j1, col_indices_[k2]);
+        if (k >= 0) {
+          U[k] -= U[k1].transpose() * U[k2];
+        }
+      }
+    }
+  }
+  return U;
+}
+
+void BlockSparseSymmetricMatrix::SolveInPlace(
+    PreconditionerType preconditioner_type, EigenPtr<VectorXd> b) const {
+  DRAKE_DEMAND(b != nullptr);
+  DRAKE_DEMAND(b->size() == rows());
+  const int n = num_block_rows();
+
+  vector<Matrix3d> U;
+  if (preconditioner_type == PreconditionerType::kIncompleteCholesky) {
+    U = CalcIncompleteCholesky();
+    if (U.empty() && n > 0) {
+      preconditioner_type = PreconditionerType::kBlockJacobi;
+    }
+  }
+  vector<Matrix3d> diagonal_inverses;
+  if (preconditioner_type == PreconditionerType::kBlockJacobi) {
+    diagonal_inverses.resize(n);
+    for (int i = 0; i < n; ++i) {
+      diagonal_inverses[i] = blocks_[row_starts_[i]].inverse();
+    }
+  }
+  /* Computes z = P⁻¹r for the chosen preconditioner P. */
+  auto precondition = [&](const VectorXd& r, VectorXd* z) {
+    switch (preconditioner_type) {
+      case PreconditionerType::kNone:
+        *z = r;
+        return;
+      case PreconditionerType::kBlockJacobi:
+        for (int i = 0; i < n; ++i) {
+          z->segment<3>(3 * i) = diagonal_inverses[i] * r.segment<3>(3 * i);
+        }
+        return;
+      case PreconditionerType::kIncompleteCholesky:
+        /* Forward substitution with Uᵀ followed by backward substitution with
+         U. */
+        *z = r;
+        for (int i = 0; i < n; ++i) {
+          const Matrix3d& U_ii = U[row_starts_[i]];
+          z->segment<3>(3 * i) = U_ii.transpose()
+                                     .triangularView<Eigen::Lower>()
+                                     .solve(z->segment<3>(3 * i));
+          for (int k = row_starts_[i] + 1; k < row_starts_[i + 1]; ++k) {
+            z->segment<3>(3 * col_indices_[k]) -=
+                U[k].transpose() * z->segment<3>(3 * i);
+          }
+        }
+        for (int i = n - 1; i >= 0; --i) {
+          Vector3d z_i = z->segment<3>(3 * i);
+          for (int k = row_starts_[i] + 1; k < row_starts_[i + 1]; ++k) {
+            z_i -= U[k] * z->segment<3>(3 * col_indices_[k]);
+          }
+          z->segment<3>(3 * i) =
+              U[row_starts_[i]].triangularView<Eigen::Upper>().solve(z_i);
+        }
+        return;
+    }
+  };
+
+  const int max_iterations = max_iterations_ > 0 ? max_iterations_ : rows();
+  const double threshold = relative_tolerance_ * b->norm();
+  VectorXd x = VectorXd::Zero(rows());
+  VectorXd r = *b;
+  VectorXd z(rows());
+  VectorXd Ap(rows());
+  precondition(r, &z);
+  VectorXd p = z;
+  double rz = r.dot(z);
+  int iteration = 0;
+  while (iteration < max_iterations && r.norm() > threshold) {
+    Multiply(p, &Ap);
+    const double alpha = rz / p.dot(Ap);
+    x += alpha * p;
+    r -= alpha * Ap;
+    precondition(r, &z);
+    const double rz_next = r.dot(z);
+    p = z + (rz_next / rz) * p;
+    rz = rz_next;
+    ++iteration;
+  }
+  last_num_iterations_ = iteration;
+  *b = x;
+}
+
+VectorXd BlockSparseSymmetricMatrix::Solve(
+    PreconditionerType preconditioner_type, const VectorXd& b) const {
+  VectorXd x = b;
+  SolveInPlace(preconditioner_type, &x);
+  return x;
+}
+
+MatrixXd BlockSparseSymmetricMatrix::MakeDenseMatrix() const {
+  MatrixXd A = MatrixXd::Zero(rows(), cols());
+  for (int i = 0; i < num_block_rows(); ++i) {
+    for (int k = row_starts_[i]; k < row_starts_[i + 1]; ++k) {
+      const int j = col_indices_[k];
+      A.block<3, 3>(3 * i, 3 * j) = blocks_[k];
+      A.block<3, 3>(3 * j, 3 * i) = blocks_[k].transpose();
+    }
+  }
+  return A;
+}
+
+namespace {
+
+/* Appends the triplets of the 3x3 `block` placed at block (i, j). */
+void AppendBlockTriplets(int i, int j, const Matrix3d& block,
+                         vector<Eigen::Triplet<double>>* triplets) {
+  for (int r = 0; r < 3; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      triplets->emplace_back(3 * i + r, 3 * j + c, block(r, c));
+    }
+  }
+}
+
+}  // namespace
+
+Eigen::SparseMatrix<double> BlockSparseSymmetricMatrix::MakeEigenSparseMatrix()
+    const {
+  vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve(2 * 9 * blocks_.size());
+  for (int i = 0; i < num_block_rows(); ++i) {
+    for (int k = row_starts_[i]; k < row_starts_[i + 1]; ++k) {
+      const int j = col_indices_[k];
+      AppendBlockTriplets(i, j, blocks_[k], &triplets);
+      if (i != j) {
+        AppendBlockTriplets(j, i, blocks_[k].transpose(), &triplets);
+      }
+    }
+  }
+  Eigen::SparseMatrix<double> A(rows(), cols());
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  return A;
+}
+
+SchurComplement<double> BlockSparseSymmetricMatrix::CalcSchurComplement(
+    const vector<int>& D_block_indexes,
+    const vector<int>& A_block_indexes) const {
+  /* For each block row of `this` matrix, records whether it belongs to A or D
+   and its block index within that submatrix. */
+  constexpr int kUnused = -1;
+  vector<int> in_A(num_block_rows(), kUnused);
+  vector<int> in_D(num_block_rows(), kUnused);
+  for (int a = 0; a < static_cast<int>(A_block_indexes.size()); ++a) {
+    in_A[A_block_indexes[a]] = a;
+  }
+  for (int d = 0; d < static_cast<int>(D_block_indexes.size()); ++d) {
+    in_D[D_block_indexes[d]] = d;
+  }
+  vector<Eigen::Triplet<double>> A_triplets, B_transpose_triplets, D_triplets;
+  /* Appends block (i, j) of `this` matrix (and its transpose if off-diagonal)
+   to the submatrices it belongs to. */
+  auto append = [&](int i, int j, const Matrix3d& block) {
+    if (in_A[i] != kUnused && in_A[j] != kUnused) {
+      AppendBlockTriplets(in_A[i], in_A[j], block, &A_triplets);
+    } else if (in_D[i] != kUnused && in_D[j] != kUnused) {
+      AppendBlockTriplets(in_D[i], in_D[j], block, &D_triplets);
+    } else if (in_D[i] != kUnused && in_A[j] != kUnused) {
+      AppendBlockTriplets(in_D[i], in_A[j], block, &B_transpose_triplets);
+    }
+  };
+  for (int i = 0; i < num_block_rows(); ++i) {
+    for (int k = row_starts_[i]; k < row_starts_[i + 1]; ++k) {
+      const int j = col_indices_[k];
+      append(i, j, blocks_[k]);
+      if (i != j) {
+        append(j, i, blocks_[k].transpose());
+      }
+    }
+  }
+  const int p = 3 * A_block_indexes.size();
+  const int q = 3 * D_block_indexes.size();
+  Eigen::SparseMatrix<double> A(p, p), B_transpose(q, p), D(q, q);
+  A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+  B_transpose.setFromTriplets(B_transpose_triplets.begin(),
+                              B_transpose_triplets.end());
+  D.setFromTriplets(D_triplets.begin(), D_triplets.end());
+  return SchurComplement<double>(A, B_transpose, D);
+}
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Sparse>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/fem/schur_complement.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+
+/* A symmetric block sparse matrix with 3x3 blocks, stored natively in block
+ compressed sparse row (BCSR) format. Only the diagonal and upper triangular
+ blocks are stored, and the sparsity pattern is fixed at construction. It
+ supports the same operations as PetscSymmetricBlockSparseMatrix (block
+ accumulation, boundary condition application, Schur complement), and solves
+ A*x = b with a preconditioned conjugate gradient method. Unlike
+ PetscSymmetricBlockSparseMatrix, it holds no global state, so distinct
+ instances can be used concurrently from different threads, and there is no
+ "assembled" state to maintain. It only supports double as the scalar type. */
+class BlockSparseSymmetricMatrix {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BlockSparseSymmetricMatrix);
+
+  enum class PreconditionerType {
+    /* No preconditioning. */
+    kNone,
+    /* Inverse of the 3x3 diagonal blocks. */
+    kBlockJacobi,
+    /* Zero fill-in block incomplete Cholesky factorization. Falls back to
+     kBlockJacobi if the factorization breaks down. */
+    kIncompleteCholesky,
+  };
+
+  /* Constructs a symmetric block sparse matrix with all nonzero blocks set to
+   zero.
+   @param sparsity_pattern  `sparsity_pattern[i]` contains the block column
+                            indices j >= i of the nonzero blocks in the i-th
+                            block row. The diagonal block is always allocated
+                            whether or not it is listed, and duplicates are
+                            ignored.
+   @pre 0 <= i <= sparsity_pattern[i][k] < sparsity_pattern.size() for all
+   valid i and k. */
+  explicit BlockSparseSymmetricMatrix(
+      const std::vector<std::vector<int>>& sparsity_pattern);
+
+  /* Accumulates values in the block matrix, with the same semantics as
+   PetscSymmetricBlockSparseMatrix::AddToBlock() with a block size of 3.
+   @pre block is symmetric.
+   @pre block.rows() == block.cols() == 3 * block_indices.size().
+   @pre Every pair of `block_indices` refers to an allocated block. Only checked
+   in debug builds. */
+  void AddToBlock(const VectorX<int>& block_indices,
+                  const MatrixX<double>& block);
+
+  /* Sets all blocks to zeros while maintaining the sparsity pattern. */
+  void SetZero();
+
+  /* Zeros out all rows and columns whose index is included in `indexes` and
+   sets the diagonal entry of these rows and columns to `value`. This operation
+   doesn't change the sparsity pattern.
+   @pre 0 <= indexes[i] < rows() for each i. */
+  void ZeroRowsAndColumns(const std::vector<int>& indexes, double value);
+
+  /* Computes y = A*x where A is this matrix.
+   @pre x.size() == cols(), y != nullptr, and y->size() == rows(). */
+  void Multiply(const Eigen::Ref<const VectorX<double>>& x,
+                EigenPtr<VectorX<double>> y) const;
+
+  /* Solves A*x = b for a positive definite A with the preconditioned conjugate
+   gradient method, starting from x = 0. The iteration stops when
+   ‖b - A*x‖ <= relative_tolerance() * ‖b‖ or after max_iterations().
+   @pre b.size() == rows(). */
+  VectorX<double> Solve(PreconditionerType preconditioner_type,
+                        const VectorX<double>& b) const;
+
+  /* Similar to Solve(), but writes the result in `b`. */
+  void SolveInPlace(PreconditionerType preconditioner_type,
+                    EigenPtr<VectorX<double>> b) const;
+
+  /* Returns the number of iterations taken by the most recent call to Solve()
+   or SolveInPlace(). */
+  int last_num_iterations() const { return last_num_iterations_; }
+
+  void set_relative_tolerance(double tolerance) {
+    relative_tolerance_ = tolerance;
+  }
+  double relative_tolerance() const { return relative_tolerance_; }
+
+  /* Sets the maximum number of conjugate gradient iterations. A nonpositive
+   value (the default) means rows() iterations. */
+  void set_max_iterations(int max_iterations) {
+    max_iterations_ = max_iterations;
+  }
+  int max_iterations() const { return max_iterations_; }
+
+  /* Makes a dense matrix representation of this block-sparse matrix. */
+  MatrixX<double> MakeDenseMatrix() const;
+
+  /* Makes an Eigen sparse matrix representation of this matrix (with both
+   the upper and lower triangular parts populated). */
+  Eigen::SparseMatrix<double> MakeEigenSparseMatrix() const;
+
+  /* Builds the SchurComplement of the D block of this matrix. See
+   PetscSymmetricBlockSparseMatrix::CalcSchurComplement(). */
+  SchurComplement<double> CalcSchurComplement(
+      const std::vector<int>& D_block_indexes,
+      const std::vector<int>& A_block_indexes) const;
+
+  int rows() const { return 3 * num_block_rows(); }
+
+  int cols() const { return rows(); }
+
+  int num_block_rows() const {
+    return static_cast<int>(row_starts_.size()) - 1;
+  }
+
+  /* The number of stored (diagonal and upper triangular) blocks. */
+  int num_blocks() const { return static_cast<int>(blocks_.size()); }
+
+ private:
+  /* Returns the index into `blocks_` of the block at (block_row, block_col),
+   or -1 if it is not allocated.
+   @pre block_row <= block_col. */
+  int FindBlock(int block_row, int block_col) const;
+
+  /* Returns the zero fill-in block incomplete Cholesky factor U (with
+   A ≈ UᵀU) stored in the same pattern as this matrix, or an empty vector if
+   the factorization breaks down. */
+  std::vector<Eigen::Matrix3d> CalcIncompleteCholesky() const;
+
+  /* BCSR storage of the upper triangular blocks. The blocks of block row i are
+   blocks_[row_starts_[i]], ..., blocks_[row_starts_[i + 1] - 1], with block
+   column indices stored in the same positions of `col_indices_` in increasing
+   order. The first block of each row is the diagonal block. */
+  std::vector<int> row_starts_;
+  std::vector<int> col_indices_;
+  std::vector<Eigen::Matrix3d> blocks_;
+
+  double relative_tolerance_{1e-5};
+  int max_iterations_{0};
+  mutable int last_num_iterations_{0};
+};
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
@@ -35,6 +35,19 @@ void DirichletBoundaryCondition<T>::ApplyBoundaryConditionToState(
 template <typename T>
 void DirichletBoundaryCondition<T>::ApplyBoundaryConditionToTangentMatrix(
     internal::PetscSymmetricBlockSparseMatrix* tangent_matrix) const {
+  ApplyBoundaryConditionToTangentMatrixImpl(tangent_matrix);
+}
+
+template <typename T>
+void DirichletBoundaryCondition<T>::ApplyBoundaryConditionToTangentMatrix(
+    internal::BlockSparseSymmetricMatrix* tangent_matrix) const {
+  ApplyBoundaryConditionToTangentMatrixImpl(tangent_matrix);
+}
+
+template <typename T>
+template <typename TangentMatrix>
+void DirichletBoundaryCondition<T>::ApplyBoundaryConditionToTangentMatrixImpl(
+    TangentMatrix* tangent_matrix) const {
   DRAKE_DEMAND(tangent_matrix != nullptr);
   DRAKE_DEMAND(tangent_matrix->rows() == tangent_matrix->cols());
   if (index_to_boundary_state_.empty()) return;
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "drake/common/eigen_types.h"
+#include "drake/multibody/fem/block_sparse_symmetric_matrix.h"
 #include "drake/multibody/fem/fem_state.h"
 #include "drake/multibody/fem/petsc_symmetric_block_sparse_matrix.h"
 
@@ -68,6 +69,11 @@ class DirichletBoundaryCondition {
   void ApplyBoundaryConditionToTangentMatrix(
       PetscSymmetricBlockSparseMatrix* tangent_matrix) const;
 
+  /* Overload of ApplyBoundaryConditionToTangentMatrix() for the native
+   BlockSparseSymmetricMatrix. */
+  void ApplyBoundaryConditionToTangentMatrix(
+      BlockSparseSymmetricMatrix* tangent_matrix) const;
+
   /* Modifies the given vector `v` (e.g, the residual of the system or the
    velocities/positions) that arises from an FEM model without BC into the a
    vector for the same model subject to `this` BC. More specifically, the
@@ -82,6 +88,12 @@ class DirichletBoundaryCondition {
    than or equal to the given `size`. */
   void VerifyIndexes(int size) const;
 
+  /* Implements ApplyBoundaryConditionToTangentMatrix() for both matrix
+   types. */
+  template <typename TangentMatrix>
+  void ApplyBoundaryConditionToTangentMatrixImpl(
+      TangentMatrix* tangent_matrix) const;
+
   /* We sort the boundary conditions according to dof indexes for better
    cache consistency when applying the BC. The value stored is q, v, and a (in
    that order) of the dof under BC. */
@@ -46,12 +46,40 @@ void FemModel<T>::CalcTangentMatrix(
   DoCalcTangentMatrix(fem_state, weights, tangent_matrix);
 }
 
+template <typename T>
+void FemModel<T>::CalcTangentMatrix(
+    const FemState<T>& fem_state, const Vector3<T>& weights,
+    internal::BlockSparseSymmetricMatrix* tangent_matrix) const {
+  DRAKE_DEMAND(tangent_matrix != nullptr);
+  DRAKE_DEMAND(tangent_matrix->rows() == num_dofs());
+  DRAKE_DEMAND(tangent_matrix->cols() == num_dofs());
+  ThrowIfModelDataIncompatible(__func__, fem_state);
+  DoCalcTangentMatrix(fem_state, weights, tangent_matrix);
+}
+
+template <typename T>
+void FemModel<T>::CalcTangentMatrixTimesVector(
+    const FemState<T>& fem_state, const Vector3<T>& weights,
+    const Eigen::Ref<const VectorX<T>>& x, EigenPtr<VectorX<T>> y) const {
+  DRAKE_DEMAND(y != nullptr);
+  DRAKE_DEMAND(x.size() == num_dofs());
+  DRAKE_DEMAND(y->size() == num_dofs());
+  ThrowIfModelDataIncompatible(__func__, fem_state);
+  DoCalcTangentMatrixTimesVector(fem_state, weights, x, y);
+}
+
 template <typename T>
 std::unique_ptr<internal::PetscSymmetricBlockSparseMatrix>
 FemModel<T>::MakePetscSymmetricBlockSparseTangentMatrix() const {
   return DoMakePetscSymmetricBlockSparseTangentMatrix();
 }
 
+template <typename T>
+std::unique_ptr<internal::BlockSparseSymmetricMatrix>
+FemModel<T>::MakeBlockSparseSymmetricTangentMatrix() const {
+  return DoMakeBlockSparseSymmetricTangentMatrix();
+}
+
 template <typename T>
 FemModel<T>::FemModel()
     : fem_state_system_(std::make_unique<internal::FemStateSystem<T>>(
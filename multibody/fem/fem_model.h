@@ -9,6 +9,8 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
+#include "drake/multibody/fem/block_sparse_symmetric_matrix.h"
 #include "drake/multibody/fem/fem_state.h"
 #include "drake/multibody/fem/petsc_symmetric_block_sparse_matrix.h"
 
@@ -158,6 +160,19 @@ class FemModel {
       const FemState<T>& fem_state, const Vector3<T>& weights,
       internal::PetscSymmetricBlockSparseMatrix* tangent_matrix) const;
 
+  /** Calculates y = K*x where K is the tangent matrix evaluated at the given
+   FEM state with the given weights (see CalcTangentMatrix()), without
+   assembling K. Each element's contribution is applied directly to `x`, so
+   no global sparse matrix is formed or stored. This is the building block for
+   matrix-free iterative solvers.
+   @pre x.size() == num_dofs().
+   @pre y != nullptr and y->size() == num_dofs().
+   @throws std::exception if the FEM state is incompatible with this model. */
+  void CalcTangentMatrixTimesVector(const FemState<T>& fem_state,
+                                    const Vector3<T>& weights,
+                                    const Eigen::Ref<const VectorX<T>>& x,
+                                    EigenPtr<VectorX<T>> y) const;
+
   /** Creates a PetscSymmetricBlockSparseMatrix that has the sparsity pattern
    of the tangent matrix of this FEM model. In particular, the size of the
    tangent matrix is `num_dofs()` by `num_dofs()`. All entries are initialized
@@ -165,6 +180,33 @@ class FemModel {
   std::unique_ptr<internal::PetscSymmetricBlockSparseMatrix>
   MakePetscSymmetricBlockSparseTangentMatrix() const;
 
+  /** Similar to the PetscSymmetricBlockSparseMatrix overload, but calculates
+   the tangent matrix into a native BlockSparseSymmetricMatrix.
+   @pre tangent_matrix != nullptr.
+   @pre The size of `tangent_matrix` is `num_dofs()` * `num_dofs()`.
+   @pre The sparsity pattern of `tangent_matrix` contains that of the tangent
+   matrix. See MakeBlockSparseSymmetricTangentMatrix().
+   @throws std::exception if the FEM state is incompatible with this model. */
+  void CalcTangentMatrix(
+      const FemState<T>& fem_state, const Vector3<T>& weights,
+      internal::BlockSparseSymmetricMatrix* tangent_matrix) const;
+
+  /** Creates a BlockSparseSymmetricMatrix that has the sparsity pattern of the
+   tangent matrix of this FEM model. All entries are initialized to zero. */
+  std::unique_ptr<internal::BlockSparseSymmetricMatrix>
+  MakeBlockSparseSymmetricTangentMatrix() const;
+
+  /** Sets the parallelism used to evaluate per-element quantities in
+   CalcResidual(), CalcTangentMatrix() and the element data cache. Elements are
+   grouped into colors such that no two elements of the same color share a
+   node, so that elements within a color can be assembled concurrently. The
+   default is Parallelism::None(), which evaluates the elements serially in the
+   order they were added. */
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  /** Returns the parallelism set by set_parallelism(). */
+  Parallelism parallelism() const { return parallelism_; }
+
  protected:
   /** Constructs an empty FEM model. */
   FemModel();
@@ -192,11 +234,30 @@ class FemModel {
       const FemState<T>& fem_state, const Vector3<T>& weights,
       internal::PetscSymmetricBlockSparseMatrix* tangent_matrix) const = 0;
 
+  /** FemModelImpl must override this method to provide an implementation for
+   the NVI CalcTangentMatrix() that takes a BlockSparseSymmetricMatrix. */
+  virtual void DoCalcTangentMatrix(
+      const FemState<T>& fem_state, const Vector3<T>& weights,
+      internal::BlockSparseSymmetricMatrix* tangent_matrix) const = 0;
+
+  /** FemModelImpl must override this method to provide an implementation for
+   the NVI CalcTangentMatrixTimesVector(). The input `fem_state` is guaranteed
+   to be compatible with `this` FEM model, and the inputs are guaranteed to be
+   properly sized. */
+  virtual void DoCalcTangentMatrixTimesVector(
+      const FemState<T>& fem_state, const Vector3<T>& weights,
+      const Eigen::Ref<const VectorX<T>>& x, EigenPtr<VectorX<T>> y) const = 0;
+
   /** FemModelImpl must override this method to provide an implementation for
    the NVI MakePetscSymmetricBlockSparseTangentMatrix(). */
   virtual std::unique_ptr<internal::PetscSymmetricBlockSparseMatrix>
   DoMakePetscSymmetricBlockSparseTangentMatrix() const = 0;
 
+  /** FemModelImpl must override this method to provide an implementation for
+   the NVI MakeBlockSparseSymmetricTangentMatrix(). */
+  virtual std::unique_ptr<internal::BlockSparseSymmetricMatrix>
+  DoMakeBlockSparseSymmetricTangentMatrix() const = 0;
+
   /** Updates the system that manages the states and the cache entries of this
    FEM model. Must be called before calling MakeFemState() after the FEM model
    changes (e.g. adding new elements). */
@@ -217,6 +278,7 @@ class FemModel {
   /* The system that manages the states and cache entries of this FEM model.
    */
   std::unique_ptr<internal::FemStateSystem<T>> fem_state_system_;
+  Parallelism parallelism_{Parallelism::None()};
 };
 
 }  // namespace fem
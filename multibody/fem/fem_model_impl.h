@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <array>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -10,6 +11,8 @@
 #include <vector>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
+#include "drake/multibody/fem/block_sparse_symmetric_matrix.h"
 #include "drake/multibody/fem/fem_element.h"
 #include "drake/multibody/fem/fem_indexes.h"
 #include "drake/multibody/fem/fem_model.h"
@@ -49,6 +52,7 @@ class FemModelImpl : public FemModel<typename Element::T> {
    FemModelImpl. */
   void AddElement(Element&& element) {
     elements_.emplace_back(std::move(element));
+    AssignColor(num_elements() - 1);
   }
 
   /* Moves the input `elements`' entries into the vector of elements owned by
@@ -60,6 +64,10 @@ class FemModelImpl : public FemModel<typename Element::T> {
     elements_.insert(elements_.end(),
                      std::make_move_iterator(elements->begin()),
                      std::make_move_iterator(elements->end()));
+    for (int e = num_elements() - static_cast<int>(elements->size());
+         e < num_elements(); ++e) {
+      AssignColor(e);
+    }
   }
 
  private:
@@ -74,21 +82,53 @@ class FemModelImpl : public FemModel<typename Element::T> {
     Vector<T, Element::num_dofs> element_residual;
     const std::vector<Data>& element_data =
         fem_state.template EvalElementData<Data>(element_data_index_);
-    for (int e = 0; e < num_elements(); ++e) {
-      elements_[e].CalcResidual(element_data[e], &element_residual);
+    auto accumulate_element = [&](int e,
+                                  Vector<T, Element::num_dofs>* scratch) {
+      elements_[e].CalcResidual(element_data[e], scratch);
       const std::array<FemNodeIndex, Element::num_nodes>& element_node_indices =
           elements_[e].node_indices();
       for (int a = 0; a < Element::num_nodes; ++a) {
         const int global_node = element_node_indices[a];
         residual->template segment<kDim>(global_node * kDim) +=
-            element_residual.template segment<kDim>(a * kDim);
+            scratch->template segment<kDim>(a * kDim);
       }
+    };
+    const Parallelism parallelism = this->parallelism();
+    if (parallelism.num_threads() == 1) {
+      for (int e = 0; e < num_elements(); ++e) {
+        accumulate_element(e, &element_residual);
+      }
+      return;
+    }
+    /* Elements of the same color share no nodes, so they can scatter into the
+     residual concurrently. */
+    for (const std::vector<int>& color : element_colors_) {
+      StaticParallelForIndexLoop(
+          parallelism, 0, static_cast<int>(color.size()), [&](int, int i) {
+            Vector<T, Element::num_dofs> scratch;
+            accumulate_element(color[i], &scratch);
+          });
     }
   }
 
   void DoCalcTangentMatrix(
       const FemState<T>& fem_state, const Vector3<T>& weights,
       PetscSymmetricBlockSparseMatrix* tangent_matrix) const final {
+    CalcTangentMatrixImpl(fem_state, weights, tangent_matrix);
+  }
+
+  void DoCalcTangentMatrix(
+      const FemState<T>& fem_state, const Vector3<T>& weights,
+      BlockSparseSymmetricMatrix* tangent_matrix) const final {
+    CalcTangentMatrixImpl(fem_state, weights, tangent_matrix);
+  }
+
+  /* Implements DoCalcTangentMatrix() for both PetscSymmetricBlockSparseMatrix
+   and BlockSparseSymmetricMatrix. */
+  template <typename TangentMatrix>
+  void CalcTangentMatrixImpl(const FemState<T>& fem_state,
+                             const Vector3<T>& weights,
+                             TangentMatrix* tangent_matrix) const {
     /* Clears the old data. */
     tangent_matrix->SetZero();
 
@@ -97,25 +137,95 @@ class FemModelImpl : public FemModel<typename Element::T> {
     Vector<int, Element::num_nodes> block_indices;
     const std::vector<Data>& element_data =
         fem_state.template EvalElementData<Data>(element_data_index_);
-    Eigen::Matrix<T, Element::num_dofs, Element::num_dofs>
-        element_tangent_matrix;
-    for (int e = 0; e < num_elements(); ++e) {
-      elements_[e].CalcTangentMatrix(element_data[e], weights,
-                                     &element_tangent_matrix);
+    using ElementTangentMatrix =
+        Eigen::Matrix<T, Element::num_dofs, Element::num_dofs>;
+    ElementTangentMatrix element_tangent_matrix;
+    auto add_to_block = [&](int e, const ElementTangentMatrix& matrix) {
       const std::array<FemNodeIndex, Element::num_nodes>& element_node_indices =
           elements_[e].node_indices();
       // TODO(xuchenhan-tri): Avoid this index copy.
       for (int a = 0; a < Element::num_nodes; ++a) {
         block_indices(a) = element_node_indices[a];
       }
-      tangent_matrix->AddToBlock(block_indices, element_tangent_matrix);
+      tangent_matrix->AddToBlock(block_indices, matrix);
+    };
+    const Parallelism parallelism = this->parallelism();
+    if (parallelism.num_threads() == 1) {
+      for (int e = 0; e < num_elements(); ++e) {
+        elements_[e].CalcTangentMatrix(element_data[e], weights,
+                                       &element_tangent_matrix);
+        add_to_block(e, element_tangent_matrix);
+      }
+      return;
+    }
+    /* Inserting into the PETSc matrix is not thread-safe, so only the element
+     tangent matrices are computed concurrently, one color at a time to bound
+     the size of the buffer. They are then added to the global matrix
+     serially. */
+    std::vector<ElementTangentMatrix> element_tangent_matrices;
+    for (const std::vector<int>& color : element_colors_) {
+      element_tangent_matrices.resize(color.size());
+      StaticParallelForIndexLoop(
+          parallelism, 0, static_cast<int>(color.size()), [&](int, int i) {
+            const int e = color[i];
+            elements_[e].CalcTangentMatrix(element_data[e], weights,
+                                           &element_tangent_matrices[i]);
+          });
+      for (int i = 0; i < static_cast<int>(color.size()); ++i) {
+        add_to_block(color[i], element_tangent_matrices[i]);
+      }
     }
   }
 
-  std::unique_ptr<PetscSymmetricBlockSparseMatrix>
-  DoMakePetscSymmetricBlockSparseTangentMatrix() const final {
-    std::vector<std::unordered_set<int>> neighbor_nodes(this->num_nodes());
+  void DoCalcTangentMatrixTimesVector(const FemState<T>& fem_state,
+                                      const Vector3<T>& weights,
+                                      const Eigen::Ref<const VectorX<T>>& x,
+                                      EigenPtr<VectorX<T>> y) const final {
+    y->setZero();
     constexpr int kDim = 3;
+    const std::vector<Data>& element_data =
+        fem_state.template EvalElementData<Data>(element_data_index_);
+    /* Accumulates K_e * x_e into y for the element e. */
+    auto accumulate_element = [&](int e) {
+      Eigen::Matrix<T, Element::num_dofs, Element::num_dofs>
+          element_tangent_matrix;
+      elements_[e].CalcTangentMatrix(element_data[e], weights,
+                                     &element_tangent_matrix);
+      const std::array<FemNodeIndex, Element::num_nodes>& element_node_indices =
+          elements_[e].node_indices();
+      Vector<T, Element::num_dofs> element_x;
+      for (int a = 0; a < Element::num_nodes; ++a) {
+        element_x.template segment<kDim>(a * kDim) =
+            x.template segment<kDim>(element_node_indices[a] * kDim);
+      }
+      const Vector<T, Element::num_dofs> element_y =
+          element_tangent_matrix * element_x;
+      for (int a = 0; a < Element::num_nodes; ++a) {
+        y->template segment<kDim>(element_node_indices[a] * kDim) +=
+            element_y.template segment<kDim>(a * kDim);
+      }
+    };
+    const Parallelism parallelism = this->parallelism();
+    if (parallelism.num_threads() == 1) {
+      for (int e = 0; e < num_elements(); ++e) {
+        accumulate_element(e);
+      }
+      return;
+    }
+    /* Elements of the same color share no nodes, so they can scatter into `y`
+     concurrently. */
+    for (const std::vector<int>& color : element_colors_) {
+      StaticParallelForIndexLoop(
+          parallelism, 0, static_cast<int>(color.size()),
+          [&](int, int i) { accumulate_element(color[i]); });
+    }
+  }
+
+  /* Returns, for each node i, the nodes j >= i that share an element with it,
+   i.e. the upper triangular block sparsity pattern of the tangent matrix. */
+  std::vector<std::unordered_set<int>> CalcUpperTriangularNeighborNodes()
+      const {
+    std::vector<std::unordered_set<int>> neighbor_nodes(this->num_nodes());
     /* Create a nonzero block for each pair of nodes that are connected by an
      edge in the mesh. */
     for (int e = 0; e < num_elements(); ++e) {
@@ -136,6 +246,14 @@ class FemModelImpl : public FemModel<typename Element::T> {
         }
       }
     }
+    return neighbor_nodes;
+  }
+
+  std::unique_ptr<PetscSymmetricBlockSparseMatrix>
+  DoMakePetscSymmetricBlockSparseTangentMatrix() const final {
+    const std::vector<std::unordered_set<int>> neighbor_nodes =
+        CalcUpperTriangularNeighborNodes();
+    constexpr int kDim = 3;
     std::vector<int> nonzero_blocks(this->num_nodes());
     for (int i = 0; i < this->num_nodes(); ++i) {
       nonzero_blocks[i] = neighbor_nodes[i].size();
@@ -165,6 +283,18 @@ class FemModelImpl : public FemModel<typename Element::T> {
     return tangent_matrix;
   }
 
+  std::unique_ptr<BlockSparseSymmetricMatrix>
+  DoMakeBlockSparseSymmetricTangentMatrix() const final {
+    const std::vector<std::unordered_set<int>> neighbor_nodes =
+        CalcUpperTriangularNeighborNodes();
+    std::vector<std::vector<int>> sparsity_pattern(this->num_nodes());
+    for (int i = 0; i < this->num_nodes(); ++i) {
+      sparsity_pattern[i].assign(neighbor_nodes[i].begin(),
+                                 neighbor_nodes[i].end());
+    }
+    return std::make_unique<BlockSparseSymmetricMatrix>(sparsity_pattern);
+  }
+
   void DeclareCacheEntries(
       internal::FemStateSystem<T>* fem_state_system) final {
     element_data_index_ =
@@ -182,13 +312,45 @@ class FemModelImpl : public FemModel<typename Element::T> {
     DRAKE_DEMAND(data != nullptr);
     data->resize(num_elements());
     const FemState<T> fem_state(&(this->fem_state_system()), &context);
-    for (int i = 0; i < num_elements(); ++i) {
-      (*data)[i] = elements_[i].ComputeData(fem_state);
+    StaticParallelForIndexLoop(
+        this->parallelism(), 0, num_elements(), [&](int, int i) {
+          (*data)[i] = elements_[i].ComputeData(fem_state);
+        });
+  }
+
+  /* Assigns the element with index `e` to the smallest color that none of the
+   elements sharing a node with it already has. */
+  void AssignColor(int e) {
+    const std::array<FemNodeIndex, Element::num_nodes>& element_node_indices =
+        elements_[e].node_indices();
+    std::vector<bool> is_used(element_colors_.size() + 1, false);
+    for (int a = 0; a < Element::num_nodes; ++a) {
+      const int node = element_node_indices[a];
+      if (node >= static_cast<int>(node_colors_.size())) {
+        node_colors_.resize(node + 1);
+      }
+      for (int color : node_colors_[node]) {
+        is_used[color] = true;
+      }
+    }
+    const int color = std::distance(
+        is_used.begin(), std::find(is_used.begin(), is_used.end(), false));
+    if (color == static_cast<int>(element_colors_.size())) {
+      element_colors_.emplace_back();
+    }
+    element_colors_[color].push_back(e);
+    for (int a = 0; a < Element::num_nodes; ++a) {
+      node_colors_[element_node_indices[a]].push_back(color);
     }
   }
 
   /* FemElements owned by this model. */
   std::vector<Element> elements_;
+  /* The indices of the elements of each color. No two elements of the same
+   color share a node. */
+  std::vector<std::vector<int>> element_colors_;
+  /* The colors of the elements incident to each node. */
+  std::vector<std::vector<int>> node_colors_;
   systems::CacheIndex element_data_index_;
 };
 
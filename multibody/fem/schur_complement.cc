@@ -1,5 +1,6 @@
 #include "drake/multibody/fem/schur_complement.h"
 
+#include <stdexcept>
 #include <utility>
 
 namespace drake {
@@ -59,6 +60,57 @@ VectorX<T> SchurComplement<T>::SolveForY(
   return neg_Dinv_B_transpose_ * x;
 }
 
+template <typename T>
+SchurComplementFactorization<T>::SchurComplementFactorization(
+    const Eigen::SparseMatrix<T>& M)
+    : size_(M.rows()) {
+  DRAKE_DEMAND(M.rows() == M.cols());
+  if (size_ == 0) return;
+  M_factorization_.compute(M);
+  if (M_factorization_.info() != Eigen::Success) {
+    throw std::runtime_error(
+        "SchurComplementFactorization: failed to factor the matrix.");
+  }
+}
+
+template <typename T>
+SchurComplement<T> SchurComplementFactorization<T>::CalcSchurComplement(
+    const std::vector<int>& D_indexes,
+    const std::vector<int>& A_indexes) const {
+  const int p = A_indexes.size();
+  const int q = D_indexes.size();
+  DRAKE_DEMAND(p + q == size_);
+  if (p == 0) {
+    return SchurComplement<T>(MatrixX<T>(0, 0), MatrixX<T>(q, 0));
+  }
+  /* Y = M⁻¹E where E selects the columns of A. */
+  MatrixX<T> E = MatrixX<T>::Zero(size_, p);
+  for (int j = 0; j < p; ++j) {
+    E(A_indexes[j], j) = 1.0;
+  }
+  const MatrixX<T> Y = M_factorization_.solve(E);
+  /* X = (M⁻¹)_AA = (A - BD⁻¹Bᵀ)⁻¹ and Z = (M⁻¹)_DA = -D⁻¹BᵀX. */
+  MatrixX<T> X(p, p);
+  for (int i = 0; i < p; ++i) {
+    X.row(i) = Y.row(A_indexes[i]);
+  }
+  MatrixX<T> Z(q, p);
+  for (int i = 0; i < q; ++i) {
+    Z.row(i) = Y.row(D_indexes[i]);
+  }
+  const Eigen::LLT<MatrixX<T>> X_factorization(0.5 * (X + X.transpose()));
+  if (X_factorization.info() != Eigen::Success) {
+    throw std::runtime_error(
+        "SchurComplementFactorization: the matrix is not positive definite.");
+  }
+  MatrixX<T> D_complement =
+      X_factorization.solve(MatrixX<T>::Identity(p, p));
+  D_complement = 0.5 * (D_complement + D_complement.transpose()).eval();
+  MatrixX<T> neg_Dinv_B_transpose = Z * D_complement;
+  return SchurComplement<T>(std::move(D_complement),
+                            std::move(neg_Dinv_B_transpose));
+}
+
 }  // namespace internal
 }  // namespace fem
 }  // namespace multibody
@@ -66,3 +118,6 @@ VectorX<T> SchurComplement<T>::SolveForY(
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
     class ::drake::multibody::fem::internal::SchurComplement)
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::fem::internal::SchurComplementFactorization)
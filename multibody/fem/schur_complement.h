@@ -1,5 +1,9 @@
 #pragma once
 
+#include <vector>
+
+#include <Eigen/SparseLU>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
@@ -68,6 +72,51 @@ class SchurComplement {
   MatrixX<T> neg_Dinv_B_transpose_{};  // -D⁻¹Bᵀ.
 };
 
+/* Caches a factorization of a positive definite matrix M so that the Schur
+ complement of the block D can be computed cheaply for many different
+ partitions of M into the blocks A and D.
+
+ In deformable-rigid coupling, M is the FEM tangent matrix, A corresponds to the
+ dofs of the vertices participating in contact and D to all the other dofs. The
+ contact vertices change from step to step, while M can be kept frozen (lagged)
+ over many steps, much like ImplicitIntegrator reuses its iteration matrix.
+ Rather than factoring D anew for every partition, this class factors M once and
+ uses the block inverse identities
+     (M⁻¹)_AA = (A - BD⁻¹Bᵀ)⁻¹,
+     (M⁻¹)_DA = -D⁻¹Bᵀ(A - BD⁻¹Bᵀ)⁻¹,
+ so that each Schur complement costs p solves with the cached factorization
+ plus a dense p-by-p factorization, where p is the size of A. Callers should
+ construct a new factorization whenever M is updated.
+
+ @tparam_nonsymbolic_scalar */
+template <typename T>
+class SchurComplementFactorization {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SchurComplementFactorization);
+
+  /* Factors the given matrix M.
+   @pre M is symmetric positive definite.
+   @throws std::exception if the factorization fails. */
+  explicit SchurComplementFactorization(const Eigen::SparseMatrix<T>& M);
+
+  /* Returns the number of rows and columns of M. */
+  int size() const { return size_; }
+
+  /* Builds the SchurComplement of the block D of M, where the rows and
+   columns of D and A are given by `D_indexes` and `A_indexes` (in that order
+   within each block). The result is the same as that of the SchurComplement
+   constructed from the blocks of M, up to round-off.
+   @pre `D_indexes` and `A_indexes` together form a permutation of
+        {0, ..., size() - 1}. */
+  SchurComplement<T> CalcSchurComplement(
+      const std::vector<int>& D_indexes,
+      const std::vector<int>& A_indexes) const;
+
+ private:
+  int size_{0};
+  Eigen::SparseLU<Eigen::SparseMatrix<T>> M_factorization_;
+};
+
 }  // namespace internal
 }  // namespace fem
 }  // namespace multibody
@@ -75,3 +124,6 @@ class SchurComplement {
 
 DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
     class ::drake::multibody::fem::internal::SchurComplement)
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::fem::internal::SchurComplementFactorization)
@@ -0,0 +1,189 @@
+#include "drake/multibody/fem/block_sparse_symmetric_matrix.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+using std::vector;
+using PreconditionerType = BlockSparseSymmetricMatrix::PreconditionerType;
+
+constexpr double kEps = 1e-12;
+constexpr int kNumNodes = 6;
+
+/* The nodes of each two-node "element". Together they form a chain of nodes
+ plus one element connecting the two ends of the chain. */
+const vector<std::pair<int, int>> kElements = {{0, 1}, {1, 2}, {2, 3},
+                                               {3, 4}, {4, 5}, {0, 5}};
+
+/* Makes an arbitrary symmetric positive definite 6x6 element matrix. */
+MatrixXd MakeElementMatrix(int e) {
+  const MatrixXd M =
+      MatrixXd::Random(6, 6) + (e + 1) * MatrixXd::Identity(6, 6);
+  return M.transpose() * M;
+}
+
+/* Populates `matrix` with the (seeded) element matrices and returns the
+ dense equivalent. */
+MatrixXd AddElements(BlockSparseSymmetricMatrix* matrix) {
+  MatrixXd dense = MatrixXd::Zero(3 * kNumNodes, 3 * kNumNodes);
+  std::srand(1234);
+  for (int e = 0; e < static_cast<int>(kElements.size()); ++e) {
+    const MatrixXd element_matrix = MakeElementMatrix(e);
+    const auto [a, b] = kElements[e];
+    const Eigen::Vector2i block_indices(a, b);
+    matrix->AddToBlock(block_indices, element_matrix);
+    for (int i = 0; i < 2; ++i) {
+      for (int j = 0; j < 2; ++j) {
+        dense.block<3, 3>(3 * block_indices(i), 3 * block_indices(j)) +=
+            element_matrix.block<3, 3>(3 * i, 3 * j);
+      }
+    }
+  }
+  return dense;
+}
+
+BlockSparseSymmetricMatrix MakeMatrix() {
+  vector<vector<int>> sparsity_pattern(kNumNodes);
+  for (const auto& [a, b] : kElements) {
+    sparsity_pattern[std::min(a, b)].push_back(std::max(a, b));
+  }
+  return BlockSparseSymmetricMatrix(sparsity_pattern);
+}
+
+GTEST_TEST(BlockSparseSymmetricMatrixTest, Construction) {
+  const BlockSparseSymmetricMatrix A = MakeMatrix();
+  EXPECT_EQ(A.rows(), 3 * kNumNodes);
+  EXPECT_EQ(A.cols(), 3 * kNumNodes);
+  EXPECT_EQ(A.num_block_rows(), kNumNodes);
+  /* One diagonal block per node and one off-diagonal block per element. */
+  EXPECT_EQ(A.num_blocks(), kNumNodes + static_cast<int>(kElements.size()));
+  EXPECT_EQ(A.MakeDenseMatrix(), MatrixXd::Zero(A.rows(), A.cols()));
+}
+
+GTEST_TEST(BlockSparseSymmetricMatrixTest, AddToBlockAndSetZero) {
+  BlockSparseSymmetricMatrix A = MakeMatrix();
+  const MatrixXd expected = AddElements(&A);
+  EXPECT_TRUE(CompareMatrices(A.MakeDenseMatrix(), expected, kEps));
+  EXPECT_TRUE(
+      CompareMatrices(MatrixXd(A.MakeEigenSparseMatrix()), expected, kEps));
+
+  A.SetZero();
+  EXPECT_EQ(A.MakeDenseMatrix(), MatrixXd::Zero(A.rows(), A.cols()));
+}
+
+GTEST_TEST(BlockSparseSymmetricMatrixTest, Multiply) {
+  BlockSparseSymmetricMatrix A = MakeMatrix();
+  const MatrixXd dense = AddElements(&A);
+  const VectorXd x = VectorXd::LinSpaced(A.cols(), -1.0, 2.0);
+  VectorXd y(A.rows());
+  A.Multiply(x, &y);
+  EXPECT_TRUE(CompareMatrices(y, dense * x, kEps * dense.norm()));
+}
+
+GTEST_TEST(BlockSparseSymmetricMatrixTest, ZeroRowsAndColumns) {
+  BlockSparseSymmetricMatrix A = MakeMatrix();
+  MatrixXd expected = AddElements(&A);
+  const vector<int> indexes = {1, 4, 17};
+  A.ZeroRowsAndColumns(indexes, 3.0);
+  for (int i : indexes) {
+    expected.row(i).setZero();
+    expected.col(i).setZero();
+    expected(i, i) = 3.0;
+  }
+  EXPECT_TRUE(CompareMatrices(A.MakeDenseMatrix(), expected, kEps));
+}
+
+GTEST_TEST(BlockSparseSymmetricMatrixTest, Solve) {
+  BlockSparseSymmetricMatrix A = MakeMatrix();
+  const MatrixXd dense = AddElements(&A);
+  const VectorXd b = VectorXd::LinSpaced(A.rows(), 1.0, 4.0);
+  const VectorXd expected = dense.llt().solve(b);
+  A.set_relative_tolerance(1e-12);
+  for (PreconditionerType preconditioner :
+       {PreconditionerType::kNone, PreconditionerType::kBlockJacobi,
+        PreconditionerType::kIncompleteCholesky}) {
+    const VectorXd x = A.Solve(preconditioner, b);
+    EXPECT_TRUE(CompareMatrices(x, expected, 1e-10));
+    EXPECT_GT(A.last_num_iterations(), 0);
+    EXPECT_LE(A.last_num_iterations(), A.rows());
+
+    VectorXd x_in_place = b;
+    A.SolveInPlace(preconditioner, &x_in_place);
+    EXPECT_EQ(x_in_place, x);
+  }
+}
+
+/* Block incomplete Cholesky is exact when the sparsity pattern admits no
+ fill-in, e.g. for a chain of nodes. Then the preconditioned conjugate gradient
+ converges in a single iteration. */
+GTEST_TEST(BlockSparseSymmetricMatrixTest, IncompleteCholeskyWithoutFillIn) {
+  vector<vector<int>> sparsity_pattern(kNumNodes);
+  for (int i = 0; i + 1 < kNumNodes; ++i) {
+    sparsity_pattern[i].push_back(i + 1);
+  }
+  BlockSparseSymmetricMatrix A(sparsity_pattern);
+  for (int i = 0; i + 1 < kNumNodes; ++i) {
+    A.AddToBlock(Eigen::Vector2i(i, i + 1), MakeElementMatrix(i));
+  }
+  const VectorXd b = VectorXd::LinSpaced(A.rows(), 1.0, 4.0);
+  A.set_relative_tolerance(1e-12);
+  const VectorXd x = A.Solve(PreconditionerType::kIncompleteCholesky, b);
+  EXPECT_TRUE(CompareMatrices(x, A.MakeDenseMatrix().llt().solve(b), 1e-10));
+  EXPECT_EQ(A.last_num_iterations(), 1);
+}
+
+GTEST_TEST(BlockSparseSymmetricMatrixTest, SchurComplement) {
+  BlockSparseSymmetricMatrix A = MakeMatrix();
+  const MatrixXd dense = AddElements(&A);
+  const vector<int> D_block_indexes = {1, 3, 4};
+  const vector<int> A_block_indexes = {0, 2, 5};
+  const SchurComplement<double> schur_complement =
+      A.CalcSchurComplement(D_block_indexes, A_block_indexes);
+
+  /* Build the expected Schur complement from the dense matrix. */
+  auto submatrix = [&dense](const vector<int>& row_blocks,
+                            const vector<int>& col_blocks) {
+    MatrixXd result(3 * row_blocks.size(), 3 * col_blocks.size());
+    for (int i = 0; i < static_cast<int>(row_blocks.size()); ++i) {
+      for (int j = 0; j < static_cast<int>(col_blocks.size()); ++j) {
+        result.block<3, 3>(3 * i, 3 * j) =
+            dense.block<3, 3>(3 * row_blocks[i], 3 * col_blocks[j]);
+      }
+    }
+    return result;
+  };
+  const MatrixXd A_dense = submatrix(A_block_indexes, A_block_indexes);
+  const MatrixXd B_transpose_dense =
+      submatrix(D_block_indexes, A_block_indexes);
+  const MatrixXd D_dense = submatrix(D_block_indexes, D_block_indexes);
+  const MatrixXd expected_D_complement =
+      A_dense -
+      B_transpose_dense.transpose() * D_dense.llt().solve(B_transpose_dense);
+  EXPECT_TRUE(CompareMatrices(schur_complement.get_D_complement(),
+                              expected_D_complement,
+                              1e-10 * expected_D_complement.norm()));
+
+  const VectorXd x = VectorXd::LinSpaced(A_dense.rows(), -1.0, 1.0);
+  const VectorXd expected_y = -D_dense.llt().solve(B_transpose_dense * x);
+  EXPECT_TRUE(CompareMatrices(schur_complement.SolveForY(x), expected_y,
+                              1e-10 * expected_y.norm()));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
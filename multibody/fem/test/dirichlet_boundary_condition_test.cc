@@ -71,6 +71,12 @@ class DirichletBoundaryConditionTest : public ::testing::Test {
     return A;
   }
 
+  /* Returns the dense form of MakePetscTangentMatrix() before any boundary
+   condition is applied. */
+  static DenseMatrix MakeDenseTangentMatrix() {
+    return MakePetscTangentMatrix()->MakeDenseMatrix();
+  }
+
   /* The DirichletBoundaryCondition under test. */
   DirichletBoundaryCondition<double> bc_;
   unique_ptr<FemStateSystem<double>> fem_state_system_;
@@ -118,6 +124,14 @@ TEST_F(DirichletBoundaryConditionTest,
   auto A_petsc = MakePetscTangentMatrix();
   bc_.ApplyBoundaryConditionToTangentMatrix(A_petsc.get());
   EXPECT_TRUE(CompareMatrices(A_petsc->MakeDenseMatrix(), A_expected));
+
+  /* The native block sparse matrix gives the same result. */
+  BlockSparseSymmetricMatrix A_native({{}, {}});
+  const DenseMatrix A = MakeDenseTangentMatrix();
+  A_native.AddToBlock(Vector1<int>(0), A.block<3, 3>(0, 0));
+  A_native.AddToBlock(Vector1<int>(1), A.block<3, 3>(3, 3));
+  bc_.ApplyBoundaryConditionToTangentMatrix(&A_native);
+  EXPECT_TRUE(CompareMatrices(A_native.MakeDenseMatrix(), A_expected));
 }
 
 /* Tests out-of-bound boundary conditions throw an exception. */
@@ -98,6 +98,59 @@ GTEST_TEST(FemModelTest, CalcTangentMatrix) {
                               MatrixCompareType::relative));
 }
 
+/* Verifies that the native BlockSparseSymmetricMatrix tangent matrix matches
+ the PETSc one. */
+GTEST_TEST(FemModelTest, CalcBlockSparseSymmetricTangentMatrix) {
+  DummyModel model;
+  DummyModel::DummyBuilder builder(&model);
+  builder.AddTwoElementsWithSharedNodes();
+  builder.AddElementWithDistinctNodes();
+  builder.Build();
+  unique_ptr<FemState<double>> fem_state = model.MakeFemState();
+  const Vector3d weights(0.1, 0.2, 0.3);
+
+  unique_ptr<internal::PetscSymmetricBlockSparseMatrix> petsc_tangent_matrix =
+      model.MakePetscSymmetricBlockSparseTangentMatrix();
+  model.CalcTangentMatrix(*fem_state, weights, petsc_tangent_matrix.get());
+  petsc_tangent_matrix->AssembleIfNecessary();
+
+  unique_ptr<internal::BlockSparseSymmetricMatrix> tangent_matrix =
+      model.MakeBlockSparseSymmetricTangentMatrix();
+  ASSERT_EQ(tangent_matrix->rows(), model.num_dofs());
+  ASSERT_EQ(tangent_matrix->cols(), model.num_dofs());
+  model.CalcTangentMatrix(*fem_state, weights, tangent_matrix.get());
+  EXPECT_TRUE(CompareMatrices(tangent_matrix->MakeDenseMatrix(),
+                              petsc_tangent_matrix->MakeDenseMatrix(),
+                              std::numeric_limits<double>::epsilon(),
+                              MatrixCompareType::relative));
+}
+
+/* Verifies that the matrix-free tangent matrix product matches the product
+ with the assembled tangent matrix, both serially and in parallel. */
+GTEST_TEST(FemModelTest, CalcTangentMatrixTimesVector) {
+  DummyModel model;
+  DummyModel::DummyBuilder builder(&model);
+  builder.AddTwoElementsWithSharedNodes();
+  builder.AddElementWithDistinctNodes();
+  builder.Build();
+  unique_ptr<FemState<double>> fem_state = model.MakeFemState();
+  const Vector3d weights(0.1, 0.2, 0.3);
+  unique_ptr<internal::BlockSparseSymmetricMatrix> tangent_matrix =
+      model.MakeBlockSparseSymmetricTangentMatrix();
+  model.CalcTangentMatrix(*fem_state, weights, tangent_matrix.get());
+  const VectorXd x = VectorXd::LinSpaced(model.num_dofs(), -1.0, 1.0);
+  const VectorXd expected_y = tangent_matrix->MakeDenseMatrix() * x;
+
+  for (int num_threads : {1, 3}) {
+    model.set_parallelism(Parallelism(num_threads));
+    VectorXd y(model.num_dofs());
+    model.CalcTangentMatrixTimesVector(*fem_state, weights, x, &y);
+    EXPECT_TRUE(CompareMatrices(y, expected_y,
+                                16 * std::numeric_limits<double>::epsilon() *
+                                    expected_y.norm()));
+  }
+}
+
 /* Verifies that performing calculations on incompatible model and states throws
  an exception. */
 GTEST_TEST(FemModelTest, IncompatibleModelState) {
@@ -131,6 +184,59 @@ GTEST_TEST(FemModelTest, IncompatibleModelState) {
       "CalcTangentMatrix.* model and state are not compatible.");
 }
 
+/* Verifies that the colored, parallel evaluation of the residual and tangent
+ matrix matches the serial evaluation. */
+GTEST_TEST(FemModelTest, ParallelAssembly) {
+  auto make_model = []() {
+    auto model = make_unique<DummyModel>();
+    DummyModel::DummyBuilder builder(model.get());
+    for (int i = 0; i < 10; ++i) {
+      builder.AddTwoElementsWithSharedNodes();
+      builder.AddElementWithDistinctNodes();
+    }
+    builder.Build();
+    return model;
+  };
+  unique_ptr<DummyModel> serial_model = make_model();
+  unique_ptr<DummyModel> parallel_model = make_model();
+  EXPECT_EQ(serial_model->parallelism().num_threads(), 1);
+  parallel_model->set_parallelism(Parallelism(4));
+  EXPECT_EQ(parallel_model->parallelism().num_threads(), 4);
+
+  unique_ptr<FemState<double>> serial_state = serial_model->MakeFemState();
+  unique_ptr<FemState<double>> parallel_state = parallel_model->MakeFemState();
+  for (FemState<double>* fem_state :
+       {serial_state.get(), parallel_state.get()}) {
+    fem_state->SetPositions(VectorXd::Zero(fem_state->num_dofs()));
+    fem_state->SetVelocities(VectorXd::Zero(fem_state->num_dofs()));
+    fem_state->SetAccelerations(VectorXd::Zero(fem_state->num_dofs()));
+  }
+
+  VectorXd serial_residual(serial_model->num_dofs());
+  VectorXd parallel_residual(parallel_model->num_dofs());
+  serial_model->CalcResidual(*serial_state, &serial_residual);
+  parallel_model->CalcResidual(*parallel_state, &parallel_residual);
+  EXPECT_TRUE(CompareMatrices(parallel_residual, serial_residual,
+                              std::numeric_limits<double>::epsilon(),
+                              MatrixCompareType::relative));
+
+  const Vector3d weights(0.1, 0.2, 0.3);
+  unique_ptr<internal::PetscSymmetricBlockSparseMatrix> serial_tangent =
+      serial_model->MakePetscSymmetricBlockSparseTangentMatrix();
+  unique_ptr<internal::PetscSymmetricBlockSparseMatrix> parallel_tangent =
+      parallel_model->MakePetscSymmetricBlockSparseTangentMatrix();
+  serial_model->CalcTangentMatrix(*serial_state, weights,
+                                  serial_tangent.get());
+  parallel_model->CalcTangentMatrix(*parallel_state, weights,
+                                    parallel_tangent.get());
+  serial_tangent->AssembleIfNecessary();
+  parallel_tangent->AssembleIfNecessary();
+  EXPECT_TRUE(CompareMatrices(parallel_tangent->MakeDenseMatrix(),
+                              serial_tangent->MakeDenseMatrix(),
+                              std::numeric_limits<double>::epsilon(),
+                              MatrixCompareType::relative));
+}
+
 /* Verifies that multiple builders can build into the same FemModel. */
 GTEST_TEST(FemModelTest, MultipleBuilders) {
   DummyModel model;
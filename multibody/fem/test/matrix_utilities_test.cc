@@ -64,6 +64,35 @@ GTEST_TEST(MatrixUtilitiesTest, PolarDecompose) {
   EXPECT_TRUE(math::RotationMatrix<double>::IsValid(R, kTol));
 }
 
+/* PolarDecompose<double> takes a fast iterative path for nonsingular,
+ non-inverted matrices and falls back to an SVD otherwise. Both must agree with
+ the SVD based result computed for AutoDiffXd. */
+GTEST_TEST(MatrixUtilitiesTest, PolarDecomposeMatchesSvd) {
+  // clang-format off
+  const Matrix3<double> well_conditioned =
+      (Matrix3<double>() << 1.1, 0.2, -0.3,
+                            0.1, 0.9,  0.2,
+                           -0.2, 0.3,  1.2).finished();
+  // clang-format on
+  const Matrix3<double> ill_conditioned =
+      Vector3<double>(1e3, 1.0, 1e-3).asDiagonal() * well_conditioned;
+  Matrix3<double> inverted = well_conditioned;
+  inverted.col(0) *= -1.0;
+  for (const Matrix3<double>& F :
+       {well_conditioned, ill_conditioned, inverted}) {
+    Matrix3<double> R, S;
+    PolarDecompose<double>(F, &R, &S);
+    Matrix3<AutoDiffXd> R_svd, S_svd;
+    PolarDecompose<AutoDiffXd>(F.cast<AutoDiffXd>(), &R_svd, &S_svd);
+    const double tolerance = CalcTolerance(F);
+    EXPECT_TRUE(CompareMatrices(R, math::DiscardGradient(R_svd), tolerance));
+    EXPECT_TRUE(CompareMatrices(S, math::DiscardGradient(S_svd),
+                                tolerance * F.norm()));
+    EXPECT_TRUE(CompareMatrices(F, R * S, tolerance * F.norm()));
+    EXPECT_TRUE(math::RotationMatrix<double>::IsValid(R, tolerance));
+  }
+}
+
 GTEST_TEST(MatrixUtilitiesTest, AddScaledRotationalDerivative) {
   const Matrix3<AutoDiffXd> F = MakeAutoDiffMatrix(3, 3);
   Matrix3<AutoDiffXd> R, S;
@@ -1,5 +1,8 @@
 #include "drake/multibody/fem/schur_complement.h"
 
+#include <utility>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -105,6 +108,51 @@ GTEST_TEST(SchurComplementTest, MisA) {
   EXPECT_TRUE(CompareMatrices(s.SolveForY(x), expected_y));
 }
 
+/* Verify that SchurComplementFactorization reproduces the SchurComplement
+ built from the blocks of M for several partitions of the same M, including the
+ degenerate ones. */
+GTEST_TEST(SchurComplementFactorizationTest, MatchesSchurComplement) {
+  constexpr int kSize = 7;
+  /* An arbitrary symmetric positive definite matrix. */
+  MatrixXd M = MatrixXd::Zero(kSize, kSize);
+  for (int i = 0; i < kSize; ++i) {
+    M(i, i) = 4.0 + i;
+    if (i + 1 < kSize) M(i, i + 1) = M(i + 1, i) = 1.0;
+    if (i + 3 < kSize) M(i, i + 3) = M(i + 3, i) = -0.5;
+  }
+  const SchurComplementFactorization<double> factorization(M.sparseView());
+  EXPECT_EQ(factorization.size(), kSize);
+
+  auto submatrix = [&M](const std::vector<int>& rows,
+                        const std::vector<int>& cols) {
+    MatrixXd result(rows.size(), cols.size());
+    for (int i = 0; i < static_cast<int>(rows.size()); ++i) {
+      for (int j = 0; j < static_cast<int>(cols.size()); ++j) {
+        result(i, j) = M(rows[i], cols[j]);
+      }
+    }
+    return result;
+  };
+  const std::vector<std::pair<std::vector<int>, std::vector<int>>>
+      partitions = {{{0, 2, 3, 5, 6}, {4, 1}},
+                    {{1, 2, 3, 4, 5, 6}, {0}},
+                    {{}, {0, 1, 2, 3, 4, 5, 6}},
+                    {{6, 5, 4, 3, 2, 1, 0}, {}}};
+  for (const auto& [D_indexes, A_indexes] : partitions) {
+    const SchurComplement<double> expected(
+        submatrix(A_indexes, A_indexes).sparseView(),
+        submatrix(D_indexes, A_indexes).sparseView(),
+        submatrix(D_indexes, D_indexes).sparseView());
+    const SchurComplement<double> s =
+        factorization.CalcSchurComplement(D_indexes, A_indexes);
+    constexpr double kTol = 1e-13;
+    EXPECT_TRUE(CompareMatrices(s.get_D_complement(),
+                                expected.get_D_complement(), kTol));
+    const VectorXd x = VectorXd::LinSpaced(A_indexes.size(), 1.0, 2.0);
+    EXPECT_TRUE(CompareMatrices(s.SolveForY(x), expected.SolveForY(x), kTol));
+  }
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace fem
@@ -42,100 +42,92 @@ class Intersector {
     polygon_[1].reserve(7);
   }
 
-  /* Intersects a volume mesh (union of tetrahedra) with a surface mesh (union
-   of triangles).
+  /* Intersects the tetrahedron `tet_index` of a volume mesh with the triangle
+   `tri_index` of a surface mesh, and appends the data of the resulting contact
+   polygon (if any) to `out_poly_data`.
 
    @param[in] tet_mesh_D   The deformable tet mesh with vertices measured and
                            expressed in the deformable frame D.
    @param[in] surface_R    The surface mesh, whose vertices are measured and
                            expressed in the rigid frame R.
-   @param[in] bvh_R        The bounding volume hierarchy for the surface mesh,
-                           measured and expressed in frame R.
    @param[in] X_DR  The pose of frame R relative to the world frame D.
-   @returns The (possibly empty) contact surface representing the intersection
-            between the two meshes.  */
-  DeformableContactSurface<T> Intersect(
-      const DeformableVolumeMesh<T>& tet_mesh_D,
-      const TriangleSurfaceMesh<double>& surface_R,
-      const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R,
-      const math::RigidTransform<T>& X_DR) {
-    // The collection of contact data. We will aggregate into this.
-    vector<ContactPolygonData<T>> out_poly_data;
-
-    const math::RigidTransformd& X_DR_d = convert_to_double(X_DR);
-    for (const auto [tet_index, tri_index] :
-         tet_mesh_D.bvh().GetCollisionCandidates(bvh_R, X_DR_d)) {
-      const vector<IntersectionVertex<T>>& poly_vertices_D =
-          ClipTriangleByTetrahedron(tet_index, tet_mesh_D.mesh(), tri_index,
-                                    surface_R, X_DR);
-      const int poly_vertex_count = static_cast<int>(poly_vertices_D.size());
-      if (poly_vertex_count < 3) continue;
-
-      const Vector3<T>& nhat_D =
-          X_DR.rotation() * surface_R.face_normal(tri_index).template cast<T>();
-
-      // TODO(SeanCurtis-TRI): The cost of re-creating these lambdas per element
-      //  pair is ridiculous. Move it *outside* the for loop and simply pass
-      //  in the polygon normal.
-
-      // Computes the double area of the triangle spanned by the three
-      // vertices. This could be more robust by smart selection of the two
-      // triangle edges.
-      auto calc_double_area =
-          [&nhat_D](int v0, int v1, int v2,
-                    const vector<IntersectionVertex<T>>& vertices_D) {
-            const Vector3<T> p_01_D =
-                vertices_D[v1].cartesian - vertices_D[v0].cartesian;
-            const Vector3<T> p_02_D =
-                vertices_D[v2].cartesian - vertices_D[v0].cartesian;
-            return p_01_D.cross(p_02_D).dot(nhat_D);
-          };
-
-      // Computes the *scaled* centroid of the triangle spanned by the three
-      // vertices in both Cartesian and Barycentric coordinates. The *true*
-      // centroid would be found by dividing each quantity by three.
-      auto calc_scaled_centroid =
-          [](int v0, int v1, int v2,
-             const vector<IntersectionVertex<T>>& vertices_D)
-          -> IntersectionVertex<T> {
-        Vector3<T> centroid_D =
-            (vertices_D[v0].cartesian + vertices_D[v1].cartesian +
-             vertices_D[v2].cartesian);
-        Vector4<T> b_centroid =
-            (vertices_D[v0].bary + vertices_D[v1].bary + vertices_D[v2].bary);
-        return {centroid_D, b_centroid};
-      };
-
-      // We construct a triangle fan from the polygon with vertex 0 as the
-      // common vertex: e.g., triangles (0, 1, 2), (0, 2, 3), ... Generally,
-      // a triangle from a fan with N vertices is (0, i, i + 1), for
-      // i ∈ [1, N - 2]. For each triangle, compute its doubled area and
-      // scaled centroid.
-      T poly_double_area{0};  // We accumulate into this variable to find 2x
-                              // the area of the contact polygon.
-      // We accumulate into this variable the sum of
-      // 6 x the area of the triangle x the centroid of the triangle
-      // over all triangle fans in the polygon.
-      IntersectionVertex<T> scaled_centroid{Vector3<T>::Zero(),
-                                            Vector4<T>::Zero()};
-      for (int i = 1; i < poly_vertex_count - 1; ++i) {
-        // 2 x the area of the triangle.
-        const T double_area = calc_double_area(0, i, i + 1, poly_vertices_D);
-        poly_double_area += double_area;
-        // 3 x the centroid of the centroid.
-        const IntersectionVertex<T> tri_centroid =
-            calc_scaled_centroid(0, i, i + 1, poly_vertices_D);
-        // Accumulate
-        //   6 x the area of the triangle x the centroid of the triangle.
-        scaled_centroid.bary += double_area * tri_centroid.bary;
-        scaled_centroid.cartesian += double_area * tri_centroid.cartesian;
-      }
-      out_poly_data.push_back(
-          {poly_double_area / 2, nhat_D,
-           scaled_centroid.cartesian / (poly_double_area * 3),
-           scaled_centroid.bary / (poly_double_area * 3), tet_index});
+   @param[in] tet_index    The index of the tetrahedron in `tet_mesh_D`.
+   @param[in] tri_index    The index of the triangle in `surface_R`.
+   @param[out] out_poly_data  The collection of contact data to append to.  */
+  void Intersect(const DeformableVolumeMesh<T>& tet_mesh_D,
+                 const TriangleSurfaceMesh<double>& surface_R,
+                 const math::RigidTransform<T>& X_DR, int tet_index,
+                 int tri_index,
+                 vector<ContactPolygonData<T>>* out_poly_data) {
+    const vector<IntersectionVertex<T>>& poly_vertices_D =
+        ClipTriangleByTetrahedron(tet_index, tet_mesh_D.mesh(), tri_index,
+                                  surface_R, X_DR);
+    const int poly_vertex_count = static_cast<int>(poly_vertices_D.size());
+    if (poly_vertex_count < 3) return;
+
+    const Vector3<T>& nhat_D =
+        X_DR.rotation() * surface_R.face_normal(tri_index).template cast<T>();
+
+    // TODO(SeanCurtis-TRI): The cost of re-creating these lambdas per element
+    //  pair is ridiculous. Move them out of this function and simply pass
+    //  in the polygon normal.
+
+    // Computes the double area of the triangle spanned by the three
+    // vertices. This could be more robust by smart selection of the two
+    // triangle edges.
+    auto calc_double_area =
+        [&nhat_D](int v0, int v1, int v2,
+                  const vector<IntersectionVertex<T>>& vertices_D) {
+          const Vector3<T> p_01_D =
+              vertices_D[v1].cartesian - vertices_D[v0].cartesian;
+          const Vector3<T> p_02_D =
+              vertices_D[v2].cartesian - vertices_D[v0].cartesian;
+          return p_01_D.cross(p_02_D).dot(nhat_D);
+        };
+
+    // Computes the *scaled* centroid of the triangle spanned by the three
+    // vertices in both Cartesian and Barycentric coordinates. The *true*
+    // centroid would be found by dividing each quantity by three.
+    auto calc_scaled_centroid =
+        [](int v0, int v1, int v2,
+           const vector<IntersectionVertex<T>>& vertices_D)
+        -> IntersectionVertex<T> {
+      Vector3<T> centroid_D =
+          (vertices_D[v0].cartesian + vertices_D[v1].cartesian +
+           vertices_D[v2].cartesian);
+      Vector4<T> b_centroid =
+          (vertices_D[v0].bary + vertices_D[v1].bary + vertices_D[v2].bary);
+      return {centroid_D, b_centroid};
+    };
+
+    // We construct a triangle fan from the polygon with vertex 0 as the
+    // common vertex: e.g., triangles (0, 1, 2), (0, 2, 3), ... Generally,
+    // a triangle from a fan with N vertices is (0, i, i + 1), for
+    // i ∈ [1, N - 2]. For each triangle, compute its doubled area and
+    // scaled centroid.
+    T poly_double_area{0};  // We accumulate into this variable to find 2x
+                            // the area of the contact polygon.
+    // We accumulate into this variable the sum of
+    // 6 x the area of the triangle x the centroid of the triangle
+    // over all triangle fans in the polygon.
+    IntersectionVertex<T> scaled_centroid{Vector3<T>::Zero(),
+                                          Vector4<T>::Zero()};
+    for (int i = 1; i < poly_vertex_count - 1; ++i) {
+      // 2 x the area of the triangle.
+      const T double_area = calc_double_area(0, i, i + 1, poly_vertices_D);
+      poly_double_area += double_area;
+      // 3 x the centroid of the centroid.
+      const IntersectionVertex<T> tri_centroid =
+          calc_scaled_centroid(0, i, i + 1, poly_vertices_D);
+      // Accumulate
+      //   6 x the area of the triangle x the centroid of the triangle.
+      scaled_centroid.bary += double_area * tri_centroid.bary;
+      scaled_centroid.cartesian += double_area * tri_centroid.cartesian;
     }
-    return DeformableContactSurface<T>(move(out_poly_data));
+    out_poly_data->push_back(
+        {poly_double_area / 2, nhat_D,
+         scaled_centroid.cartesian / (poly_double_area * 3),
+         scaled_centroid.bary / (poly_double_area * 3), tet_index});
   }
 
  private:
@@ -483,8 +475,30 @@ DeformableContactSurface<T> ComputeTetMeshTriMeshContact(
     const DeformableVolumeMesh<T>& tet_mesh_D,
     const TriangleSurfaceMesh<double>& tri_mesh_R,
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R,
-    const math::RigidTransform<T>& X_DR) {
-  return Intersector<T>().Intersect(tet_mesh_D, tri_mesh_R, bvh_R, X_DR);
+    const math::RigidTransform<T>& X_DR, Parallelism parallelism) {
+  const vector<std::pair<int, int>> candidates =
+      tet_mesh_D.bvh().GetCollisionCandidates(bvh_R, convert_to_double(X_DR));
+  // Each thread clips a contiguous block of the candidates with its own
+  // scratch space into its own buffer; concatenating the buffers in thread
+  // order gives the same polygons, in the same order, as a serial loop.
+  const int num_threads = parallelism.num_threads();
+  vector<Intersector<T>> intersectors(num_threads);
+  vector<vector<ContactPolygonData<T>>> thread_poly_data(num_threads);
+  StaticParallelForIndexLoop(
+      parallelism, 0, static_cast<int>(candidates.size()),
+      [&](int thread_num, int i) {
+        const auto [tet_index, tri_index] = candidates[i];
+        intersectors[thread_num].Intersect(tet_mesh_D, tri_mesh_R, X_DR,
+                                           tet_index, tri_index,
+                                           &thread_poly_data[thread_num]);
+      });
+  vector<ContactPolygonData<T>> out_poly_data = move(thread_poly_data[0]);
+  for (int t = 1; t < num_threads; ++t) {
+    out_poly_data.insert(out_poly_data.end(),
+                         std::make_move_iterator(thread_poly_data[t].begin()),
+                         std::make_move_iterator(thread_poly_data[t].end()));
+  }
+  return DeformableContactSurface<T>(move(out_poly_data));
 }
 
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS((
@@ -6,6 +6,7 @@
 #include <Eigen/Dense>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/geometry/proximity/bvh.h"
 #include "drake/geometry/proximity/deformable_volume_mesh.h"
 #include "drake/geometry/proximity/triangle_surface_mesh.h"
@@ -98,14 +99,18 @@ class DeformableContactSurface {
  @returns The collection of contact data associated with an implicit contact
           surface formed by the intersection of the volume and surface meshes.
           If there is no intersection, the resulting surface will report as
-          "empty".  */
+          "empty".
+ @param parallelism  The maximum number of threads used to clip the candidate
+                     tetrahedron-triangle pairs. The result (including the
+                     order of its polygons) doesn't depend on it.  */
 template <typename T>
 DeformableContactSurface<T> ComputeTetMeshTriMeshContact(
     const geometry::internal::DeformableVolumeMesh<T>& tet_mesh_D,
     const geometry::TriangleSurfaceMesh<double>& tri_mesh_R,
     const geometry::internal::Bvh<geometry::internal::Obb,
                                   geometry::TriangleSurfaceMesh<double>>& bvh_R,
-    const math::RigidTransform<T>& X_DR);
+    const math::RigidTransform<T>& X_DR,
+    Parallelism parallelism = Parallelism::None());
 }  // namespace fem
 }  // namespace multibody
 }  // namespace drake
@@ -8,8 +8,10 @@
 #include "drake/common/autodiff.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/geometry/proximity/make_box_mesh.h"
 #include "drake/geometry/proximity/triangle_surface_mesh.h"
 #include "drake/geometry/proximity/volume_mesh.h"
+#include "drake/geometry/shape_specification.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/fixed_fem/dev/deformable_contact_data.h"
@@ -244,6 +246,36 @@ GTEST_TEST(DeformableContactTest, NonTriangleContactPolygon) {
   EXPECT_TRUE(CompareMatrices(data.centroid, Vector3d(0, 0, 0), kTol));
 }
 
+/* Verifies that computing the contact surface with multiple threads produces
+ the same polygons, in the same order, as the serial computation. */
+GTEST_TEST(DeformableContactTest, Parallelism) {
+  const DeformableVolumeMesh<double> volume_D(
+      geometry::internal::MakeBoxVolumeMesh<double>(geometry::Box(2, 2, 2),
+                                                    0.25));
+  const TriangleSurfaceMesh<double> surface_R = MakePyramidSurface<double>();
+  const Bvh<Obb, TriangleSurfaceMesh<double>> bvh_R(surface_R);
+  const math::RigidTransformd X_DR(Vector3d(0.1, -0.05, 0.3));
+
+  const DeformableContactSurface<double> serial =
+      ComputeTetMeshTriMeshContact<double>(volume_D, surface_R, bvh_R, X_DR);
+  ASSERT_GT(serial.num_polygons(), 0);
+  for (int num_threads : {2, 3, 8}) {
+    const DeformableContactSurface<double> parallel =
+        ComputeTetMeshTriMeshContact<double>(volume_D, surface_R, bvh_R, X_DR,
+                                             Parallelism(num_threads));
+    ASSERT_EQ(parallel.num_polygons(), serial.num_polygons());
+    for (int i = 0; i < serial.num_polygons(); ++i) {
+      const ContactPolygonData<double>& expected = serial.polygon_data(i);
+      const ContactPolygonData<double>& actual = parallel.polygon_data(i);
+      EXPECT_EQ(actual.tet_index, expected.tet_index);
+      EXPECT_EQ(actual.area, expected.area);
+      EXPECT_TRUE(CompareMatrices(actual.unit_normal, expected.unit_normal));
+      EXPECT_TRUE(CompareMatrices(actual.centroid, expected.centroid));
+      EXPECT_TRUE(CompareMatrices(actual.b_centroid, expected.b_centroid));
+    }
+  }
+}
+
 
 const DeformableBodyIndex kDeformableBodyIndex(2);
 /* Makes a DeformableContactData with a single contact pair using the given
@@ -1,10 +1,14 @@
 #include "drake/multibody/inverse_kinematics/minimum_distance_constraint.h"
 
 #include <limits>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include <Eigen/Dense>
 
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/inverse_kinematics/distance_constraint_utilities.h"
 #include "drake/multibody/inverse_kinematics/kinematic_constraint_utilities.h"
 
@@ -12,14 +16,11 @@ namespace drake {
 namespace multibody {
 using internal::RefFromPtrOrThrow;
 
-template <typename T, typename S>
-VectorX<S> Distances(const MultibodyPlant<T>& plant,
-                     systems::Context<T>* context,
-                     const Eigen::Ref<const VectorX<S>>& q,
-                     double influence_distance) {
-  internal::UpdateContextConfiguration(context, plant, q);
+template <typename T>
+const geometry::QueryObject<T>& EvalQueryObject(
+    const MultibodyPlant<T>& plant, const systems::Context<T>& context) {
   const auto& query_port = plant.get_geometry_query_input_port();
-  if (!query_port.HasValue(*context)) {
+  if (!query_port.HasValue(context)) {
     throw std::invalid_argument(
         "MinimumDistanceConstraint: Cannot get a valid geometry::QueryObject. "
         "Either the plant geometry_query_input_port() is not properly "
@@ -27,8 +28,17 @@ VectorX<S> Distances(const MultibodyPlant<T>& plant,
         "incorrect. Please refer to AddMultibodyPlantSceneGraph on connecting "
         "MultibodyPlant to SceneGraph.");
   }
-  const auto& query_object =
-      query_port.template Eval<geometry::QueryObject<T>>(*context);
+  return query_port.template Eval<geometry::QueryObject<T>>(context);
+}
+
+template <typename T, typename S>
+VectorX<S> Distances(const MultibodyPlant<T>& plant,
+                     systems::Context<T>* context,
+                     const Eigen::Ref<const VectorX<S>>& q,
+                     double influence_distance) {
+  internal::UpdateContextConfiguration(context, plant, q);
+  const geometry::QueryObject<T>& query_object =
+      EvalQueryObject(plant, *context);
 
   const std::vector<geometry::SignedDistancePair<T>> signed_distance_pairs =
       query_object.ComputeSignedDistancePairwiseClosestPoints(
@@ -63,6 +73,98 @@ VectorX<S> Distances(const MultibodyPlant<T>& plant,
   return distances;
 }
 
+// Specialization of Distances() for MultibodyPlant<double> and AutoDiffXd q.
+// Instead of forming the gradient of each distance separately, as
+// internal::CalcDistanceDerivatives() does, the witness points of all pairs
+// within the influence distance are grouped per body, and the translational
+// Jacobians of all the points on a body are computed with a single call to
+// CalcJacobianTranslationalVelocity(). With Ca and Cb the witness points on
+// geometries A and B, ∂d/∂q = n̂_BA_Wᵀ * (Jq_v_WCa - Jq_v_WCb), which is the
+// same gradient as the one in CalcDistanceDerivatives(); the angular velocity
+// of B contributes ω_WB × (d * n̂_BA_W), which is orthogonal to n̂_BA_W. The
+// chain rule with ∂q/∂z is then applied to all distances at once.
+VectorX<AutoDiffXd> DistancesWithAnalyticGradient(
+    const MultibodyPlant<double>& plant, systems::Context<double>* context,
+    const Eigen::Ref<const AutoDiffVecXd>& q, double influence_distance) {
+  internal::UpdateContextConfiguration(context, plant, q);
+  const geometry::QueryObject<double>& query_object =
+      EvalQueryObject(plant, *context);
+  const geometry::SceneGraphInspector<double>& inspector =
+      query_object.inspector();
+
+  const std::vector<geometry::SignedDistancePair<double>>
+      signed_distance_pairs =
+          query_object.ComputeSignedDistancePairwiseClosestPoints(
+              influence_distance);
+
+  // The witness points on a body B, p_BC, and for each of them the row of the
+  // distance it contributes to, with the sign of that contribution.
+  struct BodyWitnessPoints {
+    const Body<double>* body{};
+    std::vector<Eigen::Vector3d> p_BC;
+    std::vector<int> rows;
+    std::vector<double> signs;
+  };
+  std::vector<BodyWitnessPoints> witness_points;
+  std::unordered_map<BodyIndex, int> body_to_witness_points;
+  auto add_witness_point = [&](geometry::GeometryId id,
+                               const Eigen::Vector3d& p_GC, int row,
+                               double sign) {
+    const Body<double>* body =
+        plant.GetBodyFromFrameId(inspector.GetFrameId(id));
+    // Points on the world body (anchored geometries) don't move with q.
+    if (body->index() == world_index()) return;
+    auto [it, inserted] = body_to_witness_points.emplace(
+        body->index(), static_cast<int>(witness_points.size()));
+    if (inserted) witness_points.push_back({body, {}, {}, {}});
+    BodyWitnessPoints& points = witness_points[it->second];
+    // MultibodyPlant registers geometries on body frames, so the geometry's
+    // frame F is the body frame B.
+    points.p_BC.push_back(inspector.GetPoseInFrame(id) * p_GC);
+    points.rows.push_back(row);
+    points.signs.push_back(sign);
+  };
+
+  Eigen::VectorXd distances(signed_distance_pairs.size());
+  std::vector<const Eigen::Vector3d*> nhats_BA_W;
+  nhats_BA_W.reserve(signed_distance_pairs.size());
+  int distance_count{0};
+  for (const auto& signed_distance_pair : signed_distance_pairs) {
+    if (signed_distance_pair.distance < influence_distance) {
+      add_witness_point(signed_distance_pair.id_A, signed_distance_pair.p_ACa,
+                        distance_count, 1.0);
+      add_witness_point(signed_distance_pair.id_B, signed_distance_pair.p_BCb,
+                        distance_count, -1.0);
+      nhats_BA_W.push_back(&signed_distance_pair.nhat_BA_W);
+      distances(distance_count++) = signed_distance_pair.distance;
+    }
+  }
+  distances.conservativeResize(distance_count);
+
+  Eigen::MatrixXd ddistance_dq =
+      Eigen::MatrixXd::Zero(distance_count, plant.num_positions());
+  Eigen::MatrixXd Jq_v_WC;
+  for (const BodyWitnessPoints& points : witness_points) {
+    const int num_points = static_cast<int>(points.p_BC.size());
+    Eigen::Matrix3Xd p_BC(3, num_points);
+    for (int i = 0; i < num_points; ++i) {
+      p_BC.col(i) = points.p_BC[i];
+    }
+    Jq_v_WC.resize(3 * num_points, plant.num_positions());
+    plant.CalcJacobianTranslationalVelocity(
+        *context, JacobianWrtVariable::kQDot, points.body->body_frame(), p_BC,
+        plant.world_frame(), plant.world_frame(), &Jq_v_WC);
+    for (int i = 0; i < num_points; ++i) {
+      const int row = points.rows[i];
+      ddistance_dq.row(row) += points.signs[i] *
+                               nhats_BA_W[row]->transpose() *
+                               Jq_v_WC.middleRows<3>(3 * i);
+    }
+  }
+  return math::InitializeAutoDiff(distances,
+                                  ddistance_dq * math::ExtractGradient(q));
+}
+
 template <typename T>
 void MinimumDistanceConstraint::Initialize(
     const MultibodyPlant<T>& plant, systems::Context<T>* plant_context,
@@ -90,8 +192,13 @@ void MinimumDistanceConstraint::Initialize(
       this->num_vars(), minimum_distance, influence_distance_offset,
       num_collision_candidates,
       [&plant, plant_context](const auto& x, double influence_distance) {
-        return Distances<T, AutoDiffXd>(plant, plant_context, x,
-                                        influence_distance);
+        if constexpr (std::is_same_v<T, double>) {
+          return DistancesWithAnalyticGradient(plant, plant_context, x,
+                                               influence_distance);
+        } else {
+          return Distances<T, AutoDiffXd>(plant, plant_context, x,
+                                          influence_distance);
+        }
       },
       [&plant, plant_context](const auto& x, double influence_distance) {
         return Distances<T, double>(plant, plant_context, x,
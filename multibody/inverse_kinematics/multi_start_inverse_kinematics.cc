@@ -0,0 +1,164 @@
+#include "drake/multibody/inverse_kinematics/multi_start_inverse_kinematics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/ipopt_solver.h"
+#include "drake/solvers/solver_interface.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+// The problem and solver owned by one worker thread.
+struct Worker {
+  std::unique_ptr<systems::Context<double>> root_context;
+  std::unique_ptr<InverseKinematics> ik;
+  std::unique_ptr<solvers::SolverInterface> solver;
+};
+
+Worker MakeWorker(
+    const MultibodyPlant<double>& plant,
+    const systems::Context<double>& root_context,
+    const std::function<void(InverseKinematics*)>& add_constraints,
+    bool with_joint_limits) {
+  Worker worker;
+  worker.root_context = root_context.Clone();
+  worker.ik = std::make_unique<InverseKinematics>(
+      plant, &plant.GetMyMutableContextFromRoot(worker.root_context.get()),
+      with_joint_limits);
+  add_constraints(worker.ik.get());
+  return worker;
+}
+
+// Returns true if `a` is a better result than `b`: a success beats a failure,
+// then the lower optimal cost wins.
+bool IsBetter(const solvers::MathematicalProgramResult& a,
+              const solvers::MathematicalProgramResult& b) {
+  if (a.is_success() != b.is_success()) {
+    return a.is_success();
+  }
+  return a.get_optimal_cost() < b.get_optimal_cost();
+}
+}  // namespace
+
+MultiStartInverseKinematicsResult SolveMultiStartInverseKinematics(
+    const MultibodyPlant<double>& plant,
+    const systems::Context<double>& root_context,
+    const std::function<void(InverseKinematics*)>& add_constraints,
+    const std::vector<Eigen::VectorXd>& seeds,
+    const MultiStartInverseKinematicsOptions& options) {
+  DRAKE_THROW_UNLESS(add_constraints != nullptr);
+  const int num_seeds = static_cast<int>(seeds.size());
+  for (int i = 0; i < num_seeds; ++i) {
+    if (seeds[i].size() != plant.num_positions()) {
+      throw std::invalid_argument(fmt::format(
+          "SolveMultiStartInverseKinematics: seeds[{}] has size {}, but the "
+          "plant has {} positions.",
+          i, seeds[i].size(), plant.num_positions()));
+    }
+  }
+  MultiStartInverseKinematicsResult result;
+  if (num_seeds == 0) {
+    return result;
+  }
+
+  // The first worker is made on the calling thread so that we can choose the
+  // solver, and with it the number of threads, from its program.
+  std::vector<Worker> workers(1);
+  workers[0] = MakeWorker(plant, root_context, add_constraints,
+                          options.with_joint_limits);
+  const solvers::SolverId solver_id =
+      options.solver_id.has_value()
+          ? *options.solver_id
+          : solvers::ChooseBestSolver(workers[0].ik->prog());
+  const int num_threads =
+      solver_id == solvers::IpoptSolver::id()
+          ? 1
+          : std::min(options.parallelism.num_threads(), num_seeds);
+  workers.resize(num_threads);
+
+  const int num_successes_to_stop = options.num_successes_to_stop > 0
+                                        ? options.num_successes_to_stop
+                                        : num_seeds + 1;
+  std::vector<std::optional<solvers::MathematicalProgramResult>> results(
+      num_seeds);
+  std::set<int> successful_seeds;
+  std::mutex mutex;
+  std::atomic<int> next_seed{0};
+
+  // Returns true if the seeds before `seed` have already been solved
+  // successfully num_successes_to_stop times; `seed` and all the seeds after
+  // it can then be skipped.
+  auto is_done_before = [&](int seed) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (static_cast<int>(successful_seeds.size()) < num_successes_to_stop) {
+      return false;
+    }
+    return *std::next(successful_seeds.begin(), num_successes_to_stop - 1) <
+           seed;
+  };
+
+  StaticParallelForIndexLoop(
+      Parallelism(num_threads), 0, num_threads, [&](int, int worker_index) {
+        Worker& worker = workers[worker_index];
+        if (worker.ik == nullptr) {
+          worker = MakeWorker(plant, root_context, add_constraints,
+                              options.with_joint_limits);
+        }
+        worker.solver = solvers::MakeSolver(solver_id);
+        const solvers::MathematicalProgram& prog = worker.ik->prog();
+        Eigen::VectorXd initial_guess = prog.initial_guess();
+        // Seeds are handed out in increasing order, so once a seed can be
+        // skipped, so can all the remaining ones.
+        for (int seed = next_seed++; seed < num_seeds && !is_done_before(seed);
+             seed = next_seed++) {
+          prog.SetDecisionVariableValueInVector(worker.ik->q(), seeds[seed],
+                                                &initial_guess);
+          solvers::MathematicalProgramResult seed_result;
+          worker.solver->Solve(prog, initial_guess, options.solver_options,
+                               &seed_result);
+          std::lock_guard<std::mutex> lock(mutex);
+          if (seed_result.is_success()) {
+            successful_seeds.insert(seed);
+          }
+          results[seed] = std::move(seed_result);
+        }
+      });
+
+  // Only the seeds up to the one that completed the requested number of
+  // successes are considered, which makes the result independent of the
+  // scheduling of the threads. All of them have been solved: a seed is only
+  // skipped once num_successes_to_stop seeds before it have succeeded.
+  int last_seed = num_seeds - 1;
+  if (static_cast<int>(successful_seeds.size()) >= num_successes_to_stop) {
+    last_seed =
+        *std::next(successful_seeds.begin(), num_successes_to_stop - 1);
+  }
+  result.num_seeds_considered = last_seed + 1;
+  for (int seed = 0; seed < num_seeds; ++seed) {
+    if (!results[seed].has_value()) continue;
+    ++result.num_solves;
+    if (seed > last_seed) continue;
+    if (results[seed]->is_success()) {
+      result.successful_seed_indices.push_back(seed);
+    }
+    if (result.best_seed_index < 0 ||
+        IsBetter(*results[seed], result.best_result)) {
+      result.best_seed_index = seed;
+      result.best_result = *results[seed];
+    }
+  }
+  return result;
+}
+}  // namespace multibody
+}  // namespace drake
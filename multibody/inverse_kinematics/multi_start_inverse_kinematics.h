@@ -0,0 +1,110 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
+#include "drake/multibody/inverse_kinematics/inverse_kinematics.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/solvers/mathematical_program_result.h"
+#include "drake/solvers/solver_id.h"
+#include "drake/solvers/solver_options.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+/**
+ * Options for SolveMultiStartInverseKinematics().
+ */
+struct MultiStartInverseKinematicsOptions {
+  /** The search stops once this many seeds have been solved successfully.
+   * Seeds that have not been started by then are skipped. A value <= 0 means
+   * that every seed is solved. */
+  int num_successes_to_stop{1};
+
+  /** Whether to impose the plant's joint limits, see the InverseKinematics
+   * constructors. */
+  bool with_joint_limits{true};
+
+  /** If set, every seed is solved with this solver, otherwise with the solver
+   * chosen by solvers::ChooseBestSolver(). */
+  std::optional<solvers::SolverId> solver_id;
+
+  /** The options passed to the solver for every seed. */
+  std::optional<solvers::SolverOptions> solver_options;
+
+  /** The maximum number of threads to use. Programs solved by IPOPT always
+   * use a single thread, since IPOPT's linear solver (MUMPS) is not
+   * reentrant. */
+  Parallelism parallelism{Parallelism::Max()};
+};
+
+/**
+ * The result of SolveMultiStartInverseKinematics().
+ */
+struct MultiStartInverseKinematicsResult {
+  /** The index of the seed that produced `best_result`, or -1 if there were
+   * no seeds. */
+  int best_seed_index{-1};
+
+  /** Among the considered seeds, the successful result with the lowest
+   * optimal cost; if no seed was solved successfully, the failed result with
+   * the lowest optimal cost. */
+  solvers::MathematicalProgramResult best_result;
+
+  /** The number of seeds considered, i.e. the seeds up to and including the
+   * one that completed the requested number of successes (or all the seeds
+   * if there were not enough successes). */
+  int num_seeds_considered{0};
+
+  /** The indices, in increasing order, of the considered seeds that were
+   * solved successfully. */
+  std::vector<int> successful_seed_indices;
+
+  /** The number of solves actually performed. It may exceed
+   * `num_seeds_considered` when seeds past the last considered one were
+   * already being solved by other threads when the search stopped; their
+   * results are discarded. */
+  int num_solves{0};
+};
+
+/**
+ * Solves an inverse kinematics problem from several initial guesses (seeds)
+ * of the generalized positions q, to escape the local minima of the
+ * nonlinear program.
+ *
+ * Each thread constructs a single InverseKinematics problem, with its own
+ * copy of `root_context`, and populates it by calling `add_constraints`; the
+ * problem is then solved from every seed assigned to that thread, changing
+ * only the initial guess. Seeds are assigned to threads in increasing order.
+ *
+ * Once `options.num_successes_to_stop` seeds have been solved successfully,
+ * the seeds that have not been started yet are skipped. Solves already in
+ * progress run to completion. The result does not depend on the number of
+ * threads: it is computed from the seeds up to and including the one that
+ * completes the requested number of successes in seed order, exactly as a
+ * serial search would.
+ *
+ * @param plant The robot on which the problem is solved.
+ * @param root_context The root context of the diagram containing `plant`, or
+ * the context of `plant` if it is not part of a diagram. For collision related
+ * constraints, `plant` must be connected to a SceneGraph within this diagram.
+ * This context is not modified.
+ * @param add_constraints Adds the costs and constraints to an
+ * InverseKinematics problem. It is called once per thread, possibly
+ * concurrently, and must therefore be safe to call from several threads.
+ * @param seeds The initial guesses of q. Each must have size
+ * plant.num_positions().
+ * @param options The options of the search.
+ * @throws std::exception if a seed has the wrong size.
+ */
+MultiStartInverseKinematicsResult SolveMultiStartInverseKinematics(
+    const MultibodyPlant<double>& plant,
+    const systems::Context<double>& root_context,
+    const std::function<void(InverseKinematics*)>& add_constraints,
+    const std::vector<Eigen::VectorXd>& seeds,
+    const MultiStartInverseKinematicsOptions& options = {});
+}  // namespace multibody
+}  // namespace drake
@@ -193,6 +193,76 @@ GTEST_TEST(MinimumDistanceConstraintTest, MultibodyPlantWithoutCollisionPairs) {
   constraint.Eval(q_autodiff, &y_autodiff);
 }
 
+// Several pairs within the influence distance, with more than one witness point
+// on each body and a witness point on an anchored geometry. The constraint
+// from MultibodyPlant<double> computes the distance gradients with the
+// Jacobians of all the witness points on a body at once; they must match the
+// gradients from MultibodyPlant<AutoDiffXd>.
+GTEST_TEST(MinimumDistanceConstraintTest, MultipleGeometriesPerBody) {
+  systems::DiagramBuilder<double> builder{};
+  MultibodyPlant<double>& plant = AddMultibodyPlantSceneGraph(&builder, 0.0);
+  AddTwoFreeBodiesToPlant(&plant);
+  const Body<double>& body1 = plant.GetBodyByName("body1");
+  const Body<double>& body2 = plant.GetBodyByName("body2");
+  const CoulombFriction<double> friction(0.9, 0.5);
+  plant.RegisterCollisionGeometry(
+      body1, math::RigidTransformd(Eigen::Vector3d(0.1, 0, 0)),
+      geometry::Sphere(0.1), "sphere1a", friction);
+  plant.RegisterCollisionGeometry(
+      body1, math::RigidTransformd(Eigen::Vector3d(-0.1, 0.05, 0)),
+      geometry::Sphere(0.1), "sphere1b", friction);
+  plant.RegisterCollisionGeometry(
+      body2, math::RigidTransformd(Eigen::Vector3d(0, 0.1, 0.02)),
+      geometry::Sphere(0.15), "sphere2a", friction);
+  plant.RegisterCollisionGeometry(
+      body2, math::RigidTransformd(Eigen::Vector3d(0.02, -0.1, 0)),
+      geometry::Box(0.1, 0.2, 0.1), "box2b", friction);
+  plant.RegisterCollisionGeometry(
+      plant.world_body(), math::RigidTransformd(Eigen::Vector3d(0, 0, -0.5)),
+      geometry::Sphere(0.2), "ground", friction);
+  plant.Finalize();
+  auto diagram = builder.Build();
+  auto diagram_context = diagram->CreateDefaultContext();
+  auto plant_context =
+      &diagram->GetMutableSubsystemContext(plant, diagram_context.get());
+
+  std::unique_ptr<systems::Diagram<AutoDiffXd>> diagram_autodiff =
+      systems::System<double>::ToAutoDiffXd(*diagram);
+  const auto& plant_autodiff = static_cast<const MultibodyPlant<AutoDiffXd>&>(
+      diagram_autodiff->GetSubsystemByName(plant.get_name()));
+  auto diagram_context_autodiff = diagram_autodiff->CreateDefaultContext();
+  auto plant_context_autodiff = &diagram_autodiff->GetMutableSubsystemContext(
+      plant_autodiff, diagram_context_autodiff.get());
+
+  const double minimum_distance = 0.05;
+  const double influence_distance_offset = 0.5;
+  const MinimumDistanceConstraint constraint(
+      &plant, minimum_distance, plant_context, {}, influence_distance_offset);
+  const MinimumDistanceConstraint constraint_from_autodiff(
+      &plant_autodiff, minimum_distance, plant_context_autodiff, {},
+      influence_distance_offset);
+
+  Eigen::VectorXd q(kNumPositionsForTwoFreeBodies);
+  q.head<4>() = Eigen::Vector4d(0.9, 0.1, -0.2, 0.3).normalized();
+  q.segment<3>(4) << 0.05, 0.02, -0.1;
+  q.segment<4>(7) = Eigen::Vector4d(0.2, 0.7, 0.1, -0.4).normalized();
+  q.tail<3>() << 0.1, 0.25, 0.05;
+  Eigen::Matrix<double, kNumPositionsForTwoFreeBodies, 2> dq;
+  for (int i = 0; i < kNumPositionsForTwoFreeBodies; ++i) {
+    dq(i, 0) = std::cos(i + 1);
+    dq(i, 1) = 0.5 * i - 3;
+  }
+  // The numerical gradient is only accurate up to 5E-6.
+  TestKinematicConstraintEval(constraint, constraint_from_autodiff, q, dq,
+                              5E-6);
+
+  // The penalized constraint value is positive, i.e. at least one pair is
+  // within the influence distance.
+  Eigen::VectorXd y;
+  constraint.Eval(q, &y);
+  EXPECT_GT(y(0), 0);
+}
+
 TEST_F(TwoFreeSpheresTest, NonpositiveInfluenceDistanceOffset) {
   DRAKE_EXPECT_THROWS_MESSAGE(
       MinimumDistanceConstraint(plant_double_, 0.1, plant_context_double_, {},
@@ -0,0 +1,133 @@
+#include "drake/multibody/inverse_kinematics/multi_start_inverse_kinematics.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/multibody/inverse_kinematics/test/inverse_kinematics_test_utilities.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+class MultiStartInverseKinematicsTest : public ::testing::Test {
+ public:
+  MultiStartInverseKinematicsTest()
+      : plant_(ConstructIiwaPlant(
+            FindResourceOrThrow("drake/manipulation/models/iiwa_description/"
+                                "sdf/iiwa14_no_collision.sdf"),
+            0.01)),
+        context_(plant_->CreateDefaultContext()) {
+    const Eigen::VectorXd lower = plant_->GetPositionLowerLimits();
+    const Eigen::VectorXd upper = plant_->GetPositionUpperLimits();
+    for (int i = 0; i < 12; ++i) {
+      const double s = 0.5 + 0.45 * std::sin(3.0 * i + 1.0);
+      seeds_.push_back(lower + s * (upper - lower));
+    }
+  }
+
+ protected:
+  // Asks the end effector to reach a point, while staying close to a nominal
+  // posture.
+  void AddConstraints(InverseKinematics* ik) const {
+    const Frame<double>& link7 = plant_->GetFrameByName("iiwa_link_7");
+    ik->AddPositionConstraint(link7, Eigen::Vector3d::Zero(),
+                              plant_->world_frame(), p_WQ_ - kTol * ones_,
+                              p_WQ_ + kTol * ones_);
+    ik->get_mutable_prog()->AddQuadraticErrorCost(
+        Eigen::MatrixXd::Identity(7, 7), Eigen::VectorXd::Zero(7), ik->q());
+  }
+
+  void CheckSolution(const MultiStartInverseKinematicsResult& result) const {
+    ASSERT_GE(result.best_seed_index, 0);
+    ASSERT_TRUE(result.best_result.is_success());
+    auto context = plant_->CreateDefaultContext();
+    plant_->SetPositions(context.get(),
+                         result.best_result.GetSolution().head<7>());
+    const Eigen::Vector3d p_WQ =
+        plant_->GetFrameByName("iiwa_link_7")
+            .CalcPoseInWorld(*context)
+            .translation();
+    EXPECT_TRUE(CompareMatrices(p_WQ, p_WQ_, kTol + 1E-6));
+  }
+
+  static constexpr double kTol{1E-3};
+  const Eigen::Vector3d p_WQ_{0.4, 0.2, 0.6};
+  const Eigen::Vector3d ones_{Eigen::Vector3d::Ones()};
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  std::unique_ptr<systems::Context<double>> context_;
+  std::vector<Eigen::VectorXd> seeds_;
+};
+
+TEST_F(MultiStartInverseKinematicsTest, StopAtFirstSuccess) {
+  MultiStartInverseKinematicsOptions options;
+  options.parallelism = Parallelism::None();
+  const auto add_constraints = [this](InverseKinematics* ik) {
+    AddConstraints(ik);
+  };
+  const MultiStartInverseKinematicsResult serial =
+      SolveMultiStartInverseKinematics(*plant_, *context_, add_constraints,
+                                       seeds_, options);
+  CheckSolution(serial);
+  ASSERT_EQ(serial.successful_seed_indices.size(), 1);
+  EXPECT_EQ(serial.successful_seed_indices[0], serial.best_seed_index);
+  EXPECT_EQ(serial.num_seeds_considered, serial.best_seed_index + 1);
+  // A serial search solves nothing past the first success.
+  EXPECT_EQ(serial.num_solves, serial.num_seeds_considered);
+
+  // The result doesn't depend on the number of threads.
+  options.parallelism = Parallelism(4);
+  const MultiStartInverseKinematicsResult parallel =
+      SolveMultiStartInverseKinematics(*plant_, *context_, add_constraints,
+                                       seeds_, options);
+  EXPECT_EQ(parallel.best_seed_index, serial.best_seed_index);
+  EXPECT_EQ(parallel.num_seeds_considered, serial.num_seeds_considered);
+  EXPECT_EQ(parallel.successful_seed_indices, serial.successful_seed_indices);
+  EXPECT_GE(parallel.num_solves, parallel.num_seeds_considered);
+  EXPECT_TRUE(CompareMatrices(parallel.best_result.GetSolution(),
+                              serial.best_result.GetSolution()));
+}
+
+TEST_F(MultiStartInverseKinematicsTest, SolveAllSeeds) {
+  MultiStartInverseKinematicsOptions options;
+  options.num_successes_to_stop = 0;
+  options.parallelism = Parallelism(3);
+  const MultiStartInverseKinematicsResult result =
+      SolveMultiStartInverseKinematics(
+          *plant_, *context_,
+          [this](InverseKinematics* ik) {
+            AddConstraints(ik);
+          },
+          seeds_, options);
+  CheckSolution(result);
+  const int num_seeds = static_cast<int>(seeds_.size());
+  EXPECT_EQ(result.num_seeds_considered, num_seeds);
+  EXPECT_EQ(result.num_solves, num_seeds);
+  EXPECT_GE(result.successful_seed_indices.size(), 1);
+  EXPECT_TRUE(std::is_sorted(result.successful_seed_indices.begin(),
+                             result.successful_seed_indices.end()));
+}
+
+TEST_F(MultiStartInverseKinematicsTest, Errors) {
+  const auto add_constraints = [this](InverseKinematics* ik) {
+    AddConstraints(ik);
+  };
+  const MultiStartInverseKinematicsResult no_seeds =
+      SolveMultiStartInverseKinematics(*plant_, *context_, add_constraints,
+                                       {});
+  EXPECT_EQ(no_seeds.best_seed_index, -1);
+  EXPECT_EQ(no_seeds.num_solves, 0);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SolveMultiStartInverseKinematics(*plant_, *context_, add_constraints,
+                                       {seeds_[0], Eigen::VectorXd::Zero(3)}),
+      "SolveMultiStartInverseKinematics: seeds\\[1\\] has size 3, but the "
+      "plant has 7 positions.");
+}
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -87,6 +87,35 @@ TEST_F(IiwaToppraTest, JointVelocityLimit) {
   EXPECT_TRUE((velocity.array() <= upper_bound.array() + tol).all());
 }
 
+// With only bounding box constraints, the one-step problems are solved in
+// closed form rather than as linear programs.
+TEST_F(IiwaToppraTest, JointVelocityLimitOnly) {
+  Eigen::VectorXd lower_bound(7);
+  lower_bound << -1.1, -1.2, -1.3, -1.4, -1.5, -1.6, -1.7;
+  Eigen::VectorXd upper_bound(7);
+  upper_bound << 2.1, 2.2, 2.3, 2.4, 2.5, 2.6, 2.7;
+
+  toppra_->AddJointVelocityLimit(lower_bound, upper_bound);
+
+  auto result = toppra_->SolvePathParameterization();
+  ASSERT_TRUE(result);
+  auto s_path = result.value();
+  EXPECT_GT(s_path.end_time(), s_path.start_time());
+
+  const double tol = 1e-14;
+  for (int ii = 0; ii <= s_path.get_number_of_segments(); ii++) {
+    const double t = ii < s_path.get_number_of_segments()
+                         ? s_path.start_time(ii)
+                         : s_path.end_time();
+    const auto s = s_path.scalarValue(t);
+    const auto s_dot = s_path.EvalDerivative(t, 1);
+    const auto velocity = path_.EvalDerivative(s, 1) * s_dot;
+
+    EXPECT_TRUE((velocity.array() >= lower_bound.array() - tol).all());
+    EXPECT_TRUE((velocity.array() <= upper_bound.array() + tol).all());
+  }
+}
+
 TEST_F(IiwaToppraTest, JointAccelerationLimit) {
   Eigen::VectorXd lower_bound(7);
   lower_bound << -1.1, -1.2, -1.3, -1.4, -1.5, -1.6, -1.7;
@@ -351,6 +380,37 @@ TEST_F(IiwaToppraTest, FrameAccelerationLimit) {
   EXPECT_TRUE((frame_acceleration.array() <= upper_bound.array() + tol).all());
 }
 
+// Evaluating the constraints at the gridpoints in parallel gives the same
+// result as evaluating them serially.
+TEST_F(IiwaToppraTest, ParallelGridpointEvaluation) {
+  const auto& frame = iiwa_plant_->GetFrameByName("iiwa_link_7");
+  const auto add_limits = [&](Toppra* toppra) {
+    toppra->AddJointTorqueLimit(Eigen::VectorXd::Constant(7, -30),
+                                Eigen::VectorXd::Constant(7, 31));
+    toppra->AddFrameVelocityLimit(frame, Vector6d::Constant(-1.5),
+                                  Vector6d::Constant(2));
+    toppra->AddFrameTranslationalSpeedLimit(frame, 1.1);
+    toppra->AddFrameAccelerationLimit(frame, Vector6d::Constant(-10),
+                                      Vector6d::Constant(10));
+  };
+  add_limits(toppra_.get());
+  const auto serial_result = toppra_->SolvePathParameterization();
+  ASSERT_TRUE(serial_result);
+
+  Toppra parallel_toppra(path_, *iiwa_plant_,
+                         Toppra::CalcGridPoints(path_, {}));
+  EXPECT_EQ(parallel_toppra.parallelism().num_threads(), 1);
+  parallel_toppra.set_parallelism(Parallelism(4));
+  EXPECT_EQ(parallel_toppra.parallelism().num_threads(), 4);
+  add_limits(&parallel_toppra);
+  const auto parallel_result = parallel_toppra.SolvePathParameterization();
+  ASSERT_TRUE(parallel_result);
+
+  EXPECT_EQ(parallel_result->get_segment_times(),
+            serial_result->get_segment_times());
+  EXPECT_TRUE(parallel_result->isApprox(*serial_result, 0));
+}
+
 GTEST_TEST(ToppraTest, GridpointsTest) {
   Eigen::MatrixXd knots(3, 2);
   knots.col(0) << 0, 10, 20;
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <forward_list>
 #include <limits>
+#include <vector>
 
 #include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/clp_solver.h"
@@ -14,6 +15,16 @@ namespace multibody {
 
 using trajectories::PiecewisePolynomial;
 
+namespace {
+
+// The upper bound on the squared path velocity, ṡ², which ensures that the
+// controllable set calculated in the backward pass is always bounded. It is
+// chosen such that trajectories with zero velocity segments do not cause the
+// backward pass to fail.
+constexpr double kMaxPathVelocitySquared = 1e16;
+
+}  // namespace
+
 Eigen::VectorXd Toppra::CalcGridPoints(const Trajectory<double>& path,
                                        const CalcGridPointsOptions& options) {
   std::forward_list<double> gridpts{path.start_time(), path.end_time()};
@@ -99,10 +110,26 @@ Toppra::Toppra(const Trajectory<double>& path,
     }
   }
   // Add constraint on path velocity to ensure reachable set caluclated in
-  // backward pass is always bounded. Maximum path velocity selected such that
-  // trajectories with zero velocity segments do not cause the backward pass to
-  // fail.
-  backward_prog_->AddBoundingBoxConstraint(0, 1e16, backward_x_);
+  // backward pass is always bounded.
+  backward_prog_->AddBoundingBoxConstraint(0, kMaxPathVelocitySquared,
+                                           backward_x_);
+}
+
+void Toppra::ForEachGridpoint(
+    const std::function<void(systems::Context<double>*, int)>& calc) {
+  const int N = gridpoints_.size() - 1;
+  const int num_threads = std::max(1, std::min(parallelism_.num_threads(), N));
+  // The calling thread (thread 0) uses plant_context_.
+  std::vector<std::unique_ptr<systems::Context<double>>> thread_contexts;
+  for (int i = 1; i < num_threads; ++i) {
+    thread_contexts.push_back(plant_context_->Clone());
+  }
+  StaticParallelForIndexLoop(
+      Parallelism(num_threads), 0, N, [&](int thread_num, int knot) {
+        calc(thread_num == 0 ? plant_context_.get()
+                             : thread_contexts[thread_num - 1].get(),
+             knot);
+      });
 }
 
 Binding<BoundingBoxConstraint> Toppra::AddJointVelocityLimit(
@@ -115,7 +142,7 @@ Binding<BoundingBoxConstraint> Toppra::AddJointVelocityLimit(
   Eigen::VectorXd x_lower_bound(N);
   Eigen::VectorXd x_upper_bound(N);
 
-  for (int knot = 0; knot < N; knot++) {
+  ForEachGridpoint([&](systems::Context<double>*, int knot) {
     const Eigen::VectorXd qs_dot = path_.EvalDerivative(gridpoints_(knot), 1);
 
     double sd_max = std::numeric_limits<double>::infinity();
@@ -131,7 +158,7 @@ Binding<BoundingBoxConstraint> Toppra::AddJointVelocityLimit(
     }
     x_lower_bound(knot) = std::pow(std::max(sd_min, 0.), 2);
     x_upper_bound(knot) = std::pow(sd_max, 2);
-  }
+  });
   auto x_bbox = backward_prog_->AddBoundingBoxConstraint(0, 1, backward_x_);
   auto bounds = ToppraBoundingBoxConstraint(x_lower_bound, x_upper_bound);
   x_bounds_.emplace(x_bbox, bounds);
@@ -154,7 +181,7 @@ Toppra::AddJointAccelerationLimit(
   Eigen::MatrixXd con_lb(n_con, N);
   Eigen::MatrixXd con_ub(n_con, N);
 
-  for (int knot = 0; knot < N; knot++) {
+  ForEachGridpoint([&](systems::Context<double>*, int knot) {
     const Eigen::VectorXd qs_dot = path_.EvalDerivative(gridpoints_(knot), 1);
     const Eigen::VectorXd qs_ddot = path_.EvalDerivative(gridpoints_(knot), 2);
 
@@ -162,7 +189,7 @@ Toppra::AddJointAccelerationLimit(
     con_A.block(0, 2 * knot + 1, n_dof, 1) << qs_dot;
     con_lb.block(0, knot, n_dof, 1) << lower_limit;
     con_ub.block(0, knot, n_dof, 1) << upper_limit;
-  }
+  });
   if (discretization == ToppraDiscretization::kInterpolation) {
     CalcInterpolationConstraint(&con_A, &con_lb, &con_ub);
   }
@@ -194,11 +221,8 @@ Toppra::AddJointTorqueLimit(
   Eigen::MatrixXd con_A(n_con, 2 * N);
   Eigen::MatrixXd con_lb(n_con, N);
   Eigen::MatrixXd con_ub(n_con, N);
-  Eigen::MatrixXd M(n_dof, n_dof);
-  Eigen::VectorXd Cv(n_dof);
-  Eigen::VectorXd G(n_dof);
 
-  for (int knot = 0; knot < N; knot++) {
+  ForEachGridpoint([&](systems::Context<double>* context, int knot) {
     // The equation of motion is M(q)v̇ + C(q, v) = g(q) + τ.
     // Since v = dq/ds * ṡ and v̇ = dq/ds * s̈ + d²q/ds² * ṡ²,
     // the constraint becomes
@@ -208,17 +232,19 @@ Toppra::AddJointTorqueLimit(
     const Eigen::VectorXd qs_dot = path_.EvalDerivative(gridpoints_(knot), 1);
     const Eigen::VectorXd qs_ddot = path_.EvalDerivative(gridpoints_(knot), 2);
 
-    plant_.SetPositions(plant_context_.get(), qs);
-    plant_.SetVelocities(plant_context_.get(), qs_dot);
-    plant_.CalcMassMatrix(*plant_context_, &M);
-    plant_.CalcBiasTerm(*plant_context_, &Cv);
-    G = plant_.CalcGravityGeneralizedForces(*plant_context_);
+    Eigen::MatrixXd M(n_dof, n_dof);
+    Eigen::VectorXd Cv(n_dof);
+    plant_.SetPositions(context, qs);
+    plant_.SetVelocities(context, qs_dot);
+    plant_.CalcMassMatrix(*context, &M);
+    plant_.CalcBiasTerm(*context, &Cv);
+    const Eigen::VectorXd G = plant_.CalcGravityGeneralizedForces(*context);
 
     con_A.block(0, 2 * knot, n_dof, 1) << M * qs_ddot + Cv;
     con_A.block(0, 2 * knot + 1, n_dof, 1) << M * qs_dot;
     con_lb.block(0, knot, n_dof, 1) << lower_limit + G;
     con_ub.block(0, knot, n_dof, 1) << upper_limit + G;
-  }
+  });
   if (discretization == ToppraDiscretization::kInterpolation) {
     CalcInterpolationConstraint(&con_A, &con_lb, &con_ub);
   }
@@ -242,16 +268,15 @@ Binding<BoundingBoxConstraint> Toppra::AddFrameVelocityLimit(
   const int N = gridpoints_.size() - 1;
   Eigen::VectorXd x_lower_bound(N);
   Eigen::VectorXd x_upper_bound(N);
-  Eigen::VectorXd velocity(6);
 
-  for (int knot = 0; knot < N; knot++) {
+  ForEachGridpoint([&](systems::Context<double>* context, int knot) {
     const Eigen::VectorXd qs = path_.value(gridpoints_(knot));
     const Eigen::VectorXd qs_dot = path_.EvalDerivative(gridpoints_(knot), 1);
 
-    plant_.SetPositions(plant_context_.get(), qs);
-    plant_.SetVelocities(plant_context_.get(), qs_dot);
-    velocity = constraint_frame.CalcSpatialVelocityInWorld(*plant_context_)
-                   .get_coeffs();
+    plant_.SetPositions(context, qs);
+    plant_.SetVelocities(context, qs_dot);
+    const Vector6d velocity =
+        constraint_frame.CalcSpatialVelocityInWorld(*context).get_coeffs();
 
     double sd_max = std::numeric_limits<double>::infinity();
     double sd_min = -std::numeric_limits<double>::infinity();
@@ -266,7 +291,7 @@ Binding<BoundingBoxConstraint> Toppra::AddFrameVelocityLimit(
     }
     x_lower_bound(knot) = std::pow(std::max(sd_min, 0.), 2);
     x_upper_bound(knot) = std::pow(sd_max, 2);
-  }
+  });
   auto x_bbox = backward_prog_->AddBoundingBoxConstraint(0, 1, backward_x_);
   auto bounds = ToppraBoundingBoxConstraint(x_lower_bound, x_upper_bound);
   x_bounds_.emplace(x_bbox, bounds);
@@ -279,14 +304,14 @@ Binding<BoundingBoxConstraint> Toppra::AddFrameTranslationalSpeedLimit(
   Eigen::VectorXd x_lower_bound = Eigen::VectorXd::Zero(N);
   Eigen::VectorXd x_upper_bound(N);
 
-  for (int knot = 0; knot < N; knot++) {
+  ForEachGridpoint([&](systems::Context<double>* context, int knot) {
     const Eigen::VectorXd qs = path_.value(gridpoints_(knot));
     const Eigen::VectorXd qs_dot = path_.EvalDerivative(gridpoints_(knot), 1);
 
-    plant_.SetPositions(plant_context_.get(), qs);
-    plant_.SetVelocities(plant_context_.get(), qs_dot);
+    plant_.SetPositions(context, qs);
+    plant_.SetVelocities(context, qs_dot);
     const SpatialVelocity<double> velocity =
-        constraint_frame.CalcSpatialVelocityInWorld(*plant_context_);
+        constraint_frame.CalcSpatialVelocityInWorld(*context);
     const double speed_squared = velocity.translational().squaredNorm();
 
     // Check to avoid performing division by zero.
@@ -295,7 +320,7 @@ Binding<BoundingBoxConstraint> Toppra::AddFrameTranslationalSpeedLimit(
     } else {
       x_upper_bound(knot) = std::numeric_limits<double>::infinity();
     }
-  }
+  });
   auto x_bbox = backward_prog_->AddBoundingBoxConstraint(0, 1, backward_x_);
   auto bounds = ToppraBoundingBoxConstraint(x_lower_bound, x_upper_bound);
   x_bounds_.emplace(x_bbox, bounds);
@@ -315,10 +340,8 @@ Toppra::AddFrameAccelerationLimit(
   Eigen::MatrixXd con_A(n_con, 2 * N);
   Eigen::MatrixXd con_lb(n_con, N);
   Eigen::MatrixXd con_ub(n_con, N);
-  Eigen::MatrixXd J(6, n_dof);
-  Vector6d dJds_times_v;
 
-  for (int knot = 0; knot < N; knot++) {
+  ForEachGridpoint([&](systems::Context<double>* context, int knot) {
     // The constraint equation is Jv_WF * v̇ + J̇v_WF * v = a_WF.
     // Since v = dq/ds * ṡ and v̇ = dq/ds * s̈ + d²q/ds² * ṡ²,
     // the constraint becomes
@@ -328,24 +351,26 @@ Toppra::AddFrameAccelerationLimit(
     const Eigen::VectorXd qs_dot = path_.EvalDerivative(gridpoints_(knot), 1);
     const Eigen::VectorXd qs_ddot = path_.EvalDerivative(gridpoints_(knot), 2);
 
-    plant_.SetPositions(plant_context_.get(), qs);
-    plant_.SetVelocities(plant_context_.get(), qs_dot);
+    Eigen::MatrixXd J(6, n_dof);
+    plant_.SetPositions(context, qs);
+    plant_.SetVelocities(context, qs_dot);
     plant_.CalcJacobianSpatialVelocity(
-        *plant_context_, JacobianWrtVariable::kQDot, constraint_frame,
+        *context, JacobianWrtVariable::kQDot, constraint_frame,
         Eigen::Vector3d::Zero(), plant_.world_frame(), plant_.world_frame(),
         &J);
-    dJds_times_v = plant_
-                       .CalcBiasSpatialAcceleration(
-                           *plant_context_, JacobianWrtVariable::kV,
-                           constraint_frame, Eigen::Vector3d::Zero(),
-                           plant_.world_frame(), plant_.world_frame())
-                       .get_coeffs();
+    const Vector6d dJds_times_v =
+        plant_
+            .CalcBiasSpatialAcceleration(
+                *context, JacobianWrtVariable::kV, constraint_frame,
+                Eigen::Vector3d::Zero(), plant_.world_frame(),
+                plant_.world_frame())
+            .get_coeffs();
 
     con_A.block(0, 2 * knot, 6, 1) << J * qs_ddot + dJds_times_v;
     con_A.block(0, 2 * knot + 1, 6, 1) << J * qs_dot;
     con_lb.block(0, knot, 6, 1) << lower_limit;
     con_ub.block(0, knot, 6, 1) << upper_limit;
-  }
+  });
   if (discretization == ToppraDiscretization::kInterpolation) {
     CalcInterpolationConstraint(&con_A, &con_lb, &con_ub);
   }
@@ -407,48 +432,65 @@ std::optional<Eigen::Matrix2Xd> Toppra::ComputeBackwardPass(
   K.col(N) << std::pow(s_dot_N, 2), std::pow(s_dot_N, 2);
   // Setup and solve sequence of one-step problems
   for (int knot = N - 1; knot > -1; knot--) {
-    // Setup constraints for both max & min
-    const double delta = gridpoints_(knot + 1) - gridpoints_(knot);
-    backward_continuity_con_.evaluator()->UpdateCoefficients(
-        Eigen::Vector2d(1, 2 * delta).transpose(), Vector1d(K(0, knot + 1)),
-        Vector1d(K(1, knot + 1)));
-    for (auto& [constraint, bounds] : x_bounds_) {
-      constraint.evaluator()->set_bounds(Vector1d(bounds.lb(knot)),
-                                         Vector1d(bounds.ub(knot)));
-    }
-    for (auto& [constraint, coefficients] : backward_lin_constraint_) {
-      constraint.evaluator()->UpdateCoefficients(
-          coefficients.coeffs.middleCols<2>(2 * knot),
-          coefficients.lb.col(knot), coefficients.ub.col(knot));
-    }
-    // Solve minimum
-    {
-      backward_cost_.evaluator()->UpdateCoefficients(min_cost_A);
-      solvers::MathematicalProgramResult result;
-      solver.Solve(*backward_prog_, {}, {}, &result);
-      if (!result.is_success()) {
-        drake::log()->error(
-            fmt::format("Toppra failed to find lower bound of controllable set "
-                        "at knot {}/{}.",
-                        knot, N));
-        return std::nullopt;
-      } else {
-        K(0, knot) = result.GetSolution(backward_x_)(0);
+    if (backward_lin_constraint_.empty()) {
+      // Without linear constraints the path acceleration u is free, so the
+      // continuity constraint can always be met and the controllable set at
+      // the knot is just the intersection of the bounding boxes on x.
+      K(0, knot) = 0;
+      K(1, knot) = kMaxPathVelocitySquared;
+      for (const auto& [constraint, bounds] : x_bounds_) {
+        K(0, knot) = std::max(K(0, knot), bounds.lb(knot));
+        K(1, knot) = std::min(K(1, knot), bounds.ub(knot));
       }
-    }
-    // Solve maximum
-    {
-      backward_cost_.evaluator()->UpdateCoefficients(max_cost_A);
-      solvers::MathematicalProgramResult result;
-      solver.Solve(*backward_prog_, {}, {}, &result);
-      if (!result.is_success()) {
-        drake::log()->error(
-            fmt::format("Toppra failed to find upper bound of controllable set "
-                        "at knot {}/{}.",
-                        knot, N));
+      if (K(0, knot) > K(1, knot)) {
+        drake::log()->error(fmt::format(
+            "Toppra found an empty controllable set at knot {}/{}.", knot, N));
         return std::nullopt;
-      } else {
-        K(1, knot) = result.GetSolution(backward_x_)(0);
+      }
+    } else {
+      // Setup constraints for both max & min
+      const double delta = gridpoints_(knot + 1) - gridpoints_(knot);
+      backward_continuity_con_.evaluator()->UpdateCoefficients(
+          Eigen::Vector2d(1, 2 * delta).transpose(), Vector1d(K(0, knot + 1)),
+          Vector1d(K(1, knot + 1)));
+      for (auto& [constraint, bounds] : x_bounds_) {
+        constraint.evaluator()->set_bounds(Vector1d(bounds.lb(knot)),
+                                           Vector1d(bounds.ub(knot)));
+      }
+      for (auto& [constraint, coefficients] : backward_lin_constraint_) {
+        constraint.evaluator()->UpdateCoefficients(
+            coefficients.coeffs.middleCols<2>(2 * knot),
+            coefficients.lb.col(knot), coefficients.ub.col(knot));
+      }
+      // Solve minimum
+      {
+        backward_cost_.evaluator()->UpdateCoefficients(min_cost_A);
+        solvers::MathematicalProgramResult result;
+        solver.Solve(*backward_prog_, {}, {}, &result);
+        if (!result.is_success()) {
+          drake::log()->error(fmt::format(
+              "Toppra failed to find lower bound of controllable set at knot "
+              "{}/{}.",
+              knot, N));
+          return std::nullopt;
+        } else {
+          K(0, knot) = result.GetSolution(backward_x_)(0);
+        }
+      }
+      // Solve maximum
+      {
+        backward_cost_.evaluator()->UpdateCoefficients(max_cost_A);
+        solvers::MathematicalProgramResult result;
+        solver.Solve(*backward_prog_, {}, {}, &result);
+        if (!result.is_success()) {
+          drake::log()->error(fmt::format(
+              "Toppra failed to find upper bound of controllable set at knot "
+              "{}/{}.",
+              knot, N));
+          return std::nullopt;
+        } else {
+          K(1, knot) = result.GetSolution(backward_x_)(0);
+        }
       }
     }
 
@@ -493,26 +535,33 @@ Toppra::ComputeForwardPass(double s_dot_0,
   xstar(0) = std::pow(s_dot_0, 2);
   for (int knot = 0; knot < N; knot++) {
     const double delta = gridpoints_(knot + 1) - gridpoints_(knot);
-    forward_continuity_con_.evaluator()->UpdateCoefficients(
-        Vector1d(2 * delta), Vector1d(K(0, knot + 1) - xstar(knot)),
-        Vector1d(K(1, knot + 1) - xstar(knot)));
-    for (auto& [constraint, coefficients] : forward_lin_constraint_) {
-      constraint.evaluator()->UpdateCoefficients(
-          coefficients.coeffs.col(2 * knot + 1),
-          coefficients.lb.col(knot) -
-              xstar(knot) * coefficients.coeffs.col(2 * knot),
-          coefficients.ub.col(knot) -
-              xstar(knot) * coefficients.coeffs.col(2 * knot));
-    }
-    solvers::MathematicalProgramResult result;
-    solver.Solve(*forward_prog_, {}, {}, &result);
-    if (!result.is_success()) {
-      drake::log()->error(fmt::format(
-          "Toppra failed to find the maximum path acceleration at knot {}/{}.",
-          knot, N));
-      return std::nullopt;
+    if (forward_lin_constraint_.empty()) {
+      // Only the continuity constraint K(0, knot + 1) ≤ x + 2Δu ≤
+      // K(1, knot + 1) bounds u, so the greediest u reaches the upper bound.
+      ustar(knot) = (K(1, knot + 1) - xstar(knot)) / (2 * delta);
     } else {
-      ustar(knot) = result.GetSolution()(0);
+      forward_continuity_con_.evaluator()->UpdateCoefficients(
+          Vector1d(2 * delta), Vector1d(K(0, knot + 1) - xstar(knot)),
+          Vector1d(K(1, knot + 1) - xstar(knot)));
+      for (auto& [constraint, coefficients] : forward_lin_constraint_) {
+        constraint.evaluator()->UpdateCoefficients(
+            coefficients.coeffs.col(2 * knot + 1),
+            coefficients.lb.col(knot) -
+                xstar(knot) * coefficients.coeffs.col(2 * knot),
+            coefficients.ub.col(knot) -
+                xstar(knot) * coefficients.coeffs.col(2 * knot));
+      }
+      solvers::MathematicalProgramResult result;
+      solver.Solve(*forward_prog_, {}, {}, &result);
+      if (!result.is_success()) {
+        drake::log()->error(fmt::format(
+            "Toppra failed to find the maximum path acceleration at knot "
+            "{}/{}.",
+            knot, N));
+        return std::nullopt;
+      } else {
+        ustar(knot) = result.GetSolution()(0);
+      }
     }
     double xnext = xstar(knot) + 2 * delta * ustar(knot);
     xstar(knot + 1) = std::max(K(0, knot + 1), std::min(K(1, knot + 1), xnext));
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <tuple>
@@ -7,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
 #include "drake/common/trajectories/trajectory.h"
 #include "drake/multibody/plant/multibody_plant.h"
@@ -94,6 +96,19 @@ class Toppra {
   static Eigen::VectorXd CalcGridPoints(const Trajectory<double>& path,
                                         const CalcGridPointsOptions& options);
 
+  /**
+   * Sets the degree of parallelism with which the constraints added afterwards
+   * evaluate the path and the plant's dynamics at the gridpoints. Each thread
+   * uses its own plant context. The path is evaluated concurrently, so its
+   * const methods must be safe to call from several threads at once (as they
+   * are for the trajectories in drake::trajectories). The constraints are the
+   * same for any degree of parallelism. The default is no parallelism.
+   */
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  /** Returns the degree of parallelism set by set_parallelism(). */
+  Parallelism parallelism() const { return parallelism_; }
+
   // TODO(mpetersen94): Consider adding optional<Solver> argument.
   /**
    * Solves the TOPPRA optimization and returns the time optimized path
@@ -101,6 +116,9 @@ class Toppra {
    * generate a time parameterized trajectory.
    * The path parameterization has the same start time as the original path's
    * starting break.
+   * If only bounding box constraints on the path velocity (i.e., velocity
+   * and speed limits) have been added, the one-step problems are solved in
+   * closed form; otherwise they are solved as linear programs.
    */
   std::optional<PiecewisePolynomial<double>> SolvePathParameterization();
 
@@ -225,6 +243,16 @@ class Toppra {
       double s_dot_0, const Eigen::Ref<const Eigen::Matrix2Xd>& K,
       const SolverInterface& solver);
 
+  /*
+   * Calls `calc(context, knot)` for each gridpoint but the last, with the
+   * degree of parallelism set by set_parallelism(). `context` is a plant
+   * context owned by the calling thread; `calc` may change its state, and
+   * must write only to the results for `knot`.
+   */
+  void ForEachGridpoint(
+      const std::function<void(systems::Context<double>* context, int knot)>&
+          calc);
+
   /*
    * Calculates the interpolation constraint coefficients for the forward
    * integrated gridpoints based on the constraint coefficients already
@@ -277,6 +305,7 @@ class Toppra {
   const MultibodyPlant<double>& plant_;
   const std::unique_ptr<systems::Context<double>> plant_context_;
   Eigen::VectorXd gridpoints_;
+  Parallelism parallelism_;
   // x_bounds_ maps a Binding<BoundingBoxConstraint> to its bounds for the
   // backward pass. At the i'th grid point the linear constraint
   // x_bounds_.at(constraint).lb.col(i) <= x
@@ -831,35 +831,43 @@ std::optional<ModelInstanceIndex> AddModelFromUrdf(
     const DataSource& data_source,
     const std::string& model_name_in,
     const std::optional<std::string>& parent_model_name,
-    const ParsingWorkspace& workspace) {
+    const ParsingWorkspace& workspace,
+    XMLDocument* preloaded_xml) {
   MultibodyPlant<double>* plant = workspace.plant;
   DRAKE_THROW_UNLESS(plant != nullptr);
   DRAKE_THROW_UNLESS(!plant->is_finalized());
   TinyXml2Diagnostic diag(&workspace.diagnostic, &data_source);
 
-  // Opens the URDF file and feeds it into the XML parser.
-  XMLDocument xml_doc;
-  if (data_source.IsFilename()) {
-    xml_doc.LoadFile(data_source.filename().c_str());
-    if (xml_doc.ErrorID()) {
-      diag.Error(xml_doc, fmt::format("Failed to parse XML file: {}",
-                                      xml_doc.ErrorName()));
-      return std::nullopt;
-    }
-  } else {
-    xml_doc.Parse(data_source.contents().c_str());
-    if (xml_doc.ErrorID()) {
-      diag.Error(xml_doc, fmt::format("Failed to parse XML string: {}",
-                                      xml_doc.ErrorName()));
-      return std::nullopt;
-    }
+  // Opens the URDF file and feeds it into the XML parser, unless that was
+  // already done by the caller.
+  std::unique_ptr<XMLDocument> loaded_xml;
+  XMLDocument* xml_doc = preloaded_xml;
+  if (xml_doc == nullptr) {
+    loaded_xml = LoadUrdfXml(data_source);
+    xml_doc = loaded_xml.get();
+  }
+  if (xml_doc->ErrorID()) {
+    diag.Error(*xml_doc, fmt::format(
+        "Failed to parse XML {}: {}",
+        data_source.IsFilename() ? "file" : "string", xml_doc->ErrorName()));
+    return std::nullopt;
   }
 
   UrdfParser parser(&data_source, model_name_in, parent_model_name,
-                    data_source.GetRootDir(), &xml_doc, workspace);
+                    data_source.GetRootDir(), xml_doc, workspace);
   return parser.Parse();
 }
 
+std::unique_ptr<XMLDocument> LoadUrdfXml(const DataSource& data_source) {
+  auto xml_doc = std::make_unique<XMLDocument>();
+  if (data_source.IsFilename()) {
+    xml_doc->LoadFile(data_source.filename().c_str());
+  } else {
+    xml_doc->Parse(data_source.contents().c_str());
+  }
+  return xml_doc;
+}
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <string>
 
+#include <tinyxml2.h>
+
 #include "drake/multibody/parsing/detail_common.h"
 #include "drake/multibody/parsing/detail_parsing_workspace.h"
 #include "drake/multibody/tree/multibody_tree_indexes.h"
@@ -30,6 +33,9 @@ namespace internal {
 //   newly created instance of this model.
 // @param workspace
 //   The ParsingWorkspace.
+// @param preloaded_xml
+//   Optional XML document previously loaded from @p data_source by
+//   LoadUrdfXml().  If null, the document is loaded here.
 // @returns The model instance index for the newly added model, or std::nullopt
 //          if no model instance was allocated. An instance will be allocated
 //          as long as a valid model name can be constructed, by consulting the
@@ -47,7 +53,15 @@ std::optional<ModelInstanceIndex> AddModelFromUrdf(
     const DataSource& data_source,
     const std::string& model_name,
     const std::optional<std::string>& parent_model_name,
-    const ParsingWorkspace& workspace);
+    const ParsingWorkspace& workspace,
+    tinyxml2::XMLDocument* preloaded_xml = nullptr);
+
+// Reads and parses the XML of the URDF in @p data_source, without consulting
+// any plant or reporting any diagnostics; errors are left on the returned
+// document (see XMLDocument::ErrorID()) and are reported when it is passed to
+// AddModelFromUrdf().  This is safe to call concurrently.
+std::unique_ptr<tinyxml2::XMLDocument> LoadUrdfXml(
+    const DataSource& data_source);
 
 }  // namespace internal
 }  // namespace multibody
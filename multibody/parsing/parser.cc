@@ -1,5 +1,7 @@
 #include "drake/multibody/parsing/parser.h"
 
+#include <map>
+#include <memory>
 #include <optional>
 
 #include "drake/common/filesystem.h"
@@ -15,6 +17,7 @@ using internal::AddModelFromSdf;
 using internal::AddModelFromUrdf;
 using internal::AddModelsFromSdf;
 using internal::DataSource;
+using internal::LoadUrdfXml;
 using internal::ParsingWorkspace;
 
 Parser::Parser(
@@ -82,6 +85,55 @@ ModelInstanceIndex Parser::AddModelFromFile(
   return *maybe_model;
 }
 
+std::vector<ModelInstanceIndex> Parser::AddModelsFromFiles(
+    const std::vector<std::string>& file_names,
+    const std::vector<std::string>& model_names, Parallelism parallelism) {
+  DRAKE_THROW_UNLESS(model_names.empty() ||
+                     model_names.size() == file_names.size());
+  const int num_files = file_names.size();
+
+  // Load the distinct URDF documents concurrently; this doesn't touch the
+  // plant.  Errors are left on the documents and reported (in order) below.
+  std::map<std::string, std::unique_ptr<tinyxml2::XMLDocument>> urdf_docs;
+  for (const std::string& file_name : file_names) {
+    if (DetermineFileType(file_name) == FileType::kUrdf) {
+      urdf_docs.emplace(file_name, nullptr);
+    }
+  }
+  std::vector<std::pair<const std::string*,
+                        std::unique_ptr<tinyxml2::XMLDocument>*>> to_load;
+  for (auto& [file_name, doc] : urdf_docs) {
+    to_load.emplace_back(&file_name, &doc);
+  }
+  StaticParallelForIndexLoop(
+      parallelism, 0, static_cast<int>(to_load.size()), [&](int, int i) {
+        DataSource data_source(DataSource::kFilename, to_load[i].first);
+        *to_load[i].second = LoadUrdfXml(data_source);
+      });
+
+  std::vector<ModelInstanceIndex> result;
+  result.reserve(num_files);
+  ParsingWorkspace workspace{package_map_, diagnostic_policy_, plant_};
+  for (int i = 0; i < num_files; ++i) {
+    const std::string& file_name = file_names[i];
+    const std::string model_name = model_names.empty() ? "" : model_names[i];
+    DataSource data_source(DataSource::kFilename, &file_name);
+    std::optional<ModelInstanceIndex> maybe_model;
+    if (DetermineFileType(file_name) == FileType::kSdf) {
+      maybe_model = AddModelFromSdf(data_source, model_name, workspace);
+    } else {
+      maybe_model = AddModelFromUrdf(data_source, model_name, {}, workspace,
+                                     urdf_docs.at(file_name).get());
+    }
+    if (!maybe_model.has_value()) {
+      throw std::runtime_error(
+          fmt::format("{}: parsing failed", file_name));
+    }
+    result.push_back(*maybe_model);
+  }
+  return result;
+}
+
 ModelInstanceIndex Parser::AddModelFromString(
     const std::string& file_contents,
     const std::string& file_type,
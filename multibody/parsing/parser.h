@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "drake/common/diagnostic_policy.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/parsing/package_map.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/multibody/tree/multibody_tree_indexes.h"
@@ -75,6 +76,27 @@ class Parser final {
       const std::string& file_name,
       const std::string& model_name = {});
 
+  /// Adds one top-level model from each file named in @p file_names to
+  /// @p plant, with the same result as calling AddModelFromFile() on each file
+  /// in turn.
+  ///
+  /// Reading and XML parsing of URDF files does not depend on the plant, so it
+  /// happens concurrently using up to @p parallelism threads, and a URDF file
+  /// that is named more than once is only read and parsed once. Adding the
+  /// models to the plant (and all SDFormat parsing, which may call back into
+  /// the plant) is always done serially, in order.
+  ///
+  /// @param file_names The names of the SDF or URDF files to be parsed.
+  /// @param model_names Either empty, or the name given to each newly created
+  ///   model instance (an empty name uses the name in the file), as for
+  ///   AddModelFromFile().
+  /// @returns The instance indices for the newly added models, in order.
+  /// @throws std::exception in case of errors.
+  std::vector<ModelInstanceIndex> AddModelsFromFiles(
+      const std::vector<std::string>& file_names,
+      const std::vector<std::string>& model_names = {},
+      Parallelism parallelism = Parallelism::Max());
+
   /// Provides same functionality as AddModelFromFile, but instead parses the
   /// SDFormat or URDF XML data via @p file_contents with type dictated by
   /// @p file_type.
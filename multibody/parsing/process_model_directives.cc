@@ -4,7 +4,9 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/common/filesystem.h"
 #include "drake/common/find_resource.h"
@@ -44,6 +46,46 @@ std::unique_ptr<T> ConstructIfNullAndReassign(T** ptr, Args&&... args) {
   return out;
 }
 
+// Memoizes, for the duration of one ProcessModelDirectives() call, the
+// resolution of `package://` URIs and the loading of the directives files they
+// name. Scenes often instantiate one directives file many times, e.g., once per
+// model namespace; it is then read and parsed only once, and each instance is
+// processed from the parsed copy.
+class DirectivesMemo {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DirectivesMemo)
+
+  explicit DirectivesMemo(const PackageMap* package_map)
+      : package_map_(*package_map) {}
+
+  // Returns ResolveModelDirectiveUri(uri, package_map).
+  const std::string& Resolve(const std::string& uri) {
+    auto iter = resolved_uris_.find(uri);
+    if (iter == resolved_uris_.end()) {
+      iter = resolved_uris_.emplace(
+          uri, ResolveModelDirectiveUri(uri, package_map_)).first;
+    }
+    return iter->second;
+  }
+
+  // Returns LoadModelDirectives(Resolve(uri)).
+  const ModelDirectives& Load(const std::string& uri) {
+    auto iter = loaded_directives_.find(uri);
+    if (iter == loaded_directives_.end()) {
+      iter = loaded_directives_.emplace(
+          uri, LoadModelDirectives(Resolve(uri))).first;
+    }
+    return iter->second;
+  }
+
+ private:
+  const PackageMap& package_map_;
+  // Both maps are node based, so the references returned above remain valid
+  // while the recursion adds to them.
+  std::unordered_map<std::string, std::string> resolved_uris_;
+  std::unordered_map<std::string, ModelDirectives> loaded_directives_;
+};
+
 }  // namespace
 
 namespace {
@@ -75,7 +117,7 @@ void AddWeld(
 void ProcessModelDirectivesImpl(
     const ModelDirectives& directives, MultibodyPlant<double>* plant,
     std::vector<ModelInstanceInfo>* added_models, Parser* parser,
-    const std::string& model_namespace) {
+    const std::string& model_namespace, DirectivesMemo* memo) {
   drake::log()->debug("ProcessModelDirectives(MultibodyPlant)");
   DRAKE_DEMAND(plant != nullptr);
   DRAKE_DEMAND(added_models != nullptr);
@@ -90,20 +132,37 @@ void ProcessModelDirectivesImpl(
     return GetScopedFrameByName(*plant, PrefixName(model_namespace, name));
   };
 
-  for (auto& directive : directives.directives) {
+  const int num_directives = directives.directives.size();
+  for (int i = 0; i < num_directives; ++i) {
+    auto& directive = directives.directives[i];
     if (directive.add_model) {
-      ModelInstanceInfo info;
-      auto& model = *directive.add_model;
-      const std::string name = PrefixName(model_namespace, model.name);
-      drake::log()->debug("  add_model: {}\n    {}", name, model.file);
-      const std::string file =
-          ResolveModelDirectiveUri(model.file, parser->package_map());
-      drake::multibody::ModelInstanceIndex child_model_instance_id =
-          parser->AddModelFromFile(file, name);
-      info.model_instance = child_model_instance_id;
-      info.model_name = name;
-      info.model_path = file;
-      if (added_models) added_models->push_back(info);
+      // A run of consecutive add_model directives is independent of the rest
+      // of the plant, so the whole run is handed to the parser at once; it
+      // may then load the files concurrently.
+      int run_end = i;
+      while (run_end < num_directives &&
+             directives.directives[run_end].add_model) {
+        ++run_end;
+      }
+      std::vector<std::string> names;
+      std::vector<std::string> files;
+      for (int j = i; j < run_end; ++j) {
+        auto& model = *directives.directives[j].add_model;
+        names.push_back(PrefixName(model_namespace, model.name));
+        drake::log()->debug("  add_model: {}\n    {}", names.back(),
+                            model.file);
+        files.push_back(memo->Resolve(model.file));
+      }
+      i = run_end - 1;
+      const std::vector<ModelInstanceIndex> child_model_instance_ids =
+          parser->AddModelsFromFiles(files, names);
+      for (int j = 0; j < static_cast<int>(files.size()); ++j) {
+        ModelInstanceInfo info;
+        info.model_instance = child_model_instance_ids[j];
+        info.model_name = names[j];
+        info.model_path = files[j];
+        if (added_models) added_models->push_back(info);
+      }
 
     } else if (directive.add_model_instance) {
       auto& instance = *directive.add_model_instance;
@@ -154,11 +213,8 @@ void ProcessModelDirectivesImpl(
             "Namespace '{}' does not exist as model instance",
             new_model_namespace));
       }
-      auto sub_directives =
-          LoadModelDirectives(
-              ResolveModelDirectiveUri(sub.file, parser->package_map()));
-      ProcessModelDirectivesImpl(
-          sub_directives, plant, added_models, parser, new_model_namespace);
+      ProcessModelDirectivesImpl(memo->Load(sub.file), plant, added_models,
+                                 parser, new_model_namespace, memo);
     }
   }
 }
@@ -207,8 +263,9 @@ void ProcessModelDirectives(
   auto tmp_added_model =
       ConstructIfNullAndReassign<std::vector<ModelInstanceInfo>>(&added_models);
   const std::string model_namespace = "";
+  DirectivesMemo memo(&parser->package_map());
   ProcessModelDirectivesImpl(
-      directives, plant, added_models, parser, model_namespace);
+      directives, plant, added_models, parser, model_namespace, &memo);
 }
 
 ModelDirectives LoadModelDirectives(const std::string& filename) {
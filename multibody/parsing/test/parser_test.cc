@@ -2,6 +2,7 @@
 
 #include <fstream>
 #include <sstream>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -57,6 +58,39 @@ GTEST_TEST(FileParserTest, BasicTest) {
   }
 }
 
+GTEST_TEST(FileParserTest, AddModelsFromFilesTest) {
+  const std::string sdf_name = FindResourceOrThrow(
+      "drake/multibody/benchmarks/acrobot/acrobot.sdf");
+  const std::string urdf_name = FindResourceOrThrow(
+      "drake/multibody/benchmarks/acrobot/acrobot.urdf");
+
+  // A URDF that is named twice is shared; the results match the singular
+  // method, in order.
+  MultibodyPlant<double> plant(0.0);
+  Parser dut(&plant);
+  const std::vector<ModelInstanceIndex> ids = dut.AddModelsFromFiles(
+      {urdf_name, sdf_name, urdf_name}, {"foo", "bar", "baz"},
+      Parallelism(2));
+  ASSERT_EQ(ids.size(), 3);
+  EXPECT_EQ(plant.GetModelInstanceName(ids[0]), "foo");
+  EXPECT_EQ(plant.GetModelInstanceName(ids[1]), "bar");
+  EXPECT_EQ(plant.GetModelInstanceName(ids[2]), "baz");
+  EXPECT_EQ(plant.GetBodyIndices(ids[0]).size(),
+            plant.GetBodyIndices(ids[2]).size());
+
+  // Without model names, the names in the files are used.
+  MultibodyPlant<double> other_plant(0.0);
+  const std::vector<ModelInstanceIndex> other_ids =
+      Parser(&other_plant).AddModelsFromFiles({urdf_name});
+  ASSERT_EQ(other_ids.size(), 1);
+  EXPECT_EQ(other_plant.GetModelInstanceName(other_ids[0]), "acrobot");
+
+  // Errors are reported when the model is added.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.AddModelsFromFiles({"/no/such/file.urdf"}),
+      ".*Failed to parse XML file.*");
+}
+
 GTEST_TEST(FileParserTest, BasicStringTest) {
   const std::string sdf_name = FindResourceOrThrow(
       "drake/multibody/benchmarks/acrobot/acrobot.sdf");
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "drake/common/default_scalars.h"
+#include "drake/multibody/math/spatial_algebra.h"
+#include "drake/multibody/tree/multibody_tree_indexes.h"
+
+namespace drake {
+namespace multibody {
+
+/**
+ A summary of the contact interaction between a pair of bodies: the net contact
+ spatial force that body A applies on body B, accumulated over every contact
+ point (point contact) and every contact surface (hydroelastic contact) between
+ the two bodies. Unlike PointPairContactInfo and HydroelasticContactInfo, it
+ carries no per-point or per-face data, which makes it cheap to compute and to
+ copy. See MultibodyPlant::get_body_pair_contact_wrenches_output_port().
+
+ @tparam_default_scalar
+ */
+template <typename T>
+struct BodyPairContactWrench {
+  /** Index of body A. Always smaller than `bodyB_index`. */
+  BodyIndex bodyA_index;
+
+  /** Index of body B. */
+  BodyIndex bodyB_index;
+
+  /** Net contact spatial force on body B, applied at B's origin Bo, and
+   expressed in the world frame W. The net contact spatial force on body A is
+   the negative of this force, shifted from Bo to A's origin. */
+  SpatialForce<T> F_BBo_W;
+};
+
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,70 @@
+#include "drake/multibody/plant/collision_checker.h"
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+using geometry::GeometryId;
+using math::RigidTransformd;
+
+namespace {
+const MultibodyPlant<double>& DemandNotNull(
+    const MultibodyPlant<double>* plant) {
+  DRAKE_DEMAND(plant != nullptr);
+  return *plant;
+}
+}  // namespace
+
+CollisionChecker::CollisionChecker(
+    const MultibodyPlant<double>* plant,
+    const geometry::SceneGraphInspector<double>& inspector)
+    : plant_(plant),
+      context_(DemandNotNull(plant).CreateDefaultContext()),
+      pc_(GetInternalTree(*plant).get_topology()),
+      engine_(inspector.CloneProximityEngine()) {
+  DRAKE_DEMAND(plant->is_finalized());
+  if (!plant->geometry_source_is_registered() ||
+      !inspector.SourceIsRegistered(*plant->get_source_id())) {
+    throw std::logic_error(
+        "CollisionChecker(): the plant must be registered as a geometry "
+        "source of the given SceneGraph.");
+  }
+
+  for (GeometryId id : inspector.GetAllGeometryIds()) {
+    if (inspector.GetProximityProperties(id) == nullptr) continue;
+    const geometry::FrameId frame_id = inspector.GetFrameId(id);
+    // Anchored geometries keep the poses they have in the proximity engine.
+    if (frame_id == inspector.world_frame_id()) continue;
+    const Body<double>* body = plant->GetBodyFromFrameId(frame_id);
+    if (body == nullptr) {
+      throw std::logic_error(fmt::format(
+          "CollisionChecker(): geometry '{}' is not affixed to a body of the "
+          "plant.",
+          inspector.GetName(id)));
+    }
+    // MultibodyPlant registers a single frame per body, with F = B.
+    dynamic_geometries_.push_back(
+        {id, body->node_index(), inspector.GetPoseInFrame(id)});
+    X_WGs_.emplace(id, RigidTransformd::Identity());
+  }
+}
+
+bool CollisionChecker::HasCollisions(
+    const Eigen::Ref<const VectorX<double>>& q) {
+  plant_->SetPositions(context_.get_mutable(), q);
+  GetInternalTree(*plant_).CalcPositionKinematicsCache(*context_, &pc_);
+  for (const DynamicGeometry& geometry : dynamic_geometries_) {
+    X_WGs_.at(geometry.id) = pc_.get_X_WB(geometry.body_node_index) *
+                             geometry.X_BG;
+  }
+  engine_->UpdateWorldPoses(X_WGs_);
+  return engine_->HasCollisions();
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/copyable_unique_ptr.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/proximity_engine.h"
+#include "drake/geometry/scene_graph_inspector.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/position_kinematics_cache.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+// CollisionChecker answers whether a MultibodyPlant is in collision at a given
+// configuration q, with as little overhead as possible. It is meant for
+// sampling based planners that perform a very large number of such queries.
+//
+// Rather than going through the plant's cache entries, SceneGraph's pose input
+// port and QueryObject, this class owns:
+//   1. the position kinematics of the plant, which it updates directly with
+//      MultibodyTree::CalcPositionKinematicsCache(), and
+//   2. a copy of SceneGraph's proximity engine, whose geometry poses it sets
+//      directly from the body poses.
+//
+// Collision filters are those of the SceneGraphInspector provided at
+// construction. Changes made later to the SceneGraph, or to a SceneGraph
+// context, are not reflected in this checker.
+//
+// HasCollisions() modifies the state of the checker and therefore a single
+// instance must not be used concurrently from multiple threads. Instead, make
+// a copy of the checker for each thread; copies are independent.
+class CollisionChecker {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CollisionChecker)
+
+  // Constructs a collision checker for `plant` with the proximity geometries
+  // in `inspector`. `plant` is aliased and must outlive this checker.
+  // @pre plant != nullptr.
+  // @pre plant is finalized.
+  // @throws std::exception if `plant` is not registered as a source for the
+  // SceneGraph inspected by `inspector`.
+  // @throws std::exception if a dynamic proximity geometry in `inspector` is
+  // not affixed to a body of `plant`.
+  CollisionChecker(const MultibodyPlant<double>* plant,
+                   const geometry::SceneGraphInspector<double>& inspector);
+
+  // Returns `true` if any pair of unfiltered proximity geometries is in
+  // collision when the plant is at configuration `q`. See
+  // QueryObject::HasCollisions() for details.
+  // @throws std::exception if q.size() != plant.num_positions().
+  bool HasCollisions(const Eigen::Ref<const VectorX<double>>& q);
+
+  // The number of proximity geometries whose poses depend on q.
+  int num_dynamic_geometries() const {
+    return static_cast<int>(dynamic_geometries_.size());
+  }
+
+ private:
+  // A proximity geometry G affixed to a body B.
+  struct DynamicGeometry {
+    geometry::GeometryId id;
+    BodyNodeIndex body_node_index;
+    math::RigidTransformd X_BG;
+  };
+
+  const MultibodyPlant<double>* plant_{nullptr};
+  copyable_unique_ptr<systems::Context<double>> context_;
+  PositionKinematicsCache<double> pc_;
+  std::vector<DynamicGeometry> dynamic_geometries_;
+  copyable_unique_ptr<geometry::internal::ProximityEngine<double>> engine_;
+  // Pre-allocated map of poses X_WG for dynamic geometries.
+  std::unordered_map<geometry::GeometryId, math::RigidTransformd> X_WGs_;
+};
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
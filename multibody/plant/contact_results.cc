@@ -1,5 +1,6 @@
 #include "drake/multibody/plant/contact_results.h"
 
+#include <memory>
 #include <utility>
 
 namespace drake {
@@ -29,20 +30,28 @@ ContactResults<T>& ContactResults<T>::operator=(
     // If this currently holds pointers, we need to change the type.
     if (hydroelastic_contact_vector_ownership_mode() == kAliasedPointers) {
       hydroelastic_contact_info_ =
-          std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>();
+          std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>();
     }
 
-    // Copy the HydroelasticContactInfo data.
-    std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>&
+    std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>&
         hydroelastic_contact_vector =
-            hydroelastic_contact_vector_of_unique_ptrs();
-    hydroelastic_contact_vector.resize(
-        contact_results.num_hydroelastic_contacts());
-    for (int i = 0; i < contact_results.num_hydroelastic_contacts(); ++i) {
-      const HydroelasticContactInfo<T>& contact_info =
-          contact_results.hydroelastic_contact_info(i);
-      hydroelastic_contact_vector[i] =
-          std::make_unique<HydroelasticContactInfo<T>>(contact_info);
+            hydroelastic_contact_vector_of_shared_ptrs();
+    if (contact_results.hydroelastic_contact_vector_ownership_mode() ==
+        kOwnsCopies) {
+      // The data owned by `contact_results` is immutable; share it.
+      hydroelastic_contact_vector =
+          contact_results.hydroelastic_contact_vector_of_shared_ptrs();
+    } else {
+      // Copy the HydroelasticContactInfo data, since we can't rely on the
+      // lifetime of the data aliased by `contact_results`.
+      hydroelastic_contact_vector.resize(
+          contact_results.num_hydroelastic_contacts());
+      for (int i = 0; i < contact_results.num_hydroelastic_contacts(); ++i) {
+        const HydroelasticContactInfo<T>& contact_info =
+            contact_results.hydroelastic_contact_info(i);
+        hydroelastic_contact_vector[i] =
+            std::make_shared<const HydroelasticContactInfo<T>>(contact_info);
+      }
     }
   }
 
@@ -69,7 +78,7 @@ void ContactResults<T>::Clear() {
   if (hydroelastic_contact_vector_ownership_mode() == kAliasedPointers) {
     hydroelastic_contact_vector_of_pointers().clear();
   } else {
-    hydroelastic_contact_vector_of_unique_ptrs().clear();
+    hydroelastic_contact_vector_of_shared_ptrs().clear();
   }
   plant_ = nullptr;
 }
@@ -88,7 +97,7 @@ ContactResults<T>::hydroelastic_contact_info(int i) const {
   if (hydroelastic_contact_vector_ownership_mode() == kAliasedPointers) {
     return *hydroelastic_contact_vector_of_pointers()[i];
   } else {
-    return *hydroelastic_contact_vector_of_unique_ptrs()[i];
+    return *hydroelastic_contact_vector_of_shared_ptrs()[i];
   }
 }
 
@@ -107,7 +116,7 @@ int ContactResults<T>::num_hydroelastic_contacts() const {
     return static_cast<int>(hydroelastic_contact_vector_of_pointers().size());
   } else {
     return static_cast<int>(
-        hydroelastic_contact_vector_of_unique_ptrs().size());
+        hydroelastic_contact_vector_of_shared_ptrs().size());
   }
 }
 
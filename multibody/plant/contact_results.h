@@ -5,7 +5,6 @@
 #include <variant>
 #include <vector>
 
-#include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
@@ -22,8 +21,10 @@ template <typename T> class MultibodyPlant;
 /**
  A container class storing the contact results information for each contact
  pair for a given state of the simulation. Note that copying this data structure
- is expensive when `num_hydroelastic_contacts() > 0` because a deep copy is
- performed.
+ is expensive when `num_hydroelastic_contacts() > 0` and `this` references the
+ hydroelastic contact data computed by a MultibodyPlant, because a deep copy is
+ performed. Copying the copy is cheap, since it shares the (immutable) data it
+ owns.
 
  @tparam_default_scalar
  */
@@ -103,15 +104,17 @@ class ContactResults {
         hydroelastic_contact_info_);
   }
 
-  const std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>&
-  hydroelastic_contact_vector_of_unique_ptrs() const {
-    return std::get<std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>>(
+  const std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>&
+  hydroelastic_contact_vector_of_shared_ptrs() const {
+    return std::get<
+        std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>>(
         hydroelastic_contact_info_);
   }
 
-  std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>&
-  hydroelastic_contact_vector_of_unique_ptrs() {
-    return std::get<std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>>(
+  std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>&
+  hydroelastic_contact_vector_of_shared_ptrs() {
+    return std::get<
+        std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>>(
         hydroelastic_contact_info_);
   }
 
@@ -122,17 +125,18 @@ class ContactResults {
    possible. By default, the variant stores the first type, i.e.,
    std::vector<const HydroelasticContactInfo<T>*>. If this data structure is
    copied, however, the variant changes to instead store the second type, a
-   vector of unique pointers. In that case, all of the underlying
+   vector of shared pointers. In that case, all of the underlying
    HydroelasticContactInfo objects are copied and
    AddContactInfo(const HydroelasticContactInfo*) can no longer be called on the
-   copy (see assertion in AddContactInfo).
+   copy (see assertion in AddContactInfo). Since the copies are never modified,
+   subsequent copies of the copy simply share them.
 
    Note that we jump through these hoops because storing ContactResults into
    a cache entry requires that it be placed into a Value<ContactResults>, which
    in turn requires that ContactResults be copyable.
    */
   std::variant<std::vector<const HydroelasticContactInfo<T>*>,
-               std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>>
+               std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>>
       hydroelastic_contact_info_;
 
   const MultibodyPlant<T>* plant_{nullptr};
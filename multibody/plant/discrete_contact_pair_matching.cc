@@ -0,0 +1,54 @@
+#include "drake/multibody/plant/discrete_contact_pair_matching.h"
+
+#include <unordered_map>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/sorted_pair.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+template <typename T>
+std::vector<int> MatchPersistentContactPairs(
+    const std::vector<DiscreteContactPair<T>>& previous,
+    const std::vector<DiscreteContactPair<T>>& current, double max_distance) {
+  DRAKE_THROW_UNLESS(max_distance >= 0.0);
+  using geometry::GeometryId;
+
+  // Previous pairs grouped by geometry pair, so that matching is linear in the
+  // number of pairs for a bounded number of contact points per geometry pair.
+  std::unordered_map<SortedPair<GeometryId>, std::vector<int>> candidates;
+  for (int j = 0; j < static_cast<int>(previous.size()); ++j) {
+    candidates[MakeSortedPair(previous[j].id_A, previous[j].id_B)].push_back(j);
+  }
+
+  const double max_distance_squared = max_distance * max_distance;
+  std::vector<bool> matched(previous.size(), false);
+  std::vector<int> previous_index(current.size(), -1);
+  for (int i = 0; i < static_cast<int>(current.size()); ++i) {
+    const auto it =
+        candidates.find(MakeSortedPair(current[i].id_A, current[i].id_B));
+    if (it == candidates.end()) continue;
+    double closest_distance_squared = max_distance_squared;
+    for (int j : it->second) {
+      if (matched[j]) continue;
+      const double distance_squared = ExtractDoubleOrThrow(
+          (current[i].p_WC - previous[j].p_WC).squaredNorm());
+      if (distance_squared <= closest_distance_squared) {
+        closest_distance_squared = distance_squared;
+        previous_index[i] = j;
+      }
+    }
+    if (previous_index[i] >= 0) matched[previous_index[i]] = true;
+  }
+  return previous_index;
+}
+
+DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS((
+    &MatchPersistentContactPairs<T>
+))
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/multibody/plant/discrete_contact_pair.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+/* Matches the contact pairs in `current` with the contact pairs in `previous`,
+ typically the discrete contact pairs of two consecutive time steps, so that a
+ contact solver can warm-start persistent contacts with the solution of the
+ previous step (e.g. see SapSolver::SetContactCorrespondence()).
+
+ A pair in `current` persists from a pair in `previous` if both pairs are
+ between the same two geometries and their contact points are at most
+ `max_distance` apart. When several pairs in `previous` qualify, the one with
+ the closest contact point is chosen. Each pair in `previous` is matched at most
+ once, with pairs in `current` processed in order.
+
+ @returns a vector `previous_index` of size current.size() such that
+ previous_index[i] is the index of the pair in `previous` matched with the i-th
+ pair in `current`, or -1 if the i-th pair is new.
+ @throws std::exception if max_distance is negative.
+ @tparam_nonsymbolic_scalar */
+template <typename T>
+std::vector<int> MatchPersistentContactPairs(
+    const std::vector<DiscreteContactPair<T>>& previous,
+    const std::vector<DiscreteContactPair<T>>& current, double max_distance);
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
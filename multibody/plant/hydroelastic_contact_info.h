@@ -87,11 +87,13 @@ class HydroelasticContactInfo {
       std::unique_ptr<geometry::ContactSurface<T>> contact_surface,
       const SpatialForce<T>& F_Ac_W,
       std::vector<HydroelasticQuadraturePointData<T>>&& quadrature_point_data)
-      : contact_surface_(std::move(contact_surface)),
+      : contact_surface_(std::shared_ptr<const geometry::ContactSurface<T>>(
+            std::move(contact_surface))),
         F_Ac_W_(F_Ac_W),
         quadrature_point_data_(std::move(quadrature_point_data)) {
-    DRAKE_DEMAND(std::get<std::unique_ptr<geometry::ContactSurface<T>>>(
-                     contact_surface_) != nullptr);
+    DRAKE_DEMAND(
+        std::get<std::shared_ptr<const geometry::ContactSurface<T>>>(
+            contact_surface_) != nullptr);
   }
   // @}
 
@@ -99,10 +101,13 @@ class HydroelasticContactInfo {
   /// MoveAssignable.
   //@{
 
-  /** Clones this data structure, making deep copies of all underlying data.
-   @note The new object will contain a cloned ContactSurface even if the
-         original was constructed using a raw pointer referencing an existing
-         ContactSurface.
+  /** Copies this data structure. The copy owns its ContactSurface, so that
+   it remains valid regardless of the lifetime of the original object.
+   @note If the original was constructed using a raw pointer referencing an
+         existing ContactSurface, the copy contains a copy of that surface
+         (which cheaply shares the surface's immutable mesh and fields; see
+         geometry::ContactSurface). Otherwise, the (immutable) ContactSurface
+         owned by the original is shared with the copy, rather than copied.
    */
   HydroelasticContactInfo(const HydroelasticContactInfo& info) {
     *this = info;
@@ -112,8 +117,14 @@ class HydroelasticContactInfo {
    @see HydroelasticContactInfo(const HydroelasticContactInfo&)
    */
   HydroelasticContactInfo& operator=(const HydroelasticContactInfo& info) {
-    contact_surface_ =
-        std::make_unique<geometry::ContactSurface<T>>(info.contact_surface());
+    if (std::holds_alternative<const geometry::ContactSurface<T>*>(
+            info.contact_surface_)) {
+      contact_surface_ =
+          std::make_shared<const geometry::ContactSurface<T>>(
+              info.contact_surface());
+    } else {
+      contact_surface_ = info.contact_surface_;
+    }
     F_Ac_W_ = info.F_Ac_W_;
     quadrature_point_data_ = info.quadrature_point_data_;
     return *this;
@@ -131,8 +142,8 @@ class HydroelasticContactInfo {
             contact_surface_)) {
       return *std::get<const geometry::ContactSurface<T>*>(contact_surface_);
     } else {
-      return *std::get<std::unique_ptr<geometry::ContactSurface<T>>>
-                  (contact_surface_);
+      return *std::get<std::shared_ptr<const geometry::ContactSurface<T>>>(
+          contact_surface_);
     }
   }
 
@@ -151,8 +162,10 @@ class HydroelasticContactInfo {
 
  private:
   // Note that the mesh of the contact surface is defined in the world frame.
+  // An owned surface is never modified and therefore it is shared among copies.
   std::variant<const geometry::ContactSurface<T>*,
-                 std::unique_ptr<geometry::ContactSurface<T>>> contact_surface_;
+               std::shared_ptr<const geometry::ContactSurface<T>>>
+      contact_surface_;
 
   // The spatial force applied at the centroid (Point C) of the surface mesh.
   SpatialForce<T> F_Ac_W_;
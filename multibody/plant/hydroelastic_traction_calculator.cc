@@ -7,7 +7,6 @@
 #include <vector>
 
 #include "drake/math/rotation_matrix.h"
-#include "drake/multibody/triangle_quadrature/gaussian_triangle_quadrature_rule.h"
 #include "drake/multibody/triangle_quadrature/triangle_quadrature.h"
 
 namespace drake {
@@ -38,42 +37,19 @@ void HydroelasticTractionCalculator<T>::
   // (i.e., the traction, f). Higher-order pressure fields and nonlinear
   // tractions (from, e.g., incorporating the Stribeck curve into the friction
   // model) might see benefit from a higher-order quadrature.
-  const GaussianTriangleQuadratureRule gaussian(2 /* order */);
+  constexpr int kOrder = 2;
 
   // We'll be accumulating force on body A at the surface centroid C,
-  // triangle-by-triangle.
+  // face-by-face.
   F_Ac_W->SetZero();
 
-  // Reserve enough memory to keep from doing repeated heap allocations in the
-  // quadrature process.
+  const int num_faces = data.surface.num_faces();
   traction_at_quadrature_points->clear();
-  traction_at_quadrature_points->reserve(data.surface.num_faces());
-
-  // Integrate the tractions over all triangles in the contact surface.
-  for (int i = 0; i < data.surface.num_faces(); ++i) {
-    // Construct the function to be integrated over triangle i.
-    // TODO(sherm1) Pull functor creation out of the loop (not a good idea to
-    //              create a new functor for every i).
-    if (data.surface.is_triangle()) {
-      std::function<SpatialForce<T>(const Vector3<T>&)> traction_Ac_W =
-          [this, &data, i, dissipation, mu_coulomb,
-           traction_at_quadrature_points](const Vector3<T>& Q_barycentric) {
-            traction_at_quadrature_points->emplace_back(CalcTractionAtPoint(
-                data, i, Q_barycentric, dissipation, mu_coulomb));
-            const HydroelasticQuadraturePointData<T>& traction_output =
-                traction_at_quadrature_points->back();
-            return ComputeSpatialTractionAtAcFromTractionAtAq(
-                data, traction_output.p_WQ, traction_output.traction_Aq_W);
-          };
-
-      // Compute the integral over the triangle to get a force from the
-      // tractions (force/area) at the Gauss points (shifted to C).
-      const SpatialForce<T> Fi_Ac_W =  // Force from triangle i.
-          TriangleQuadrature<SpatialForce<T>, T>::Integrate(
-              traction_Ac_W, gaussian, data.surface.area(i));
-      // Update the spatial force at the centroid.
-      (*F_Ac_W) += Fi_Ac_W;
-    } else {
+
+  if (!data.surface.is_triangle()) {
+    // Polygonal faces are integrated with a single sample at their centroid.
+    traction_at_quadrature_points->reserve(num_faces);
+    for (int i = 0; i < num_faces; ++i) {
       traction_at_quadrature_points->emplace_back(
           CalcTractionAtCentroid(data, i, dissipation, mu_coulomb));
       const HydroelasticQuadraturePointData<T>& traction_output =
@@ -83,6 +59,36 @@ void HydroelasticTractionCalculator<T>::
               data, traction_output.p_WQ, traction_output.traction_Aq_W);
       (*F_Ac_W) += data.surface.area(i) * traction_Ac_W;
     }
+    return;
+  }
+
+  constexpr int kNumQuadraturePoints =
+      GaussianTriangleQuadratureTable<kOrder>::kNumPoints;
+
+  // Reserve enough memory to keep from doing repeated heap allocations in the
+  // quadrature process; there is one sample per quadrature point.
+  traction_at_quadrature_points->reserve(num_faces * kNumQuadraturePoints);
+
+  // Integrate the tractions over all triangles in the contact surface in one
+  // batch. The integrand records the traction sample at each quadrature point
+  // and returns the spatial traction shifted to C.
+  std::vector<T> areas(num_faces);
+  for (int i = 0; i < num_faces; ++i) areas[i] = data.surface.area(i);
+  std::vector<SpatialForce<T>> F_Ac_W_per_face;
+  TriangleQuadrature<SpatialForce<T>, T>::template IntegrateBatch<kOrder>(
+      [&](int i, const Vector3<T>& Q_barycentric) {
+        traction_at_quadrature_points->emplace_back(CalcTractionAtPoint(
+            data, i, Q_barycentric, dissipation, mu_coulomb));
+        const HydroelasticQuadraturePointData<T>& traction_output =
+            traction_at_quadrature_points->back();
+        return ComputeSpatialTractionAtAcFromTractionAtAq(
+            data, traction_output.p_WQ, traction_output.traction_Aq_W);
+      },
+      areas, &F_Ac_W_per_face);
+
+  // Update the spatial force at the centroid.
+  for (const SpatialForce<T>& Fi_Ac_W : F_Ac_W_per_face) {
+    (*F_Ac_W) += Fi_Ac_W;
   }
 }
 
@@ -3,9 +3,11 @@
 #include <algorithm>
 #include <functional>
 #include <limits>
+#include <map>
 #include <memory>
 #include <set>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 #include "drake/common/drake_throw.h"
@@ -20,9 +22,14 @@
 #include "drake/geometry/render/render_label.h"
 #include "drake/math/random_rotation.h"
 #include "drake/math/rotation_matrix.h"
+#include "drake/multibody/contact_solvers/block_sparse_linear_operator.h"
+#include "drake/multibody/contact_solvers/sap_solver.h"
 #include "drake/multibody/contact_solvers/sparse_linear_operator.h"
+#include "drake/multibody/contact_solvers/tree_ltl_factorization.h"
+#include "drake/multibody/contact_solvers/tree_ltl_inverse_operator.h"
 #include "drake/multibody/hydroelastics/hydroelastic_engine.h"
 #include "drake/multibody/plant/discrete_contact_pair.h"
+#include "drake/multibody/plant/discrete_contact_pair_matching.h"
 #include "drake/multibody/plant/externally_applied_spatial_force.h"
 #include "drake/multibody/plant/hydroelastic_traction_calculator.h"
 #include "drake/multibody/tree/prismatic_joint.h"
@@ -355,6 +362,24 @@ VectorX<T> ExpandRows(const VectorX<T>& v, int rows_out,
   return result;
 }
 
+// Returns `contact_solver` as a SapSolver, or nullptr if it is not one. SAP
+// only supports T = double.
+template <typename T>
+contact_solvers::internal::SapSolver<double>* GetSapSolver(
+    contact_solvers::internal::ContactSolver<T>* contact_solver) {
+  if constexpr (std::is_same_v<T, double>) {
+    return dynamic_cast<contact_solvers::internal::SapSolver<double>*>(
+        contact_solver);
+  } else {
+    return nullptr;
+  }
+}
+
+// Contact pairs of consecutive steps persist when their contact points are at
+// most this far apart, in meters; see MatchPersistentContactPairs(). This is
+// well above the motion of a contact point over a typical time step.
+constexpr double kMaxPersistentContactPointDistance = 1.0e-3;
+
 }  // namespace
 
 template <typename T>
@@ -1286,6 +1311,101 @@ void MultibodyPlant<T>::CopyContactResultsOutput(
   *contact_results = EvalContactResults(context);
 }
 
+template <typename T>
+void MultibodyPlant<T>::CopyBodyPairContactWrenchesOutput(
+    const systems::Context<T>& context,
+    std::vector<BodyPairContactWrench<T>>* wrenches) const {
+  this->ValidateContext(context);
+  DRAKE_DEMAND(wrenches != nullptr);
+  *wrenches = EvalBodyPairContactWrenches(context);
+}
+
+template <typename T>
+void MultibodyPlant<T>::CalcBodyPairContactWrenches(
+    const systems::Context<T>& context,
+    std::vector<BodyPairContactWrench<T>>* wrenches) const {
+  this->ValidateContext(context);
+  DRAKE_DEMAND(wrenches != nullptr);
+  wrenches->clear();
+  if (num_collision_geometries() == 0) return;
+
+  std::map<std::pair<BodyIndex, BodyIndex>, SpatialForce<T>> F_BBo_W_map;
+  if (is_discrete() && discrete_update_manager_ == nullptr) {
+    // Accumulate the forces applied by the contact solver directly, without
+    // building the ContactResults. The discrete pairs include both point
+    // contacts and hydroelastic quadrature points.
+    const std::vector<internal::DiscreteContactPair<T>>& contact_pairs =
+        EvalDiscreteContactPairs(context);
+    const std::vector<RotationMatrix<T>>& R_WC_set =
+        EvalContactJacobians(context).R_WC_list;
+    const contact_solvers::internal::ContactSolverResults<T>& solver_results =
+        EvalContactSolverResults(context);
+    const VectorX<T>& fn = solver_results.fn;
+    const VectorX<T>& ft = solver_results.ft;
+    const int num_contacts = contact_pairs.size();
+    DRAKE_DEMAND(fn.size() == num_contacts);
+    DRAKE_DEMAND(ft.size() == 2 * num_contacts);
+
+    for (int icontact = 0; icontact < num_contacts; ++icontact) {
+      const internal::DiscreteContactPair<T>& pair = contact_pairs[icontact];
+      // Contact force applied on B at contact point C.
+      const Vector3<T> f_Bc_C(ft(2 * icontact), ft(2 * icontact + 1),
+                              -fn(icontact));
+      const Vector3<T> f_Bc_W = R_WC_set[icontact] * f_Bc_C;
+      AccumulateBodyPairContactWrench(
+          context, FindBodyByGeometryId(pair.id_A),
+          FindBodyByGeometryId(pair.id_B),
+          SpatialForce<T>(Vector3<T>::Zero(), f_Bc_W), pair.p_WC,
+          &F_BBo_W_map);
+    }
+  } else {
+    const ContactResults<T>& contact_results = EvalContactResults(context);
+    for (int i = 0; i < contact_results.num_point_pair_contacts(); ++i) {
+      const PointPairContactInfo<T>& info =
+          contact_results.point_pair_contact_info(i);
+      AccumulateBodyPairContactWrench(
+          context, info.bodyA_index(), info.bodyB_index(),
+          SpatialForce<T>(Vector3<T>::Zero(), info.contact_force()),
+          info.contact_point(), &F_BBo_W_map);
+    }
+    for (int i = 0; i < contact_results.num_hydroelastic_contacts(); ++i) {
+      const HydroelasticContactInfo<T>& info =
+          contact_results.hydroelastic_contact_info(i);
+      const geometry::ContactSurface<T>& surface = info.contact_surface();
+      // The force on B at the centroid C is the negative of F_Ac_W.
+      AccumulateBodyPairContactWrench(
+          context, FindBodyByGeometryId(surface.id_M()),
+          FindBodyByGeometryId(surface.id_N()), -info.F_Ac_W(),
+          surface.centroid(), &F_BBo_W_map);
+    }
+  }
+
+  wrenches->reserve(F_BBo_W_map.size());
+  for (const auto& [bodies, F_BBo_W] : F_BBo_W_map) {
+    wrenches->push_back({bodies.first, bodies.second, F_BBo_W});
+  }
+}
+
+template <typename T>
+void MultibodyPlant<T>::AccumulateBodyPairContactWrench(
+    const systems::Context<T>& context, BodyIndex bodyA_index,
+    BodyIndex bodyB_index, const SpatialForce<T>& F_Bc_W,
+    const Vector3<T>& p_WC,
+    std::map<std::pair<BodyIndex, BodyIndex>, SpatialForce<T>>* wrenches)
+    const {
+  // Report every pair with bodyA_index < bodyB_index, so that contacts reported
+  // as (A, B) and as (B, A) are combined.
+  const bool swap = bodyB_index < bodyA_index;
+  const BodyIndex A = swap ? bodyB_index : bodyA_index;
+  const BodyIndex B = swap ? bodyA_index : bodyB_index;
+  const Vector3<T>& p_WBo =
+      EvalBodyPoseInWorld(context, get_body(B)).translation();
+  const SpatialForce<T> F_BBo_W =
+      (swap ? -F_Bc_W : F_Bc_W).Shift(p_WBo - p_WC);
+  auto [it, inserted] = wrenches->emplace(std::make_pair(A, B), F_BBo_W);
+  if (!inserted) it->second += F_BBo_W;
+}
+
 template <typename T>
 void MultibodyPlant<T>::CalcContactResultsContinuous(
     const systems::Context<T>& context,
@@ -2317,7 +2437,8 @@ void MultibodyPlant<T>::CalcContactSolverResults(
   if (contact_solver_ != nullptr) {
     CallContactSolver(contact_solver_.get(), context0.get_time(), v0_unlocked,
                       M0_unlocked, minus_tau_unlocked, phi0, Jc_unlocked,
-                      stiffness, damping, mu, &results_unlocked);
+                      stiffness, damping, mu, contact_pairs,
+                      &results_unlocked);
   } else {
     systems::CacheEntryValue& value =
         this->get_cache_entry(cache_indexes_.contact_solver_scratch)
@@ -2467,6 +2588,7 @@ void MultibodyPlant<symbolic::Expression>::CallContactSolver(
     const VectorX<symbolic::Expression>&, const MatrixX<symbolic::Expression>&,
     const VectorX<symbolic::Expression>&, const VectorX<symbolic::Expression>&,
     const VectorX<symbolic::Expression>&,
+    const std::vector<internal::DiscreteContactPair<symbolic::Expression>>&,
     contact_solvers::internal::ContactSolverResults<symbolic::Expression>*)
     const {
   throw std::logic_error(
@@ -2480,6 +2602,7 @@ void MultibodyPlant<T>::CallContactSolver(
     const VectorX<T>& minus_tau, const VectorX<T>& phi0, const MatrixX<T>& Jc,
     const VectorX<T>& stiffness, const VectorX<T>& damping,
     const VectorX<T>& mu,
+    const std::vector<internal::DiscreteContactPair<T>>& contact_pairs,
     contact_solvers::internal::ContactSolverResults<T>* results) const {
   // Tolerance larger than machine epsilon by an arbitrary factor. Just large
   // enough so that entries close to machine epsilon, due to round-off errors,
@@ -2491,36 +2614,19 @@ void MultibodyPlant<T>::CallContactSolver(
   const contact_solvers::internal::SparseLinearOperator<T> Jc_op("Jc",
                                                                  &Jc_sparse);
 
-  class MassMatrixInverseOperator
-      : public contact_solvers::internal::LinearOperator<T> {
-   public:
-    MassMatrixInverseOperator(const std::string& name, const MatrixX<T>* M)
-        : contact_solvers::internal::LinearOperator<T>(name), M_ldlt_{*M} {
-      DRAKE_DEMAND(M != nullptr);
-      nv_ = M->rows();
-      // TODO(sherm1) Eliminate heap allocation.
-      tmp_.resize(nv_);
-    }
-    ~MassMatrixInverseOperator() = default;
-
-    int rows() const { return nv_; }
-    int cols() const { return nv_; }
-
-   private:
-    void DoMultiply(const Eigen::Ref<const Eigen::SparseVector<T>>& x,
-                    Eigen::SparseVector<T>* y) const final {
-      tmp_ = VectorX<T>(x);
-      *y = M_ldlt_.Solve(tmp_).sparseView();
-    }
-    void DoMultiply(const Eigen::Ref<const VectorX<T>>& x,
-                    VectorX<T>* y) const final {
-      *y = M_ldlt_.Solve(x);
-    }
-    int nv_;
-    mutable VectorX<T> tmp_;  // temporary workspace.
-    math::LinearSolver<Eigen::LDLT, MatrixX<T>> M_ldlt_;
-  };
-  MassMatrixInverseOperator Minv_op("Minv", &M0);
+  // The mass matrix has the sparsity pattern induced by the tree topology,
+  // which we exploit to factorize it in O(nv⋅d²), with d the depth of the
+  // deepest tree.
+  contact_solvers::internal::TreeLtlFactorization<T> M_ltl(
+      internal_tree().get_topology().GetVelocityParents());
+  if (!M_ltl.Factor(M0)) {
+    throw std::runtime_error(fmt::format(
+        "The mass matrix of this MultibodyPlant is not positive definite at "
+        "simulation time = {:7.3g}.",
+        time0));
+  }
+  const contact_solvers::internal::TreeLtlInverseOperator<T> Minv_op(
+      "Minv", &M_ltl);
 
   // Perform the "predictor" step, in the absence of contact forces. See
   // ContactSolver's class documentation for details.
@@ -2532,10 +2638,52 @@ void MultibodyPlant<T>::CallContactSolver(
   v_star *= -time_step();                // v_star = dt⋅M⁻¹⋅τ
   v_star += v0;                          // v_star = v₀ + dt⋅M⁻¹⋅τ
 
-  contact_solvers::internal::SystemDynamicsData<T> dynamics_data(&Minv_op,
-                                                                 &v_star);
+  // SAP is a primal method: it needs the inverse dynamics A = M0, and it
+  // assembles A and Jc as block-sparse matrices. All velocities are treated as
+  // a single tree.
+  contact_solvers::internal::SapSolver<double>* sap_solver =
+      GetSapSolver(contact_solver);
+  contact_solvers::internal::BlockSparseMatrix<T> M_blocks;
+  contact_solvers::internal::BlockSparseMatrix<T> Jc_blocks;
+  std::unique_ptr<contact_solvers::internal::BlockSparseLinearOperator<T>>
+      M_blocks_op;
+  std::unique_ptr<contact_solvers::internal::BlockSparseLinearOperator<T>>
+      Jc_blocks_op;
+  if (sap_solver != nullptr) {
+    const int num_contacts = phi0.size();
+    if (num_contacts == 0) {
+      // SAP only solves problems with constraints. Without contact, v = v*.
+      results->v_next = v_star;
+      results->tau_contact.setZero();
+      contact_solver_previous_pairs_.clear();
+      return;
+    }
+    contact_solvers::internal::BlockSparseMatrixBuilder<T> M_builder(1, 1, 1);
+    M_builder.PushBlock(0, 0, M0);
+    M_blocks = M_builder.Build();
+    contact_solvers::internal::BlockSparseMatrixBuilder<T> Jc_builder(1, 1, 1);
+    Jc_builder.PushBlock(0, 0, Jc);
+    Jc_blocks = Jc_builder.Build();
+    M_blocks_op = std::make_unique<
+        contact_solvers::internal::BlockSparseLinearOperator<T>>("A",
+                                                                 &M_blocks);
+    Jc_blocks_op = std::make_unique<
+        contact_solvers::internal::BlockSparseLinearOperator<T>>("Jc",
+                                                                 &Jc_blocks);
+    sap_solver->SetContactCorrespondence(internal::MatchPersistentContactPairs(
+        contact_solver_previous_pairs_, contact_pairs,
+        kMaxPersistentContactPointDistance));
+  }
+
+  contact_solvers::internal::SystemDynamicsData<T> dynamics_data(
+      M_blocks_op.get(), &Minv_op, &v_star);
   contact_solvers::internal::PointContactData<T> contact_data(
-      &phi0, &Jc_op, &stiffness, &damping, &mu);
+      &phi0,
+      Jc_blocks_op != nullptr
+          ? static_cast<const contact_solvers::internal::LinearOperator<T>*>(
+                Jc_blocks_op.get())
+          : &Jc_op,
+      &stiffness, &damping, &mu);
   const contact_solvers::internal::ContactSolverStatus info =
       contact_solver->SolveWithGuess(time_step(), dynamics_data, contact_data,
                                     v0, &*results);
@@ -2550,6 +2698,9 @@ void MultibodyPlant<T>::CallContactSolver(
                     time0, time_step());
     throw std::runtime_error(msg);
   }
+  if (sap_solver != nullptr) {
+    contact_solver_previous_pairs_ = contact_pairs;
+  }
 }
 
 template <typename T>
@@ -2959,6 +3110,17 @@ void MultibodyPlant<T>::DeclareStateCacheAndPorts() {
                                   {contact_results_cache_entry.ticket()})
                               .get_index();
 
+  // Per body pair contact wrenches output port.
+  const auto& body_pair_contact_wrenches_cache_entry =
+      this->get_cache_entry(cache_indexes_.body_pair_contact_wrenches);
+  body_pair_contact_wrenches_port_ =
+      this->DeclareAbstractOutputPort(
+              "body_pair_contact_wrenches",
+              std::vector<BodyPairContactWrench<T>>(),
+              &MultibodyPlant<T>::CopyBodyPairContactWrenchesOutput,
+              {body_pair_contact_wrenches_cache_entry.ticket()})
+          .get_index();
+
   // Let external model managers declare their state, cache and ports in
   // `this` MultibodyPlant.
   for (auto& physical_model : physical_models_) {
@@ -3096,6 +3258,19 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
       {dependency_ticket});
   cache_indexes_.contact_results = contact_results_cache_entry.cache_index();
 
+  // Cache the per body pair summary of the contact results. It depends on the
+  // same quantities as the contact results, which it might evaluate, and on
+  // the body poses.
+  std::set<systems::DependencyTicket> wrenches_tickets = dependency_ticket;
+  wrenches_tickets.insert(
+      this->cache_entry_ticket(cache_indexes_.contact_results));
+  wrenches_tickets.insert(this->configuration_ticket());
+  auto& body_pair_contact_wrenches_cache_entry = this->DeclareCacheEntry(
+      std::string("Body pair contact wrenches."),
+      &MultibodyPlant<T>::CalcBodyPairContactWrenches, {wrenches_tickets});
+  cache_indexes_.body_pair_contact_wrenches =
+      body_pair_contact_wrenches_cache_entry.cache_index();
+
   // Cache spatial continuous contact forces.
   auto& spatial_contact_forces_continuous_cache_entry = this->DeclareCacheEntry(
       "Spatial contact forces (continuous).",
@@ -3258,6 +3433,13 @@ MultibodyPlant<T>::get_contact_results_output_port() const {
   return this->get_output_port(contact_results_port_);
 }
 
+template <typename T>
+const systems::OutputPort<T>&
+MultibodyPlant<T>::get_body_pair_contact_wrenches_output_port() const {
+  DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+  return this->get_output_port(body_pair_contact_wrenches_port_);
+}
+
 template <typename T>
 const systems::OutputPort<T>&
 MultibodyPlant<T>::get_reaction_forces_output_port() const {
@@ -3348,8 +3530,7 @@ void MultibodyPlant<T>::CalcFramePoseOutput(
 
     // NOTE: The GeometryFrames for each body were registered in the world
     // frame, so we report poses in the world frame.
-    poses->set_value(body_index_to_frame_id_.at(body_index),
-                     pc.get_X_WB(body.node_index()));
+    poses->set_value(it.second, pc.get_X_WB(body.node_index()));
   }
 }
 
@@ -20,6 +20,7 @@
 #include "drake/math/rigid_transform.h"
 #include "drake/multibody/contact_solvers/contact_solver.h"
 #include "drake/multibody/contact_solvers/contact_solver_results.h"
+#include "drake/multibody/plant/body_pair_contact_wrench.h"
 #include "drake/multibody/plant/contact_jacobians.h"
 #include "drake/multibody/plant/contact_results.h"
 #include "drake/multibody/plant/coulomb_friction.h"
@@ -132,6 +133,7 @@ output_ports:
 - generalized_acceleration
 - reaction_forces
 - contact_results
+- body_pair_contact_wrenches
 - <em style="color:gray">model_instance_name[i]</em>_continuous_state
 - '<em style="color:gray">
   model_instance_name[i]</em>_generalized_acceleration'
@@ -244,6 +246,13 @@ The vector `τ ∈ ℝⁿᵛ` on the right hand side of Eq. (1) is
 the system's generalized forces. These incorporate gravity, springs,
 externally applied body forces, constraint forces, and contact forces.
 
+For a continuous %MultibodyPlant, Eq. (1) is solved for v̇ with the O(n)
+Articulated %Body Algorithm [Featherstone 2008] rather than by forming and
+factorizing the dense mass matrix `M(q)`, whose O(n³) factorization dominates
+the cost of forward dynamics for models with many degrees of freedom. The
+result is available via get_generalized_acceleration_output_port() and is what
+CalcTimeDerivatives() reports.
+
 @anchor sdf_loading
                  ### Loading models from SDFormat files
 
@@ -715,6 +724,24 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   /// @throws std::exception if called pre-finalize, see Finalize().
   const systems::OutputPort<T>& get_contact_results_output_port() const;
 
+  /// Returns a constant reference to the port that outputs a summary of the
+  /// contact results: the net contact spatial force between each pair of
+  /// bodies in contact, as a std::vector<BodyPairContactWrench<T>> with one
+  /// entry per body pair, sorted by (bodyA_index, bodyB_index).
+  ///
+  /// Consumers that only need net wrenches (e.g., force/torque or tactile
+  /// sensor models) should prefer this port over
+  /// get_contact_results_output_port(). The per-point and per-face data in
+  /// ContactResults are only computed when that port (or another consumer of
+  /// the same cache entry) is evaluated. For a discrete model, this port is
+  /// computed directly from the contact solver results, and reports the forces
+  /// actually applied by the solver for both point and hydroelastic contact.
+  /// For a continuous model, or a discrete model using an external discrete
+  /// update manager, it is accumulated from the ContactResults.
+  /// @throws std::exception if called pre-finalize, see Finalize().
+  const systems::OutputPort<T>& get_body_pair_contact_wrenches_output_port()
+      const;
+
   /// Returns the output port of frames' poses to communicate with a
   /// SceneGraph.
   const systems::OutputPort<T>& get_geometry_poses_output_port() const;
@@ -1685,7 +1712,10 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   ///
   /// @param solver The contact solver to be used for simulations of discrete
   /// models with frictional contact. Discrete updates will use this solver
-  /// after this call.
+  /// after this call. A SapSolver additionally receives the mass matrix it
+  /// needs and, between consecutive discrete updates, the correspondence of
+  /// persistent contacts used by
+  /// SapSolverParameters::warm_start_with_impulses.
   /// @pre solver != nullptr.
   /// @note `this` MultibodyPlant will no longer support scalar conversion to or
   /// from symbolic::Expression after a call to this method.
@@ -3549,6 +3579,59 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   }
   /// @} <!-- System matrix computations -->
 
+  /// @anchor mbp_batched_evaluation
+  /// @name                    Batched evaluation
+  /// The methods in this group evaluate a quantity for a batch of N
+  /// configurations (or states) at once, supplied as the columns of an nq × N
+  /// matrix `q_batch` (and, if needed, an nv × N matrix `v_batch`). They are
+  /// intended for sampling-based algorithms that evaluate many configurations
+  /// in a tight loop: a single scratch `context` is reused for all of the
+  /// samples, so that the cache entries and the auxiliary storage used by the
+  /// underlying algorithms are allocated once per batch rather than once per
+  /// sample.
+  ///
+  /// On return, `context` holds the state of the last sample in the batch; the
+  /// rest of its contents (e.g., parameters and input ports) are those
+  /// supplied by the caller and are shared by all of the samples.
+  /// @throws std::exception if `context` is nullptr or does not correspond to
+  /// this plant, or if the arguments are not sized as documented.
+  /// @{
+
+  /// Batched version of CalcMassMatrix(). On output, `M_batch` is an
+  /// nv × (nv⋅N) matrix whose i-th nv × nv block of columns is the mass matrix
+  /// evaluated at `q_batch.col(i)`.
+  void CalcMassMatrixBatch(systems::Context<T>* context,
+                           const Eigen::Ref<const MatrixX<T>>& q_batch,
+                           EigenPtr<MatrixX<T>> M_batch) const {
+    this->ValidateContext(context);
+    internal_tree().CalcMassMatrixBatch(context, q_batch, M_batch);
+  }
+
+  /// Batched version of CalcBiasTerm(). On output, `Cv_batch` is an nv × N
+  /// matrix whose i-th column is the bias term evaluated at the state
+  /// (`q_batch.col(i)`, `v_batch.col(i)`).
+  void CalcBiasTermBatch(systems::Context<T>* context,
+                         const Eigen::Ref<const MatrixX<T>>& q_batch,
+                         const Eigen::Ref<const MatrixX<T>>& v_batch,
+                         EigenPtr<MatrixX<T>> Cv_batch) const {
+    this->ValidateContext(context);
+    internal_tree().CalcBiasTermBatch(context, q_batch, v_batch, Cv_batch);
+  }
+
+  /// Computes the pose `X_WB` of every body in the world frame for each of the
+  /// configurations in `q_batch`. The results are stored in structure-of-arrays
+  /// layout: on output, `X_WB_batch` has num_bodies() × N entries and the pose
+  /// of the body with index `b` for the i-th sample is
+  /// `(*X_WB_batch)[b * N + i]`, so the poses of any given body across the
+  /// whole batch are contiguous.
+  void CalcAllBodyPosesInWorldBatch(
+      systems::Context<T>* context, const Eigen::Ref<const MatrixX<T>>& q_batch,
+      std::vector<math::RigidTransform<T>>* X_WB_batch) const {
+    this->ValidateContext(context);
+    internal_tree().CalcAllBodyPosesInWorldBatch(context, q_batch, X_WB_batch);
+  }
+  /// @} <!-- Batched evaluation -->
+
   /// @anchor mbp_introspection
   /// @name                    Introspection
   /// These methods allow a user to query whether a given multibody element is
@@ -4171,6 +4254,7 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // MultibodyPlant specific cache entries. These are initialized at Finalize()
   // when the plant declares its cache entries.
   struct CacheIndexes {
+    systems::CacheIndex body_pair_contact_wrenches;
     systems::CacheIndex contact_info_and_body_spatial_forces;
     systems::CacheIndex contact_jacobians;
     systems::CacheIndex contact_results;
@@ -4460,6 +4544,30 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
         .template Eval<ContactResults<T>>(context);
   }
 
+  // Computes the net contact spatial force between each pair of bodies in
+  // contact. See get_body_pair_contact_wrenches_output_port().
+  // @param[out] wrenches is fully overwritten
+  void CalcBodyPairContactWrenches(
+      const systems::Context<T>& context,
+      std::vector<BodyPairContactWrench<T>>* wrenches) const;
+
+  // Adds the contact force F_Bc_W, applied on body B at point C (whose
+  // position in the world is p_WC), to the net spatial force between bodies A
+  // and B stored in `wrenches`, keyed by the ordered pair of body indexes.
+  void AccumulateBodyPairContactWrench(
+      const systems::Context<T>& context, BodyIndex bodyA_index,
+      BodyIndex bodyB_index, const SpatialForce<T>& F_Bc_W,
+      const Vector3<T>& p_WC,
+      std::map<std::pair<BodyIndex, BodyIndex>, SpatialForce<T>>* wrenches)
+      const;
+
+  // Evaluate the net contact spatial force between each pair of bodies.
+  const std::vector<BodyPairContactWrench<T>>& EvalBodyPairContactWrenches(
+      const systems::Context<T>& context) const {
+    return this->get_cache_entry(cache_indexes_.body_pair_contact_wrenches)
+        .template Eval<std::vector<BodyPairContactWrench<T>>>(context);
+  }
+
   // Calc method for the reaction forces output port.
   // A joint constraints the motion between a frame Jp on a "parent" P and a
   // frame Jc on a "child" frame C. This generates reaction forces on bodies P
@@ -4592,6 +4700,10 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
       const systems::Context<T>& context,
       ContactResults<T>* contact_results) const;
 
+  void CopyBodyPairContactWrenchesOutput(
+      const systems::Context<T>& context,
+      std::vector<BodyPairContactWrench<T>>* wrenches) const;
+
   // Helper method to compute penetration point pairs for a given `context`.
   // Having this as a separate method allows us to control specializations for
   // different scalar types.
@@ -4749,12 +4861,16 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // Helper to invoke ContactSolver when one is available. This method and
   // `CallTamsiSolver()` are disjoint methods. One should only use one or the
   // other, but not both.
+  // If `contact_solver` is a SapSolver, it is also given the inverse dynamics
+  // A = M0 it needs and, when it warm-starts with impulses, the correspondence
+  // between `contact_pairs` and the pairs of its previous solve.
   void CallContactSolver(
       contact_solvers::internal::ContactSolver<T>* contact_solver,
       const T& time0, const VectorX<T>& v0, const MatrixX<T>& M0,
       const VectorX<T>& minus_tau, const VectorX<T>& phi0, const MatrixX<T>& Jc,
       const VectorX<T>& stiffness, const VectorX<T>& damping,
       const VectorX<T>& mu,
+      const std::vector<internal::DiscreteContactPair<T>>& contact_pairs,
       contact_solvers::internal::ContactSolverResults<T>* results) const;
 
   // Removes `this` MultibodyPlant's ability to convert to the scalar types
@@ -4955,6 +5071,9 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // Index for the output port of ContactResults.
   systems::OutputPortIndex contact_results_port_;
 
+  // Index for the output port of the per body pair contact wrenches.
+  systems::OutputPortIndex body_pair_contact_wrenches_port_;
+
   // Joint reactions forces port index.
   systems::OutputPortIndex reaction_forces_port_;
 
@@ -4979,6 +5098,12 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // solver to be used for discrete updates.
   std::unique_ptr<contact_solvers::internal::ContactSolver<T>> contact_solver_;
 
+  // The discrete contact pairs of the last successful solve by contact_solver_,
+  // when it is a SapSolver that warm-starts with impulses. Like the impulses
+  // the solver keeps, they belong to the plant rather than to a context.
+  mutable std::vector<internal::DiscreteContactPair<T>>
+      contact_solver_previous_pairs_;
+
   // When not the nullptr, this manager class is used to advance discrete
   // states.
   // TODO(amcastro-tri): migrate the entirety of computations related to contact
@@ -5168,6 +5293,7 @@ void MultibodyPlant<symbolic::Expression>::CallContactSolver(
     const VectorX<symbolic::Expression>&, const MatrixX<symbolic::Expression>&,
     const VectorX<symbolic::Expression>&, const VectorX<symbolic::Expression>&,
     const VectorX<symbolic::Expression>&,
+    const std::vector<internal::DiscreteContactPair<symbolic::Expression>>&,
     contact_solvers::internal::ContactSolverResults<symbolic::Expression>*)
     const;
 #endif
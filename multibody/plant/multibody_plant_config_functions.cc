@@ -25,6 +25,15 @@ AddResult AddMultibodyPlant(
   return result;
 }
 
+AddResult AddMultibodyPlant(
+    const MultibodyPlantConfig& plant_config,
+    const geometry::SceneGraphConfig& scene_graph_config,
+    systems::DiagramBuilder<double>* builder) {
+  AddResult result = AddMultibodyPlant(plant_config, builder);
+  result.scene_graph.set_config(scene_graph_config);
+  return result;
+}
+
 namespace internal {
 namespace {
 
@@ -3,6 +3,7 @@
 #include <string>
 
 #include "drake/geometry/query_results/contact_surface.h"
+#include "drake/geometry/scene_graph_config.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/multibody/plant/multibody_plant_config.h"
 #include "drake/systems/framework/diagram_builder.h"
@@ -16,6 +17,15 @@ AddMultibodyPlantSceneGraphResult<double> AddMultibodyPlant(
     const MultibodyPlantConfig& config,
     systems::DiagramBuilder<double>* builder);
 
+/// Adds a new MultibodyPlant and SceneGraph to the given `builder`.  The
+/// plant's settings such as `time_step` are set using the given `plant_config`.
+/// The scene graph's settings are set using the given `scene_graph_config`.
+/// @throws std::exception if either config contains invalid values.
+AddMultibodyPlantSceneGraphResult<double> AddMultibodyPlant(
+    const MultibodyPlantConfig& plant_config,
+    const geometry::SceneGraphConfig& scene_graph_config,
+    systems::DiagramBuilder<double>* builder);
+
 namespace internal {
 
 // (Exposed for unit testing only.)
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
@@ -581,6 +582,158 @@ void TamsiSolver<T>::CalcJacobian(
   }
 }
 
+template <typename T>
+int TamsiSolver<T>::CoupledGroupsWorkspace::FindRoot(int i) {
+  while (parent_[i] != i) {
+    parent_[i] = parent_[parent_[i]];  // Path halving.
+    i = parent_[i];
+  }
+  return i;
+}
+
+template <typename T>
+void TamsiSolver<T>::CoupledGroupsWorkspace::Unite(int i, int j) {
+  const int root_i = FindRoot(i);
+  const int root_j = FindRoot(j);
+  if (root_i != root_j) {
+    parent_[std::max(root_i, root_j)] = std::min(root_i, root_j);
+  }
+}
+
+template <typename T>
+void TamsiSolver<T>::CoupledGroupsWorkspace::Update(
+    const Eigen::Ref<const MatrixX<T>>& M,
+    const Eigen::Ref<const MatrixX<T>>& Jn,
+    const Eigen::Ref<const MatrixX<T>>& Jt) {
+  const int nv = M.rows();
+  const int nc = Jn.rows();
+  parent_.resize(nv);
+  std::iota(parent_.begin(), parent_.end(), 0);
+
+  // Velocities coupled by the mass matrix.
+  for (int j = 0; j < nv; ++j) {
+    for (int i = j + 1; i < nv; ++i) {
+      if (M(i, j) != 0.0 || M(j, i) != 0.0) Unite(i, j);
+    }
+  }
+  // Velocities coupled through a contact point. For each contact point, all
+  // velocities with a nonzero entry in its rows of Jn or Jt are coupled.
+  // first_velocity(ic) returns the first such velocity, or -1 if the contact
+  // point does not involve any velocity.
+  auto first_velocity = [&](int ic) {
+    for (int j = 0; j < nv; ++j) {
+      if (Jn(ic, j) != 0.0 || Jt(2 * ic, j) != 0.0 ||
+          Jt(2 * ic + 1, j) != 0.0) {
+        return j;
+      }
+    }
+    return -1;
+  };
+  for (int ic = 0; ic < nc; ++ic) {
+    const int first = first_velocity(ic);
+    if (first < 0) continue;
+    for (int j = first + 1; j < nv; ++j) {
+      if (Jn(ic, j) != 0.0 || Jt(2 * ic, j) != 0.0 ||
+          Jt(2 * ic + 1, j) != 0.0) {
+        Unite(first, j);
+      }
+    }
+  }
+
+  // Number the groups in order of their smallest velocity index.
+  group_of_root_.assign(nv, -1);
+  num_groups_ = 0;
+  for (int i = 0; i < nv; ++i) {
+    const int root = FindRoot(i);
+    if (group_of_root_[root] < 0) group_of_root_[root] = num_groups_++;
+  }
+  if (static_cast<int>(velocities_.size()) < num_groups_) {
+    velocities_.resize(num_groups_);
+    contacts_.resize(num_groups_);
+    J_.resize(num_groups_);
+    rhs_.resize(num_groups_);
+    J_ldlt_.resize(num_groups_);
+    J_lu_.resize(num_groups_);
+  }
+  for (int g = 0; g < num_groups_; ++g) {
+    velocities_[g].clear();
+    contacts_[g].clear();
+  }
+  for (int i = 0; i < nv; ++i) {
+    velocities_[group_of_root_[FindRoot(i)]].push_back(i);
+  }
+  for (int ic = 0; ic < nc; ++ic) {
+    const int first = first_velocity(ic);
+    if (first < 0) continue;
+    contacts_[group_of_root_[FindRoot(first)]].push_back(ic);
+  }
+}
+
+template <typename T>
+bool TamsiSolver<T>::CalcNewtonUpdateByGroups(
+    const Eigen::Ref<const MatrixX<T>>& M,
+    const Eigen::Ref<const MatrixX<T>>& Jn,
+    const Eigen::Ref<const MatrixX<T>>& Jt,
+    const Eigen::Ref<const MatrixX<T>>& Gn,
+    const std::vector<Matrix2<T>>& dft_dvt,
+    const Eigen::Ref<const VectorX<T>>& t_hat,
+    const Eigen::Ref<const VectorX<T>>& mu_vt, double dt,
+    const Eigen::Ref<const VectorX<T>>& residual,
+    EigenPtr<VectorX<T>> Delta_v) const {
+  CoupledGroupsWorkspace& groups = coupled_groups_workspace_;
+  for (int g = 0; g < groups.num_groups(); ++g) {
+    const std::vector<int>& velocities = groups.velocities(g);
+    const int n = velocities.size();
+
+    // The group's block of J = M − δt Jₙᵀ Gn − δt Jₜᵀ Gt, see CalcJacobian().
+    MatrixX<T>& J = groups.mutable_J(g);
+    J.resize(n, n);
+    for (int b = 0; b < n; ++b) {
+      for (int a = 0; a < n; ++a) {
+        J(a, b) = M(velocities[a], velocities[b]);
+      }
+    }
+    for (int ic : groups.contacts(g)) {
+      const int ik = 2 * ic;
+      for (int b = 0; b < n; ++b) {
+        const int jb = velocities[b];
+        // Column jb of Gt = −∇ᵥfₜ for this contact point.
+        Vector2<T> Gt_b = -dft_dvt[ic] * Vector2<T>(Jt(ik, jb), Jt(ik + 1, jb));
+        if (has_two_way_coupling()) {
+          Gt_b -= mu_vt(ic) * t_hat.template segment<2>(ik) * Gn(ic, jb);
+        }
+        for (int a = 0; a < n; ++a) {
+          const int ja = velocities[a];
+          J(a, b) -= dt * (Jt(ik, ja) * Gt_b(0) + Jt(ik + 1, ja) * Gt_b(1));
+          if (has_two_way_coupling()) {
+            J(a, b) -= dt * Jn(ic, ja) * Gn(ic, jb);
+          }
+        }
+      }
+    }
+
+    VectorX<T>& rhs = groups.mutable_rhs(g);
+    rhs.resize(n);
+    for (int a = 0; a < n; ++a) {
+      rhs(a) = -residual(velocities[a]);
+    }
+    if (has_two_way_coupling()) {
+      auto& J_lu = groups.mutable_J_lu(g);
+      J_lu.compute(J);
+      rhs = J_lu.solve(rhs);
+    } else {
+      auto& J_ldlt = groups.mutable_J_ldlt(g);
+      J_ldlt.compute(J);
+      if (J_ldlt.info() != Eigen::Success) return false;
+      J_ldlt.solveInPlace(rhs);
+    }
+    for (int a = 0; a < n; ++a) {
+      (*Delta_v)(velocities[a]) = rhs(a);
+    }
+  }
+  return true;
+}
+
 template <typename T>
 T TamsiSolver<T>::CalcAlpha(
     const Eigen::Ref<const VectorX<T>>& vt,
@@ -664,6 +817,12 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
   auto fn = variable_size_workspace_.mutable_fn();
   auto v_slip = variable_size_workspace_.mutable_v_slip();
 
+  // Partition the velocities into groups that are not coupled by the Jacobian.
+  // When there is more than one group, the Newton update is computed group by
+  // group, which avoids forming and factoring the dense nv x nv Jacobian.
+  coupled_groups_workspace_.Update(M, Jn, Jt);
+  const bool solve_by_groups = coupled_groups_workspace_.num_groups() > 1;
+
   // Initialize vt_error to an arbitrary value larger than tolerance so that the
   // solver at least performs one iteration.
   double vt_error = 2 * v_contact_tolerance;
@@ -700,19 +859,24 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
     // t_hat and v_slip.
     CalcFrictionForcesGradient(fn, mu_vt, t_hat, v_slip, &dft_dvt);
 
-    // Newton-Raphson Jacobian, J = ∇ᵥR, as a function of M, dft_dvt, Jt, dt.
-    CalcJacobian(M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt, dt, &J);
-
     // TODO(amcastro-tri): Consider using a cheap iterative solver like CG.
     // Since we are in a non-linear iteration, an approximate cheap solution
     // is probably best.
     // TODO(amcastro-tri): Consider using a matrix-free iterative method to
     // avoid computing M and J. CG and the Krylov family can be matrix-free.
-    if (has_two_way_coupling()) {
+    if (solve_by_groups) {
+      if (!CalcNewtonUpdateByGroups(M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt, dt,
+                                    residual, &Delta_v)) {
+        return TamsiSolverResult::kLinearSolverFailed;
+      }
+    } else if (has_two_way_coupling()) {
+      // Newton-Raphson Jacobian, J = ∇ᵥR, as a function of M, dft_dvt, Jt, dt.
+      CalcJacobian(M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt, dt, &J);
       auto& J_lu = fixed_size_workspace_.mutable_J_lu();
       J_lu.compute(J);  // Update factorization.
       Delta_v = J_lu.solve(-residual);
     } else {
+      CalcJacobian(M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt, dt, &J);
       auto& J_ldlt = fixed_size_workspace_.mutable_J_ldlt();
       J_ldlt.compute(J);  // Update factorization.
       if (J_ldlt.info() != Eigen::Success) {
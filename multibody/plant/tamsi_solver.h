@@ -1104,6 +1104,52 @@ class TamsiSolver {
     MatrixX<T> Gn_;        // ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹), in ℝⁿᶜˣⁿᵛ
   };
 
+  // The Newton-Raphson Jacobian J = M − δt Jₙᵀ Gn − δt Jₜᵀ Gt only couples two
+  // generalized velocities if they are coupled by the mass matrix or if they
+  // both participate in a common contact point. For instance, for a pile of
+  // free bodies, J is block diagonal (up to a permutation) with one block per
+  // cluster of bodies in contact. This workspace stores such a partition of
+  // the generalized velocities into independent groups, so that the Newton
+  // update can be computed group by group instead of with a dense factorization
+  // of the full nv x nv Jacobian. Its storage is reused across solves.
+  class CoupledGroupsWorkspace {
+   public:
+    // Recomputes the partition for the given problem data.
+    void Update(const Eigen::Ref<const MatrixX<T>>& M,
+                const Eigen::Ref<const MatrixX<T>>& Jn,
+                const Eigen::Ref<const MatrixX<T>>& Jt);
+
+    int num_groups() const { return num_groups_; }
+
+    // The (sorted) generalized velocity indices in group g.
+    const std::vector<int>& velocities(int g) const { return velocities_[g]; }
+
+    // The contact point indices in group g.
+    const std::vector<int>& contacts(int g) const { return contacts_[g]; }
+
+    MatrixX<T>& mutable_J(int g) { return J_[g]; }
+    VectorX<T>& mutable_rhs(int g) { return rhs_[g]; }
+    Eigen::LDLT<MatrixX<T>>& mutable_J_ldlt(int g) { return J_ldlt_[g]; }
+    Eigen::PartialPivLU<MatrixX<T>>& mutable_J_lu(int g) { return J_lu_[g]; }
+
+   private:
+    // Union-find helpers over the generalized velocities.
+    int FindRoot(int i);
+    void Unite(int i, int j);
+
+    int num_groups_{0};
+    std::vector<int> parent_;
+    std::vector<int> group_of_root_;
+    // Only the first num_groups_ entries of the vectors below are meaningful.
+    // Entries past that are kept to reuse their storage.
+    std::vector<std::vector<int>> velocities_;
+    std::vector<std::vector<int>> contacts_;
+    std::vector<MatrixX<T>> J_;
+    std::vector<VectorX<T>> rhs_;
+    std::vector<Eigen::LDLT<MatrixX<T>>> J_ldlt_;
+    std::vector<Eigen::PartialPivLU<MatrixX<T>>> J_lu_;
+  };
+
   // Returns true if the solver is solving the two-way coupled problem.
   bool has_two_way_coupling() const {
     return problem_data_aliases_.has_two_way_coupling_data();
@@ -1160,6 +1206,21 @@ class TamsiSolver {
       const Eigen::Ref<const VectorX<T>>& mu_vt, double dt,
       EigenPtr<MatrixX<T>> J) const;
 
+  // Computes the Newton-Raphson update Δv = −J⁻¹R one group at a time, for the
+  // groups in coupled_groups_workspace_ (see CoupledGroupsWorkspace). The
+  // arguments are the same as those of CalcJacobian().
+  // Returns false if the factorization of any of the group's Jacobians fails.
+  bool CalcNewtonUpdateByGroups(
+      const Eigen::Ref<const MatrixX<T>>& M,
+      const Eigen::Ref<const MatrixX<T>>& Jn,
+      const Eigen::Ref<const MatrixX<T>>& Jt,
+      const Eigen::Ref<const MatrixX<T>>& Gn,
+      const std::vector<Matrix2<T>>& dft_dvt,
+      const Eigen::Ref<const VectorX<T>>& t_hat,
+      const Eigen::Ref<const VectorX<T>>& mu_vt, double dt,
+      const Eigen::Ref<const VectorX<T>>& residual,
+      EigenPtr<VectorX<T>> Delta_v) const;
+
   // Limit the per-iteration angle change between vₜᵏ⁺¹ and vₜᵏ for
   // all contact points. The angle change θ is defined by the dot product
   // between vₜᵏ⁺¹ and vₜᵏ as: cos(θ) = vₜᵏ⁺¹⋅vₜᵏ/(‖vₜᵏ⁺¹‖‖vₜᵏ‖).
@@ -1207,6 +1268,7 @@ class TamsiSolver {
   // thread-unsafe integration elsewhere.
   mutable FixedSizeWorkspace fixed_size_workspace_;
   mutable VariableSizeWorkspace variable_size_workspace_;
+  mutable CoupledGroupsWorkspace coupled_groups_workspace_;
 
   // Precomputed value of cos(theta_max), used by TalsLimiter.
   double cos_theta_max_{std::cos(parameters_.theta_max)};
@@ -1,5 +1,7 @@
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -131,6 +133,31 @@ class SlidingBoxTest : public ::testing::Test {
 
       // There should not be motion in the normal direction.
       EXPECT_NEAR(point_pair_contact_info.separation_speed(), 0.0, kTolerance);
+
+      // The summary port reports the same force as a single body pair wrench,
+      // on the body with the larger index and about its origin.
+      const std::vector<BodyPairContactWrench<double>>& wrenches =
+          the_plant.get_body_pair_contact_wrenches_output_port()
+              .Eval<std::vector<BodyPairContactWrench<double>>>(the_context);
+      ASSERT_EQ(wrenches.size(), 1);
+      const BodyPairContactWrench<double>& wrench = wrenches[0];
+      EXPECT_EQ(wrench.bodyA_index, std::min(box.index(), ground.index()));
+      EXPECT_EQ(wrench.bodyB_index, std::max(box.index(), ground.index()));
+      const double sign =
+          point_pair_contact_info.bodyB_index() == wrench.bodyB_index ? 1.0
+                                                                      : -1.0;
+      const Vector3<double>& p_WBo =
+          the_plant
+              .EvalBodyPoseInWorld(the_context,
+                                   the_plant.get_body(wrench.bodyB_index))
+              .translation();
+      const SpatialForce<double> F_BBo_W_expected =
+          SpatialForce<double>(Vector3<double>::Zero(),
+                               sign * point_pair_contact_info.contact_force())
+              .Shift(p_WBo - point_pair_contact_info.contact_point());
+      EXPECT_TRUE(CompareMatrices(wrench.F_BBo_W.get_coeffs(),
+                                  F_BBo_W_expected.get_coeffs(), kTolerance,
+                                  MatrixCompareType::relative));
     };
 
     // Verify contact results at the end of the simulation.
@@ -0,0 +1,116 @@
+#include "drake/multibody/plant/collision_checker.h"
+
+#include <memory>
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/query_object.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+using geometry::HalfSpace;
+using geometry::QueryObject;
+using geometry::SceneGraph;
+using geometry::Sphere;
+using math::RigidTransformd;
+using systems::Context;
+using systems::Diagram;
+using systems::DiagramBuilder;
+
+constexpr double kRadius = 0.5;
+
+// Two free spheres above an anchored ground half space.
+class CollisionCheckerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    DiagramBuilder<double> builder;
+    std::tie(plant_, scene_graph_) = AddMultibodyPlantSceneGraph(&builder, 0.0);
+    const auto M = SpatialInertia<double>::MakeFromCentralInertia(
+        1.0, Vector3<double>::Zero(),
+        UnitInertia<double>::SolidSphere(kRadius));
+    sphere1_ = &plant_->AddRigidBody("sphere1", M);
+    sphere2_ = &plant_->AddRigidBody("sphere2", M);
+    const CoulombFriction<double> friction(0.5, 0.5);
+    plant_->RegisterCollisionGeometry(*sphere1_, RigidTransformd(),
+                                      Sphere(kRadius), "sphere1", friction);
+    plant_->RegisterCollisionGeometry(*sphere2_, RigidTransformd(),
+                                      Sphere(kRadius), "sphere2", friction);
+    plant_->RegisterCollisionGeometry(plant_->world_body(), RigidTransformd(),
+                                      HalfSpace(), "ground", friction);
+    plant_->Finalize();
+    diagram_ = builder.Build();
+    diagram_context_ = diagram_->CreateDefaultContext();
+  }
+
+  // Returns the configuration with the spheres' centers at heights z1 and z2,
+  // separated by distance dx along the x axis.
+  VectorX<double> MakePositions(double z1, double z2, double dx) {
+    Context<double>& plant_context =
+        plant_->GetMyMutableContextFromRoot(diagram_context_.get());
+    plant_->SetFreeBodyPose(&plant_context, *sphere1_,
+                            RigidTransformd(Vector3<double>(0.0, 0.0, z1)));
+    plant_->SetFreeBodyPose(&plant_context, *sphere2_,
+                            RigidTransformd(Vector3<double>(dx, 0.0, z2)));
+    return plant_->GetPositions(plant_context);
+  }
+
+  // Reference result through SceneGraph's query object.
+  bool HasCollisionsThroughSceneGraph(const VectorX<double>& q) {
+    Context<double>& plant_context =
+        plant_->GetMyMutableContextFromRoot(diagram_context_.get());
+    plant_->SetPositions(&plant_context, q);
+    const auto& query_object =
+        plant_->get_geometry_query_input_port()
+            .Eval<QueryObject<double>>(plant_context);
+    return query_object.HasCollisions();
+  }
+
+  MultibodyPlant<double>* plant_{};
+  SceneGraph<double>* scene_graph_{};
+  const RigidBody<double>* sphere1_{};
+  const RigidBody<double>* sphere2_{};
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> diagram_context_;
+};
+
+TEST_F(CollisionCheckerTest, HasCollisions) {
+  CollisionChecker checker(plant_, scene_graph_->model_inspector());
+  EXPECT_EQ(checker.num_dynamic_geometries(), 2);
+
+  const VectorX<double> q_free = MakePositions(1.0, 1.0, 3.0);
+  const VectorX<double> q_spheres = MakePositions(1.0, 1.0, 0.5);
+  const VectorX<double> q_ground = MakePositions(0.25, 1.0, 3.0);
+  for (const VectorX<double>& q : {q_free, q_spheres, q_ground}) {
+    EXPECT_EQ(checker.HasCollisions(q), HasCollisionsThroughSceneGraph(q));
+  }
+  EXPECT_FALSE(checker.HasCollisions(q_free));
+  EXPECT_TRUE(checker.HasCollisions(q_spheres));
+  EXPECT_TRUE(checker.HasCollisions(q_ground));
+
+  // Copies are independent of the original.
+  CollisionChecker copy(checker);
+  EXPECT_FALSE(copy.HasCollisions(q_free));
+  EXPECT_TRUE(checker.HasCollisions(q_spheres));
+  EXPECT_FALSE(copy.HasCollisions(q_free));
+}
+
+TEST_F(CollisionCheckerTest, UnregisteredPlant) {
+  MultibodyPlant<double> plant(0.0);
+  plant.Finalize();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      CollisionChecker(&plant, scene_graph_->model_inspector()),
+      ".*must be registered as a geometry source.*");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,69 @@
+#include "drake/multibody/plant/discrete_contact_pair_matching.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using geometry::GeometryId;
+
+DiscreteContactPair<double> MakePair(GeometryId id_A, GeometryId id_B,
+                                     const Vector3d& p_WC) {
+  DiscreteContactPair<double> pair;
+  pair.id_A = id_A;
+  pair.id_B = id_B;
+  pair.p_WC = p_WC;
+  return pair;
+}
+
+GTEST_TEST(MatchPersistentContactPairs, Match) {
+  const GeometryId box = GeometryId::get_new_id();
+  const GeometryId ground = GeometryId::get_new_id();
+  const GeometryId ball = GeometryId::get_new_id();
+
+  const std::vector<DiscreteContactPair<double>> previous = {
+      MakePair(box, ground, Vector3d(0.0, 0.0, 0.0)),
+      MakePair(box, ground, Vector3d(1.0, 0.0, 0.0)),
+      MakePair(ball, ground, Vector3d(5.0, 0.0, 0.0)),
+  };
+  const std::vector<DiscreteContactPair<double>> current = {
+      // A new contact point between the box and the ground.
+      MakePair(box, ground, Vector3d(0.5, 0.5, 0.0)),
+      // The second box contact, with the geometries swapped.
+      MakePair(ground, box, Vector3d(1.0, 1.0e-4, 0.0)),
+      // The first box contact.
+      MakePair(box, ground, Vector3d(-1.0e-4, 0.0, 0.0)),
+      // New contact between the ball and the box, close to previous contacts.
+      MakePair(ball, box, Vector3d(0.0, 0.0, 0.0)),
+      // The ball contact. It moved too far to be considered persistent.
+      MakePair(ball, ground, Vector3d(5.1, 0.0, 0.0)),
+  };
+  const std::vector<int> expected = {-1, 1, 0, -1, -1};
+  EXPECT_EQ(MatchPersistentContactPairs(previous, current, 1.0e-3), expected);
+
+  // Each previous contact is matched at most once, to the closest current
+  // contact processed first.
+  const std::vector<DiscreteContactPair<double>> duplicated = {
+      MakePair(box, ground, Vector3d(0.0, 0.0, 1.0e-4)),
+      MakePair(box, ground, Vector3d(0.0, 0.0, 0.0)),
+  };
+  EXPECT_EQ(MatchPersistentContactPairs(previous, duplicated, 1.0e-3),
+            std::vector<int>({0, -1}));
+
+  EXPECT_TRUE(MatchPersistentContactPairs(previous, {}, 1.0e-3).empty());
+  EXPECT_EQ(MatchPersistentContactPairs({}, current, 1.0e-3),
+            std::vector<int>(current.size(), -1));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MatchPersistentContactPairs(previous, current, -1.0),
+      ".*max_distance >= 0.*");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
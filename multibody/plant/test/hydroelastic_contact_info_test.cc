@@ -0,0 +1,82 @@
+#include "drake/multibody/plant/hydroelastic_contact_info.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/plant/contact_results.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using geometry::ContactSurface;
+using geometry::GeometryId;
+using geometry::MeshFieldLinear;
+using geometry::SurfaceTriangle;
+using geometry::TriangleSurfaceMesh;
+
+std::unique_ptr<ContactSurface<double>> MakeContactSurface() {
+  std::vector<SurfaceTriangle> faces{{0, 1, 2}};
+  std::vector<Vector3<double>> vertices{
+      {0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}};
+  auto mesh = std::make_unique<TriangleSurfaceMesh<double>>(
+      std::move(faces), std::move(vertices));
+  TriangleSurfaceMesh<double>* mesh_pointer = mesh.get();
+  return std::make_unique<ContactSurface<double>>(
+      GeometryId::get_new_id(), GeometryId::get_new_id(), std::move(mesh),
+      std::make_unique<MeshFieldLinear<double, TriangleSurfaceMesh<double>>>(
+          std::vector<double>{0.0, 1.0, 2.0}, mesh_pointer));
+}
+
+const SpatialForce<double> kForce(Vector3<double>(1.0, 2.0, 3.0),
+                                  Vector3<double>(4.0, 5.0, 6.0));
+
+// A copy of an info that aliases its surface must own a clone of it, while
+// copies of an info that owns its surface share it.
+GTEST_TEST(HydroelasticContactInfo, CopySemantics) {
+  const std::unique_ptr<ContactSurface<double>> surface = MakeContactSurface();
+  const HydroelasticContactInfo<double> aliasing(surface.get(), kForce, {});
+  EXPECT_EQ(&aliasing.contact_surface(), surface.get());
+
+  const HydroelasticContactInfo<double> copy(aliasing);
+  EXPECT_NE(&copy.contact_surface(), surface.get());
+  EXPECT_TRUE(copy.contact_surface().Equal(*surface));
+  EXPECT_TRUE(
+      CompareMatrices(copy.F_Ac_W().get_coeffs(), kForce.get_coeffs()));
+
+  const HydroelasticContactInfo<double> copy_of_copy(copy);
+  EXPECT_EQ(&copy_of_copy.contact_surface(), &copy.contact_surface());
+
+  HydroelasticContactInfo<double> assigned(MakeContactSurface(), kForce, {});
+  assigned = copy;
+  EXPECT_EQ(&assigned.contact_surface(), &copy.contact_surface());
+}
+
+// Copies of ContactResults made from the results computed by a plant (which
+// alias their hydroelastic data) clone the data, while copies of copies share
+// it.
+GTEST_TEST(HydroelasticContactInfo, ContactResultsCopySemantics) {
+  const std::unique_ptr<ContactSurface<double>> surface = MakeContactSurface();
+  const HydroelasticContactInfo<double> aliasing(surface.get(), kForce, {});
+  ContactResults<double> results;
+  results.AddContactInfo(&aliasing);
+
+  const ContactResults<double> copy(results);
+  ASSERT_EQ(copy.num_hydroelastic_contacts(), 1);
+  EXPECT_NE(&copy.hydroelastic_contact_info(0), &aliasing);
+  EXPECT_NE(&copy.hydroelastic_contact_info(0).contact_surface(),
+            surface.get());
+
+  const ContactResults<double> copy_of_copy(copy);
+  ASSERT_EQ(copy_of_copy.num_hydroelastic_contacts(), 1);
+  EXPECT_EQ(&copy_of_copy.hydroelastic_contact_info(0),
+            &copy.hydroelastic_contact_info(0));
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -31,6 +31,24 @@ GTEST_TEST(MultibodyPlantConfigFunctionsTest, BasicTest) {
   // can't test them.
 }
 
+GTEST_TEST(MultibodyPlantConfigFunctionsTest, SceneGraphConfigTest) {
+  MultibodyPlantConfig plant_config;
+  plant_config.time_step = 0.002;
+  geometry::SceneGraphConfig scene_graph_config;
+  scene_graph_config.proximity_num_threads = 2;
+
+  drake::systems::DiagramBuilder<double> builder;
+  auto result = AddMultibodyPlant(plant_config, scene_graph_config, &builder);
+  EXPECT_EQ(result.plant.time_step(), 0.002);
+  EXPECT_EQ(result.scene_graph.get_config().proximity_num_threads, 2);
+
+  scene_graph_config.proximity_num_threads = -1;
+  drake::systems::DiagramBuilder<double> bad_builder;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      AddMultibodyPlant(plant_config, scene_graph_config, &bad_builder),
+      ".*proximity_num_threads.*");
+}
+
 const char* const kExampleConfig = R"""(
 time_step: 0.002
 penetration_allowance: 0.003
@@ -99,6 +99,64 @@ TEST_F(MultibodyPlantMassMatrixTests, IiwaRobot) {
   VerifyMassMatrixComputation(*context);
 }
 
+// Verifies that the batched evaluations agree with their per-context
+// counterparts, sample by sample.
+TEST_F(MultibodyPlantMassMatrixTests, IiwaRobotBatch) {
+  LoadModel(
+      "drake/manipulation/models/iiwa_description/sdf/iiwa14_no_collision.sdf");
+  const int nq = plant_.num_positions();
+  const int nv = plant_.num_velocities();
+  const int kNumSamples = 5;
+
+  // Arbitrary states; the quaternions of the floating base need not be
+  // normalized for this comparison.
+  MatrixX<double> q_batch(nq, kNumSamples);
+  MatrixX<double> v_batch(nv, kNumSamples);
+  for (int i = 0; i < kNumSamples; ++i) {
+    q_batch.col(i) = VectorX<double>::LinSpaced(nq, 0.1 * i, 1 + i);
+    v_batch.col(i) = VectorX<double>::LinSpaced(nv, -1 - i, 0.2 * i);
+  }
+
+  std::unique_ptr<Context<double>> batch_context =
+      plant_.CreateDefaultContext();
+  MatrixX<double> M_batch(nv, nv * kNumSamples);
+  plant_.CalcMassMatrixBatch(batch_context.get(), q_batch, &M_batch);
+  MatrixX<double> Cv_batch(nv, kNumSamples);
+  plant_.CalcBiasTermBatch(batch_context.get(), q_batch, v_batch, &Cv_batch);
+  std::vector<math::RigidTransformd> X_WB_batch;
+  plant_.CalcAllBodyPosesInWorldBatch(batch_context.get(), q_batch,
+                                      &X_WB_batch);
+  ASSERT_EQ(X_WB_batch.size(), plant_.num_bodies() * kNumSamples);
+
+  std::unique_ptr<Context<double>> context = plant_.CreateDefaultContext();
+  MatrixX<double> M(nv, nv);
+  VectorX<double> Cv(nv);
+  for (int i = 0; i < kNumSamples; ++i) {
+    plant_.SetPositions(context.get(), q_batch.col(i));
+    plant_.SetVelocities(context.get(), v_batch.col(i));
+    plant_.CalcMassMatrix(*context, &M);
+    EXPECT_TRUE(CompareMatrices(M_batch.middleCols(i * nv, nv), M));
+    plant_.CalcBiasTerm(*context, &Cv);
+    EXPECT_TRUE(CompareMatrices(Cv_batch.col(i), Cv));
+    for (BodyIndex b(0); b < plant_.num_bodies(); ++b) {
+      const math::RigidTransformd& X_WB =
+          plant_.EvalBodyPoseInWorld(*context, plant_.get_body(b));
+      EXPECT_TRUE(CompareMatrices(
+          X_WB_batch[b * kNumSamples + i].GetAsMatrix34(),
+          X_WB.GetAsMatrix34()));
+    }
+  }
+
+  // Mis-sized outputs are rejected.
+  MatrixX<double> M_wrong(nv, nv);
+  EXPECT_THROW(
+      plant_.CalcMassMatrixBatch(batch_context.get(), q_batch, &M_wrong),
+      std::exception);
+  EXPECT_THROW(plant_.CalcBiasTermBatch(batch_context.get(), q_batch,
+                                        v_batch.leftCols(1), &Cv_batch),
+               std::exception);
+}
+
 // This Atlas model contains a number of kinematics chains of massless bodies.
 // Therefore this test verifies our implementation can handle this situation.
 TEST_F(MultibodyPlantMassMatrixTests, AtlasRobot) {
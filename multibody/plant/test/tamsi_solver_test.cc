@@ -69,6 +69,12 @@ class TamsiSolverTester {
   static int get_capacity(const TamsiSolver<double>& solver) {
     return solver.variable_size_workspace_.capacity();
   }
+
+  // Returns the number of groups of coupled generalized velocities found in
+  // the last call to SolveWithGuess().
+  static int get_num_coupled_groups(const TamsiSolver<double>& solver) {
+    return solver.coupled_groups_workspace_.num_groups();
+  }
 };
 namespace {
 
@@ -1100,6 +1106,75 @@ TEST_F(RollingCylinder, SlidingAfterImpact) {
       J, J_expected, J_tolerance, MatrixCompareType::absolute));
 }
 
+// Two cylinders, one in stiction and the other one sliding, are stacked into
+// a single problem with a block diagonal mass matrix and contact Jacobians.
+// The solver should find two uncoupled groups of generalized velocities and
+// the solution for each cylinder should match the solution of the
+// corresponding single cylinder problem.
+TEST_F(RollingCylinder, UncoupledCylinders) {
+  const double dt = 1.0e-3;  // time step in seconds.
+  const double mu = 0.1;     // Friction coefficient.
+  const Vector3<double> tau(0.0, -m_ * g_, 0.0);
+  const double h0 = 0.5;
+  const double vy0 = -sqrt(2.0 * g_ * h0);
+  // Initial velocities in stiction and sliding respectively, recall that
+  // vx_transition = 0.6 m/s.
+  const Vector3<double> v0_stiction(0.5, vy0, 0.0);
+  const Vector3<double> v0_sliding(0.7, vy0, 0.0);
+
+  TamsiSolverParameters parameters;  // Default parameters.
+  parameters.stiction_tolerance = 1.0e-6;
+  solver_.set_solver_parameters(parameters);
+
+  // Solutions to each of the single cylinder problems.
+  SetImpactProblem(v0_stiction, tau, mu, h0, dt);
+  ASSERT_EQ(solver_.SolveWithGuess(dt, v0_stiction),
+            TamsiSolverResult::kSuccess);
+  EXPECT_EQ(TamsiSolverTester::get_num_coupled_groups(solver_), 1);
+  const VectorX<double> v_stiction = solver_.get_generalized_velocities();
+  SetImpactProblem(v0_sliding, tau, mu, h0, dt);
+  ASSERT_EQ(solver_.SolveWithGuess(dt, v0_sliding),
+            TamsiSolverResult::kSuccess);
+  const VectorX<double> v_sliding = solver_.get_generalized_velocities();
+
+  // Stack the problem data of both cylinders. The sliding problem data is the
+  // last one set by SetImpactProblem().
+  const int nv = 2 * nv_;
+  const int nc = 2 * nc_;
+  MatrixX<double> M = MatrixX<double>::Zero(nv, nv);
+  M.topLeftCorner(nv_, nv_) = M_;
+  M.bottomRightCorner(nv_, nv_) = M_;
+  MatrixX<double> Jn = MatrixX<double>::Zero(nc, nv);
+  Jn.topLeftCorner(nc_, nv_) = Jn_;
+  Jn.bottomRightCorner(nc_, nv_) = Jn_;
+  MatrixX<double> Jt = MatrixX<double>::Zero(2 * nc, nv);
+  Jt.topLeftCorner(2 * nc_, nv_) = Jt_;
+  Jt.bottomRightCorner(2 * nc_, nv_) = Jt_;
+  VectorX<double> p_star(nv);
+  p_star << M_ * v0_stiction + dt * tau, p_star_;
+  VectorX<double> v0(nv);
+  v0 << v0_stiction, v0_sliding;
+  VectorX<double> fn0(nc), stiffness(nc), dissipation(nc), mu_vector(nc);
+  fn0 << fn0_, fn0_;
+  stiffness << stiffness_, stiffness_;
+  dissipation << dissipation_, dissipation_;
+  mu_vector << mu_vector_, mu_vector_;
+
+  TamsiSolver<double> solver(nv);
+  solver.SetTwoWayCoupledProblemData(&M, &Jn, &Jt, &p_star, &fn0, &stiffness,
+                                     &dissipation, &mu_vector);
+  solver.set_solver_parameters(parameters);
+  ASSERT_EQ(solver.SolveWithGuess(dt, v0), TamsiSolverResult::kSuccess);
+  EXPECT_EQ(TamsiSolverTester::get_num_coupled_groups(solver), 2);
+
+  const VectorX<double>& v = solver.get_generalized_velocities();
+  const double kTolerance = 10 * std::numeric_limits<double>::epsilon();
+  EXPECT_TRUE(CompareMatrices(v.head(nv_), v_stiction, kTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(v.tail(nv_), v_sliding, kTolerance,
+                              MatrixCompareType::relative));
+}
+
 GTEST_TEST(EmptyWorld, Solve) {
   const int nv = 0;
   TamsiSolver<double> solver{nv};
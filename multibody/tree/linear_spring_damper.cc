@@ -227,8 +227,98 @@ T LinearSpringDamper<T>::CalcLengthTimeDerivative(
   return length_dot;
 }
 
+namespace internal {
+
+template <typename T>
+LinearSpringDamperBatch<T>::LinearSpringDamperBatch(
+    const std::vector<const LinearSpringDamper<T>*>& spring_dampers) {
+  const int n = static_cast<int>(spring_dampers.size());
+  node_A_.reserve(n);
+  node_B_.reserve(n);
+  p_AP_.resize(3, n);
+  p_BQ_.resize(3, n);
+  free_length_.resize(n);
+  stiffness_.resize(n);
+  damping_.resize(n);
+  for (int i = 0; i < n; ++i) {
+    const LinearSpringDamper<T>& spring = *spring_dampers[i];
+    node_A_.push_back(spring.bodyA().node_index());
+    node_B_.push_back(spring.bodyB().node_index());
+    p_AP_.col(i) = spring.p_AP();
+    p_BQ_.col(i) = spring.p_BQ();
+    free_length_[i] = spring.free_length();
+    stiffness_[i] = spring.stiffness();
+    damping_[i] = spring.damping();
+  }
+}
+
+template <typename T>
+void LinearSpringDamperBatch<T>::CalcAndAddForceContribution(
+    const PositionKinematicsCache<T>& pc,
+    const VelocityKinematicsCache<T>& vc,
+    MultibodyForces<T>* forces) const {
+  DRAKE_DEMAND(forces != nullptr);
+  using std::sqrt;
+
+  std::vector<SpatialForce<T>>& F_Bo_W_array = forces->mutable_body_forces();
+  for (int i = 0; i < size(); ++i) {
+    const math::RigidTransform<T>& X_WA = pc.get_X_WB(node_A_[i]);
+    const math::RigidTransform<T>& X_WB = pc.get_X_WB(node_B_[i]);
+
+    const Vector3<T> p_WP = X_WA * p_AP_.col(i).template cast<T>();
+    const Vector3<T> p_WQ = X_WB * p_BQ_.col(i).template cast<T>();
+    const Vector3<T> p_PQ_W = p_WQ - p_WP;
+
+    // The same "soft" length as LinearSpringDamper::SafeSoftNorm().
+    const double epsilon_length =
+        std::numeric_limits<double>::epsilon() * free_length_[i];
+    const double epsilon_length_squared = epsilon_length * epsilon_length;
+    const T x2 = p_PQ_W.squaredNorm();
+    if (scalar_predicate<T>::is_bool && (x2 < epsilon_length_squared)) {
+      throw std::runtime_error(
+          "The length of the spring became nearly zero. "
+          "Revisit your model to avoid this situation.");
+    }
+    const T length_soft = sqrt(x2 + epsilon_length_squared);
+    const Vector3<T> r_PQ_W = p_PQ_W / length_soft;
+
+    // p_AoP = p_WP - p_WAo and p_BoQ = p_WQ - p_WBo.
+    const Vector3<T> p_AoP_W = p_WP - X_WA.translation();
+    const Vector3<T> p_BoQ_W = p_WQ - X_WB.translation();
+
+    // The rate at which the length of the spring changes. The velocities of P
+    // and Q are shifted from the body origins directly, rather than through
+    // SpatialVelocity::Shift(), since only their translational parts are used.
+    const SpatialVelocity<T>& V_WA = vc.get_V_WB(node_A_[i]);
+    const SpatialVelocity<T>& V_WB = vc.get_V_WB(node_B_[i]);
+    const Vector3<T> v_WP =
+        V_WA.translational() + V_WA.rotational().cross(p_AoP_W);
+    const Vector3<T> v_WQ =
+        V_WB.translational() + V_WB.rotational().cross(p_BoQ_W);
+    const T length_dot = (v_WQ - v_WP).dot(r_PQ_W);
+
+    // Force on A, applied at P, expressed in the world frame.
+    Vector3<T> f_AP_W =
+        stiffness_[i] * (length_soft - free_length_[i]) * r_PQ_W;
+    f_AP_W += damping_[i] * length_dot * r_PQ_W;
+
+    // Shift the forces on A at P and on B at Q to the body origins and
+    // accumulate them in place.
+    SpatialForce<T>& F_Ao_W = F_Bo_W_array[node_A_[i]];
+    F_Ao_W.rotational() += p_AoP_W.cross(f_AP_W);
+    F_Ao_W.translational() += f_AP_W;
+    SpatialForce<T>& F_Bo_W = F_Bo_W_array[node_B_[i]];
+    F_Bo_W.rotational() -= p_BoQ_W.cross(f_AP_W);
+    F_Bo_W.translational() -= f_AP_W;
+  }
+}
+
+}  // namespace internal
 }  // namespace multibody
 }  // namespace drake
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::multibody::LinearSpringDamper)
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::internal::LinearSpringDamperBatch)
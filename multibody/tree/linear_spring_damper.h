@@ -146,6 +146,45 @@ class LinearSpringDamper final : public ForceElement<T> {
   double damping_;
 };
 
+namespace internal {
+
+// Evaluates the forces of a group of LinearSpringDamper elements in a single
+// pass. The element data is stored as a structure of arrays so that the loop
+// over springs streams through contiguous memory, and each spring's length is
+// computed only once for both its stiffness and damping terms. The result is
+// the same as calling LinearSpringDamper::CalcAndAddForceContribution() on
+// each element, up to the order in which the body forces are summed.
+template <typename T>
+class LinearSpringDamperBatch {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LinearSpringDamperBatch)
+
+  // Copies the parameters of `spring_dampers`, which must all belong to a
+  // finalized MultibodyTree.
+  explicit LinearSpringDamperBatch(
+      const std::vector<const LinearSpringDamper<T>*>& spring_dampers);
+
+  int size() const { return static_cast<int>(free_length_.size()); }
+
+  // Adds the forces of all the elements in this batch to `forces`.
+  // @throws std::exception if the length of any of the springs becomes nearly
+  // zero, see LinearSpringDamper.
+  void CalcAndAddForceContribution(
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>& vc,
+      MultibodyForces<T>* forces) const;
+
+ private:
+  std::vector<BodyNodeIndex> node_A_;
+  std::vector<BodyNodeIndex> node_B_;
+  Matrix3X<double> p_AP_;
+  Matrix3X<double> p_BQ_;
+  Eigen::VectorXd free_length_;
+  Eigen::VectorXd stiffness_;
+  Eigen::VectorXd damping_;
+};
+
+}  // namespace internal
 }  // namespace multibody
 }  // namespace drake
 
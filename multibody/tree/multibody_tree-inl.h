@@ -56,7 +56,7 @@ const BodyType<T>& MultibodyTree<T>::AddBody(
   }
   BodyIndex body_index(0);
   FrameIndex body_frame_index(0);
-  std::tie(body_index, body_frame_index) = topology_.add_body();
+  std::tie(body_index, body_frame_index) = mutable_topology().add_body();
   // These tests MUST be performed BEFORE frames_.push_back() and
   // owned_bodies_.push_back() below. Do not move them around!
   DRAKE_DEMAND(body_index == num_bodies());
@@ -74,11 +74,12 @@ const BodyType<T>& MultibodyTree<T>::AddBody(
   body_frame->set_parent_tree(this, body_frame_index);
   DRAKE_ASSERT(body_frame->name() == body->name());
   this->SetElementIndex(body_frame->name(), body_frame_index,
-                        &frame_name_to_index_);
+                        &mutable_names().frame_name_to_index);
   frames_.push_back(body_frame);
   // - Register body.
   BodyType<T>* raw_body_ptr = body.get();
-  this->SetElementIndex(body->name(), body->index(), &body_name_to_index_);
+  this->SetElementIndex(body->name(), body->index(),
+                        &mutable_names().body_name_to_index);
   owned_bodies_.push_back(std::move(body));
   return *raw_body_ptr;
 }
@@ -101,7 +102,7 @@ const RigidBody<T>& MultibodyTree<T>::AddRigidBody(
 
   if (HasBodyNamed(name, model_instance)) {
     throw std::logic_error(
-        "Model instance '" + instance_index_to_name_.at(model_instance) +
+        "Model instance '" + names_->instance_index_to_name.at(model_instance) +
             "' already contains a body named '" + name + "'. " +
             "Body names must be unique within a given model.");
   }
@@ -138,7 +139,7 @@ const FrameType<T>& MultibodyTree<T>::AddFrame(
   if (frame == nullptr) {
     throw std::logic_error("Input frame is a nullptr.");
   }
-  FrameIndex frame_index = topology_.add_frame(frame->body().index());
+  FrameIndex frame_index = mutable_topology().add_frame(frame->body().index());
   // This test MUST be performed BEFORE frames_.push_back() and
   // owned_frames_.push_back() below. Do not move it around!
   DRAKE_DEMAND(frame_index == num_frames());
@@ -149,7 +150,8 @@ const FrameType<T>& MultibodyTree<T>::AddFrame(
   frame->set_parent_tree(this, frame_index);
   FrameType<T>* raw_frame_ptr = frame.get();
   frames_.push_back(raw_frame_ptr);
-  this->SetElementIndex(frame->name(), frame_index, &frame_name_to_index_);
+  this->SetElementIndex(frame->name(), frame_index,
+                        &mutable_names().frame_name_to_index);
   owned_frames_.push_back(std::move(frame));
   return *raw_frame_ptr;
 }
@@ -185,7 +187,7 @@ const MobilizerType<T>& MultibodyTree<T>::AddMobilizer(
   mobilizer->outboard_frame().HasThisParentTreeOrThrow(this);
   const int num_positions = mobilizer->num_positions();
   const int num_velocities = mobilizer->num_velocities();
-  MobilizerIndex mobilizer_index = topology_.add_mobilizer(
+  MobilizerIndex mobilizer_index = mutable_topology().add_mobilizer(
       mobilizer->inboard_frame().index(),
       mobilizer->outboard_frame().index(),
       num_positions, num_velocities);
@@ -208,9 +210,9 @@ const MobilizerType<T>& MultibodyTree<T>::AddMobilizer(
 
   // Mark free bodies as needed.
   const BodyIndex outboard_body_index = mobilizer->outboard_body().index();
-  topology_.get_mutable_body(outboard_body_index).is_floating =
+  mutable_topology().get_mutable_body(outboard_body_index).is_floating =
       mobilizer->is_floating();
-  topology_.get_mutable_body(outboard_body_index).has_quaternion_dofs =
+  mutable_topology().get_mutable_body(outboard_body_index).has_quaternion_dofs =
       mobilizer->has_quaternion_dofs();
 
   MobilizerType<T>* raw_mobilizer_ptr = mobilizer.get();
@@ -255,7 +257,8 @@ const ForceElementType<T>& MultibodyTree<T>::AddForceElement(
     gravity_field_ = gravity_element;
   }
 
-  ForceElementIndex force_element_index = topology_.add_force_element();
+  ForceElementIndex force_element_index =
+      mutable_topology().add_force_element();
   // This test MUST be performed BEFORE owned_force_elements_.push_back()
   // below. Do not move it around!
   DRAKE_DEMAND(force_element_index == num_force_elements());
@@ -288,7 +291,7 @@ const JointType<T>& MultibodyTree<T>::AddJoint(
   if (HasJointNamed(joint->name(), joint->model_instance())) {
     throw std::logic_error(
         "Model instance '" +
-            instance_index_to_name_.at(joint->model_instance()) +
+            names_->instance_index_to_name.at(joint->model_instance()) +
             "' already contains a joint named '" + joint->name() + "'. " +
             "Joint names must be unique within a given model.");
   }
@@ -304,7 +307,8 @@ const JointType<T>& MultibodyTree<T>::AddJoint(
   const JointIndex joint_index(owned_joints_.size());
   joint->set_parent_tree(this, joint_index);
   JointType<T>* raw_joint_ptr = joint.get();
-  this->SetElementIndex(joint->name(), joint->index(), &joint_name_to_index_);
+  this->SetElementIndex(joint->name(), joint->index(),
+                        &mutable_names().joint_name_to_index);
   owned_joints_.push_back(std::move(joint));
   return *raw_joint_ptr;
 }
@@ -349,7 +353,7 @@ const JointActuator<T>& MultibodyTree<T>::AddJointActuator(
   if (HasJointActuatorNamed(name, joint.model_instance())) {
     throw std::logic_error(
         "Model instance '" +
-            instance_index_to_name_.at(joint.model_instance()) +
+            names_->instance_index_to_name.at(joint.model_instance()) +
             "' already contains a joint actuator named '" + name + "'. " +
             "Joint actuator names must be unique within a given model.");
   }
@@ -361,12 +365,13 @@ const JointActuator<T>& MultibodyTree<T>::AddJointActuator(
   }
 
   const JointActuatorIndex actuator_index =
-      topology_.add_joint_actuator(joint.num_velocities());
+      mutable_topology().add_joint_actuator(joint.num_velocities());
   owned_actuators_.push_back(
       std::make_unique<JointActuator<T>>(name, joint, effort_limit));
   JointActuator<T>* actuator = owned_actuators_.back().get();
   actuator->set_parent_tree(this, actuator_index);
-  this->SetElementIndex(name, actuator_index, &actuator_name_to_index_);
+  this->SetElementIndex(name, actuator_index,
+                        &mutable_names().actuator_name_to_index);
   return *actuator;
 }
 
@@ -385,8 +390,8 @@ ModelInstanceIndex MultibodyTree<T>::AddModelInstance(const std::string& name) {
                            "details.");
   }
   const ModelInstanceIndex index(num_model_instances());
-  this->SetElementIndex(name, index, &instance_name_to_index_);
-  instance_index_to_name_[index] = name;
+  this->SetElementIndex(name, index, &mutable_names().instance_name_to_index);
+  mutable_names().instance_index_to_name[index] = name;
   return index;
 }
 
@@ -5,6 +5,8 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <typeindex>
+#include <typeinfo>
 #include <unordered_set>
 #include <utility>
 
@@ -15,6 +17,7 @@
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/tree/body_node_welded.h"
+#include "drake/multibody/tree/linear_spring_damper.h"
 #include "drake/multibody/tree/multibody_tree-inl.h"
 #include "drake/multibody/tree/quaternion_floating_mobilizer.h"
 #include "drake/multibody/tree/rigid_body.h"
@@ -89,8 +92,8 @@ MultibodyTree<T>::MultibodyTree() {
 template <typename T>
 const std::string& MultibodyTree<T>::GetModelInstanceName(
     ModelInstanceIndex model_instance) const {
-  const auto it = instance_index_to_name_.find(model_instance);
-  if (it == instance_index_to_name_.end()) {
+  const auto it = names_->instance_index_to_name.find(model_instance);
+  if (it == names_->instance_index_to_name.end()) {
     throw std::logic_error(
         fmt::format("There is no model instance id {} in the model.",
                     std::to_string(model_instance)));
@@ -114,12 +117,12 @@ const Body<T>& MultibodyTree<T>::GetUniqueFreeBaseBodyOrThrowImpl(
       MaybeGetUniqueBaseBodyIndex(model_instance);
   if (!base_body_index.has_value()) {
     throw std::logic_error("Model " +
-                           instance_index_to_name_.at(model_instance) +
+                           names_->instance_index_to_name.at(model_instance) +
                            " does not have a unique base body.");
   }
   if (!owned_bodies_[base_body_index.value()]->is_floating()) {
     throw std::logic_error("Model " +
-                           instance_index_to_name_.at(model_instance) +
+                           names_->instance_index_to_name.at(model_instance) +
                            " has a unique base body, but it is not free.");
   }
   return *owned_bodies_[base_body_index.value()];
@@ -305,73 +308,83 @@ const auto& GetElementByName(
 
 template <typename T>
 int MultibodyTree<T>::NumBodiesWithName(std::string_view name) const {
-  return static_cast<int>(body_name_to_index_.count(name));
+  return static_cast<int>(names_->body_name_to_index.count(name));
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasBodyNamed(std::string_view name) const {
-  return HasElementNamed(*this, name, std::nullopt, body_name_to_index_);
+  return HasElementNamed(*this, name, std::nullopt, names_->body_name_to_index);
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasBodyNamed(
     std::string_view name, ModelInstanceIndex model_instance) const {
-  return HasElementNamed(*this, name, model_instance, body_name_to_index_);
+  return HasElementNamed(*this, name, model_instance,
+                         names_->body_name_to_index);
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasFrameNamed(std::string_view name) const {
-  return HasElementNamed(*this, name, std::nullopt, frame_name_to_index_);
+  return HasElementNamed(*this, name, std::nullopt,
+                         names_->frame_name_to_index);
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasFrameNamed(
     std::string_view name, ModelInstanceIndex model_instance) const {
-  return HasElementNamed(*this, name, model_instance, frame_name_to_index_);
+  return HasElementNamed(*this, name, model_instance,
+                         names_->frame_name_to_index);
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasJointNamed(std::string_view name) const {
-  return HasElementNamed(*this, name, std::nullopt, joint_name_to_index_);
+  return HasElementNamed(*this, name, std::nullopt,
+                         names_->joint_name_to_index);
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasJointNamed(
     std::string_view name, ModelInstanceIndex model_instance) const {
-  return HasElementNamed(*this, name, model_instance, joint_name_to_index_);
+  return HasElementNamed(*this, name, model_instance,
+                         names_->joint_name_to_index);
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasJointActuatorNamed(std::string_view name) const {
-  return HasElementNamed(*this, name, std::nullopt, actuator_name_to_index_);
+  return HasElementNamed(*this, name, std::nullopt,
+                         names_->actuator_name_to_index);
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasJointActuatorNamed(
     std::string_view name, ModelInstanceIndex model_instance) const {
-  return HasElementNamed(*this, name, model_instance, actuator_name_to_index_);
+  return HasElementNamed(*this, name, model_instance,
+                         names_->actuator_name_to_index);
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasModelInstanceNamed(std::string_view name) const {
-  return instance_name_to_index_.find(name) != instance_name_to_index_.end();
+  return names_->instance_name_to_index.find(name) !=
+         names_->instance_name_to_index.end();
 }
 
 template <typename T>
 const Body<T>& MultibodyTree<T>::GetBodyByName(std::string_view name) const {
-  return GetElementByName(*this, name, std::nullopt, body_name_to_index_);
+  return GetElementByName(*this, name, std::nullopt,
+                          names_->body_name_to_index);
 }
 
 template <typename T>
 const Body<T>& MultibodyTree<T>::GetBodyByName(
     std::string_view name, ModelInstanceIndex model_instance) const {
-  return GetElementByName(*this, name, model_instance, body_name_to_index_);
+  return GetElementByName(*this, name, model_instance,
+                          names_->body_name_to_index);
 }
 
 template <typename T>
 std::vector<BodyIndex> MultibodyTree<T>::GetBodyIndices(
     ModelInstanceIndex model_instance) const {
-  DRAKE_THROW_UNLESS(model_instance < instance_name_to_index_.size());
+  DRAKE_THROW_UNLESS(model_instance < names_->instance_name_to_index.size());
   std::vector<BodyIndex> indices;
   for (auto& body : owned_bodies_) {
     if (body->model_instance() == model_instance) {
@@ -384,7 +397,7 @@ std::vector<BodyIndex> MultibodyTree<T>::GetBodyIndices(
 template <typename T>
 std::vector<JointIndex> MultibodyTree<T>::GetJointIndices(
     ModelInstanceIndex model_instance) const {
-  DRAKE_THROW_UNLESS(model_instance < instance_name_to_index_.size());
+  DRAKE_THROW_UNLESS(model_instance < names_->instance_name_to_index.size());
   std::vector<JointIndex> indices;
   for (auto& joint : owned_joints_) {
     if (joint->model_instance() == model_instance) {
@@ -397,7 +410,7 @@ std::vector<JointIndex> MultibodyTree<T>::GetJointIndices(
 template <typename T>
 std::vector<FrameIndex> MultibodyTree<T>::GetFrameIndices(
     ModelInstanceIndex model_instance) const {
-  DRAKE_THROW_UNLESS(model_instance < instance_name_to_index_.size());
+  DRAKE_THROW_UNLESS(model_instance < names_->instance_name_to_index.size());
   std::vector<FrameIndex> indices;
   for (auto& frame : frames_) {
     if (frame->model_instance() == model_instance) {
@@ -409,13 +422,15 @@ std::vector<FrameIndex> MultibodyTree<T>::GetFrameIndices(
 
 template <typename T>
 const Frame<T>& MultibodyTree<T>::GetFrameByName(std::string_view name) const {
-  return GetElementByName(*this, name, std::nullopt, frame_name_to_index_);
+  return GetElementByName(*this, name, std::nullopt,
+                          names_->frame_name_to_index);
 }
 
 template <typename T>
 const Frame<T>& MultibodyTree<T>::GetFrameByName(
     std::string_view name, ModelInstanceIndex model_instance) const {
-  return GetElementByName(*this, name, model_instance, frame_name_to_index_);
+  return GetElementByName(*this, name, model_instance,
+                          names_->frame_name_to_index);
 }
 
 template <typename T>
@@ -433,13 +448,13 @@ const RigidBody<T>& MultibodyTree<T>::GetRigidBodyByName(
 template <typename T>
 const RigidBody<T>& MultibodyTree<T>::GetRigidBodyByName(
     std::string_view name, ModelInstanceIndex model_instance) const {
-  DRAKE_THROW_UNLESS(model_instance < instance_name_to_index_.size());
+  DRAKE_THROW_UNLESS(model_instance < names_->instance_name_to_index.size());
   const RigidBody<T>* body =
       dynamic_cast<const RigidBody<T>*>(&GetBodyByName(name, model_instance));
   if (body == nullptr) {
     throw std::logic_error(
         fmt::format("Body '{}' in model instance '{}' is not a RigidBody.",
-                    name, instance_index_to_name_.at(model_instance)));
+                    name, names_->instance_index_to_name.at(model_instance)));
   }
   return *body;
 }
@@ -448,7 +463,8 @@ template <typename T>
 const Joint<T>& MultibodyTree<T>::GetJointByNameImpl(
     std::string_view name,
     std::optional<ModelInstanceIndex> model_instance) const {
-  return GetElementByName(*this, name, model_instance, joint_name_to_index_);
+  return GetElementByName(*this, name, model_instance,
+                          names_->joint_name_to_index);
 }
 
 template <typename T>
@@ -457,27 +473,29 @@ void MultibodyTree<T>::ThrowJointSubtypeMismatch(
   throw std::logic_error(fmt::format(
       "GetJointByName(): Joint '{}' in model instance '{}' is not of type {} "
       "but of type {}.",
-      joint.name(), instance_index_to_name_.at(joint.model_instance()),
+      joint.name(), names_->instance_index_to_name.at(joint.model_instance()),
       desired_type, NiceTypeName::Get(joint)));
 }
 
 template <typename T>
 const JointActuator<T>& MultibodyTree<T>::GetJointActuatorByName(
     std::string_view name) const {
-  return GetElementByName(*this, name, std::nullopt, actuator_name_to_index_);
+  return GetElementByName(*this, name, std::nullopt,
+                          names_->actuator_name_to_index);
 }
 
 template <typename T>
 const JointActuator<T>& MultibodyTree<T>::GetJointActuatorByName(
     std::string_view name, ModelInstanceIndex model_instance) const {
-  return GetElementByName(*this, name, model_instance, actuator_name_to_index_);
+  return GetElementByName(*this, name, model_instance,
+                          names_->actuator_name_to_index);
 }
 
 template <typename T>
 ModelInstanceIndex MultibodyTree<T>::GetModelInstanceByName(
     std::string_view name) const {
-  const auto it = instance_name_to_index_.find(name);
-  if (it == instance_name_to_index_.end()) {
+  const auto it = names_->instance_name_to_index.find(name);
+  if (it == names_->instance_name_to_index.end()) {
     throw std::logic_error(fmt::format(
         "GetModelInstanceByName(): There is no model instance named '{}'.",
         name));
@@ -593,7 +611,7 @@ void MultibodyTree<T>::FinalizeTopology() {
 
   // Before performing any setup that depends on the scalar type <T>, compile
   // all the type-T independent topological information.
-  topology_.Finalize();
+  mutable_topology().Finalize();
 }
 
 template <typename T>
@@ -607,26 +625,26 @@ void MultibodyTree<T>::FinalizeInternals() {
   // Give different multiobody elements the chance to perform any finalize-time
   // setup.
   for (const auto& body : owned_bodies_) {
-    body->SetTopology(topology_);
+    body->SetTopology(*topology_);
   }
   for (const auto& frame : owned_frames_) {
-    frame->SetTopology(topology_);
+    frame->SetTopology(*topology_);
   }
   for (const auto& mobilizer : owned_mobilizers_) {
-    mobilizer->SetTopology(topology_);
+    mobilizer->SetTopology(*topology_);
   }
   for (const auto& force_element : owned_force_elements_) {
-    force_element->SetTopology(topology_);
+    force_element->SetTopology(*topology_);
   }
   for (const auto& actuator : owned_actuators_) {
-    actuator->SetTopology(topology_);
+    actuator->SetTopology(*topology_);
   }
 
-  body_node_levels_.resize(topology_.tree_height());
+  body_node_levels_.resize(topology_->tree_height());
   for (BodyNodeIndex body_node_index(1);
-       body_node_index < topology_.get_num_body_nodes(); ++body_node_index) {
+       body_node_index < topology_->get_num_body_nodes(); ++body_node_index) {
     const BodyNodeTopology& node_topology =
-        topology_.get_body_node(body_node_index);
+        topology_->get_body_node(body_node_index);
     body_node_levels_[node_topology.level].push_back(body_node_index);
   }
 
@@ -634,10 +652,48 @@ void MultibodyTree<T>::FinalizeInternals() {
   // This recursion order ensures that a BodyNode's parent is created before the
   // node itself, since BodyNode objects are in Depth First Traversal order.
   for (BodyNodeIndex body_node_index(0);
-       body_node_index < topology_.get_num_body_nodes(); ++body_node_index) {
+       body_node_index < topology_->get_num_body_nodes(); ++body_node_index) {
     CreateBodyNode(body_node_index);
   }
 
+  // Compile the (non-world) body nodes into the flat base-to-tip order used by
+  // the recursive algorithms: sorted by level, and within each level (where
+  // the nodes are independent of each other) grouped by mobilizer kind, so
+  // that consecutive nodes dispatch to the same mobilizer implementation.
+  body_nodes_base_to_tip_.clear();
+  body_nodes_base_to_tip_.reserve(topology_->get_num_body_nodes() - 1);
+  for (int level = 1; level < tree_height(); ++level) {
+    const int level_begin = static_cast<int>(body_nodes_base_to_tip_.size());
+    for (BodyNodeIndex body_node_index : body_node_levels_[level]) {
+      body_nodes_base_to_tip_.push_back(body_nodes_[body_node_index].get());
+    }
+    std::stable_sort(
+        body_nodes_base_to_tip_.begin() + level_begin,
+        body_nodes_base_to_tip_.end(),
+        [](const BodyNode<T>* a, const BodyNode<T>* b) {
+          return std::type_index(typeid(a->get_mobilizer())) <
+                 std::type_index(typeid(b->get_mobilizer()));
+        });
+  }
+
+  // Gather the LinearSpringDamper elements into a batch evaluated in a single
+  // pass by CalcForceElementsContribution(); the remaining force elements are
+  // evaluated one at a time.
+  std::vector<const LinearSpringDamper<T>*> linear_spring_dampers;
+  unbatched_force_elements_.clear();
+  for (const auto& force_element : owned_force_elements_) {
+    const auto* linear_spring_damper =
+        dynamic_cast<const LinearSpringDamper<T>*>(force_element.get());
+    if (linear_spring_damper != nullptr) {
+      linear_spring_dampers.push_back(linear_spring_damper);
+    } else {
+      unbatched_force_elements_.push_back(force_element.get());
+    }
+  }
+  linear_spring_damper_batch_ =
+      std::make_shared<const internal::LinearSpringDamperBatch<T>>(
+          linear_spring_dampers);
+
   CreateModelInstances();
 }
 
@@ -682,7 +738,7 @@ void MultibodyTree<T>::Finalize() {
 template <typename T>
 void MultibodyTree<T>::CreateBodyNode(BodyNodeIndex body_node_index) {
   const BodyNodeTopology& node_topology =
-      topology_.get_body_node(body_node_index);
+      topology_->get_body_node(body_node_index);
   const BodyIndex body_index = node_topology.body;
 
   const Body<T>* body = owned_bodies_[node_topology.body].get();
@@ -705,7 +761,7 @@ void MultibodyTree<T>::CreateBodyNode(BodyNodeIndex body_node_index) {
     parent_node->add_child_node(body_node.get());
   }
   body_node->set_parent_tree(this, body_node_index);
-  body_node->SetTopology(topology_);
+  body_node->SetTopology(*topology_);
 
   body_nodes_.push_back(std::move(body_node));
 }
@@ -937,16 +993,11 @@ void MultibodyTree<T>::CalcPositionKinematicsCache(
   // information for each body, we are now in position to perform a base-to-tip
   // recursion to update world positions and parent to child body transforms.
   // This skips the world, level = 0.
-  for (int level = 1; level < tree_height(); ++level) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[level]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
-      DRAKE_ASSERT(node.get_topology().level == level);
-      DRAKE_ASSERT(node.index() == body_node_index);
+  for (const BodyNode<T>* node_ptr : body_nodes_base_to_tip_) {
+    const BodyNode<T>& node = *node_ptr;
 
-      // Update per-node kinematics.
-      node.CalcPositionKinematicsCache_BaseToTip(context, pc);
-    }
+    // Update per-node kinematics.
+    node.CalcPositionKinematicsCache_BaseToTip(context, pc);
   }
 }
 
@@ -972,25 +1023,20 @@ void MultibodyTree<T>::CalcVelocityKinematicsCache(
 
   // Performs a base-to-tip recursion computing body velocities.
   // This skips the world, depth = 0.
-  for (int depth = 1; depth < tree_height(); ++depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
-      DRAKE_ASSERT(node.get_topology().level == depth);
-      DRAKE_ASSERT(node.index() == body_node_index);
+  for (const BodyNode<T>* node_ptr : body_nodes_base_to_tip_) {
+    const BodyNode<T>& node = *node_ptr;
+
+    // Hinge matrix for this node. H_PB_W ∈ ℝ⁶ˣⁿᵐ with nm ∈ [0; 6] the
+    // number of mobilities for this node. Therefore, the return is a
+    // MatrixUpTo6 since the number of columns generally changes with the
+    // node.  It is returned as an Eigen::Map to the memory allocated in the
+    // std::vector H_PB_W_cache so that we can work with H_PB_W as with any
+    // other Eigen matrix object.
+    Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
 
-      // Hinge matrix for this node. H_PB_W ∈ ℝ⁶ˣⁿᵐ with nm ∈ [0; 6] the
-      // number of mobilities for this node. Therefore, the return is a
-      // MatrixUpTo6 since the number of columns generally changes with the
-      // node.  It is returned as an Eigen::Map to the memory allocated in the
-      // std::vector H_PB_W_cache so that we can work with H_PB_W as with any
-      // other Eigen matrix object.
-      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
-          node.GetJacobianFromArray(H_PB_W_cache);
-
-      // Update per-node kinematics.
-      node.CalcVelocityKinematicsCache_BaseToTip(context, pc, H_PB_W, vc);
-    }
+    // Update per-node kinematics.
+    node.CalcVelocityKinematicsCache_BaseToTip(context, pc, H_PB_W, vc);
   }
 }
 
@@ -1045,21 +1091,21 @@ void MultibodyTree<T>::CalcCompositeBodyInertiasInWorld(
       EvalSpatialInertiaInWorldCache(context);
 
   // Perform tip-to-base recursion for each composite body, skipping the world.
-  for (int depth = tree_height() - 1; depth > 0; --depth) {
-    for (BodyNodeIndex composite_node_index : body_node_levels_[depth]) {
-      // Node corresponding to the composite body C.
-      const BodyNode<T>& composite_node = *body_nodes_[composite_node_index];
-
-      // This node's spatial inertia.
-      const SpatialInertia<T>& M_C_W = M_B_W_all[composite_node_index];
-
-      // Compute the spatial inertia Mc_C_W of the composite body C
-      // corresponding to the node with index composite_node_index. Computed
-      // about C's origin Co and expressed in the world frame W.
-      SpatialInertia<T>& Mc_C_W = (*Mc_B_W_all)[composite_node_index];
-      composite_node.CalcCompositeBodyInertia_TipToBase(M_C_W, pc, *Mc_B_W_all,
-                                                        &Mc_C_W);
-    }
+  for (auto node_ptr = body_nodes_base_to_tip_.rbegin();
+       node_ptr != body_nodes_base_to_tip_.rend(); ++node_ptr) {
+    // Node corresponding to the composite body C.
+    const BodyNode<T>& composite_node = **node_ptr;
+    const BodyNodeIndex composite_node_index = composite_node.index();
+
+    // This node's spatial inertia.
+    const SpatialInertia<T>& M_C_W = M_B_W_all[composite_node_index];
+
+    // Compute the spatial inertia Mc_C_W of the composite body C
+    // corresponding to the node with index composite_node_index. Computed
+    // about C's origin Co and expressed in the world frame W.
+    SpatialInertia<T>& Mc_C_W = (*Mc_B_W_all)[composite_node_index];
+    composite_node.CalcCompositeBodyInertia_TipToBase(M_C_W, pc, *Mc_B_W_all,
+                                                      &Mc_C_W);
   }
 }
 
@@ -1167,7 +1213,7 @@ void MultibodyTree<T>::CalcSpatialAccelerationsFromVdot(
   DRAKE_DEMAND(A_WB_array != nullptr);
   DRAKE_DEMAND(static_cast<int>(A_WB_array->size()) == num_bodies());
 
-  DRAKE_DEMAND(known_vdot.size() == topology_.num_velocities());
+  DRAKE_DEMAND(known_vdot.size() == topology_->num_velocities());
 
   const auto& pc = EvalPositionKinematics(context);
   const VelocityKinematicsCache<T>* vc =
@@ -1181,17 +1227,12 @@ void MultibodyTree<T>::CalcSpatialAccelerationsFromVdot(
 
   // Performs a base-to-tip recursion computing body accelerations.
   // This skips the world, depth = 0.
-  for (int depth = 1; depth < tree_height(); ++depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
-      DRAKE_ASSERT(node.get_topology().level == depth);
-      DRAKE_ASSERT(node.index() == body_node_index);
+  for (const BodyNode<T>* node_ptr : body_nodes_base_to_tip_) {
+    const BodyNode<T>& node = *node_ptr;
 
-      // Update per-node kinematics.
-      node.CalcSpatialAcceleration_BaseToTip(
-          context, pc, vc, known_vdot, A_WB_array);
-    }
+    // Update per-node kinematics.
+    node.CalcSpatialAcceleration_BaseToTip(
+        context, pc, vc, known_vdot, A_WB_array);
   }
 }
 
@@ -1203,7 +1244,7 @@ void MultibodyTree<T>::CalcAccelerationKinematicsCache(
     const VectorX<T>& known_vdot,
     AccelerationKinematicsCache<T>* ac) const {
   DRAKE_DEMAND(ac != nullptr);
-  DRAKE_DEMAND(known_vdot.size() == topology_.num_velocities());
+  DRAKE_DEMAND(known_vdot.size() == topology_->num_velocities());
 
   // TODO(amcastro-tri): Loop over bodies to compute velocity kinematics updates
   // corresponding to flexible bodies.
@@ -1347,10 +1388,12 @@ void MultibodyTree<T>::CalcForceElementsContribution(
   DRAKE_DEMAND(forces->CheckHasRightSizeForModel(*this));
 
   forces->SetZero();
-  // Add contributions from force elements.
-  for (const auto& force_element : owned_force_elements_) {
+  // Add contributions from force elements; see FinalizeInternals() for how
+  // they are grouped.
+  for (const ForceElement<T>* force_element : unbatched_force_elements_) {
     force_element->CalcAndAddForceContribution(context, pc, vc, forces);
   }
+  linear_spring_damper_batch_->CalcAndAddForceContribution(pc, vc, forces);
 
   // TODO(amcastro-tri): Remove this call once damping is implemented in terms
   // of force elements.
@@ -1473,91 +1516,92 @@ void MultibodyTree<T>::CalcMassMatrix(const systems::Context<T>& context,
   (*M) = reflected_inertia.asDiagonal();
 
   // Perform tip-to-base recursion for each composite body, skipping the world.
-  for (int depth = tree_height() - 1; depth > 0; --depth) {
-    for (BodyNodeIndex composite_node_index : body_node_levels_[depth]) {
-      // Node corresponding to the composite body C.
-      const BodyNode<T>& composite_node = *body_nodes_[composite_node_index];
-      const int cnv = composite_node.get_num_mobilizer_velocities();
-
-      if (cnv == 0) continue;  // Weld has no generalized coordinates, so skip.
-
-      // This node's 6x6 composite body inertia.
-      const SpatialInertia<T>& Mc_C_W = Mc_B_W_cache[composite_node_index];
-
-      // Across-mobilizer 6 x cnv hinge matrix, from C's parent Cp to C.
-      Eigen::Map<const MatrixUpTo6<T>> H_CpC_W =
-          composite_node.GetJacobianFromArray(H_PB_W_cache);
-
-      // The composite body algorithm considers the system at rest, when
-      // generalized velocities are zero.
-      // Now if we consider this node's generalized accelerations as the matrix
-      // vm_dot = Iₘ, the identity matrix in ℝᵐˣᵐ, the spatial acceleration A_WC
-      // is in ℝ⁶ˣᵐ. That is, we are considering each case in which all
-      // generalized accelerations are zero but the m-th generalized
-      // acceleration for this node equals one.
-      // This node's spatial acceleration can be written as:
-      //   A_WC = Φᵀ(p_CpC) * A_WCp + Ac_WC + Ab_CpC_W + H_CpC_W * vm_dot
-      // where A_WCp is the spatial acceleration of the parent node's body Cp,
-      // Ac_WC include the centrifugal and Coriolis terms, and Ab_CpC_W is the
-      // spatial acceleration bias of the hinge Jacobian matrix H_CpC_W.
-      // Now, since all generalized accelerations but vm_dot are zero, then
-      // A_WCp is zero.  Since the system is at rest, Ac_WC and Ab_CpC_W are
-      // zero.
-      // Therefore, for vm_dot = Iₘ, we have that A_WC = H_CpC_W.
-      const auto& A_WC = H_CpC_W;  // 6 x cnv
-
-      // If we consider the closed system composed of the composite body held by
-      // its mobilizer, the Newton-Euler equations state:
-      //   Fm_CCo_W = Mc_C_W * A_WC + Fb_C_W
-      // where Fm_CCo_W is the spatial force at this node's mobilizer.
-      // Since the system is at rest, we have Fb_C_W = 0 and thus:
-      const Matrix6xUpTo6<T> Fm_CCo_W = Mc_C_W * A_WC;  // 6 x cnv.
-
-      const int composite_start = composite_node.velocity_start();
-
-      // Diagonal block corresponding to current node (composite_node_index).
-      M->block(composite_start, composite_start, cnv, cnv) +=
-          H_CpC_W.transpose() * Fm_CCo_W;
-
-      // We recurse the tree inwards from C all the way to the root. We define
-      // the frames:
-      //  - B:  the frame for the current node, body_node.
-      //  - Bc: B's child node frame, child_node.
-      //  - P:  B's parent node frame.
-      const BodyNode<T>* child_node =
-          &composite_node;  // Child starts at frame C.
-      const BodyNode<T>* body_node = child_node->parent_body_node();
-      Matrix6xUpTo6<T> Fm_CBo_W = Fm_CCo_W;  // 6 x cnv
-      while (body_node) {
-        const Vector3<T>& p_BcBo_W = -pc.get_p_PoBo_W(child_node->index());
-        // In place rigid shift of the spatial force in each column of
-        // Fm_CBo_W, from Bc to Bo. Before this computation, Fm_CBo_W actually
-        // stores Fm_CBc_W from the previous recursion. At the end of this
-        // computation, Fm_CBo_W stores the spatial force on composite body C,
-        // shifted to Bo, and expressed in the world W. That is, we are doing
-        // Fm_CBo_W = Fm_CBc_W.Shift(p_BcB_W).
-        SpatialForce<T>::ShiftInPlace(&Fm_CBo_W, p_BcBo_W);
-
-        // The shift alone is sufficient for a weld joint.
-        const int bnv = body_node->get_num_mobilizer_velocities();
-        if (bnv > 0) {
-          // Across mobilizer 6 x bnv Jacobian between body_node B and
-          // its parent P.
-          const Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
-              body_node->GetJacobianFromArray(H_PB_W_cache);
-
-          // Compute the corresponding bnv x cnv block.
-          const MatrixUpTo6<T> HtFm = H_PB_W.transpose() * Fm_CBo_W;
-          const int body_start = body_node->velocity_start();
-          M->block(body_start, composite_start, bnv, cnv) += HtFm;
-
-          // And copy to its symmetric block.
-          M->block(composite_start, body_start, cnv, bnv) += HtFm.transpose();
-        }
-
-        child_node = body_node;                      // Update child node Bc.
-        body_node = child_node->parent_body_node();  // Update node B.
+  for (auto node_ptr = body_nodes_base_to_tip_.rbegin();
+       node_ptr != body_nodes_base_to_tip_.rend(); ++node_ptr) {
+    // Node corresponding to the composite body C.
+    const BodyNode<T>& composite_node = **node_ptr;
+    const BodyNodeIndex composite_node_index = composite_node.index();
+
+    const int cnv = composite_node.get_num_mobilizer_velocities();
+
+    if (cnv == 0) continue;  // Weld has no generalized coordinates, so skip.
+
+    // This node's 6x6 composite body inertia.
+    const SpatialInertia<T>& Mc_C_W = Mc_B_W_cache[composite_node_index];
+
+    // Across-mobilizer 6 x cnv hinge matrix, from C's parent Cp to C.
+    Eigen::Map<const MatrixUpTo6<T>> H_CpC_W =
+        composite_node.GetJacobianFromArray(H_PB_W_cache);
+
+    // The composite body algorithm considers the system at rest, when
+    // generalized velocities are zero.
+    // Now if we consider this node's generalized accelerations as the matrix
+    // vm_dot = Iₘ, the identity matrix in ℝᵐˣᵐ, the spatial acceleration A_WC
+    // is in ℝ⁶ˣᵐ. That is, we are considering each case in which all
+    // generalized accelerations are zero but the m-th generalized
+    // acceleration for this node equals one.
+    // This node's spatial acceleration can be written as:
+    //   A_WC = Φᵀ(p_CpC) * A_WCp + Ac_WC + Ab_CpC_W + H_CpC_W * vm_dot
+    // where A_WCp is the spatial acceleration of the parent node's body Cp,
+    // Ac_WC include the centrifugal and Coriolis terms, and Ab_CpC_W is the
+    // spatial acceleration bias of the hinge Jacobian matrix H_CpC_W.
+    // Now, since all generalized accelerations but vm_dot are zero, then
+    // A_WCp is zero.  Since the system is at rest, Ac_WC and Ab_CpC_W are
+    // zero.
+    // Therefore, for vm_dot = Iₘ, we have that A_WC = H_CpC_W.
+    const auto& A_WC = H_CpC_W;  // 6 x cnv
+
+    // If we consider the closed system composed of the composite body held by
+    // its mobilizer, the Newton-Euler equations state:
+    //   Fm_CCo_W = Mc_C_W * A_WC + Fb_C_W
+    // where Fm_CCo_W is the spatial force at this node's mobilizer.
+    // Since the system is at rest, we have Fb_C_W = 0 and thus:
+    const Matrix6xUpTo6<T> Fm_CCo_W = Mc_C_W * A_WC;  // 6 x cnv.
+
+    const int composite_start = composite_node.velocity_start();
+
+    // Diagonal block corresponding to current node (composite_node_index).
+    M->block(composite_start, composite_start, cnv, cnv) +=
+        H_CpC_W.transpose() * Fm_CCo_W;
+
+    // We recurse the tree inwards from C all the way to the root. We define
+    // the frames:
+    //  - B:  the frame for the current node, body_node.
+    //  - Bc: B's child node frame, child_node.
+    //  - P:  B's parent node frame.
+    const BodyNode<T>* child_node =
+        &composite_node;  // Child starts at frame C.
+    const BodyNode<T>* body_node = child_node->parent_body_node();
+    Matrix6xUpTo6<T> Fm_CBo_W = Fm_CCo_W;  // 6 x cnv
+    while (body_node) {
+      const Vector3<T>& p_BcBo_W = -pc.get_p_PoBo_W(child_node->index());
+      // In place rigid shift of the spatial force in each column of
+      // Fm_CBo_W, from Bc to Bo. Before this computation, Fm_CBo_W actually
+      // stores Fm_CBc_W from the previous recursion. At the end of this
+      // computation, Fm_CBo_W stores the spatial force on composite body C,
+      // shifted to Bo, and expressed in the world W. That is, we are doing
+      // Fm_CBo_W = Fm_CBc_W.Shift(p_BcB_W).
+      SpatialForce<T>::ShiftInPlace(&Fm_CBo_W, p_BcBo_W);
+
+      // The shift alone is sufficient for a weld joint.
+      const int bnv = body_node->get_num_mobilizer_velocities();
+      if (bnv > 0) {
+        // Across mobilizer 6 x bnv Jacobian between body_node B and
+        // its parent P.
+        const Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+            body_node->GetJacobianFromArray(H_PB_W_cache);
+
+        // Compute the corresponding bnv x cnv block.
+        const MatrixUpTo6<T> HtFm = H_PB_W.transpose() * Fm_CBo_W;
+        const int body_start = body_node->velocity_start();
+        M->block(body_start, composite_start, bnv, cnv) += HtFm;
+
+        // And copy to its symmetric block.
+        M->block(composite_start, body_start, cnv, bnv) += HtFm.transpose();
       }
+
+      child_node = body_node;                      // Update child node Bc.
+      body_node = child_node->parent_body_node();  // Update node B.
     }
   }
 }
@@ -1578,6 +1622,72 @@ void MultibodyTree<T>::CalcBiasTerm(
                       &A_WB_array, &F_BMo_W_array, Cv);
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcMassMatrixBatch(
+    systems::Context<T>* context, const Eigen::Ref<const MatrixX<T>>& q_batch,
+    EigenPtr<MatrixX<T>> M_batch) const {
+  DRAKE_THROW_UNLESS(context != nullptr);
+  DRAKE_THROW_UNLESS(M_batch != nullptr);
+  const int nv = num_velocities();
+  const int num_samples = q_batch.cols();
+  DRAKE_THROW_UNLESS(q_batch.rows() == num_positions());
+  DRAKE_THROW_UNLESS(M_batch->rows() == nv);
+  DRAKE_THROW_UNLESS(M_batch->cols() == nv * num_samples);
+  for (int i = 0; i < num_samples; ++i) {
+    GetMutablePositions(context) = q_batch.col(i);
+    auto M_i = M_batch->middleCols(i * nv, nv);
+    CalcMassMatrix(*context, &M_i);
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcBiasTermBatch(
+    systems::Context<T>* context, const Eigen::Ref<const MatrixX<T>>& q_batch,
+    const Eigen::Ref<const MatrixX<T>>& v_batch,
+    EigenPtr<MatrixX<T>> Cv_batch) const {
+  DRAKE_THROW_UNLESS(context != nullptr);
+  DRAKE_THROW_UNLESS(Cv_batch != nullptr);
+  const int nv = num_velocities();
+  const int num_samples = q_batch.cols();
+  DRAKE_THROW_UNLESS(q_batch.rows() == num_positions());
+  DRAKE_THROW_UNLESS(v_batch.rows() == nv);
+  DRAKE_THROW_UNLESS(v_batch.cols() == num_samples);
+  DRAKE_THROW_UNLESS(Cv_batch->rows() == nv);
+  DRAKE_THROW_UNLESS(Cv_batch->cols() == num_samples);
+  // Unlike in CalcBiasTerm(), the auxiliary arrays used by inverse dynamics
+  // are allocated once and reused for every sample.
+  const VectorX<T> vdot = VectorX<T>::Zero(nv);
+  std::vector<SpatialAcceleration<T>> A_WB_array(num_bodies());
+  std::vector<SpatialForce<T>> F_BMo_W_array(num_bodies());
+  for (int i = 0; i < num_samples; ++i) {
+    Eigen::VectorBlock<VectorX<T>> x = GetMutablePositionsAndVelocities(context);
+    x.head(num_positions()) = q_batch.col(i);
+    x.tail(nv) = v_batch.col(i);
+    auto Cv_i = Cv_batch->col(i);
+    CalcInverseDynamics(*context, vdot, {}, VectorX<T>(), &A_WB_array,
+                        &F_BMo_W_array, &Cv_i);
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcAllBodyPosesInWorldBatch(
+    systems::Context<T>* context, const Eigen::Ref<const MatrixX<T>>& q_batch,
+    std::vector<RigidTransform<T>>* X_WB_batch) const {
+  DRAKE_THROW_UNLESS(context != nullptr);
+  DRAKE_THROW_UNLESS(X_WB_batch != nullptr);
+  DRAKE_THROW_UNLESS(q_batch.rows() == num_positions());
+  const int num_samples = q_batch.cols();
+  X_WB_batch->resize(num_bodies() * num_samples);
+  for (int i = 0; i < num_samples; ++i) {
+    GetMutablePositions(context) = q_batch.col(i);
+    const PositionKinematicsCache<T>& pc = EvalPositionKinematics(*context);
+    for (BodyIndex body_index(0); body_index < num_bodies(); ++body_index) {
+      const BodyNodeIndex node_index = get_body(body_index).node_index();
+      (*X_WB_batch)[body_index * num_samples + i] = pc.get_X_WB(node_index);
+    }
+  }
+}
+
 template <typename T>
 VectorX<T> MultibodyTree<T>::CalcGravityGeneralizedForces(
     const systems::Context<T>& context) const {
@@ -1880,7 +1990,7 @@ SpatialMomentum<T> MultibodyTree<T>::CalcSpatialMomentumInWorldAboutPoint(
   std::vector<BodyIndex> body_indexes;
   for (auto model_instance : model_instances) {
     // If invalid model_instance, throw an exception with a helpful message.
-    if (model_instance >= instance_name_to_index_.size()) {
+    if (model_instance >= names_->instance_name_to_index.size()) {
       throw std::logic_error(
           "CalcSpatialMomentumInWorldAboutPoint(): This MultibodyPlant method"
           " contains an invalid model_instance.");
@@ -2498,7 +2608,7 @@ void MultibodyTree<T>::CalcJacobianAngularAndOrTranslationalVelocityInWorld(
 
   // Form kinematic path from body_F to the world.
   std::vector<BodyNodeIndex> path_to_world;
-  topology_.GetKinematicPathToWorld(body_F.node_index(), &path_to_world);
+  topology_->GetKinematicPathToWorld(body_F.node_index(), &path_to_world);
   const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
 
   const std::vector<Vector6<T>>& H_PB_W_cache =
@@ -2861,19 +2971,19 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
   const VectorX<T>& reflected_inertia = EvalReflectedInertiaCache(context);
 
   // Perform tip-to-base recursion, skipping the world.
-  for (int depth = tree_height() - 1; depth > 0; --depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
+  for (auto node_ptr = body_nodes_base_to_tip_.rbegin();
+       node_ptr != body_nodes_base_to_tip_.rend(); ++node_ptr) {
+    const BodyNode<T>& node = **node_ptr;
+    const BodyNodeIndex body_node_index = node.index();
 
-      // Get hinge matrix and spatial inertia for this node.
-      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
-          node.GetJacobianFromArray(H_PB_W_cache);
-      const SpatialInertia<T>& M_B_W =
-          spatial_inertia_in_world_cache[body_node_index];
+    // Get hinge matrix and spatial inertia for this node.
+    Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
+    const SpatialInertia<T>& M_B_W =
+        spatial_inertia_in_world_cache[body_node_index];
 
-      node.CalcArticulatedBodyInertiaCache_TipToBase(
-          context, pc, H_PB_W, M_B_W, reflected_inertia, abic);
-    }
+    node.CalcArticulatedBodyInertiaCache_TipToBase(
+        context, pc, H_PB_W, M_B_W, reflected_inertia, abic);
   }
 }
 
@@ -2912,26 +3022,26 @@ void MultibodyTree<T>::CalcArticulatedBodyForceCache(
       EvalArticulatedBodyForceBiasCache(context);
 
   // Perform tip-to-base recursion, skipping the world.
-  for (int depth = tree_height() - 1; depth > 0; --depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
+  for (auto node_ptr = body_nodes_base_to_tip_.rbegin();
+       node_ptr != body_nodes_base_to_tip_.rend(); ++node_ptr) {
+    const BodyNode<T>& node = **node_ptr;
+    const BodyNodeIndex body_node_index = node.index();
+
+    // Get generalized force and body force for this node.
+    Eigen::Ref<const VectorX<T>> tau_applied =
+        node.get_mobilizer().get_generalized_forces_from_array(
+            generalized_forces);
+    const SpatialForce<T>& Fapplied_Bo_W = body_forces[body_node_index];
+
+    // Get references to the hinge matrix and force bias for this node.
+    Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
+    const SpatialForce<T>& Fb_B_W = dynamic_bias_cache[body_node_index];
+    const SpatialForce<T>& Zb_Bo_W = Zb_Bo_W_cache[body_node_index];
 
-      // Get generalized force and body force for this node.
-      Eigen::Ref<const VectorX<T>> tau_applied =
-          node.get_mobilizer().get_generalized_forces_from_array(
-              generalized_forces);
-      const SpatialForce<T>& Fapplied_Bo_W = body_forces[body_node_index];
-
-      // Get references to the hinge matrix and force bias for this node.
-      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
-          node.GetJacobianFromArray(H_PB_W_cache);
-      const SpatialForce<T>& Fb_B_W = dynamic_bias_cache[body_node_index];
-      const SpatialForce<T>& Zb_Bo_W = Zb_Bo_W_cache[body_node_index];
-
-      node.CalcArticulatedBodyForceCache_TipToBase(
-          context, pc, &vc, Fb_B_W, abic, Zb_Bo_W, Fapplied_Bo_W, tau_applied,
-          H_PB_W, aba_force_cache);
-    }
+    node.CalcArticulatedBodyForceCache_TipToBase(
+        context, pc, &vc, Fb_B_W, abic, Zb_Bo_W, Fapplied_Bo_W, tau_applied,
+        H_PB_W, aba_force_cache);
   }
 }
 
@@ -2950,19 +3060,18 @@ void MultibodyTree<T>::CalcArticulatedBodyAccelerations(
       EvalSpatialAccelerationBiasCache(context);
 
   // Perform base-to-tip recursion, skipping the world.
-  for (int depth = 1; depth < tree_height(); ++depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
+  for (const BodyNode<T>* node_ptr : body_nodes_base_to_tip_) {
+    const BodyNode<T>& node = *node_ptr;
+    const BodyNodeIndex body_node_index = node.index();
 
-      const SpatialAcceleration<T>& Ab_WB = Ab_WB_cache[body_node_index];
+    const SpatialAcceleration<T>& Ab_WB = Ab_WB_cache[body_node_index];
 
-      // Get reference to the hinge mapping matrix.
-      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
-          node.GetJacobianFromArray(H_PB_W_cache);
+    // Get reference to the hinge mapping matrix.
+    Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
 
-      node.CalcArticulatedBodyAccelerations_BaseToTip(
-          context, pc, abic, aba_force_cache, H_PB_W, Ab_WB, ac);
-    }
+    node.CalcArticulatedBodyAccelerations_BaseToTip(
+        context, pc, abic, aba_force_cache, H_PB_W, Ab_WB, ac);
   }
 }
 
@@ -3197,14 +3306,14 @@ VectorX<double> MultibodyTree<T>::GetEffortUpperLimits() const {
 template <typename T>
 std::optional<BodyIndex> MultibodyTree<T>::MaybeGetUniqueBaseBodyIndex(
     ModelInstanceIndex model_instance) const {
-  DRAKE_THROW_UNLESS(model_instance < instance_name_to_index_.size());
+  DRAKE_THROW_UNLESS(model_instance < names_->instance_name_to_index.size());
   if (model_instance == world_model_instance()) {
     return std::nullopt;
   }
   std::optional<BodyIndex> base_body_index{};
   for (const auto& body : owned_bodies_) {
     if (body->model_instance() == model_instance &&
-        (topology_.get_body(body->index()).parent_body == world_index())) {
+        (topology_->get_body(body->index()).parent_body == world_index())) {
       if (base_body_index.has_value()) {
         // More than one base body associated with this model.
         return std::nullopt;
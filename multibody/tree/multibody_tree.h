@@ -64,10 +64,49 @@ enum class JacobianWrtVariable {
 namespace internal {
 
 template <typename T> class BodyNode;
+template <typename T> class LinearSpringDamperBatch;
 template <typename T> class ModelInstance;
 template <typename T> class Mobilizer;
 template <typename T> class QuaternionFloatingMobilizer;
 
+// TODO(amcastro-tri): Consider moving these maps into MultibodyTreeTopology
+// since they are not templated on <T>.
+
+// The lookup tables from element names to indices, and back. Once a tree is
+// finalized, nothing can be added to it, so its scalar-converted clones
+// share these tables rather than copying them (see
+// MultibodyTree::CloneToScalar()).
+struct MultibodyTreeNameIndices {
+  // In order for the keys in the following maps to have correct semantics,
+  // indices should only be set in these maps via invocations to
+  // SetElementIndex. Never call emplace or insert directly, just to be safe.
+
+  // The xxx_name_to_index structures are multimaps because
+  // bodies/joints/actuators/etc may appear with the same name in different
+  // model instances.  The index values are still unique across the entire
+  // %MultibodyTree.
+
+  // Map used to find body indexes by their body name.
+  std::unordered_multimap<StringViewMapKey, BodyIndex> body_name_to_index;
+
+  // Map used to find frame indexes by their frame name.
+  std::unordered_multimap<StringViewMapKey, FrameIndex> frame_name_to_index;
+
+  // Map used to find joint indexes by their joint name.
+  std::unordered_multimap<StringViewMapKey, JointIndex> joint_name_to_index;
+
+  // Map used to find actuator indexes by their actuator name.
+  std::unordered_multimap<StringViewMapKey, JointActuatorIndex>
+      actuator_name_to_index;
+
+  // Map used to find a model instance index by its model instance name.
+  std::unordered_map<StringViewMapKey, ModelInstanceIndex>
+      instance_name_to_index;
+
+  // Map used to find a model instance name by its model instance index.
+  std::unordered_map<ModelInstanceIndex, std::string> instance_index_to_name;
+};
+
 // %MultibodyTree provides a representation for a physical system consisting of
 // a collection of interconnected rigid and deformable bodies. As such, it owns
 // and manages each of the elements that belong to this physical system.
@@ -563,12 +602,12 @@ class MultibodyTree {
 
   // Returns the number of model instances in the MultibodyTree.
   int num_model_instances() const {
-    return static_cast<int>(instance_name_to_index_.size());
+    return static_cast<int>(names_->instance_name_to_index.size());
   }
 
   // Returns the number of generalized positions of the model.
   int num_positions() const {
-    return topology_.num_positions();
+    return topology_->num_positions();
   }
 
   // Returns the number of generalized positions in a specific model instance.
@@ -579,7 +618,7 @@ class MultibodyTree {
 
   // Returns the number of generalized velocities of the model.
   int num_velocities() const {
-    return topology_.num_velocities();
+    return topology_->num_velocities();
   }
 
   // Returns the number of generalized velocities in a specific model instance.
@@ -590,7 +629,7 @@ class MultibodyTree {
 
   // Returns the total size of the state vector in the model.
   int num_states() const {
-    return topology_.num_states();
+    return topology_->num_states();
   }
 
   // Returns the total size of the state vector in a specific model instance.
@@ -602,7 +641,7 @@ class MultibodyTree {
 
   // See MultibodyPlant method.
   int num_actuated_dofs() const {
-    return topology_.num_actuated_dofs();
+    return topology_->num_actuated_dofs();
   }
 
   // See MultibodyPlant method.
@@ -619,7 +658,7 @@ class MultibodyTree {
   // frames. Therefore, this method does not count kinematic cycles, which
   // could only be considered in the model using constraints.
   int tree_height() const {
-    return topology_.tree_height();
+    return topology_->tree_height();
   }
 
   // Returns a constant reference to the *world* body.
@@ -878,13 +917,13 @@ class MultibodyTree {
   // When a %MultibodyTree is instantiated, its topology remains invalid until
   // Finalize() is called, which validates the topology.
   // @see Finalize().
-  bool topology_is_valid() const { return topology_.is_valid(); }
+  bool topology_is_valid() const { return topology_->is_valid(); }
 
   // Returns the topology information for this multibody tree. Users should not
   // need to call this method since MultibodyTreeTopology is an internal
   // bookkeeping detail. Used at Finalize() stage by multibody elements to
   // retrieve a local copy of their topology.
-  const MultibodyTreeTopology& get_topology() const { return topology_; }
+  const MultibodyTreeTopology& get_topology() const { return *topology_; }
 
   // Returns the mobilizer model for joint with index `joint_index`. The index
   // is invalid if the joint is not modeled with a mobilizer.
@@ -1638,6 +1677,25 @@ class MultibodyTree {
   void CalcBiasTerm(
       const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const;
 
+  // See MultibodyPlant method.
+  void CalcMassMatrixBatch(
+      systems::Context<T>* context,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      EigenPtr<MatrixX<T>> M_batch) const;
+
+  // See MultibodyPlant method.
+  void CalcBiasTermBatch(
+      systems::Context<T>* context,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      const Eigen::Ref<const MatrixX<T>>& v_batch,
+      EigenPtr<MatrixX<T>> Cv_batch) const;
+
+  // See MultibodyPlant method.
+  void CalcAllBodyPosesInWorldBatch(
+      systems::Context<T>* context,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      std::vector<math::RigidTransform<T>>* X_WB_batch) const;
+
   // See MultibodyPlant method.
   VectorX<T> CalcGravityGeneralizedForces(
       const systems::Context<T>& context) const;
@@ -2190,15 +2248,12 @@ class MultibodyTree {
       tree_clone->CloneActuatorAndAdd(*actuator);
     }
 
-    // We can safely make a deep copy here since the original multibody tree is
-    // required to be finalized.
+    // The topology and the name lookup tables are not templated on the scalar
+    // type, and the original multibody tree is required to be finalized so
+    // they can no longer change; the clone shares them instead of copying
+    // them.
     tree_clone->topology_ = this->topology_;
-    tree_clone->body_name_to_index_ = this->body_name_to_index_;
-    tree_clone->frame_name_to_index_ = this->frame_name_to_index_;
-    tree_clone->joint_name_to_index_ = this->joint_name_to_index_;
-    tree_clone->actuator_name_to_index_ = this->actuator_name_to_index_;
-    tree_clone->instance_name_to_index_ = this->instance_name_to_index_;
-    tree_clone->instance_index_to_name_ = this->instance_index_to_name_;
+    tree_clone->names_ = this->names_;
     tree_clone->joint_to_mobilizer_ = this->joint_to_mobilizer_;
     tree_clone->discrete_state_index_ = this->discrete_state_index_;
 
@@ -2901,50 +2956,60 @@ class MultibodyTree {
   // The gravity field force element.
   UniformGravityFieldElement<T>* gravity_field_{nullptr};
 
-  // TODO(amcastro-tri): Consider moving these maps into MultibodyTreeTopology
-  // since they are not templated on <T>.
-
-  // In order for the keys in the following maps to have correct semantics,
-  // indices should only be set in these maps via invocations to
-  // SetElementIndex. Never call emplace or insert directly, just to be safe.
-
-  // The xxx_name_to_index_ structures are multimaps because
-  // bodies/joints/actuators/etc may appear with the same name in different
-  // model instances.  The index values are still unique across the entire
-  // %MultibodyTree.
 
-  // Map used to find body indexes by their body name.
-  std::unordered_multimap<StringViewMapKey, BodyIndex> body_name_to_index_;
-
-  // Map used to find frame indexes by their frame name.
-  std::unordered_multimap<StringViewMapKey, FrameIndex> frame_name_to_index_;
-
-  // Map used to find joint indexes by their joint name.
-  std::unordered_multimap<StringViewMapKey, JointIndex> joint_name_to_index_;
-
-  // Map used to find actuator indexes by their actuator name.
-  std::unordered_multimap<StringViewMapKey, JointActuatorIndex>
-      actuator_name_to_index_;
+  // Returns the name lookup tables for modification, first making a private
+  // copy of them if they are shared with another tree.
+  MultibodyTreeNameIndices& mutable_names() {
+    if (names_.use_count() > 1) {
+      names_ = std::make_shared<MultibodyTreeNameIndices>(*names_);
+    }
+    return *names_;
+  }
 
-  // Map used to find a model instance index by its model instance name.
-  std::unordered_map<StringViewMapKey, ModelInstanceIndex>
-      instance_name_to_index_;
+  // Returns the topology for modification, first making a private copy of it
+  // if it is shared with another tree.
+  MultibodyTreeTopology& mutable_topology() {
+    if (topology_.use_count() > 1) {
+      topology_ = std::make_shared<MultibodyTreeTopology>(*topology_);
+    }
+    return *topology_;
+  }
 
-  // Map used to find a model instance name by its model instance index.
-  std::unordered_map<ModelInstanceIndex, std::string> instance_index_to_name_;
+  // Never null. Shared with scalar-converted clones; see
+  // MultibodyTreeNameIndices.
+  std::shared_ptr<MultibodyTreeNameIndices> names_{
+      std::make_shared<MultibodyTreeNameIndices>()};
 
   // Body node indexes ordered by level (a.k.a depth). Therefore for the
   // i-th level body_node_levels_[i] contains the list of all body node indexes
   // in that level.
   std::vector<std::vector<BodyNodeIndex>> body_node_levels_;
 
+  // All body nodes but the world's, in the order in which base-to-tip
+  // recursions visit them: by increasing level and, within a level, grouped by
+  // the concrete type of their inboard mobilizer. Tip-to-base recursions visit
+  // them in reverse. The pointers alias the nodes owned by body_nodes_.
+  std::vector<const internal::BodyNode<T>*> body_nodes_base_to_tip_;
+
+  // The force elements are compiled at finalize time for
+  // CalcForceElementsContribution(): the LinearSpringDamper elements are
+  // gathered into a single batch that is evaluated in one pass, and all other
+  // elements are listed in unbatched_force_elements_, which aliases the
+  // elements owned by owned_force_elements_. A shared_ptr is used so that this
+  // header only needs a forward declaration of the batch type.
+  std::shared_ptr<const internal::LinearSpringDamperBatch<T>>
+      linear_spring_damper_batch_;
+  std::vector<const ForceElement<T>*> unbatched_force_elements_;
+
   // Joint to Mobilizer map, of size num_joints(). For a joint with index
   // joint_index, mobilizer_index = joint_to_mobilizer_[joint_index] maps to the
   // mobilizer model of the joint, or an invalid index if the joint is modeled
   // with constraints instead.
   std::vector<MobilizerIndex> joint_to_mobilizer_;
 
-  MultibodyTreeTopology topology_;
+  // Never null. Shared with scalar-converted clones, like names_.
+  std::shared_ptr<MultibodyTreeTopology> topology_{
+      std::make_shared<MultibodyTreeTopology>()};
 
   const MultibodyTreeSystem<T>* tree_system_{};
 
@@ -1045,6 +1045,41 @@ class MultibodyTreeTopology {
     return welded_bodies;
   }
 
+  // Returns the "parent array" λ of the generalized velocities, Featherstone's
+  // representation of the sparsity pattern of the mass matrix (see Section 6.5
+  // in [Featherstone 2008]). Entry λ[i] is the index of the velocity that
+  // immediately precedes the i-th velocity along the path to the world, or -1
+  // if there is none. Within a mobilizer, velocities form a chain in which
+  // each one is the parent of the next; the first velocity of a mobilizer has
+  // for parent the last velocity of the closest inboard mobilizer whose number
+  // of velocities is non-zero (weld mobilizers are skipped). Since nodes are
+  // ordered base to tip, λ[i] < i. The mass matrix entry M(i, j), with j < i,
+  // can only be non-zero if j is an ancestor of i in λ.
+  //
+  // - [Featherstone 2008] Featherstone, R., 2008. Rigid body dynamics
+  //                       algorithms. Springer.
+  //
+  // @pre is_valid() is true.
+  std::vector<int> GetVelocityParents() const {
+    DRAKE_DEMAND(is_valid());
+    std::vector<int> parents(num_velocities(), -1);
+    // For each node, the index of the last velocity in its path to the world,
+    // or -1 if there is none.
+    std::vector<int> last_velocity_in_path(get_num_body_nodes(), -1);
+    for (BodyNodeIndex node_index(1); node_index < get_num_body_nodes();
+         ++node_index) {
+      const BodyNodeTopology& node = get_body_node(node_index);
+      int parent = last_velocity_in_path[node.parent_body_node];
+      for (int k = 0; k < node.num_mobilizer_velocities; ++k) {
+        const int v = node.mobilizer_velocities_start_in_v + k;
+        parents[v] = parent;
+        parent = v;
+      }
+      last_velocity_in_path[node_index] = parent;
+    }
+    return parents;
+  }
+
  private:
   // Returns `true` if there is _any_ mobilizer in the multibody tree
   // connecting the frames with indexes `frame` and `frame2`.
@@ -1,10 +1,15 @@
 #include "drake/multibody/tree/linear_spring_damper.h"
 
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/multibody/tree/position_kinematics_cache.h"
 #include "drake/multibody/tree/prismatic_joint.h"
@@ -285,6 +290,77 @@ TEST_F(SpringDamperTester, Power) {
             non_conservative_power);
 }
 
+// Verify that the plant, which evaluates all of its LinearSpringDamper elements
+// in a single batch, reports the same forces and errors as the element itself.
+TEST_F(SpringDamperTester, BatchedEvaluation) {
+  SetSliderState(2.0, 1.0);
+  CalcSpringDamperForces();
+  MultibodyForces<double> plant_forces(plant_);
+  plant_.CalcForceElementsContribution(*context_, &plant_forces);
+  EXPECT_TRUE(CompareMatrices(
+      plant_forces.body_forces().at(bodyA_->node_index()).get_coeffs(),
+      GetSpatialForceOnBodyA().get_coeffs(), kTolerance));
+  EXPECT_TRUE(CompareMatrices(
+      plant_forces.body_forces().at(bodyB_->node_index()).get_coeffs(),
+      GetSpatialForceOnBodyB().get_coeffs(), kTolerance));
+
+  SetSliderState(0.0, 0.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      plant_.CalcForceElementsContribution(*context_, &plant_forces),
+      "The length of the spring became nearly zero. "
+      "Revisit your model to avoid this situation.");
+}
+
+// Verify that the batched evaluation of many spring-dampers mixed with other
+// force elements matches adding up the contribution of each element in turn.
+GTEST_TEST(LinearSpringDamper, BatchMatchesPerElement) {
+  MultibodyPlant<double> plant{0.};
+  const SpatialInertia<double> inertia(1., Eigen::Vector3d::Zero(),
+                                       UnitInertia<double>(1., 1., 1.));
+  const int kNumBodies = 6;
+  std::vector<const RigidBody<double>*> bodies;
+  for (int i = 0; i < kNumBodies; ++i) {
+    bodies.push_back(
+        &plant.AddRigidBody("Body" + std::to_string(i), inertia));
+  }
+  // A chain of springs between consecutive bodies and to the world.
+  for (int i = 0; i < kNumBodies; ++i) {
+    const Body<double>& previous =
+        (i == 0) ? plant.world_body() : *bodies[i - 1];
+    plant.AddForceElement<LinearSpringDamper>(
+        previous, Vector3<double>(0.1 * i, 0.0, 0.2), *bodies[i],
+        Vector3<double>(0.0, -0.1, 0.05 * i), 0.5 + 0.1 * i, 10.0 + i,
+        0.5 * i);
+  }
+  plant.Finalize();
+  auto context = plant.CreateDefaultContext();
+  for (int i = 0; i < kNumBodies; ++i) {
+    plant.SetFreeBodyPose(
+        context.get(), *bodies[i],
+        math::RigidTransform<double>(
+            math::RollPitchYaw<double>(0.1 * i, -0.2, 0.3 * i),
+            Vector3<double>(1.0 * i, 0.5, -0.2 * i)));
+    plant.SetFreeBodySpatialVelocity(
+        context.get(), *bodies[i],
+        SpatialVelocity<double>(Vector3<double>(0.3, -0.1 * i, 0.2),
+                                Vector3<double>(-0.4 * i, 0.1, 0.7)));
+  }
+
+  MultibodyForces<double> expected(plant);
+  for (ForceElementIndex i(0); i < plant.num_force_elements(); ++i) {
+    plant.get_force_element(i).CalcAndAddForceContribution(
+        *context, plant.EvalPositionKinematics(*context),
+        plant.EvalVelocityKinematics(*context), &expected);
+  }
+  MultibodyForces<double> forces(plant);
+  plant.CalcForceElementsContribution(*context, &forces);
+  for (int i = 0; i < static_cast<int>(forces.body_forces().size()); ++i) {
+    EXPECT_TRUE(CompareMatrices(forces.body_forces()[i].get_coeffs(),
+                                expected.body_forces()[i].get_coeffs(),
+                                100 * kTolerance));
+  }
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -468,6 +468,11 @@ class TreeTopologyTests : public ::testing::Test {
     EXPECT_EQ(topology.velocity_to_tree_index(4), TreeIndex(3));
     EXPECT_EQ(topology.velocity_to_tree_index(5), TreeIndex(3));
     EXPECT_EQ(topology.velocity_to_tree_index(6), TreeIndex(3));
+
+    // All mobilizers have at most one velocity. Therefore, the parent of each
+    // velocity is the velocity of its inboard mobilizer, if any.
+    const std::vector<int> expected_velocity_parents{-1, -1, 1, -1, 3, 3, 5};
+    EXPECT_EQ(topology.GetVelocityParents(), expected_velocity_parents);
   }
 
  protected:
@@ -621,6 +626,9 @@ TEST_F(TreeTopologyTests, ToSymbolic) {
   // The topology of the clone must be exactly equal to the topology of the
   // original MultibodyTree.
   EXPECT_EQ(topology, symbolic_topology);
+  // Since the original is finalized, the clone shares its topology rather than
+  // holding a copy.
+  EXPECT_EQ(&topology, &symbolic_topology);
 
   // Even though the test above confirms the two topologies are exactly equal,
   // we perform a number of additional tests.
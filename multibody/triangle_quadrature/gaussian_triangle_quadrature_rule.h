@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <stdexcept>
 #include <vector>
 
@@ -8,15 +10,153 @@
 namespace drake {
 namespace multibody {
 
+/// Compile-time tables of the Gaussian quadrature rules for triangular
+/// domains, for use where the order of the rule is known at compile time.
+/// Each specialization stores its rule as structure-of-arrays: the
+/// quadrature points' three barycentric coordinates (`kB0`, `kB1`, `kB2`,
+/// with kB2[q] = 1 - kB0[q] - kB1[q]) and the weights (`kWeights`, which sum
+/// to 1), each of length `kNumPoints`. These are the same rules returned by
+/// GaussianTriangleQuadratureRule.
+///
+/// Weights and quadrature points for the rational numbers were taken from
+/// pp. 8-9 of:
+/// http://math2.uncc.edu/~shaodeng/TEACHING/math5172/Lectures/Lect_15.PDF
+/// Weights and quadrature points for decimal numbers were taken from p. 1140
+/// of:
+/// D. A. Dunavant. High degree efficient symmetrical Gaussian quadrature
+/// rules for the triangle. Intl. J. Num. Meth. Eng. pp. 1129-1148, 1985.
+/// The sixth order values were refined to full double precision by solving
+/// Dunavant's moment equations.
+///
+/// @tparam order the order of the rule, between 1 and
+///         kMaxGaussianTriangleQuadratureOrder.
+template <int order>
+struct GaussianTriangleQuadratureTable;
+
+/// The highest order supported by GaussianTriangleQuadratureTable and
+/// GaussianTriangleQuadratureRule.
+constexpr int kMaxGaussianTriangleQuadratureOrder = 6;
+
+namespace internal {
+// Returns the third barycentric coordinates 1 - b0 - b1 of a rule's points.
+template <size_t num_points>
+constexpr std::array<double, num_points> ThirdBarycentric(
+    const std::array<double, num_points>& b0,
+    const std::array<double, num_points>& b1) {
+  std::array<double, num_points> b2{};
+  for (size_t q = 0; q < num_points; ++q) {
+    b2[q] = 1.0 - b0[q] - b1[q];
+  }
+  return b2;
+}
+}  // namespace internal
+
+template <>
+struct GaussianTriangleQuadratureTable<1> {
+  static constexpr int kNumPoints = 1;
+  static constexpr std::array<double, kNumPoints> kWeights{1.0};
+  static constexpr std::array<double, kNumPoints> kB0{1.0/3.0};
+  static constexpr std::array<double, kNumPoints> kB1{1.0/3.0};
+  static constexpr std::array<double, kNumPoints> kB2 =
+      internal::ThirdBarycentric(kB0, kB1);
+};
+
+template <>
+struct GaussianTriangleQuadratureTable<2> {
+  static constexpr int kNumPoints = 3;
+  static constexpr std::array<double, kNumPoints> kWeights{
+      1.0/3.0, 1.0/3.0, 1.0/3.0};
+  static constexpr std::array<double, kNumPoints> kB0{
+      1.0/6.0, 1.0/6.0, 2.0/3.0};
+  static constexpr std::array<double, kNumPoints> kB1{
+      1.0/6.0, 2.0/3.0, 1.0/6.0};
+  static constexpr std::array<double, kNumPoints> kB2 =
+      internal::ThirdBarycentric(kB0, kB1);
+};
+
+template <>
+struct GaussianTriangleQuadratureTable<3> {
+  static constexpr int kNumPoints = 4;
+  static constexpr std::array<double, kNumPoints> kWeights{
+      -27.0/48.0, 25.0/48.0, 25.0/48.0, 25.0/48.0};
+  static constexpr std::array<double, kNumPoints> kB0{
+      1.0/3.0, 1.0/5.0, 1.0/5.0, 3.0/5.0};
+  static constexpr std::array<double, kNumPoints> kB1{
+      1.0/3.0, 1.0/5.0, 3.0/5.0, 1.0/5.0};
+  static constexpr std::array<double, kNumPoints> kB2 =
+      internal::ThirdBarycentric(kB0, kB1);
+};
+
+// TODO(edrumwri): Consider solving the polynomial equations for the
+// rational numbers symbolically (or even numerically) to get the last
+// digit of accuracy for fourth and fifth order; they currently provide
+// "only" 15 decimal digits of accuracy.
+template <>
+struct GaussianTriangleQuadratureTable<4> {
+  static constexpr int kNumPoints = 6;
+  static constexpr std::array<double, kNumPoints> kWeights{
+      0.223381589678011, 0.223381589678011, 0.223381589678011,
+      0.109951743655322, 0.109951743655322, 0.109951743655322};
+  static constexpr std::array<double, kNumPoints> kB0{
+      0.445948490915965, 0.445948490915965, 0.108103018168070,
+      0.091576213509771, 0.091576213509771, 0.816847572980459};
+  static constexpr std::array<double, kNumPoints> kB1{
+      0.445948490915965, 0.108103018168070, 0.445948490915965,
+      0.091576213509771, 0.816847572980459, 0.091576213509771};
+  static constexpr std::array<double, kNumPoints> kB2 =
+      internal::ThirdBarycentric(kB0, kB1);
+};
+
+template <>
+struct GaussianTriangleQuadratureTable<5> {
+  static constexpr int kNumPoints = 7;
+  static constexpr std::array<double, kNumPoints> kWeights{
+      0.225,
+      0.132394152788506, 0.132394152788506, 0.132394152788506,
+      0.125939180544827, 0.125939180544827, 0.125939180544827};
+  static constexpr std::array<double, kNumPoints> kB0{
+      1.0/3.0,
+      0.470142064105115, 0.470142064105115, 0.059715871789770,
+      0.101286507323456, 0.101286507323456, 0.797426985353087};
+  static constexpr std::array<double, kNumPoints> kB1{
+      1.0/3.0,
+      0.470142064105115, 0.059715871789770, 0.470142064105115,
+      0.101286507323456, 0.797426985353087, 0.101286507323456};
+  static constexpr std::array<double, kNumPoints> kB2 =
+      internal::ThirdBarycentric(kB0, kB1);
+};
+
+template <>
+struct GaussianTriangleQuadratureTable<6> {
+  static constexpr int kNumPoints = 12;
+  static constexpr std::array<double, kNumPoints> kWeights{
+      0.116786275726378758, 0.116786275726378758, 0.116786275726378758,
+      0.0508449063702066295, 0.0508449063702066295, 0.0508449063702066295,
+      0.0828510756183739728, 0.0828510756183739728, 0.0828510756183739728,
+      0.0828510756183739728, 0.0828510756183739728, 0.0828510756183739728};
+  static constexpr std::array<double, kNumPoints> kB0{
+      0.249286745170910795, 0.249286745170910795, 0.501426509658178409,
+      0.0630890144915020910, 0.0630890144915020910, 0.873821971016995818,
+      0.0531450498448172003, 0.310352451033784014, 0.0531450498448172003,
+      0.636502499121398785, 0.310352451033784014, 0.636502499121398785};
+  static constexpr std::array<double, kNumPoints> kB1{
+      0.249286745170910795, 0.501426509658178409, 0.249286745170910795,
+      0.0630890144915020910, 0.873821971016995818, 0.0630890144915020910,
+      0.310352451033784014, 0.0531450498448172003, 0.636502499121398785,
+      0.0531450498448172003, 0.636502499121398785, 0.310352451033784014};
+  static constexpr std::array<double, kNumPoints> kB2 =
+      internal::ThirdBarycentric(kB0, kB1);
+};
+
 class GaussianTriangleQuadratureRule final : public TriangleQuadratureRule {
  public:
   /// Constructs the Gaussian quadrature rule of the specified order, which
-  /// must be between 1 and 5.
+  /// must be between 1 and kMaxGaussianTriangleQuadratureOrder.
   explicit GaussianTriangleQuadratureRule(int order) : order_(order) {
     DRAKE_DEMAND(order >= 1);
-    if (order > 5) {
+    if (order > kMaxGaussianTriangleQuadratureOrder) {
       throw std::logic_error(
-        "Gaussian triangle quadrature only supported up to fifth order "
+        "Gaussian triangle quadrature only supported up to sixth order "
         "presently.");
     }
     SetWeightsAndQuadraturePoints();
@@ -24,79 +164,30 @@ class GaussianTriangleQuadratureRule final : public TriangleQuadratureRule {
 
  private:
   // Sets the weights and quadrature points depending on the order of the
-  // quadrature rule. Weights and quadrature points for the rational numbers
-  // were taken from pp. 8-9 of:
-  // http://math2.uncc.edu/~shaodeng/TEACHING/math5172/Lectures/Lect_15.PDF
-  // Weights and quadrature points for decimal numbers were taken from p. 1140
-  // of:
-  // D. A. Dunavant. High degree efficient symmetrical Gaussian quadrature
-  // rules for the triangle. Intl. J. Num. Meth. Eng. pp. 1129-1148, 1985.
+  // quadrature rule, from the corresponding GaussianTriangleQuadratureTable.
   void SetWeightsAndQuadraturePoints() {
     switch (order_) {
-      case 1:
-        weights_.resize(1);
-        quadrature_points_.resize(1);
-        weights_[0] = 1.0;
-        quadrature_points_[0] = { 1.0/3.0, 1.0/3.0 };
-        break;
-
-      case 2:
-        weights_.resize(3);
-        quadrature_points_.resize(3);
-        weights_[0] = weights_[1] = weights_[2] = 1.0/3.0;
-        quadrature_points_[0] = { 1.0/6.0, 1.0/6.0 };
-        quadrature_points_[1] = { 1.0/6.0, 2.0/3.0 };
-        quadrature_points_[2] = { 2.0/3.0, 1.0/6.0 };
-        break;
-
-      case 3:
-        weights_.resize(4);
-        quadrature_points_.resize(4);
-        weights_[0] = -27.0/48.0;
-        weights_[1] = weights_[2] = weights_[3] = 25.0/48.0;
-        quadrature_points_[0] = { 1.0/3.0, 1.0/3.0 };
-        quadrature_points_[1] = { 1.0/5.0, 1.0/5.0 };
-        quadrature_points_[2] = { 1.0/5.0, 3.0/5.0 };
-        quadrature_points_[3] = { 3.0/5.0, 1.0/5.0 };
-        break;
-
-      // TODO(edrumwri): Consider solving the polynomial equations for the
-      // rational numbers symbolically (or even numerically) to get the last
-      // digit of accuracy for fourth order and beyond; fourth and fifth order
-      // currently provide "only" 15 decimal digits of accuracy.
-      case 4:
-        weights_.resize(6);
-        quadrature_points_.resize(6);
-        weights_[0] = weights_[1] = weights_[2] = 0.223381589678011;
-        weights_[3] = weights_[4] = weights_[5] = 0.109951743655322;
-        quadrature_points_[0] = { 0.445948490915965, 0.445948490915965 };
-        quadrature_points_[1] = { 0.445948490915965, 0.108103018168070 };
-        quadrature_points_[2] = { 0.108103018168070, 0.445948490915965 };
-        quadrature_points_[3] = { 0.091576213509771, 0.091576213509771 };
-        quadrature_points_[4] = { 0.091576213509771, 0.816847572980459 };
-        quadrature_points_[5] = { 0.816847572980459, 0.091576213509771 };
-        break;
-
-      case 5:
-        weights_.resize(7);
-        quadrature_points_.resize(7);
-        weights_[0] = 0.225;
-        weights_[1] = weights_[2] = weights_[3] = 0.132394152788506;
-        weights_[4] = weights_[5] = weights_[6] = 0.125939180544827;
-        quadrature_points_[0] = { 1.0/3.0, 1.0/3.0 };
-        quadrature_points_[1] = { 0.470142064105115, 0.470142064105115 };
-        quadrature_points_[2] = { 0.470142064105115, 0.059715871789770 };
-        quadrature_points_[3] = { 0.059715871789770, 0.470142064105115 };
-        quadrature_points_[4] = { 0.101286507323456, 0.101286507323456 };
-        quadrature_points_[5] = { 0.101286507323456, 0.797426985353087 };
-        quadrature_points_[6] = { 0.797426985353087, 0.101286507323456 };
-        break;
-
+      case 1: CopyFromTable<1>(); break;
+      case 2: CopyFromTable<2>(); break;
+      case 3: CopyFromTable<3>(); break;
+      case 4: CopyFromTable<4>(); break;
+      case 5: CopyFromTable<5>(); break;
+      case 6: CopyFromTable<6>(); break;
       default:
         DRAKE_UNREACHABLE();
     }
   }
 
+  template <int order>
+  void CopyFromTable() {
+    using Table = GaussianTriangleQuadratureTable<order>;
+    weights_.assign(Table::kWeights.begin(), Table::kWeights.end());
+    quadrature_points_.resize(Table::kNumPoints);
+    for (int q = 0; q < Table::kNumPoints; ++q) {
+      quadrature_points_[q] = {Table::kB0[q], Table::kB1[q]};
+    }
+  }
+
   int do_order() const final { return order_; }
 
   const std::vector<double>& do_weights() const final {
@@ -1,6 +1,7 @@
 #include "drake/multibody/triangle_quadrature/triangle_quadrature.h"
 
 #include <algorithm>
+#include <cmath>
 #include <numeric>
 
 #include <gtest/gtest.h>
@@ -17,13 +18,14 @@ namespace {
 GTEST_TEST(TriangleQuadrature, GaussianQuadratureRuleThrowsAboveMaxOrder) {
   // TODO(edrumwri): Consider adding a max_order() method to the
   // TriangleQuadratureRule class (if more quadrature rules are added).
-  const int max_order = 5;
+  const int max_order = kMaxGaussianTriangleQuadratureOrder;
   DRAKE_EXPECT_THROWS_MESSAGE(GaussianTriangleQuadratureRule(max_order + 1),
-      ".*quadrature only supported up to fifth order.*");
+      ".*quadrature only supported up to sixth order.*");
 }
 
 GTEST_TEST(TriangleQuadrature, WeightsSumToUnity) {
-  for (int order = 1; order <= 5; ++order) {
+  for (int order = 1; order <= kMaxGaussianTriangleQuadratureOrder;
+       ++order) {
     GaussianTriangleQuadratureRule rule(order);
     const std::vector<double>& weights = rule.weights();
     const double sum = std::accumulate(weights.begin(), weights.end(), 0.0);
@@ -34,7 +36,8 @@ GTEST_TEST(TriangleQuadrature, WeightsSumToUnity) {
 }
 
 GTEST_TEST(TriangleQuadrature, BarycentricCoordsConsistent) {
-  for (int order = 1; order <= 5; ++order) {
+  for (int order = 1; order <= kMaxGaussianTriangleQuadratureOrder;
+       ++order) {
     GaussianTriangleQuadratureRule rule(order);
     const std::vector<Vector2d>& quadrature_points = rule.quadrature_points();
     for (const Vector2d& p : quadrature_points)
@@ -51,8 +54,9 @@ class UnityQuadratureTest : public ::testing::Test {
  public:
   void TestForUnityResultFromStartingOrder(
       const std::function<double(const Vector2d&)>& f, int starting_order) {
-    // Test Gaussian quadrature rules from starting_order through 5.
-    for (int order = starting_order; order <= 5; ++order) {
+    // Test Gaussian quadrature rules from starting_order through the maximum.
+    for (int order = starting_order;
+         order <= kMaxGaussianTriangleQuadratureOrder; ++order) {
       GaussianTriangleQuadratureRule rule(order);
 
       // Compute the integral over the unit triangle (0, 0), (1, 0), (0, 1).
@@ -175,6 +179,75 @@ TEST_F(UnityQuadratureTest, FifthOrder2) {
   TestForUnityResultFromStartingOrder(f, 5);
 }
 
+// Sixth-order analogues of the tests above.
+TEST_F(UnityQuadratureTest, SixthOrder1) {
+  // Function to be integrated: 56y⁶
+  auto f = [](const Vector2d& p) -> double {
+    return 56 * std::pow(p[1], 6);
+  };
+
+  TestForUnityResultFromStartingOrder(f, 6);
+}
+
+TEST_F(UnityQuadratureTest, SixthOrder2) {
+  // Function to be integrated: 336xy⁵
+  auto f = [](const Vector2d& p) -> double {
+    return 336 * p[0] * std::pow(p[1], 5);
+  };
+
+  TestForUnityResultFromStartingOrder(f, 6);
+}
+
+// Checks that the compile-time table of the given order matches the rule
+// and that IntegrateBatch() matches Integrate() triangle by triangle.
+template <int order>
+void CheckTableAndBatch() {
+  using Table = GaussianTriangleQuadratureTable<order>;
+  const GaussianTriangleQuadratureRule rule(order);
+  ASSERT_EQ(Table::kNumPoints, static_cast<int>(rule.weights().size()));
+  for (int q = 0; q < Table::kNumPoints; ++q) {
+    EXPECT_EQ(Table::kWeights[q], rule.weights()[q]);
+    EXPECT_EQ(Table::kB0[q], rule.quadrature_points()[q][0]);
+    EXPECT_EQ(Table::kB1[q], rule.quadrature_points()[q][1]);
+    EXPECT_EQ(Table::kB2[q], 1.0 - Table::kB0[q] - Table::kB1[q]);
+  }
+
+  // Integrate a polynomial of the rule's order whose coefficients differ per
+  // triangle, so that each triangle's integral is distinct.
+  const std::vector<double> areas{0.5, 0.25, 2.0};
+  auto f = [](int i, const Vector3<double>& p) -> Vector2d {
+    return Vector2d(1 + i * std::pow(p[0], order),
+                    p[1] * std::pow(p[2] + i, order - 1));
+  };
+  std::vector<Vector2d> integrals;
+  TriangleQuadrature<Vector2d, double>::IntegrateBatch<order>(f, areas,
+                                                              &integrals);
+  ASSERT_EQ(integrals.size(), areas.size());
+  for (int i = 0; i < static_cast<int>(areas.size()); ++i) {
+    const std::function<Vector2d(const Vector3<double>&)> fi =
+        [&f, i](const Vector3<double>& p) { return f(i, p); };
+    const Vector2d expected =
+        TriangleQuadrature<Vector2d, double>::Integrate(fi, rule, areas[i]);
+    EXPECT_EQ(integrals[i], expected) << "order " << order << ", i " << i;
+  }
+}
+
+GTEST_TEST(TriangleQuadrature, TablesAndBatchIntegration) {
+  CheckTableAndBatch<1>();
+  CheckTableAndBatch<2>();
+  CheckTableAndBatch<3>();
+  CheckTableAndBatch<4>();
+  CheckTableAndBatch<5>();
+  CheckTableAndBatch<6>();
+}
+
+GTEST_TEST(TriangleQuadrature, BatchIntegrationOfEmptyBatch) {
+  std::vector<double> integrals{1.0};
+  TriangleQuadrature<double, double>::IntegrateBatch<2>(
+      [](int, const Vector3<double>&) { return 1.0; }, {}, &integrals);
+  EXPECT_TRUE(integrals.empty());
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "drake/common/eigen_types.h"
+#include "drake/multibody/triangle_quadrature/gaussian_triangle_quadrature_rule.h"
 #include "drake/multibody/triangle_quadrature/triangle_quadrature_rule.h"
 
 namespace drake {
@@ -47,6 +48,25 @@ class TriangleQuadrature {
       const std::function<NumericReturnType(const Vector3<T>&)>& f,
       const TriangleQuadratureRule& rule,
       const T& area);
+
+  /// Numerically integrates a function over each triangle of a batch using
+  /// the Gaussian quadrature rule of the given order. Unlike Integrate(), the
+  /// rule's points and weights are the compile-time constants of
+  /// GaussianTriangleQuadratureTable and `f` is invoked directly rather than
+  /// through a std::function, so the evaluation can be inlined and the loop
+  /// over quadrature points unrolled.
+  /// @tparam order the order of the Gaussian rule, between 1 and
+  ///         kMaxGaussianTriangleQuadratureOrder.
+  /// @param f(i, p) a callable that returns a numerical value for point p in
+  ///        the domain of triangle i, where p is a Vector3<T> of barycentric
+  ///        coordinates (p[0], p[1], p[2]). It is invoked triangle by
+  ///        triangle, in the order of the rule's points within a triangle.
+  /// @param areas the areas of the triangles in the batch.
+  /// @param[out] integrals on return, holds the integral over each triangle;
+  ///             it is resized to match `areas`.
+  template <int order, typename Function>
+  static void IntegrateBatch(const Function& f, const std::vector<T>& areas,
+                             std::vector<NumericReturnType>* integrals);
 };
 
 template <typename NumericReturnType, typename T>
@@ -96,5 +116,30 @@ NumericReturnType TriangleQuadrature<NumericReturnType, T>::Integrate(
   return Integrate(fprime, rule, area);
 }
 
+template <typename NumericReturnType, typename T>
+template <int order, typename Function>
+void TriangleQuadrature<NumericReturnType, T>::IntegrateBatch(
+    const Function& f, const std::vector<T>& areas,
+    std::vector<NumericReturnType>* integrals) {
+  using Table = GaussianTriangleQuadratureTable<order>;
+  DRAKE_DEMAND(integrals != nullptr);
+  const int num_triangles = static_cast<int>(areas.size());
+  integrals->resize(num_triangles);
+
+  // As in Integrate(), the first term initializes the sum so that no
+  // knowledge of how to zero NumericReturnType is needed.
+  for (int i = 0; i < num_triangles; ++i) {
+    NumericReturnType integral =
+        f(i, Vector3<T>(Table::kB0[0], Table::kB1[0], Table::kB2[0])) *
+        Table::kWeights[0];
+    for (int q = 1; q < Table::kNumPoints; ++q) {
+      integral +=
+          f(i, Vector3<T>(Table::kB0[q], Table::kB1[q], Table::kB2[q])) *
+          Table::kWeights[q];
+    }
+    (*integrals)[i] = integral * areas[i];
+  }
+}
+
 }  // namespace multibody
 }  // namespace drake
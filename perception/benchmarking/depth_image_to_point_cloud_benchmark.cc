@@ -0,0 +1,111 @@
+#include <cmath>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/perception/depth_image_to_point_cloud.h"
+#include "drake/tools/performance/fixture_common.h"
+
+/* Benchmarks the conversion of VGA depth images into point clouds, as done for
+each camera tick by DepthImageToPointCloud. */
+
+namespace drake {
+namespace perception {
+namespace {
+
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth16U;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageRgba8U;
+using systems::sensors::PixelType;
+
+constexpr int kWidth = 640;
+constexpr int kHeight = 480;
+
+class DepthImageToPointCloudFixture : public benchmark::Fixture {
+ public:
+  DepthImageToPointCloudFixture() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+  // This apparently futile using statement works around "overloaded virtual"
+  // errors in g++. All of this is a consequence of the weird deprecation of
+  // const-ref State versions of SetUp() and TearDown() in benchmark.h.
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    const PixelType pixel_type =
+        state.range(0) == 0 ? PixelType::kDepth32F : PixelType::kDepth16U;
+    const bool with_pose = state.range(1) != 0;
+    const bool with_color = state.range(2) != 0;
+    const pc_flags::BaseFieldT fields =
+        with_color ? (pc_flags::kXYZs | pc_flags::kRGBs) : pc_flags::kXYZs;
+    dut_ = std::make_unique<DepthImageToPointCloud>(camera_info_, pixel_type,
+                                                    1.0f, fields);
+    context_ = dut_->CreateDefaultContext();
+
+    // A depth ramp across the image with some invalid pixels sprinkled in.
+    if (pixel_type == PixelType::kDepth32F) {
+      ImageDepth32F depth(kWidth, kHeight);
+      for (int v = 0; v < kHeight; ++v) {
+        for (int u = 0; u < kWidth; ++u) {
+          depth.at(u, v)[0] = (u % 97 == 0) ? 0.0f : 0.5f + 0.001f * u;
+        }
+      }
+      depth_port_value_ =
+          &dut_->depth_image_input_port().FixValue(context_.get(), depth);
+    } else {
+      ImageDepth16U depth(kWidth, kHeight);
+      for (int v = 0; v < kHeight; ++v) {
+        for (int u = 0; u < kWidth; ++u) {
+          depth.at(u, v)[0] = (u % 97 == 0) ? 0 : 500 + u;
+        }
+      }
+      depth_port_value_ =
+          &dut_->depth_image_input_port().FixValue(context_.get(), depth);
+    }
+    if (with_pose) {
+      dut_->camera_pose_input_port().FixValue(
+          context_.get(), RigidTransformd(RollPitchYawd(0.1, -0.2, 0.3),
+                                          Eigen::Vector3d(1.0, 2.0, 3.0)));
+    }
+    if (with_color) {
+      dut_->color_image_input_port().FixValue(context_.get(),
+                                              ImageRgba8U(kWidth, kHeight));
+    }
+  }
+
+  void Run(benchmark::State& state) {  // NOLINT(runtime/references)
+    const auto& output = dut_->point_cloud_output_port();
+    for (auto _ : state) {
+      // Invalidate the depth image so that every iteration converts it anew,
+      // just as a new image arrives with every camera tick.
+      depth_port_value_->GetMutableData();
+      benchmark::DoNotOptimize(output.Eval<PointCloud>(*context_));
+    }
+  }
+
+ protected:
+  const CameraInfo camera_info_{kWidth, kHeight, M_PI_4};
+  std::unique_ptr<DepthImageToPointCloud> dut_;
+  std::unique_ptr<systems::Context<double>> context_;
+  systems::FixedInputPortValue* depth_port_value_{};
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(DepthImageToPointCloudFixture, Convert)
+(benchmark::State& state) {
+  Run(state);
+}
+BENCHMARK_REGISTER_F(DepthImageToPointCloudFixture, Convert)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgsProduct({{0, 1},    // pixel type: 0 = 32F, 1 = 16U.
+                   {0, 1},    // camera pose: 0 = none, 1 = given.
+                   {0, 1}});  // color: 0 = none, 1 = given.
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
+
+BENCHMARK_MAIN();
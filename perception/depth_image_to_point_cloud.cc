@@ -42,12 +42,36 @@ const AbstractValue& GetModelValue(PixelType pixel_type) {
   throw std::logic_error("Unsupported pixel_type in DepthImageToPointCloud");
 }
 
+// Computes the unprojection factors of the camera's intrinsics for an image
+// of the given size: the pixel (u, v) with depth z unprojects to the point
+// (z⋅x_factors(u), z⋅y_factors(v), z) in the camera frame. The factors are
+// separable, so they are computed once per column and row rather than once per
+// pixel.
+void CalcUnprojectionFactors(const CameraInfo& camera_info, int width,
+                             int height, Eigen::VectorXf* x_factors,
+                             Eigen::VectorXf* y_factors) {
+  const float cx = camera_info.center_x();
+  const float cy = camera_info.center_y();
+  const float fx_inv = 1.f / camera_info.focal_x();
+  const float fy_inv = 1.f / camera_info.focal_y();
+  x_factors->resize(width);
+  for (int u = 0; u < width; ++u) {
+    (*x_factors)(u) = (u - cx) * fx_inv;
+  }
+  y_factors->resize(height);
+  for (int v = 0; v < height; ++v) {
+    (*y_factors)(v) = (v - cy) * fy_inv;
+  }
+}
+
 // TODO(russt): Consider dropping NaN/kTooClose/kTooFar points from the point
 // cloud output? (This would require adding support for colored point clouds,
 // because current implementation assume that an RGB image will still line up).
 template <PixelType pixel_type>
 void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
                const CameraInfo& camera_info,
+               const Eigen::VectorXf& cached_x_factors,
+               const Eigen::VectorXf& cached_y_factors,
                const RigidTransformd* const camera_pose,
                const Image<pixel_type>& depth_image,
                const ImageRgba8U* color_image, const float scale,
@@ -62,6 +86,7 @@ void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
     const bool skip_initialize = (output->fields().base_fields() == kXYZs);
     output->resize(depth_image.size(), skip_initialize);
   }
+  if (depth_image.size() == 0) return;
   Eigen::Ref<Matrix3Xf> output_xyz = output->mutable_xyzs();
   std::optional<Eigen::Ref<Matrix3X<uint8_t>>> output_rgb;
   if (color_image) {
@@ -70,30 +95,55 @@ void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
 
   const int height = depth_image.height();
   const int width = depth_image.width();
-  const float cx = camera_info.center_x();
-  const float cy = camera_info.center_y();
-  const float fx_inv = 1.f / camera_info.focal_x();
-  const float fy_inv = 1.f / camera_info.focal_y();
+  // Use the cached unprojection factors when they match the image size;
+  // otherwise compute them here.
+  Eigen::VectorXf computed_x_factors;
+  Eigen::VectorXf computed_y_factors;
+  const bool use_cached = (cached_x_factors.size() == width) &&
+                          (cached_y_factors.size() == height);
+  if (!use_cached) {
+    CalcUnprojectionFactors(camera_info, width, height, &computed_x_factors,
+                            &computed_y_factors);
+  }
+  const Eigen::VectorXf& x_factors =
+      use_cached ? cached_x_factors : computed_x_factors;
+  const Eigen::VectorXf& y_factors =
+      use_cached ? cached_y_factors : computed_y_factors;
   const math::RigidTransform<float> X_PC = (camera_pose != nullptr) ?
       camera_pose->cast<float>() : math::RigidTransform<float>::Identity();
 
+  // The depth pixels are walked in storage order with no per-pixel intrinsics
+  // arithmetic, and the transform is skipped entirely when there is no camera
+  // pose.
+  const auto* const depths = depth_image.at(0, 0);
   for (int v = 0; v < height; ++v) {
+    const float y_factor = y_factors(v);
     for (int u = 0; u < width; ++u) {
       const int col = v * width + u;
-      const auto z = depth_image.at(u, v)[0];
+      const auto z = depths[col];
       if ((z == ImageTraits<pixel_type>::kTooClose) ||
           (z == ImageTraits<pixel_type>::kTooFar)) {
         output_xyz.col(col).array() = std::numeric_limits<float>::infinity();
       } else {
         // N.B. This clause handles both true depths *and* NaNs.
-        output_xyz.col(col) =
-            X_PC * Vector3f(scale * z * (u - cx) * fx_inv,
-                            scale * z * (v - cy) * fy_inv,
-                            scale * z);
+        const float z_scaled = scale * z;
+        const Vector3f p_CP(z_scaled * x_factors(u), z_scaled * y_factor,
+                            z_scaled);
+        if (camera_pose != nullptr) {
+          output_xyz.col(col) = X_PC * p_CP;
+        } else {
+          output_xyz.col(col) = p_CP;
+        }
       }
-      if (color_image) {
+    }
+  }
+
+  if (color_image) {
+    for (int v = 0; v < height; ++v) {
+      for (int u = 0; u < width; ++u) {
         const auto color = color_image->at(u, v);
-        output_rgb->col(col) = Vector3<uint8_t>(color[0], color[1], color[2]);
+        output_rgb->col(v * width + u) =
+            Vector3<uint8_t>(color[0], color[1], color[2]);
       }
     }
   }
@@ -108,6 +158,9 @@ DepthImageToPointCloud::DepthImageToPointCloud(
       depth_pixel_type_(depth_pixel_type),
       scale_(scale),
       fields_(fields) {
+  CalcUnprojectionFactors(camera_info_, camera_info_.width(),
+                          camera_info_.height(), &x_factors_, &y_factors_);
+
   // Input port for depth image.
   depth_image_input_port_ =
       this->DeclareAbstractInputPort("depth_image",
@@ -138,7 +191,8 @@ void DepthImageToPointCloud::Convert(
     const systems::sensors::ImageDepth32F& depth_image,
     const std::optional<systems::sensors::ImageRgba8U>& color_image,
     const std::optional<float>& scale, PointCloud* output) {
-  DoConvert(std::nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
+  DoConvert(std::nullopt, camera_info, Eigen::VectorXf(), Eigen::VectorXf(),
+            camera_pose ? &*camera_pose : nullptr,
             depth_image, color_image ? &*color_image : nullptr,
             scale.value_or(1.0f), output);
 }
@@ -149,7 +203,8 @@ void DepthImageToPointCloud::Convert(
     const systems::sensors::ImageDepth16U& depth_image,
     const std::optional<systems::sensors::ImageRgba8U>& color_image,
     const std::optional<float>& scale, PointCloud* output) {
-  DoConvert(std::nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
+  DoConvert(std::nullopt, camera_info, Eigen::VectorXf(), Eigen::VectorXf(),
+            camera_pose ? &*camera_pose : nullptr,
             depth_image, color_image ? &*color_image : nullptr,
             scale.value_or(1.0f), output);
 }
@@ -163,8 +218,8 @@ void DepthImageToPointCloud::CalcOutput32F(
   const auto* const pose_or_null =
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
-  DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+  DoConvert(fields_, camera_info_, x_factors_, y_factors_, pose_or_null,
+            *depth_image, color_image_or_null, scale_, output);
 }
 
 void DepthImageToPointCloud::CalcOutput16U(
@@ -176,8 +231,8 @@ void DepthImageToPointCloud::CalcOutput16U(
   const auto* const pose_or_null =
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
-  DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+  DoConvert(fields_, camera_info_, x_factors_, y_factors_, pose_or_null,
+            *depth_image, color_image_or_null, scale_, output);
 }
 
 }  // namespace perception
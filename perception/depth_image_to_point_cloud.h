@@ -126,6 +126,11 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   const float scale_;
   const pc_flags::BaseFieldT fields_;
 
+  // The per-column and per-row unprojection factors for camera_info_,
+  // computed once at construction.
+  Eigen::VectorXf x_factors_;
+  Eigen::VectorXf y_factors_;
+
   systems::InputPortIndex depth_image_input_port_{};
   systems::InputPortIndex color_image_input_port_{};
   systems::InputPortIndex camera_pose_input_port_{};
@@ -1,11 +1,16 @@
 #include "drake/perception/point_cloud.h"
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/perception/point_cloud_kd_tree.h"
 
 using Eigen::Map;
 using Eigen::NoChange;
@@ -287,6 +292,193 @@ Eigen::Ref<MatrixX<D>> PointCloud::mutable_descriptors() {
   return storage_->descriptors();
 }
 
+namespace {
+
+// Returns a cloud with the same fields as `cloud`, holding copies of the points
+// with the given `indices`, in order.
+PointCloud SelectPoints(const PointCloud& cloud,
+                        const std::vector<int>& indices) {
+  const int new_size = static_cast<int>(indices.size());
+  PointCloud result(new_size, cloud.fields(), true /* skip_initialize */);
+  auto copy = [&indices, new_size](auto source, auto destination) {
+    for (int j = 0; j < new_size; ++j) {
+      destination.col(j) = source.col(indices[j]);
+    }
+  };
+  if (cloud.has_xyzs()) copy(cloud.xyzs(), result.mutable_xyzs());
+  if (cloud.has_normals()) copy(cloud.normals(), result.mutable_normals());
+  if (cloud.has_rgbs()) copy(cloud.rgbs(), result.mutable_rgbs());
+  if (cloud.has_descriptors()) {
+    copy(cloud.descriptors(), result.mutable_descriptors());
+  }
+  return result;
+}
+
+// The integer coordinates of a voxel in VoxelizedDownSample().
+struct VoxelKey {
+  bool operator==(const VoxelKey& other) const {
+    return x == other.x && y == other.y && z == other.z;
+  }
+
+  int64_t x{};
+  int64_t y{};
+  int64_t z{};
+};
+
+struct VoxelKeyHash {
+  size_t operator()(const VoxelKey& key) const {
+    // Mixes the coordinates with large primes (as in Teschner et al.,
+    // "Optimized Spatial Hashing for Collision Detection of Deformable
+    // Objects", 2003).
+    return static_cast<size_t>(key.x * 73856093) ^
+           static_cast<size_t>(key.y * 19349663) ^
+           static_cast<size_t>(key.z * 83492791);
+  }
+};
+
+}  // namespace
+
+PointCloud PointCloud::Crop(
+    const Eigen::Ref<const Vector3<T>>& lower_xyz,
+    const Eigen::Ref<const Vector3<T>>& upper_xyz) const {
+  DRAKE_DEMAND(has_xyzs());
+  if ((lower_xyz.array() > upper_xyz.array()).any()) {
+    throw std::runtime_error(
+        "Crop: lower_xyz must be less than or equal to upper_xyz in every "
+        "dimension");
+  }
+  Eigen::Ref<const Matrix3X<T>> xyz = xyzs();
+  std::vector<int> indices;
+  for (int i = 0; i < size(); ++i) {
+    if ((xyz.col(i).array() >= lower_xyz.array()).all() &&
+        (xyz.col(i).array() <= upper_xyz.array()).all()) {
+      indices.push_back(i);
+    }
+  }
+  return SelectPoints(*this, indices);
+}
+
+PointCloud PointCloud::VoxelizedDownSample(double voxel_size) const {
+  DRAKE_DEMAND(has_xyzs());
+  if (!(voxel_size > 0)) {
+    throw std::runtime_error(fmt::format(
+        "VoxelizedDownSample: voxel_size ({}) must be positive", voxel_size));
+  }
+
+  // Map each point to the index of its voxel; voxels are numbered in the order
+  // in which they are first encountered.
+  Eigen::Ref<const Matrix3X<T>> xyz = xyzs();
+  std::unordered_map<VoxelKey, int, VoxelKeyHash> voxel_indices;
+  std::vector<int> point_voxels(size(), -1);
+  for (int i = 0; i < size(); ++i) {
+    if (!xyz.col(i).allFinite()) continue;
+    const Eigen::Vector3d scaled = xyz.col(i).cast<double>() / voxel_size;
+    const VoxelKey key{static_cast<int64_t>(std::floor(scaled.x())),
+                       static_cast<int64_t>(std::floor(scaled.y())),
+                       static_cast<int64_t>(std::floor(scaled.z()))};
+    point_voxels[i] =
+        voxel_indices.emplace(key, static_cast<int>(voxel_indices.size()))
+            .first->second;
+  }
+
+  // Average each field over the points in each voxel. The sums are
+  // accumulated in double precision.
+  const int num_voxels = static_cast<int>(voxel_indices.size());
+  PointCloud result(num_voxels, fields(), true /* skip_initialize */);
+  auto average = [&point_voxels, num_voxels](const auto& source,
+                                              bool skip_non_finite) {
+    Eigen::MatrixXd sums = Eigen::MatrixXd::Zero(source.rows(), num_voxels);
+    Eigen::VectorXd counts = Eigen::VectorXd::Zero(num_voxels);
+    for (int i = 0; i < static_cast<int>(point_voxels.size()); ++i) {
+      const int voxel = point_voxels[i];
+      if (voxel < 0) continue;
+      const Eigen::VectorXd value = source.col(i).template cast<double>();
+      if (skip_non_finite && !value.allFinite()) continue;
+      sums.col(voxel) += value;
+      counts(voxel) += 1;
+    }
+    // Voxels with no contributing values average to NaN (0 / 0).
+    return Eigen::MatrixXd(sums.array().rowwise() /
+                           counts.transpose().array());
+  };
+  result.mutable_xyzs() = average(xyz, false).cast<T>();
+  if (has_normals()) {
+    Eigen::MatrixXd normals_average = average(normals(), true);
+    normals_average.colwise().normalize();
+    result.mutable_normals() = normals_average.cast<T>();
+  }
+  if (has_rgbs()) {
+    result.mutable_rgbs() =
+        average(rgbs(), false).array().round().cast<C>().matrix();
+  }
+  if (has_descriptors()) {
+    result.mutable_descriptors() = average(descriptors(), false).cast<D>();
+  }
+  return result;
+}
+
+bool PointCloud::EstimateNormals(double radius, int num_closest,
+                                 Parallelism parallelize) {
+  DRAKE_DEMAND(has_xyzs());
+  DRAKE_DEMAND(has_normals());
+  if (!(radius > 0)) {
+    throw std::runtime_error(fmt::format(
+        "EstimateNormals: radius ({}) must be positive", radius));
+  }
+  if (num_closest < 3) {
+    throw std::runtime_error(fmt::format(
+        "EstimateNormals: num_closest ({}) must be at least 3", num_closest));
+  }
+
+  Eigen::Ref<const Matrix3X<T>> xyz = xyzs();
+  Eigen::Ref<Matrix3X<T>> normal = mutable_normals();
+  const PointCloudKdTree tree(xyz);
+  const double radius_squared = radius * radius;
+  std::vector<std::vector<int>> neighbors(parallelize.num_threads());
+  // N.B. We use uint8_t rather than bool so that threads write to distinct
+  // memory locations.
+  std::vector<uint8_t> estimated(size(), 0);
+  StaticParallelForIndexLoop(
+      parallelize, 0, size(), [&](int thread_num, int i) {
+        normal.col(i).setConstant(kDefaultValue);
+        if (!xyz.col(i).allFinite()) return;
+        const Eigen::Vector3d p_i = xyz.col(i).cast<double>();
+
+        // The closest points are sorted by distance, so those within the
+        // radius are a prefix.
+        std::vector<int>& closest = neighbors[thread_num];
+        tree.FindNearest(xyz.col(i), num_closest, &closest);
+        int count = 0;
+        while (count < static_cast<int>(closest.size()) &&
+               (xyz.col(closest[count]).cast<double>() - p_i).squaredNorm() <=
+                   radius_squared) {
+          ++count;
+        }
+        if (count < 3) return;
+
+        Eigen::Vector3d mean = Eigen::Vector3d::Zero();
+        for (int j = 0; j < count; ++j) {
+          mean += xyz.col(closest[j]).cast<double>();
+        }
+        mean /= count;
+        Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+        for (int j = 0; j < count; ++j) {
+          const Eigen::Vector3d offset =
+              xyz.col(closest[j]).cast<double>() - mean;
+          covariance += offset * offset.transpose();
+        }
+        // The eigenvalues are sorted in increasing order.
+        const Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(
+            covariance);
+        Eigen::Vector3d n = solver.eigenvectors().col(0);
+        if (n.dot(p_i) > 0) n = -n;
+        normal.col(i) = n.cast<T>();
+        estimated[i] = 1;
+      });
+  return std::all_of(estimated.begin(), estimated.end(),
+                     [](uint8_t value) { return value != 0; });
+}
+
 bool PointCloud::HasFields(
     pc_flags::Fields fields_in) const {
   DRAKE_DEMAND(!fields_in.contains(pc_flags::kInherit));
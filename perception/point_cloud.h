@@ -10,6 +10,7 @@
 #include <Eigen/Dense>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/perception/point_cloud_flags.h"
 
 namespace drake {
@@ -276,6 +277,48 @@ class PointCloud final {
 
   /// @}
 
+  /// @name Point Cloud Processing
+  /// @{
+
+  /// Returns a new point cloud containing only the points in this cloud whose
+  /// xyz values lie within the axis-aligned box [`lower_xyz`, `upper_xyz`]
+  /// (inclusive), in their original order. All fields are copied.
+  /// @pre `has_xyzs()` must be true.
+  /// @throws std::exception if lower_xyz(i) > upper_xyz(i) for any i.
+  PointCloud Crop(const Eigen::Ref<const Vector3<T>>& lower_xyz,
+                  const Eigen::Ref<const Vector3<T>>& upper_xyz) const;
+
+  /// Returns a down-sampled point cloud by grouping all xyzs in this cloud
+  /// into a 3D grid of cubic voxels with side length `voxel_size`, and
+  /// replacing the points within each voxel by a single point at their
+  /// centroid. Normals (re-normalized), rgbs, and descriptors are likewise
+  /// averaged over the points in each voxel. Points with non-finite xyz
+  /// values are discarded. The voxels appear in the result in the order in
+  /// which their first points appear in this cloud.
+  /// @pre `has_xyzs()` must be true.
+  /// @throws std::exception if voxel_size <= 0.
+  PointCloud VoxelizedDownSample(double voxel_size) const;
+
+  /// Estimates the normal of each point from the covariance of its neighbors:
+  /// the (at most) `num_closest` points within distance `radius` of it,
+  /// including itself. The normal is the direction of least variance, oriented
+  /// to point towards the origin of the frame in which the xyzs are expressed
+  /// (e.g., towards the camera that captured the cloud). Neighbor searches use
+  /// a PointCloudKdTree over this cloud.
+  ///
+  /// Points with fewer than three neighbors (including points whose xyzs are
+  /// non-finite) have their normals set to NaN.
+  ///
+  /// @param parallelize Degree of parallelism; the result is the same
+  ///    regardless of the degree chosen.
+  /// @returns true if a normal was estimated for every point.
+  /// @pre `has_xyzs()` and `has_normals()` must be true.
+  /// @throws std::exception if radius <= 0 or num_closest < 3.
+  bool EstimateNormals(double radius, int num_closest,
+                       Parallelism parallelize = false);
+
+  /// @}
+
   /// @name Fields
   /// @{
 
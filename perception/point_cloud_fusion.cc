@@ -0,0 +1,243 @@
+#include "drake/perception/point_cloud_fusion.h"
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace perception {
+
+using math::RigidTransformd;
+using systems::Context;
+using systems::ValueProducer;
+
+namespace {
+
+// The integer coordinates of a voxel.
+struct VoxelKey {
+  bool operator==(const VoxelKey& other) const {
+    return x == other.x && y == other.y && z == other.z;
+  }
+
+  int64_t x{};
+  int64_t y{};
+  int64_t z{};
+};
+
+struct VoxelKeyHash {
+  size_t operator()(const VoxelKey& key) const {
+    // Mixes the coordinates with large primes (as in Teschner et al.,
+    // "Optimized Spatial Hashing for Collision Detection of Deformable
+    // Objects", 2003).
+    return static_cast<size_t>(key.x * 73856093) ^
+           static_cast<size_t>(key.y * 19349663) ^
+           static_cast<size_t>(key.z * 83492791);
+  }
+};
+
+// The sums of the field values of the points in a voxel.
+struct VoxelSums {
+  void Add(const VoxelSums& other) {
+    xyz += other.xyz;
+    normal += other.normal;
+    rgb += other.rgb;
+    count += other.count;
+    normal_count += other.normal_count;
+  }
+
+  Eigen::Vector3d xyz{Eigen::Vector3d::Zero()};
+  Eigen::Vector3d normal{Eigen::Vector3d::Zero()};
+  Eigen::Vector3d rgb{Eigen::Vector3d::Zero()};
+  int count{0};
+  // Non-finite normals are excluded from the sum; this counts the rest.
+  int normal_count{0};
+};
+
+// The occupied voxels of a set of points, in the order in which they were
+// first occupied. Clearing the grid retains its allocated storage.
+struct VoxelGrid {
+  void Clear() {
+    index.clear();
+    keys.clear();
+    sums.clear();
+  }
+
+  VoxelSums& Get(const VoxelKey& key) {
+    const auto [iter, inserted] =
+        index.emplace(key, static_cast<int>(keys.size()));
+    if (inserted) {
+      keys.push_back(key);
+      sums.emplace_back();
+    }
+    return sums[iter->second];
+  }
+
+  std::unordered_map<VoxelKey, int, VoxelKeyHash> index;
+  std::vector<VoxelKey> keys;
+  std::vector<VoxelSums> sums;
+};
+
+}  // namespace
+
+struct PointCloudFusion::Scratch {
+  // The voxels of each input cloud, computed independently (and in parallel).
+  std::vector<VoxelGrid> cloud_grids;
+  // The union of the input clouds' voxels.
+  VoxelGrid fused;
+};
+
+PointCloudFusion::PointCloudFusion(int num_clouds, double voxel_size,
+                                   const Eigen::Vector3f& lower_xyz,
+                                   const Eigen::Vector3f& upper_xyz,
+                                   pc_flags::BaseFieldT fields,
+                                   Parallelism parallelize)
+    : voxel_size_(voxel_size),
+      lower_xyz_(lower_xyz),
+      upper_xyz_(upper_xyz),
+      fields_(fields),
+      parallelize_(parallelize) {
+  DRAKE_THROW_UNLESS(num_clouds >= 1);
+  DRAKE_THROW_UNLESS(voxel_size > 0);
+  DRAKE_THROW_UNLESS((lower_xyz.array() <= upper_xyz.array()).all());
+  DRAKE_THROW_UNLESS((fields & pc_flags::kXYZs) != 0);
+  DRAKE_THROW_UNLESS(
+      (fields & ~(pc_flags::kXYZs | pc_flags::kNormals | pc_flags::kRGBs)) ==
+      0);
+
+  for (int i = 0; i < num_clouds; ++i) {
+    cloud_ports_.push_back(
+        this->DeclareAbstractInputPort(fmt::format("point_cloud_{}", i),
+                                       Value<PointCloud>())
+            .get_index());
+    pose_ports_.push_back(
+        this->DeclareAbstractInputPort(fmt::format("camera_pose_{}", i),
+                                       Value<RigidTransformd>{})
+            .get_index());
+  }
+
+  // This cache entry only provides storage that is reused by CalcOutput(); it
+  // invokes no invalidation support from the cache system.
+  Scratch scratch;
+  scratch.cloud_grids.resize(num_clouds);
+  scratch_cache_index_ =
+      this->DeclareCacheEntry(
+              "scratch", ValueProducer(scratch, &ValueProducer::NoopCalc),
+              {this->nothing_ticket()})
+          .cache_index();
+
+  this->DeclareAbstractOutputPort("point_cloud", PointCloud{0, fields},
+                                  &PointCloudFusion::CalcOutput);
+}
+
+PointCloudFusion::~PointCloudFusion() = default;
+
+void PointCloudFusion::CalcOutput(const Context<double>& context,
+                                  PointCloud* output) const {
+  const bool has_normals = (fields_ & pc_flags::kNormals) != 0;
+  const bool has_rgbs = (fields_ & pc_flags::kRGBs) != 0;
+
+  // Input evaluation isn't thread-safe, so all inputs are gathered up front.
+  std::vector<const PointCloud*> clouds(num_clouds());
+  std::vector<const RigidTransformd*> poses(num_clouds());
+  for (int i = 0; i < num_clouds(); ++i) {
+    clouds[i] = this->EvalInputValue<PointCloud>(context, cloud_ports_[i]);
+    if (clouds[i] == nullptr) {
+      throw std::logic_error(fmt::format(
+          "PointCloudFusion: input port point_cloud_{} is not connected", i));
+    }
+    clouds[i]->RequireFields(fields_);
+    poses[i] = this->EvalInputValue<RigidTransformd>(context, pose_ports_[i]);
+  }
+
+  Scratch& scratch =
+      this->get_cache_entry(scratch_cache_index_)
+          .get_mutable_cache_entry_value(context)
+          .GetMutableValueOrThrow<Scratch>();
+
+  // Voxelize each cloud independently.
+  const double voxel_size = voxel_size_;
+  StaticParallelForIndexLoop(
+      parallelize_, 0, num_clouds(), [&](int, int i) {
+        const PointCloud& cloud = *clouds[i];
+        const math::RigidTransform<float> X_WC =
+            poses[i] != nullptr ? poses[i]->cast<float>()
+                                : math::RigidTransform<float>::Identity();
+        VoxelGrid& grid = scratch.cloud_grids[i];
+        grid.Clear();
+        Eigen::Ref<const Matrix3X<float>> xyzs = cloud.xyzs();
+        for (int j = 0; j < cloud.size(); ++j) {
+          if (!xyzs.col(j).allFinite()) continue;
+          const Eigen::Vector3f p_WP = X_WC * xyzs.col(j);
+          if ((p_WP.array() < lower_xyz_.array()).any() ||
+              (p_WP.array() > upper_xyz_.array()).any()) {
+            continue;
+          }
+          const Eigen::Vector3d scaled = p_WP.cast<double>() / voxel_size;
+          VoxelSums& sums =
+              grid.Get(VoxelKey{static_cast<int64_t>(std::floor(scaled.x())),
+                                static_cast<int64_t>(std::floor(scaled.y())),
+                                static_cast<int64_t>(std::floor(scaled.z()))});
+          sums.xyz += p_WP.cast<double>();
+          ++sums.count;
+          if (has_normals) {
+            const Eigen::Vector3f n_W = X_WC.rotation() * cloud.normal(j);
+            if (n_W.allFinite()) {
+              sums.normal += n_W.cast<double>();
+              ++sums.normal_count;
+            }
+          }
+          if (has_rgbs) {
+            sums.rgb += cloud.rgbs().col(j).cast<double>();
+          }
+        }
+      });
+
+  // Merge the clouds' voxels in cloud order, so that the result doesn't
+  // depend on the degree of parallelism.
+  VoxelGrid& fused = scratch.fused;
+  fused.Clear();
+  for (const VoxelGrid& grid : scratch.cloud_grids) {
+    for (int v = 0; v < static_cast<int>(grid.keys.size()); ++v) {
+      fused.Get(grid.keys[v]).Add(grid.sums[v]);
+    }
+  }
+
+  const int num_voxels = static_cast<int>(fused.keys.size());
+  if (output->size() != num_voxels) {
+    output->resize(num_voxels, true /* skip_initialize */);
+  }
+  Eigen::Ref<Matrix3X<float>> output_xyzs = output->mutable_xyzs();
+  for (int v = 0; v < num_voxels; ++v) {
+    const VoxelSums& sums = fused.sums[v];
+    output_xyzs.col(v) = (sums.xyz / sums.count).cast<float>();
+  }
+  if (has_normals) {
+    Eigen::Ref<Matrix3X<float>> output_normals = output->mutable_normals();
+    for (int v = 0; v < num_voxels; ++v) {
+      const VoxelSums& sums = fused.sums[v];
+      // Voxels with no finite normals (and normals that cancel out) produce
+      // NaN normals.
+      output_normals.col(v) = sums.normal.normalized().cast<float>();
+      if (sums.normal_count == 0 || sums.normal.norm() == 0) {
+        output_normals.col(v).setConstant(PointCloud::kDefaultValue);
+      }
+    }
+  }
+  if (has_rgbs) {
+    Eigen::Ref<Matrix3X<uint8_t>> output_rgbs = output->mutable_rgbs();
+    for (int v = 0; v < num_voxels; ++v) {
+      const VoxelSums& sums = fused.sums[v];
+      output_rgbs.col(v) =
+          (sums.rgb / sums.count).array().round().cast<uint8_t>().matrix();
+    }
+  }
+}
+
+}  // namespace perception
+}  // namespace drake
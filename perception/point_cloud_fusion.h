@@ -0,0 +1,119 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace perception {
+
+/// Fuses several point clouds (e.g., from multiple DepthImageToPointCloud
+/// systems) into a single, down-sampled point cloud in the world frame.
+///
+/// @system
+/// name: PointCloudFusion
+/// input_ports:
+/// - point_cloud_0
+/// - camera_pose_0 (optional)
+/// - ...
+/// - point_cloud_N-1
+/// - camera_pose_N-1 (optional)
+/// output_ports:
+/// - point_cloud
+/// @endsystem
+///
+/// Each input cloud i is expressed in its camera frame Cᵢ, and is posed in
+/// the world by the corresponding camera_pose input, X_WCᵢ, as a
+/// RigidTransformd. If a camera_pose input is not connected, its cloud is
+/// taken to already be expressed in the world frame.
+///
+/// In a single pass over the input points, each finite point is transformed
+/// into the world frame, discarded if it lies outside of the crop box
+/// [`lower_xyz`, `upper_xyz`], and accumulated into its cubic voxel of side
+/// length `voxel_size`. The output holds one point per occupied voxel, at the
+/// centroid of the points in it, with averaged colors and (re-normalized)
+/// normals when those fields are requested; this is equivalent to concatenating
+/// the transformed, cropped clouds and calling
+/// PointCloud::VoxelizedDownSample() (up to floating-point round-off and point
+/// order). The input clouds are processed in parallel (see `parallelize`);
+/// the output is the same regardless of the degree of parallelism. All
+/// intermediate storage is retained in the Context and reused across
+/// evaluations.
+///
+/// @ingroup perception_systems
+class PointCloudFusion final : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PointCloudFusion)
+
+  /// Constructs the fusion system.
+  ///
+  /// @param[in] num_clouds The number of input clouds.
+  /// @param[in] voxel_size The side length of the voxels used to merge points.
+  /// @param[in] lower_xyz The lower corner of the crop box, in the world
+  ///   frame.
+  /// @param[in] upper_xyz The upper corner of the crop box, in the world
+  ///   frame.
+  /// @param[in] fields The fields of the output cloud; every input cloud must
+  ///   provide these fields. Only kXYZs, kNormals, and kRGBs are supported, and
+  ///   kXYZs is required.
+  /// @param[in] parallelize The degree of parallelism across input clouds.
+  /// @throws std::exception if num_clouds < 1, voxel_size <= 0,
+  ///   lower_xyz(i) > upper_xyz(i) for any i, or `fields` is unsupported.
+  PointCloudFusion(
+      int num_clouds, double voxel_size,
+      const Eigen::Vector3f& lower_xyz = Eigen::Vector3f::Constant(
+          -std::numeric_limits<float>::infinity()),
+      const Eigen::Vector3f& upper_xyz = Eigen::Vector3f::Constant(
+          std::numeric_limits<float>::infinity()),
+      pc_flags::BaseFieldT fields = pc_flags::kXYZs,
+      Parallelism parallelize = false);
+
+  ~PointCloudFusion() final;
+
+  /// Returns the number of input clouds.
+  int num_clouds() const { return static_cast<int>(cloud_ports_.size()); }
+
+  /// Returns the abstract valued input port that expects the i'th PointCloud.
+  const systems::InputPort<double>& point_cloud_input_port(int i) const {
+    return this->get_input_port(cloud_ports_.at(i));
+  }
+
+  /// Returns the abstract valued input port that expects the pose of the i'th
+  /// cloud's frame in the world, X_WCᵢ, as a RigidTransformd. (This input port
+  /// does not necessarily need to be connected; refer to the class overview
+  /// for details.)
+  const systems::InputPort<double>& camera_pose_input_port(int i) const {
+    return this->get_input_port(pose_ports_.at(i));
+  }
+
+  /// Returns the abstract valued output port that provides the fused
+  /// PointCloud.
+  const systems::OutputPort<double>& point_cloud_output_port() const {
+    return LeafSystem<double>::get_output_port(0);
+  }
+
+ private:
+  // The per-evaluation storage that is reused across evaluations; defined in
+  // the .cc file.
+  struct Scratch;
+
+  void CalcOutput(const systems::Context<double>& context,
+                  PointCloud* output) const;
+
+  const double voxel_size_;
+  const Eigen::Vector3f lower_xyz_;
+  const Eigen::Vector3f upper_xyz_;
+  const pc_flags::BaseFieldT fields_;
+  const Parallelism parallelize_;
+
+  std::vector<systems::InputPortIndex> cloud_ports_;
+  std::vector<systems::InputPortIndex> pose_ports_;
+  systems::CacheIndex scratch_cache_index_{};
+};
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,150 @@
+#include "drake/perception/point_cloud_kd_tree.h"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+// The maximum number of points in a leaf of the tree.
+constexpr int kMaxLeafSize = 8;
+
+}  // namespace
+
+PointCloudKdTree::PointCloudKdTree(
+    const Eigen::Ref<const Matrix3X<float>>& xyzs)
+    : xyzs_(xyzs) {
+  ordered_indices_.reserve(xyzs_.cols());
+  for (int i = 0; i < xyzs_.cols(); ++i) {
+    if (xyzs_.col(i).allFinite()) ordered_indices_.push_back(i);
+  }
+  if (!ordered_indices_.empty()) {
+    Build(0, static_cast<int>(ordered_indices_.size()));
+  }
+}
+
+int PointCloudKdTree::Build(int begin, int end) {
+  const int index = static_cast<int>(nodes_.size());
+  nodes_.emplace_back();
+  nodes_[index].begin = begin;
+  nodes_[index].end = end;
+  if (end - begin <= kMaxLeafSize) return index;
+
+  // Split at the median along the axis of greatest extent.
+  Vector3<float> lower = Vector3<float>::Constant(
+      std::numeric_limits<float>::infinity());
+  Vector3<float> upper = -lower;
+  for (int i = begin; i < end; ++i) {
+    lower = lower.cwiseMin(xyzs_.col(ordered_indices_[i]));
+    upper = upper.cwiseMax(xyzs_.col(ordered_indices_[i]));
+  }
+  int axis = 0;
+  (upper - lower).maxCoeff(&axis);
+  const int mid = begin + (end - begin) / 2;
+  std::nth_element(ordered_indices_.begin() + begin,
+                   ordered_indices_.begin() + mid,
+                   ordered_indices_.begin() + end,
+                   [this, axis](int a, int b) {
+                     return xyzs_(axis, a) < xyzs_(axis, b);
+                   });
+  const float split = xyzs_(axis, ordered_indices_[mid]);
+  // Note: nodes_ may reallocate during the recursion, so we can't hold a
+  // reference into it.
+  const int left = Build(begin, mid);
+  const int right = Build(mid, end);
+  nodes_[index].axis = axis;
+  nodes_[index].split = split;
+  nodes_[index].left = left;
+  nodes_[index].right = right;
+  return index;
+}
+
+void PointCloudKdTree::FindInRadius(const Eigen::Ref<const Vector3<float>>& p,
+                                    double radius,
+                                    std::vector<int>* indices) const {
+  DRAKE_DEMAND(indices != nullptr);
+  DRAKE_DEMAND(radius >= 0);
+  indices->clear();
+  if (nodes_.empty()) return;
+
+  const double radius_squared = radius * radius;
+  std::vector<int> stack{0};
+  while (!stack.empty()) {
+    const Node& node = nodes_[stack.back()];
+    stack.pop_back();
+    if (node.left < 0) {
+      for (int i = node.begin; i < node.end; ++i) {
+        const int point = ordered_indices_[i];
+        if ((xyzs_.col(point) - p).squaredNorm() <= radius_squared) {
+          indices->push_back(point);
+        }
+      }
+      continue;
+    }
+    const double offset = p(node.axis) - node.split;
+    if (offset <= radius) stack.push_back(node.left);
+    if (offset >= -radius) stack.push_back(node.right);
+  }
+}
+
+void PointCloudKdTree::FindNearest(const Eigen::Ref<const Vector3<float>>& p,
+                                   int k, std::vector<int>* indices) const {
+  DRAKE_DEMAND(indices != nullptr);
+  DRAKE_DEMAND(k >= 0);
+  indices->clear();
+  if (nodes_.empty() || k == 0) return;
+
+  // A max-heap of the (squared distance, index) pairs of the k closest points
+  // found so far; its top is the farthest of them.
+  std::priority_queue<std::pair<double, int>> closest;
+  auto worst_squared = [&closest, k]() {
+    return static_cast<int>(closest.size()) < k
+               ? std::numeric_limits<double>::infinity()
+               : closest.top().first;
+  };
+
+  // Depth-first traversal, visiting the child containing p first; a far child
+  // is skipped when its splitting plane is farther than the current k-th
+  // closest point. Each stack entry holds a node and the squared distance
+  // from p to the splitting plane that must be crossed to reach it.
+  std::vector<std::pair<int, double>> stack{{0, 0.0}};
+  while (!stack.empty()) {
+    const auto [node_index, plane_squared] = stack.back();
+    stack.pop_back();
+    if (plane_squared > worst_squared()) continue;
+    const Node& node = nodes_[node_index];
+    if (node.left < 0) {
+      for (int i = node.begin; i < node.end; ++i) {
+        const int point = ordered_indices_[i];
+        const double distance_squared = (xyzs_.col(point) - p).squaredNorm();
+        if (static_cast<int>(closest.size()) < k) {
+          closest.emplace(distance_squared, point);
+        } else if (distance_squared < closest.top().first) {
+          closest.pop();
+          closest.emplace(distance_squared, point);
+        }
+      }
+      continue;
+    }
+    const double offset = p(node.axis) - node.split;
+    const int near = offset <= 0 ? node.left : node.right;
+    const int far = offset <= 0 ? node.right : node.left;
+    // The near child is pushed last so that it is visited first.
+    stack.emplace_back(far, offset * offset);
+    stack.emplace_back(near, 0.0);
+  }
+
+  indices->resize(closest.size());
+  for (int i = static_cast<int>(closest.size()) - 1; i >= 0; --i) {
+    (*indices)[i] = closest.top().second;
+    closest.pop();
+  }
+}
+
+}  // namespace perception
+}  // namespace drake
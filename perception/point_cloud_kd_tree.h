@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace perception {
+
+/// A k-d tree over a set of 3D points (e.g., the xyzs() of a PointCloud) that
+/// answers radius and k-nearest-neighbor queries in logarithmic (rather than
+/// linear) time in the number of points.
+///
+/// The tree stores a copy of the points, so it remains valid after the source
+/// cloud is mutated or destroyed (though it then no longer reflects it).
+/// Points with non-finite coordinates are not indexed and are never reported
+/// by a query. All queries are thread-safe.
+class PointCloudKdTree final {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(PointCloudKdTree)
+
+  /// Builds the tree over the columns of `xyzs`. Query results are reported
+  /// as column indices into `xyzs`.
+  explicit PointCloudKdTree(const Eigen::Ref<const Matrix3X<float>>& xyzs);
+
+  /// Returns the number of indexed (i.e., finite) points.
+  int size() const { return static_cast<int>(ordered_indices_.size()); }
+
+  /// Writes into `indices` (replacing its contents) the indices of all points
+  /// within `radius` of the query point `p` (inclusive), in no particular
+  /// order.
+  /// @pre `indices` is not null and `radius` is non-negative.
+  void FindInRadius(const Eigen::Ref<const Vector3<float>>& p, double radius,
+                    std::vector<int>* indices) const;
+
+  /// Writes into `indices` (replacing its contents) the indices of the
+  /// min(k, size()) points closest to the query point `p`, ordered by
+  /// increasing distance. Ties are broken arbitrarily.
+  /// @pre `indices` is not null and `k` is non-negative.
+  void FindNearest(const Eigen::Ref<const Vector3<float>>& p, int k,
+                   std::vector<int>* indices) const;
+
+ private:
+  // A node of the tree. An interior node splits its points on `axis` at
+  // `split` (left: ≤ split, right: ≥ split); a leaf owns the points
+  // ordered_indices_[begin, end).
+  struct Node {
+    int begin{0};
+    int end{0};
+    int axis{-1};
+    float split{0};
+    int left{-1};
+    int right{-1};
+  };
+
+  // Builds the subtree over ordered_indices_[begin, end) and returns its
+  // index in nodes_.
+  int Build(int begin, int end);
+
+  Matrix3X<float> xyzs_;
+  std::vector<int> ordered_indices_;
+  std::vector<Node> nodes_;
+};
+
+}  // namespace perception
+}  // namespace drake
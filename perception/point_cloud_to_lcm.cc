@@ -1,13 +1,17 @@
 #include "drake/perception/point_cloud_to_lcm.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstring>
+#include <limits>
 #include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <zlib.h>
 
 #include "drake/common/drake_throw.h"
-#include "drake/lcmt_point_cloud.hpp"
-#include "drake/perception/point_cloud.h"
 
 // TODO(jwnimmer-tri) Additional enhancements we could consider here:
 //
@@ -26,10 +30,21 @@ namespace drake {
 namespace perception {
 namespace {
 
-// Populates `message` using the given time, frame_name, and point cloud data.
-// (This is the implementation function for our system's output port.)
-void Calc(double time, const std::string& frame_name, const PointCloud& cloud,
-          lcmt_point_cloud* message) {
+using Encoding = PointCloudToLcm::Encoding;
+
+// The size of the bounding box that prefixes quantized data.
+constexpr int kBoxSize = 6 * sizeof(float);
+
+// The largest quantized coordinate.
+constexpr float kQuantizedMax = std::numeric_limits<uint16_t>::max();
+
+// Populates `message` using the given time, frame_name, encoding, and point
+// cloud data. When the encoding is kCompact, the uncompressed data is staged
+// in `scratch`. (This is the implementation function for our system's output
+// port.)
+void Calc(double time, const std::string& frame_name, Encoding encoding,
+          const PointCloud& cloud, lcmt_point_cloud* message,
+          std::vector<uint8_t>* scratch) {
   // A best practice for filling in LCM messages is to first value-initialize
   // the entire message to its defaults ("*message = {}") before setting any
   // new values.  That way, if we accidentally skip over any fields, they will
@@ -37,12 +52,17 @@ void Calc(double time, const std::string& frame_name, const PointCloud& cloud,
   // happened to contain beforehand.  In our case though, point cloud data is
   // typically high-bandwidth, so we'll carefully work to reuse our message's
   // storage instead of recreating it on every call.
+  const bool compact = (encoding == Encoding::kCompact);
 
   // Fill in the basic header info.
   message->utime = static_cast<int64_t>(time * 1e6);
   message->frame_name = frame_name;
   message->height = 1;
   message->flags = lcmt_point_cloud::IS_STRICTLY_FINITE;
+  if (compact) {
+    message->flags |= lcmt_point_cloud::IS_QUANTIZED;
+    message->flags |= lcmt_point_cloud::IS_ZLIB_COMPRESSED;
+  }
 
   // Fill in the field metadata.
   // http://wiki.ros.org/pcl/Overview#Common_PointCloud2_field_names
@@ -59,6 +79,8 @@ void Calc(double time, const std::string& frame_name, const PointCloud& cloud,
     int current_field = 0;
     int current_offset = 0;
     if (has_xyzs) {
+      // The compact encoding quantizes xyz to two bytes each.
+      const int size = compact ? 2 : 4;
       for (int i = 0; i < 3; ++i) {
         auto& field = message->fields[current_field];
         switch (i) {
@@ -67,10 +89,11 @@ void Calc(double time, const std::string& frame_name, const PointCloud& cloud,
           case 2: { field.name = "z"; break; }
         }
         field.byte_offset = current_offset;
-        field.datatype = lcmt_point_cloud_field::FLOAT32;
+        field.datatype = compact ? lcmt_point_cloud_field::UINT16
+                                 : lcmt_point_cloud_field::FLOAT32;
         field.count = 1;
         current_field += 1;
-        current_offset += 4;
+        current_offset += size;
       }
     }
     if (has_rgbs) {
@@ -127,26 +150,73 @@ void Calc(double time, const std::string& frame_name, const PointCloud& cloud,
   const Eigen::Ref<const Matrix3X<float>> normals =
       has_normals ? cloud.normals() :
       Eigen::Ref<const Matrix3X<float>>(empty_float);
-
-  // Resize our message storage large enough to hold all points, assuming they
-  // will all be finite.  If some were non-finite, we'll shrink it down later.
   const int num_points = cloud.size();
-  message->data.resize(static_cast<int64_t>(num_points) * point_step);
+  auto is_finite = [&xyzs](int i) {
+    return std::isfinite(xyzs(0, i)) && std::isfinite(xyzs(1, i)) &&
+           std::isfinite(xyzs(2, i));
+  };
+
+  // For the compact encoding, find the bounding box of the finite points; the
+  // box of an empty cloud is all zeros.
+  Eigen::Vector3f box_min = Eigen::Vector3f::Zero();
+  Eigen::Vector3f box_max = Eigen::Vector3f::Zero();
+  Eigen::Vector3f box_scale = Eigen::Vector3f::Zero();
+  if (compact && has_xyzs) {
+    bool empty = true;
+    for (int i = 0; i < num_points; ++i) {
+      if (!is_finite(i)) {
+        continue;
+      }
+      if (empty) {
+        box_min = box_max = xyzs.col(i);
+        empty = false;
+      } else {
+        box_min = box_min.cwiseMin(xyzs.col(i));
+        box_max = box_max.cwiseMax(xyzs.col(i));
+      }
+    }
+    for (int k = 0; k < 3; ++k) {
+      const float extent = box_max[k] - box_min[k];
+      box_scale[k] = (extent > 0) ? (kQuantizedMax / extent) : 0.0f;
+    }
+  }
+
+  // Resize our storage large enough to hold all points, assuming they will
+  // all be finite.  If some were non-finite, we'll shrink it down later.  The
+  // compact encoding stages its (uncompressed) data in the scratch buffer,
+  // after the bounding box.
+  std::vector<uint8_t>& raw = compact ? *scratch : message->data;
+  const int header_size = compact ? kBoxSize : 0;
+  raw.resize(header_size + static_cast<int64_t>(num_points) * point_step);
+  if (compact) {
+    std::memcpy(raw.data(), box_min.data(), 3 * sizeof(float));
+    std::memcpy(raw.data() + 3 * sizeof(float), box_max.data(),
+                3 * sizeof(float));
+  }
 
   // Copy the cloud's data into the message.
   int64_t num_finite_points = 0;
-  uint8_t* cursor = message->data.data();
+  uint8_t* const begin = raw.data() + header_size;
+  uint8_t* cursor = begin;
   for (int i = 0; i < num_points; ++i) {
     if (has_xyzs) {
-      const float x = xyzs(0, i);
-      const float y = xyzs(1, i);
-      const float z = xyzs(2, i);
-      if (!(std::isfinite(x) && std::isfinite(y) && std::isfinite(z))) {
+      if (!is_finite(i)) {
         continue;
       }
-      std::memcpy(cursor, &x, 4); cursor += 4;
-      std::memcpy(cursor, &y, 4); cursor += 4;
-      std::memcpy(cursor, &z, 4); cursor += 4;
+      if (compact) {
+        for (int k = 0; k < 3; ++k) {
+          const uint16_t q = static_cast<uint16_t>(std::lround(
+              (xyzs(k, i) - box_min[k]) * box_scale[k]));
+          std::memcpy(cursor, &q, 2); cursor += 2;
+        }
+      } else {
+        const float x = xyzs(0, i);
+        const float y = xyzs(1, i);
+        const float z = xyzs(2, i);
+        std::memcpy(cursor, &x, 4); cursor += 4;
+        std::memcpy(cursor, &y, 4); cursor += 4;
+        std::memcpy(cursor, &z, 4); cursor += 4;
+      }
     }
     if (has_rgbs) {
       *cursor = rgbs(0, i); ++cursor;
@@ -165,31 +235,203 @@ void Calc(double time, const std::string& frame_name, const PointCloud& cloud,
     ++num_finite_points;
   }
 
-  // Shrink the message down to the actual number of valid points copied.
-  const std::ptrdiff_t data_size = cursor - message->data.data();
-  DRAKE_DEMAND(data_size == (num_finite_points * point_step));
-  message->data_size = data_size;
-  message->data.resize(data_size);
+  // Shrink the storage down to the actual number of valid points copied.
+  const std::ptrdiff_t points_size = cursor - begin;
+  DRAKE_DEMAND(points_size == (num_finite_points * point_step));
+  raw.resize(header_size + points_size);
   message->width = num_finite_points;
-  message->row_step = data_size;
+  message->row_step = points_size;
+
+  // Compress the staged data into the message.
+  if (compact) {
+    uLongf dest_size = compressBound(raw.size());
+    message->data.resize(dest_size);
+    const int compress_status = compress2(
+        message->data.data(), &dest_size, raw.data(), raw.size(),
+        Z_BEST_SPEED);
+    DRAKE_DEMAND(compress_status == Z_OK);
+    message->data.resize(dest_size);
+  }
+  message->data_size = message->data.size();
+}
+
+// Returns the field of `message` with the given name, or nullptr if none.
+const lcmt_point_cloud_field* FindField(const lcmt_point_cloud& message,
+                                        const char* name) {
+  for (const auto& field : message.fields) {
+    if (field.name == name) {
+      return &field;
+    }
+  }
+  return nullptr;
+}
+
+// Returns the byte offset of the given field after checking its datatype and
+// that it lies within a point.
+int CheckField(const lcmt_point_cloud& message,
+               const lcmt_point_cloud_field& field, int8_t datatype, int size) {
+  if (field.datatype != datatype || field.count != 1) {
+    throw std::runtime_error(fmt::format(
+        "LcmToPointCloud(): field '{}' has unsupported datatype {} (count {})",
+        field.name, field.datatype, field.count));
+  }
+  if (field.byte_offset < 0 || field.byte_offset + size > message.point_step) {
+    throw std::runtime_error(fmt::format(
+        "LcmToPointCloud(): field '{}' does not fit within point_step {}",
+        field.name, message.point_step));
+  }
+  return field.byte_offset;
 }
 
 }  // anonymous namespace
 
-PointCloudToLcm::PointCloudToLcm(std::string frame_name)
-    : frame_name_(std::move(frame_name)) {
+PointCloudToLcm::PointCloudToLcm(std::string frame_name, Encoding encoding)
+    : frame_name_(std::move(frame_name)), encoding_(encoding) {
   DeclareAbstractInputPort("point_cloud", Value<PointCloud>());
+  // The scratch entry is never evaluated, only written through; it holds the
+  // uncompressed data of the compact encoding, so that its storage is reused
+  // from one message to the next.
+  scratch_cache_index_ =
+      DeclareCacheEntry(
+          "scratch",
+          systems::ValueProducer(std::vector<uint8_t>(),
+                                 &systems::ValueProducer::NoopCalc),
+          {nothing_ticket()})
+          .cache_index();
   DeclareAbstractOutputPort(
       "lcmt_point_cloud",
       []() { return AbstractValue::Make<lcmt_point_cloud>(); },
       [this](const systems::Context<double>& context, AbstractValue* value) {
         auto& cloud = this->get_input_port().template Eval<PointCloud>(context);
         auto& message = value->get_mutable_value<lcmt_point_cloud>();
-        Calc(context.get_time(), this->frame_name_, cloud, &message);
+        auto& scratch =
+            this->get_cache_entry(scratch_cache_index_)
+                .get_mutable_cache_entry_value(context)
+                .template GetMutableValueOrThrow<std::vector<uint8_t>>();
+        Calc(context.get_time(), this->frame_name_, this->encoding_, cloud,
+             &message, &scratch);
       });
 }
 
 PointCloudToLcm::~PointCloudToLcm() = default;
 
+PointCloud LcmToPointCloud(const lcmt_point_cloud& message) {
+  if (message.flags & lcmt_point_cloud::IS_BIGENDIAN) {
+    throw std::runtime_error(
+        "LcmToPointCloud(): big-endian data is not supported");
+  }
+  const bool quantized = message.flags & lcmt_point_cloud::IS_QUANTIZED;
+  const bool compressed = message.flags & lcmt_point_cloud::IS_ZLIB_COMPRESSED;
+  const int64_t num_points = message.width * message.height;
+  const int point_step = message.point_step;
+  if (num_points < 0 || num_points > std::numeric_limits<int>::max() ||
+      point_step < 0 ||
+      message.data_size != static_cast<int64_t>(message.data.size())) {
+    throw std::runtime_error("LcmToPointCloud(): malformed message header");
+  }
+
+  // Find the fields that we know how to decode.
+  const lcmt_point_cloud_field* const x = FindField(message, "x");
+  const lcmt_point_cloud_field* const y = FindField(message, "y");
+  const lcmt_point_cloud_field* const z = FindField(message, "z");
+  const lcmt_point_cloud_field* const rgb = FindField(message, "rgb");
+  const lcmt_point_cloud_field* const nx = FindField(message, "normal_x");
+  const lcmt_point_cloud_field* const ny = FindField(message, "normal_y");
+  const lcmt_point_cloud_field* const nz = FindField(message, "normal_z");
+  const bool has_xyzs = x && y && z;
+  const bool has_rgbs = (rgb != nullptr);
+  const bool has_normals = nx && ny && nz;
+  const int8_t xyz_datatype = quantized ? lcmt_point_cloud_field::UINT16
+                                        : lcmt_point_cloud_field::FLOAT32;
+  const int xyz_size = quantized ? 2 : 4;
+  int xyz_offsets[3]{};
+  int rgb_offset{};
+  int normal_offsets[3]{};
+  if (has_xyzs) {
+    xyz_offsets[0] = CheckField(message, *x, xyz_datatype, xyz_size);
+    xyz_offsets[1] = CheckField(message, *y, xyz_datatype, xyz_size);
+    xyz_offsets[2] = CheckField(message, *z, xyz_datatype, xyz_size);
+  }
+  if (has_rgbs) {
+    rgb_offset = CheckField(message, *rgb, lcmt_point_cloud_field::UINT32, 4);
+  }
+  if (has_normals) {
+    const int8_t float32 = lcmt_point_cloud_field::FLOAT32;
+    normal_offsets[0] = CheckField(message, *nx, float32, 4);
+    normal_offsets[1] = CheckField(message, *ny, float32, 4);
+    normal_offsets[2] = CheckField(message, *nz, float32, 4);
+  }
+
+  // Locate the uncompressed data.
+  const int header_size = quantized ? kBoxSize : 0;
+  const int64_t expected_size = header_size + num_points * point_step;
+  std::vector<uint8_t> uncompressed;
+  const uint8_t* raw = message.data.data();
+  if (compressed) {
+    uncompressed.resize(expected_size);
+    uLongf uncompressed_size = expected_size;
+    const int status = uncompress(uncompressed.data(), &uncompressed_size,
+                                  message.data.data(), message.data.size());
+    if (status != Z_OK || static_cast<int64_t>(uncompressed_size) !=
+                              expected_size) {
+      throw std::runtime_error(
+          "LcmToPointCloud(): could not decompress the point data");
+    }
+    raw = uncompressed.data();
+  } else if (message.data_size < expected_size) {
+    throw std::runtime_error(fmt::format(
+        "LcmToPointCloud(): data_size {} is too small for {} points",
+        message.data_size, num_points));
+  }
+
+  // Read the bounding box of quantized data.
+  float box_min[3]{};
+  float box_step[3]{};
+  if (quantized) {
+    float box_max[3];
+    std::memcpy(box_min, raw, 3 * sizeof(float));
+    std::memcpy(box_max, raw + 3 * sizeof(float), 3 * sizeof(float));
+    for (int k = 0; k < 3; ++k) {
+      box_step[k] = (box_max[k] - box_min[k]) / kQuantizedMax;
+    }
+  }
+  const uint8_t* const points = raw + header_size;
+
+  // Copy the message's data into the cloud.
+  const pc_flags::Fields fields =
+      (has_xyzs ? pc_flags::kXYZs : pc_flags::kNone) |
+      (has_rgbs ? pc_flags::kRGBs : pc_flags::kNone) |
+      (has_normals ? pc_flags::kNormals : pc_flags::kNone);
+  PointCloud cloud(num_points, fields, /* skip_initialize = */ true);
+  for (int i = 0; i < num_points; ++i) {
+    const uint8_t* const point = points + static_cast<int64_t>(i) * point_step;
+    if (has_xyzs) {
+      auto xyz = cloud.mutable_xyz(i);
+      for (int k = 0; k < 3; ++k) {
+        if (quantized) {
+          uint16_t q;
+          std::memcpy(&q, point + xyz_offsets[k], 2);
+          xyz[k] = box_min[k] + q * box_step[k];
+        } else {
+          std::memcpy(&xyz[k], point + xyz_offsets[k], 4);
+        }
+      }
+    }
+    if (has_rgbs) {
+      auto color = cloud.mutable_rgb(i);
+      for (int k = 0; k < 3; ++k) {
+        color[k] = point[rgb_offset + k];
+      }
+    }
+    if (has_normals) {
+      auto normal = cloud.mutable_normal(i);
+      for (int k = 0; k < 3; ++k) {
+        std::memcpy(&normal[k], point + normal_offsets[k], 4);
+      }
+    }
+  }
+  return cloud;
+}
+
 }  // namespace perception
 }  // namespace drake
@@ -3,6 +3,8 @@
 #include <string>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/lcmt_point_cloud.hpp"
+#include "drake/perception/point_cloud.h"
 #include "drake/systems/framework/leaf_system.h"
 
 namespace drake {
@@ -24,17 +26,46 @@ namespace perception {
 ///
 /// Only the finite points from the cloud are copied into the message
 /// (too-close or too-far points from a depth sensor are omitted).
+///
+/// Messages can be decoded back into a PointCloud using LcmToPointCloud().
 class PointCloudToLcm final : public systems::LeafSystem<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PointCloudToLcm)
 
-  /// Constructs a system that outputs messages using the given `frame_name`.
-  explicit PointCloudToLcm(std::string frame_name = {});
+  /// The layout of the point data in the output message.
+  enum class Encoding {
+    /// Every channel is stored as uncompressed float32 values (with rgb
+    /// packed into a uint32), in the conventional PCL / ROS layout.
+    kFloat32,
+    /// The xyz channels are quantized to uint16 values over the bounding box
+    /// of the (finite) points, the points are packed without padding, and the
+    /// data is compressed with zlib, tuned for speed. The quantization step
+    /// is the extent of the bounding box divided by 65535, per axis. See the
+    /// IS_QUANTIZED and IS_ZLIB_COMPRESSED flags of lcmt_point_cloud.
+    kCompact,
+  };
+
+  /// Constructs a system that outputs messages using the given `frame_name`
+  /// and `encoding`.
+  explicit PointCloudToLcm(std::string frame_name = {},
+                           Encoding encoding = Encoding::kFloat32);
   ~PointCloudToLcm() final;
 
+  /// Returns the encoding of the output messages.
+  Encoding encoding() const { return encoding_; }
+
  private:
   const std::string frame_name_;
+  const Encoding encoding_;
+  systems::CacheIndex scratch_cache_index_;
 };
 
+/// Decodes a message produced by PointCloudToLcm (with either encoding). The
+/// cloud has the fields that the message has among xyz, rgb, and normals;
+/// other fields of the message are ignored.
+/// @throws std::exception if the message is big-endian, is malformed, or
+/// stores one of those fields in a datatype that PointCloudToLcm does not use.
+PointCloud LcmToPointCloud(const lcmt_point_cloud& message);
+
 }  // namespace perception
 }  // namespace drake
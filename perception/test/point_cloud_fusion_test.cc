@@ -0,0 +1,150 @@
+#include "drake/perception/point_cloud_fusion.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Vector3f;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+// Makes a cloud with the given xyzs, whose normals all point along +z and
+// whose colors are all `rgb`.
+PointCloud MakeCloud(const Matrix3X<float>& xyzs, uint8_t rgb) {
+  PointCloud cloud(xyzs.cols(),
+                   pc_flags::kXYZs | pc_flags::kNormals | pc_flags::kRGBs);
+  cloud.mutable_xyzs() = xyzs;
+  cloud.mutable_normals().setZero();
+  cloud.mutable_normals().row(2).setOnes();
+  cloud.mutable_rgbs().setConstant(rgb);
+  return cloud;
+}
+
+GTEST_TEST(PointCloudFusionTest, Ports) {
+  const PointCloudFusion dut(3, 0.1);
+  EXPECT_EQ(dut.num_clouds(), 3);
+  EXPECT_EQ(dut.num_input_ports(), 6);
+  EXPECT_EQ(dut.point_cloud_input_port(2).get_name(), "point_cloud_2");
+  EXPECT_EQ(dut.camera_pose_input_port(1).get_name(), "camera_pose_1");
+  EXPECT_EQ(dut.point_cloud_output_port().get_name(), "point_cloud");
+}
+
+GTEST_TEST(PointCloudFusionTest, BadArguments) {
+  EXPECT_THROW(PointCloudFusion(0, 0.1), std::exception);
+  EXPECT_THROW(PointCloudFusion(1, 0.0), std::exception);
+  EXPECT_THROW(PointCloudFusion(1, 0.1, Vector3f(0, 0, 1), Vector3f(1, 1, 0)),
+               std::exception);
+  EXPECT_THROW(PointCloudFusion(1, 0.1, Vector3f::Zero(), Vector3f::Ones(),
+                                pc_flags::kRGBs),
+               std::exception);
+}
+
+// Two clouds, one already in the world frame and one posed by its camera, are
+// cropped and merged into shared voxels.
+GTEST_TEST(PointCloudFusionTest, Fuse) {
+  const pc_flags::BaseFieldT fields =
+      pc_flags::kXYZs | pc_flags::kNormals | pc_flags::kRGBs;
+  const PointCloudFusion dut(2, 1.0, Vector3f::Constant(-10),
+                             Vector3f::Constant(10), fields);
+  auto context = dut.CreateDefaultContext();
+
+  Matrix3X<float> xyzs0(3, 3);
+  // clang-format off
+  xyzs0 << 0.25, 0.5, 20,
+           0.25, 0.5,  0,
+           0.25, 0.5,  0;
+  // clang-format on
+  dut.point_cloud_input_port(0).FixValue(context.get(), MakeCloud(xyzs0, 10));
+
+  // Cloud 1's camera is rotated by π about its x axis, mapping camera
+  // coordinates (x, y, z) to world coordinates (x, 1 - y, 1.25 - z). Its
+  // points land at (0.75, 0.75, 0.75), sharing the voxel of cloud 0's
+  // points, and (5.5, 0.5, 0.5); its +z normals become -z normals.
+  Matrix3X<float> xyzs1(3, 2);
+  // clang-format off
+  xyzs1 << 0.75, 5.5,
+           0.25, 0.5,
+           0.5,  0.75;
+  // clang-format on
+  dut.point_cloud_input_port(1).FixValue(context.get(), MakeCloud(xyzs1, 40));
+  dut.camera_pose_input_port(1).FixValue(
+      context.get(),
+      RigidTransformd(RollPitchYawd(M_PI, 0, 0), Eigen::Vector3d(0, 1, 1.25)));
+
+  const PointCloud& fused =
+      dut.point_cloud_output_port().Eval<PointCloud>(*context);
+  EXPECT_EQ(fused.fields(), fields);
+  ASSERT_EQ(fused.size(), 2);
+
+  // Voxels appear in order of first occupancy, cloud by cloud.
+  EXPECT_TRUE(CompareMatrices(fused.xyz(0), Vector3f::Constant(0.5), 1e-6));
+  EXPECT_TRUE(CompareMatrices(fused.xyz(1), Vector3f(5.5, 0.5, 0.5), 1e-6));
+  // The first voxel has two +z normals and one -z normal.
+  EXPECT_TRUE(CompareMatrices(fused.normal(0), Vector3f(0, 0, 1), 1e-6));
+  EXPECT_TRUE(CompareMatrices(fused.normal(1), Vector3f(0, 0, -1), 1e-6));
+  EXPECT_EQ(fused.rgb(0), (Vector3<uint8_t>::Constant(20)));
+  EXPECT_EQ(fused.rgb(1), (Vector3<uint8_t>::Constant(40)));
+
+  // Re-evaluating with different inputs reuses the output and scratch storage.
+  dut.point_cloud_input_port(1).FixValue(context.get(), PointCloud(0, fields));
+  const PointCloud& refused =
+      dut.point_cloud_output_port().Eval<PointCloud>(*context);
+  ASSERT_EQ(refused.size(), 1);
+  EXPECT_TRUE(CompareMatrices(refused.xyz(0), Vector3f::Constant(0.375), 1e-6));
+  EXPECT_EQ(refused.rgb(0), (Vector3<uint8_t>::Constant(10)));
+}
+
+// The result doesn't depend on the degree of parallelism.
+GTEST_TEST(PointCloudFusionTest, Parallel) {
+  const int kNumClouds = 4;
+  const Vector3f lower = Vector3f::Constant(-0.8);
+  const Vector3f upper = Vector3f::Constant(0.8);
+  const PointCloudFusion serial(kNumClouds, 0.05, lower, upper);
+  const PointCloudFusion parallel(kNumClouds, 0.05, lower, upper,
+                                  pc_flags::kXYZs, Parallelism::Max());
+  auto serial_context = serial.CreateDefaultContext();
+  auto parallel_context = parallel.CreateDefaultContext();
+  for (int i = 0; i < kNumClouds; ++i) {
+    PointCloud cloud(1000);
+    cloud.mutable_xyzs().setRandom();
+    const RigidTransformd X_WC(RollPitchYawd(0.1 * i, 0.2, 0.3),
+                               Eigen::Vector3d(0.1 * i, 0, 0));
+    serial.point_cloud_input_port(i).FixValue(serial_context.get(), cloud);
+    serial.camera_pose_input_port(i).FixValue(serial_context.get(), X_WC);
+    parallel.point_cloud_input_port(i).FixValue(parallel_context.get(), cloud);
+    parallel.camera_pose_input_port(i).FixValue(parallel_context.get(), X_WC);
+  }
+  const PointCloud& expected =
+      serial.point_cloud_output_port().Eval<PointCloud>(*serial_context);
+  const PointCloud& actual =
+      parallel.point_cloud_output_port().Eval<PointCloud>(*parallel_context);
+  EXPECT_GT(expected.size(), 0);
+  EXPECT_TRUE(CompareMatrices(actual.xyzs(), expected.xyzs()));
+  for (int i = 0; i < expected.size(); ++i) {
+    EXPECT_TRUE((expected.xyz(i).array() >= lower.array()).all());
+    EXPECT_TRUE((expected.xyz(i).array() <= upper.array()).all());
+  }
+}
+
+GTEST_TEST(PointCloudFusionTest, MissingInput) {
+  const PointCloudFusion dut(2, 0.1);
+  auto context = dut.CreateDefaultContext();
+  dut.point_cloud_input_port(0).FixValue(context.get(), PointCloud(1));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.point_cloud_output_port().Eval<PointCloud>(*context),
+      ".*point_cloud_1 is not connected.*");
+  dut.point_cloud_input_port(1).FixValue(context.get(),
+                                         PointCloud(1, pc_flags::kNormals));
+  EXPECT_THROW(dut.point_cloud_output_port().Eval<PointCloud>(*context),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
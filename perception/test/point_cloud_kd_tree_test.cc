@@ -0,0 +1,80 @@
+#include "drake/perception/point_cloud_kd_tree.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Vector3f;
+
+// Random points in the unit cube, with a few non-finite points mixed in.
+Matrix3X<float> MakePoints(int num_points) {
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<float> distribution(0, 1);
+  Matrix3X<float> xyzs(3, num_points);
+  for (int i = 0; i < num_points; ++i) {
+    for (int j = 0; j < 3; ++j) xyzs(j, i) = distribution(generator);
+  }
+  xyzs(0, 3) = std::numeric_limits<float>::quiet_NaN();
+  xyzs(2, 7) = std::numeric_limits<float>::infinity();
+  return xyzs;
+}
+
+// Compares the tree's queries against brute-force searches.
+GTEST_TEST(PointCloudKdTreeTest, MatchesBruteForce) {
+  const Matrix3X<float> xyzs = MakePoints(1000);
+  const PointCloudKdTree dut(xyzs);
+  EXPECT_EQ(dut.size(), 998);
+
+  std::vector<int> indices;
+  for (const Vector3f& p : {Vector3f(0.5, 0.5, 0.5), Vector3f(0, 0, 0),
+                            Vector3f(0.9, 0.1, 0.3), Vector3f(2, 2, 2)}) {
+    // All finite points, sorted by distance from p.
+    std::vector<std::pair<float, int>> sorted;
+    for (int i = 0; i < xyzs.cols(); ++i) {
+      if (!xyzs.col(i).allFinite()) continue;
+      sorted.emplace_back((xyzs.col(i) - p).squaredNorm(), i);
+    }
+    std::sort(sorted.begin(), sorted.end());
+
+    for (int k : {0, 1, 5, 20, 2000}) {
+      dut.FindNearest(p, k, &indices);
+      ASSERT_EQ(indices.size(), std::min<size_t>(k, sorted.size()));
+      for (int j = 0; j < static_cast<int>(indices.size()); ++j) {
+        EXPECT_EQ(indices[j], sorted[j].second);
+      }
+    }
+
+    for (double radius : {0.0, 0.05, 0.2, 2.0}) {
+      dut.FindInRadius(p, radius, &indices);
+      std::sort(indices.begin(), indices.end());
+      std::vector<int> expected;
+      for (const auto& [distance_squared, i] : sorted) {
+        if (distance_squared <= radius * radius) expected.push_back(i);
+      }
+      std::sort(expected.begin(), expected.end());
+      EXPECT_EQ(indices, expected);
+    }
+  }
+}
+
+GTEST_TEST(PointCloudKdTreeTest, Empty) {
+  const PointCloudKdTree dut(Matrix3X<float>(3, 0));
+  EXPECT_EQ(dut.size(), 0);
+  std::vector<int> indices{1, 2};
+  dut.FindNearest(Vector3f::Zero(), 3, &indices);
+  EXPECT_TRUE(indices.empty());
+  indices = {1, 2};
+  dut.FindInRadius(Vector3f::Zero(), 1.0, &indices);
+  EXPECT_TRUE(indices.empty());
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
@@ -1,5 +1,6 @@
 #include "drake/perception/point_cloud.h"
 
+#include <cmath>
 #include <iostream>
 #include <stdexcept>
 
@@ -7,6 +8,7 @@
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 
 using Eigen::Matrix3Xf;
 using Eigen::Matrix4Xf;
@@ -257,6 +259,91 @@ GTEST_TEST(PointCloudTest, Fields) {
   }
 }
 
+GTEST_TEST(PointCloudTest, Crop) {
+  PointCloud cloud(4, pc_flags::kXYZs | pc_flags::kRGBs);
+  cloud.mutable_xyzs() << 0, 1, 2, 3,
+                          0, 1, 2, 3,
+                          0, 1, 2, 3;
+  cloud.mutable_rgbs() << 10, 11, 12, 13,
+                          20, 21, 22, 23,
+                          30, 31, 32, 33;
+  const PointCloud cropped =
+      cloud.Crop(Eigen::Vector3f(0.5, 0.5, 0.5), Eigen::Vector3f(2, 2, 2));
+  EXPECT_TRUE(cropped.HasExactFields(cloud.fields()));
+  ASSERT_EQ(cropped.size(), 2);
+  EXPECT_TRUE(CompareMatrices(cropped.xyzs(), cloud.xyzs().middleCols(1, 2)));
+  EXPECT_TRUE((cropped.rgbs().array() ==
+               cloud.rgbs().middleCols(1, 2).array()).all());
+
+  EXPECT_THROW(
+      cloud.Crop(Eigen::Vector3f(1, 0, 0), Eigen::Vector3f(0, 1, 1)),
+      std::exception);
+}
+
+GTEST_TEST(PointCloudTest, VoxelizedDownSample) {
+  PointCloud cloud(5, pc_flags::kXYZs | pc_flags::kNormals | pc_flags::kRGBs);
+  // Two points in the voxel [0, 1)³, one in [1, 2) x [0, 1)², one in
+  // [-1, 0)³, and one non-finite point.
+  cloud.mutable_xyzs() << 0.1, 1.5, 0.3, -0.5, NAN,
+                          0.2, 0.5, 0.4, -0.5, 0,
+                          0.3, 0.5, 0.5, -0.5, 0;
+  cloud.mutable_normals() << 1, 0, 0, 0, 0,
+                             0, 0, 1, 0, 0,
+                             0, 1, 0, 1, 1;
+  cloud.mutable_rgbs() << 10, 0, 20, 0, 0,
+                          0, 0, 0, 0, 0,
+                          0, 0, 0, 0, 0;
+
+  const PointCloud down = cloud.VoxelizedDownSample(1.0);
+  EXPECT_TRUE(down.HasExactFields(cloud.fields()));
+  ASSERT_EQ(down.size(), 3);
+  Matrix3Xf expected_xyzs(3, 3);
+  expected_xyzs << 0.2, 1.5, -0.5,
+                   0.3, 0.5, -0.5,
+                   0.4, 0.5, -0.5;
+  EXPECT_TRUE(CompareMatrices(down.xyzs(), expected_xyzs, 1e-6));
+  EXPECT_TRUE(CompareMatrices(down.normal(0),
+                              Eigen::Vector3f(M_SQRT1_2, M_SQRT1_2, 0),
+                              1e-6));
+  EXPECT_EQ(down.rgb(0)(0), 15);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(cloud.VoxelizedDownSample(0),
+                              ".*voxel_size.*must be positive");
+}
+
+GTEST_TEST(PointCloudTest, EstimateNormals) {
+  // A 10 x 10 grid of points in the plane z = 1, plus one isolated point.
+  const int kGrid = 10;
+  PointCloud cloud(kGrid * kGrid + 1, pc_flags::kXYZs | pc_flags::kNormals);
+  for (int i = 0; i < kGrid; ++i) {
+    for (int j = 0; j < kGrid; ++j) {
+      cloud.mutable_xyz(i * kGrid + j) =
+          Eigen::Vector3f(0.1 * i, 0.1 * j, 1.0);
+    }
+  }
+  cloud.mutable_xyz(kGrid * kGrid) = Eigen::Vector3f(10, 10, 10);
+
+  for (bool parallelize : {false, true}) {
+    PointCloud dut(cloud);
+    EXPECT_FALSE(dut.EstimateNormals(0.25, 10, parallelize));
+    for (int i = 0; i < kGrid * kGrid; ++i) {
+      // The normals point towards the origin.
+      EXPECT_TRUE(
+          CompareMatrices(dut.normal(i), Eigen::Vector3f(0, 0, -1), 1e-5));
+    }
+    EXPECT_TRUE(dut.normals().col(kGrid * kGrid).array().isNaN().all());
+  }
+
+  PointCloud grid(cloud);
+  grid.resize(kGrid * kGrid);
+  EXPECT_TRUE(grid.EstimateNormals(0.25, 10));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(grid.EstimateNormals(0, 10),
+                              ".*radius.*must be positive");
+  DRAKE_EXPECT_THROWS_MESSAGE(grid.EstimateNormals(1, 2),
+                              ".*num_closest.*must be at least 3");
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace drake
@@ -272,6 +272,116 @@ TEST_F(PointCloudToLcmTest, StorageReuse) {
   }
 }
 
+// Check that the float32 encoding decodes back to the finite points.
+TEST_F(PointCloudToLcmTest, DecodeFloat32) {
+  PointCloud cloud(3, pc_flags::kXYZs | pc_flags::kRGBs | pc_flags::kNormals);
+  cloud.mutable_xyz(0) = Vector3f(1.0, 2.0, 3.0);
+  cloud.mutable_xyz(1) = Vector3f(NAN, 0.0, 0.0);
+  cloud.mutable_xyz(2) = Vector3f(4.0, 5.0, 6.0);
+  cloud.mutable_rgb(0) = Vector3<uint8_t>(0, 127, 255);
+  cloud.mutable_rgb(2) = Vector3<uint8_t>(1, 128, 255);
+  cloud.mutable_normal(0) = Vector3f(1.0, 0.0, 0.0);
+  cloud.mutable_normal(2) = Vector3f(0.0, -1.0, 0.0);
+
+  const PointCloud decoded = LcmToPointCloud(Convert(cloud));
+  EXPECT_EQ(decoded.fields(), cloud.fields());
+  ASSERT_EQ(decoded.size(), 2);
+  for (int i : {0, 1}) {
+    const int j = 2 * i;
+    EXPECT_EQ(decoded.xyz(i), cloud.xyz(j));
+    EXPECT_EQ(decoded.rgb(i), cloud.rgb(j));
+    EXPECT_EQ(decoded.normal(i), cloud.normal(j));
+  }
+}
+
+// Check the compact encoding of a cloud, and that it decodes back to the
+// finite points to within the quantization step.
+TEST_F(PointCloudToLcmTest, Compact) {
+  const int num_points = 1000;
+  PointCloud cloud(num_points, pc_flags::kXYZs | pc_flags::kRGBs);
+  for (int i = 0; i < num_points; ++i) {
+    cloud.mutable_xyz(i) = Vector3f(0.01 * i, -0.5 + 0.001 * (i % 10), 2.0);
+    cloud.mutable_rgb(i) = Vector3<uint8_t>(i % 256, 0, 255);
+  }
+  cloud.mutable_xyz(10) = Vector3f(NAN, 0.0, 0.0);
+  cloud.mutable_xyz(20) = Vector3f(0.0, 0.0, kInf);
+
+  const PointCloudToLcm dut("world", PointCloudToLcm::Encoding::kCompact);
+  EXPECT_EQ(dut.encoding(), PointCloudToLcm::Encoding::kCompact);
+  auto context = dut.CreateDefaultContext();
+  dut.get_input_port().FixValue(context.get(), Value<PointCloud>(cloud));
+  const auto& message = dut.get_output_port().Eval<lcmt_point_cloud>(*context);
+
+  EXPECT_EQ(message.flags, lcmt_point_cloud::IS_STRICTLY_FINITE |
+                               lcmt_point_cloud::IS_QUANTIZED |
+                               lcmt_point_cloud::IS_ZLIB_COMPRESSED);
+  EXPECT_EQ(message.width, num_points - 2);
+  ASSERT_EQ(message.num_fields, 4);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(message.fields[i].byte_offset, 2 * i);
+    EXPECT_EQ(message.fields[i].datatype, lcmt_point_cloud_field::UINT16);
+  }
+  EXPECT_EQ(message.fields[3].byte_offset, 6);
+  EXPECT_EQ(message.point_step, 10);
+  EXPECT_EQ(message.row_step, 10 * (num_points - 2));
+  EXPECT_EQ(message.data_size, message.data.size());
+  // The compressed data is much smaller than the float32 encoding.
+  EXPECT_LT(message.data_size, Convert(cloud).data_size / 2);
+
+  const PointCloud decoded = LcmToPointCloud(message);
+  EXPECT_EQ(decoded.fields(), cloud.fields());
+  ASSERT_EQ(decoded.size(), num_points - 2);
+  // The bounding box spans [0, 9.99] x [-0.5, -0.491] x [2, 2].
+  const Vector3f tolerance =
+      Vector3f(9.99, 0.009, 0.0) / 65535 / 2 + Vector3f::Constant(1e-6);
+  int j = 0;
+  for (int i = 0; i < decoded.size(); ++i, ++j) {
+    if (j == 10 || j == 20) {
+      ++j;
+    }
+    EXPECT_TRUE(((decoded.xyz(i) - cloud.xyz(j)).cwiseAbs().array() <=
+                 tolerance.array()).all())
+        << i << ": " << decoded.xyz(i).transpose();
+    EXPECT_EQ(decoded.rgb(i), cloud.rgb(j));
+  }
+}
+
+// Check the compact encoding of an empty cloud.
+TEST_F(PointCloudToLcmTest, CompactEmpty) {
+  const PointCloudToLcm dut("world", PointCloudToLcm::Encoding::kCompact);
+  auto context = dut.CreateDefaultContext();
+  dut.get_input_port().FixValue(context.get(), Value<PointCloud>());
+  const auto& message = dut.get_output_port().Eval<lcmt_point_cloud>(*context);
+  EXPECT_EQ(message.width, 0);
+
+  const PointCloud decoded = LcmToPointCloud(message);
+  EXPECT_EQ(decoded.fields(), pc_flags::kXYZs);
+  EXPECT_EQ(decoded.size(), 0);
+}
+
+// Check that malformed messages are rejected.
+TEST_F(PointCloudToLcmTest, DecodeErrors) {
+  PointCloud cloud(2);
+  cloud.mutable_xyz(0) = Vector3f(1.0, 2.0, 3.0);
+  cloud.mutable_xyz(1) = Vector3f(4.0, 5.0, 6.0);
+
+  lcmt_point_cloud message = Convert(cloud);
+  message.flags |= lcmt_point_cloud::IS_BIGENDIAN;
+  EXPECT_THROW(LcmToPointCloud(message), std::exception);
+
+  message = Convert(cloud);
+  message.fields[0].datatype = lcmt_point_cloud_field::FLOAT64;
+  EXPECT_THROW(LcmToPointCloud(message), std::exception);
+
+  message = Convert(cloud);
+  message.data.pop_back();
+  message.data_size = message.data.size();
+  EXPECT_THROW(LcmToPointCloud(message), std::exception);
+
+  message = Convert(cloud);
+  message.flags |= lcmt_point_cloud::IS_ZLIB_COMPRESSED;
+  EXPECT_THROW(LcmToPointCloud(message), std::exception);
+}
 
 }  // namespace
 }  // namespace perception
@@ -202,11 +202,7 @@ MixedIntegerBranchAndBoundNode::ConstructRootNode(
   }
   MixedIntegerBranchAndBoundNode* node = new MixedIntegerBranchAndBoundNode(
       new_prog, binary_variables_list, solver_id);
-  node->solution_result_ = SolveProgramWithSolver(
-      *node->prog_, solver_id, node->prog_result_.get());
-  if (node->solution_result_ == SolutionResult::kSolutionFound) {
-    node->CheckOptimalSolutionIsIntegral();
-  }
+  node->SolveProgram();
   return std::make_pair(std::unique_ptr<MixedIntegerBranchAndBoundNode>(node),
                         map_old_vars_to_new_vars);
 }
@@ -290,7 +286,7 @@ void MixedIntegerBranchAndBoundNode::FixBinaryVariable(
   fixed_binary_value_ = binary_value;
 }
 
-void MixedIntegerBranchAndBoundNode::Branch(
+void MixedIntegerBranchAndBoundNode::MakeChildren(
     const symbolic::Variable& binary_variable) {
   left_child_.reset(new MixedIntegerBranchAndBoundNode(
       *prog_, remaining_binary_variables_, solver_id_));
@@ -300,20 +296,35 @@ void MixedIntegerBranchAndBoundNode::Branch(
   right_child_->FixBinaryVariable(binary_variable, 1);
   left_child_->parent_ = this;
   right_child_->parent_ = this;
-  left_child_->solution_result_ = SolveProgramWithSolver(
-      *left_child_->prog_, left_child_->solver_id_,
-      left_child_->prog_result_.get());
-  right_child_->solution_result_ = SolveProgramWithSolver(
-      *right_child_->prog_, right_child_->solver_id_,
-      right_child_->prog_result_.get());
-  if (left_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    left_child_->CheckOptimalSolutionIsIntegral();
+  // Warm-start the children from this node's solution, which only violates
+  // the children's new bound on binary_variable.
+  if (solution_result_ == SolutionResult::kSolutionFound) {
+    const Eigen::VectorXd x_sol =
+        prog_result_->GetSolution(prog_->decision_variables());
+    for (MixedIntegerBranchAndBoundNode* child :
+         {left_child_.get(), right_child_.get()}) {
+      child->prog_->SetInitialGuessForAllVariables(x_sol);
+      child->prog_->SetInitialGuess(binary_variable,
+                                    child->fixed_binary_value_);
+    }
   }
-  if (right_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    right_child_->CheckOptimalSolutionIsIntegral();
+}
+
+void MixedIntegerBranchAndBoundNode::SolveProgram() {
+  solution_result_ =
+      SolveProgramWithSolver(*prog_, solver_id_, prog_result_.get());
+  if (solution_result_ == SolutionResult::kSolutionFound) {
+    CheckOptimalSolutionIsIntegral();
   }
 }
 
+void MixedIntegerBranchAndBoundNode::Branch(
+    const symbolic::Variable& binary_variable) {
+  MakeChildren(binary_variable);
+  left_child_->SolveProgram();
+  right_child_->SolveProgram();
+}
+
 MixedIntegerBranchAndBound::MixedIntegerBranchAndBound(
     const MathematicalProgram& prog, const SolverId& solver_id)
     : root_{nullptr},
@@ -360,20 +371,26 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       !root_->optimal_solution_is_integral()) {
     SearchIntegralSolutionByRounding(*root_);
   }
-  MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
-  while (branching_node) {
-    // Found a branching node, branch on this node. If no branching node is
+  std::vector<MixedIntegerBranchAndBoundNode*> branching_nodes =
+      PickBranchingNodes();
+  while (!branching_nodes.empty()) {
+    // Found branching nodes, branch on these nodes. If no branching node is
     // found, then every leaf node is fathomed, the branch-and-bound process
     // should terminate.
     // TODO(hongkai.dai) We might need to have a function that picks the
     // branching node together with the branching variable simultaneously.
-    const symbolic::Variable* branching_variable =
-        PickBranchingVariable(*branching_node);
-    BranchAndUpdate(branching_node, *branching_variable);
+    std::vector<std::pair<MixedIntegerBranchAndBoundNode*,
+                          const symbolic::Variable*>>
+        branches;
+    for (MixedIntegerBranchAndBoundNode* branching_node : branching_nodes) {
+      branches.emplace_back(branching_node,
+                            PickBranchingVariable(*branching_node));
+    }
+    BranchAndUpdate(branches);
     if (HasConverged()) {
       return SolutionResult::kSolutionFound;
     }
-    branching_node = PickBranchingNode();
+    branching_nodes = PickBranchingNodes();
   }
   // No node to branch.
   if (best_lower_bound_ == -std::numeric_limits<double>::infinity()) {
@@ -480,6 +497,23 @@ MixedIntegerBranchAndBoundNode* MixedIntegerBranchAndBound::PickBranchingNode()
 }
 
 namespace {
+// Appends the non-fathomed leaf nodes in the tree to `leaves`, from left to
+// right.
+void CollectUnfathomedLeafNodes(
+    const MixedIntegerBranchAndBound& bnb,
+    const MixedIntegerBranchAndBoundNode& sub_tree_root,
+    std::vector<MixedIntegerBranchAndBoundNode*>* leaves) {
+  if (sub_tree_root.IsLeaf()) {
+    if (!bnb.IsLeafNodeFathomed(sub_tree_root)) {
+      leaves->push_back(
+          const_cast<MixedIntegerBranchAndBoundNode*>(&sub_tree_root));
+    }
+    return;
+  }
+  CollectUnfathomedLeafNodes(bnb, *(sub_tree_root.left_child()), leaves);
+  CollectUnfathomedLeafNodes(bnb, *(sub_tree_root.right_child()), leaves);
+}
+
 // Pick the non-fathomed leaf node in the tree with the smallest optimal cost.
 MixedIntegerBranchAndBoundNode* PickMinLowerBoundNodeInSubTree(
     const MixedIntegerBranchAndBound& bnb,
@@ -601,6 +635,38 @@ const symbolic::Variable* PickMostOrLeastAmbivalentAsBranchingVariable(
 }
 }  // namespace
 
+std::vector<MixedIntegerBranchAndBoundNode*>
+MixedIntegerBranchAndBound::PickBranchingNodes() const {
+  MixedIntegerBranchAndBoundNode* const first = PickBranchingNode();
+  if (first == nullptr) {
+    return {};
+  }
+  std::vector<MixedIntegerBranchAndBoundNode*> nodes{first};
+  if (branching_batch_size_ == 1 ||
+      node_selection_method_ == NodeSelectionMethod::kUserDefined) {
+    return nodes;
+  }
+  // The rest of the batch are the next best leaves by the same criterion as
+  // PickBranchingNode(), with ties broken from left to right.
+  std::vector<MixedIntegerBranchAndBoundNode*> leaves;
+  CollectUnfathomedLeafNodes(*this, *root_, &leaves);
+  leaves.erase(std::find(leaves.begin(), leaves.end(), first));
+  const auto key = [this](const MixedIntegerBranchAndBoundNode* node) {
+    return node_selection_method_ == NodeSelectionMethod::kMinLowerBound
+               ? node->prog_result()->get_optimal_cost()
+               : static_cast<double>(node->remaining_binary_variables().size());
+  };
+  std::stable_sort(leaves.begin(), leaves.end(),
+                   [&key](const MixedIntegerBranchAndBoundNode* a,
+                          const MixedIntegerBranchAndBoundNode* b) {
+                     return key(a) < key(b);
+                   });
+  const int num_rest = std::min(static_cast<int>(leaves.size()),
+                                branching_batch_size_ - 1);
+  nodes.insert(nodes.end(), leaves.begin(), leaves.begin() + num_rest);
+  return nodes;
+}
+
 MixedIntegerBranchAndBoundNode*
 MixedIntegerBranchAndBound::PickMinLowerBoundNode() const {
   return PickMinLowerBoundNodeInSubTree(*this, *root_);
@@ -655,7 +721,23 @@ bool MixedIntegerBranchAndBound::IsLeafNodeFathomed(
 void MixedIntegerBranchAndBound::BranchAndUpdate(
     MixedIntegerBranchAndBoundNode* node,
     const symbolic::Variable& branching_variable) {
-  node->Branch(branching_variable);
+  BranchAndUpdate({{node, &branching_variable}});
+}
+
+void MixedIntegerBranchAndBound::BranchAndUpdate(
+    const std::vector<std::pair<MixedIntegerBranchAndBoundNode*,
+                                const symbolic::Variable*>>& branches) {
+  std::vector<MixedIntegerBranchAndBoundNode*> children;
+  for (const auto& [node, branching_variable] : branches) {
+    node->MakeChildren(*branching_variable);
+    children.push_back(node->mutable_left_child());
+    children.push_back(node->mutable_right_child());
+  }
+  StaticParallelForIndexLoop(
+      parallelism_, 0, static_cast<int>(children.size()),
+      [&children](int, int i) {
+        children[i]->SolveProgram();
+      });
   // Update the best lower and upper bounds.
   // The best lower bound is the minimal among all the optimal costs of the
   // non-fathomed leaf nodes.
@@ -663,7 +745,7 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
   // If either the left or the right children finds integral solution, then
   // we can potentially update the best upper bound, and insert the solutions
   // to the list solutions_;
-  for (auto& child : {node->left_child(), node->right_child()}) {
+  for (const MixedIntegerBranchAndBoundNode* child : children) {
     if (child->solution_result() == SolutionResult::kSolutionFound &&
         child->optimal_solution_is_integral()) {
       const double child_node_optimal_cost =
@@ -5,7 +5,9 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/mathematical_program_result.h"
 
@@ -73,7 +75,7 @@ class MixedIntegerBranchAndBoundNode {
    * Branches on @p binary_variable, and creates two child nodes. In the left
    * child node, the binary variable is fixed to 0. In the right node, the
    * binary variable is fixed to 1. Solves the optimization program in each
-   * child node.
+   * child node, warm-started from the solution in this node (if it has one).
    * @param binary_variable This binary variable is fixed to either 0 or 1 in
    * the child node.
    * @pre binary_variable is in remaining_binary_variables_;
@@ -174,6 +176,10 @@ class MixedIntegerBranchAndBoundNode {
   }
 
  private:
+  // The branch-and-bound creates the children of several nodes before it
+  // solves them all (possibly concurrently).
+  friend class MixedIntegerBranchAndBound;
+
   // Constructs an empty node. Clone the input mathematical program to this
   // node. The child and the parent nodes are all nullptr.
   // @param prog The optimization program whose binary variable constraints are
@@ -197,6 +203,16 @@ class MixedIntegerBranchAndBoundNode {
   // Only call this function AFTER the program is solved.
   void CheckOptimalSolutionIsIntegral();
 
+  // Creates the two (unsolved) children of Branch(). If this node has an
+  // optimal solution, it is the initial guess of the children's programs,
+  // with the branching variable's guess set to its fixed value.
+  void MakeChildren(const symbolic::Variable& binary_variable);
+
+  // Solves the program in this node, and checks whether its optimal solution
+  // (if any) is integral. Only reads the rest of the tree, so the programs of
+  // distinct nodes can be solved concurrently.
+  void SolveProgram();
+
   enum class OptimalSolutionIsIntegral {
     kTrue,   ///< The program in this node has been solved, and the solution to
              /// all binary variables satisfies the integral constraints.
@@ -564,6 +580,39 @@ class MixedIntegerBranchAndBound {
   /** Geeter for the relative gap tolerance. */
   double relative_gap_tol() const { return relative_gap_tol_; }
 
+  /**
+   * Sets the number of nodes to branch on in each round of the
+   * branch-and-bound process. The first is the node that the node selection
+   * method picks; for NodeSelectionMethod::kMinLowerBound and
+   * NodeSelectionMethod::kDepthFirst, the rest are the next un-fathomed leaf
+   * nodes in the same order (with kUserDefined, each round branches on one
+   * node). The children of all the nodes in a round are solved before the
+   * bounds and the solutions are updated, so a larger batch gives
+   * set_parallelism() more relaxations to solve at once, at the price of
+   * branching on some nodes that a one-at-a-time search would have fathomed.
+   * @default is 1.
+   * @throws std::exception if batch_size < 1.
+   */
+  void set_branching_batch_size(int batch_size) {
+    DRAKE_THROW_UNLESS(batch_size >= 1);
+    branching_batch_size_ = batch_size;
+  }
+
+  /** Getter for the branching batch size. */
+  int branching_batch_size() const { return branching_batch_size_; }
+
+  /**
+   * Sets the parallelism with which the relaxations of the child nodes in a
+   * round (see set_branching_batch_size()) are solved. The result of the
+   * branch-and-bound process does not depend on it. The solver must support
+   * solving several programs concurrently.
+   * @default is Parallelism::None().
+   */
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  /** Getter for the parallelism. */
+  const Parallelism& parallelism() const { return parallelism_; }
+
  private:
   // Forward declaration the tester class.
   friend class MixedIntegerBranchAndBoundTester;
@@ -573,6 +622,12 @@ class MixedIntegerBranchAndBound {
    */
   MixedIntegerBranchAndBoundNode* PickBranchingNode() const;
 
+  /**
+   * Pick the nodes to branch on in one round (see set_branching_batch_size()).
+   * Returns an empty vector if every leaf node is fathomed.
+   */
+  std::vector<MixedIntegerBranchAndBoundNode*> PickBranchingNodes() const;
+
   /**
    * Pick the node with the minimal lower bound.
    */
@@ -598,6 +653,15 @@ class MixedIntegerBranchAndBound {
   void BranchAndUpdate(MixedIntegerBranchAndBoundNode* node,
                        const symbolic::Variable& branching_variable);
 
+  /**
+   * Branch on each node on its variable, solve the optimizations of all the
+   * children (with parallelism_), and then update the best lower and upper
+   * bounds.
+   */
+  void BranchAndUpdate(
+      const std::vector<std::pair<MixedIntegerBranchAndBoundNode*,
+                                  const symbolic::Variable*>>& branches);
+
   /**
    * Update the solutions (solutions_) and the best upper bound, with an
    * integral solution and its cost.
@@ -682,6 +746,10 @@ class MixedIntegerBranchAndBound {
 
   bool search_integral_solution_by_rounding_ = false;
 
+  int branching_batch_size_{1};
+
+  Parallelism parallelism_;
+
   // The user defined function to pick a branching variable. Default is null.
   VariableSelectFun variable_selection_userfun_ = nullptr;
 
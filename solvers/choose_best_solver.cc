@@ -8,6 +8,7 @@
 #include "drake/common/never_destroyed.h"
 #include "drake/solvers/clp_solver.h"
 #include "drake/solvers/csdp_solver.h"
+#include "drake/solvers/dense_active_set_qp_solver.h"
 #include "drake/solvers/equality_constrained_qp_solver.h"
 #include "drake/solvers/get_program_type.h"
 #include "drake/solvers/gurobi_solver.h"
@@ -62,9 +63,10 @@ class StaticSolverInterface {
 };
 
 // The list of all solvers compiled in Drake.
-constexpr std::array<StaticSolverInterface, 12> kKnownSolvers{
+constexpr std::array<StaticSolverInterface, 13> kKnownSolvers{
     StaticSolverInterface::Make<ClpSolver>(),
     StaticSolverInterface::Make<CsdpSolver>(),
+    StaticSolverInterface::Make<DenseActiveSetQpSolver>(),
     StaticSolverInterface::Make<EqualityConstrainedQPSolver>(),
     StaticSolverInterface::Make<GurobiSolver>(),
     StaticSolverInterface::Make<IpoptSolver>(),
@@ -0,0 +1,245 @@
+#include "drake/solvers/chordal_decomposition.h"
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/solvers/solve.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+namespace {
+// Returns M(rows, cols). (Indexing by vectors of indices needs Eigen 3.4.)
+template <typename Derived>
+MatrixX<typename Derived::Scalar> Submatrix(
+    const Eigen::MatrixBase<Derived>& M, const std::vector<int>& rows,
+    const std::vector<int>& cols) {
+  MatrixX<typename Derived::Scalar> result(rows.size(), cols.size());
+  for (int j = 0; j < static_cast<int>(cols.size()); ++j) {
+    for (int i = 0; i < static_cast<int>(rows.size()); ++i) {
+      result(i, j) = M(rows[i], cols[j]);
+    }
+  }
+  return result;
+}
+}  // namespace
+
+std::vector<std::vector<int>> FindChordalExtensionCliques(
+    const Eigen::Ref<const MatrixX<bool>>& sparsity) {
+  DRAKE_THROW_UNLESS(sparsity.rows() == sparsity.cols());
+  const int n = sparsity.rows();
+  std::vector<std::set<int>> neighbors(n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < j; ++i) {
+      if (sparsity(i, j) || sparsity(j, i)) {
+        neighbors[i].insert(j);
+        neighbors[j].insert(i);
+      }
+    }
+  }
+  // Eliminates the vertex of minimum degree (the smallest one on ties) until
+  // none is left, connecting the neighbors of each eliminated vertex to each
+  // other. The eliminated vertex together with its neighbors at that point is
+  // a clique of the resulting chordal graph.
+  std::vector<std::vector<int>> candidates;
+  std::vector<bool> eliminated(n, false);
+  for (int step = 0; step < n; ++step) {
+    int v = -1;
+    for (int i = 0; i < n; ++i) {
+      if (!eliminated[i] &&
+          (v < 0 || neighbors[i].size() < neighbors[v].size())) {
+        v = i;
+      }
+    }
+    std::vector<int> clique(neighbors[v].begin(), neighbors[v].end());
+    for (int a : clique) {
+      neighbors[a].erase(v);
+      for (int b : clique) {
+        if (a != b) neighbors[a].insert(b);
+      }
+    }
+    clique.insert(std::upper_bound(clique.begin(), clique.end(), v), v);
+    candidates.push_back(std::move(clique));
+    eliminated[v] = true;
+  }
+  // A candidate can only be contained in the candidate of a vertex eliminated
+  // before it. The maximal candidates, in the reverse order of elimination,
+  // satisfy the running intersection property.
+  std::vector<std::vector<int>> cliques;
+  for (int k = n - 1; k >= 0; --k) {
+    bool maximal = true;
+    for (int j = 0; j < k && maximal; ++j) {
+      maximal = !std::includes(candidates[j].begin(), candidates[j].end(),
+                               candidates[k].begin(), candidates[k].end());
+    }
+    if (maximal) {
+      cliques.push_back(candidates[k]);
+    }
+  }
+  return cliques;
+}
+
+Eigen::MatrixXd CompletePsdMatrix(
+    const Eigen::Ref<const Eigen::MatrixXd>& X,
+    const std::vector<std::vector<int>>& cliques) {
+  DRAKE_THROW_UNLESS(X.rows() == X.cols());
+  Eigen::MatrixXd X_completed = X;
+  // The indices covered by the cliques processed so far, whose block of
+  // X_completed is already PSD.
+  std::vector<bool> covered(X.rows(), false);
+  for (const std::vector<int>& clique : cliques) {
+    // Splits the clique into its separator U from the covered indices, and its
+    // new indices N. The block X(N, R), where R is the covered indices outside
+    // of U, is then X(N, U) X(U, U)⁺ X(U, R), which keeps X(N ∪ U ∪ R) PSD.
+    std::vector<int> U;
+    std::vector<int> N;
+    for (int i : clique) {
+      (covered[i] ? U : N).push_back(i);
+    }
+    std::vector<int> R;
+    for (int i = 0; i < X.rows(); ++i) {
+      if (covered[i] && !std::binary_search(clique.begin(), clique.end(), i)) {
+        R.push_back(i);
+      }
+    }
+    if (!N.empty() && !R.empty()) {
+      Eigen::MatrixXd X_NR = Eigen::MatrixXd::Zero(N.size(), R.size());
+      if (!U.empty()) {
+        const Eigen::MatrixXd X_UU = Submatrix(X_completed, U, U);
+        X_NR = Submatrix(X_completed, N, U) *
+               X_UU.completeOrthogonalDecomposition().pseudoInverse() *
+               Submatrix(X_completed, U, R);
+      }
+      for (int b = 0; b < static_cast<int>(R.size()); ++b) {
+        for (int a = 0; a < static_cast<int>(N.size()); ++a) {
+          X_completed(N[a], R[b]) = X_completed(R[b], N[a]) = X_NR(a, b);
+        }
+      }
+    }
+    for (int i : N) {
+      covered[i] = true;
+    }
+  }
+  DRAKE_DEMAND(std::find(covered.begin(), covered.end(), false) ==
+               covered.end());
+  return X_completed;
+}
+
+}  // namespace internal
+
+namespace {
+// A PSD constraint that was replaced by constraints on its cliques.
+struct DecomposedPsdConstraint {
+  MatrixXDecisionVariable X;
+  std::vector<std::vector<int>> cliques;
+  // The free entries X(i, j), i < j, that lie outside of every clique.
+  std::vector<std::pair<int, int>> completed_entries;
+};
+
+// Counts the occurrences of each decision variable in the bindings.
+template <typename C>
+void CountVariables(const std::vector<Binding<C>>& bindings,
+                    std::unordered_map<symbolic::Variable::Id, int>* counts) {
+  for (const auto& binding : bindings) {
+    for (int i = 0; i < binding.variables().rows(); ++i) {
+      ++(*counts)[binding.variables()(i).get_id()];
+    }
+  }
+}
+
+// Returns the decomposition of the PSD constraint `binding`, or nullopt if it
+// isn't worth decomposing.
+std::optional<DecomposedPsdConstraint> DecomposePsdConstraint(
+    const Binding<PositiveSemidefiniteConstraint>& binding,
+    const std::unordered_map<symbolic::Variable::Id, int>& counts) {
+  const int n = binding.evaluator()->matrix_rows();
+  const MatrixXDecisionVariable X =
+      Eigen::Map<const MatrixXDecisionVariable>(binding.variables().data(), n,
+                                                n);
+  MatrixX<bool> sparsity = MatrixX<bool>::Identity(n, n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < j; ++i) {
+      if (!X(i, j).equal_to(X(j, i))) {
+        return std::nullopt;
+      }
+      // A free entry appears twice in this binding, and nowhere else.
+      sparsity(i, j) = sparsity(j, i) = counts.at(X(i, j).get_id()) != 2;
+    }
+  }
+  std::vector<std::vector<int>> cliques =
+      internal::FindChordalExtensionCliques(sparsity);
+  if (cliques.size() <= 1) {
+    return std::nullopt;
+  }
+  MatrixX<bool> extension = MatrixX<bool>::Zero(n, n);
+  for (const std::vector<int>& clique : cliques) {
+    for (int i : clique) {
+      for (int j : clique) {
+        extension(i, j) = true;
+      }
+    }
+  }
+  std::vector<std::pair<int, int>> completed_entries;
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < j; ++i) {
+      if (!extension(i, j)) {
+        completed_entries.emplace_back(i, j);
+      }
+    }
+  }
+  return DecomposedPsdConstraint{X, std::move(cliques),
+                                 std::move(completed_entries)};
+}
+}  // namespace
+
+MathematicalProgramResult SolveWithChordalDecomposition(
+    const MathematicalProgram& prog,
+    const std::optional<Eigen::VectorXd>& initial_guess,
+    const std::optional<SolverOptions>& solver_options) {
+  std::unordered_map<symbolic::Variable::Id, int> counts;
+  CountVariables(prog.GetAllCosts(), &counts);
+  CountVariables(prog.GetAllConstraints(), &counts);
+  CountVariables(prog.positive_semidefinite_constraints(), &counts);
+
+  std::unique_ptr<MathematicalProgram> decomposed_prog = prog.Clone();
+  std::vector<DecomposedPsdConstraint> decompositions;
+  for (const auto& binding : prog.positive_semidefinite_constraints()) {
+    std::optional<DecomposedPsdConstraint> decomposition =
+        DecomposePsdConstraint(binding, counts);
+    if (!decomposition.has_value()) {
+      continue;
+    }
+    decomposed_prog->RemoveConstraint(binding);
+    for (const std::vector<int>& clique : decomposition->cliques) {
+      decomposed_prog->AddPositiveSemidefiniteConstraint(
+          internal::Submatrix(decomposition->X, clique, clique));
+    }
+    decompositions.push_back(std::move(*decomposition));
+  }
+
+  MathematicalProgramResult result =
+      Solve(*decomposed_prog, initial_guess, solver_options);
+  if (!result.is_success() || decompositions.empty()) {
+    return result;
+  }
+  Eigen::VectorXd x_val = result.get_x_val();
+  for (const DecomposedPsdConstraint& decomposition : decompositions) {
+    const Eigen::MatrixXd X_completed = internal::CompletePsdMatrix(
+        result.GetSolution(decomposition.X), decomposition.cliques);
+    for (const auto& [i, j] : decomposition.completed_entries) {
+      x_val(prog.FindDecisionVariableIndex(decomposition.X(i, j))) =
+          X_completed(i, j);
+    }
+  }
+  result.set_x_val(x_val);
+  return result;
+}
+
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/eigen_types.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/mathematical_program_result.h"
+#include "drake/solvers/solver_options.h"
+
+namespace drake {
+namespace solvers {
+/**
+ * Solves an optimization program like Solve() does, but first replaces each
+ * large positive semidefinite (PSD) constraint whose matrix is sparse with
+ * several smaller PSD constraints, one on each maximal clique of a chordal
+ * extension of the matrix's sparsity pattern.
+ *
+ * An off-diagonal entry X(i, j) of a PSD constraint on the symmetric matrix of
+ * decision variables X is considered *free* if its variable appears in no cost
+ * and in no constraint other than X ⪰ 0 (and only in the entries (i, j) and
+ * (j, i) there). The sparsity pattern of X is its diagonal together with its
+ * entries that are not free. By Grone's theorem, when that pattern is chordal
+ * with maximal cliques C₁, ..., Cₘ, the values of the non-free entries can be
+ * completed to a PSD matrix iff X(Cₖ, Cₖ) ⪰ 0 for every k. So the program
+ * keeps its optimal value when X ⪰ 0 is replaced by these m smaller
+ * constraints, once the pattern has been extended to be chordal. Since the
+ * cost of the interior-point iterations of an SDP solver grows steeply with
+ * the size of the PSD blocks, this can be much cheaper than the original
+ * program when the cliques are small. After the solve, the free entries of X
+ * that lie outside of the chordal extension are set to the values of a PSD
+ * completion, so that the reported X satisfies the original constraint.
+ *
+ * A PSD constraint is left untouched when its matrix is not symmetric in its
+ * decision variables, or when its chordal extension has a clique spanning the
+ * whole matrix (e.g. when X has no free entries). Note that the Gram matrix of
+ * a sum-of-squares polynomial is usually dense in this sense, as each of its
+ * entries appears in the coefficient-matching equality constraints; the
+ * decomposition helps with programs such as the relaxations of sparse
+ * quadratic programs, whose PSD matrices have many entries that no other
+ * constraint uses.
+ *
+ * The dual solutions of the decomposed PSD constraints are not reported.
+ *
+ * @param prog The program to solve.
+ * @param initial_guess The initial guess for the decision variables of prog.
+ * @param solver_options The options in addition to those stored in prog, with
+ * the same priority rules as Solve().
+ * @return The result of solving the decomposed program, with its decision
+ * variables indexed as in prog.
+ */
+MathematicalProgramResult SolveWithChordalDecomposition(
+    const MathematicalProgram& prog,
+    const std::optional<Eigen::VectorXd>& initial_guess = std::nullopt,
+    const std::optional<SolverOptions>& solver_options = std::nullopt);
+
+namespace internal {
+/*
+ * Computes a chordal extension of the graph whose adjacency matrix is the
+ * off-diagonal part of the symmetric `sparsity`, by eliminating the vertices
+ * in a greedy minimum-degree order, and returns the extension's maximal
+ * cliques. The indices within each clique are sorted, and the cliques are
+ * ordered such that they satisfy the running intersection property: for each
+ * k > 0, the intersection of clique k with the union of the cliques before it
+ * is contained in one of those cliques.
+ */
+std::vector<std::vector<int>> FindChordalExtensionCliques(
+    const Eigen::Ref<const MatrixX<bool>>& sparsity);
+
+/*
+ * Given a symmetric matrix X whose entries within each of the `cliques`
+ * (ordered as returned by FindChordalExtensionCliques()) form a PSD matrix,
+ * returns X with its entries outside of every clique replaced such that the
+ * whole matrix is PSD. Each of those entries is completed from the clique that
+ * separates it from the earlier cliques, which gives the completion of
+ * maximum determinant when the clique blocks are positive definite.
+ * @pre Every index in [0, X.rows()) belongs to some clique.
+ */
+Eigen::MatrixXd CompletePsdMatrix(
+    const Eigen::Ref<const Eigen::MatrixXd>& X,
+    const std::vector<std::vector<int>>& cliques);
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
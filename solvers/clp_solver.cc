@@ -57,15 +57,17 @@ void AddLinearConstraint(
   constraint_dual_start_index->emplace(binding_cast, *constraint_count);
   const std::vector<int> variable_indices =
       prog.FindDecisionVariableIndices(linear_constraint.variables());
-  for (int i = 0; i < linear_constraint.evaluator()->num_constraints(); ++i) {
-    for (int j = 0; j < linear_constraint.variables().rows(); ++j) {
-      const int var_index = variable_indices[j];
-      if (linear_constraint.evaluator()->A()(i, j) != 0) {
-        constraint_coeffs->emplace_back(
-            i + *constraint_count, var_index,
-            linear_constraint.evaluator()->A()(i, j));
+  const Eigen::SparseMatrix<double>& A =
+      linear_constraint.evaluator()->get_sparse_A();
+  for (int j = 0; j < A.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(A, j); it; ++it) {
+      if (it.value() != 0) {
+        constraint_coeffs->emplace_back(it.row() + *constraint_count,
+                                        variable_indices[j], it.value());
       }
     }
+  }
+  for (int i = 0; i < linear_constraint.evaluator()->num_constraints(); ++i) {
     (*constraint_lower)[*constraint_count + i] =
         linear_constraint.evaluator()->lower_bound()(i);
     (*constraint_upper)[*constraint_count + i] =
@@ -84,14 +86,13 @@ void AddLinearConstraints(
   int num_nonzero_coeff_max = 0;
   for (const auto& linear_constraint : prog.linear_constraints()) {
     num_constraints += linear_constraint.evaluator()->num_constraints();
-    num_nonzero_coeff_max += linear_constraint.evaluator()->num_constraints() *
-                             linear_constraint.variables().rows();
+    num_nonzero_coeff_max +=
+        linear_constraint.evaluator()->get_sparse_A().nonZeros();
   }
   for (const auto& linear_eq_constraint : prog.linear_equality_constraints()) {
     num_constraints += linear_eq_constraint.evaluator()->num_constraints();
     num_nonzero_coeff_max +=
-        linear_eq_constraint.evaluator()->num_constraints() *
-        linear_eq_constraint.variables().rows();
+        linear_eq_constraint.evaluator()->get_sparse_A().nonZeros();
   }
   constraint_lower->resize(num_constraints);
   constraint_upper->resize(num_constraints);
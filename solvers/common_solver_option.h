@@ -25,6 +25,21 @@ enum class CommonSolverOption {
    * console.
    */
   kPrintToConsole,
+  /** Drake can presolve a program before handing it to any solver: it merges
+   * the bounding box constraints, removes the variables that they fix, and
+   * drops the rows of the linear constraints that are left without variables,
+   * then maps the solution (including the dual solution) back to the original
+   * program. This only applies to programs with linear or quadratic costs,
+   * linear (equality) and bounding box constraints, and continuous variables;
+   * other programs are handed to the solver unchanged. It is independent of
+   * any presolve that the solver itself performs. The solver details in the
+   * result (see MathematicalProgramResult::get_solver_details()) describe the
+   * reduced program that the solver was given, e.g., their primal and dual
+   * values are indexed by its variables and rows. The user can call
+   * SolverOptions::SetOption(kPresolve, 1) to turn it on, or
+   * SolverOptions::SetOption(kPresolve, 0) to turn it off (the default).
+   */
+  kPresolve,
 };
 
 std::ostream& operator<<(std::ostream& os,
@@ -286,16 +286,117 @@ std::ostream& RotatedLorentzConeConstraint::DoDisplay(
                            false);
 }
 
+// A_ is deprecated for subclasses only; LinearConstraint itself stores the
+// dense A in it.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+LinearConstraint::LinearConstraint(DenseTag, Eigen::MatrixXd A,
+                                   const Eigen::Ref<const Eigen::VectorXd>& lb,
+                                   const Eigen::Ref<const Eigen::VectorXd>& ub)
+    : Constraint(A.rows(), A.cols(), lb, ub),
+      A_(std::move(A)),
+      convert_once_(std::make_unique<std::once_flag>()) {
+  DRAKE_DEMAND(A_.rows() == lb.rows());
+  DRAKE_DEMAND(A_.array().isFinite().all());
+}
+
+LinearConstraint::LinearConstraint(const Eigen::SparseMatrix<double>& A,
+                                   const Eigen::Ref<const Eigen::VectorXd>& lb,
+                                   const Eigen::Ref<const Eigen::VectorXd>& ub)
+    : Constraint(A.rows(), A.cols(), lb, ub),
+      A_sparse_(A),
+      is_sparse_(true),
+      convert_once_(std::make_unique<std::once_flag>()) {
+  DRAKE_DEMAND(A.rows() == lb.rows());
+  A_sparse_.makeCompressed();
+  DRAKE_DEMAND(Eigen::Map<const Eigen::VectorXd>(A_sparse_.valuePtr(),
+                                                 A_sparse_.nonZeros())
+                   .array()
+                   .isFinite()
+                   .all());
+}
+
+LinearConstraint::~LinearConstraint() {}
+
+const Eigen::SparseMatrix<double>& LinearConstraint::get_sparse_A() const {
+  if (!is_sparse_) {
+    std::call_once(*convert_once_, [this]() {
+      A_sparse_ = A_.sparseView();
+      A_sparse_.makeCompressed();
+    });
+  }
+  return A_sparse_;
+}
+
+const Eigen::MatrixXd& LinearConstraint::A() const {
+  if (is_sparse_) {
+    std::call_once(*convert_once_, [this]() {
+      A_ = Eigen::MatrixXd(A_sparse_);
+    });
+  }
+  return A_;
+}
+
+void LinearConstraint::UpdateDenseCoefficients(
+    Eigen::MatrixXd new_A, const Eigen::Ref<const Eigen::VectorXd>& new_lb,
+    const Eigen::Ref<const Eigen::VectorXd>& new_ub) {
+  A_ = std::move(new_A);
+  A_sparse_ = Eigen::SparseMatrix<double>();
+  is_sparse_ = false;
+  convert_once_ = std::make_unique<std::once_flag>();
+  set_num_outputs(A_.rows());
+  set_bounds(new_lb, new_ub);
+}
+
+void LinearConstraint::UpdateCoefficients(
+    const Eigen::SparseMatrix<double>& new_A,
+    const Eigen::Ref<const Eigen::VectorXd>& new_lb,
+    const Eigen::Ref<const Eigen::VectorXd>& new_ub) {
+  if (new_A.rows() != new_lb.rows() || new_lb.rows() != new_ub.rows()) {
+    throw std::runtime_error("New constraints have invalid dimensions");
+  }
+  if (new_A.cols() != num_vars()) {
+    throw std::runtime_error("Can't change the number of decision variables");
+  }
+  A_sparse_ = new_A;
+  A_sparse_.makeCompressed();
+  A_.resize(0, 0);
+  is_sparse_ = true;
+  convert_once_ = std::make_unique<std::once_flag>();
+  set_num_outputs(A_sparse_.rows());
+  set_bounds(new_lb, new_ub);
+}
+
 template <typename DerivedX, typename ScalarY>
 void LinearConstraint::DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
                                      VectorX<ScalarY>* y) const {
+  if (!is_sparse_) {
+    *y = A_ * x.template cast<ScalarY>();
+    return;
+  }
+  // Accumulate y = A x over the nonzeros of the sparse A, so that evaluating
+  // with AutoDiffXd or symbolic scalars neither forms nor locks the dense A.
   y->resize(num_constraints());
-  (*y) = A_ * x.template cast<ScalarY>();
+  y->setZero();
+  for (int j = 0; j < A_sparse_.outerSize(); ++j) {
+    const ScalarY x_j = ScalarY(x(j));
+    for (Eigen::SparseMatrix<double>::InnerIterator it(A_sparse_, j); it;
+         ++it) {
+      (*y)(it.row()) += it.value() * x_j;
+    }
+  }
 }
 
 void LinearConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                               Eigen::VectorXd* y) const {
-  DoEvalGeneric(x, y);
+  // Evaluate with the form of A that was given, so that the dense copy of a
+  // large sparse constraint is never formed by the solvers that only need
+  // values.
+  if (is_sparse_) {
+    *y = A_sparse_ * x;
+  } else {
+    *y = A_ * x;
+  }
 }
 
 void LinearConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
@@ -303,6 +404,43 @@ void LinearConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
   DoEvalGeneric(x, y);
 }
 
+bool LinearConstraint::DoEvalWithGradient(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+    EigenPtr<Eigen::VectorXd> dy_dx) const {
+  DoEval(x, y);
+  const auto& sparsity_pattern = gradient_sparsity_pattern();
+  if (!is_sparse_) {
+    if (sparsity_pattern.has_value()) {
+      for (int k = 0; k < static_cast<int>(sparsity_pattern->size()); ++k) {
+        (*dy_dx)(k) =
+            A_((*sparsity_pattern)[k].first, (*sparsity_pattern)[k].second);
+      }
+    } else {
+      // The dense gradient is A itself, stored row-major.
+      for (int i = 0; i < A_.rows(); ++i) {
+        for (int j = 0; j < A_.cols(); ++j) {
+          (*dy_dx)(i * A_.cols() + j) = A_(i, j);
+        }
+      }
+    }
+  } else if (sparsity_pattern.has_value()) {
+    for (int k = 0; k < static_cast<int>(sparsity_pattern->size()); ++k) {
+      (*dy_dx)(k) = A_sparse_.coeff((*sparsity_pattern)[k].first,
+                                    (*sparsity_pattern)[k].second);
+    }
+  } else {
+    dy_dx->setZero();
+    for (int j = 0; j < A_sparse_.outerSize(); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(A_sparse_, j); it;
+           ++it) {
+        (*dy_dx)(it.row() * A_sparse_.cols() + j) = it.value();
+      }
+    }
+  }
+  return true;
+}
+#pragma GCC diagnostic pop
+
 void LinearConstraint::DoEval(
     const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
     VectorX<symbolic::Expression>* y) const {
@@ -492,57 +630,40 @@ ExpressionConstraint::ExpressionConstraint(
                                                       &map_var_to_index_);
   }
 
-  derivatives_ = symbolic::Jacobian(expressions_, vars_);
-
-  // Setup the environment.
-  for (int i = 0; i < vars_.size(); i++) {
-    environment_.insert(vars_[i], 0.0);
-  }
+  // Compile the expressions followed by their Jacobian (in column-major
+  // order), so that the AutoDiffXd evaluation shares their subexpressions.
+  const MatrixX<symbolic::Expression> derivatives =
+      symbolic::Jacobian(expressions_, vars_);
+  VectorX<symbolic::Expression> values_and_derivatives(
+      expressions_.size() + derivatives.size());
+  values_and_derivatives << expressions_,
+      Eigen::Map<const VectorX<symbolic::Expression>>(derivatives.data(),
+                                                      derivatives.size());
+  compiled_values_ = symbolic::CompiledExpressions(expressions_, vars_);
+  compiled_values_and_derivatives_ =
+      symbolic::CompiledExpressions(values_and_derivatives, vars_);
 }
 
 void ExpressionConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                                   Eigen::VectorXd* y) const {
   DRAKE_DEMAND(x.rows() == vars_.rows());
-
-  // Set environment with current x values.
-  for (int i = 0; i < vars_.size(); i++) {
-    environment_[vars_[i]] = x(map_var_to_index_.at(vars_[i].get_id()));
-  }
-
-  // Evaluate into the output, y.
   y->resize(num_constraints());
-  for (int i = 0; i < num_constraints(); i++) {
-    (*y)[i] = expressions_[i].Evaluate(environment_);
-  }
+  compiled_values_.Evaluate(x, y);
 }
 
 void ExpressionConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
                                   AutoDiffVecXd* y) const {
   DRAKE_DEMAND(x.rows() == vars_.rows());
 
-  // Set environment with current x values.
-  for (int i = 0; i < vars_.size(); i++) {
-    environment_[vars_[i]] = x(map_var_to_index_.at(vars_[i].get_id())).value();
-  }
-
   // Evaluate value and derivatives into the output, y.
   // Using ∂yᵢ/∂zⱼ = ∑ₖ ∂fᵢ/∂xₖ ∂xₖ/∂zⱼ.
-  y->resize(num_constraints());
-  Eigen::VectorXd dyidx(x.size());
-  for (int i = 0; i < num_constraints(); i++) {
-    (*y)[i].value() = expressions_[i].Evaluate(environment_);
-    for (int k = 0; k < x.size(); k++) {
-      dyidx[k] = derivatives_(i, k).Evaluate(environment_);
-    }
-
-    (*y)[i].derivatives().resize(x(0).derivatives().size());
-    for (int j = 0; j < x(0).derivatives().size(); j++) {
-      (*y)[i].derivatives()[j] = 0.0;
-      for (int k = 0; k < x.size(); k++) {
-        (*y)[i].derivatives()[j] += dyidx[k] * x(k).derivatives()[j];
-      }
-    }
-  }
+  const Eigen::VectorXd result =
+      compiled_values_and_derivatives_.Evaluate(math::ExtractValue(x));
+  const int num_y = num_constraints();
+  const Eigen::Map<const Eigen::MatrixXd> dydx(result.data() + num_y, num_y,
+                                               x.size());
+  *y = math::InitializeAutoDiff(result.head(num_y),
+                                dydx * math::ExtractGradient(x));
 }
 
 void ExpressionConstraint::DoEval(
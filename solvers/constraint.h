@@ -4,6 +4,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -15,6 +16,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_deprecated.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/polynomial.h"
 #include "drake/common/symbolic.h"
@@ -559,22 +561,39 @@ class LinearConstraint : public Constraint {
   LinearConstraint(const Eigen::MatrixBase<DerivedA>& a,
                    const Eigen::MatrixBase<DerivedLB>& lb,
                    const Eigen::MatrixBase<DerivedUB>& ub)
-      : Constraint(a.rows(), a.cols(), lb, ub), A_(a) {
-    DRAKE_DEMAND(a.rows() == lb.rows());
-    DRAKE_DEMAND(A_.array().isFinite().all());
-  }
+      : LinearConstraint(DenseTag{}, Eigen::MatrixXd(a), lb, ub) {}
+
+  /**
+   * Overloads the constructor with a sparse A matrix. The constraint keeps A
+   * sparse; a dense copy is formed only if A() is called. Use this
+   * constructor for large constraints whose A is assembled from triplets.
+   *
+   * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+   */
+  LinearConstraint(const Eigen::SparseMatrix<double>& A,
+                   const Eigen::Ref<const Eigen::VectorXd>& lb,
+                   const Eigen::Ref<const Eigen::VectorXd>& ub);
 
-  ~LinearConstraint() override {}
+  ~LinearConstraint() override;
 
   virtual Eigen::SparseMatrix<double> GetSparseMatrix() const {
-    // TODO(eric.cousineau): Consider storing or caching sparse matrix, such
-    // that we can return a const lvalue reference.
-    return A_.sparseView();
+    return get_sparse_A();
   }
+
+  /**
+   * Returns the sparse A matrix. If this constraint was constructed from a
+   * dense matrix, the sparse copy is formed on the first call. This is safe to
+   * call concurrently; after the first call, it takes no lock.
+   */
+  const Eigen::SparseMatrix<double>& get_sparse_A() const;
+
+  /**
+   * Returns the dense A matrix. If this constraint was constructed from a
+   * sparse matrix, the dense copy is formed on the first call. This is safe to
+   * call concurrently; after the first call, it takes no lock.
+   */
   virtual const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& A()
-      const {
-    return A_;
-  }
+      const;
 
   /**
    * Updates the linear term, upper and lower bounds in the linear constraint.
@@ -595,15 +614,22 @@ class LinearConstraint : public Constraint {
       throw std::runtime_error("New constraints have invalid dimensions");
     }
 
-    if (new_A.cols() != A_.cols()) {
+    if (new_A.cols() != num_vars()) {
       throw std::runtime_error("Can't change the number of decision variables");
     }
 
-    A_ = new_A;
-    set_num_outputs(A_.rows());
-    set_bounds(new_lb, new_ub);
+    UpdateDenseCoefficients(new_A, new_lb, new_ub);
   }
 
+  /**
+   * Overloads UpdateCoefficients with a sparse A matrix.
+   *
+   * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+   */
+  void UpdateCoefficients(const Eigen::SparseMatrix<double>& new_A,
+                          const Eigen::Ref<const Eigen::VectorXd>& new_lb,
+                          const Eigen::Ref<const Eigen::VectorXd>& new_ub);
+
   using Constraint::set_bounds;
   using Constraint::UpdateLowerBound;
   using Constraint::UpdateUpperBound;
@@ -618,15 +644,42 @@ class LinearConstraint : public Constraint {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  bool DoEvalWithGradient(const Eigen::Ref<const Eigen::VectorXd>& x,
+                          Eigen::VectorXd* y,
+                          EigenPtr<Eigen::VectorXd> dy_dx) const override;
+
   std::ostream& DoDisplay(std::ostream&,
                           const VectorX<symbolic::Variable>&) const override;
 
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> A_;
+  /**
+   * The dense A matrix. If this constraint was constructed from (or last
+   * updated with) a sparse matrix, this is only populated once A() has been
+   * called. Subclasses must not modify it.
+   */
+  DRAKE_DEPRECATED("2022-09-01", "Use A() or get_sparse_A() instead.")
+  mutable Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> A_;
 
  private:
+  struct DenseTag {};
+
+  LinearConstraint(DenseTag, Eigen::MatrixXd A,
+                   const Eigen::Ref<const Eigen::VectorXd>& lb,
+                   const Eigen::Ref<const Eigen::VectorXd>& ub);
+
+  void UpdateDenseCoefficients(Eigen::MatrixXd new_A,
+                               const Eigen::Ref<const Eigen::VectorXd>& new_lb,
+                               const Eigen::Ref<const Eigen::VectorXd>& new_ub);
+
   template <typename DerivedX, typename ScalarY>
   void DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
                      VectorX<ScalarY>* y) const;
+
+  // A is stored once, in the form it was given: in A_ if it was dense, in
+  // A_sparse_ if it was sparse. The other form is a copy that A() or
+  // get_sparse_A() forms on first use, under convert_once_.
+  mutable Eigen::SparseMatrix<double> A_sparse_;
+  bool is_sparse_{false};
+  std::unique_ptr<std::once_flag> convert_once_;
 };
 
 /**
@@ -653,6 +706,15 @@ class LinearEqualityConstraint : public LinearConstraint {
                            double beq)
       : LinearEqualityConstraint(a, Vector1d(beq)) {}
 
+  /**
+   * Constructs the linear equality constraint Aeq * x = beq with a sparse Aeq.
+   *
+   * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+   */
+  LinearEqualityConstraint(const Eigen::SparseMatrix<double>& Aeq,
+                           const Eigen::Ref<const Eigen::VectorXd>& beq)
+      : LinearConstraint(Aeq, beq, beq) {}
+
   ~LinearEqualityConstraint() override {}
 
   /*
@@ -668,6 +730,16 @@ class LinearEqualityConstraint : public LinearConstraint {
     LinearConstraint::UpdateCoefficients(Aeq, beq, beq);
   }
 
+  /**
+   * Overloads UpdateCoefficients with a sparse Aeq.
+   *
+   * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+   */
+  void UpdateCoefficients(const Eigen::SparseMatrix<double>& Aeq,
+                          const Eigen::Ref<const Eigen::VectorXd>& beq) {
+    LinearConstraint::UpdateCoefficients(Aeq, beq, beq);
+  }
+
  private:
   /**
    * The user should not call this function. Call UpdateCoefficients(Aeq, beq)
@@ -996,14 +1068,15 @@ class ExpressionConstraint : public Constraint {
 
  private:
   VectorX<symbolic::Expression> expressions_{0};
-  MatrixX<symbolic::Expression> derivatives_{0, 0};
 
   // map_var_to_index_[vars_(i).get_id()] = i.
   VectorXDecisionVariable vars_{0};
   std::unordered_map<symbolic::Variable::Id, int> map_var_to_index_;
 
-  // Only for caching, does not carrying hidden state.
-  mutable symbolic::Environment environment_;
+  // The expressions_, and the expressions_ followed by their Jacobian with
+  // respect to vars_ (in column-major order), compiled for evaluation.
+  symbolic::CompiledExpressions compiled_values_;
+  symbolic::CompiledExpressions compiled_values_and_derivatives_;
 };
 
 /**
@@ -31,6 +31,21 @@ std::ostream& DisplayCost(const Cost& cost, std::ostream& os,
 
   return os;
 }
+
+// Writes the dense gradient of a scalar cost into `dy_dx`, in the layout
+// documented in EvaluatorBase::EvalWithGradient().
+void CopyCostGradient(const Cost& cost,
+                      const Eigen::Ref<const Eigen::VectorXd>& gradient,
+                      EigenPtr<Eigen::VectorXd> dy_dx) {
+  const auto& sparsity_pattern = cost.gradient_sparsity_pattern();
+  if (sparsity_pattern.has_value()) {
+    for (int k = 0; k < static_cast<int>(sparsity_pattern->size()); ++k) {
+      (*dy_dx)(k) = gradient((*sparsity_pattern)[k].second);
+    }
+  } else {
+    *dy_dx = gradient;
+  }
+}
 }  // namespace
 
 template <typename DerivedX, typename U>
@@ -54,6 +69,14 @@ void LinearCost::DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
   DoEvalGeneric(x, y);
 }
 
+bool LinearCost::DoEvalWithGradient(const Eigen::Ref<const Eigen::VectorXd>& x,
+                                    Eigen::VectorXd* y,
+                                    EigenPtr<Eigen::VectorXd> dy_dx) const {
+  DoEvalGeneric(x, y);
+  CopyCostGradient(*this, a_, dy_dx);
+  return true;
+}
+
 std::ostream& LinearCost::DoDisplay(
     std::ostream& os, const VectorX<symbolic::Variable>& vars) const {
   return DisplayCost(*this, os, "LinearCost", vars);
@@ -97,6 +120,17 @@ void QuadraticCost::DoEval(
   DoEvalGeneric(x, y);
 }
 
+bool QuadraticCost::DoEvalWithGradient(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+    EigenPtr<Eigen::VectorXd> dy_dx) const {
+  // Q_ is symmetric, so the gradient of .5 x'Qx + b'x + c is Qx + b.
+  const Eigen::VectorXd Qx = Q_ * x;
+  y->resize(1);
+  (*y)(0) = .5 * x.dot(Qx) + b_.dot(x) + c_;
+  CopyCostGradient(*this, Qx + b_, dy_dx);
+  return true;
+}
+
 std::ostream& QuadraticCost::DoDisplay(
     std::ostream& os, const VectorX<symbolic::Variable>& vars) const {
   return DisplayCost(*this, os, "QuadraticCost", vars);
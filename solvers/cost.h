@@ -90,6 +90,10 @@ class LinearCost : public Cost {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  bool DoEvalWithGradient(const Eigen::Ref<const Eigen::VectorXd>& x,
+                          Eigen::VectorXd* y,
+                          EigenPtr<Eigen::VectorXd> dy_dx) const override;
+
   std::ostream& DoDisplay(std::ostream&,
                           const VectorX<symbolic::Variable>&) const override;
 
@@ -201,6 +205,10 @@ class QuadraticCost : public Cost {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  bool DoEvalWithGradient(const Eigen::Ref<const Eigen::VectorXd>& x,
+                          Eigen::VectorXd* y,
+                          EigenPtr<Eigen::VectorXd> dy_dx) const override;
+
   std::ostream& DoDisplay(std::ostream&,
                           const VectorX<symbolic::Variable>&) const override;
 
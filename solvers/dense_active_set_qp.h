@@ -0,0 +1,472 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace solvers {
+
+/** The outcome of DenseActiveSetQp::Solve(). */
+enum class DenseActiveSetQpStatus {
+  kSolved,             ///< Found the optimal solution.
+  kInfeasible,         ///< The constraints are infeasible.
+  kNotStrictlyConvex,  ///< The Hessian is not positive definite.
+  kIterationLimit,     ///< Reached the iteration limit.
+};
+
+namespace internal {
+// A dense matrix with (possibly) bounded dynamic sizes. Eigen requires
+// matrices with at most one row to be stored in row major order.
+template <int Rows, int Cols, int MaxRows = Rows, int MaxCols = Cols>
+using DenseQpMatrix = Eigen::Matrix<
+    double, Rows, Cols,
+    (MaxRows == 1 && MaxCols != 1) ? Eigen::RowMajor : Eigen::ColMajor,
+    MaxRows, MaxCols>;
+}  // namespace internal
+
+/**
+ * Solves the strictly convex quadratic program
+ *
+ *     min ½ xᵀHx + gᵀx
+ *     s.t. lower ≤ Cx ≤ upper
+ *
+ * with a dense dual active-set method (D. Goldfarb and A. Idnani, "A
+ * numerically stable dual method for solving strictly convex quadratic
+ * programs", Mathematical Programming 27, 1983). The Hessian H must be
+ * positive definite. Bounds may be infinite; a row with lower == upper is an
+ * equality constraint.
+ *
+ * This class is meant for the small problems solved at every tick of a
+ * controller (differential inverse kinematics, centroidal MPC): it does not
+ * need a MathematicalProgram, and when the sizes are known at compile time it
+ * does not allocate any memory. The active set of the last solve is kept, and
+ * the next Solve() starts from it, which typically takes a handful of
+ * iterations (often none) when the problem changes little between the calls.
+ * See DenseActiveSetQpSolver to solve a MathematicalProgram with the same
+ * method.
+ *
+ * @tparam kNumVariables The number of variables, or Eigen::Dynamic.
+ * @tparam kNumConstraints The number of rows of C, or Eigen::Dynamic.
+ */
+template <int kNumVariables, int kNumConstraints>
+class DenseActiveSetQp {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(DenseActiveSetQp)
+
+  static_assert(kNumVariables == Eigen::Dynamic || kNumVariables > 0);
+  static_assert(kNumConstraints == Eigen::Dynamic || kNumConstraints >= 0);
+
+  using HessianMatrix = internal::DenseQpMatrix<kNumVariables, kNumVariables>;
+  using VariableVector = internal::DenseQpMatrix<kNumVariables, 1>;
+  using ConstraintMatrix =
+      internal::DenseQpMatrix<kNumConstraints, kNumVariables>;
+  using ConstraintVector = internal::DenseQpMatrix<kNumConstraints, 1>;
+
+  /** The bound at which a constraint is active. */
+  enum class ActiveBound { kNone, kLower, kUpper };
+
+  /**
+   * Constructs the solver for the given sizes, which only need to be passed
+   * when they are dynamic. The active set starts empty.
+   * @throws std::exception if a size is negative, or differs from a fixed
+   * size.
+   */
+  explicit DenseActiveSetQp(int num_variables = kNumVariables,
+                            int num_constraints = kNumConstraints)
+      : num_variables_(num_variables), num_constraints_(num_constraints) {
+    DRAKE_THROW_UNLESS(num_variables >= 0 && num_constraints >= 0);
+    DRAKE_THROW_UNLESS(kNumVariables == Eigen::Dynamic ||
+                       num_variables == kNumVariables);
+    DRAKE_THROW_UNLESS(kNumConstraints == Eigen::Dynamic ||
+                       num_constraints == kNumConstraints);
+    const int n = num_variables;
+    const int m = num_constraints;
+    max_active_ = std::min(n, m);
+    max_iterations_ = 10 * (n + m);
+    x_.setZero(n);
+    Hinv_g_.setZero(n);
+    Hinv_n_.setZero(n);
+    n_plus_.setZero(n);
+    z_.setZero(n);
+    Cx_.setZero(m);
+    dual_.setZero(m);
+    side_.setZero(m);
+    active_.setZero(max_active_);
+    u_.setZero(max_active_);
+    r_.setZero(max_active_);
+    b_.setZero(max_active_);
+    N_.setZero(max_active_, n);
+    Hinv_Nt_.setZero(n, max_active_);
+    M_.setZero(max_active_, max_active_);
+  }
+
+  int num_variables() const { return num_variables_; }
+  int num_constraints() const { return num_constraints_; }
+
+  /** The maximum number of iterations of Solve(), where an iteration adds
+   * or removes a constraint of the active set. Defaults to
+   * 10 * (num_variables() + num_constraints()). */
+  int max_iterations() const { return max_iterations_; }
+  void set_max_iterations(int max_iterations) {
+    DRAKE_THROW_UNLESS(max_iterations >= 0);
+    max_iterations_ = max_iterations;
+  }
+
+  /** A constraint is violated when it is violated by more than this
+   * tolerance, relative to max(1, |bound|). Defaults to 1E-9. */
+  double feasibility_tolerance() const { return feasibility_tolerance_; }
+  void set_feasibility_tolerance(double feasibility_tolerance) {
+    DRAKE_THROW_UNLESS(feasibility_tolerance >= 0);
+    feasibility_tolerance_ = feasibility_tolerance;
+  }
+
+  /** Returns the bound at which constraint i is in the active set. After a
+   * successful Solve(), this is the optimal active set. */
+  ActiveBound active_bound(int i) const {
+    DRAKE_ASSERT(i >= 0 && i < num_constraints_);
+    return side_(i) > 0   ? ActiveBound::kLower
+           : side_(i) < 0 ? ActiveBound::kUpper
+                          : ActiveBound::kNone;
+  }
+
+  /** Sets the bound at which constraint i is in the active set the next
+   * Solve() starts from. Solve() discards the constraints of this guess that
+   * are linearly dependent on the previous ones, or whose bound is
+   * infinite. */
+  void set_active_bound(int i, ActiveBound bound) {
+    DRAKE_THROW_UNLESS(i >= 0 && i < num_constraints_);
+    side_(i) = bound == ActiveBound::kLower   ? 1
+               : bound == ActiveBound::kUpper ? -1
+                                              : 0;
+  }
+
+  /** Empties the active set, so that the next Solve() starts cold. */
+  void ResetActiveSet() { side_.setZero(); }
+
+  /**
+   * Solves the program, starting from the current active set.
+   * @throws std::exception if the sizes of the arguments do not match
+   * num_variables() and num_constraints().
+   */
+  DenseActiveSetQpStatus Solve(const HessianMatrix& H, const VariableVector& g,
+                               const ConstraintMatrix& C,
+                               const ConstraintVector& lower,
+                               const ConstraintVector& upper) {
+    const int n = num_variables_;
+    const int m = num_constraints_;
+    DRAKE_THROW_UNLESS(H.rows() == n && H.cols() == n && g.rows() == n);
+    DRAKE_THROW_UNLESS(C.rows() == m && C.cols() == n);
+    DRAKE_THROW_UNLESS(lower.rows() == m && upper.rows() == m);
+    num_iterations_ = 0;
+    llt_H_.compute(H);
+    if (llt_H_.info() != Eigen::Success) {
+      return DenseActiveSetQpStatus::kNotStrictlyConvex;
+    }
+    Hinv_g_ = llt_H_.solve(g);
+
+    // Rebuild the starting active set, keeping the independent constraints.
+    num_active_ = 0;
+    for (int i = 0; i < m; ++i) {
+      if (side_(i) == 0) continue;
+      if (num_active_ == max_active_ || std::isinf(Bound(i, lower, upper))) {
+        side_(i) = 0;
+        continue;
+      }
+      Append(i, C, lower, upper);
+      if (!Factor()) {
+        --num_active_;
+        side_(i) = 0;
+      }
+    }
+    Factor();
+    // Drop the constraints with negative multipliers until the solution of
+    // the equality constrained problem is dual feasible.
+    while (true) {
+      SolveEqualityConstrained();
+      const int j = FlipEqualitiesAndFindNegativeMultiplier(lower, upper);
+      if (j < 0) break;
+      Remove(j);
+      Factor();
+    }
+
+    while (true) {
+      // Look for the most violated constraint.
+      Cx_.noalias() = C * x_;
+      int p = -1;
+      int p_side = 0;
+      double p_violation = 0;
+      for (int i = 0; i < m; ++i) {
+        if (side_(i) != 0) continue;
+        const double lower_violation = lower(i) - Cx_(i);
+        const double upper_violation = Cx_(i) - upper(i);
+        if (lower_violation > Tolerance(lower(i)) &&
+            lower_violation > p_violation) {
+          p = i;
+          p_side = 1;
+          p_violation = lower_violation;
+        } else if (upper_violation > Tolerance(upper(i)) &&
+                   upper_violation > p_violation) {
+          p = i;
+          p_side = -1;
+          p_violation = upper_violation;
+        }
+      }
+      if (p < 0) {
+        return Finish(DenseActiveSetQpStatus::kSolved);
+      }
+      // The side of p is set now, so that p can be appended once it becomes
+      // active; it is reset if the iterations stop before that.
+      side_(p) = p_side;
+      n_plus_ = p_side * C.row(p).transpose();
+      const double b_plus = Bound(p, lower, upper);
+      double u_plus = 0;
+      while (true) {
+        if (num_iterations_ == max_iterations_) {
+          side_(p) = 0;
+          return Finish(DenseActiveSetQpStatus::kIterationLimit);
+        }
+        ++num_iterations_;
+        // Step direction in the primal (z) and dual (r) spaces.
+        const int k = num_active_;
+        Hinv_n_ = llt_H_.solve(n_plus_);
+        if (k > 0) {
+          r_.head(k) = llt_M_.solve(N_.topRows(k) * Hinv_n_);
+          z_.noalias() = Hinv_n_ - Hinv_Nt_.leftCols(k) * r_.head(k);
+        } else {
+          z_ = Hinv_n_;
+        }
+        const double zn = z_.dot(n_plus_);
+        const bool dependent =
+            k == max_active_ ||
+            zn <= kDependenceTolerance * n_plus_.dot(Hinv_n_);
+        // The full step makes p active; the partial step makes the
+        // multiplier of an active inequality vanish.
+        const double kInf = std::numeric_limits<double>::infinity();
+        const double t_full =
+            dependent ? kInf : (b_plus - n_plus_.dot(x_)) / zn;
+        double t_partial = kInf;
+        int blocking = -1;
+        for (int j = 0; j < k; ++j) {
+          const int i = active_(j);
+          if (lower(i) == upper(i) || r_(j) <= 0) continue;
+          const double t = u_(j) / r_(j);
+          if (t < t_partial) {
+            t_partial = t;
+            blocking = j;
+          }
+        }
+        const double t = std::min(t_full, t_partial);
+        if (t == kInf) {
+          side_(p) = 0;
+          return Finish(DenseActiveSetQpStatus::kInfeasible);
+        }
+        if (!dependent) {
+          x_ += t * z_;
+        }
+        u_.head(k) -= t * r_.head(k);
+        u_plus += t;
+        if (t_full <= t_partial) {
+          active_(k) = p;
+          u_(k) = u_plus;
+          ++num_active_;
+          SetRow(k, C, lower, upper);
+          // An equality whose multiplier became negative is active at its
+          // other side.
+          FlipEqualitiesAndFindNegativeMultiplier(lower, upper);
+          Factor();
+          SolveEqualityConstrained();
+          break;
+        }
+        Remove(blocking);
+        FlipEqualitiesAndFindNegativeMultiplier(lower, upper);
+        Factor();
+      }
+    }
+  }
+
+  /** The solution of the last Solve(). */
+  const VariableVector& x() const { return x_; }
+
+  /** The multipliers of the constraints at the solution of the last Solve(),
+   * with the sign convention of MathematicalProgramResult::GetDualSolution():
+   * non-negative when the lower bound is active, non-positive when the upper
+   * bound is active, and zero for inactive constraints. */
+  const ConstraintVector& dual() const { return dual_; }
+
+  /** The number of iterations of the last Solve(). */
+  int num_iterations() const { return num_iterations_; }
+
+  /** The number of constraints in the active set. */
+  int num_active() const { return num_active_; }
+
+ private:
+  // The active constraints are linearly independent, hence at most
+  // min(num_variables, num_constraints) of them.
+  static constexpr int kMaxActive =
+      kNumVariables == Eigen::Dynamic     ? kNumConstraints
+      : kNumConstraints == Eigen::Dynamic ? kNumVariables
+                                          : std::min(kNumVariables,
+                                                     kNumConstraints);
+  // A new constraint is linearly dependent on the active ones if its normal
+  // n has no component zᵀn, in the metric of H⁻¹, beyond this fraction of
+  // nᵀH⁻¹n.
+  static constexpr double kDependenceTolerance = 1E-10;
+
+  using ActiveVector =
+      internal::DenseQpMatrix<Eigen::Dynamic, 1, kMaxActive, 1>;
+  using ActiveIndices =
+      Eigen::Matrix<int, Eigen::Dynamic, 1, Eigen::ColMajor, kMaxActive, 1>;
+  using ConstraintSides = Eigen::Matrix<int, kNumConstraints, 1>;
+  using ActiveMatrix =
+      internal::DenseQpMatrix<Eigen::Dynamic, kNumVariables, kMaxActive,
+                              kNumVariables>;
+  using ActiveTransposeMatrix =
+      internal::DenseQpMatrix<kNumVariables, Eigen::Dynamic, kNumVariables,
+                              kMaxActive>;
+  using ActiveSquareMatrix =
+      internal::DenseQpMatrix<Eigen::Dynamic, Eigen::Dynamic, kMaxActive,
+                              kMaxActive>;
+
+  // Each active constraint i is written nᵢᵀx ≥ bᵢ, with nᵢ = ±C.row(i).
+  double Bound(int i, const ConstraintVector& lower,
+               const ConstraintVector& upper) const {
+    return side_(i) > 0 ? lower(i) : -upper(i);
+  }
+
+  double Tolerance(double bound) const {
+    return feasibility_tolerance_ * std::max(1.0, std::abs(bound));
+  }
+
+  void SetRow(int j, const ConstraintMatrix& C, const ConstraintVector& lower,
+              const ConstraintVector& upper) {
+    const int i = active_(j);
+    N_.row(j) = side_(i) * C.row(i);
+    b_(j) = Bound(i, lower, upper);
+  }
+
+  // Appends constraint i to the active set with a zero multiplier.
+  void Append(int i, const ConstraintMatrix& C, const ConstraintVector& lower,
+              const ConstraintVector& upper) {
+    active_(num_active_) = i;
+    u_(num_active_) = 0;
+    SetRow(num_active_, C, lower, upper);
+    ++num_active_;
+  }
+
+  // Removes the j'th constraint of the active set.
+  void Remove(int j) {
+    side_(active_(j)) = 0;
+    for (int l = j + 1; l < num_active_; ++l) {
+      active_(l - 1) = active_(l);
+      u_(l - 1) = u_(l);
+      b_(l - 1) = b_(l);
+      N_.row(l - 1) = N_.row(l);
+    }
+    --num_active_;
+  }
+
+  // Factors M = N H⁻¹ Nᵀ for the active set; returns false if the active
+  // constraints are (numerically) linearly dependent.
+  bool Factor() {
+    const int k = num_active_;
+    if (k == 0) return true;
+    Hinv_Nt_.leftCols(k) = llt_H_.solve(N_.topRows(k).transpose());
+    M_.topLeftCorner(k, k).noalias() =
+        N_.topRows(k) * Hinv_Nt_.leftCols(k);
+    llt_M_.compute(M_.topLeftCorner(k, k));
+    if (llt_M_.info() != Eigen::Success) return false;
+    const auto L_diagonal = llt_M_.matrixLLT().diagonal();
+    return L_diagonal.minCoeff() * L_diagonal.minCoeff() >
+           kDependenceTolerance * M_.diagonal().head(k).maxCoeff();
+  }
+
+  // Solves min ½ xᵀHx + gᵀx s.t. N x = b, which gives the multipliers
+  //   M u = b + N H⁻¹ g
+  // and the solution x = H⁻¹(Nᵀu − g).
+  void SolveEqualityConstrained() {
+    const int k = num_active_;
+    if (k == 0) {
+      x_ = -Hinv_g_;
+      return;
+    }
+    r_.head(k) = b_.head(k);
+    r_.head(k).noalias() += N_.topRows(k) * Hinv_g_;
+    u_.head(k) = llt_M_.solve(r_.head(k));
+    x_.noalias() = Hinv_Nt_.leftCols(k) * u_.head(k);
+    x_ -= Hinv_g_;
+  }
+
+  // Moves the active equality constraints with negative multipliers to their
+  // other side, and returns the index in the active set of the inequality
+  // with the most negative multiplier, or -1 if there is none.
+  int FlipEqualitiesAndFindNegativeMultiplier(const ConstraintVector& lower,
+                                              const ConstraintVector& upper) {
+    int most_negative = -1;
+    for (int j = 0; j < num_active_; ++j) {
+      if (u_(j) >= 0) continue;
+      const int i = active_(j);
+      if (lower(i) == upper(i)) {
+        side_(i) = -side_(i);
+        u_(j) = -u_(j);
+        N_.row(j) = -N_.row(j);
+        b_(j) = -b_(j);
+      } else if (most_negative < 0 || u_(j) < u_(most_negative)) {
+        most_negative = j;
+      }
+    }
+    return most_negative;
+  }
+
+  DenseActiveSetQpStatus Finish(DenseActiveSetQpStatus status) {
+    dual_.setZero();
+    for (int j = 0; j < num_active_; ++j) {
+      dual_(active_(j)) = side_(active_(j)) * u_(j);
+    }
+    return status;
+  }
+
+  int num_variables_{};
+  int num_constraints_{};
+  int max_active_{};
+  int max_iterations_{};
+  double feasibility_tolerance_{1E-9};
+  int num_iterations_{0};
+
+  // The active set: the indices of the active constraints, in the order in
+  // which they were added, and the side of every constraint (1 for the lower
+  // bound, -1 for the upper bound, 0 if inactive).
+  int num_active_{0};
+  ActiveIndices active_;
+  ConstraintSides side_;
+
+  // The primal and dual iterates.
+  VariableVector x_;
+  ActiveVector u_;
+  ConstraintVector dual_;
+
+  // The rows N and bounds b of the active constraints, and the factorizations.
+  ActiveMatrix N_;
+  ActiveVector b_;
+  Eigen::LLT<HessianMatrix> llt_H_;
+  ActiveTransposeMatrix Hinv_Nt_;
+  ActiveSquareMatrix M_;
+  Eigen::LLT<ActiveSquareMatrix> llt_M_;
+
+  // Workspace.
+  VariableVector Hinv_g_;
+  VariableVector Hinv_n_;
+  VariableVector n_plus_;
+  VariableVector z_;
+  ActiveVector r_;
+  ConstraintVector Cx_;
+};
+
+}  // namespace solvers
+}  // namespace drake
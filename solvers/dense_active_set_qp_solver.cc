@@ -0,0 +1,263 @@
+#include "drake/solvers/dense_active_set_qp_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/never_destroyed.h"
+#include "drake/common/text_logging.h"
+#include "drake/solvers/dense_active_set_qp.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+
+using DynamicQp = DenseActiveSetQp<Eigen::Dynamic, Eigen::Dynamic>;
+
+// The program min ½ xᵀHx + gᵀx + constant s.t. lower ≤ Cx ≤ upper.
+struct DenseQpProblem {
+  Eigen::MatrixXd H;
+  Eigen::VectorXd g;
+  double constant{0};
+  Eigen::MatrixXd C;
+  Eigen::VectorXd lower;
+  Eigen::VectorXd upper;
+  // The first row of each constraint in C.
+  std::unordered_map<Binding<Constraint>, int> constraint_start_row;
+};
+
+template <typename C>
+void ParseLinearConstraints(const MathematicalProgram& prog,
+                            const std::vector<Binding<C>>& constraints,
+                            DenseQpProblem* problem, int* num_rows) {
+  for (const auto& binding : constraints) {
+    const std::vector<int> x_indices =
+        prog.FindDecisionVariableIndices(binding.variables());
+    const Eigen::SparseMatrix<double>& A = binding.evaluator()->get_sparse_A();
+    for (int j = 0; j < A.outerSize(); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(A, j); it; ++it) {
+        problem->C(*num_rows + it.row(), x_indices[j]) += it.value();
+      }
+    }
+    const int n = binding.evaluator()->num_constraints();
+    problem->lower.segment(*num_rows, n) = binding.evaluator()->lower_bound();
+    problem->upper.segment(*num_rows, n) = binding.evaluator()->upper_bound();
+    problem->constraint_start_row.emplace(
+        internal::BindingDynamicCast<Constraint>(binding), *num_rows);
+    *num_rows += n;
+  }
+}
+
+DenseQpProblem ParseDenseQpProblem(const MathematicalProgram& prog) {
+  const int num_vars = prog.num_vars();
+  DenseQpProblem problem;
+  problem.H = Eigen::MatrixXd::Zero(num_vars, num_vars);
+  problem.g = Eigen::VectorXd::Zero(num_vars);
+  for (const auto& binding : prog.quadratic_costs()) {
+    const std::vector<int> x_indices =
+        prog.FindDecisionVariableIndices(binding.variables());
+    const auto& Q = binding.evaluator()->Q();
+    const auto& b = binding.evaluator()->b();
+    for (int i = 0; i < static_cast<int>(x_indices.size()); ++i) {
+      for (int j = 0; j < static_cast<int>(x_indices.size()); ++j) {
+        problem.H(x_indices[i], x_indices[j]) += Q(i, j);
+      }
+      problem.g(x_indices[i]) += b(i);
+    }
+    problem.constant += binding.evaluator()->c();
+  }
+  for (const auto& binding : prog.linear_costs()) {
+    const std::vector<int> x_indices =
+        prog.FindDecisionVariableIndices(binding.variables());
+    for (int i = 0; i < static_cast<int>(x_indices.size()); ++i) {
+      problem.g(x_indices[i]) += binding.evaluator()->a()(i);
+    }
+    problem.constant += binding.evaluator()->b();
+  }
+
+  int num_rows = 0;
+  for (const auto& binding : prog.GetAllLinearConstraints()) {
+    num_rows += binding.evaluator()->num_constraints();
+  }
+  for (const auto& binding : prog.bounding_box_constraints()) {
+    num_rows += binding.evaluator()->num_constraints();
+  }
+  problem.C = Eigen::MatrixXd::Zero(num_rows, num_vars);
+  problem.lower.resize(num_rows);
+  problem.upper.resize(num_rows);
+  num_rows = 0;
+  ParseLinearConstraints(prog, prog.linear_constraints(), &problem,
+                         &num_rows);
+  ParseLinearConstraints(prog, prog.linear_equality_constraints(), &problem,
+                         &num_rows);
+  for (const auto& binding : prog.bounding_box_constraints()) {
+    const int n = binding.evaluator()->num_constraints();
+    for (int i = 0; i < n; ++i) {
+      problem.C(num_rows + i,
+                prog.FindDecisionVariableIndex(binding.variables()(i))) = 1;
+    }
+    problem.lower.segment(num_rows, n) = binding.evaluator()->lower_bound();
+    problem.upper.segment(num_rows, n) = binding.evaluator()->upper_bound();
+    problem.constraint_start_row.emplace(
+        internal::BindingDynamicCast<Constraint>(binding), num_rows);
+    num_rows += n;
+  }
+  return problem;
+}
+
+void SetDenseActiveSetQpOptions(const SolverOptions& solver_options,
+                                DynamicQp* qp) {
+  DRAKE_ASSERT_VOID(solver_options.CheckOptionKeysForSolver(
+      DenseActiveSetQpSolver::id(),
+      {DenseActiveSetQpSolver::FeasibilityTolOptionName()},
+      {DenseActiveSetQpSolver::MaxIterationsOptionName()}, {}));
+  const auto& options_double =
+      solver_options.GetOptionsDouble(DenseActiveSetQpSolver::id());
+  const auto& options_int =
+      solver_options.GetOptionsInt(DenseActiveSetQpSolver::id());
+  const auto tol =
+      options_double.find(DenseActiveSetQpSolver::FeasibilityTolOptionName());
+  if (tol != options_double.end()) {
+    if (!(tol->second >= 0)) {
+      throw std::invalid_argument(
+          "FeasibilityTol should be a non-negative number.");
+    }
+    qp->set_feasibility_tolerance(tol->second);
+  }
+  const auto max_iterations =
+      options_int.find(DenseActiveSetQpSolver::MaxIterationsOptionName());
+  if (max_iterations != options_int.end()) {
+    if (max_iterations->second < 0) {
+      throw std::invalid_argument(
+          "MaxIterations should be a non-negative number.");
+    }
+    qp->set_max_iterations(max_iterations->second);
+  }
+}
+
+template <typename C>
+void SetDualSolutions(const std::vector<Binding<C>>& constraints,
+                      const DenseQpProblem& problem,
+                      const Eigen::VectorXd& dual,
+                      MathematicalProgramResult* result) {
+  for (const auto& binding : constraints) {
+    const Binding<Constraint> binding_cast =
+        internal::BindingDynamicCast<Constraint>(binding);
+    result->set_dual_solution(
+        binding,
+        dual.segment(problem.constraint_start_row.at(binding_cast),
+                     binding.evaluator()->num_constraints()));
+  }
+}
+}  // namespace
+
+DenseActiveSetQpSolver::DenseActiveSetQpSolver()
+    : SolverBase(&id, &is_available, &is_enabled,
+                 &ProgramAttributesSatisfied) {}
+
+DenseActiveSetQpSolver::~DenseActiveSetQpSolver() = default;
+
+void DenseActiveSetQpSolver::DoSolve(
+    const MathematicalProgram& prog,
+    const Eigen::VectorXd& initial_guess,
+    const SolverOptions& merged_options,
+    MathematicalProgramResult* result) const {
+  if (!prog.GetVariableScaling().empty()) {
+    static const logging::Warn log_once(
+        "DenseActiveSetQpSolver doesn't support the feature of variable "
+        "scaling.");
+  }
+
+  const DenseQpProblem problem = ParseDenseQpProblem(prog);
+  DynamicQp qp(problem.H.rows(), problem.C.rows());
+  SetDenseActiveSetQpOptions(merged_options, &qp);
+
+  // Start from the constraints that are active at the initial guess.
+  if (initial_guess.array().isFinite().all()) {
+    const Eigen::VectorXd Cx = problem.C * initial_guess;
+    auto is_active = [tol = qp.feasibility_tolerance()](double value,
+                                                          double bound) {
+      return std::isfinite(bound) &&
+             std::abs(value - bound) <= tol * std::max(1.0, std::abs(bound));
+    };
+    for (int i = 0; i < Cx.rows(); ++i) {
+      if (is_active(Cx(i), problem.lower(i))) {
+        qp.set_active_bound(i, DynamicQp::ActiveBound::kLower);
+      } else if (is_active(Cx(i), problem.upper(i))) {
+        qp.set_active_bound(i, DynamicQp::ActiveBound::kUpper);
+      }
+    }
+  }
+
+  SolutionResult solution_result{SolutionResult::kUnknownError};
+  double optimal_cost{NAN};
+  switch (qp.Solve(problem.H, problem.g, problem.C, problem.lower,
+                   problem.upper)) {
+    case DenseActiveSetQpStatus::kSolved: {
+      solution_result = SolutionResult::kSolutionFound;
+      const Eigen::VectorXd& x = qp.x();
+      optimal_cost =
+          0.5 * x.dot(problem.H * x) + problem.g.dot(x) + problem.constant;
+      break;
+    }
+    case DenseActiveSetQpStatus::kInfeasible: {
+      solution_result = SolutionResult::kInfeasibleConstraints;
+      optimal_cost = MathematicalProgram::kGlobalInfeasibleCost;
+      break;
+    }
+    case DenseActiveSetQpStatus::kNotStrictlyConvex: {
+      solution_result = SolutionResult::kInvalidInput;
+      break;
+    }
+    case DenseActiveSetQpStatus::kIterationLimit: {
+      solution_result = SolutionResult::kIterationLimit;
+      break;
+    }
+  }
+  result->set_x_val(qp.x());
+  result->set_solution_result(solution_result);
+  result->set_optimal_cost(optimal_cost);
+  if (solution_result == SolutionResult::kSolutionFound) {
+    SetDualSolutions(prog.linear_constraints(), problem, qp.dual(), result);
+    SetDualSolutions(prog.linear_equality_constraints(), problem, qp.dual(),
+                     result);
+    SetDualSolutions(prog.bounding_box_constraints(), problem, qp.dual(),
+                     result);
+  }
+}
+
+std::string DenseActiveSetQpSolver::FeasibilityTolOptionName() {
+  return "FeasibilityTol";
+}
+
+std::string DenseActiveSetQpSolver::MaxIterationsOptionName() {
+  return "MaxIterations";
+}
+
+SolverId DenseActiveSetQpSolver::id() {
+  static const never_destroyed<SolverId> singleton{"Dense active-set QP"};
+  return singleton.access();
+}
+
+bool DenseActiveSetQpSolver::is_available() { return true; }
+
+bool DenseActiveSetQpSolver::is_enabled() { return true; }
+
+bool DenseActiveSetQpSolver::ProgramAttributesSatisfied(
+    const MathematicalProgram& prog) {
+  static const never_destroyed<ProgramAttributes> solver_capabilities(
+      std::initializer_list<ProgramAttribute>{
+          ProgramAttribute::kQuadraticCost, ProgramAttribute::kLinearCost,
+          ProgramAttribute::kLinearConstraint,
+          ProgramAttribute::kLinearEqualityConstraint});
+  return AreRequiredAttributesSupported(prog.required_capabilities(),
+                                        solver_capabilities.access());
+}
+
+}  // namespace solvers
+}  // namespace drake
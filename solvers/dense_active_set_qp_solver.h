@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/solvers/solver_base.h"
+
+namespace drake {
+namespace solvers {
+
+/**
+ * Solves a strictly convex quadratic program, with linear constraints and
+ * bounding boxes, with the dense active-set method of DenseActiveSetQp. The
+ * sum of the quadratic costs must have a positive definite Hessian; otherwise
+ * the result is SolutionResult::kInvalidInput.
+ *
+ * This solver is meant for small problems (a few tens of variables), where it
+ * is typically faster than the sparse solvers. It is never chosen by
+ * ChooseBestSolver(); instantiate it explicitly. Controllers that solve the
+ * same small problem at every tick should rather use DenseActiveSetQp
+ * directly, which avoids building the MathematicalProgram and keeps the active
+ * set between the solves.
+ *
+ * The initial guess, if it is set, seeds the active set with the constraints
+ * that are active at the initial guess.
+ *
+ * The user can set the following options:
+ *
+ * - FeasibilityTolOptionName(). See
+ *   DenseActiveSetQp::feasibility_tolerance().
+ * - MaxIterationsOptionName(). See DenseActiveSetQp::max_iterations().
+ */
+class DenseActiveSetQpSolver final : public SolverBase {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DenseActiveSetQpSolver)
+
+  DenseActiveSetQpSolver();
+  ~DenseActiveSetQpSolver() final;
+
+  /// @returns string key for SolverOptions to set the feasibility tolerance.
+  static std::string FeasibilityTolOptionName();
+
+  /// @returns string key for SolverOptions to set the maximum number of
+  /// iterations.
+  static std::string MaxIterationsOptionName();
+
+  /// @name Static versions of the instance methods with similar names.
+  //@{
+  static SolverId id();
+  static bool is_available();
+  static bool is_enabled();
+  static bool ProgramAttributesSatisfied(const MathematicalProgram&);
+  //@}
+
+  // A using-declaration adds these methods into our class's Doxygen.
+  using SolverBase::Solve;
+
+ private:
+  void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
+               const SolverOptions&, MathematicalProgramResult*) const final;
+};
+
+}  // namespace solvers
+}  // namespace drake
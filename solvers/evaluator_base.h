@@ -74,6 +74,38 @@ class EvaluatorBase {
     DRAKE_ASSERT(y->rows() == num_outputs_);
   }
 
+  /**
+   * Evaluates the expression together with its gradient ∂y/∂x, using only
+   * double arithmetic. This avoids the per-scalar derivative allocations of
+   * the AutoDiffXd overload of Eval(), but is only available for evaluators
+   * that override DoEvalWithGradient().
+   * @param[in] x A `num_vars` x 1 input vector.
+   * @param[out] y A `num_outputs` x 1 output vector.
+   * @param[out] dy_dx The entries of ∂y/∂x, pre-sized by the caller. If
+   * gradient_sparsity_pattern() has a value, then dy_dx(k) is the entry at
+   * the k'th (row_index, col_index) pair of that pattern. Otherwise dy_dx has
+   * `num_outputs * x.rows()` entries, storing the dense gradient in row-major
+   * order, namely dy_dx(i * x.rows() + j) = ∂yᵢ/∂xⱼ.
+   * @retval false if this evaluator does not implement DoEvalWithGradient();
+   * `y` and `dy_dx` are then unspecified and the caller should fall back to
+   * the AutoDiffXd overload of Eval().
+   */
+  bool EvalWithGradient(const Eigen::Ref<const Eigen::VectorXd>& x,
+                        Eigen::VectorXd* y,
+                        EigenPtr<Eigen::VectorXd> dy_dx) const {
+    DRAKE_ASSERT(x.rows() == num_vars_ || num_vars_ == Eigen::Dynamic);
+    DRAKE_ASSERT(dy_dx != nullptr);
+    DRAKE_ASSERT(dy_dx->rows() ==
+                 (gradient_sparsity_pattern_.has_value()
+                      ? static_cast<int>(gradient_sparsity_pattern_->size())
+                      : num_outputs_ * static_cast<int>(x.rows())));
+    if (!DoEvalWithGradient(x, y, dy_dx)) {
+      return false;
+    }
+    DRAKE_ASSERT(y->rows() == num_outputs_);
+    return true;
+  }
+
   /**
    * Set a human-friendly description for the evaluator.
    */
@@ -181,6 +213,18 @@ class EvaluatorBase {
   virtual void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
                       VectorX<symbolic::Expression>* y) const = 0;
 
+  /**
+   * Implements EvalWithGradient(). The default implementation returns false,
+   * meaning that solvers compute the gradient through the AutoDiffXd overload
+   * of DoEval() instead. Subclasses that override this must return true and
+   * write `y` and `dy_dx` in the layout documented in EvalWithGradient().
+   */
+  virtual bool DoEvalWithGradient(const Eigen::Ref<const Eigen::VectorXd>&,
+                                  Eigen::VectorXd*,
+                                  EigenPtr<Eigen::VectorXd>) const {
+    return false;
+  }
+
   /**
    * NVI implementation of Display. The default implementation will report
    * the NiceTypeName, get_description, and list the bound variables.
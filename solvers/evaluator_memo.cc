@@ -0,0 +1,119 @@
+#include "drake/solvers/evaluator_memo.h"
+
+#include <cstring>
+#include <utility>
+
+#include "drake/common/hash.h"
+#include "drake/math/autodiff.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+
+namespace {
+
+bool BitwiseEqual(const Eigen::Ref<const Eigen::VectorXd>& a,
+                  const Eigen::Ref<const Eigen::VectorXd>& b) {
+  return a.size() == b.size() &&
+         std::memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0;
+}
+
+}  // namespace
+
+void EvalValueAndGradient(const EvaluatorBase& evaluator,
+                          const Eigen::Ref<const Eigen::VectorXd>& x,
+                          MemoizedEvaluation* result) {
+  DRAKE_DEMAND(result != nullptr);
+  const auto& gradient_sparsity_pattern =
+      evaluator.gradient_sparsity_pattern();
+  const int num_outputs = evaluator.num_outputs();
+  const int num_vars = x.size();
+  result->dy_dx.resize(gradient_sparsity_pattern.has_value()
+                           ? static_cast<int>(gradient_sparsity_pattern->size())
+                           : num_outputs * num_vars);
+  if (evaluator.EvalWithGradient(x, &result->y, &result->dy_dx)) {
+    return;
+  }
+
+  AutoDiffVecXd ty(num_outputs);
+  evaluator.Eval(math::InitializeAutoDiff(x), &ty);
+  result->y = math::ExtractValue(ty);
+  // An entry of ty whose derivatives are empty doesn't depend on x.
+  const auto derivative = [&ty](int i, int j) {
+    return ty(i).derivatives().size() > 0 ? ty(i).derivatives()(j) : 0.0;
+  };
+  if (gradient_sparsity_pattern.has_value()) {
+    int k = 0;
+    for (const auto& [i, j] : *gradient_sparsity_pattern) {
+      result->dy_dx(k++) = derivative(i, j);
+    }
+  } else {
+    for (int i = 0; i < num_outputs; ++i) {
+      for (int j = 0; j < num_vars; ++j) {
+        result->dy_dx(i * num_vars + j) = derivative(i, j);
+      }
+    }
+  }
+}
+
+const MemoizedEvaluation& EvaluatorMemo::Eval(
+    const EvaluatorBase& evaluator,
+    const Eigen::Ref<const Eigen::VectorXd>& x) {
+  Key key{&evaluator, x};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto iter = memo_.find(key);
+    if (iter != memo_.end()) {
+      return iter->second;
+    }
+  }
+  // Evaluate outside the lock, so that other bindings can be evaluated
+  // meanwhile. If another thread evaluates the same key concurrently, the
+  // first to finish wins; the results are identical either way.
+  MemoizedEvaluation result;
+  EvalValueAndGradient(evaluator, x, &result);
+  std::lock_guard<std::mutex> lock(mutex_);
+  return memo_.emplace(std::move(key), std::move(result)).first->second;
+}
+
+const MemoizedEvaluation* EvaluatorMemo::Find(
+    const EvaluatorBase& evaluator,
+    const Eigen::Ref<const Eigen::VectorXd>& x) const {
+  const Key key{&evaluator, x};
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto iter = memo_.find(key);
+  return iter != memo_.end() ? &iter->second : nullptr;
+}
+
+void EvaluatorMemo::Clear() {
+  memo_.clear();
+}
+
+void EvaluatorMemo::Reset(
+    const Eigen::Ref<const Eigen::VectorXd>& decision_variables) {
+  if (!BitwiseEqual(decision_variables, decision_variables_)) {
+    memo_.clear();
+    decision_variables_ = decision_variables;
+  }
+}
+
+int EvaluatorMemo::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int>(memo_.size());
+}
+
+size_t EvaluatorMemo::KeyHash::operator()(const Key& key) const noexcept {
+  DefaultHasher hasher;
+  hash_append(hasher, reinterpret_cast<uintptr_t>(key.evaluator));
+  hasher(key.x.data(), key.x.size() * sizeof(double));
+  return static_cast<size_t>(hasher);
+}
+
+bool EvaluatorMemo::KeyEqual::operator()(const Key& a,
+                                         const Key& b) const noexcept {
+  return a.evaluator == b.evaluator && BitwiseEqual(a.x, b.x);
+}
+
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
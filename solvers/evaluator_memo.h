@@ -0,0 +1,94 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/solvers/evaluator_base.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+
+/* The value and gradient of one evaluator at one input.  */
+struct MemoizedEvaluation {
+  Eigen::VectorXd y;
+  // The entries of ∂y/∂x, laid out as in EvaluatorBase::EvalWithGradient():
+  // in the order of the evaluator's gradient_sparsity_pattern() if it has
+  // one, otherwise dense and row-major.
+  Eigen::VectorXd dy_dx;
+};
+
+/* Evaluates `evaluator` and its gradient at `x`, preferring the double-only
+ EvalWithGradient() and otherwise falling back to the AutoDiffXd Eval() with
+ the derivatives of `x` seeded to the identity.  */
+void EvalValueAndGradient(const EvaluatorBase& evaluator,
+                          const Eigen::Ref<const Eigen::VectorXd>& x,
+                          MemoizedEvaluation* result);
+
+/* Memoizes the values and gradients of evaluators within a solver callback.
+
+ A program often binds one evaluator more than once (e.g., a constraint or
+ cost added at each knot point of a trajectory optimization), and a solver
+ often asks for the same bindings at the same decision variable values more
+ than once (e.g., for its objective and its constraints in separate
+ callbacks). Each (evaluator, input) pair is evaluated only once until the
+ memo is reset; later requests return the stored result. Inputs are compared
+ bitwise.
+
+ Eval() may be called from several threads at once. Reset() and Clear() may
+ not be called concurrently with anything else, and they invalidate the
+ references returned by Eval().  */
+class EvaluatorMemo {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(EvaluatorMemo)
+
+  EvaluatorMemo() = default;
+
+  /* Returns the value and gradient of `evaluator` at `x`, evaluating them
+   (see EvalValueAndGradient()) only if they aren't memoized yet.  */
+  const MemoizedEvaluation& Eval(const EvaluatorBase& evaluator,
+                                 const Eigen::Ref<const Eigen::VectorXd>& x);
+
+  /* Returns the memoized value and gradient of `evaluator` at `x`, or
+   nullptr if there are none (for callers that need only the value, and
+   can compute that more cheaply than the gradient).  */
+  const MemoizedEvaluation* Find(
+      const EvaluatorBase& evaluator,
+      const Eigen::Ref<const Eigen::VectorXd>& x) const;
+
+  /* Forgets every memoized evaluation.  */
+  void Clear();
+
+  /* Clears the memo iff `decision_variables` differ (bitwise) from those
+   passed to the previous call; for use by solvers whose callbacks don't say
+   whether the decision variables have changed since the last one.  */
+  void Reset(const Eigen::Ref<const Eigen::VectorXd>& decision_variables);
+
+  /* The number of evaluations memoized.  */
+  int size() const;
+
+ private:
+  struct Key {
+    const EvaluatorBase* evaluator{};
+    Eigen::VectorXd x;
+  };
+  struct KeyHash {
+    size_t operator()(const Key& key) const noexcept;
+  };
+  struct KeyEqual {
+    bool operator()(const Key& a, const Key& b) const noexcept;
+  };
+
+  mutable std::mutex mutex_;
+  // The map is node based, so references to its values remain valid while
+  // other threads insert.
+  std::unordered_map<Key, MemoizedEvaluation, KeyHash, KeyEqual> memo_;
+  Eigen::VectorXd decision_variables_;
+};
+
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
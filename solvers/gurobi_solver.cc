@@ -323,35 +323,38 @@ __attribute__((unused)) bool HasCorrectNumberOfVariables(
  * @return error as an integer. The full set of error values are
  * described here :
  * https://www.gurobi.com/documentation/9.5/refman/error_codes.html
- *
- * TODO(hongkai.dai): Use a sparse matrix A.
  */
-template <typename DerivedA, typename DerivedLB, typename DerivedUB>
+template <typename DerivedLB, typename DerivedUB>
 int AddLinearConstraint(const MathematicalProgram& prog, GRBmodel* model,
-                        const Eigen::MatrixBase<DerivedA>& A,
+                        const Eigen::SparseMatrix<double>& A,
                         const Eigen::MatrixBase<DerivedLB>& lb,
                         const Eigen::MatrixBase<DerivedUB>& ub,
                         const Eigen::Ref<const VectorXDecisionVariable>& vars,
                         bool is_equality, double sparseness_threshold,
                         int* num_gurobi_linear_constraints) {
-  for (int i = 0; i < A.rows(); i++) {
-    int nonzero_coeff_count = 0;
-    std::vector<int> nonzero_var_index(A.cols(), 0);
-    std::vector<double> nonzero_coeff(A.cols(), 0.0);
-
-    for (int j = 0; j < A.cols(); j++) {
-      if (std::abs(A(i, j)) > sparseness_threshold) {
-        nonzero_coeff[nonzero_coeff_count] = A(i, j);
-        nonzero_var_index[nonzero_coeff_count++] =
-            prog.FindDecisionVariableIndex(vars(j));
+  const std::vector<int> var_indices = prog.FindDecisionVariableIndices(vars);
+  // Gurobi adds the constraints one row at a time.
+  const Eigen::SparseMatrix<double, Eigen::RowMajor> A_row_major = A;
+  std::vector<int> nonzero_var_index;
+  std::vector<double> nonzero_coeff;
+  for (int i = 0; i < A_row_major.rows(); i++) {
+    nonzero_var_index.clear();
+    nonzero_coeff.clear();
+    for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(
+             A_row_major, i);
+         it; ++it) {
+      if (std::abs(it.value()) > sparseness_threshold) {
+        nonzero_coeff.push_back(it.value());
+        nonzero_var_index.push_back(var_indices[it.col()]);
       }
     }
+    const int nonzero_coeff_count = static_cast<int>(nonzero_coeff.size());
     // The sense of the constraint could be ==, <= or >=
     int error = 0;
     if (is_equality) {
       // Adds equality constraint.
-      error = GRBaddconstr(model, nonzero_coeff_count, &nonzero_var_index[0],
-                           &nonzero_coeff[0], GRB_EQUAL, lb(i), nullptr);
+      error = GRBaddconstr(model, nonzero_coeff_count, nonzero_var_index.data(),
+                           nonzero_coeff.data(), GRB_EQUAL, lb(i), nullptr);
       (*num_gurobi_linear_constraints)++;
       DRAKE_ASSERT(!error);
       if (error) return error;
@@ -360,7 +363,7 @@ int AddLinearConstraint(const MathematicalProgram& prog, GRBmodel* model,
         if (!std::isinf(lb(i))) {
           // Adds A.row(i)*x >= lb(i).
           error = GRBaddconstr(model, nonzero_coeff_count,
-                               &nonzero_var_index[0], &nonzero_coeff[0],
+                               nonzero_var_index.data(), nonzero_coeff.data(),
                                GRB_GREATER_EQUAL, lb(i), nullptr);
           DRAKE_ASSERT(!error);
           (*num_gurobi_linear_constraints)++;
@@ -368,9 +371,9 @@ int AddLinearConstraint(const MathematicalProgram& prog, GRBmodel* model,
         }
         if (!std::isinf(ub(i))) {
           // Adds A.row(i)*x <= ub(i).
-          error =
-              GRBaddconstr(model, nonzero_coeff_count, &nonzero_var_index[0],
-                           &nonzero_coeff[0], GRB_LESS_EQUAL, ub(i), nullptr);
+          error = GRBaddconstr(model, nonzero_coeff_count,
+                               nonzero_var_index.data(), nonzero_coeff.data(),
+                               GRB_LESS_EQUAL, ub(i), nullptr);
           DRAKE_ASSERT(!error);
           (*num_gurobi_linear_constraints)++;
           if (error) return error;
@@ -669,7 +672,7 @@ int ProcessLinearConstraints(
     constraint_dual_start_row->emplace(binding, *num_gurobi_linear_constraints);
 
     const int error = AddLinearConstraint(
-        prog, model, constraint->A(), constraint->lower_bound(),
+        prog, model, constraint->get_sparse_A(), constraint->lower_bound(),
         constraint->upper_bound(), binding.variables(), true,
         sparseness_threshold, num_gurobi_linear_constraints);
     if (error) {
@@ -683,7 +686,7 @@ int ProcessLinearConstraints(
     constraint_dual_start_row->emplace(binding, *num_gurobi_linear_constraints);
 
     const int error = AddLinearConstraint(
-        prog, model, constraint->A(), constraint->lower_bound(),
+        prog, model, constraint->get_sparse_A(), constraint->lower_bound(),
         constraint->upper_bound(), binding.variables(), false,
         sparseness_threshold, num_gurobi_linear_constraints);
     if (error) {
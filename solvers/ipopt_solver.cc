@@ -14,9 +14,10 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/never_destroyed.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/unused.h"
-#include "drake/math/autodiff.h"
+#include "drake/solvers/evaluator_memo.h"
 #include "drake/solvers/mathematical_program.h"
 
 using Ipopt::Index;
@@ -137,7 +138,11 @@ void SetAllConstraintDualSolution(
 /// @return number of constraints
 int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
   const int num_constraints = c.num_constraints();
-  *num_grad = num_constraints * var_count;
+  if (c.gradient_sparsity_pattern().has_value()) {
+    *num_grad = c.gradient_sparsity_pattern()->size();
+  } else {
+    *num_grad = num_constraints * var_count;
+  }
   return num_constraints;
 }
 
@@ -160,6 +165,15 @@ size_t GetGradientMatrix(
   const int m = c.num_constraints();
   size_t grad_index = 0;
 
+  if (c.gradient_sparsity_pattern().has_value()) {
+    for (const auto& [i, j] : c.gradient_sparsity_pattern().value()) {
+      iRow[grad_index] = constraint_idx + i;
+      jCol[grad_index] = prog.FindDecisionVariableIndex(variables(j));
+      grad_index++;
+    }
+    return grad_index;
+  }
+
   for (int i = 0; i < static_cast<int>(m); ++i) {
     for (int j = 0; j < variables.rows(); ++j) {
       iRow[grad_index] = constraint_idx + i;
@@ -182,13 +196,15 @@ Eigen::VectorXd MakeEigenVector(Index n, const Number* x) {
 /// Evaluate a constraint, storing the result of the evaluation into
 /// @p result and gradients into @p grad.  @p grad is the sparse
 /// matrix data for which the structure was defined in
-/// GetGradientMatrix.
+/// GetGradientMatrix. Evaluations with gradients are looked up in (or
+/// added to) @p memo.
 ///
 /// @return number of gradient entries populated.
 size_t EvaluateConstraint(const MathematicalProgram& prog,
                           const Eigen::VectorXd& xvec, const Constraint& c,
                           const VectorXDecisionVariable& variables,
-                          Number* result, Number* grad) {
+                          internal::EvaluatorMemo* memo, Number* result,
+                          Number* grad) {
   // For constraints which don't use all of the variables in the X
   // input, extract a subset into the AutoDiffVecXd this_x to evaluate
   // the constraint (we actually do this for all constraints.  One
@@ -203,11 +219,15 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
   }
 
   if (!grad) {
-    // We don't want the gradient info, so just call the VectorXd version of
-    // Eval.
+    // We don't want the gradient info, so reuse a memoized evaluation if
+    // there is one, or else just call the VectorXd version of Eval.
+    const internal::MemoizedEvaluation* memoized = memo->Find(c, this_x);
     Eigen::VectorXd ty(c.num_constraints());
-
-    c.Eval(this_x, &ty);
+    if (memoized != nullptr) {
+      ty = memoized->y;
+    } else {
+      c.Eval(this_x, &ty);
+    }
 
     // Store the results.
     for (int i = 0; i < c.num_constraints(); i++) {
@@ -216,35 +236,17 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
     return 0;
   }
 
-  // Run the version which calculates gradients.
-
-  AutoDiffVecXd ty(c.num_constraints());
-  c.Eval(math::InitializeAutoDiff(this_x), &ty);
-
-  // Store the results.  Since IPOPT directly knows the bounds of the
-  // constraint, we don't need to apply any bounding information here.
+  // Since IPOPT directly knows the bounds of the constraint, we don't need to
+  // apply any bounding information here. The gradient is already laid out as
+  // GetGradientMatrix expects.
+  const internal::MemoizedEvaluation& evaluation = memo->Eval(c, this_x);
   for (int i = 0; i < c.num_constraints(); i++) {
-    result[i] = ty(i).value();
+    result[i] = evaluation.y(i);
   }
-
-  // Extract the appropriate derivatives from our result into the
-  // gradient array.
-  size_t grad_idx = 0;
-
-  DRAKE_ASSERT(ty.rows() == c.num_constraints());
-  for (int i = 0; i < ty.rows(); i++) {
-    if (ty(i).derivatives().size() > 0) {
-      for (int j = 0; j < variables.rows(); j++) {
-        grad[grad_idx++] = ty(i).derivatives()(j);
-      }
-    } else {
-      for (int j = 0; j < variables.rows(); j++) {
-        grad[grad_idx++] = 0;
-      }
-    }
+  for (int k = 0; k < evaluation.dy_dx.rows(); ++k) {
+    grad[k] = evaluation.dy_dx(k);
   }
-
-  return grad_idx;
+  return evaluation.dy_dx.rows();
 }
 
 // IPOPT uses separate callbacks to get the result and the gradients.  When
@@ -621,7 +623,7 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
 
     problem_->EvalVisualizationCallbacks(xvec);
 
-    AutoDiffVecXd ty(1);
+    memo_.Reset(xvec);
     Eigen::VectorXd this_x;
 
     cost_cache_->SetX(n, x);
@@ -636,54 +638,73 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
             xvec(problem_->FindDecisionVariableIndex(binding.variables()(i)));
       }
 
-      binding.evaluator()->Eval(math::InitializeAutoDiff(this_x), &ty);
-
-      cost_cache_->result[0] += ty(0).value();
-
-      if (ty(0).derivatives().size() > 0) {
-        for (int j = 0; j < num_v_variables; ++j) {
-          const size_t vj_index =
-              problem_->FindDecisionVariableIndex(binding.variables()(j));
-          cost_cache_->grad[vj_index] += ty(0).derivatives()(j);
-        }
+      const auto& gradient_sparsity_pattern =
+          binding.evaluator()->gradient_sparsity_pattern();
+      const internal::MemoizedEvaluation& evaluation =
+          memo_.Eval(*binding.evaluator(), this_x);
+      cost_cache_->result[0] += evaluation.y(0);
+      for (int k = 0; k < evaluation.dy_dx.rows(); ++k) {
+        const int j = gradient_sparsity_pattern.has_value()
+                          ? (*gradient_sparsity_pattern)[k].second
+                          : k;
+        cost_cache_->grad[problem_->FindDecisionVariableIndex(
+            binding.variables()(j))] += evaluation.dy_dx(k);
       }
       cost_cache_->grad_valid = true;
-
-      // We do not need to add code for ty(0).derivatives().size() == 0, since
-      // cost_cache_->grad would be unchanged if the derivative has zero size.
     }
   }
 
   void EvaluateConstraints(Index n, const Number* x, bool eval_gradient) {
     const Eigen::VectorXd xvec = MakeEigenVector(n, x);
 
+    memo_.Reset(xvec);
     constraint_cache_->SetX(n, x);
     Number* result = constraint_cache_->result.data();
     Number* grad = eval_gradient ? constraint_cache_->grad.data() : nullptr;
 
-    for (const auto& c : problem_->generic_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
+    // The generic constraints write to disjoint ranges of result and grad,
+    // so we lay out those ranges first and then evaluate the bindings with
+    // the program's evaluation parallelism.
+    const auto& generic_constraints = problem_->generic_constraints();
+    const int num_generic = static_cast<int>(generic_constraints.size());
+    std::vector<Number*> generic_result(num_generic);
+    std::vector<Number*> generic_grad(num_generic);
+    for (int b = 0; b < num_generic; ++b) {
+      const Constraint& c = *generic_constraints[b].evaluator();
+      const int num_variables = generic_constraints[b].GetNumElements();
+      generic_result[b] = result;
+      generic_grad[b] = grad;
+      result += c.num_constraints();
+      if (grad != nullptr) {
+        grad += c.gradient_sparsity_pattern().has_value()
+                    ? c.gradient_sparsity_pattern()->size()
+                    : c.num_constraints() * num_variables;
+      }
     }
+    StaticParallelForIndexLoop(
+        problem_->evaluation_parallelism(), 0, num_generic, [&](int, int b) {
+          const auto& c = generic_constraints[b];
+          EvaluateConstraint(*problem_, xvec, *c.evaluator(), c.variables(),
+                             &memo_, generic_result[b], generic_grad[b]);
+        });
     for (const auto& c : problem_->lorentz_cone_constraints()) {
       grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
+                                 c.variables(), &memo_, result, grad);
       result += c.evaluator()->num_constraints();
     }
     for (const auto& c : problem_->rotated_lorentz_cone_constraints()) {
       grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
+                                 c.variables(), &memo_, result, grad);
       result += c.evaluator()->num_constraints();
     }
     for (const auto& c : problem_->linear_constraints()) {
       grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
+                                 c.variables(), &memo_, result, grad);
       result += c.evaluator()->num_constraints();
     }
     for (const auto& c : problem_->linear_equality_constraints()) {
       grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
+                                 c.variables(), &memo_, result, grad);
       result += c.evaluator()->num_constraints();
     }
 
@@ -695,6 +716,8 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
   const MathematicalProgram* const problem_;
   std::unique_ptr<ResultCache> cost_cache_;
   std::unique_ptr<ResultCache> constraint_cache_;
+  // Shared by the cost and constraint callbacks; reset whenever x changes.
+  internal::EvaluatorMemo memo_;
   Eigen::VectorXd x_init_;
   MathematicalProgramResult* const result_;
   // bb_con_dual_variable_indices_[constraint] maps the bounding box constraint
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <map>
 #include <memory>
 #include <ostream>
 #include <set>
@@ -13,6 +14,7 @@
 #include <utility>
 #include <vector>
 
+#include <Eigen/SparseCore>
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
@@ -90,6 +92,8 @@ std::unique_ptr<MathematicalProgram> MathematicalProgram::Clone() const {
   new_prog->solver_options_ = solver_options_;
 
   new_prog->required_capabilities_ = required_capabilities_;
+  new_prog->sos_parallelism_ = sos_parallelism_;
+  new_prog->evaluation_parallelism_ = evaluation_parallelism_;
   return new_prog;
 }
 
@@ -150,8 +154,8 @@ void MathematicalProgram::AddDecisionVariables(
         throw std::runtime_error(fmt::format(
             "decision_variables({}, {}) should not be a dummy variable", i, j));
       }
-      if (decision_variable_index_.find(var.get_id()) !=
-          decision_variable_index_.end()) {
+      if (decision_variable_index_->find(var.get_id()) !=
+          decision_variable_index_->end()) {
         throw std::runtime_error(
             fmt::format("{} is already a decision variable.", var));
       }
@@ -163,7 +167,8 @@ void MathematicalProgram::AddDecisionVariables(
       CheckVariableType(var.get_type());
       decision_variables_.push_back(var);
       const int var_index = decision_variables_.size() - 1;
-      decision_variable_index_.insert(std::make_pair(var.get_id(), var_index));
+      mutable_decision_variable_index().insert(
+          std::make_pair(var.get_id(), var_index));
     }
   }
   AppendNanToEnd(decision_variables.size(), &x_initial_guess_);
@@ -220,48 +225,83 @@ MathematicalProgram::NewSosPolynomial(
 }
 
 namespace {
+// Returns the products monomial_basis(i) * monomial_basis(j) for i <= j, in
+// row-major order of the upper triangle, i.e. (0, 0), (0, 1), ..., (1, 1), ...
+// The products are independent, so they are formed concurrently.
+std::vector<symbolic::Monomial> ComputeGramMonomialProducts(
+    const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis,
+    const Parallelism& parallelism) {
+  const int n = monomial_basis.rows();
+  std::vector<symbolic::Monomial> products(n * (n + 1) / 2);
+  // row_start[i] is the index in `products` of the product (i, i).
+  std::vector<int> row_start(n);
+  for (int i = 0, k = 0; i < n; k += n - i, ++i) {
+    row_start[i] = k;
+  }
+  StaticParallelForIndexLoop(parallelism, 0, n, [&](int, int i) {
+    for (int j = i; j < n; ++j) {
+      products[row_start[i] + j - i] = monomial_basis(i) * monomial_basis(j);
+    }
+  });
+  return products;
+}
+
 symbolic::Polynomial ComputePolynomialFromMonomialBasisAndGramMatrix(
     const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis,
-    const Eigen::Ref<const MatrixX<symbolic::Variable>>& gram) {
+    const Eigen::Ref<const MatrixX<symbolic::Variable>>& gram,
+    const Parallelism& parallelism) {
   // TODO(hongkai.dai & soonho.kong): ideally we should compute p in one line as
   // monomial_basis.dot(gramian * monomial_basis). But as explained in #10200,
   // this one line version is too slow, so we use this double for loop to
   // compute the matrix product by hand. I will revert to the one line version
   // when it is fast.
+  const std::vector<symbolic::Monomial> products =
+      ComputeGramMonomialProducts(monomial_basis, parallelism);
   symbolic::Polynomial p{};
+  int k = 0;
   for (int i = 0; i < gram.rows(); ++i) {
-    p.AddProduct(gram(i, i), pow(monomial_basis(i), 2));
+    p.AddProduct(gram(i, i), products[k++]);
     for (int j = i + 1; j < gram.cols(); ++j) {
-      p.AddProduct(2 * gram(i, j), monomial_basis(i) * monomial_basis(j));
+      p.AddProduct(2 * gram(i, j), products[k++]);
     }
   }
   return p;
 }
-}  // namespace
 
-symbolic::Polynomial MathematicalProgram::NewSosPolynomial(
+// Imposes the constraint that the Gram matrix is of the given
+// NonnegativePolynomial type.
+void AddGramMatrixConstraint(
+    MathematicalProgram* prog,
     const Eigen::Ref<const MatrixX<symbolic::Variable>>& gramian,
-    const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis,
-    NonnegativePolynomial type) {
-  DRAKE_ASSERT(gramian.rows() == gramian.cols());
-  DRAKE_ASSERT(gramian.rows() == monomial_basis.rows());
-  const symbolic::Polynomial p =
-      ComputePolynomialFromMonomialBasisAndGramMatrix(monomial_basis, gramian);
+    MathematicalProgram::NonnegativePolynomial type) {
   switch (type) {
     case MathematicalProgram::NonnegativePolynomial::kSos: {
-      AddPositiveSemidefiniteConstraint(gramian);
+      prog->AddPositiveSemidefiniteConstraint(gramian);
       break;
     }
     case MathematicalProgram::NonnegativePolynomial::kSdsos: {
-      AddScaledDiagonallyDominantMatrixConstraint(gramian);
+      prog->AddScaledDiagonallyDominantMatrixConstraint(gramian);
       break;
     }
     case MathematicalProgram::NonnegativePolynomial::kDsos: {
-      AddPositiveDiagonallyDominantMatrixConstraint(
+      prog->AddPositiveDiagonallyDominantMatrixConstraint(
           gramian.cast<symbolic::Expression>());
       break;
     }
   }
+}
+}  // namespace
+
+symbolic::Polynomial MathematicalProgram::NewSosPolynomial(
+    const Eigen::Ref<const MatrixX<symbolic::Variable>>& gramian,
+    const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis,
+    NonnegativePolynomial type) {
+  DRAKE_ASSERT(gramian.rows() == gramian.cols());
+  DRAKE_ASSERT(gramian.rows() == monomial_basis.rows());
+  const symbolic::Polynomial p =
+      ComputePolynomialFromMonomialBasisAndGramMatrix(monomial_basis, gramian,
+                                                      sos_parallelism_);
+  AddGramMatrixConstraint(this, gramian, type);
   return p;
 }
 
@@ -394,8 +434,8 @@ void MathematicalProgram::AddIndeterminates(
       }
       if (indeterminates_index_.find(var.get_id()) !=
               indeterminates_index_.end() ||
-          decision_variable_index_.find(var.get_id()) !=
-              decision_variable_index_.end()) {
+          decision_variable_index_->find(var.get_id()) !=
+              decision_variable_index_->end()) {
         throw std::runtime_error(
             fmt::format("{} already exists in the optimization program.", var));
       }
@@ -838,7 +878,7 @@ Binding<LinearConstraint> MathematicalProgram::AddConstraint(
   } else {
     // TODO(eric.cousineau): This is a good assertion... But seems out of place,
     // possibly redundant w.r.t. the binding infrastructure.
-    DRAKE_ASSERT(binding.evaluator()->A().cols() ==
+    DRAKE_ASSERT(binding.evaluator()->get_sparse_A().cols() ==
                  static_cast<int>(binding.GetNumElements()));
     if (!CheckBinding(binding)) {
       return binding;
@@ -857,9 +897,17 @@ Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
   return AddConstraint(make_shared<LinearConstraint>(A, lb, ub), vars);
 }
 
+Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const Eigen::VectorXd>& lb,
+    const Eigen::Ref<const Eigen::VectorXd>& ub,
+    const Eigen::Ref<const VectorXDecisionVariable>& vars) {
+  return AddConstraint(make_shared<LinearConstraint>(A, lb, ub), vars);
+}
+
 Binding<LinearEqualityConstraint> MathematicalProgram::AddConstraint(
     const Binding<LinearEqualityConstraint>& binding) {
-  DRAKE_ASSERT(binding.evaluator()->A().cols() ==
+  DRAKE_ASSERT(binding.evaluator()->get_sparse_A().cols() ==
                static_cast<int>(binding.GetNumElements()));
   if (!CheckBinding(binding)) {
     return binding;
@@ -888,6 +936,14 @@ MathematicalProgram::AddLinearEqualityConstraint(
   return AddConstraint(make_shared<LinearEqualityConstraint>(Aeq, beq), vars);
 }
 
+Binding<LinearEqualityConstraint>
+MathematicalProgram::AddLinearEqualityConstraint(
+    const Eigen::SparseMatrix<double>& Aeq,
+    const Eigen::Ref<const Eigen::VectorXd>& beq,
+    const Eigen::Ref<const VectorXDecisionVariable>& vars) {
+  return AddConstraint(make_shared<LinearEqualityConstraint>(Aeq, beq), vars);
+}
+
 Binding<BoundingBoxConstraint> MathematicalProgram::AddConstraint(
     const Binding<BoundingBoxConstraint>& binding) {
   if (!CheckBinding(binding)) {
@@ -1291,9 +1347,21 @@ std::vector<Binding<Constraint>> MathematicalProgram::GetAllConstraints()
   return conlist;
 }
 
+std::unordered_map<symbolic::Variable::Id, int>&
+MathematicalProgram::mutable_decision_variable_index() {
+  // Any snapshot taken by shared_decision_variable_index() keeps the mapping
+  // it was taken from.
+  if (decision_variable_index_.use_count() > 1) {
+    decision_variable_index_ =
+        std::make_shared<std::unordered_map<symbolic::Variable::Id, int>>(
+            *decision_variable_index_);
+  }
+  return *decision_variable_index_;
+}
+
 int MathematicalProgram::FindDecisionVariableIndex(const Variable& var) const {
-  auto it = decision_variable_index_.find(var.get_id());
-  if (it == decision_variable_index_.end()) {
+  auto it = decision_variable_index_->find(var.get_id());
+  if (it == decision_variable_index_->end()) {
     ostringstream oss;
     oss << var
         << " is not a decision variable in the mathematical program, "
@@ -1355,18 +1423,138 @@ bool MathematicalProgram::CheckSatisfiedAtInitialGuess(
 namespace {
 // Body of MathematicalProgram::AddSosConstraint(const symbolic::Polynomial&,
 // const Eigen::Ref<const VectorX<symbolic::Monomial>>&).
+//
+// Rather than forming the polynomial mᵀQm and subtracting p symbolically, the
+// coefficient-matching equalities are assembled directly as the triplets of a
+// sparse matrix A and a vector b, with one row per monomial and the columns
+// indexing [upper triangle of Q; decision variables of p]. Each row then
+// becomes one linear equality constraint on its nonzero columns, in the same
+// order as the terms of (mᵀQm - p).
 MatrixXDecisionVariable DoAddSosConstraint(
     MathematicalProgram* const prog, const symbolic::Polynomial& p,
     const Eigen::Ref<const VectorX<symbolic::Monomial>>& monomial_basis,
     MathematicalProgram::NonnegativePolynomial type) {
-  const auto pair = prog->NewSosPolynomial(monomial_basis, type);
-  const symbolic::Polynomial& sos_poly{pair.first};
-  const MatrixXDecisionVariable& Q{pair.second};
+  const Parallelism& parallelism = prog->sos_parallelism();
+  const int n = monomial_basis.rows();
+  const MatrixXDecisionVariable Q = prog->NewSymmetricContinuousVariables(n);
+  AddGramMatrixConstraint(prog, Q, type);
+
+  const std::vector<symbolic::Monomial> products =
+      ComputeGramMonomialProducts(monomial_basis, parallelism);
+  const int num_gram_vars = static_cast<int>(products.size());
+
+  // Assign a row to every monomial of mᵀQm and of p.
+  std::map<symbolic::Monomial, int, symbolic::internal::CompareMonomial> rows;
+  for (const symbolic::Monomial& monomial : products) {
+    rows.emplace(monomial, 0);
+  }
+  std::vector<const symbolic::Polynomial::MapType::value_type*> p_terms;
+  for (const auto& term : p.monomial_to_coefficient_map()) {
+    rows.emplace(term.first, 0);
+    p_terms.push_back(&term);
+  }
+  int num_rows = 0;
+  for (auto& row : rows) {
+    row.second = num_rows++;
+  }
 
-  const symbolic::Polynomial poly_diff = sos_poly - p;
+  // Decompose each coefficient of p, c(x) = a·x + c₀, into its affine parts.
+  struct AffineCoefficient {
+    VectorX<symbolic::Variable> vars;
+    Eigen::RowVectorXd coeffs;
+    double constant_term{};
+  };
+  std::vector<AffineCoefficient> p_coeffs(p_terms.size());
+  StaticParallelForIndexLoop(
+      parallelism, 0, static_cast<int>(p_terms.size()), [&](int, int t) {
+        const symbolic::Expression& e = p_terms[t]->second;
+        AffineCoefficient& result = p_coeffs[t];
+        std::unordered_map<symbolic::Variable::Id, int> map_var_to_index;
+        std::tie(result.vars, map_var_to_index) =
+            symbolic::ExtractVariablesFromExpression(e);
+        result.coeffs.resize(result.vars.rows());
+        symbolic::DecomposeAffineExpression(e, map_var_to_index, result.coeffs,
+                                            &result.constant_term);
+      });
+
+  // The columns are the upper triangle of Q followed by the decision variables
+  // of p, in order of first appearance.
+  VectorXDecisionVariable vars(num_gram_vars);
+  for (int i = 0, k = 0; i < n; ++i) {
+    for (int j = i; j < n; ++j) {
+      vars(k++) = Q(i, j);
+    }
+  }
+  std::unordered_map<symbolic::Variable::Id, int> map_var_to_index;
+  std::vector<symbolic::Variable> p_vars;
+  for (const AffineCoefficient& coeff : p_coeffs) {
+    for (int l = 0; l < coeff.vars.rows(); ++l) {
+      if (map_var_to_index
+              .emplace(coeff.vars(l).get_id(), num_gram_vars + p_vars.size())
+              .second) {
+        p_vars.push_back(coeff.vars(l));
+      }
+    }
+  }
+  vars.conservativeResize(num_gram_vars + p_vars.size());
+  for (int l = 0; l < static_cast<int>(p_vars.size()); ++l) {
+    vars(num_gram_vars + l) = p_vars[l];
+  }
 
-  for (const auto& term : poly_diff.monomial_to_coefficient_map()) {
-    prog->AddLinearEqualityConstraint(term.second, 0);
+  // The triplets for Q are built per thread and concatenated in thread order,
+  // so the result does not depend on the degree of parallelism.
+  const int num_threads = parallelism.num_threads();
+  std::vector<std::vector<Eigen::Triplet<double>>> thread_triplets(num_threads);
+  std::vector<int> row_start(n);
+  for (int i = 0, k = 0; i < n; k += n - i, ++i) {
+    row_start[i] = k;
+  }
+  StaticParallelForIndexLoop(parallelism, 0, n, [&](int thread_num, int i) {
+    std::vector<Eigen::Triplet<double>>& triplets = thread_triplets[thread_num];
+    for (int j = i; j < n; ++j) {
+      const int k = row_start[i] + j - i;
+      triplets.emplace_back(rows.at(products[k]), k, i == j ? 1.0 : 2.0);
+    }
+  });
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve(num_gram_vars);
+  for (const auto& thread_triplet : thread_triplets) {
+    triplets.insert(triplets.end(), thread_triplet.begin(),
+                    thread_triplet.end());
+  }
+  Eigen::VectorXd b = Eigen::VectorXd::Zero(num_rows);
+  for (int t = 0; t < static_cast<int>(p_terms.size()); ++t) {
+    const int row = rows.at(p_terms[t]->first);
+    const AffineCoefficient& coeff = p_coeffs[t];
+    for (int l = 0; l < coeff.vars.rows(); ++l) {
+      triplets.emplace_back(row, map_var_to_index.at(coeff.vars(l).get_id()),
+                            -coeff.coeffs(l));
+    }
+    b(row) = coeff.constant_term;
+  }
+  using RowMajorSparseMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+  RowMajorSparseMatrix A(num_rows, vars.rows());
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  A.prune(0.0);
+
+  for (int row = 0; row < num_rows; ++row) {
+    const int nnz = A.outerIndexPtr()[row + 1] - A.outerIndexPtr()[row];
+    if (nnz == 0) {
+      if (b(row) != 0) {
+        // Report the infeasible constant equality the same way as the
+        // symbolic path does.
+        prog->AddLinearEqualityConstraint(symbolic::Expression(-b(row)), 0);
+      }
+      continue;
+    }
+    Eigen::RowVectorXd a_row(nnz);
+    VectorXDecisionVariable row_vars(nnz);
+    int l = 0;
+    for (RowMajorSparseMatrix::InnerIterator it(A, row); it; ++it, ++l) {
+      a_row(l) = it.value();
+      row_vars(l) = vars(it.col());
+    }
+    prog->AddLinearEqualityConstraint(a_row, b(row), row_vars);
   }
   return Q;
 }
@@ -1785,7 +1973,7 @@ void MathematicalProgram::CheckIsDecisionVariable(
     const VectorXDecisionVariable& vars) const {
   for (int i = 0; i < vars.rows(); ++i) {
     for (int j = 0; j < vars.cols(); ++j) {
-      if (decision_variable_index_.count(vars(i, j).get_id()) == 0) {
+      if (decision_variable_index_->count(vars(i, j).get_id()) == 0) {
         throw std::logic_error(fmt::format(
             "{} is not a decision variable of the mathematical program.",
             vars(i, j)));
@@ -18,12 +18,14 @@
 #include <vector>
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/polynomial.h"
 #include "drake/common/symbolic.h"
 #include "drake/solvers/binding.h"
@@ -1510,6 +1512,27 @@ class MathematicalProgram {
       const Eigen::Ref<const Eigen::VectorXd>& ub,
       const Eigen::Ref<const VectorXDecisionVariable>& vars);
 
+  /**
+   * Adds linear constraints lb <= A * vars <= ub with a sparse A. The
+   * constraint keeps A sparse, and no symbolic expressions are formed, so
+   * this is the fast path for building large programs. Assemble A from
+   * triplets, for example
+   * @code{.cc}
+   *   std::vector<Eigen::Triplet<double>> triplets;
+   *   // ... push_back (row, col, value) for every nonzero ...
+   *   Eigen::SparseMatrix<double> A(num_rows, x.rows());
+   *   A.setFromTriplets(triplets.begin(), triplets.end());
+   *   prog.AddLinearConstraint(A, lb, ub, x);
+   * @endcode
+   *
+   * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+   */
+  Binding<LinearConstraint> AddLinearConstraint(
+      const Eigen::SparseMatrix<double>& A,
+      const Eigen::Ref<const Eigen::VectorXd>& lb,
+      const Eigen::Ref<const Eigen::VectorXd>& ub,
+      const Eigen::Ref<const VectorXDecisionVariable>& vars);
+
   /**
    * Adds one row of linear constraint referencing potentially a
    * subset of the decision variables (defined in the vars parameter).
@@ -1773,6 +1796,18 @@ class MathematicalProgram {
       const Eigen::Ref<const Eigen::VectorXd>& beq,
       const Eigen::Ref<const VectorXDecisionVariable>& vars);
 
+  /**
+   * Adds linear equality constraints Aeq * vars = beq with a sparse Aeq. Like
+   * the sparse overload of AddLinearConstraint(), this forms no symbolic
+   * expressions and keeps Aeq sparse.
+   *
+   * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+   */
+  Binding<LinearEqualityConstraint> AddLinearEqualityConstraint(
+      const Eigen::SparseMatrix<double>& Aeq,
+      const Eigen::Ref<const Eigen::VectorXd>& beq,
+      const Eigen::Ref<const VectorXDecisionVariable>& vars);
+
   /**
    * Adds one row of linear equality constraint referencing potentially a subset
    * of decision variables.
@@ -2624,6 +2659,41 @@ class MathematicalProgram {
   AddSosConstraint(const symbolic::Expression& e,
                    NonnegativePolynomial type = NonnegativePolynomial::kSos);
 
+  /**
+   * Sets the degree of parallelism used while setting up sum-of-squares
+   * programs: forming the products of the monomial basis in NewSosPolynomial()
+   * and matching the coefficients of the Gram matrix in AddSosConstraint().
+   * The constraints added to the program do not depend on this choice.
+   * @default is Parallelism::None().
+   */
+  void set_sos_parallelism(Parallelism parallelism) {
+    sos_parallelism_ = parallelism;
+  }
+
+  /** Returns the parallelism set by set_sos_parallelism(). */
+  const Parallelism& sos_parallelism() const { return sos_parallelism_; }
+
+  /**
+   * Sets the parallelism with which a solver may evaluate the bindings of
+   * the generic constraints (see generic_constraints()) at a given x. The
+   * bindings are independent of one another, so evaluating them
+   * concurrently only requires that each constraint's evaluator be safe to
+   * Eval() from several threads at once (including concurrently with
+   * itself, when it is bound more than once); don't set this unless they
+   * all are. The solution found does not depend on this choice. Solvers
+   * that evaluate constraints one at a time (i.e., all but SNOPT and IPOPT)
+   * ignore it.
+   * @default is Parallelism::None().
+   */
+  void set_evaluation_parallelism(Parallelism parallelism) {
+    evaluation_parallelism_ = parallelism;
+  }
+
+  /** Returns the parallelism set by set_evaluation_parallelism(). */
+  const Parallelism& evaluation_parallelism() const {
+    return evaluation_parallelism_;
+  }
+
   /**
    * Constraining that two polynomials are the same (i.e., they have the same
    * coefficients for each monomial). This function is often used in
@@ -3183,6 +3253,19 @@ class MathematicalProgram {
    */
   const std::unordered_map<symbolic::Variable::Id, int>&
   decision_variable_index() const {
+    return *decision_variable_index_;
+  }
+
+  /**
+   * (Advanced.) Returns the same mapping as decision_variable_index(), as a
+   * snapshot that is not affected by adding decision variables to this
+   * program later. Taking the snapshot doesn't copy the mapping, so that a
+   * MathematicalProgramResult can share it instead of copying it on every
+   * solve.
+   * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+   */
+  std::shared_ptr<const std::unordered_map<symbolic::Variable::Id, int>>
+  shared_decision_variable_index() const {
     return decision_variable_index_;
   }
 
@@ -3306,9 +3389,17 @@ class MathematicalProgram {
    */
   void UpdateRequiredCapability(ProgramAttribute query_capability);
 
+  // Returns decision_variable_index_ for modification, after making a copy of
+  // it if it is shared with a snapshot.
+  std::unordered_map<symbolic::Variable::Id, int>&
+  mutable_decision_variable_index();
+
   // maps the ID of a symbolic variable to the index of the variable stored
-  // in the optimization program.
-  std::unordered_map<symbolic::Variable::Id, int> decision_variable_index_{};
+  // in the optimization program. It is copied on write, once it is shared by
+  // shared_decision_variable_index().
+  std::shared_ptr<std::unordered_map<symbolic::Variable::Id, int>>
+      decision_variable_index_{
+          std::make_shared<std::unordered_map<symbolic::Variable::Id, int>>()};
 
   // Use std::vector here instead of Eigen::VectorX because std::vector performs
   // much better when pushing new variables into the container.
@@ -3356,6 +3447,10 @@ class MathematicalProgram {
 
   ProgramAttributes required_capabilities_;
 
+  Parallelism sos_parallelism_;
+
+  Parallelism evaluation_parallelism_;
+
   template <typename T>
   void NewVariables_impl(
       VarType type, const T& names, bool is_symmetric,
@@ -3376,7 +3471,7 @@ class MathematicalProgram {
     for (int i = 0; i < num_new_vars; ++i) {
       decision_variables_.emplace_back(names[i], type);
       const int new_var_index = decision_variables_.size() - 1;
-      decision_variable_index_.insert(std::make_pair(
+      mutable_decision_variable_index().insert(std::make_pair(
           decision_variables_[new_var_index].get_id(), new_var_index));
       decision_variable_matrix(row_index, col_index) =
           decision_variables_[new_var_index];
@@ -1,5 +1,8 @@
 #include "drake/solvers/mathematical_program_result.h"
 
+#include <limits>
+#include <utility>
+
 #include <fmt/format.h>
 
 #include "drake/common/never_destroyed.h"
@@ -29,12 +32,81 @@ const AbstractValue& MathematicalProgramResult::get_abstract_solver_details()
   return *solver_details_;
 }
 
+void MathematicalProgramResult::Reset() {
+  solution_result_ = SolutionResult::kUnknownError;
+  x_val_.setConstant(std::numeric_limits<double>::quiet_NaN());
+  optimal_cost_ = NAN;
+  solver_id_ = UnknownId();
+  solver_details_ = nullptr;
+  suboptimal_x_val_.clear();
+  suboptimal_objectives_.clear();
+  num_dual_solutions_ = 0;
+}
+
+void MathematicalProgramResult::set_decision_variable_index(
+    std::shared_ptr<const std::unordered_map<symbolic::Variable::Id, int>>
+        decision_variable_index) {
+  DRAKE_THROW_UNLESS(decision_variable_index != nullptr);
+  decision_variable_index_ = std::move(decision_variable_index);
+  // N.B. This only reallocates x_val_ if its size changes.
+  x_val_.setConstant(decision_variable_index_->size(),
+                     std::numeric_limits<double>::quiet_NaN());
+}
+
+void MathematicalProgramResult::SetDualSolution(
+    const Binding<Constraint>& constraint,
+    const Eigen::Ref<const Eigen::VectorXd>& dual_solution) {
+  // Each constraint occupies at most one entry of dual_solutions_, and
+  // dual_solution_index_ maps it to that entry.
+  const int k = num_dual_solutions_;
+  const int num_entries = dual_solutions_.size();
+  if (k < num_entries && dual_solutions_[k].constraint == constraint) {
+    // The same constraint as in the previous solve.
+    dual_solutions_[k].value = dual_solution;
+    ++num_dual_solutions_;
+    return;
+  }
+  auto it = dual_solution_index_.find(constraint);
+  if (it != dual_solution_index_.end()) {
+    const int j = it->second;
+    if (j < k) {
+      // Like the insertion into a map, keeps the dual solution that was set
+      // first.
+      return;
+    }
+    // Brings the constraint's leftover entry forward.
+    std::swap(dual_solutions_[j], dual_solutions_[k]);
+    dual_solution_index_.at(dual_solutions_[j].constraint) = j;
+    it->second = k;
+    dual_solutions_[k].value = dual_solution;
+  } else if (k < num_entries) {
+    // Overwrites another constraint's leftover entry.
+    dual_solution_index_.erase(dual_solutions_[k].constraint);
+    dual_solutions_[k].constraint = constraint;
+    dual_solutions_[k].value = dual_solution;
+    dual_solution_index_.emplace(constraint, k);
+  } else {
+    dual_solutions_.push_back(DualSolution{constraint, dual_solution});
+    dual_solution_index_.emplace(constraint, k);
+  }
+  ++num_dual_solutions_;
+}
+
+const Eigen::VectorXd* MathematicalProgramResult::FindDualSolution(
+    const Binding<Constraint>& constraint) const {
+  const auto it = dual_solution_index_.find(constraint);
+  if (it == dual_solution_index_.end() || it->second >= num_dual_solutions_) {
+    return nullptr;
+  }
+  return &dual_solutions_[it->second].value;
+}
+
 bool MathematicalProgramResult::is_success() const {
   return solution_result_ == SolutionResult::kSolutionFound;
 }
 
 void MathematicalProgramResult::set_x_val(const Eigen::VectorXd& x_val) {
-  DRAKE_DEMAND(decision_variable_index_.has_value());
+  DRAKE_DEMAND(decision_variable_index_ != nullptr);
   if (x_val.size() != static_cast<int>(decision_variable_index_->size())) {
     std::stringstream oss;
     oss << "MathematicalProgramResult::set_x_val, the dimension of x_val is "
@@ -50,10 +122,17 @@ double GetVariableValue(
         variable_index,
     const Eigen::Ref<const Eigen::VectorXd>& variable_values) {
   DRAKE_ASSERT(variable_index.has_value());
+  return GetVariableValue(var, *variable_index, variable_values);
+}
+
+double GetVariableValue(
+    const symbolic::Variable& var,
+    const std::unordered_map<symbolic::Variable::Id, int>& variable_index,
+    const Eigen::Ref<const Eigen::VectorXd>& variable_values) {
   DRAKE_ASSERT(variable_values.rows() ==
-               static_cast<int>(variable_index->size()));
-  auto it = variable_index->find(var.get_id());
-  if (it == variable_index->end()) {
+               static_cast<int>(variable_index.size()));
+  auto it = variable_index.find(var.get_id());
+  if (it == variable_index.end()) {
     throw std::invalid_argument(fmt::format(
         "GetVariableValue: {} is not captured by the variable_index map.",
         var.get_name()));
@@ -63,12 +142,13 @@ double GetVariableValue(
 
 double MathematicalProgramResult::GetSolution(
     const symbolic::Variable& var) const {
-  return GetVariableValue(var, decision_variable_index_, x_val_);
+  DRAKE_ASSERT(decision_variable_index_ != nullptr);
+  return GetVariableValue(var, *decision_variable_index_, x_val_);
 }
 
 symbolic::Expression MathematicalProgramResult::GetSolution(
     const symbolic::Expression& e) const {
-  DRAKE_ASSERT(decision_variable_index_.has_value());
+  DRAKE_ASSERT(decision_variable_index_ != nullptr);
   symbolic::Environment env;
   for (const auto& var : e.GetVariables()) {
     const auto it = decision_variable_index_->find(var.get_id());
@@ -83,7 +163,7 @@ symbolic::Expression MathematicalProgramResult::GetSolution(
 
 symbolic::Polynomial MathematicalProgramResult::GetSolution(
     const symbolic::Polynomial& p) const {
-  DRAKE_ASSERT(decision_variable_index_.has_value());
+  DRAKE_ASSERT(decision_variable_index_ != nullptr);
   for (const auto& indeterminate : p.indeterminates()) {
     if (decision_variable_index_->count(indeterminate.get_id()) > 0) {
       throw std::invalid_argument(
@@ -113,7 +193,8 @@ symbolic::Polynomial MathematicalProgramResult::GetSolution(
 
 double MathematicalProgramResult::GetSuboptimalSolution(
     const symbolic::Variable& var, int solution_number) const {
-  return GetVariableValue(var, decision_variable_index_,
+  DRAKE_ASSERT(decision_variable_index_ != nullptr);
+  return GetVariableValue(var, *decision_variable_index_,
                           suboptimal_x_val_[solution_number]);
 }
 
@@ -123,6 +204,11 @@ void MathematicalProgramResult::AddSuboptimalSolution(
   suboptimal_objectives_.push_back(suboptimal_objective);
 }
 
+void MathematicalProgramResult::ClearSuboptimalSolutions() {
+  suboptimal_x_val_.clear();
+  suboptimal_objectives_.clear();
+}
+
 std::vector<std::string>
 MathematicalProgramResult::GetInfeasibleConstraintNames(
     const MathematicalProgram& prog, std::optional<double> tolerance) const {
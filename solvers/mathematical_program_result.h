@@ -41,6 +41,15 @@ double GetVariableValue(
         variable_index,
     const Eigen::Ref<const Eigen::VectorXd>& variable_values);
 
+/**
+ * Overload GetVariableValue() function, but for a variable_index that is
+ * known to be set.
+ */
+double GetVariableValue(
+    const symbolic::Variable& var,
+    const std::unordered_map<symbolic::Variable::Id, int>& variable_index,
+    const Eigen::Ref<const Eigen::VectorXd>& variable_values);
+
 /**
  * Overload GetVariableValue() function, but for an Eigen matrix of decision
  * variables.
@@ -52,8 +61,7 @@ typename std::enable_if_t<
                   Derived::ColsAtCompileTime>>
 GetVariableValue(
     const Eigen::MatrixBase<Derived>& var,
-    const std::optional<std::unordered_map<symbolic::Variable::Id, int>>&
-        variable_index,
+    const std::unordered_map<symbolic::Variable::Id, int>& variable_index,
     const Eigen::Ref<const Eigen::VectorXd>& variable_values) {
   Eigen::Matrix<double, Derived::RowsAtCompileTime, Derived::ColsAtCompileTime>
       value(var.rows(), var.cols());
@@ -66,6 +74,24 @@ GetVariableValue(
   return value;
 }
 
+/**
+ * Overload GetVariableValue() function, but for an Eigen matrix of decision
+ * variables.
+ */
+template <typename Derived>
+typename std::enable_if_t<
+    std::is_same_v<typename Derived::Scalar, symbolic::Variable>,
+    Eigen::Matrix<double, Derived::RowsAtCompileTime,
+                  Derived::ColsAtCompileTime>>
+GetVariableValue(
+    const Eigen::MatrixBase<Derived>& var,
+    const std::optional<std::unordered_map<symbolic::Variable::Id, int>>&
+        variable_index,
+    const Eigen::Ref<const Eigen::VectorXd>& variable_values) {
+  DRAKE_ASSERT(variable_index.has_value());
+  return GetVariableValue(var, *variable_index, variable_values);
+}
+
 /**
  * The result returned by MathematicalProgram::Solve(). It stores the
  * solvers::SolutionResult (whether the program is solved to optimality,
@@ -89,6 +115,19 @@ class MathematicalProgramResult final {
    */
   bool is_success() const;
 
+  /**
+   * (Advanced.) Prepares this result to receive the outcome of another solve;
+   * implementations of SolverInterface call it at the start of Solve(). It
+   * resets the solution result, the optimal cost, the solver id and the solver
+   * details, clears the suboptimal and the dual solutions, and sets the
+   * values of the decision variables to NAN. Unlike assigning a
+   * default-constructed result, it keeps the storage of the solution and of
+   * the dual solutions, so that solving the same program repeatedly into the
+   * same result doesn't reallocate them.
+   * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+   */
+  void Reset();
+
   /**
    * Sets decision_variable_index mapping, that maps each decision variable to
    * its index in the aggregated vector containing all decision variables in
@@ -96,12 +135,21 @@ class MathematicalProgramResult final {
    */
   void set_decision_variable_index(
       std::unordered_map<symbolic::Variable::Id, int> decision_variable_index) {
-    decision_variable_index_ = std::move(decision_variable_index);
-    x_val_ =
-        Eigen::VectorXd::Constant(decision_variable_index_->size(),
-                                  std::numeric_limits<double>::quiet_NaN());
+    set_decision_variable_index(
+        std::make_shared<const std::unordered_map<symbolic::Variable::Id, int>>(
+            std::move(decision_variable_index)));
   }
 
+  /**
+   * (Advanced.) Overloads set_decision_variable_index() to share the mapping
+   * (e.g., the MathematicalProgram::shared_decision_variable_index()) rather
+   * than to copy it.
+   * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+   */
+  void set_decision_variable_index(
+      std::shared_ptr<const std::unordered_map<symbolic::Variable::Id, int>>
+          decision_variable_index);
+
   /** Sets SolutionResult. */
   void set_solution_result(SolutionResult solution_result) {
     solution_result_ = solution_result;
@@ -121,9 +169,8 @@ class MathematicalProgramResult final {
   void set_dual_solution(
       const Binding<C>& constraint,
       const Eigen::Ref<const Eigen::VectorXd>& dual_solution) {
-    const Binding<Constraint> constraint_cast =
-        internal::BindingDynamicCast<Constraint>(constraint);
-    dual_solutions_.emplace(constraint_cast, dual_solution);
+    SetDualSolution(internal::BindingDynamicCast<Constraint>(constraint),
+                    dual_solution);
   }
 
   /** Gets the optimal cost. */
@@ -187,7 +234,8 @@ class MathematicalProgramResult final {
       Eigen::Matrix<double, Derived::RowsAtCompileTime,
                     Derived::ColsAtCompileTime>>
   GetSolution(const Eigen::MatrixBase<Derived>& var) const {
-    return GetVariableValue(var, decision_variable_index_, x_val_);
+    DRAKE_ASSERT(decision_variable_index_ != nullptr);
+    return GetVariableValue(var, *decision_variable_index_, x_val_);
   }
 
   /**
@@ -317,10 +365,9 @@ class MathematicalProgramResult final {
    */
   template <typename C>
   Eigen::VectorXd GetDualSolution(const Binding<C>& constraint) const {
-    const Binding<Constraint> constraint_cast =
-        internal::BindingDynamicCast<Constraint>(constraint);
-    auto it = dual_solutions_.find(constraint_cast);
-    if (it == dual_solutions_.end()) {
+    const Eigen::VectorXd* dual_solution =
+        FindDualSolution(internal::BindingDynamicCast<Constraint>(constraint));
+    if (dual_solution == nullptr) {
       // Throws a more meaningful error message when the user wants to retrieve
       // a dual solution from a Gurobi result for a program containing second
       // order cone constraints, but forgot to explicitly turn on the flag to
@@ -344,7 +391,7 @@ class MathematicalProgramResult final {
           "{} does not currently support getting dual solution yet.",
           solver_id_.name()));
     } else {
-      return it->second;
+      return *dual_solution;
     }
   }
 
@@ -357,7 +404,7 @@ class MathematicalProgramResult final {
    */
   template <typename Evaluator>
   Eigen::VectorXd EvalBinding(const Binding<Evaluator>& binding) const {
-    DRAKE_ASSERT(decision_variable_index_.has_value());
+    DRAKE_ASSERT(decision_variable_index_ != nullptr);
     Eigen::VectorXd binding_x(binding.GetNumElements());
     for (int i = 0; i < binding_x.rows(); ++i) {
       binding_x(i) =
@@ -392,7 +439,8 @@ class MathematicalProgramResult final {
                     Derived::ColsAtCompileTime>>
   GetSuboptimalSolution(const Eigen::MatrixBase<Derived>& var,
                         int solution_number) const {
-    return GetVariableValue(var, decision_variable_index_,
+    DRAKE_ASSERT(decision_variable_index_ != nullptr);
+    return GetVariableValue(var, *decision_variable_index_,
                             suboptimal_x_val_[solution_number]);
   }
 
@@ -437,6 +485,13 @@ class MathematicalProgramResult final {
    */
   void AddSuboptimalSolution(double suboptimal_objective,
                              const Eigen::VectorXd& suboptimal_x);
+
+  /**
+   * (Advanced.) Removes all of the suboptimal solutions. See @ref
+   * solution_pools "solution pools".
+   * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+   */
+  void ClearSuboptimalSolutions();
   //@}
 
   /** @anchor get_infeasible_constraints
@@ -489,7 +544,20 @@ class MathematicalProgramResult final {
   // @}
 
  private:
-  std::optional<std::unordered_map<symbolic::Variable::Id, int>>
+  // A dual solution, as set by set_dual_solution().
+  struct DualSolution {
+    Binding<Constraint> constraint;
+    Eigen::VectorXd value;
+  };
+
+  void SetDualSolution(const Binding<Constraint>& constraint,
+                       const Eigen::Ref<const Eigen::VectorXd>& dual_solution);
+
+  // Returns the dual solution of `constraint`, or nullptr if it has none.
+  const Eigen::VectorXd* FindDualSolution(
+      const Binding<Constraint>& constraint) const;
+
+  std::shared_ptr<const std::unordered_map<symbolic::Variable::Id, int>>
       decision_variable_index_{};
   SolutionResult solution_result_{};
   Eigen::VectorXd x_val_;
@@ -502,8 +570,16 @@ class MathematicalProgramResult final {
   // suboptimal solution suboptimal_x_val_[i].
   std::vector<Eigen::VectorXd> suboptimal_x_val_{};
   std::vector<double> suboptimal_objectives_{};
-  // Stores the dual variable solutions for each constraint.
-  std::unordered_map<Binding<Constraint>, Eigen::VectorXd> dual_solutions_{};
+  // Stores the dual variable solutions for each constraint, in the order in
+  // which they were set. Only the first num_dual_solutions_ entries are
+  // current; the ones after them are left over from before the last Reset(),
+  // and are overwritten in place when the same constraints get their dual
+  // solutions set in the same order again (as they do when the same program
+  // is solved again), which avoids hashing them and reallocating the values.
+  std::vector<DualSolution> dual_solutions_{};
+  int num_dual_solutions_{0};
+  // Maps each constraint in dual_solutions_ to its entry.
+  std::unordered_map<Binding<Constraint>, int> dual_solution_index_{};
 };
 
 }  // namespace solvers
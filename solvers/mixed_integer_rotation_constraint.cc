@@ -3,6 +3,7 @@
 #include <cmath>
 #include <limits>
 
+#include "drake/common/symbolic_decompose.h"
 #include "drake/math/gray_code.h"
 #include "drake/solvers/bilinear_product_util.h"
 #include "drake/solvers/integer_optimization_util.h"
@@ -401,50 +402,149 @@ Eigen::Vector3d FlipVector(const Eigen::Ref<const Eigen::Vector3d>& vpos,
   return v;
 }
 
-// Given (an integer enumeration of) the orthant, return a vector c with
-// c(i) = a(i) if element i is positive in the indicated orthant, otherwise
-// c(i) = b(i).
-template <typename Derived>
-Eigen::Matrix<Derived, 3, 1> PickPermutation(
-    const Eigen::Matrix<Derived, 3, 1>& a,
-    const Eigen::Matrix<Derived, 3, 1>& b, int orthant) {
-  DRAKE_DEMAND(orthant >= 0 && orthant <= 7);
-  Eigen::Matrix<Derived, 3, 1> c = a;
-  if (orthant & (1 << 2)) c(0) = b(0);
-  if (orthant & (1 << 1)) c(1) = b(1);
-  if (orthant & 1) c(2) = b(2);
-  return c;
-}
+// Accumulates the box-sphere intersection constraints on one column (or row)
+// v of R, where v1 and v2 are the other two columns (or rows). Every
+// constraint is a row of the form
+//   lb ≤ a_vᵀ * v + a_v1ᵀ * v1 + a_v2ᵀ * v2 + α * c_sum ≤ ub
+// where c_sum = c[xi](0) + c[yi](1) + c[zi](2) is the sum of three affine
+// expressions picked from cpos and cneg, indicating that v is in box
+// (xi, yi, zi) of one orthant. The rows are stored as sparse triplets over the
+// variables [v; v1; v2; variables in cpos and cneg], so that they are added
+// to the program as a single sparse LinearConstraint without forming any
+// symbolic expression per row.
+class BoxSphereConstraintRows {
+ public:
+  BoxSphereConstraintRows(const VectorDecisionVariable<3>& v,
+                          const VectorDecisionVariable<3>& v1,
+                          const VectorDecisionVariable<3>& v2,
+                          const std::vector<Vector3<Expression>>& cpos,
+                          const std::vector<Vector3<Expression>>& cneg)
+      : N_(cpos.size()) {
+    // Decompose all the entries of cpos and cneg as C * x + c₀ at once.
+    VectorX<Expression> c(6 * N_);
+    for (int k = 0; k < N_; ++k) {
+      c.segment<3>(3 * k) = cpos[k];
+      c.segment<3>(3 * (N_ + k)) = cneg[k];
+    }
+    Eigen::MatrixXd C;
+    VectorXDecisionVariable c_vars;
+    symbolic::DecomposeAffineExpressions(c, &C, &c_constant_, &c_vars);
+    vars_.resize(9 + c_vars.rows());
+    vars_ << v, v1, v2, c_vars;
+    c_terms_.resize(6 * N_);
+    for (int i = 0; i < C.rows(); ++i) {
+      for (int j = 0; j < C.cols(); ++j) {
+        if (C(i, j) != 0) {
+          c_terms_[i].emplace_back(9 + j, C(i, j));
+        }
+      }
+    }
+  }
+
+  // Selects c_sum as the sum of the entries of cpos and cneg for box
+  // (xi, yi, zi) in the given orthant. Element i of c_sum is taken from cpos
+  // if element i is positive in the indicated orthant, otherwise from cneg.
+  void SelectBox(int xi, int yi, int zi, int orthant) {
+    DRAKE_DEMAND(orthant >= 0 && orthant <= 7);
+    c_index_[0] = CIndex(xi, 0, orthant & (1 << 2));
+    c_index_[1] = CIndex(yi, 1, orthant & (1 << 1));
+    c_index_[2] = CIndex(zi, 2, orthant & 1);
+  }
+
+  // Adds the row lb ≤ a_vᵀ * v + a_v1ᵀ * v1 + a_v2ᵀ * v2 + α * c_sum ≤ ub,
+  // with c_sum as chosen by the last call to SelectBox().
+  void AddRow(const Eigen::Vector3d& a_v, const Eigen::Vector3d& a_v1,
+              const Eigen::Vector3d& a_v2, double alpha, double lb,
+              double ub) {
+    const int row = static_cast<int>(lb_.size());
+    for (int i = 0; i < 3; ++i) {
+      AddEntry(row, i, a_v(i));
+      AddEntry(row, 3 + i, a_v1(i));
+      AddEntry(row, 6 + i, a_v2(i));
+    }
+    double c_sum_constant = 0;
+    for (int index : c_index_) {
+      for (const auto& [col, coeff] : c_terms_[index]) {
+        AddEntry(row, col, alpha * coeff);
+      }
+      c_sum_constant += c_constant_(index);
+    }
+    lb_.push_back(lb - alpha * c_sum_constant);
+    ub_.push_back(ub - alpha * c_sum_constant);
+  }
+
+  void AddToProgram(MathematicalProgram* prog) const {
+    Eigen::SparseMatrix<double> A(lb_.size(), vars_.rows());
+    A.setFromTriplets(triplets_.begin(), triplets_.end());
+    prog->AddLinearConstraint(
+        A, Eigen::Map<const Eigen::VectorXd>(lb_.data(), lb_.size()),
+        Eigen::Map<const Eigen::VectorXd>(ub_.data(), ub_.size()), vars_);
+  }
+
+ private:
+  // The index of cpos[k](axis) (or cneg[k](axis) if `negative` is true) in
+  // c_terms_ and c_constant_.
+  int CIndex(int k, int axis, bool negative) const {
+    return 3 * (negative ? N_ + k : k) + axis;
+  }
+
+  void AddEntry(int row, int col, double value) {
+    if (value != 0) {
+      triplets_.emplace_back(row, col, value);
+    }
+  }
+
+  // Number of intervals per half axis.
+  int N_{};
+  VectorXDecisionVariable vars_;
+  // c_terms_[CIndex(k, axis, negative)] contains the (column in vars_,
+  // coefficient) pairs of the affine expression cpos[k](axis) (or
+  // cneg[k](axis)), and c_constant_ contains its constant term.
+  std::vector<std::vector<std::pair<int, double>>> c_terms_;
+  Eigen::VectorXd c_constant_;
+  std::array<int, 3> c_index_{};
+  std::vector<Eigen::Triplet<double>> triplets_;
+  std::vector<double> lb_;
+  std::vector<double> ub_;
+};
 
 void AddBoxSphereIntersectionConstraints(
     MathematicalProgram* prog, const VectorDecisionVariable<3>& v,
     const std::vector<Vector3<Expression>>& cpos,
     const std::vector<Vector3<Expression>>& cneg,
     const VectorDecisionVariable<3>& v1, const VectorDecisionVariable<3>& v2,
-    const std::vector<std::vector<std::vector<std::vector<Eigen::Vector3d>>>>&
-        box_sphere_intersection_vertices,
-    const std::vector<
-        std::vector<std::vector<std::pair<Eigen::Vector3d, double>>>>&
-        box_sphere_intersection_halfspace) {
+    const internal::BoxSphereIntersections& box_sphere_intersections) {
   const int N = cpos.size();  // number of discretization points.
+  DRAKE_DEMAND(box_sphere_intersections.num_intervals_per_half_axis == N);
+  const double kInf = std::numeric_limits<double>::infinity();
+  const Eigen::Vector3d kZero = Eigen::Vector3d::Zero();
 
+  // Returns the matrix [u]ₓ such that [u]ₓ * x = u.cross(x).
+  auto cross_product_matrix = [](const Eigen::Vector3d& u) {
+    Eigen::Matrix3d u_cross;
+    for (int j = 0; j < 3; ++j) {
+      u_cross.col(j) = u.cross(Eigen::Vector3d::Unit(j));
+    }
+    return u_cross;
+  };
+
+  BoxSphereConstraintRows rows(v, v1, v2, cpos, cneg);
   // Iterate through regions.
   for (int xi = 0; xi < N; xi++) {
     for (int yi = 0; yi < N; yi++) {
       for (int zi = 0; zi < N; zi++) {
-        Vector3<Expression> this_cpos, this_cneg;
-        this_cpos << cpos[xi](0), cpos[yi](1), cpos[zi](2);
-        this_cneg << cneg[xi](0), cneg[yi](1), cneg[zi](2);
+        const internal::BoxSphereIntersection& box =
+            box_sphere_intersections.box(xi, yi, zi);
 
         // If the box and the sphere surface has intersection
-        if (box_sphere_intersection_vertices[xi][yi][zi].size() > 0) {
+        if (box.vertices.size() > 0) {
           // The box intersects with the surface of the unit sphere.
           // Two possible cases
           // 1. If the box bmin <= x <= bmax intersects with the surface of the
           // unit sphere at a unique point (either bmin or bmax),
           // 2. Otherwise, there is a region of intersection.
 
-          if (box_sphere_intersection_vertices[xi][yi][zi].size() == 1) {
+          if (box.vertices.size() == 1) {
             // If box_min or box_max is on the sphere, then denote the point on
             // the sphere as u, we have the following condition
             // if c[xi](0) = 1 and c[yi](1) == 1 and c[zi](2) == 1, then
@@ -465,37 +565,31 @@ void AddBoxSphereIntersectionConstraints(
             //   2 * c[xi](0) + c[yi](1) + c[zi](2) - 6
             //       <= v.cross(v1) - v2 <= 6 - 2 * (c[xi](0) + c[yi](1) +
             //       c[zi](2))
+            // where v is replaced by u in the dot and cross products.
 
             // `u` in the documentation above.
-            const Eigen::Vector3d unique_intersection =
-                box_sphere_intersection_vertices[xi][yi][zi][0];
-            Eigen::Vector3d orthant_u;
-            Vector3<Expression> orthant_c;
+            const Eigen::Vector3d& unique_intersection = box.vertices[0];
             for (int o = 0; o < 8; o++) {  // iterate over orthants
-              orthant_u = FlipVector(unique_intersection, o);
-              orthant_c = PickPermutation(this_cpos, this_cneg, o);
-
-              // TODO(hongkai.dai): remove this for loop when we can handle
-              // Eigen::Array of symbolic formulae.
-              Expression orthant_c_sum = orthant_c.cast<Expression>().sum();
+              const Eigen::Vector3d orthant_u =
+                  FlipVector(unique_intersection, o);
+              const Eigen::Matrix3d orthant_u_cross =
+                  cross_product_matrix(orthant_u);
+              rows.SelectBox(xi, yi, zi, o);
               for (int i = 0; i < 3; ++i) {
-                prog->AddLinearConstraint(v(i) - orthant_u(i) <=
-                                          6 - 2 * orthant_c_sum);
-                prog->AddLinearConstraint(v(i) - orthant_u(i) >=
-                                          2 * orthant_c_sum - 6);
+                const Eigen::Vector3d e_i = Eigen::Vector3d::Unit(i);
+                rows.AddRow(e_i, kZero, kZero, 2, -kInf, 6 + orthant_u(i));
+                rows.AddRow(e_i, kZero, kZero, -2, orthant_u(i) - 6, kInf);
               }
-              const Expression v_dot_v1 = orthant_u.dot(v1);
-              const Expression v_dot_v2 = orthant_u.dot(v2);
-              prog->AddLinearConstraint(v_dot_v1 <= 3 - orthant_c_sum);
-              prog->AddLinearConstraint(orthant_c_sum - 3 <= v_dot_v1);
-              prog->AddLinearConstraint(v_dot_v2 <= 3 - orthant_c_sum);
-              prog->AddLinearConstraint(orthant_c_sum - 3 <= v_dot_v2);
-              const Vector3<Expression> v_cross_v1 = orthant_u.cross(v1);
+              rows.AddRow(kZero, orthant_u, kZero, 1, -kInf, 3);
+              rows.AddRow(kZero, orthant_u, kZero, -1, -3, kInf);
+              rows.AddRow(kZero, kZero, orthant_u, 1, -kInf, 3);
+              rows.AddRow(kZero, kZero, orthant_u, -1, -3, kInf);
               for (int i = 0; i < 3; ++i) {
-                prog->AddLinearConstraint(v_cross_v1(i) - v2(i) <=
-                                          6 - 2 * orthant_c_sum);
-                prog->AddLinearConstraint(v_cross_v1(i) - v2(i) >=
-                                          2 * orthant_c_sum - 6);
+                const Eigen::Vector3d e_i = Eigen::Vector3d::Unit(i);
+                rows.AddRow(kZero, orthant_u_cross.row(i).transpose(), -e_i, 2,
+                            -kInf, 6);
+                rows.AddRow(kZero, orthant_u_cross.row(i).transpose(), -e_i,
+                            -2, -6, kInf);
               }
             }
           } else {
@@ -503,31 +597,23 @@ void AddBoxSphereIntersectionConstraints(
             // the tightest linear constraint of the form:
             //    d <= n'*v
             // that puts v inside (but as close as possible to) the unit circle.
-
-            const double d =
-                box_sphere_intersection_halfspace[xi][yi][zi].second;
-            const Eigen::Vector3d& normal =
-                box_sphere_intersection_halfspace[xi][yi][zi].first;
-
-            Eigen::VectorXd b(0);
-            Eigen::Matrix<double, Eigen::Dynamic, 3> A(0, 3);
-
-            internal::ComputeInnerFacetsForBoxSphereIntersection(
-                box_sphere_intersection_vertices[xi][yi][zi], &A, &b);
+            const double d = box.d;
+            const Eigen::Vector3d& normal = box.normal;
+            const Eigen::Matrix<double, Eigen::Dynamic, 3>& A = box.A;
+            const Eigen::VectorXd& b = box.b;
 
             // theta is the maximal angle between v and normal, where v is an
             // intersecting point between the box and the sphere.
             double cos_theta = d;
             const double theta = std::acos(cos_theta);
+            const double sin_theta{sin(theta)};
+            const double sin_theta2 = sin(theta / 2);
 
-            Eigen::Matrix<double, 1, 6> a;
-            Eigen::Matrix<double, 3, 9> A_cross;
-
-            Eigen::Vector3d orthant_normal;
-            Vector3<Expression> orthant_c;
             for (int o = 0; o < 8; o++) {  // iterate over orthants
-              orthant_normal = FlipVector(normal, o);
-              orthant_c = PickPermutation(this_cpos, this_cneg, o);
+              const Eigen::Vector3d orthant_normal = FlipVector(normal, o);
+              const Eigen::Matrix3d orthant_normal_cross =
+                  cross_product_matrix(orthant_normal);
+              rows.SelectBox(xi, yi, zi, o);
 
               for (int i = 0; i < A.rows(); ++i) {
                 // Add the constraint that A * v <= b, representing the inner
@@ -542,23 +628,19 @@ void AddBoxSphereIntersectionConstraints(
                 //   A.row(i) * v <= b(i)
                 // Otherwise
                 //   A.row(i) * v -b(i) is not constrained
-                Eigen::Vector3d orthant_a =
+                const Eigen::Vector3d orthant_a =
                     -FlipVector(-A.row(i).transpose(), o);
-                prog->AddLinearConstraint(
-                    orthant_a.dot(v) - b(i) <=
-                    3 - 3 * b(i) +
-                        (b(i) - 1) *
-                            orthant_c.cast<symbolic::Expression>().sum());
+                rows.AddRow(orthant_a, kZero, kZero, 1 - b(i), -kInf,
+                            3 - 2 * b(i));
               }
 
               // Max vector norm constraint: -1 <= normal'*x <= 1.
               // No need to restrict to this orthant, but also no need to apply
               // the same constraint twice (would be the same for opposite
               // orthants), so skip all of the -x orthants.
-              if (o % 2 == 0)
-                prog->AddLinearConstraint(orthant_normal.transpose(), -1, 1, v);
-
-              const symbolic::Expression orthant_c_sum{orthant_c.sum()};
+              if (o % 2 == 0) {
+                rows.AddRow(orthant_normal, kZero, kZero, 0, -1, 1);
+              }
 
               // Dot-product constraint: ideally v.dot(v1) = v.dot(v2) = 0.
               // The cone of (unit) vectors within theta of the normal vector
@@ -596,16 +678,14 @@ void AddBoxSphereIntersectionConstraints(
               // nᵀ * v2 - sinθ <= (1 - sinθ)*(3 - c_sum)
               // nᵀ * v1 + sinθ >= (-1 + sinθ)*(3 - c_sum)
               // nᵀ * v2 + sinθ >= (-1 + sinθ)*(3 - c_sum)
-              const double sin_theta{sin(theta)};
-              prog->AddLinearConstraint(orthant_normal.dot(v1) + sin_theta >=
-                                        (-1 + sin_theta) * (3 - orthant_c_sum));
-              prog->AddLinearConstraint(orthant_normal.dot(v2) + sin_theta >=
-                                        (-1 + sin_theta) * (3 - orthant_c_sum));
-
-              prog->AddLinearConstraint(orthant_normal.dot(v1) - sin_theta <=
-                                        (1 - sin_theta) * (3 - orthant_c_sum));
-              prog->AddLinearConstraint(orthant_normal.dot(v2) - sin_theta <=
-                                        (1 - sin_theta) * (3 - orthant_c_sum));
+              rows.AddRow(kZero, orthant_normal, kZero, sin_theta - 1,
+                          2 * sin_theta - 3, kInf);
+              rows.AddRow(kZero, kZero, orthant_normal, sin_theta - 1,
+                          2 * sin_theta - 3, kInf);
+              rows.AddRow(kZero, orthant_normal, kZero, 1 - sin_theta, -kInf,
+                          3 - 2 * sin_theta);
+              rows.AddRow(kZero, kZero, orthant_normal, 1 - sin_theta, -kInf,
+                          3 - 2 * sin_theta);
 
               // Cross-product constraint: ideally v2 = v.cross(v1).
               // Since v is within theta of normal, we will prove that
@@ -633,33 +713,28 @@ void AddBoxSphereIntersectionConstraints(
               // Note: Again this constraint could be tighter as a Lorenz cone
               // constraint of the form:
               //   |v2 - normal.cross(v1)| <= 2*sin(θ/2).
-              const double sin_theta2 = sin(theta / 2);
-              const Vector3<symbolic::Expression> v2_minus_n_cross_v1{
-                  v2 - orthant_normal.cross(v1)};
-              prog->AddLinearConstraint(
-                  v2_minus_n_cross_v1 <=
-                  Vector3<symbolic::Expression>::Constant(
-                      2 * sin_theta2 +
-                      (2 - 2 * sin_theta2) * (3 - orthant_c_sum)));
-              prog->AddLinearConstraint(
-                  v2_minus_n_cross_v1 >=
-                  Vector3<symbolic::Expression>::Constant(
-                      -2 * sin_theta2 +
-                      (-2 + 2 * sin_theta2) * (3 - orthant_c_sum)));
+              for (int i = 0; i < 3; ++i) {
+                const Eigen::Vector3d e_i = Eigen::Vector3d::Unit(i);
+                const Eigen::Vector3d a_v1 =
+                    -orthant_normal_cross.row(i).transpose();
+                rows.AddRow(kZero, a_v1, e_i, 2 - 2 * sin_theta2, -kInf,
+                            6 - 4 * sin_theta2);
+                rows.AddRow(kZero, a_v1, e_i, -2 + 2 * sin_theta2,
+                            4 * sin_theta2 - 6, kInf);
+              }
             }
           }
         } else {
           // This box does not intersect with the surface of the sphere.
           for (int o = 0; o < 8; ++o) {  // iterate over orthants
-            prog->AddLinearConstraint(PickPermutation(this_cpos, this_cneg, o)
-                                          .cast<Expression>()
-                                          .sum(),
-                                      0.0, 2.0);
+            rows.SelectBox(xi, yi, zi, o);
+            rows.AddRow(kZero, kZero, kZero, 1, 0, 2);
           }
         }
       }
     }
   }
+  rows.AddToProgram(prog);
 }
 
 // This function just calls AddBoxSphereIntersectionConstraints for each
@@ -669,11 +744,7 @@ void AddBoxSphereIntersectionConstraintsForR(
     const std::vector<Matrix3<symbolic::Expression>>& CRpos,
     const std::vector<Matrix3<symbolic::Expression>>& CRneg,
     int num_intervals_per_half_axis,
-    const std::vector<std::vector<std::vector<std::vector<Eigen::Vector3d>>>>&
-        box_sphere_intersection_vertices,
-    const std::vector<
-        std::vector<std::vector<std::pair<Eigen::Vector3d, double>>>>&
-        box_sphere_intersection_halfspace,
+    const internal::BoxSphereIntersections& box_sphere_intersections,
     MathematicalProgram* prog) {
   // Add constraints to the column and row vectors.
   std::vector<Vector3<Expression>> cpos(num_intervals_per_half_axis),
@@ -689,7 +760,7 @@ void AddBoxSphereIntersectionConstraintsForR(
     }
     AddBoxSphereIntersectionConstraints(
         prog, R.col(i), cpos, cneg, R.col((i + 1) % 3), R.col((i + 2) % 3),
-        box_sphere_intersection_vertices, box_sphere_intersection_halfspace);
+        box_sphere_intersections);
 
     for (int k = 0; k < num_intervals_per_half_axis; k++) {
       cpos[k] = CRpos[k].row(i).transpose();
@@ -697,8 +768,7 @@ void AddBoxSphereIntersectionConstraintsForR(
     }
     AddBoxSphereIntersectionConstraints(
         prog, R.row(i).transpose(), cpos, cneg, R.row((i + 1) % 3).transpose(),
-        R.row((i + 2) % 3).transpose(), box_sphere_intersection_vertices,
-        box_sphere_intersection_halfspace);
+        R.row((i + 2) % 3).transpose(), box_sphere_intersections);
   }
 }
 
@@ -753,71 +823,6 @@ void GetCRposAndCRnegForLogarithmicBinning(
   }
 }
 
-/**
- * Compute the vertices of the intersection region between the boxes and the
- * sphere surface. Also compute the tightest halfspace that contains the
- * intersection region.
- */
-void ComputeBoxSphereIntersectionAndHalfSpace(
-    int num_intervals_per_half_axis,
-    const Eigen::Ref<const Eigen::VectorXd>& phi_nonnegative,
-    std::vector<std::vector<std::vector<std::vector<Eigen::Vector3d>>>>*
-        box_sphere_intersection_vertices,
-    std::vector<std::vector<std::vector<std::pair<Eigen::Vector3d, double>>>>*
-        box_sphere_intersection_halfspace) {
-  const double kEpsilon = std::numeric_limits<double>::epsilon();
-
-  box_sphere_intersection_vertices->resize(num_intervals_per_half_axis);
-  box_sphere_intersection_halfspace->resize(num_intervals_per_half_axis);
-  for (int xi = 0; xi < num_intervals_per_half_axis; ++xi) {
-    (*box_sphere_intersection_vertices)[xi].resize(num_intervals_per_half_axis);
-    (*box_sphere_intersection_halfspace)[xi].resize(
-        num_intervals_per_half_axis);
-    for (int yi = 0; yi < num_intervals_per_half_axis; ++yi) {
-      (*box_sphere_intersection_vertices)[xi][yi].resize(
-          num_intervals_per_half_axis);
-      (*box_sphere_intersection_halfspace)[xi][yi].resize(
-          num_intervals_per_half_axis);
-      for (int zi = 0; zi < num_intervals_per_half_axis; ++zi) {
-        const Eigen::Vector3d box_min(phi_nonnegative(xi), phi_nonnegative(yi),
-                                      phi_nonnegative(zi));
-        const Eigen::Vector3d box_max(phi_nonnegative(xi + 1),
-                                      phi_nonnegative(yi + 1),
-                                      phi_nonnegative(zi + 1));
-        const double box_min_norm = box_min.lpNorm<2>();
-        const double box_max_norm = box_max.lpNorm<2>();
-        if (box_min_norm <= 1.0 - kEpsilon && box_max_norm >= 1.0 + kEpsilon) {
-          // box_min is strictly inside the sphere, box_max is strictly
-          // outside of the sphere.
-          // We choose eps here, because if a vector x has unit length, and
-          // another vector y is different from x by eps (||x - y||∞ < eps),
-          // then max ||y||₂ - 1 is eps.
-          (*box_sphere_intersection_vertices)[xi][yi][zi] =
-              internal::ComputeBoxEdgesAndSphereIntersection(box_min, box_max);
-          DRAKE_DEMAND((*box_sphere_intersection_vertices)[xi][yi][zi].size() >=
-                       3);
-
-          Eigen::Vector3d normal{};
-          internal::ComputeHalfSpaceRelaxationForBoxSphereIntersection(
-              (*box_sphere_intersection_vertices)[xi][yi][zi],
-              &((*box_sphere_intersection_halfspace)[xi][yi][zi].first),
-              &((*box_sphere_intersection_halfspace)[xi][yi][zi].second));
-        } else if (std::abs(box_min_norm - 1) < kEpsilon) {
-          // box_min is on the surface. This is the unique intersection point
-          // between the sphere surface and the box.
-          (*box_sphere_intersection_vertices)[xi][yi][zi].push_back(
-              box_min / box_min_norm);
-        } else if (std::abs(box_max_norm - 1) < kEpsilon) {
-          // box_max is on the surface. This is the unique intersection point
-          // between the sphere surface and the box.
-          (*box_sphere_intersection_vertices)[xi][yi][zi].push_back(
-              box_max / box_max_norm);
-        }
-      }
-    }
-  }
-}
-
 }  // namespace
 
 std::string to_string(MixedIntegerRotationConstraintGenerator::Approach type) {
@@ -866,10 +871,8 @@ MixedIntegerRotationConstraintGenerator::
   // halfspace nᵀx≥ d, as the tightest halfspace for each intersection region.
   if (approach_ == Approach::kBoxSphereIntersection ||
       approach_ == Approach::kBoth) {
-    ComputeBoxSphereIntersectionAndHalfSpace(
-        num_intervals_per_half_axis_, phi_nonnegative_,
-        &box_sphere_intersection_vertices_,
-        &box_sphere_intersection_halfspace_);
+    box_sphere_intersections_ =
+        internal::GetBoxSphereIntersections(num_intervals_per_half_axis_);
   }
 }
 
@@ -949,8 +952,7 @@ MixedIntegerRotationConstraintGenerator::AddToProgram(
     }
     AddBoxSphereIntersectionConstraintsForR(
         R, CRpos, CRneg, num_intervals_per_half_axis_,
-        box_sphere_intersection_vertices_, box_sphere_intersection_halfspace_,
-        prog);
+        *box_sphere_intersections_, prog);
   }
   return ret;
 }
@@ -1045,17 +1047,9 @@ AddRotationMatrixBoxSphereIntersectionMilpConstraints(
   AddNotInSameOrOppositeOrthantConstraint(prog, ret.BRpos[0]);
   AddNotInSameOrOppositeOrthantConstraint(prog, ret.BRpos[0].transpose());
 
-  std::vector<std::vector<std::vector<std::vector<Eigen::Vector3d>>>>
-      box_sphere_intersection_vertices;
-  std::vector<std::vector<std::vector<std::pair<Eigen::Vector3d, double>>>>
-      box_sphere_intersection_halfspace;
-  ComputeBoxSphereIntersectionAndHalfSpace(
-      num_intervals_per_half_axis, phi_nonnegative,
-      &box_sphere_intersection_vertices, &box_sphere_intersection_halfspace);
   AddBoxSphereIntersectionConstraintsForR(
       R, ret.CRpos, ret.CRneg, num_intervals_per_half_axis,
-      box_sphere_intersection_vertices, box_sphere_intersection_halfspace,
-      prog);
+      *internal::GetBoxSphereIntersections(num_intervals_per_half_axis), prog);
 
   AddCrossProductImpliedOrthantConstraint(prog, ret.BRpos[0]);
   AddCrossProductImpliedOrthantConstraint(prog, ret.BRpos[0].transpose());
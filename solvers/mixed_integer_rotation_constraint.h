@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -11,6 +12,9 @@
 
 namespace drake {
 namespace solvers {
+namespace internal {
+struct BoxSphereIntersections;
+}  // namespace internal
 
 /**
  * We relax the non-convex SO(3) constraint on rotation matrix R to
@@ -145,18 +149,15 @@ class MixedIntegerRotationConstraintGenerator {
   Eigen::VectorXd phi_nonnegative_;
 
   // When considering the intersection between the box and the sphere surface,
-  // we will compute the vertices of the intersection region, and find one tight
-  // halfspace nᵀx ≥ d, such that all points on the intersection surface satisfy
-  // this halfspace constraint. For intersection region between the box
-  // [φ₊(xi), φ₊(xi+1)] x [φ₊(yi), φ₊(yi+1)] x [φ₊(zi), φ₊(zi+1)] and the sphere
-  // surface, the vertices of the intersection region is in
-  // box_sphere_intersection_vertices_[xi][yi][zi], and the halfspace is
-  // (box_sphere_intersection_halfspace_[xi][yi][zi].first)ᵀ x ≥
-  // box_sphere_intersection_halfspace[xi][yi][zi].second
-  std::vector<std::vector<std::vector<std::vector<Eigen::Vector3d>>>>
-      box_sphere_intersection_vertices_;
-  std::vector<std::vector<std::vector<std::pair<Eigen::Vector3d, double>>>>
-      box_sphere_intersection_halfspace_;
+  // we use the vertices of the intersection region, and one tight halfspace
+  // nᵀx ≥ d, such that all points on the intersection surface satisfy this
+  // halfspace constraint, for each box
+  // [φ₊(xi), φ₊(xi+1)] x [φ₊(yi), φ₊(yi+1)] x [φ₊(zi), φ₊(zi+1)]. This only
+  // depends on num_intervals_per_half_axis_, so it is shared by all the
+  // generators with the same number of intervals. It is null if approach_ is
+  // kBilinearMcCormick.
+  std::shared_ptr<const internal::BoxSphereIntersections>
+      box_sphere_intersections_;
 };
 
 std::string to_string(MixedIntegerRotationConstraintGenerator::Approach type);
@@ -3,8 +3,11 @@
 #include <algorithm>
 #include <array>
 #include <limits>
+#include <map>
+#include <mutex>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/never_destroyed.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/solve.h"
 
@@ -206,10 +209,10 @@ void ComputeHalfSpaceRelaxationForBoxSphereIntersection(
     prog_normal.AddLinearConstraint(n_var.dot(pt) >= d_var(0));
   }
 
-  // TODO(hongkai.dai): This optimization is expensive, especially if we have
-  // multiple rotation matrices, all relaxed with the same number of binary
-  // variables per half axis, the result `n` and `d` are the same. Should
-  // consider hard-coding the result, to avoid repeated computation.
+  // This optimization is expensive. For the boxes used by
+  // MixedIntegerRotationConstraintGenerator, GetBoxSphereIntersections()
+  // caches the result, so that it is only computed once per number of
+  // intervals.
 
   Vector4<symbolic::Expression> lorentz_cone_vars;
   lorentz_cone_vars << 1, n_var;
@@ -271,6 +274,73 @@ void ComputeInnerFacetsForBoxSphereIntersection(
     }
   }
 }
+
+namespace {
+BoxSphereIntersections ComputeBoxSphereIntersections(
+    int num_intervals_per_half_axis) {
+  const double kEpsilon = std::numeric_limits<double>::epsilon();
+  const int N = num_intervals_per_half_axis;
+  const Eigen::VectorXd phi_nonnegative =
+      Eigen::VectorXd::LinSpaced(N + 1, 0, 1);
+
+  BoxSphereIntersections result;
+  result.num_intervals_per_half_axis = N;
+  result.boxes.resize(N * N * N);
+  for (int xi = 0; xi < N; ++xi) {
+    for (int yi = 0; yi < N; ++yi) {
+      for (int zi = 0; zi < N; ++zi) {
+        BoxSphereIntersection& box = result.boxes[(xi * N + yi) * N + zi];
+        const Eigen::Vector3d box_min(phi_nonnegative(xi), phi_nonnegative(yi),
+                                      phi_nonnegative(zi));
+        const Eigen::Vector3d box_max(phi_nonnegative(xi + 1),
+                                      phi_nonnegative(yi + 1),
+                                      phi_nonnegative(zi + 1));
+        const double box_min_norm = box_min.lpNorm<2>();
+        const double box_max_norm = box_max.lpNorm<2>();
+        if (box_min_norm <= 1.0 - kEpsilon && box_max_norm >= 1.0 + kEpsilon) {
+          // box_min is strictly inside the sphere, box_max is strictly
+          // outside of the sphere.
+          // We choose eps here, because if a vector x has unit length, and
+          // another vector y is different from x by eps (||x - y||∞ < eps),
+          // then max ||y||₂ - 1 is eps.
+          box.vertices = ComputeBoxEdgesAndSphereIntersection(box_min, box_max);
+          DRAKE_DEMAND(box.vertices.size() >= 3);
+          ComputeHalfSpaceRelaxationForBoxSphereIntersection(
+              box.vertices, &box.normal, &box.d);
+          ComputeInnerFacetsForBoxSphereIntersection(box.vertices, &box.A,
+                                                     &box.b);
+        } else if (std::abs(box_min_norm - 1) < kEpsilon) {
+          // box_min is on the surface. This is the unique intersection point
+          // between the sphere surface and the box.
+          box.vertices.push_back(box_min / box_min_norm);
+        } else if (std::abs(box_max_norm - 1) < kEpsilon) {
+          // box_max is on the surface. This is the unique intersection point
+          // between the sphere surface and the box.
+          box.vertices.push_back(box_max / box_max_norm);
+        }
+      }
+    }
+  }
+  return result;
+}
+}  // namespace
+
+std::shared_ptr<const BoxSphereIntersections> GetBoxSphereIntersections(
+    int num_intervals_per_half_axis) {
+  DRAKE_DEMAND(num_intervals_per_half_axis >= 1);
+  static never_destroyed<std::mutex> mutex;
+  static never_destroyed<
+      std::map<int, std::shared_ptr<const BoxSphereIntersections>>>
+      cache;
+  std::lock_guard<std::mutex> guard(mutex.access());
+  std::shared_ptr<const BoxSphereIntersections>& result =
+      cache.access()[num_intervals_per_half_axis];
+  if (result == nullptr) {
+    result = std::make_shared<const BoxSphereIntersections>(
+        ComputeBoxSphereIntersections(num_intervals_per_half_axis));
+  }
+  return result;
+}
 }  // namespace internal
 }  // namespace solvers
 }  // namespace drake
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include <Eigen/Core>
@@ -65,6 +66,54 @@ bool AreAllVerticesCoPlanar(const std::vector<Eigen::Vector3d>& pts,
 void ComputeInnerFacetsForBoxSphereIntersection(
     const std::vector<Eigen::Vector3d>& pts,
     Eigen::Matrix<double, Eigen::Dynamic, 3>* A, Eigen::VectorXd* b);
+
+/**
+ * The intersection region between the surface of the unit sphere and one box
+ * [φ₊(xi), φ₊(xi+1)] x [φ₊(yi), φ₊(yi+1)] x [φ₊(zi), φ₊(zi+1)] in the first
+ * orthant, where φ₊(i) = i / N.
+ */
+struct BoxSphereIntersection {
+  /** The vertices of the intersection region. Empty if the box does not
+   * intersect the sphere surface, and a single vertex if the box touches the
+   * sphere surface only at one of its corners. */
+  std::vector<Eigen::Vector3d> vertices;
+  /** The tightest halfspace normalᵀ * x >= d containing the intersection
+   * region, see ComputeHalfSpaceRelaxationForBoxSphereIntersection(). Only
+   * computed if `vertices` has at least 3 entries. */
+  Eigen::Vector3d normal{Eigen::Vector3d::Zero()};
+  double d{0};
+  /** The inner facets A * x <= b of the convex hull of the intersection
+   * region, see ComputeInnerFacetsForBoxSphereIntersection(). Only computed if
+   * `vertices` has at least 3 entries. */
+  Eigen::Matrix<double, Eigen::Dynamic, 3> A;
+  Eigen::VectorXd b;
+};
+
+/**
+ * The intersection regions between the surface of the unit sphere and all the
+ * N³ boxes in the first orthant, with N intervals per half axis.
+ */
+struct BoxSphereIntersections {
+  const BoxSphereIntersection& box(int xi, int yi, int zi) const {
+    return boxes[(xi * num_intervals_per_half_axis + yi) *
+                     num_intervals_per_half_axis +
+                 zi];
+  }
+
+  int num_intervals_per_half_axis{};
+  std::vector<BoxSphereIntersection> boxes;
+};
+
+/**
+ * Returns the intersection regions between the surface of the unit sphere and
+ * the boxes obtained by cutting [0, 1] evenly into
+ * `num_intervals_per_half_axis` intervals on each axis. This geometry only
+ * depends on `num_intervals_per_half_axis`, so it is computed on the first
+ * call and shared process-wide afterwards. This function is thread-safe.
+ * @pre num_intervals_per_half_axis >= 1.
+ */
+std::shared_ptr<const BoxSphereIntersections> GetBoxSphereIntersections(
+    int num_intervals_per_half_axis);
 }  // namespace internal
 }  // namespace solvers
 }  // namespace drake
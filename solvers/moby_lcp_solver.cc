@@ -73,6 +73,33 @@ VectorX<double> LinearSolve(
   return M.partialPivLu().solve(b);
 }
 
+// Computes the inverse of a linear basis, using the same factorizations (and
+// subject to the same caveats) as LinearSolve().
+template <class T>
+MatrixX<T> InvertBasis(const MatrixX<T>& M) {
+  return M.householderQr().solve(MatrixX<T>::Identity(M.rows(), M.cols()));
+}
+
+template <>
+MatrixX<double> InvertBasis(const MatrixX<double>& M) {
+  return M.partialPivLu().inverse();
+}
+
+// Replaces column r of a basis B with a column b, updating Binv = B⁻¹ in place
+// (the "product form" update of the revised simplex method). `d` must hold
+// B⁻¹b, computed before the update, and d(r) must be nonzero. This requires
+// O(n²) operations rather than the O(n³) of a fresh factorization.
+template <class T>
+void UpdateBasisInverse(const VectorX<T>& d, int r, MatrixX<T>* Binv) {
+  const RowVectorX<T> pivot_row = Binv->row(r) / d(r);
+  Binv->noalias() -= d * pivot_row;
+  Binv->row(r) = pivot_row;
+}
+
+// The number of pivots after which the basis inverse is recomputed from
+// scratch, which bounds the accumulation of roundoff error from the updates.
+constexpr unsigned kRefactorizationInterval = 50;
+
 // Utility function for copying part of a matrix (designated by the indices
 // in rows and cols) from in to a target matrix, out. This template approach
 // allows selecting parts of both sparse and dense matrices for input; only
@@ -132,6 +159,18 @@ template <typename T>
 void MobyLCPSolver<T>::SetLoggingEnabled(bool enabled) {
   log_enabled_ = enabled; }
 
+template <typename T>
+void MobyLCPSolver<T>::SetWarmStartingEnabled(bool enabled) {
+  warm_start_enabled_ = enabled;
+  if (!enabled) ClearWarmStart();
+}
+
+template <typename T>
+void MobyLCPSolver<T>::ClearWarmStart() {
+  warm_start_size_ = -1;
+  warm_start_basis_.clear();
+}
+
 template <typename T>
 std::ostream& MobyLCPSolver<T>::Log() const {
   if (log_enabled_) {
@@ -143,7 +182,6 @@ std::ostream& MobyLCPSolver<T>::Log() const {
 template <typename T>
 void MobyLCPSolver<T>::ClearIndexVectors() const {
   // clear all vectors
-  all_.clear();
   tlist_.clear();
   bas_.clear();
   nonbas_.clear();
@@ -585,6 +623,54 @@ void MobyLCPSolver<T>::FinishLemkeSolution(const MatrixType& M,
   }
 }
 
+template <typename T>
+void MobyLCPSolver<T>::StoreWarmStart(int n) const {
+  warm_start_size_ = n;
+  warm_start_basis_.clear();
+  for (unsigned variable : bas_) {
+    if (variable < static_cast<unsigned>(n))
+      warm_start_basis_.push_back(variable);
+  }
+}
+
+template <typename T>
+bool MobyLCPSolver<T>::SolveLcpLemkeFromWarmStart(const MatrixX<T>& M,
+                                                  const VectorX<T>& q,
+                                                  const T& zero_tol,
+                                                  VectorX<T>* z) const {
+  const int n = q.size();
+  if (warm_start_size_ != n) return false;
+
+  // The remembered basis consists of the z variables recorded in
+  // warm_start_basis_ and the complementary w variables for the remaining
+  // indices. Its columns are the corresponding columns of M (for z) and -I
+  // (for w), and the basic variables solve B*x = -q.
+  ClearIndexVectors();
+  MatrixX<T> B = -MatrixX<T>::Identity(n, n);
+  for (unsigned i = 0; i < static_cast<unsigned>(n); i++) bas_.push_back(i + n);
+  for (unsigned i : warm_start_basis_) {
+    B.col(i) = M.col(i);
+    bas_[i] = i;
+  }
+  const VectorX<T> x = -LinearSolve(B, q);
+
+  // The basis is complementary by construction, so the candidate solves the
+  // LCP if both z and w = Mz + q are nonnegative. The negated comparisons
+  // also reject NaN values, as from a singular basis.
+  z->resize(2 * n);
+  z->setZero();
+  FinishLemkeSolution(M, q, x, z);
+  const VectorX<T> w = M * (*z) + q;
+  for (int i = 0; i < n; i++) {
+    if (!((*z)[i] > -zero_tol) || !(w[i] > -zero_tol)) {
+      Log() << " -- warm start basis does not provide a solution"
+            << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
 template <typename T>
 bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
                                      const VectorX<T>& q, VectorX<T>* z,
@@ -594,8 +680,8 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
 
   // Variables that will be reused multiple times, thus hopefully allowing
   // Eigen to keep from freeing/reallocating memory repeatedly.
-  VectorX<T> result, dj, dl, x, xj, Be, u, z0;
-  MatrixX<T> Bl, t1, t2;
+  VectorX<T> result, dj, dl, x, xj, Be, u;
+  MatrixX<T> Bl, Binv;
 
   if (log_enabled_) {
     Log() << "MobyLCPSolver::SolveLcpLemke() entered" << std::endl;
@@ -629,14 +715,12 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
     return true;
   }
 
-  // Lemke's algorithm doesn't seem to like warmstarting
-  //
-  // TODO(sammy-tri) this is not present in the sparse solver, and it
-  // causes subtle dead code below.
-  z->fill(0);
-
-  // copy z to z0
-  z0 = *z;
+  if (warm_start_enabled_ && SolveLcpLemkeFromWarmStart(M, q, mod_zero_tol,
+                                                         z)) {
+    Log() << " -- warm start basis provides a solution!" << std::endl;
+    Log() << "MobyLCPSolver::SolveLcpLemke() exited" << std::endl;
+    return true;
+  }
 
   ClearIndexVectors();
 
@@ -646,66 +730,18 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
   unsigned t = 2 * n;
   unsigned entering = t;
   unsigned leaving = 0;
-  for (unsigned i = 0; i < n; i++) {
-    all_.push_back(i);
-  }
   unsigned lvindex;
   unsigned idx;
   std::vector<unsigned>::iterator iiter;
 
-  // determine initial basis
-  if (z0.size() != n) {
-    // setup the nonbasic indices
-    for (unsigned i = 0; i < n; i++) nonbas_.push_back(i);
-  } else {
-    for (unsigned i = 0; i < n; i++) {
-      if (z0[i] > 0) {
-        bas_.push_back(i);
-      } else {
-        nonbas_.push_back(i);
-      }
-    }
-  }
-
-  // determine initial values
-  if (!bas_.empty()) {
-    Log() << "-- initial basis not empty (warmstarting)" << std::endl;
-
-    // start from good initial basis
-    Bl.resize(n, n);
-    Bl.setIdentity();
-    Bl *= -1;
-
-    // select columns of M corresponding to z vars in the basis
-    selectSubMat(M, all_, bas_, &t1);
-
-    // select columns of I corresponding to z vars not in the basis
-    selectSubMat(Bl, all_, nonbas_, &t2);
-
-    // setup the basis matrix
-    Bl.resize(n, t1.cols() + t2.cols());
-    Bl.block(0, 0, t1.rows(), t1.cols()) = t1;
-    Bl.block(0, t1.cols(), t2.rows(), t2.cols()) = t2;
-
-    // Solve B*x = -q.
-    x = LinearSolve(Bl, q);
-  } else {
-    Log() << "-- using basis of -1 (no warmstarting)" << std::endl;
-
-    // use standard initial basis
-    Bl.resize(n, n);
-    Bl.setIdentity();
-    Bl *= -1;
-    x = q;
-  }
-
-  // check whether initial basis provides a solution
-  if (x.minCoeff() >= 0.0) {
-    Log() << " -- initial basis provides a solution!" << std::endl;
-    FinishLemkeSolution(M, q, x, z);
-    Log() << "MobyLCPSolver::SolveLcpLemke() exited" << std::endl;
-    return true;
-  }
+  // Start with all z variables nonbasic and the basis B = -I, for which the
+  // solution to B*x = -q is x = q.
+  for (unsigned i = 0; i < n; i++) nonbas_.push_back(i);
+  Bl.resize(n, n);
+  Bl.setIdentity();
+  Bl *= -1;
+  Binv = Bl;
+  x = q;
 
   // use a new pivot tolerance if necessary
   const T naive_piv_tol = n * max(T(1), M.template lpNorm<Eigen::Infinity>()) *
@@ -738,6 +774,8 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
   u *= tval;
   x += u;
   x[lvindex] = tval;
+  dl = Binv * Be;
+  UpdateBasisInverse(dl, lvindex, &Binv);
   Bl.col(lvindex) = Be;
   Log() << "  new q: " << x << std::endl;
 
@@ -755,6 +793,7 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
     // check whether done; if not, get new entering variable
     if (leaving == t) {
       Log() << "-- solved LCP successfully!" << std::endl;
+      if (warm_start_enabled_) StoreWarmStart(n);
       FinishLemkeSolution(M, q, x, z);
       Log() << "MobyLCPSolver::SolveLcpLemke() exited" << std::endl;
       return true;
@@ -767,10 +806,13 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
       entering = leaving - n;
       Be = M.col(entering);
     }
-    dl = Be;
 
-    // See comments above on the possibility of this solve failing.
-    dl = LinearSolve(Bl, dl.eval());
+    // Solve B*dl = Be using the basis inverse, which is periodically
+    // recomputed from the basis itself. See comments above LinearSolve() on
+    // the possibility of the basis becoming degenerate.
+    if (pivots_ > 0 && pivots_ % kRefactorizationInterval == 0)
+      Binv = InvertBasis(Bl);
+    dl.noalias() = Binv * Be;
 
     // ** find new leaving variable
     j_.clear();
@@ -869,6 +911,7 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
 
     // ** perform pivot
     const T ratio = x[lvindex] / dl[lvindex];
+    UpdateBasisInverse(dl, lvindex, &Binv);
     dl *= ratio;
     x -= dl;
     x[lvindex] = ratio;
@@ -76,6 +76,20 @@ class MobyLCPSolver final : public SolverBase {
 
   void SetLoggingEnabled(bool enabled);
 
+  /// Enables or disables warm starting of SolveLcpLemke() (disabled by
+  /// default). When enabled, the solver remembers the basis at which the last
+  /// successful Lemke solve terminated. A later problem of the same dimension
+  /// is first tried at that basis, which requires a single linear solve; if
+  /// the resulting candidate solves the new problem to within the zero
+  /// tolerance, it is returned without any pivoting (and get_num_pivots()
+  /// returns zero). Otherwise the solver falls back to Lemke's Algorithm from
+  /// the usual starting basis. This pays off for sequences of closely related
+  /// problems, e.g., those posed by a time stepping scheme.
+  void SetWarmStartingEnabled(bool enabled);
+
+  /// Forgets the basis remembered for warm starting, if any.
+  void ClearWarmStart();
+
   /// Calculates the zero tolerance that the solver would compute if the user
   /// does not specify a tolerance.
   template <class U>
@@ -198,13 +212,14 @@ class MobyLCPSolver final : public SolverBase {
   /// success/failure.
   /// @param[in] M the LCP matrix.
   /// @param[in] q the LCP vector.
-  /// @param[in,out] z the solution to the LCP on return (if the solver
-  ///                succeeds). If the length of z is equal to the length of q,
-  ///                the solver will attempt to use z's value as a starting
-  ///                solution. **This warmstarting is generally not
-  ///                recommended**: it has a predisposition to lead to a failing
-  ///                pivoting sequence. If the solver fails (returns `false`),
-  ///                `z` will be set to the zero vector.
+  /// The basis inverse is updated in place after each pivot (with periodic
+  /// refactorization to bound roundoff error), so each pivot costs O(n²)
+  /// rather than the O(n³) of a fresh factorization. See
+  /// SetWarmStartingEnabled() for reusing the basis of the previous solve.
+  ///
+  /// @param[out] z the solution to the LCP on return (if the solver
+  ///               succeeds). If the solver fails (returns `false`), `z` will
+  ///               be set to the zero vector.
   /// @param[in] zero_tol The tolerance for testing against zero. If the
   ///            tolerance is negative (default) the solver will determine a
   ///            generally reasonable tolerance.
@@ -248,12 +263,8 @@ class MobyLCPSolver final : public SolverBase {
   /// Algorithm. See SolveLcpFastRegularized() for a description of all
   /// calling parameters other than @p z, which apply equally well to this
   /// function.
-  /// @param[in,out] z the solution to the LCP on return (if the solver
-  ///                succeeds). If the length of z is equal to the length of q,
-  ///                the solver will attempt to use z's value as a starting
-  ///                solution. **This warmstarting is generally not
-  ///                recommended**: it has a predisposition to lead to a failing
-  ///                pivoting sequence.
+  /// @param[out] z the solution to the LCP on return (if the solver
+  ///               succeeds).
   ///
   /// @sa SolveLcpFastRegularized()
   /// @sa SolveLcpLemke()
@@ -290,6 +301,14 @@ class MobyLCPSolver final : public SolverBase {
 
   void ClearIndexVectors() const;
 
+  // Attempts to solve the LCP using the basis remembered from the last
+  // successful Lemke solve. On success, sets `z` and returns `true`.
+  bool SolveLcpLemkeFromWarmStart(const MatrixX<T>& M, const VectorX<T>& q,
+                                  const T& zero_tol, VectorX<T>* z) const;
+
+  // Records the z variables in the basis `bas_` for later warm starts.
+  void StoreWarmStart(int n) const;
+
   template <typename MatrixType, typename Scalar>
   void FinishLemkeSolution(const MatrixType& M, const VectorX<Scalar>& q,
                            const VectorX<Scalar>& x, VectorX<Scalar>* z) const;
@@ -300,6 +319,14 @@ class MobyLCPSolver final : public SolverBase {
   bool log_enabled_{false};
   mutable std::ofstream null_stream_;
 
+  // The dimension of the last problem solved by SolveLcpLemke() and the
+  // indices of the z variables in its final basis (the remaining basic
+  // variables are the complementary w variables). A dimension of -1 indicates
+  // that no basis is available.
+  bool warm_start_enabled_{false};
+  mutable int warm_start_size_{-1};
+  mutable std::vector<unsigned> warm_start_basis_;
+
   // Records the number of pivoting operations used during the last solve.
   mutable unsigned pivots_{0};
 
@@ -307,7 +334,7 @@ class MobyLCPSolver final : public SolverBase {
   // allocations; all are marked 'mutable' as they do not affect the
   // semantic const'ness of the class under its methods.
   // Vectors which correspond to indices into other data.
-  mutable std::vector<unsigned> all_, tlist_, bas_, nonbas_, j_;
+  mutable std::vector<unsigned> tlist_, bas_, nonbas_, j_;
 };
 
 }  // end namespace solvers
@@ -19,5 +19,20 @@ void OsqpSolver::DoSolve(
       "solver.");
 }
 
+struct OsqpSolverSession::Impl {};
+
+OsqpSolverSession::OsqpSolverSession(
+    const MathematicalProgram* prog,
+    const std::optional<SolverOptions>&)
+    : prog_(prog) {}
+
+OsqpSolverSession::~OsqpSolverSession() = default;
+
+MathematicalProgramResult OsqpSolverSession::Solve() {
+  throw std::runtime_error(
+      "The OSQP bindings were not compiled.  You'll need to use a different "
+      "solver.");
+}
+
 }  // namespace solvers
 }  // namespace drake
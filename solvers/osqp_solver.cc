@@ -1,5 +1,9 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <osqp.h>
@@ -127,7 +131,7 @@ void ParseLinearConstraints(
     const std::vector<int> x_indices =
         prog.FindDecisionVariableIndices(constraint.variables());
     const std::vector<Eigen::Triplet<double>> Ai_triplets =
-        math::SparseMatrixToTriplets(constraint.evaluator()->A());
+        math::SparseMatrixToTriplets(constraint.evaluator()->get_sparse_A());
     const Binding<Constraint> constraint_cast =
         internal::BindingDynamicCast<Constraint>(constraint);
     constraint_start_row->emplace(constraint_cast, *num_A_rows);
@@ -317,56 +321,50 @@ void SetDualSolution(
                                    constraint.evaluator()->num_constraints()));
   }
 }
-}  // namespace
-
-bool OsqpSolver::is_available() { return true; }
-
-void OsqpSolver::DoSolve(
-    const MathematicalProgram& prog,
-    const Eigen::VectorXd& initial_guess,
-    const SolverOptions& merged_options,
-    MathematicalProgramResult* result) const {
-  OsqpSolverDetails& solver_details =
-      result->SetSolverDetailsType<OsqpSolverDetails>();
-
-  // TODO(hongkai.dai): OSQP uses initial guess to warm start.
-  unused(initial_guess);
-
-  // OSQP solves a convex quadratic programming problem
-  // min 0.5 xᵀPx + qᵀx
-  // s.t l ≤ Ax ≤ u
-  // OSQP is written in C, so this function will be in C style.
-
-  // Get the cost for the QP.
-  Eigen::SparseMatrix<c_float> P_sparse;
-  std::vector<c_float> q(prog.num_vars(), 0);
+// The OSQP problem
+// min 0.5 xᵀPx + qᵀx
+// s.t l ≤ Ax ≤ u
+// parsed from a MathematicalProgram.
+struct OsqpProblem {
+  Eigen::SparseMatrix<c_float> P;
+  std::vector<c_float> q;
   double constant_cost_term{0};
-
-  ParseQuadraticCosts(prog, &P_sparse, &q, &constant_cost_term);
-  ParseLinearCosts(prog, &q, &constant_cost_term);
-
-  // linear_constraint_start_row[binding] stores the starting row index in A
+  Eigen::SparseMatrix<c_float> A;
+  std::vector<c_float> l;
+  std::vector<c_float> u;
+  // constraint_start_row[binding] stores the starting row index in A
   // corresponding to the linear constraint `binding`.
   std::unordered_map<Binding<Constraint>, int> constraint_start_row;
+};
+
+OsqpProblem ParseOsqpProblem(const MathematicalProgram& prog) {
+  OsqpProblem problem;
+  problem.q.resize(prog.num_vars(), 0);
+  ParseQuadraticCosts(prog, &problem.P, &problem.q,
+                      &problem.constant_cost_term);
+  ParseLinearCosts(prog, &problem.q, &problem.constant_cost_term);
+  ParseAllLinearConstraints(prog, &problem.A, &problem.l, &problem.u,
+                            &problem.constraint_start_row);
+  problem.P.makeCompressed();
+  problem.A.makeCompressed();
+  return problem;
+}
 
-  // Parse the linear constraints.
-  Eigen::SparseMatrix<c_float> A_sparse;
-  std::vector<c_float> l, u;
-  ParseAllLinearConstraints(prog, &A_sparse, &l, &u, &constraint_start_row);
-
-  // Now pass the constraint and cost to osqp data.
-  OSQPData* data = nullptr;
-
-  // Populate data.
-  data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-
-  data->n = prog.num_vars();
-  data->m = A_sparse.rows();
-  data->P = EigenSparseToCSC(P_sparse);
-  data->q = q.data();
-  data->A = EigenSparseToCSC(A_sparse);
-  data->l = l.data();
-  data->u = u.data();
+// Sets up the OSQP workspace for `problem`. OSQP copies the problem data into
+// the workspace, so `problem` need not outlive it. On failure, returns false
+// and leaves `work` as nullptr.
+bool SetupOsqpWorkspace(const OsqpProblem& problem,
+                        const SolverOptions& merged_options,
+                        OSQPWorkspace** work) {
+  // OSQP only reads the cost and bounds, so it is safe to cast away the const.
+  OSQPData* data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+  data->n = problem.P.cols();
+  data->m = problem.A.rows();
+  data->P = EigenSparseToCSC(problem.P);
+  data->q = const_cast<c_float*>(problem.q.data());
+  data->A = EigenSparseToCSC(problem.A);
+  data->l = const_cast<c_float*>(problem.l.data());
+  data->u = const_cast<c_float*>(problem.u.data());
 
   // Define Solver settings as default.
   // Problem settings
@@ -376,21 +374,42 @@ void OsqpSolver::DoSolve(
 
   SetOsqpSolverSettings(merged_options, settings);
 
+  *work = nullptr;
+  const c_int osqp_setup_err = osqp_setup(work, data, settings);
+  if (osqp_setup_err != 0) {
+    osqp_cleanup(*work);
+    *work = nullptr;
+  }
+
+  c_free(data->P->x);
+  c_free(data->P->i);
+  c_free(data->P->p);
+  c_free(data->P);
+  c_free(data->A->x);
+  c_free(data->A->i);
+  c_free(data->A->p);
+  c_free(data->A);
+  c_free(data);
+  c_free(settings);
+  return *work != nullptr;
+}
+
+// Runs osqp_solve() on `work` and writes the outcome into `result`.
+void SolveAndExtractResult(const MathematicalProgram& prog,
+                           const OsqpProblem& problem, OSQPWorkspace* work,
+                           MathematicalProgramResult* result) {
+  OsqpSolverDetails& solver_details =
+      result->SetSolverDetailsType<OsqpSolverDetails>();
+
   // If any step fails, it will set the solution_result and skip other steps.
   std::optional<SolutionResult> solution_result;
 
-  // Setup workspace.
-  OSQPWorkspace* work = nullptr;
-  if (!solution_result) {
-    const c_int osqp_setup_err = osqp_setup(&work, data, settings);
-    if (osqp_setup_err != 0) {
-      solution_result = SolutionResult::kInvalidInput;
-    }
+  if (work == nullptr) {
+    solution_result = SolutionResult::kInvalidInput;
   }
 
   // Solve problem.
   if (!solution_result) {
-    DRAKE_THROW_UNLESS(work != nullptr);
     const c_int osqp_solve_err = osqp_solve(work);
     if (osqp_solve_err != 0) {
       solution_result = SolutionResult::kInvalidInput;
@@ -428,16 +447,17 @@ void OsqpSolver::DoSolve(
           result->set_x_val(osqp_sol.cast<double>());
         }
 
-        result->set_optimal_cost(work->info->obj_val + constant_cost_term);
+        result->set_optimal_cost(work->info->obj_val +
+                                 problem.constant_cost_term);
         solver_details.y =
             Eigen::Map<Eigen::VectorXd>(work->solution->y, work->data->m);
         solution_result = SolutionResult::kSolutionFound;
         SetDualSolution(prog.linear_constraints(), solver_details.y,
-                        constraint_start_row, result);
+                        problem.constraint_start_row, result);
         SetDualSolution(prog.linear_equality_constraints(), solver_details.y,
-                        constraint_start_row, result);
+                        problem.constraint_start_row, result);
         SetDualSolution(prog.bounding_box_constraints(), solver_details.y,
-                        constraint_start_row, result);
+                        problem.constraint_start_row, result);
 
         break;
       }
@@ -463,19 +483,112 @@ void OsqpSolver::DoSolve(
     }
   }
   result->set_solution_result(solution_result.value());
+}
+
+bool HaveSameSparsity(const Eigen::SparseMatrix<c_float>& m1,
+                      const Eigen::SparseMatrix<c_float>& m2) {
+  return m1.rows() == m2.rows() && m1.cols() == m2.cols() &&
+         m1.nonZeros() == m2.nonZeros() &&
+         std::equal(m1.outerIndexPtr(), m1.outerIndexPtr() + m1.cols() + 1,
+                    m2.outerIndexPtr()) &&
+         std::equal(m1.innerIndexPtr(), m1.innerIndexPtr() + m1.nonZeros(),
+                    m2.innerIndexPtr());
+}
+
+bool HaveSameValues(const Eigen::SparseMatrix<c_float>& m1,
+                    const Eigen::SparseMatrix<c_float>& m2) {
+  return std::equal(m1.valuePtr(), m1.valuePtr() + m1.nonZeros(),
+                    m2.valuePtr());
+}
+}  // namespace
+
+bool OsqpSolver::is_available() { return true; }
+
+void OsqpSolver::DoSolve(
+    const MathematicalProgram& prog,
+    const Eigen::VectorXd& initial_guess,
+    const SolverOptions& merged_options,
+    MathematicalProgramResult* result) const {
+  // TODO(hongkai.dai): OSQP uses initial guess to warm start.
+  unused(initial_guess);
+
+  // OSQP solves a convex quadratic programming problem
+  // min 0.5 xᵀPx + qᵀx
+  // s.t l ≤ Ax ≤ u
+  // OSQP is written in C, so this function will be in C style.
+  const OsqpProblem problem = ParseOsqpProblem(prog);
+
+  OSQPWorkspace* work = nullptr;
+  SetupOsqpWorkspace(problem, merged_options, &work);
+  SolveAndExtractResult(prog, problem, work, result);
 
   // Clean workspace.
   osqp_cleanup(work);
-  c_free(data->P->x);
-  c_free(data->P->i);
-  c_free(data->P->p);
-  c_free(data->P);
-  c_free(data->A->x);
-  c_free(data->A->i);
-  c_free(data->A->p);
-  c_free(data->A);
-  c_free(data);
-  c_free(settings);
+}
+
+struct OsqpSolverSession::Impl {
+  ~Impl() { osqp_cleanup(work); }
+
+  // The problem data most recently passed to `work`.
+  OsqpProblem problem;
+  OSQPWorkspace* work{nullptr};
+};
+
+OsqpSolverSession::OsqpSolverSession(
+    const MathematicalProgram* prog,
+    const std::optional<SolverOptions>& solver_options)
+    : prog_(prog), impl_(std::make_unique<Impl>()) {
+  DRAKE_THROW_UNLESS(prog != nullptr);
+  merged_options_ = solver_options.value_or(SolverOptions{});
+  merged_options_.Merge(prog->solver_options());
+}
+
+OsqpSolverSession::~OsqpSolverSession() = default;
+
+MathematicalProgramResult OsqpSolverSession::Solve() {
+  const OsqpSolver solver;
+  if (!solver.AreProgramAttributesSatisfied(*prog_)) {
+    throw std::invalid_argument(
+        solver.ExplainUnsatisfiedProgramAttributes(*prog_));
+  }
+  MathematicalProgramResult result;
+  result.set_solver_id(OsqpSolver::id());
+  result.set_decision_variable_index(prog_->shared_decision_variable_index());
+
+  OsqpProblem problem = ParseOsqpProblem(*prog_);
+  OsqpProblem& last = impl_->problem;
+  bool updated = false;
+  if (impl_->work != nullptr && HaveSameSparsity(problem.P, last.P) &&
+      HaveSameSparsity(problem.A, last.A)) {
+    // Forward only the data that changed since the previous solve. OSQP keeps
+    // its KKT factorization unless P or A change, and warm-starts from the
+    // previous solution.
+    c_int error = 0;
+    if (!HaveSameValues(problem.P, last.P) ||
+        !HaveSameValues(problem.A, last.A)) {
+      error = error || osqp_update_P_A(impl_->work, problem.P.valuePtr(),
+                                       OSQP_NULL, problem.P.nonZeros(),
+                                       problem.A.valuePtr(), OSQP_NULL,
+                                       problem.A.nonZeros());
+    }
+    if (problem.q != last.q) {
+      error = error || osqp_update_lin_cost(impl_->work, problem.q.data());
+    }
+    if (problem.l != last.l || problem.u != last.u) {
+      error = error || osqp_update_bounds(impl_->work, problem.l.data(),
+                                          problem.u.data());
+    }
+    updated = (error == 0);
+  }
+  if (!updated) {
+    osqp_cleanup(impl_->work);
+    impl_->work = nullptr;
+    SetupOsqpWorkspace(problem, merged_options_, &impl_->work);
+    ++num_setups_;
+  }
+  impl_->problem = std::move(problem);
+  SolveAndExtractResult(*prog_, impl_->problem, impl_->work, &result);
+  return result;
 }
 
 }  // namespace solvers
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <optional>
 #include <string>
 
 #include "drake/common/drake_copyable.h"
@@ -63,5 +65,59 @@ class OsqpSolver final : public SolverBase {
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
 };
+
+/**
+ * Keeps an OSQP workspace alive across repeated solves of one
+ * MathematicalProgram, as in an MPC loop that changes only the linear cost and
+ * the constraint bounds between solves.
+ *
+ * Between calls to Solve(), update the program in place through its bindings,
+ * e.g. with LinearCost::UpdateCoefficients(), Constraint::UpdateLowerBound(),
+ * Constraint::UpdateUpperBound(), or LinearConstraint::UpdateCoefficients().
+ * Each Solve() re-reads the cost and constraint data from the program and
+ * passes only what changed to OSQP (osqp_update_lin_cost, osqp_update_bounds,
+ * osqp_update_P_A). The workspace, and its factorization when P and A are
+ * unchanged, is reused, and the previous solution warm-starts the next solve
+ * (unless the "warm_start" option is 0). If the sizes or the sparsity pattern
+ * of P or A change, e.g. because bindings were added or a coefficient became
+ * zero, the workspace is set up again from scratch.
+ *
+ * The solution may differ from OsqpSolver::Solve() on the same program within
+ * the solver tolerance, because of the warm start.
+ */
+class OsqpSolverSession {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(OsqpSolverSession)
+
+  /**
+   * @param prog The program to solve. It is aliased, and must outlive this
+   * object.
+   * @param solver_options Options used for the whole session. They are merged
+   * with prog's own solver options, as in OsqpSolver::Solve().
+   */
+  explicit OsqpSolverSession(
+      const MathematicalProgram* prog,
+      const std::optional<SolverOptions>& solver_options = std::nullopt);
+
+  ~OsqpSolverSession();
+
+  /**
+   * Solves the program with its current data.
+   * @throws std::exception if OSQP is not available or the program is not
+   * supported by OsqpSolver.
+   */
+  MathematicalProgramResult Solve();
+
+  /** Returns the number of times the OSQP workspace has been set up. */
+  int num_setups() const { return num_setups_; }
+
+ private:
+  struct Impl;
+
+  const MathematicalProgram* const prog_;
+  SolverOptions merged_options_;
+  int num_setups_{0};
+  std::unique_ptr<Impl> impl_;
+};
 }  // namespace solvers
 }  // namespace drake
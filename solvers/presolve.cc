@@ -0,0 +1,420 @@
+#include "drake/solvers/presolve.h"
+
+#include <algorithm>
+#include <exception>
+#include <limits>
+#include <optional>
+
+namespace drake {
+namespace solvers {
+namespace internal {
+namespace {
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+// The rows of a linear constraint lb <= A * x <= ub that remain after
+// substituting the fixed variables.
+struct ReducedRows {
+  Eigen::SparseMatrix<double> A;
+  Eigen::VectorXd lb;
+  Eigen::VectorXd ub;
+  VectorXDecisionVariable vars;
+  std::vector<int> kept_rows;
+};
+
+// Returns the dual solution of `binding` in `result`, if the solver reported
+// one.
+template <typename C>
+std::optional<Eigen::VectorXd> FindDualSolution(
+    const MathematicalProgramResult& result, const Binding<C>& binding) {
+  try {
+    return result.GetDualSolution(binding);
+  } catch (const std::exception&) {
+    return std::nullopt;
+  }
+}
+
+}  // namespace
+
+Presolver::Presolver(const MathematicalProgram& prog) : prog_(prog) {}
+
+std::unique_ptr<Presolver> Presolver::Make(const MathematicalProgram& prog) {
+  if (prog.GetAllCosts().size() !=
+          prog.linear_costs().size() + prog.quadratic_costs().size() ||
+      prog.GetAllConstraints().size() !=
+          prog.linear_constraints().size() +
+              prog.linear_equality_constraints().size() +
+              prog.bounding_box_constraints().size() ||
+      !prog.positive_semidefinite_constraints().empty() ||
+      !prog.visualization_callbacks().empty()) {
+    return nullptr;
+  }
+  const int n = prog.num_vars();
+  for (int i = 0; i < n; ++i) {
+    if (prog.decision_variable(i).get_type() !=
+        symbolic::Variable::Type::CONTINUOUS) {
+      return nullptr;
+    }
+  }
+
+  std::unique_ptr<Presolver> presolver(new Presolver(prog));
+  Presolver& self = *presolver;
+  self.lower_ = Eigen::VectorXd::Constant(n, -kInf);
+  self.upper_ = Eigen::VectorXd::Constant(n, kInf);
+  for (const auto& binding : prog.bounding_box_constraints()) {
+    const auto& lb = binding.evaluator()->lower_bound();
+    const auto& ub = binding.evaluator()->upper_bound();
+    for (int k = 0; k < binding.variables().rows(); ++k) {
+      const int i = prog.FindDecisionVariableIndex(binding.variables()(k));
+      self.lower_(i) = std::max(self.lower_(i), lb(k));
+      self.upper_(i) = std::min(self.upper_(i), ub(k));
+    }
+  }
+  if ((self.lower_.array() > self.upper_.array()).any()) {
+    return nullptr;
+  }
+  self.reduced_index_.resize(n);
+  std::vector<symbolic::Variable> reduced_vars;
+  for (int i = 0; i < n; ++i) {
+    if (self.lower_(i) == self.upper_(i)) {
+      self.reduced_index_[i] = -1;
+    } else {
+      self.reduced_index_[i] = reduced_vars.size();
+      reduced_vars.push_back(prog.decision_variable(i));
+    }
+  }
+  const int num_fixed = n - static_cast<int>(reduced_vars.size());
+  if (reduced_vars.empty()) {
+    return nullptr;
+  }
+  self.reduced_prog_ = std::make_unique<MathematicalProgram>();
+  MathematicalProgram& reduced_prog = *self.reduced_prog_;
+  reduced_prog.AddDecisionVariables(Eigen::Map<VectorXDecisionVariable>(
+      reduced_vars.data(), reduced_vars.size()));
+
+  // Splits the positions of a binding's variables into those of the free
+  // variables, and the values of the fixed ones at the other positions.
+  auto split = [&self](const VectorXDecisionVariable& vars,
+                       std::vector<int>* free_positions,
+                       Eigen::VectorXd* fixed_values) {
+    fixed_values->setZero(vars.rows());
+    for (int k = 0; k < vars.rows(); ++k) {
+      const int i = self.prog_.FindDecisionVariableIndex(vars(k));
+      if (self.reduced_index_[i] < 0) {
+        (*fixed_values)(k) = self.lower_(i);
+      } else {
+        free_positions->push_back(k);
+      }
+    }
+  };
+  auto select = [](const VectorXDecisionVariable& vars,
+                   const std::vector<int>& positions) {
+    VectorXDecisionVariable result(positions.size());
+    for (int j = 0; j < static_cast<int>(positions.size()); ++j) {
+      result(j) = vars(positions[j]);
+    }
+    return result;
+  };
+
+  for (const auto& binding : prog.linear_costs()) {
+    std::vector<int> free_positions;
+    Eigen::VectorXd fixed_values;
+    split(binding.variables(), &free_positions, &fixed_values);
+    const Eigen::VectorXd& a = binding.evaluator()->a();
+    const double b = binding.evaluator()->b() + a.dot(fixed_values);
+    if (free_positions.empty()) {
+      self.constant_cost_ += b;
+      continue;
+    }
+    Eigen::VectorXd a_free(free_positions.size());
+    for (int j = 0; j < a_free.rows(); ++j) {
+      a_free(j) = a(free_positions[j]);
+    }
+    reduced_prog.AddCost(std::make_shared<LinearCost>(a_free, b),
+                         select(binding.variables(), free_positions));
+  }
+  for (const auto& binding : prog.quadratic_costs()) {
+    std::vector<int> free_positions;
+    Eigen::VectorXd fixed_values;
+    split(binding.variables(), &free_positions, &fixed_values);
+    const Eigen::MatrixXd& Q = binding.evaluator()->Q();
+    const Eigen::VectorXd& b = binding.evaluator()->b();
+    // With the fixed values v (and zeros at the free positions), the cost
+    // ½xᵀQx + bᵀx + c is ½x_Fᵀ Q_FF x_F + (b + Q v)_Fᵀ x_F + ½vᵀQv + bᵀv + c.
+    const Eigen::VectorXd b_substituted = b + Q * fixed_values;
+    const double c = binding.evaluator()->c() +
+                     0.5 * fixed_values.dot(Q * fixed_values) +
+                     b.dot(fixed_values);
+    if (free_positions.empty()) {
+      self.constant_cost_ += c;
+      continue;
+    }
+    const int m = free_positions.size();
+    Eigen::MatrixXd Q_free(m, m);
+    Eigen::VectorXd b_free(m);
+    for (int j = 0; j < m; ++j) {
+      b_free(j) = b_substituted(free_positions[j]);
+      for (int k = 0; k < m; ++k) {
+        Q_free(k, j) = Q(free_positions[k], free_positions[j]);
+      }
+    }
+    // A principal submatrix of a PSD matrix is PSD.
+    const std::optional<bool> is_hessian_psd =
+        binding.evaluator()->is_convex() ? std::optional<bool>(true)
+                                         : std::nullopt;
+    reduced_prog.AddCost(
+        std::make_shared<QuadraticCost>(Q_free, b_free, c, is_hessian_psd),
+        select(binding.variables(), free_positions));
+  }
+
+  // Substitutes the fixed variables into lb <= A * x <= ub, and returns its
+  // non-empty rows; returns nullopt if an empty row is violated.
+  auto reduce_rows = [&](const Binding<LinearConstraint>& binding)
+      -> std::optional<ReducedRows> {
+    std::vector<int> free_positions;
+    Eigen::VectorXd fixed_values;
+    split(binding.variables(), &free_positions, &fixed_values);
+    const Eigen::SparseMatrix<double>& A = binding.evaluator()->get_sparse_A();
+    const Eigen::VectorXd shift = A * fixed_values;
+    std::vector<bool> nonempty(A.rows(), false);
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int j = 0; j < static_cast<int>(free_positions.size()); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(A, free_positions[j]);
+           it; ++it) {
+        if (it.value() != 0) {
+          nonempty[it.row()] = true;
+          triplets.emplace_back(it.row(), j, it.value());
+        }
+      }
+    }
+    ReducedRows result;
+    std::vector<int> reduced_row(A.rows(), -1);
+    for (int r = 0; r < A.rows(); ++r) {
+      const double lb = binding.evaluator()->lower_bound()(r) - shift(r);
+      const double ub = binding.evaluator()->upper_bound()(r) - shift(r);
+      if (nonempty[r]) {
+        reduced_row[r] = result.kept_rows.size();
+        result.kept_rows.push_back(r);
+      } else if (lb > 0 || ub < 0) {
+        return std::nullopt;
+      }
+    }
+    const int num_rows = result.kept_rows.size();
+    for (auto& triplet : triplets) {
+      triplet = Eigen::Triplet<double>(reduced_row[triplet.row()],
+                                       triplet.col(), triplet.value());
+    }
+    result.A.resize(num_rows, free_positions.size());
+    result.A.setFromTriplets(triplets.begin(), triplets.end());
+    result.lb.resize(num_rows);
+    result.ub.resize(num_rows);
+    for (int r = 0; r < num_rows; ++r) {
+      result.lb(r) =
+          binding.evaluator()->lower_bound()(result.kept_rows[r]) -
+          shift(result.kept_rows[r]);
+      result.ub(r) =
+          binding.evaluator()->upper_bound()(result.kept_rows[r]) -
+          shift(result.kept_rows[r]);
+    }
+    result.vars = select(binding.variables(), free_positions);
+    return result;
+  };
+
+  int num_dropped_rows = 0;
+  for (const auto& binding : prog.linear_constraints()) {
+    std::optional<ReducedRows> rows = reduce_rows(binding);
+    if (!rows.has_value()) {
+      return nullptr;
+    }
+    num_dropped_rows +=
+        binding.evaluator()->num_constraints() - rows->kept_rows.size();
+    ReducedBinding<LinearConstraint> reduced{binding, std::nullopt,
+                                             rows->kept_rows};
+    if (!rows->kept_rows.empty()) {
+      reduced.reduced = reduced_prog.AddConstraint(
+          std::make_shared<LinearConstraint>(rows->A, rows->lb, rows->ub),
+          rows->vars);
+    }
+    self.linear_constraints_.push_back(std::move(reduced));
+  }
+  for (const auto& binding : prog.linear_equality_constraints()) {
+    std::optional<ReducedRows> rows = reduce_rows(binding);
+    if (!rows.has_value()) {
+      return nullptr;
+    }
+    num_dropped_rows +=
+        binding.evaluator()->num_constraints() - rows->kept_rows.size();
+    ReducedBinding<LinearEqualityConstraint> reduced{binding, std::nullopt,
+                                                     rows->kept_rows};
+    if (!rows->kept_rows.empty()) {
+      reduced.reduced = reduced_prog.AddConstraint(
+          std::make_shared<LinearEqualityConstraint>(rows->A, rows->lb),
+          rows->vars);
+    }
+    self.linear_equality_constraints_.push_back(std::move(reduced));
+  }
+
+  std::vector<int> bounded;
+  for (int i = 0; i < n; ++i) {
+    if (self.reduced_index_[i] >= 0 &&
+        (self.lower_(i) > -kInf || self.upper_(i) < kInf)) {
+      bounded.push_back(i);
+    }
+  }
+  if (!bounded.empty()) {
+    Eigen::VectorXd lb(bounded.size());
+    Eigen::VectorXd ub(bounded.size());
+    VectorXDecisionVariable vars(bounded.size());
+    for (int j = 0; j < static_cast<int>(bounded.size()); ++j) {
+      lb(j) = self.lower_(bounded[j]);
+      ub(j) = self.upper_(bounded[j]);
+      vars(j) = prog.decision_variable(bounded[j]);
+    }
+    self.reduced_bounds_ = reduced_prog.AddBoundingBoxConstraint(lb, ub, vars);
+  }
+
+  if (num_fixed == 0 && num_dropped_rows == 0 &&
+      prog.bounding_box_constraints().size() <= 1) {
+    return nullptr;
+  }
+  return presolver;
+}
+
+Eigen::VectorXd Presolver::ReduceDecisionVariableValues(
+    const Eigen::VectorXd& x) const {
+  DRAKE_DEMAND(x.rows() == prog_.num_vars());
+  Eigen::VectorXd x_reduced(reduced_prog_->num_vars());
+  for (int i = 0; i < prog_.num_vars(); ++i) {
+    if (reduced_index_[i] >= 0) {
+      x_reduced(reduced_index_[i]) = x(i);
+    }
+  }
+  return x_reduced;
+}
+
+void Presolver::RecoverResult(MathematicalProgramResult* result) const {
+  DRAKE_DEMAND(result != nullptr);
+  const int n = prog_.num_vars();
+  auto expand = [&](const Eigen::VectorXd& x_reduced) {
+    Eigen::VectorXd x(n);
+    for (int i = 0; i < n; ++i) {
+      x(i) = reduced_index_[i] < 0 ? lower_(i) : x_reduced(reduced_index_[i]);
+    }
+    return x;
+  };
+  // The (suboptimal) solutions are read before the decision variable index is
+  // replaced, which resets them.
+  const Eigen::VectorXd x = expand(result->get_x_val());
+  std::vector<std::pair<double, Eigen::VectorXd>> suboptimal;
+  for (int j = 0; j < result->num_suboptimal_solution(); ++j) {
+    suboptimal.emplace_back(
+        result->get_suboptimal_objective(j) + constant_cost_,
+        expand(result->GetSuboptimalSolution(
+            reduced_prog_->decision_variables(), j)));
+  }
+  result->set_decision_variable_index(prog_.shared_decision_variable_index());
+  result->set_x_val(x);
+  result->set_optimal_cost(result->get_optimal_cost() + constant_cost_);
+  result->ClearSuboptimalSolutions();
+  for (const auto& [objective, suboptimal_x] : suboptimal) {
+    result->AddSuboptimalSolution(objective, suboptimal_x);
+  }
+
+  // The stationarity of the Lagrangian reads ∇f(x) = Σᵢ λᵢ ∇gᵢ(x), summed over
+  // all constraint rows, where λᵢ is the dual solution of row gᵢ. The duals of
+  // the linear rows are mapped back directly, and their terms accumulated
+  // into `constraint_gradient`; what remains of ∇f for a fixed variable is the
+  // dual of its bounds.
+  Eigen::VectorXd constraint_gradient = Eigen::VectorXd::Zero(n);
+  std::vector<std::pair<Binding<LinearConstraint>, Eigen::VectorXd>> duals;
+  auto recover = [&](const auto& reduced_binding) {
+    const auto& original = reduced_binding.original;
+    Eigen::VectorXd dual =
+        Eigen::VectorXd::Zero(original.evaluator()->num_constraints());
+    if (reduced_binding.reduced.has_value()) {
+      const std::optional<Eigen::VectorXd> reduced_dual =
+          FindDualSolution(*result, *reduced_binding.reduced);
+      if (!reduced_dual.has_value()) {
+        return false;
+      }
+      for (int r = 0; r < reduced_dual->rows(); ++r) {
+        dual(reduced_binding.kept_rows[r]) = (*reduced_dual)(r);
+      }
+    }
+    const Eigen::SparseMatrix<double>& A =
+        original.evaluator()->get_sparse_A();
+    for (int k = 0; k < A.cols(); ++k) {
+      const int i = prog_.FindDecisionVariableIndex(original.variables()(k));
+      for (Eigen::SparseMatrix<double>::InnerIterator it(A, k); it; ++it) {
+        constraint_gradient(i) += dual(it.row()) * it.value();
+      }
+    }
+    duals.emplace_back(original, dual);
+    return true;
+  };
+  for (const auto& reduced_binding : linear_constraints_) {
+    if (!recover(reduced_binding)) return;
+  }
+  for (const auto& reduced_binding : linear_equality_constraints_) {
+    if (!recover(reduced_binding)) return;
+  }
+  Eigen::VectorXd bound_dual = Eigen::VectorXd::Zero(n);
+  if (reduced_bounds_.has_value()) {
+    const std::optional<Eigen::VectorXd> reduced_dual =
+        FindDualSolution(*result, *reduced_bounds_);
+    if (!reduced_dual.has_value()) {
+      return;
+    }
+    for (int j = 0; j < reduced_dual->rows(); ++j) {
+      bound_dual(prog_.FindDecisionVariableIndex(
+          reduced_bounds_->variables()(j))) = (*reduced_dual)(j);
+    }
+  }
+  Eigen::VectorXd cost_gradient = Eigen::VectorXd::Zero(n);
+  for (const auto& binding : prog_.linear_costs()) {
+    for (int k = 0; k < binding.variables().rows(); ++k) {
+      cost_gradient(prog_.FindDecisionVariableIndex(binding.variables()(k))) +=
+          binding.evaluator()->a()(k);
+    }
+  }
+  for (const auto& binding : prog_.quadratic_costs()) {
+    const Eigen::VectorXd gradient =
+        binding.evaluator()->Q() * result->GetSolution(binding.variables()) +
+        binding.evaluator()->b();
+    for (int k = 0; k < binding.variables().rows(); ++k) {
+      cost_gradient(prog_.FindDecisionVariableIndex(binding.variables()(k))) +=
+          gradient(k);
+    }
+  }
+  for (int i = 0; i < n; ++i) {
+    if (reduced_index_[i] < 0) {
+      bound_dual(i) = cost_gradient(i) - constraint_gradient(i);
+    }
+  }
+
+  for (const auto& [binding, dual] : duals) {
+    result->set_dual_solution(binding, dual);
+  }
+  // A positive dual means that the lower bound is active, and a negative one
+  // that the upper bound is. Each is attributed to the first bounding box
+  // constraint that imposes that (merged) bound.
+  std::vector<bool> attributed(n, false);
+  for (const auto& binding : prog_.bounding_box_constraints()) {
+    const auto& lb = binding.evaluator()->lower_bound();
+    const auto& ub = binding.evaluator()->upper_bound();
+    Eigen::VectorXd dual = Eigen::VectorXd::Zero(binding.variables().rows());
+    for (int k = 0; k < binding.variables().rows(); ++k) {
+      const int i = prog_.FindDecisionVariableIndex(binding.variables()(k));
+      if (!attributed[i] && ((bound_dual(i) > 0 && lb(k) == lower_(i)) ||
+                             (bound_dual(i) < 0 && ub(k) == upper_(i)))) {
+        dual(k) = bound_dual(i);
+        attributed[i] = true;
+      }
+    }
+    result->set_dual_solution(binding, dual);
+  }
+}
+
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
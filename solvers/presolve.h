@@ -0,0 +1,100 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/mathematical_program_result.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+
+/* Reduces a program, before it is handed to a solver, by
+ - merging all of its bounding box constraints into a single one,
+ - removing its fixed variables (those whose merged bounds are equal), by
+   substituting their values into the costs and the constraints, and
+ - dropping the rows of its linear (equality) constraints that no longer
+   involve any variable, together with the bindings left with no rows;
+ and maps the solution of the reduced program back to the original one,
+ including the dual solutions of the linear, linear equality and bounding box
+ constraints.
+
+ Only programs whose costs are linear or quadratic, whose constraints are
+ linear, linear equality or bounding box constraints, and whose decision
+ variables are all continuous are presolved. SolverBase::Solve() applies this
+ presolve when CommonSolverOption::kPresolve is set. */
+class Presolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Presolver)
+
+  /* Returns the presolver for `prog`, or nullptr if `prog` is not of the
+   supported form, if it wouldn't shrink, if it has no variable left after the
+   reduction, or if the reduction proves it infeasible (so that the solver
+   reports the infeasibility of the original program). `prog` must outlive
+   the returned object. */
+  static std::unique_ptr<Presolver> Make(const MathematicalProgram& prog);
+
+  /* The reduced program, whose decision variables are the variables of the
+   original program that are not fixed, in their original order. */
+  const MathematicalProgram& reduced_program() const {
+    return *reduced_prog_;
+  }
+
+  /* Returns the entries of the original program's `x` that correspond to the
+   decision variables of the reduced program. */
+  Eigen::VectorXd ReduceDecisionVariableValues(const Eigen::VectorXd& x) const;
+
+  /* Converts `result`, the result of solving the reduced program, into the
+   result of solving the original program. The values of the fixed variables
+   are set (in the solution and in each suboptimal solution), the constant
+   cost terms that the reduction removed are added to the optimal cost (and to
+   each suboptimal objective), and the dual solutions of the original
+   constraints are set if the solver reported the dual solutions of all of the
+   reduced constraints. The dual solution of a fixed variable's bounds is
+   recovered from the stationarity condition, and is attributed to one of the
+   bounding box constraints that fix the variable; likewise the dual solution
+   of a merged bound goes to one of the constraints that impose it. The solver
+   details are left as the solver reported them, i.e., they refer to the
+   reduced program. */
+  void RecoverResult(MathematicalProgramResult* result) const;
+
+ private:
+  // A linear (equality) constraint of the original program, and the
+  // corresponding constraint of the reduced program.
+  template <typename C>
+  struct ReducedBinding {
+    Binding<C> original;
+    // The reduced binding; unset if all rows were dropped.
+    std::optional<Binding<C>> reduced;
+    // kept_rows[i] is the row of `original` of the i'th row of `reduced`.
+    std::vector<int> kept_rows;
+  };
+
+  explicit Presolver(const MathematicalProgram& prog);
+
+  const MathematicalProgram& prog_;
+  std::unique_ptr<MathematicalProgram> reduced_prog_;
+  // The merged bounds of each decision variable of prog_.
+  Eigen::VectorXd lower_;
+  Eigen::VectorXd upper_;
+  // For each decision variable of prog_, its index in reduced_prog_ or -1 if
+  // it is fixed.
+  std::vector<int> reduced_index_;
+  // The sum of the cost terms that only involve fixed variables.
+  double constant_cost_{0};
+  std::vector<ReducedBinding<LinearConstraint>> linear_constraints_;
+  std::vector<ReducedBinding<LinearEqualityConstraint>>
+      linear_equality_constraints_;
+  // The merged bounding box constraint on the variables of reduced_prog_ that
+  // have finite bounds, if any.
+  std::optional<Binding<BoundingBoxConstraint>> reduced_bounds_;
+};
+
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -18,9 +18,11 @@
 // NOLINTNEXTLINE(build/include)
 #include "snopt.h"
 
+#include "drake/common/parallelism.h"
 #include "drake/common/scope_exit.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/autodiff.h"
+#include "drake/solvers/evaluator_memo.h"
 #include "drake/solvers/mathematical_program.h"
 
 // TODO(jwnimmer-tri) Eventually resolve these warnings.
@@ -359,6 +361,27 @@ void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
                     constraint.q().cast<AutoDiffXd>());
 }
 
+// Evaluates a single nonlinear constraint and its gradient in double
+// precision, when the constraint implements EvaluatorBase::EvalWithGradient().
+// Returns false if the caller must fall back to
+// EvaluateSingleNonlinearConstraint().
+template <typename C>
+bool EvaluateSingleNonlinearConstraintWithGradient(
+    const C& constraint, const Eigen::Ref<const Eigen::VectorXd>& x,
+    Eigen::VectorXd* y, EigenPtr<Eigen::VectorXd> dy_dx) {
+  return constraint.EvalWithGradient(x, y, dy_dx);
+}
+
+template <>
+bool EvaluateSingleNonlinearConstraintWithGradient<
+    LinearComplementarityConstraint>(const LinearComplementarityConstraint&,
+                                     const Eigen::Ref<const Eigen::VectorXd>&,
+                                     Eigen::VectorXd*,
+                                     EigenPtr<Eigen::VectorXd>) {
+  // SNOPT evaluates a different function than Eval() for this constraint.
+  return false;
+}
+
 /*
  * Evaluate the value and gradients of nonlinear constraints.
  * The template type Binding is supposed to be a
@@ -371,20 +394,49 @@ void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
  * @param grad_index The starting index of the gradient of constraint_list(0)
  * in the optimization problem.
  * @param xvec the value of the decision variables.
+ * @param memo If non-null, the evaluations are looked up in (or added to) it.
+ * It must be null when C is LinearComplementarityConstraint, for which SNOPT
+ * evaluates a different function than Eval().
+ * @param parallelism The parallelism with which to evaluate the bindings.
  */
 template <typename C>
 void EvaluateNonlinearConstraints(
     const MathematicalProgram& prog,
     const std::vector<Binding<C>>& constraint_list, double F[], double G[],
-    size_t* constraint_index, size_t* grad_index, const Eigen::VectorXd& xvec) {
+    size_t* constraint_index, size_t* grad_index, const Eigen::VectorXd& xvec,
+    internal::EvaluatorMemo* memo = nullptr,
+    Parallelism parallelism = Parallelism::None()) {
   const auto & scale_map = prog.GetVariableScaling();
-  Eigen::VectorXd this_x;
-  for (const auto& binding : constraint_list) {
+  // The bindings write to disjoint ranges of F and G, so we first lay out
+  // those ranges and then evaluate the bindings (possibly concurrently).
+  const int num_bindings = static_cast<int>(constraint_list.size());
+  std::vector<size_t> F_start(num_bindings);
+  std::vector<size_t> G_start(num_bindings);
+  for (int b = 0; b < num_bindings; ++b) {
+    const auto& binding = constraint_list[b];
+    const int num_constraints =
+        SingleNonlinearConstraintSize(*binding.evaluator());
+    const int num_variables = binding.GetNumElements();
+    const std::optional<std::vector<std::pair<int, int>>>&
+        gradient_sparsity_pattern =
+            binding.evaluator()->gradient_sparsity_pattern();
+    F_start[b] = *constraint_index;
+    G_start[b] = *grad_index;
+    *constraint_index += num_constraints;
+    *grad_index += gradient_sparsity_pattern.has_value()
+                       ? gradient_sparsity_pattern->size()
+                       : num_constraints * num_variables;
+  }
+
+  const auto evaluate_binding = [&](int, int b) {
+    const auto& binding = constraint_list[b];
     const auto& c = binding.evaluator();
     int num_constraints = SingleNonlinearConstraintSize(*c);
+    size_t f_index = F_start[b];
+    size_t g_index = G_start[b];
 
     const int num_variables = binding.GetNumElements();
-    this_x.resize(num_variables);
+    Eigen::VectorXd this_x(num_variables);
     // binding_var_indices[i] is the index of binding.variables()(i) in prog's
     // decision variables.
     std::vector<int> binding_var_indices(num_variables);
@@ -394,6 +446,52 @@ void EvaluateNonlinearConstraints(
       this_x(i) = xvec(binding_var_indices[i]);
     }
 
+    const std::optional<std::vector<std::pair<int, int>>>&
+        gradient_sparsity_pattern =
+            binding.evaluator()->gradient_sparsity_pattern();
+
+    // Try the double-only gradient first. It writes straight into G, after
+    // which we apply the chain rule for the variable scaling.
+    Eigen::VectorXd this_scale = Eigen::VectorXd::Ones(num_variables);
+    for (int i = 0; i < num_variables; i++) {
+      auto it = scale_map.find(binding_var_indices[i]);
+      if (it != scale_map.end()) {
+        this_scale(i) = it->second;
+      }
+    }
+    const int num_gradients =
+        gradient_sparsity_pattern.has_value()
+            ? static_cast<int>(gradient_sparsity_pattern->size())
+            : num_constraints * num_variables;
+    Eigen::Map<Eigen::VectorXd> this_G(G + g_index, num_gradients);
+    if (memo != nullptr) {
+      const internal::MemoizedEvaluation& evaluation =
+          memo->Eval(*c, this_x.cwiseProduct(this_scale));
+      this_G = evaluation.dy_dx;
+      for (int i = 0; i < num_constraints; i++) {
+        F[f_index++] = evaluation.y(i);
+      }
+      for (int k = 0; k < num_gradients; ++k) {
+        this_G(k) *= this_scale(gradient_sparsity_pattern.has_value()
+                                    ? (*gradient_sparsity_pattern)[k].second
+                                    : k % num_variables);
+      }
+      return;
+    }
+    Eigen::VectorXd this_y;
+    if (EvaluateSingleNonlinearConstraintWithGradient(
+            *c, this_x.cwiseProduct(this_scale), &this_y, &this_G)) {
+      for (int i = 0; i < num_constraints; i++) {
+        F[f_index++] = this_y(i);
+      }
+      for (int k = 0; k < num_gradients; ++k) {
+        this_G(k) *= this_scale(gradient_sparsity_pattern.has_value()
+                                    ? (*gradient_sparsity_pattern)[k].second
+                                    : k % num_variables);
+      }
+      return;
+    }
+
     // Scale this_x
     auto this_x_scaled = math::InitializeAutoDiff(this_x);
     for (int i = 0; i < num_variables; i++) {
@@ -408,15 +506,12 @@ void EvaluateNonlinearConstraints(
     EvaluateSingleNonlinearConstraint(*c, this_x_scaled, &ty);
 
     for (int i = 0; i < num_constraints; i++) {
-      F[(*constraint_index)++] = ty(i).value();
+      F[f_index++] = ty(i).value();
     }
 
-    const std::optional<std::vector<std::pair<int, int>>>&
-        gradient_sparsity_pattern =
-            binding.evaluator()->gradient_sparsity_pattern();
     if (gradient_sparsity_pattern.has_value()) {
       for (const auto& nonzero_entry : gradient_sparsity_pattern.value()) {
-        G[(*grad_index)++] =
+        G[g_index++] =
             ty(nonzero_entry.first).derivatives().size() > 0
                 ? ty(nonzero_entry.first).derivatives()(nonzero_entry.second)
                 : 0.0;
@@ -425,16 +520,17 @@ void EvaluateNonlinearConstraints(
       for (int i = 0; i < num_constraints; i++) {
         if (ty(i).derivatives().size() > 0) {
           for (int j = 0; j < num_variables; ++j) {
-            G[(*grad_index)++] = ty(i).derivatives()(j);
+            G[g_index++] = ty(i).derivatives()(j);
           }
         } else {
           for (int j = 0; j < num_variables; ++j) {
-            G[(*grad_index)++] = 0.0;
+            G[g_index++] = 0.0;
           }
         }
       }
     }
-  }
+  };
+  StaticParallelForIndexLoop(parallelism, 0, num_bindings, evaluate_binding);
 }
 
 // Find the variables with non-zero gradient in @p costs, and add the indices of
@@ -471,12 +567,14 @@ std::set<int> GetAllNonlinearCostNonzeroGradientIndices(
 /*
  * Evaluates all the nonlinear costs, adds the value of the costs to
  * @p total_cost, and also adds the gradients to @p nonlinear_cost_gradients.
+ * The evaluations are looked up in (or added to) @p memo.
  */
 template <typename C>
 void EvaluateAndAddNonlinearCosts(
     const MathematicalProgram& prog,
     const std::vector<Binding<C>>& nonlinear_costs, const Eigen::VectorXd& x,
-    double* total_cost, std::vector<double>* nonlinear_cost_gradients) {
+    internal::EvaluatorMemo* memo, double* total_cost,
+    std::vector<double>* nonlinear_cost_gradients) {
   const auto & scale_map = prog.GetVariableScaling();
   for (const auto& binding : nonlinear_costs) {
     const auto& obj = binding.evaluator();
@@ -491,23 +589,25 @@ void EvaluateAndAddNonlinearCosts(
           prog.FindDecisionVariableIndex(binding.variables()(i));
       this_x(i) = x(binding_var_indices[i]);
     }
-    AutoDiffVecXd ty(1);
-    // Scale this_x
-    auto this_x_scaled = math::InitializeAutoDiff(this_x);
+
+    // Evaluate at the scaled x, then apply the chain rule for the scaling.
+    const auto& gradient_sparsity_pattern = obj->gradient_sparsity_pattern();
+    Eigen::VectorXd this_scale = Eigen::VectorXd::Ones(num_variables);
     for (int i = 0; i < num_variables; i++) {
       auto it = scale_map.find(binding_var_indices[i]);
       if (it != scale_map.end()) {
-        this_x_scaled(i) *= it->second;
+        this_scale(i) = it->second;
       }
     }
-    obj->Eval(this_x_scaled, &ty);
-
-    *total_cost += ty(0).value();
-    if (ty(0).derivatives().size() > 0) {
-      for (int i = 0; i < num_variables; ++i) {
-        (*nonlinear_cost_gradients)[binding_var_indices[i]] +=
-            ty(0).derivatives()(i);
-      }
+    const internal::MemoizedEvaluation& evaluation =
+        memo->Eval(*obj, this_x.cwiseProduct(this_scale));
+    *total_cost += evaluation.y(0);
+    for (int k = 0; k < evaluation.dy_dx.rows(); ++k) {
+      const int i = gradient_sparsity_pattern.has_value()
+                        ? (*gradient_sparsity_pattern)[k].second
+                        : k;
+      (*nonlinear_cost_gradients)[binding_var_indices[i]] +=
+          evaluation.dy_dx(k) * this_scale(i);
     }
   }
 }
@@ -518,15 +618,16 @@ void EvaluateAndAddNonlinearCosts(
 // will store the nonzero gradient of the cost.
 void EvaluateAllNonlinearCosts(
     const MathematicalProgram& prog, const Eigen::VectorXd& xvec,
-    const std::set<int>& nonlinear_cost_gradient_indices, double F[],
-    double G[], size_t* grad_index) {
+    const std::set<int>& nonlinear_cost_gradient_indices,
+    internal::EvaluatorMemo* memo, double F[], double G[],
+    size_t* grad_index) {
   std::vector<double> cost_gradients(prog.num_vars(), 0);
   // Quadratic costs.
-  EvaluateAndAddNonlinearCosts(prog, prog.quadratic_costs(), xvec, &(F[0]),
-                               &cost_gradients);
+  EvaluateAndAddNonlinearCosts(prog, prog.quadratic_costs(), xvec, memo,
+                               &(F[0]), &cost_gradients);
   // Generic costs.
-  EvaluateAndAddNonlinearCosts(prog, prog.generic_costs(), xvec, &(F[0]),
-                               &cost_gradients);
+  EvaluateAndAddNonlinearCosts(prog, prog.generic_costs(), xvec, memo,
+                               &(F[0]), &cost_gradients);
 
   for (const int cost_gradient_index : nonlinear_cost_gradient_indices) {
     G[*grad_index] = cost_gradients[cost_gradient_index];
@@ -558,9 +659,13 @@ void snopt_userfun(int* Status, int* n, double x[], int* needF, int* neF,
   }
   current_problem.EvalVisualizationCallbacks(xvec_scaled);
 
+  // Bindings of the same evaluator at the same values (within this call)
+  // are evaluated only once.
+  internal::EvaluatorMemo memo;
+
   EvaluateAllNonlinearCosts(current_problem, xvec,
-                            info.nonlinear_cost_gradient_indices(), F, G,
-                            &grad_index);
+                            info.nonlinear_cost_gradient_indices(), &memo, F,
+                            G, &grad_index);
 
   // The constraint index starts at 1 because the cost is the
   // first row.
@@ -568,13 +673,14 @@ void snopt_userfun(int* Status, int* n, double x[], int* needF, int* neF,
   // The gradient_index also starts after the cost.
   EvaluateNonlinearConstraints(current_problem,
                                current_problem.generic_constraints(), F, G,
-                               &constraint_index, &grad_index, xvec);
+                               &constraint_index, &grad_index, xvec, &memo,
+                               current_problem.evaluation_parallelism());
   EvaluateNonlinearConstraints(current_problem,
                                current_problem.lorentz_cone_constraints(), F, G,
-                               &constraint_index, &grad_index, xvec);
+                               &constraint_index, &grad_index, xvec, &memo);
   EvaluateNonlinearConstraints(
       current_problem, current_problem.rotated_lorentz_cone_constraints(), F, G,
-      &constraint_index, &grad_index, xvec);
+      &constraint_index, &grad_index, xvec, &memo);
   EvaluateNonlinearConstraints(
       current_problem, current_problem.linear_complementarity_constraints(), F,
       G, &constraint_index, &grad_index, xvec);
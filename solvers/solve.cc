@@ -1,10 +1,16 @@
 #include "drake/solvers/solve.h"
 
 #include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include <fmt/format.h>
 
 #include "drake/common/nice_type_name.h"
 #include "drake/common/text_logging.h"
 #include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/ipopt_solver.h"
 #include "drake/solvers/solver_interface.h"
 
 namespace drake {
@@ -31,5 +37,83 @@ MathematicalProgramResult Solve(
 MathematicalProgramResult Solve(const MathematicalProgram& prog) {
   return Solve(prog, {}, {});
 }
+
+namespace {
+// The solver instances owned by one worker thread, keyed by solver id.
+using SolverPool =
+    std::unordered_map<SolverId, std::unique_ptr<SolverInterface>>;
+
+SolverInterface* GetOrMakeSolver(const SolverId& id, SolverPool* pool) {
+  auto iter = pool->find(id);
+  if (iter == pool->end()) {
+    iter = pool->emplace(id, MakeSolver(id)).first;
+  }
+  return iter->second.get();
+}
+}  // namespace
+
+std::vector<MathematicalProgramResult> SolveInParallel(
+    const std::vector<const MathematicalProgram*>& progs,
+    const std::vector<const Eigen::VectorXd*>* initial_guesses,
+    const std::vector<const SolverOptions*>* solver_options,
+    const std::optional<SolverId>& solver_id, Parallelism parallelism) {
+  const int num_progs = static_cast<int>(progs.size());
+  if (initial_guesses != nullptr &&
+      static_cast<int>(initial_guesses->size()) != num_progs) {
+    throw std::invalid_argument(fmt::format(
+        "SolveInParallel: got {} programs but {} initial guesses.", num_progs,
+        initial_guesses->size()));
+  }
+  if (solver_options != nullptr &&
+      static_cast<int>(solver_options->size()) != num_progs) {
+    throw std::invalid_argument(fmt::format(
+        "SolveInParallel: got {} programs but {} solver options.", num_progs,
+        solver_options->size()));
+  }
+  for (int i = 0; i < num_progs; ++i) {
+    if (progs[i] == nullptr) {
+      throw std::invalid_argument(
+          fmt::format("SolveInParallel: progs[{}] is nullptr.", i));
+    }
+  }
+
+  // Choosing a solver only inspects the program, so we do it up front to
+  // split out the programs that must not be solved concurrently.
+  std::vector<SolverId> ids;
+  ids.reserve(num_progs);
+  std::vector<int> parallel_indices;
+  std::vector<int> serial_indices;
+  for (int i = 0; i < num_progs; ++i) {
+    ids.push_back(solver_id.has_value() ? *solver_id
+                                        : ChooseBestSolver(*progs[i]));
+    (ids.back() == IpoptSolver::id() ? serial_indices : parallel_indices)
+        .push_back(i);
+  }
+
+  std::vector<MathematicalProgramResult> results(num_progs);
+  auto solve_one = [&](int i, SolverPool* pool) {
+    std::optional<Eigen::VectorXd> guess;
+    if (initial_guesses != nullptr && (*initial_guesses)[i] != nullptr) {
+      guess = *(*initial_guesses)[i];
+    }
+    std::optional<SolverOptions> options;
+    if (solver_options != nullptr && (*solver_options)[i] != nullptr) {
+      options = *(*solver_options)[i];
+    }
+    GetOrMakeSolver(ids[i], pool)
+        ->Solve(*progs[i], guess, options, &results[i]);
+  };
+
+  std::vector<SolverPool> pools(parallelism.num_threads());
+  StaticParallelForIndexLoop(
+      parallelism, 0, static_cast<int>(parallel_indices.size()),
+      [&](int thread_num, int k) {
+        solve_one(parallel_indices[k], &pools[thread_num]);
+      });
+  for (int i : serial_indices) {
+    solve_one(i, &pools[0]);
+  }
+  return results;
+}
 }  // namespace solvers
 }  // namespace drake
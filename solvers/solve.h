@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/mathematical_program_result.h"
 #include "drake/solvers/solver_base.h"
@@ -42,5 +43,39 @@ MathematicalProgramResult Solve(
     const Eigen::Ref<const Eigen::VectorXd>& initial_guess);
 
 MathematicalProgramResult Solve(const MathematicalProgram& prog);
+
+/**
+ * Solves a batch of independent optimization programs, dispatching them over
+ * up to `parallelism.num_threads()` threads. Each thread keeps its own solver
+ * instances and reuses them for every program it is assigned, so solvers that
+ * hold a license environment (e.g. Gurobi, MOSEK™) acquire it at most once per
+ * thread instead of once per program.
+ *
+ * @param progs The programs to solve. None of them may be nullptr. The
+ * programs must not be mutated while this function is running.
+ * @param initial_guesses If non-null, must have the same size as @p progs;
+ * entry i (which may itself be nullptr) is the initial guess for progs[i].
+ * @param solver_options If non-null, must have the same size as @p progs;
+ * entry i (which may itself be nullptr) holds the options for progs[i], with
+ * the same priority rules as Solve().
+ * @param solver_id If set, every program is solved by this solver; otherwise
+ * ChooseBestSolver() picks the solver for each program independently.
+ * @param parallelism The maximum number of threads to use.
+ * @return The results, where entry i is the result of solving progs[i].
+ *
+ * Programs whose solver is IPOPT are solved serially on the calling thread
+ * after the parallel batch completes, since IPOPT's linear solver (MUMPS) is
+ * not reentrant.
+ *
+ * @throws std::exception if the sizes of the inputs are inconsistent, or if
+ * any individual solve throws.
+ * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+ */
+std::vector<MathematicalProgramResult> SolveInParallel(
+    const std::vector<const MathematicalProgram*>& progs,
+    const std::vector<const Eigen::VectorXd*>* initial_guesses = nullptr,
+    const std::vector<const SolverOptions*>* solver_options = nullptr,
+    const std::optional<SolverId>& solver_id = std::nullopt,
+    Parallelism parallelism = Parallelism::Max());
 }  // namespace solvers
 }  // namespace drake
@@ -7,6 +7,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/nice_type_name.h"
+#include "drake/solvers/presolve.h"
 
 namespace drake {
 namespace solvers {
@@ -44,7 +45,7 @@ void SolverBase::Solve(const MathematicalProgram& prog,
                        const std::optional<Eigen::VectorXd>& initial_guess,
                        const std::optional<SolverOptions>& solver_options,
                        MathematicalProgramResult* result) const {
-  *result = {};
+  result->Reset();
   if (!available()) {
     const std::string name = ShortName(*this);
     throw std::invalid_argument(fmt::format(
@@ -66,7 +67,7 @@ void SolverBase::Solve(const MathematicalProgram& prog,
     throw std::invalid_argument(ExplainUnsatisfiedProgramAttributes(prog));
   }
   result->set_solver_id(solver_id());
-  result->set_decision_variable_index(prog.decision_variable_index());
+  result->set_decision_variable_index(prog.shared_decision_variable_index());
   const Eigen::VectorXd& x_init =
       initial_guess ? *initial_guess : prog.initial_guess();
   if (x_init.rows() != prog.num_vars()) {
@@ -74,13 +75,23 @@ void SolverBase::Solve(const MathematicalProgram& prog,
         fmt::format("Solve expects initial guess of size {}, got {}.",
                     prog.num_vars(), x_init.rows()));
   }
-  if (!solver_options) {
-    DoSolve(prog, x_init, prog.solver_options(), result);
-  } else {
-    SolverOptions merged_options = *solver_options;
-    merged_options.Merge(prog.solver_options());
-    DoSolve(prog, x_init, merged_options, result);
+  SolverOptions merged_options;
+  if (solver_options) {
+    merged_options = *solver_options;
   }
+  merged_options.Merge(prog.solver_options());
+  if (merged_options.get_presolve()) {
+    if (const auto presolver = internal::Presolver::Make(prog)) {
+      const MathematicalProgram& reduced_prog = presolver->reduced_program();
+      result->set_decision_variable_index(
+          reduced_prog.shared_decision_variable_index());
+      DoSolve(reduced_prog, presolver->ReduceDecisionVariableValues(x_init),
+              merged_options, result);
+      presolver->RecoverResult(result);
+      return;
+    }
+  }
+  DoSolve(prog, x_init, merged_options, result);
 }
 
 bool SolverBase::available() const {
@@ -62,6 +62,9 @@ class SolverInterface {
   /// If the @p prog has set an option for a solver, and @p solver_options
   /// contains a different value for the same option on the same solver, then @p
   /// solver_options takes priority.
+  /// The previous contents of @p result are discarded (see
+  /// MathematicalProgramResult::Reset()); passing the same @p result to
+  /// repeated solves of the same program reuses its storage.
   /// Derived implementations of this interface may elect to throw
   /// std::exception for badly formed programs.
   virtual void Solve(const MathematicalProgram& prog,
@@ -41,7 +41,8 @@ void SolverOptions::SetOption(const SolverId& solver_id,
 
 void SolverOptions::SetOption(CommonSolverOption key, OptionValue value) {
   switch (key) {
-    case CommonSolverOption::kPrintToConsole: {
+    case CommonSolverOption::kPrintToConsole:
+    case CommonSolverOption::kPresolve: {
       if (!std::holds_alternative<int>(value)) {
         throw std::runtime_error(fmt::format(
             "SolverOptions::SetOption support {} only with int value.", key));
@@ -115,6 +116,12 @@ bool SolverOptions::get_print_to_console() const {
   return result;
 }
 
+bool SolverOptions::get_presolve() const {
+  // N.B. SetOption sanity checks the value; we don't need to re-check here.
+  auto iter = common_solver_options_.find(CommonSolverOption::kPresolve);
+  return iter != common_solver_options_.end() && std::get<int>(iter->second);
+}
+
 std::unordered_set<SolverId> SolverOptions::GetSolverIds() const {
   std::unordered_set<SolverId> result;
   for (const auto& pair : solver_options_double_) { result.insert(pair.first); }
@@ -121,6 +121,10 @@ class SolverOptions {
    * the option has not been set. */
   bool get_print_to_console() const;
 
+  /** Returns the kPresolve set via CommonSolverOption, or else false if the
+   * option has not been set. */
+  bool get_presolve() const;
+
   template <typename T>
   const std::unordered_map<std::string, T>& GetOptions(
       const SolverId& solver_id) const {
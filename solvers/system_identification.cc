@@ -4,6 +4,9 @@
 #include <cmath>
 #include <iostream>  // For LUMPED_SYSTEM_IDENTIFICATION_VERBOSE below.
 #include <list>
+#include <optional>
+
+#include <Eigen/QR>
 
 #include "drake/common/drake_assert.h"
 #include "drake/solvers/mathematical_program.h"
@@ -14,6 +17,200 @@
 
 namespace drake {
 namespace solvers {
+namespace {
+
+// The regression form of a vector of polynomials that are affine in their
+// parameters θ, i.e., polys[i](θ, x) = a_i(x)ᵀ⋅θ + c_i(x) for the active
+// variables x. It is compiled once from the polynomials so that evaluating it
+// at a data sample needs no Polynomial manipulation.
+class AffineRegressor {
+ public:
+  typedef Polynomiald::VarType VarType;
+  typedef std::map<VarType, double> PartialEvalType;
+
+  // Returns std::nullopt if any of `polys` is not affine in `parameters`.
+  static std::optional<AffineRegressor> Compile(
+      const VectorXPoly& polys, const std::vector<VarType>& parameters) {
+    AffineRegressor result;
+    result.num_polys_ = polys.rows();
+    result.num_parameters_ = parameters.size();
+    std::map<VarType, int> parameter_columns;
+    for (int j = 0; j < static_cast<int>(parameters.size()); ++j) {
+      parameter_columns[parameters[j]] = j;
+    }
+    std::map<VarType, int> active_slots;
+    for (int i = 0; i < polys.rows(); ++i) {
+      for (const Polynomiald::Monomial& monomial : polys[i].GetMonomials()) {
+        Term term;
+        term.poly = i;
+        term.column = -1;
+        term.coefficient = monomial.coefficient;
+        for (const Polynomiald::Term& factor : monomial.terms) {
+          const auto parameter = parameter_columns.find(factor.var);
+          if (parameter != parameter_columns.end()) {
+            if (term.column >= 0 || factor.power != 1) {
+              return std::nullopt;
+            }
+            term.column = parameter->second;
+            continue;
+          }
+          const auto [slot, inserted] = active_slots.emplace(
+              factor.var, static_cast<int>(result.active_vars_.size()));
+          if (inserted) {
+            result.active_vars_.push_back(factor.var);
+          }
+          term.factors.push_back({slot->second, factor.power});
+        }
+        result.terms_.push_back(std::move(term));
+      }
+    }
+    return result;
+  }
+
+  int num_polys() const { return num_polys_; }
+
+  int num_parameters() const { return num_parameters_; }
+
+  // Writes the num_polys() regression rows for `sample` into `Ab`, which must
+  // be zero on entry: the first num_parameters() columns hold a(x)ᵀ and the
+  // last column holds -c(x). `values` is scratch storage.
+  void Evaluate(const PartialEvalType& sample, EigenPtr<Eigen::MatrixXd> Ab,
+                std::vector<double>* values) const {
+    values->resize(active_vars_.size());
+    for (int k = 0; k < static_cast<int>(active_vars_.size()); ++k) {
+      (*values)[k] = sample.at(active_vars_[k]);
+    }
+    for (const Term& term : terms_) {
+      double value = term.coefficient;
+      for (const Factor& factor : term.factors) {
+        value *= std::pow((*values)[factor.slot], factor.power);
+      }
+      if (term.column >= 0) {
+        (*Ab)(term.poly, term.column) += value;
+      } else {
+        (*Ab)(term.poly, num_parameters_) -= value;
+      }
+    }
+  }
+
+ private:
+  struct Factor {
+    int slot{};
+    int power{};
+  };
+
+  // coefficient * Π x[factor.slot]^factor.power, times the parameter in
+  // `column` if column >= 0.
+  struct Term {
+    int poly{};
+    int column{};
+    double coefficient{};
+    std::vector<Factor> factors;
+  };
+
+  int num_polys_{};
+  int num_parameters_{};
+  std::vector<VarType> active_vars_;
+  std::vector<Term> terms_;
+};
+
+// Accumulates rows [A b] of a least-squares problem min ‖Aθ - b‖ into the
+// upper-triangular factor R of the QR decomposition of all the rows seen so
+// far. Only R, which is square with one more column than θ, is kept, so the
+// full problem is never stored.
+class StreamedLeastSquares {
+ public:
+  // Rows are folded into R in blocks of this many rows.
+  static constexpr int kBlockRows = 256;
+
+  explicit StreamedLeastSquares(int num_columns)
+      : R_(Eigen::MatrixXd::Zero(num_columns, num_columns)),
+        block_(Eigen::MatrixXd::Zero(kBlockRows, num_columns)) {}
+
+  // Returns a block of `num_rows` zeroed rows to write into; the rows are
+  // part of the problem from then on.
+  Eigen::Block<Eigen::MatrixXd> NextRows(int num_rows) {
+    DRAKE_DEMAND(num_rows <= kBlockRows);
+    if (num_block_rows_ + num_rows > kBlockRows) {
+      Flush();
+    }
+    const int row = num_block_rows_;
+    num_block_rows_ += num_rows;
+    return block_.middleRows(row, num_rows);
+  }
+
+  // Folds the rows of `other` into this.
+  void Merge(StreamedLeastSquares* other) {
+    other->Flush();
+    Fold(other->R_);
+  }
+
+  // Folds any pending rows and returns R.
+  const Eigen::MatrixXd& R() {
+    Flush();
+    return R_;
+  }
+
+ private:
+  void Flush() {
+    if (num_block_rows_ > 0) {
+      Fold(block_.topRows(num_block_rows_));
+      block_.topRows(num_block_rows_).setZero();
+      num_block_rows_ = 0;
+    }
+  }
+
+  void Fold(const Eigen::Ref<const Eigen::MatrixXd>& rows) {
+    const int n = R_.cols();
+    Eigen::MatrixXd stacked(n + rows.rows(), n);
+    stacked << R_, rows;
+    const Eigen::HouseholderQR<Eigen::MatrixXd> qr(stacked);
+    R_ = qr.matrixQR().topRows(n).triangularView<Eigen::Upper>();
+  }
+
+  Eigen::MatrixXd R_;
+  Eigen::MatrixXd block_;
+  int num_block_rows_{0};
+};
+
+// Solves min Σ ‖regressor(sample)⋅[θ; -1]‖² over the samples. The samples are
+// split into contiguous ranges, one per thread, which are reduced in thread
+// order. Returns θ and the root-mean-square residual.
+std::pair<Eigen::VectorXd, double> SolveAffineLeastSquares(
+    const AffineRegressor& regressor,
+    const std::vector<AffineRegressor::PartialEvalType>& samples,
+    Parallelism parallelism) {
+  const int num_data = samples.size();
+  const int num_parameters = regressor.num_parameters();
+  const int num_threads = std::max(
+      1, std::min(parallelism.num_threads(), num_data));
+  std::vector<StreamedLeastSquares> accumulators(
+      num_threads, StreamedLeastSquares(num_parameters + 1));
+  std::vector<std::vector<double>> values(num_threads);
+  StaticParallelForIndexLoop(
+      Parallelism(num_threads), 0, num_data,
+      [&](int thread_num, int sample) {
+        auto rows = accumulators[thread_num].NextRows(regressor.num_polys());
+        regressor.Evaluate(samples[sample], &rows, &values[thread_num]);
+      });
+  for (int i = 1; i < num_threads; ++i) {
+    accumulators[0].Merge(&accumulators[i]);
+  }
+
+  // With R = [R_θ z; 0 ρ], the solution is R_θ⁻¹⋅z and the residual norm is
+  // |ρ|. A complete orthogonal decomposition returns the minimum-norm solution
+  // if R_θ is singular.
+  const Eigen::MatrixXd& R = accumulators[0].R();
+  const Eigen::VectorXd theta =
+      R.topLeftCorner(num_parameters, num_parameters)
+          .completeOrthogonalDecomposition()
+          .solve(R.topRightCorner(num_parameters, 1));
+  const double residual = std::abs(R(num_parameters, num_parameters));
+  const int num_err_terms = num_data * regressor.num_polys();
+  return {theta, residual / std::sqrt(num_err_terms)};
+}
+
+}  // namespace
 
 template <typename T>
 std::set<typename SystemIdentification<T>::MonomialType>
@@ -244,7 +441,8 @@ template <typename T>
 std::pair<typename SystemIdentification<T>::PartialEvalType, T>
 SystemIdentification<T>::EstimateParameters(
     const VectorXPoly& polys,
-    const std::vector<PartialEvalType>& active_var_values) {
+    const std::vector<PartialEvalType>& active_var_values,
+    Parallelism parallelism) {
   DRAKE_ASSERT(active_var_values.size() > 0);
   const int num_data = active_var_values.size();
   const int num_err_terms = num_data * polys.rows();
@@ -264,7 +462,22 @@ SystemIdentification<T>::EstimateParameters(
   // our solution will be meaningless.
   DRAKE_ASSERT(num_data >= num_to_estimate);
 
-  // Build up our optimization problem's decision variables.
+  // When the polynomials are affine in the parameters (as they are after
+  // lumping), this is a linear least-squares problem; evaluate its regressor
+  // directly at each sample and accumulate it in a streamed QR factorization.
+  const std::optional<AffineRegressor> regressor =
+      AffineRegressor::Compile(polys, vars_to_estimate);
+  if (regressor.has_value()) {
+    const auto [theta, rms_error] =
+        SolveAffineLeastSquares(*regressor, active_var_values, parallelism);
+    PartialEvalType estimates;
+    for (int i = 0; i < num_to_estimate; i++) {
+      estimates[vars_to_estimate[i]] = theta(i);
+    }
+    return std::make_pair(estimates, rms_error);
+  }
+
+  // Otherwise, build up a general optimization problem's decision variables.
   MathematicalProgram problem;
   VectorXDecisionVariable parameter_variables =
       problem.NewContinuousVariables(num_to_estimate, "param");
@@ -334,7 +547,8 @@ template <typename T>
 typename SystemIdentification<T>::SystemIdentificationResult
 SystemIdentification<T>::LumpedSystemIdentification(
     const VectorXTrigPoly& trigpolys,
-    const std::vector<PartialEvalType>& active_var_values) {
+    const std::vector<PartialEvalType>& active_var_values,
+    Parallelism parallelism) {
   SystemIdentificationResult result;
 
 // Tracing this method is a very useful way to debug otherwise-obscure
@@ -422,7 +636,7 @@ SystemIdentification<T>::LumpedSystemIdentification(
     polys_as_eigen[i] = result.lumped_polys[i].poly();
   }
   std::tie(result.lumped_parameter_values, result.rms_error) =
-      EstimateParameters(polys_as_eigen, augmented_values);
+      EstimateParameters(polys_as_eigen, augmented_values, parallelism);
   for (const auto& k_v_pair : result.lumped_parameter_values) {
     debug << "Parameter estimate: "
           << Polynomiald::IdToVariableName(k_v_pair.first)
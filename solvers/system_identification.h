@@ -10,6 +10,7 @@
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/polynomial.h"
 #include "drake/common/trig_poly.h"
 
@@ -110,10 +111,17 @@ class DRAKE_DEPRECATED(
    *   * estimates is a map of polynomial VarTypes (a, b, ...) to their
    *     estimated values, suitable as input for Polynomial::evaluatePartial.
    *   * error is the root-mean-square error of the estimates.
+   *
+   * When every polynomial is affine in the parameters (e.g., the output of
+   * RewritePolynomialWithLumpedParameters), the regressor is evaluated
+   * directly at each datum, using up to `parallelism` threads, and folded
+   * into a streamed QR factorization, so memory use does not grow with the
+   * number of data. Otherwise a MathematicalProgram is solved.
    */
   static std::pair<PartialEvalType, T> EstimateParameters(
       const VectorXPoly& polys,
-      const std::vector<PartialEvalType>& active_var_values);
+      const std::vector<PartialEvalType>& active_var_values,
+      Parallelism parallelism = Parallelism::None());
 
   /** A helper struct to hold System ID results */
   struct SystemIdentificationResult {
@@ -149,10 +157,13 @@ class DRAKE_DEPRECATED(
    *  * GetLumpedParametersFromPolynomials
    *  * RewritePolynomialWithLumpedParameters
    *  * EstimateParameters
+   *
+   * `parallelism` is passed through to EstimateParameters.
    */
   static SystemIdentificationResult LumpedSystemIdentification(
       const VectorXTrigPoly& polys,
-      const std::vector<PartialEvalType>& active_var_values);
+      const std::vector<PartialEvalType>& active_var_values,
+      Parallelism parallelism = Parallelism::None());
 
 
  private:
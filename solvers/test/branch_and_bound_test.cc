@@ -380,6 +380,26 @@ GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestBranch2) {
   EXPECT_THROW(root->Branch(x(3)), std::runtime_error);
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestBranchWarmStart) {
+  // The children of a node are warm-started from its solution.
+  auto prog = ConstructMathematicalProgram2();
+
+  std::unique_ptr<MixedIntegerBranchAndBoundNode> root;
+  std::tie(root, std::ignore) =
+      MixedIntegerBranchAndBoundNode::ConstructRootNode(*prog,
+                                                        GurobiSolver::id());
+  ASSERT_EQ(root->solution_result(), SolutionResult::kSolutionFound);
+  VectorDecisionVariable<5> x = root->prog()->decision_variables();
+  const Eigen::VectorXd x_root = root->prog_result()->GetSolution(x);
+
+  root->Branch(x(2));
+  for (const auto* child : {root->left_child(), root->right_child()}) {
+    Eigen::VectorXd x_guess = x_root;
+    x_guess(2) = child->fixed_binary_value();
+    EXPECT_TRUE(CompareMatrices(child->prog()->initial_guess(), x_guess));
+  }
+}
+
 GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestBranch3) {
   // Test branching on the root node for prog 3.
   auto prog = ConstructMathematicalProgram3();
@@ -922,6 +942,37 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolve4) {
   }
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveBatchedInParallel) {
+  // Branching on several nodes per round, and solving their children in
+  // parallel, finds the same optimum.
+  auto prog = ConstructMathematicalProgram2();
+  const VectorDecisionVariable<5> x = prog->decision_variables();
+  Eigen::Matrix<double, 5, 1> x_expected;
+  x_expected << 1, 1.0 / 3.0, 1, 1, 0;
+  const double tol{1E-3};
+
+  for (auto pick_node : NonUserDefinedPickNodeMethods()) {
+    for (const int batch_size : {1, 3}) {
+      for (const int num_threads : {1, 4}) {
+        MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+        bnb.SetNodeSelectionMethod(pick_node);
+        bnb.set_branching_batch_size(batch_size);
+        bnb.set_parallelism(Parallelism(num_threads));
+        EXPECT_EQ(bnb.branching_batch_size(), batch_size);
+        EXPECT_EQ(bnb.parallelism().num_threads(), num_threads);
+
+        EXPECT_EQ(bnb.Solve(), SolutionResult::kSolutionFound);
+        EXPECT_NEAR(bnb.GetOptimalCost(), -13.0 / 3, tol);
+        EXPECT_TRUE(CompareMatrices(bnb.GetSolution(x, 0), x_expected, tol,
+                                    MatrixCompareType::absolute));
+      }
+    }
+  }
+
+  MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+  EXPECT_THROW(bnb.set_branching_batch_size(0), std::exception);
+}
+
 GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSteelBlendingProblem) {
   // This problem is taken from
   // "An application of Mixed Integer Programming in a Swedish Steel Mill"
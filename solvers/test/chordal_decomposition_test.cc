@@ -0,0 +1,174 @@
+#include "drake/solvers/chordal_decomposition.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <Eigen/Eigenvalues>
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/solvers/scs_solver.h"
+#include "drake/solvers/solve.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+
+using Eigen::MatrixXd;
+
+// Checks that every clique after the first one intersects the union of the
+// cliques before it in a subset of one of them.
+void ExpectRunningIntersection(const std::vector<std::vector<int>>& cliques) {
+  for (int k = 1; k < static_cast<int>(cliques.size()); ++k) {
+    std::vector<int> previous;
+    for (int j = 0; j < k; ++j) {
+      previous.insert(previous.end(), cliques[j].begin(), cliques[j].end());
+    }
+    std::sort(previous.begin(), previous.end());
+    std::vector<int> separator;
+    std::set_intersection(cliques[k].begin(), cliques[k].end(),
+                          previous.begin(), previous.end(),
+                          std::back_inserter(separator));
+    bool contained = false;
+    for (int j = 0; j < k; ++j) {
+      contained = contained ||
+                  std::includes(cliques[j].begin(), cliques[j].end(),
+                                separator.begin(), separator.end());
+    }
+    EXPECT_TRUE(contained) << "clique " << k;
+  }
+}
+
+double MinEigenvalue(const MatrixXd& X) {
+  return Eigen::SelfAdjointEigenSolver<MatrixXd>(X).eigenvalues().minCoeff();
+}
+
+GTEST_TEST(FindChordalExtensionCliquesTest, Banded) {
+  // A tridiagonal pattern is chordal, with one clique per edge.
+  MatrixX<bool> sparsity = MatrixX<bool>::Identity(5, 5);
+  for (int i = 0; i < 4; ++i) {
+    sparsity(i, i + 1) = sparsity(i + 1, i) = true;
+  }
+  const auto cliques = internal::FindChordalExtensionCliques(sparsity);
+  ASSERT_EQ(cliques.size(), 4);
+  for (const auto& clique : cliques) {
+    ASSERT_EQ(clique.size(), 2);
+    EXPECT_EQ(clique[1], clique[0] + 1);
+  }
+  ExpectRunningIntersection(cliques);
+}
+
+GTEST_TEST(FindChordalExtensionCliquesTest, Cycle) {
+  // The 4-cycle 0-1-2-3-0 isn't chordal; its extension adds one chord, which
+  // gives two triangles.
+  MatrixX<bool> sparsity = MatrixX<bool>::Identity(4, 4);
+  for (int i = 0; i < 4; ++i) {
+    sparsity(i, (i + 1) % 4) = sparsity((i + 1) % 4, i) = true;
+  }
+  const auto cliques = internal::FindChordalExtensionCliques(sparsity);
+  ASSERT_EQ(cliques.size(), 2);
+  EXPECT_EQ(cliques[0].size(), 3);
+  EXPECT_EQ(cliques[1].size(), 3);
+  ExpectRunningIntersection(cliques);
+}
+
+GTEST_TEST(FindChordalExtensionCliquesTest, DenseAndDiagonal) {
+  const auto dense_cliques = internal::FindChordalExtensionCliques(
+      MatrixX<bool>::Constant(3, 3, true));
+  ASSERT_EQ(dense_cliques.size(), 1);
+  EXPECT_EQ(dense_cliques[0], std::vector<int>({0, 1, 2}));
+
+  const auto diagonal_cliques = internal::FindChordalExtensionCliques(
+      MatrixX<bool>::Identity(3, 3));
+  EXPECT_EQ(diagonal_cliques.size(), 3);
+}
+
+GTEST_TEST(CompletePsdMatrixTest, Banded) {
+  // Keeps the band of a random positive definite matrix, and overwrites the
+  // rest of it.
+  const int n = 6;
+  const MatrixXd A = MatrixXd::Random(n, n);
+  const MatrixXd X_full = A * A.transpose() + MatrixXd::Identity(n, n);
+  MatrixX<bool> sparsity = MatrixX<bool>::Identity(n, n);
+  MatrixXd X = MatrixXd::Constant(n, n, 100);
+  for (int i = 0; i < n; ++i) {
+    X(i, i) = X_full(i, i);
+    if (i + 1 < n) {
+      sparsity(i, i + 1) = sparsity(i + 1, i) = true;
+      X(i, i + 1) = X(i + 1, i) = X_full(i, i + 1);
+    }
+  }
+  const auto cliques = internal::FindChordalExtensionCliques(sparsity);
+  const MatrixXd X_completed = internal::CompletePsdMatrix(X, cliques);
+  EXPECT_TRUE(CompareMatrices(X_completed, X_completed.transpose(), 1e-12));
+  EXPECT_GT(MinEigenvalue(X_completed), 0);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      if (sparsity(i, j)) {
+        EXPECT_EQ(X_completed(i, j), X(i, j));
+      }
+    }
+  }
+}
+
+GTEST_TEST(CompletePsdMatrixTest, Singular) {
+  // The rank-one matrix v vᵀ with v = (1, -1, 1, -1), known on a 4-cycle
+  // pattern. The clique blocks are singular.
+  MatrixX<bool> sparsity = MatrixX<bool>::Identity(4, 4);
+  for (int i = 0; i < 4; ++i) {
+    sparsity(i, (i + 1) % 4) = sparsity((i + 1) % 4, i) = true;
+  }
+  const Eigen::Vector4d v(1, -1, 1, -1);
+  const MatrixXd X_full = v * v.transpose();
+  const auto cliques = internal::FindChordalExtensionCliques(sparsity);
+  // Every clique block of X_full is PSD, so completing from those blocks
+  // recovers the rank-one matrix.
+  MatrixXd X = X_full;
+  for (int j = 0; j < 4; ++j) {
+    for (int i = 0; i < 4; ++i) {
+      const bool in_clique = std::any_of(
+          cliques.begin(), cliques.end(), [i, j](const std::vector<int>& c) {
+            return std::count(c.begin(), c.end(), i) &&
+                   std::count(c.begin(), c.end(), j);
+          });
+      if (!in_clique) {
+        X(i, j) = 0;
+      }
+    }
+  }
+  EXPECT_TRUE(
+      CompareMatrices(internal::CompletePsdMatrix(X, cliques), X_full, 1e-12));
+}
+
+// The relaxation of max-cut on a path graph: minimize the sum of the entries
+// X(i, i + 1) subject to diag(X) = 1 and X ⪰ 0. The entries off the band are
+// free, so the 6×6 PSD constraint decomposes into five 2×2 ones.
+GTEST_TEST(SolveWithChordalDecompositionTest, PathMaxCut) {
+  if (!ScsSolver::is_available()) {
+    return;
+  }
+  const int n = 6;
+  MathematicalProgram prog;
+  const auto X = prog.NewSymmetricContinuousVariables(n, "X");
+  prog.AddPositiveSemidefiniteConstraint(X);
+  prog.AddBoundingBoxConstraint(1, 1, X.diagonal());
+  symbolic::Expression cost = 0;
+  for (int i = 0; i + 1 < n; ++i) {
+    cost += X(i, i + 1);
+  }
+  prog.AddLinearCost(cost);
+
+  const MathematicalProgramResult result = SolveWithChordalDecomposition(prog);
+  ASSERT_TRUE(result.is_success());
+  const double tol = 1e-4;
+  EXPECT_NEAR(result.get_optimal_cost(), -(n - 1), tol);
+  EXPECT_NEAR(result.get_optimal_cost(), Solve(prog).get_optimal_cost(), tol);
+  // The completed solution satisfies the original PSD constraint.
+  const MatrixXd X_sol = result.GetSolution(X);
+  EXPECT_TRUE(CompareMatrices(X_sol, X_sol.transpose()));
+  EXPECT_GT(MinEigenvalue(X_sol), -tol);
+}
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
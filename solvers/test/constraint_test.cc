@@ -1,5 +1,8 @@
 #include "drake/solvers/constraint.h"
 
+#include <thread>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -88,6 +91,144 @@ GTEST_TEST(testConstraint, testLinearConstraintUpdate) {
   EXPECT_TRUE(CompareMatrices(constraint.A(), A3));
   EXPECT_EQ(constraint.num_constraints(), 3);
 }
+
+GTEST_TEST(testConstraint, testSparseLinearConstraint) {
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.emplace_back(0, 0, 1);
+  triplets.emplace_back(0, 2, -2);
+  triplets.emplace_back(1, 1, 3);
+  Eigen::SparseMatrix<double> A(2, 3);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  const Eigen::Vector2d lb(-1, 0);
+  const Eigen::Vector2d ub(1, kInf);
+  LinearConstraint constraint(A, lb, ub);
+  EXPECT_EQ(constraint.num_constraints(), 2);
+  EXPECT_EQ(constraint.num_vars(), 3);
+  EXPECT_EQ(constraint.get_sparse_A().nonZeros(), 3);
+  EXPECT_TRUE(CompareMatrices(MatrixXd(constraint.get_sparse_A()),
+                              MatrixXd(A)));
+
+  const Eigen::Vector3d x(1, 2, 3);
+  Eigen::VectorXd y;
+  constraint.Eval(x, &y);
+  EXPECT_TRUE(CompareMatrices(y, Eigen::Vector2d(-5, 6)));
+  AutoDiffVecXd y_autodiff;
+  constraint.Eval(math::InitializeAutoDiff(x), &y_autodiff);
+  EXPECT_TRUE(CompareMatrices(math::ExtractValue(y_autodiff), y));
+  EXPECT_TRUE(CompareMatrices(math::ExtractGradient(y_autodiff), MatrixXd(A)));
+  const Vector3<Variable> x_sym(Variable("x0"), Variable("x1"),
+                                Variable("x2"));
+  VectorX<Expression> y_sym;
+  constraint.Eval(x_sym, &y_sym);
+  ASSERT_EQ(y_sym.size(), 2);
+  EXPECT_PRED2(ExprEqual, y_sym(0), x_sym(0) - 2 * x_sym(2));
+  EXPECT_PRED2(ExprEqual, y_sym(1), 3 * x_sym(1));
+  // The dense matrix is formed on request.
+  EXPECT_TRUE(CompareMatrices(constraint.A(), MatrixXd(A)));
+
+  // Update with a sparse matrix that has a different number of rows.
+  Eigen::SparseMatrix<double> A2(1, 3);
+  A2.insert(0, 1) = 4;
+  constraint.UpdateCoefficients(A2, Vector1d(0), Vector1d(1));
+  EXPECT_EQ(constraint.num_constraints(), 1);
+  EXPECT_TRUE(CompareMatrices(constraint.A(), MatrixXd(A2)));
+  constraint.Eval(x, &y);
+  EXPECT_TRUE(CompareMatrices(y, Vector1d(8)));
+  EXPECT_THROW(constraint.UpdateCoefficients(Eigen::SparseMatrix<double>(1, 2),
+                                             Vector1d(0), Vector1d(1)),
+               std::runtime_error);
+
+  // A dense update replaces the sparse matrix too.
+  constraint.UpdateCoefficients(Eigen::RowVector3d(1, 0, 1), Vector1d(0),
+                                Vector1d(1));
+  EXPECT_EQ(constraint.get_sparse_A().nonZeros(), 2);
+
+  LinearEqualityConstraint equality(A, Eigen::Vector2d(1, 2));
+  // The double-only gradient matches the AutoDiffXd one, both dense
+  // (row-major) and in the declared sparsity pattern's order.
+  Eigen::VectorXd dy_dx(6);
+  ASSERT_TRUE(equality.EvalWithGradient(x, &y, &dy_dx));
+  EXPECT_TRUE(CompareMatrices(y, Eigen::Vector2d(-5, 6)));
+  Eigen::VectorXd dy_dx_expected(6);
+  dy_dx_expected << 1, 0, -2, 0, 3, 0;
+  EXPECT_TRUE(CompareMatrices(dy_dx, dy_dx_expected));
+  equality.SetGradientSparsityPattern({{1, 1}, {0, 2}, {0, 0}});
+  dy_dx.resize(3);
+  ASSERT_TRUE(equality.EvalWithGradient(x, &y, &dy_dx));
+  EXPECT_TRUE(CompareMatrices(dy_dx, Eigen::Vector3d(3, -2, 1)));
+  EXPECT_TRUE(CompareMatrices(equality.lower_bound(), Eigen::Vector2d(1, 2)));
+  EXPECT_TRUE(CompareMatrices(equality.upper_bound(), Eigen::Vector2d(1, 2)));
+  EXPECT_TRUE(CompareMatrices(equality.A(), MatrixXd(A)));
+}
+
+// Concurrent first calls to A() on a sparse constraint all see the same,
+// fully formed dense matrix.
+GTEST_TEST(testConstraint, testSparseLinearConstraintConcurrentA) {
+  Eigen::SparseMatrix<double> A(50, 40);
+  for (int i = 0; i < 40; ++i) {
+    A.insert(i, i) = i + 1;
+    A.insert(i + 10, i) = -1;
+  }
+  const LinearConstraint constraint(A, VectorXd::Zero(50),
+                                    VectorXd::Constant(50, kInf));
+  std::vector<const MatrixXd*> results(8, nullptr);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < static_cast<int>(results.size()); ++i) {
+    threads.emplace_back([&constraint, &results, i]() {
+      results[i] = &constraint.A();
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const MatrixXd* result : results) {
+    EXPECT_EQ(result, results[0]);
+  }
+  EXPECT_TRUE(CompareMatrices(*results[0], MatrixXd(A)));
+}
+
+// A subclass that still reads the deprecated A_ member.
+class LegacyLinearConstraint : public LinearConstraint {
+ public:
+  using LinearConstraint::LinearConstraint;
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  const MatrixXd& legacy_A() const { return A_; }
+#pragma GCC diagnostic pop
+};
+
+GTEST_TEST(testConstraint, testDenseLinearConstraint) {
+  const Eigen::Matrix<double, 2, 3> A =
+      (Eigen::Matrix<double, 2, 3>() << 1, 0, -2, 0, 3, 0).finished();
+  const LegacyLinearConstraint constraint(A, Eigen::Vector2d(-1, 0),
+                                          Eigen::Vector2d(1, kInf));
+  // A is stored once, densely; A() and the deprecated member refer to it.
+  EXPECT_EQ(&constraint.A(), &constraint.legacy_A());
+  EXPECT_TRUE(CompareMatrices(constraint.legacy_A(), A));
+
+  const Eigen::Vector3d x(1, 2, 3);
+  Eigen::VectorXd y;
+  constraint.Eval(x, &y);
+  EXPECT_TRUE(CompareMatrices(y, Eigen::Vector2d(-5, 6)));
+  AutoDiffVecXd y_autodiff;
+  constraint.Eval(math::InitializeAutoDiff(x), &y_autodiff);
+  EXPECT_TRUE(CompareMatrices(math::ExtractValue(y_autodiff), y));
+  EXPECT_TRUE(CompareMatrices(math::ExtractGradient(y_autodiff), MatrixXd(A)));
+  Eigen::VectorXd dy_dx(6);
+  ASSERT_TRUE(constraint.EvalWithGradient(x, &y, &dy_dx));
+  Eigen::VectorXd dy_dx_expected(6);
+  dy_dx_expected << 1, 0, -2, 0, 3, 0;
+  EXPECT_TRUE(CompareMatrices(dy_dx, dy_dx_expected));
+
+  // The sparse matrix is formed on request, once.
+  const Eigen::SparseMatrix<double>& A_sparse = constraint.get_sparse_A();
+  EXPECT_EQ(A_sparse.nonZeros(), 3);
+  EXPECT_TRUE(CompareMatrices(MatrixXd(A_sparse), A));
+  EXPECT_EQ(&constraint.get_sparse_A(), &A_sparse);
+  EXPECT_TRUE(CompareMatrices(MatrixXd(constraint.GetSparseMatrix()), A));
+}
+
 GTEST_TEST(testConstraint, testQuadraticConstraintHessian) {
   // Check if the getters in the QuadraticConstraint are right.
   Eigen::Matrix2d Q;
@@ -287,6 +287,28 @@ GTEST_TEST(TestQuadraticCost, ConvexCost) {
   EXPECT_TRUE(cost->is_convex());
 }
 
+GTEST_TEST(TestQuadraticCost, EvalWithGradient) {
+  Eigen::Matrix2d Q;
+  Q << 1, 2, 3, 10;
+  const Eigen::Vector2d b(5, 6);
+  const QuadraticCost cost(Q, b, 0.5);
+  const Eigen::Vector2d x(-1, 2);
+
+  AutoDiffVecXd y_autodiff;
+  cost.Eval(math::InitializeAutoDiff(x), &y_autodiff);
+  VectorXd y;
+  VectorXd dy_dx(2);
+  ASSERT_TRUE(cost.EvalWithGradient(x, &y, &dy_dx));
+  EXPECT_TRUE(CompareMatrices(y, math::ExtractValue(y_autodiff), 1E-14));
+  EXPECT_TRUE(CompareMatrices(
+      dy_dx, math::ExtractGradient(y_autodiff).transpose(), 1E-14));
+
+  const LinearCost linear_cost(b, 1);
+  ASSERT_TRUE(linear_cost.EvalWithGradient(x, &y, &dy_dx));
+  EXPECT_TRUE(CompareMatrices(y, Vector1d(8)));
+  EXPECT_TRUE(CompareMatrices(dy_dx, b));
+}
+
 // TODO(eric.cousineau): Move QuadraticErrorCost and L2NormCost tests here from
 // MathematicalProgram.
 
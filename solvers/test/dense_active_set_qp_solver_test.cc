@@ -0,0 +1,83 @@
+#include "drake/solvers/dense_active_set_qp_solver.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/test/quadratic_program_examples.h"
+
+namespace drake {
+namespace solvers {
+namespace test {
+
+GTEST_TEST(DenseActiveSetQpSolverTest, Qp) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  prog.AddQuadraticErrorCost(Eigen::Matrix2d::Identity(),
+                             Eigen::Vector2d(1, 2), x);
+  prog.AddLinearCost(x(0) + 3);
+  auto constraint = prog.AddLinearConstraint(x(0) + x(1) <= 2);
+  auto bounds = prog.AddBoundingBoxConstraint(0, 1, x(0));
+
+  DenseActiveSetQpSolver solver;
+  EXPECT_TRUE(solver.available());
+  EXPECT_TRUE(solver.AreProgramAttributesSatisfied(prog));
+  MathematicalProgramResult result = solver.Solve(prog);
+  ASSERT_TRUE(result.is_success());
+  EXPECT_EQ(result.get_solver_id(), DenseActiveSetQpSolver::id());
+  // min |x - (1, 2)|² + x₀ + 3 s.t. x₀ + x₁ ≤ 2, 0 ≤ x₀ ≤ 1.
+  const double tol = 1E-10;
+  const Eigen::Vector2d x_expected(0.25, 1.75);
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x), x_expected, tol));
+  EXPECT_NEAR(result.get_optimal_cost(), 3.875, tol);
+  EXPECT_NEAR(result.GetDualSolution(constraint)(0), -0.5, tol);
+  EXPECT_NEAR(result.GetDualSolution(bounds)(0), 0, tol);
+
+  // With an initial guess on the optimal active set, no iteration is needed.
+  prog.SetInitialGuess(x, x_expected);
+  SolverOptions options;
+  options.SetOption(DenseActiveSetQpSolver::id(),
+                    DenseActiveSetQpSolver::MaxIterationsOptionName(), 0);
+  result = solver.Solve(prog, std::nullopt, options);
+  ASSERT_TRUE(result.is_success());
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x), x_expected, tol));
+  result = solver.Solve(prog, Eigen::Vector2d(1, 0), options);
+  EXPECT_EQ(result.get_solution_result(), SolutionResult::kIterationLimit);
+
+  // The Hessian must be positive definite.
+  prog.NewContinuousVariables<1>();
+  result = solver.Solve(prog);
+  EXPECT_EQ(result.get_solution_result(), SolutionResult::kInvalidInput);
+}
+
+GTEST_TEST(DenseActiveSetQpSolverTest, Infeasible) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  prog.AddQuadraticCost(x(0) * x(0) + x(1) * x(1));
+  prog.AddLinearConstraint(x(0) + x(1) >= 3);
+  prog.AddBoundingBoxConstraint(-1, 1, x);
+  DenseActiveSetQpSolver solver;
+  const MathematicalProgramResult result = solver.Solve(prog);
+  EXPECT_EQ(result.get_solution_result(),
+            SolutionResult::kInfeasibleConstraints);
+  EXPECT_EQ(result.get_optimal_cost(),
+            MathematicalProgram::kGlobalInfeasibleCost);
+}
+
+GTEST_TEST(DenseActiveSetQpSolverTest, UnitBall) {
+  DenseActiveSetQpSolver solver;
+  TestQPonUnitBallExample(solver);
+}
+
+GTEST_TEST(DenseActiveSetQpSolverTest, DualSolution) {
+  DenseActiveSetQpSolver solver;
+  TestQPDualSolution1(solver);
+  TestQPDualSolution2(solver);
+  TestQPDualSolution3(solver);
+  TestEqualityConstrainedQPDualSolution1(solver);
+  TestEqualityConstrainedQPDualSolution2(solver);
+}
+
+}  // namespace test
+}  // namespace solvers
+}  // namespace drake
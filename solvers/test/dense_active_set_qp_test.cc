@@ -0,0 +1,212 @@
+#include "drake/solvers/dense_active_set_qp.h"
+
+#include <limits>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+const double kInf = std::numeric_limits<double>::infinity();
+const double kTol = 1E-9;
+
+// Checks the first-order optimality conditions of the last solve.
+template <typename Qp>
+void CheckKkt(const Qp& qp, const MatrixXd& H, const VectorXd& g,
+              const MatrixXd& C, const VectorXd& lower, const VectorXd& upper) {
+  const VectorXd x = qp.x();
+  const VectorXd dual = qp.dual();
+  EXPECT_TRUE(CompareMatrices(H * x + g, C.transpose() * dual, kTol));
+  const VectorXd Cx = C * x;
+  for (int i = 0; i < C.rows(); ++i) {
+    EXPECT_GE(Cx(i), lower(i) - kTol);
+    EXPECT_LE(Cx(i), upper(i) + kTol);
+    if (dual(i) > 0) {
+      EXPECT_NEAR(Cx(i), lower(i), kTol);
+    } else if (dual(i) < 0) {
+      EXPECT_NEAR(Cx(i), upper(i), kTol);
+    }
+  }
+}
+
+GTEST_TEST(DenseActiveSetQpTest, FixedSize) {
+  // Projects (1, 2) onto x₀ + x₁ ≤ 2, x ≥ 0.
+  DenseActiveSetQp<2, 3> qp;
+  using ActiveBound = DenseActiveSetQp<2, 3>::ActiveBound;
+  const Eigen::Matrix2d H = 2 * Eigen::Matrix2d::Identity();
+  Eigen::Vector2d g(-2, -4);
+  Eigen::Matrix<double, 3, 2> C;
+  // clang-format off
+  C << 1, 1,
+       1, 0,
+       0, 1;
+  // clang-format on
+  const Eigen::Vector3d lower(-kInf, 0, 0);
+  const Eigen::Vector3d upper(2, kInf, kInf);
+  ASSERT_EQ(qp.Solve(H, g, C, lower, upper), DenseActiveSetQpStatus::kSolved);
+  EXPECT_TRUE(CompareMatrices(qp.x(), Eigen::Vector2d(0.5, 1.5), kTol));
+  EXPECT_TRUE(CompareMatrices(qp.dual(), Eigen::Vector3d(-1, 0, 0), kTol));
+  EXPECT_EQ(qp.active_bound(0), ActiveBound::kUpper);
+  EXPECT_EQ(qp.active_bound(1), ActiveBound::kNone);
+  EXPECT_EQ(qp.num_active(), 1);
+  EXPECT_GT(qp.num_iterations(), 0);
+
+  // Warm started from the optimal active set, a nearby problem is solved
+  // without any iteration.
+  g << -2, -4.4;
+  ASSERT_EQ(qp.Solve(H, g, C, lower, upper), DenseActiveSetQpStatus::kSolved);
+  EXPECT_TRUE(CompareMatrices(qp.x(), Eigen::Vector2d(0.4, 1.6), kTol));
+  EXPECT_EQ(qp.num_iterations(), 0);
+
+  // When the active set changes, the constraints that are no longer active
+  // are dropped, and the new ones are added.
+  g << -2, -10;
+  ASSERT_EQ(qp.Solve(H, g, C, lower, upper), DenseActiveSetQpStatus::kSolved);
+  EXPECT_TRUE(CompareMatrices(qp.x(), Eigen::Vector2d(0, 2), kTol));
+  CheckKkt(qp, H, g, C, lower, upper);
+  g << 2, -1;
+  ASSERT_EQ(qp.Solve(H, g, C, lower, upper), DenseActiveSetQpStatus::kSolved);
+  EXPECT_TRUE(CompareMatrices(qp.x(), Eigen::Vector2d(0, 0.5), kTol));
+  CheckKkt(qp, H, g, C, lower, upper);
+  EXPECT_EQ(qp.active_bound(0), ActiveBound::kNone);
+  EXPECT_EQ(qp.active_bound(1), ActiveBound::kLower);
+}
+
+GTEST_TEST(DenseActiveSetQpTest, Equality) {
+  // min x₀² + x₁² s.t. x₀ + x₁ = b, x₀ - x₁ ≤ 1.
+  DenseActiveSetQp<2, 2> qp;
+  const Eigen::Matrix2d H = 2 * Eigen::Matrix2d::Identity();
+  const Eigen::Vector2d g = Eigen::Vector2d::Zero();
+  Eigen::Matrix2d C;
+  // clang-format off
+  C << 1, 1,
+       1, -1;
+  // clang-format on
+  for (const double b : {3.0, -3.0, 3.0}) {
+    const Eigen::Vector2d lower(b, -kInf);
+    const Eigen::Vector2d upper(b, 1);
+    ASSERT_EQ(qp.Solve(H, g, C, lower, upper),
+              DenseActiveSetQpStatus::kSolved);
+    EXPECT_TRUE(CompareMatrices(qp.x(), Eigen::Vector2d(b / 2, b / 2), kTol));
+    EXPECT_NEAR(qp.dual()(0), b, kTol);
+    CheckKkt(qp, H, g, C, lower, upper);
+  }
+}
+
+GTEST_TEST(DenseActiveSetQpTest, RandomProblems) {
+  const int n = 8;
+  const int m = 14;
+  std::mt19937 generator(1234);
+  std::normal_distribution<double> normal;
+  auto random_matrix = [&](int rows, int cols) {
+    return MatrixXd::NullaryExpr(rows, cols, [&]() {
+      return normal(generator);
+    });
+  };
+  DenseActiveSetQp<Eigen::Dynamic, Eigen::Dynamic> warm(n, m);
+  for (int trial = 0; trial < 20; ++trial) {
+    const MatrixXd A = random_matrix(n, n);
+    const MatrixXd H = A * A.transpose() + 0.1 * MatrixXd::Identity(n, n);
+    const VectorXd g = 5 * random_matrix(n, 1);
+    const MatrixXd C = random_matrix(m, n);
+    // The bounds contain C x₀ for a random x₀, so that the problem is
+    // feasible. A few rows are equalities, and a few are one-sided.
+    const VectorXd Cx0 = C * random_matrix(n, 1);
+    VectorXd lower = Cx0 - random_matrix(m, 1).cwiseAbs();
+    VectorXd upper = Cx0 + random_matrix(m, 1).cwiseAbs();
+    lower(0) = upper(0) = Cx0(0);
+    lower(1) = upper(1) = Cx0(1);
+    lower(2) = -kInf;
+    upper(3) = kInf;
+
+    DenseActiveSetQp<Eigen::Dynamic, Eigen::Dynamic> cold(n, m);
+    ASSERT_EQ(cold.Solve(H, g, C, lower, upper),
+              DenseActiveSetQpStatus::kSolved);
+    CheckKkt(cold, H, g, C, lower, upper);
+    ASSERT_EQ(warm.Solve(H, g, C, lower, upper),
+              DenseActiveSetQpStatus::kSolved);
+    EXPECT_TRUE(CompareMatrices(warm.x(), cold.x(), 1E-8));
+
+    // A small perturbation of the problem, solved from the previous active
+    // set.
+    const VectorXd g_perturbed = g + 1E-3 * random_matrix(n, 1);
+    ASSERT_EQ(cold.Solve(H, g_perturbed, C, lower, upper),
+              DenseActiveSetQpStatus::kSolved);
+    CheckKkt(cold, H, g_perturbed, C, lower, upper);
+  }
+}
+
+GTEST_TEST(DenseActiveSetQpTest, Infeasible) {
+  // x₀ ≥ 1 and x₀ + x₁ ≤ 0 and x₁ ≥ 0.
+  DenseActiveSetQp<2, 3> qp;
+  Eigen::Matrix<double, 3, 2> C;
+  // clang-format off
+  C << 1, 0,
+       1, 1,
+       0, 1;
+  // clang-format on
+  EXPECT_EQ(qp.Solve(Eigen::Matrix2d::Identity(), Eigen::Vector2d::Zero(), C,
+                     Eigen::Vector3d(1, -kInf, 0),
+                     Eigen::Vector3d(kInf, 0, kInf)),
+            DenseActiveSetQpStatus::kInfeasible);
+}
+
+GTEST_TEST(DenseActiveSetQpTest, NotStrictlyConvex) {
+  DenseActiveSetQp<2, 1> qp;
+  Eigen::Matrix2d H;
+  H << 1, 0, 0, 0;
+  EXPECT_EQ(qp.Solve(H, Eigen::Vector2d::Zero(), Eigen::RowVector2d(1, 1),
+                     Eigen::Matrix<double, 1, 1>(0),
+                     Eigen::Matrix<double, 1, 1>(1)),
+            DenseActiveSetQpStatus::kNotStrictlyConvex);
+}
+
+GTEST_TEST(DenseActiveSetQpTest, IterationLimit) {
+  DenseActiveSetQp<2, 1> qp;
+  qp.set_max_iterations(0);
+  EXPECT_EQ(qp.Solve(Eigen::Matrix2d::Identity(), Eigen::Vector2d::Zero(),
+                     Eigen::RowVector2d(1, 1), Eigen::Matrix<double, 1, 1>(1),
+                     Eigen::Matrix<double, 1, 1>(2)),
+            DenseActiveSetQpStatus::kIterationLimit);
+  EXPECT_EQ(qp.num_active(), 0);
+}
+
+GTEST_TEST(DenseActiveSetQpTest, WarmStartGuess) {
+  // A guess that contains a dependent constraint and an infinite bound.
+  DenseActiveSetQp<Eigen::Dynamic, 3> qp(2);
+  using ActiveBound = DenseActiveSetQp<Eigen::Dynamic, 3>::ActiveBound;
+  Eigen::Matrix<double, 3, 2> C;
+  // clang-format off
+  C << 1, 0,
+       2, 0,
+       0, 1;
+  // clang-format on
+  qp.set_active_bound(0, ActiveBound::kLower);
+  qp.set_active_bound(1, ActiveBound::kLower);
+  qp.set_active_bound(2, ActiveBound::kUpper);
+  ASSERT_EQ(qp.Solve(Eigen::Matrix2d::Identity(), Eigen::Vector2d(-1, -1), C,
+                     Eigen::Vector3d(2, 4, -kInf),
+                     Eigen::Vector3d(kInf, kInf, kInf)),
+            DenseActiveSetQpStatus::kSolved);
+  EXPECT_TRUE(CompareMatrices(qp.x(), Eigen::Vector2d(2, 1), kTol));
+  EXPECT_EQ(qp.num_active(), 1);
+  EXPECT_EQ(qp.active_bound(2), ActiveBound::kNone);
+  EXPECT_NEAR(qp.dual()(0) + 2 * qp.dual()(1), 1, kTol);
+
+  qp.ResetActiveSet();
+  EXPECT_EQ(qp.active_bound(0), ActiveBound::kNone);
+  EXPECT_THROW(qp.set_active_bound(3, ActiveBound::kLower), std::exception);
+  using FixedQp = DenseActiveSetQp<2, 3>;
+  EXPECT_THROW(FixedQp(3), std::exception);
+}
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
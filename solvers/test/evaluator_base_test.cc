@@ -236,6 +236,16 @@ GTEST_TEST(EvaluatorBaseTest, SetGradientSparsityPattern) {
   }
 }
 
+GTEST_TEST(EvaluatorBaseTest, EvalWithGradientDefault) {
+  // An evaluator that does not override DoEvalWithGradient() reports that
+  // callers must fall back to AutoDiffXd.
+  SimpleEvaluator evaluator;
+  Eigen::VectorXd y;
+  Eigen::VectorXd dy_dx(6);
+  EXPECT_FALSE(evaluator.EvalWithGradient(Eigen::Vector3d(1, 2, 3), &y,
+                                          &dy_dx));
+}
+
 /**
  * An evaluator with dynamic sized input.
  */
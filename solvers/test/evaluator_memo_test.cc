@@ -0,0 +1,134 @@
+#include "drake/solvers/evaluator_memo.h"
+
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+namespace {
+
+using Eigen::Vector2d;
+using Eigen::VectorXd;
+
+// y = (x₀x₁, x₁²), counting its evaluations. If `with_gradient` is set, it
+// implements DoEvalWithGradient(); otherwise solvers go through AutoDiffXd.
+class CountingEvaluator : public EvaluatorBase {
+ public:
+  explicit CountingEvaluator(bool with_gradient)
+      : EvaluatorBase(2, 2), with_gradient_(with_gradient) {}
+
+  int num_evals() const { return num_evals_; }
+
+ private:
+  template <typename T>
+  void DoEvalGeneric(const Eigen::Ref<const VectorX<T>>& x,
+                     VectorX<T>* y) const {
+    ++num_evals_;
+    y->resize(2);
+    (*y)(0) = x(0) * x(1);
+    (*y)(1) = x(1) * x(1);
+  }
+
+  void DoEval(const Eigen::Ref<const VectorXd>& x,
+              VectorXd* y) const override {
+    DoEvalGeneric<double>(x, y);
+  }
+
+  void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+              AutoDiffVecXd* y) const override {
+    DoEvalGeneric<AutoDiffXd>(x, y);
+  }
+
+  void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>&,
+              VectorX<symbolic::Expression>*) const override {
+    throw std::logic_error("Not supported");
+  }
+
+  bool DoEvalWithGradient(const Eigen::Ref<const VectorXd>& x, VectorXd* y,
+                          EigenPtr<VectorXd> dy_dx) const override {
+    if (!with_gradient_) {
+      return false;
+    }
+    DoEval(x, y);
+    if (gradient_sparsity_pattern().has_value()) {
+      *dy_dx << x(1), x(0), 2 * x(1);
+    } else {
+      *dy_dx << x(1), x(0), 0, 2 * x(1);
+    }
+    return true;
+  }
+
+  const bool with_gradient_;
+  mutable int num_evals_{0};
+};
+
+GTEST_TEST(EvalValueAndGradientTest, Layout) {
+  const Vector2d x(3, 5);
+  const Vector2d y_expected(15, 25);
+  for (const bool with_gradient : {false, true}) {
+    CountingEvaluator dense(with_gradient);
+    MemoizedEvaluation result;
+    EvalValueAndGradient(dense, x, &result);
+    EXPECT_TRUE(CompareMatrices(result.y, y_expected));
+    EXPECT_TRUE(
+        CompareMatrices(result.dy_dx, Eigen::Vector4d(5, 3, 0, 10)));
+
+    CountingEvaluator sparse(with_gradient);
+    sparse.SetGradientSparsityPattern({{0, 0}, {0, 1}, {1, 1}});
+    EvalValueAndGradient(sparse, x, &result);
+    EXPECT_TRUE(CompareMatrices(result.y, y_expected));
+    EXPECT_TRUE(
+        CompareMatrices(result.dy_dx, Eigen::Vector3d(5, 3, 10)));
+  }
+}
+
+GTEST_TEST(EvaluatorMemoTest, MemoizesByEvaluatorAndInput) {
+  CountingEvaluator evaluator(false);
+  CountingEvaluator other(false);
+  EvaluatorMemo memo;
+  const Vector2d x(3, 5);
+
+  EXPECT_EQ(memo.Find(evaluator, x), nullptr);
+  const MemoizedEvaluation& first = memo.Eval(evaluator, x);
+  EXPECT_EQ(evaluator.num_evals(), 1);
+  EXPECT_EQ(&memo.Eval(evaluator, x), &first);
+  EXPECT_EQ(memo.Find(evaluator, x), &first);
+  EXPECT_EQ(evaluator.num_evals(), 1);
+
+  // A different input or a different evaluator is a different entry.
+  memo.Eval(evaluator, Vector2d(3, 6));
+  EXPECT_EQ(evaluator.num_evals(), 2);
+  memo.Eval(other, x);
+  EXPECT_EQ(other.num_evals(), 1);
+  EXPECT_EQ(memo.size(), 3);
+
+  memo.Clear();
+  EXPECT_EQ(memo.size(), 0);
+  memo.Eval(evaluator, x);
+  EXPECT_EQ(evaluator.num_evals(), 3);
+}
+
+GTEST_TEST(EvaluatorMemoTest, Reset) {
+  CountingEvaluator evaluator(true);
+  EvaluatorMemo memo;
+  const VectorXd decision_variables = Eigen::Vector3d(1, 2, 3);
+  memo.Reset(decision_variables);
+  memo.Eval(evaluator, Vector2d(1, 2));
+  EXPECT_EQ(memo.size(), 1);
+
+  // The same decision variables keep the memo; different ones clear it.
+  memo.Reset(decision_variables);
+  EXPECT_EQ(memo.size(), 1);
+  memo.Reset(Eigen::Vector3d(1, 2, 4));
+  EXPECT_EQ(memo.size(), 0);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
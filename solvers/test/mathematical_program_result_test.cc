@@ -8,6 +8,7 @@
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/test_utilities/symbolic_test_util.h"
 #include "drake/solvers/cost.h"
+#include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/osqp_solver.h"
 #include "drake/solvers/snopt_solver.h"
 
@@ -56,6 +57,11 @@ TEST_F(MathematicalProgramResultTest, Setters) {
   EXPECT_EQ(result.GetSuboptimalSolution(x0_, 0), 1);
   EXPECT_EQ(result.GetSuboptimalSolution(x1_, 0), 2);
   EXPECT_EQ(result.get_suboptimal_objective(0), 0.1);
+  result.ClearSuboptimalSolutions();
+  EXPECT_EQ(result.num_suboptimal_solution(), 0);
+  result.AddSuboptimalSolution(0.2, Eigen::Vector2d(3, 4));
+  EXPECT_EQ(result.num_suboptimal_solution(), 1);
+  EXPECT_EQ(result.GetSuboptimalSolution(x0_, 0), 3);
   DRAKE_EXPECT_THROWS_MESSAGE(result.set_x_val(Eigen::Vector3d::Zero()),
                               "MathematicalProgramResult::set_x_val, the "
                               "dimension of x_val is 3, expected 2");
@@ -171,6 +177,74 @@ TEST_F(MathematicalProgramResultTest, DualSolution) {
                   result.get_solver_id()));
 }
 
+TEST_F(MathematicalProgramResultTest, Reset) {
+  MathematicalProgramResult result;
+  result.set_decision_variable_index(decision_variable_index_);
+  result.set_solution_result(SolutionResult::kSolutionFound);
+  result.set_x_val(Eigen::Vector2d(1, 2));
+  result.set_optimal_cost(3);
+  result.set_solver_id(SolverId("foo"));
+  const Binding<BoundingBoxConstraint> binding1(
+      std::make_shared<BoundingBoxConstraint>(Vector1d(0), Vector1d(1)),
+      Vector1<symbolic::Variable>(x0_));
+  const Binding<BoundingBoxConstraint> binding2(
+      std::make_shared<BoundingBoxConstraint>(Vector1d(0), Vector1d(1)),
+      Vector1<symbolic::Variable>(x1_));
+  const Binding<BoundingBoxConstraint> binding3(
+      std::make_shared<BoundingBoxConstraint>(Vector1d(0), Vector1d(1)),
+      Vector1<symbolic::Variable>(x0_));
+  result.set_dual_solution(binding1, Vector1d(1));
+  result.set_dual_solution(binding2, Vector1d(2));
+  // The first dual solution set for a constraint is kept.
+  result.set_dual_solution(binding1, Vector1d(3));
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(binding1), Vector1d(1)));
+
+  result.Reset();
+  EXPECT_FALSE(result.is_success());
+  EXPECT_TRUE(std::isnan(result.get_optimal_cost()));
+  EXPECT_EQ(result.get_solver_id(),
+            MathematicalProgramResult().get_solver_id());
+  ASSERT_EQ(result.get_x_val().size(), 2);
+  EXPECT_TRUE(result.get_x_val().array().isNaN().all());
+  EXPECT_THROW(result.GetDualSolution(binding1), std::exception);
+  EXPECT_THROW(result.GetDualSolution(binding2), std::exception);
+  // The decision variable index is kept.
+  result.set_x_val(Eigen::Vector2d(4, 5));
+  EXPECT_EQ(result.GetSolution(x1_), 5);
+
+  // Sets the dual solutions in a different order, and for a different set of
+  // constraints, than before the reset.
+  result.set_dual_solution(binding2, Vector1d(4));
+  result.set_dual_solution(binding3, Vector1d(5));
+  result.set_dual_solution(binding1, Vector1d(6));
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(binding1), Vector1d(6)));
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(binding2), Vector1d(4)));
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(binding3), Vector1d(5)));
+
+  // Sets a subset of them in the same order as before.
+  result.Reset();
+  result.set_dual_solution(binding2, Vector1d(7));
+  result.set_dual_solution(binding3, Vector1d(8));
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(binding2), Vector1d(7)));
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(binding3), Vector1d(8)));
+  EXPECT_THROW(result.GetDualSolution(binding1), std::exception);
+}
+
+TEST_F(MathematicalProgramResultTest, SharedDecisionVariableIndex) {
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables<2>();
+  MathematicalProgramResult result;
+  result.set_decision_variable_index(prog.shared_decision_variable_index());
+  result.set_x_val(Eigen::Vector2d(1, 2));
+  // Adding variables to the program doesn't change the index that the result
+  // shares.
+  const auto y = prog.NewContinuousVariables<1>();
+  EXPECT_EQ(prog.decision_variable_index().size(), 3);
+  EXPECT_EQ(prog.FindDecisionVariableIndex(y(0)), 2);
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x), Eigen::Vector2d(1, 2)));
+  EXPECT_THROW(result.GetSolution(y(0)), std::exception);
+}
+
 struct DummySolverDetails {
   int data{0};
 };
@@ -3026,6 +3026,14 @@ GTEST_TEST(TestMathematicalProgram, TestClone) {
   EXPECT_TRUE(CompareMatrices(new_prog->initial_guess(), prog.initial_guess()));
 }
 
+GTEST_TEST(TestMathematicalProgram, EvaluationParallelism) {
+  MathematicalProgram prog;
+  EXPECT_EQ(prog.evaluation_parallelism().num_threads(), 1);
+  prog.set_evaluation_parallelism(Parallelism(4));
+  EXPECT_EQ(prog.evaluation_parallelism().num_threads(), 4);
+  EXPECT_EQ(prog.Clone()->evaluation_parallelism().num_threads(), 4);
+}
+
 GTEST_TEST(TestMathematicalProgram, TestEvalBinding) {
   MathematicalProgram prog;
   auto x = prog.NewContinuousVariables<3>();
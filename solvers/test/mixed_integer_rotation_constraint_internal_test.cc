@@ -2,6 +2,9 @@
 #include "drake/solvers/mixed_integer_rotation_constraint_internal.h"
 /* clang-format on */
 
+#include <memory>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -339,6 +342,39 @@ GTEST_TEST(RotationTest, TestIntersectBoxWithCircle) {
   CompareHalfspaceRelaxation(desired);
   CheckInnerFacets(desired);
 }
+
+GTEST_TEST(RotationTest, TestGetBoxSphereIntersections) {
+  const int N = 2;
+  const std::shared_ptr<const internal::BoxSphereIntersections> boxes =
+      internal::GetBoxSphereIntersections(N);
+  ASSERT_NE(boxes, nullptr);
+  EXPECT_EQ(boxes->num_intervals_per_half_axis, N);
+  EXPECT_EQ(static_cast<int>(boxes->boxes.size()), N * N * N);
+  // The result is computed once and shared afterwards.
+  EXPECT_EQ(internal::GetBoxSphereIntersections(N), boxes);
+  EXPECT_NE(internal::GetBoxSphereIntersections(N + 1), boxes);
+
+  // The box [0, 0.5]³ is strictly inside the sphere.
+  EXPECT_TRUE(boxes->box(0, 0, 0).vertices.empty());
+  // The box [0.5, 1] x [0, 0.5] x [0, 0.5] intersects the sphere surface in a
+  // region; compare against computing it directly.
+  const internal::BoxSphereIntersection& box = boxes->box(1, 0, 0);
+  const std::vector<Eigen::Vector3d> vertices =
+      internal::ComputeBoxEdgesAndSphereIntersection(
+          Eigen::Vector3d(0.5, 0, 0), Eigen::Vector3d(1, 0.5, 0.5));
+  CompareIntersectionResults(vertices, box.vertices);
+  Eigen::Vector3d n;
+  double d;
+  internal::ComputeHalfSpaceRelaxationForBoxSphereIntersection(vertices, &n,
+                                                               &d);
+  EXPECT_TRUE(CompareMatrices(box.normal, n, 1E-10));
+  EXPECT_NEAR(box.d, d, 1E-10);
+  Eigen::Matrix<double, Eigen::Dynamic, 3> A;
+  Eigen::VectorXd b;
+  internal::ComputeInnerFacetsForBoxSphereIntersection(vertices, &A, &b);
+  EXPECT_TRUE(CompareMatrices(box.A, A));
+  EXPECT_TRUE(CompareMatrices(box.b, b));
+}
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
@@ -376,6 +376,74 @@ GTEST_TEST(testMobyLCP, testFailure) {
   // not to fail.
 }
 
+// Verifies that a problem requiring more pivots than the interval at which
+// the basis inverse is refactored is solved accurately.
+GTEST_TEST(testMobyLCP, testManyPivots) {
+  const int n = 80;
+  const Eigen::MatrixXd A = Eigen::MatrixXd::Random(n, n);
+  const Eigen::MatrixXd M =
+      A * A.transpose() + Eigen::MatrixXd::Identity(n, n);
+  const Eigen::VectorXd expected_z = Eigen::VectorXd::LinSpaced(n, 1, 2);
+  const Eigen::VectorXd q = -M * expected_z;
+
+  MobyLCPSolver<double> l;
+  l.SetLoggingEnabled(verbose);
+  Eigen::VectorXd z;
+  ASSERT_TRUE(l.SolveLcpLemke(M, q, &z));
+  EXPECT_GE(l.get_num_pivots(), n);
+  EXPECT_TRUE(CompareMatrices(z, expected_z, epsilon,
+                              MatrixCompareType::absolute));
+}
+
+// Verifies that warm starting solves a sequence of related problems without
+// pivoting, falls back to pivoting when the basis changes, and agrees with
+// solutions computed from scratch.
+GTEST_TEST(testMobyLCP, testWarmStart) {
+  Eigen::MatrixXd M(3, 3);
+  M << 2, 1, 0,
+       1, 2, 1,
+       0, 1, 2;
+  Eigen::VectorXd q(3);
+  q << -1, -1, 1;
+
+  MobyLCPSolver<double> cold;
+  MobyLCPSolver<double> warm;
+  cold.SetLoggingEnabled(verbose);
+  warm.SetLoggingEnabled(verbose);
+  warm.SetWarmStartingEnabled(true);
+
+  Eigen::VectorXd cold_z, warm_z;
+  ASSERT_TRUE(warm.SolveLcpLemke(M, q, &warm_z));
+  EXPECT_GT(warm.get_num_pivots(), 0);
+
+  // A small change to q leaves the final basis unchanged.
+  q[0] = -1.1;
+  ASSERT_TRUE(cold.SolveLcpLemke(M, q, &cold_z));
+  ASSERT_TRUE(warm.SolveLcpLemke(M, q, &warm_z));
+  EXPECT_EQ(warm.get_num_pivots(), 0);
+  EXPECT_TRUE(CompareMatrices(warm_z, cold_z, epsilon,
+                              MatrixCompareType::absolute));
+
+  // A larger change requires a different basis.
+  q << -1, 1, -1;
+  ASSERT_TRUE(cold.SolveLcpLemke(M, q, &cold_z));
+  ASSERT_TRUE(warm.SolveLcpLemke(M, q, &warm_z));
+  EXPECT_GT(warm.get_num_pivots(), 0);
+  EXPECT_TRUE(CompareMatrices(warm_z, cold_z, epsilon,
+                              MatrixCompareType::absolute));
+
+  // The basis is only reused for problems of the same dimension.
+  const Eigen::MatrixXd M2 = M.topLeftCorner(2, 2);
+  const Eigen::VectorXd q2 = q.head(2);
+  ASSERT_TRUE(warm.SolveLcpLemke(M2, q2, &warm_z));
+  EXPECT_EQ(warm_z.size(), 2);
+
+  // Once cleared, the solver pivots from scratch again.
+  warm.ClearWarmStart();
+  ASSERT_TRUE(warm.SolveLcpLemke(M2, q2, &warm_z));
+  EXPECT_GT(warm.get_num_pivots(), 0);
+}
+
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
@@ -1,5 +1,7 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <limits>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -65,6 +67,89 @@ INSTANTIATE_TEST_SUITE_P(
                        ::testing::ValuesIn(linear_constraint_form()),
                        ::testing::ValuesIn(quadratic_problems())));
 
+// Linear constraints added with a sparse A matrix give the same solution as
+// the same constraints added with a dense A matrix.
+GTEST_TEST(QPtest, TestSparseLinearConstraints) {
+  Eigen::SparseMatrix<double> A(2, 3);
+  A.insert(0, 0) = 1;
+  A.insert(0, 1) = 1;
+  A.insert(1, 1) = 1;
+  A.insert(1, 2) = -1;
+  Eigen::SparseMatrix<double> Aeq(1, 3);
+  Aeq.insert(0, 2) = 2;
+  const Eigen::Vector2d lb(-1, -std::numeric_limits<double>::infinity());
+  const Eigen::Vector2d ub(1, 0);
+
+  auto solve = [&](bool sparse) {
+    MathematicalProgram prog;
+    auto x = prog.NewContinuousVariables<3>();
+    prog.AddQuadraticCost((x(0) - 1) * (x(0) - 1) + (x(1) - 2) * (x(1) - 2) +
+                          x(2) * x(2));
+    if (sparse) {
+      prog.AddLinearConstraint(A, lb, ub, x);
+      prog.AddLinearEqualityConstraint(Aeq, Vector1d(1), x);
+    } else {
+      prog.AddLinearConstraint(Eigen::MatrixXd(A), lb, ub, x);
+      prog.AddLinearEqualityConstraint(Eigen::MatrixXd(Aeq), Vector1d(1), x);
+    }
+    OsqpSolver solver;
+    const MathematicalProgramResult result = solver.Solve(prog, {}, {});
+    EXPECT_TRUE(result.is_success());
+    return Eigen::VectorXd(result.GetSolution(x));
+  };
+  if (OsqpSolver().available()) {
+    EXPECT_TRUE(CompareMatrices(solve(true), solve(false), 1E-10));
+  }
+}
+
+GTEST_TEST(OsqpSolverSessionTest, UpdateCostAndBounds) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  prog.AddQuadraticCost(x(0) * x(0) + x(1) * x(1) + x(0) * x(1));
+  auto linear_cost = prog.AddLinearCost(Eigen::Vector2d(1, -1), x);
+  auto constraint =
+      prog.AddLinearConstraint(Eigen::RowVector2d(1, 1), -1, 1, x);
+  auto bounds = prog.AddBoundingBoxConstraint(-2, 2, x);
+
+  OsqpSolverSession session(&prog);
+  OsqpSolver solver;
+  if (!solver.available()) {
+    return;
+  }
+  const double tol = 1E-5;
+  auto check_against_fresh_solve = [&]() {
+    const MathematicalProgramResult result = session.Solve();
+    const MathematicalProgramResult expected = solver.Solve(prog);
+    ASSERT_TRUE(result.is_success());
+    ASSERT_TRUE(expected.is_success());
+    EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                                expected.GetSolution(x), tol));
+    EXPECT_NEAR(result.get_optimal_cost(), expected.get_optimal_cost(), tol);
+    EXPECT_TRUE(CompareMatrices(result.GetDualSolution(constraint),
+                                expected.GetDualSolution(constraint), tol));
+  };
+  check_against_fresh_solve();
+  EXPECT_EQ(session.num_setups(), 1);
+
+  // Changing the linear cost and the bounds reuses the workspace.
+  linear_cost.evaluator()->UpdateCoefficients(Eigen::Vector2d(-3, 2), 1);
+  check_against_fresh_solve();
+  constraint.evaluator()->UpdateLowerBound(Vector1d(0.5));
+  bounds.evaluator()->UpdateUpperBound(Eigen::Vector2d(0.2, 2));
+  check_against_fresh_solve();
+  // Changing a nonzero coefficient of A keeps the sparsity pattern.
+  constraint.evaluator()->UpdateCoefficients(Eigen::RowVector2d(2, 1),
+                                             Vector1d(0.5), Vector1d(1));
+  check_against_fresh_solve();
+  EXPECT_EQ(session.num_setups(), 1);
+
+  // Adding a constraint changes the size of A, so the workspace is set up
+  // again.
+  prog.AddLinearEqualityConstraint(x(0) - x(1) == 0.1);
+  check_against_fresh_solve();
+  EXPECT_EQ(session.num_setups(), 2);
+}
+
 GTEST_TEST(QPtest, TestUnitBallExample) {
   OsqpSolver solver;
   if (solver.available()) {
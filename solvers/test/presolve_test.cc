@@ -0,0 +1,193 @@
+#include "drake/solvers/presolve.h"
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/solvers/osqp_solver.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+namespace {
+
+using Eigen::Matrix2d;
+using Eigen::Vector2d;
+
+const double kInf = std::numeric_limits<double>::infinity();
+
+// min (x₀ + x₁ − 3)² + 3x₀
+// s.t. x₀ + x₁ ≤ 2
+//      x₀ ≤ 5
+//      x₀ = 1, 0 ≤ x₀ ≤ 2, 0 ≤ x₁ ≤ 10
+// Fixing x₀ = 1 reduces it to min (x₁ − 2)² s.t. 0 ≤ x₁ ≤ 1, whose solution
+// is x₁ = 1. The optimal cost is 4, and the dual solutions (which satisfy
+// ∇f = Σ λᵢ∇gᵢ) are −2 for x₀ + x₁ ≤ 2 and 3 for x₀ = 1.
+class PresolveTest : public ::testing::Test {
+ protected:
+  PresolveTest() {
+    x_ = prog_.NewContinuousVariables<2>("x");
+    Matrix2d Q;
+    Q << 2, 2, 2, 2;
+    prog_.AddQuadraticCost(Q, Vector2d(-6, -6), 9, x_);
+    prog_.AddLinearCost(Vector1d(3), 0, x_.head<1>());
+    Matrix2d A;
+    A << 1, 1, 1, 0;
+    prog_.AddLinearConstraint(A, Vector2d(-kInf, -kInf), Vector2d(2, 5), x_);
+    prog_.AddBoundingBoxConstraint(1, 1, x_(0));
+    prog_.AddBoundingBoxConstraint(Vector2d(0, 0), Vector2d(2, 10), x_);
+  }
+
+  const Binding<LinearConstraint>& linear() const {
+    return prog_.linear_constraints()[0];
+  }
+  const Binding<BoundingBoxConstraint>& fix() const {
+    return prog_.bounding_box_constraints()[0];
+  }
+  const Binding<BoundingBoxConstraint>& bounds() const {
+    return prog_.bounding_box_constraints()[1];
+  }
+
+  MathematicalProgram prog_;
+  Vector2<symbolic::Variable> x_;
+};
+
+TEST_F(PresolveTest, Reduction) {
+  const auto dut = Presolver::Make(prog_);
+  ASSERT_NE(dut, nullptr);
+  const MathematicalProgram& reduced = dut->reduced_program();
+  ASSERT_EQ(reduced.num_vars(), 1);
+  EXPECT_TRUE(reduced.decision_variable(0).equal_to(x_(1)));
+  EXPECT_TRUE(CompareMatrices(
+      dut->ReduceDecisionVariableValues(Vector2d(4, 5)), Vector1d(5)));
+
+  // The cost that only involves x₀ is dropped; the other one is (x₁ − 2)².
+  EXPECT_TRUE(reduced.linear_costs().empty());
+  ASSERT_EQ(reduced.quadratic_costs().size(), 1);
+  const auto& cost = reduced.quadratic_costs()[0];
+  EXPECT_TRUE(CompareMatrices(cost.evaluator()->Q(), Vector1d(2)));
+  EXPECT_TRUE(CompareMatrices(cost.evaluator()->b(), Vector1d(-4)));
+  EXPECT_EQ(cost.evaluator()->c(), 4);
+
+  // The row x₀ ≤ 5 is dropped, and x₀ + x₁ ≤ 2 becomes x₁ ≤ 1.
+  ASSERT_EQ(reduced.linear_constraints().size(), 1);
+  const auto& constraint = reduced.linear_constraints()[0];
+  EXPECT_TRUE(CompareMatrices(constraint.evaluator()->A(), Vector1d(1)));
+  EXPECT_TRUE(CompareMatrices(constraint.evaluator()->upper_bound(),
+                              Vector1d(1)));
+
+  // The bounds are merged.
+  ASSERT_EQ(reduced.bounding_box_constraints().size(), 1);
+  const auto& bounds = reduced.bounding_box_constraints()[0];
+  EXPECT_TRUE(CompareMatrices(bounds.evaluator()->lower_bound(), Vector1d(0)));
+  EXPECT_TRUE(CompareMatrices(bounds.evaluator()->upper_bound(),
+                              Vector1d(10)));
+}
+
+TEST_F(PresolveTest, RecoverResult) {
+  const auto dut = Presolver::Make(prog_);
+  ASSERT_NE(dut, nullptr);
+  const MathematicalProgram& reduced = dut->reduced_program();
+
+  // Mimics what a solver reports for the reduced program.
+  MathematicalProgramResult result;
+  result.set_decision_variable_index(reduced.decision_variable_index());
+  result.set_solution_result(SolutionResult::kSolutionFound);
+  result.set_x_val(Vector1d(1));
+  result.set_optimal_cost(1);
+  result.set_dual_solution(reduced.linear_constraints()[0], Vector1d(-2));
+  result.set_dual_solution(reduced.bounding_box_constraints()[0],
+                           Vector1d(0));
+
+  dut->RecoverResult(&result);
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x_), Vector2d(1, 1)));
+  EXPECT_EQ(result.get_optimal_cost(), 4);
+  EXPECT_TRUE(
+      CompareMatrices(result.GetDualSolution(linear()), Vector2d(-2, 0)));
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(fix()), Vector1d(3)));
+  EXPECT_TRUE(
+      CompareMatrices(result.GetDualSolution(bounds()), Vector2d(0, 0)));
+}
+
+// The suboptimal solutions are mapped back like the solution.
+TEST_F(PresolveTest, RecoverSuboptimalSolutions) {
+  const auto dut = Presolver::Make(prog_);
+  ASSERT_NE(dut, nullptr);
+  MathematicalProgramResult result;
+  result.set_decision_variable_index(
+      dut->reduced_program().decision_variable_index());
+  result.set_x_val(Vector1d(1));
+  result.set_optimal_cost(1);
+  result.AddSuboptimalSolution(4, Vector1d(0));
+  result.AddSuboptimalSolution(2.25, Vector1d(0.5));
+  dut->RecoverResult(&result);
+  ASSERT_EQ(result.num_suboptimal_solution(), 2);
+  EXPECT_TRUE(
+      CompareMatrices(result.GetSuboptimalSolution(x_, 0), Vector2d(1, 0)));
+  EXPECT_EQ(result.get_suboptimal_objective(0), 7);
+  EXPECT_TRUE(
+      CompareMatrices(result.GetSuboptimalSolution(x_, 1), Vector2d(1, 0.5)));
+  EXPECT_EQ(result.get_suboptimal_objective(1), 5.25);
+}
+
+TEST_F(PresolveTest, MissingDualSolution) {
+  const auto dut = Presolver::Make(prog_);
+  ASSERT_NE(dut, nullptr);
+  MathematicalProgramResult result;
+  result.set_decision_variable_index(
+      dut->reduced_program().decision_variable_index());
+  result.set_x_val(Vector1d(1));
+  dut->RecoverResult(&result);
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x_), Vector2d(1, 1)));
+  EXPECT_THROW(result.GetDualSolution(linear()), std::exception);
+}
+
+TEST_F(PresolveTest, Solve) {
+  OsqpSolver solver;
+  if (!solver.available()) {
+    return;
+  }
+  SolverOptions options;
+  options.SetOption(CommonSolverOption::kPresolve, 1);
+  const MathematicalProgramResult result = solver.Solve(prog_, {}, options);
+  ASSERT_TRUE(result.is_success());
+  const double tol = 1e-5;
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x_), Vector2d(1, 1), tol));
+  EXPECT_NEAR(result.get_optimal_cost(), 4, tol);
+  EXPECT_TRUE(
+      CompareMatrices(result.GetDualSolution(linear()), Vector2d(-2, 0), tol));
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(fix()), Vector1d(3), tol));
+}
+
+GTEST_TEST(PresolveMakeTest, NotPresolved) {
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables<2>("x");
+  prog.AddLinearCost(x(0) + x(1));
+  prog.AddBoundingBoxConstraint(0, 1, x);
+  // There is nothing to reduce.
+  EXPECT_EQ(Presolver::Make(prog), nullptr);
+
+  // An empty row that is violated.
+  prog.AddBoundingBoxConstraint(1, 1, x(0));
+  prog.AddLinearEqualityConstraint(x(0) == 2);
+  EXPECT_EQ(Presolver::Make(prog), nullptr);
+
+  // Every variable is fixed.
+  MathematicalProgram fixed_prog;
+  const auto y = fixed_prog.NewContinuousVariables<1>("y");
+  fixed_prog.AddBoundingBoxConstraint(1, 1, y);
+  EXPECT_EQ(Presolver::Make(fixed_prog), nullptr);
+
+  // Unsupported constraints.
+  MathematicalProgram cone_prog;
+  const auto z = cone_prog.NewContinuousVariables<3>("z");
+  cone_prog.AddBoundingBoxConstraint(1, 1, z(0));
+  cone_prog.AddLorentzConeConstraint(z);
+  EXPECT_EQ(Presolver::Make(cone_prog), nullptr);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -1,6 +1,8 @@
 #include "drake/solvers/solve.h"
 
+#include <memory>
 #include <regex>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -56,5 +58,38 @@ GTEST_TEST(SolveTest, TestInitialGuessAndOptions) {
     EXPECT_NEAR(result.GetSolution(x)(0), vars_init(0), 1E-6);
   }
 }
+
+GTEST_TEST(SolveTest, SolveInParallel) {
+  // A batch of independent linear systems, each with a different solution.
+  const int num_progs = 20;
+  std::vector<std::unique_ptr<MathematicalProgram>> prog_storage;
+  std::vector<const MathematicalProgram*> progs;
+  for (int i = 0; i < num_progs; ++i) {
+    prog_storage.push_back(std::make_unique<MathematicalProgram>());
+    auto x = prog_storage.back()->NewContinuousVariables<2>();
+    prog_storage.back()->AddLinearEqualityConstraint(
+        Eigen::Matrix2d::Identity(), Eigen::Vector2d(i, -i), x);
+    progs.push_back(prog_storage.back().get());
+  }
+
+  for (const Parallelism parallelism :
+       {Parallelism::None(), Parallelism(4)}) {
+    const std::vector<MathematicalProgramResult> results =
+        SolveInParallel(progs, nullptr, nullptr, std::nullopt, parallelism);
+    ASSERT_EQ(results.size(), progs.size());
+    for (int i = 0; i < num_progs; ++i) {
+      EXPECT_TRUE(results[i].is_success());
+      EXPECT_EQ(results[i].get_solver_id(), LinearSystemSolver::id());
+      EXPECT_TRUE(CompareMatrices(results[i].get_x_val(),
+                                  Eigen::Vector2d(i, -i), 1E-12));
+    }
+  }
+
+  // Mismatched sizes are rejected.
+  const std::vector<const Eigen::VectorXd*> initial_guesses(num_progs - 1);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SolveInParallel(progs, &initial_guesses),
+      ".*20 programs but 19 initial guesses.*");
+}
 }  // namespace solvers
 }  // namespace drake
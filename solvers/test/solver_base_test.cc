@@ -1,5 +1,7 @@
 #include "drake/solvers/solver_base.h"
 
+#include <cmath>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -195,6 +197,29 @@ GTEST_TEST(SolverBaseTest, InitialGuessSizeError) {
                               "Solve expects initial guess of size 2, got 3.");
 }
 
+GTEST_TEST(SolverBaseTest, Presolve) {
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables<2>();
+  prog.AddLinearCost(x(0) + x(1));
+  prog.AddBoundingBoxConstraint(1, 1, x(0));
+  prog.AddBoundingBoxConstraint(0, 1, x(1));
+  StubSolverBase dut;
+  SolverOptions options;
+  options.SetOption(StubSolverBase::id(), "x0_solution", 0.5);
+
+  // Without presolve, the solver sees both variables.
+  MathematicalProgramResult result = dut.Solve(prog, {}, options);
+  EXPECT_EQ(result.GetSolution(x(0)), 0.5);
+  EXPECT_TRUE(std::isnan(result.GetSolution(x(1))));
+
+  // With presolve, the solver only sees x(1), and the fixed x(0) is
+  // restored.
+  options.SetOption(CommonSolverOption::kPresolve, 1);
+  result = dut.Solve(prog, {}, options);
+  EXPECT_EQ(result.GetSolution(x(0)), 1);
+  EXPECT_EQ(result.GetSolution(x(1)), 0.5);
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace solvers
@@ -147,6 +147,18 @@ GTEST_TEST(SolverOptionsTest, SetOptionError) {
   DRAKE_EXPECT_THROWS_MESSAGE(
       solver_options.SetOption(CommonSolverOption::kPrintToConsole, 2),
       "kPrintToConsole expects value either 0 or 1");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      solver_options.SetOption(CommonSolverOption::kPresolve, 2),
+      "kPresolve expects value either 0 or 1");
+}
+
+GTEST_TEST(SolverOptionsTest, Presolve) {
+  SolverOptions dut;
+  EXPECT_FALSE(dut.get_presolve());
+  dut.SetOption(CommonSolverOption::kPresolve, 1);
+  EXPECT_TRUE(dut.get_presolve());
+  dut.SetOption(CommonSolverOption::kPresolve, 0);
+  EXPECT_FALSE(dut.get_presolve());
 }
 }  // namespace solvers
 }  // namespace drake
@@ -3,9 +3,12 @@
 #include "drake/solvers/mathematical_program.h"
 /* clang-format on */
 
+#include <unordered_map>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/symbolic.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/symbolic_test_util.h"
 #include "drake/solvers/solve.h"
 
@@ -302,6 +305,53 @@ TEST_F(SosConstraintTest, AddSosConstraintMultivariate2) {
   CheckPositiveDefiniteMatrix(Q, m, e);
 }
 
+// The coefficient-matching constraints do not depend on the parallelism used
+// to set them up.
+TEST_F(SosConstraintTest, AddSosConstraintParallel) {
+  const auto& x0 = x_(0);
+  const auto& x1 = x_(1);
+  const auto& x2 = x_(2);
+  const auto& c = c_(0);
+  prog_.AddCost(-c);
+  const symbolic::Polynomial p(
+      pow(x0, 4) + 2 * x0 * x0 * x1 * x1 + pow(x1, 4) + x0 * x2 + 3 * x2 * x2 -
+          c * x0 * x1 + 2 - c,
+      Variables(x_));
+  const VectorX<Monomial> basis = symbolic::MonomialBasis(Variables(x_), 2);
+
+  const MatrixXDecisionVariable Q_serial = prog_.AddSosConstraint(p, basis);
+  const int num_serial = prog_.linear_equality_constraints().size();
+  prog_.set_sos_parallelism(Parallelism(4));
+  const MatrixXDecisionVariable Q_parallel = prog_.AddSosConstraint(p, basis);
+  ASSERT_EQ(prog_.linear_equality_constraints().size(), 2 * num_serial);
+
+  // Maps the Gram matrix entries of the serial call onto the parallel call.
+  std::unordered_map<Variable::Id, Variable> serial_to_parallel;
+  for (int i = 0; i < Q_serial.rows(); ++i) {
+    for (int j = 0; j < Q_serial.cols(); ++j) {
+      serial_to_parallel.emplace(Q_serial(i, j).get_id(), Q_parallel(i, j));
+    }
+  }
+  serial_to_parallel.emplace(c.get_id(), c);
+  for (int k = 0; k < num_serial; ++k) {
+    const auto& serial = prog_.linear_equality_constraints()[k];
+    const auto& parallel = prog_.linear_equality_constraints()[num_serial + k];
+    EXPECT_TRUE(CompareMatrices(serial.evaluator()->A(),
+                                parallel.evaluator()->A()));
+    EXPECT_TRUE(CompareMatrices(serial.evaluator()->lower_bound(),
+                                parallel.evaluator()->lower_bound()));
+    ASSERT_EQ(serial.variables().rows(), parallel.variables().rows());
+    for (int l = 0; l < serial.variables().rows(); ++l) {
+      EXPECT_TRUE(serial_to_parallel.at(serial.variables()(l).get_id())
+                      .equal_to(parallel.variables()(l)));
+    }
+  }
+
+  result_ = Solve(prog_);
+  ASSERT_TRUE(result_.is_success());
+  CheckPositiveDefiniteMatrix(Q_parallel, basis, p.ToExpression());
+}
+
 TEST_F(SosConstraintTest, SynthesizeLyapunovFunction) {
   // Find the Lyapunov function V(x) for system:
   //
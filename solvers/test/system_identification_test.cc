@@ -326,6 +326,52 @@ GTEST_TEST(SystemIdentificationTest, SpringMassIdentification) {
   EXPECT_NEAR(estimated_params[spring_var], kSpring, kNoise);
 }
 
+// Estimating parameters from many samples gives the same answer on any number
+// of threads.
+GTEST_TEST(SystemIdentificationTest, ParallelEstimateParameters) {
+  const Polynomiald x = Polynomiald("x");
+  const auto x_var = x.GetSimpleVariable();
+  const Polynomiald y = Polynomiald("y");
+  const auto y_var = y.GetSimpleVariable();
+  const Polynomiald z = Polynomiald("z");
+  const auto z_var = z.GetSimpleVariable();
+  const Polynomiald a = Polynomiald("a");
+  const auto a_var = a.GetSimpleVariable();
+  const Polynomiald b = Polynomiald("b");
+  const auto b_var = b.GetSimpleVariable();
+  const Polynomiald c = Polynomiald("c");
+  const auto c_var = c.GetSimpleVariable();
+  const Polynomiald poly = (a * x) + (b * x * x) + (c * y) - z;
+
+  std::mt19937 generator;
+  generator.seed(kNoiseSeed);
+  std::uniform_real_distribution<double> uniform(-2, 2);
+  std::normal_distribution<double> noise(0, kNoise);
+  std::vector<SID::PartialEvalType> sample_points;
+  for (int i = 0; i < 5000; ++i) {
+    const double x_value = uniform(generator);
+    const double y_value = uniform(generator);
+    const double z_value = 1.5 * x_value - 0.5 * x_value * x_value +
+                           2.0 * y_value + noise(generator);
+    sample_points.push_back({{x_var, x_value}, {y_var, y_value},
+                             {z_var, z_value}});
+  }
+
+  const auto [serial_params, serial_error] = SID::EstimateParameters(
+      VectorXPoly::Constant(1, poly), sample_points);
+  EXPECT_NEAR(serial_error, kNoise, 0.1 * kNoise);
+  EXPECT_NEAR(serial_params.at(a_var), 1.5, 10 * kNoise);
+  EXPECT_NEAR(serial_params.at(b_var), -0.5, 10 * kNoise);
+  EXPECT_NEAR(serial_params.at(c_var), 2.0, 10 * kNoise);
+
+  const auto [parallel_params, parallel_error] = SID::EstimateParameters(
+      VectorXPoly::Constant(1, poly), sample_points, Parallelism(4));
+  EXPECT_NEAR(parallel_error, serial_error, 1e-12);
+  for (const auto& var : {a_var, b_var, c_var}) {
+    EXPECT_NEAR(parallel_params.at(var), serial_params.at(var), 1e-12);
+  }
+}
+
 GTEST_TEST(SystemIdentificationTest, PendulaIdentification) {
   // Simulate two pendula that swing independently but are actuated with the
   // same torque.  The pendula have lengths l1 = 1, l2 = 2; their masses m1
@@ -0,0 +1,178 @@
+#include "drake/systems/analysis/co_simulator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/nice_type_name.h"
+
+namespace drake {
+namespace systems {
+
+CoSimulator::CoSimulator(double sync_period, Parallelism parallelism)
+    : sync_period_(sync_period), parallelism_(parallelism) {
+  DRAKE_THROW_UNLESS(std::isfinite(sync_period) && sync_period > 0);
+}
+
+CoSimulator::~CoSimulator() = default;
+
+const System<double>& CoSimulator::AddPartition(
+    std::unique_ptr<System<double>> system) {
+  DRAKE_THROW_UNLESS(system != nullptr);
+  DRAKE_THROW_UNLESS(!initialized_);
+  Partition partition;
+  partition.system = std::move(system);
+  partition.simulator =
+      std::make_unique<Simulator<double>>(*partition.system);
+  partitions_.push_back(std::move(partition));
+  return *partitions_.back().system;
+}
+
+int CoSimulator::FindPartition(const SystemBase& system) const {
+  for (int i = 0; i < num_partitions(); ++i) {
+    if (partitions_[i].system.get() == &system) {
+      return i;
+    }
+  }
+  throw std::logic_error(fmt::format(
+      "CoSimulator: the system '{}' is not one of the partitions",
+      system.GetSystemPathname()));
+}
+
+void CoSimulator::Connect(const OutputPort<double>& output,
+                          const InputPort<double>& input) {
+  DRAKE_THROW_UNLESS(!initialized_);
+  const int output_partition = FindPartition(output.get_system());
+  const int input_partition = FindPartition(input.get_system());
+  if (output_partition == input_partition) {
+    throw std::logic_error(fmt::format(
+        "CoSimulator::Connect(): {} and {} belong to the same partition; "
+        "connect them with a DiagramBuilder instead",
+        output.GetFullDescription(), input.GetFullDescription()));
+  }
+  for (const Connection& connection : connections_) {
+    if (connection.input == &input) {
+      throw std::logic_error(fmt::format(
+          "CoSimulator::Connect(): {} is already connected",
+          input.GetFullDescription()));
+    }
+  }
+  std::unique_ptr<AbstractValue> sample = output.Allocate();
+  const std::unique_ptr<AbstractValue> model =
+      input.get_system().AllocateInputAbstract(input);
+  if (output.get_data_type() != input.get_data_type() ||
+      output.size() != input.size() ||
+      (input.get_data_type() == kAbstractValued &&
+       sample->static_type_info() != model->static_type_info())) {
+    throw std::logic_error(fmt::format(
+        "CoSimulator::Connect(): the types of {} and {} do not match",
+        output.GetFullDescription(), input.GetFullDescription()));
+  }
+
+  Context<double>& input_context =
+      partitions_[input_partition].simulator->get_mutable_context();
+  Connection connection;
+  connection.output = &output;
+  connection.output_partition = output_partition;
+  connection.input = &input;
+  connection.input_value = &input.FixValue(&input_context, *sample);
+  connection.sample = std::move(sample);
+  connections_.push_back(std::move(connection));
+}
+
+void CoSimulator::Exchange() {
+  // Sample every output before changing any input, so that the result does
+  // not depend on the order of the connections.
+  for (Connection& connection : connections_) {
+    const Context<double>& context =
+        partitions_[connection.output_partition].simulator->get_context();
+    if (connection.output->get_data_type() == kVectorValued) {
+      connection.sample->get_mutable_value<BasicVector<double>>().SetFrom(
+          connection.output->Eval<BasicVector<double>>(context));
+    } else {
+      connection.sample->SetFrom(
+          connection.output->Eval<AbstractValue>(context));
+    }
+  }
+  for (Connection& connection : connections_) {
+    if (connection.output->get_data_type() == kVectorValued) {
+      connection.input_value->GetMutableVectorData<double>()->SetFrom(
+          connection.sample->get_value<BasicVector<double>>());
+    } else {
+      connection.input_value->GetMutableData()->SetFrom(*connection.sample);
+    }
+  }
+}
+
+void CoSimulator::Initialize() {
+  DRAKE_THROW_UNLESS(!initialized_);
+  start_time_ = partitions_.empty()
+                    ? 0.0
+                    : partitions_.front().simulator->get_context().get_time();
+  for (const Partition& partition : partitions_) {
+    if (partition.simulator->get_context().get_time() != start_time_) {
+      throw std::logic_error(fmt::format(
+          "CoSimulator::Initialize(): all partitions must start at the same "
+          "time, but '{}' starts at {} instead of {}",
+          partition.system->GetSystemPathname(),
+          partition.simulator->get_context().get_time(), start_time_));
+    }
+  }
+  time_ = start_time_;
+  num_windows_ = 0;
+  // An output sampled at the initial time may depend (through direct
+  // feedthrough) on a connected input that has not been sampled yet, so we
+  // repeat the exchange once per connection; that's enough to propagate the
+  // initial values along any chain of connections that doesn't form a loop.
+  for (int i = 0; i < std::max<int>(1, connections_.size()); ++i) {
+    Exchange();
+  }
+  StaticParallelForIndexLoop(parallelism_, 0, num_partitions(),
+                             [this](int, int i) {
+                               partitions_[i].simulator->Initialize();
+                             });
+  initialized_ = true;
+}
+
+void CoSimulator::AdvanceTo(double boundary_time) {
+  if (!initialized_) {
+    Initialize();
+  }
+  DRAKE_THROW_UNLESS(boundary_time >= time_);
+  while (time_ < boundary_time) {
+    // The synchronization points are computed from the window count (rather
+    // than accumulated) so that they don't drift.
+    const double next_sync =
+        start_time_ + static_cast<double>(num_windows_ + 1) * sync_period_;
+    const double target = std::min(next_sync, boundary_time);
+    StaticParallelForIndexLoop(parallelism_, 0, num_partitions(),
+                               [this, target](int, int i) {
+                                 partitions_[i].simulator->AdvanceTo(target);
+                               });
+    time_ = target;
+    if (target == next_sync) {
+      ++num_windows_;
+      Exchange();
+    }
+  }
+}
+
+double CoSimulator::get_time() const {
+  return time_;
+}
+
+const Simulator<double>& CoSimulator::get_simulator(
+    const System<double>& partition) const {
+  return *partitions_[FindPartition(partition)].simulator;
+}
+
+Simulator<double>& CoSimulator::get_mutable_simulator(
+    const System<double>& partition) {
+  return *partitions_[FindPartition(partition)].simulator;
+}
+
+}  // namespace systems
+}  // namespace drake
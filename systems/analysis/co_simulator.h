@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/system.h"
+
+namespace drake {
+namespace systems {
+
+/** Simulates several loosely coupled systems ("partitions") concurrently, each
+with its own Simulator on its own thread, exchanging data between them only at
+fixed synchronization points.
+
+Multi-rate models (e.g., a 1 kHz plant, a 200 Hz controller, and 30 Hz
+perception) are typically coupled only through rate transitions such as a
+ZeroOrderHold. When such a model is split at those transitions into separate
+partitions (each a System, usually a Diagram), and they are connected here
+instead of with a DiagramBuilder, the partitions can advance in parallel:
+
+@code
+CoSimulator cosim(0.005);  // Exchange data every 5 ms.
+const System<double>& plant = cosim.AddPartition(std::move(plant_diagram));
+const System<double>& controller =
+    cosim.AddPartition(std::move(controller_diagram));
+cosim.Connect(plant.GetOutputPort("state"),
+              controller.GetInputPort("estimated_state"));
+cosim.Connect(controller.GetOutputPort("torque"),
+              plant.GetInputPort("actuation"));
+cosim.AdvanceTo(10.0);
+@endcode
+
+<h3>Semantics</h3>
+
+Time is divided into windows of length `sync_period`, starting from the
+partitions' initial time t₀. At the start of each window
+tₖ = t₀ + k⋅sync_period, the value of every connected output port is sampled
+(all of the outputs are sampled before any input changes) and then held on the
+connected input port for the whole window [tₖ, tₖ₊₁), exactly as if a
+ZeroOrderHold with period `sync_period` had been placed on the connection.
+(At the initial time, the exchange is repeated until the initial values have
+propagated along every chain of connections through partitions with direct
+feedthrough; chains that form a loop are only repeated once per connection.)
+Then all of the partitions' simulators advance to tₖ₊₁ concurrently. Because
+data only crosses between partitions at these points, and always in the same
+order, the results do not depend on thread scheduling or on the parallelism;
+they are identical to those of a serial execution.
+
+Only the top-level ports of a partition can be connected; a connected input
+port is always an input port that the partition exports. Input ports that are
+not connected may be fixed by the user, in the Context of the partition's
+simulator, before the first call to AdvanceTo(); connected input ports must not
+be fixed by the user. Each simulator may likewise be
+configured (integrator, accuracy, etc.) before then.
+
+@ingroup simulation */
+class CoSimulator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CoSimulator)
+
+  /** Constructs a co-simulation without any partitions.
+  @param sync_period The time between the exchanges of data.
+  @param parallelism The maximum number of threads used to advance the
+    partitions.
+  @throws std::exception if `sync_period` is not positive and finite. */
+  explicit CoSimulator(double sync_period,
+                       Parallelism parallelism = Parallelism::Max());
+
+  ~CoSimulator();
+
+  /** Adds a partition, along with a Simulator and a default Context for it,
+  and returns a reference to it.
+  @throws std::exception if the co-simulation has already been initialized. */
+  const System<double>& AddPartition(std::unique_ptr<System<double>> system);
+
+  /** Connects the `output` port of one partition to the `input` port of a
+  different partition, through a sample-and-hold at the synchronization
+  points. An output port may be connected to many input ports.
+  @throws std::exception if either port does not belong to (the top level of)
+    a partition, if both ports belong to the same partition, if the input port
+    is already connected, if the ports' data types or sizes differ, or if the
+    co-simulation has already been initialized. */
+  void Connect(const OutputPort<double>& output,
+               const InputPort<double>& input);
+
+  /** Samples the connected outputs at the initial time, and initializes all of
+  the partitions' simulators. Calling this is optional; AdvanceTo() calls it
+  if needed.
+  @throws std::exception if the partitions' contexts do not all have the same
+    time, or if already initialized. */
+  void Initialize();
+
+  /** Advances all of the partitions to `boundary_time`, exchanging data at
+  every synchronization point along the way. The `boundary_time` need not be
+  a synchronization point.
+  @throws std::exception if `boundary_time` is earlier than get_time(). */
+  void AdvanceTo(double boundary_time);
+
+  /** Returns the time that all of the partitions have been advanced to. */
+  double get_time() const;
+
+  double sync_period() const { return sync_period_; }
+
+  int num_partitions() const { return static_cast<int>(partitions_.size()); }
+
+  /** Returns the simulator for the given `partition`.
+  @throws std::exception if `partition` was not added to this. */
+  const Simulator<double>& get_simulator(
+      const System<double>& partition) const;
+
+  /** Returns the simulator for the given `partition`.
+  @throws std::exception if `partition` was not added to this. */
+  Simulator<double>& get_mutable_simulator(const System<double>& partition);
+
+ private:
+  struct Partition {
+    std::unique_ptr<System<double>> system;
+    std::unique_ptr<Simulator<double>> simulator;
+  };
+
+  struct Connection {
+    const OutputPort<double>* output{};
+    int output_partition{};
+    const InputPort<double>* input{};
+    // The value sampled from the output at the last synchronization point.
+    std::unique_ptr<AbstractValue> sample;
+    // The value of the input port, in its partition's context.
+    FixedInputPortValue* input_value{};
+  };
+
+  // Returns the index of the partition that is `system`, or throws.
+  int FindPartition(const SystemBase& system) const;
+
+  // Samples all connected outputs and then updates all connected inputs.
+  void Exchange();
+
+  const double sync_period_;
+  const Parallelism parallelism_;
+  std::vector<Partition> partitions_;
+  std::vector<Connection> connections_;
+
+  bool initialized_{false};
+  double start_time_{};
+  double time_{};
+  // The number of synchronization windows that have been completed.
+  int64_t num_windows_{0};
+};
+
+}  // namespace systems
+}  // namespace drake
@@ -1,7 +1,11 @@
 #include "drake/systems/analysis/implicit_integrator.h"
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
@@ -11,6 +15,68 @@
 namespace drake {
 namespace systems {
 
+namespace {
+
+// Computes a good increment for numerically differentiating with respect to a
+// state variable with value `xi`, using a relative step of `eps`: if |xi| is
+// large, the increment will be large as well; if |xi| is small, the increment
+// will be no smaller than eps.
+template <class T>
+T CalcDifferencingIncrement(const T& xi, double eps) {
+  using std::abs;
+  const T abs_xi = abs(xi);
+  return (abs_xi <= 1) ? T(eps) : T(eps * abs_xi);
+}
+
+}  // namespace
+
+template <class T>
+void ImplicitIntegrator<T>::set_jacobian_sparsity_pattern(
+    std::optional<Eigen::SparseMatrix<double>> pattern) {
+  jacobian_color_columns_.clear();
+  if (pattern.has_value()) {
+    if (pattern->rows() != pattern->cols()) {
+      throw std::logic_error(fmt::format(
+          "ImplicitIntegrator::set_jacobian_sparsity_pattern(): the pattern "
+          "must be square, but it is {} × {}",
+          pattern->rows(), pattern->cols()));
+    }
+    pattern->makeCompressed();
+
+    // Greedily color the columns (in order), giving each column the smallest
+    // color not used by any earlier column that shares a nonzero row with it.
+    const int n = pattern->cols();
+    const Eigen::SparseMatrix<double, Eigen::RowMajor> rows = *pattern;
+    std::vector<int> color(n, -1);
+    // forbidden[c] == j marks color c as unavailable for column j.
+    std::vector<int> forbidden;
+    for (int j = 0; j < n; ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator col_it(*pattern, j);
+           col_it; ++col_it) {
+        for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator
+                 row_it(rows, col_it.row());
+             row_it; ++row_it) {
+          const int c = color[row_it.col()];
+          if (c >= 0) forbidden[c] = j;
+        }
+      }
+      int c = 0;
+      while (c < static_cast<int>(forbidden.size()) && forbidden[c] == j) ++c;
+      if (c == static_cast<int>(forbidden.size())) {
+        forbidden.push_back(-1);
+        jacobian_color_columns_.emplace_back();
+      }
+      color[j] = c;
+      jacobian_color_columns_[c].push_back(j);
+    }
+  }
+  jacobian_sparsity_ = std::move(pattern);
+
+  // Reset the Jacobian and any matrices cached by child integrators.
+  J_.resize(0, 0);
+  DoResetCachedJacobianRelatedMatrices();
+}
+
 template <class T>
 void ImplicitIntegrator<T>::DoResetStatistics() {
   num_iter_factorizations_ = 0;
@@ -39,9 +105,19 @@ void ImplicitIntegrator<T>::ComputeAutoDiffJacobian(
   VectorX<AutoDiffXd> a_xt = xt;
 
   // Set the size of the derivatives and prepare for Jacobian calculation.
+  // With a sparsity pattern, all of the columns with the same color share a
+  // partial derivative.
   const int n_state_dim = a_xt.size();
-  for (int i = 0; i < n_state_dim; ++i)
-    a_xt[i].derivatives() = VectorX<T>::Unit(n_state_dim, i);
+  if (jacobian_sparsity_.has_value()) {
+    const int num_colors = jacobian_color_columns_.size();
+    for (int c = 0; c < num_colors; ++c) {
+      for (int i : jacobian_color_columns_[c])
+        a_xt[i].derivatives() = VectorX<T>::Unit(num_colors, c);
+    }
+  } else {
+    for (int i = 0; i < n_state_dim; ++i)
+      a_xt[i].derivatives() = VectorX<T>::Unit(n_state_dim, i);
+  }
 
   // Get the system and the context in AutoDiffable format. Inputs must also
   // be copied to the context used by the AutoDiff'd system (which is
@@ -66,6 +142,21 @@ void ImplicitIntegrator<T>::ComputeAutoDiffJacobian(
 
   *J = math::ExtractGradient(result);
 
+  // Scatter the compressed columns into the full Jacobian.
+  if (jacobian_sparsity_.has_value() && J->cols() > 0) {
+    const MatrixX<T> compressed = std::move(*J);
+    *J = MatrixX<T>::Zero(n_state_dim, n_state_dim);
+    for (int c = 0; c < static_cast<int>(jacobian_color_columns_.size());
+         ++c) {
+      for (int i : jacobian_color_columns_[c]) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(
+                 *jacobian_sparsity_, i); it; ++it) {
+          (*J)(it.row(), i) = compressed(it.row(), c);
+        }
+      }
+    }
+  }
+
   // Sometimes the system's derivatives f(t, x) do not depend on its states, for
   // example, when f(t, x) = constant or when f(t, x) depends only on t. In this
   // case, make sure that the Jacobian isn't a n ✕ 0 matrix (this will cause a
@@ -207,9 +298,108 @@ void ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
   }
 }
 
+template <class T>
+void ImplicitIntegrator<T>::ComputeColoredDiffJacobian(
+    const T& t, const VectorX<T>& xt, bool central, Context<T>* context,
+    MatrixX<T>* J) {
+  // See ComputeForwardDiffJacobian() and ComputeCentralDiffJacobian() for the
+  // choice of increments.
+  const double eps =
+      central ? std::pow(std::numeric_limits<double>::epsilon(), 5.0/12)
+              : std::sqrt(std::numeric_limits<double>::epsilon());
+  const int n = context->num_continuous_states();
+  const Eigen::SparseMatrix<double>& pattern = *jacobian_sparsity_;
+
+  DRAKE_LOGGER_DEBUG(
+      "  ImplicitIntegrator Compute Colored {}diff {}-Jacobian ({} colors) "
+      "t={}", central ? "Central" : "Forward", n,
+      jacobian_color_columns_.size(), t);
+
+  *J = MatrixX<T>::Zero(n, n);
+
+  // Evaluate f(t,xt), which is only needed for forward differences.
+  context->SetTimeAndContinuousState(t, xt);
+  VectorX<T> f;
+  if (!central) f = this->EvalTimeDerivatives(*context).CopyToVector();
+
+  // The (exactly representable) increments to each column of the current
+  // color, in the positive and negative directions.
+  VectorX<T> xt_prime = xt;
+  VectorX<T> dx_plus(n), dx_minus(n);
+  for (const std::vector<int>& columns : jacobian_color_columns_) {
+    // Compute f(x+dx), for the perturbation dx of all of these columns.
+    for (int i : columns) {
+      xt_prime(i) = xt(i) + CalcDifferencingIncrement(xt(i), eps);
+      dx_plus(i) = xt_prime(i) - xt(i);
+    }
+    context->SetContinuousState(xt_prime);
+    const VectorX<T> fprime_plus =
+        this->EvalTimeDerivatives(*context).CopyToVector();
+
+    // Compute f(x-dx), for central differences.
+    VectorX<T> fprime_minus;
+    if (central) {
+      for (int i : columns) {
+        xt_prime(i) = xt(i) - CalcDifferencingIncrement(xt(i), eps);
+        dx_minus(i) = xt(i) - xt_prime(i);
+      }
+      context->SetContinuousState(xt_prime);
+      fprime_minus = this->EvalTimeDerivatives(*context).CopyToVector();
+    }
+
+    // Since the columns share no nonzero rows, each row of the differences
+    // belongs to (at most) one of them.
+    for (int i : columns) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(pattern, i); it;
+           ++it) {
+        const int r = it.row();
+        (*J)(r, i) = central
+            ? T((fprime_plus(r) - fprime_minus(r)) / (dx_plus(i) + dx_minus(i)))
+            : T((fprime_plus(r) - f(r)) / dx_plus(i));
+      }
+      xt_prime(i) = xt(i);
+    }
+  }
+}
+
 template <class T>
 void ImplicitIntegrator<T>::IterationMatrix::SetAndFactorIterationMatrix(
     const MatrixX<T>& iteration_matrix) {
+  sparse_matrix_factored_ = false;
+  if (use_sparse_factorization_) {
+    Eigen::SparseMatrix<double> sparse_matrix = iteration_matrix.sparseView();
+    sparse_matrix.makeCompressed();
+
+    // The symbolic analysis only depends on the pattern, so it only needs to
+    // be redone when that changes.
+    const bool same_pattern =
+        sparse_LU_ != nullptr &&
+        sparse_matrix.rows() == sparse_matrix_.rows() &&
+        sparse_matrix.nonZeros() == sparse_matrix_.nonZeros() &&
+        std::equal(sparse_matrix.outerIndexPtr(),
+                   sparse_matrix.outerIndexPtr() + sparse_matrix.cols() + 1,
+                   sparse_matrix_.outerIndexPtr()) &&
+        std::equal(sparse_matrix.innerIndexPtr(),
+                   sparse_matrix.innerIndexPtr() + sparse_matrix.nonZeros(),
+                   sparse_matrix_.innerIndexPtr());
+    sparse_matrix_ = std::move(sparse_matrix);
+    if (!same_pattern) {
+      sparse_LU_ =
+          std::make_unique<Eigen::SparseLU<Eigen::SparseMatrix<double>>>();
+      sparse_LU_->analyzePattern(sparse_matrix_);
+    }
+    sparse_LU_->factorize(sparse_matrix_);
+
+    // If the sparse factorization fails (e.g., because the matrix is
+    // singular), fall back to the dense one, which always "succeeds".
+    if (sparse_LU_->info() == Eigen::Success) {
+      sparse_matrix_factored_ = true;
+      matrix_factored_ = true;
+      return;
+    }
+    DRAKE_LOGGER_DEBUG("Sparse iteration matrix factorization failed: {}",
+                       sparse_LU_->lastErrorMessage());
+  }
   LU_.compute(iteration_matrix);
   matrix_factored_ = true;
 }
@@ -217,6 +407,9 @@ void ImplicitIntegrator<T>::IterationMatrix::SetAndFactorIterationMatrix(
 template <class T>
 VectorX<T> ImplicitIntegrator<T>::IterationMatrix::Solve(
     const VectorX<T>& b) const {
+  if (sparse_matrix_factored_) {
+    return sparse_LU_->solve(b);
+  }
   return LU_.solve(b);
 }
 
@@ -300,15 +493,33 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
   // Get a the system.
   const System<T>& system = this->get_system();
 
+  if (jacobian_sparsity_.has_value() &&
+      jacobian_sparsity_->rows() != x.size()) {
+    throw std::logic_error(fmt::format(
+        "ImplicitIntegrator: the Jacobian sparsity pattern is {} × {}, but "
+        "the system has {} continuous state variables",
+        jacobian_sparsity_->rows(), jacobian_sparsity_->cols(), x.size()));
+  }
+
   // TODO(edrumwri): Give the caller the option to provide their own Jacobian.
   [this, context, &system, &t, &x]() {
     switch (jacobian_scheme_) {
       case JacobianComputationScheme::kForwardDifference:
-        ComputeForwardDiffJacobian(system, t, x, &*context, &J_);
+        if (jacobian_sparsity_.has_value()) {
+          ComputeColoredDiffJacobian(t, x, false /* central */, &*context,
+                                     &J_);
+        } else {
+          ComputeForwardDiffJacobian(system, t, x, &*context, &J_);
+        }
         break;
 
       case JacobianComputationScheme::kCentralDifference:
-        ComputeCentralDiffJacobian(system, t, x, &*context, &J_);
+        if (jacobian_sparsity_.has_value()) {
+          ComputeColoredDiffJacobian(t, x, true /* central */, &*context,
+                                     &J_);
+        } else {
+          ComputeCentralDiffJacobian(system, t, x, &*context, &J_);
+        }
         break;
 
       case JacobianComputationScheme::kAutomatic:
@@ -332,6 +543,19 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
   return J_;
 }
 
+template <class T>
+void ImplicitIntegrator<T>::ComputeAndFactorIterationMatrix(
+    const MatrixX<T>& J, const T& h,
+    const std::function<void(const MatrixX<T>&, const T&,
+        typename ImplicitIntegrator<T>::IterationMatrix*)>&
+        compute_and_factor_iteration_matrix,
+    typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
+  ++num_iter_factorizations_;
+  iteration_matrix->set_use_sparse_factorization(
+      jacobian_sparsity_.has_value());
+  compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+}
+
 template <class T>
 void ImplicitIntegrator<T>::FreshenMatricesIfFullNewton(
     const T& t, const VectorX<T>& xt, const T& h,
@@ -347,8 +571,8 @@ void ImplicitIntegrator<T>::FreshenMatricesIfFullNewton(
   // Compute the initial Jacobian and iteration matrices and factor them.
   MatrixX<T>& J = get_mutable_jacobian();
   J = CalcJacobian(t, xt);
-  ++num_iter_factorizations_;
-  compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+  ComputeAndFactorIterationMatrix(J, h, compute_and_factor_iteration_matrix,
+                                  iteration_matrix);
 }
 
 template <class T>
@@ -363,8 +587,8 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
   MatrixX<T>& J = get_mutable_jacobian();
   if (!get_reuse() || J.rows() == 0 || IsBadJacobian(J)) {
     J = CalcJacobian(t, xt);
-    ++num_iter_factorizations_;
-    compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+    ComputeAndFactorIterationMatrix(J, h, compute_and_factor_iteration_matrix,
+                                    iteration_matrix);
     return true;  // Indicate success.
   }
 
@@ -381,8 +605,8 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
   // implicit Trapezoid iteration matrix is not factorized, and so this block
   // of code will factorize it.
   if (!iteration_matrix->matrix_factored()) {
-    ++num_iter_factorizations_;
-    compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+    ComputeAndFactorIterationMatrix(J, h, compute_and_factor_iteration_matrix,
+                                    iteration_matrix);
     return true;  // Indicate success.
   }
 
@@ -416,8 +640,8 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
       // which requires the same iteration matrix (so the matrix is correct
       // and does not actually need recomputation).
       // In both cases, the right thing to do would be to skip to trial 3.
-      ++num_iter_factorizations_;
-      compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+      ComputeAndFactorIterationMatrix(J, h, compute_and_factor_iteration_matrix,
+                                      iteration_matrix);
       return true;
     }
 
@@ -435,8 +659,8 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
       // Otherwise, we can reform the Jacobian matrix and refactor the
       // iteration matrix.
       J = CalcJacobian(t, xt);
-      ++num_iter_factorizations_;
-      compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+      ComputeAndFactorIterationMatrix(J, h, compute_and_factor_iteration_matrix,
+                                      iteration_matrix);
       return true;
 
       case 4: {
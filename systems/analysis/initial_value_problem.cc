@@ -1,6 +1,10 @@
 #include "drake/systems/analysis/initial_value_problem.h"
 
+#include <algorithm>
 #include <stdexcept>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include "drake/systems/analysis/hermitian_dense_output.h"
 #include "drake/systems/analysis/runge_kutta3_integrator.h"
@@ -124,8 +128,11 @@ InitialValueProblem<T>::InitialValueProblem(const OdeFunction& ode_function,
   context_->SetTime(default_values_.t0.value());
 
   // Instantiates an explicit RK3 integrator by default.
-  integrator_ =
-      std::make_unique<RungeKutta3Integrator<T>>(*system_, context_.get());
+  integrator_factory_ = [](const System<T>& system) {
+    return std::make_unique<RungeKutta3Integrator<T>>(system);
+  };
+  integrator_ = integrator_factory_(*system_);
+  integrator_->reset_context(context_.get());
 
   // Sets step size and accuracy defaults.
   integrator_->request_initial_step_size_target(
@@ -278,8 +285,11 @@ InitialValueProblem<T>::InitialValueProblem(
   context_ = system_->CreateDefaultContext();
 
   // Instantiates an explicit RK3 integrator by default.
-  integrator_ =
-      std::make_unique<RungeKutta3Integrator<T>>(*system_, context_.get());
+  integrator_factory_ = [](const System<T>& system) {
+    return std::make_unique<RungeKutta3Integrator<T>>(system);
+  };
+  integrator_ = integrator_factory_(*system_);
+  integrator_->reset_context(context_.get());
 
   // Sets step size and accuracy defaults.
   integrator_->request_initial_step_size_target(
@@ -293,7 +303,7 @@ VectorX<T> InitialValueProblem<T>::Solve(const T& t0, const T& tf) const {
   DRAKE_THROW_UNLESS(tf >= t0);
   context_->SetTime(t0);
 
-  ResetState();
+  ResetState(context_.get(), integrator_.get());
 
   // Initializes integrator if necessary.
   if (!integrator_->is_initialized()) {
@@ -313,25 +323,114 @@ VectorX<T> InitialValueProblem<T>::Solve(const T& t0, const T& tf) const {
 }
 
 template <typename T>
-void InitialValueProblem<T>::ResetState() const {
-  system_->SetDefaultContext(context_.get());
+void InitialValueProblem<T>::ResetState(Context<T>* context,
+                                        IntegratorBase<T>* integrator) const {
+  system_->SetDefaultContext(context);
 
   // Keeps track of current step size and accuracy settings (regardless
   // of whether these are actually used by the integrator instance or not).
-  const T max_step_size = integrator_->get_maximum_step_size();
-  const T initial_step_size = integrator_->get_initial_step_size_target();
-  const double target_accuracy = integrator_->get_target_accuracy();
+  const T max_step_size = integrator->get_maximum_step_size();
+  const T initial_step_size = integrator->get_initial_step_size_target();
+  const double target_accuracy = integrator->get_target_accuracy();
 
   // Resets the integrator internal state.
-  integrator_->Reset();
+  integrator->Reset();
 
   // Sets integrator settings again.
-  integrator_->set_maximum_step_size(max_step_size);
-  if (integrator_->supports_error_estimation()) {
+  integrator->set_maximum_step_size(max_step_size);
+  if (integrator->supports_error_estimation()) {
     // Specifies initial step and accuracy setting only if necessary.
-    integrator_->request_initial_step_size_target(initial_step_size);
-    integrator_->set_target_accuracy(target_accuracy);
+    integrator->request_initial_step_size_target(initial_step_size);
+    integrator->set_target_accuracy(target_accuracy);
+  }
+}
+
+template <typename T>
+std::unique_ptr<IntegratorBase<T>> InitialValueProblem<T>::MakeIntegratorLike(
+    Context<T>* context) const {
+  std::unique_ptr<IntegratorBase<T>> integrator =
+      integrator_factory_(*system_);
+  integrator->reset_context(context);
+  integrator->set_maximum_step_size(integrator_->get_maximum_step_size());
+  if (integrator->supports_error_estimation()) {
+    integrator->request_initial_step_size_target(
+        integrator_->get_initial_step_size_target());
+    integrator->set_target_accuracy(integrator_->get_target_accuracy());
+    integrator->set_fixed_step_mode(integrator_->get_fixed_step_mode());
   }
+  return integrator;
+}
+
+template <typename T>
+void InitialValueProblem<T>::ForEachBatchProblem(
+    const T& t0, const T& tf, const Eigen::Ref<const MatrixX<T>>& x0,
+    Parallelism parallelism,
+    const std::function<void(Context<T>*, IntegratorBase<T>*, int)>& solve)
+    const {
+  DRAKE_THROW_UNLESS(tf >= t0);
+  const int num_states = context_->num_continuous_states();
+  if (x0.rows() != num_states) {
+    throw std::logic_error(fmt::format(
+        "InitialValueProblem: the initial states have {} rows, but the "
+        "ODE has {} state variables", x0.rows(), num_states));
+  }
+  const int num_problems = x0.cols();
+  const int num_threads =
+      std::max(1, std::min(parallelism.num_threads(), num_problems));
+
+  // Each thread gets its own context and integrator, which it reuses for all
+  // of its problems.
+  std::vector<std::unique_ptr<Context<T>>> contexts(num_threads);
+  std::vector<std::unique_ptr<IntegratorBase<T>>> integrators(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    contexts[i] = system_->CreateDefaultContext();
+    integrators[i] = MakeIntegratorLike(contexts[i].get());
+  }
+
+  StaticParallelForIndexLoop(
+      Parallelism(num_threads), 0, num_problems,
+      [&](int thread_num, int j) {
+        Context<T>* context = contexts[thread_num].get();
+        IntegratorBase<T>* integrator = integrators[thread_num].get();
+        context->SetTime(t0);
+        ResetState(context, integrator);
+        context->SetContinuousState(x0.col(j));
+        solve(context, integrator, j);
+      });
+}
+
+template <typename T>
+MatrixX<T> InitialValueProblem<T>::SolveBatch(
+    const T& t0, const T& tf, const Eigen::Ref<const MatrixX<T>>& x0,
+    Parallelism parallelism) const {
+  MatrixX<T> xf(x0.rows(), x0.cols());
+  ForEachBatchProblem(
+      t0, tf, x0, parallelism,
+      [&tf, &xf](Context<T>* context, IntegratorBase<T>* integrator, int j) {
+        integrator->Initialize();
+        integrator->IntegrateWithMultipleStepsToTime(tf);
+        xf.col(j) = context->get_continuous_state_vector().CopyToVector();
+      });
+  return xf;
+}
+
+template <typename T>
+std::vector<std::unique_ptr<DenseOutput<T>>>
+InitialValueProblem<T>::DenseSolveBatch(
+    const T& t0, const T& tf, const Eigen::Ref<const MatrixX<T>>& x0,
+    Parallelism parallelism) const {
+  std::vector<std::unique_ptr<DenseOutput<T>>> outputs(x0.cols());
+  ForEachBatchProblem(
+      t0, tf, x0, parallelism,
+      [&tf, &outputs](Context<T>*, IntegratorBase<T>* integrator, int j) {
+        integrator->Initialize();
+        integrator->StartDenseIntegration();
+        integrator->IntegrateWithMultipleStepsToTime(tf);
+        const std::unique_ptr<trajectories::PiecewisePolynomial<T>> traj =
+            integrator->StopDenseIntegration();
+        outputs[j] = std::make_unique<HermitianDenseOutput<T>>(*traj);
+      });
+  return outputs;
 }
 
 template <typename T>
@@ -339,7 +438,7 @@ std::unique_ptr<DenseOutput<T>> InitialValueProblem<T>::DenseSolve(
     const T& t0, const T& tf) const {
   DRAKE_THROW_UNLESS(tf >= t0);
   context_->SetTime(t0);
-  ResetState();
+  ResetState(context_.get(), integrator_.get());
 
   // Unconditionally re-initialize integrator.
   integrator_->Initialize();
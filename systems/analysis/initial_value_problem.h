@@ -1,14 +1,18 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/systems/analysis/dense_output.h"
 #include "drake/systems/analysis/integrator_base.h"
 #include "drake/systems/framework/context.h"
@@ -222,6 +226,40 @@ class InitialValueProblem {
   /// @throws std::exception if t0 > tf.
   std::unique_ptr<DenseOutput<T>> DenseSolve(const T& t0, const T& tf) const;
 
+  /// Solves the IVP from the initial time @p t0 up to time @p tf for each of
+  /// many initial state vectors, using the parameter vector 𝐤 provided in the
+  /// constructor. This is equivalent to (but much faster than) calling
+  /// Solve() once per initial state vector: the problems are divided among
+  /// up to @p parallelism threads, and each thread reuses a single context
+  /// and integrator (configured like the one returned by get_integrator())
+  /// for all of its problems.
+  ///
+  /// @param x0 An n ⨯ N matrix, each of whose columns is an initial state
+  ///           vector 𝐱₀.
+  /// @param parallelism The maximum number of threads to use.
+  /// @returns An n ⨯ N matrix whose j-th column is the IVP solution
+  ///          𝐱(@p tf; 𝐤) for 𝐱(@p t0; 𝐤) = x0.col(j).
+  /// @warning When more than one thread is used, the ODE function given on
+  ///          construction is called concurrently, so it must be safe to do
+  ///          so (e.g., it must not modify any shared data).
+  /// @throws std::exception if t0 > tf, or if x0 has the wrong number of
+  ///         rows.
+  MatrixX<T> SolveBatch(const T& t0, const T& tf,
+                        const Eigen::Ref<const MatrixX<T>>& x0,
+                        Parallelism parallelism = Parallelism::Max()) const;
+
+  /// Like SolveBatch(), but yields a dense approximation of each IVP
+  /// solution, as DenseSolve() does.
+  ///
+  /// @returns A vector whose j-th element is a dense approximation to
+  ///          𝐱(t; 𝐤) with 𝐱(@p t0; 𝐤) = x0.col(j), defined for
+  ///          @p t0 ≤ t ≤ @p tf.
+  /// @throws std::exception if t0 > tf, or if x0 has the wrong number of
+  ///         rows.
+  std::vector<std::unique_ptr<DenseOutput<T>>> DenseSolveBatch(
+      const T& t0, const T& tf, const Eigen::Ref<const MatrixX<T>>& x0,
+      Parallelism parallelism = Parallelism::Max()) const;
+
   /// Resets the internal integrator instance by in-place
   /// construction of the given integrator type.
   ///
@@ -240,6 +278,16 @@ class InitialValueProblem {
   ///          InitialValueProblem::get_mutable_integrator().
   template <typename Integrator, typename... Args>
   Integrator* reset_integrator(Args&&... args) {
+    // Keep copies of the arguments, so that SolveBatch() can make more
+    // integrators of the same kind.
+    integrator_factory_ = [args = std::make_tuple(args...)](
+        const System<T>& system) -> std::unique_ptr<IntegratorBase<T>> {
+      return std::apply(
+          [&system](const auto&... unpacked) {
+            return std::make_unique<Integrator>(system, unpacked...);
+          },
+          args);
+    };
     integrator_ =
         std::make_unique<Integrator>(*system_, std::forward<Args>(args)...);
     integrator_->reset_context(context_.get());
@@ -301,8 +349,23 @@ class InitialValueProblem {
   mutable OdeContext current_values_;
 #pragma GCC diagnostic pop
 
-  // Resets the context / integrator between multiple solves.
-  void ResetState() const;
+  // Resets the given context / integrator between multiple solves, keeping
+  // the integrator's settings.
+  void ResetState(Context<T>* context, IntegratorBase<T>* integrator) const;
+
+  // Makes a new integrator of the same kind as integrator_ (and with the same
+  // settings) for the given context, for SolveBatch() and DenseSolveBatch().
+  std::unique_ptr<IntegratorBase<T>> MakeIntegratorLike(
+      Context<T>* context) const;
+
+  // Calls `solve(context, integrator, j)` for each column j of `x0`, where
+  // the context has been set to the initial time `t0` and state x0.col(j)
+  // and the integrator has been reset, using up to `parallelism` threads.
+  void ForEachBatchProblem(
+      const T& t0, const T& tf, const Eigen::Ref<const MatrixX<T>>& x0,
+      Parallelism parallelism,
+      const std::function<void(Context<T>*, IntegratorBase<T>*, int)>& solve)
+      const;
 
   // IVP ODE solver integration context.
   std::unique_ptr<Context<T>> context_;
@@ -310,6 +373,11 @@ class InitialValueProblem {
   std::unique_ptr<System<T>> system_;
   // Numerical integrator used for IVP ODE solving.
   std::unique_ptr<IntegratorBase<T>> integrator_;
+
+  // Makes a new integrator of the same type (and constructor arguments) as
+  // integrator_, for the given system.
+  std::function<std::unique_ptr<IntegratorBase<T>>(const System<T>&)>
+      integrator_factory_;
 };
 
 }  // namespace systems
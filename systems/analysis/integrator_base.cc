@@ -1,5 +1,7 @@
 #include "drake/systems/analysis/integrator_base.h"
 
+#include "drake/common/extract_double.h"
+
 namespace drake {
 namespace systems {
 
@@ -462,6 +464,76 @@ typename IntegratorBase<T>::StepResult
   }
 }
 
+template <class T>
+void IntegratorBase<T>::LimitDenseOutputMemory() {
+  using std::isinf;
+  if constexpr (scalar_predicate<T>::is_bool) {
+    using trajectories::PiecewisePolynomial;
+    PiecewisePolynomial<T>& dense_output = *dense_output_;
+    std::vector<double>& errors = dense_output_merge_errors_;
+    errors.resize(dense_output.get_number_of_segments(), 0.0);
+
+    // Try to merge the two segments preceding the final one.
+    const int n = dense_output.get_number_of_segments();
+    if (dense_output_merge_tolerance_ > 0 && n >= 3) {
+      const PiecewisePolynomial<T> pair = dense_output.slice(n - 3, 2);
+      const std::vector<T>& breaks = pair.get_segment_times();
+      const T& t0 = breaks[0];
+      const T& t2 = breaks[2];
+      const PiecewisePolynomial<T> merged =
+          PiecewisePolynomial<T>::CubicHermite(
+              std::vector<T>({t0, t2}), {pair.value(t0), pair.value(t2)},
+              {pair.EvalDerivative(t0, 1), pair.EvalDerivative(t2, 1)});
+
+      // Compare at the shared break, and at the quarter points of each
+      // segment.
+      double error = 0;
+      for (int i = 0; i < 2; ++i) {
+        const T h = breaks[i + 1] - breaks[i];
+        for (const double fraction : {0.25, 0.5, 0.75, 1.0}) {
+          const T t = breaks[i] + fraction * h;
+          const MatrixX<T> expected = pair.value(t);
+          const MatrixX<T> scale =
+              expected.array().abs().max(T(1.0)).matrix();
+          const T change =
+              ((merged.value(t) - expected).array().abs() / scale.array())
+                  .maxCoeff();
+          error = std::max(error, ExtractDoubleOrThrow(change));
+        }
+      }
+      error += errors[n - 3] + errors[n - 2];
+      if (error <= dense_output_merge_tolerance_) {
+        const PiecewisePolynomial<T> final_segment =
+            dense_output.slice(n - 1, 1);
+        for (int i = 0; i < 3; ++i) dense_output.RemoveFinalSegment();
+        dense_output.ConcatenateInTime(merged);
+        dense_output.ConcatenateInTime(final_segment);
+        errors.resize(n - 1);
+        errors[n - 3] = error;
+        errors[n - 2] = 0.0;
+      }
+    }
+
+    // Evict the segments that end before the horizon, once they are at least
+    // as many as those that don't (so that the cost of shifting the remaining
+    // segments is amortized). The final segment is always kept.
+    const int num_segments = dense_output.get_number_of_segments();
+    if (num_segments >= 2 && !isinf(dense_output_horizon_)) {
+      const std::vector<T>& breaks = dense_output.get_segment_times();
+      const T cutoff = breaks.back() - dense_output_horizon_;
+      // Segment i ends at breaks[i + 1].
+      const int num_expired = std::min<int>(
+          num_segments - 1,
+          std::upper_bound(breaks.begin() + 1, breaks.end(), cutoff) -
+              (breaks.begin() + 1));
+      if (num_expired > 0 && 2 * num_expired >= num_segments) {
+        dense_output.RemoveInitialSegments(num_expired);
+        errors.erase(errors.begin(), errors.begin() + num_expired);
+      }
+    }
+  }
+}
+
 }  // namespace systems
 }  // namespace drake
 
@@ -859,6 +859,9 @@ class IntegratorBase {
 
     // Drops dense output, if any.
     dense_output_.reset();
+    dense_output_merge_errors_.clear();
+    dense_output_horizon_ = std::numeric_limits<double>::infinity();
+    dense_output_merge_tolerance_ = 0.0;
 
     // Integrator no longer operates in fixed step mode.
     fixed_step_mode_ = false;
@@ -919,8 +922,9 @@ class IntegratorBase {
     // TODO(edrumwri): Compute qbar_weight_, z_weight_ automatically.
     // Set error weighting vectors if not already done.
     if (supports_error_estimation()) {
-      // Allocate space for the error estimate.
-      err_est_ = system_.AllocateTimeDerivatives();
+      // Allocate space for the error estimate. The storage depends only on
+      // the System, so repeated initializations reuse it.
+      if (err_est_ == nullptr) err_est_ = system_.AllocateTimeDerivatives();
 
       const auto& xc = context_->get_state().get_continuous_state();
       const int gv_size = xc.get_generalized_velocity().size();
@@ -1225,8 +1229,64 @@ class IntegratorBase {
 
    Once dense integration is started, and until it is stopped, all subsequent
    integration steps taken will update the allocated dense output.
+
+   By default, the dense output keeps one segment per integration step, so it
+   grows without bound during long dense integrations. Its memory can be
+   limited by evicting the segments older than a time horizon (see
+   set_dense_output_horizon()), and reduced by merging consecutive segments
+   when their union is well approximated by a single segment (see
+   set_dense_output_merge_tolerance()).
    */
 
+  /**
+   Sets the time horizon of the dense output: segments of the dense output that
+   end more than `horizon` before its end time may be discarded, so that its
+   memory footprint stays bounded (it holds at most about twice as many
+   segments as are needed to cover the horizon). The dense output's
+   start_time() moves forward accordingly; earlier times can no longer be
+   evaluated. The default horizon is infinite (nothing is discarded).
+   This setting is ignored when T is symbolic::Expression.
+   @throws std::exception if `horizon` is negative.
+   */
+  void set_dense_output_horizon(const T& horizon) {
+    if (horizon < 0) {
+      throw std::logic_error("Dense output horizon must be non-negative.");
+    }
+    dense_output_horizon_ = horizon;
+  }
+
+  /** Gets the time horizon of the dense output.
+   @sa set_dense_output_horizon() */
+  const T& get_dense_output_horizon() const { return dense_output_horizon_; }
+
+  /**
+   Sets the tolerance for merging segments of the dense output. After each
+   integration step, the two segments preceding the newest one are replaced by
+   a single cubic Hermite segment (matching the values and time derivatives
+   at their ends) if doing so changes the dense output, at a few sample points
+   in each segment, by no more than `tolerance`. The change is measured as
+   the largest over all of the states xᵢ of |Δxᵢ| / max(|xᵢ|, 1) (i.e.,
+   absolute for small states and relative for large ones). The changes of
+   successive merges into the same segment are accumulated, so that the
+   tolerance bounds the total change. The default tolerance is zero (no
+   merging).
+   This setting is ignored when T is symbolic::Expression.
+   @throws std::exception if `tolerance` is negative.
+   */
+  void set_dense_output_merge_tolerance(double tolerance) {
+    if (tolerance < 0) {
+      throw std::logic_error(
+          "Dense output merge tolerance must be non-negative.");
+    }
+    dense_output_merge_tolerance_ = tolerance;
+  }
+
+  /** Gets the tolerance for merging segments of the dense output.
+   @sa set_dense_output_merge_tolerance() */
+  double get_dense_output_merge_tolerance() const {
+    return dense_output_merge_tolerance_;
+  }
+
   /**
    Starts dense integration, allocating a new dense output for this integrator
    to use.
@@ -1250,6 +1310,7 @@ class IntegratorBase {
       throw std::logic_error("Dense integration has been started already.");
     }
     dense_output_ = std::make_unique<trajectories::PiecewisePolynomial<T>>();
+    dense_output_merge_errors_.clear();
   }
 
   /**
@@ -1513,6 +1574,7 @@ class IntegratorBase {
             std::vector<T>({start_time, context_->get_time()}),
             {start_state, state.CopyToVector()},
             {start_derivatives, derivatives.CopyToVector()}));
+    LimitDenseOutputMemory();
     return true;
   }
 
@@ -1596,6 +1658,12 @@ class IntegratorBase {
     return DoStep(h);
   }
 
+  // Merges and evicts segments of the dense output, according to
+  // dense_output_merge_tolerance_ and dense_output_horizon_. The final segment
+  // is never changed, since it may yet be removed or replaced (see
+  // DoDenseStep()).
+  void LimitDenseOutputMemory();
+
   // Reference to the system being simulated.
   const System<T>& system_;
 
@@ -1605,6 +1673,16 @@ class IntegratorBase {
   // Current dense output.
   std::unique_ptr<trajectories::PiecewisePolynomial<T>> dense_output_{nullptr};
 
+  // Dense output memory limits.
+  T dense_output_horizon_{std::numeric_limits<double>::infinity()};
+  double dense_output_merge_tolerance_{0.0};
+
+  // The accumulated change in each segment of the dense output due to merges
+  // (zero for unmerged segments). Segments are only ever added or removed at
+  // the end of the dense output, except by LimitDenseOutputMemory(), so this
+  // is brought up to date by resizing it there.
+  std::vector<double> dense_output_merge_errors_;
+
   // Runtime variables.
   // For variable step integrators, this is set at the end of each step to guide
   // the next one.
@@ -1,8 +1,11 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
+#include <algorithm>
+#include <exception>
 #include <future>
 #include <list>
 #include <mutex>
+#include <optional>
 #include <thread>
 
 #include "drake/systems/analysis/simulator.h"
@@ -197,6 +200,94 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
   }
 }
 
+void MonteCarloSimulationStreaming(
+    const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
+    const double final_time, const int num_samples,
+    const MonteCarloResultCallback& on_result, RandomGenerator* generator,
+    const int num_parallel_executions) {
+  DRAKE_THROW_UNLESS(on_result != nullptr);
+
+  // Create a generator if the user didn't provide one.
+  std::unique_ptr<RandomGenerator> owned_generator;
+  if (generator == nullptr) {
+    owned_generator = std::make_unique<RandomGenerator>();
+    generator = owned_generator.get();
+  }
+
+  // There is no point in having more workers than samples.
+  const int num_threads = std::min(
+      internal::SelectNumberOfThreadsToUse(num_parallel_executions),
+      num_samples);
+  if (num_threads <= 0) {
+    return;
+  }
+
+  // Make all of the simulators up front, from the calling thread. Each is
+  // given its own copy of the generator so that constructing the simulators
+  // doesn't perturb the sequence of samples.
+  std::vector<std::unique_ptr<Simulator<double>>> simulators;
+  for (int i = 0; i < num_threads; ++i) {
+    RandomGenerator factory_generator(*generator);
+    simulators.push_back(make_simulator(&factory_generator));
+  }
+
+  // Guards the generator, the next sample index, and the first exception.
+  std::mutex sample_mutex;
+  int next_sample = 0;
+  std::exception_ptr first_exception;
+  // Serializes the calls to on_result.
+  std::mutex result_mutex;
+
+  auto run_worker = [&](Simulator<double>* simulator) {
+    const System<double>& system = simulator->get_system();
+    Context<double>& context = simulator->get_mutable_context();
+    const std::unique_ptr<Context<double>> initial_context = context.Clone();
+    try {
+      while (true) {
+        int sample = -1;
+        std::optional<RandomSimulationResult> result;
+        {
+          std::lock_guard<std::mutex> lock(sample_mutex);
+          if (next_sample == num_samples || first_exception != nullptr) {
+            return;
+          }
+          sample = next_sample++;
+          context.SetTimeStateAndParametersFrom(*initial_context);
+          result.emplace(*generator);
+          system.SetRandomContext(&context, generator);
+        }
+        simulator->Initialize();
+        simulator->AdvanceTo(final_time);
+        result->output = output(system, context);
+        {
+          std::lock_guard<std::mutex> lock(result_mutex);
+          on_result(sample, std::move(*result));
+        }
+        drake::log()->debug("Simulation {} completed", sample);
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(sample_mutex);
+      if (first_exception == nullptr) {
+        first_exception = std::current_exception();
+      }
+    }
+  };
+
+  // The calling thread serves as one of the workers.
+  std::vector<std::thread> workers;
+  for (int i = 1; i < num_threads; ++i) {
+    workers.emplace_back(run_worker, simulators[i].get());
+  }
+  run_worker(simulators[0].get());
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+
+  if (first_exception != nullptr) {
+    std::rethrow_exception(first_exception);
+  }
+}
+
 }  // namespace analysis
 }  // namespace systems
 }  // namespace drake
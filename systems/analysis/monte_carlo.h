@@ -179,6 +179,78 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
     double final_time, int num_samples, RandomGenerator* generator = nullptr,
     int num_parallel_executions = kNoConcurrency);
 
+/**
+ * Defines a callback that receives the result of one sample of
+ * MonteCarloSimulationStreaming(). The first argument is the index of the
+ * sample (in the range [0, num_samples)).
+ */
+typedef std::function<void(int sample, RandomSimulationResult result)>
+    MonteCarloResultCallback;
+
+/**
+ * A variant of MonteCarloSimulation() designed for very large numbers of
+ * samples. Rather than constructing a new Simulator (and therefore a new
+ * Context) for every sample, each worker thread constructs a single Simulator
+ * and reuses it for all of the samples it processes; and rather than returning
+ * a vector of all of the results, each result is passed to @p on_result as
+ * soon as it is available.
+ *
+ * In pseudo-code, each worker thread implements:
+ * @code
+ *   simulator = make_simulator(copy_of_generator)
+ *   initial_context = simulator.get_context().Clone()
+ *   while (sample = pop_next_sample()) is valid
+ *     simulator.get_mutable_context().SetTimeStateAndParametersFrom(
+ *         initial_context)
+ *     const generator_snapshot = deepcopy(generator)
+ *     simulator.get_system().SetRandomContext(context, generator)
+ *     simulator.Initialize()
+ *     simulator.AdvanceTo(final_time)
+ *     on_result(sample, {generator_snapshot, output(context)})
+ * @endcode
+ * where popping a sample and randomizing the context (the only accesses to
+ * @p generator) are done atomically, in sample order. The samples are
+ * therefore independent of the number of threads, and each result's
+ * `generator_snapshot` reproduces it with RandomSimulation().
+ *
+ * Because the System is reused across samples, this mode is only suitable
+ * when the randomness of the simulation is introduced by SetRandomContext()
+ * (including random input ports, e.g. RandomSource). @p make_simulator is
+ * called once per worker, from the calling thread, with a *copy* of
+ * @p generator; any randomness it introduces is not resampled between
+ * samples.
+ *
+ * @see MonteCarloSimulation() for details about @p make_simulator,
+ * @p output, @p final_time, @p num_samples, @p generator, and
+ * @p num_parallel_executions.
+ *
+ * @param on_result Called once for each sample with its result. The calls are
+ * serialized (no two calls are concurrent) but are made from the worker
+ * threads, in order of completion rather than in sample order.
+ *
+ * If any simulation (or call to @p output or @p on_result) throws, no new
+ * samples are started and the first exception is rethrown from the calling
+ * thread after all workers have stopped.
+ *
+ * Thread safety when parallel execution is specified:
+ * - @p make_simulator is only accessed from the calling thread.
+ *
+ * - Each simulator and its context are only accessed from within a single
+ *   worker thread; however, any resource shared between these simulators must
+ *   be safe for concurrent use.
+ *
+ * - @p output is called from within worker threads; it must be safe to make
+ *   concurrent calls to it.
+ *
+ * @ingroup analysis
+ */
+void MonteCarloSimulationStreaming(
+    const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
+    double final_time, int num_samples,
+    const MonteCarloResultCallback& on_result,
+    RandomGenerator* generator = nullptr,
+    int num_parallel_executions = kNoConcurrency);
+
 // The below functions are exposed for unit testing only.
 namespace internal {
 
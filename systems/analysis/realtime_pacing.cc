@@ -0,0 +1,51 @@
+#include "drake/systems/analysis/realtime_pacing.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+namespace drake {
+namespace systems {
+
+namespace {
+
+// We'll work in fractional seconds.
+using Clock = std::chrono::steady_clock;
+using Duration = std::chrono::duration<double>;
+using TimePoint = std::chrono::time_point<Clock, Duration>;
+
+}  // namespace
+
+RealtimeClock::~RealtimeClock() = default;
+
+SteadyRealtimeClock::~SteadyRealtimeClock() = default;
+
+double SteadyRealtimeClock::Now() {
+  return TimePoint(Clock::now()).time_since_epoch().count();
+}
+
+void SteadyRealtimeClock::WaitUntil(double time) {
+  const TimePoint wake_time{Duration(time)};
+  // TODO(sherm1): Could add some slop to now() and not sleep if
+  // we are already close enough. But what is a reasonable value?
+  if (wake_time > Clock::now()) {
+    std::this_thread::sleep_until(wake_time);
+  }
+}
+
+double RealtimePacingStatistics::mean_lateness() const {
+  if (num_paced_steps == 0) return 0;
+  return sum_lateness / num_paced_steps;
+}
+
+double RealtimePacingStatistics::lateness_jitter() const {
+  if (num_paced_steps == 0) return 0;
+  const double mean = mean_lateness();
+  // Guard against a tiny negative variance due to rounding.
+  return std::sqrt(
+      std::max(0.0, sum_squared_lateness / num_paced_steps - mean * mean));
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace systems {
+
+/** @ingroup simulation
+The source of real time against which a Simulator paces itself when it has a
+positive target realtime rate (see Simulator::set_target_realtime_rate()).
+
+The default, SteadyRealtimeClock, reads std::chrono::steady_clock and sleeps
+until each deadline. A custom clock can instead follow an external time base
+(e.g., the timestamps of incoming LCM messages or a hardware clock), and wait
+for it in whatever way suits that time base, e.g., by blocking on the arrival
+of the next message rather than by sleeping or busy-waiting.
+
+The Simulator calls these methods only from within Initialize(),
+ResetStatistics(), AdvanceTo() and get_actual_realtime_rate(). */
+class RealtimeClock {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RealtimeClock)
+
+  virtual ~RealtimeClock();
+
+  /** Returns the current real time, in seconds since an arbitrary (but fixed)
+  epoch. Successive calls must return non-decreasing values. */
+  virtual double Now() = 0;
+
+  /** Returns once Now() would return at least `time`. */
+  virtual void WaitUntil(double time) = 0;
+
+ protected:
+  RealtimeClock() = default;
+};
+
+/** @ingroup simulation
+A RealtimeClock that reads std::chrono::steady_clock, which is immune to
+changes of the system clock, and waits by sleeping. */
+class SteadyRealtimeClock final : public RealtimeClock {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SteadyRealtimeClock)
+
+  SteadyRealtimeClock() = default;
+  ~SteadyRealtimeClock() final;
+
+  double Now() final;
+  void WaitUntil(double time) final;
+};
+
+/** @ingroup simulation
+Statistics of how closely a Simulator kept to its target realtime rate.
+
+Each step that a Simulator takes with a positive target realtime rate has a
+_deadline_: the real time at which the target rate calls for the step to start.
+If the step is ready before its deadline, the Simulator waits for the deadline;
+otherwise the step has _missed_ its deadline, by an _overrun_ equal to the real
+time at which it was ready minus the deadline. The _lateness_ of a step is the
+real time at which it actually started minus its deadline: for a step that met
+its deadline it is the clock's wake-up latency, and for a step that missed it,
+it is the overrun.
+
+@see Simulator::get_realtime_pacing_statistics() */
+struct RealtimePacingStatistics {
+  /** The number of bins of the overrun histogram. */
+  static constexpr int kNumOverrunBins = 5;
+
+  /** The upper (exclusive) edges of all but the last bin of the overrun
+  histogram, in seconds. The last bin is unbounded. */
+  static constexpr std::array<double, kNumOverrunBins - 1> kOverrunBinEdges{
+      1e-4, 1e-3, 1e-2, 1e-1};
+
+  /** Returns the mean lateness of the paced steps in seconds, or zero if no
+  step was paced. */
+  double mean_lateness() const;
+
+  /** Returns the jitter of the paced steps, i.e., the (population) standard
+  deviation of their lateness, in seconds, or zero if no step was paced. */
+  double lateness_jitter() const;
+
+  /** The number of steps paced against the realtime clock. */
+  int64_t num_paced_steps{0};
+
+  /** The number of paced steps that missed their deadlines. */
+  int64_t num_missed_deadlines{0};
+
+  /** The number of steps whose publishes were skipped because the steps were
+  too late (see Simulator::set_max_publish_lateness()). */
+  int64_t num_skipped_publish_steps{0};
+
+  /** The histogram of the overruns of the steps that missed their deadlines:
+  `overrun_histogram[i]` counts the overruns in the ith bin (see
+  kOverrunBinEdges). */
+  std::array<int64_t, kNumOverrunBins> overrun_histogram{};
+
+  /** The largest overrun in seconds, or zero if no deadline was missed. */
+  double max_overrun{0};
+
+  /** The sum of the lateness of all paced steps, in seconds. */
+  double sum_lateness{0};
+
+  /** The sum of the squared lateness of all paced steps, in seconds². */
+  double sum_squared_lateness{0};
+};
+
+}  // namespace systems
+}  // namespace drake
@@ -1,7 +1,9 @@
 #include "drake/systems/analysis/region_of_attraction.h"
 
 #include <algorithm>
+#include <random>
 
+#include "drake/common/random.h"
 #include "drake/math/continuous_lyapunov_equation.h"
 #include "drake/math/matrix_util.h"
 #include "drake/math/quadratic_form.h"
@@ -29,6 +31,66 @@ using symbolic::Variables;
 
 namespace {
 
+// Throws unless the polynomial V(x) is SOS, without solving an SDP whenever a
+// cheaper test is conclusive:
+// - If V is a quadratic form xᵀSx, it is SOS iff S is positive semidefinite,
+//   which an eigenvalue test decides (only borderline cases fall back to the
+//   SDP).
+// - Otherwise, V is first evaluated at many sampled states, so that a
+//   candidate that is negative somewhere is rejected before the SDP.
+void ThrowUnlessSos(const solvers::VectorXIndeterminate& x,
+                    const Expression& V) {
+  const int num_states = x.size();
+  const Polynomial V_poly(V, Variables(x));
+  const bool is_quadratic_form = std::all_of(
+      V_poly.monomial_to_coefficient_map().begin(),
+      V_poly.monomial_to_coefficient_map().end(),
+      [](const auto& pair) { return pair.first.total_degree() == 2; });
+  if (is_quadratic_form) {
+    Environment env;
+    for (int i = 0; i < num_states; i++) {
+      env.insert(x(i), 0.0);
+    }
+    // V = xᵀSx, where S is half of the Hessian of V.
+    const Eigen::MatrixXd S =
+        0.5 * symbolic::Evaluate(symbolic::Jacobian(V.Jacobian(x), x), env);
+    const double tolerance = 1e-8;
+    if (IsPositiveDefinite(S, tolerance)) return;
+    const Eigen::VectorXd eigenvalues =
+        Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd>(S).eigenvalues();
+    DRAKE_THROW_UNLESS(
+        eigenvalues.minCoeff() >=
+        -tolerance * std::max(1.0, eigenvalues.cwiseAbs().maxCoeff()));
+  } else {
+    // Sample directions at a few radii, since the lowest degree terms of V
+    // dominate near the origin and the highest degree terms far from it.
+    const int kSamplesPerRadius = 100;
+    const std::vector<double> radii{0.1, 1.0, 10.0};
+    RandomGenerator generator;
+    std::normal_distribution<double> normal;
+    Eigen::MatrixXd samples(num_states, kSamplesPerRadius * radii.size());
+    for (int j = 0; j < samples.cols(); ++j) {
+      for (int i = 0; i < num_states; ++i) {
+        samples(i, j) = normal(generator);
+      }
+      samples.col(j) *= radii[j / kSamplesPerRadius] / samples.col(j).norm();
+    }
+    const Eigen::VectorXd values = V_poly.EvaluateIndeterminates(x, samples);
+    for (int r = 0; r < static_cast<int>(radii.size()); ++r) {
+      const auto segment =
+          values.segment(r * kSamplesPerRadius, kSamplesPerRadius);
+      DRAKE_THROW_UNLESS(segment.minCoeff() >=
+                         -1e-8 * std::max(1.0, segment.cwiseAbs().maxCoeff()));
+    }
+  }
+
+  MathematicalProgram prog;
+  prog.AddIndeterminates(x);
+  prog.AddSosConstraint(V);
+  const auto result = Solve(prog);
+  DRAKE_THROW_UNLESS(result.is_success());
+}
+
 // Assumes V positive semi-definite at the origin.
 // If the Hessian of Vdot is negative definite at the origin, then we use
 // Vdot = 0 => V >= rho (or x=0) via
@@ -238,9 +300,7 @@ Expression RegionOfAttraction(const System<double>& system,
     DRAKE_THROW_UNLESS(V.GetVariables().IsSubsetOf(Variables(x_bar)));
 
     // Check that V is positive definite.
-    prog.AddSosConstraint(V);
-    const auto result = Solve(prog);
-    DRAKE_THROW_UNLESS(result.is_success());
+    ThrowUnlessSos(x_bar, V);
   } else {
     // Solve a Lyapunov equation to find a candidate.
     const auto linearized_system =
@@ -1,8 +1,9 @@
 #include "drake/systems/analysis/simulator.h"
 
-#include <thread>
+#include <algorithm>
 
 #include "drake/common/extract_double.h"
+#include "drake/common/profiler.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/analysis/runge_kutta3_integrator.h"
 
@@ -57,6 +58,7 @@ Simulator<T>::Simulator(const System<T>* system,
 
 template <typename T>
 SimulatorStatus Simulator<T>::Initialize(const InitializeParams& params) {
+  ScopedProfileTimer timer("Simulator::Initialize");
   // TODO(sherm1) Modify Context to satisfy constraints.
   // TODO(sherm1) Invoke System's initial conditions computation.
   if (!context_)
@@ -75,8 +77,21 @@ SimulatorStatus Simulator<T>::Initialize(const InitializeParams& params) {
   // Restore default values.
   ResetStatistics();
 
+  // The event collections depend only on the System, so they are allocated
+  // on the first call and reused (cleared) by later calls; this keeps
+  // repeated resets of the same Simulator free of heap churn.
+  const auto reuse_or_allocate =
+      [this](std::unique_ptr<CompositeEventCollection<T>>* events) {
+        if (*events == nullptr) {
+          *events = system_.AllocateCompositeEventCollection();
+          DRAKE_DEMAND(*events != nullptr);
+        } else {
+          (*events)->Clear();
+        }
+      };
+
   // Process all the initialization events.
-  merged_events_ = system_.AllocateCompositeEventCollection();
+  reuse_or_allocate(&merged_events_);
   if (!params.suppress_initialization_events) {
     system_.GetInitializationEvents(*context_, merged_events_.get());
   }
@@ -87,13 +102,11 @@ SimulatorStatus Simulator<T>::Initialize(const InitializeParams& params) {
   HandleDiscreteUpdate(merged_events_->get_discrete_update_events());
 
   // Gets all per-step events to be handled.
-  per_step_events_ = system_.AllocateCompositeEventCollection();
-  DRAKE_DEMAND(per_step_events_ != nullptr);
+  reuse_or_allocate(&per_step_events_);
   system_.GetPerStepEvents(*context_, per_step_events_.get());
 
   // Allocate timed events collection.
-  timed_events_ = system_.AllocateCompositeEventCollection();
-  DRAKE_DEMAND(timed_events_ != nullptr);
+  reuse_or_allocate(&timed_events_);
 
   // Ensure that CalcNextUpdateTime() can return the current time by perturbing
   // current time as slightly toward negative infinity as we can allow.
@@ -116,7 +129,7 @@ SimulatorStatus Simulator<T>::Initialize(const InitializeParams& params) {
   }
 
   // Allocate the witness function collection.
-  witnessed_events_ = system_.AllocateCompositeEventCollection();
+  reuse_or_allocate(&witnessed_events_);
 
   // Do any publishes last. Merge the initialization events with per-step
   // events and current_time timed events (if any). We expect all initialization
@@ -144,11 +157,22 @@ SimulatorStatus Simulator<T>::Initialize(const InitializeParams& params) {
   return status;
 }
 
+template <typename T>
+SimulatorStatus Simulator<T>::Reset(const Context<T>& initial_context,
+                                    const InitializeParams& params) {
+  if (!context_)
+    throw std::logic_error("Reset(): Context has not been set.");
+  system_.ValidateContext(initial_context);
+  context_->SetTimeStateAndParametersFrom(initial_context);
+  return Initialize(params);
+}
+
 // Processes UnrestrictedUpdateEvent events.
 template <typename T>
 void Simulator<T>::HandleUnrestrictedUpdate(
     const EventCollection<UnrestrictedUpdateEvent<T>>& events) {
   if (events.HasEvents()) {
+    ScopedProfileTimer timer("unrestricted updates");
     // First, compute the unrestricted updates into a temporary buffer.
     system_.CalcUnrestrictedUpdate(*context_, events,
         unrestricted_updates_.get());
@@ -167,6 +191,7 @@ template <typename T>
 void Simulator<T>::HandleDiscreteUpdate(
     const EventCollection<DiscreteUpdateEvent<T>>& events) {
   if (events.HasEvents()) {
+    ScopedProfileTimer timer("discrete updates");
     // First, compute the discrete updates into a temporary buffer.
     system_.CalcDiscreteVariableUpdates(*context_, events,
         discrete_updates_.get());
@@ -182,6 +207,7 @@ template <typename T>
 void Simulator<T>::HandlePublish(
     const EventCollection<PublishEvent<T>>& events) {
   if (events.HasEvents()) {
+    ScopedProfileTimer timer("publishes");
     system_.Publish(*context_, events);
     ++num_publishes_;
   }
@@ -189,6 +215,7 @@ void Simulator<T>::HandlePublish(
 
 template <typename T>
 SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
+  ScopedProfileTimer timer("Simulator::AdvanceTo");
   if (!initialization_done_) {
     const SimulatorStatus initialize_status = Initialize();
     if (!initialize_status.succeeded())
@@ -228,7 +255,7 @@ SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
     DRAKE_LOGGER_TRACE("Starting a simulation step at {}", step_start_time);
 
     // Delay to match target realtime rate if requested and possible.
-    PauseIfTooFast();
+    const bool skip_publishes = PauseIfTooFast() > max_publish_lateness_;
 
     // The general policy here is to do actions in decreasing order of
     // "violence" to the state, i.e. unrestricted -> discrete -> continuous ->
@@ -292,14 +319,23 @@ SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
     if (time_or_witness_triggered_ & kWitnessTriggered)
       merged_events_->AddToEnd(*witnessed_events_);
 
-    // Handle any publish events at the end of the loop.
-    HandlePublish(merged_events_->get_publish_events());
-
-    // TODO(siyuan): transfer per step publish entirely to individual systems.
-    // Allow System a chance to produce some output.
-    if (get_publish_every_time_step()) {
-      system_.Publish(*context_);
-      ++num_publishes_;
+    if (skip_publishes) {
+      // The step started too late; drop its publishes so that the simulation
+      // can catch up with real time.
+      if (merged_events_->get_publish_events().HasEvents() ||
+          get_publish_every_time_step()) {
+        ++realtime_pacing_statistics_.num_skipped_publish_steps;
+      }
+    } else {
+      // Handle any publish events at the end of the loop.
+      HandlePublish(merged_events_->get_publish_events());
+
+      // TODO(siyuan): transfer per step publish entirely to individual
+      // systems. Allow System a chance to produce some output.
+      if (get_publish_every_time_step()) {
+        system_.Publish(*context_);
+        ++num_publishes_;
+      }
     }
 
     CallMonitorUpdateStatusAndMaybeThrow(&status);
@@ -565,6 +601,7 @@ Simulator<T>::IntegrateContinuousState(
     const T& next_publish_time, const T& next_update_time,
     const T& boundary_time, CompositeEventCollection<T>* witnessed_events) {
   using std::abs;
+  ScopedProfileTimer timer("continuous integration");
 
   // Clear the composite event collection.
   DRAKE_ASSERT(witnessed_events != nullptr);
@@ -573,7 +610,10 @@ Simulator<T>::IntegrateContinuousState(
   // Save the time and current state.
   const Context<T>& context = get_context();
   const T t0 = context.get_time();
-  const VectorX<T> x0 = context.get_continuous_state().CopyToVector();
+  const VectorBase<T>& xc = context.get_continuous_state().get_vector();
+  x0_.resize(xc.size());
+  xc.CopyToPreSizedVector(&x0_);
+  const VectorX<T>& x0 = x0_;
 
   // Get the set of witness functions active at the current state.
   RedetermineActiveWitnessFunctionsIfNecessary();
@@ -689,24 +729,39 @@ Simulator<T>::IntegrateContinuousState(
 }
 
 template <typename T>
-void Simulator<T>::PauseIfTooFast() const {
-  if (target_realtime_rate_ <= 0) return;  // Run at full speed.
+double Simulator<T>::PauseIfTooFast() {
+  if (target_realtime_rate_ <= 0) return 0;  // Run at full speed.
   const double simtime_now = ExtractDoubleOrThrow(get_context().get_time());
   const double simtime_passed = simtime_now - initial_simtime_;
-  const TimePoint desired_realtime =
-      initial_realtime_ + Duration(simtime_passed / target_realtime_rate_);
-  // TODO(sherm1): Could add some slop to now() and not sleep if
-  // we are already close enough. But what is a reasonable value?
-  if (desired_realtime > Clock::now())
-    std::this_thread::sleep_until(desired_realtime);
+  const double deadline =
+      initial_realtime_ + simtime_passed / target_realtime_rate_;
+  RealtimePacingStatistics& stats = realtime_pacing_statistics_;
+  double realtime_now = realtime_clock_->Now();
+  const double overrun = realtime_now - deadline;
+  if (overrun > 0) {
+    ++stats.num_missed_deadlines;
+    const auto& edges = RealtimePacingStatistics::kOverrunBinEdges;
+    const int bin = std::upper_bound(edges.begin(), edges.end(), overrun) -
+                    edges.begin();
+    ++stats.overrun_histogram[bin];
+    stats.max_overrun = std::max(stats.max_overrun, overrun);
+  } else {
+    realtime_clock_->WaitUntil(deadline);
+    realtime_now = realtime_clock_->Now();
+  }
+  const double lateness = realtime_now - deadline;
+  ++stats.num_paced_steps;
+  stats.sum_lateness += lateness;
+  stats.sum_squared_lateness += lateness * lateness;
+  return lateness;
 }
 
 template <typename T>
 double Simulator<T>::get_actual_realtime_rate() const {
   const double simtime_now = ExtractDoubleOrThrow(get_context().get_time());
   const double simtime_passed = simtime_now - initial_simtime_;
-  const Duration realtime_passed = Clock::now() - initial_realtime_;
-  const double rate = (simtime_passed / realtime_passed.count());
+  const double realtime_passed = realtime_clock_->Now() - initial_realtime_;
+  const double rate = (simtime_passed / realtime_passed);
   return rate;
 }
 
@@ -717,9 +772,10 @@ void Simulator<T>::ResetStatistics() {
   num_discrete_updates_ = 0;
   num_unrestricted_updates_ = 0;
   num_publishes_ = 0;
+  realtime_pacing_statistics_ = {};
 
   initial_simtime_ = ExtractDoubleOrThrow(get_context().get_time());
-  initial_realtime_ = Clock::now();
+  initial_realtime_ = realtime_clock_->Now();
 }
 
 }  // namespace systems
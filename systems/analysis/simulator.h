@@ -1,7 +1,6 @@
 #pragma once
 
 #include <algorithm>
-#include <chrono>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -14,6 +13,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/extract_double.h"
 #include "drake/systems/analysis/integrator_base.h"
+#include "drake/systems/analysis/realtime_pacing.h"
 #include "drake/systems/analysis/simulator_config.h"
 #include "drake/systems/analysis/simulator_status.h"
 #include "drake/systems/framework/context.h"
@@ -294,6 +294,25 @@ class Simulator {
   /// @see AdvanceTo(), AdvancePendingEvents(), SimulatorStatus
   SimulatorStatus Initialize(const InitializeParams& params = {});
 
+  /// Restores the time, state, and parameters of the internally-maintained
+  /// Context from `initial_context` and then calls Initialize(). This is the
+  /// preferred way to restart a simulation repeatedly from the same initial
+  /// conditions (e.g., for Monte Carlo rollouts): the values are copied into
+  /// the existing Context, so no Context, integrator, or event storage is
+  /// reallocated, and only the cache entries that depend on the copied values
+  /// are invalidated. As with Initialize(), integrator settings (including
+  /// any step size adapted by an error-controlled integrator) are retained.
+  ///
+  /// @param initial_context A Context for the same System as this Simulator,
+  ///                        typically one saved with Context::Clone() before
+  ///                        the first simulation.
+  /// @param params (optional) a parameter structure (@see InitializeParams).
+  /// @throws std::exception if this Simulator has no Context, or if
+  ///         `initial_context` is not compatible with the System.
+  /// @see Initialize(), Context::SetTimeStateAndParametersFrom()
+  SimulatorStatus Reset(const Context<T>& initial_context,
+                        const InitializeParams& params = {});
+
   /// Advances the System's trajectory until `boundary_time` is reached in
   /// the context or some other termination condition occurs. A variety of
   /// `std::runtime_error` conditions are possible here, as well as error
@@ -494,6 +513,45 @@ class Simulator {
   /// @see set_target_realtime_rate()
   double get_actual_realtime_rate() const;
 
+  /// Sets the clock against which the simulation is paced when the target
+  /// realtime rate is positive, and which get_actual_realtime_rate() reads.
+  /// See RealtimeClock for why one might replace the default
+  /// SteadyRealtimeClock. Set the clock before calling Initialize(), since
+  /// the initial real time is recorded then (and by ResetStatistics()).
+  /// @param clock The new clock, or nullptr to restore the default.
+  void set_realtime_clock(std::shared_ptr<RealtimeClock> clock) {
+    realtime_clock_ = clock != nullptr
+                          ? std::move(clock)
+                          : std::make_shared<SteadyRealtimeClock>();
+  }
+
+  /// Returns the clock set by set_realtime_clock().
+  RealtimeClock& get_mutable_realtime_clock() { return *realtime_clock_; }
+
+  /// Sets how late (in seconds) a step may start relative to its realtime
+  /// deadline, while the target realtime rate is positive, and still publish.
+  /// The publishes at the end of any later step (its publish events and the
+  /// forced publish of set_publish_every_time_step()) are skipped, so that a
+  /// simulation that falls behind real time under overload can catch up. The
+  /// monitor is still called. The default is infinity (never skip).
+  /// @see RealtimePacingStatistics for the definitions of deadlines and
+  ///      lateness.
+  /// @throws std::exception if `max_lateness` is negative or NaN.
+  void set_max_publish_lateness(double max_lateness) {
+    DRAKE_THROW_UNLESS(max_lateness >= 0);
+    max_publish_lateness_ = max_lateness;
+  }
+
+  /// Returns the lateness set by set_max_publish_lateness().
+  double get_max_publish_lateness() const { return max_publish_lateness_; }
+
+  /// Returns the statistics of how closely the steps taken since the last
+  /// Initialize() or ResetStatistics() call kept to the target realtime rate.
+  /// Steps taken while the target rate is zero are not counted.
+  const RealtimePacingStatistics& get_realtime_pacing_statistics() const {
+    return realtime_pacing_statistics_;
+  }
+
   /// Sets whether the simulation should trigger a forced-Publish event on the
   /// System under simulation at the end of every trajectory-advancing step.
   /// Specifically, that means the System::Publish() event dispatcher will be
@@ -753,15 +811,11 @@ class Simulator {
     const Context<T>& context) const;
   void RedetermineActiveWitnessFunctionsIfNecessary();
 
-  // The steady_clock is immune to system clock changes so increases
-  // monotonically. We'll work in fractional seconds.
-  using Clock = std::chrono::steady_clock;
-  using Duration = std::chrono::duration<double>;
-  using TimePoint = std::chrono::time_point<Clock, Duration>;
-
   // If the simulated time in the context is ahead of real time, pause long
-  // enough to let real time catch up (approximately).
-  void PauseIfTooFast() const;
+  // enough to let real time catch up (approximately). Records the step in
+  // realtime_pacing_statistics_ and returns its lateness, or returns zero if
+  // the target realtime rate is zero.
+  double PauseIfTooFast();
 
   // A pointer to the integrator.
   std::unique_ptr<IntegratorBase<T>> integrator_;
@@ -784,7 +838,7 @@ class Simulator {
 
   // Temporaries used for witness function isolation.
   std::vector<const WitnessFunction<T>*> triggered_witnesses_;
-  VectorX<T> w0_, wf_;
+  VectorX<T> x0_, w0_, wf_;
 
   // Slow down to this rate if possible (user settable).
   double target_realtime_rate_{SimulatorConfig{}.target_realtime_rate};
@@ -793,9 +847,19 @@ class Simulator {
 
   bool publish_at_initialization_{SimulatorConfig{}.publish_every_time_step};
 
+  // The source of real time (user settable).
+  std::shared_ptr<RealtimeClock> realtime_clock_{
+      std::make_shared<SteadyRealtimeClock>()};
+
+  // Skip the publishes of steps later than this (user settable).
+  double max_publish_lateness_{std::numeric_limits<double>::infinity()};
+
   // These are recorded at initialization or statistics reset.
   double initial_simtime_{nan()};  // Simulated time at start of period.
-  TimePoint initial_realtime_;     // Real time at start of period.
+  double initial_realtime_{nan()};  // Real time at start of period.
+
+  // The realtime pacing statistics since the last statistics reset.
+  RealtimePacingStatistics realtime_pacing_statistics_;
 
   // The number of discrete updates since the last statistics reset.
   int64_t num_discrete_updates_{0};
@@ -7,6 +7,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/nice_type_name.h"
+#include "drake/common/profiler.h"
 #include "drake/systems/analysis/implicit_integrator.h"
 #include "drake/systems/analysis/integrator_base.h"
 #include "drake/systems/analysis/simulator.h"
@@ -159,6 +160,13 @@ void PrintSimulatorStatistics(const Simulator<T>& simulator) {
                  implicit_integrator->get_num_newton_raphson_iterations());
     }
   }
+
+  // Print the timings gathered while profiling, if any.
+  const Profiler& profiler = Profiler::Global();
+  if (!profiler.GetStatistics().empty()) {
+    fmt::print("\nProfile (see drake::Profiler):\n{}",
+               profiler.FormatReport());
+  }
 }
 
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
@@ -6,7 +6,8 @@ namespace drake {
 namespace systems {
 
 /// This method outputs to stdout relevant simulation statistics for a
-/// simulator that advanced the state of a system forward in time.
+/// simulator that advanced the state of a system forward in time. If any
+/// timings were gathered with drake::Profiler, its report is printed as well.
 /// @param[in] simulator
 ///   The simulator to output statistics for.
 template <typename T>
@@ -0,0 +1,125 @@
+#include "drake/systems/analysis/co_simulator.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/primitives/gain.h"
+#include "drake/systems/primitives/integrator.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// A feedback loop x' = u, u = -x, split into two partitions: an integrator
+// ("plant") and a gain ("controller").
+class CoSimulatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override { MakeLoop(Parallelism::Max()); }
+
+  void MakeLoop(Parallelism parallelism) {
+    dut_ = std::make_unique<CoSimulator>(kPeriod, parallelism);
+    plant_ = &dut_->AddPartition(std::make_unique<Integrator<double>>(1));
+    controller_ = &dut_->AddPartition(std::make_unique<Gain<double>>(-1, 1));
+    dut_->Connect(plant_->get_output_port(0), controller_->get_input_port(0));
+    dut_->Connect(controller_->get_output_port(0), plant_->get_input_port(0));
+    dynamic_cast<const Integrator<double>&>(*plant_).set_integral_value(
+        &dut_->get_mutable_simulator(*plant_).get_mutable_context(),
+        Vector1d(1.0));
+  }
+
+  double plant_state() const {
+    return dut_->get_simulator(*plant_)
+        .get_context()
+        .get_continuous_state_vector()
+        .GetAtIndex(0);
+  }
+
+  static constexpr double kPeriod = 0.1;
+  std::unique_ptr<CoSimulator> dut_;
+  const System<double>* plant_{};
+  const System<double>* controller_{};
+};
+
+// Each connection behaves like a zero-order hold at the synchronization
+// period, so the plant's state follows x[k+1] = x[k] - h⋅x[k-1]: the
+// controller's output is sampled at the start of each window, while its
+// input still holds the plant's state from the start of the previous window.
+// (In the first window, the initial exchange has already propagated x[0]
+// through the controller.)
+TEST_F(CoSimulatorTest, SampleAndHold) {
+  EXPECT_EQ(dut_->num_partitions(), 2);
+  EXPECT_EQ(dut_->sync_period(), kPeriod);
+  double x = 1.0;
+  double x_prev = 1.0;
+  for (int k = 1; k <= 10; ++k) {
+    dut_->AdvanceTo(k * kPeriod);
+    EXPECT_EQ(dut_->get_time(), k * kPeriod);
+    const double x_next = x - kPeriod * x_prev;
+    x_prev = x;
+    x = x_next;
+    EXPECT_NEAR(plant_state(), x, 1e-14) << k;
+  }
+
+  // Advancing to times between the synchronization points doesn't change the
+  // exchanges.
+  MakeLoop(Parallelism::Max());
+  dut_->AdvanceTo(0.25);
+  EXPECT_EQ(dut_->get_time(), 0.25);
+  dut_->AdvanceTo(0.55);
+  dut_->AdvanceTo(1.0);
+  EXPECT_NEAR(plant_state(), x, 1e-14);
+}
+
+// The result does not depend on the parallelism.
+TEST_F(CoSimulatorTest, Deterministic) {
+  dut_->AdvanceTo(2.0);
+  const double parallel_result = plant_state();
+  MakeLoop(Parallelism::None());
+  dut_->AdvanceTo(2.0);
+  EXPECT_EQ(plant_state(), parallel_result);
+}
+
+TEST_F(CoSimulatorTest, Errors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(CoSimulator(0.0), ".*sync_period.*");
+
+  // Ports that aren't from partitions.
+  Gain<double> stranger(1.0, 1);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut_->Connect(stranger.get_output_port(), plant_->get_input_port(0)),
+      ".*not one of the partitions.*");
+
+  // Ports from the same partition.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut_->Connect(plant_->get_output_port(0), plant_->get_input_port(0)),
+      ".*same partition.*");
+
+  // Ports that are already connected.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut_->Connect(controller_->get_output_port(0),
+                    plant_->get_input_port(0)),
+      ".*already connected.*");
+
+  // Ports with different sizes.
+  const System<double>& wide =
+      dut_->AddPartition(std::make_unique<Gain<double>>(1.0, 2));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut_->Connect(plant_->get_output_port(0), wide.get_input_port(0)),
+      ".*do not match.*");
+
+  // Partitions that start at different times.
+  dut_->get_mutable_simulator(wide).get_mutable_context().SetTime(1.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(dut_->Initialize(), ".*same time.*");
+  dut_->get_mutable_simulator(wide).get_mutable_context().SetTime(0.0);
+
+  // Changes after initialization.
+  dut_->AdvanceTo(0.1);
+  EXPECT_THROW(dut_->AddPartition(std::make_unique<Gain<double>>(1.0, 1)),
+               std::exception);
+  EXPECT_THROW(dut_->AdvanceTo(0.05), std::exception);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -1,6 +1,8 @@
 #include "drake/systems/analysis/initial_value_problem.h"
 
 #include <algorithm>
+#include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -64,6 +66,62 @@ GTEST_TEST(InitialValueProblemTest, SolutionUsingMultipleIntegrators) {
       ivp.Solve(t0, t2), k1 + (x0 - k1) * std::exp(-(t2 - t0)), kAccuracy));
 }
 
+// Checks that solving a batch of IVPs gives the same results as solving them
+// one at a time, regardless of the parallelism and integrator.
+GTEST_TEST(InitialValueProblemTest, SolveBatch) {
+  const VectorX<double> kParameters = VectorX<double>::Constant(2, 1.0);
+  InitialValueProblem<double> ivp(
+      [](const double& t, const VectorX<double>& x,
+         const VectorX<double>& k) -> VectorX<double> {
+        unused(t);
+        return -x + k;
+      }, VectorX<double>::Zero(2), kParameters);
+
+  const int kNumProblems = 7;
+  const MatrixX<double> x0 = MatrixX<double>::Random(2, kNumProblems);
+  const double t0 = 0.5;
+  const double tf = 1.5;
+
+  const auto check_batches = [&]() {
+    for (const Parallelism parallelism :
+         {Parallelism::None(), Parallelism(3)}) {
+      const MatrixX<double> xf = ivp.SolveBatch(t0, tf, x0, parallelism);
+      const std::vector<std::unique_ptr<DenseOutput<double>>> dense =
+          ivp.DenseSolveBatch(t0, tf, x0, parallelism);
+      ASSERT_EQ(xf.cols(), kNumProblems);
+      ASSERT_EQ(dense.size(), kNumProblems);
+      for (int j = 0; j < kNumProblems; ++j) {
+        // The per-problem API sets the initial state via the default context,
+        // so we make a new IVP to compare with.
+        InitialValueProblem<double> single(
+            [](const double&, const VectorX<double>& x,
+               const VectorX<double>& k) -> VectorX<double> { return -x + k; },
+            x0.col(j), kParameters);
+        if (ivp.get_integrator().get_fixed_step_mode()) {
+          single.reset_integrator<RungeKutta2Integrator<double>>(0.1);
+        }
+        const VectorX<double> expected = single.Solve(t0, tf);
+        EXPECT_TRUE(CompareMatrices(xf.col(j), expected));
+        EXPECT_EQ(dense[j]->start_time(), t0);
+        EXPECT_EQ(dense[j]->end_time(), tf);
+        EXPECT_TRUE(CompareMatrices(dense[j]->Evaluate(tf), expected, 1e-14));
+      }
+    }
+  };
+  check_batches();
+
+  // The batch uses the same kind of integrator as the IVP.
+  ivp.reset_integrator<RungeKutta2Integrator<double>>(0.1);
+  check_batches();
+
+  // An empty batch is fine; a batch with the wrong state size is not.
+  EXPECT_EQ(ivp.SolveBatch(t0, tf, MatrixX<double>(2, 0)).cols(), 0);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ivp.SolveBatch(t0, tf, MatrixX<double>::Zero(3, 1)),
+      ".*3 rows.*2 state variables.*");
+  EXPECT_THROW(ivp.SolveBatch(tf, t0, x0), std::exception);
+}
+
 // Parameterized fixture for testing accuracy of IVP solutions.
 class InitialValueProblemAccuracyTest
     : public ::testing::TestWithParam<double> {
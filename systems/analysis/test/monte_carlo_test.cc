@@ -1,7 +1,11 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
+#include <atomic>
 #include <cmath>
+#include <optional>
 #include <thread>
+#include <unordered_set>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -219,6 +223,66 @@ GTEST_TEST(MonteCarloSimulationTest, BasicTest) {
   }
 }
 
+// Confirms that the streaming variant reports every sample exactly once, with
+// results that are independent of the number of threads and reproducible by
+// RandomSimulation(), while making only one simulator per worker.
+GTEST_TEST(MonteCarloSimulationStreamingTest, BasicTest) {
+  std::atomic<int> num_simulators_made{0};
+  const SimulatorFactory make_simulator = [&](RandomGenerator*) {
+    ++num_simulators_made;
+    auto system = std::make_unique<RandomContextSystem>();
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const double final_time = 0.1;
+  const int num_samples = 100;
+
+  const RandomGenerator prototype_generator;
+  std::vector<std::vector<std::optional<RandomSimulationResult>>> results;
+  for (int num_threads : {kNoConcurrency, kTestConcurrency}) {
+    SCOPED_TRACE(fmt::format("num_threads = {}", num_threads));
+    num_simulators_made = 0;
+    RandomGenerator generator(prototype_generator);
+    std::vector<std::optional<RandomSimulationResult>> thread_results(
+        num_samples);
+    MonteCarloSimulationStreaming(
+        make_simulator, &GetScalarOutput, final_time, num_samples,
+        [&](int sample, RandomSimulationResult result) {
+          ASSERT_GE(sample, 0);
+          ASSERT_LT(sample, num_samples);
+          EXPECT_FALSE(thread_results[sample].has_value());
+          thread_results[sample] = std::move(result);
+        },
+        &generator, num_threads);
+    EXPECT_EQ(num_simulators_made, num_threads);
+    for (const auto& result : thread_results) {
+      ASSERT_TRUE(result.has_value());
+    }
+    results.push_back(std::move(thread_results));
+  }
+
+  std::unordered_set<double> outputs;
+  for (int sample = 0; sample < num_samples; ++sample) {
+    const RandomSimulationResult& serial_result = *results[0][sample];
+    const RandomSimulationResult& parallel_result = *results[1][sample];
+    outputs.emplace(serial_result.output);
+    EXPECT_EQ(serial_result.output, parallel_result.output);
+
+    RandomGenerator reproduction_generator(parallel_result.generator_snapshot);
+    EXPECT_EQ(RandomSimulation(make_simulator, &GetScalarOutput, final_time,
+                               &reproduction_generator),
+              parallel_result.output);
+  }
+  EXPECT_EQ(outputs.size(), num_samples);
+
+  // No samples means no work.
+  num_simulators_made = 0;
+  MonteCarloSimulationStreaming(
+      make_simulator, &GetScalarOutput, final_time, 0,
+      [](int, RandomSimulationResult) { ADD_FAILURE(); }, nullptr,
+      kTestConcurrency);
+  EXPECT_EQ(num_simulators_made, 0);
+}
+
 // Simple system that outputs constant scalar, where this scalar is stored in
 // the discrete state of the system.  The scalar value is randomized in
 // SetRandomState(). If the state value (cast to int) is odd, DoCalcVectorOutput
@@ -272,6 +336,38 @@ GTEST_TEST(MonteCarloSimulationExceptionTest, BasicTest) {
       std::exception);
 }
 
+GTEST_TEST(MonteCarloSimulationStreamingExceptionTest, BasicTest) {
+  const SimulatorFactory make_simulator = [](RandomGenerator* generator) {
+    auto system = std::make_unique<ThrowingRandomContextSystem>();
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const double final_time = 0.1;
+  const int num_samples = 10;
+  auto ignore_result = [](int, RandomSimulationResult) {};
+
+  EXPECT_THROW(MonteCarloSimulationStreaming(
+      make_simulator, &GetScalarOutput, final_time, num_samples,
+      ignore_result, nullptr, kNoConcurrency),
+      std::exception);
+  EXPECT_THROW(MonteCarloSimulationStreaming(
+      make_simulator, &GetScalarOutput, final_time, num_samples,
+      ignore_result, nullptr, kTestConcurrency),
+      std::exception);
+
+  // Exceptions thrown by the callback propagate as well.
+  const SimulatorFactory make_benign_simulator = [](RandomGenerator*) {
+    auto system = std::make_unique<RandomContextSystem>();
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  EXPECT_THROW(MonteCarloSimulationStreaming(
+      make_benign_simulator, &GetScalarOutput, final_time, num_samples,
+      [](int, RandomSimulationResult) {
+        throw std::runtime_error("callback failure");
+      },
+      nullptr, kTestConcurrency),
+      std::runtime_error);
+}
+
 }  // namespace
 }  // namespace analysis
 }  // namespace systems
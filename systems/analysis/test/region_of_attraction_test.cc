@@ -119,6 +119,24 @@ GTEST_TEST(RegionOfAttractionTest, IndefiniteHessian) {
   EXPECT_TRUE(Polynomial(V).CoefficientsAlmostEqual(V_expected, 1e-6));
 }
 
+// A Lyapunov candidate that is not positive (quadratic or not) is rejected.
+GTEST_TEST(RegionOfAttractionTest, IndefiniteCandidate) {
+  const Variable x("x");
+  const Variable y("y");
+  const auto system = SymbolicVectorSystemBuilder()
+                          .state({x, y})
+                          .dynamics({-x, -y + pow(y, 3)})
+                          .Build();
+  const auto context = system->CreateDefaultContext();
+
+  RegionOfAttractionOptions options;
+  options.state_variables = Vector2<symbolic::Variable>(x, y);
+  options.lyapunov_candidate = x * x - y * y;
+  EXPECT_THROW(RegionOfAttraction(*system, *context, options), std::exception);
+  options.lyapunov_candidate = pow(x, 4) - y * y;
+  EXPECT_THROW(RegionOfAttraction(*system, *context, options), std::exception);
+}
+
 // Another example from the underactuated lyapunov chapter.  U(x) is a
 // polynomial potential function, and xdot = (U-1)dUdx, which should have
 // U==1 as the true boundary of the RoA.
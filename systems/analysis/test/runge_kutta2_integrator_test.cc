@@ -1,6 +1,7 @@
 #include "drake/systems/analysis/runge_kutta2_integrator.h"
 
 #include <cmath>
+#include <limits>
 
 #include <gtest/gtest.h>
 
@@ -151,6 +152,59 @@ GTEST_TEST(IntegratorTest, SpringMassStep) {
   CheckStatsValidity(&integrator);
 }
 
+// Checks that the dense output's memory can be limited by evicting old
+// segments and merging similar ones.
+GTEST_TEST(IntegratorTest, DenseOutputMemoryLimits) {
+  SpringMassSystem<double> spring_mass(300.0, 2.0, 0.);
+  const double h = 1.0 / 1024;
+  const double t_final = 1.0;
+
+  // Returns the dense output for the given horizon and merge tolerance.
+  auto integrate = [&](double horizon, double tolerance) {
+    auto context = spring_mass.CreateDefaultContext();
+    spring_mass.set_position(context.get(), 0.1);
+    spring_mass.set_velocity(context.get(), 0.01);
+    RungeKutta2Integrator<double> integrator(spring_mass, h, context.get());
+    integrator.Initialize();
+    integrator.set_dense_output_horizon(horizon);
+    integrator.set_dense_output_merge_tolerance(tolerance);
+    integrator.StartDenseIntegration();
+    integrator.IntegrateWithMultipleStepsToTime(t_final);
+    return integrator.StopDenseIntegration();
+  };
+  const auto full = integrate(std::numeric_limits<double>::infinity(), 0.0);
+  ASSERT_EQ(full->get_number_of_segments(), 1024);
+
+  // With a horizon, only (about) the recent segments are kept, and they are
+  // unchanged.
+  const double kHorizon = 0.1;
+  const auto windowed = integrate(kHorizon, 0.0);
+  EXPECT_LE(windowed->get_number_of_segments(), 2 * (kHorizon / h + 1));
+  EXPECT_LE(windowed->start_time(), t_final - kHorizon);
+  EXPECT_EQ(windowed->end_time(), t_final);
+  for (double t = t_final - kHorizon; t <= t_final; t += h / 2) {
+    EXPECT_EQ(windowed->value(t), full->value(t));
+  }
+
+  // With a merge tolerance, there are fewer segments, which stay close to the
+  // original ones. (The tolerance is checked at sample points only, so we
+  // allow a bit of slack.)
+  const double kTolerance = 1e-4;
+  const auto merged = integrate(std::numeric_limits<double>::infinity(),
+                                kTolerance);
+  EXPECT_LT(merged->get_number_of_segments(), 1024 / 2);
+  EXPECT_EQ(merged->start_time(), 0.0);
+  EXPECT_EQ(merged->end_time(), t_final);
+  for (double t = 0; t <= t_final; t += h / 2) {
+    EXPECT_NEAR(merged->value(t)(0), full->value(t)(0), 2 * kTolerance);
+  }
+
+  RungeKutta2Integrator<double> integrator(spring_mass, h);
+  EXPECT_THROW(integrator.set_dense_output_horizon(-1), std::exception);
+  EXPECT_THROW(integrator.set_dense_output_merge_tolerance(-1),
+               std::exception);
+}
+
 // System where the state at t corresponds to the quadratic equation
 // 4t² + 4t + C, where C is the initial value (the state at t=0).
 class Quadratic : public LeafSystem<double> {
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/limit_malloc.h"
+#include "drake/systems/analysis/explicit_euler_integrator.h"
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/framework/event.h"
@@ -84,6 +85,169 @@ GTEST_TEST(SimulatorLimitMallocTest,
   }
 }
 
+// A discrete system resembling a discrete MultibodyPlant: its update is
+// computed in the legacy DoCalcDiscreteVariableUpdates() override from
+// abstract and vector cache entries, and it reports results through both
+// vector and abstract output ports.
+class DiscretePlantLike final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DiscretePlantLike)
+
+  DiscretePlantLike() {
+    const DiscreteStateIndex state_index = DeclareDiscreteState(kSize);
+    DeclareVectorInputPort("u", kSize);
+    DeclarePeriodicDiscreteUpdate(kTimeStep);
+    contacts_cache_index_ =
+        DeclareCacheEntry("contacts", &DiscretePlantLike::CalcContacts,
+                          {xd_ticket()})
+            .cache_index();
+    forces_cache_index_ =
+        DeclareCacheEntry("forces", BasicVector<double>(kSize),
+                          &DiscretePlantLike::CalcForces,
+                          {all_input_ports_ticket(), xd_ticket()})
+            .cache_index();
+    DeclareStateOutputPort("state", state_index);
+    DeclareAbstractOutputPort("contacts", &DiscretePlantLike::CalcContacts,
+                              {xd_ticket()});
+  }
+
+  static constexpr int kSize = 3;
+  static constexpr double kTimeStep = 0.01;
+
+ private:
+  // Mimics per-step containers that are cleared and refilled, retaining their
+  // capacity.
+  void CalcContacts(const Context<double>& context,
+                    std::vector<double>* contacts) const {
+    contacts->clear();
+    for (int i = 0; i < kSize; ++i) {
+      contacts->push_back(context.get_discrete_state_vector()[i]);
+    }
+  }
+
+  void CalcForces(const Context<double>& context,
+                  BasicVector<double>* forces) const {
+    forces->get_mutable_value() =
+        get_input_port(0).Eval(context) -
+        context.get_discrete_state_vector().value();
+  }
+
+  void DoCalcDiscreteVariableUpdates(
+      const Context<double>& context,
+      const std::vector<const DiscreteUpdateEvent<double>*>&,
+      DiscreteValues<double>* updates) const final {
+    const auto& contacts = get_cache_entry(contacts_cache_index_)
+                               .Eval<std::vector<double>>(context);
+    const auto& forces =
+        get_cache_entry(forces_cache_index_).Eval<BasicVector<double>>(context);
+    for (int i = 0; i < kSize; ++i) {
+      (*updates)[i] = contacts[i] + kTimeStep * forces[i];
+    }
+  }
+
+  CacheIndex contacts_cache_index_;
+  CacheIndex forces_cache_index_;
+};
+
+// A system that consumes the outputs of DiscretePlantLike at every step, as
+// e.g. a controller or a visualizer would.
+class PerStepConsumer final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PerStepConsumer)
+
+  PerStepConsumer() {
+    DeclareVectorInputPort("state", DiscretePlantLike::kSize);
+    DeclareAbstractInputPort("contacts", Value<std::vector<double>>());
+    DeclareVectorOutputPort("u", DiscretePlantLike::kSize,
+                            &PerStepConsumer::CalcActuation);
+    DeclarePerStepPublishEvent(&PerStepConsumer::Consume);
+  }
+
+ private:
+  void CalcActuation(const Context<double>& context,
+                     BasicVector<double>* u) const {
+    u->get_mutable_value() = -get_input_port(0).Eval(context);
+  }
+
+  EventStatus Consume(const Context<double>& context) const {
+    const auto& contacts =
+        get_input_port(1).Eval<std::vector<double>>(context);
+    DRAKE_DEMAND(static_cast<int>(contacts.size()) == DiscretePlantLike::kSize);
+    return EventStatus::Succeeded();
+  }
+};
+
+// A continuous harmonic oscillator.
+class Oscillator final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Oscillator)
+
+  Oscillator() { DeclareContinuousState(1, 1, 0); }
+
+ private:
+  void DoCalcTimeDerivatives(const Context<double>& context,
+                             ContinuousState<double>* derivatives) const final {
+    const VectorBase<double>& x = context.get_continuous_state_vector();
+    (*derivatives)[0] = x[1];
+    (*derivatives)[1] = -x[0];
+  }
+};
+
+// Tests that, after the first step, heap allocations do not occur from
+// Simulator and the systems framework for a (nested) diagram of discrete
+// systems exchanging vector and abstract values through their ports, while
+// evaluating cache entries.
+GTEST_TEST(SimulatorLimitMallocTest, NoHeapAllocsInSteadyStateForDiscreteDiagram) {
+  DiagramBuilder<double> plant_builder;
+  auto* plant = plant_builder.AddSystem<DiscretePlantLike>();
+  plant_builder.ExportInput(plant->get_input_port(0));
+  plant_builder.ExportOutput(plant->get_output_port(0));
+  plant_builder.ExportOutput(plant->get_output_port(1));
+
+  DiagramBuilder<double> builder;
+  auto* plant_diagram = builder.AddSystem(plant_builder.Build());
+  auto* consumer = builder.AddSystem<PerStepConsumer>();
+  builder.Connect(plant_diagram->get_output_port(0),
+                  consumer->get_input_port(0));
+  builder.Connect(plant_diagram->get_output_port(1),
+                  consumer->get_input_port(1));
+  builder.Connect(consumer->get_output_port(0),
+                  plant_diagram->get_input_port(0));
+  auto diagram = builder.Build();
+
+  Simulator<double> simulator(*diagram);
+  simulator.Initialize();
+  // The first step may size per-step storage (e.g. the abstract cache entry).
+  simulator.AdvanceTo(DiscretePlantLike::kTimeStep);
+  {
+    test::LimitMalloc heap_alloc_checker({.max_num_allocations = 0});
+    simulator.AdvanceTo(1.0);
+    simulator.AdvanceTo(2.0);
+  }
+}
+
+// Tests that, after the first step, heap allocations do not occur from
+// Simulator for continuous state integrated with a fixed-step integrator.
+// TODO(rpoyner-tri): add testing for error-controlled integration, which
+// still allocates.
+GTEST_TEST(SimulatorLimitMallocTest,
+           NoHeapAllocsInSteadyStateForFixedStepIntegration) {
+  DiagramBuilder<double> builder;
+  builder.AddSystem<Oscillator>();
+  builder.AddSystem<EventfulSystem>();
+  auto diagram = builder.Build();
+
+  Simulator<double> simulator(*diagram);
+  simulator.reset_integrator<ExplicitEulerIntegrator<double>>(0.01);
+  simulator.Initialize();
+  simulator.AdvanceTo(0.01);
+  {
+    test::LimitMalloc heap_alloc_checker({.max_num_allocations = 0});
+    simulator.AdvanceTo(1.0);
+    simulator.AdvanceTo(2.0);
+  }
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/profiler.h"
+
 #include "drake/systems/primitives/constant_vector_source.h"
 
 namespace drake {
@@ -21,5 +23,25 @@ TYPED_TEST(SimulatorPrintStatsTest, Test) {
 
   PrintSimulatorStatistics(simulator);
 }
+
+// With profiling enabled, the simulator's scopes are timed and reported.
+GTEST_TEST(SimulatorPrintStatsProfileTest, Profile) {
+  ConstantVectorSource<double> source(2);
+  Simulator<double> simulator(source);
+  simulator.set_publish_every_time_step(true);
+  Profiler& profiler = Profiler::Global();
+  profiler.Reset();
+  profiler.set_enabled(true);
+  simulator.AdvanceTo(0.5);
+  source.get_output_port().Eval(simulator.get_context());
+  profiler.set_enabled(false);
+
+  const std::string report = profiler.FormatReport();
+  EXPECT_NE(report.find("Simulator::Initialize"), std::string::npos);
+  EXPECT_NE(report.find("Simulator::AdvanceTo"), std::string::npos);
+  EXPECT_NE(report.find("cache entry"), std::string::npos);
+  PrintSimulatorStatistics(simulator);
+  profiler.Reset();
+}
 }  // namespace systems
 }  // namespace drake
@@ -1,5 +1,6 @@
 #include "drake/systems/analysis/simulator.h"
 
+#include <array>
 #include <cmath>
 #include <complex>
 #include <functional>
@@ -950,6 +951,40 @@ GTEST_TEST(SimulatorTest, ResetIntegratorTest) {
   EXPECT_EQ(simulator.get_num_steps_taken(), 500);
 }
 
+// Repeated Reset() calls from a saved initial Context reproduce the same
+// trajectory while reusing the Simulator's own Context.
+GTEST_TEST(SimulatorTest, ResetFromInitialContext) {
+  analysis_test::MySpringMassSystem<double> spring_mass(300., 2., 0.);
+  Simulator<double> simulator(spring_mass);  // Use default Context.
+  simulator.reset_integrator<ExplicitEulerIntegrator<double>>(1e-3);
+  spring_mass.set_position(&simulator.get_mutable_context(), 0.1);
+  const std::unique_ptr<Context<double>> initial_context =
+      simulator.get_context().Clone();
+  const Context<double>* const context = &simulator.get_context();
+
+  simulator.Initialize();
+  simulator.AdvanceTo(0.5);
+  const double position = spring_mass.get_position(simulator.get_context());
+  const int num_steps = simulator.get_num_steps_taken();
+  ASSERT_NE(position, 0.1);
+
+  for (int i = 0; i < 3; ++i) {
+    simulator.Reset(*initial_context);
+    EXPECT_EQ(&simulator.get_context(), context);
+    EXPECT_EQ(simulator.get_context().get_time(), 0.);
+    EXPECT_EQ(spring_mass.get_position(simulator.get_context()), 0.1);
+    EXPECT_EQ(simulator.get_num_steps_taken(), 0);
+
+    simulator.AdvanceTo(0.5);
+    EXPECT_EQ(spring_mass.get_position(simulator.get_context()), position);
+    EXPECT_EQ(simulator.get_num_steps_taken(), num_steps);
+  }
+
+  simulator.release_context();
+  DRAKE_EXPECT_THROWS_MESSAGE(simulator.Reset(*initial_context),
+      ".*Reset.*Context.*not.*set.*");
+}
+
 // Because of arbitrary possible delays we can't do a very careful test of
 // the realtime rate control. However, we can at least say that the simulation
 // should not proceed much *faster* than the rate we select.
@@ -971,6 +1006,114 @@ GTEST_TEST(SimulatorTest, RealtimeRate) {
   EXPECT_TRUE(simulator.get_actual_realtime_rate() <= 5.1);
 }
 
+// A RealtimeClock that advances only when told to (or when waited on), which
+// lets us test realtime pacing deterministically.
+class FakeRealtimeClock final : public systems::RealtimeClock {
+ public:
+  explicit FakeRealtimeClock(double wake_latency)
+      : wake_latency_(wake_latency) {}
+
+  double Now() final { return now_; }
+
+  void WaitUntil(double time) final {
+    now_ = std::max(now_, time + wake_latency_);
+  }
+
+  void Advance(double duration) { now_ += duration; }
+
+ private:
+  const double wake_latency_;
+  double now_{100.0};
+};
+
+// Simulates 1 second in fixed steps of 0.01 seconds, at 1X real time, as if
+// each step took `step_cost` seconds of real time to compute.
+void SimulatePaced(double step_cost, FakeRealtimeClock* clock,
+                   Simulator<double>* simulator) {
+  simulator->reset_integrator<ExplicitEulerIntegrator<double>>(0.01);
+  simulator->set_target_realtime_rate(1.0);
+  simulator->Initialize();
+  simulator->set_monitor([clock, step_cost](const Context<double>&) {
+    clock->Advance(step_cost);
+    return EventStatus::Succeeded();
+  });
+  simulator->AdvanceTo(1.0);
+}
+
+GTEST_TEST(SimulatorTest, RealtimePacingMeetsDeadlines) {
+  analysis_test::MySpringMassSystem<double> spring_mass(1., 1., 0.);
+  Simulator<double> simulator(spring_mass);
+  auto clock = std::make_shared<FakeRealtimeClock>(2e-4);
+  simulator.set_realtime_clock(clock);
+  EXPECT_EQ(&simulator.get_mutable_realtime_clock(), clock.get());
+
+  // Each step is computed well within its time budget, so every step waits for
+  // its deadline and starts late only by the clock's wake-up latency.
+  SimulatePaced(0.005, clock.get(), &simulator);
+  const systems::RealtimePacingStatistics& stats =
+      simulator.get_realtime_pacing_statistics();
+  EXPECT_EQ(stats.num_paced_steps, simulator.get_num_steps_taken());
+  EXPECT_EQ(stats.num_missed_deadlines, 0);
+  EXPECT_EQ(stats.num_skipped_publish_steps, 0);
+  EXPECT_EQ(stats.max_overrun, 0.0);
+  EXPECT_NEAR(stats.mean_lateness(), 2e-4, 1e-12);
+  EXPECT_NEAR(stats.lateness_jitter(), 0.0, 1e-6);
+  EXPECT_NEAR(simulator.get_actual_realtime_rate(), 1.0, 0.01);
+
+  // The statistics are reset with the others; restoring the default clock
+  // leaves the statistics alone.
+  simulator.ResetStatistics();
+  EXPECT_EQ(simulator.get_realtime_pacing_statistics().num_paced_steps, 0);
+  simulator.set_realtime_clock(nullptr);
+  EXPECT_NE(&simulator.get_mutable_realtime_clock(), clock.get());
+}
+
+GTEST_TEST(SimulatorTest, RealtimePacingMissesDeadlines) {
+  analysis_test::MySpringMassSystem<double> spring_mass(1., 1., 0.);
+  Simulator<double> simulator(spring_mass);
+  auto clock = std::make_shared<FakeRealtimeClock>(0.0);
+  simulator.set_realtime_clock(clock);
+
+  // Each step takes 0.0133 seconds to compute its 0.01 simulated seconds, so
+  // the kth step (from zero) starts 0.0033 k seconds late.
+  SimulatePaced(0.0133, clock.get(), &simulator);
+  const systems::RealtimePacingStatistics& stats =
+      simulator.get_realtime_pacing_statistics();
+  const int64_t num_steps = simulator.get_num_steps_taken();
+  ASSERT_EQ(num_steps, 100);
+  EXPECT_EQ(stats.num_paced_steps, num_steps);
+  EXPECT_EQ(stats.num_missed_deadlines, num_steps - 1);
+  // Overruns of 0.0033 - 0.0099, 0.0132 - 0.099 and 0.1023 - 0.3267 seconds.
+  const std::array<int64_t, 5> expected_histogram{0, 0, 3, 27, 69};
+  EXPECT_EQ(stats.overrun_histogram, expected_histogram);
+  EXPECT_NEAR(stats.max_overrun, 0.0033 * 99, 1e-9);
+  EXPECT_NEAR(stats.mean_lateness(), 0.0033 * 99 / 2, 1e-9);
+  EXPECT_GT(stats.lateness_jitter(), 0.05);
+  EXPECT_EQ(stats.num_skipped_publish_steps, 0);
+}
+
+GTEST_TEST(SimulatorTest, RealtimePacingSkipsLatePublishes) {
+  analysis_test::MySpringMassSystem<double> spring_mass(1., 1., 0.);
+  Simulator<double> simulator(spring_mass);
+  auto clock = std::make_shared<FakeRealtimeClock>(0.0);
+  simulator.set_realtime_clock(clock);
+  simulator.set_publish_every_time_step(true);
+  EXPECT_EQ(simulator.get_max_publish_lateness(),
+            std::numeric_limits<double>::infinity());
+  EXPECT_THROW(simulator.set_max_publish_lateness(-1), std::exception);
+  simulator.set_max_publish_lateness(0.05);
+
+  // As above, the kth step starts 0.0033 k seconds late, so steps 16 and
+  // later don't publish.
+  SimulatePaced(0.0133, clock.get(), &simulator);
+  ASSERT_EQ(simulator.get_num_steps_taken(), 100);
+  EXPECT_EQ(simulator.get_num_publishes(), 16);
+  EXPECT_EQ(spring_mass.get_publish_count(), 16);
+  EXPECT_EQ(
+      simulator.get_realtime_pacing_statistics().num_skipped_publish_steps,
+      100 - 16);
+}
+
 // Tests that if publishing every timestep is disabled and publish on
 // initialization is enabled, publish only happens on initialization.
 GTEST_TEST(SimulatorTest, DisablePublishEveryTimestep) {
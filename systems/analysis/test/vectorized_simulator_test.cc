@@ -0,0 +1,124 @@
+#include "drake/systems/analysis/vectorized_simulator.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/primitives/integrator.h"
+#include "drake/systems/primitives/pass_through.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::MatrixXd;
+
+constexpr int kNumInstances = 5;
+constexpr double kControlPeriod = 0.25;
+
+// Each instance integrates its own constant input, so after n steps instance
+// i holds n * kControlPeriod * u_i.
+class VectorizedSimulatorTest : public ::testing::TestWithParam<int> {
+ protected:
+  VectorizedSimulatorTest()
+      : dut_(integrator_, kNumInstances, kControlPeriod,
+             Parallelism(GetParam())) {}
+
+  Integrator<double> integrator_{2};
+  VectorizedSimulator<double> dut_;
+};
+
+TEST_P(VectorizedSimulatorTest, Step) {
+  EXPECT_EQ(dut_.num_instances(), kNumInstances);
+  EXPECT_EQ(dut_.control_period(), kControlPeriod);
+  EXPECT_EQ(dut_.parallelism().num_threads(), GetParam());
+  EXPECT_EQ(&dut_.get_system(), &integrator_);
+
+  MatrixXd u(kNumInstances, 2);
+  for (int i = 0; i < kNumInstances; ++i) {
+    u.row(i) << i, -2.0 * i;
+  }
+  dut_.FixVectorInputPortValues(integrator_.get_input_port(), u);
+  dut_.Initialize();
+  EXPECT_TRUE(CompareMatrices(
+      dut_.EvalVectorOutputPort(integrator_.get_output_port()),
+      MatrixXd::Zero(kNumInstances, 2)));
+
+  dut_.Step();
+  dut_.Step();
+  for (int i = 0; i < kNumInstances; ++i) {
+    EXPECT_EQ(dut_.get_context(i).get_time(), 2 * kControlPeriod);
+  }
+  const MatrixXd x = dut_.EvalVectorOutputPort(integrator_.get_output_port());
+  EXPECT_TRUE(CompareMatrices(x, 2 * kControlPeriod * u, 1e-12));
+
+  // Later values overwrite the earlier ones in place.
+  const FixedInputPortValue* fixed =
+      dut_.get_context(1).MaybeGetFixedInputPortValue(0);
+  ASSERT_NE(fixed, nullptr);
+  dut_.FixVectorInputPortValues(integrator_.get_input_port(), -u);
+  EXPECT_EQ(dut_.get_context(1).MaybeGetFixedInputPortValue(0), fixed);
+  dut_.Step();
+  EXPECT_TRUE(CompareMatrices(
+      dut_.EvalVectorOutputPort(integrator_.get_output_port()),
+      kControlPeriod * u, 1e-12));
+}
+
+TEST_P(VectorizedSimulatorTest, IndependentInstances) {
+  dut_.FixVectorInputPortValues(integrator_.get_input_port(),
+                                MatrixXd::Ones(kNumInstances, 2));
+  dut_.Initialize();
+  dut_.Step();
+
+  // Reset one instance only.
+  dut_.get_mutable_context(3).SetTime(0);
+  integrator_.set_integral_value(&dut_.get_mutable_context(3),
+                                 Eigen::Vector2d(10, 20));
+  dut_.get_mutable_simulator(3).Initialize();
+  dut_.Step();
+
+  const MatrixXd x = dut_.EvalVectorOutputPort(integrator_.get_output_port());
+  for (int i = 0; i < kNumInstances; ++i) {
+    const Eigen::Vector2d expected =
+        (i == 3) ? Eigen::Vector2d(10.25, 20.25)
+                 : Eigen::Vector2d::Constant(2 * kControlPeriod);
+    EXPECT_TRUE(CompareMatrices(x.row(i).transpose(), expected, 1e-12));
+  }
+  EXPECT_EQ(dut_.get_context(3).get_time(), kControlPeriod);
+  EXPECT_EQ(dut_.get_context(0).get_time(), 2 * kControlPeriod);
+}
+
+TEST_P(VectorizedSimulatorTest, BadArguments) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut_.FixVectorInputPortValues(integrator_.get_input_port(),
+                                    MatrixXd::Zero(kNumInstances, 3)),
+      ".*expected a 5x2 matrix.*but got 5x3.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut_.FixVectorInputPortValues(integrator_.get_input_port(),
+                                    MatrixXd::Zero(1, 2)),
+      ".*expected a 5x2 matrix.*but got 1x2.*");
+
+  const PassThrough<double> other(2);
+  EXPECT_THROW(dut_.FixVectorInputPortValues(other.get_input_port(),
+                                             MatrixXd::Zero(kNumInstances, 2)),
+               std::exception);
+  EXPECT_THROW(dut_.EvalVectorOutputPort(other.get_output_port()),
+               std::exception);
+  EXPECT_THROW(dut_.get_simulator(kNumInstances), std::exception);
+  EXPECT_THROW(dut_.get_mutable_simulator(-1), std::exception);
+
+  // The input was never fixed, so no instance can be advanced.
+  EXPECT_THROW(dut_.Step(), std::exception);
+
+  EXPECT_THROW(VectorizedSimulator<double>(integrator_, 0, kControlPeriod),
+               std::exception);
+  EXPECT_THROW(VectorizedSimulator<double>(integrator_, 1, 0.0),
+               std::exception);
+}
+
+INSTANTIATE_TEST_SUITE_P(SerialAndParallel, VectorizedSimulatorTest,
+                         ::testing::Values(1, 2));
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,123 @@
+#include "drake/systems/analysis/vectorized_simulator.h"
+
+#include <exception>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/systems/framework/fixed_input_port_value.h"
+
+namespace drake {
+namespace systems {
+
+template <typename T>
+VectorizedSimulator<T>::VectorizedSimulator(const System<T>& system,
+                                            int num_instances,
+                                            double control_period,
+                                            Parallelism parallelism)
+    : system_(system),
+      control_period_(control_period),
+      parallelism_(parallelism) {
+  DRAKE_THROW_UNLESS(num_instances >= 1);
+  DRAKE_THROW_UNLESS(control_period > 0);
+  simulators_.reserve(num_instances);
+  for (int i = 0; i < num_instances; ++i) {
+    simulators_.push_back(std::make_unique<Simulator<T>>(system_));
+  }
+}
+
+template <typename T>
+VectorizedSimulator<T>::~VectorizedSimulator() = default;
+
+template <typename T>
+const Simulator<T>& VectorizedSimulator<T>::get_simulator(int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_instances());
+  return *simulators_[i];
+}
+
+template <typename T>
+Simulator<T>& VectorizedSimulator<T>::get_mutable_simulator(int i) {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_instances());
+  return *simulators_[i];
+}
+
+template <typename T>
+void VectorizedSimulator<T>::ForEachInstance(
+    const std::function<void(int)>& function) const {
+  std::vector<std::exception_ptr> errors(num_instances());
+  StaticParallelForIndexLoop(parallelism_, 0, num_instances(),
+                             [&](int, int i) {
+                               try {
+                                 function(i);
+                               } catch (...) {
+                                 errors[i] = std::current_exception();
+                               }
+                             });
+  for (const std::exception_ptr& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+template <typename T>
+void VectorizedSimulator<T>::Initialize() {
+  ForEachInstance([this](int i) {
+    simulators_[i]->Initialize();
+  });
+}
+
+template <typename T>
+void VectorizedSimulator<T>::Step() {
+  ForEachInstance([this](int i) {
+    Simulator<T>& simulator = *simulators_[i];
+    simulator.AdvanceTo(simulator.get_context().get_time() + control_period_);
+  });
+}
+
+template <typename T>
+void VectorizedSimulator<T>::FixVectorInputPortValues(
+    const InputPort<T>& port, const Eigen::Ref<const MatrixX<T>>& values) {
+  DRAKE_THROW_UNLESS(&port.get_system() == &system_);
+  DRAKE_THROW_UNLESS(port.get_data_type() == kVectorValued);
+  if (values.rows() != num_instances() || values.cols() != port.size()) {
+    throw std::logic_error(fmt::format(
+        "FixVectorInputPortValues(): expected a {}x{} matrix of values for "
+        "input port '{}', but got {}x{}.",
+        num_instances(), port.size(), port.get_name(), values.rows(),
+        values.cols()));
+  }
+  for (int i = 0; i < num_instances(); ++i) {
+    Context<T>& context = simulators_[i]->get_mutable_context();
+    FixedInputPortValue* fixed =
+        context.MaybeGetMutableFixedInputPortValue(port.get_index());
+    if (fixed != nullptr) {
+      // Overwriting in place spares the allocation of a new value, and only
+      // notifies the port's dependents.
+      fixed->GetMutableVectorData<T>()->SetFromVector(values.row(i));
+    } else {
+      port.FixValue(&context, VectorX<T>(values.row(i)));
+    }
+  }
+}
+
+template <typename T>
+MatrixX<T> VectorizedSimulator<T>::EvalVectorOutputPort(
+    const OutputPort<T>& port) const {
+  DRAKE_THROW_UNLESS(&port.get_system() == &system_);
+  DRAKE_THROW_UNLESS(port.get_data_type() == kVectorValued);
+  MatrixX<T> result(num_instances(), port.size());
+  ForEachInstance([&](int i) {
+    result.row(i) =
+        port.template Eval<BasicVector<T>>(simulators_[i]->get_context())
+            .value()
+            .transpose();
+  });
+  return result;
+}
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class drake::systems::VectorizedSimulator)
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/input_port.h"
+#include "drake/systems/framework/output_port.h"
+#include "drake/systems/framework/system.h"
+
+namespace drake {
+namespace systems {
+
+/// A set of independent simulations of the same System, each with its own
+/// Simulator and Context, that are advanced together. This is meant for
+/// workloads such as reinforcement learning, where many copies of one
+/// environment are stepped in lock step: a single call to Step() advances
+/// every instance by one control period, and vector-valued ports are read and
+/// written for all instances at once as matrices with one row per instance.
+///
+/// The instances share nothing but the (const) System. Step(),
+/// Initialize() and EvalVectorOutputPort() process the instances in parallel
+/// when a Parallelism greater than one is given; in that case the System must
+/// support concurrent evaluation in distinct Contexts, which is the case for
+/// all Drake systems that keep their state in the Context. The results do not
+/// depend on the degree of parallelism.
+///
+/// Each instance's Simulator can be reached (e.g., to change its integrator)
+/// through get_mutable_simulator().
+///
+/// @tparam_default_nonsymbolic_scalar
+template <typename T>
+class VectorizedSimulator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(VectorizedSimulator)
+
+  /// Creates `num_instances` simulators of `system`, each with its own default
+  /// Context. The %VectorizedSimulator holds an internal, non-owned reference
+  /// to `system`, which must outlive it.
+  /// @param control_period The amount of simulated time by which Step()
+  ///   advances each instance.
+  /// @param parallelism The number of threads used to process the instances.
+  /// @throws std::exception if num_instances < 1 or control_period <= 0.
+  VectorizedSimulator(const System<T>& system, int num_instances,
+                      double control_period,
+                      Parallelism parallelism = Parallelism::None());
+
+  ~VectorizedSimulator();
+
+  /// Returns the System being simulated.
+  const System<T>& get_system() const { return system_; }
+
+  /// Returns the number of independent instances.
+  int num_instances() const { return static_cast<int>(simulators_.size()); }
+
+  /// Returns the amount of simulated time by which Step() advances each
+  /// instance.
+  double control_period() const { return control_period_; }
+
+  /// Returns the degree of parallelism used to process the instances.
+  const Parallelism& parallelism() const { return parallelism_; }
+
+  /// Sets the degree of parallelism used to process the instances.
+  void set_parallelism(Parallelism parallelism) {
+    parallelism_ = parallelism;
+  }
+
+  /// Returns the Simulator of instance `i`.
+  /// @throws std::exception if `i` is out of range.
+  const Simulator<T>& get_simulator(int i) const;
+
+  /// Returns the mutable Simulator of instance `i`.
+  /// @throws std::exception if `i` is out of range.
+  Simulator<T>& get_mutable_simulator(int i);
+
+  /// Returns the Context of instance `i`.
+  /// @throws std::exception if `i` is out of range.
+  const Context<T>& get_context(int i) const {
+    return get_simulator(i).get_context();
+  }
+
+  /// Returns the mutable Context of instance `i`. After changing it, e.g., to
+  /// reset the instance, call get_mutable_simulator(i).Initialize().
+  /// @throws std::exception if `i` is out of range.
+  Context<T>& get_mutable_context(int i) {
+    return get_mutable_simulator(i).get_mutable_context();
+  }
+
+  /// Calls Simulator::Initialize() on every instance.
+  void Initialize();
+
+  /// Advances every instance from its current time `t` to
+  /// `t + control_period()`, using Simulator::AdvanceTo().
+  /// @throws std::exception if any instance's simulation fails; the other
+  ///   instances are still advanced, and the error of the lowest-numbered
+  ///   failing instance is reported.
+  void Step();
+
+  /// Fixes the value of the vector-valued input `port` of every instance:
+  /// instance `i` gets row `i` of `values`. After the first call for a given
+  /// port, later calls overwrite the fixed values in place.
+  /// @throws std::exception if `port` does not belong to get_system(), is not
+  ///   vector-valued, or if `values` is not num_instances() × port.size().
+  void FixVectorInputPortValues(const InputPort<T>& port,
+                                const Eigen::Ref<const MatrixX<T>>& values);
+
+  /// Evaluates the vector-valued output `port` of every instance, and returns
+  /// the values as a num_instances() × port.size() matrix whose row `i` comes
+  /// from instance `i`.
+  /// @throws std::exception if `port` does not belong to get_system() or is
+  ///   not vector-valued.
+  MatrixX<T> EvalVectorOutputPort(const OutputPort<T>& port) const;
+
+ private:
+  // Runs `function(i)` for every instance, using up to parallelism_ threads.
+  // If any call throws, all instances are still processed and the exception
+  // of the lowest-numbered failing instance is re-thrown.
+  void ForEachInstance(const std::function<void(int)>& function) const;
+
+  const System<T>& system_;
+  const double control_period_;
+  Parallelism parallelism_;
+  std::vector<std::unique_ptr<Simulator<T>>> simulators_;
+};
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class drake::systems::VectorizedSimulator)
@@ -1,7 +1,10 @@
 #include <benchmark/benchmark.h>
 
+#include "drake/common/test_utilities/limit_malloc.h"
+#include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/primitives/pass_through.h"
+#include "drake/systems/primitives/zero_order_hold.h"
 #include "drake/tools/performance/fixture_common.h"
 
 /* A collection of scenarios to benchmark, scoped to cover all code within the
@@ -62,6 +65,56 @@ BENCHMARK_F(BasicFixture, PassThrough3)(benchmark::State& state) {
   }
 }
 
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(BasicFixture, DiscreteSimulatorStep)(benchmark::State& state) {
+  const int n = 7;
+  const double time_step = 0.001;
+  auto* alpha = builder_->AddSystem<ZeroOrderHold<double>>(time_step, n);
+  auto* bravo = builder_->AddSystem<ZeroOrderHold<double>>(time_step, n);
+  auto* charlie = builder_->AddSystem<PassThrough<double>>(n);
+  builder_->Cascade(*alpha, *bravo);
+  builder_->Cascade(*bravo, *charlie);
+  builder_->Cascade(*charlie, *alpha);
+  Build();
+
+  Simulator<double> simulator(*diagram_, std::move(context_));
+  simulator.Initialize();
+  simulator.AdvanceTo(time_step);
+
+  // After the first step, advancing a discrete simulation must not allocate.
+  // See also simulator_limit_malloc_test.
+  test::LimitMalloc guard;
+  for (auto _ : state) {
+    simulator.AdvanceTo(simulator.get_context().get_time() + time_step);
+  }
+}
+
+// Times the invalidation sweep caused by changing the time of a wide Diagram,
+// where every subsystem's built-in cache entries depend on time. The argument
+// selects recursive (0) or bulk (1) invalidation.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(BasicFixture, WideTimeInvalidation)(
+    benchmark::State& state) {
+  const int num_systems = 100;
+  for (int i = 0; i < num_systems; ++i) {
+    builder_->AddSystem<PassThrough<double>>(1);
+  }
+  Build();
+  if (state.range(0)) {
+    context_->EnableBulkInvalidation();
+  }
+
+  double time = 0.0;
+  for (auto _ : state) {
+    time += 0.001;
+    context_->SetTime(time);
+  }
+}
+BENCHMARK_REGISTER_F(BasicFixture, WideTimeInvalidation)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(0)
+    ->Arg(1);
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
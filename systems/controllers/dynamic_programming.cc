@@ -1,6 +1,8 @@
 #include "drake/systems/controllers/dynamic_programming.h"
 
+#include <algorithm>
 #include <limits>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -9,11 +11,24 @@
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/solve.h"
 #include "drake/systems/analysis/simulator.h"
+#include "drake/systems/analysis/simulator_config_functions.h"
 
 namespace drake {
 namespace systems {
 namespace controllers {
 
+namespace {
+// The simulator used by one thread of FittedValueIteration to compute the
+// transitions, with the input value fixed in its context.
+struct TransitionWorker {
+  std::unique_ptr<Simulator<double>> owned_simulator;
+  Simulator<double>* simulator{};
+  BasicVector<double>* input_value{};
+  // The next state from the current mesh point, for every input.
+  Eigen::MatrixXd next_states;
+};
+}  // namespace
+
 DynamicProgrammingOptions::PeriodicBoundaryCondition::PeriodicBoundaryCondition(
     int state_index_in, double low_in, double high_in)
     : state_index(state_index_in), low(low_in), high(high_in) {
@@ -66,51 +81,77 @@ FittedValueIteration(
     DRAKE_DEMAND(b.high <= *(state_grid[b.state_index].rbegin()));
   }
 
-  // The transition probabilities are represented as a sparse matrix,
-  // where Tind[input](:,state) is a list of non-zero indexes into the
-  // state_mesh, and T[input](:,state) is the associated list of coefficients.
-  // cost[input](j) is the cost of taking action input from state mesh index j.
-  std::vector<Eigen::MatrixXi> Tind(num_inputs);
-  std::vector<Eigen::MatrixXd> T(num_inputs);
-  std::vector<Eigen::RowVectorXd> cost(num_inputs);
+  // The transition probabilities are represented as a sparse matrix, where
+  // Tind(:, j) is a list of non-zero indexes into the state_mesh, and T(:, j)
+  // is the associated list of coefficients, for the pair of state mesh index
+  // `state` and input mesh index `input` with j = state * num_inputs + input;
+  // cost(j) is the cost of the pair.  The pairs of a state are contiguous, so
+  // that the value iteration update of a state reads contiguous memory.
+  const Eigen::Index num_pairs = static_cast<Eigen::Index>(num_states) *
+                                 num_inputs;
+  Eigen::MatrixXi Tind(num_state_indices, num_pairs);
+  Eigen::MatrixXd T(num_state_indices, num_pairs);
+  Eigen::RowVectorXd cost(num_pairs);
+  auto pair_index = [num_inputs](int state, int input) {
+    return static_cast<Eigen::Index>(state) * num_inputs + input;
+  };
+
+  const int num_threads =
+      std::min(options.parallelism.num_threads(), num_states);
+  const Eigen::MatrixXd inputs = input_mesh.get_all_mesh_points();
 
   drake::log()->info("Computing transition and cost matrices.");
-  auto& sim_state = context.get_mutable_continuous_state_vector();
-
-  Eigen::VectorXd input_vec(input_mesh.get_input_size());
-  Eigen::VectorXd state_vec(state_mesh.get_input_size());
-
-  Eigen::VectorXi Tind_tmp(num_state_indices);
-  Eigen::VectorXd T_tmp(num_state_indices);
-
-  for (int input = 0; input < num_inputs; input++) {
-    Tind[input].resize(num_state_indices, num_states);
-    T[input].resize(num_state_indices, num_states);
-    cost[input].resize(num_states);
-
-    input_mesh.get_mesh_point(input, &input_vec);
-    input_port->FixValue(&context, input_vec);
-
-    for (int state = 0; state < num_states; state++) {
-      context.SetTime(0.0);
-      sim_state.SetFromVector(state_mesh.get_mesh_point(state));
-      simulator->Initialize();
-
-      cost[input](state) = timestep * cost_function(context);
-
-      simulator->AdvanceTo(timestep);
-      state_vec = sim_state.CopyToVector();
-
-      for (const auto& b : options.periodic_boundary_conditions) {
-        state_vec[b.state_index] =
-            math::wrap_to(state_vec[b.state_index], b.low, b.high);
-      }
-
-      state_mesh.EvalBarycentricWeights(state_vec, &Tind_tmp, &T_tmp);
-      Tind[input].col(state) = Tind_tmp;
-      T[input].col(state) = T_tmp;
+  std::vector<TransitionWorker> workers(num_threads);
+  for (int i = 0; i < num_threads; i++) {
+    TransitionWorker& worker = workers[i];
+    if (i == 0) {
+      worker.simulator = simulator;
+    } else {
+      worker.owned_simulator =
+          std::make_unique<Simulator<double>>(system, context.Clone());
+      ApplySimulatorConfig(worker.owned_simulator.get(),
+                           ExtractSimulatorConfig(*simulator));
+      worker.simulator = worker.owned_simulator.get();
     }
+    worker.input_value =
+        input_port
+            ->FixValue(&worker.simulator->get_mutable_context(),
+                       Eigen::VectorXd(inputs.col(0)))
+            .GetMutableVectorData<double>();
+    worker.next_states.resize(state_size, num_inputs);
   }
+
+  StaticParallelForIndexLoop(
+      Parallelism(num_threads), 0, num_states,
+      [&](int thread_num, int state) {
+        TransitionWorker& worker = workers[thread_num];
+        Context<double>& worker_context =
+            worker.simulator->get_mutable_context();
+        auto& sim_state = worker_context.get_mutable_continuous_state_vector();
+        for (int input = 0; input < num_inputs; input++) {
+          worker.input_value->SetFromVector(inputs.col(input));
+          worker_context.SetTime(0.0);
+          sim_state.SetFromVector(state_mesh.get_mesh_point(state));
+          worker.simulator->Initialize();
+
+          cost(pair_index(state, input)) =
+              timestep * cost_function(worker_context);
+
+          worker.simulator->AdvanceTo(timestep);
+          auto next_state = worker.next_states.col(input);
+          next_state = sim_state.CopyToVector();
+
+          for (const auto& b : options.periodic_boundary_conditions) {
+            next_state[b.state_index] =
+                math::wrap_to(next_state[b.state_index], b.low, b.high);
+          }
+        }
+        auto Tind_block = Tind.middleCols(pair_index(state, 0), num_inputs);
+        auto T_block = T.middleCols(pair_index(state, 0), num_inputs);
+        state_mesh.EvalBarycentricWeightsBatch(worker.next_states, &Tind_block,
+                                               &T_block);
+      });
+  workers.clear();
   drake::log()->info("Done computing transition and cost matrices.");
 
   // Perform value iteration loop.
@@ -122,26 +163,30 @@ FittedValueIteration(
   double max_diff = std::numeric_limits<double>::infinity();
   int iteration = 0;
   while (max_diff > options.convergence_tol) {
-    for (int state = 0; state < num_states; state++) {
-      Jnext(state) = std::numeric_limits<double>::infinity();
-
-      int best_input = 0;
-      for (int input = 0; input < num_inputs; input++) {
-        // Q(x,u) = g(x,u) + γ J(f(x,u)).
-        double Q = cost[input](state);
-        for (int index = 0; index < num_state_indices; index++) {
-          Q += options.discount_factor * T[input](index, state) *
-               J(Tind[input](index, state));
-        }
-        // Cost-to-go: J = minᵤ Q(x,u).
-        // Policy:  π(x) = argminᵤ Q(x,u).
-        if (Q < Jnext(state)) {
-          Jnext(state) = Q;
-          best_input = input;
-        }
-      }
-      Pi.col(state) = input_mesh.get_mesh_point(best_input);
-    }
+    // The update of each state only reads J, so the states are updated
+    // concurrently.
+    StaticParallelForIndexLoop(
+        Parallelism(num_threads), 0, num_states, [&](int, int state) {
+          Jnext(state) = std::numeric_limits<double>::infinity();
+
+          int best_input = 0;
+          for (int input = 0; input < num_inputs; input++) {
+            const Eigen::Index pair = pair_index(state, input);
+            // Q(x,u) = g(x,u) + γ J(f(x,u)).
+            double Q = cost(pair);
+            for (int index = 0; index < num_state_indices; index++) {
+              Q += options.discount_factor * T(index, pair) *
+                   J(Tind(index, pair));
+            }
+            // Cost-to-go: J = minᵤ Q(x,u).
+            // Policy:  π(x) = argminᵤ Q(x,u).
+            if (Q < Jnext(state)) {
+              Jnext(state) = Q;
+              best_input = input;
+            }
+          }
+          Pi.col(state) = inputs.col(best_input);
+        });
     max_diff = (J - Jnext).lpNorm<Eigen::Infinity>();
     J = Jnext;
     iteration++;
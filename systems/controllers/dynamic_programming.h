@@ -6,6 +6,7 @@
 #include <utility>
 #include <variant>
 
+#include "drake/common/parallelism.h"
 #include "drake/common/symbolic.h"
 #include "drake/math/barycentric.h"
 #include "drake/systems/analysis/simulator.h"
@@ -66,6 +67,16 @@ struct DynamicProgrammingOptions {
   /// the dynamics of the additional state variables cannot impact the dynamics
   /// of the continuous states.  @default false.
   bool assume_non_continuous_states_are_fixed{false};
+
+  /// The maximum number of threads used by FittedValueIteration, both to
+  /// simulate the transitions from the mesh points and to sweep the value
+  /// iteration updates over them.  Each additional thread simulates with its
+  /// own Simulator, on a clone of the given Context, configured as the given
+  /// Simulator according to ExtractSimulatorConfig(); its integrator must
+  /// therefore be one of the integration schemes of SimulatorConfig, and the
+  /// cost function must be safe to call concurrently on different Contexts.
+  /// The result does not depend on the number of threads.  @default None.
+  Parallelism parallelism{Parallelism::None()};
 };
 
 /// Implements Fitted Value Iteration on a (triangulated) Barycentric Mesh,
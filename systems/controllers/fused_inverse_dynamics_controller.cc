@@ -0,0 +1,187 @@
+#include "drake/systems/controllers/fused_inverse_dynamics_controller.h"
+
+#include <utility>
+
+using drake::multibody::MultibodyForces;
+using drake::multibody::MultibodyPlant;
+
+namespace drake {
+namespace systems {
+namespace controllers {
+
+template <typename T>
+void FusedInverseDynamicsController<T>::SetUp(const VectorX<double>& kp,
+                                              const VectorX<double>& ki,
+                                              const VectorX<double>& kd) {
+  const MultibodyPlant<T>& plant = *multibody_plant_for_control_;
+  DRAKE_THROW_UNLESS(plant.is_finalized());
+
+  const int num_positions = plant.num_positions();
+  const int num_velocities = plant.num_velocities();
+  DRAKE_THROW_UNLESS(num_positions == num_velocities);
+  DRAKE_THROW_UNLESS(num_positions == plant.num_actuators());
+  DRAKE_THROW_UNLESS(kp.size() == num_positions);
+  DRAKE_THROW_UNLESS(ki.size() == num_positions);
+  DRAKE_THROW_UNLESS(kd.size() == num_positions);
+  kp_ = kp.cast<T>();
+  ki_ = ki.cast<T>();
+  kd_ = kd.cast<T>();
+
+  // The integral of the position error.
+  this->DeclareContinuousState(num_positions);
+
+  input_port_index_estimated_state_ =
+      this->DeclareVectorInputPort("estimated_state",
+                                   num_positions + num_velocities)
+          .get_index();
+  input_port_index_desired_state_ =
+      this->DeclareVectorInputPort("desired_state",
+                                   num_positions + num_velocities)
+          .get_index();
+  if (has_reference_acceleration_) {
+    input_port_index_desired_acceleration_ =
+        this->DeclareVectorInputPort("desired_acceleration", num_velocities)
+            .get_index();
+  }
+  output_port_index_control_ =
+      this->DeclareVectorOutputPort(
+              "force", num_velocities,
+              &FusedInverseDynamicsController<T>::CalcOutputForce)
+          .get_index();
+
+  multibody_plant_context_cache_index_ =
+      this->DeclareCacheEntry(
+              "multibody_plant_context_cache", *plant.CreateDefaultContext(),
+              &FusedInverseDynamicsController<T>::SetMultibodyContext,
+              {this->input_port_ticket(input_port_index_estimated_state_)})
+          .cache_index();
+  external_forces_cache_index_ =
+      this->DeclareCacheEntry(
+              "external_forces_cache", MultibodyForces<T>(plant),
+              &FusedInverseDynamicsController<T>::CalcMultibodyForces,
+              {this->cache_entry_ticket(multibody_plant_context_cache_index_)})
+          .cache_index();
+
+  // The scratch entry is never evaluated, only written through; it exists so
+  // that each context owns its buffers.
+  Scratch scratch;
+  scratch.vd_d.resize(num_velocities);
+  scratch.A_WB.resize(plant.num_bodies());
+  scratch.F_BMo_W.resize(plant.num_bodies());
+  scratch_cache_index_ =
+      this->DeclareCacheEntry("scratch",
+                              ValueProducer(scratch, &ValueProducer::NoopCalc),
+                              {this->nothing_ticket()})
+          .cache_index();
+}
+
+template <typename T>
+FusedInverseDynamicsController<T>::FusedInverseDynamicsController(
+    const MultibodyPlant<T>& plant, const VectorX<double>& kp,
+    const VectorX<double>& ki, const VectorX<double>& kd,
+    bool has_reference_acceleration)
+    : multibody_plant_for_control_(&plant),
+      has_reference_acceleration_(has_reference_acceleration) {
+  SetUp(kp, ki, kd);
+}
+
+template <typename T>
+FusedInverseDynamicsController<T>::FusedInverseDynamicsController(
+    std::unique_ptr<MultibodyPlant<T>> plant, const VectorX<double>& kp,
+    const VectorX<double>& ki, const VectorX<double>& kd,
+    bool has_reference_acceleration)
+    : owned_plant_for_control_(std::move(plant)),
+      multibody_plant_for_control_(owned_plant_for_control_.get()),
+      has_reference_acceleration_(has_reference_acceleration) {
+  DRAKE_THROW_UNLESS(multibody_plant_for_control_ != nullptr);
+  SetUp(kp, ki, kd);
+}
+
+template <typename T>
+FusedInverseDynamicsController<T>::~FusedInverseDynamicsController() =
+    default;
+
+template <typename T>
+void FusedInverseDynamicsController<T>::set_integral_value(
+    Context<T>* context, const Eigen::Ref<const VectorX<T>>& value) const {
+  this->ValidateContext(context);
+  VectorBase<T>& state_vector = context->get_mutable_continuous_state_vector();
+  DRAKE_THROW_UNLESS(value.size() == state_vector.size());
+  state_vector.SetFromVector(value);
+}
+
+template <typename T>
+void FusedInverseDynamicsController<T>::DoCalcTimeDerivatives(
+    const Context<T>& context, ContinuousState<T>* derivatives) const {
+  const int num_positions = multibody_plant_for_control_->num_positions();
+  const VectorX<T>& x = get_input_port_estimated_state().Eval(context);
+  const VectorX<T>& x_d = get_input_port_desired_state().Eval(context);
+
+  // The derivative of the continuous state is the position error.
+  derivatives->get_mutable_vector().SetFromVector(x_d.head(num_positions) -
+                                                  x.head(num_positions));
+}
+
+template <typename T>
+void FusedInverseDynamicsController<T>::SetMultibodyContext(
+    const Context<T>& context, Context<T>* multibody_plant_context) const {
+  const VectorX<T>& x = get_input_port_estimated_state().Eval(context);
+  multibody_plant_for_control_->SetPositionsAndVelocities(
+      multibody_plant_context, x);
+}
+
+template <typename T>
+void FusedInverseDynamicsController<T>::CalcMultibodyForces(
+    const Context<T>& context, MultibodyForces<T>* cache_value) const {
+  const auto& multibody_plant_context =
+      this->get_cache_entry(multibody_plant_context_cache_index_)
+          .template Eval<Context<T>>(context);
+  multibody_plant_for_control_->CalcForceElementsContribution(
+      multibody_plant_context, cache_value);
+}
+
+template <typename T>
+void FusedInverseDynamicsController<T>::CalcOutputForce(
+    const Context<T>& context, BasicVector<T>* output) const {
+  const int num_positions = multibody_plant_for_control_->num_positions();
+  const VectorX<T>& x = get_input_port_estimated_state().Eval(context);
+  const VectorX<T>& x_d = get_input_port_desired_state().Eval(context);
+  const VectorX<T>& q_int =
+      dynamic_cast<const BasicVector<T>&>(context.get_continuous_state_vector())
+          .value();
+
+  Scratch& scratch =
+      this->get_cache_entry(scratch_cache_index_)
+          .get_mutable_cache_entry_value(context)
+          .template GetMutableValueOrThrow<Scratch>();
+
+  // vd_d = kp(q* - q) + kd(v* - v) + ki int(q* - q) + vd*, formed in place.
+  scratch.vd_d.array() =
+      kp_.array() * (x_d.head(num_positions) - x.head(num_positions)).array() +
+      kd_.array() * (x_d.tail(num_positions) - x.tail(num_positions)).array() +
+      ki_.array() * q_int.array();
+  if (has_reference_acceleration_) {
+    scratch.vd_d += get_input_port_desired_acceleration().Eval(context);
+  }
+
+  const auto& multibody_plant_context =
+      this->get_cache_entry(multibody_plant_context_cache_index_)
+          .template Eval<Context<T>>(context);
+  const auto& external_forces =
+      this->get_cache_entry(external_forces_cache_index_)
+          .template Eval<MultibodyForces<T>>(context);
+
+  // Run the recursive Newton-Euler pass straight into the output.
+  auto tau = output->get_mutable_value();
+  multibody::internal::GetInternalTree(*multibody_plant_for_control_)
+      .CalcInverseDynamics(multibody_plant_context, scratch.vd_d,
+                           external_forces.body_forces(),
+                           external_forces.generalized_forces(),
+                           &scratch.A_WB, &scratch.F_BMo_W, &tau);
+}
+
+template class FusedInverseDynamicsController<double>;
+
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
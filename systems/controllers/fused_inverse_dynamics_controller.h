@@ -0,0 +1,177 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/controllers/state_feedback_controller_interface.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace controllers {
+
+// N.B. Inheritance order must remain fixed for pydrake (#9243).
+/**
+ * A single-system equivalent of InverseDynamicsController: it computes the
+ * same output
+ * `torque = inverse_dynamics(q, v, vd_d)`,
+ * where `vd_d = kp(q* - q) + kd(v* - v) + ki int(q* - q) + vd*`,
+ * but as one LeafSystem rather than as a Diagram of a PidController, an Adder
+ * and an InverseDynamics system.
+ *
+ * @system
+ * name: FusedInverseDynamicsController
+ * input_ports:
+ * - estimated_state
+ * - desired_state
+ * - <span style="color:gray">desired_acceleration</span>
+ * output_ports:
+ * - force
+ * @endsystem
+ *
+ * Ports show in <span style="color:gray">gray</span> may be absent, depending
+ * on how the system is constructed.
+ *
+ * The ports, the integral state and the restrictions on the plant are those
+ * of InverseDynamicsController, so that this system can replace it as is.
+ * Evaluating the output evaluates each input port once, forms `vd_d` in place
+ * and runs the recursive Newton-Euler inverse dynamics directly on buffers
+ * that are allocated with the context, so that a control tick does no heap
+ * allocation beyond what MultibodyPlant's own caches do. The plant context
+ * and the contribution of the force elements are cached on the estimated
+ * state, as in InverseDynamics.
+ *
+ * @tparam_double_only
+ * @ingroup control_systems
+ */
+template <typename T>
+class FusedInverseDynamicsController
+    : public LeafSystem<T>,
+      public StateFeedbackControllerInterface<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(FusedInverseDynamicsController)
+
+  /**
+   * Constructs a fused inverse dynamics controller for the given `plant`
+   * model. The %FusedInverseDynamicsController holds an internal, non-owned
+   * reference to the MultibodyPlant object so you must ensure that `plant` has
+   * a longer lifetime than `this` %FusedInverseDynamicsController.
+   * @param plant The model of the plant for control.
+   * @param kp Position gain.
+   * @param ki Integral gain.
+   * @param kd Velocity gain.
+   * @param has_reference_acceleration If true, there is an extra BasicVector
+   * input port for `vd*`. If false, `vd*` is treated as zero, and no extra
+   * input port is declared.
+   * @throws std::exception if
+   *  - The plant is not finalized (see MultibodyPlant::Finalize()).
+   *  - The number of generalized velocities is not equal to the number of
+   *    generalized positions.
+   *  - The model is not fully actuated.
+   *  - Vector kp, ki and kd do not all have the same size equal to the number
+   *    of generalized positions.
+   */
+  FusedInverseDynamicsController(const multibody::MultibodyPlant<T>& plant,
+                                 const VectorX<double>& kp,
+                                 const VectorX<double>& ki,
+                                 const VectorX<double>& kd,
+                                 bool has_reference_acceleration);
+
+  /**
+   * Constructs a fused inverse dynamics controller and takes the ownership of
+   * the input `plant`.
+   */
+  FusedInverseDynamicsController(
+      std::unique_ptr<multibody::MultibodyPlant<T>> plant,
+      const VectorX<double>& kp, const VectorX<double>& ki,
+      const VectorX<double>& kd, bool has_reference_acceleration);
+
+  ~FusedInverseDynamicsController() override;
+
+  /**
+   * Sets the integral of the position error to @p value.
+   * @p value must be a column vector of the appropriate size.
+   */
+  void set_integral_value(Context<T>* context,
+                          const Eigen::Ref<const VectorX<T>>& value) const;
+
+  /**
+   * Returns the input port for the reference acceleration.
+   */
+  const InputPort<T>& get_input_port_desired_acceleration() const {
+    DRAKE_DEMAND(has_reference_acceleration_);
+    return this->get_input_port(input_port_index_desired_acceleration_);
+  }
+
+  /**
+   * Returns the input port for the estimated state.
+   */
+  const InputPort<T>& get_input_port_estimated_state() const final {
+    return this->get_input_port(input_port_index_estimated_state_);
+  }
+
+  /**
+   * Returns the input port for the desired state.
+   */
+  const InputPort<T>& get_input_port_desired_state() const final {
+    return this->get_input_port(input_port_index_desired_state_);
+  }
+
+  /**
+   * Returns the output port for computed control.
+   */
+  const OutputPort<T>& get_output_port_control() const final {
+    return this->get_output_port(output_port_index_control_);
+  }
+
+  /**
+   * Returns a constant pointer to the MultibodyPlant used for control.
+   */
+  const multibody::MultibodyPlant<T>* get_multibody_plant_for_control() const {
+    return multibody_plant_for_control_;
+  }
+
+ private:
+  // Buffers for the output calculation, allocated once per context.
+  struct Scratch {
+    VectorX<T> vd_d;
+    std::vector<multibody::SpatialAcceleration<T>> A_WB;
+    std::vector<multibody::SpatialForce<T>> F_BMo_W;
+  };
+
+  void SetUp(const VectorX<double>& kp, const VectorX<double>& ki,
+             const VectorX<double>& kd);
+
+  void DoCalcTimeDerivatives(const Context<T>& context,
+                             ContinuousState<T>* derivatives) const final;
+
+  // This is the calculator method for the output port.
+  void CalcOutputForce(const Context<T>& context,
+                       BasicVector<T>* force) const;
+
+  // Methods for updating cache entries.
+  void SetMultibodyContext(const Context<T>&, Context<T>*) const;
+  void CalcMultibodyForces(const Context<T>&,
+                           multibody::MultibodyForces<T>*) const;
+
+  const std::unique_ptr<multibody::MultibodyPlant<T>>
+      owned_plant_for_control_{};
+  const multibody::MultibodyPlant<T>* multibody_plant_for_control_{nullptr};
+  const bool has_reference_acceleration_{false};
+  VectorX<T> kp_;
+  VectorX<T> ki_;
+  VectorX<T> kd_;
+  InputPortIndex input_port_index_estimated_state_;
+  InputPortIndex input_port_index_desired_state_;
+  InputPortIndex input_port_index_desired_acceleration_;
+  OutputPortIndex output_port_index_control_;
+  CacheIndex multibody_plant_context_cache_index_;
+  CacheIndex external_forces_cache_index_;
+  CacheIndex scratch_cache_index_;
+};
+
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
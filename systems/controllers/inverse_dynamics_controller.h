@@ -55,6 +55,8 @@ namespace controllers {
  *
  * @see InverseDynamics for an accounting of all forces incorporated into the
  *      inverse dynamics computation.
+ * @see FusedInverseDynamicsController for a single-system equivalent with a
+ *      lower per-evaluation cost.
  *
  * @tparam_double_only
  * @ingroup control_systems
@@ -4,15 +4,30 @@
 #include <utility>
 
 #include "drake/common/eigen_types.h"
-#include "drake/solvers/solve.h"
-#include "drake/systems/trajectory_optimization/direct_transcription.h"
+#include "drake/solvers/fbstab/fbstab_mpc.h"
 
 namespace drake {
 namespace systems {
 namespace controllers {
 
-using solvers::VectorXDecisionVariable;
-using trajectory_optimization::DirectTranscription;
+using solvers::fbstab::FBstabAlgoMpc;
+using solvers::fbstab::FBstabMpc;
+
+namespace {
+// FBstabMpc needs at least one inequality constraint per stage. The problem
+// has none, so each stage gets the trivially satisfied constraint 0 ≤ 1.
+constexpr int kNumStageConstraints = 1;
+
+// Writes into `shifted` the stage-wise vector `previous`, made of stages of
+// size `n`, advanced by one stage, with the last stage repeated.
+void ShiftStages(const Eigen::VectorXd& previous, int n,
+                 Eigen::VectorXd* shifted) {
+  const int size = previous.size();
+  shifted->resize(size);
+  shifted->head(size - n) = previous.tail(size - n);
+  shifted->tail(n) = previous.tail(n);
+}
+}  // namespace
 
 template <typename T>
 LinearModelPredictiveController<T>::LinearModelPredictiveController(
@@ -62,20 +77,55 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
     throw std::runtime_error("R must be positive definite");
   }
 
-  this->DeclarePeriodicDiscreteUpdate(time_period_);
+  warm_start_index_ = this->DeclareAbstractState(Value<QpSolution>{});
+  this->DeclarePeriodicUnrestrictedUpdateEvent(
+      time_period_, 0., &LinearModelPredictiveController<T>::UpdateWarmStart);
+  qp_solution_cache_index_ =
+      this->DeclareCacheEntry(
+              "qp_solution",
+              &LinearModelPredictiveController<T>::CalcQpSolution,
+              {this->input_port_ticket(get_state_port().get_index()),
+               this->abstract_state_ticket(warm_start_index_)})
+          .cache_index();
 
   if (base_context_ != nullptr) {
     linear_model_ = Linearize(*model_, *base_context_);
+
+    // The running cost is imposed on the states and inputs of every sample
+    // time but the last one, where the input is unconstrained; its cost R
+    // only makes it unique.
+    const int num_sample_times =
+        static_cast<int>(time_horizon_ / time_period_ + 0.5);
+    DRAKE_DEMAND(num_sample_times >= 2);
+    horizon_ = num_sample_times - 1;
+    const int nx = num_states_;
+    const int nu = num_inputs_;
+    for (int i = 0; i <= horizon_; ++i) {
+      stages_.Q.push_back(i < horizon_ ? Q_ : Eigen::MatrixXd::Zero(nx, nx));
+      stages_.R.push_back(R_);
+      stages_.S.push_back(Eigen::MatrixXd::Zero(nu, nx));
+      stages_.q.push_back(Eigen::VectorXd::Zero(nx));
+      stages_.r.push_back(Eigen::VectorXd::Zero(nu));
+      stages_.E.push_back(Eigen::MatrixXd::Zero(kNumStageConstraints, nx));
+      stages_.L.push_back(Eigen::MatrixXd::Zero(kNumStageConstraints, nu));
+      stages_.d.push_back(Eigen::VectorXd::Constant(kNumStageConstraints, -1));
+      if (i < horizon_) {
+        stages_.A.push_back(linear_model_->A());
+        stages_.B.push_back(linear_model_->B());
+        stages_.c.push_back(Eigen::VectorXd::Zero(nx));
+      }
+    }
   }
 }
 
 template <typename T>
 void LinearModelPredictiveController<T>::CalcControl(
     const Context<T>& context, BasicVector<T>* control) const {
-  const VectorX<T>& current_state = get_state_port().Eval(context);
-
-  const Eigen::VectorXd current_input =
-      SetupAndSolveQp(*base_context_, current_state);
+  const QpSolution& solution =
+      this->get_cache_entry(qp_solution_cache_index_)
+          .template Eval<QpSolution>(context);
+  // u(0) follows x(0) in z.
+  const VectorX<T> current_input = solution.z.segment(num_states_, num_inputs_);
 
   const VectorX<T> input_ref = model_->get_input_port(0).Eval(*base_context_);
 
@@ -85,32 +135,56 @@ void LinearModelPredictiveController<T>::CalcControl(
 }
 
 template <typename T>
-VectorX<T> LinearModelPredictiveController<T>::SetupAndSolveQp(
-    const Context<T>& base_context, const VectorX<T>& current_state) const {
+void LinearModelPredictiveController<T>::CalcQpSolution(
+    const Context<T>& context, QpSolution* solution) const {
   DRAKE_DEMAND(linear_model_ != nullptr);
 
-  const int kNumSampleTimes =
-      static_cast<int>(time_horizon_ / time_period_ + 0.5);
-
-  DirectTranscription dirtran(linear_model_.get(), *base_context_,
-                              kNumSampleTimes);
-  auto& prog = dirtran.prog();
-
-  const auto state_error = dirtran.state();
-  const auto input_error = dirtran.input();
-
-  dirtran.AddRunningCost(state_error.transpose() * Q_ * state_error +
-                         input_error.transpose() * R_ * input_error);
-
+  const VectorX<T>& current_state = get_state_port().Eval(context);
   const VectorX<T> state_ref =
-      base_context.get_discrete_state().get_vector().CopyToVector();
-  prog.AddLinearConstraint(dirtran.initial_state() ==
-                           current_state - state_ref);
-
-  const auto result = Solve(prog);
-  DRAKE_DEMAND(result.is_success());
+      base_context_->get_discrete_state().get_vector().CopyToVector();
+  const Eigen::VectorXd x0 = current_state - state_ref;
+
+  // Warm start from the solution of the previous control period, advanced
+  // by one stage.
+  const int nx = num_states_;
+  const int nu = num_inputs_;
+  const int num_stages = horizon_ + 1;
+  const QpSolution& previous =
+      context.template get_abstract_state<QpSolution>(warm_start_index_);
+  const bool warm_start = previous.z.size() == (nx + nu) * num_stages;
+  if (warm_start) {
+    ShiftStages(previous.z, nx + nu, &solution->z);
+    ShiftStages(previous.l, nx, &solution->l);
+    ShiftStages(previous.v, kNumStageConstraints, &solution->v);
+  } else {
+    solution->z.setZero((nx + nu) * num_stages);
+    solution->l.setZero(nx * num_stages);
+    solution->v.setZero(kNumStageConstraints * num_stages);
+  }
+  // The solver recomputes the constraint margins from z.
+  solution->y.resize(kNumStageConstraints * num_stages);
+
+  const FBstabMpc::QPData data{
+      &stages_.Q, &stages_.R, &stages_.S, &stages_.q, &stages_.r, &stages_.A,
+      &stages_.B, &stages_.c, &stages_.E, &stages_.L, &stages_.d, &x0};
+  const FBstabMpc::QPVariable variable{&solution->z, &solution->l,
+                                       &solution->v, &solution->y};
+  FBstabMpc solver(horizon_, nx, nu, kNumStageConstraints);
+  solver.SetDisplayLevel(FBstabAlgoMpc::Display::OFF);
+  // A cold start is the zero initial guess set above; FBstabMpc can't zero
+  // the variables itself before it has linked them to the data.
+  const solvers::fbstab::SolverOut out =
+      solver.Solve(data, &variable, true /* use_initial_guess */);
+  DRAKE_DEMAND(out.eflag == solvers::fbstab::ExitFlag::SUCCESS);
+}
 
-  return dirtran.GetInputSamples(result).col(0);
+template <typename T>
+void LinearModelPredictiveController<T>::UpdateWarmStart(
+    const Context<T>& context, State<T>* state) const {
+  if (linear_model_ == nullptr) return;
+  state->template get_mutable_abstract_state<QpSolution>(warm_start_index_) =
+      this->get_cache_entry(qp_solution_cache_index_)
+          .template Eval<QpSolution>(context);
 }
 
 template class LinearModelPredictiveController<double>;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
@@ -23,9 +24,13 @@ namespace controllers {
 ///
 /// and subject to linear inequality constraints on the inputs and states, where
 /// N is the horizon length, Q and R are cost matrices, and xd and ud are the
-/// desired states and inputs, respectively.  Note that the present
-/// implementation solves the QP in whole at every time step, discarding any
-/// information between steps.
+/// desired states and inputs, respectively.
+///
+/// The QP is solved with solvers::fbstab::FBstabMpc, which exploits its
+/// stage-wise structure: the cost of a solve grows linearly with the horizon.
+/// The stage data is built once, at construction. The solution is stored in
+/// the controller's abstract state at every control period, and the next
+/// solve is warm started from it, shifted by one stage.
 ///
 /// @system
 /// name: LinearModelPredictiveController
@@ -82,12 +87,41 @@ class LinearModelPredictiveController : public LeafSystem<T> {
   }
 
  private:
+  // The solution of the QP in the layout of FBstabMpc: the primal variables
+  // z = (x(0), u(0), ..., x(N), u(N)), the costates l, and the duals v and
+  // margins y of the inequality constraints. All are empty if there is no
+  // solution yet.
+  struct QpSolution {
+    Eigen::VectorXd z;
+    Eigen::VectorXd l;
+    Eigen::VectorXd v;
+    Eigen::VectorXd y;
+  };
+
+  // The stage-wise data of the QP, in the layout of FBstabMpc. It does not
+  // depend on the current state.
+  struct StageData {
+    std::vector<Eigen::MatrixXd> Q;
+    std::vector<Eigen::MatrixXd> R;
+    std::vector<Eigen::MatrixXd> S;
+    std::vector<Eigen::VectorXd> q;
+    std::vector<Eigen::VectorXd> r;
+    std::vector<Eigen::MatrixXd> A;
+    std::vector<Eigen::MatrixXd> B;
+    std::vector<Eigen::VectorXd> c;
+    std::vector<Eigen::MatrixXd> E;
+    std::vector<Eigen::MatrixXd> L;
+    std::vector<Eigen::VectorXd> d;
+  };
+
   void CalcControl(const Context<T>& context, BasicVector<T>* control) const;
 
-  // Sets up a DirectTranscription problem and solves for the current control
-  // input.
-  VectorX<T> SetupAndSolveQp(const Context<T>& base_context,
-                             const VectorX<T>& current_state) const;
+  // Solves the QP for the current state, warm started from the solution
+  // stored in the state.
+  void CalcQpSolution(const Context<T>& context, QpSolution* solution) const;
+
+  // Stores the current solution of the QP, to warm start the next one.
+  void UpdateWarmStart(const Context<T>& context, State<T>* state) const;
 
   const int state_input_index_{-1};
   const int control_output_index_{-1};
@@ -107,6 +141,13 @@ class LinearModelPredictiveController : public LeafSystem<T> {
 
   // Descrption of the linearized plant model.
   std::unique_ptr<LinearSystem<double>> linear_model_;
+
+  // The number of stages of the QP after the initial one.
+  int horizon_{};
+  StageData stages_;
+
+  AbstractStateIndex warm_start_index_;
+  CacheIndex qp_solution_cache_index_;
 };
 
 }  // namespace controllers
@@ -202,6 +202,58 @@ GTEST_TEST(FittedValueIteration, DoubleIntegrator) {
   }
 }
 
+// The result of a multithreaded FittedValueIteration is the same as the
+// serial one.
+GTEST_TEST(FittedValueIteration, Parallelism) {
+  Eigen::Matrix2d A;
+  A << 0., 1., 0., 0.;
+  const Eigen::Vector2d B{0., 1.};
+  const Eigen::Matrix2d C = Eigen::Matrix2d::Identity();
+  const Eigen::Vector2d D = Eigen::Vector2d::Zero();
+  LinearSystem<double> sys(A, B, C, D);
+
+  const auto cost_function = [&sys](const Context<double>& context) {
+    const Eigen::Vector2d x = context.get_continuous_state().CopyToVector();
+    const double u = sys.get_input_port().Eval(context)[0];
+    return x.dot(x) + u * u;
+  };
+
+  math::BarycentricMesh<double>::MeshGrid state_grid(2);
+  for (double x = -2.; x <= 2.; x += .5) {
+    state_grid[0].insert(x);
+    state_grid[1].insert(x);
+  }
+  const math::BarycentricMesh<double>::MeshGrid input_grid(
+      {{-2., -1., 0., 1., 2.}});
+  const double timestep = .1;
+
+  DynamicProgrammingOptions options;
+  options.discount_factor = .95;
+
+  Simulator<double> serial_simulator(sys);
+  const auto [serial_policy, serial_cost_to_go] =
+      FittedValueIteration(&serial_simulator, cost_function, state_grid,
+                           input_grid, timestep, options);
+
+  options.parallelism = Parallelism(3);
+  Simulator<double> parallel_simulator(sys);
+  const auto [parallel_policy, parallel_cost_to_go] =
+      FittedValueIteration(&parallel_simulator, cost_function, state_grid,
+                           input_grid, timestep, options);
+
+  EXPECT_TRUE(CompareMatrices(parallel_cost_to_go, serial_cost_to_go));
+  auto serial_context = serial_policy->CreateDefaultContext();
+  auto parallel_context = parallel_policy->CreateDefaultContext();
+  for (const double x : state_grid[0]) {
+    const Eigen::Vector2d state{x, -x};
+    serial_policy->get_input_port().FixValue(serial_context.get(), state);
+    parallel_policy->get_input_port().FixValue(parallel_context.get(), state);
+    EXPECT_TRUE(CompareMatrices(
+        parallel_policy->get_output_port().Eval(*parallel_context),
+        serial_policy->get_output_port().Eval(*serial_context)));
+  }
+}
+
 // Ensure that FittedValueIteration can be called on a MultibodyPlant/SceneGraph
 // combo.
 GTEST_TEST(FittedValueIteration, MultibodyPlant) {
@@ -0,0 +1,130 @@
+#include "drake/systems/controllers/fused_inverse_dynamics_controller.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/systems/controllers/inverse_dynamics_controller.h"
+
+using drake::multibody::MultibodyPlant;
+
+namespace drake {
+namespace systems {
+namespace controllers {
+namespace {
+
+std::unique_ptr<MultibodyPlant<double>> MakeIiwa() {
+  auto robot = std::make_unique<MultibodyPlant<double>>(0.0);
+  const std::string full_name = drake::FindResourceOrThrow(
+      "drake/manipulation/models/iiwa_description/sdf/iiwa14_no_collision.sdf");
+  multibody::Parser(robot.get()).AddModelFromFile(full_name);
+  robot->WeldFrames(robot->world_frame(), robot->GetFrameByName("iiwa_link_0"));
+  robot->Finalize();
+  return robot;
+}
+
+class FusedInverseDynamicsControllerTest
+    : public ::testing::TestWithParam<bool> {
+ protected:
+  void SetUp() override {
+    robot_ = MakeIiwa();
+    const int dim = robot_->num_positions();
+    kp_.resize(dim);
+    ki_.resize(dim);
+    kp_ << 1, 2, 3, 4, 5, 6, 7;
+    ki_ << 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7;
+    kd_ = kp_ / 2.;
+  }
+
+  // Sets the same inputs and integral on `system` in `context`.
+  template <typename ControllerType>
+  void Configure(const ControllerType& system, Context<double>* context,
+                 bool has_reference_acceleration) {
+    const int dim = robot_->num_positions();
+    VectorX<double> q(dim), v(dim), q_r(dim), v_r(dim), vd_r(dim), q_int(dim);
+    q << 0.3, 0.2, 0.1, 0, -0.1, -0.2, -0.3;
+    v = q * 3;
+    q_r = (q + VectorX<double>::Constant(dim, 0.1)) * 2.;
+    v_r << -1, 0, 1, 0, -1, 0, 1;
+    vd_r << 1, 2, 3, 4, 5, 6, 7;
+    q_int << -1, -2, -3, -4, -5, -6, -7;
+
+    VectorX<double> state(2 * dim), reference_state(2 * dim);
+    state << q, v;
+    reference_state << q_r, v_r;
+    system.get_input_port_estimated_state().FixValue(context, state);
+    system.get_input_port_desired_state().FixValue(context, reference_state);
+    if (has_reference_acceleration) {
+      system.get_input_port_desired_acceleration().FixValue(context, vd_r);
+    }
+    system.set_integral_value(context, q_int);
+  }
+
+  std::unique_ptr<MultibodyPlant<double>> robot_;
+  VectorX<double> kp_, ki_, kd_;
+};
+
+// The fused controller must agree with the Diagram-based one, both in its
+// output and in the derivative of its integral state.
+TEST_P(FusedInverseDynamicsControllerTest, MatchesInverseDynamicsController) {
+  const bool has_reference_acceleration = GetParam();
+  const InverseDynamicsController<double> reference(
+      *robot_, kp_, ki_, kd_, has_reference_acceleration);
+  const FusedInverseDynamicsController<double> dut(
+      *robot_, kp_, ki_, kd_, has_reference_acceleration);
+  EXPECT_EQ(dut.num_input_ports(), reference.num_input_ports());
+  EXPECT_EQ(dut.num_continuous_states(), reference.num_continuous_states());
+
+  auto reference_context = reference.CreateDefaultContext();
+  auto dut_context = dut.CreateDefaultContext();
+  Configure(reference, reference_context.get(), has_reference_acceleration);
+  Configure(dut, dut_context.get(), has_reference_acceleration);
+
+  const VectorX<double>& expected_torque =
+      reference.get_output_port_control().Eval(*reference_context);
+  EXPECT_TRUE(CompareMatrices(
+      dut.get_output_port_control().Eval(*dut_context), expected_torque,
+      1e-10, MatrixCompareType::absolute));
+
+  // The output is recomputed in place when an input changes.
+  VectorX<double> state = reference.get_input_port_estimated_state().Eval(
+      *reference_context);
+  state.head(3) *= -1;
+  reference.get_input_port_estimated_state().FixValue(
+      reference_context.get(), state);
+  dut.get_input_port_estimated_state().FixValue(dut_context.get(), state);
+  EXPECT_TRUE(CompareMatrices(
+      dut.get_output_port_control().Eval(*dut_context),
+      reference.get_output_port_control().Eval(*reference_context), 1e-10,
+      MatrixCompareType::absolute));
+
+  EXPECT_TRUE(CompareMatrices(
+      dut.EvalTimeDerivatives(*dut_context).CopyToVector(),
+      reference.EvalTimeDerivatives(*reference_context).CopyToVector(),
+      1e-14, MatrixCompareType::absolute));
+}
+
+INSTANTIATE_TEST_SUITE_P(WithAndWithoutReferenceAcceleration,
+                         FusedInverseDynamicsControllerTest,
+                         ::testing::Bool());
+
+GTEST_TEST(FusedInverseDynamicsControllerErrorTest, BadGains) {
+  auto robot = MakeIiwa();
+  const VectorX<double> gains = VectorX<double>::Ones(7);
+  const VectorX<double> bad_gains = VectorX<double>::Ones(6);
+  EXPECT_THROW(FusedInverseDynamicsController<double>(
+                   *robot, bad_gains, gains, gains, false),
+               std::exception);
+  EXPECT_THROW(FusedInverseDynamicsController<double>(
+                   *robot, gains, gains, bad_gains, false),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
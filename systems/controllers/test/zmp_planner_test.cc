@@ -253,6 +253,38 @@ TEST_F(ZMPPlannerTest, TestOptimalControl) {
   }
 }
 
+// Replanning with one planner, which reuses the gains and the segment
+// exponentials of earlier plans, should give the same results as planning
+// each trajectory from scratch, including when the height changes.
+TEST_F(ZMPPlannerTest, TestReplan) {
+  std::vector<Eigen::Vector2d> footsteps = {
+      Eigen::Vector2d(0, 0), Eigen::Vector2d(0.5, 0.1),
+      Eigen::Vector2d(1, -0.1), Eigen::Vector2d(1.5, 0)};
+  std::vector<PiecewisePolynomial<double>> zmp_trajs =
+      GenerateDesiredZMPTrajs(footsteps, 0.5, 1);
+  const Eigen::Vector4d x0(0.1, -0.05, 0.1, 0.1);
+
+  for (double height : {1.0, 1.0, 0.8}) {
+    for (const auto& zmp_d : zmp_trajs) {
+      zmp_planner_.Plan(zmp_d, x0, height);
+      ZMPPlanner fresh_planner;
+      fresh_planner.Plan(zmp_d, x0, height);
+
+      EXPECT_TRUE(CompareMatrices(zmp_planner_.get_Vxx(),
+                                  fresh_planner.get_Vxx()));
+      for (double t = zmp_d.start_time(); t <= zmp_d.end_time(); t += 0.1) {
+        EXPECT_TRUE(CompareMatrices(zmp_planner_.get_nominal_com(t),
+                                    fresh_planner.get_nominal_com(t)));
+        EXPECT_TRUE(CompareMatrices(zmp_planner_.get_Vx(t),
+                                    fresh_planner.get_Vx(t)));
+        EXPECT_TRUE(CompareMatrices(
+            zmp_planner_.ComputeOptimalCoMdd(t, x0),
+            fresh_planner.ComputeOptimalCoMdd(t, x0)));
+      }
+    }
+  }
+}
+
 }  // namespace
 }  // namespace controllers
 }  // namespace systems
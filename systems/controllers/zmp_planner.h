@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/trajectories/exponential_plus_piecewise_polynomial.h"
@@ -84,6 +86,11 @@ class ZMPPlanner {
    * It is allowed to pass in a `zmp_d` with a non-stationary end point, but
    * the user should treat the result with caution, since the resulting nominal
    * CoM trajectory diverges exponentially fast past the end point.
+   *
+   * Replanning is cheap: as long as `height`, `gravity`, `Qy` and `R` are the
+   * same as in the previous call, the LQR solution and the other time
+   * invariant terms are reused, as are the matrix exponentials of segments
+   * whose durations were seen before.
    * @param zmp_d, Desired two dimensional ZMP trajectory.
    * @param x0, Initial CoM state.
    * @param height, CoM height from the ground.
@@ -277,6 +284,27 @@ class ZMPPlanner {
   }
 
  private:
+  // The matrix exponentials for a segment of duration `dt`, shared by all
+  // segments of that duration (e.g., every step of a uniformly timed gait).
+  struct SegmentExponentials {
+    double dt{};
+    // exp(-A2 * dt), i.e., the inverse of exp(A2 * dt).
+    Eigen::Matrix<double, 4, 4> A2_exp_inverse;
+    // The top four rows of exp(Az * dt).
+    Eigen::Matrix<double, 4, 8> Az_exp_top;
+  };
+
+  // Computes the time invariant terms of the value function, the policy, and
+  // the backward and forward passes (everything that depends only on D, Qy
+  // and R), and discards the cached segment exponentials.
+  void ComputeGains(const Eigen::Matrix2d& D, const Eigen::Matrix2d& Qy,
+                    const Eigen::Matrix2d& R);
+
+  // Returns the exponentials for a segment of duration `dt`, computing and
+  // caching them if needed. The returned reference is invalidated by the next
+  // call.
+  const SegmentExponentials& GetSegmentExponentials(double dt);
+
   // Check if the last point of zmp_d is stationary (first and higher
   // derivatives are zero).
   bool CheckStationaryEndPoint(
@@ -287,6 +315,10 @@ class ZMPPlanner {
   // arbitrarily chosen.
   static constexpr double kStationaryThreshold = 1e-8;
 
+  // The maximum number of distinct segment durations whose exponentials are
+  // kept across calls to Plan().
+  static constexpr int kMaxCachedSegmentDurations = 16;
+
   // Symbols:
   // x: [com; comd]
   // y: zmp
@@ -313,6 +345,17 @@ class ZMPPlanner {
   Eigen::Matrix<double, 2, 2> R1i_;
   Eigen::Matrix<double, 4, 4> A2_;
   Eigen::Matrix<double, 4, 2> B2_;
+  Eigen::Matrix<double, 4, 4> A2i_;
+
+  // The dynamics of the forward pass.
+  Eigen::Matrix<double, 8, 8> Az_;
+  Eigen::Matrix<double, 8, 8> Azi_;
+  Eigen::Matrix<double, 8, 2> Bz_;
+
+  // Whether the members above (and S1_ and K_) are valid. They are reused by
+  // Plan() as long as the height, gravity and cost weights don't change.
+  bool has_gains_{false};
+  std::vector<SegmentExponentials> segment_exponentials_;
 
   // One step cost function:
   // L = (y - y_d)^T * Qy * (y - y_d)^T + u^T * R * u.
@@ -24,7 +24,8 @@ void CacheEntryValue::ThrowIfBadCacheEntryValue(
   if (owning_subcontext && owning_subcontext_ != owning_subcontext) {
     throw std::logic_error(FormatName(__func__) + "wrong owning subcontext.");
   }
-  if ((flags_ & ~(kValueIsOutOfDate | kCacheEntryIsDisabled)) != 0) {
+  if ((flags_ & ~(kValueIsOutOfDate | kCacheEntryIsDisabled |
+                  kConcurrentEvaluation)) != 0) {
     throw std::logic_error(FormatName(__func__) +
                            "flags value is out of range.");
   }
@@ -57,6 +58,22 @@ void CacheEntryValue::ThrowIfBadOtherValue(
   }
 }
 
+void CacheEntryValue::UpdateConcurrently(
+    const std::function<void(AbstractValue*)>& calc) {
+  DRAKE_ASSERT(is_concurrent_evaluation_enabled());
+  // The flags are only written while no thread is evaluating, so they may be
+  // read here without synchronization.
+  if ((flags_ & (kValueIsOutOfDate | kCacheEntryIsDisabled)) == 0) return;
+  if (guard_.computed.load(std::memory_order_acquire)) return;
+  std::lock_guard<std::mutex> lock(guard_.mutex);
+  if (guard_.computed.load(std::memory_order_relaxed)) return;
+  ThrowIfNoValuePresent(__func__);
+  ThrowIfFrozen(__func__);
+  // If calc() throws, the value remains out of date.
+  calc(value_.get_mutable());
+  guard_.computed.store(true, std::memory_order_release);
+}
+
 CacheEntryValue& Cache::CreateNewCacheEntryValue(
     CacheIndex index, DependencyTicket ticket,
     const std::string& description,
@@ -125,6 +142,18 @@ void Cache::SetAllEntriesOutOfDate() {
     if (entry) entry->mark_out_of_date();
 }
 
+void Cache::EnableConcurrentEvaluation() {
+  for (auto& entry : store_)
+    if (entry) entry->begin_concurrent_evaluation();
+  is_concurrent_evaluation_enabled_ = true;
+}
+
+void Cache::DisableConcurrentEvaluation() {
+  for (auto& entry : store_)
+    if (entry) entry->end_concurrent_evaluation();
+  is_concurrent_evaluation_enabled_ = false;
+}
+
 void Cache::RepairCachePointers(
     const internal::ContextMessageInterface* owning_subcontext) {
   DRAKE_DEMAND(owning_subcontext != nullptr);
@@ -4,8 +4,11 @@
 Declares CacheEntryValue and Cache, which is the container for cache entry
 values. */
 
+#include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -23,6 +26,24 @@ namespace systems {
 
 class DependencyGraph;
 
+namespace internal {
+// The synchronization state of a CacheEntryValue while concurrent evaluation
+// is enabled (see ContextBase::EnableConcurrentCacheEvaluation()). It is never
+// shared: a copy is a fresh, unlocked state that has computed nothing.
+class CacheEntryGuard {
+ public:
+  CacheEntryGuard() = default;
+  CacheEntryGuard(const CacheEntryGuard&) {}
+  CacheEntryGuard& operator=(const CacheEntryGuard&) { return *this; }
+
+  // Serializes the recomputation of the value.
+  std::mutex mutex;
+  // Whether the value has been recomputed since concurrent evaluation was
+  // enabled or the entry was last marked out of date, whichever is later.
+  std::atomic<bool> computed{false};
+};
+}  // namespace internal
+
 //==============================================================================
 //                             CACHE ENTRY VALUE
 //==============================================================================
@@ -319,7 +340,9 @@ class CacheEntryValue {
   @see needs_recomputation() */
   bool is_out_of_date() const {
     DRAKE_ASSERT_VOID(ThrowIfNoValuePresent(__func__));
-    return (flags_ & kValueIsOutOfDate) != 0;
+    if ((flags_ & kValueIsOutOfDate) == 0) return false;
+    return (flags_ & kConcurrentEvaluation) == 0 ||
+           !guard_.computed.load(std::memory_order_acquire);
   }
 
   /** Returns `true` if either (a) the value is out of date, or (b) caching
@@ -330,7 +353,8 @@ class CacheEntryValue {
   Note that if this returns true while the cache is frozen, any attempt to
   access the value will fail since recomputation is forbidden in that case.
   However, operation of _this_ method is unaffected by whether the cache
-  is frozen. */
+  is frozen. While concurrent evaluation is enabled this always returns true,
+  so that Eval() goes through UpdateConcurrently(). */
   bool needs_recomputation() const {
     DRAKE_ASSERT_VOID(ThrowIfNoValuePresent(__func__));
     return flags_ != kReadyToUse;
@@ -369,6 +393,9 @@ class CacheEntryValue {
   inaccessible since it would require recomputation. */
   void mark_out_of_date() {
     flags_ |= kValueIsOutOfDate;
+    if ((flags_ & kConcurrentEvaluation) != 0) {
+      guard_.computed.store(false, std::memory_order_relaxed);
+    }
   }
 
   /** Returns the serial number of the contained value. This counts up every
@@ -450,6 +477,30 @@ class CacheEntryValue {
   }
   //@}
 
+  /** @name                 Concurrent evaluation
+  Methods here support evaluating the cache entries of a single Context from
+  several threads at once. See ContextBase::EnableConcurrentCacheEvaluation()
+  for the user-facing API. */
+  //@{
+
+  /** (Advanced) Returns `true` if concurrent evaluation is enabled for this
+  cache entry value. */
+  bool is_concurrent_evaluation_enabled() const {
+    return (flags_ & kConcurrentEvaluation) != 0;
+  }
+
+  /** (Internal use only) Brings the value up to date, if needed, by invoking
+  `calc` on it. Any number of threads may call this at once; only one of them
+  invokes `calc`, and the others wait for it to finish. If `calc` throws, the
+  value remains out of date and the next caller tries again. An entry whose
+  caching is disabled is recomputed only once, until it is next marked out of
+  date.
+  @throws std::exception if the value must be recomputed but the cache is
+                         frozen.
+  @pre is_concurrent_evaluation_enabled() */
+  void UpdateConcurrently(const std::function<void(AbstractValue*)>& calc);
+  //@}
+
  private:
   // So Cache and no one else can construct and copy CacheEntryValues.
   friend class Cache;
@@ -497,6 +548,23 @@ class CacheEntryValue {
     owning_subcontext_ = owning_subcontext;
   }
 
+  // These implement Cache::EnableConcurrentEvaluation() and
+  // Cache::DisableConcurrentEvaluation() for this entry. The latter folds a
+  // value computed under the guard back into the flags and serial number.
+  void begin_concurrent_evaluation() {
+    guard_.computed.store(false, std::memory_order_relaxed);
+    flags_ |= kConcurrentEvaluation;
+  }
+  void end_concurrent_evaluation() {
+    if ((flags_ & kConcurrentEvaluation) == 0) return;
+    if (guard_.computed.load(std::memory_order_acquire)) {
+      ++serial_number_;
+      flags_ &= ~kValueIsOutOfDate;
+      guard_.computed.store(false, std::memory_order_relaxed);
+    }
+    flags_ &= ~kConcurrentEvaluation;
+  }
+
   // Fully-checked method with API name to use in error messages.
   const AbstractValue& GetAbstractValueOrThrowHelper(const char* api) const {
     ThrowIfNoValuePresent(api);
@@ -583,9 +651,10 @@ class CacheEntryValue {
   // instruction whether it must recalculate. Only if flags==0 (kReadyToUse) can
   // we reuse the existing value. See needs_recomputation() above.
   enum Flags : int {
-    kReadyToUse           = 0b00,
-    kValueIsOutOfDate     = 0b01,
-    kCacheEntryIsDisabled = 0b10
+    kReadyToUse           = 0b000,
+    kValueIsOutOfDate     = 0b001,
+    kCacheEntryIsDisabled = 0b010,
+    kConcurrentEvaluation = 0b100
   };
 
   // The index for this CacheEntryValue within its containing subcontext.
@@ -610,6 +679,12 @@ class CacheEntryValue {
   copyable_unique_ptr<AbstractValue> value_;
   int64_t serial_number_{0};
   int flags_{kValueIsOutOfDate};
+
+  // Only used while concurrent evaluation is enabled. During that time the
+  // flags above are left untouched by evaluation (so that threads may read
+  // them without synchronization) and the out_of_date flag is qualified by
+  // whether the value has since been computed under the guard.
+  internal::CacheEntryGuard guard_;
 };
 
 //==============================================================================
@@ -676,6 +751,11 @@ class Cache {
   entry associated with a particular index. */
   int cache_size() const { return static_cast<int>(store_.size()); }
 
+  /** (Internal use only) Makes room for `num_entries` cache entry values so
+  that creating them with CreateNewCacheEntryValue() does not reallocate the
+  container. */
+  void reserve(int num_entries) { store_.reserve(num_entries); }
+
   /** Returns a const CacheEntryValue given an index. This is very fast.
   Behavior is undefined if the index is out of range [0..cache_size()-1] or
   if there is no CacheEntryValue with that index. Use has_cache_entry_value()
@@ -732,6 +812,42 @@ class Cache {
   @see ContextBase::is_cache_frozen() for the user-facing API */
   bool is_cache_frozen() const { return is_cache_frozen_; }
 
+  /** (Advanced) Sets the "bulk invalidation" flag, which the dependency
+  trackers of the owning subcontext consult when they initiate a change event.
+  @see ContextBase::EnableBulkInvalidation() for the user-facing API */
+  void enable_bulk_invalidation() {
+    is_bulk_invalidation_enabled_ = true;
+  }
+
+  /** (Advanced) Clears the "bulk invalidation" flag.
+  @see ContextBase::DisableBulkInvalidation() for the user-facing API */
+  void disable_bulk_invalidation() {
+    is_bulk_invalidation_enabled_ = false;
+  }
+
+  /** (Advanced) Reports the current value of the "bulk invalidation" flag.
+  @see ContextBase::is_bulk_invalidation_enabled() for the user-facing API */
+  bool is_bulk_invalidation_enabled() const {
+    return is_bulk_invalidation_enabled_;
+  }
+
+  /** (Advanced) Switches every entry in this cache to concurrent evaluation.
+  @see ContextBase::EnableConcurrentCacheEvaluation() for the user-facing API */
+  void EnableConcurrentEvaluation();
+
+  /** (Advanced) Switches every entry in this cache back to normal evaluation,
+  marking the values computed in the meantime up to date.
+  @see ContextBase::DisableConcurrentCacheEvaluation() for the user-facing
+  API */
+  void DisableConcurrentEvaluation();
+
+  /** (Advanced) Reports whether concurrent evaluation is enabled.
+  @see ContextBase::is_concurrent_cache_evaluation_enabled() for the
+  user-facing API */
+  bool is_concurrent_evaluation_enabled() const {
+    return is_concurrent_evaluation_enabled_;
+  }
+
   /** (Internal use only) Returns a mutable reference to a dummy CacheEntryValue
   that can serve as a /dev/null-like destination for throw-away writes. */
   CacheEntryValue& dummy_cache_entry_value() { return dummy_; }
@@ -774,6 +890,13 @@ class Cache {
 
   // Whether we are currently preventing mutable access to the cache.
   bool is_cache_frozen_{false};
+
+  // Whether the entries may currently be evaluated from several threads.
+  bool is_concurrent_evaluation_enabled_{false};
+
+  // Whether changes initiated in the owning subcontext invalidate downstream
+  // cache entries in bulk.
+  bool is_bulk_invalidation_enabled_{false};
 };
 
 }  // namespace systems
@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/profiler.h"
 #include "drake/common/value.h"
 #include "drake/systems/framework/context_base.h"
 #include "drake/systems/framework/framework_common.h"
@@ -298,9 +299,18 @@ class CacheEntry {
   // to be in need of recomputation (either because it is out of date or
   // because caching was disabled).
   void UpdateValue(const ContextBase& context) const {
+    ScopedProfileTimer timer([this]() {
+      return owning_system_->GetSystemPathname() + " cache entry '" +
+             description_ + "'";
+    });
     // We can get a mutable cache entry value from a const context.
     CacheEntryValue& mutable_cache_value =
         get_mutable_cache_entry_value(context);
+    if (mutable_cache_value.is_concurrent_evaluation_enabled()) {
+      mutable_cache_value.UpdateConcurrently(
+          [this, &context](AbstractValue* value) { Calc(context, value); });
+      return;
+    }
     AbstractValue& value = mutable_cache_value.GetMutableAbstractValueOrThrow();
     // If Calc() throws a recoverable exception, the cache remains out of date.
     Calc(context, &value);
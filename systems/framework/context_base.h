@@ -118,6 +118,79 @@ class ContextBase : public internal::ContextMessageInterface {
     return get_cache().is_cache_frozen();
   }
 
+  /** (Advanced) Switches change notification to "bulk" invalidation.
+  Normally, a change to
+  a source value such as time, state, or a parameter notifies each downstream
+  dependency tracker in turn, recursively. With bulk invalidation, the first
+  change to a given source gathers the cache entries transitively downstream of
+  it into a flat list, and that and every later change marks them all out of
+  date in a single pass. The list is rebuilt automatically if the dependency
+  graph changes (e.g., when an input port is first fixed). Results are
+  identical either way; this trades a little memory for faster invalidation of
+  large fan-outs, such as setting the state of a big MultibodyPlant. The
+  per-tracker runtime statistics of downstream trackers are not updated in this
+  mode. This is applied to this %Context and all its subcontexts, but _not_ to
+  its parent or siblings so it is most useful when called on the root
+  %Context. */
+  void EnableBulkInvalidation() const {
+    PropagateCachingChange(*this, &Cache::enable_bulk_invalidation);
+  }
+
+  /** (Advanced) Restores the default, recursive change notification after
+  EnableBulkInvalidation(), recursively for this context and all its
+  subcontexts. */
+  void DisableBulkInvalidation() const {
+    PropagateCachingChange(*this, &Cache::disable_bulk_invalidation);
+  }
+
+  /** (Advanced) Reports whether this %Context uses bulk invalidation. This
+  checks only locally; it is possible that parent, child, or sibling subcontext
+  caches are in a different state than this one. */
+  bool is_bulk_invalidation_enabled() const final {
+    return get_cache().is_bulk_invalidation_enabled();
+  }
+
+  /** (Advanced) Permits several threads to evaluate cache entries (and hence
+  output ports and other computed quantities) in this %Context at the same time,
+  without cloning it. While enabled, the first thread to Eval() an out-of-date
+  entry computes it while any other thread asking for the same entry waits; an
+  entry that is already up to date is read without locking. This is applied
+  recursively to this %Context and all its subcontexts, but _not_ to its parent
+  or siblings so it is most useful when called on the root %Context.
+
+  Only evaluation may happen concurrently. Modifying the %Context (e.g.,
+  setting its time, state, parameters, or fixed input values) while any thread
+  is evaluating it results in undefined behavior, though modifications made in
+  between concurrent evaluations are handled correctly. Computations that write
+  to a cache entry outside of its Eval() (e.g., entries used as scratch space)
+  are not protected. Entries whose caching is disabled are computed at most
+  once until they are next marked out of date. This may be combined with
+  FreezeCache(), in which case entries that were up to date when the cache was
+  frozen may be read concurrently and any other Eval() throws.
+
+  Values computed in this mode become ordinary up-to-date cache values when
+  DisableConcurrentCacheEvaluation() is called. Calling this when concurrent
+  evaluation is already enabled does nothing but waste a little time. */
+  void EnableConcurrentCacheEvaluation() const {
+    PropagateCachingChange(*this, &Cache::EnableConcurrentEvaluation);
+  }
+
+  /** (Advanced) Restores the single-threaded evaluation of cache entries
+  after EnableConcurrentCacheEvaluation(). No thread may be evaluating this
+  %Context while this is called. This is applied recursively to this %Context
+  and all its subcontexts, but _not_ to its parent or siblings. */
+  void DisableConcurrentCacheEvaluation() const {
+    PropagateCachingChange(*this, &Cache::DisableConcurrentEvaluation);
+  }
+
+  /** (Advanced) Reports whether this %Context's cache currently permits
+  concurrent evaluation. This checks only locally; it is possible that parent,
+  child, or sibling subcontext caches are in a different state than this
+  one. */
+  bool is_concurrent_cache_evaluation_enabled() const {
+    return get_cache().is_concurrent_evaluation_enabled();
+  }
+
   /** Returns the local name of the subsystem for which this is the Context.
   This is intended primarily for error messages and logging.
   @see SystemBase::GetSystemName() for details.
@@ -1,6 +1,7 @@
 #include "drake/systems/framework/dependency_tracker.h"
 
 #include <algorithm>
+#include <unordered_set>
 
 #include "drake/common/unused.h"
 
@@ -33,9 +34,60 @@ void DependencyTracker::NoteValueChange(int64_t change_event) const {
     return;
   }
   last_change_event_ = change_event;
+  if (owning_subcontext_->is_bulk_invalidation_enabled()) {
+    InvalidateDownstreamInBulk();
+    return;
+  }
   NotifySubscribers(change_event, 0);
 }
 
+// Gathers our transitive subscribers' cache entry values if we haven't yet
+// (or have since forgotten them), then marks them all out of date.
+void DependencyTracker::InvalidateDownstreamInBulk() const {
+  if (!downstream_is_gathered_) {
+    downstream_cache_values_.clear();
+    std::unordered_set<const DependencyTracker*> visited;
+    std::vector<const DependencyTracker*> to_visit(subscribers_);
+    while (!to_visit.empty()) {
+      const DependencyTracker* tracker = to_visit.back();
+      to_visit.pop_back();
+      if (!visited.insert(tracker).second) continue;
+      tracker->is_in_gathered_closure_ = true;
+      if (tracker->has_associated_cache_entry_)
+        downstream_cache_values_.push_back(tracker->cache_value_);
+      to_visit.insert(to_visit.end(), tracker->subscribers_.begin(),
+                      tracker->subscribers_.end());
+    }
+    // Visit the values in memory order during invalidation.
+    std::sort(downstream_cache_values_.begin(), downstream_cache_values_.end());
+    downstream_is_gathered_ = true;
+    DRAKE_LOGGER_DEBUG("Tracker '{}' gathered {} downstream cache entries.",
+                       GetPathDescription(), downstream_cache_values_.size());
+  }
+  for (CacheEntryValue* cache_value : downstream_cache_values_)
+    cache_value->mark_out_of_date();
+  num_downstream_notifications_sent_ += downstream_cache_values_.size();
+}
+
+// Only trackers that have gathered their downstream cache values, or that are
+// downstream of one that has, can be affected by a change in subscriptions
+// here. Before any gathering (e.g., while a Context is being allocated) this
+// returns immediately.
+void DependencyTracker::ForgetDownstreamCacheValues() const {
+  if (!(downstream_is_gathered_ || is_in_gathered_closure_)) return;
+  std::unordered_set<const DependencyTracker*> visited;
+  std::vector<const DependencyTracker*> to_visit{this};
+  while (!to_visit.empty()) {
+    const DependencyTracker* tracker = to_visit.back();
+    to_visit.pop_back();
+    if (!visited.insert(tracker).second) continue;
+    tracker->downstream_is_gathered_ = false;
+    tracker->downstream_cache_values_.clear();
+    to_visit.insert(to_visit.end(), tracker->prerequisites_.begin(),
+                    tracker->prerequisites_.end());
+  }
+}
+
 // A prerequisite says it has changed. Short circuit if we've already heard
 // about this change event. Otherwise, invalidate the associated cache entry and
 // then pass on the bad news to our subscribers. Update statistics.
@@ -99,6 +151,7 @@ void DependencyTracker::SubscribeToPrerequisite(
   prerequisites_.push_back(prerequisite);
 
   prerequisite->AddDownstreamSubscriber(*this);
+  prerequisite->ForgetDownstreamCacheValues();
 }
 
 void DependencyTracker::AddDownstreamSubscriber(
@@ -143,6 +196,7 @@ void DependencyTracker::UnsubscribeFromPrerequisite(
   Remove<const DependencyTracker*>(prerequisite, &prerequisites_);
 
   prerequisite->RemoveDownstreamSubscriber(*this);
+  prerequisite->ForgetDownstreamCacheValues();
 }
 
 void DependencyTracker::RemoveDownstreamSubscriber(
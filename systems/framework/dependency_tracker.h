@@ -130,6 +130,13 @@ nodes. */
 // CacheEntryValue, make it available for all non-cache DependencyTrackers
 // to "invalidate", and require that the definition of the cache invalidation
 // method is visible here rather than use an abstract interface to it.
+//
+// When bulk invalidation is enabled (see ContextBase::EnableBulkInvalidation())
+// a tracker on which NoteValueChange() is invoked instead lazily gathers the
+// transitive closure of its subscribers into a flat list of the real cache
+// entry values downstream of it, and marks those out of date in a single pass.
+// The list is discarded whenever a subscription anywhere upstream of it
+// changes.
 
 class DependencyTracker {
  public:
@@ -163,6 +170,7 @@ class DependencyTracker {
     DRAKE_DEMAND(!has_associated_cache_entry_);
     cache_value_ = cache_value;
     has_associated_cache_entry_ = true;
+    ForgetDownstreamCacheValues();
   }
 
   // This is for validating that this tracker is associated with the right
@@ -191,7 +199,12 @@ class DependencyTracker {
   sweep. So it is unusual for NoteValueChange() to be called on a cache entry's
   dependency tracker. But if it is called, that is likely to mean the cache
   entry was just given a new value, and is therefore _valid_; invalidating it
-  now would be an error. */
+  now would be an error.
+
+  If bulk invalidation is enabled in the owning subcontext, the downstream
+  cache entries are marked out of date directly rather than by notifying each
+  subscriber in turn; in that case the downstream trackers' runtime statistics
+  are not updated. */
   void NoteValueChange(int64_t change_event) const;
 
   /** @name              Prerequisites and subscribers
@@ -384,6 +397,14 @@ class DependencyTracker {
   // prerequisite; downstream subscribers can't tell the difference.
   void NotifySubscribers(int64_t change_event, int depth) const;
 
+  // Implements NoteValueChange() when bulk invalidation is enabled, gathering
+  // downstream_cache_values_ first if necessary.
+  void InvalidateDownstreamInBulk() const;
+
+  // Discards the downstream_cache_values_ of this tracker and of every tracker
+  // upstream of it, since their transitive subscribers may have changed.
+  void ForgetDownstreamCacheValues() const;
+
   std::string GetSystemPathname() const {
     DRAKE_DEMAND(owning_subcontext_!= nullptr);
     return owning_subcontext_->GetSystemPathname();
@@ -415,6 +436,15 @@ class DependencyTracker {
   // greater than zero, so this will never match.
   mutable int64_t last_change_event_{-1};
 
+  // The real cache entry values of all the transitive subscribers of this
+  // tracker, without repetition. Only valid when downstream_is_gathered_ is
+  // true; gathered lazily by InvalidateDownstreamInBulk(). Never copied.
+  mutable std::vector<CacheEntryValue*> downstream_cache_values_;
+  mutable bool downstream_is_gathered_{false};
+  // Whether this tracker has ever been gathered as a transitive subscriber of
+  // another one. Conservatively never cleared.
+  mutable bool is_in_gathered_closure_{false};
+
   // Runtime statistics. Does not change behavior at all.
   mutable int64_t num_value_change_notifications_received_{0};
   mutable int64_t num_prerequisite_notifications_received_{0};
@@ -513,6 +543,11 @@ class DependencyGraph {
   if there is a tracker associated with a particular ticket. */
   int trackers_size() const { return static_cast<int>(graph_.size()); }
 
+  /** (Internal use only) Makes room for trackers with ticket numbers up to
+  `num_tickets - 1` so that creating them with CreateNewDependencyTracker() does
+  not reallocate the container. */
+  void reserve(int num_tickets) { graph_.reserve(num_tickets); }
+
   /** Returns a const DependencyTracker given a ticket. This is very fast.
   Behavior is undefined if the ticket is out of range [0..num_trackers()-1]. */
   const DependencyTracker& get_tracker(DependencyTicket ticket) const {
@@ -1,5 +1,6 @@
 #include "drake/systems/framework/diagram.h"
 
+#include <algorithm>
 #include <limits>
 #include <set>
 #include <stdexcept>
@@ -304,11 +305,23 @@ void Diagram<T>::DoCalcTimeDerivatives(const Context<T>& context,
   DRAKE_DEMAND(num_subsystems() == n);
 
   // Evaluate the derivatives of each constituent system.
-  for (SubsystemIndex i(0); i < n; ++i) {
+  auto calc = [&](SubsystemIndex i) {
     const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
     ContinuousState<T>& subderivatives =
         diagram_derivatives->get_mutable_substate(i);
     registered_systems_[i]->CalcTimeDerivatives(subcontext, &subderivatives);
+  };
+  if (parallelism_.num_threads() > 1) {
+    DispatchToSubsystemsInParallel(
+        *diagram_context,
+        [this](SubsystemIndex i) {
+          return registered_systems_[i]->num_continuous_states() > 0;
+        },
+        true, calc);
+    return;
+  }
+  for (SubsystemIndex i(0); i < n; ++i) {
+    calc(i);
   }
 }
 
@@ -865,8 +878,10 @@ void Diagram<T>::DoCalcNextUpdateTime(const Context<T>& context,
       this->get_cache_entry(event_times_buffer_cache_index_)
       .get_mutable_cache_entry_value(context);
   auto& event_times_buffer = value.GetMutableValueOrThrow<std::vector<T>>();
-  DRAKE_DEMAND(
-      static_cast<int>(event_times_buffer.size()) == num_subsystems());
+  const int num_unscheduled = static_cast<int>(unscheduled_subsystems_.size());
+  const int num_timings = static_cast<int>(periodic_event_schedule_.size());
+  DRAKE_DEMAND(static_cast<int>(event_times_buffer.size()) ==
+               num_unscheduled + num_timings);
 
   // In assert-enabled builds, enforce the invariant that no stale values in
   // event_times_buffer are reused across invocations. In effect,
@@ -884,15 +899,28 @@ void Diagram<T>::DoCalcNextUpdateTime(const Context<T>& context,
 
   *next_update_time = std::numeric_limits<double>::infinity();
 
-  // Iterate over the subsystems, and harvest the most imminent updates.
-  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+  // Iterate over the unscheduled subsystems, and harvest the most imminent
+  // updates.
+  for (int k = 0; k < num_unscheduled; ++k) {
+    const SubsystemIndex i = unscheduled_subsystems_[k];
     const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
     CompositeEventCollection<T>& subinfo =
         info->get_mutable_subevent_collection(i);
 
     const T sub_time =
         registered_systems_[i]->CalcNextUpdateTime(subcontext, &subinfo);
-    event_times_buffer[i] = sub_time;
+    event_times_buffer[k] = sub_time;
+
+    if (sub_time < *next_update_time) {
+      *next_update_time = sub_time;
+    }
+  }
+
+  // Then the distinct timings of the scheduled subsystems' periodic events.
+  for (int k = 0; k < num_timings; ++k) {
+    const T sub_time = internal::GetNextSampleTime(
+        periodic_event_schedule_[k].timing, context.get_time());
+    event_times_buffer[num_unscheduled + k] = sub_time;
 
     if (sub_time < *next_update_time) {
       *next_update_time = sub_time;
@@ -907,11 +935,25 @@ void Diagram<T>::DoCalcNextUpdateTime(const Context<T>& context,
   };
   DRAKE_ASSERT(none_are_nan(event_times_buffer));
 
-  // For all the subsystems whose next update time is bigger than
+  // For all the unscheduled subsystems whose next update time is bigger than
   // next_update_time, clear their event collections.
-  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
-    if (event_times_buffer[i] > *next_update_time)
-      info->get_mutable_subevent_collection(i).Clear();
+  for (int k = 0; k < num_unscheduled; ++k) {
+    if (event_times_buffer[k] > *next_update_time) {
+      info->get_mutable_subevent_collection(unscheduled_subsystems_[k])
+          .Clear();
+    }
+  }
+
+  // Fill the scheduled subsystems' event collections with the events whose
+  // timing triggers at next_update_time.
+  for (const SubsystemIndex i : scheduled_subsystems_) {
+    info->get_mutable_subevent_collection(i).Clear();
+  }
+  for (int k = 0; k < num_timings; ++k) {
+    if (event_times_buffer[num_unscheduled + k] > *next_update_time) continue;
+    for (const auto& [i, event] : periodic_event_schedule_[k].events) {
+      event->AddToComposite(&info->get_mutable_subevent_collection(i));
+    }
   }
 }
 
@@ -1030,42 +1072,26 @@ const AbstractValue* Diagram<T>::EvalConnectedSubsystemInputPort(
   auto& diagram_context =
       static_cast<const DiagramContext<T>&>(context_base);
 
-  // Profiling revealed that it is too expensive to do a dynamic_cast here.
-  // A static_cast is safe as long as the given input_port_base was actually
-  // an InputPort<T>, and since our sole caller is SystemBase which always
-  // retrieves the input_port_base from `this`, the <T> must be correct.
-  auto& system =
-      static_cast<const System<T>&>(input_port_base.get_system_interface());
-  const InputPortLocator id{&system, input_port_base.get_index()};
-
-  // Find if this input port is exported (connected to an input port of this
-  // containing diagram).
-  const auto external_it = input_port_map_.find(id);
-  const bool is_exported = (external_it != input_port_map_.end());
-
-  // Find if this input port is connected to an output port.
-  // TODO(sherm1) Fix this. Shouldn't have to search.
-  const auto upstream_it = connection_map_.find(id);
-  const bool is_connected = (upstream_it != connection_map_.end());
-
-  if (!(is_exported || is_connected))
+  // The sources were resolved when this Diagram was built; see
+  // CompileInputPortSources().
+  const auto iter = input_port_sources_.find(&input_port_base);
+  if (iter == input_port_sources_.end())
     return nullptr;
+  const InputPortSource& source = iter->second;
 
-  DRAKE_DEMAND(is_exported ^ is_connected);
-
-  if (is_exported) {
+  if (source.upstream_port == nullptr) {
     // The upstream source is an input to this whole Diagram; evaluate that
     // input port and use the result as the value for this one.
-    const InputPortIndex i = external_it->second;
-    return this->EvalAbstractInput(diagram_context, i);
+    return this->EvalAbstractInput(diagram_context, source.exported_index);
   }
 
   // The upstream source is an output port of one of this Diagram's child
   // subsystems; evaluate it.
   // TODO(david-german-tri): Add online algebraic loop detection here.
-  DRAKE_ASSERT(is_connected);
-  const OutputPortLocator& prerequisite = upstream_it->second;
-  return &this->EvalSubsystemOutputPort(diagram_context, prerequisite);
+  const Context<T>& subsystem_context =
+      diagram_context.GetSubsystemContext(source.upstream_subsystem);
+  return &source.upstream_port->template Eval<AbstractValue>(
+      subsystem_context);
 }
 
 template <typename T>
@@ -1156,14 +1182,22 @@ void Diagram<T>::DispatchPublishHandler(
       dynamic_cast<const DiagramEventCollection<PublishEvent<T>>&>(
           event_info);
 
+  auto is_active = [&info](SubsystemIndex i) {
+    return info.get_subevent_collection(i).HasEvents();
+  };
+  auto calc = [&](SubsystemIndex i) {
+    const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
+    registered_systems_[i]->Publish(subcontext,
+                                    info.get_subevent_collection(i));
+  };
+  if (parallelism_.num_threads() > 1) {
+    // Publish handlers typically have side effects outside of the Context
+    // (e.g., sending messages); only their inputs are computed concurrently.
+    DispatchToSubsystemsInParallel(*diagram_context, is_active, false, calc);
+    return;
+  }
   for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
-    const EventCollection<PublishEvent<T>>& subinfo =
-        info.get_subevent_collection(i);
-
-    if (subinfo.HasEvents()) {
-      const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
-      registered_systems_[i]->Publish(subcontext, subinfo);
-    }
+    if (is_active(i)) calc(i);
   }
 }
 
@@ -1182,18 +1216,22 @@ void Diagram<T>::DispatchDiscreteVariableUpdateHandler(
       dynamic_cast<const DiagramEventCollection<DiscreteUpdateEvent<T>>&>(
           events);
 
+  auto is_active = [&diagram_events](SubsystemIndex i) {
+    return diagram_events.get_subevent_collection(i).HasEvents();
+  };
+  auto calc = [&](SubsystemIndex i) {
+    const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
+    DiscreteValues<T>& subdiscrete =
+        diagram_discrete->get_mutable_subdiscrete(i);
+    registered_systems_[i]->CalcDiscreteVariableUpdates(
+        subcontext, diagram_events.get_subevent_collection(i), &subdiscrete);
+  };
+  if (parallelism_.num_threads() > 1) {
+    DispatchToSubsystemsInParallel(*diagram_context, is_active, true, calc);
+    return;
+  }
   for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
-    const EventCollection<DiscreteUpdateEvent<T>>& subevents =
-        diagram_events.get_subevent_collection(i);
-
-    if (subevents.HasEvents()) {
-      const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
-      DiscreteValues<T>& subdiscrete =
-          diagram_discrete->get_mutable_subdiscrete(i);
-
-      registered_systems_[i]->CalcDiscreteVariableUpdates(
-          subcontext, subevents, &subdiscrete);
-    }
+    if (is_active(i)) calc(i);
   }
 }
 
@@ -1238,17 +1276,21 @@ void Diagram<T>::DispatchUnrestrictedUpdateHandler(
       dynamic_cast<const DiagramEventCollection<UnrestrictedUpdateEvent<T>>&>(
           events);
 
+  auto is_active = [&diagram_events](SubsystemIndex i) {
+    return diagram_events.get_subevent_collection(i).HasEvents();
+  };
+  auto calc = [&](SubsystemIndex i) {
+    const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
+    State<T>& substate = diagram_state->get_mutable_substate(i);
+    registered_systems_[i]->CalcUnrestrictedUpdate(
+        subcontext, diagram_events.get_subevent_collection(i), &substate);
+  };
+  if (parallelism_.num_threads() > 1) {
+    DispatchToSubsystemsInParallel(*diagram_context, is_active, true, calc);
+    return;
+  }
   for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
-    const EventCollection<UnrestrictedUpdateEvent<T>>& subevents =
-        diagram_events.get_subevent_collection(i);
-
-    if (subevents.HasEvents()) {
-      const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
-      State<T>& substate = diagram_state->get_mutable_substate(i);
-
-      registered_systems_[i]->CalcUnrestrictedUpdate(subcontext, subevents,
-                                                     &substate);
-    }
+    if (is_active(i)) calc(i);
   }
 }
 
@@ -1372,6 +1414,7 @@ Diagram<T>::ConvertScalarType() const {
   }
   // Move the new systems into the blueprint.
   blueprint->systems = std::move(new_systems);
+  blueprint->parallelism = parallelism_;
 
   return blueprint;
 }
@@ -1448,6 +1491,30 @@ void Diagram<T>::Initialize(std::unique_ptr<Blueprint> blueprint) {
   connection_map_ = std::move(blueprint->connection_map);
   output_port_ids_ = std::move(blueprint->output_port_ids);
   registered_systems_ = std::move(blueprint->systems);
+  parallelism_ = blueprint->parallelism;
+
+  // Schedule the periodic events of the subsystems that have nothing else
+  // to report from CalcNextUpdateTime(), merged by timing.
+  std::map<PeriodicEventData, int, PeriodicEventDataComparator> timing_index;
+  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    const System<T>& subsystem = *registered_systems_[i];
+    if (!subsystem.HasOnlyPeriodicUpdateTimes()) {
+      unscheduled_subsystems_.push_back(i);
+      continue;
+    }
+    scheduled_subsystems_.push_back(i);
+    for (const auto& [timing, events] : subsystem.GetPeriodicEvents()) {
+      const auto [iter, inserted] = timing_index.emplace(
+          timing, static_cast<int>(periodic_event_schedule_.size()));
+      if (inserted) {
+        periodic_event_schedule_.push_back({timing, {}});
+      }
+      auto& scheduled = periodic_event_schedule_[iter->second].events;
+      for (const Event<T>* event : events) {
+        scheduled.emplace_back(i, event);
+      }
+    }
+  }
 
   // This cache entry just maintains temporary storage. It is only ever used
   // by DoCalcNextUpdateTime(). Since this declaration of the cache entry
@@ -1457,7 +1524,8 @@ void Diagram<T>::Initialize(std::unique_ptr<Blueprint> blueprint) {
   event_times_buffer_cache_index_ =
       this->DeclareCacheEntry(
           "event_times_buffer", ValueProducer(
-              std::vector<T>(num_subsystems()),
+              std::vector<T>(unscheduled_subsystems_.size() +
+                             periodic_event_schedule_.size()),
               &ValueProducer::NoopCalc),
           {this->nothing_ticket()}).cache_index();
 
@@ -1535,6 +1603,172 @@ void Diagram<T>::Initialize(std::unique_ptr<Blueprint> blueprint) {
     residual_size += system->implicit_time_derivatives_residual_size();
   }
   this->set_implicit_time_derivatives_residual_size(residual_size);
+
+  CompileInputPortSources();
+
+  if (parallelism_.num_threads() > 1) {
+    CalcPrefetchSchedule();
+  }
+}
+
+template <typename T>
+void Diagram<T>::CompileInputPortSources() {
+  input_port_sources_.clear();
+  for (const auto& [input, output] : connection_map_) {
+    InputPortSource& source =
+        input_port_sources_[&input.first->get_input_port(input.second)];
+    source.upstream_port = &output.first->get_output_port(output.second);
+    source.upstream_subsystem = GetSystemIndexOrAbort(output.first);
+  }
+  for (const auto& [input, index] : input_port_map_) {
+    InputPortSource& source =
+        input_port_sources_[&input.first->get_input_port(input.second)];
+    // An input port can't be both connected and exported.
+    DRAKE_DEMAND(source.upstream_port == nullptr);
+    source.exported_index = index;
+  }
+}
+
+template <typename T>
+void Diagram<T>::CalcPrefetchSchedule() {
+  std::vector<std::multimap<int, int>> feedthroughs;
+  for (const auto& system : registered_systems_) {
+    feedthroughs.push_back(system->GetDirectFeedthroughs());
+  }
+
+  // The dependencies of a subsystem output port: itself (including its stage)
+  // and, transitively, the ports feeding through to it.
+  struct Dependencies {
+    PrefetchItem item;
+    std::set<PrefetchItem> outputs;
+    std::set<InputPortIndex> inputs;
+  };
+  std::map<OutputPortLocator, Dependencies> memo;
+
+  // Adds the dependencies of the subsystem input port `input` to `deps`, and
+  // returns the stage after which its value is available (-1 if the value is
+  // not computed by a subsystem).
+  std::function<int(const InputPortLocator&, Dependencies*)> add_input;
+  std::function<const Dependencies&(const OutputPortLocator&)> visit_output =
+      [&](const OutputPortLocator& output) -> const Dependencies& {
+    auto iter = memo.find(output);
+    if (iter != memo.end()) return iter->second;
+    Dependencies deps;
+    const SubsystemIndex j = GetSystemIndexOrAbort(output.first);
+    deps.item.subsystem = j;
+    deps.item.port = output.second;
+    for (const auto& [input_index, output_index] : feedthroughs[j]) {
+      if (output_index != output.second) continue;
+      const int stage =
+          add_input({output.first, InputPortIndex(input_index)}, &deps);
+      deps.item.stage = std::max(deps.item.stage, stage + 1);
+    }
+    // The graph of connections and direct feedthroughs is acyclic (that's
+    // checked by DiagramBuilder), so the recursion terminates.
+    return memo.emplace(output, std::move(deps)).first->second;
+  };
+  add_input = [&](const InputPortLocator& input, Dependencies* deps) {
+    const auto connection = connection_map_.find(input);
+    if (connection != connection_map_.end()) {
+      const Dependencies& upstream = visit_output(connection->second);
+      deps->outputs.insert(upstream.item);
+      deps->outputs.insert(upstream.outputs.begin(), upstream.outputs.end());
+      deps->inputs.insert(upstream.inputs.begin(), upstream.inputs.end());
+      return upstream.item.stage;
+    }
+    const auto exported = input_port_map_.find(input);
+    if (exported != input_port_map_.end()) {
+      deps->inputs.insert(exported->second);
+    }
+    return -1;
+  };
+
+  prefetch_outputs_.resize(num_subsystems());
+  prefetch_inputs_.resize(num_subsystems());
+  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    const System<T>* const system = registered_systems_[i].get();
+    Dependencies deps;
+    for (InputPortIndex k(0); k < system->num_input_ports(); ++k) {
+      add_input({system, k}, &deps);
+    }
+    prefetch_outputs_[i].assign(deps.outputs.begin(), deps.outputs.end());
+    prefetch_inputs_[i].assign(deps.inputs.begin(), deps.inputs.end());
+  }
+}
+
+template <typename T>
+void Diagram<T>::PrefetchSubsystemInputs(
+    const DiagramContext<T>& context,
+    const std::vector<SubsystemIndex>& subsystems) const {
+  DRAKE_DEMAND(parallelism_.num_threads() > 1);
+  std::vector<PrefetchItem> items;
+  std::vector<InputPortIndex> inputs;
+  for (const SubsystemIndex i : subsystems) {
+    items.insert(items.end(), prefetch_outputs_[i].begin(),
+                 prefetch_outputs_[i].end());
+    inputs.insert(inputs.end(), prefetch_inputs_[i].begin(),
+                  prefetch_inputs_[i].end());
+  }
+  std::sort(items.begin(), items.end());
+  items.erase(std::unique(items.begin(), items.end()), items.end());
+  std::sort(inputs.begin(), inputs.end());
+  inputs.erase(std::unique(inputs.begin(), inputs.end()), inputs.end());
+
+  // The inputs of this Diagram are computed by our parent, possibly sharing
+  // values among them. We can't evaluate those concurrently.
+  for (const InputPortIndex k : inputs) {
+    this->EvalAbstractInput(context, k);
+  }
+
+  // Within a stage, the ports of a given subsystem might share computations
+  // (e.g., through a common cache entry). Therefore each task evaluates all
+  // the ports in the stage of a single subsystem. Tasks are given as ranges
+  // [first, last) into items.
+  std::vector<std::pair<int, int>> tasks;
+  int stage_begin = 0;
+  while (stage_begin < static_cast<int>(items.size())) {
+    tasks.clear();
+    int end = stage_begin;
+    while (end < static_cast<int>(items.size()) &&
+           items[end].stage == items[stage_begin].stage) {
+      if (tasks.empty() ||
+          items[tasks.back().first].subsystem != items[end].subsystem) {
+        tasks.emplace_back(end, end);
+      }
+      tasks.back().second = ++end;
+    }
+    StaticParallelForIndexLoop(
+        parallelism_, 0, static_cast<int>(tasks.size()), [&](int, int task) {
+          for (int n = tasks[task].first; n < tasks[task].second; ++n) {
+            const SubsystemIndex i = items[n].subsystem;
+            EvalSubsystemOutputPort(
+                context, {registered_systems_[i].get(), items[n].port});
+          }
+        });
+    stage_begin = end;
+  }
+}
+
+template <typename T>
+void Diagram<T>::DispatchToSubsystemsInParallel(
+    const DiagramContext<T>& context,
+    const std::function<bool(SubsystemIndex)>& is_active, bool concurrent,
+    const std::function<void(SubsystemIndex)>& calc) const {
+  std::vector<SubsystemIndex> active;
+  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    if (is_active(i)) active.push_back(i);
+  }
+  PrefetchSubsystemInputs(context, active);
+  if (concurrent) {
+    StaticParallelForIndexLoop(
+        parallelism_, 0, static_cast<int>(active.size()), [&](int, int n) {
+          calc(active[n]);
+        });
+  } else {
+    for (const SubsystemIndex i : active) {
+      calc(i);
+    }
+  }
 }
 
 template <typename T>
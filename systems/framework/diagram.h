@@ -4,11 +4,14 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/systems/framework/diagram_context.h"
 #include "drake/systems/framework/diagram_continuous_state.h"
 #include "drake/systems/framework/diagram_discrete_values.h"
@@ -109,6 +112,11 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
 
   std::multimap<int, int> GetDirectFeedthroughs() const final;
 
+  /// Returns the degree of parallelism with which this Diagram dispatches
+  /// computations to its immediate subsystems, as set by
+  /// DiagramBuilder::set_parallelism().
+  const Parallelism& parallelism() const { return parallelism_; }
+
   void SetDefaultState(const Context<T>& context,
                        State<T>* state) const override;
 
@@ -320,6 +328,10 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
                             CompositeEventCollection<T>* event_info,
                             T* time) const override;
 
+  /// A Diagram reports the events of its subsystems in their own (nested)
+  /// event collections, so its parent must always ask it.
+  bool DoHasOnlyPeriodicUpdateTimes() const final { return false; }
+
   std::string GetUnsupportedScalarConversionMessage(
       const std::type_info& source_type,
       const std::type_info& destination_type) const final;
@@ -469,6 +481,8 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     std::map<InputPortLocator, OutputPortLocator> connection_map;
     // All of the systems to be included in the diagram.
     internal::OwnedSystems<T> systems;
+    // The degree of parallelism of subsystem dispatch.
+    Parallelism parallelism;
   };
 
   // Constructs a Diagram from the Blueprint that a DiagramBuilder produces.
@@ -510,6 +524,32 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   typename DiagramContext<T>::OutputPortIdentifier
   ConvertToContextPortIdentifier(const OutputPortLocator& locator) const;
 
+  // Populates prefetch_outputs_ and prefetch_inputs_ from the connections and
+  // the direct feedthrough of the subsystems.
+  void CalcPrefetchSchedule();
+
+  // Brings up to date every value that the input ports of the given
+  // subsystems depend on, so that those subsystems can subsequently be
+  // evaluated concurrently without recomputing any value outside of their
+  // own subcontexts. Independent subsystem output ports are evaluated
+  // concurrently, one stage at a time.
+  // @pre parallelism_ allows more than one thread.
+  void PrefetchSubsystemInputs(
+      const DiagramContext<T>& context,
+      const std::vector<SubsystemIndex>& subsystems) const;
+
+  // Calls `calc(i)` for every subsystem i for which `is_active(i)` is true,
+  // after prefetching their inputs. The calls are made concurrently iff
+  // `concurrent` is true.
+  // @pre parallelism_ allows more than one thread.
+  void DispatchToSubsystemsInParallel(
+      const DiagramContext<T>& context,
+      const std::function<bool(SubsystemIndex)>& is_active, bool concurrent,
+      const std::function<void(SubsystemIndex)>& calc) const;
+
+  // Populates input_port_sources_ from connection_map_ and input_port_map_.
+  void CompileInputPortSources();
+
   // Returns true if every port mentioned in the connection map exists.
   bool PortsAreValid() const;
 
@@ -536,11 +576,76 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   // The map of subsystem inputs to inputs of this Diagram.
   std::map<InputPortLocator, InputPortIndex> input_port_map_;
 
+  // Where a subsystem input port gets its value from, resolved once from
+  // connection_map_, input_port_map_, and system_index_map_ so that
+  // EvalConnectedSubsystemInputPort() needs a single hash lookup.
+  struct InputPortSource {
+    // The upstream subsystem output port and the index of its subsystem, or
+    // null if the input port is exported.
+    const OutputPort<T>* upstream_port{};
+    SubsystemIndex upstream_subsystem;
+    // The input port of this Diagram, if the input port is exported.
+    InputPortIndex exported_index;
+  };
+  // Subsystem input ports that are neither connected nor exported are absent.
+  std::unordered_map<const InputPortBase*, InputPortSource>
+      input_port_sources_;
+
   // The index of a cache entry that stores a buffer of time data for use in
   // managing events. It is only used in DoCalcNextUpdateTime(), but is
   // allocated as a cache entry to avoid heap operations during simulation.
+  // It holds the next update times of the unscheduled_subsystems_, followed
+  // by those of the entries of the periodic_event_schedule_.
   CacheIndex event_times_buffer_cache_index_{};
 
+  // The periodic events that share one timing, from every subsystem whose
+  // next update time is determined by its periodic events alone (see
+  // System::HasOnlyPeriodicUpdateTimes()), merged for DoCalcNextUpdateTime().
+  struct ScheduledPeriodicEvents {
+    PeriodicEventData timing;
+    std::vector<std::pair<SubsystemIndex, const Event<T>*>> events;
+  };
+  // The scheduled periodic events, one entry per distinct timing. Subsystem
+  // declarations are fixed once they belong to this Diagram, so this is built
+  // once, by Initialize(). DoCalcNextUpdateTime() finds the next update time
+  // of the scheduled subsystems by looking at each of the (typically few)
+  // distinct timings, rather than by asking each of the subsystems.
+  std::vector<ScheduledPeriodicEvents> periodic_event_schedule_;
+  // The subsystems whose events are in periodic_event_schedule_.
+  std::vector<SubsystemIndex> scheduled_subsystems_;
+  // The other subsystems; DoCalcNextUpdateTime() asks each of them.
+  std::vector<SubsystemIndex> unscheduled_subsystems_;
+
+  // The degree of parallelism of subsystem dispatch. See
+  // DiagramBuilder::set_parallelism().
+  Parallelism parallelism_;
+
+  // An output port of an immediate subsystem, tagged with its "stage": the
+  // length of the longest chain of direct-feedthrough dependencies on other
+  // subsystem output ports through which it is computed. All the ports in a
+  // stage can be evaluated concurrently once the earlier stages are up to
+  // date. Sorts by stage first.
+  struct PrefetchItem {
+    bool operator<(const PrefetchItem& other) const {
+      return std::tie(stage, subsystem, port) <
+             std::tie(other.stage, other.subsystem, other.port);
+    }
+    bool operator==(const PrefetchItem& other) const {
+      return stage == other.stage && subsystem == other.subsystem &&
+             port == other.port;
+    }
+
+    int stage{};
+    SubsystemIndex subsystem;
+    OutputPortIndex port;
+  };
+
+  // Only populated when parallelism_ allows more than one thread. Indexed by
+  // SubsystemIndex, the subsystem output ports (sorted) and the input ports of
+  // this Diagram that the evaluation of that subsystem's inputs may require.
+  std::vector<std::vector<PrefetchItem>> prefetch_outputs_;
+  std::vector<std::vector<InputPortIndex>> prefetch_inputs_;
+
   // For all T, Diagram<T> considers DiagramBuilder<T> a friend, so that the
   // builder can set the internal state correctly.
   friend class DiagramBuilder<T>;
@@ -11,6 +11,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/systems/framework/diagram.h"
 #include "drake/systems/framework/system.h"
 
@@ -342,6 +343,35 @@ class DiagramBuilder {
       const OutputPort<T>& output,
       std::variant<std::string, UseDefaultName> name = kUseDefaultName);
 
+  /// Sets the degree of parallelism with which the Diagram to be built
+  /// dispatches computations to its immediate subsystems. By default there is
+  /// no parallelism. With more than one thread, the Diagram computes the time
+  /// derivatives, discrete updates and unrestricted updates of its subsystems
+  /// concurrently. Beforehand, it brings up to date the subsystem output ports
+  /// that those computations depend on, evaluating independent ports
+  /// concurrently (this includes the inputs of subsystems handling publish
+  /// events, though the publish handlers themselves are called serially).
+  /// The schedule of those evaluations is derived once, when the Diagram is
+  /// built, from the connections and the direct feedthrough of the
+  /// subsystems.
+  ///
+  /// This is only allowed for subsystems that can be evaluated concurrently,
+  /// i.e., that do not share mutable data outside of their Context (or
+  /// protect it), and that report their direct feedthrough correctly. Caching
+  /// must not be disabled in the Context (see ContextBase::DisableCaching()).
+  /// Nested Diagrams have their own setting. The results do not depend on the
+  /// degree of parallelism.
+  void set_parallelism(Parallelism parallelism) {
+    ThrowIfAlreadyBuilt();
+    parallelism_ = parallelism;
+  }
+
+  /// Returns the degree of parallelism set by set_parallelism().
+  const Parallelism& parallelism() const {
+    ThrowIfAlreadyBuilt();
+    return parallelism_;
+  }
+
   /// Builds the Diagram that has been described by the calls to Connect,
   /// ExportInput, and ExportOutput.
   /// @throws std::exception if the graph is not buildable.
@@ -426,6 +456,9 @@ class DiagramBuilder {
   std::unordered_set<const System<T>*> systems_;
   // The Systems in this DiagramBuilder, in the order they were registered.
   internal::OwnedSystems<T> registered_systems_;
+
+  // The degree of parallelism passed on to the Diagram.
+  Parallelism parallelism_;
 };
 
 }  // namespace systems
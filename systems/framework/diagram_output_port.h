@@ -4,6 +4,7 @@
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
@@ -86,6 +87,19 @@ class DiagramOutputPort final : public OutputPort<T> {
     DRAKE_DEMAND(index.is_valid() && ticket.is_valid());
     DRAKE_DEMAND(source_subsystem_index.is_valid());
     DRAKE_DEMAND(source_output_port != nullptr);
+    // Resolve a chain of exported ports down to the port that actually
+    // computes the value, so that DoEval() doesn't have to recurse.
+    leaf_path_.push_back(source_subsystem_index);
+    const auto* source_diagram_port =
+        dynamic_cast<const DiagramOutputPort<T>*>(source_output_port);
+    if (source_diagram_port != nullptr) {
+      leaf_output_port_ = source_diagram_port->leaf_output_port_;
+      leaf_path_.insert(leaf_path_.end(),
+                        source_diagram_port->leaf_path_.begin(),
+                        source_diagram_port->leaf_path_.end());
+    } else {
+      leaf_output_port_ = source_output_port;
+    }
   }
 
   // Asks the source system output port to allocate an appropriate object.
@@ -101,11 +115,18 @@ class DiagramOutputPort final : public OutputPort<T> {
     return source_output_port_->Calc(subcontext, value);
   }
 
-  // Given the whole Diagram context, extracts the appropriate subcontext and
-  // delegates to the source output port.
+  // Given the whole Diagram context, extracts the subcontext of the leaf
+  // port's system and delegates to the leaf port directly, bypassing any
+  // intermediate diagram output ports.
   const AbstractValue& DoEval(const Context<T>& diagram_context) const final {
-    const Context<T>& subcontext = get_subcontext(diagram_context);
-    return source_output_port_->template Eval<AbstractValue>(subcontext);
+    // See get_subcontext() for why a static_cast is safe here. Every context
+    // along the path except the last is a DiagramContext.
+    const Context<T>* subcontext = &diagram_context;
+    for (const SubsystemIndex i : leaf_path_) {
+      subcontext = &static_cast<const DiagramContext<T>*>(subcontext)
+                        ->GetSubsystemContext(i);
+    }
+    return leaf_output_port_->template Eval<AbstractValue>(*subcontext);
   }
 
   // Returns the source output port's subsystem, and the ticket for that
@@ -139,6 +160,12 @@ class DiagramOutputPort final : public OutputPort<T> {
 
   const OutputPort<T>* const source_output_port_;
   const SubsystemIndex source_subsystem_index_;
+
+  // The first output port down the chain of exported ports that is not itself
+  // a DiagramOutputPort, and the subsystem indices leading from this diagram's
+  // context to that port's subcontext (starting with source_subsystem_index_).
+  const OutputPort<T>* leaf_output_port_{};
+  std::vector<SubsystemIndex> leaf_path_;
 };
 
 }  // namespace systems
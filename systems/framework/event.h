@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <unordered_set>
@@ -567,6 +568,39 @@ struct PeriodicEventDataComparator {
   }
 };
 
+#ifndef DRAKE_DOXYGEN_CXX
+namespace internal {
+// Returns the next sample time for the given periodic @p attribute: the
+// earliest time strictly after @p current_time_sec at which it triggers.
+template <typename T>
+T GetNextSampleTime(const PeriodicEventData& attribute,
+                    const T& current_time_sec) {
+  const double period = attribute.period_sec();
+  DRAKE_ASSERT(period > 0);
+  const double offset = attribute.offset_sec();
+  DRAKE_ASSERT(offset >= 0);
+
+  // If the first sample time hasn't arrived yet, then that is the next
+  // sample time.
+  if (current_time_sec < offset) {
+    return offset;
+  }
+
+  // Compute the index in the sequence of samples for the next time to sample,
+  // which should be greater than the present time.
+  using std::ceil;
+  const T offset_time = current_time_sec - offset;
+  const T next_k = ceil(offset_time / period);
+  T next_t = offset + next_k * period;
+  if (next_t <= current_time_sec) {
+    next_t = offset + (next_k + 1) * period;
+  }
+  DRAKE_ASSERT(next_t > current_time_sec);
+  return next_t;
+}
+}  // namespace internal
+#endif
+
 /** @defgroup event_callbacks Event Callbacks
     @ingroup technical_notes
 
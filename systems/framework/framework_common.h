@@ -212,6 +212,10 @@ class ContextMessageInterface {
   // Returns true if the cache in this subcontext has been frozen.
   virtual bool is_cache_frozen() const = 0;
 
+  // Returns true if value changes initiated in this subcontext should
+  // invalidate downstream cache entries in bulk.
+  virtual bool is_bulk_invalidation_enabled() const = 0;
+
   // Returns a mutable reference to the Context's (mutable) Cache's dummy
   // CacheEntryValue.
   virtual CacheEntryValue& dummy_cache_entry_value() const = 0;
@@ -6,45 +6,13 @@
 #include "absl/container/inlined_vector.h"
 
 #include "drake/common/pointer_cast.h"
+#include "drake/common/profiler.h"
 #include "drake/systems/framework/system_symbolic_inspector.h"
 #include "drake/systems/framework/value_checker.h"
 
 namespace drake {
 namespace systems {
 
-namespace {
-
-// Returns the next sample time for the given @p attribute.
-template <typename T>
-T GetNextSampleTime(
-    const PeriodicEventData& attribute,
-    const T& current_time_sec) {
-  const double period = attribute.period_sec();
-  DRAKE_ASSERT(period > 0);
-  const double offset = attribute.offset_sec();
-  DRAKE_ASSERT(offset >= 0);
-
-  // If the first sample time hasn't arrived yet, then that is the next
-  // sample time.
-  if (current_time_sec < offset) {
-    return offset;
-  }
-
-  // Compute the index in the sequence of samples for the next time to sample,
-  // which should be greater than the present time.
-  using std::ceil;
-  const T offset_time = current_time_sec - offset;
-  const T next_k = ceil(offset_time / period);
-  T next_t = offset + next_k * period;
-  if (next_t <= current_time_sec) {
-    next_t = offset + (next_k + 1) * period;
-  }
-  DRAKE_ASSERT(next_t > current_time_sec);
-  return next_t;
-}
-
-}  // namespace
-
 template <typename T>
 LeafSystem<T>::~LeafSystem() {}
 
@@ -370,7 +338,7 @@ void LeafSystem<T>::DoCalcNextUpdateTime(
   for (const auto& event_pair : periodic_events_) {
     const PeriodicEventData& event_data = event_pair.first;
     const Event<T>* const event = event_pair.second.get();
-    const T t = GetNextSampleTime(event_data, context.get_time());
+    const T t = internal::GetNextSampleTime(event_data, context.get_time());
     if (t < min_time) {
       min_time = t;
       next_events = {event};
@@ -825,6 +793,8 @@ void LeafSystem<T>::DispatchPublishHandler(
      dynamic_cast<const LeafEventCollection<PublishEvent<T>>&>(events);
   // Only call DoPublish if there are publish events.
   DRAKE_DEMAND(leaf_events.HasEvents());
+  ScopedProfileTimer timer(
+      [this]() { return this->GetSystemPathname() + " publish"; });
   this->DoPublish(context, leaf_events.get_events());
 }
 
@@ -838,6 +808,8 @@ void LeafSystem<T>::DispatchDiscreteVariableUpdateHandler(
           events);
   DRAKE_DEMAND(leaf_events.HasEvents());
 
+  ScopedProfileTimer timer(
+      [this]() { return this->GetSystemPathname() + " discrete update"; });
   // Must initialize the output argument with the current contents of the
   // discrete state.
   discrete_state->SetFrom(context.get_discrete_state());
@@ -867,6 +839,8 @@ void LeafSystem<T>::DispatchUnrestrictedUpdateHandler(
           events);
   DRAKE_DEMAND(leaf_events.HasEvents());
 
+  ScopedProfileTimer timer(
+      [this]() { return this->GetSystemPathname() + " unrestricted update"; });
   // Must initialize the output argument with the current contents of the
   // state.
   state->SetFrom(context.get_state());
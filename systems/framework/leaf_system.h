@@ -147,6 +147,9 @@ class LeafSystem : public System<T> {
   arithmetic. Subclasses that require aperiodic events should override, but
   be sure to invoke the parent class implementation at the start of the
   override if you want periodic events to continue to be handled.
+  Subclasses that don't override it may override
+  System::DoHasOnlyPeriodicUpdateTimes() to return true, which lets a Diagram
+  schedule their periodic events without calling this method.
 
   @post `time` is set to a value greater than or equal to
         `context.get_time()` on return.
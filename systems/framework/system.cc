@@ -370,6 +370,11 @@ T System<T>::CalcNextUpdateTime(const Context<T>& context,
   return time;
 }
 
+template <typename T>
+bool System<T>::HasOnlyPeriodicUpdateTimes() const {
+  return DoHasOnlyPeriodicUpdateTimes();
+}
+
 template <typename T>
 void System<T>::GetPerStepEvents(const Context<T>& context,
                                  CompositeEventCollection<T>* events) const {
@@ -642,10 +647,8 @@ const InputPort<T>* System<T>::get_input_port_selection(
 template <typename T>
 const InputPort<T>& System<T>::GetInputPort(
     const std::string& port_name) const {
-  for (InputPortIndex i{0}; i < num_input_ports(); i++) {
-    if (port_name == get_input_port_base(i).get_name()) {
-      return get_input_port(i);
-    }
+  if (const auto index = this->FindInputPortIndex(port_name)) {
+    return get_input_port(*index);
   }
   throw std::logic_error("System " + GetSystemName() +
                          " does not have an input port named " +
@@ -655,12 +658,7 @@ const InputPort<T>& System<T>::GetInputPort(
 template <typename T>
 bool System<T>::HasInputPort(
     const std::string& port_name) const {
-  for (InputPortIndex i{0}; i < num_input_ports(); i++) {
-    if (port_name == get_input_port_base(i).get_name()) {
-      return true;
-    }
-  }
-  return false;
+  return this->FindInputPortIndex(port_name).has_value();
 }
 
 template <typename T>
@@ -684,10 +682,8 @@ const OutputPort<T>* System<T>::get_output_port_selection(
 template <typename T>
 const OutputPort<T>& System<T>::GetOutputPort(
     const std::string& port_name) const {
-  for (OutputPortIndex i{0}; i < num_output_ports(); i++) {
-    if (port_name == get_output_port_base(i).get_name()) {
-      return get_output_port(i);
-    }
+  if (const auto index = this->FindOutputPortIndex(port_name)) {
+    return get_output_port(*index);
   }
   throw std::logic_error("System " + GetSystemName() +
                          " does not have an output port named " +
@@ -697,12 +693,7 @@ const OutputPort<T>& System<T>::GetOutputPort(
 template <typename T>
 bool System<T>::HasOutputPort(
     const std::string& port_name) const {
-  for (OutputPortIndex i{0}; i < num_output_ports(); i++) {
-    if (port_name == get_output_port_base(i).get_name()) {
-      return true;
-    }
-  }
-  return false;
+  return this->FindOutputPortIndex(port_name).has_value();
 }
 
 template <typename T>
@@ -1004,6 +995,11 @@ void System<T>::DoCalcNextUpdateTime(const Context<T>& context,
   *time = std::numeric_limits<double>::infinity();
 }
 
+template <typename T>
+bool System<T>::DoHasOnlyPeriodicUpdateTimes() const {
+  return false;
+}
+
 template <typename T>
 void System<T>::DoGetPerStepEvents(
     const Context<T>& context,
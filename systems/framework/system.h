@@ -610,6 +610,15 @@ class System : public SystemBase {
   T CalcNextUpdateTime(const Context<T>& context,
                        CompositeEventCollection<T>* events) const;
 
+  /** (Advanced) Returns true if this System promises that CalcNextUpdateTime()
+  reports exactly the earliest of its periodic events (see GetPeriodicEvents())
+  and nothing else, regardless of the rest of its Context. A Diagram schedules
+  the periodic events of such subsystems itself, rather than calling
+  CalcNextUpdateTime() on each of them at every step; that matters for
+  Diagrams with many periodic publishers. See
+  DoHasOnlyPeriodicUpdateTimes(). */
+  bool HasOnlyPeriodicUpdateTimes() const;
+
   /** This method is called by Simulator::Initialize() to gather all update
   and publish events that are to be handled in AdvanceTo() at the point
   before Simulator integrates continuous state. It is assumed that these
@@ -1463,6 +1472,20 @@ class System : public SystemBase {
                                     CompositeEventCollection<T>* events,
                                     T* time) const;
 
+  /** Override this method to return true if this System's
+  DoCalcNextUpdateTime() does just what LeafSystem's does: it reports the
+  earliest of the periodic events returned by DoGetPeriodicEvents(), with
+  their timings, and nothing else. A Diagram may then compute this System's
+  next update time and events from its periodic events, without calling
+  CalcNextUpdateTime(). A %LeafSystem with many periodic events at a few
+  rates, such as a publisher, is a good candidate.
+
+  Do not return true from a System that overrides DoCalcNextUpdateTime(), or
+  whose subclasses might; their timing would be ignored inside a Diagram.
+
+  The default implementation returns false. */
+  virtual bool DoHasOnlyPeriodicUpdateTimes() const;
+
   /** Implement this method to return all periodic triggered events.
   @see GetPeriodicEvents() for a detailed description of the returned
        variable.
@@ -69,12 +69,16 @@ void SystemBase::InitializeContextBase(ContextBase* context_ptr) const {
   internal::SystemBaseContextBaseAttorney::set_system_id(
       &context, system_id_);
 
+  // Every ticket this System will ever hand out is already known, so size the
+  // containers once rather than growing them an element at a time.
+  DependencyGraph& graph = context.get_mutable_dependency_graph();
+  graph.reserve(next_available_ticket_);
+  context.get_mutable_cache().reserve(num_cache_entries());
+
   // Add the independent-source trackers and wire them up appropriately. That
   // includes input ports since their dependencies are external.
   CreateSourceTrackers(&context);
 
-  DependencyGraph& graph = context.get_mutable_dependency_graph();
-
   // Create the Context cache containing a CacheEntryValue corresponding to
   // each CacheEntry, add a DependencyTracker and subscribe it to its
   // prerequisites as specified in the CacheEntry. Cache entries are
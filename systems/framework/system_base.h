@@ -7,6 +7,7 @@
 #include <set>
 #include <string>
 #include <typeinfo>
+#include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -818,12 +819,11 @@ class SystemBase : public internal::SystemMessageInterface {
     DRAKE_DEMAND(!port->get_name().empty());
 
     // Check that name is unique.
-    for (InputPortIndex i{0}; i < num_input_ports(); i++) {
-      if (port->get_name() == get_input_port_base(i).get_name()) {
-        throw std::logic_error("System " + GetSystemName() +
-            " already has an input port named " +
-            port->get_name());
-      }
+    if (!input_port_name_to_index_.emplace(port->get_name(),
+                                           port->get_index()).second) {
+      throw std::logic_error("System " + GetSystemName() +
+          " already has an input port named " +
+          port->get_name());
     }
 
     input_ports_.push_back(std::move(port));
@@ -843,17 +843,37 @@ class SystemBase : public internal::SystemMessageInterface {
     DRAKE_DEMAND(!port->get_name().empty());
 
     // Check that name is unique.
-    for (OutputPortIndex i{0}; i < num_output_ports(); i++) {
-      if (port->get_name() == get_output_port_base(i).get_name()) {
-        throw std::logic_error("System " + GetSystemName() +
-                               " already has an output port named " +
-                               port->get_name());
-      }
+    if (!output_port_name_to_index_.emplace(port->get_name(),
+                                            port->get_index()).second) {
+      throw std::logic_error("System " + GetSystemName() +
+                             " already has an output port named " +
+                             port->get_name());
     }
 
     output_ports_.push_back(std::move(port));
   }
 
+  /** (Internal use only) Returns the index of the input port named
+  `port_name`, or nullopt if there is no such port. This takes constant time,
+  so that looking up ports by name is cheap even for systems with thousands of
+  ports. */
+  std::optional<InputPortIndex> FindInputPortIndex(
+      const std::string& port_name) const {
+    const auto iter = input_port_name_to_index_.find(port_name);
+    if (iter == input_port_name_to_index_.end()) return std::nullopt;
+    return iter->second;
+  }
+
+  /** (Internal use only) Returns the index of the output port named
+  `port_name`, or nullopt if there is no such port. This takes constant
+  time. */
+  std::optional<OutputPortIndex> FindOutputPortIndex(
+      const std::string& port_name) const {
+    const auto iter = output_port_name_to_index_.find(port_name);
+    if (iter == output_port_name_to_index_.end()) return std::nullopt;
+    return iter->second;
+  }
+
   /** (Internal use only) Returns a name for the next input port, using the
   given name if it isn't kUseDefaultName, otherwise making up a name like "u3"
   from the next available input port index.
@@ -1200,6 +1220,10 @@ class SystemBase : public internal::SystemMessageInterface {
   // Indexed by CacheIndex.
   std::vector<std::unique_ptr<CacheEntry>> cache_entries_;
 
+  // The inverses of input_ports_ and output_ports_ by port name.
+  std::unordered_map<std::string, InputPortIndex> input_port_name_to_index_;
+  std::unordered_map<std::string, OutputPortIndex> output_port_name_to_index_;
+
   // States and parameters don't hold their own tickets so we track them here.
 
   // Indexed by DiscreteStateIndex.
@@ -47,6 +47,18 @@ TEST_F(AbstractStateTest, Clone) {
   EXPECT_EQ(76, UnpackIntValue(clone->get_value(1)));
 }
 
+// The clone is a deep copy: a mutable reference obtained before Clone() still
+// refers only to the original's value.
+TEST_F(AbstractStateTest, CloneIsDeep) {
+  AbstractValues xa(std::move(data_));
+  AbstractValue& value = xa.get_mutable_value(0);
+  std::unique_ptr<AbstractValues> clone = xa.Clone();
+  EXPECT_NE(&clone->get_value(0), &xa.get_value(0));
+  value.set_value<int>(5);
+  EXPECT_EQ(5, UnpackIntValue(xa.get_value(0)));
+  EXPECT_EQ(42, UnpackIntValue(clone->get_value(0)));
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
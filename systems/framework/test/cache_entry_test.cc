@@ -16,6 +16,8 @@
 
 #include <memory>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -757,6 +759,80 @@ TEST_F(CacheEntryTest, Copy) {
   EXPECT_FALSE(vector_entry().is_out_of_date(clone_context));
 }
 
+// Concurrent evaluation lets several threads Eval() the same Context. Each
+// out-of-date entry is computed once, and becomes an ordinary up-to-date value
+// once concurrent evaluation is disabled.
+TEST_F(CacheEntryTest, ConcurrentEvaluation) {
+  CacheEntryValue& value0 = entry0().get_mutable_cache_entry_value(context_);
+  CacheEntryValue& value2 = entry2().get_mutable_cache_entry_value(context_);
+  CacheEntryValue& string_value =
+      string_entry().get_mutable_cache_entry_value(context_);
+  const int64_t serial0 = value0.serial_number();
+  const int64_t serial2 = value2.serial_number();
+  const int64_t string_serial = string_value.serial_number();
+
+  // Invalidate everything downstream of entry0; leave string_entry alone.
+  invalidate(index0_);
+  EXPECT_FALSE(context_.is_concurrent_cache_evaluation_enabled());
+  context_.EnableConcurrentCacheEvaluation();
+  EXPECT_TRUE(context_.is_concurrent_cache_evaluation_enabled());
+  EXPECT_TRUE(value0.is_concurrent_evaluation_enabled());
+  EXPECT_TRUE(value0.needs_recomputation());
+  EXPECT_TRUE(entry0().is_out_of_date(context_));
+  EXPECT_FALSE(string_entry().is_out_of_date(context_));
+
+  std::vector<std::thread> threads;
+  std::vector<int> results0(8), results2(8), results3(8);
+  std::vector<const string*> string_results(8);
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&, i]() {
+      results0[i] = entry0().Eval<int>(context_);
+      results2[i] = entry2().Eval<int>(context_);
+      results3[i] = entry3().Eval<int>(context_);
+      string_results[i] = &string_entry().Eval<string>(context_);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(results0[i], 99);
+    EXPECT_EQ(results2[i], 98);
+    EXPECT_EQ(results3[i], 98);
+    EXPECT_EQ(*string_results[i], "initial");
+    EXPECT_EQ(string_results[i], string_results[0]);
+  }
+  EXPECT_FALSE(entry0().is_out_of_date(context_));
+  EXPECT_FALSE(entry2().is_out_of_date(context_));
+  DRAKE_EXPECT_NO_THROW(entry2().GetKnownUpToDate<int>(context_));
+  // The bookkeeping is deferred until concurrent evaluation is disabled.
+  EXPECT_EQ(value0.serial_number(), serial0);
+  EXPECT_EQ(value2.serial_number(), serial2);
+
+  // Modifications in between concurrent evaluations are permitted.
+  invalidate(index2_);
+  EXPECT_TRUE(entry2().is_out_of_date(context_));
+  EXPECT_FALSE(entry0().is_out_of_date(context_));
+  EXPECT_EQ(entry2().Eval<int>(context_), 98);
+
+  // A frozen cache still refuses to recompute.
+  invalidate(index2_);
+  context_.FreezeCache();
+  DRAKE_EXPECT_THROWS_MESSAGE(entry2().EvalAbstract(context_),
+                              ".*UpdateConcurrently.*frozen.*");
+  EXPECT_EQ(entry0().Eval<int>(context_), 99);
+  context_.UnfreezeCache();
+
+  context_.DisableConcurrentCacheEvaluation();
+  EXPECT_FALSE(context_.is_concurrent_cache_evaluation_enabled());
+  EXPECT_FALSE(value0.is_concurrent_evaluation_enabled());
+  EXPECT_FALSE(value0.needs_recomputation());
+  EXPECT_EQ(value0.serial_number(), serial0 + 1);
+  EXPECT_TRUE(entry2().is_out_of_date(context_));
+  EXPECT_EQ(value2.serial_number(), serial2);
+  EXPECT_EQ(string_value.serial_number(), string_serial);
+  EXPECT_EQ(entry2().Eval<int>(context_), 98);
+  EXPECT_EQ(value2.serial_number(), serial2 + 1);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
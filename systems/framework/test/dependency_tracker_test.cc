@@ -444,6 +444,65 @@ TEST_F(HandBuiltDependencies, Notify) {
   ExpectAllStatsMatch();
 }
 
+// With bulk invalidation, a value change marks every downstream cache entry
+// out of date exactly once, and the gathered entries are refreshed when a
+// subscription changes.
+TEST_F(HandBuiltDependencies, BulkInvalidation) {
+  EXPECT_FALSE(context_.is_bulk_invalidation_enabled());
+  context_.EnableBulkInvalidation();
+  EXPECT_TRUE(context_.is_bulk_invalidation_enabled());
+
+  entry0_->set_value(1125);
+  downstream1_->NoteValueChange(1LL);
+  EXPECT_FALSE(entry0_->is_out_of_date());
+  EXPECT_EQ(downstream1_->num_notifications_sent(), 0);
+
+  // There are two paths from upstream1 to entry0, but only one cache entry
+  // to invalidate. The downstream trackers aren't notified individually.
+  upstream1_->NoteValueChange(2LL);
+  EXPECT_TRUE(entry0_->is_out_of_date());
+  EXPECT_EQ(upstream1_->num_notifications_sent(), 1);
+  EXPECT_EQ(middle1_->num_notifications_received(), 0);
+
+  // A repeated change event is still ignored.
+  entry0_->mark_up_to_date();
+  upstream1_->NoteValueChange(2LL);
+  EXPECT_FALSE(entry0_->is_out_of_date());
+  EXPECT_EQ(upstream1_->num_ignored_notifications(), 1);
+
+  // Add a cache entry downstream of downstream1, after upstream1 has already
+  // gathered its downstream entries.
+  DependencyGraph& graph = context_.get_mutable_dependency_graph();
+  Cache& cache = context_.get_mutable_cache();
+  CacheEntryValue& entry1 = cache.CreateNewCacheEntryValue(
+      CacheIndex(cache.cache_size()), DependencyTicket(graph.trackers_size()),
+      "entry1",
+      {downstream1_->ticket()}, &graph);
+  entry1.SetInitialValue(AbstractValue::Make<int>(4));
+  entry1.mark_up_to_date();
+  upstream1_->NoteValueChange(3LL);
+  EXPECT_TRUE(entry0_->is_out_of_date());
+  EXPECT_TRUE(entry1.is_out_of_date());
+  EXPECT_EQ(upstream1_->num_notifications_sent(), 3);
+
+  // Likewise when a subscription is removed.
+  entry0_->mark_up_to_date();
+  entry1.mark_up_to_date();
+  downstream1_->UnsubscribeFromPrerequisite(upstream1_);
+  downstream1_->UnsubscribeFromPrerequisite(middle1_);
+  upstream1_->NoteValueChange(4LL);
+  EXPECT_TRUE(entry0_->is_out_of_date());
+  EXPECT_FALSE(entry1.is_out_of_date());
+
+  // Back to recursive notification.
+  context_.DisableBulkInvalidation();
+  EXPECT_FALSE(context_.is_bulk_invalidation_enabled());
+  entry0_->mark_up_to_date();
+  upstream2_->NoteValueChange(5LL);
+  EXPECT_TRUE(entry0_->is_out_of_date());
+  EXPECT_EQ(middle1_->num_prerequisite_change_events(), 1);
+}
+
 // Clone the dependency graph and make sure the clone works like the
 // original did, but on the new entities!
 TEST_F(HandBuiltDependencies, Clone) {
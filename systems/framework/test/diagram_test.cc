@@ -1,5 +1,9 @@
 #include "drake/systems/framework/diagram.h"
 
+#include <mutex>
+#include <set>
+#include <thread>
+
 #include <Eigen/Dense>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -9,6 +13,7 @@
 #include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/examples/pendulum/pendulum_plant.h"
+#include "drake/systems/analysis/simulator.h"
 #include "drake/systems/analysis/test_utilities/stateless_system.h"
 #include "drake/systems/framework/basic_vector.h"
 #include "drake/systems/framework/diagram_builder.h"
@@ -2173,6 +2178,73 @@ GTEST_TEST(DiscreteStateDiagramTest, IsDifferenceEquationSystem) {
   EXPECT_FALSE(one_period_two_state_diagram->IsDifferenceEquationSystem());
 }
 
+// A publisher whose next update time is determined by its periodic events
+// alone, so that a Diagram schedules them rather than asking it.
+class ScheduledPublisher : public LeafSystem<double> {
+ public:
+  explicit ScheduledPublisher(double period) {
+    DeclarePeriodicPublishEvent(period, 0, &ScheduledPublisher::Publish);
+  }
+
+ private:
+  EventStatus Publish(const Context<double>&) const {
+    return EventStatus::Succeeded();
+  }
+
+  bool DoHasOnlyPeriodicUpdateTimes() const final { return true; }
+};
+
+// Tests that the scheduled periodic events of several subsystems, at a few
+// rates, are reported in the same way as the events of a subsystem that is
+// asked for its next update time.
+GTEST_TEST(DiscreteStateDiagramTest, ScheduledPeriodicEvents) {
+  DiagramBuilder<double> builder;
+  std::vector<const ScheduledPublisher*> publishers;
+  for (int i = 0; i < 4; ++i) {
+    publishers.push_back(
+        builder.AddSystem<ScheduledPublisher>(i % 2 == 0 ? 0.5 : 0.75));
+  }
+  const auto* discrete = builder.AddSystem<SystemWithDiscreteState>(1, 1.);
+  const auto diagram = builder.Build();
+  EXPECT_TRUE(publishers[0]->HasOnlyPeriodicUpdateTimes());
+  EXPECT_FALSE(discrete->HasOnlyPeriodicUpdateTimes());
+  EXPECT_FALSE(diagram->HasOnlyPeriodicUpdateTimes());
+
+  auto context = diagram->CreateDefaultContext();
+  auto events = diagram->AllocateCompositeEventCollection();
+  auto publishes = [&](int i) {
+    return diagram
+        ->GetSubsystemCompositeEventCollection(*publishers[i], *events)
+        .get_publish_events()
+        .HasEvents();
+  };
+  auto updates = [&]() {
+    return diagram->GetSubsystemCompositeEventCollection(*discrete, *events)
+        .get_discrete_update_events()
+        .HasEvents();
+  };
+
+  EXPECT_EQ(diagram->CalcNextUpdateTime(*context, events.get()), 0.5);
+  EXPECT_TRUE(publishes(0) && publishes(2));
+  EXPECT_FALSE(publishes(1) || publishes(3) || updates());
+
+  context->SetTime(0.5);
+  EXPECT_EQ(diagram->CalcNextUpdateTime(*context, events.get()), 0.75);
+  EXPECT_TRUE(publishes(1) && publishes(3));
+  EXPECT_FALSE(publishes(0) || publishes(2) || updates());
+
+  // The scheduled events coincide with the asked subsystem's.
+  context->SetTime(0.75);
+  EXPECT_EQ(diagram->CalcNextUpdateTime(*context, events.get()), 1.0);
+  EXPECT_TRUE(publishes(0) && publishes(2) && updates());
+  EXPECT_FALSE(publishes(1) || publishes(3));
+
+  context->SetTime(1.0);
+  EXPECT_EQ(diagram->CalcNextUpdateTime(*context, events.get()), 1.5);
+  EXPECT_TRUE(publishes(0) && publishes(1) && publishes(2) && publishes(3));
+  EXPECT_FALSE(updates());
+}
+
 // Tests CalcDiscreteVariableUpdates() when there are multiple subsystems and
 // only one has an event to handle (call that the "participating subsystem"). We
 // want to verify that only the participating subsystem's State gets copied,
@@ -3689,6 +3761,182 @@ GTEST_TEST(ImplicitTimeDerivatives, DiagramProcessing) {
   EXPECT_EQ(residual, expected_result);
 }
 
+// Checks that ports exported through several levels of nesting, and inputs
+// connected to them, evaluate to the value held by the leaf output port.
+GTEST_TEST(NestedDiagramPortTest, EvalReachesLeafPort) {
+  std::unique_ptr<Diagram<double>> inner;
+  Gain<double>* gain = nullptr;
+  {
+    DiagramBuilder<double> builder;
+    gain = builder.AddSystem<Gain<double>>(2.0, 1);
+    builder.ExportInput(gain->get_input_port());
+    builder.ExportOutput(gain->get_output_port());
+    inner = builder.Build();
+  }
+  std::unique_ptr<Diagram<double>> middle;
+  const Diagram<double>* inner_ptr = inner.get();
+  {
+    DiagramBuilder<double> builder;
+    builder.AddSystem(std::move(inner));
+    builder.ExportInput(inner_ptr->get_input_port(0));
+    builder.ExportOutput(inner_ptr->get_output_port(0));
+    middle = builder.Build();
+  }
+  DiagramBuilder<double> builder;
+  auto* source = builder.AddSystem<ConstantVectorSource<double>>(3.0);
+  const Diagram<double>* middle_ptr = builder.AddSystem(std::move(middle));
+  auto* adder = builder.AddSystem<Adder<double>>(2, 1);
+  builder.Connect(source->get_output_port(), middle_ptr->get_input_port(0));
+  builder.Connect(middle_ptr->get_output_port(0), adder->get_input_port(0));
+  builder.ExportInput(adder->get_input_port(1));
+  builder.ExportOutput(middle_ptr->get_output_port(0));
+  builder.ExportOutput(adder->get_output_port());
+  auto outer = builder.Build();
+
+  // The exported ports still report their immediate sources.
+  const auto& outer_port =
+      dynamic_cast<const DiagramOutputPort<double>&>(outer->get_output_port(0));
+  EXPECT_EQ(&outer_port.get_source_output_port(),
+            &middle_ptr->get_output_port(0));
+
+  auto context = outer->CreateDefaultContext();
+  outer->get_input_port(0).FixValue(context.get(), 1.0);
+  const Context<double>& gain_context =
+      gain->GetMyContextFromRoot(*context);
+  EXPECT_EQ(&outer_port.Eval<BasicVector<double>>(*context),
+            &gain->get_output_port().Eval<BasicVector<double>>(gain_context));
+  EXPECT_EQ(outer_port.Eval(*context)[0], 6.0);
+  EXPECT_EQ(outer->get_output_port(1).Eval(*context)[0], 7.0);
+
+  // Invalidation still flows through the nested ports.
+  BasicVector<double>& source_value = source->get_mutable_source_value(
+      &source->GetMyMutableContextFromRoot(context.get()));
+  source_value[0] = 4.0;
+  EXPECT_EQ(outer_port.Eval(*context)[0], 8.0);
+  EXPECT_EQ(outer->get_output_port(1).Eval(*context)[0], 9.0);
+}
+
+// A system with continuous and discrete state, whose output feeds through
+// from its input. It records the threads on which its state updates run.
+class ThreadRecordingSystem final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ThreadRecordingSystem)
+
+  explicit ThreadRecordingSystem(std::set<std::thread::id>* threads)
+      : threads_(threads) {
+    DeclareContinuousState(1);
+    DeclareDiscreteState(1);
+    DeclareVectorInputPort("u", 1);
+    DeclareVectorOutputPort("y", 1, &ThreadRecordingSystem::CalcOutput);
+    DeclarePeriodicDiscreteUpdateEvent(0.1, 0.0,
+                                       &ThreadRecordingSystem::Update);
+  }
+
+ private:
+  double CalcY(const Context<double>& context) const {
+    return get_input_port(0).Eval(context)[0] +
+           context.get_discrete_state_vector()[0] +
+           context.get_continuous_state_vector()[0];
+  }
+
+  void CalcOutput(const Context<double>& context,
+                  BasicVector<double>* output) const {
+    (*output)[0] = CalcY(context);
+  }
+
+  EventStatus Update(const Context<double>& context,
+                     DiscreteValues<double>* next) const {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      threads_->insert(std::this_thread::get_id());
+    }
+    (*next)[0] = 0.5 * CalcY(context);
+    return EventStatus::Succeeded();
+  }
+
+  void DoCalcTimeDerivatives(const Context<double>& context,
+                             ContinuousState<double>* derivatives) const final {
+    (*derivatives)[0] = -CalcY(context);
+  }
+
+  std::set<std::thread::id>* const threads_;
+  mutable std::mutex mutex_;
+};
+
+// Builds source -> zero -> {one -> three, two}, where zero, one, two and three
+// are ThreadRecordingSystem instances, exporting the output of two.
+std::unique_ptr<Diagram<double>> MakeParallelTestDiagram(
+    const Parallelism& parallelism, std::set<std::thread::id>* threads) {
+  DiagramBuilder<double> builder;
+  builder.set_parallelism(parallelism);
+  EXPECT_EQ(builder.parallelism().num_threads(), parallelism.num_threads());
+  auto* source = builder.AddSystem<ConstantVectorSource<double>>(1.0);
+  std::vector<ThreadRecordingSystem*> systems;
+  for (int i = 0; i < 4; ++i) {
+    systems.push_back(builder.AddSystem<ThreadRecordingSystem>(threads));
+  }
+  builder.Cascade(*source, *systems[0]);
+  builder.Cascade(*systems[0], *systems[1]);
+  builder.Cascade(*systems[0], *systems[2]);
+  builder.Cascade(*systems[1], *systems[3]);
+  builder.ExportOutput(systems[2]->get_output_port(0));
+  return builder.Build();
+}
+
+// Checks that a Diagram that dispatches to its subsystems in parallel does so
+// concurrently, with the same results as a serial Diagram.
+GTEST_TEST(DiagramParallelismTest, SameResultsAsSerial) {
+  std::set<std::thread::id> serial_threads;
+  auto serial = MakeParallelTestDiagram(Parallelism::None(), &serial_threads);
+  EXPECT_EQ(serial->parallelism().num_threads(), 1);
+  std::set<std::thread::id> parallel_threads;
+  auto parallel = MakeParallelTestDiagram(Parallelism(4), &parallel_threads);
+  EXPECT_EQ(parallel->parallelism().num_threads(), 4);
+
+  auto serial_context = serial->CreateDefaultContext();
+  auto parallel_context = parallel->CreateDefaultContext();
+  const VectorXd x0 = VectorXd::LinSpaced(8, 0.1, 0.8);
+  serial_context->SetContinuousState(x0.head(4));
+  parallel_context->SetContinuousState(x0.head(4));
+  for (int i = 0; i < 4; ++i) {
+    serial_context->SetDiscreteState(i, x0.segment<1>(4 + i));
+    parallel_context->SetDiscreteState(i, x0.segment<1>(4 + i));
+  }
+
+  const VectorXd serial_xcdot =
+      serial->EvalTimeDerivatives(*serial_context).CopyToVector();
+  const VectorXd parallel_xcdot =
+      parallel->EvalTimeDerivatives(*parallel_context).CopyToVector();
+  EXPECT_EQ(parallel_xcdot, serial_xcdot);
+
+  Simulator<double> serial_simulator(*serial, std::move(serial_context));
+  serial_simulator.AdvanceTo(1.0);
+  Simulator<double> parallel_simulator(*parallel, std::move(parallel_context));
+  parallel_simulator.AdvanceTo(1.0);
+  const Context<double>& serial_result = serial_simulator.get_context();
+  const Context<double>& parallel_result = parallel_simulator.get_context();
+  EXPECT_EQ(parallel_result.get_continuous_state_vector().CopyToVector(),
+            serial_result.get_continuous_state_vector().CopyToVector());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(parallel_result.get_discrete_state(i).value(),
+              serial_result.get_discrete_state(i).value());
+  }
+  EXPECT_EQ(parallel->get_output_port(0).Eval(parallel_result),
+            serial->get_output_port(0).Eval(serial_result));
+
+  EXPECT_EQ(serial_threads.size(), 1);
+  EXPECT_GT(parallel_threads.size(), 1);
+}
+
+GTEST_TEST(DiagramParallelismTest, ScalarConversion) {
+  DiagramBuilder<double> builder;
+  builder.set_parallelism(Parallelism(3));
+  builder.AddSystem<Integrator<double>>(1);
+  std::unique_ptr<Diagram<AutoDiffXd>> diagram =
+      System<double>::ToAutoDiffXd(*builder.Build());
+  EXPECT_EQ(diagram->parallelism().num_threads(), 3);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -248,6 +248,11 @@ class LcmPublisherSystem : public LeafSystem<double> {
   drake::lcm::DrakeLcmInterface* const lcm_;
 
   const double publish_period_;
+
+  // A per-Context scratch std::vector<uint8_t> that holds the serialized
+  // message; it is reused across publishes so that its storage only needs to
+  // be allocated when the message grows.
+  CacheIndex message_bytes_cache_index_;
 };
 
 }  // namespace lcm
@@ -1,10 +1,12 @@
 #include "drake/systems/lcm/lcm_subscriber_system.h"
 
+#include <array>
 #include <functional>
 #include <iostream>
 #include <utility>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/scope_exit.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/framework/basic_vector.h"
 
@@ -19,17 +21,80 @@ namespace {
 constexpr int kStateIndexMessage = 0;
 constexpr int kStateIndexMessageCount = 1;
 constexpr int kMagic = 6832;  // An arbitrary value.
+
+// The type of the message state in kLockFree mode.
+using MessageBytes = std::shared_ptr<const std::vector<uint8_t>>;
 }  // namespace
 
+// A lock-free "triple buffer" that holds the most recently received message,
+// for a single producer (the LCM receive thread) and a single consumer (the
+// consumers must serialize among themselves).
+//
+// The producer copies each message into its back buffer and then atomically
+// exchanges the back buffer with the middle buffer, flagging the middle buffer
+// as fresh. The consumer exchanges its front buffer with the middle buffer
+// when it is fresh. Buffers are shared (immutably) with the abstract states
+// that have processed them, so the producer only reuses the storage of a
+// buffer that nobody else refers to; in steady state there is one copy and no
+// allocation per message.
+class LcmSubscriberSystem::LatestMessageBuffer {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LatestMessageBuffer)
+
+  LatestMessageBuffer() = default;
+
+  // Called only by the producer.
+  void Write(const void* data, int size) {
+    std::shared_ptr<std::vector<uint8_t>>& back = buffers_[back_];
+    if (back.use_count() != 1) {
+      back = std::make_shared<std::vector<uint8_t>>();
+    } else {
+      // Synchronize with the release of the other references.
+      std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    const uint8_t* const begin = static_cast<const uint8_t*>(data);
+    back->assign(begin, begin + size);
+    back_ = middle_.exchange(back_ | kFresh, std::memory_order_acq_rel) &
+            kIndexMask;
+  }
+
+  // Called only by the consumer. Returns the most recently written message,
+  // or nullptr if nothing has been written yet.
+  MessageBytes Read() {
+    if (middle_.load(std::memory_order_acquire) & kFresh) {
+      front_ = middle_.exchange(front_, std::memory_order_acq_rel) &
+               kIndexMask;
+    }
+    return buffers_[front_];
+  }
+
+ private:
+  static constexpr int kIndexMask = 0x3;
+  static constexpr int kFresh = 0x4;
+
+  std::array<std::shared_ptr<std::vector<uint8_t>>, 3> buffers_;
+  // Owned by the producer.
+  int back_{0};
+  // The index of the middle buffer, and whether it is fresh.
+  std::atomic<int> middle_{1};
+  // Owned by the consumer.
+  int front_{2};
+};
+
 LcmSubscriberSystem::LcmSubscriberSystem(
     const std::string& channel,
     std::unique_ptr<SerializerInterface> serializer,
-    drake::lcm::DrakeLcmInterface* lcm)
+    drake::lcm::DrakeLcmInterface* lcm,
+    LcmSubscriberHandoff handoff)
     : channel_(channel),
       serializer_(std::move(serializer)),
+      handoff_(handoff),
       magic_number_{kMagic} {
   DRAKE_DEMAND(serializer_ != nullptr);
   DRAKE_DEMAND(lcm != nullptr);
+  if (handoff_ == LcmSubscriberHandoff::kLockFree) {
+    latest_message_ = std::make_unique<LatestMessageBuffer>();
+  }
 
   subscription_ = lcm->Subscribe(
       channel_, [this](const void* buffer, int size) {
@@ -39,15 +104,29 @@ LcmSubscriberSystem::LcmSubscriberSystem(
     subscription_->set_unsubscribe_on_delete(true);
   }
 
-  // Declare our two states (message_value, message_count).
+  // Declare our two states (message_value, message_count). In kLockFree
+  // mode, the message_value is the (not yet deserialized) message bytes.
   static_assert(kStateIndexMessage == 0, "");
   auto message_state_index =
-      this->DeclareAbstractState(*serializer_->CreateDefaultValue());
+      handoff_ == LcmSubscriberHandoff::kLockFree
+          ? this->DeclareAbstractState(Value<MessageBytes>())
+          : this->DeclareAbstractState(*serializer_->CreateDefaultValue());
   static_assert(kStateIndexMessageCount == 1, "");
   this->DeclareAbstractState(Value<int>(0));
 
-  // Our sole output is the message state.
-  this->DeclareStateOutputPort(kUseDefaultName, message_state_index);
+  // Our sole output is the message state (deserialized on demand in kLockFree
+  // mode).
+  if (handoff_ == LcmSubscriberHandoff::kLockFree) {
+    this->DeclareAbstractOutputPort(
+        kUseDefaultName,
+        [this]() { return serializer_->CreateDefaultValue(); },
+        [this](const Context<double>& context, AbstractValue* output) {
+          this->CalcLazyOutput(context, output);
+        },
+        {this->abstract_state_ticket(message_state_index)});
+  } else {
+    this->DeclareStateOutputPort(kUseDefaultName, message_state_index);
+  }
 
   // Declare an unrestricted forced update handler that is invoked when a
   // "forced" trigger occurs. This gives the user flexibility to force update
@@ -73,6 +152,19 @@ systems::EventStatus LcmSubscriberSystem::ProcessMessageAndStoreToAbstractState(
     const Context<double>&, State<double>* state) const {
   AbstractValues& abstract_state = state->get_mutable_abstract_state();
   std::lock_guard<std::mutex> lock(received_message_mutex_);
+  if (handoff_ == LcmSubscriberHandoff::kLockFree) {
+    // The count is read first; the handler increments it only after the
+    // message is in the buffer, so the bytes are at least as new as the count.
+    const int count = received_message_count_.load();
+    MessageBytes bytes = latest_message_->Read();
+    if (bytes != nullptr) {
+      abstract_state.get_mutable_value(kStateIndexMessage)
+          .get_mutable_value<MessageBytes>() = std::move(bytes);
+    }
+    abstract_state.get_mutable_value(kStateIndexMessageCount)
+        .get_mutable_value<int>() = count;
+    return systems::EventStatus::Succeeded();
+  }
   if (!received_message_.empty()) {
     serializer_->Deserialize(
         received_message_.data(), received_message_.size(),
@@ -84,6 +176,18 @@ systems::EventStatus LcmSubscriberSystem::ProcessMessageAndStoreToAbstractState(
   return systems::EventStatus::Succeeded();
 }
 
+void LcmSubscriberSystem::CalcLazyOutput(const Context<double>& context,
+                                         AbstractValue* output) const {
+  const MessageBytes& bytes =
+      context.get_abstract_state<MessageBytes>(kStateIndexMessage);
+  if (bytes == nullptr) {
+    output->SetFrom(*serializer_->CreateDefaultValue());
+    return;
+  }
+  serializer_->Deserialize(bytes->data(), static_cast<int>(bytes->size()),
+                           output);
+}
+
 int LcmSubscriberSystem::GetMessageCount(const Context<double>& context) const {
   return context.get_abstract_state<int>(kStateIndexMessageCount);
 }
@@ -101,10 +205,7 @@ void LcmSubscriberSystem::DoCalcNextUpdateTime(
 
   // Do nothing unless we have a new message.
   const int last_message_count = GetMessageCount(context);
-  const int received_message_count = [this]() {
-    std::unique_lock<std::mutex> lock(received_message_mutex_);
-    return received_message_count_;
-  }();
+  const int received_message_count = received_message_count_.load();
   if (last_message_count == received_message_count) {
     return;
   }
@@ -139,6 +240,19 @@ void LcmSubscriberSystem::HandleMessage(const void* buffer, int size) {
   DRAKE_LOGGER_TRACE("Receiving LCM {} message", channel_);
   DRAKE_DEMAND(magic_number_ == kMagic);
 
+  if (handoff_ == LcmSubscriberHandoff::kLockFree) {
+    latest_message_->Write(buffer, size);
+    received_message_count_++;
+    // Only blocked waiters need the mutex; taking (and releasing) it ensures
+    // that a waiter can't miss this notification between checking the count
+    // and going to sleep.
+    if (num_waiters_.load() > 0) {
+      { std::lock_guard<std::mutex> lock(received_message_mutex_); }
+      received_message_condition_variable_.notify_all();
+    }
+    return;
+  }
+
   const uint8_t* const rbuf_begin = static_cast<const uint8_t*>(buffer);
   const uint8_t* const rbuf_end = rbuf_begin + size;
   std::lock_guard<std::mutex> lock(received_message_mutex_);
@@ -160,6 +274,10 @@ int LcmSubscriberSystem::WaitForMessage(
   // a callback function invoked by a different thread owned by the
   // drake::lcm::DrakeLcmInterface instance passed to the constructor. Thus,
   // for thread safety, these need to be properly protected by a mutex.
+  // In kLockFree mode, the handler only takes the mutex when it sees that
+  // there are waiters, so we must announce ourselves before checking the count.
+  num_waiters_++;
+  ScopeExit guard([this]() { num_waiters_--; });
   std::unique_lock<std::mutex> lock(received_message_mutex_);
 
   // Predicate to handle spurious wakeup -- in other words, we can stop if we
@@ -191,16 +309,22 @@ int LcmSubscriberSystem::WaitForMessage(
   }
 
   if (message) {
+    if (handoff_ == LcmSubscriberHandoff::kLockFree) {
+      const MessageBytes bytes = latest_message_->Read();
+      DRAKE_DEMAND(bytes != nullptr);
+      serializer_->Deserialize(
+          bytes->data(), static_cast<int>(bytes->size()), message);
+    } else {
       serializer_->Deserialize(
           received_message_.data(), received_message_.size(), message);
+    }
   }
 
   return received_message_count_;
 }
 
 int LcmSubscriberSystem::GetInternalMessageCount() const {
-  std::unique_lock<std::mutex> lock(received_message_mutex_);
-  return received_message_count_;
+  return received_message_count_.load();
 }
 
 }  // namespace lcm
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -18,6 +19,30 @@ namespace drake {
 namespace systems {
 namespace lcm {
 
+/**
+ * Selects how an LcmSubscriberSystem hands received messages from the LCM
+ * receive thread over to the System.
+ */
+enum class LcmSubscriberHandoff {
+  /**
+   * Each received message is copied into a buffer guarded by a mutex, and is
+   * deserialized into the State when the update event processes it. The State
+   * holds the message object, e.g., an lcmt_drake_signal.
+   */
+  kLocked,
+
+  /**
+   * Each received message is copied exactly once, by the receive thread, into
+   * a lock-free single-producer "latest message only" buffer; messages that
+   * are overwritten before they are processed are dropped. The update event
+   * stores a (shared, immutable) reference to the latest message bytes into
+   * the State, and the output port deserializes them lazily, only when the
+   * output is evaluated. The State holds the bytes rather than the message
+   * object, so users must read the message from the output port.
+   */
+  kLockFree,
+};
+
 /**
  * Receives LCM messages from a given channel and outputs them to a
  * System<double>'s port. This class stores the most recently processed LCM
@@ -58,12 +83,15 @@ class LcmSubscriberSystem : public LeafSystem<double> {
    * @param[in] channel The LCM channel on which to subscribe.
    *
    * @param lcm A non-null pointer to the LCM subsystem to subscribe on.
+   *
+   * @param handoff How received messages are handed over to the System.
    */
   template <typename LcmMessage>
   static std::unique_ptr<LcmSubscriberSystem> Make(
-      const std::string& channel, drake::lcm::DrakeLcmInterface* lcm) {
+      const std::string& channel, drake::lcm::DrakeLcmInterface* lcm,
+      LcmSubscriberHandoff handoff = LcmSubscriberHandoff::kLocked) {
     return std::make_unique<LcmSubscriberSystem>(
-        channel, std::make_unique<Serializer<LcmMessage>>(), lcm);
+        channel, std::make_unique<Serializer<LcmMessage>>(), lcm, handoff);
   }
 
   /**
@@ -77,10 +105,14 @@ class LcmSubscriberSystem : public LeafSystem<double> {
    * and LCM message objects.
    *
    * @param lcm A non-null pointer to the LCM subsystem to subscribe on.
+   *
+   * @param handoff How received messages are handed over to the System.
    */
-  LcmSubscriberSystem(const std::string& channel,
-                      std::unique_ptr<SerializerInterface> serializer,
-                      drake::lcm::DrakeLcmInterface* lcm);
+  LcmSubscriberSystem(
+      const std::string& channel,
+      std::unique_ptr<SerializerInterface> serializer,
+      drake::lcm::DrakeLcmInterface* lcm,
+      LcmSubscriberHandoff handoff = LcmSubscriberHandoff::kLocked);
 
   ~LcmSubscriberSystem() override;
 
@@ -118,10 +150,20 @@ class LcmSubscriberSystem : public LeafSystem<double> {
    */
   int GetMessageCount(const Context<double>& context) const;
 
+  /** Returns the handoff mode this system was constructed with. */
+  LcmSubscriberHandoff handoff() const { return handoff_; }
+
  private:
+  class LatestMessageBuffer;
+
   // Callback entry point from LCM into this class.
   void HandleMessage(const void*, int);
 
+  // Deserializes the message bytes in the State into `output` (only used in
+  // kLockFree mode).
+  void CalcLazyOutput(const Context<double>& context,
+                      AbstractValue* output) const;
+
   void DoCalcNextUpdateTime(const Context<double>& context,
                             systems::CompositeEventCollection<double>* events,
                             double* time) const final;
@@ -136,17 +178,27 @@ class LcmSubscriberSystem : public LeafSystem<double> {
   // Will be non-null iff our output port is abstract-valued.
   const std::unique_ptr<SerializerInterface> serializer_;
 
-  // The mutex that guards received_message_ and received_message_count_.
+  const LcmSubscriberHandoff handoff_;
+
+  // The mutex that guards received_message_ in kLocked mode. In kLockFree
+  // mode, it is never taken by the handler unless a WaitForMessage() call is
+  // blocked; instead, it serializes the readers of latest_message_.
   mutable std::mutex received_message_mutex_;
 
   // A condition variable that's signaled every time the handler is called.
   mutable std::condition_variable received_message_condition_variable_;
 
-  // The bytes of the most recently received LCM message.
+  // The bytes of the most recently received LCM message (kLocked mode).
   std::vector<uint8_t> received_message_;
 
+  // The most recently received LCM message (kLockFree mode).
+  std::unique_ptr<LatestMessageBuffer> latest_message_;
+
+  // The number of WaitForMessage() calls that are blocked (kLockFree mode).
+  mutable std::atomic<int> num_waiters_{0};
+
   // A message counter that's incremented every time the handler is called.
-  int received_message_count_{0};
+  std::atomic<int> received_message_count_{0};
 
   // When we are destroyed, our subscription will be automatically removed
   // (if the DrakeLcmInterface supports removal).
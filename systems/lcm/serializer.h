@@ -42,7 +42,10 @@ class SerializerInterface {
       AbstractValue* abstract_value) const = 0;
 
   /**
-   * Translates a drake::AbstractValue object into LCM message bytes.
+   * Translates a drake::AbstractValue object into LCM message bytes, replacing
+   * the contents of @p message_bytes. Callers may pass the same vector to
+   * successive calls (as LcmPublisherSystem does), so implementations should
+   * reuse its capacity rather than reallocating it.
    */
   virtual void Serialize(const AbstractValue& abstract_value,
                          std::vector<uint8_t>* message_bytes) const = 0;
@@ -89,6 +92,8 @@ class Serializer : public SerializerInterface {
                  std::vector<uint8_t>* message_bytes) const override {
     DRAKE_DEMAND(message_bytes != nullptr);
     const LcmMessage& message = abstract_value.get_value<LcmMessage>();
+    // The encoded size is known up front, so we encode directly into the
+    // caller's buffer (whose capacity is retained by resize).
     const int message_length = message.getEncodedSize();
     message_bytes->resize(message_length);
     int consumed = message.encode(message_bytes->data(), 0, message_length);
@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -106,6 +107,51 @@ GTEST_TEST(LcmPublisherSystemTest, SerializerTest) {
   EXPECT_TRUE(CompareLcmtDrakeSignalMessages(sub.message(), sample_data));
 }
 
+// A serializer that records the address of the buffer it writes into.
+class RecordingSerializer final : public Serializer<lcmt_drake_signal> {
+ public:
+  explicit RecordingSerializer(std::vector<const uint8_t*>* buffers)
+      : buffers_(buffers) {}
+
+  void Serialize(const AbstractValue& abstract_value,
+                 std::vector<uint8_t>* message_bytes) const final {
+    Serializer<lcmt_drake_signal>::Serialize(abstract_value, message_bytes);
+    buffers_->push_back(message_bytes->data());
+  }
+
+ private:
+  std::vector<const uint8_t*>* const buffers_;
+};
+
+// Tests that the publisher reuses its message buffer from one publish to the
+// next.
+GTEST_TEST(LcmPublisherSystemTest, ReusesMessageBuffer) {
+  lcm::DrakeLcm interface;
+  const std::string channel_name = "channel_name";
+  std::vector<const uint8_t*> buffers;
+  LcmPublisherSystem dut(channel_name,
+                         std::make_unique<RecordingSerializer>(&buffers),
+                         &interface);
+  unique_ptr<Context<double>> context = dut.CreateDefaultContext();
+  Subscriber sub(&interface, channel_name);
+
+  // Publish a large message, and then a smaller one.
+  lcmt_drake_signal large{};
+  large.dim = 100;
+  large.val.resize(100, 1.0);
+  large.coord.resize(100, "coord");
+  dut.get_input_port().FixValue(context.get(), large);
+  dut.Publish(*context);
+  const lcmt_drake_signal small{1, {2.0}, {"x"}, 1234};
+  dut.get_input_port().FixValue(context.get(), small);
+  dut.Publish(*context);
+  interface.HandleSubscriptions(0);
+  EXPECT_TRUE(CompareLcmtDrakeSignalMessages(sub.message(), small));
+
+  ASSERT_EQ(buffers.size(), 2);
+  EXPECT_EQ(buffers[0], buffers[1]);
+}
+
 // Tests that per-step publish generates the expected number of publishes.
 GTEST_TEST(LcmPublisherSystemTest, TestPerStepPublish) {
   lcm::DrakeLcm interface;
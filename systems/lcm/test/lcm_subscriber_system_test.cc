@@ -102,13 +102,67 @@ GTEST_TEST(LcmSubscriberSystemTest, ReceiveTest) {
   EXPECT_TRUE(CompareLcmtDrakeSignalMessages(value, sample_data.value));
 }
 
-GTEST_TEST(LcmSubscriberSystemTest, WaitTest) {
-  // Ensure that `WaitForMessage` works as expected.
+// Tests LcmSubscriberSystem in kLockFree mode, where only the latest message
+// is kept and the output is deserialized on demand.
+GTEST_TEST(LcmSubscriberSystemTest, LockFreeReceiveTest) {
+  drake::lcm::DrakeLcm lcm;
+  const std::string channel_name = "channel_name";
+
+  auto dut = LcmSubscriberSystem::Make<lcmt_drake_signal>(
+      channel_name, &lcm, LcmSubscriberHandoff::kLockFree);
+  EXPECT_EQ(dut->handoff(), LcmSubscriberHandoff::kLockFree);
+  std::unique_ptr<Context<double>> context = dut->CreateDefaultContext();
+
+  // Before any message arrives, the output is the default message.
+  EXPECT_TRUE(CompareLcmtDrakeSignalMessages(
+      dut->get_output_port().Eval<lcmt_drake_signal>(*context),
+      lcmt_drake_signal{}));
+
+  // Two messages arrive before the system is updated; only the latest one is
+  // output.
+  SampleData first;
+  first.value.timestamp = 1;
+  first.PublishAndHandle(&lcm, channel_name);
+  SampleData second;
+  second.value.timestamp = 2;
+  second.PublishAndHandle(&lcm, channel_name);
+  EXPECT_EQ(dut->GetInternalMessageCount(), 2);
+
+  std::unique_ptr<SystemOutput<double>> output = dut->AllocateOutput();
+  EvalOutputHelper(*dut, context.get(), output.get());
+  EXPECT_EQ(dut->GetMessageCount(*context), 2);
+  EXPECT_TRUE(CompareLcmtDrakeSignalMessages(
+      output->get_data(0)->get_value<lcmt_drake_signal>(), second.value));
+
+  // A second context can still process the same (latest) message.
+  std::unique_ptr<Context<double>> other_context = dut->CreateDefaultContext();
+  EvalOutputHelper(*dut, other_context.get(), output.get());
+  EXPECT_EQ(dut->GetMessageCount(*other_context), 2);
+  EXPECT_TRUE(CompareLcmtDrakeSignalMessages(
+      output->get_data(0)->get_value<lcmt_drake_signal>(), second.value));
+
+  // A newer message doesn't disturb the states that have already processed
+  // the older one.
+  SampleData third;
+  third.value.timestamp = 3;
+  third.PublishAndHandle(&lcm, channel_name);
+  EXPECT_TRUE(CompareLcmtDrakeSignalMessages(
+      dut->get_output_port().Eval<lcmt_drake_signal>(*context),
+      second.value));
+  EvalOutputHelper(*dut, context.get(), output.get());
+  EXPECT_EQ(dut->GetMessageCount(*context), 3);
+  EXPECT_TRUE(CompareLcmtDrakeSignalMessages(
+      output->get_data(0)->get_value<lcmt_drake_signal>(), third.value));
+}
+
+// Ensures that `WaitForMessage` works as expected.
+void CheckWaitForMessage(LcmSubscriberHandoff handoff) {
   drake::lcm::DrakeLcm lcm;
   const std::string channel_name = "channel_name";
 
   // Start device under test, with background LCM thread running.
-  auto dut = LcmSubscriberSystem::Make<lcmt_drake_signal>(channel_name, &lcm);
+  auto dut = LcmSubscriberSystem::Make<lcmt_drake_signal>(
+      channel_name, &lcm, handoff);
 
   SampleData sample_data;
 
@@ -171,6 +225,14 @@ GTEST_TEST(LcmSubscriberSystemTest, WaitTest) {
   EXPECT_GE(second_timeout_count.get(), old_count + 1);
 }
 
+GTEST_TEST(LcmSubscriberSystemTest, WaitTest) {
+  CheckWaitForMessage(LcmSubscriberHandoff::kLocked);
+}
+
+GTEST_TEST(LcmSubscriberSystemTest, LockFreeWaitTest) {
+  CheckWaitForMessage(LcmSubscriberHandoff::kLockFree);
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace systems
@@ -245,6 +245,29 @@ bool IsMeaningful(const Eigen::MatrixXd& m) {
   return m.size() > 0 && (m.array() != 0).any();
 }
 
+bool IsMeaningful(const Eigen::SparseMatrix<double>& m) {
+  for (int k = 0; k < m.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(m, k); it; ++it) {
+      if (it.value() != 0) return true;
+    }
+  }
+  return false;
+}
+
+// Adds M * v to `result`. This spells out the sparse matrix-vector product so
+// that it works for any scalar type T of the vector.
+template <typename T>
+void AddSparseTimesVector(const Eigen::SparseMatrix<double>& M,
+                          const Eigen::Ref<const VectorX<T>>& v,
+                          EigenPtr<VectorX<T>> result) {
+  DRAKE_ASSERT(M.cols() == v.size() && M.rows() == result->size());
+  for (int k = 0; k < M.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(M, k); it; ++it) {
+      (*result)(it.row()) += it.value() * v(it.col());
+    }
+  }
+}
+
 }  // namespace
 
 // Our protected constructor does all of the real work -- everything else
@@ -399,6 +422,124 @@ void AffineSystem<T>::DoCalcDiscreteVariableUpdates(
   updates->set_value(xnext);
 }
 
+// Our public constructor declares that our most specific subclass is
+// SparseAffineSystem, and then delegates to our protected constructor.
+template <typename T>
+SparseAffineSystem<T>::SparseAffineSystem(
+    const Eigen::SparseMatrix<double>& A, const Eigen::SparseMatrix<double>& B,
+    const Eigen::Ref<const Eigen::VectorXd>& f0,
+    const Eigen::SparseMatrix<double>& C, const Eigen::SparseMatrix<double>& D,
+    const Eigen::Ref<const Eigen::VectorXd>& y0, double time_period)
+    : SparseAffineSystem<T>(SystemTypeTag<SparseAffineSystem>{}, A, B, f0, C,
+                            D, y0, time_period) {}
+
+template <typename T>
+SparseAffineSystem<T>::SparseAffineSystem(
+    SystemScalarConverter converter, const Eigen::SparseMatrix<double>& A,
+    const Eigen::SparseMatrix<double>& B,
+    const Eigen::Ref<const Eigen::VectorXd>& f0,
+    const Eigen::SparseMatrix<double>& C, const Eigen::SparseMatrix<double>& D,
+    const Eigen::Ref<const Eigen::VectorXd>& y0, double time_period)
+    : TimeVaryingAffineSystem<T>(std::move(converter), f0.size(), D.cols(),
+                                 D.rows(), time_period),
+      A_(A),
+      B_(B),
+      f0_(f0),
+      C_(C),
+      D_(D),
+      y0_(y0),
+      has_meaningful_C_(IsMeaningful(C)),
+      has_meaningful_D_(IsMeaningful(D)) {
+  DRAKE_DEMAND(this->num_states() == A.rows());
+  DRAKE_DEMAND(this->num_states() == A.cols());
+  DRAKE_DEMAND(this->num_states() == B.rows());
+  DRAKE_DEMAND(this->num_states() == C.cols());
+  DRAKE_DEMAND(this->num_inputs() == B.cols());
+  DRAKE_DEMAND(this->num_inputs() == D.cols());
+  DRAKE_DEMAND(this->num_outputs() == C.rows());
+  DRAKE_DEMAND(this->num_outputs() == D.rows());
+  DRAKE_DEMAND(this->num_outputs() == y0.size());
+
+  // As in AffineSystem, the output only depends on state (iff C is non-zero)
+  // and input (iff D is non-zero).
+  if (this->num_outputs() > 0) {
+    const OutputPort<T>& output_port = this->get_output_port();
+    const auto& leaf_port = dynamic_cast<const LeafOutputPort<T>&>(output_port);
+    const CacheIndex cache_index = leaf_port.cache_entry().cache_index();
+    CacheEntry& cache_entry = this->get_mutable_cache_entry(cache_index);
+    std::set<DependencyTicket>& prereqs = cache_entry.mutable_prerequisites();
+    prereqs.clear();
+    if (has_meaningful_C_) {
+      prereqs.insert(this->all_state_ticket());
+    }
+    if (has_meaningful_D_) {
+      prereqs.insert(this->all_input_ports_ticket());
+    }
+  }
+}
+
+template <typename T>
+template <typename U>
+SparseAffineSystem<T>::SparseAffineSystem(const SparseAffineSystem<U>& other)
+    : SparseAffineSystem(other.A(), other.B(), other.f0(), other.C(),
+                         other.D(), other.y0(), other.time_period()) {
+  this->ConfigureDefaultAndRandomStateFrom(other);
+}
+
+template <typename T>
+void SparseAffineSystem<T>::CalcOutputY(const Context<T>& context,
+                                        BasicVector<T>* output_vector) const {
+  auto y = output_vector->get_mutable_value();
+  y = y0_;
+
+  if (has_meaningful_C_) {
+    const VectorX<T>& x = (this->time_period() == 0.)
+        ? dynamic_cast<const BasicVector<T>&>(
+            context.get_continuous_state_vector()).get_value()
+        : context.get_discrete_state().get_vector().get_value();
+    AddSparseTimesVector<T>(C_, x, &y);
+  }
+
+  if (has_meaningful_D_) {
+    const auto& u = this->get_input_port().Eval(context);
+    AddSparseTimesVector<T>(D_, u, &y);
+  }
+}
+
+template <typename T>
+VectorX<T> SparseAffineSystem<T>::CalcDynamics(
+    const Context<T>& context, const Eigen::Ref<const VectorX<T>>& x) const {
+  VectorX<T> result = f0_;
+  AddSparseTimesVector<T>(A_, x, &result);
+  if (this->num_inputs() > 0) {
+    const auto& u = this->get_input_port().Eval(context);
+    AddSparseTimesVector<T>(B_, u, &result);
+  }
+  return result;
+}
+
+template <typename T>
+void SparseAffineSystem<T>::DoCalcTimeDerivatives(
+    const Context<T>& context, ContinuousState<T>* derivatives) const {
+  if (this->num_states() == 0 || this->time_period() > 0.0) return;
+
+  const auto& x =
+      dynamic_cast<const BasicVector<T>&>(context.get_continuous_state_vector())
+          .get_value();
+  derivatives->SetFromVector(CalcDynamics(context, x));
+}
+
+template <typename T>
+void SparseAffineSystem<T>::DoCalcDiscreteVariableUpdates(
+    const drake::systems::Context<T>& context,
+    const std::vector<const drake::systems::DiscreteUpdateEvent<T>*>&,
+    drake::systems::DiscreteValues<T>* updates) const {
+  if (this->num_states() == 0 || this->time_period() == 0.0) return;
+
+  const auto& x = context.get_discrete_state(0).get_value();
+  updates->set_value(CalcDynamics(context, x));
+}
+
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS((
     &TimeVaryingAffineSystem<T>::template ConfigureDefaultAndRandomStateFrom<U>
 ))
@@ -411,3 +552,6 @@ DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::systems::AffineSystem)
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::SparseAffineSystem)
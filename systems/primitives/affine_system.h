@@ -3,6 +3,8 @@
 #include <memory>
 #include <vector>
 
+#include <Eigen/SparseCore>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/symbolic.h"
@@ -285,5 +287,122 @@ class AffineSystem : public TimeVaryingAffineSystem<T> {
   const bool has_meaningful_D_{};
 };
 
+/// A discrete OR continuous affine system (with constant coefficients) whose
+/// coefficient matrices `A`, `B`, `C`, and `D` are stored as sparse matrices.
+///
+/// @system
+/// name: SparseAffineSystem
+/// input_ports:
+/// - u0
+/// output_ports:
+/// - y0
+/// @endsystem
+///
+/// This system has the same dynamics and output as AffineSystem. It is meant
+/// for systems with many states whose coefficient matrices are mostly zero
+/// (e.g., models linearized from a finite element discretization), where the
+/// dense storage and dense matrix-vector products of AffineSystem are too
+/// costly. The dynamics and output are evaluated with sparse matrix-vector
+/// products.
+///
+/// @tparam_default_scalar
+///
+/// @ingroup primitive_systems
+///
+/// @see AffineSystem
+/// @see SparseLinearSystem
+template <typename T>
+class SparseAffineSystem : public TimeVaryingAffineSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SparseAffineSystem)
+
+  /// Constructs a sparse affine system with a fixed set of coefficient
+  /// matrices `A`, `B`,`C`, and `D` as well as fixed initial velocity offset
+  /// `xDot0` and output offset `y0`. The dimensions must be the same as for
+  /// AffineSystem.
+  ///
+  /// @param time_period Defines the period of the discrete time system; use
+  ///  time_period=0.0 to denote a continuous time system.  @default 0.0
+  ///
+  /// Subclasses must use the protected constructor, not this one.
+  SparseAffineSystem(const Eigen::SparseMatrix<double>& A,
+                     const Eigen::SparseMatrix<double>& B,
+                     const Eigen::Ref<const Eigen::VectorXd>& f0,
+                     const Eigen::SparseMatrix<double>& C,
+                     const Eigen::SparseMatrix<double>& D,
+                     const Eigen::Ref<const Eigen::VectorXd>& y0,
+                     double time_period = 0.0);
+
+  /// Scalar-converting copy constructor.  See @ref system_scalar_conversion.
+  template <typename U>
+  explicit SparseAffineSystem(const SparseAffineSystem<U>&);
+
+  /// @name Helper getter methods.
+  /// @{
+  const Eigen::SparseMatrix<double>& A() const { return A_; }
+  const Eigen::SparseMatrix<double>& B() const { return B_; }
+  const Eigen::VectorXd& f0() const { return f0_; }
+  const Eigen::SparseMatrix<double>& C() const { return C_; }
+  const Eigen::SparseMatrix<double>& D() const { return D_; }
+  const Eigen::VectorXd& y0() const { return y0_; }
+  /// @}
+
+  /// @name Implementations of TimeVaryingAffineSystem<T>'s pure virtual
+  /// methods. These return dense copies of the coefficient matrices; prefer
+  /// the sparse getters above.
+  /// @{
+  MatrixX<T> A(const T&) const final { return ToDense(A_); }
+  MatrixX<T> B(const T&) const final { return ToDense(B_); }
+  VectorX<T> f0(const T&) const final { return VectorX<T>(f0_); }
+  MatrixX<T> C(const T&) const final { return ToDense(C_); }
+  MatrixX<T> D(const T&) const final { return ToDense(D_); }
+  VectorX<T> y0(const T&) const final { return VectorX<T>(y0_); }
+  /// @}
+
+ protected:
+  /// Constructor that specifies scalar-type conversion support.
+  /// @param converter scalar-type conversion support helper (i.e., AutoDiff,
+  /// etc.); pass a default-constructed object if such support is not desired.
+  /// See @ref system_scalar_conversion for detailed background and examples
+  /// related to scalar-type conversion support.
+  SparseAffineSystem(SystemScalarConverter converter,
+                     const Eigen::SparseMatrix<double>& A,
+                     const Eigen::SparseMatrix<double>& B,
+                     const Eigen::Ref<const Eigen::VectorXd>& f0,
+                     const Eigen::SparseMatrix<double>& C,
+                     const Eigen::SparseMatrix<double>& D,
+                     const Eigen::Ref<const Eigen::VectorXd>& y0,
+                     double time_period);
+
+ private:
+  static MatrixX<T> ToDense(const Eigen::SparseMatrix<double>& m) {
+    return MatrixX<T>(Eigen::MatrixXd(m));
+  }
+
+  void CalcOutputY(const Context<T>& context,
+                   BasicVector<T>* output_vector) const final;
+
+  void DoCalcTimeDerivatives(const Context<T>& context,
+                             ContinuousState<T>* derivatives) const final;
+
+  void DoCalcDiscreteVariableUpdates(
+      const drake::systems::Context<T>& context,
+      const std::vector<const drake::systems::DiscreteUpdateEvent<T>*>& events,
+      drake::systems::DiscreteValues<T>* updates) const final;
+
+  // Returns A x + B u + f0, for the state x and input u in `context`.
+  VectorX<T> CalcDynamics(const Context<T>& context,
+                          const Eigen::Ref<const VectorX<T>>& x) const;
+
+  const Eigen::SparseMatrix<double> A_;
+  const Eigen::SparseMatrix<double> B_;
+  const Eigen::VectorXd f0_;
+  const Eigen::SparseMatrix<double> C_;
+  const Eigen::SparseMatrix<double> D_;
+  const Eigen::VectorXd y0_;
+  const bool has_meaningful_C_{};
+  const bool has_meaningful_D_{};
+};
+
 }  // namespace systems
 }  // namespace drake
@@ -28,6 +28,9 @@ DiscreteTimeDelay<T>::DiscreteTimeDelay(
                                   &DiscreteTimeDelay::CopyDelayedVector,
                                   {this->xd_ticket()});
     this->DeclareDiscreteState(vector_size_ * delay_buffer_size_);
+    // This state keeps track of the index of the oldest value in the buffer.
+    // It is at discrete state group index 1.
+    this->DeclareDiscreteState(1);
     this->DeclarePeriodicDiscreteUpdateEvent(
         update_sec_, 0., &DiscreteTimeDelay::SaveInputVectorToBuffer);
   } else {
@@ -64,26 +67,34 @@ template <typename T>
 void DiscreteTimeDelay<T>::CopyDelayedVector(
     const Context<T>& context, BasicVector<T>* output) const {
   DRAKE_ASSERT(!is_abstract());
+  const int oldest_index = GetOldestVectorIndex(context.get_discrete_state());
   const BasicVector<T>& state_value = context.get_discrete_state(0);
-  output->SetFromVector(state_value.get_value().head(vector_size_));
+  output->SetFromVector(state_value.get_value().segment(
+      oldest_index * vector_size_, vector_size_));
 }
 
 template <typename T>
 void DiscreteTimeDelay<T>::SaveInputVectorToBuffer(
     const Context<T>& context, DiscreteValues<T>* discrete_state) const {
   DRAKE_ASSERT(!is_abstract());
-  // Copies the current state of the delay buffer from the context to the
-  // discrete state, sliding the buffer forward one step, dropping the oldest
-  // value and adding the value on the input port to the end of the buffer.
-  // TODO(mpetersen94): consider revising to avoid possibly expensive buffer
-  // copy operation.
+  // The discrete state arrives holding the current contents of the buffer, so
+  // only the oldest value needs to be overwritten (by the value on the input
+  // port) before advancing the index to the next oldest value.
   const auto& input = this->get_input_port().Eval(context);
-  Eigen::VectorBlock<VectorX<T>> updated_state_value =
-      discrete_state->get_mutable_value(0);
-  const VectorX<T>& old_state_value = context.get_discrete_state(0).value();
-  updated_state_value.head((delay_buffer_size_ - 1) * vector_size_) =
-      old_state_value.tail((delay_buffer_size_ - 1) * vector_size_);
-  updated_state_value.tail(vector_size_) = input;
+  const int oldest_index = GetOldestVectorIndex(context.get_discrete_state());
+  discrete_state->get_mutable_value(0).segment(oldest_index * vector_size_,
+                                               vector_size_) = input;
+  discrete_state->get_mutable_value(1)[0] =
+      (oldest_index + 1) % delay_buffer_size_;
+}
+
+template <typename T>
+int DiscreteTimeDelay<T>::GetOldestVectorIndex(
+    const DiscreteValues<T>& discrete_state) const {
+  const int oldest_index =
+      static_cast<int>(ExtractDoubleOrThrow(discrete_state.value(1)[0]));
+  DRAKE_THROW_UNLESS(0 <= oldest_index && oldest_index < delay_buffer_size_);
+  return oldest_index;
 }
 
 template <typename T>
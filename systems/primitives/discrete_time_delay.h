@@ -28,16 +28,31 @@ namespace systems {
 ///
 /// Let t,z ∈ ℕ be the number of delay time steps and the input vector size.
 /// For abstract-valued %DiscreteTimeDelay, z is 1.
-/// The state x ∈ ℝ⁽ᵗ⁺¹⁾ᶻ is partitioned into t+1 blocks x[0] x[1] ... x[t],
-/// each of size z. The input and output are u,y ∈ ℝᶻ.
+/// The state consists of a circular buffer x ∈ ℝ⁽ᵗ⁺¹⁾ᶻ, partitioned into t+1
+/// blocks x[0] x[1] ... x[t], each of size z, and the index h ∈ {0, ..., t}
+/// of the block holding the oldest value. The input and output are u,y ∈ ℝᶻ.
 /// The discrete state space dynamics of %DiscreteTimeDelay is:
 /// ```
-///   xₙ₊₁ = xₙ[1] xₙ[2] ... xₙ[t] uₙ  // update
-///   yₙ = xₙ[0]                       // output
-///   x₀ = xᵢₙᵢₜ                       // initialize
+///   xₙ₊₁[hₙ] = uₙ                    // update (other blocks unchanged)
+///   hₙ₊₁ = (hₙ + 1) mod (t + 1)
+///   yₙ = xₙ[hₙ]                       // output
+///   x₀ = xᵢₙᵢₜ, h₀ = 0                // initialize
 /// ```
 /// where xᵢₙᵢₜ = 0 for vector-valued %DiscreteTimeDelay and xᵢₙᵢₜ is a
-/// given value for abstract-valued %DiscreteTimeDelay.
+/// given value for abstract-valued %DiscreteTimeDelay. Each update writes a
+/// single block, so its cost does not grow with the number of delay steps.
+///
+/// For vector-valued %DiscreteTimeDelay, x is discrete state group 0 and h is
+/// the sole element of discrete state group 1. For abstract-valued
+/// %DiscreteTimeDelay, the blocks are abstract states 0 through t and h is
+/// abstract state t+1.
+///
+/// The index h selects which block the update writes and the output reads, so
+/// the dynamics are linear in x only for a fixed h; the vector-valued system
+/// is not LTI, and a linearization about a context holds only for its h.
+/// For the same reason h must always hold a number: with T =
+/// symbolic::Expression, x may hold arbitrary expressions but h must be a
+/// constant, and the update and output throw if it is not.
 ///
 /// See @ref discrete_systems "Discrete Systems" for general information about
 /// discrete systems in Drake, including how they interact with continuous
@@ -75,8 +90,8 @@ class DiscreteTimeDelay final : public LeafSystem<T> {
   ~DiscreteTimeDelay() final = default;
 
   /// (Advanced) Manually samples the input port and updates the state of the
-  /// block, sliding the delay buffer forward and placing the sampled input at
-  /// the end. This emulates an update event and is mostly useful for testing.
+  /// block, replacing the oldest value in the delay buffer with the sampled
+  /// input. This emulates an update event and is mostly useful for testing.
   void SaveInputToBuffer(Context<T>* context) const {
     if (is_abstract()) {
       SaveInputAbstractValueToBuffer(*context, &context->get_mutable_state());
@@ -101,6 +116,9 @@ class DiscreteTimeDelay final : public LeafSystem<T> {
   void SaveInputVectorToBuffer(const Context<T>& context,
                                DiscreteValues<T>* discrete_state) const;
 
+  // Returns the index of the oldest value in the vector-valued buffer.
+  int GetOldestVectorIndex(const DiscreteValues<T>& discrete_state) const;
+
   // Sets the output port value to the properly delayed abstract value.
   void CopyDelayedAbstractValue(const Context<T>& context,
                                 AbstractValue* output) const;
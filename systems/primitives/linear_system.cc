@@ -2,6 +2,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <Eigen/Dense>
 #include <Eigen/LU>
@@ -82,11 +83,88 @@ unique_ptr<LinearSystem<T>> LinearSystem<T>::MakeLinearSystem(
   return make_unique<LinearSystem<T>>(A, B, C, D, time_period);
 }
 
+template <typename T>
+SparseLinearSystem<T>::SparseLinearSystem(const Eigen::SparseMatrix<double>& A,
+                                          const Eigen::SparseMatrix<double>& B,
+                                          const Eigen::SparseMatrix<double>& C,
+                                          const Eigen::SparseMatrix<double>& D,
+                                          double time_period)
+    : SparseLinearSystem<T>(SystemTypeTag<SparseLinearSystem>{}, A, B, C, D,
+                            time_period) {}
+
+template <typename T>
+template <typename U>
+SparseLinearSystem<T>::SparseLinearSystem(const SparseLinearSystem<U>& other)
+    : SparseLinearSystem<T>(other.A(), other.B(), other.C(), other.D(),
+                            other.time_period()) {}
+
+template <typename T>
+SparseLinearSystem<T>::SparseLinearSystem(SystemScalarConverter converter,
+                                          const Eigen::SparseMatrix<double>& A,
+                                          const Eigen::SparseMatrix<double>& B,
+                                          const Eigen::SparseMatrix<double>& C,
+                                          const Eigen::SparseMatrix<double>& D,
+                                          double time_period)
+    : SparseAffineSystem<T>(std::move(converter), A, B,
+                            Eigen::VectorXd::Zero(A.rows()), C, D,
+                            Eigen::VectorXd::Zero(C.rows()), time_period) {}
+
 namespace {
 
-// Helper function allows reuse for both FirstOrderTaylorApproximation and
-// Linearize.
-std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
+// Splits the gradient of `vec` with respect to [x; u] into the Jacobian with
+// respect to the x (the first `num_states` derivatives) and the Jacobian with
+// respect to u (the remaining `num_inputs` derivatives).
+void ExtractStateAndInputJacobians(
+    const Eigen::Ref<const VectorX<AutoDiffXd>>& vec, int num_states,
+    int num_inputs, Eigen::MatrixXd* Jx, Eigen::MatrixXd* Ju) {
+  const Eigen::MatrixXd J = math::ExtractGradient(vec);
+  *Jx = J.leftCols(num_states);
+  *Ju = J.rightCols(num_inputs);
+}
+
+void ExtractStateAndInputJacobians(
+    const Eigen::Ref<const VectorX<AutoDiffXd>>& vec, int num_states,
+    int num_inputs, Eigen::SparseMatrix<double>* Jx,
+    Eigen::SparseMatrix<double>* Ju) {
+  std::vector<Eigen::Triplet<double>> x_triplets;
+  std::vector<Eigen::Triplet<double>> u_triplets;
+  for (int i = 0; i < vec.size(); ++i) {
+    // Entries with no derivatives are interpreted as having all-zero
+    // derivatives, the same as math::ExtractGradient().
+    const AutoDiffXd& entry = vec(i);
+    const Eigen::VectorXd& derivatives = entry.derivatives();
+    DRAKE_DEMAND(derivatives.size() == 0 ||
+                 derivatives.size() == num_states + num_inputs);
+    for (int j = 0; j < derivatives.size(); ++j) {
+      if (derivatives(j) == 0) continue;
+      if (j < num_states) {
+        x_triplets.emplace_back(i, j, derivatives(j));
+      } else {
+        u_triplets.emplace_back(i, j - num_states, derivatives(j));
+      }
+    }
+  }
+  Jx->resize(vec.size(), num_states);
+  Jx->setFromTriplets(x_triplets.begin(), x_triplets.end());
+  Ju->resize(vec.size(), num_inputs);
+  Ju->setFromTriplets(u_triplets.begin(), u_triplets.end());
+}
+
+template <typename MatrixType>
+MatrixType MakeZeroMatrix(int rows, int cols) {
+  if constexpr (std::is_same_v<MatrixType, Eigen::MatrixXd>) {
+    return Eigen::MatrixXd::Zero(rows, cols);
+  } else {
+    return MatrixType(rows, cols);
+  }
+}
+
+// Helper function allows reuse for FirstOrderTaylorApproximation, Linearize,
+// and SparseLinearize. AffineSystemType is either AffineSystem<double> (with
+// MatrixType = Eigen::MatrixXd) or SparseAffineSystem<double> (with
+// MatrixType = Eigen::SparseMatrix<double>).
+template <typename AffineSystemType, typename MatrixType>
+std::unique_ptr<AffineSystemType> DoFirstOrderTaylorApproximation(
     const System<double>& system, const Context<double>& context,
     std::variant<InputPortSelection, InputPortIndex> input_port_index,
     std::variant<OutputPortSelection, OutputPortIndex> output_port_index,
@@ -144,7 +222,7 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
     input_port->FixValue(autodiff_context.get(), input_vector);
   }
 
-  Eigen::MatrixXd A(num_states, num_states), B(num_states, num_inputs);
+  MatrixType A, B;
   Eigen::VectorXd f0(num_states);
   if (num_states > 0) {
     if (autodiff_context->has_only_continuous_state()) {
@@ -156,9 +234,8 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
                                            autodiff_xdot.get());
       auto autodiff_xdot_vec = autodiff_xdot->CopyToVector();
 
-      const Eigen::MatrixXd AB = math::ExtractGradient(autodiff_xdot_vec);
-      A = AB.leftCols(num_states);
-      B = AB.rightCols(num_inputs);
+      ExtractStateAndInputJacobians(autodiff_xdot_vec, num_states, num_inputs,
+                                    &A, &B);
 
       const Eigen::VectorXd xdot0 = math::ExtractValue(autodiff_xdot_vec);
 
@@ -182,9 +259,8 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
                                                    autodiff_x1.get());
       auto autodiff_x1_vec = autodiff_x1->get_value();
 
-      const Eigen::MatrixXd AB = math::ExtractGradient(autodiff_x1_vec);
-      A = AB.leftCols(num_states);
-      B = AB.rightCols(num_inputs);
+      ExtractStateAndInputJacobians(autodiff_x1_vec, num_states, num_inputs,
+                                    &A, &B);
 
       const Eigen::VectorXd x1 = math::ExtractValue(autodiff_x1_vec);
 
@@ -200,20 +276,19 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
     }
   } else {
     DRAKE_ASSERT(num_states == 0);
-    A = Eigen::MatrixXd(0, 0);
-    B = Eigen::MatrixXd(0, num_inputs);
+    A = MakeZeroMatrix<MatrixType>(0, 0);
+    B = MakeZeroMatrix<MatrixType>(0, num_inputs);
     f0 = Eigen::VectorXd(0);
   }
 
-  Eigen::MatrixXd C = Eigen::MatrixXd::Zero(num_outputs, num_states);
-  Eigen::MatrixXd D = Eigen::MatrixXd::Zero(num_outputs, num_inputs);
+  MatrixType C = MakeZeroMatrix<MatrixType>(num_outputs, num_states);
+  MatrixType D = MakeZeroMatrix<MatrixType>(num_outputs, num_inputs);
   Eigen::VectorXd y0 = Eigen::VectorXd::Zero(num_outputs);
 
   if (output_port) {
     const auto& autodiff_y0 = output_port->Eval(*autodiff_context);
-    const Eigen::MatrixXd CD = math::ExtractGradient(autodiff_y0);
-    C = CD.leftCols(num_states);
-    D = CD.rightCols(num_inputs);
+    ExtractStateAndInputJacobians(autodiff_y0, num_states, num_inputs, &C,
+                                  &D);
 
     const Eigen::VectorXd y = math::ExtractValue(autodiff_y0);
 
@@ -223,8 +298,7 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
     y0 = y - C * x0 - D * u0;
   }
 
-  return std::make_unique<AffineSystem<double>>(A, B, f0, C, D, y0,
-                                                time_period);
+  return std::make_unique<AffineSystemType>(A, B, f0, C, D, y0, time_period);
 }
 
 }  // namespace
@@ -235,7 +309,7 @@ std::unique_ptr<LinearSystem<double>> Linearize(
     std::variant<OutputPortSelection, OutputPortIndex> output_port_index,
     double equilibrium_check_tolerance) {
   std::unique_ptr<AffineSystem<double>> affine =
-      DoFirstOrderTaylorApproximation(
+      DoFirstOrderTaylorApproximation<AffineSystem<double>, Eigen::MatrixXd>(
           system, context, std::move(input_port_index),
           std::move(output_port_index), equilibrium_check_tolerance);
 
@@ -244,13 +318,30 @@ std::unique_ptr<LinearSystem<double>> Linearize(
                                                 affine->time_period());
 }
 
+std::unique_ptr<SparseLinearSystem<double>> SparseLinearize(
+    const System<double>& system, const Context<double>& context,
+    std::variant<InputPortSelection, InputPortIndex> input_port_index,
+    std::variant<OutputPortSelection, OutputPortIndex> output_port_index,
+    double equilibrium_check_tolerance) {
+  std::unique_ptr<SparseAffineSystem<double>> affine =
+      DoFirstOrderTaylorApproximation<SparseAffineSystem<double>,
+                                      Eigen::SparseMatrix<double>>(
+          system, context, std::move(input_port_index),
+          std::move(output_port_index), equilibrium_check_tolerance);
+
+  return std::make_unique<SparseLinearSystem<double>>(
+      affine->A(), affine->B(), affine->C(), affine->D(),
+      affine->time_period());
+}
+
 std::unique_ptr<AffineSystem<double>> FirstOrderTaylorApproximation(
     const System<double>& system, const Context<double>& context,
     std::variant<InputPortSelection, InputPortIndex> input_port_index,
     std::variant<OutputPortSelection, OutputPortIndex> output_port_index) {
-  return DoFirstOrderTaylorApproximation(system, context,
-                                         std::move(input_port_index),
-                                         std::move(output_port_index));
+  return DoFirstOrderTaylorApproximation<AffineSystem<double>,
+                                         Eigen::MatrixXd>(
+      system, context, std::move(input_port_index),
+      std::move(output_port_index));
 }
 
 /// Returns the controllability matrix:  R = [B, AB, ..., A^{n-1}B].
@@ -311,5 +402,8 @@ bool IsObservable(const LinearSystem<double>& sys,
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::systems::LinearSystem)
 
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::SparseLinearSystem)
+
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::systems::TimeVaryingLinearSystem)
@@ -91,6 +91,59 @@ class LinearSystem : public AffineSystem<T> {
                const Eigen::Ref<const Eigen::MatrixXd>& D, double time_period);
 };
 
+/// A discrete OR continuous linear system whose coefficient matrices `A`, `B`,
+/// `C`, and `D` are stored as sparse matrices.
+///
+/// @system
+/// name: SparseLinearSystem
+/// input_ports:
+/// - u0
+/// output_ports:
+/// - y0
+/// @endsystem
+///
+/// This system has the same dynamics and output as LinearSystem; see
+/// SparseAffineSystem for when to prefer the sparse representation.
+///
+/// @tparam_default_scalar
+/// @ingroup primitive_systems
+///
+/// @see LinearSystem
+/// @see SparseAffineSystem
+template <typename T>
+class SparseLinearSystem : public SparseAffineSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SparseLinearSystem)
+
+  /// Constructs a %SparseLinearSystem with a fixed set of coefficient matrices
+  /// `A`, `B`,`C`, and `D`. The dimensions must be the same as for
+  /// LinearSystem.
+  ///
+  /// Subclasses must use the protected constructor, not this one.
+  SparseLinearSystem(const Eigen::SparseMatrix<double>& A,
+                     const Eigen::SparseMatrix<double>& B,
+                     const Eigen::SparseMatrix<double>& C,
+                     const Eigen::SparseMatrix<double>& D,
+                     double time_period = 0.0);
+
+  /// Scalar-converting copy constructor.  See @ref system_scalar_conversion.
+  template <typename U>
+  explicit SparseLinearSystem(const SparseLinearSystem<U>&);
+
+ protected:
+  /// Constructor that specifies scalar-type conversion support.
+  /// @param converter scalar-type conversion support helper (i.e., AutoDiff,
+  /// etc.); pass a default-constructed object if such support is not desired.
+  /// See @ref system_scalar_conversion for detailed background and examples
+  /// related to scalar-type conversion support.
+  SparseLinearSystem(SystemScalarConverter converter,
+                     const Eigen::SparseMatrix<double>& A,
+                     const Eigen::SparseMatrix<double>& B,
+                     const Eigen::SparseMatrix<double>& C,
+                     const Eigen::SparseMatrix<double>& D,
+                     double time_period);
+};
+
 /// Base class for a discrete or continuous linear time-varying (LTV) system.
 ///
 /// @system
@@ -198,6 +251,27 @@ std::unique_ptr<LinearSystem<double>> Linearize(
         OutputPortSelection::kUseFirstOutputIfItExists,
     double equilibrium_check_tolerance = 1e-6);
 
+/// Takes the first-order Taylor expansion of a System around a nominal
+/// operating point, like Linearize(), but returns a SparseLinearSystem. The
+/// Jacobians are assembled directly into sparse matrices, keeping only their
+/// nonzero entries, so the dense `A`, `B`, `C`, and `D` matrices are never
+/// formed. (The AutoDiffXd evaluation of the system still carries a dense
+/// gradient for each entry.) Prefer this over Linearize() for systems with
+/// many states whose Jacobians are mostly zero.
+///
+/// The parameters, return value, exceptions, and notes are the same as for
+/// Linearize().
+///
+/// @ingroup primitive_systems
+///
+std::unique_ptr<SparseLinearSystem<double>> SparseLinearize(
+    const System<double>& system, const Context<double>& context,
+    std::variant<InputPortSelection, InputPortIndex> input_port_index =
+        InputPortSelection::kUseFirstInputIfItExists,
+    std::variant<OutputPortSelection, OutputPortIndex> output_port_index =
+        OutputPortSelection::kUseFirstOutputIfItExists,
+    double equilibrium_check_tolerance = 1e-6);
+
 /// A first-order Taylor series approximation to a @p system in the neighborhood
 /// of an arbitrary point.  When Taylor-expanding a system at a non-equilibrium
 /// point, it may be represented either of the form:
@@ -15,10 +15,9 @@ namespace internal {
 
 template <typename T>
 struct CalcLayersData {
-  explicit CalcLayersData(int n) : Wx(n), Wx_plus_b(n), Xn(n) {}
+  explicit CalcLayersData(int n) : Wx_plus_b(n), Xn(n) {}
 
   MatrixX<T> input_features;
-  std::vector<VectorX<T>> Wx;
   std::vector<VectorX<T>> Wx_plus_b;
   std::vector<VectorX<T>> Xn;
 };
@@ -46,8 +45,7 @@ const std::vector<int>& RejectEmpty(const std::vector<int>& arg) {
 template <typename T>
 struct BackPropData {
   explicit BackPropData(int n)
-      : Wx(n),
-        Wx_plus_b(n),
+      : Wx_plus_b(n),
         Xn(n),
         dXn_dWx_plus_b(n),
         dloss_dXn(n),
@@ -55,7 +53,6 @@ struct BackPropData {
         dloss_dW(n),
         dloss_db(n) {}
 
-  std::vector<MatrixX<T>> Wx;
   std::vector<MatrixX<T>> Wx_plus_b;
   std::vector<MatrixX<T>> Xn;
   std::vector<MatrixX<T>> dXn_dWx_plus_b;
@@ -80,7 +77,8 @@ void Activation(
   if (type == kTanh) {
     *Y = X.array().tanh().matrix();
     if (dYdX) {
-      dYdX->noalias() = (1.0 - X.array().tanh().square()).matrix();
+      // d/dx tanh(x) = 1 - tanh²(x); reuse Y rather than evaluating tanh again.
+      dYdX->noalias() = (1.0 - Y->array().square()).matrix();
     }
   } else if (type == kReLU) {
     *Y = X.array().max(0.0).matrix();
@@ -159,7 +157,6 @@ MultilayerPerceptron<T>::MultilayerPerceptron(
   // Declare cache entry for CalcOutput.
   internal::CalcLayersData<T> calc_layers_data(num_weights_);
   for (int i = 0; i < num_weights_; ++i) {
-    calc_layers_data.Wx[i] = VectorX<T>::Zero(layers_[i + 1]);
     calc_layers_data.Wx_plus_b[i] = VectorX<T>::Zero(layers_[i + 1]);
     calc_layers_data.Xn[i] = VectorX<T>::Zero(layers_[i + 1]);
   }
@@ -312,16 +309,16 @@ T MultilayerPerceptron<T>::Backpropagation(
   // Forward pass:
   if (has_input_features_) {
     CalcInputFeatures(X, &data.input_features);
-    data.Wx[0].noalias() = GetWeights(context, 0) * data.input_features;
+    data.Wx_plus_b[0].noalias() = GetWeights(context, 0) * data.input_features;
   } else {
-    data.Wx[0].noalias() = GetWeights(context, 0) * X;
+    data.Wx_plus_b[0].noalias() = GetWeights(context, 0) * X;
   }
-  data.Wx_plus_b[0].noalias() = data.Wx[0].colwise() + GetBiases(context, 0);
+  data.Wx_plus_b[0].colwise() += GetBiases(context, 0);
   Activation<T, Eigen::Dynamic>(activation_types_[0], data.Wx_plus_b[0],
                                 &data.Xn[0], &data.dXn_dWx_plus_b[0]);
   for (int i = 1; i < num_weights_; ++i) {
-    data.Wx[i].noalias() = GetWeights(context, i) * data.Xn[i - 1];
-    data.Wx_plus_b[i].noalias() = data.Wx[i].colwise() + GetBiases(context, i);
+    data.Wx_plus_b[i].noalias() = GetWeights(context, i) * data.Xn[i - 1];
+    data.Wx_plus_b[i].colwise() += GetBiases(context, i);
     Activation<T, Eigen::Dynamic>(activation_types_[i], data.Wx_plus_b[i],
                                   &data.Xn[i], &data.dXn_dWx_plus_b[i]);
   }
@@ -334,19 +331,16 @@ T MultilayerPerceptron<T>::Backpropagation(
   for (int i = num_weights_ - 1; i >= 0; --i) {
     data.dloss_dWx_plus_b[i] =
         (data.dloss_dXn[i].array() * data.dXn_dWx_plus_b[i].array()).matrix();
-    data.dloss_dW[i].resize(layers_[i + 1], layers_[i]);
-    data.dloss_dW[i].setZero();
-    for (int j = 0; j < X.cols(); ++j) {
-      if (i > 0) {
-        data.dloss_dW[i].noalias() +=
-            data.dloss_dWx_plus_b[i].col(j) * data.Xn[i - 1].col(j).transpose();
-      } else if (has_input_features_) {
-        data.dloss_dW[i].noalias() += data.dloss_dWx_plus_b[i].col(j) *
-                                      data.input_features.col(j).transpose();
-      } else {
-        data.dloss_dW[i].noalias() +=
-            data.dloss_dWx_plus_b[i].col(j) * X.col(j).transpose();
-      }
+    // The gradient is summed over the batch, ∑ⱼ δⱼ xⱼᵀ, which is one (blocked)
+    // matrix product over all of the columns at once.
+    if (i > 0) {
+      data.dloss_dW[i].noalias() =
+          data.dloss_dWx_plus_b[i] * data.Xn[i - 1].transpose();
+    } else if (has_input_features_) {
+      data.dloss_dW[i].noalias() =
+          data.dloss_dWx_plus_b[i] * data.input_features.transpose();
+    } else {
+      data.dloss_dW[i].noalias() = data.dloss_dWx_plus_b[i] * X.transpose();
     }
     SetWeights(dloss_dparams, i, data.dloss_dW[i]);
     data.dloss_db[i] = data.dloss_dWx_plus_b[i].rowwise().sum();
@@ -398,17 +392,17 @@ void MultilayerPerceptron<T>::BatchOutput(const Context<T>& context,
   // Forward pass:
   if (has_input_features_) {
     CalcInputFeatures(X, &data.input_features);
-    data.Wx[0].noalias() = GetWeights(context, 0) * data.input_features;
+    data.Wx_plus_b[0].noalias() = GetWeights(context, 0) * data.input_features;
   } else {
-    data.Wx[0].noalias() = GetWeights(context, 0) * X;
+    data.Wx_plus_b[0].noalias() = GetWeights(context, 0) * X;
   }
-  data.Wx_plus_b[0].noalias() = data.Wx[0].colwise() + GetBiases(context, 0);
+  data.Wx_plus_b[0].colwise() += GetBiases(context, 0);
   Activation<T, Eigen::Dynamic>(activation_types_[0], data.Wx_plus_b[0],
                                 &data.Xn[0],
                                 gradients ? &data.dXn_dWx_plus_b[0] : nullptr);
   for (int i = 1; i < num_weights_; ++i) {
-    data.Wx[i].noalias() = GetWeights(context, i) * data.Xn[i - 1];
-    data.Wx_plus_b[i].noalias() = data.Wx[i].colwise() + GetBiases(context, i);
+    data.Wx_plus_b[i].noalias() = GetWeights(context, i) * data.Xn[i - 1];
+    data.Wx_plus_b[i].colwise() += GetBiases(context, i);
     Activation<T, Eigen::Dynamic>(
         activation_types_[i], data.Wx_plus_b[i], &data.Xn[i],
         gradients ? &data.dXn_dWx_plus_b[i] : nullptr);
@@ -465,17 +459,17 @@ void MultilayerPerceptron<T>::CalcLayers(
   if (has_input_features_) {
     CalcInputFeatures(this->get_input_port().Eval(context),
                       &data->input_features);
-    data->Wx[0].noalias() = GetWeights(context, 0) * data->input_features;
+    data->Wx_plus_b[0].noalias() =
+        GetWeights(context, 0) * data->input_features;
   } else {
-    data->Wx[0].noalias() =
+    data->Wx_plus_b[0].noalias() =
         GetWeights(context, 0) * this->get_input_port().Eval(context);
   }
-  data->Wx_plus_b[0].noalias() = data->Wx[0].colwise() + GetBiases(context, 0);
+  data->Wx_plus_b[0] += GetBiases(context, 0);
   Activation<T, 1>(activation_types_[0], data->Wx_plus_b[0], &(data->Xn[0]));
   for (int i = 1; i < num_weights_; ++i) {
-    data->Wx[i].noalias() = GetWeights(context, i) * data->Xn[i - 1];
-    data->Wx_plus_b[i].noalias() =
-        data->Wx[i].colwise() + GetBiases(context, i);
+    data->Wx_plus_b[i].noalias() = GetWeights(context, i) * data->Xn[i - 1];
+    data->Wx_plus_b[i] += GetBiases(context, i);
     Activation<T, 1>(activation_types_[i], data->Wx_plus_b[i], &(data->Xn[i]));
   }
 }
@@ -49,13 +49,16 @@ class SampleGenerator {
 
   Seed seed() const { return seed_; }
 
-  double GenerateNext() {
-    switch (distribution_.index()) {
-      case 0: return std::get<0>(distribution_)(generator_);
-      case 1: return std::get<1>(distribution_)(generator_);
-      case 2: return std::get<2>(distribution_)(generator_);
-    }
-    DRAKE_UNREACHABLE();
+  // Overwrites each element of `samples` with the next sample.  The
+  // distribution is dispatched once for the whole vector, rather than once
+  // per element.
+  template <typename T>
+  void GenerateNext(VectorBase<T>* samples) {
+    std::visit([this, samples](auto& distribution) {
+      for (int i = 0; i < samples->size(); ++i) {
+        (*samples)[i] = T(distribution(generator_));
+      }
+    }, distribution_);
   }
 
  private:
@@ -135,10 +138,7 @@ void RandomSource<T>::SetSeed(Seed seed, const Context<T>& context,
 template <typename T>
 void RandomSource<T>::UpdateSamples(const Context<T>&, State<T>* state) const {
   auto& source = state->template get_mutable_abstract_state<SampleGenerator>(0);
-  auto& samples = state->get_mutable_discrete_state(0);
-  for (int i = 0; i < samples.size(); ++i) {
-    samples[i] = T(source.GenerateNext());
-  }
+  source.GenerateNext(&state->get_mutable_discrete_state(0));
 }
 
 template <typename T>
@@ -9,7 +9,6 @@ namespace drake {
 namespace systems {
 
 using Eigen::Ref;
-using symbolic::Environment;
 using symbolic::Expression;
 using symbolic::Jacobian;
 using symbolic::Substitution;
@@ -144,19 +143,24 @@ SymbolicVectorSystem<T>::SymbolicVectorSystem(
                                   &SymbolicVectorSystem<T>::CalcOutput);
   }
 
-  // Initialize Jacobian matrices iff T == AutoDiffXd.
-  if (std::is_same_v<T, AutoDiffXd>) {
-    if (dynamics_.size() > 0) {
-      dynamics_jacobian_ = Jacobian(dynamics_, vars_vec);
-    }
-    if (output_.size() > 0) {
-      output_jacobian_ = Jacobian(output_, vars_vec);
-    }
-  }
-
-  // Allocate a symbolic::Environment once to be cloned/reused below.
-  for (const auto& v : all_vars) {
-    env_.insert(v, 0.0);
+  // Compile the dynamics and output iff T != Expression, along with their
+  // Jacobians iff T == AutoDiffXd.
+  if constexpr (!std::is_same_v<T, Expression>) {
+    auto compile = [&vars_vec](const VectorX<Expression>& expr) {
+      if constexpr (std::is_same_v<T, AutoDiffXd>) {
+        const MatrixX<Expression> jacobian =
+            (vars_vec.size() > 0) ? Jacobian(expr, vars_vec)
+                                  : MatrixX<Expression>(expr.size(), 0);
+        VectorX<Expression> expr_and_jacobian(expr.size() + jacobian.size());
+        expr_and_jacobian << expr, Eigen::Map<const VectorX<Expression>>(
+                                       jacobian.data(), jacobian.size());
+        return symbolic::CompiledExpressions(expr_and_jacobian, vars_vec);
+      } else {
+        return symbolic::CompiledExpressions(expr, vars_vec);
+      }
+    };
+    dynamics_compiled_ = compile(dynamics_);
+    output_compiled_ = compile(output_);
   }
 }
 
@@ -217,23 +221,49 @@ void SymbolicVectorSystem<T>::PopulateFromContext(const Context<T>& context,
 template <>
 void SymbolicVectorSystem<double>::EvaluateWithContext(
     const Context<double>& context, const VectorX<Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian,
-    bool needs_inputs, VectorBase<double>* out) const {
-  unused(jacobian);
-  Environment env = env_;
-  PopulateFromContext(context, needs_inputs, &env);
-  for (int i = 0; i < out->size(); i++) {
-    out->SetAtIndex(i, expr[i].Evaluate(env));
+    const symbolic::CompiledExpressions& compiled, bool needs_inputs,
+    VectorBase<double>* out) const {
+  unused(expr);
+  // The values are ordered as the parameters of the compiled program. Input
+  // values that aren't needed are left as zero.
+  Eigen::VectorXd vars = Eigen::VectorXd::Zero(compiled.num_parameters());
+  int index = 0;
+  if (state_vars_.size() > 0) {
+    const VectorBase<double>& state =
+        (time_period_ > 0.0) ? context.get_discrete_state_vector()
+                             : context.get_continuous_state_vector();
+    for (int i = 0; i < state_vars_.size(); i++, index++) {
+      vars[index] = state[i];
+    }
+  }
+  // As in PopulateFromContext(), inputs are only evaluated when needed.
+  if (input_vars_.size() > 0 && needs_inputs) {
+    vars.segment(index, input_vars_.size()) =
+        this->get_input_port().Eval(context);
   }
+  index += input_vars_.size();
+  if (parameter_vars_.size() > 0) {
+    const BasicVector<double>& parameter = context.get_numeric_parameter(0);
+    for (int i = 0; i < parameter_vars_.size(); i++, index++) {
+      vars[index] = parameter[i];
+    }
+  }
+  if (time_var_) {
+    vars[index] = context.get_time();
+  }
+
+  Eigen::VectorXd result(out->size());
+  compiled.Evaluate(vars, &result);
+  out->SetFromVector(result);
 }
 
 template <>
 void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
     const Context<AutoDiffXd>& context, const VectorX<Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian,
-    bool needs_inputs, VectorBase<AutoDiffXd>* pout) const {
+    const symbolic::CompiledExpressions& compiled, bool needs_inputs,
+    VectorBase<AutoDiffXd>* pout) const {
+  unused(expr);
   VectorBase<AutoDiffXd>& out = *pout;
-
   const BasicVector<AutoDiffXd> empty(0);
   const AutoDiffXd& time = context.get_time();
   const VectorBase<AutoDiffXd>& state =
@@ -276,24 +306,25 @@ void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
   }
   set_num_gradients(parameter);
 
-  Eigen::MatrixXd dvars = Eigen::MatrixXd::Zero(jacobian.cols(), num_gradients);
-  Environment env = env_;
+  const int num_vars = compiled.num_parameters();
+  Eigen::VectorXd vars = Eigen::VectorXd::Zero(num_vars);
+  Eigen::MatrixXd dvars = Eigen::MatrixXd::Zero(num_vars, num_gradients);
   if (time_var_) {
-    env[*time_var_] = time.value();
+    vars[num_vars - 1] = time.value();
     if (time.derivatives().size()) {
       dvars.bottomRows<1>() = time.derivatives();
     }
   }
-  size_t dvars_row_idx = 0;
+  int dvars_row_idx = 0;
   for (int i = 0; i < state_vars_.size(); i++, dvars_row_idx++) {
-    env[state_vars_[i]] = state[i].value();
+    vars[dvars_row_idx] = state[i].value();
     if (state[i].derivatives().size()) {
       dvars.row(dvars_row_idx) = state[i].derivatives();
     }
   }
   if (needs_inputs) {
     for (int i = 0; i < input_vars_.size(); i++, dvars_row_idx++) {
-      env[input_vars_[i]] = input[i].value();
+      vars[dvars_row_idx] = input[i].value();
       if (input[i].derivatives().size()) {
         dvars.row(dvars_row_idx) = input[i].derivatives();
       }
@@ -302,30 +333,29 @@ void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
     dvars_row_idx += input_vars_.size();
   }
   for (int i = 0; i < parameter_vars_.size(); i++, dvars_row_idx++) {
-    env[parameter_vars_[i]] = parameter[i].value();
+    vars[dvars_row_idx] = parameter[i].value();
     if (parameter[i].derivatives().size()) {
       dvars.row(dvars_row_idx) = parameter[i].derivatives();
     }
   }
 
   // Now actually compute the output values and derivatives.
-  Eigen::RowVectorXd dout_dvars(jacobian.cols());
+  const Eigen::VectorXd result = compiled.Evaluate(vars);
+  const Eigen::Map<const Eigen::MatrixXd> dout_dvars(
+      result.data() + out.size(), out.size(), num_vars);
+  const Eigen::MatrixXd dout = dout_dvars * dvars;
   for (int i = 0; i < out.size(); i++) {
-    out[i].value() = expr[i].Evaluate(env);
-
-    for (int j = 0; j < jacobian.cols(); j++) {
-      dout_dvars(j) = jacobian(i, j).Evaluate(env);
-    }
-    out[i].derivatives() = dout_dvars * dvars;
+    out[i].value() = result[i];
+    out[i].derivatives() = dout.row(i).transpose();
   }
 }
 
 template <>
 void SymbolicVectorSystem<Expression>::EvaluateWithContext(
     const Context<Expression>& context, const VectorX<Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian,
-    bool needs_inputs, VectorBase<Expression>* out) const {
-  unused(jacobian);
+    const symbolic::CompiledExpressions& compiled, bool needs_inputs,
+    VectorBase<Expression>* out) const {
+  unused(compiled);
   Substitution s;
   PopulateFromContext(context, needs_inputs, &s);
   for (int i = 0; i < out->size(); i++) {
@@ -337,7 +367,7 @@ template <typename T>
 void SymbolicVectorSystem<T>::CalcOutput(const Context<T>& context,
                                          BasicVector<T>* output_vector) const {
   DRAKE_DEMAND(output_.size() > 0);
-  EvaluateWithContext(context, output_, output_jacobian_, output_needs_inputs_,
+  EvaluateWithContext(context, output_, output_compiled_, output_needs_inputs_,
                       output_vector);
 }
 
@@ -346,7 +376,7 @@ void SymbolicVectorSystem<T>::DoCalcTimeDerivatives(
     const Context<T>& context, ContinuousState<T>* derivatives) const {
   DRAKE_DEMAND(time_period_ == 0.0);
   DRAKE_DEMAND(dynamics_.size() > 0);
-  EvaluateWithContext(context, dynamics_, dynamics_jacobian_,
+  EvaluateWithContext(context, dynamics_, dynamics_compiled_,
                       dynamics_needs_inputs_,
                       &derivatives->get_mutable_vector());
 }
@@ -359,7 +389,7 @@ void SymbolicVectorSystem<T>::DoCalcDiscreteVariableUpdates(
   unused(events);
   DRAKE_DEMAND(time_period_ > 0.0);
   DRAKE_DEMAND(dynamics_.size() > 0);
-  EvaluateWithContext(context, dynamics_, dynamics_jacobian_,
+  EvaluateWithContext(context, dynamics_, dynamics_compiled_,
                       dynamics_needs_inputs_, &updates->get_mutable_vector());
 }
 
@@ -184,10 +184,11 @@ class SymbolicVectorSystem final : public LeafSystem<T> {
   void PopulateFromContext(const Context<T>& context, bool needs_inputs,
                            Container* penv) const;
 
-  // Evaluate context to a vector.
+  // Evaluate context to a vector. The `compiled` program is only used when T
+  // is double or AutoDiffXd; see dynamics_compiled_ for its layout.
   void EvaluateWithContext(const Context<T>& context,
                            const VectorX<symbolic::Expression>& expr,
-                           const MatrixX<symbolic::Expression>& jacobian,
+                           const symbolic::CompiledExpressions& compiled,
                            bool needs_inputs, VectorBase<T>* out) const;
 
   void CalcOutput(const Context<T>& context,
@@ -210,14 +211,16 @@ class SymbolicVectorSystem final : public LeafSystem<T> {
   const bool dynamics_needs_inputs_;
   const bool output_needs_inputs_;
 
-  symbolic::Environment env_{};
   const double time_period_{0.0};
 
   std::unordered_map<symbolic::Variable::Id, int> state_var_to_index_;
 
-  // Storage for Jacobians (empty unless T == AutoDiffXd).
-  MatrixX<symbolic::Expression> dynamics_jacobian_{};
-  MatrixX<symbolic::Expression> output_jacobian_{};
+  // The dynamics and output, compiled (unless T == Expression) with the
+  // state, input, parameter, and time variables as the parameters, in that
+  // order. When T == AutoDiffXd, each is followed by its Jacobian with respect
+  // to those variables, in column-major order.
+  symbolic::CompiledExpressions dynamics_compiled_{};
+  symbolic::CompiledExpressions output_compiled_{};
 
   template <typename U>
   friend class SymbolicVectorSystem;
@@ -428,21 +431,21 @@ class SymbolicVectorSystemBuilder {
 template <>
 void SymbolicVectorSystem<double>::EvaluateWithContext(
     const Context<double>& context, const VectorX<symbolic::Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const symbolic::CompiledExpressions& compiled, bool needs_inputs,
     VectorBase<double>* out) const;
 
 template <>
 void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
     const Context<AutoDiffXd>& context,
     const VectorX<symbolic::Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const symbolic::CompiledExpressions& compiled, bool needs_inputs,
     VectorBase<AutoDiffXd>* out) const;
 
 template <>
 void SymbolicVectorSystem<symbolic::Expression>::EvaluateWithContext(
     const Context<symbolic::Expression>& context,
     const VectorX<symbolic::Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const symbolic::CompiledExpressions& compiled, bool needs_inputs,
     VectorBase<symbolic::Expression>* out) const;
 #endif
 
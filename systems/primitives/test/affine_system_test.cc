@@ -161,6 +161,109 @@ TEST_F(AffineSystemTest, ConvertScalarType) {
   }));
 }
 
+class SparseAffineSystemTest : public AffineLinearSystemTest {
+ public:
+  // Setup the same system as AffineSystemTest, with sparse matrices.
+  SparseAffineSystemTest() : AffineLinearSystemTest(-4.5, 6.5, 3.5, -7.6) {}
+
+  void Initialize() override {
+    dut_ = make_unique<SparseAffineSystem<double>>(
+        A_.sparseView(), B_.sparseView(), f0_, C_.sparseView(),
+        D_.sparseView(), y0_);
+    dut_->configure_default_state(x0_);
+    dut_->set_name("test_sparse_affine_system");
+    context_ = dut_->CreateDefaultContext();
+    input_port_ = &dut_->get_input_port();
+    state_ = &context_->get_mutable_continuous_state();
+    derivatives_ = dut_->AllocateTimeDerivatives();
+  }
+
+ protected:
+  unique_ptr<SparseAffineSystem<double>> dut_;
+  const Eigen::Vector2d x0_{1.2, 3.4};
+};
+
+// Tests that the sparse affine system is correctly setup.
+TEST_F(SparseAffineSystemTest, Construction) {
+  EXPECT_EQ("test_sparse_affine_system", dut_->get_name());
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(dut_->A()), A_));
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(dut_->B()), B_));
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(dut_->C()), C_));
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(dut_->D()), D_));
+  EXPECT_EQ(dut_->f0(), f0_);
+  EXPECT_EQ(dut_->y0(), y0_);
+  EXPECT_EQ(dut_->num_output_ports(), 1);
+  EXPECT_EQ(dut_->num_input_ports(), 1);
+
+  // Test TimeVaryingAffineSystem accessor methods.
+  const double t = 3.5;
+  EXPECT_TRUE(CompareMatrices(dut_->A(t), A_));
+  EXPECT_TRUE(CompareMatrices(dut_->B(t), B_));
+  EXPECT_TRUE(CompareMatrices(dut_->f0(t), f0_));
+  EXPECT_TRUE(CompareMatrices(dut_->C(t), C_));
+  EXPECT_TRUE(CompareMatrices(dut_->D(t), D_));
+  EXPECT_TRUE(CompareMatrices(dut_->y0(t), y0_));
+}
+
+// Tests that the derivatives and outputs match those of AffineSystem.
+TEST_F(SparseAffineSystemTest, DerivativesAndOutput) {
+  const Eigen::Vector2d u(5.6, -10.1);
+  SetInput(u);
+  const Eigen::Vector2d x(0.8, -22.1);
+  state_->SetFromVector(x);
+
+  dut_->CalcTimeDerivatives(*context_, derivatives_.get());
+  EXPECT_TRUE(CompareMatrices(A_ * x + B_ * u + f0_,
+                              derivatives_->get_vector().CopyToVector(),
+                              1e-10));
+  EXPECT_TRUE(CompareMatrices(C_ * x + D_ * u + y0_,
+                              dut_->get_output_port().Eval(*context_), 1e-10));
+}
+
+// Tests that the discrete updates match those of AffineSystem.
+TEST_F(SparseAffineSystemTest, DiscreteUpdates) {
+  // Leave out some entries to exercise the sparse storage.
+  Eigen::SparseMatrix<double> A(2, 2);
+  A.insert(0, 1) = 2.0;
+  A.insert(1, 0) = -1.5;
+  const Eigen::MatrixXd A_dense(A);
+  const SparseAffineSystem<double> dut(A, B_.sparseView(), f0_,
+                                       C_.sparseView(), D_.sparseView(), y0_,
+                                       0.1);
+  auto context = dut.CreateDefaultContext();
+  const Eigen::Vector2d u(1, 4);
+  dut.get_input_port().FixValue(context.get(), u);
+  const Eigen::Vector2d x(0.1, 0.25);
+  context->get_mutable_discrete_state_vector().SetFromVector(x);
+
+  auto updates = dut.AllocateDiscreteVariables();
+  dut.CalcDiscreteVariableUpdates(*context, updates.get());
+  EXPECT_TRUE(CompareMatrices(A_dense * x + B_ * u + f0_,
+                              updates->get_vector().CopyToVector(), 1e-10));
+}
+
+// Tests converting to different scalar types.
+TEST_F(SparseAffineSystemTest, ConvertScalarType) {
+  EXPECT_TRUE(is_autodiffxd_convertible(*dut_, [&](const auto& converted) {
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.A()), A_));
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.B()), B_));
+    EXPECT_EQ(converted.f0(), f0_);
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.C()), C_));
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.D()), D_));
+    EXPECT_EQ(converted.y0(), y0_);
+    EXPECT_TRUE(CompareMatrices(
+        math::ExtractValue(converted.get_default_state()), x0_, 0.0));
+  }));
+  EXPECT_TRUE(is_symbolic_convertible(*dut_, [&](const auto& converted) {
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.A()), A_));
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.B()), B_));
+    EXPECT_EQ(converted.f0(), f0_);
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.C()), C_));
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.D()), D_));
+    EXPECT_EQ(converted.y0(), y0_);
+  }));
+}
+
 class FeedthroughAffineSystemTest : public ::testing::Test {
  public:
   void SetDCornerElement(double d_1_1_element) {
@@ -59,6 +59,19 @@ Eigen::VectorXd ConcatenateAbstractBufferToVector(Context<double>* context) {
   return value;
 }
 
+// Returns the circular buffer of a vector-valued DiscreteTimeDelay, starting
+// with the oldest value (i.e., in the same order as
+// ConcatenateAbstractBufferToVector()).
+Eigen::VectorXd ConcatenateVectorBufferToVector(
+    const Context<double>& context) {
+  const Eigen::VectorXd& buffer = context.get_discrete_state(0).value();
+  const int oldest_index = context.get_discrete_state(1)[0];
+  Eigen::VectorXd value(buffer.size());
+  value << buffer.tail(buffer.size() - oldest_index * kLength),
+      buffer.head(oldest_index * kLength);
+  return value;
+}
+
 class DiscreteTimeDelayTest : public ::testing::TestWithParam<bool> {
  protected:
   DiscreteTimeDelayTest() : is_abstract_(GetParam()) {}
@@ -112,6 +125,9 @@ TEST_P(DiscreteTimeDelayTest, InitialState) {
     const BasicVector<double>& xd = context_->get_discrete_state(0);
     EXPECT_EQ(kLength * (kBuffer + 1), xd.size());
     value = xd.CopyToVector();
+    // The oldest value is at the start of the buffer.
+    EXPECT_EQ(context_->get_discrete_state(1).size(), 1);
+    EXPECT_EQ(context_->get_discrete_state(1)[0], 0.0);
   } else {
     value = ConcatenateAbstractBufferToVector(context_.get());
   }
@@ -149,8 +165,11 @@ TEST_P(DiscreteTimeDelayTest, Update) {
   Eigen::VectorXd value;
   // Check that the state has been updated to the input.
   if (!is_abstract_) {
-    const BasicVector<double>& xd = context_->get_discrete_state(0);
-    value = xd.CopyToVector();
+    value = ConcatenateVectorBufferToVector(*context_);
+    // Only the oldest value was overwritten.
+    EXPECT_EQ(context_->get_discrete_state(1)[0], 1.0);
+    EXPECT_EQ(context_->get_discrete_state(0).value().head(kLength),
+              input_value_);
   } else {
     value = ConcatenateAbstractBufferToVector(context_.get());
   }
@@ -325,18 +344,28 @@ TEST_F(SymbolicDiscreteTimeDelayTest, Output) {
   EXPECT_EQ("x0", out[0].to_string());
 }
 
-// Tests that SaveInputVectorToBuffer updates the state (i.e. slides the buffer
-// forward, adding the input value to the end of the buffer).
+// Tests that SaveInputVectorToBuffer updates the state (i.e. replaces the
+// oldest value with the input value, and advances to the next oldest value).
 TEST_F(SymbolicDiscreteTimeDelayTest, Update) {
   const auto& xd = context_->get_discrete_state(0);
   for (int ii = 0; ii < (kBuffer + 1); ii++) {
     EXPECT_EQ("x" + std::to_string(ii), xd[ii].to_string());
   }
   delay_->SaveInputToBuffer(context_.get());
-  for (int ii = 0; ii < kBuffer; ii++) {
-    EXPECT_EQ("x" + std::to_string(ii + 1), xd[ii].to_string());
+  EXPECT_EQ("u0", xd[0].to_string());
+  for (int ii = 1; ii < (kBuffer + 1); ii++) {
+    EXPECT_EQ("x" + std::to_string(ii), xd[ii].to_string());
   }
-  EXPECT_EQ("u0", xd[kBuffer].to_string());
+  EXPECT_EQ("x1", delay_->get_output_port().Eval(*context_)[0].to_string());
+}
+
+// The index of the oldest value must be a constant, even when the buffer holds
+// symbolic expressions.
+TEST_F(SymbolicDiscreteTimeDelayTest, SymbolicIndexThrows) {
+  EXPECT_EQ(context_->get_discrete_state(1)[0].to_string(), "0");
+  context_->get_mutable_discrete_state(1)[0] = symbolic::Variable("h");
+  EXPECT_THROW(delay_->get_output_port().Eval(*context_), std::exception);
+  EXPECT_THROW(delay_->SaveInputToBuffer(context_.get()), std::exception);
 }
 
 }  // namespace
@@ -178,6 +178,24 @@ class SimpleTimeVaryingLinearSystem final
   }
 };
 
+// Tests converting a SparseLinearSystem to different scalar types.
+TEST_F(LinearSystemTest, SparseConvertScalarType) {
+  const SparseLinearSystem<double> dut(A_.sparseView(), B_.sparseView(),
+                                       C_.sparseView(), D_.sparseView());
+  EXPECT_TRUE(is_autodiffxd_convertible(dut, [&](const auto& converted) {
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.A()), A_));
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.B()), B_));
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.C()), C_));
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.D()), D_));
+  }));
+  EXPECT_TRUE(is_symbolic_convertible(dut, [&](const auto& converted) {
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.A()), A_));
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.B()), B_));
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.C()), C_));
+    EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(converted.D()), D_));
+  }));
+}
+
 GTEST_TEST(SimpleTimeVaryingLinearSystemTest, ConstructorTest) {
   SimpleTimeVaryingLinearSystem sys;
 
@@ -288,6 +306,71 @@ TEST_F(TestLinearizeFromAffine, ContinuousAtNonEquilibrium) {
                               MatrixCompareType::absolute));
 }
 
+// Test that SparseLinearize() agrees with Linearize().
+TEST_F(TestLinearizeFromAffine, SparseLinearize) {
+  auto context = continuous_system_->CreateDefaultContext();
+  continuous_system_->get_input_port().FixValue(context.get(), u0_);
+  context->get_mutable_continuous_state_vector().SetFromVector(
+      xstar_continuous_);
+
+  auto sparse_system = SparseLinearize(*continuous_system_, *context);
+
+  double tol = 1e-10;
+  EXPECT_TRUE(CompareMatrices(A_, Eigen::MatrixXd(sparse_system->A()), tol,
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(B_, Eigen::MatrixXd(sparse_system->B()), tol,
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(C_, Eigen::MatrixXd(sparse_system->C()), tol,
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(D_, Eigen::MatrixXd(sparse_system->D()), tol,
+                              MatrixCompareType::absolute));
+  EXPECT_EQ(sparse_system->time_period(), 0.0);
+
+  // Also at a discrete-time equilibrium.
+  auto discrete_context = discrete_system_->CreateDefaultContext();
+  discrete_system_->get_input_port().FixValue(discrete_context.get(), u0_);
+  discrete_context->get_mutable_discrete_state_vector().SetFromVector(
+      xstar_discrete_);
+  auto sparse_discrete = SparseLinearize(*discrete_system_, *discrete_context);
+  EXPECT_TRUE(CompareMatrices(A_, Eigen::MatrixXd(sparse_discrete->A()), tol,
+                              MatrixCompareType::absolute));
+  EXPECT_EQ(sparse_discrete->time_period(), time_period_);
+
+  // A non-equilibrium point is still rejected.
+  context->get_mutable_continuous_state_vector().SetFromVector(x0_);
+  EXPECT_THROW(SparseLinearize(*continuous_system_, *context),
+               std::runtime_error);
+}
+
+// Test that SparseLinearize() only stores the structural nonzeros of a
+// sparse system.
+GTEST_TEST(SparseLinearizeTest, KeepsSparsity) {
+  const int n = 50;
+  Eigen::SparseMatrix<double> A(n, n);
+  Eigen::SparseMatrix<double> B(n, 1);
+  Eigen::SparseMatrix<double> C(1, n);
+  Eigen::SparseMatrix<double> D(1, 1);
+  for (int i = 0; i < n; ++i) {
+    A.insert(i, i) = -1.0 - i;
+    if (i + 1 < n) A.insert(i, i + 1) = 0.5;
+  }
+  B.insert(0, 0) = 1.0;
+  C.insert(0, n - 1) = 2.0;
+  const SparseLinearSystem<double> sys(A, B, C, D);
+  auto context = sys.CreateDefaultContext();
+  sys.get_input_port().FixValue(context.get(), 0.0);
+
+  auto linearized = SparseLinearize(sys, *context);
+  EXPECT_EQ(linearized->A().nonZeros(), A.nonZeros());
+  EXPECT_EQ(linearized->B().nonZeros(), 1);
+  EXPECT_EQ(linearized->C().nonZeros(), 1);
+  EXPECT_EQ(linearized->D().nonZeros(), 0);
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(linearized->A()),
+                              Eigen::MatrixXd(A), 1e-12));
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(linearized->C()),
+                              Eigen::MatrixXd(C), 1e-12));
+}
+
 TEST_F(TestLinearizeFromAffine, DiscreteAtEquilibrium) {
   auto context = discrete_system_->CreateDefaultContext();
   discrete_system_->get_input_port().FixValue(context.get(), u0_);
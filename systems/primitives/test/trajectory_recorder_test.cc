@@ -0,0 +1,140 @@
+#include "drake/systems/primitives/trajectory_recorder.h"
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::Vector2d;
+
+class TrajectoryRecorderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    recorder_.AddVectorInput("x", 2);
+    recorder_.AddAbstractInput(
+        "label", Value<std::string>(), {"label_size"},
+        [](const AbstractValue& value, VectorX<double>* columns) {
+          (*columns)(0) = value.get_value<std::string>().size();
+        });
+    context_ = recorder_.CreateDefaultContext();
+  }
+
+  // Records `num_samples` samples, at times 0, 0.1, ..., to `filename`.
+  void Record(const std::string& filename, int num_samples) {
+    recorder_.StartRecording(filename, context_.get());
+    EXPECT_TRUE(recorder_.is_recording(*context_));
+    for (int k = 0; k < num_samples; ++k) {
+      context_->SetTime(0.1 * k);
+      recorder_.get_input_port(0).FixValue(context_.get(),
+                                           Vector2d(k, -k));
+      recorder_.get_input_port(1).FixValue(context_.get(),
+                                           std::string(k % 5, 'a'));
+      recorder_.Publish(*context_);
+    }
+    recorder_.StopRecording(context_.get());
+    EXPECT_FALSE(recorder_.is_recording(*context_));
+  }
+
+  // Chunks of 8 samples.
+  TrajectoryRecorder recorder_{0.0, 8};
+  std::unique_ptr<Context<double>> context_;
+  const std::string filename_{temp_directory() + "/recording.bin"};
+};
+
+TEST_F(TrajectoryRecorderTest, Schema) {
+  const std::vector<std::string> expected{"time", "x[0]", "x[1]",
+                                          "label_size"};
+  EXPECT_EQ(recorder_.column_names(), expected);
+  EXPECT_EQ(recorder_.num_input_ports(), 2);
+}
+
+TEST_F(TrajectoryRecorderTest, RoundTrip) {
+  const int kNumSamples = 100;
+  Record(filename_, kNumSamples);
+
+  TrajectoryRecordingReader reader(filename_);
+  EXPECT_EQ(reader.column_names(), recorder_.column_names());
+  ASSERT_EQ(reader.num_rows(), kNumSamples);
+  const MatrixX<double> all = reader.Read(reader.column_names());
+  ASSERT_EQ(all.rows(), kNumSamples);
+  ASSERT_EQ(all.cols(), 4);
+  for (int k = 0; k < kNumSamples; ++k) {
+    EXPECT_EQ(all(k, 0), 0.1 * k);
+    EXPECT_EQ(all(k, 1), k);
+    EXPECT_EQ(all(k, 2), -k);
+    EXPECT_EQ(all(k, 3), k % 5);
+  }
+
+  // Partial reads, of some columns and rows (spanning several chunks).
+  const MatrixX<double> part = reader.Read({"x[1]", "time"}, 13, 20);
+  ASSERT_EQ(part.rows(), 20);
+  ASSERT_EQ(part.cols(), 2);
+  EXPECT_TRUE(CompareMatrices(part.col(0), all.col(2).segment(13, 20)));
+  EXPECT_TRUE(CompareMatrices(part.col(1), all.col(0).segment(13, 20)));
+  EXPECT_TRUE(
+      CompareMatrices(reader.Read({"x[0]"}, 95), all.block(95, 1, 5, 1)));
+  EXPECT_EQ(reader.Read({"x[0]"}, 0, 0).rows(), 0);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(reader.Read({"y"}), ".*no column named 'y'.*");
+  EXPECT_THROW(reader.Read({"x[0]"}, 90, 20), std::exception);
+}
+
+// Each recording of a context goes to its own file, and only the samples
+// taken while recording are recorded.
+TEST_F(TrajectoryRecorderTest, MultipleRecordings) {
+  recorder_.get_input_port(0).FixValue(context_.get(), Vector2d::Zero());
+  recorder_.get_input_port(1).FixValue(context_.get(), std::string());
+  recorder_.Publish(*context_);
+
+  const std::string other = temp_directory() + "/other.bin";
+  Record(filename_, 3);
+  Record(other, 20);
+  EXPECT_EQ(TrajectoryRecordingReader(filename_).num_rows(), 3);
+  EXPECT_EQ(TrajectoryRecordingReader(other).num_rows(), 20);
+
+  // An empty recording.
+  Record(filename_, 0);
+  TrajectoryRecordingReader reader(filename_);
+  EXPECT_EQ(reader.num_rows(), 0);
+  EXPECT_EQ(reader.Read({"time"}).rows(), 0);
+
+  // A copy of a context isn't recorded.
+  recorder_.StartRecording(filename_, context_.get());
+  EXPECT_FALSE(recorder_.is_recording(*context_->Clone()));
+}
+
+TEST_F(TrajectoryRecorderTest, Errors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      recorder_.StartRecording(temp_directory() + "/no/such/dir/a.bin",
+                               context_.get()),
+      ".*could not open.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      TrajectoryRecordingReader(temp_directory() + "/no_such_file.bin"),
+      ".*could not open.*");
+
+  // A truncated recording is rejected.
+  Record(filename_, 10);
+  std::ifstream input(filename_, std::ios::binary);
+  const std::string contents((std::istreambuf_iterator<char>(input)),
+                             std::istreambuf_iterator<char>());
+  const std::string truncated = filename_ + ".truncated";
+  std::ofstream(truncated, std::ios::binary)
+      << contents.substr(0, contents.size() - 1);
+  DRAKE_EXPECT_THROWS_MESSAGE(TrajectoryRecordingReader{truncated},
+                              ".*not a well-formed recording.*");
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
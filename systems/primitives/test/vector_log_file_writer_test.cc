@@ -0,0 +1,95 @@
+#include "drake/systems/primitives/vector_log_file_writer.h"
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+class VectorLogFileWriterTest : public ::testing::Test {
+ protected:
+  const std::string filename_{temp_directory() + "/vector_log.bin"};
+};
+
+// Streams the samples discarded by a bounded log, and then the retained ones,
+// and reads them all back.
+TEST_F(VectorLogFileWriterTest, RoundTrip) {
+  const int kNumSamples = 1000;
+  VectorLog<double> expected(2);
+  {
+    VectorLog<double> log(2);
+    VectorLogFileWriter writer(filename_, 2);
+    log.SetMaxNumSamples(64);
+    log.SetDiscardedSamplesCallback(
+        [&writer](const Eigen::Ref<const VectorX<double>>& times,
+                  const Eigen::Ref<const MatrixX<double>>& data) {
+          writer.Write(times, data);
+        });
+    for (int k = 0; k < kNumSamples; ++k) {
+      const Eigen::Vector2d sample(k, -0.5 * k);
+      log.AddData(0.001 * k, sample);
+      expected.AddData(0.001 * k, sample);
+    }
+    EXPECT_EQ(log.num_samples(), 64);
+    log.FlushDiscardedSamples();
+    writer.Flush();
+    writer.Write(log.sample_times(), log.data());
+    writer.Close();
+    // Closing is idempotent.
+    writer.Close();
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        writer.Write(log.sample_times(), log.data()), ".*closing_.*");
+  }
+
+  const VectorLog<double> log = ReadVectorLogFile(filename_);
+  EXPECT_EQ(log.get_input_size(), 2);
+  ASSERT_EQ(log.num_samples(), kNumSamples);
+  EXPECT_TRUE(CompareMatrices(log.sample_times(), expected.sample_times()));
+  EXPECT_TRUE(CompareMatrices(log.data(), expected.data()));
+}
+
+TEST_F(VectorLogFileWriterTest, Empty) {
+  { VectorLogFileWriter writer(filename_, 3); }
+  const VectorLog<double> log = ReadVectorLogFile(filename_);
+  EXPECT_EQ(log.get_input_size(), 3);
+  EXPECT_EQ(log.num_samples(), 0);
+}
+
+TEST_F(VectorLogFileWriterTest, Errors) {
+  VectorLogFileWriter writer(filename_, 2);
+  EXPECT_THROW(writer.Write(Eigen::Vector2d::Zero(), MatrixX<double>(3, 2)),
+               std::exception);
+  EXPECT_THROW(writer.Write(Eigen::Vector3d::Zero(), MatrixX<double>(2, 2)),
+               std::exception);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      VectorLogFileWriter(temp_directory() + "/no/such/dir/log.bin", 2),
+      ".*could not open.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ReadVectorLogFile(temp_directory() + "/no_such_file.bin"),
+      ".*could not open.*");
+
+  // A truncated file is rejected.
+  writer.Write(Eigen::Vector2d(0.0, 1.0), MatrixX<double>::Ones(2, 2));
+  writer.Close();
+  std::ifstream input(filename_, std::ios::binary);
+  const std::string contents((std::istreambuf_iterator<char>(input)),
+                             std::istreambuf_iterator<char>());
+  const std::string truncated = filename_ + ".truncated";
+  std::ofstream(truncated, std::ios::binary)
+      << contents.substr(0, contents.size() - 1);
+  DRAKE_EXPECT_THROWS_MESSAGE(ReadVectorLogFile(truncated),
+                              ".*not a well-formed.*");
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
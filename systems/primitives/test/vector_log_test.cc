@@ -1,5 +1,7 @@
 #include "drake/systems/primitives/vector_log.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/autodiff.h"
@@ -65,6 +67,67 @@ TYPED_TEST(VectorLogFixture, GrowLog) {
   EXPECT_EQ(log.data()(2, goal_size - 1), 3.3);
 }
 
+TYPED_TEST(VectorLogFixture, Bounded) {
+  using T = TypeParam;
+  auto& log = this->log_;
+  EXPECT_FALSE(log.max_num_samples().has_value());
+  EXPECT_THROW(log.SetMaxNumSamples(0), std::exception);
+
+  // Record the discarded samples.
+  std::vector<T> discarded_times;
+  log.SetDiscardedSamplesCallback(
+      [&discarded_times](const Eigen::Ref<const VectorX<T>>& times,
+                         const Eigen::Ref<const MatrixX<T>>& data) {
+        EXPECT_EQ(data.cols(), times.size());
+        for (int i = 0; i < times.size(); ++i) {
+          EXPECT_EQ(data(0, i), times(i));
+          discarded_times.push_back(times(i));
+        }
+      });
+
+  // Bounding a log discards its oldest samples right away.
+  for (int k = 0; k < 5; ++k) {
+    log.AddData(T(k), VectorX<T>::Constant(3, T(k)));
+  }
+  const int kMax = 3;
+  log.SetMaxNumSamples(kMax);
+  EXPECT_EQ(log.max_num_samples(), kMax);
+  EXPECT_EQ(log.num_samples(), kMax);
+  EXPECT_EQ(log.sample_times()[0], 2.0);
+  ASSERT_EQ(discarded_times.size(), 2);
+
+  // The log retains the most recent samples, in order, and discards the
+  // others (in batches).
+  const int kNumSamples = 100;
+  for (int k = 5; k < kNumSamples; ++k) {
+    log.AddData(T(k), VectorX<T>::Constant(3, T(k)));
+    ASSERT_EQ(log.num_samples(), kMax);
+    for (int i = 0; i < kMax; ++i) {
+      const double expected = k - kMax + 1 + i;
+      EXPECT_EQ(log.sample_times()[i], expected);
+      EXPECT_EQ(log.data()(2, i), expected);
+    }
+    const int num_discarded = discarded_times.size();
+    EXPECT_LE(num_discarded, k - kMax + 1);
+    EXPECT_GE(num_discarded, k - 2 * kMax);
+  }
+
+  // Clearing the log delivers the samples discarded so far, but not the
+  // retained ones.
+  log.Clear();
+  ASSERT_EQ(discarded_times.size(), kNumSamples - kMax);
+  for (int k = 0; k < kNumSamples - kMax; ++k) {
+    EXPECT_EQ(discarded_times[k], static_cast<double>(k));
+  }
+
+  // The bound can be removed.
+  log.SetMaxNumSamples(std::nullopt);
+  for (int k = 0; k < 2 * kMax; ++k) {
+    log.AddData(T(k), this->record_);
+  }
+  EXPECT_EQ(log.num_samples(), 2 * kMax);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -0,0 +1,491 @@
+#include "drake/systems/primitives/trajectory_recorder.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include <fmt/format.h>
+#include <zlib.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+constexpr char kMagic[] = "DRAKETR1";
+constexpr int kMagicSize = sizeof(kMagic) - 1;
+
+template <typename Scalar>
+void WriteRaw(std::ofstream* file, const Scalar& value) {
+  file->write(reinterpret_cast<const char*>(&value), sizeof(Scalar));
+}
+
+template <typename Scalar>
+bool ReadRaw(std::ifstream* file, Scalar* value) {
+  file->read(reinterpret_cast<char*>(value), sizeof(Scalar));
+  return static_cast<bool>(*file);
+}
+
+// Stores the bytes of `values` grouped by their position within each value
+// (all of the first bytes, then all of the second bytes, etc.). The bytes of
+// similar doubles (e.g., the exponents) then end up next to each other, which
+// compresses much better.
+void Shuffle(const double* values, int num_values,
+             std::vector<uint8_t>* bytes) {
+  const auto* input = reinterpret_cast<const uint8_t*>(values);
+  bytes->resize(sizeof(double) * num_values);
+  for (int i = 0; i < num_values; ++i) {
+    for (int b = 0; b < static_cast<int>(sizeof(double)); ++b) {
+      (*bytes)[b * num_values + i] = input[i * sizeof(double) + b];
+    }
+  }
+}
+
+// Undoes Shuffle().
+void Unshuffle(const std::vector<uint8_t>& bytes, int num_values,
+               double* values) {
+  auto* output = reinterpret_cast<uint8_t*>(values);
+  for (int i = 0; i < num_values; ++i) {
+    for (int b = 0; b < static_cast<int>(sizeof(double)); ++b) {
+      output[i * sizeof(double) + b] = bytes[b * num_values + i];
+    }
+  }
+}
+
+// A chunk of samples. Column j of `values` holds the samples of the j'th
+// recorded column; only its first `num_rows` rows are meaningful.
+struct Chunk {
+  MatrixX<double> values;
+  int num_rows{};
+};
+
+// A file being recorded. The chunks passed to Enqueue() are compressed and
+// written on a background thread.
+class RecordingFile {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RecordingFile)
+
+  RecordingFile(const std::string& filename,
+                const std::vector<std::string>& column_names, int chunk_size)
+      : filename_(filename),
+        num_columns_(column_names.size()),
+        chunk_size_(chunk_size),
+        file_(filename, std::ios::binary | std::ios::trunc) {
+    if (!file_) {
+      throw std::runtime_error(fmt::format(
+          "TrajectoryRecorder: could not open '{}' for writing", filename));
+    }
+    file_.write(kMagic, kMagicSize);
+    WriteRaw(&file_, static_cast<uint32_t>(num_columns_));
+    for (const std::string& name : column_names) {
+      WriteRaw(&file_, static_cast<uint32_t>(name.size()));
+      file_.write(name.data(), name.size());
+    }
+    writer_thread_ = std::thread([this]() { WriteChunks(); });
+  }
+
+  ~RecordingFile() {
+    try {
+      Close();
+    } catch (const std::exception&) {
+      // Destructors must not throw.
+    }
+  }
+
+  // Returns an empty chunk, reusing the storage of a written chunk if any.
+  Chunk TakeChunk() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!free_chunks_.empty()) {
+        Chunk chunk = std::move(free_chunks_.back());
+        free_chunks_.pop_back();
+        return chunk;
+      }
+    }
+    return Chunk{MatrixX<double>(chunk_size_, num_columns_), 0};
+  }
+
+  // Queues `chunk` to be written.
+  // @throws std::exception if a previous chunk couldn't be written.
+  void Enqueue(Chunk chunk) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ThrowIfFailed();
+    chunks_.push_back(std::move(chunk));
+    wake_writer_.notify_one();
+  }
+
+  // Writes the queued chunks, then closes the file.
+  // @throws std::exception if a chunk couldn't be written.
+  void Close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (closing_) {
+        return;
+      }
+      closing_ = true;
+      wake_writer_.notify_one();
+    }
+    writer_thread_.join();
+    file_.close();
+    std::lock_guard<std::mutex> lock(mutex_);
+    ThrowIfFailed();
+  }
+
+ private:
+  void ThrowIfFailed() const {
+    if (failed_) {
+      throw std::runtime_error(fmt::format(
+          "TrajectoryRecorder: could not write to '{}'", filename_));
+    }
+  }
+
+  void WriteChunks() {
+    std::vector<uint8_t> shuffled;
+    std::vector<uint8_t> compressed;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      wake_writer_.wait(lock,
+                        [this]() { return !chunks_.empty() || closing_; });
+      if (chunks_.empty()) {
+        // closing_ is set, and there is nothing left to write.
+        break;
+      }
+      Chunk chunk = std::move(chunks_.front());
+      chunks_.pop_front();
+      lock.unlock();
+
+      bool ok = true;
+      WriteRaw(&file_, static_cast<uint32_t>(chunk.num_rows));
+      for (int j = 0; j < num_columns_ && ok; ++j) {
+        Shuffle(chunk.values.col(j).data(), chunk.num_rows, &shuffled);
+        uLongf compressed_size = compressBound(shuffled.size());
+        compressed.resize(compressed_size);
+        ok = compress2(compressed.data(), &compressed_size, shuffled.data(),
+                       shuffled.size(), Z_BEST_SPEED) == Z_OK;
+        WriteRaw(&file_, static_cast<uint64_t>(compressed_size));
+        file_.write(reinterpret_cast<const char*>(compressed.data()),
+                    compressed_size);
+      }
+      file_.flush();
+      ok = ok && static_cast<bool>(file_);
+
+      lock.lock();
+      chunk.num_rows = 0;
+      free_chunks_.push_back(std::move(chunk));
+      if (!ok) {
+        failed_ = true;
+        chunks_.clear();
+      }
+    }
+  }
+
+  const std::string filename_;
+  const int num_columns_;
+  const int chunk_size_;
+  std::ofstream file_;
+
+  // All of the fields below are guarded by mutex_.
+  std::mutex mutex_;
+  std::condition_variable wake_writer_;
+  std::deque<Chunk> chunks_;
+  std::vector<Chunk> free_chunks_;
+  bool closing_{false};
+  bool failed_{false};
+
+  std::thread writer_thread_;
+};
+
+// The recording of one context, stored in its cache. Copies of a context are
+// not recorded, so copies of a recording are empty.
+class Recording {
+ public:
+  Recording() = default;
+  Recording(const Recording&) {}
+  Recording& operator=(const Recording& other) {
+    if (this != &other) {
+      file_.reset();
+    }
+    return *this;
+  }
+  ~Recording() = default;
+
+  bool is_recording() const { return file_ != nullptr; }
+
+  void Start(const std::string& filename,
+             const std::vector<std::string>& column_names, int chunk_size) {
+    Stop();
+    file_ = std::make_unique<RecordingFile>(filename, column_names, chunk_size);
+    chunk_ = file_->TakeChunk();
+  }
+
+  void Stop() {
+    if (file_ == nullptr) {
+      return;
+    }
+    std::unique_ptr<RecordingFile> file = std::move(file_);
+    if (chunk_.num_rows > 0) {
+      file->Enqueue(std::move(chunk_));
+    }
+    chunk_ = {};
+    file->Close();
+  }
+
+  // Returns the row of the current chunk to be filled in next.
+  auto next_row() { return chunk_.values.row(chunk_.num_rows); }
+
+  // Adds the row returned by next_row() to the current chunk.
+  void CommitRow() {
+    ++chunk_.num_rows;
+    if (chunk_.num_rows == chunk_.values.rows()) {
+      try {
+        file_->Enqueue(std::move(chunk_));
+      } catch (...) {
+        // Give up on this recording.
+        file_.reset();
+        throw;
+      }
+      chunk_ = file_->TakeChunk();
+    }
+  }
+
+  // Scratch space for the flattening functions.
+  VectorX<double>* scratch() { return &scratch_; }
+
+ private:
+  std::unique_ptr<RecordingFile> file_;
+  Chunk chunk_;
+  VectorX<double> scratch_;
+};
+
+Recording& GetRecording(const LeafSystem<double>& system,
+                        CacheIndex cache_index,
+                        const Context<double>& context) {
+  system.ValidateContext(context);
+  return system.get_cache_entry(cache_index)
+      .get_mutable_cache_entry_value(context)
+      .GetMutableValueOrThrow<Recording>();
+}
+
+}  // namespace
+
+TrajectoryRecorder::TrajectoryRecorder(double publish_period, int chunk_size)
+    : chunk_size_(chunk_size) {
+  DRAKE_THROW_UNLESS(publish_period >= 0.0);
+  DRAKE_THROW_UNLESS(chunk_size > 0);
+
+  // This cache entry just holds the recording in progress (if any). It is
+  // only ever updated by the methods below, so it invokes no invalidation
+  // support from the cache system.
+  recording_cache_index_ =
+      this->DeclareCacheEntry(
+          "recording",
+          ValueProducer(Recording(), &ValueProducer::NoopCalc),
+          {this->nothing_ticket()}).cache_index();
+
+  this->DeclareForcedPublishEvent(&TrajectoryRecorder::RecordSample);
+  if (publish_period > 0.0) {
+    this->DeclarePeriodicPublishEvent(publish_period, 0.0,
+                                      &TrajectoryRecorder::RecordSample);
+  } else {
+    this->DeclarePerStepPublishEvent(&TrajectoryRecorder::RecordSample);
+  }
+}
+
+const InputPort<double>& TrajectoryRecorder::AddVectorInput(
+    const std::string& name, int size) {
+  DRAKE_THROW_UNLESS(size > 0);
+  const InputPort<double>& port =
+      this->DeclareVectorInputPort(name, size);
+  for (int i = 0; i < size; ++i) {
+    column_names_.push_back(fmt::format("{}[{}]", name, i));
+  }
+  inputs_.push_back({port.get_index(), size, nullptr});
+  return port;
+}
+
+const InputPort<double>& TrajectoryRecorder::AddAbstractInput(
+    const std::string& name, const AbstractValue& model_value,
+    std::vector<std::string> column_names, Flattener flatten) {
+  DRAKE_THROW_UNLESS(!column_names.empty());
+  DRAKE_THROW_UNLESS(flatten != nullptr);
+  const InputPort<double>& port =
+      this->DeclareAbstractInputPort(name, model_value);
+  const int num_columns = column_names.size();
+  column_names_.insert(column_names_.end(), column_names.begin(),
+                       column_names.end());
+  inputs_.push_back({port.get_index(), num_columns, std::move(flatten)});
+  return port;
+}
+
+void TrajectoryRecorder::StartRecording(const std::string& filename,
+                                        Context<double>* context) const {
+  DRAKE_THROW_UNLESS(context != nullptr);
+  GetRecording(*this, recording_cache_index_, *context)
+      .Start(filename, column_names_, chunk_size_);
+}
+
+void TrajectoryRecorder::StopRecording(Context<double>* context) const {
+  DRAKE_THROW_UNLESS(context != nullptr);
+  GetRecording(*this, recording_cache_index_, *context).Stop();
+}
+
+bool TrajectoryRecorder::is_recording(const Context<double>& context) const {
+  return GetRecording(*this, recording_cache_index_, context).is_recording();
+}
+
+EventStatus TrajectoryRecorder::RecordSample(
+    const Context<double>& context) const {
+  Recording& recording =
+      GetRecording(*this, recording_cache_index_, context);
+  if (!recording.is_recording()) {
+    return EventStatus::DidNothing();
+  }
+  auto row = recording.next_row();
+  row(0) = context.get_time();
+  int column = 1;
+  for (const InputColumns& input : inputs_) {
+    const InputPort<double>& port = this->get_input_port(input.port_index);
+    if (input.flatten == nullptr) {
+      row.segment(column, input.num_columns) = port.Eval(context).transpose();
+    } else {
+      VectorX<double>* columns = recording.scratch();
+      columns->resize(input.num_columns);
+      input.flatten(port.Eval<AbstractValue>(context), columns);
+      DRAKE_THROW_UNLESS(columns->size() == input.num_columns);
+      row.segment(column, input.num_columns) = columns->transpose();
+    }
+    column += input.num_columns;
+  }
+  recording.CommitRow();
+  return EventStatus::Succeeded();
+}
+
+TrajectoryRecordingReader::TrajectoryRecordingReader(
+    const std::string& filename)
+    : filename_(filename), file_(filename, std::ios::binary) {
+  if (!file_) {
+    throw std::runtime_error(fmt::format(
+        "TrajectoryRecordingReader: could not open '{}' for reading",
+        filename));
+  }
+  auto fail = [&filename]() {
+    throw std::runtime_error(fmt::format(
+        "TrajectoryRecordingReader: '{}' is not a well-formed recording",
+        filename));
+  };
+
+  // Read the schema.
+  char magic[kMagicSize];
+  uint32_t num_columns{};
+  file_.read(magic, kMagicSize);
+  if (!ReadRaw(&file_, &num_columns) ||
+      std::memcmp(magic, kMagic, kMagicSize) != 0) {
+    fail();
+  }
+  for (uint32_t j = 0; j < num_columns; ++j) {
+    uint32_t size{};
+    if (!ReadRaw(&file_, &size)) fail();
+    std::string name(size, '\0');
+    file_.read(name.data(), size);
+    if (!file_) fail();
+    column_names_.push_back(std::move(name));
+  }
+
+  // Index the chunks, skipping over their values.
+  uint32_t num_rows{};
+  while (ReadRaw(&file_, &num_rows)) {
+    Chunk chunk{num_rows_, static_cast<int>(num_rows), {}, {}};
+    for (uint32_t j = 0; j < num_columns; ++j) {
+      uint64_t size{};
+      if (!ReadRaw(&file_, &size)) fail();
+      chunk.offsets.push_back(file_.tellg());
+      chunk.sizes.push_back(size);
+      file_.seekg(size, std::ios::cur);
+    }
+    if (!file_ || num_rows == 0) fail();
+    num_rows_ += num_rows;
+    chunks_.push_back(std::move(chunk));
+  }
+  // The only way to stop indexing is to reach the end of the file, exactly
+  // at a chunk boundary. (Seeking past the end is only detected on reading.)
+  if (!file_.eof() || file_.gcount() != 0) fail();
+  file_.clear();
+  file_.seekg(0, std::ios::end);
+  if (!chunks_.empty() &&
+      chunks_.back().offsets.back() + chunks_.back().sizes.back() >
+          static_cast<int64_t>(file_.tellg())) {
+    fail();
+  }
+}
+
+MatrixX<double> TrajectoryRecordingReader::Read(
+    const std::vector<std::string>& columns, int64_t first_row,
+    std::optional<int64_t> num_rows) {
+  const int64_t count = num_rows.value_or(num_rows_ - first_row);
+  DRAKE_THROW_UNLESS(first_row >= 0 && count >= 0);
+  DRAKE_THROW_UNLESS(first_row + count <= num_rows_);
+  std::vector<int> indices;
+  for (const std::string& name : columns) {
+    const auto iter =
+        std::find(column_names_.begin(), column_names_.end(), name);
+    if (iter == column_names_.end()) {
+      throw std::logic_error(fmt::format(
+          "TrajectoryRecordingReader: '{}' has no column named '{}'",
+          filename_, name));
+    }
+    indices.push_back(iter - column_names_.begin());
+  }
+
+  MatrixX<double> result(count, columns.size());
+  if (count == 0) {
+    return result;
+  }
+  // The first chunk that holds any of the requested rows.
+  auto chunk = std::upper_bound(
+      chunks_.begin(), chunks_.end(), first_row,
+      [](int64_t row, const Chunk& c) { return row < c.first_row; });
+  --chunk;
+  std::vector<uint8_t> compressed;
+  std::vector<uint8_t> shuffled;
+  VectorX<double> values;
+  for (; chunk != chunks_.end() && chunk->first_row < first_row + count;
+       ++chunk) {
+    // The requested rows within this chunk.
+    const int64_t begin = std::max(first_row, chunk->first_row);
+    const int64_t end =
+        std::min(first_row + count, chunk->first_row + chunk->num_rows);
+    values.resize(chunk->num_rows);
+    shuffled.resize(sizeof(double) * chunk->num_rows);
+    for (int k = 0; k < static_cast<int>(indices.size()); ++k) {
+      const int j = indices[k];
+      compressed.resize(chunk->sizes[j]);
+      file_.clear();
+      file_.seekg(chunk->offsets[j]);
+      file_.read(reinterpret_cast<char*>(compressed.data()), chunk->sizes[j]);
+      uLongf size = shuffled.size();
+      if (!file_ ||
+          uncompress(shuffled.data(), &size, compressed.data(),
+                     compressed.size()) != Z_OK ||
+          size != shuffled.size()) {
+        throw std::runtime_error(fmt::format(
+            "TrajectoryRecordingReader: '{}' is not a well-formed recording",
+            filename_));
+      }
+      Unshuffle(shuffled, chunk->num_rows, values.data());
+      result.col(k).segment(begin - first_row, end - begin) =
+          values.segment(begin - chunk->first_row, end - begin);
+    }
+  }
+  return result;
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+
+/**
+ A sink that records its inputs, sample by sample, to a chunked, compressed,
+ columnar file (see TrajectoryRecordingReader), e.g., to save the state,
+ actuation and contact results of every rollout for training learned models.
+
+ Each input port is declared with AddVectorInput() or AddAbstractInput() and
+ is recorded as one or more named columns of doubles; the recording's schema
+ is the `time` column, followed by the columns of each input port in the
+ order they were declared. A vector-valued port named `x` of size 2 is
+ recorded as the columns `x[0]` and `x[1]`, whereas an abstract-valued port
+ is recorded as the columns named when it was declared, as computed by its
+ flattening function.
+
+ Recording is per-context: StartRecording() opens a file for the samples of
+ a given context, and StopRecording() completes it, so that each rollout can
+ be recorded to its own file. Samples are taken on the same triggers as
+ VectorLogSink (per step by default, or periodically), but only while a file
+ is open. The simulation thread only copies each sample into a chunk of
+ rows; full chunks are compressed and written to the file on a background
+ thread.
+
+ @system
+ name: TrajectoryRecorder
+ input_ports:
+ - (user assigned port name)
+ - ...
+ - (user assigned port name)
+ @endsystem
+
+ @ingroup primitive_systems */
+class TrajectoryRecorder final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TrajectoryRecorder)
+
+  /** The signature of a function that writes the columns recorded for the
+   value of an abstract-valued input port into `columns`, which is sized to
+   the number of columns named in AddAbstractInput(). */
+  using Flattener =
+      std::function<void(const AbstractValue& value, VectorX<double>* columns)>;
+
+  /** Constructs a recorder without any inputs.
+   @param publish_period If positive, samples are recorded periodically with
+   this period (starting at time 0); if zero, samples are recorded at the end
+   of every simulation step instead. Samples are also recorded on forced
+   publish events.
+   @param chunk_size The number of samples per compressed chunk; the unit of
+   partial reads (see TrajectoryRecordingReader::Read()).
+   @pre publish_period is non-negative.
+   @pre chunk_size is positive. */
+  explicit TrajectoryRecorder(double publish_period = 0.0,
+                              int chunk_size = 1024);
+
+  /** Declares a vector-valued input port named `name`, of the given `size`,
+   that is recorded as the columns `name[0]`, ..., `name[size - 1]`. */
+  const InputPort<double>& AddVectorInput(const std::string& name, int size);
+
+  /** Declares an abstract-valued input port named `name`, whose values are
+   like `model_value`, and that is recorded as the given `column_names`, as
+   computed by `flatten`. */
+  const InputPort<double>& AddAbstractInput(
+      const std::string& name, const AbstractValue& model_value,
+      std::vector<std::string> column_names, Flattener flatten);
+
+  /** Returns the names of the recorded columns, starting with `time`. */
+  const std::vector<std::string>& column_names() const {
+    return column_names_;
+  }
+
+  /** Starts recording the samples of `context` to the file `filename`, which
+   is created (or truncated). A recording that was already in progress for
+   `context` is stopped first.
+   @throws std::exception if the file can't be opened. */
+  void StartRecording(const std::string& filename,
+                      Context<double>* context) const;
+
+  /** Writes any remaining samples of `context`, and then closes its file.
+   Has no effect if `context` is not being recorded. A recording that is
+   never stopped is completed when its context is destroyed (but errors are
+   not reported then). Copies of a context are not recorded.
+   @throws std::exception if the file couldn't be written. */
+  void StopRecording(Context<double>* context) const;
+
+  /** Returns whether the samples of `context` are being recorded. */
+  bool is_recording(const Context<double>& context) const;
+
+ private:
+  struct InputColumns {
+    InputPortIndex port_index;
+    int num_columns{};
+    // Null for vector-valued ports.
+    Flattener flatten;
+  };
+
+  EventStatus RecordSample(const Context<double>& context) const;
+
+  const int chunk_size_;
+  std::vector<std::string> column_names_{"time"};
+  std::vector<InputColumns> inputs_;
+  CacheIndex recording_cache_index_{};
+};
+
+/**
+ Reads a file written by TrajectoryRecorder, fully or in part.
+
+ The file starts with the 8 characters `DRAKETR1`, the number of columns (a
+ uint32) and the name of each column (a uint32 length, then its characters),
+ followed by a sequence of chunks. Each chunk is its number of rows (a
+ uint32), then for each column the size in bytes (a uint64) of that column's
+ compressed values. The values are doubles, in native byte order, whose bytes
+ are first "shuffled" (all of the first bytes of the values, then all of the
+ second bytes, etc.), which helps compression, and then compressed with zlib.
+ The reader only decompresses the chunks and columns that it is asked for. */
+class TrajectoryRecordingReader {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TrajectoryRecordingReader)
+
+  /** Opens the file `filename` and reads its schema and chunk index.
+   @throws std::exception if the file can't be read or is not well-formed. */
+  explicit TrajectoryRecordingReader(const std::string& filename);
+
+  /** Returns the names of the recorded columns, starting with `time`. */
+  const std::vector<std::string>& column_names() const {
+    return column_names_;
+  }
+
+  /** Returns the number of recorded samples. */
+  int64_t num_rows() const { return num_rows_; }
+
+  /** Reads `num_rows` samples (or all of the remaining samples, if nullopt),
+   starting at `first_row`, of the named `columns`. The result has one row
+   per sample and one column per entry of `columns`.
+   @throws std::exception if a column name is unknown, the rows are out of
+   range, or the file is not well-formed. */
+  MatrixX<double> Read(const std::vector<std::string>& columns,
+                       int64_t first_row = 0,
+                       std::optional<int64_t> num_rows = std::nullopt);
+
+ private:
+  struct Chunk {
+    int64_t first_row{};
+    int num_rows{};
+    // The file offset and size of the compressed values of each column.
+    std::vector<int64_t> offsets;
+    std::vector<int64_t> sizes;
+  };
+
+  const std::string filename_;
+  std::ifstream file_;
+  std::vector<std::string> column_names_;
+  std::vector<Chunk> chunks_;
+  int64_t num_rows_{};
+};
+
+}  // namespace systems
+}  // namespace drake
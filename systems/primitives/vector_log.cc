@@ -1,7 +1,10 @@
 #include "drake/systems/primitives/vector_log.h"
 
+#include <utility>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
 
 namespace drake {
 namespace systems {
@@ -23,29 +26,92 @@ void VectorLog<T>::Reserve(int64_t capacity) {
   DRAKE_ASSERT_VOID(CheckInvariants());
 }
 
+template <typename T>
+void VectorLog<T>::SetMaxNumSamples(std::optional<int64_t> max_num_samples) {
+  DRAKE_THROW_UNLESS(!max_num_samples.has_value() || *max_num_samples > 0);
+  DRAKE_ASSERT_VOID(CheckInvariants());
+  max_num_samples_ = max_num_samples;
+  if (max_num_samples_.has_value()) {
+    // Discard the oldest samples beyond the bound.
+    if (num_samples_ > *max_num_samples_) {
+      start_ += num_samples_ - *max_num_samples_;
+      num_samples_ = *max_num_samples_;
+    }
+    FlushDiscardedSamples();
+    const int64_t capacity = 2 * *max_num_samples_;
+    sample_times_.conservativeResize(capacity);
+    data_.conservativeResize(Eigen::NoChange, capacity);
+  } else {
+    FlushDiscardedSamples();
+  }
+  DRAKE_ASSERT_VOID(CheckInvariants());
+}
+
+template <typename T>
+void VectorLog<T>::SetDiscardedSamplesCallback(
+    DiscardedSamplesCallback callback) {
+  FlushDiscardedSamples();
+  discarded_samples_callback_ = std::move(callback);
+}
+
 template <typename T>
 void VectorLog<T>::AddData(const T& time, const VectorX<T>& sample) {
   DRAKE_ASSERT_VOID(CheckInvariants());
+  if (max_num_samples_.has_value()) {
+    // A full bounded log discards its oldest sample. Once the storage is used
+    // up, the retained samples are moved back to its front.
+    if (num_samples_ == *max_num_samples_) {
+      ++start_;
+      --num_samples_;
+    }
+    if (start_ + num_samples_ + 1 > sample_times_.size()) {
+      FlushDiscardedSamples();
+    }
+  }
   // If the new size exceeds the current allocation, then do a conservative
   // resize (ouch!). Clients can avoid this if necessary by calling Reserve()
   // ahead of time.
-  if (num_samples_ + 1 > sample_times_.size()) {
+  if (start_ + num_samples_ + 1 > sample_times_.size()) {
     Reserve(sample_times_.size() * 2);
   }
 
-  // Record time and input to the num_samples position.
-  sample_times_(int64_t{num_samples_}) = time;
-  data_.col(int64_t{num_samples_}) = sample;
+  // Record time and input to the next position.
+  const int64_t index = start_ + num_samples_;
+  sample_times_(index) = time;
+  data_.col(index) = sample;
 
   // Update the count.
   ++num_samples_;
   DRAKE_ASSERT_VOID(CheckInvariants());
 }
 
+template <typename T>
+void VectorLog<T>::FlushDiscardedSamples() {
+  // Pass the discarded samples (which precede start_) to the callback, and
+  // move the retained samples to the front of the storage.
+  if (start_ == 0) {
+    return;
+  }
+  if (discarded_samples_callback_ != nullptr) {
+    discarded_samples_callback_(sample_times_.head(start_),
+                                data_.leftCols(start_));
+  }
+  // The source and destination ranges may overlap, so copy column by column,
+  // front to back.
+  for (int64_t i = 0; i < num_samples_; ++i) {
+    sample_times_(i) = sample_times_(start_ + i);
+    data_.col(i) = data_.col(start_ + i);
+  }
+  start_ = 0;
+}
+
 template <typename T>
 void VectorLog<T>::CheckInvariants() const {
   DRAKE_DEMAND(sample_times_.size() == data_.cols());
-  DRAKE_DEMAND(num_samples_ <= sample_times_.size());
+  DRAKE_DEMAND(start_ >= 0 && num_samples_ >= 0);
+  DRAKE_DEMAND(start_ + num_samples_ <= sample_times_.size());
+  DRAKE_DEMAND(!max_num_samples_.has_value() ||
+               num_samples_ <= *max_num_samples_);
 }
 
 }  // namespace systems
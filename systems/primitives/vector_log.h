@@ -1,5 +1,8 @@
 #pragma once
 
+#include <functional>
+#include <optional>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/reset_after_move.h"
@@ -17,6 +20,12 @@ namespace systems {
  double in size. If avoiding memory allocation during some performance-critical
  phase is desired, clients can call Reserve() to pre-allocate log storage.
 
+ Alternatively, the log can be bounded with SetMaxNumSamples(), in which case
+ it only retains the most recent samples, in fixed storage (of twice the
+ bound), much like a ring buffer. The discarded samples can be passed to a
+ callback (see SetDiscardedSamplesCallback()), e.g., to stream them to a file
+ with VectorLogFileWriter.
+
  This object imposes no constraints on the stored data. For example, times
  passed to AddData() need not be increasing in order of insertion, values are
  allowed to be infinite, NaN, etc.
@@ -33,6 +42,12 @@ class VectorLog {
    */
   static constexpr int64_t kDefaultCapacity = 1000;
 
+  /** The signature of a function that receives the samples discarded by a
+   bounded log. The i'th column of `data` was sampled at `times[i]`. */
+  using DiscardedSamplesCallback =
+      std::function<void(const Eigen::Ref<const VectorX<T>>& times,
+                         const Eigen::Ref<const MatrixX<T>>& data)>;
+
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(VectorLog)
 
   /** Constructs the vector log.
@@ -50,7 +65,8 @@ class VectorLog {
   // part of the sample_times_ vector contains meaningful data.
   /** Accesses the logged time stamps. */
   Eigen::VectorBlock<const VectorX<T>> sample_times() const {
-    return const_cast<const VectorX<T>&>(sample_times_).head(num_samples_);
+    return const_cast<const VectorX<T>&>(sample_times_)
+        .segment(start_, num_samples_);
   }
 
   /** Accesses the logged data.
@@ -61,7 +77,7 @@ class VectorLog {
   Eigen::Block<const MatrixX<T>, Eigen::Dynamic, Eigen::Dynamic,
                true /* InnerPanel */>
   data() const {
-    return data_.leftCols(num_samples_);
+    return data_.middleCols(start_, num_samples_);
   }
 
   /**
@@ -70,9 +86,43 @@ class VectorLog {
    */
   void Reserve(int64_t capacity);
 
+  /**
+   Bounds the log to the most recent `max_num_samples` samples, or removes the
+   bound when `max_num_samples` is nullopt. Once a bounded log is full, adding
+   a sample discards the oldest one. The storage of a bounded log is fixed to
+   twice the bound, so that discarding samples only needs to move the retained
+   samples (to the front of the storage) once every `max_num_samples` or so
+   additions; the cost per sample is constant.
+
+   If the log holds more than `max_num_samples` samples, the oldest ones are
+   discarded right away.
+   @throws std::exception if `max_num_samples` is not positive.
+   */
+  void SetMaxNumSamples(std::optional<int64_t> max_num_samples);
+
+  /** Returns the bound set by SetMaxNumSamples(), if any. */
+  std::optional<int64_t> max_num_samples() const { return max_num_samples_; }
+
+  /**
+   Sets the function that receives the samples discarded by a bounded log (see
+   SetMaxNumSamples()), oldest first, or clears it when `callback` is null.
+   The discarded samples are delivered in batches of up to about
+   `max_num_samples`, when the retained samples are moved; any samples that
+   were discarded but not yet delivered are delivered by
+   FlushDiscardedSamples(), Clear(), SetMaxNumSamples(), and this method. The
+   samples that are still retained are never delivered; to also save those,
+   pass sample_times() and data() to the same function.
+   */
+  void SetDiscardedSamplesCallback(DiscardedSamplesCallback callback);
+
+  /** Delivers the samples that were discarded, but not yet delivered, to the
+   callback set by SetDiscardedSamplesCallback() (if any). */
+  void FlushDiscardedSamples();
+
   /** Clears the logged data. */
   void Clear() {
     DRAKE_ASSERT_VOID(CheckInvariants());
+    FlushDiscardedSamples();
     // Resetting num_samples_ is sufficient to have all future writes and
     // reads re-initialized to the beginning of the data.
     num_samples_ = 0;
@@ -91,9 +141,15 @@ class VectorLog {
  private:
   void CheckInvariants() const;
 
+  // The retained samples are the columns [start_, start_ + num_samples_) of
+  // the storage. The columns before start_ have been discarded (by a bounded
+  // log), but not yet delivered to discarded_samples_callback_.
+  reset_after_move<int64_t> start_{0};
   reset_after_move<int64_t> num_samples_{0};
   VectorX<T> sample_times_;
   MatrixX<T> data_;
+  std::optional<int64_t> max_num_samples_;
+  DiscardedSamplesCallback discarded_samples_callback_;
 };
 }  // namespace systems
 }  // namespace drake
@@ -0,0 +1,183 @@
+#include "drake/systems/primitives/vector_log_file_writer.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+constexpr char kMagic[] = "DRAKEVL1";
+constexpr int kMagicSize = sizeof(kMagic) - 1;
+
+template <typename Scalar>
+void WriteRaw(std::ofstream* file, const Scalar* values, int64_t count) {
+  file->write(reinterpret_cast<const char*>(values), sizeof(Scalar) * count);
+}
+
+template <typename Scalar>
+void ReadRaw(std::ifstream* file, Scalar* values, int64_t count) {
+  file->read(reinterpret_cast<char*>(values), sizeof(Scalar) * count);
+}
+
+}  // namespace
+
+VectorLogFileWriter::VectorLogFileWriter(const std::string& filename,
+                                         int input_size)
+    : filename_(filename),
+      input_size_(input_size),
+      file_(filename, std::ios::binary | std::ios::trunc) {
+  DRAKE_THROW_UNLESS(input_size >= 0);
+  if (!file_) {
+    throw std::runtime_error(fmt::format(
+        "VectorLogFileWriter: could not open '{}' for writing", filename));
+  }
+  const int64_t size = input_size;
+  file_.write(kMagic, kMagicSize);
+  WriteRaw(&file_, &size, 1);
+  writer_thread_ = std::thread([this]() { WriteChunks(); });
+}
+
+VectorLogFileWriter::~VectorLogFileWriter() {
+  try {
+    Close();
+  } catch (const std::exception&) {
+    // Destructors must not throw.
+  }
+}
+
+void VectorLogFileWriter::Write(const Eigen::Ref<const VectorX<double>>& times,
+                                const Eigen::Ref<const MatrixX<double>>& data) {
+  DRAKE_THROW_UNLESS(data.rows() == input_size_);
+  DRAKE_THROW_UNLESS(data.cols() == times.size());
+  if (times.size() == 0) {
+    return;
+  }
+  // Copy (and transpose) the samples outside of the lock.
+  Chunk chunk{times, data};
+  std::lock_guard<std::mutex> lock(mutex_);
+  DRAKE_THROW_UNLESS(!closing_);
+  ThrowIfFailed();
+  chunks_.push_back(std::move(chunk));
+  wake_writer_.notify_one();
+}
+
+void VectorLogFileWriter::Flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  chunks_written_.wait(lock, [this]() {
+    return (chunks_.empty() && !writing_) || failed_;
+  });
+  ThrowIfFailed();
+}
+
+void VectorLogFileWriter::Close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closing_) {
+      return;
+    }
+    closing_ = true;
+    wake_writer_.notify_one();
+  }
+  // The background thread writes all of the queued chunks before it exits.
+  writer_thread_.join();
+  file_.close();
+  std::lock_guard<std::mutex> lock(mutex_);
+  ThrowIfFailed();
+}
+
+void VectorLogFileWriter::ThrowIfFailed() const {
+  if (failed_) {
+    throw std::runtime_error(fmt::format(
+        "VectorLogFileWriter: could not write to '{}'", filename_));
+  }
+}
+
+void VectorLogFileWriter::WriteChunks() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    wake_writer_.wait(lock, [this]() { return !chunks_.empty() || closing_; });
+    if (chunks_.empty()) {
+      // closing_ is set, and there is nothing left to write.
+      break;
+    }
+    Chunk chunk = std::move(chunks_.front());
+    chunks_.pop_front();
+    writing_ = true;
+    lock.unlock();
+
+    const int64_t num_samples = chunk.times.size();
+    WriteRaw(&file_, &num_samples, 1);
+    WriteRaw(&file_, chunk.times.data(), num_samples);
+    WriteRaw(&file_, chunk.data.data(), chunk.data.size());
+    file_.flush();
+    const bool ok = static_cast<bool>(file_);
+
+    lock.lock();
+    writing_ = false;
+    if (!ok) {
+      failed_ = true;
+      chunks_.clear();
+    }
+    chunks_written_.notify_all();
+  }
+  chunks_written_.notify_all();
+}
+
+VectorLog<double> ReadVectorLogFile(const std::string& filename) {
+  std::ifstream file(filename, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error(fmt::format(
+        "ReadVectorLogFile: could not open '{}' for reading", filename));
+  }
+  auto fail = [&filename]() {
+    throw std::runtime_error(fmt::format(
+        "ReadVectorLogFile: '{}' is not a well-formed vector log file",
+        filename));
+  };
+  char magic[kMagicSize];
+  int64_t input_size{};
+  file.read(magic, kMagicSize);
+  ReadRaw(&file, &input_size, 1);
+  if (!file || std::memcmp(magic, kMagic, kMagicSize) != 0 || input_size < 0) {
+    fail();
+  }
+
+  VectorLog<double> log(static_cast<int>(input_size));
+  VectorX<double> times;
+  VectorX<double> sample(input_size);
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> data;
+  int64_t num_samples{};
+  while (ReadRaw(&file, &num_samples, 1), file) {
+    if (num_samples <= 0) {
+      fail();
+    }
+    times.resize(num_samples);
+    data.resize(input_size, num_samples);
+    ReadRaw(&file, times.data(), num_samples);
+    ReadRaw(&file, data.data(), data.size());
+    if (!file) {
+      fail();
+    }
+    log.Reserve(log.num_samples() + num_samples);
+    for (int64_t i = 0; i < num_samples; ++i) {
+      sample = data.col(i);
+      log.AddData(times(i), sample);
+    }
+  }
+  // The only way to stop reading chunks is to reach the end of the file,
+  // exactly at a chunk boundary.
+  if (!file.eof() || file.gcount() != 0) {
+    fail();
+  }
+  return log;
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/systems/primitives/vector_log.h"
+
+namespace drake {
+namespace systems {
+
+/**
+ Streams chunks of logged vector samples to a file, on a background thread, so
+ that long-running logs need not be kept in memory. Typically, the chunks are
+ the samples discarded by a bounded VectorLog: @code
+ VectorLogFileWriter writer("/tmp/log.bin", log.get_input_size());
+ log.SetMaxNumSamples(10000);
+ log.SetDiscardedSamplesCallback(
+     [&writer](const auto& times, const auto& data) {
+       writer.Write(times, data);
+     });
+ // ... simulate ...
+ log.FlushDiscardedSamples();
+ writer.Write(log.sample_times(), log.data());  // The retained samples.
+ writer.Close();
+ @endcode
+
+ The file is a columnar binary file, in the native byte order: a header of
+ the 8 characters `DRAKEVL1` and the input size (an int64), followed by the
+ chunks in the order they were written. Each chunk is its number of samples
+ `n` (an int64), then its `n` times, then the `n` values of each element of
+ the input vector in turn (all as doubles). ReadVectorLogFile() reads such a
+ file back.
+
+ Write() copies the chunk and returns right away; the file is written on the
+ background thread. This class is not thread-safe (other than with respect to
+ its own background thread). */
+class VectorLogFileWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(VectorLogFileWriter)
+
+  /** Creates (or truncates) the file `filename`, for samples of `input_size`
+   elements.
+   @throws std::exception if the file can't be opened. */
+  VectorLogFileWriter(const std::string& filename, int input_size);
+
+  /** Closes the file; see Close(). Errors are not reported. */
+  ~VectorLogFileWriter();
+
+  /** Queues the samples in `data`, sampled at `times`, to be written.
+   @throws std::exception if `data` doesn't have `input_size` rows or one
+   column per time, if the writer was closed, or if a previous chunk couldn't
+   be written. */
+  void Write(const Eigen::Ref<const VectorX<double>>& times,
+             const Eigen::Ref<const MatrixX<double>>& data);
+
+  /** Blocks until the queued chunks have been written and flushed.
+   @throws std::exception if a chunk couldn't be written. */
+  void Flush();
+
+  /** Flushes (see Flush()), then closes the file and stops the background
+   thread. Has no effect if the writer was already closed. */
+  void Close();
+
+ private:
+  using RowMajorMatrixX =
+      Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  struct Chunk {
+    VectorX<double> times;
+    // One row per element of the input vector, so that each is contiguous.
+    RowMajorMatrixX data;
+  };
+
+  void ThrowIfFailed() const;
+  void WriteChunks();
+
+  const std::string filename_;
+  const int input_size_;
+  std::ofstream file_;
+
+  // All of the fields below are guarded by mutex_.
+  std::mutex mutex_;
+  std::condition_variable wake_writer_;
+  std::condition_variable chunks_written_;
+  std::deque<Chunk> chunks_;
+  // Whether the background thread is writing a chunk that was already popped
+  // from chunks_.
+  bool writing_{false};
+  bool closing_{false};
+  bool failed_{false};
+
+  std::thread writer_thread_;
+};
+
+/** Reads all of the samples in a file written by VectorLogFileWriter.
+ @throws std::exception if the file can't be read or is not well-formed. */
+VectorLog<double> ReadVectorLogFile(const std::string& filename);
+
+}  // namespace systems
+}  // namespace drake
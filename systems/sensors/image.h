@@ -1,11 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <mutex>
 #include <utility>
 #include <vector>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/never_destroyed.h"
 #include "drake/common/reset_after_move.h"
 #include "drake/systems/sensors/pixel_types.h"
 
@@ -45,12 +49,110 @@ using ImageGrey8U = Image<PixelType::kGrey8U>;
 /// symbolic::Expression.
 using ImageExpr = Image<PixelType::kExpr>;
 
+namespace internal {
+
+/* An opt-in, process-wide cache of released pixel buffers with channel type T.
+ When it is enabled (see set_max_bytes()), the buffers of destroyed images are
+ retained, up to the given total number of bytes, and handed to subsequently
+ constructed images of exactly the same size instead of freshly allocating
+ them. This benefits applications that repeatedly create and discard large
+ images of the same size. The pool is disabled by default; all methods are
+ thread-safe.  */
+template <typename T>
+class ImageBufferPool {
+ public:
+  using Buffer = std::vector<T>;
+
+  /* Sets the total size (in bytes) of the buffers that the pool may retain;
+   zero (the default) disables the pool. Lowering the limit releases retained
+   buffers as needed.  */
+  static void set_max_bytes(size_t max_bytes) {
+    Storage& storage = GetStorage();
+    std::lock_guard<std::mutex> lock(storage.mutex);
+    storage.max_bytes = max_bytes;
+    while (storage.num_bytes > max_bytes) {
+      storage.num_bytes -= NumBytes(storage.buffers.front());
+      storage.buffers.erase(storage.buffers.begin());
+    }
+  }
+
+  /* Returns a buffer with `size` elements, each set to `value`.  */
+  static Buffer Acquire(int size, const T& value) {
+    Storage& storage = GetStorage();
+    if (storage.max_bytes > 0) {
+      std::lock_guard<std::mutex> lock(storage.mutex);
+      // Prefer the most recently released buffer, whose memory is most likely
+      // to be cache-resident.
+      std::vector<Buffer>& buffers = storage.buffers;
+      for (int i = static_cast<int>(buffers.size()) - 1; i >= 0; --i) {
+        if (static_cast<int>(buffers[i].size()) == size) {
+          Buffer buffer = std::move(buffers[i]);
+          buffers.erase(buffers.begin() + i);
+          storage.num_bytes -= NumBytes(buffer);
+          std::fill(buffer.begin(), buffer.end(), value);
+          return buffer;
+        }
+      }
+    }
+    return Buffer(size, value);
+  }
+
+  /* Offers the given `buffer` to the pool, which retains it if the pool is
+   enabled and has room for it.  */
+  static void Release(Buffer&& buffer) {
+    Storage& storage = GetStorage();
+    if (storage.max_bytes == 0 || buffer.empty()) return;
+    std::lock_guard<std::mutex> lock(storage.mutex);
+    const size_t num_bytes = NumBytes(buffer);
+    if (storage.num_bytes + num_bytes <= storage.max_bytes) {
+      storage.num_bytes += num_bytes;
+      storage.buffers.push_back(std::move(buffer));
+    }
+  }
+
+  /* Reports the number of buffers currently retained by the pool.  */
+  static int num_pooled() {
+    Storage& storage = GetStorage();
+    std::lock_guard<std::mutex> lock(storage.mutex);
+    return static_cast<int>(storage.buffers.size());
+  }
+
+  /* Reports the total size (in bytes) of the buffers currently retained.  */
+  static size_t num_pooled_bytes() {
+    Storage& storage = GetStorage();
+    std::lock_guard<std::mutex> lock(storage.mutex);
+    return storage.num_bytes;
+  }
+
+ private:
+  struct Storage {
+    std::mutex mutex;
+    // Checked without the lock so that a disabled pool costs nothing.
+    std::atomic<size_t> max_bytes{0};
+    size_t num_bytes{0};
+    std::vector<Buffer> buffers;
+  };
+
+  static size_t NumBytes(const Buffer& buffer) {
+    return buffer.size() * sizeof(T);
+  }
+
+  static Storage& GetStorage() {
+    static never_destroyed<Storage> storage;
+    return storage.access();
+  }
+};
+
+}  // namespace internal
+
 /// Simple data format for Image. For the complex calculation with the image,
 /// consider converting this to other libaries' Matrix data format, i.e.,
 /// MatrixX in Eigen, Mat in OpenCV, and so on.
 ///
 /// The origin of image coordinate system is on the left-upper corner.
 ///
+/// An Image has value semantics: copies own their pixels.
+///
 /// @tparam kPixelType The pixel type enum that denotes the pixel format and the
 /// data type of a channel.
 template <PixelType kPixelType>
@@ -93,7 +195,8 @@ class Image {
   /// @param initial_value A value set to all the channels in all the pixels
   Image(int width, int height, T initial_value)
       : width_(width), height_(height),
-        data_(width * height * kNumChannels, initial_value) {
+        data_(BufferPool::Acquire(width * height * kNumChannels,
+                                  initial_value)) {
     DRAKE_ASSERT(width > 0);
     DRAKE_ASSERT(height > 0);
   }
@@ -101,6 +204,8 @@ class Image {
   /// Constructs a zero-sized image.
   Image() = default;
 
+  ~Image() { BufferPool::Release(std::move(data_)); }
+
   /// Returns the size of width for the image
   int width() const { return width_; }
 
@@ -150,6 +255,8 @@ class Image {
   }
 
  private:
+  using BufferPool = internal::ImageBufferPool<T>;
+
   reset_after_move<int> width_;
   reset_after_move<int> height_;
   std::vector<T> data_;
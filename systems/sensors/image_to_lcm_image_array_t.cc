@@ -1,10 +1,13 @@
 #include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
 #include <stdexcept>
+#include <vector>
 
+#include <png.h>
 #include <zlib.h>
 
 #include "drake/lcmt_image.hpp"
+#include "drake/common/drake_assert.h"
 #include "drake/lcmt_image_array.hpp"
 #include "drake/systems/sensors/lcm_image_traits.h"
 
@@ -17,9 +20,11 @@ namespace {
 
 const int64_t kSecToMillisec = 1000000;
 
+using CompressionMethod = ImageToLcmImageArrayT::CompressionMethod;
+
 // Overwrites the msg's compression_method, size, and data.
 template <PixelType kPixelType>
-void Compress(const Image<kPixelType>& image, lcmt_image* msg) {
+void CompressZlib(const Image<kPixelType>& image, lcmt_image* msg) {
   msg->compression_method = lcmt_image::COMPRESSION_METHOD_ZLIB;
 
   const int source_size = image.width() * image.height() * image.kPixelSize;
@@ -40,6 +45,75 @@ void Compress(const Image<kPixelType>& image, lcmt_image* msg) {
   msg->size = dest_size;
 }
 
+void AppendPngBytes(png_structp png_ptr, png_bytep data, size_t length) {
+  DRAKE_DEMAND(png_ptr != nullptr);
+  std::vector<uint8_t>* dest =
+      reinterpret_cast<std::vector<uint8_t>*>(png_get_io_ptr(png_ptr));
+  DRAKE_DEMAND(dest != nullptr);
+  dest->insert(dest->end(), data, data + length);
+}
+
+// Returns the PNG color type for images with the given number of channels.
+int GetPngColorType(int num_channels) {
+  switch (num_channels) {
+    case 1: return PNG_COLOR_TYPE_GRAY;
+    case 2: return PNG_COLOR_TYPE_GRAY_ALPHA;
+    case 3: return PNG_COLOR_TYPE_RGB;
+    case 4: return PNG_COLOR_TYPE_RGBA;
+  }
+  DRAKE_UNREACHABLE();
+}
+
+// Overwrites the msg's compression_method, size, and data. The channels are
+// stored in the image's own order (e.g., BGR stays BGR), which is what
+// LcmImageArrayToImages expects when it decodes them.
+template <PixelType kPixelType>
+void CompressPng(const Image<kPixelType>& image, lcmt_image* msg) {
+  using ChannelType = typename ImageTraits<kPixelType>::ChannelType;
+  constexpr int kBitDepth = sizeof(ChannelType) * 8;
+  if constexpr (kBitDepth > 16) {
+    CompressZlib(image, msg);
+  } else {
+    msg->compression_method = lcmt_image::COMPRESSION_METHOD_PNG;
+    std::vector<uint8_t>& dest = msg->data;
+    dest.clear();
+
+    png_structp png_ptr = png_create_write_struct(
+        PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+    DRAKE_DEMAND(png_ptr != nullptr);
+    png_infop info_ptr = png_create_info_struct(png_ptr);
+    DRAKE_DEMAND(info_ptr != nullptr);
+
+    std::vector<png_bytep> row_pointers(image.height());
+    for (int i = 0; i < image.height(); ++i) {
+      row_pointers[i] = reinterpret_cast<png_bytep>(
+          const_cast<ChannelType*>(image.at(0, i)));
+    }
+
+    bool success = false;
+    if (setjmp(png_jmpbuf(png_ptr)) == 0) {
+      png_set_write_fn(png_ptr, &dest, AppendPngBytes, nullptr);
+      png_set_IHDR(png_ptr, info_ptr, image.width(), image.height(),
+                   kBitDepth, GetPngColorType(image.kNumChannels),
+                   PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+                   PNG_FILTER_TYPE_DEFAULT);
+      png_set_compression_level(png_ptr, Z_BEST_SPEED);
+      png_write_info(png_ptr, info_ptr);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+      if constexpr (kBitDepth > 8) {
+        png_set_swap(png_ptr);
+      }
+#endif
+      png_write_image(png_ptr, row_pointers.data());
+      png_write_end(png_ptr, nullptr);
+      success = true;
+    }
+    png_destroy_write_struct(&png_ptr, &info_ptr);
+    DRAKE_DEMAND(success);
+    msg->size = dest.size();
+  }
+}
+
 // Overwrites the msg's compression_method, size, and data.
 template <PixelType kPixelType>
 void Pack(const Image<kPixelType>& image, lcmt_image* msg) {
@@ -54,7 +128,7 @@ void Pack(const Image<kPixelType>& image, lcmt_image* msg) {
 // Overwrites everything in msg except its header.
 template <PixelType kPixelType>
 void PackImageToLcmImageT(const Image<kPixelType>& image, lcmt_image* msg,
-                          bool do_compress) {
+                          CompressionMethod compression_method) {
   msg->width = image.width();
   msg->height = image.height();
   msg->row_stride = image.kPixelSize * msg->width;
@@ -63,64 +137,71 @@ void PackImageToLcmImageT(const Image<kPixelType>& image, lcmt_image* msg,
       LcmPixelTraits<ImageTraits<kPixelType>::kPixelFormat>::kPixelFormat;
   msg->channel_type = LcmImageTraits<kPixelType>::kChannelType;
 
-  if (do_compress) {
-    Compress(image, msg);
-  } else {
-    Pack(image, msg);
+  switch (compression_method) {
+    case CompressionMethod::kNone:
+      Pack(image, msg);
+      return;
+    case CompressionMethod::kZlib:
+      CompressZlib(image, msg);
+      return;
+    case CompressionMethod::kPng:
+      CompressPng(image, msg);
+      return;
   }
+  DRAKE_UNREACHABLE();
 }
 
 // Overwrites everything in msg except its header.
 void PackImageToLcmImageT(const AbstractValue& untyped_image,
                           PixelType pixel_type, lcmt_image* msg,
-                          bool do_compress) {
+                          CompressionMethod compression_method) {
   switch (pixel_type) {
     case PixelType::kRgb8U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kRgb8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression_method);
       break;
     }
     case PixelType::kBgr8U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kBgr8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression_method);
       break;
     }
     case PixelType::kRgba8U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kRgba8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression_method);
       break;
     }
     case PixelType::kBgra8U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kBgra8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression_method);
       break;
     }
     case PixelType::kGrey8U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kGrey8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression_method);
       break;
     }
     case PixelType::kDepth16U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kDepth16U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression_method);
       break;
     }
     case PixelType::kDepth32F: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kDepth32F>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression_method);
       break;
     }
     case PixelType::kLabel16I: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kLabel16I>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression_method);
       break;
     }
     case PixelType::kExpr:
@@ -131,7 +212,8 @@ void PackImageToLcmImageT(const AbstractValue& untyped_image,
 }  // anonymous namespace
 
 ImageToLcmImageArrayT::ImageToLcmImageArrayT(bool do_compress)
-    : do_compress_(do_compress) {
+    : compression_method_(do_compress ? CompressionMethod::kZlib
+                                      : CompressionMethod::kNone) {
   image_array_t_msg_output_port_index_ = DeclareAbstractOutputPort(
       kUseDefaultName, &ImageToLcmImageArrayT::CalcImageArray)
           .get_index();
@@ -141,7 +223,8 @@ ImageToLcmImageArrayT::ImageToLcmImageArrayT(const string& color_frame_name,
                                              const string& depth_frame_name,
                                              const string& label_frame_name,
                                              bool do_compress)
-    : do_compress_(do_compress) {
+    : compression_method_(do_compress ? CompressionMethod::kZlib
+                                      : CompressionMethod::kNone) {
   color_image_input_port_index_ =
       DeclareImageInputPort<PixelType::kRgba8U>(color_frame_name).get_index();
   depth_image_input_port_index_ =
@@ -193,17 +276,20 @@ void ImageToLcmImageArrayT::CalcImageArray(
   const int num_inputs = num_input_ports();
   msg->num_images = num_inputs;
   msg->images.resize(num_inputs);
+  // The inputs are evaluated here, on the calling thread; only the packing,
+  // which touches nothing but its own image and message, is parallelized.
+  std::vector<const AbstractValue*> values(num_inputs);
   for (int i = 0; i < num_inputs; i++) {
-    const std::string& name = this->get_input_port(i).get_name();
-    const PixelType& type = input_port_pixel_type_[i];
-    const auto& value = this->get_input_port(i).
-        template Eval<AbstractValue>(context);
+    values[i] = &this->get_input_port(i).template Eval<AbstractValue>(context);
+  }
+  StaticParallelForIndexLoop(parallelism_, 0, num_inputs, [&](int, int i) {
     lcmt_image& packed = msg->images.at(i);
     packed.header = {};
     packed.header.utime = utime;
-    packed.header.frame_name = name;
-    PackImageToLcmImageT(value, type, &packed, do_compress_);
-  }
+    packed.header.frame_name = this->get_input_port(i).get_name();
+    PackImageToLcmImageT(*values[i], input_port_pixel_type_[i], &packed,
+                         compression_method_);
+  });
 }
 
 }  // namespace sensors
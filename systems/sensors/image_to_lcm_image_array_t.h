@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/lcmt_image_array.hpp"
 #include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/sensors/image.h"
@@ -36,10 +37,26 @@ namespace sensors {
 /// @endsystem
 ///
 /// @note The output message's header field `seq` is always zero.
+///
+/// Images are packed (and compressed, if requested) one after another on the
+/// calling thread by default; see set_parallelism() to pack them concurrently.
 class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageToLcmImageArrayT)
 
+  /// The compression applied to the images of the output message. Both
+  /// methods are lossless and are understood by LcmImageArrayToImages.
+  enum class CompressionMethod {
+    /// The images are copied verbatim.
+    kNone,
+    /// The images are compressed with zlib, tuned for speed.
+    kZlib,
+    /// The images are encoded as PNG, tuned for speed. PNG does not support
+    /// 32-bit channels, so images of such pixel types (e.g., ImageDepth32F)
+    /// are compressed with zlib instead.
+    kPng,
+  };
+
   /// Constructs an empty system with no input ports.
   /// After construction, use DeclareImageInputPort() to add inputs.
   explicit ImageToLcmImageArrayT(bool do_compress = false);
@@ -73,6 +90,22 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
   /// `Value<lcmt_image_array>`.
   const OutputPort<double>& image_array_t_msg_output_port() const;
 
+  /// Sets the compression applied to the images. The `do_compress`
+  /// constructor argument selects kZlib (when true) or kNone (when false).
+  void set_compression_method(CompressionMethod method) {
+    compression_method_ = method;
+  }
+
+  /// Returns the compression applied to the images.
+  CompressionMethod compression_method() const { return compression_method_; }
+
+  /// Sets the parallelism with which the images are packed and compressed.
+  /// The output message does not depend on it. The default is no parallelism.
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  /// Returns the parallelism with which the images are packed and compressed.
+  Parallelism parallelism() const { return parallelism_; }
+
   template <PixelType kPixelType>
   const InputPort<double>& DeclareImageInputPort(const std::string& name) {
     input_port_pixel_type_.push_back(kPixelType);
@@ -90,7 +123,8 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
   int image_array_t_msg_output_port_index_{-1};
 
   std::vector<PixelType> input_port_pixel_type_{};
-  const bool do_compress_;
+  CompressionMethod compression_method_{CompressionMethod::kNone};
+  Parallelism parallelism_;
 };
 
 }  // namespace sensors
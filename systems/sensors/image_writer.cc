@@ -2,8 +2,20 @@
 
 #include <unistd.h>
 
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <mutex>
 #include <regex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -13,16 +25,21 @@
 #include <vtkPNGWriter.h>
 #include <vtkSmartPointer.h>
 #include <vtkTIFFWriter.h>
+#include <vtkUnsignedCharArray.h>
 
 #include "drake/common/filesystem.h"
+#include "drake/common/text_logging.h"
 
 namespace drake {
 namespace systems {
 namespace sensors {
 
+// Writes `image` to `file_path` or, if `encoded` is non-null, encodes it into
+// `encoded` instead (which is only supported for images written as .png).
 template <PixelType kPixelType>
 void SaveToFileHelper(const Image<kPixelType>& image,
-                      const std::string& file_path) {
+                      const std::string& file_path,
+                      std::vector<uint8_t>* encoded = nullptr) {
   const int width = image.width();
   const int height = image.height();
   const int num_channels = Image<kPixelType>::kNumChannels;
@@ -70,11 +87,275 @@ void SaveToFileHelper(const Image<kPixelType>& image,
     }
   }
 
-  writer->SetFileName(file_path.c_str());
   writer->SetInputData(vtk_image.GetPointer());
+  if (encoded != nullptr) {
+    vtkPNGWriter* png_writer = vtkPNGWriter::SafeDownCast(writer);
+    DRAKE_DEMAND(png_writer != nullptr);
+    png_writer->WriteToMemoryOn();
+    png_writer->Write();
+    vtkUnsignedCharArray* result = png_writer->GetResult();
+    const uint8_t* data = result->GetPointer(0);
+    encoded->assign(data, data + result->GetNumberOfValues());
+    return;
+  }
+  writer->SetFileName(file_path.c_str());
   writer->Write();
 }
 
+namespace internal {
+
+// Appends files to a sequence of ustar archives ("shards"). It is safe to call
+// Append() and Close() from several threads at once.
+class ImageArchive {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageArchive)
+
+  ImageArchive(std::string prefix, int64_t max_shard_bytes)
+      : prefix_(std::move(prefix)), max_shard_bytes_(max_shard_bytes) {}
+
+  ~ImageArchive() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    CloseLocked();
+  }
+
+  // Appends a member named `name` holding `data`, first starting a new shard
+  // if there is no open one.
+  void Append(const std::string& name, const std::vector<uint8_t>& data) {
+    std::array<char, kBlockSize> header = MakeHeader(name, data.size());
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!out_.is_open()) {
+      const std::string shard_name =
+          fmt::format("{}-{:05}.tar", prefix_, next_shard_++);
+      out_.open(shard_name, std::ios::binary | std::ios::trunc);
+      if (!out_) {
+        throw std::runtime_error(fmt::format(
+            "ImageWriter: cannot open the archive '{}'", shard_name));
+      }
+      shard_bytes_ = 0;
+    }
+    const int64_t padding = (kBlockSize - data.size() % kBlockSize) %
+                            kBlockSize;
+    const std::array<char, kBlockSize> zeros{};
+    out_.write(header.data(), kBlockSize);
+    out_.write(reinterpret_cast<const char*>(data.data()), data.size());
+    out_.write(zeros.data(), padding);
+    if (!out_) {
+      throw std::runtime_error(fmt::format(
+          "ImageWriter: failed to write '{}' to the archive", name));
+    }
+    shard_bytes_ += kBlockSize + data.size() + padding;
+    if (shard_bytes_ >= max_shard_bytes_) {
+      CloseLocked();
+    }
+  }
+
+  // Completes the open shard, if any.
+  void Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    CloseLocked();
+  }
+
+ private:
+  static constexpr int kBlockSize = 512;
+
+  // Writes `value` as a NUL-terminated, zero-padded octal number filling the
+  // `width` bytes at `field`.
+  static void WriteOctal(char* field, int width, uint64_t value) {
+    std::snprintf(field, width, "%0*llo", width - 1,
+                  static_cast<unsigned long long>(value));  // NOLINT
+  }
+
+  // Returns the ustar header of a regular file named `name` of `size` bytes.
+  static std::array<char, kBlockSize> MakeHeader(const std::string& name,
+                                                 uint64_t size) {
+    // Names longer than the 100-byte name field are split at a '/' between
+    // the 155-byte prefix field and the name field.
+    std::string prefix;
+    std::string suffix = name;
+    if (name.size() > 100) {
+      const size_t split = name.rfind('/', 155);
+      if (split == std::string::npos || name.size() - split - 1 > 100) {
+        throw std::runtime_error(fmt::format(
+            "ImageWriter: the name '{}' is too long for the archive", name));
+      }
+      prefix = name.substr(0, split);
+      suffix = name.substr(split + 1);
+    }
+    std::array<char, kBlockSize> header{};
+    std::memcpy(&header[0], suffix.data(), suffix.size());
+    WriteOctal(&header[100], 8, 0644);  // mode
+    WriteOctal(&header[108], 8, 0);  // uid
+    WriteOctal(&header[116], 8, 0);  // gid
+    WriteOctal(&header[124], 12, size);
+    WriteOctal(&header[136], 12, std::time(nullptr));  // mtime
+    header[156] = '0';  // typeflag: regular file
+    std::memcpy(&header[257], "ustar", 6);  // magic
+    std::memcpy(&header[263], "00", 2);  // version
+    std::memcpy(&header[345], prefix.data(), prefix.size());
+    // The checksum is computed with its own field filled with spaces.
+    std::fill(&header[148], &header[156], ' ');
+    unsigned int checksum = 0;
+    for (char c : header) {
+      checksum += static_cast<unsigned char>(c);
+    }
+    std::snprintf(&header[148], 7, "%06o", checksum);
+    return header;
+  }
+
+  void CloseLocked() {
+    if (out_.is_open()) {
+      // An archive ends with two zero blocks.
+      const std::array<char, 2 * kBlockSize> zeros{};
+      out_.write(zeros.data(), zeros.size());
+      out_.close();
+    }
+  }
+
+  const std::string prefix_;
+  const int64_t max_shard_bytes_;
+  std::mutex mutex_;
+  std::ofstream out_;
+  int next_shard_{0};
+  int64_t shard_bytes_{0};
+};
+
+// Runs jobs on a fixed set of threads, from a queue of bounded size.
+class ImageWritePool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageWritePool)
+
+  ImageWritePool(int num_threads, int max_queue_size,
+                 ImageWriter::QueueFullPolicy policy)
+      : max_queue_size_(max_queue_size), policy_(policy) {
+    for (int i = 0; i < num_threads; ++i) {
+      threads_.emplace_back([this]() { Run(); });
+    }
+  }
+
+  // Completes the queued jobs before joining the threads.
+  ~ImageWritePool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    not_empty_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+    if (error_ != nullptr) {
+      try {
+        std::rethrow_exception(error_);
+      } catch (const std::exception& e) {
+        drake::log()->error("ImageWriter: an image was not written: {}",
+                            e.what());
+      }
+    }
+  }
+
+  // Queues `job`, or discards it if the queue is full and the policy says so.
+  void Submit(std::function<void()> job) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ThrowIfErrorLocked();
+    if (static_cast<int>(queue_.size()) >= max_queue_size_) {
+      if (policy_ == ImageWriter::QueueFullPolicy::kDrop) {
+        ++num_dropped_;
+        return;
+      }
+      not_full_.wait(lock, [this]() {
+        return static_cast<int>(queue_.size()) < max_queue_size_;
+      });
+    }
+    queue_.push_back(std::move(job));
+    lock.unlock();
+    not_empty_.notify_one();
+  }
+
+  // Waits until every queued job has run.
+  void Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() { return queue_.empty() && num_busy_ == 0; });
+    ThrowIfErrorLocked();
+  }
+
+  int64_t num_dropped() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_dropped_;
+  }
+
+ private:
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      not_empty_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        return;
+      }
+      std::function<void()> job = std::move(queue_.front());
+      queue_.pop_front();
+      ++num_busy_;
+      lock.unlock();
+      not_full_.notify_one();
+      std::exception_ptr error;
+      try {
+        job();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      lock.lock();
+      if (error != nullptr && error_ == nullptr) {
+        error_ = error;
+      }
+      --num_busy_;
+      if (queue_.empty() && num_busy_ == 0) {
+        idle_.notify_all();
+      }
+    }
+  }
+
+  // Re-throws (and forgets) the first error of a job, if any.
+  void ThrowIfErrorLocked() {
+    if (error_ != nullptr) {
+      std::exception_ptr error = error_;
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  const int max_queue_size_;
+  const ImageWriter::QueueFullPolicy policy_;
+  mutable std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::condition_variable idle_;
+  std::deque<std::function<void()>> queue_;
+  int num_busy_{0};
+  bool stopping_{false};
+  std::exception_ptr error_;
+  int64_t num_dropped_{0};
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace internal
+
+namespace {
+
+// Writes `image` to `file_name`, or appends it to `archive` (if non-null).
+template <PixelType kPixelType>
+void WriteImageTo(const Image<kPixelType>& image, const std::string& file_name,
+                  internal::ImageArchive* archive) {
+  if (archive == nullptr) {
+    SaveToFileHelper(image, file_name);
+    return;
+  }
+  std::vector<uint8_t> encoded;
+  SaveToFileHelper(image, file_name, &encoded);
+  const size_t start = file_name.find_first_not_of('/');
+  archive->Append(file_name.substr(std::min(start, file_name.size())),
+                  encoded);
+}
+
+}  // namespace
+
 void SaveToPng(const ImageRgba8U& image, const std::string& file_path) {
   SaveToFileHelper(image, file_path);
 }
@@ -109,6 +390,63 @@ ImageWriter::ImageWriter() {
   extensions_[PixelType::kGrey8U] = ".png";
 }
 
+ImageWriter::~ImageWriter() = default;
+
+void ImageWriter::SetAsyncWriting(int num_threads, int max_queue_size,
+                                  QueueFullPolicy policy) {
+  if (num_threads < 1 || max_queue_size < 1) {
+    throw std::logic_error(
+        "ImageWriter: the number of threads and the queue size must be "
+        "positive");
+  }
+  if (pool_ != nullptr) {
+    throw std::logic_error(
+        "ImageWriter: asynchronous writing is already enabled");
+  }
+  pool_ = std::make_unique<internal::ImageWritePool>(num_threads,
+                                                     max_queue_size, policy);
+}
+
+void ImageWriter::SetArchiveOutput(const std::string& archive_prefix,
+                                   int64_t max_shard_bytes) {
+  if (max_shard_bytes <= 0) {
+    throw std::logic_error(
+        "ImageWriter: the maximum archive size must be positive");
+  }
+  if (archive_ != nullptr) {
+    throw std::logic_error("ImageWriter: archive output is already enabled");
+  }
+  for (const ImagePortInfo& info : port_info_) {
+    if (extensions_.at(info.pixel_type) != ".png") {
+      throw std::logic_error(
+          "ImageWriter: only images written as .png can be archived");
+    }
+  }
+  const filesystem::path directory =
+      filesystem::path(archive_prefix).parent_path();
+  if (!directory.empty() &&
+      ValidateDirectory(directory.string()) != FolderState::kValid) {
+    throw std::logic_error(fmt::format(
+        "ImageWriter: the archive prefix '{}' implies an invalid directory",
+        archive_prefix));
+  }
+  archive_ = std::make_unique<internal::ImageArchive>(archive_prefix,
+                                                      max_shard_bytes);
+}
+
+void ImageWriter::Flush() const {
+  if (pool_ != nullptr) {
+    pool_->Flush();
+  }
+  if (archive_ != nullptr) {
+    archive_->Close();
+  }
+}
+
+int64_t ImageWriter::num_dropped_images() const {
+  return pool_ != nullptr ? pool_->num_dropped() : 0;
+}
+
 template <PixelType kPixelType>
 const InputPort<double>& ImageWriter::DeclareImageInputPort(
     std::string port_name, std::string file_name_format, double publish_period,
@@ -125,6 +463,10 @@ const InputPort<double>& ImageWriter::DeclareImageInputPort(
   if (publish_period <= 0) {
     throw std::logic_error("ImageWriter: publish period must be positive");
   }
+  if (archive_ != nullptr && extensions_[kPixelType] != ".png") {
+    throw std::logic_error(
+        "ImageWriter: only images written as .png can be archived");
+  }
 
   // Confirms the implied directory is valid.
   const std::string test_dir =
@@ -182,9 +524,20 @@ void ImageWriter::WriteImage(const Context<double>& context, int index) const {
   const auto& port = get_input_port(index);
   const ImagePortInfo& data = port_info_[index];
   const Image<kPixelType>& image = port.Eval<Image<kPixelType>>(context);
-  SaveToFileHelper(
-      image, MakeFileName(data.format, data.pixel_type, context.get_time(),
-                          port.get_name(), data.count++));
+  std::string file_name =
+      MakeFileName(data.format, data.pixel_type, context.get_time(),
+                   port.get_name(), data.count++);
+  if (pool_ == nullptr) {
+    WriteImageTo(image, file_name, archive_.get());
+    return;
+  }
+  // The job must own a copy of the image; the context's may change before
+  // the job runs.
+  auto copy = std::make_shared<const Image<kPixelType>>(image);
+  pool_->Submit([copy, file_name = std::move(file_name),
+                 archive = archive_.get()]() {
+    WriteImageTo(*copy, file_name, archive);
+  });
 }
 
 std::string ImageWriter::MakeFileName(const std::string& format,
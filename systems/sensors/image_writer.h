@@ -6,6 +6,8 @@
  invoked in any context and a System that can be connected into a diagram to
  automatically capture images during simulation at a fixed frequency.  */
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -19,6 +21,13 @@ namespace drake {
 namespace systems {
 namespace sensors {
 
+#ifndef DRAKE_DOXYGEN_CXX
+namespace internal {
+class ImageArchive;
+class ImageWritePool;
+}  // namespace internal
+#endif
+
 /** @name     Utility functions for writing common image types to disk.
 
  Given a fully-specified path to the file to write and corresponding image data,
@@ -86,14 +95,32 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path);
  that function's documentation for elaboration on how to configure image output.
  It is important to note, that every declared image input port _must_ be
  connected; otherwise, attempting to write an image from that port, will cause
- an error in the system.  */
+ an error in the system.
+
+ By default, each image is encoded and written to its own file within the
+ publish event that captures it. For long dataset-generation runs, the writing
+ can instead be handed to background threads (see SetAsyncWriting()), and the
+ images can be packed into a few large archive files rather than many small
+ ones (see SetArchiveOutput()).  */
 class ImageWriter : public LeafSystem<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageWriter)
 
+  /** What a publish event does when the queue of images awaiting a background
+   writer is full (see SetAsyncWriting()).  */
+  enum class QueueFullPolicy {
+    /** Wait until a writer takes an image off the queue; no image is lost.  */
+    kBlock,
+    /** Discard the new image (see num_dropped_images()).  */
+    kDrop,
+  };
+
   /** Constructs default instance with no image ports.  */
   ImageWriter();
 
+  /** Completes all pending writes (see Flush()) before destruction.  */
+  ~ImageWriter() override;
+
   /** Declares and configures a new image input port. A port is configured by
    providing:
 
@@ -191,8 +218,11 @@ class ImageWriter : public LeafSystem<double> {
    @throws std::exception   if (1) the directory encoded in the
                             `file_name_format` is not "valid" (see
                             documentation above for definition),
-                            (2) `publish_period` is not positive, or
-                            (3) `port_name` is used by a previous input port.
+                            (2) `publish_period` is not positive,
+                            (3) `port_name` is used by a previous input port,
+                            or (4) archive output is enabled (see
+                            SetArchiveOutput()) and the images would be
+                            written as .tiff.
   */
   template <PixelType kPixelType>
   const InputPort<double>& DeclareImageInputPort(std::string port_name,
@@ -200,6 +230,45 @@ class ImageWriter : public LeafSystem<double> {
                                                  double publish_period,
                                                  double start_time);
 
+  /** Makes the images be encoded and written by `num_threads` background
+   threads instead of within the publish events. A publish event copies its
+   image (and resolves its file name) and queues it; at most `max_queue_size`
+   images wait in the queue, and `policy` determines what a publish event
+   does when it finds the queue full. Images from a port are not necessarily
+   written in the order in which they were captured.
+
+   An error in a background write is re-thrown by the next publish event or
+   call to Flush().
+   @throws std::exception if `num_threads` or `max_queue_size` is not
+                          positive, or if asynchronous writing has already
+                          been enabled.  */
+  void SetAsyncWriting(int num_threads, int max_queue_size,
+                       QueueFullPolicy policy = QueueFullPolicy::kBlock);
+
+  /** Makes the images be appended to a sequence of uncompressed tar (ustar)
+   archives, `{archive_prefix}-00000.tar`, `{archive_prefix}-00001.tar`, etc.,
+   rather than written to individual files. Each image becomes an archive
+   member named by its port's file name format, less any leading '/'. Once an
+   archive holds at least `max_shard_bytes`, the next image starts a new one.
+   Because the images are encoded in memory, only ports whose images are
+   written as .png can be archived. An archive is complete (and readable by
+   standard tools) once Flush() has been called or this system destroyed.
+   @throws std::exception if `max_shard_bytes` is not positive, if the
+                          directory of `archive_prefix` is not valid, if any
+                          declared port writes .tiff images, or if archive
+                          output has already been enabled.  */
+  void SetArchiveOutput(const std::string& archive_prefix,
+                        int64_t max_shard_bytes);
+
+  /** Blocks until every queued image has been written, and completes the
+   current archive (if any); images captured afterwards go into a new one.
+   @throws std::exception if a background write has failed.  */
+  void Flush() const;
+
+  /** Returns the number of images discarded because the queue was full (see
+   QueueFullPolicy::kDrop).  */
+  int64_t num_dropped_images() const;
+
  private:
 #ifndef DRAKE_DOXYGEN_CXX
   // Friend for facilitating unit testing.
@@ -260,6 +329,11 @@ class ImageWriter : public LeafSystem<double> {
 
   std::unordered_map<PixelType, std::string> labels_;
   std::unordered_map<PixelType, std::string> extensions_;
+
+  // Both are null unless enabled. The pool is declared last so that it is
+  // destroyed (and its pending writes completed) first.
+  std::unique_ptr<internal::ImageArchive> archive_;
+  std::unique_ptr<internal::ImageWritePool> pool_;
 };
 
 }  // namespace sensors
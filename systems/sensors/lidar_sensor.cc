@@ -0,0 +1,78 @@
+#include "drake/systems/sensors/lidar_sensor.h"
+
+#include <cmath>
+#include <vector>
+
+#include "drake/geometry/scene_graph.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+using geometry::FrameId;
+using geometry::QueryObject;
+using geometry::RayHit;
+using geometry::SceneGraph;
+using math::RigidTransformd;
+
+LidarSensor::LidarSensor(FrameId parent_id, const RigidTransformd& X_PB,
+                         const Eigen::Matrix3Xd& beam_directions,
+                         double max_range)
+    : parent_frame_id_(parent_id),
+      X_PB_(X_PB),
+      n_Bs_(beam_directions),
+      max_range_(max_range) {
+  DRAKE_THROW_UNLESS(
+      (beam_directions.colwise().squaredNorm().array() > 0).all());
+  DRAKE_THROW_UNLESS(max_range > 0);
+  n_Bs_.colwise().normalize();
+
+  query_object_input_port_ = &this->DeclareAbstractInputPort(
+      "geometry_query", Value<QueryObject<double>>{});
+
+  depth_output_port_ = &this->DeclareVectorOutputPort(
+      "depth", num_beams(), &LidarSensor::CalcDepth);
+}
+
+Eigen::Matrix3Xd LidarSensor::MakePlanarBeamDirections(int num_beams,
+                                                       double min_angle,
+                                                       double max_angle) {
+  DRAKE_DEMAND(num_beams >= 2);
+  Eigen::Matrix3Xd n_Bs(3, num_beams);
+  for (int i = 0; i < num_beams; ++i) {
+    const double angle =
+        min_angle + (max_angle - min_angle) * i / (num_beams - 1);
+    n_Bs.col(i) << std::cos(angle), std::sin(angle), 0;
+  }
+  return n_Bs;
+}
+
+const InputPort<double>& LidarSensor::query_object_input_port() const {
+  return *query_object_input_port_;
+}
+
+const OutputPort<double>& LidarSensor::depth_output_port() const {
+  return *depth_output_port_;
+}
+
+void LidarSensor::CalcDepth(const Context<double>& context,
+                            BasicVector<double>* depth) const {
+  const auto& query_object =
+      query_object_input_port().Eval<QueryObject<double>>(context);
+  const RigidTransformd X_WB =
+      parent_frame_id_ == SceneGraph<double>::world_frame_id()
+          ? X_PB_
+          : query_object.GetPoseInWorld(parent_frame_id_) * X_PB_;
+  const Eigen::Matrix3Xd p_WBos =
+      X_WB.translation().replicate(1, num_beams());
+  const Eigen::Matrix3Xd n_Ws = X_WB.rotation().matrix() * n_Bs_;
+  const std::vector<RayHit> hits =
+      query_object.CastRays(p_WBos, n_Ws, max_range_);
+  for (int i = 0; i < num_beams(); ++i) {
+    (*depth)[i] = hits[i].is_hit() ? hits[i].distance : max_range_;
+  }
+}
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/query_object.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+/** A LIDAR-style range sensor that measures, along each of a fixed set of
+ beams, the distance to the nearest geometry with the proximity role in the
+ geometry::SceneGraph.
+
+ @system
+ name: LidarSensor
+ input_ports:
+ - geometry_query
+ output_ports:
+ - depth
+ @endsystem
+
+ This class uses the following frames:
+
+   - W - world frame
+   - P - parent frame, a frame registered with SceneGraph to which the sensor
+     is affixed.
+   - B - sensor body frame. All beams start at its origin Bo.
+
+ The beams are cast with geometry::QueryObject::CastRays() rather than by
+ rendering a depth image, so the sensor costs time proportional to the
+ number of beams (rather than to the number of pixels of an image that
+ covers them) and doesn't require a render engine. Note that it sees the
+ proximity geometries rather than the perception geometries.
+
+ The `depth` output port reports one range per beam, in meters, in the order
+ of the beams. A beam that hits nothing within the sensor's maximum range
+ reports the maximum range; a beam that starts inside a geometry reports zero.
+ The output can be connected directly to the `depth` input of a BeamModel to
+ add measurement noise.
+
+ @ingroup sensor_systems  */
+class LidarSensor final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LidarSensor)
+
+  /** Constructs a %LidarSensor.
+   @param parent_id        The id of the frame P to which the sensor is
+                           affixed.
+   @param X_PB             The pose of the sensor body frame B in P.
+   @param beam_directions  The direction of each beam, expressed in B, one
+                           per column. They need not be unit length.
+   @param max_range        The maximum range of the sensor.
+   @throws std::exception if any beam direction is zero, or if `max_range` is
+                          not positive.  */
+  LidarSensor(geometry::FrameId parent_id, const math::RigidTransformd& X_PB,
+              const Eigen::Matrix3Xd& beam_directions, double max_range);
+
+  /** Returns the directions of `num_beams` beams that are evenly spaced in
+   the Bx-By plane, from the angle `min_angle` to the angle `max_angle`
+   (in radians, measured from Bx towards By), end points included. This is the
+   beam pattern of a typical planar scanning LIDAR.
+   @pre `num_beams` >= 2.  */
+  static Eigen::Matrix3Xd MakePlanarBeamDirections(int num_beams,
+                                                   double min_angle,
+                                                   double max_angle);
+
+  /** Returns the id of the frame to which the sensor is affixed.  */
+  geometry::FrameId parent_frame_id() const { return parent_frame_id_; }
+
+  /** Returns `X_PB`.  */
+  const math::RigidTransformd& X_PB() const { return X_PB_; }
+
+  /** Returns the unit directions of the beams, expressed in B.  */
+  const Eigen::Matrix3Xd& beam_directions() const { return n_Bs_; }
+
+  /** Returns the number of beams.  */
+  int num_beams() const { return static_cast<int>(n_Bs_.cols()); }
+
+  /** Returns the maximum range of the sensor.  */
+  double max_range() const { return max_range_; }
+
+  /** Returns the geometry::QueryObject<double>-valued input port.  */
+  const InputPort<double>& query_object_input_port() const;
+
+  /** Returns the vector-valued output port that reports the range of each
+   beam.  */
+  const OutputPort<double>& depth_output_port() const;
+
+ private:
+  void CalcDepth(const Context<double>& context,
+                 BasicVector<double>* depth) const;
+
+  const InputPort<double>* query_object_input_port_{};
+  const OutputPort<double>* depth_output_port_{};
+
+  // The identifier for the parent frame `P`.
+  const geometry::FrameId parent_frame_id_;
+  // The pose of the sensor's B frame relative to its parent frame P.
+  const math::RigidTransformd X_PB_;
+  // The unit beam directions, expressed in B.
+  Eigen::Matrix3Xd n_Bs_;
+  const double max_range_;
+};
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
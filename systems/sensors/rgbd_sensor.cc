@@ -158,11 +158,17 @@ void RgbdSensor::ConvertDepth32FTo16U(const ImageDepth32F& d32,
   // Convert to mm and 16bits.
   const float kDepth16UOverflowDistance =
       std::numeric_limits<uint16_t>::max() / 1000.;
-  for (int w = 0; w < d16->width(); w++) {
-    for (int h = 0; h < d16->height(); h++) {
-      const double dist = std::min(d32.at(w, h)[0], kDepth16UOverflowDistance);
-      d16->at(w, h)[0] = static_cast<uint16_t>(dist * 1000);
-    }
+  DRAKE_DEMAND(d32.width() == d16->width() && d32.height() == d16->height());
+  // Both images store their (single-channel) pixels contiguously in the same
+  // order, so we convert them as flat arrays; the branch-free loop body lets
+  // the compiler vectorize it.
+  const int size = d16->size();
+  if (size == 0) return;
+  const float* const src = d32.at(0, 0);
+  uint16_t* const dst = d16->at(0, 0);
+  for (int i = 0; i < size; ++i) {
+    const double dist = std::min(src[i], kDepth16UOverflowDistance);
+    dst[i] = static_cast<uint16_t>(dist * 1000);
   }
 }
 
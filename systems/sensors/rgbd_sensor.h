@@ -234,6 +234,16 @@ class RgbdSensor final : public LeafSystem<double> {
  - label_image
  - body_pose_in_world
  @endsystem
+
+ <h3>Pipelined rendering</h3>
+
+ The zero-order holds sample each image exactly once per period. When the
+ sensor's renderer is a RenderEngineGl constructed with
+ geometry::render::RenderEngineGlParams::pipelined_readback set, the image
+ sampled at time tₖ is therefore the one drawn at tₖ₋₁: the outputs carry an
+ explicit latency of one `period`, and in exchange the simulation never waits
+ for the GPU to finish an image. (At the first sample, t₀, there is no earlier
+ image, and the sensor waits for its own.)
  */
 class RgbdSensorDiscrete final : public systems::Diagram<double> {
  public:
@@ -171,6 +171,59 @@ GTEST_TEST(TestImage, ResizeTest) {
   EXPECT_EQ(dut.size(), kWidthResized * kHeightResized * kNumChannels);
 }
 
+// Copies own their pixels; writing through a pointer obtained before the copy
+// doesn't affect the copy.
+GTEST_TEST(TestImage, CopyTest) {
+  ImageRgba8U image(kWidth, kHeight, kInitialValue);
+  uint8_t* pixel = image.at(1, 2);
+  const ImageRgba8U copy(image);
+  EXPECT_NE(copy.at(1, 2), image.at(1, 2));
+  *pixel = 7;
+  EXPECT_EQ(image.at(1, 2)[0], 7);
+  EXPECT_EQ(copy.at(1, 2)[0], kInitialValue);
+}
+
+// The buffer pool is disabled by default. Once enabled, it recycles released
+// buffers of exactly the requested size, within its byte limit.
+GTEST_TEST(TestImage, BufferPoolTest) {
+  using Pool = internal::ImageBufferPool<float>;
+  const size_t kImageBytes = kWidth * kHeight * sizeof(float);
+  { ImageDepth32F image(kWidth, kHeight); }
+  EXPECT_EQ(Pool::num_pooled(), 0);
+
+  Pool::set_max_bytes(kImageBytes);
+  const float* pixels{};
+  {
+    ImageDepth32F image(kWidth, kHeight);
+    pixels = image.at(0, 0);
+  }
+  EXPECT_EQ(Pool::num_pooled(), 1);
+  EXPECT_EQ(Pool::num_pooled_bytes(), kImageBytes);
+
+  // An image of a different size doesn't take the buffer (and its own buffer
+  // exceeds the limit once released).
+  {
+    ImageDepth32F smaller(kWidth, kHeight - 1);
+    EXPECT_EQ(Pool::num_pooled(), 1);
+  }
+  EXPECT_EQ(Pool::num_pooled(), 1);
+
+  {
+    ImageDepth32F image(kWidth, kHeight, 2.0f);
+    EXPECT_EQ(image.at(0, 0), pixels);
+    EXPECT_EQ(image.at(kWidth - 1, kHeight - 1)[0], 2.0f);
+    EXPECT_EQ(Pool::num_pooled(), 0);
+    // Of the two buffers released at the end of this scope, only one fits.
+    ImageDepth32F other(kWidth, kHeight);
+  }
+
+  // Disabling the pool releases the retained buffers.
+  EXPECT_EQ(Pool::num_pooled(), 1);
+  Pool::set_max_bytes(0);
+  EXPECT_EQ(Pool::num_pooled(), 0);
+  EXPECT_EQ(Pool::num_pooled_bytes(), 0);
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
@@ -1,9 +1,12 @@
 #include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
+#include <algorithm>
+
 #include <gtest/gtest.h>
 
 #include "drake/lcmt_image_array.hpp"
 #include "drake/systems/sensors/image.h"
+#include "drake/systems/sensors/lcm_image_array_to_images.h"
 
 namespace drake {
 namespace systems {
@@ -37,6 +40,12 @@ lcmt_image_array SetUpInputAndOutput(
       Eval<lcmt_image_array>(*context);
 }
 
+template <PixelType kPixelType>
+bool ImagesEqual(const Image<kPixelType>& a, const Image<kPixelType>& b) {
+  return a.width() == b.width() && a.height() == b.height() &&
+         std::equal(a.at(0, 0), a.at(0, 0) + a.size(), b.at(0, 0));
+}
+
 GTEST_TEST(ImageToLcmImageArrayT, ValidTest) {
   ImageRgba8U color_image(kImageWidth, kImageHeight);
   ImageDepth32F depth_image(kImageWidth, kImageHeight);
@@ -111,6 +120,60 @@ GTEST_TEST(ImageToLcmImageArrayT, ValidTest) {
          lcmt_image::COMPRESSION_METHOD_NOT_COMPRESSED);
 }
 
+// PNG applies to the 8- and 16-bit images, while the 32-bit depth image falls
+// back to zlib. The message doesn't depend on the parallelism, and it decodes
+// back to the original images.
+GTEST_TEST(ImageToLcmImageArrayT, PngAndParallelism) {
+  ImageRgba8U color_image(kImageWidth, kImageHeight);
+  ImageDepth32F depth_image(kImageWidth, kImageHeight);
+  ImageLabel16I label_image(kImageWidth, kImageHeight);
+  for (int y = 0; y < kImageHeight; ++y) {
+    for (int x = 0; x < kImageWidth; ++x) {
+      for (int c = 0; c < 4; ++c) {
+        color_image.at(x, y)[c] = 10 * x + y + 60 * c;
+      }
+      depth_image.at(x, y)[0] = 0.25f * x + y;
+      label_image.at(x, y)[0] = 300 * x - y;
+    }
+  }
+
+  ImageToLcmImageArrayT dut(kColorFrameName, kDepthFrameName,
+                            kLabelFrameName);
+  dut.set_compression_method(ImageToLcmImageArrayT::CompressionMethod::kPng);
+  EXPECT_EQ(dut.compression_method(),
+            ImageToLcmImageArrayT::CompressionMethod::kPng);
+  const lcmt_image_array serial =
+      SetUpInputAndOutput(&dut, color_image, depth_image, label_image);
+  ASSERT_EQ(serial.images.size(), 3);
+  for (const lcmt_image& image : serial.images) {
+    EXPECT_EQ(image.data.size(), image.size);
+    EXPECT_EQ(image.compression_method,
+              image.pixel_format == lcmt_image::PIXEL_FORMAT_DEPTH
+                  ? lcmt_image::COMPRESSION_METHOD_ZLIB
+                  : lcmt_image::COMPRESSION_METHOD_PNG);
+  }
+
+  dut.set_parallelism(Parallelism(3));
+  const lcmt_image_array parallel =
+      SetUpInputAndOutput(&dut, color_image, depth_image, label_image);
+  ASSERT_EQ(parallel.images.size(), 3);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(parallel.images[i].header.frame_name,
+              serial.images[i].header.frame_name);
+    EXPECT_EQ(parallel.images[i].data, serial.images[i].data);
+  }
+
+  LcmImageArrayToImages decoder;
+  auto decoder_context = decoder.CreateDefaultContext();
+  decoder.image_array_t_input_port().FixValue(decoder_context.get(), serial);
+  EXPECT_TRUE(ImagesEqual(
+      decoder.color_image_output_port().Eval<ImageRgba8U>(*decoder_context),
+      color_image));
+  EXPECT_TRUE(ImagesEqual(
+      decoder.depth_image_output_port().Eval<ImageDepth32F>(*decoder_context),
+      depth_image));
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
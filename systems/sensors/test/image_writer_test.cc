@@ -2,9 +2,11 @@
 
 #include <unistd.h>
 
+#include <cstring>
 #include <fstream>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <vtkImageData.h>
@@ -690,6 +692,104 @@ TEST_F(ImageWriterTest, WritesGreyImage) {
   TestWritingImageOnPort<PixelType::kGrey8U>();
 }
 
+// Publishes the color image on a port configured by `format` at each of
+// `times`, returning the names of the files the images should go to.
+std::vector<std::string> PublishColorImages(ImageWriter* writer,
+                                            const std::string& format,
+                                            const std::vector<double>& times) {
+  ImageWriterTester tester(*writer);
+  const std::string port_name = "color";
+  const auto& port = writer->DeclareImageInputPort<PixelType::kRgba8U>(
+      port_name, format, 0.1, 0.0);
+  auto events = writer->AllocateCompositeEventCollection();
+  auto context = writer->AllocateContext();
+  port.FixValue(context.get(), test_image<PixelType::kRgba8U>());
+  context->SetTime(0.);
+  writer->CalcNextUpdateTime(*context, events.get());
+  std::vector<std::string> names;
+  for (double time : times) {
+    context->SetTime(time);
+    names.push_back(tester.MakeFileName(
+        tester.port_format(port.get_index()), PixelType::kRgba8U, time,
+        port_name, tester.port_count(port.get_index())));
+    writer->Publish(*context, events->get_publish_events());
+  }
+  return names;
+}
+
+// With asynchronous writing, the images are all written by the time Flush()
+// returns.
+TEST_F(ImageWriterTest, AsyncWriting) {
+  ImageWriter writer;
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.SetAsyncWriting(0, 1),
+                              ".*must be positive");
+  writer.SetAsyncWriting(2, 1);
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.SetAsyncWriting(2, 1),
+                              ".*already enabled");
+
+  filesystem::path path(temp_dir());
+  path.append("async_{time_usec}");
+  const std::vector<std::string> names =
+      PublishColorImages(&writer, path.string(), {0.5, 0.6, 0.7, 0.8});
+  writer.Flush();
+  EXPECT_EQ(writer.num_dropped_images(), 0);
+  for (const std::string& name : names) {
+    add_file_for_cleanup(name);
+    EXPECT_TRUE(MatchesFileOnDisk(name, test_image<PixelType::kRgba8U>()));
+  }
+}
+
+// Archived images become the members of a tar file, named by their would-be
+// file names.
+TEST_F(ImageWriterTest, ArchiveOutput) {
+  ImageWriter writer;
+  filesystem::path prefix(temp_dir());
+  prefix.append("archive");
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.SetArchiveOutput(prefix.string(), 0),
+                              ".*must be positive");
+  writer.SetArchiveOutput(prefix.string(), 1 << 20);
+  // Depth images are written as .tiff, which can't be archived.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      writer.DeclareImageInputPort<PixelType::kDepth32F>(
+          "depth", temp_dir() + "/depth", 0.1, 0.0),
+      ".*only images written as .png can be archived");
+
+  const std::vector<std::string> names = PublishColorImages(
+      &writer, temp_dir() + "/archived_{count}", {0.5, 0.6, 0.7});
+  writer.Flush();
+  const std::string archive_name = prefix.string() + "-00000.tar";
+  add_file_for_cleanup(archive_name);
+  for (const std::string& name : names) {
+    EXPECT_FALSE(filesystem::exists({name}));
+  }
+
+  // Walks the archive's headers: the name is at offset 0 (preceded by the
+  // prefix at offset 345, if any) and the (octal) size at offset 124 of each
+  // 512-byte header, and each member's data is padded to a multiple of 512
+  // bytes.
+  std::ifstream archive(archive_name, std::ios::binary);
+  ASSERT_TRUE(archive.good());
+  for (const std::string& name : names) {
+    char header[512];
+    archive.read(header, 512);
+    ASSERT_TRUE(archive.good());
+    const std::string member_prefix(header + 345, strnlen(header + 345, 155));
+    const std::string member_name(header, strnlen(header, 100));
+    EXPECT_EQ(member_prefix.empty() ? member_name
+                                    : member_prefix + "/" + member_name,
+              name.substr(1));
+    const int size = std::stoi(std::string(header + 124, 11), nullptr, 8);
+    std::string data(size, '\0');
+    archive.read(data.data(), size);
+    archive.ignore((512 - size % 512) % 512);
+    // The member is the PNG that would have been written to the file.
+    const std::string extracted = temp_name();
+    std::ofstream(extracted, std::ios::binary) << data;
+    EXPECT_TRUE(
+        MatchesFileOnDisk(extracted, test_image<PixelType::kRgba8U>()));
+  }
+}
+
 // Evaluate the stand-alone test for color images.
 TEST_F(ImageWriterTest, SaveToPng_Color) {
   ImageRgba8U color_image = test_image<PixelType::kRgba8U>();
@@ -0,0 +1,106 @@
+#include "drake/systems/sensors/lidar_sensor.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/geometry/geometry_instance.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/math/rotation_matrix.h"
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+namespace {
+
+using Eigen::Matrix3Xd;
+using Eigen::Vector3d;
+using geometry::Box;
+using geometry::GeometryInstance;
+using geometry::ProximityProperties;
+using geometry::SceneGraph;
+using geometry::SourceId;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+
+GTEST_TEST(LidarSensorTest, MakePlanarBeamDirections) {
+  const Matrix3Xd n_Bs =
+      LidarSensor::MakePlanarBeamDirections(3, -M_PI / 2, M_PI / 2);
+  Matrix3Xd expected(3, 3);
+  expected << 0, 1, 0,
+              -1, 0, 1,
+              0, 0, 0;
+  EXPECT_TRUE(CompareMatrices(n_Bs, expected, 1e-15));
+}
+
+GTEST_TEST(LidarSensorTest, Construction) {
+  const auto world_id = SceneGraph<double>::world_frame_id();
+  Matrix3Xd n_Bs(3, 2);
+  n_Bs << 2, 0,
+          0, 0,
+          0, 3;
+  const LidarSensor dut(world_id, RigidTransformd(Vector3d(1, 2, 3)), n_Bs,
+                        10);
+  EXPECT_EQ(dut.parent_frame_id(), world_id);
+  EXPECT_EQ(dut.num_beams(), 2);
+  EXPECT_EQ(dut.max_range(), 10);
+  EXPECT_TRUE(CompareMatrices(dut.X_PB().translation(), Vector3d(1, 2, 3)));
+  // The directions are normalized.
+  Matrix3Xd expected_n_Bs(3, 2);
+  expected_n_Bs << 1, 0,
+                   0, 0,
+                   0, 1;
+  EXPECT_TRUE(CompareMatrices(dut.beam_directions(), expected_n_Bs));
+  EXPECT_EQ(dut.depth_output_port().size(), 2);
+
+  // Zero directions and non-positive ranges are rejected.
+  EXPECT_THROW(LidarSensor(world_id, {}, Matrix3Xd::Zero(3, 1), 10),
+               std::exception);
+  EXPECT_THROW(LidarSensor(world_id, {}, n_Bs, 0), std::exception);
+}
+
+// A sensor at the world origin scans a unit cube centered at (2, 0, 0).
+GTEST_TEST(LidarSensorTest, Depth) {
+  DiagramBuilder<double> builder;
+  auto* scene_graph = builder.AddSystem<SceneGraph<double>>();
+  const SourceId source_id = scene_graph->RegisterSource("lidar_test");
+  const auto geometry_id = scene_graph->RegisterAnchoredGeometry(
+      source_id,
+      std::make_unique<GeometryInstance>(RigidTransformd(Vector3d(2, 0, 0)),
+                                         std::make_unique<Box>(1, 1, 1),
+                                         "box"));
+  scene_graph->AssignRole(source_id, geometry_id, ProximityProperties());
+
+  const double kMaxRange = 5;
+  const Matrix3Xd n_Bs =
+      LidarSensor::MakePlanarBeamDirections(3, -M_PI / 2, M_PI / 2);
+  // The second sensor is turned by 90° about Wz, so that its first beam looks
+  // along +Wx.
+  const RigidTransformd X_WB(RotationMatrixd::MakeZRotation(M_PI / 2));
+  auto* lidar = builder.AddSystem<LidarSensor>(
+      SceneGraph<double>::world_frame_id(), RigidTransformd(), n_Bs,
+      kMaxRange);
+  auto* turned_lidar = builder.AddSystem<LidarSensor>(
+      SceneGraph<double>::world_frame_id(), X_WB, n_Bs, kMaxRange);
+  builder.Connect(scene_graph->get_query_output_port(),
+                  lidar->query_object_input_port());
+  builder.Connect(scene_graph->get_query_output_port(),
+                  turned_lidar->query_object_input_port());
+  const auto diagram = builder.Build();
+  const auto context = diagram->CreateDefaultContext();
+
+  const Eigen::VectorXd depth = lidar->depth_output_port().Eval(
+      lidar->GetMyContextFromRoot(*context));
+  EXPECT_TRUE(CompareMatrices(depth, Vector3d(kMaxRange, 1.5, kMaxRange)));
+  const Eigen::VectorXd turned_depth = turned_lidar->depth_output_port().Eval(
+      turned_lidar->GetMyContextFromRoot(*context));
+  EXPECT_TRUE(
+      CompareMatrices(turned_depth, Vector3d(1.5, kMaxRange, kMaxRange)));
+}
+
+}  // namespace
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
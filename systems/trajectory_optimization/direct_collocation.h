@@ -1,7 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <variant>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/solvers/constraint.h"
@@ -135,14 +137,35 @@ class DirectCollocationConstraint : public solvers::Constraint {
               VectorX<symbolic::Expression>* y) const override;
 
  private:
+  // The memory that one evaluation of the dynamics writes to. The same
+  // constraint is bound at every knot point, and a solver may evaluate those
+  // bindings concurrently (see
+  // solvers::MathematicalProgram::set_evaluation_parallelism()), so each
+  // call to DoEval() borrows its own Scratch from a pool.
+  struct Scratch {
+    std::unique_ptr<Context<AutoDiffXd>> context;
+    // Aliases the fixed value of input_port_ in `context` (if any).
+    FixedInputPortValue* input_port_value{nullptr};
+    std::unique_ptr<ContinuousState<AutoDiffXd>> derivatives;
+  };
+
+  // Takes a Scratch from the pool, or makes a new one (from context_) if the
+  // pool is empty.
+  std::unique_ptr<Scratch> AcquireScratch() const;
+
+  // Returns `scratch` to the pool.
+  void ReleaseScratch(std::unique_ptr<Scratch> scratch) const;
+
   void dynamics(const AutoDiffVecXd& state, const AutoDiffVecXd& input,
-                AutoDiffVecXd* xdot) const;
+                Scratch* scratch, AutoDiffVecXd* xdot) const;
 
   const std::unique_ptr<System<AutoDiffXd>> system_;
+  // The prototype of every Scratch::context; it is never evaluated.
   std::unique_ptr<Context<AutoDiffXd>> context_;
   const InputPort<AutoDiffXd>* input_port_{nullptr};
-  FixedInputPortValue* input_port_value_{nullptr};
-  std::unique_ptr<ContinuousState<AutoDiffXd>> derivatives_;
+
+  mutable std::mutex scratch_mutex_;
+  mutable std::vector<std::unique_ptr<Scratch>> scratch_pool_;
 
   const int num_states_{0};
   const int num_inputs_{0};
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <cstddef>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <utility>
@@ -22,6 +24,93 @@ using trajectories::PiecewisePolynomial;
 
 namespace {
 
+// The memory that one evaluation of a DirectTranscriptionConstraint writes
+// to: a copy of the prototype context, an integrator that advances it, and
+// the result of a discrete update.
+struct TranscriptionScratch {
+  std::unique_ptr<Context<AutoDiffXd>> context;
+  // Aliases the fixed input port value in `context` (if any).
+  FixedInputPortValue* input_port_value{nullptr};
+  std::unique_ptr<IntegratorBase<AutoDiffXd>> integrator;
+  std::unique_ptr<DiscreteValues<AutoDiffXd>> discrete_state;
+};
+
+// A pool of TranscriptionScratch shared by the constraints at all of the knot
+// points. A solver may evaluate those constraints concurrently (see
+// solvers::MathematicalProgram::set_evaluation_parallelism()), so each
+// evaluation borrows its own scratch, and the pool grows to the number of
+// concurrent evaluations.
+class TranscriptionScratchPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TranscriptionScratchPool)
+
+  // @param system The system describing the dynamics. The reference must
+  // remain valid for the lifetime of this pool.
+  // @param context The prototype of every scratch context, with its input
+  // port (if any) fixed. The reference must remain valid for the lifetime of
+  // this pool, and the context must not change.
+  // @param input_port The input port whose value the constraints set, or
+  // nullptr if there is none.
+  // @param fixed_timestep Defines the explicit Euler integration timestep for
+  // systems with continuous state variables.
+  TranscriptionScratchPool(const System<AutoDiffXd>& system,
+                           const Context<AutoDiffXd>& context,
+                           const InputPort<AutoDiffXd>* input_port,
+                           double fixed_timestep)
+      : system_(system),
+        context_(context),
+        input_port_(input_port),
+        fixed_timestep_(fixed_timestep) {}
+
+  const System<AutoDiffXd>& system() const { return system_; }
+  const Context<AutoDiffXd>& context() const { return context_; }
+
+  // Takes a scratch from the pool, or makes a new one if the pool is empty.
+  std::unique_ptr<TranscriptionScratch> Acquire() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!pool_.empty()) {
+        std::unique_ptr<TranscriptionScratch> scratch =
+            std::move(pool_.back());
+        pool_.pop_back();
+        return scratch;
+      }
+    }
+    auto scratch = std::make_unique<TranscriptionScratch>();
+    scratch->context = context_.Clone();
+    if (input_port_ != nullptr) {
+      scratch->input_port_value =
+          scratch->context->MaybeGetMutableFixedInputPortValue(
+              input_port_->get_index());
+      DRAKE_DEMAND(scratch->input_port_value != nullptr);
+    }
+    if (context_.has_only_discrete_state()) {
+      scratch->discrete_state = system_.AllocateDiscreteVariables();
+    } else {
+      scratch->integrator =
+          std::make_unique<ExplicitEulerIntegrator<AutoDiffXd>>(
+              system_, fixed_timestep_, scratch->context.get());
+      scratch->integrator->Initialize();
+    }
+    return scratch;
+  }
+
+  // Returns `scratch` to the pool.
+  void Release(std::unique_ptr<TranscriptionScratch> scratch) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pool_.push_back(std::move(scratch));
+  }
+
+ private:
+  const System<AutoDiffXd>& system_;
+  const Context<AutoDiffXd>& context_;
+  const InputPort<AutoDiffXd>* const input_port_;
+  const double fixed_timestep_;
+
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<TranscriptionScratch>> pool_;
+};
+
 // Implements a constraint on the defect between the state variables
 // advanced for one discrete step or one integration for a fixed timestep,
 // and the decision variable representing the next state.
@@ -29,14 +118,8 @@ class DirectTranscriptionConstraint : public solvers::Constraint {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DirectTranscriptionConstraint)
 
-  // @param system The system describing the dynamics of the constraint.
-  // The reference must remain valid for the lifetime of this constraint.
-  // @param context A mutable pointer to a context that will be written to in
-  // order to perform the dynamics evaluations.  This context must also
-  // stay valid for the lifetime of this constraint.
-  // @param input_port_value A pre-allocated mutable pointer for writing the
-  // input value, which must be assigned as an input to @p context.  It must
-  // also remain valid.
+  // @param scratch_pool The memory to perform the dynamics evaluations in,
+  // shared with the constraints at the other knot points.
   // @param num_states the integer size of the discrete or continuous
   // state vector being optimized.
   // @param num_inputs the integer size of the input vector being optimized.
@@ -44,29 +127,23 @@ class DirectTranscriptionConstraint : public solvers::Constraint {
   // constraint is evaluated.
   // @param fixed_timestep Defines the explicit Euler integration
   // timestep for systems with continuous state variables.
-  DirectTranscriptionConstraint(IntegratorBase<AutoDiffXd>* integrator,
-                                FixedInputPortValue* input_port_value,
-                                int num_states, int num_inputs,
-                                double evaluation_time, TimeStep fixed_timestep)
+  DirectTranscriptionConstraint(
+      std::shared_ptr<TranscriptionScratchPool> scratch_pool, int num_states,
+      int num_inputs, double evaluation_time, TimeStep fixed_timestep)
       : Constraint(num_states, num_inputs + 2 * num_states,
                    Eigen::VectorXd::Zero(num_states),
                    Eigen::VectorXd::Zero(num_states)),
-        integrator_(integrator),
-        input_port_value_(input_port_value),
+        scratch_pool_(std::move(scratch_pool)),
         num_states_(num_states),
         num_inputs_(num_inputs),
         evaluation_time_(evaluation_time),
         fixed_timestep_(fixed_timestep.value) {
     DRAKE_DEMAND(evaluation_time >= 0.0);
-    const Context<AutoDiffXd>& context = integrator->get_context();
+    const Context<AutoDiffXd>& context = scratch_pool_->context();
     DRAKE_DEMAND(context.has_only_discrete_state() ||
                  context.has_only_continuous_state());
-    DRAKE_DEMAND(context.num_input_ports() == 0 ||
-                 input_port_value_ != nullptr);
 
-    if (context.has_only_discrete_state()) {
-      discrete_state_ = integrator_->get_system().AllocateDiscreteVariables();
-    } else {
+    if (!context.has_only_discrete_state()) {
       DRAKE_DEMAND(fixed_timestep_ > 0.0);
     }
 
@@ -96,26 +173,29 @@ class DirectTranscriptionConstraint : public solvers::Constraint {
     const auto state = x.segment(num_inputs_, num_states_);
     const auto next_state = x.tail(num_states_);
 
-    Context<AutoDiffXd>* context = integrator_->get_mutable_context();
+    std::unique_ptr<TranscriptionScratch> scratch = scratch_pool_->Acquire();
+    Context<AutoDiffXd>* context = scratch->context.get();
     context->SetTime(evaluation_time_);
-    if (context->num_input_ports() > 0) {
-      input_port_value_->GetMutableVectorData<AutoDiffXd>()->SetFromVector(
-          input);
+    if (scratch->input_port_value != nullptr) {
+      scratch->input_port_value->GetMutableVectorData<AutoDiffXd>()
+          ->SetFromVector(input);
     }
 
     if (context->has_only_continuous_state()) {
       // Compute the defect between next_state and the explicit Euler
       // integration.
       context->SetContinuousState(state);
-      DRAKE_THROW_UNLESS(integrator_->IntegrateWithSingleFixedStepToTime(
-          evaluation_time_ + fixed_timestep_));
+      DRAKE_THROW_UNLESS(
+          scratch->integrator->IntegrateWithSingleFixedStepToTime(
+              evaluation_time_ + fixed_timestep_));
       *y = next_state - context->get_continuous_state_vector().CopyToVector();
     } else {
       context->SetDiscreteState(0, state);
-      integrator_->get_system().CalcDiscreteVariableUpdates(
-          *context, discrete_state_.get());
-      *y = next_state - discrete_state_->get_vector(0).get_value();
+      scratch_pool_->system().CalcDiscreteVariableUpdates(
+          *context, scratch->discrete_state.get());
+      *y = next_state - scratch->discrete_state->get_vector(0).get_value();
     }
+    scratch_pool_->Release(std::move(scratch));
   }
 
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>&,
@@ -125,9 +205,7 @@ class DirectTranscriptionConstraint : public solvers::Constraint {
   }
 
  private:
-  IntegratorBase<AutoDiffXd>* const integrator_;
-  std::unique_ptr<DiscreteValues<AutoDiffXd>> discrete_state_;
-  FixedInputPortValue* const input_port_value_{nullptr};
+  const std::shared_ptr<TranscriptionScratchPool> scratch_pool_;
 
   const int num_states_{0};
   const int num_inputs_{0};
@@ -331,26 +409,25 @@ void DirectTranscription::AddAutodiffDynamicConstraints(
           "of abstract ports is not supported.");
     }
 
-    // Provide a fixed value for the input port and keep an alias around.
-    input_port_value_ = &input_port_->FixValue(
+    // Provide a fixed value for the input port; each scratch copy of the
+    // context inherits it.
+    input_port_->FixValue(
         context_.get(),
         system_->AllocateInputVector(*input_port_)->get_value());
   }
 
-  integrator_ = std::make_unique<ExplicitEulerIntegrator<AutoDiffXd>>(
-      *system_, fixed_timestep(), context_.get());
-  integrator_->Initialize();
+  auto scratch_pool = std::make_shared<TranscriptionScratchPool>(
+      *system_, *context_, input_port_, fixed_timestep());
 
   // For N-1 timesteps, add a constraint which depends on the breakpoint
   // along with the state and input vectors at that breakpoint and the
   // next.
   for (int i = 0; i < N() - 1; i++) {
-    // Add the dynamic constraints.
-    // Note that these constraints all share a context and inout_port_value,
-    // so should not be evaluated in parallel.
+    // Add the dynamic constraints. They share the scratch pool, which lets
+    // them be evaluated in parallel.
     auto constraint = std::make_shared<DirectTranscriptionConstraint>(
-        integrator_.get(), input_port_value_, num_states(), num_inputs(),
-        i * fixed_timestep(), TimeStep{fixed_timestep()});
+        scratch_pool, num_states(), num_inputs(), i * fixed_timestep(),
+        TimeStep{fixed_timestep()});
 
     prog().AddConstraint(constraint, {input(i), state(i), state(i + 1)});
   }
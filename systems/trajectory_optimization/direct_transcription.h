@@ -172,12 +172,11 @@ class DirectTranscription : public MultipleShooting {
 
   // AutoDiff versions of the System components (for the constraints).
   // These values are allocated iff the dynamic constraints are allocated
-  // as DirectTranscriptionConstraint, otherwise they are nullptr.
+  // as DirectTranscriptionConstraint, otherwise they are nullptr. The
+  // constraints evaluate copies of context_.
   std::unique_ptr<const System<AutoDiffXd>> system_;
   std::unique_ptr<Context<AutoDiffXd>> context_;
-  std::unique_ptr<IntegratorBase<AutoDiffXd>> integrator_;
   const InputPort<AutoDiffXd>* input_port_{nullptr};
-  FixedInputPortValue* input_port_value_{nullptr};  // Owned by the context.
 
   const bool discrete_time_system_{false};
 };
@@ -6,6 +6,7 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/parallelism.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/examples/rimless_wheel/rimless_wheel.h"
@@ -564,6 +565,56 @@ GTEST_TEST(DirectCollocation, DoubleIntegratorTest) {
     EXPECT_NEAR(result.GetSolution(dircol.input(i++))(0), -1.0, 1e-5);
 }
 
+// The knot points' collocation constraints share one evaluator; evaluating
+// them concurrently must give the same values as evaluating them in turn.
+GTEST_TEST(DirectCollocation, ConcurrentConstraintEvaluation) {
+  const std::unique_ptr<LinearSystem<double>> system = MakeSimpleLinearSystem();
+  const auto context = system->CreateDefaultContext();
+  const int kNumSampleTimes = 21;
+  DirectCollocation dircol(system.get(), *context, kNumSampleTimes, 0.01, 0.1);
+  auto& prog = dircol.prog();
+  prog.SetInitialGuessForAllVariables(
+      Eigen::VectorXd::LinSpaced(prog.num_vars(), 0.01, 1.0));
+
+  const std::vector<solvers::Binding<solvers::Constraint>>& constraints =
+      prog.generic_constraints();
+  const int num_constraints = static_cast<int>(constraints.size());
+  std::vector<Eigen::VectorXd> expected(num_constraints);
+  for (int i = 0; i < num_constraints; ++i) {
+    expected[i] = prog.EvalBindingAtInitialGuess(constraints[i]);
+  }
+  std::vector<Eigen::VectorXd> actual(num_constraints);
+  StaticParallelForIndexLoop(
+      Parallelism(4), 0, num_constraints, [&](int, int i) {
+        actual[i] = prog.EvalBindingAtInitialGuess(constraints[i]);
+      });
+  for (int i = 0; i < num_constraints; ++i) {
+    EXPECT_TRUE(CompareMatrices(actual[i], expected[i], 0.0));
+  }
+
+  // The double integrator's solution doesn't depend on whether the solver
+  // evaluates the constraints in parallel.
+  const auto double_integrator = MakeDoubleIntegrator();
+  auto di_context = double_integrator->CreateDefaultContext();
+  DirectCollocation di_dircol(double_integrator.get(), *di_context, 10, 0.05,
+                              2.0);
+  auto& di_prog = di_dircol.prog();
+  di_dircol.AddEqualTimeIntervalsConstraints();
+  di_dircol.AddConstraintToAllKnotPoints(Vector1d(-1.0) <= di_dircol.input());
+  di_dircol.AddConstraintToAllKnotPoints(di_dircol.input() <= Vector1d(1.0));
+  di_prog.AddLinearConstraint(di_dircol.final_state().array() == 0.0);
+  di_prog.AddLinearConstraint(di_dircol.initial_state() ==
+                              Eigen::Vector2d(-1.0, 0.0));
+  di_dircol.AddFinalCost(di_dircol.time().cast<symbolic::Expression>());
+  const solvers::MathematicalProgramResult serial = Solve(di_prog);
+  di_prog.set_evaluation_parallelism(Parallelism(4));
+  const solvers::MathematicalProgramResult parallel = Solve(di_prog);
+  ASSERT_TRUE(serial.is_success());
+  ASSERT_TRUE(parallel.is_success());
+  EXPECT_TRUE(CompareMatrices(parallel.GetSolution(), serial.GetSolution(),
+                              1e-12));
+}
+
 // Tests that the double integrator without input limits results in minimal
 // time.
 GTEST_TEST(DirectCollocation, MinimumTimeTest) {
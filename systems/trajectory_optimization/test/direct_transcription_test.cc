@@ -9,6 +9,7 @@
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/find_resource.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/autodiff.h"
 #include "drake/multibody/parsing/parser.h"
@@ -550,6 +551,34 @@ GTEST_TEST(DirectTranscriptionTest, DiscreteTimeConstraintTest) {
   }
 }
 
+// The knot points' dynamic constraints share their scratch memory; evaluating
+// them concurrently must give the same values as evaluating them in turn.
+GTEST_TEST(DirectTranscriptionTest, ConcurrentConstraintEvaluation) {
+  const double kTimeStep = 1.0;
+  CubicPolynomialSystem<double> system(kTimeStep);
+  const auto context = system.CreateDefaultContext();
+  const int kNumSampleTimes = 21;
+  DirectTranscription dirtran(&system, *context, kNumSampleTimes);
+  auto& prog = dirtran.prog();
+  prog.SetInitialGuessForAllVariables(
+      Eigen::VectorXd::LinSpaced(prog.num_vars(), 0.1, 2.0));
+
+  const std::vector<solvers::Binding<solvers::Constraint>>&
+      dynamic_constraints = prog.generic_constraints();
+  const int num_constraints = static_cast<int>(dynamic_constraints.size());
+  std::vector<Eigen::VectorXd> actual(num_constraints);
+  StaticParallelForIndexLoop(
+      Parallelism(4), 0, num_constraints, [&](int, int i) {
+        actual[i] = prog.EvalBindingAtInitialGuess(dynamic_constraints[i]);
+      });
+  using std::pow;
+  for (int i = 0; i < num_constraints; i++) {
+    EXPECT_EQ(actual[i][0],
+              prog.GetInitialGuess(dirtran.state(i + 1)[0]) -
+                  pow(prog.GetInitialGuess(dirtran.state(i)[0]), 3.0));
+  }
+}
+
 // This example will not use the symbolic constraints (because it has nonlinear
 // dynamics).  It tests DirectTranscriptionConstraint with a continuous-time
 // system.
@@ -24,6 +24,7 @@ _ALLOWED_EXTERNALS = [
     "csdp",
     "double_conversion",
     "dreal",
+    "egl",
     "fcl",
     "ghc_filesystem",
     "glew",
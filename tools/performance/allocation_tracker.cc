@@ -0,0 +1,36 @@
+#include "drake/tools/performance/allocation_tracker.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace drake {
+namespace tools {
+namespace performance {
+
+// Variance tracking is adapted from:
+// https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Welford's_online_algorithm
+void AllocationTracker::Update(int allocs, int64_t bytes) {
+  min_ = std::min(min_, allocs);
+  max_ = std::max(max_, allocs);
+  ++updates_;
+  double delta = allocs - mean_;
+  mean_ += delta / updates_;
+  m2_ += delta * (allocs - mean_);
+  mean_bytes_ += (bytes - mean_bytes_) / updates_;
+  max_bytes_ = std::max(max_bytes_, bytes);
+}
+
+void AllocationTracker::Report(benchmark::State* state) const {
+  state->counters["Allocs.min"] = min_;
+  state->counters["Allocs.max"] = max_;
+  state->counters["Allocs.mean"] = mean_;
+  state->counters["Allocs.stddev"] =
+      updates_ < 2 ? std::numeric_limits<double>::quiet_NaN()
+                   : std::sqrt(m2_ / (updates_ - 1));
+  state->counters["Bytes.mean"] = mean_bytes_;
+  state->counters["Bytes.max"] = static_cast<double>(max_bytes_);
+}
+
+}  // namespace performance
+}  // namespace tools
+}  // namespace drake
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/test_utilities/limit_malloc.h"
+
+namespace drake {
+namespace tools {
+namespace performance {
+
+/** Tracks simple streaming statistics of the heap allocations of each
+iteration of a benchmark, as observed by a drake::test::LimitMalloc guard, and
+reports them as benchmark counters.
+
+Example:
+@code
+for (auto _ : state) {
+  test::LimitMalloc guard({.max_num_allocations = 3});
+  plant.CalcInverseDynamics(*context, vdot, forces);
+  tracker.Update(guard);
+}
+tracker.Report(&state);
+@endcode
+
+The counters are "Allocs.min", "Allocs.max", "Allocs.mean" and
+"Allocs.stddev" for the number of allocations, and "Bytes.mean" and
+"Bytes.max" for the number of bytes requested by them. The statistics
+accumulate over every Update() since construction (or Reset()). */
+class AllocationTracker {
+ public:
+  AllocationTracker() = default;
+
+  /** Records the allocations observed so far by `guard`. */
+  void Update(const test::LimitMalloc& guard) {
+    Update(guard.num_allocations(), guard.num_bytes());
+  }
+
+  /** Records `allocs` allocations, of `bytes` bytes in total. */
+  void Update(int allocs, int64_t bytes = 0);
+
+  /** Adds the statistics to the counters of `state`. */
+  void Report(benchmark::State* state) const;
+
+  /** Discards all of the recorded allocations. */
+  void Reset() { *this = AllocationTracker(); }
+
+ private:
+  int min_{std::numeric_limits<int>::max()};
+  int max_{std::numeric_limits<int>::min()};
+  int updates_{};
+  double mean_{};
+  double m2_{};
+  double mean_bytes_{};
+  int64_t max_bytes_{};
+};
+
+}  // namespace performance
+}  // namespace tools
+}  // namespace drake
@@ -0,0 +1,42 @@
+# -*- python -*-
+
+load("@drake//tools/workspace:os.bzl", "determine_os")
+
+def _impl(repository_ctx):
+    os_result = determine_os(repository_ctx)
+
+    if os_result.error != None:
+        fail(os_result.error)
+
+    if os_result.is_macos:
+        # On macOS, no targets should depend on @egl.
+        build_flavor = "macos"
+    elif os_result.is_ubuntu or os_result.is_manylinux:
+        build_flavor = "ubuntu"
+        hdrs = [
+            "EGL/egl.h",
+            "EGL/eglext.h",
+            "EGL/eglplatform.h",
+        ]
+        for hdr in hdrs:
+            repository_ctx.symlink(
+                "/usr/include/{}".format(hdr),
+                "include/{}".format(hdr),
+            )
+    else:
+        fail("Operating system is NOT supported {}".format(os_result))
+
+    repository_ctx.symlink(
+        Label(
+            "@drake//tools/workspace/egl:package-{}.BUILD.bazel".format(
+                build_flavor,
+            ),
+        ),
+        "BUILD.bazel",
+    )
+
+egl_repository = repository_rule(
+    local = True,
+    configure = True,
+    implementation = _impl,
+)